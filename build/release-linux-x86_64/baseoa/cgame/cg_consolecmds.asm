@@ -0,0 +1,2345 @@
+export CG_PrintClientNumbers
+code
+proc CG_PrintClientNumbers 4 8
+ADDRGP4 $84
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $85
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $86
+ADDRGP4 $91
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $93
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $96
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $99
+ARGP4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $87
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $86
+LABELV $83
+endproc CG_PrintClientNumbers 4 8
+export CG_TargetCommand_f
+proc CG_TargetCommand_f 20 12
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $104
+ADDRGP4 $103
+JUMPV
+LABELV $104
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $106
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $103
+endproc CG_TargetCommand_f 20 12
+proc CG_SizeUp_f 4 8
+ADDRGP4 $109
+ARGP4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $107
+endproc CG_SizeUp_f 4 8
+proc CG_SizeDown_f 4 8
+ADDRGP4 $109
+ARGP4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+SUBI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $111
+endproc CG_SizeDown_f 4 8
+proc CG_Viewpos_f 0 20
+ADDRGP4 $114
+ARGP4
+ADDRGP4 cg+109252+24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 cg+109620+4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $113
+endproc CG_Viewpos_f 0 20
+proc CG_ScoresDown_f 0 4
+ADDRGP4 cg+110668
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $126
+ADDRGP4 cg+110668
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRGP4 cg+114784
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+110672
+CNSTI4 0
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRGP4 cg+114784
+CNSTI4 1
+ASGNI4
+LABELV $127
+LABELV $125
+endproc CG_ScoresDown_f 0 4
+proc CG_ScoresUp_f 0 0
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRGP4 cg+114784
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114792
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $140
+LABELV $139
+endproc CG_ScoresUp_f 0 0
+proc CG_AccDown_f 0 4
+ADDRGP4 cg+114908
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $147
+ADDRGP4 cg+114908
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 cg+114912
+INDIRI4
+CNSTI4 0
+NEI4 $148
+ADDRGP4 cg+114912
+CNSTI4 1
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRGP4 cg+114912
+CNSTI4 1
+ASGNI4
+LABELV $148
+LABELV $146
+endproc CG_AccDown_f 0 4
+proc CG_AccUp_f 0 0
+ADDRGP4 cg+114912
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRGP4 cg+114912
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114920
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $160
+LABELV $159
+endproc CG_AccUp_f 0 0
+proc CG_TellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $167
+ADDRGP4 $166
+JUMPV
+LABELV $167
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $166
+endproc CG_TellTarget_f 264 20
+proc CG_TellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $171
+ADDRGP4 $170
+JUMPV
+LABELV $171
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $170
+endproc CG_TellAttacker_f 264 20
+proc CG_VoiceTellTarget_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $174
+ADDRGP4 $173
+JUMPV
+LABELV $174
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $173
+endproc CG_VoiceTellTarget_f 264 20
+proc CG_VoiceTellAttacker_f 264 20
+ADDRLP4 260
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $178
+ADDRGP4 $177
+JUMPV
+LABELV $178
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $177
+endproc CG_VoiceTellAttacker_f 264 20
+proc CG_StartOrbit_f 1028 12
+ADDRGP4 $181
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $182
+ADDRGP4 $180
+JUMPV
+LABELV $182
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+CNSTF4 0
+EQF4 $184
+ADDRGP4 $187
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $189
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRGP4 $187
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $189
+ARGP4
+ADDRGP4 $191
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $192
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $193
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $185
+LABELV $180
+endproc CG_StartOrbit_f 1028 12
+data
+align 4
+LABELV commands
+address $196
+address CG_TestGun_f
+address $197
+address CG_TestModel_f
+address $198
+address CG_TestModelNextFrame_f
+address $199
+address CG_TestModelPrevFrame_f
+address $200
+address CG_TestModelNextSkin_f
+address $201
+address CG_TestModelPrevSkin_f
+address $202
+address CG_Viewpos_f
+address $203
+address CG_ScoresDown_f
+address $204
+address CG_ScoresUp_f
+address $205
+address CG_ZoomDown_f
+address $206
+address CG_ZoomUp_f
+address $207
+address CG_SizeUp_f
+address $208
+address CG_SizeDown_f
+address $209
+address CG_NextWeapon_f
+address $210
+address CG_PrevWeapon_f
+address $211
+address CG_Weapon_f
+address $212
+address CG_TellTarget_f
+address $213
+address CG_TellAttacker_f
+address $214
+address CG_VoiceTellTarget_f
+address $215
+address CG_VoiceTellAttacker_f
+address $216
+address CG_TargetCommand_f
+address $217
+address CG_StartOrbit_f
+address $218
+address CG_LoadDeferredPlayers
+address $219
+address CG_AccDown_f
+address $220
+address CG_AccUp_f
+address $221
+address CG_PrintClientNumbers
+export CG_ConsoleCommand
+code
+proc CG_ConsoleCommand 16 8
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $223
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $227
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $227
+LABELV $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $226
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 26
+LTU4 $223
+CNSTI4 0
+RETI4
+LABELV $222
+endproc CG_ConsoleCommand 16 8
+export CG_InitConsoleCommands
+proc CG_InitConsoleCommands 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $234
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $234
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 26
+LTU4 $231
+ADDRGP4 $235
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $236
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $237
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $238
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $239
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $240
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $241
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $242
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $243
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $244
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $245
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $246
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $247
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $248
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $249
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $250
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $251
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $252
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $253
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $254
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $255
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $256
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $257
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $258
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $259
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $260
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $261
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+ADDRGP4 $262
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $230
+endproc CG_InitConsoleCommands 4 4
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $262
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $261
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $260
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $259
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $258
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $257
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $256
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $255
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $254
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $253
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $252
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $251
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $250
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $249
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $248
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $247
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $246
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $245
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $244
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $243
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $242
+byte 1 118
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $241
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $240
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $239
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $238
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $237
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $236
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $235
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $221
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $220
+byte 1 45
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $219
+byte 1 43
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $218
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $217
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $216
+byte 1 116
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $215
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $214
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $213
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $212
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $211
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $210
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $209
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $208
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $207
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $206
+byte 1 45
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $205
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $204
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $203
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $202
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $201
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $200
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $199
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $198
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $197
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $196
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $194
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $193
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $192
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $191
+byte 1 49
+byte 1 0
+align 1
+LABELV $190
+byte 1 53
+byte 1 0
+align 1
+LABELV $189
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $188
+byte 1 48
+byte 1 0
+align 1
+LABELV $187
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $181
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $176
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $169
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $153
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $132
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $114
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $108
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $106
+byte 1 103
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $96
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 52
+byte 1 100
+byte 1 0
+align 1
+LABELV $93
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 53
+byte 1 100
+byte 1 0
+align 1
+LABELV $91
+byte 1 37
+byte 1 45
+byte 1 52
+byte 1 100
+byte 1 0
+align 1
+LABELV $85
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $84
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
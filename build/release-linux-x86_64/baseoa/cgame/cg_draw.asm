@@ -0,0 +1,14404 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+code
+proc CG_DrawField 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $75
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRFP4 8
+INDIRI4
+CNSTI4 5
+LEI4 $77
+ADDRFP4 8
+CNSTI4 5
+ASGNI4
+LABELV $77
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $79
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+GTI4 $79
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $109-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $109
+address $81
+address $88
+address $95
+address $102
+code
+LABELV $81
+ADDRFP4 12
+INDIRI4
+CNSTI4 9
+LEI4 $83
+ADDRLP4 32
+CNSTI4 9
+ASGNI4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 32
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $84
+ADDRFP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $86
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 36
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $87
+ADDRFP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $88
+ADDRFP4 12
+INDIRI4
+CNSTI4 99
+LEI4 $90
+ADDRLP4 40
+CNSTI4 99
+ASGNI4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $91
+ADDRFP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -9
+GEI4 $93
+ADDRLP4 44
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 44
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $94
+ADDRFP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $95
+ADDRFP4 12
+INDIRI4
+CNSTI4 999
+LEI4 $97
+ADDRLP4 48
+CNSTI4 999
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $98
+ADDRFP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -99
+GEI4 $100
+ADDRLP4 52
+CNSTI4 -99
+ASGNI4
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRLP4 52
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $101
+ADDRFP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $102
+ADDRFP4 12
+INDIRI4
+CNSTI4 9999
+LEI4 $104
+ADDRLP4 56
+CNSTI4 9999
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 56
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $105
+ADDRFP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -999
+GEI4 $107
+ADDRLP4 60
+CNSTI4 -999
+ASGNI4
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRLP4 60
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $108
+ADDRFP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $79
+LABELV $80
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $111
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $112
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $112
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 5
+LSHI4
+CNSTI4 2
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $117
+ADDRLP4 8
+CNSTI4 10
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $118
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1111490560
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+452
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $115
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $121
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $114
+LABELV $121
+LABELV $74
+endproc CG_DrawField 64 20
+export CG_Draw3DModel
+proc CG_Draw3DModel 512 16
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+EQI4 $127
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $123
+LABELV $127
+ADDRGP4 $122
+JUMPV
+LABELV $123
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $122
+endproc CG_Draw3DModel 512 16
+export CG_Draw3DModelEyes
+proc CG_Draw3DModelEyes 512 16
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+EQI4 $147
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $143
+LABELV $147
+ADDRGP4 $142
+JUMPV
+LABELV $143
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $142
+endproc CG_Draw3DModelEyes 512 16
+export CG_DrawHead
+proc CG_DrawHead 56 36
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $167
+ADDRGP4 $162
+JUMPV
+LABELV $167
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2104
+ADDP4
+ARGP4
+ADDRGP4 CG_Draw3DModelEyes
+CALLV
+pop
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $181
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $181
+LABELV $165
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $184
+LABELV $162
+endproc CG_DrawHead 56 36
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 72 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $189
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $189
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 cgs+180272+36
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 56
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $206
+ADDRLP4 48
+ADDRGP4 cgs+180272+36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $207
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+NEI4 $213
+ADDRLP4 48
+ADDRGP4 cgs+180272+40
+INDIRI4
+ASGNI4
+LABELV $213
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+NEI4 $218
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+LABELV $218
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+NEI4 $207
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $228
+ADDRLP4 48
+ADDRGP4 cgs+180272+40
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $229
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+NEI4 $235
+ADDRLP4 48
+ADDRGP4 cgs+180272+40
+INDIRI4
+ASGNI4
+LABELV $235
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+NEI4 $240
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+LABELV $240
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+NEI4 $229
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $188
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+LABELV $251
+LABELV $229
+LABELV $207
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $254
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $257
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $259
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $188
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $262
+LABELV $260
+LABELV $258
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $263
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $263
+LABELV $254
+LABELV $190
+LABELV $188
+endproc CG_DrawFlagModel 72 32
+proc CG_DrawStatusBarHead 60 24
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125280
+INDIRF4
+CNSTF4 0
+EQF4 $269
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125280
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $269
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125280
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+125284
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+125316
+CNSTF4 1110704128
+ADDRGP4 cg+125284
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125304
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125300
+CNSTF4 1084227584
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+125320
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+125308
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125308
+INDIRI4
+LTI4 $285
+ADDRGP4 cg+125316
+ADDRGP4 cg+125304
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125312
+ADDRGP4 cg+125300
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125320
+ADDRGP4 cg+125308
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+125308
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125304
+CNSTF4 1101004800
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125300
+CNSTF4 1084227584
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $285
+ADDRLP4 16
+CNSTF4 1114636288
+ASGNF4
+LABELV $270
+ADDRGP4 cg+125320
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $299
+ADDRGP4 cg+125320
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $299
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125320
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+125308
+INDIRI4
+ADDRGP4 cg+125320
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+125316
+INDIRF4
+ADDRGP4 cg+125304
+INDIRF4
+ADDRGP4 cg+125316
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+125312
+INDIRF4
+ADDRGP4 cg+125300
+INDIRF4
+ADDRGP4 cg+125312
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1139802112
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $266
+endproc CG_DrawStatusBarHead 60 24
+proc CG_DrawStatusBarFlag 4 24
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 0
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $317
+endproc CG_DrawStatusBarFlag 4 24
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $320
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $318
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $325
+LABELV $321
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+180272+192
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $318
+endproc CG_DrawTeamBackground 20 20
+data
+align 4
+LABELV $331
+byte 4 1065353216
+byte 4 1060152279
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawStatusBar 84 32
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $332
+ADDRGP4 $330
+JUMPV
+LABELV $332
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $335
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $335
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2120
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+LABELV $336
+ADDRLP4 28
+CNSTI4 936
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 28
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $346
+CNSTI4 172
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $346
+ADDRLP4 16
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1101004800
+ADDRLP4 72
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 76
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 28
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $346
+CNSTF4 1133412352
+ARGF4
+ADDRGP4 CG_DrawStatusBarHead
+CALLV
+pop
+ADDRGP4 cg+107636+312+28
+INDIRI4
+CNSTI4 0
+EQI4 $354
+CNSTF4 1134985216
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRGP4 cg+107636+312+32
+INDIRI4
+CNSTI4 0
+EQI4 $359
+CNSTF4 1134985216
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $360
+JUMPV
+LABELV $359
+ADDRGP4 cg+107636+312+36
+INDIRI4
+CNSTI4 0
+EQI4 $364
+CNSTF4 1134985216
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+LABELV $364
+LABELV $360
+LABELV $355
+ADDRLP4 32
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRLP4 16
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 4+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 72
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+184
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $369
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $377
+ADDRLP4 16
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 4+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $384
+ADDRLP4 52
+ADDRGP4 cgs+180272+20
+INDIRI4
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 52
+ADDRGP4 cgs+180272+24
+INDIRI4
+ASGNI4
+LABELV $385
+CNSTF4 1141800960
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 72
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $377
+ADDRLP4 28
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $391
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+LEI4 $393
+ADDRGP4 cg+107636+148
+INDIRI4
+CNSTI4 3
+NEI4 $395
+ADDRGP4 cg+107636+44
+INDIRI4
+CNSTI4 100
+LEI4 $395
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $401
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+LABELV $402
+LABELV $396
+ADDRLP4 56
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $331
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 0
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $403
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $403
+ADDRLP4 76
+CNSTI4 172
+ADDRGP4 cg+107636+144
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $410
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 80
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $410
+LABELV $403
+LABELV $393
+LABELV $391
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LEI4 $412
+ADDRGP4 $331+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LEI4 $415
+ADDRGP4 $331
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $417
+ADDRLP4 56
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $331
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRGP4 $331+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $418
+LABELV $416
+LABELV $413
+CNSTI4 185
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $421
+ADDRGP4 $331
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 370
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $423
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $423
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 76
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+188
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $423
+LABELV $421
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $429
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $432
+ADDRGP4 $331
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 470
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $434
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $434
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $438
+ADDRLP4 52
+ADDRGP4 cgs+180272+28
+INDIRI4
+ASGNI4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 52
+ADDRGP4 cgs+180272+32
+INDIRI4
+ASGNI4
+LABELV $439
+CNSTF4 1141800960
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 76
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $434
+LABELV $432
+LABELV $429
+LABELV $330
+endproc CG_DrawStatusBar 84 32
+proc CG_DrawAttacker 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $446
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $445
+JUMPV
+LABELV $446
+ADDRGP4 cg+125008
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $445
+JUMPV
+LABELV $450
+ADDRLP4 0
+ADDRGP4 cg+107636+248+24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $460
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $460
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $456
+LABELV $460
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $445
+JUMPV
+LABELV $456
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125008
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10000
+LEI4 $463
+ADDRGP4 cg+125008
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $445
+JUMPV
+LABELV $463
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $445
+endproc CG_DrawAttacker 52 24
+proc CG_DrawSpeedMeter 40 16
+ADDRGP4 cg+114788
+INDIRI4
+CNSTI4 0
+EQI4 $470
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $469
+JUMPV
+LABELV $470
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 cg_drawSpeed+12
+INDIRI4
+CNSTI4 1
+NEI4 $475
+CNSTI4 635
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+ADDRGP4 $469
+JUMPV
+LABELV $475
+CNSTI4 320
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 300
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $469
+endproc CG_DrawSpeedMeter 40 16
+proc CG_DrawSnapshot 16 16
+ADDRGP4 $479
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31444
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $478
+endproc CG_DrawSnapshot 16 16
+bss
+align 4
+LABELV $484
+skip 16
+align 4
+LABELV $485
+skip 4
+align 4
+LABELV $486
+skip 4
+code
+proc CG_DrawFPS 56 16
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $486
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $485
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $484
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 $485
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $487
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $489
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $484
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $490
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $489
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $493
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $493
+ADDRLP4 24
+CNSTI4 4000
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $487
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $483
+endproc CG_DrawFPS 56 16
+proc CG_DrawPossessionString 44 16
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $497
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $496
+JUMPV
+LABELV $497
+ADDRLP4 4
+ADDRGP4 $500
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 0
+LEI4 $501
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 1000
+GEI4 $501
+ADDRLP4 12
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $501
+ADDRLP4 8
+ADDRGP4 colorYellow
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $510
+ADDRGP4 $512
+ARGP4
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $510
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $513
+ADDRGP4 $515
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 colorGreen
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $513
+ADDRGP4 $516
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $517
+ADDRLP4 24
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $521
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $521
+ADDRLP4 28
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg_entities+776
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+NEF4 $533
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg_entities+776+4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+NEF4 $533
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg_entities+776+8
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+EQF4 $525
+LABELV $533
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+776
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 $536
+ARGP4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CNSTI4 10
+DIVI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 colorYellow
+ASGNP4
+LABELV $525
+LABELV $521
+LABELV $518
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $517
+LABELV $508
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $496
+endproc CG_DrawPossessionString 44 16
+proc CG_DrawTimer 56 16
+ADDRLP4 20
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+34804
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $537
+endproc CG_DrawTimer 56 16
+proc CG_DrawLMSmode 12 16
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 0
+NEI4 $542
+ADDRGP4 $545
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 1
+NEI4 $546
+ADDRGP4 $549
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 2
+NEI4 $550
+ADDRGP4 $553
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 3
+NEI4 $554
+ADDRGP4 $557
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRGP4 $558
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $555
+LABELV $551
+LABELV $547
+LABELV $543
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $541
+endproc CG_DrawLMSmode 12 16
+proc CG_DrawCTFoneway 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $560
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $559
+JUMPV
+LABELV $560
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+112
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $564
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $559
+JUMPV
+LABELV $564
+ADDRGP4 cgs+34820
+INDIRI4
+CNSTI4 2
+NEI4 $567
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+64
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $571
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRGP4 cgs+34820
+INDIRI4
+CNSTI4 1
+NEI4 $572
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $576
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $573
+JUMPV
+LABELV $572
+ADDRGP4 $577
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $573
+LABELV $568
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $559
+endproc CG_DrawCTFoneway 28 16
+proc CG_DrawDomStatus 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $579
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34960
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $588
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $590
+ADDRGP4 $584
+JUMPV
+LABELV $588
+ADDRLP4 12
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $590
+ADDRLP4 12
+ARGP4
+ADDRGP4 g_color_table+64
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRLP4 12
+ARGP4
+ADDRGP4 g_color_table+112
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $585
+ADDRGP4 $593
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+LABELV $580
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $582
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+34836
+INDIRI4
+LTI4 $579
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $578
+endproc CG_DrawDomStatus 44 16
+proc CG_DrawEliminationTimer 92 36
+ADDRLP4 24
+ADDRGP4 cgs+34812
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $597
+ADDRGP4 cgs+34816
+INDIRI4
+CNSTI4 0
+NEI4 $597
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $595
+JUMPV
+LABELV $597
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+112
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $602
+ADDRLP4 4
+CNSTI4 1000
+ADDRGP4 cgs+34816
+INDIRI4
+MULI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 29999
+GTI4 $607
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+48
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $607
+ADDRLP4 4
+INDIRI4
+CNSTI4 9999
+GTI4 $610
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $610
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $602
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+NEGI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+32
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 64
+CNSTI4 1000
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+125248
+INDIRI4
+CNSTI4 0
+NEI4 $615
+ADDRGP4 $618
+ARGP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 cg+125252
+INDIRI4
+EQI4 $619
+ADDRGP4 cg+125252
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $628
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $631
+ADDRGP4 $624
+JUMPV
+LABELV $625
+ADDRGP4 cgs+180272+1364
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $628
+ADDRGP4 cgs+180272+1360
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $631
+ADDRGP4 cgs+180272+1356
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $624
+LABELV $619
+ADDRLP4 56
+CNSTF4 1055286886
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg+125252
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $638
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $639
+ADDRGP4 $634
+JUMPV
+LABELV $637
+ADDRLP4 48
+CNSTI4 28
+ASGNI4
+ADDRLP4 56
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $635
+JUMPV
+LABELV $638
+ADDRLP4 48
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $635
+JUMPV
+LABELV $639
+ADDRLP4 48
+CNSTI4 20
+ASGNI4
+ADDRLP4 56
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRLP4 48
+CNSTI4 16
+ASGNI4
+ADDRLP4 56
+CNSTF4 1055286886
+ASGNF4
+LABELV $635
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 32
+INDIRI4
+ADDRLP4 80
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $615
+LABELV $603
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 10
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 40
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $640
+ADDRGP4 $642
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRGP4 $643
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 84
+INDIRP4
+ASGNP4
+LABELV $641
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 88
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 32
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $595
+endproc CG_DrawEliminationTimer 92 36
+proc CG_DrawTeamOverlay 152 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $645
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $644
+JUMPV
+LABELV $645
+ADDRLP4 92
+CNSTI4 304
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $648
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $648
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $644
+JUMPV
+LABELV $648
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $653
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 96
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $654
+ADDRLP4 48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $660
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $663
+ADDRLP4 56
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $663
+LABELV $660
+LABELV $656
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $655
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $665
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $644
+JUMPV
+LABELV $665
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+LEI4 $667
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+LABELV $667
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $669
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $673
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $673
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $675
+ADDRLP4 44
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $675
+LABELV $673
+LABELV $670
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $669
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LEI4 $677
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+LABELV $677
+ADDRLP4 80
+ADDRLP4 56
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+CNSTI4 32
+ADDI4
+CNSTI4 56
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $679
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 80
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $680
+ADDRLP4 84
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $681
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $682
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $683
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $684
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+180272+192
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $694
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $699
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $699
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $709
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $707
+LABELV $709
+ADDRLP4 20
+ADDRGP4 $710
+ASGNP4
+LABELV $707
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $711
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $711
+ADDRLP4 132
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $705
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $713
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 128
+CNSTI4 3
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 8
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+CNSTI4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $714
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $715
+JUMPV
+LABELV $714
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $715
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $720
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $721
+JUMPV
+LABELV $720
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CNSTI4 8
+SUBI4
+ASGNI4
+LABELV $721
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $722
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $726
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $728
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 148
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $730
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $731
+LABELV $728
+LABELV $726
+LABELV $723
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $722
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $699
+LABELV $695
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $697
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $694
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $644
+endproc CG_DrawTeamOverlay 152 36
+proc CG_DrawFollowMessage 20 16
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $740
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $733
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $740
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $733
+LABELV $740
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $732
+JUMPV
+LABELV $733
+ADDRGP4 $741
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $732
+endproc CG_DrawFollowMessage 20 16
+proc CG_DrawFragMsgIcons 56 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $746
+CNSTI4 20
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 300
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $747
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 300
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+CNSTI4 300
+ADDI4
+ARGI4
+ADDRGP4 $750
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $748
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $742
+endproc CG_DrawFragMsgIcons 56 36
+proc CG_DrawFragMsgText 28 36
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 300
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $751
+endproc CG_DrawFragMsgText 28 36
+proc CG_DrawFragMessage 284 12
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $756
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $760
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832+68
+ADDP4
+INDIRI4
+CNSTI4 7000
+ADDI4
+LEI4 $763
+ADDRLP4 4
+CNSTI4 276
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $763
+LABELV $760
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $769
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+NEI4 $772
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832+76
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFragMsgText
+CALLV
+pop
+ADDRGP4 $773
+JUMPV
+LABELV $772
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 3
+LTI4 $777
+ADDRLP4 4
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+INDIRB
+ASGNB 276
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFragMsgIcons
+CALLV
+pop
+LABELV $777
+LABELV $773
+LABELV $769
+LABELV $757
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $756
+LABELV $755
+endproc CG_DrawFragMessage 284 12
+proc CG_DrawUpperRight 24 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $782
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+34808
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $782
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $782
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $782
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $787
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawLMSmode
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $791
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawCTFoneway
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 12
+NEI4 $794
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawDomStatus
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $797
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawPossessionString
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $797
+LABELV $795
+LABELV $792
+LABELV $788
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $800
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $800
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $803
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $806
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $803
+LABELV $806
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $803
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $813
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $813
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $807
+LABELV $813
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawEliminationTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $807
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawFollowMessage
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $814
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $814
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 CG_DrawAttacker
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $817
+ADDRGP4 cg_drawSpeed+12
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 CG_DrawSpeedMeter
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $820
+LABELV $781
+endproc CG_DrawUpperRight 24 12
+proc CG_DrawScores 104 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 cgs+34992
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 cgs+34996
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+34984
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+34988
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $828
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $828
+ADDRLP4 0
+CNSTI4 640
+ASGNI4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $835
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 68
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $836
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $836
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $845
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $841
+LABELV $845
+CNSTI4 8
+ARGI4
+ADDRLP4 76
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $846
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 0
+LTI4 $848
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 2
+GTI4 $848
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+60
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $848
+LABELV $846
+LABELV $841
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $855
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+LTI4 $858
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+GTI4 $858
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+104
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $858
+LABELV $855
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $835
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 80
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $868
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $868
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $877
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $873
+LABELV $877
+CNSTI4 7
+ARGI4
+ADDRLP4 88
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $878
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+LTI4 $880
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+GTI4 $880
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $880
+LABELV $878
+LABELV $873
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $887
+ADDRLP4 32
+ADDRFP4 0
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+LTI4 $890
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+GTI4 $890
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+88
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $890
+ADDRLP4 88
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $900
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+EQI4 $899
+LABELV $900
+ADDRLP4 92
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $897
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+NEI4 $897
+LABELV $899
+ADDRGP4 $111
+ARGP4
+ADDRGP4 cgs+34832
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 100
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+CNSTI4 8
+ADDI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1105199104
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $897
+LABELV $887
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+NEI4 $903
+ADDRGP4 $906
+ARGP4
+ADDRGP4 cg+156496
+INDIRI4
+ARGI4
+ADDRGP4 cg+156500
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1105199104
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $903
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $909
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+NEI4 $909
+ADDRLP4 52
+ADDRGP4 cgs+31480
+INDIRI4
+ASGNI4
+ADDRGP4 $910
+JUMPV
+LABELV $909
+ADDRLP4 52
+ADDRGP4 cgs+31476
+INDIRI4
+ASGNI4
+LABELV $910
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $829
+ADDRGP4 $835
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 0
+CNSTI4 640
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $920
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $921
+JUMPV
+LABELV $920
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $921
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $922
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $922
+ADDRLP4 36
+INDIRI4
+CNSTI4 -9999
+EQI4 $924
+ADDRGP4 $835
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $926
+ADDRLP4 76
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $926
+ADDRLP4 76
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $926
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRLP4 80
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $927
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $924
+ADDRLP4 28
+INDIRI4
+CNSTI4 -9999
+EQI4 $936
+ADDRGP4 $835
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $938
+ADDRLP4 40
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $938
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRLP4 76
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $939
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $936
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 0
+EQI4 $948
+ADDRGP4 $835
+ARGP4
+ADDRGP4 cgs+31476
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $948
+LABELV $829
+ADDRLP4 32
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+RETF4
+LABELV $823
+endproc CG_DrawScores 104 20
+data
+align 4
+LABELV $953
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+code
+proc CG_DrawPowerups 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $955
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $952
+JUMPV
+LABELV $955
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $957
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $961
+ADDRGP4 $958
+JUMPV
+LABELV $961
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $966
+ADDRLP4 140
+INDIRI4
+CNSTI4 999000
+LEI4 $964
+LABELV $966
+ADDRGP4 $958
+JUMPV
+LABELV $964
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $967
+ADDRLP4 148
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $967
+ADDRGP4 $958
+JUMPV
+LABELV $967
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $972
+JUMPV
+LABELV $969
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $973
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $978
+JUMPV
+LABELV $975
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $976
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $978
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $975
+ADDRGP4 $971
+JUMPV
+LABELV $973
+LABELV $970
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $972
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $969
+LABELV $971
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $958
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $957
+ADDRLP4 168
+CNSTI4 528
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $984
+JUMPV
+LABELV $981
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $985
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $953
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 180
+CNSTI4 2
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $987
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $988
+JUMPV
+LABELV $987
+ADDRLP4 160
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 188+12
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $988
+ADDRGP4 cg+125000
+INDIRI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+NEI4 $994
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125004
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $994
+ADDRLP4 188
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 160
+ADDRLP4 188
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125004
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1111490560
+CNSTF4 1056964608
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDRLP4 188
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $995
+JUMPV
+LABELV $994
+ADDRLP4 156
+CNSTF4 1111490560
+ASGNF4
+LABELV $995
+ADDRLP4 148
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTF4 1142947840
+ADDRLP4 156
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $985
+LABELV $982
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $984
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $981
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $952
+endproc CG_DrawPowerups 212 20
+proc CG_DrawLowerRight 12 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1002
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1002
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 2
+NEI4 $1002
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $1002
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawScores
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawPowerups
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $1001
+endproc CG_DrawLowerRight 12 12
+proc CG_DrawPickupItem 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1008
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1007
+JUMPV
+LABELV $1008
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+125256
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1012
+ADDRGP4 cg+125260
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1015
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1090519040
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1015
+LABELV $1012
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $1007
+endproc CG_DrawPickupItem 16 20
+proc CG_DrawLowerLeft 16 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1020
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1020
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1020
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $1020
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawPickupItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1019
+endproc CG_DrawLowerLeft 16 12
+proc CG_DrawTeamInfo 56 36
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $1026
+ADDRLP4 8
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1027
+JUMPV
+LABELV $1026
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+LABELV $1027
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1030
+ADDRGP4 $1025
+JUMPV
+LABELV $1030
+ADDRGP4 cgs+178800
+INDIRI4
+ADDRGP4 cgs+178796
+INDIRI4
+EQI4 $1032
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+178800
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+178764
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+LEI4 $1036
+ADDRLP4 36
+ADDRGP4 cgs+178800
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1036
+ADDRLP4 32
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRGP4 cgs+178800
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+178800
+INDIRI4
+ASGNI4
+ADDRGP4 $1048
+JUMPV
+LABELV $1045
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+176836
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $1052
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1052
+LABELV $1046
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1048
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+178796
+INDIRI4
+LTI4 $1045
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1054
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $1055
+JUMPV
+LABELV $1054
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1060
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $1061
+JUMPV
+LABELV $1060
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $1061
+LABELV $1055
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 420
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+180272+192
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cgs+178796
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1074
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 420
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+176836
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1075
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1077
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+178800
+INDIRI4
+GEI4 $1074
+LABELV $1032
+LABELV $1025
+endproc CG_DrawTeamInfo 56 36
+proc CG_DrawHoldableItem 8 20
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+CNSTF4 1142161408
+ARGF4
+CNSTF4 1129840640
+ARGF4
+ADDRLP4 4
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1084
+LABELV $1082
+endproc CG_DrawHoldableItem 8 20
+proc CG_DrawPersistantPowerup 8 20
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1089
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+CNSTF4 1142161408
+ARGF4
+CNSTF4 1126694912
+ARGF4
+ADDRLP4 4
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1089
+LABELV $1087
+endproc CG_DrawPersistantPowerup 8 20
+proc CG_DrawReward 68 36
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $1093
+ADDRGP4 $1092
+JUMPV
+LABELV $1093
+ADDRGP4 cg+125020
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1097
+ADDRGP4 cg+125016
+INDIRI4
+CNSTI4 0
+LEI4 $1092
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1105
+JUMPV
+LABELV $1102
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+125104
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+125104+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+125064
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+125064+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+125024
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+125024+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1105
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+125016
+INDIRI4
+LTI4 $1102
+ADDRGP4 cg+125020
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cg+125016
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+125020
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 cg+125104
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1100
+LABELV $1097
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+125024
+INDIRI4
+CNSTI4 10
+LTI4 $1121
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133772800
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+125064
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1125
+ARGP4
+ADDRGP4 cg+125024
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1122
+JUMPV
+LABELV $1121
+ADDRLP4 12
+ADDRGP4 cg+125024
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1131
+JUMPV
+LABELV $1128
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+125064
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $1129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1131
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1128
+LABELV $1122
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1092
+endproc CG_DrawReward 68 36
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1134
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1140
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1139
+JUMPV
+LABELV $1140
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1139
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $1155
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $1151
+LABELV $1155
+ADDRGP4 $1150
+JUMPV
+LABELV $1151
+ADDRLP4 24
+ADDRGP4 $1156
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1157
+ADDRGP4 $1150
+JUMPV
+LABELV $1157
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 $1160
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1150
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_lagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1166
+ADDRGP4 cgs+31452
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1162
+LABELV $1166
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $1161
+JUMPV
+LABELV $1162
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 432
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+328
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1172
+JUMPV
+LABELV $1169
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1174
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $1176
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1176
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $1179
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $1179
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $1175
+JUMPV
+LABELV $1174
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $1183
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $1185
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1185
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $1188
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $1188
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1183
+LABELV $1175
+LABELV $1170
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1172
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $1169
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1195
+JUMPV
+LABELV $1192
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1198
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1200
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $1201
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1201
+JUMPV
+LABELV $1200
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $1206
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1206
+LABELV $1201
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $1209
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $1209
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $1199
+JUMPV
+LABELV $1198
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $1213
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $1215
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1215
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1213
+LABELV $1199
+LABELV $1193
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1195
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $1192
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $1224
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $1220
+LABELV $1224
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 $1225
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1220
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $1161
+endproc CG_DrawLagometer 76 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+123956
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+123944
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123952
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123948
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124980
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+123956
+ASGNP4
+ADDRGP4 $1236
+JUMPV
+LABELV $1235
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $1238
+ADDRLP4 4
+ADDRGP4 cg+124980
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1238
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1236
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1235
+LABELV $1226
+endproc CG_CenterPrint 8 12
+proc CG_DrawCenterString 1064 36
+ADDRGP4 cg+123944
+INDIRI4
+CNSTI4 0
+NEI4 $1242
+ADDRGP4 $1241
+JUMPV
+LABELV $1242
+ADDRGP4 cg+123944
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1247
+ADDRGP4 $1241
+JUMPV
+LABELV $1247
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+123956
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+123952
+INDIRI4
+ADDRGP4 cg+124980
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $1253
+JUMPV
+LABELV $1252
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1255
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1261
+ADDRLP4 1052
+INDIRI4
+CNSTI4 10
+NEI4 $1259
+LABELV $1261
+ADDRGP4 $1257
+JUMPV
+LABELV $1259
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1256
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LTI4 $1255
+LABELV $1257
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ARGP4
+ADDRLP4 1052
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+123948
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+123948
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+123948
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1069547520
+ADDRGP4 cg+123948
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1267
+JUMPV
+LABELV $1266
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1267
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $1269
+ADDRLP4 1060
+INDIRI4
+CNSTI4 10
+NEI4 $1266
+LABELV $1269
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1270
+ADDRGP4 $1254
+JUMPV
+LABELV $1270
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1253
+ADDRGP4 $1252
+JUMPV
+LABELV $1254
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1241
+endproc CG_DrawCenterString 1064 36
+proc drawCenterString 24 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $1275
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+NEU4 $1273
+LABELV $1275
+ADDRGP4 $1272
+JUMPV
+LABELV $1273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+123948
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 640
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+123948
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+123948
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1272
+endproc drawCenterString 24 36
+proc CG_DrawCenter1FctfString 28 8
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $1280
+ADDRGP4 $1279
+JUMPV
+LABELV $1280
+ADDRLP4 0
+ADDRGP4 cgs+35000
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $1286
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+EQI4 $1288
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+EQI4 $1290
+ADDRGP4 $1279
+JUMPV
+LABELV $1286
+ADDRGP4 $1287
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 colorRed
+ASGNP4
+ADDRGP4 $1285
+JUMPV
+LABELV $1288
+ADDRGP4 $1289
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 colorBlue
+ASGNP4
+ADDRGP4 $1285
+JUMPV
+LABELV $1290
+ADDRGP4 $1291
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 colorWhite
+ASGNP4
+LABELV $1285
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 drawCenterString
+CALLV
+pop
+LABELV $1279
+endproc CG_DrawCenter1FctfString 28 8
+data
+align 4
+LABELV $1293
+byte 4 -100
+code
+proc CG_DrawCenterDDString 48 36
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+EQI4 $1294
+ADDRGP4 $1292
+JUMPV
+LABELV $1294
+ADDRLP4 0
+ADDRGP4 cgs+34992
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cgs+34996
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1302
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1301
+LABELV $1302
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1292
+LABELV $1301
+LABELV $1300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1303
+ADDRGP4 $1305
+ARGP4
+ADDRGP4 cgs+34832
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 colorBlue
+ASGNP4
+ADDRGP4 $1304
+JUMPV
+LABELV $1303
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1308
+ADDRGP4 $1310
+ARGP4
+ADDRGP4 cgs+34832
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 colorRed
+ASGNP4
+ADDRGP4 $1309
+JUMPV
+LABELV $1308
+ADDRGP4 $1293
+CNSTI4 -100
+ASGNI4
+ADDRGP4 $1292
+JUMPV
+LABELV $1309
+LABELV $1304
+ADDRLP4 4
+ADDRGP4 cgs+34832
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 $1293
+INDIRI4
+EQI4 $1315
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1319
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1322
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1325
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $1318
+LABELV $1331
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $1328
+ADDRGP4 $1318
+JUMPV
+LABELV $1319
+ADDRGP4 cgs+180272+1364
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1318
+JUMPV
+LABELV $1322
+ADDRGP4 cgs+180272+1360
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1318
+JUMPV
+LABELV $1325
+ADDRGP4 cgs+180272+1356
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1318
+JUMPV
+LABELV $1328
+ADDRGP4 cgs+180272+1380
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1318
+LABELV $1315
+ADDRGP4 $1293
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cg+123948
+INDIRI4
+ADDRLP4 40
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 640
+ADDRLP4 24
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+123948
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+123948
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1292
+endproc CG_DrawCenterDDString 48 36
+proc CG_DrawCrosshair 92 36
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg+107636+144
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1338
+ADDRGP4 $1335
+JUMPV
+LABELV $1338
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1341
+ADDRGP4 $1335
+JUMPV
+LABELV $1341
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1344
+ADDRGP4 $1335
+JUMPV
+LABELV $1344
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $1347
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1348
+JUMPV
+LABELV $1347
+ADDRLP4 32
+ADDRGP4 cg_crosshairColorRed+8
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg_crosshairColorGreen+8
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg_crosshairColorBlue+8
+INDIRF4
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1348
+ADDRGP4 cg_differentCrosshairs+12
+INDIRI4
+CNSTI4 1
+NEI4 $1356
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+LTI4 $1359
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $1359
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1402-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1402
+address $1361
+address $1364
+address $1367
+address $1370
+address $1373
+address $1376
+address $1379
+address $1382
+address $1385
+address $1388
+address $1391
+address $1394
+address $1397
+code
+LABELV $1361
+ADDRLP4 36
+ADDRGP4 cg_ch1size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch1+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1364
+ADDRLP4 40
+ADDRGP4 cg_ch2size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch2+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1367
+ADDRLP4 44
+ADDRGP4 cg_ch3size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch3+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1370
+ADDRLP4 48
+ADDRGP4 cg_ch4size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch4+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1373
+ADDRLP4 52
+ADDRGP4 cg_ch5size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch5+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1376
+ADDRLP4 56
+ADDRGP4 cg_ch6size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch6+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1379
+ADDRLP4 60
+ADDRGP4 cg_ch7size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch7+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1382
+ADDRLP4 64
+ADDRGP4 cg_ch8size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch8+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1385
+ADDRLP4 68
+ADDRGP4 cg_ch9size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch9+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1388
+ADDRLP4 72
+ADDRGP4 cg_ch10size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch10+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1391
+ADDRLP4 76
+ADDRGP4 cg_ch11size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch11+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1394
+ADDRLP4 80
+ADDRGP4 cg_ch12size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch12+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1397
+ADDRLP4 84
+ADDRGP4 cg_ch13size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch13+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1359
+ADDRLP4 88
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+JUMPV
+LABELV $1356
+ADDRLP4 32
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+LABELV $1357
+ADDRGP4 cg_crosshairPulse+12
+INDIRI4
+CNSTI4 0
+EQI4 $1406
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125264
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+LEF4 $1411
+ADDRLP4 32
+INDIRF4
+CNSTF4 1128792064
+GEF4 $1411
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1411
+LABELV $1406
+ADDRLP4 16
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+ADDRGP4 wideAdjustX
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1415
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1415
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1419
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1419
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 36
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+109252
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+109252+8
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+109252+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+109252+12
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1335
+endproc CG_DrawCrosshair 92 36
+proc CG_ScanForCrosshairEntity 96 28
+ADDRLP4 56
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109252+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109252+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+109252+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $1446
+ADDRGP4 $1430
+JUMPV
+LABELV $1446
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1450
+ADDRGP4 $1430
+JUMPV
+LABELV $1450
+CNSTI4 936
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1452
+ADDRGP4 $1430
+JUMPV
+LABELV $1452
+ADDRGP4 cg+124992
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124996
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1430
+endproc CG_ScanForCrosshairEntity 96 28
+proc CG_DrawCrosshairNames 20 16
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1461
+ADDRGP4 $1460
+JUMPV
+LABELV $1461
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $1464
+ADDRGP4 $1460
+JUMPV
+LABELV $1464
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1467
+ADDRGP4 $1460
+JUMPV
+LABELV $1467
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+124996
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1471
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1460
+JUMPV
+LABELV $1471
+ADDRLP4 4
+CNSTI4 2120
+ADDRGP4 cg+124992
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 170
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1460
+endproc CG_DrawCrosshairNames 20 16
+proc CG_DrawSpectator 0 16
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $1477
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1478
+CNSTI4 200
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1481
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $1479
+JUMPV
+LABELV $1478
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1482
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1482
+CNSTI4 8
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1486
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1482
+LABELV $1479
+LABELV $1476
+endproc CG_DrawSpectator 0 16
+proc CG_DrawVote 12 20
+ADDRGP4 cgs+31684
+INDIRI4
+CNSTI4 0
+NEI4 $1488
+ADDRGP4 $1487
+JUMPV
+LABELV $1488
+ADDRGP4 cgs+31696
+INDIRI4
+CNSTI4 0
+EQI4 $1491
+ADDRGP4 cgs+31696
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1491
+ADDRLP4 0
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+31684
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1499
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1499
+ADDRGP4 $1501
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31700
+ARGP4
+ADDRGP4 cgs+31688
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31692
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1487
+endproc CG_DrawVote 12 20
+proc CG_DrawTeamVote 24 20
+CNSTI4 2120
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1506
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1507
+JUMPV
+LABELV $1506
+CNSTI4 2120
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1505
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1512
+LABELV $1507
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1516
+ADDRGP4 $1505
+JUMPV
+LABELV $1516
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1519
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1519
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1527
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1527
+ADDRGP4 $1529
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32756
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32732
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1505
+endproc CG_DrawTeamVote 24 20
+proc CG_DrawScoreboard 16 16
+ADDRGP4 cg+156492
+INDIRI4
+CNSTI4 0
+EQI4 $1534
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1534
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+LTI4 $1540
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+LEI4 $1534
+LABELV $1540
+ADDRGP4 cg+156492
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $1541
+ADDRGP4 $1545
+ARGP4
+ADDRGP4 cg+156492
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 400
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 colorYellow
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $1542
+JUMPV
+LABELV $1541
+ADDRGP4 $1548
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 400
+ARGI4
+ADDRGP4 $1548
+ARGP4
+ADDRGP4 colorGreen
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1542
+LABELV $1534
+ADDRLP4 8
+ADDRGP4 CG_DrawOldScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $1533
+endproc CG_DrawScoreboard 16 16
+export CG_DrawAccboard
+proc CG_DrawAccboard 44 24
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+114912
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1550
+CNSTI4 0
+RETI4
+ADDRGP4 $1549
+JUMPV
+LABELV $1550
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1553
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+344+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1557
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $1557
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1557
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1557
+LABELV $1554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $1553
+CNSTI4 500
+ARGI4
+CNSTI4 150
+ARGI4
+CNSTI4 75
+ARGI4
+ADDRLP4 12
+CNSTI4 20
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1561
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+344+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1565
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $1565
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1565
+CNSTF4 1140785152
+ARGF4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+344+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+114796
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1571
+ADDRGP4 $1574
+ARGP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTF4 1120403456
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+114796+4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+114796
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRGP4 $1578
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 536
+ARGI4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $1572
+JUMPV
+LABELV $1571
+CNSTI4 536
+ARGI4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 $1579
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1572
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1565
+LABELV $1562
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $1561
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1549
+endproc CG_DrawAccboard 44 24
+proc CG_DrawIntermission 4 0
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $1581
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1580
+JUMPV
+LABELV $1581
+ADDRGP4 cg+114792
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114788
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1580
+endproc CG_DrawIntermission 4 0
+proc CG_DrawFollow 36 36
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1588
+CNSTI4 0
+RETI4
+ADDRGP4 $1587
+JUMPV
+LABELV $1588
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 248
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 $1594
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 2120
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1587
+endproc CG_DrawFollow 36 36
+proc CG_DrawAmmoWarning 12 16
+ADDRGP4 cgs+34828
+INDIRI4
+CNSTI4 0
+EQI4 $1599
+ADDRGP4 $1598
+JUMPV
+LABELV $1599
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1602
+ADDRGP4 $1598
+JUMPV
+LABELV $1602
+ADDRGP4 cg+124984
+INDIRI4
+CNSTI4 0
+NEI4 $1605
+ADDRGP4 $1598
+JUMPV
+LABELV $1605
+ADDRGP4 cg+124984
+INDIRI4
+CNSTI4 2
+NEI4 $1608
+ADDRLP4 0
+ADDRGP4 $1611
+ASGNP4
+ADDRGP4 $1609
+JUMPV
+LABELV $1608
+ADDRLP4 0
+ADDRGP4 $1612
+ASGNP4
+LABELV $1609
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1598
+endproc CG_DrawAmmoWarning 12 16
+bss
+align 4
+LABELV $1614
+skip 4
+align 4
+LABELV $1615
+skip 4
+align 4
+LABELV $1616
+skip 4
+code
+proc CG_DrawProxWarning 44 16
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1617
+ADDRGP4 $1614
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1613
+JUMPV
+LABELV $1617
+ADDRGP4 $1614
+INDIRI4
+CNSTI4 0
+NEI4 $1620
+ADDRGP4 $1614
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 $1615
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1616
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1621
+JUMPV
+LABELV $1620
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 $1614
+INDIRI4
+LEI4 $1623
+ADDRLP4 40
+ADDRGP4 $1615
+ASGNP4
+ADDRLP4 36
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1616
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1614
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $1623
+LABELV $1621
+ADDRGP4 $1616
+INDIRI4
+CNSTI4 0
+EQI4 $1627
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1629
+ARGP4
+ADDRGP4 $1616
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1628
+JUMPV
+LABELV $1627
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1630
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1628
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $1613
+endproc CG_DrawProxWarning 44 16
+proc CG_DrawWarmup 60 36
+ADDRLP4 4
+ADDRGP4 cg+125248
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1634
+ADDRGP4 $1632
+JUMPV
+LABELV $1634
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1636
+ADDRLP4 8
+ADDRGP4 $1638
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+125252
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1632
+JUMPV
+LABELV $1636
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1640
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1643
+ADDRLP4 36
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $1648
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1648
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1653
+ADDRLP4 20
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 $1654
+JUMPV
+LABELV $1653
+ADDRLP4 24
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+LABELV $1654
+LABELV $1648
+LABELV $1644
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1646
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $1643
+ADDRLP4 36
+CNSTU4 0
+ASGNU4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $1641
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $1641
+ADDRGP4 $1659
+ARGP4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1660
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1661
+JUMPV
+LABELV $1660
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1661
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1641
+JUMPV
+LABELV $1640
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 0
+NEI4 $1662
+ADDRLP4 8
+ADDRGP4 $1665
+ASGNP4
+ADDRGP4 $1663
+JUMPV
+LABELV $1662
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+NEI4 $1666
+ADDRLP4 8
+ADDRGP4 $1669
+ASGNP4
+ADDRGP4 $1667
+JUMPV
+LABELV $1666
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $1670
+ADDRLP4 8
+ADDRGP4 $1673
+ASGNP4
+ADDRGP4 $1671
+JUMPV
+LABELV $1670
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+NEI4 $1674
+ADDRLP4 8
+ADDRGP4 $1677
+ASGNP4
+ADDRGP4 $1675
+JUMPV
+LABELV $1674
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $1678
+ADDRLP4 8
+ADDRGP4 $1681
+ASGNP4
+ADDRGP4 $1679
+JUMPV
+LABELV $1678
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $1682
+ADDRLP4 8
+ADDRGP4 $1685
+ASGNP4
+ADDRGP4 $1683
+JUMPV
+LABELV $1682
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $1686
+ADDRLP4 8
+ADDRGP4 $1689
+ASGNP4
+ADDRGP4 $1687
+JUMPV
+LABELV $1686
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1690
+ADDRLP4 8
+ADDRGP4 $1693
+ASGNP4
+ADDRGP4 $1691
+JUMPV
+LABELV $1690
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+NEI4 $1694
+ADDRLP4 8
+ADDRGP4 $1697
+ASGNP4
+ADDRGP4 $1695
+JUMPV
+LABELV $1694
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $1698
+ADDRLP4 8
+ADDRGP4 $1701
+ASGNP4
+ADDRGP4 $1699
+JUMPV
+LABELV $1698
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 12
+NEI4 $1702
+ADDRLP4 8
+ADDRGP4 $1705
+ASGNP4
+ADDRGP4 $1703
+JUMPV
+LABELV $1702
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $1706
+ADDRLP4 8
+ADDRGP4 $1709
+ASGNP4
+ADDRGP4 $1707
+JUMPV
+LABELV $1706
+ADDRLP4 8
+ADDRGP4 $1710
+ASGNP4
+LABELV $1707
+LABELV $1703
+LABELV $1699
+LABELV $1695
+LABELV $1691
+LABELV $1687
+LABELV $1683
+LABELV $1679
+LABELV $1675
+LABELV $1671
+LABELV $1667
+LABELV $1663
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1711
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1711
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1712
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1066192077
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1641
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1714
+ADDRGP4 cg+125248
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1714
+ADDRGP4 $1717
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+125252
+INDIRI4
+EQI4 $1718
+ADDRGP4 cg+125252
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1724
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1727
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1730
+ADDRGP4 $1723
+JUMPV
+LABELV $1724
+ADDRGP4 cgs+180272+1364
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1723
+JUMPV
+LABELV $1727
+ADDRGP4 cgs+180272+1360
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1723
+JUMPV
+LABELV $1730
+ADDRGP4 cgs+180272+1356
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1723
+LABELV $1718
+ADDRLP4 28
+CNSTF4 1055286886
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+125252
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1736
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+EQI4 $1737
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+EQI4 $1738
+ADDRGP4 $1733
+JUMPV
+LABELV $1736
+ADDRLP4 12
+CNSTI4 28
+ASGNI4
+ADDRLP4 28
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $1734
+JUMPV
+LABELV $1737
+ADDRLP4 12
+CNSTI4 24
+ASGNI4
+ADDRLP4 28
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $1734
+JUMPV
+LABELV $1738
+ADDRLP4 12
+CNSTI4 20
+ASGNI4
+ADDRLP4 28
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $1734
+JUMPV
+LABELV $1733
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRLP4 28
+CNSTF4 1055286886
+ASGNF4
+LABELV $1734
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1632
+endproc CG_DrawWarmup 60 36
+proc CG_Draw2D 12 4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1740
+ADDRGP4 $1739
+JUMPV
+LABELV $1740
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1743
+ADDRGP4 $1739
+JUMPV
+LABELV $1743
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1746
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1739
+JUMPV
+LABELV $1746
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1749
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1752
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1752
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1750
+JUMPV
+LABELV $1749
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114784
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1754
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1754
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRGP4 CG_DrawProxWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1758
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1758
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawHoldableItem
+CALLV
+pop
+ADDRGP4 CG_DrawPersistantPowerup
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+LABELV $1754
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1760
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1760
+ADDRGP4 CG_DrawTeamInfo
+CALLV
+pop
+LABELV $1760
+LABELV $1750
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRGP4 CG_DrawFragMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1764
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+LABELV $1764
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114788
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+114788
+INDIRI4
+CNSTI4 0
+NEI4 $1767
+ADDRGP4 CG_DrawCenterDDString
+CALLV
+pop
+ADDRGP4 CG_DrawCenter1FctfString
+CALLV
+pop
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1767
+ADDRLP4 8
+ADDRGP4 CG_DrawAccboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114916
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1739
+endproc CG_Draw2D 12 4
+proc CG_DrawTourneyScoreboard 0 0
+ADDRGP4 CG_DrawOldTourneyScoreboard
+CALLV
+pop
+LABELV $1771
+endproc CG_DrawTourneyScoreboard 0 0
+export CG_DrawActive
+proc CG_DrawActive 0 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1773
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1772
+JUMPV
+LABELV $1773
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1776
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1776
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1772
+JUMPV
+LABELV $1776
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRGP4 cg+109252
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+LABELV $1772
+endproc CG_DrawActive 0 4
+import trap_Cmd_ExecuteText
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1717
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1710
+byte 1 0
+align 1
+LABELV $1709
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1705
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1701
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1697
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1693
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $1689
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1685
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1681
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1677
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1673
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1669
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1665
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1659
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1638
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1630
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 72
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 69
+byte 1 69
+byte 1 78
+byte 1 32
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $1629
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 77
+byte 1 66
+byte 1 85
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1612
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1611
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1594
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1579
+byte 1 45
+byte 1 37
+byte 1 0
+align 1
+LABELV $1578
+byte 1 37
+byte 1 0
+align 1
+LABELV $1574
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1548
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1545
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $1529
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1501
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1486
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1481
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1477
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $1310
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1305
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1291
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 0
+align 1
+LABELV $1289
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 0
+align 1
+LABELV $1287
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 0
+align 1
+LABELV $1225
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $1160
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1156
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1125
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $906
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 94
+byte 1 52
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $835
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $750
+byte 1 40
+byte 1 94
+byte 1 49
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $741
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $713
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $710
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $643
+byte 1 32
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $642
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $618
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $593
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $577
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $576
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $571
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $558
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $557
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $553
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $549
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $545
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $540
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $536
+byte 1 37
+byte 1 100
+byte 1 48
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $516
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $515
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $512
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $500
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $495
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $479
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $474
+byte 1 37
+byte 1 105
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 0
+align 1
+LABELV $468
+byte 1 110
+byte 1 0
+align 1
+LABELV $111
+byte 1 37
+byte 1 105
+byte 1 0
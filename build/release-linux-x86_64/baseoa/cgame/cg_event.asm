@@ -0,0 +1,9880 @@
+bss
+align 1
+LABELV $75
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $76
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $78
+ASGNP4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRLP4 4
+ADDRGP4 $79
+ASGNP4
+LABELV $77
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $80
+ADDRLP4 0
+ADDRGP4 $82
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $83
+ADDRLP4 0
+ADDRGP4 $85
+ASGNP4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $86
+ADDRLP4 0
+ADDRGP4 $88
+ASGNP4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $89
+ADDRLP4 0
+ADDRGP4 $91
+ASGNP4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $92
+ADDRLP4 0
+ADDRGP4 $94
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $95
+ADDRLP4 0
+ADDRGP4 $97
+ASGNP4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $98
+ADDRGP4 $100
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $101
+ADDRGP4 $103
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $104
+ADDRGP4 $106
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $105
+LABELV $102
+LABELV $99
+LABELV $96
+LABELV $93
+LABELV $90
+LABELV $87
+LABELV $84
+LABELV $81
+ADDRGP4 $75
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $75
+RETP4
+LABELV $74
+endproc CG_PlaceString 12 20
+proc CG_Obituary 152 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRGP4 cgs+178832+1104
+ASGNP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $114
+ADDRLP4 40
+INDIRI4
+CNSTI4 64
+LTI4 $112
+LABELV $114
+ADDRGP4 $115
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $112
+ADDRLP4 104
+CNSTI4 2120
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $119
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $117
+LABELV $119
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 128
+INDIRP4
+ASGNP4
+LABELV $118
+ADDRLP4 40
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $120
+ADDRGP4 $109
+JUMPV
+LABELV $120
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 132
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 100
+ADDRGP4 $79
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1022
+EQI4 $124
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $124
+ADDRLP4 52
+INDIRI4
+CNSTI4 14
+LTI4 $128
+ADDRLP4 52
+INDIRI4
+CNSTI4 22
+GTI4 $128
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $164-56
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $164
+address $142
+address $146
+address $150
+address $138
+address $128
+address $134
+address $130
+address $154
+address $158
+code
+LABELV $130
+ADDRLP4 48
+ADDRGP4 $131
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $134
+ADDRLP4 48
+ADDRGP4 $135
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $138
+ADDRLP4 48
+ADDRGP4 $139
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $142
+ADDRLP4 48
+ADDRGP4 $143
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $146
+ADDRLP4 48
+ADDRGP4 $147
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $150
+ADDRLP4 48
+ADDRGP4 $151
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $154
+ADDRLP4 48
+ADDRGP4 $155
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $158
+ADDRLP4 48
+ADDRGP4 $159
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+LABELV $129
+LABELV $125
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $166
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 13
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $204
+ADDRLP4 52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+GTI4 $228
+LABELV $227
+ADDRLP4 52
+INDIRI4
+CNSTI4 5
+EQI4 $174
+ADDRLP4 52
+INDIRI4
+CNSTI4 7
+EQI4 $184
+ADDRLP4 52
+INDIRI4
+CNSTI4 9
+EQI4 $194
+ADDRGP4 $168
+JUMPV
+LABELV $228
+ADDRLP4 52
+INDIRI4
+CNSTI4 25
+EQI4 $208
+ADDRLP4 52
+INDIRI4
+CNSTI4 26
+EQI4 $170
+ADDRGP4 $168
+JUMPV
+LABELV $170
+ADDRLP4 48
+ADDRGP4 $171
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+764
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $174
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $175
+ADDRLP4 48
+ADDRGP4 $177
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $178
+ADDRLP4 48
+ADDRGP4 $180
+ASGNP4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 48
+ADDRGP4 $181
+ASGNP4
+LABELV $179
+LABELV $176
+ADDRLP4 92
+ADDRGP4 cgs+180272+760
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $184
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $185
+ADDRLP4 48
+ADDRGP4 $187
+ASGNP4
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $188
+ADDRLP4 48
+ADDRGP4 $190
+ASGNP4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 48
+ADDRGP4 $191
+ASGNP4
+LABELV $189
+LABELV $186
+ADDRLP4 92
+ADDRGP4 cgs+180272+792
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $194
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $195
+ADDRLP4 48
+ADDRGP4 $197
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $198
+ADDRLP4 48
+ADDRGP4 $200
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 48
+ADDRGP4 $201
+ASGNP4
+LABELV $199
+LABELV $196
+ADDRLP4 92
+ADDRGP4 cgs+180272+780
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $204
+ADDRLP4 48
+ADDRGP4 $205
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+744
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $208
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $209
+ADDRLP4 48
+ADDRGP4 $211
+ASGNP4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $212
+ADDRLP4 48
+ADDRGP4 $214
+ASGNP4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 48
+ADDRGP4 $215
+ASGNP4
+LABELV $213
+LABELV $210
+ADDRLP4 92
+ADDRGP4 cgs+180272+784
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $218
+ADDRLP4 48
+ADDRGP4 $220
+ASGNP4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $221
+ADDRLP4 48
+ADDRGP4 $223
+ASGNP4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 48
+ADDRGP4 $224
+ASGNP4
+LABELV $222
+LABELV $219
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+LABELV $169
+LABELV $166
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRLP4 8
+ARGP4
+ADDRLP4 136
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 1
+EQI4 $235
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 4
+NEI4 $231
+LABELV $235
+ADDRGP4 $236
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $231
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+LTI4 $109
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $240
+ADDRLP4 140
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832
+ADDP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832+276
+ADDP4
+INDIRB
+ASGNB 276
+LABELV $241
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $240
+ADDRGP4 cgs+178832+1104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 276
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 200
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $229
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $251
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+GEI4 $254
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $260
+ADDRGP4 $262
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRGP4 $263
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+ASGNP4
+LABELV $261
+LABELV $255
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1098907648
+ADDRGP4 cg_fragmsgsize+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $251
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $265
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 140
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $268
+ADDRGP4 cg+114924
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $268
+LABELV $266
+ADDRLP4 4
+INDIRI4
+CNSTI4 1022
+EQI4 $273
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+LTI4 $275
+ADDRLP4 52
+INDIRI4
+CNSTI4 28
+GTI4 $275
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $388-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $388
+address $289
+address $281
+address $285
+address $293
+address $298
+address $303
+address $307
+address $311
+address $316
+address $319
+address $323
+address $327
+address $327
+address $275
+address $364
+address $360
+address $376
+address $355
+address $368
+address $381
+address $275
+address $372
+address $332
+address $336
+address $341
+address $346
+address $351
+address $277
+code
+LABELV $277
+ADDRLP4 48
+ADDRGP4 $278
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+756
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $281
+ADDRLP4 48
+ADDRGP4 $282
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+752
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $285
+ADDRLP4 48
+ADDRGP4 $286
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+772
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $289
+ADDRLP4 48
+ADDRGP4 $290
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+796
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $293
+ADDRLP4 48
+ADDRGP4 $294
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $295
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+760
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $298
+ADDRLP4 48
+ADDRGP4 $299
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $300
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+760
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $303
+ADDRLP4 48
+ADDRGP4 $294
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $304
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+792
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $307
+ADDRLP4 48
+ADDRGP4 $308
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $304
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+792
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $311
+ADDRLP4 48
+ADDRGP4 $312
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $313
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+780
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $316
+ADDRLP4 48
+ADDRGP4 $312
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $313
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+780
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $319
+ADDRLP4 48
+ADDRGP4 $320
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+788
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $323
+ADDRLP4 48
+ADDRGP4 $324
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+768
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $327
+ADDRLP4 48
+ADDRGP4 $328
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $329
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+744
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $332
+ADDRLP4 48
+ADDRGP4 $333
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+776
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $336
+ADDRLP4 48
+ADDRGP4 $337
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $338
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+748
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $341
+ADDRLP4 48
+ADDRGP4 $342
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $343
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+784
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $346
+ADDRLP4 48
+ADDRGP4 $347
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $348
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+764
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $351
+ADDRLP4 48
+ADDRGP4 $352
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+784
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $355
+ADDRLP4 48
+ADDRGP4 $356
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $357
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $360
+ADDRLP4 48
+ADDRGP4 $361
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $364
+ADDRLP4 48
+ADDRGP4 $365
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $368
+ADDRLP4 48
+ADDRGP4 $369
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $372
+ADDRLP4 48
+ADDRGP4 $373
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $376
+ADDRLP4 48
+ADDRGP4 $377
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $378
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $381
+ADDRLP4 48
+ADDRGP4 $382
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 48
+ADDRGP4 $385
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+LABELV $276
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRLP4 48
+ADDRGP4 $394
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $79
+ASGNP4
+LABELV $392
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 1
+EQI4 $399
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 4
+NEI4 $395
+LABELV $399
+ADDRGP4 $400
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $395
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+LTI4 $109
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $404
+ADDRLP4 144
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cgs+178832
+ADDP4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cgs+178832+276
+ADDP4
+INDIRB
+ASGNB 276
+LABELV $405
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $404
+ADDRGP4 cgs+178832+1104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 276
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 144
+CNSTI4 32
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 200
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $390
+LABELV $273
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 1
+EQI4 $419
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 4
+NEI4 $415
+LABELV $419
+ADDRGP4 $420
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $415
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+LTI4 $421
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $424
+ADDRLP4 140
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832
+ADDP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832+276
+ADDP4
+INDIRB
+ASGNB 276
+LABELV $425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $424
+ADDRGP4 cgs+178832+1104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 276
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 140
+CNSTI4 32
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $436
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 200
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $421
+LABELV $109
+endproc CG_Obituary 152 20
+proc CG_UseItem 32 16
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $440
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $438
+LABELV $440
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $438
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRGP4 $446
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $447
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $445
+LABELV $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $448
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $448
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $466
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $466
+address $450
+address $449
+address $454
+address $449
+address $449
+address $463
+code
+LABELV $448
+LABELV $450
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+816
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $449
+JUMPV
+LABELV $454
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $455
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+GEI4 $455
+ADDRLP4 16
+CNSTI4 2120
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $455
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+1260
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $449
+JUMPV
+LABELV $463
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+1012
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $449
+LABELV $437
+endproc CG_UseItem 32 16
+proc CG_WeaponHigher 28 16
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg_weaponOrder+16
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 16
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg_weaponOrder+16
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+EQU4 $473
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+NEU4 $471
+LABELV $473
+CNSTI4 0
+RETI4
+ADDRGP4 $467
+JUMPV
+LABELV $471
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+LEU4 $474
+CNSTI4 1
+RETI4
+ADDRGP4 $467
+JUMPV
+LABELV $474
+CNSTI4 0
+RETI4
+LABELV $467
+endproc CG_WeaponHigher 28 16
+proc CG_ItemPickup 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125256
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125260
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125264
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $482
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 1
+NEI4 $485
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $485
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $485
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 2
+NEI4 $493
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $493
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $493
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 3
+NEI4 $502
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_WeaponHigher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $502
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $502
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 4
+NEI4 $511
+ADDRLP4 4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $511
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_WeaponHigher
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $511
+LABELV $482
+LABELV $476
+endproc CG_ItemPickup 12 8
+export CG_WaterLevel
+proc CG_WaterLevel 52 8
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3250061312
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $526
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $524
+LABELV $526
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRGP4 cg_enableQ+12
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102053376
+ADDF4
+ASGNF4
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $529
+LABELV $525
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $533
+ADDRLP4 40
+CNSTF4 3250585600
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $537
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $540
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+LABELV $540
+LABELV $537
+LABELV $533
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $522
+endproc CG_WaterLevel 52 8
+export CG_PainEvent
+proc CG_PainEvent 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $543
+ADDRGP4 $542
+JUMPV
+LABELV $543
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $546
+ADDRLP4 0
+ADDRGP4 $548
+ASGNP4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $549
+ADDRLP4 0
+ADDRGP4 $551
+ASGNP4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $552
+ADDRLP4 0
+ADDRGP4 $554
+ASGNP4
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRLP4 0
+ADDRGP4 $555
+ASGNP4
+LABELV $553
+LABELV $550
+LABELV $547
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $556
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $558
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $560
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $558
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $542
+endproc CG_PainEvent 16 16
+lit
+align 4
+LABELV $709
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_EntityEvent
+code
+proc CG_EntityEvent 140 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $564
+ADDRGP4 $567
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $564
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $568
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRGP4 $573
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $568
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $576
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $574
+LABELV $576
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $574
+ADDRLP4 12
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $578
+ADDRLP4 8
+INDIRI4
+CNSTI4 76
+GTI4 $578
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1329-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1329
+address $580
+address $590
+address $601
+address $612
+address $623
+address $674
+address $674
+address $674
+address $674
+address $634
+address $648
+address $660
+address $704
+address $716
+address $727
+address $734
+address $741
+address $748
+address $754
+address $772
+address $786
+address $794
+address $801
+address $806
+address $811
+address $816
+address $821
+address $826
+address $831
+address $836
+address $841
+address $846
+address $851
+address $856
+address $861
+address $866
+address $871
+address $876
+address $578
+address $908
+address $901
+address $881
+address $891
+address $919
+address $1094
+address $1103
+address $1114
+address $1068
+address $1055
+address $993
+address $998
+address $1003
+address $1008
+address $1081
+address $578
+address $1241
+address $1249
+address $1249
+address $1249
+address $1258
+address $1263
+address $1276
+address $1289
+address $1302
+address $988
+address $930
+address $945
+address $952
+address $957
+address $965
+address $970
+address $978
+address $983
+address $1319
+address $1314
+address $721
+code
+LABELV $580
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRGP4 $584
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $581
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cgs+180272+824
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $590
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRGP4 $594
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $591
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $601
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $602
+ADDRGP4 $605
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $602
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $612
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $613
+ADDRGP4 $616
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $613
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $623
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRGP4 $627
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $624
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $634
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $635
+ADDRGP4 $638
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $635
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1096
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $579
+ADDRGP4 cg+109144
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 cg+109148
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $648
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRGP4 $652
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $649
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $555
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $579
+ADDRGP4 cg+109144
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+109148
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $660
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $661
+ADDRGP4 $664
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $661
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $665
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $579
+ADDRGP4 cg+109144
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+109148
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $674
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $675
+ADDRGP4 $678
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $675
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $679
+ADDRGP4 $579
+JUMPV
+LABELV $679
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $691
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 60
+INDIRI4
+NEI4 $691
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $691
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $683
+LABELV $691
+ADDRGP4 $579
+JUMPV
+LABELV $683
+ADDRLP4 48
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109132
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 200
+GEI4 $694
+ADDRLP4 52
+ADDRGP4 cg+109128
+INDIRF4
+CNSTI4 200
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $695
+ADDRLP4 56
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 cg+109128
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109128
+INDIRF4
+CNSTF4 1107296256
+LEF4 $698
+ADDRGP4 cg+109128
+CNSTF4 1107296256
+ASGNF4
+LABELV $698
+ADDRGP4 cg+109132
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $704
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRGP4 $708
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $705
+ADDRLP4 48
+ADDRGP4 $709
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 48
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+180272+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+180272+1104
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $716
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $717
+ADDRGP4 $720
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $717
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $721
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRGP4 $725
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $722
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $726
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $727
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRGP4 $731
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $728
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1244
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $734
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $735
+ADDRGP4 $738
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $735
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1248
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $741
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $742
+ADDRGP4 $745
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $742
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1252
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $748
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $749
+ADDRGP4 $752
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $749
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $754
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRGP4 $758
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $755
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $761
+ADDRLP4 72
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $759
+LABELV $761
+ADDRGP4 $579
+JUMPV
+LABELV $759
+ADDRLP4 68
+CNSTI4 52
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 68
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 5
+EQI4 $764
+ADDRLP4 76
+INDIRI4
+CNSTI4 8
+NEI4 $762
+LABELV $764
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1412
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $763
+JUMPV
+LABELV $762
+ADDRLP4 68
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $767
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $768
+LABELV $763
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $579
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $772
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRGP4 $776
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $773
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $779
+ADDRLP4 72
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $777
+LABELV $779
+ADDRGP4 $579
+JUMPV
+LABELV $777
+ADDRLP4 68
+CNSTI4 52
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $780
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $780
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $579
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $786
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRGP4 $790
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $787
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $579
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $794
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $795
+ADDRGP4 $798
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $795
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+812
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $801
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRGP4 $805
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $802
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $806
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $807
+ADDRGP4 $810
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $807
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $811
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $812
+ADDRGP4 $815
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $812
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $816
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRGP4 $820
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $817
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $821
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $822
+ADDRGP4 $825
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $822
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $826
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $827
+ADDRGP4 $830
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $827
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $831
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $832
+ADDRGP4 $835
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $836
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $837
+ADDRGP4 $840
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $837
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $841
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $842
+ADDRGP4 $845
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $842
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $846
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $847
+ADDRGP4 $850
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $847
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $851
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $852
+ADDRGP4 $855
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $856
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $857
+ADDRGP4 $860
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $857
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $861
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $862
+ADDRGP4 $865
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $862
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $866
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRGP4 $870
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $871
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $872
+ADDRGP4 $875
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $872
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $876
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $877
+ADDRGP4 $880
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $877
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $881
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $882
+ADDRGP4 $885
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $882
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1076
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $888
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $888
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $891
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRGP4 $895
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $892
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1080
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $898
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $898
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $901
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRGP4 $905
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $902
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1088
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $908
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $909
+ADDRGP4 $912
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $909
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1088
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+CNSTI4 41
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $919
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRGP4 $923
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $920
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $924
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1416
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $924
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1420
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $930
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $931
+ADDRGP4 $934
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $931
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $935
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1424
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $935
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $939
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1428
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $939
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1432
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $945
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $946
+ADDRGP4 $949
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $946
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1436
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $952
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $953
+ADDRGP4 $956
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $953
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_KamikazeEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $957
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $958
+ADDRGP4 $961
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $958
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $962
+CNSTI4 17
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $962
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ObeliskExplode
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $965
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $966
+ADDRGP4 $969
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $966
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_ObeliskPain
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $970
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRGP4 $974
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $971
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $975
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $975
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 CG_InvulnerabilityImpact
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $978
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRGP4 $982
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $979
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_InvulnerabilityJuiced
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $983
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $984
+ADDRGP4 $987
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $984
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_LightningBoltBeam
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $988
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $989
+ADDRGP4 $992
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $989
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $993
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $994
+ADDRGP4 $997
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $994
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $998
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $999
+ADDRGP4 $1002
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $999
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1003
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1004
+ADDRGP4 $1007
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1004
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1008
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1009
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1009
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1013
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181712
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1013
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 108
+INDIRI4
+NEI4 $1020
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1013
+LABELV $1020
+ADDRGP4 $579
+JUMPV
+LABELV $1013
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1021
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1021
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+NEI4 $1025
+ADDRLP4 112
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+NEI4 $1039
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1039
+LABELV $1026
+LABELV $1021
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $579
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1055
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1056
+ADDRGP4 $1059
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1060
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181712
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $1060
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 112
+INDIRI4
+NEI4 $1067
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 112
+INDIRI4
+EQI4 $1060
+LABELV $1067
+ADDRGP4 $579
+JUMPV
+LABELV $1060
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1022
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1068
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1069
+ADDRGP4 $1072
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1069
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1073
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181712
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1073
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 116
+INDIRI4
+NEI4 $1080
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1073
+LABELV $1080
+ADDRGP4 $579
+JUMPV
+LABELV $1073
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1081
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+ADDRGP4 $1085
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1082
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1086
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181712
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1086
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 120
+INDIRI4
+NEI4 $1093
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1086
+LABELV $1093
+ADDRGP4 $579
+JUMPV
+LABELV $1086
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1094
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+ADDRGP4 $1098
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1095
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1099
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1099
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1103
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1104
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1104
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1108
+CNSTP4 0
+ARGP4
+ADDRLP4 124
+CNSTI4 184
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1108
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1114
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+ADDRGP4 $1118
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1115
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+LTI4 $579
+ADDRLP4 124
+INDIRI4
+CNSTI4 13
+GTI4 $579
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1240
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1240
+address $1122
+address $1130
+address $1138
+address $1148
+address $1158
+address $1184
+address $1210
+address $1216
+address $1222
+address $1225
+address $1228
+address $1231
+address $1234
+address $1237
+code
+LABELV $1122
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1123
+ADDRGP4 cgs+180272+1292
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1123
+ADDRGP4 cgs+180272+1296
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1130
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1131
+ADDRGP4 cgs+180272+1292
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1131
+ADDRGP4 cgs+180272+1296
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1138
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1139
+ADDRGP4 cgs+180272+1300
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRGP4 cgs+180272+1304
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $1140
+ADDRGP4 cgs+180272+1320
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1148
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1149
+ADDRGP4 cgs+180272+1300
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1150
+JUMPV
+LABELV $1149
+ADDRGP4 cgs+180272+1304
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $1150
+ADDRGP4 cgs+180272+1316
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1158
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $1163
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $1159
+LABELV $1163
+ADDRGP4 $579
+JUMPV
+LABELV $1159
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1164
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1167
+ADDRGP4 cgs+180272+1340
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1167
+ADDRGP4 cgs+180272+1328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1164
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $579
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1177
+ADDRGP4 cgs+180272+1332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1177
+ADDRGP4 cgs+180272+1336
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1184
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+NEI4 $1189
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+EQI4 $1185
+LABELV $1189
+ADDRGP4 $579
+JUMPV
+LABELV $1185
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1190
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1193
+ADDRGP4 cgs+180272+1340
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1193
+ADDRGP4 cgs+180272+1328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1190
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $579
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1203
+ADDRGP4 cgs+180272+1332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1203
+ADDRGP4 cgs+180272+1336
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1210
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $579
+ADDRGP4 cgs+180272+1348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1216
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $579
+ADDRGP4 cgs+180272+1348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1222
+ADDRGP4 cgs+180272+1272
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1225
+ADDRGP4 cgs+180272+1276
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1228
+ADDRGP4 cgs+180272+1280
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1231
+ADDRGP4 cgs+180272+1284
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1234
+ADDRGP4 cgs+180272+1288
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1237
+ADDRGP4 cgs+180272+1008
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1241
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1242
+ADDRGP4 $1245
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1242
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1249
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1250
+ADDRGP4 $1253
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+LTI4 $1254
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1256
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1254
+ADDRGP4 $1257
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1258
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1259
+ADDRGP4 $1262
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1259
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1263
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRGP4 $1267
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1264
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1268
+ADDRGP4 cg+125000
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+125004
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1268
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+804
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1276
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1277
+ADDRGP4 $1280
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1277
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1281
+ADDRGP4 cg+125000
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+125004
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1281
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+1408
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1289
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1290
+ADDRGP4 $1293
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1290
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1294
+ADDRGP4 cg+125000
+CNSTI4 5
+ASGNI4
+ADDRGP4 cg+125004
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1294
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+1404
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1302
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1303
+ADDRGP4 $1306
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1303
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $1307
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+1060
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1307
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+CNSTI4 16
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $1314
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1315
+ADDRGP4 $1318
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1315
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $1319
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1320
+ADDRGP4 $1323
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1324
+ADDRGP4 $1327
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1324
+ADDRGP4 $1328
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $579
+LABELV $563
+endproc CG_EntityEvent 140 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1334
+ADDRGP4 $1331
+JUMPV
+LABELV $1334
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1336
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1336
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+ASGNI4
+ADDRGP4 $1333
+JUMPV
+LABELV $1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+NEI4 $1338
+ADDRGP4 $1331
+JUMPV
+LABELV $1338
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $1340
+ADDRGP4 $1331
+JUMPV
+LABELV $1340
+LABELV $1333
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $1331
+endproc CG_CheckEvents 8 12
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1328
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1327
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1323
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1318
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1306
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1293
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1280
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1267
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1262
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $1257
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1256
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1253
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $1245
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1118
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1107
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1098
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1085
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1072
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1059
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1012
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1007
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1002
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $997
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $992
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $987
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $982
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $974
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 85
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $969
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $961
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $956
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $949
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $934
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 10
+byte 1 0
+align 1
+LABELV $923
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $912
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $905
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $895
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $885
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $880
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $875
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $870
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $865
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $860
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $855
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 10
+byte 1 0
+align 1
+LABELV $850
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 10
+byte 1 0
+align 1
+LABELV $845
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $840
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 10
+byte 1 0
+align 1
+LABELV $835
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $830
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $825
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $820
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $815
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $810
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $805
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $798
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $790
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $776
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $758
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $753
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $752
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $745
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $738
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $731
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $726
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $725
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $720
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $715
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $708
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $678
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $665
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $664
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $652
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $638
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $627
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $616
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $605
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $594
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $584
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $573
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $567
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $561
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $555
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $554
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $551
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $548
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $468
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 0
+align 1
+LABELV $447
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $446
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $436
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $420
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $414
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $400
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $394
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $385
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $382
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $378
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $377
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $373
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $369
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $365
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $361
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $357
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $356
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $352
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $348
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $347
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $343
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $342
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $338
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $337
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $333
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $329
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $328
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $324
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $320
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $313
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $312
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $308
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $304
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $300
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $299
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $295
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $294
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $290
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $286
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $282
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $278
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $267
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $263
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $262
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $257
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $250
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $236
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $223
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $220
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $215
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $214
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $211
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $205
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $201
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $200
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $197
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $191
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $190
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $187
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $181
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $180
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 103
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $159
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $151
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $143
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $139
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $131
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $123
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $122
+byte 1 110
+byte 1 0
+align 1
+LABELV $115
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $106
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $103
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $100
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $97
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $91
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $88
+byte 1 94
+byte 1 51
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $85
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $82
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $79
+byte 1 0
+align 1
+LABELV $78
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
@@ -0,0 +1,6044 @@
+export CG_InitLocalEntities
+code
+proc CG_InitLocalEntities 12 12
+ADDRGP4 cg_localEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 167936
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_activeLocalEntities+4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRGP4 cg_localEntities
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $76
+ADDRLP4 8
+CNSTI4 328
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+328
+ADDP4
+ASGNP4
+LABELV $77
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 511
+LTI4 $76
+LABELV $74
+endproc CG_InitLocalEntities 12 12
+export CG_FreeLocalEntity
+proc CG_FreeLocalEntity 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $83
+ADDRGP4 $85
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $83
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $82
+endproc CG_FreeLocalEntity 12 4
+export CG_AllocLocalEntity
+proc CG_AllocLocalEntity 12 12
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $87
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $87
+ADDRLP4 4
+ADDRGP4 cg_freeLocalEntities
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 328
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $86
+endproc CG_AllocLocalEntity 12 12
+export CG_BloodTrail
+proc CG_BloodTrail 44 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107600
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTF4 1157234688
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+360
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $97
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $99
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $96
+LABELV $92
+endproc CG_BloodTrail 44 48
+export CG_SmallBloodTrail
+proc CG_SmallBloodTrail 44 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 61
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107600
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTF4 1145077760
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+400
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1123024896
+ASGNF4
+LABELV $107
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $109
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $106
+LABELV $102
+endproc CG_SmallBloodTrail 44 48
+export CG_FragmentBounceMark
+proc CG_FragmentBounceMark 20 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $113
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+524
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $117
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+532
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $117
+LABELV $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $112
+endproc CG_FragmentBounceMark 20 44
+export CG_FragmentBounceSound
+proc CG_FragmentBounceSound 16 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $122
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $123
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRLP4 8
+ADDRGP4 cgs+180272+1064
+INDIRI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $130
+ADDRLP4 8
+ADDRGP4 cgs+180272+1068
+INDIRI4
+ASGNI4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 8
+ADDRGP4 cgs+180272+1072
+INDIRI4
+ASGNI4
+LABELV $131
+LABELV $127
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $136
+ADDRGP4 cg_leiBrassNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $143
+ADDRLP4 8
+ADDRGP4 cgs+180272+1120
+INDIRI4
+ASGNI4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $147
+ADDRLP4 8
+ADDRGP4 cgs+180272+1124
+INDIRI4
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 8
+ADDRGP4 cgs+180272+1128
+INDIRI4
+ASGNI4
+LABELV $148
+LABELV $144
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $153
+ADDRGP4 cg_leiBrassNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $158
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $160
+ADDRLP4 8
+ADDRGP4 cgs+180272+1132
+INDIRI4
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $164
+ADDRLP4 8
+ADDRGP4 cgs+180272+1136
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRLP4 8
+ADDRGP4 cgs+180272+1140
+INDIRI4
+ASGNI4
+LABELV $165
+LABELV $161
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $158
+LABELV $155
+LABELV $153
+LABELV $137
+LABELV $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $121
+endproc CG_FragmentBounceSound 16 16
+export CG_GoreMark
+proc CG_GoreMark 20 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $171
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 6
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+404
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $170
+endproc CG_GoreMark 20 44
+export CG_SplatSound
+proc CG_SplatSound 16 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $176
+ADDRGP4 cg_leiGoreNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRLP4 8
+ADDRGP4 cgs+180272+1108
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $187
+ADDRLP4 8
+ADDRGP4 cgs+180272+1112
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRLP4 8
+ADDRGP4 cgs+180272+1116
+INDIRI4
+ASGNI4
+LABELV $188
+LABELV $184
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $193
+LABELV $193
+LABELV $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $175
+endproc CG_SplatSound 16 16
+export CG_ReflectVelocity
+proc CG_ReflectVelocity 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107600
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $208
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $204
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1109393408
+LTF4 $208
+ADDRLP4 60
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+NEGI4
+CVIF4 4
+ADDRLP4 60
+INDIRF4
+MULF4
+GEF4 $204
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $204
+LABELV $205
+LABELV $195
+endproc CG_ReflectVelocity 64 12
+export CG_AddFragment
+proc CG_AddFragment 88 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $210
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1000
+GEI4 $213
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $209
+JUMPV
+LABELV $213
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $209
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_BloodTrail
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $216
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceMark
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ReflectVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $209
+endproc CG_AddFragment 88 28
+export CG_JustSplat
+proc CG_JustSplat 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107600
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $240
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $236
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1109393408
+LTF4 $240
+ADDRLP4 60
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+NEGI4
+CVIF4 4
+ADDRLP4 60
+INDIRF4
+MULF4
+GEF4 $236
+LABELV $240
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $236
+LABELV $237
+LABELV $227
+endproc CG_JustSplat 64 12
+export CG_AddGore
+proc CG_AddGore 84 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SmallBloodTrail
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $245
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_GoreMark
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_SplatSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_JustSplat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $241
+endproc CG_AddGore 84 28
+export CG_AddFadeRGB
+proc CG_AddFadeRGB 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $257
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $258
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $260
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $261
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $263
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $264
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $266
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $267
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $254
+endproc CG_AddFadeRGB 60 4
+proc CG_AddMoveScaleFade 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $269
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $269
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $270
+ADDRLP4 36
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $275
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $276
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 32
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $277
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+GEF4 $290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $290
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $268
+endproc CG_AddMoveScaleFade 52 12
+proc CG_AddScaleFade 48 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $295
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+GEF4 $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $292
+JUMPV
+LABELV $310
+LABELV $307
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $292
+endproc CG_AddScaleFade 48 4
+proc CG_AddFallScaleFade 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $315
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $316
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+GEF4 $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $312
+JUMPV
+LABELV $330
+LABELV $327
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $312
+endproc CG_AddFallScaleFade 52 4
+proc CG_AddExplosion 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $333
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+GEF4 $336
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 4
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $337
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $333
+LABELV $332
+endproc CG_AddExplosion 20 20
+proc CG_AddSpriteExplosion 180 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 140
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $340
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $340
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 156
+CNSTF4 1051260355
+CNSTF4 1132396544
+ADDRLP4 140
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $350
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $351
+ADDRLP4 0+116+3
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1109917696
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $353
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1056964608
+GEF4 $356
+ADDRLP4 164
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 164
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 164
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $357
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $353
+LABELV $338
+endproc CG_AddSpriteExplosion 180 20
+export CG_AddKamikaze
+proc CG_AddKamikaze 284 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 184
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 204
+CNSTF4 0
+ASGNF4
+ADDRLP4 188+8
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+LEI4 $363
+ADDRLP4 184
+INDIRI4
+CNSTI4 2000
+GEI4 $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $365
+ADDRGP4 cgs+180272+1000
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 212
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $365
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+ADDRGP4 cgs+180272+652
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+128
+ADDRLP4 180
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+68
+ADDRLP4 180
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ASGNF4
+ADDRLP4 4+28
+ADDRLP4 144
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+4
+ADDRLP4 144+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+8
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12
+ADDRLP4 144+12
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+4
+ADDRLP4 144+12+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+8
+ADDRLP4 144+12+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24
+ADDRLP4 144+24
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+4
+ADDRLP4 144+24+4
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+8
+ADDRLP4 144+24+8
+INDIRF4
+CNSTF4 1151664128
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 1500
+LEI4 $408
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+CNSTI4 1500
+SUBI4
+CVIF4 4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $409
+ADDRLP4 216
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 0
+ADDRLP4 216
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 216
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $412
+ADDRLP4 212
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 212
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $413
+ADDRLP4 4+116
+ADDRLP4 212
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 232
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+LTF4 $417
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $418
+ADDRLP4 4+116+1
+ADDRLP4 228
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 244
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+LTF4 $422
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $423
+ADDRLP4 4+116+2
+ADDRLP4 240
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 256
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+LTF4 $427
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $428
+ADDRLP4 4+116+3
+ADDRLP4 252
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $363
+ADDRLP4 184
+INDIRI4
+CNSTI4 250
+LEI4 $429
+ADDRLP4 184
+INDIRI4
+CNSTI4 2250
+GEI4 $429
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 224
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+LTF4 $433
+ADDRLP4 216
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 216
+ADDRLP4 224
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $434
+ADDRLP4 180
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 216
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+LTF4 $436
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 232
+ADDRLP4 236
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $437
+ADDRLP4 180
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 232
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+LTF4 $439
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 244
+ADDRLP4 248
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $440
+ADDRLP4 180
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 244
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 264
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 264
+INDIRF4
+LTF4 $442
+ADDRLP4 256
+ADDRLP4 260
+INDIRF4
+ADDRLP4 264
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 256
+ADDRLP4 260
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $443
+ADDRLP4 180
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 256
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 184
+INDIRI4
+CNSTI4 2000
+GEI4 $444
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+CNSTI4 250
+SUBI4
+CVIF4 4
+CNSTF4 1155186688
+DIVF4
+ASGNF4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $446
+ADDRGP4 cgs+180272+1004
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $446
+ADDRLP4 0
+CNSTI4 2250
+ADDRLP4 184
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+LABELV $445
+ADDRLP4 180
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 144+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 144+12
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 144+12+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 144+12+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 144+24
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 144+24+4
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 144+24+8
+INDIRF4
+CNSTF4 1144258560
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1116733440
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 180
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 272
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 272
+INDIRF4
+ARGF4
+ADDRLP4 272
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $429
+ADDRLP4 184
+INDIRI4
+CNSTI4 2000
+LEI4 $462
+ADDRLP4 184
+INDIRI4
+CNSTI4 3000
+GEI4 $462
+ADDRLP4 224
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+NEF4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+NEF4 $464
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+NEF4 $464
+ADDRLP4 228
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 228
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 232
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 232
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 236
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 236
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $465
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+ADDRGP4 cgs+180272+652
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+128
+ADDRLP4 180
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+68
+ADDRLP4 180
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 188+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 188+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+CNSTI4 2000
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4+28
+ADDRLP4 144
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+4
+ADDRLP4 144+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+8
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12
+ADDRLP4 144+12
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+4
+ADDRLP4 144+12+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+12+8
+ADDRLP4 144+12+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24
+ADDRLP4 144+24
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+4
+ADDRLP4 144+24+4
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+28+24+8
+ADDRLP4 144+24+8
+INDIRF4
+CNSTF4 1143996416
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1118830592
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2500
+LEI4 $507
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+CNSTI4 2500
+SUBI4
+CVIF4 4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $508
+ADDRLP4 236
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 0
+ADDRLP4 236
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 236
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 244
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+LTF4 $511
+ADDRLP4 232
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 232
+ADDRLP4 240
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $512
+ADDRLP4 4+116
+ADDRLP4 232
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 252
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+LTF4 $516
+ADDRLP4 248
+ADDRLP4 252
+INDIRF4
+ADDRLP4 256
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 248
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $517
+ADDRLP4 4+116+1
+ADDRLP4 248
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 264
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+LTF4 $521
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 260
+ADDRLP4 264
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $522
+ADDRLP4 4+116+2
+ADDRLP4 260
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 276
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 280
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+LTF4 $526
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 272
+ADDRLP4 276
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $527
+ADDRLP4 4+116+3
+ADDRLP4 272
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $462
+LABELV $359
+endproc CG_AddKamikaze 284 20
+export CG_AddInvulnerabilityImpact
+proc CG_AddInvulnerabilityImpact 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $528
+endproc CG_AddInvulnerabilityImpact 0 4
+export CG_AddInvulnerabilityJuiced
+proc CG_AddInvulnerabilityJuiced 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3000
+LEI4 $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 1050253722
+ADDRLP4 0
+INDIRI4
+CNSTI4 3000
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1157234688
+DIVF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1050253722
+ADDRLP4 0
+INDIRI4
+CNSTI4 3000
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1157234688
+DIVF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTF4 1050253722
+CNSTI4 2000
+ADDRLP4 0
+INDIRI4
+CNSTI4 3000
+SUBI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1157234688
+DIVF4
+CNSTF4 1060320051
+ADDF4
+ASGNF4
+LABELV $531
+ADDRLP4 0
+INDIRI4
+CNSTI4 5000
+LEI4 $533
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $534
+LABELV $529
+endproc CG_AddInvulnerabilityJuiced 4 4
+export CG_AddRefEntity
+proc CG_AddRefEntity 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $535
+endproc CG_AddRefEntity 0 4
+lit
+align 4
+LABELV $540
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_AddScorePlum
+code
+proc CG_AddScorePlum 172 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $540
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $542
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+LTI4 $544
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+LTI4 $546
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LTI4 $548
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $550
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+LABELV $550
+LABELV $549
+LABELV $547
+LABELV $545
+LABELV $543
+ADDRLP4 80
+INDIRF4
+CNSTF4 1048576000
+GEF4 $552
+ADDRLP4 136
+CNSTF4 1149173760
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $555
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $556
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $553
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1121714176
+CNSTF4 1120403456
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+109252+24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 148
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 152
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+109252+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1101004800
+GEF4 $588
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $588
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GEI4 $590
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $590
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $595
+JUMPV
+LABELV $592
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $593
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $595
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $592
+ADDRLP4 12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $592
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $596
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $596
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $598
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cgs+180272+452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $599
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $601
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $598
+LABELV $539
+endproc CG_AddScorePlum 172 12
+export CG_AddLocalEntities
+proc CG_AddLocalEntities 20 8
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $612
+JUMPV
+LABELV $609
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $613
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $613
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $616
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+GTI4 $616
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $634
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $634
+address $617
+address $622
+address $621
+address $623
+address $624
+address $626
+address $625
+address $627
+address $628
+address $629
+address $630
+address $631
+address $632
+address $633
+code
+LABELV $616
+ADDRGP4 $619
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $621
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddSpriteExplosion
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $622
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddExplosion
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $623
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFragment
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $624
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddMoveScaleFade
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $625
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFadeRGB
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $626
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFallScaleFade
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $627
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScaleFade
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $628
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScorePlum
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $629
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddKamikaze
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $630
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddInvulnerabilityImpact
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $631
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddInvulnerabilityJuiced
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $632
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddRefEntity
+CALLV
+pop
+ADDRGP4 $617
+JUMPV
+LABELV $633
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddGore
+CALLV
+pop
+LABELV $617
+LABELV $610
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $612
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $609
+LABELV $608
+endproc CG_AddLocalEntities 20 8
+bss
+export cg_freeLocalEntities
+align 4
+LABELV cg_freeLocalEntities
+skip 4
+export cg_activeLocalEntities
+align 4
+LABELV cg_activeLocalEntities
+skip 328
+export cg_localEntities
+align 4
+LABELV cg_localEntities
+skip 167936
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $619
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $85
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
@@ -0,0 +1,18867 @@
+data
+export forceModelModificationCount
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $75
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $75
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $87
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $87
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+code
+LABELV $77
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $78
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $79
+ADDRLP4 4
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $80
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+ADDRGP4 CG_FairCvars
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $81
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $82
+ADDRLP4 12
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $83
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $84
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $85
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRGP4 $86
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $76
+CNSTI4 -1
+RETI4
+LABELV $74
+endproc vmMain 16 12
+data
+align 4
+LABELV cvarTable
+address cg_ignore
+address $89
+address $90
+byte 4 0
+address cg_autoswitch
+address $91
+address $92
+byte 4 1
+address cg_drawGun
+address $93
+address $92
+byte 4 1
+address cg_zoomFov
+address $94
+address $95
+byte 4 1
+address cg_fov
+address $96
+address $97
+byte 4 1
+address cg_viewsize
+address $98
+address $99
+byte 4 1
+address cg_shadows
+address $100
+address $92
+byte 4 1
+address cg_gibs
+address $101
+address $92
+byte 4 1
+address cg_draw2D
+address $102
+address $92
+byte 4 1
+address cg_drawStatus
+address $103
+address $92
+byte 4 1
+address cg_drawTimer
+address $104
+address $90
+byte 4 1
+address cg_drawFPS
+address $105
+address $90
+byte 4 1
+address cg_drawSnapshot
+address $106
+address $90
+byte 4 1
+address cg_draw3dIcons
+address $107
+address $92
+byte 4 1
+address cg_drawIcons
+address $108
+address $92
+byte 4 1
+address cg_drawAmmoWarning
+address $109
+address $92
+byte 4 1
+address cg_drawAttacker
+address $110
+address $92
+byte 4 1
+address cg_drawSpeed
+address $111
+address $90
+byte 4 1
+address cg_drawCrosshair
+address $112
+address $113
+byte 4 1
+address cg_drawCrosshairNames
+address $114
+address $92
+byte 4 1
+address cg_drawRewards
+address $115
+address $92
+byte 4 1
+address cg_crosshairSize
+address $116
+address $117
+byte 4 1
+address cg_crosshairHealth
+address $118
+address $92
+byte 4 1
+address cg_crosshairX
+address $119
+address $90
+byte 4 1
+address cg_crosshairY
+address $120
+address $90
+byte 4 1
+address cg_brassTime
+address $121
+address $122
+byte 4 1
+address cg_simpleItems
+address $123
+address $90
+byte 4 1
+address cg_addMarks
+address $124
+address $92
+byte 4 1
+address cg_lagometer
+address $125
+address $92
+byte 4 1
+address cg_railTrailTime
+address $126
+address $127
+byte 4 1
+address cg_gun_x
+address $128
+address $90
+byte 4 512
+address cg_gun_y
+address $129
+address $90
+byte 4 512
+address cg_gun_z
+address $130
+address $90
+byte 4 512
+address cg_centertime
+address $131
+address $132
+byte 4 512
+address cg_runpitch
+address $133
+address $134
+byte 4 1
+address cg_runroll
+address $135
+address $136
+byte 4 1
+address cg_bob
+address $137
+address $92
+byte 4 1
+address cg_bobup
+address $138
+address $136
+byte 4 512
+address cg_bobpitch
+address $139
+address $134
+byte 4 1
+address cg_bobroll
+address $140
+address $134
+byte 4 1
+address cg_bobmodel
+address $141
+address $90
+byte 4 1
+address cg_kickScale
+address $142
+address $143
+byte 4 1
+address cg_swingSpeed
+address $144
+address $145
+byte 4 512
+address cg_animSpeed
+address $146
+address $92
+byte 4 512
+address cg_debugAnim
+address $147
+address $90
+byte 4 512
+address cg_debugPosition
+address $148
+address $90
+byte 4 512
+address cg_debugEvents
+address $149
+address $90
+byte 4 512
+address cg_errorDecay
+address $150
+address $99
+byte 4 0
+address cg_nopredict
+address $151
+address $90
+byte 4 0
+address cg_noPlayerAnims
+address $152
+address $90
+byte 4 512
+address cg_showmiss
+address $153
+address $90
+byte 4 0
+address cg_footsteps
+address $154
+address $92
+byte 4 512
+address cg_tracerChance
+address $155
+address $156
+byte 4 512
+address cg_tracerWidth
+address $157
+address $92
+byte 4 512
+address cg_tracerLength
+address $158
+address $99
+byte 4 512
+address cg_thirdPersonRange
+address $159
+address $160
+byte 4 512
+address cg_thirdPersonAngle
+address $161
+address $90
+byte 4 512
+address cg_thirdPerson
+address $162
+address $90
+byte 4 0
+address cg_teamChatTime
+address $163
+address $164
+byte 4 1
+address cg_teamChatHeight
+address $165
+address $90
+byte 4 1
+address cg_forceModel
+address $166
+address $90
+byte 4 1
+address cg_predictItems
+address $167
+address $92
+byte 4 1
+address cg_deferPlayers
+address $168
+address $92
+byte 4 1
+address cg_drawTeamOverlay
+address $169
+address $90
+byte 4 1
+address cg_teamOverlayUserinfo
+address $170
+address $90
+byte 4 66
+address cg_stats
+address $171
+address $90
+byte 4 0
+address cg_drawFriend
+address $172
+address $92
+byte 4 1
+address cg_teamChatsOnly
+address $173
+address $90
+byte 4 1
+address cg_noVoiceChats
+address $174
+address $90
+byte 4 1
+address cg_noVoiceText
+address $175
+address $90
+byte 4 1
+address cg_buildScript
+address $176
+address $90
+byte 4 0
+address cg_paused
+address $177
+address $90
+byte 4 64
+address cg_blood
+address $178
+address $92
+byte 4 1
+address cg_alwaysWeaponBar
+address $179
+address $90
+byte 4 1
+address cg_hitsound
+address $180
+address $90
+byte 4 1
+address cg_voip_teamonly
+address $181
+address $92
+byte 4 1
+address cg_voteflags
+address $182
+address $183
+byte 4 64
+address cg_cyclegrapple
+address $184
+address $92
+byte 4 1
+address cg_vote_custom_commands
+address $185
+address $186
+byte 4 64
+address cg_synchronousClients
+address $187
+address $90
+byte 4 8
+address cg_autovertex
+address $188
+address $90
+byte 4 1
+address cg_enableFS
+address $189
+address $90
+byte 4 4
+address cg_enableQ
+address $190
+address $90
+byte 4 4
+address cg_enableDust
+address $191
+address $90
+byte 4 4
+address cg_enableBreath
+address $192
+address $90
+byte 4 4
+address cg_obeliskRespawnDelay
+address $193
+address $194
+byte 4 4
+address cg_cameraOrbit
+address $195
+address $90
+byte 4 512
+address cg_cameraOrbitDelay
+address $196
+address $197
+byte 4 1
+address cg_timescaleFadeEnd
+address $198
+address $92
+byte 4 0
+address cg_timescaleFadeSpeed
+address $199
+address $90
+byte 4 0
+address cg_timescale
+address $200
+address $92
+byte 4 0
+address cg_scorePlum
+address $201
+address $92
+byte 4 3
+address cg_obituaryOutput
+address $202
+address $132
+byte 4 1
+address pmove_fixed
+address $203
+address $90
+byte 4 8
+address pmove_msec
+address $204
+address $205
+byte 4 8
+address pmove_float
+address $206
+address $92
+byte 4 8
+address cg_noTaunt
+address $207
+address $90
+byte 4 1
+address cg_noProjectileTrail
+address $208
+address $90
+byte 4 1
+address cg_smallFont
+address $209
+address $210
+byte 4 1
+address cg_bigFont
+address $211
+address $156
+byte 4 1
+address cg_oldRail
+address $212
+address $90
+byte 4 1
+address cg_oldRocket
+address $213
+address $92
+byte 4 1
+address cg_leiEnhancement
+address $214
+address $90
+byte 4 1
+address cg_leiGoreNoise
+address $215
+address $90
+byte 4 1
+address cg_leiBrassNoise
+address $216
+address $90
+byte 4 1
+address cg_leiSuperGoreyAwesome
+address $217
+address $90
+byte 4 1
+address cg_leiDebug
+address $218
+address $90
+byte 4 1
+address cg_leiChibi
+address $219
+address $90
+byte 4 512
+address cg_leiWidescreen
+address $220
+address $92
+byte 4 1
+address cg_deathcam
+address $221
+address $92
+byte 4 1
+address cg_cameramode
+address $222
+address $90
+byte 4 1
+address cg_cameraEyes
+address $223
+address $90
+byte 4 1
+address cg_cameraEyes_Fwd
+address $224
+address $132
+byte 4 512
+address cg_cameraEyes_Up
+address $225
+address $132
+byte 4 512
+address cg_modelEyes_Up
+address $226
+address $132
+byte 4 1
+address cg_modelEyes_Right
+address $227
+address $132
+byte 4 1
+address cg_modelEyes_Fwd
+address $228
+address $132
+byte 4 1
+address cg_oldPlasma
+address $229
+address $92
+byte 4 1
+address cg_delag
+address $230
+address $92
+byte 4 3
+address cg_cmdTimeNudge
+address $231
+address $90
+byte 4 3
+address sv_fps
+address $232
+address $233
+byte 4 8
+address cg_projectileNudge
+address $234
+address $90
+byte 4 1
+address cg_optimizePrediction
+address $235
+address $92
+byte 4 1
+address cl_timeNudge
+address $236
+address $90
+byte 4 1
+address cg_trueLightning
+address $237
+address $238
+byte 4 1
+address cg_music
+address $239
+address $186
+byte 4 1
+address cg_fragmsgsize
+address $240
+address $143
+byte 4 1
+address cg_crosshairPulse
+address $241
+address $92
+byte 4 1
+address cg_differentCrosshairs
+address $242
+address $90
+byte 4 1
+address cg_ch1
+address $243
+address $92
+byte 4 1
+address cg_ch1size
+address $244
+address $117
+byte 4 1
+address cg_ch2
+address $245
+address $92
+byte 4 1
+address cg_ch2size
+address $246
+address $117
+byte 4 1
+address cg_ch3
+address $247
+address $92
+byte 4 1
+address cg_ch3size
+address $248
+address $117
+byte 4 1
+address cg_ch4
+address $249
+address $92
+byte 4 1
+address cg_ch4size
+address $250
+address $117
+byte 4 1
+address cg_ch5
+address $251
+address $92
+byte 4 1
+address cg_ch5size
+address $252
+address $117
+byte 4 1
+address cg_ch6
+address $253
+address $92
+byte 4 1
+address cg_ch6size
+address $254
+address $117
+byte 4 1
+address cg_ch7
+address $255
+address $92
+byte 4 1
+address cg_ch7size
+address $256
+address $117
+byte 4 1
+address cg_ch8
+address $257
+address $92
+byte 4 1
+address cg_ch8size
+address $258
+address $117
+byte 4 1
+address cg_ch9
+address $259
+address $92
+byte 4 1
+address cg_ch9size
+address $260
+address $117
+byte 4 1
+address cg_ch10
+address $261
+address $92
+byte 4 1
+address cg_ch10size
+address $262
+address $117
+byte 4 1
+address cg_ch11
+address $263
+address $92
+byte 4 1
+address cg_ch11size
+address $264
+address $117
+byte 4 1
+address cg_ch12
+address $265
+address $92
+byte 4 1
+address cg_ch12size
+address $266
+address $117
+byte 4 1
+address cg_ch13
+address $267
+address $92
+byte 4 1
+address cg_ch13size
+address $268
+address $117
+byte 4 1
+address cg_crosshairColorRed
+address $269
+address $143
+byte 4 1
+address cg_crosshairColorGreen
+address $270
+address $143
+byte 4 1
+address cg_crosshairColorBlue
+address $271
+address $143
+byte 4 1
+address cg_weaponBarStyle
+address $272
+address $90
+byte 4 1
+address cg_weaponOrder
+address $273
+address $274
+byte 4 1
+address cg_chatBeep
+address $275
+address $92
+byte 4 1
+address cg_teamChatBeep
+address $276
+address $92
+byte 4 1
+address cg_muzzleflashStyle
+address $277
+address $92
+byte 4 1
+align 4
+LABELV cvarTableSize
+byte 4 163
+export CG_RegisterCvars
+code
+proc CG_RegisterCvars 1036 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $282
+JUMPV
+LABELV $279
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $280
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $282
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $279
+ADDRGP4 $283
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31452
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $286
+ARGP4
+ADDRGP4 $287
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $288
+ARGP4
+ADDRGP4 $287
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRGP4 $287
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRGP4 $287
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $278
+endproc CG_RegisterCvars 1036 16
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $296
+ADDRGP4 $293
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $293
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $292
+LABELV $291
+endproc CG_ForceModelChange 12 4
+export CG_UpdateCvars
+proc CG_UpdateCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $299
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_cmdTimeNudge
+CVPU4 4
+NEU4 $303
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 999
+ARGI4
+ADDRGP4 CG_Cvar_ClampInt
+CALLI4
+pop
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 cl_timeNudge
+CVPU4 4
+NEU4 $305
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 -50
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 CG_Cvar_ClampInt
+CALLI4
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_errorDecay
+CVPU4 4
+NEU4 $307
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 250
+ARGI4
+ADDRGP4 CG_Cvar_ClampInt
+CALLI4
+pop
+LABELV $307
+LABELV $306
+LABELV $304
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $300
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $302
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $299
+ADDRGP4 drawTeamOverlayModificationCount
+INDIRI4
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+EQI4 $309
+ADDRGP4 drawTeamOverlayModificationCount
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+LEI4 $313
+ADDRGP4 $170
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRGP4 $170
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $314
+LABELV $309
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+EQI4 $316
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $316
+LABELV $298
+endproc CG_UpdateCvars 12 16
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 0 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124996
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $321
+CNSTI4 -1
+RETI4
+ADDRGP4 $320
+JUMPV
+LABELV $321
+ADDRGP4 cg+124992
+INDIRI4
+RETI4
+LABELV $320
+endproc CG_CrosshairPlayer 0 0
+export CG_LastAttacker
+proc CG_LastAttacker 0 0
+ADDRGP4 cg+125008
+INDIRI4
+CNSTI4 0
+NEI4 $327
+CNSTI4 -1
+RETI4
+ADDRGP4 $326
+JUMPV
+LABELV $327
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+RETI4
+LABELV $326
+endproc CG_LastAttacker 0 0
+export CG_Printf
+proc CG_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $331
+endproc CG_Printf 1028 16
+export CG_Error
+proc CG_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $333
+endproc CG_Error 1028 16
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $337
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $335
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $337
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $338
+endproc Com_Printf 1028 16
+bss
+align 1
+LABELV $341
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $341
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $341
+RETP4
+LABELV $340
+endproc CG_Argv 0 12
+proc CG_RegisterItemSounds 96 12
+ADDRLP4 76
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $343
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $343
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $347
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $349
+LABELV $347
+ADDRGP4 $342
+JUMPV
+LABELV $348
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $352
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $351
+LABELV $354
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $357
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $355
+LABELV $357
+ADDRGP4 $358
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $342
+JUMPV
+LABELV $355
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $359
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $359
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 92
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $361
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $361
+LABELV $349
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $348
+LABELV $342
+endproc CG_RegisterItemSounds 96 12
+proc CG_RegisterSounds 704 16
+ADDRGP4 $368
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1144
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $371
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1148
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $374
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1152
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $377
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1164
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $380
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1160
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $383
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1156
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $386
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1356
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $389
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1360
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $392
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1364
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $395
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1368
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $398
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1372
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $405
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $404
+LABELV $405
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $399
+LABELV $404
+ADDRGP4 $408
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1268
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $411
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1280
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $414
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1284
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $417
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1288
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $420
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1180
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $423
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1272
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $426
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1276
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $408
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1292
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $431
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1296
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $434
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1300
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $437
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1304
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1308
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $443
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1312
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $450
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $450
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $444
+LABELV $450
+ADDRGP4 $453
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1316
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1320
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $459
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1328
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $462
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1336
+ADDRLP4 440
+INDIRI4
+ASGNI4
+LABELV $444
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $467
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $463
+LABELV $467
+ADDRGP4 $437
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1324
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $472
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1340
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $475
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1332
+ADDRLP4 436
+INDIRI4
+ASGNI4
+LABELV $463
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+EQI4 $480
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $476
+LABELV $480
+ADDRGP4 $483
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1348
+ADDRLP4 428
+INDIRI4
+ASGNI4
+LABELV $476
+LABELV $399
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $494
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $494
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $494
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $494
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $484
+LABELV $494
+ADDRGP4 $497
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1344
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $500
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1352
+ADDRLP4 380
+INDIRI4
+ASGNI4
+LABELV $484
+ADDRGP4 $503
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+808
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $506
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+812
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $509
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+820
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $512
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+816
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $515
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1060
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $518
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1064
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1068
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $524
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1072
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $527
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1108
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $530
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1112
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $533
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1116
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $536
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1120
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $539
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1124
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1128
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $545
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1132
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $548
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1136
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $551
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1140
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $554
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1012
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $557
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1016
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1020
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $563
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1024
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $566
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1028
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $569
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1376
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $572
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1380
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $575
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1384
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $578
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1388
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $581
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1032
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $584
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1036
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $587
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1040
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $590
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1044
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $593
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1076
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $596
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1080
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $599
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1088
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $602
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1084
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $605
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1092
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $608
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1096
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 cg_hitsound+12
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRGP4 $609
+JUMPV
+LABELV $612
+LABELV $609
+ADDRGP4 $615
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1168
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $618
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1184
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $621
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1188
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $624
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1192
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $627
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 532
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1196
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $630
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 536
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1200
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $633
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 540
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1204
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $636
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 544
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1220
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $639
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 548
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1224
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $642
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 552
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1228
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $645
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 556
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1244
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 560
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1248
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 564
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1252
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 568
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1104
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $655
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $659
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 572
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824
+ADDP4
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+16
+ADDP4
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $666
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+32
+ADDP4
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $670
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+48
+ADDP4
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+64
+ADDP4
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $678
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $682
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+80
+ADDP4
+ADDRLP4 596
+INDIRI4
+ASGNI4
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $655
+CNSTI4 27
+ARGI4
+ADDRLP4 572
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 572
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $687
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $686
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $690
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 576
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 576
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $694
+ADDRGP4 $692
+JUMPV
+LABELV $694
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $696
+ADDRGP4 $691
+JUMPV
+LABELV $696
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+ADDRLP4 580
+INDIRI4
+ASGNI4
+LABELV $691
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $690
+LABELV $692
+ADDRGP4 $701
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1256
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $704
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1260
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $707
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+804
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $710
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+948
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $713
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+952
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 $716
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+956
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $719
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+960
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $722
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+964
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $725
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 608
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+968
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $728
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+972
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $731
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+976
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $734
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 620
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+980
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $737
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+984
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $740
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 628
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+988
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $743
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 632
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+992
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $746
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+996
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $749
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1264
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $752
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 644
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1000
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $755
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 648
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1004
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 $758
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 652
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1008
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRGP4 $761
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 656
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1048
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRGP4 $764
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 660
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1052
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 $767
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 664
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1056
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $770
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 668
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1424
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRGP4 $773
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 672
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1428
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRGP4 $776
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 676
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1432
+ADDRLP4 676
+INDIRI4
+ASGNI4
+ADDRGP4 $779
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 680
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1436
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $782
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 684
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1404
+ADDRLP4 684
+INDIRI4
+ASGNI4
+ADDRGP4 $785
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 688
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1408
+ADDRLP4 688
+INDIRI4
+ASGNI4
+ADDRGP4 $788
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 692
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1412
+ADDRLP4 692
+INDIRI4
+ASGNI4
+ADDRGP4 $791
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 696
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1416
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRGP4 $794
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 700
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1420
+ADDRLP4 700
+INDIRI4
+ASGNI4
+LABELV $365
+endproc CG_RegisterSounds 704 16
+data
+align 4
+LABELV $796
+address $797
+address $798
+address $799
+address $800
+address $801
+address $802
+address $803
+address $804
+address $805
+address $806
+address $807
+code
+proc CG_RegisterGraphics 792 16
+ADDRGP4 cg+109252
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $812
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $813
+ADDRLP4 264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 $796
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 cgs+180272+452
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $814
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $813
+ADDRGP4 $821
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $825
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $829
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+8
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $833
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+12
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $837
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+16
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $840
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+280
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $843
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+196
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $846
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+704
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $849
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+708
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $852
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+712
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $855
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+716
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $858
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+340
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $861
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+344
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $864
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+348
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $867
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+444
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $870
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+448
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+352
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $876
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+360
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $879
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+328
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $882
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+272
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $885
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+356
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $888
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+284
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $891
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+276
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $894
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+744
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $897
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+748
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $900
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+752
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+756
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $906
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+760
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $909
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+764
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $912
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+768
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $915
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+772
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $918
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+776
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+780
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+784
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $927
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+788
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $930
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+792
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $933
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+796
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+800
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $937
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $941
+ADDRGP4 $945
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRGP4 $948
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+ADDRLP4 436
+INDIRI4
+ASGNI4
+LABELV $942
+LABELV $938
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $937
+ADDRGP4 $951
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+332
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $954
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+336
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $957
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+544
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $960
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+552
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $963
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+564
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $966
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+568
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+556
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $972
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+560
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $975
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+572
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $986
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $986
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $986
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $986
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $976
+LABELV $986
+ADDRGP4 $989
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+20
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $992
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+24
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+28
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $997
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+32
+ADDRLP4 464
+INDIRI4
+ASGNI4
+LABELV $976
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $998
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $998
+ADDRGP4 $1004
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+588
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1007
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+592
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $999
+JUMPV
+LABELV $998
+ADDRGP4 $1010
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+584
+ADDRLP4 452
+INDIRI4
+ASGNI4
+LABELV $999
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $1011
+ADDRGP4 $1017
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88+4
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88+8
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1024
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $954
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88+12
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1031
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104+4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1035
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104+8
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $954
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104+12
+ADDRLP4 480
+INDIRI4
+ASGNI4
+LABELV $1011
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $1054
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $1054
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $1054
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $1054
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $1054
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1042
+LABELV $1054
+ADDRGP4 $1057
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+36
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1060
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+40
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1063
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+44
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1066
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+48
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1070
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+48+4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1074
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+48+8
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1077
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+60
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+60+4
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1085
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+60+8
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1088
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+120
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1091
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+124
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $1094
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+128
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+132
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+136
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1103
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+140
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $1106
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+144
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $1109
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+148
+ADDRLP4 516
+INDIRI4
+ASGNI4
+LABELV $1042
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $1116
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $1116
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+LABELV $1116
+ADDRGP4 $1063
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+44
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1121
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1070
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72+4
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72+8
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1131
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72+12
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1110
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+EQI4 $1136
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1132
+LABELV $1136
+ADDRGP4 $1139
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+624
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1142
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+152
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+156
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1148
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+160
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+164
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1132
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $1156
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+LABELV $1156
+ADDRGP4 $1159
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+168
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1162
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+172
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1165
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+176
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1168
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+180
+ADDRLP4 464
+INDIRI4
+ASGNI4
+LABELV $1152
+ADDRGP4 $1171
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+576
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $975
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+692
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1180
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $1179
+LABELV $1180
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1174
+LABELV $1179
+ADDRGP4 $1183
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+264
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1186
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+548
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1189
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+580
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1174
+ADDRGP4 $1192
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+192
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1195
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+184
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1198
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+188
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1201
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+244
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1204
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+248
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1207
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+200
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1210
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+204
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1213
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+208
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1216
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+212
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $1219
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+216
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $1222
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+220
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1225
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+224
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1228
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+228
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $1231
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+232
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $1234
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+236
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $1204
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+240
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+268
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $1242
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+636
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $1245
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+596
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $1248
+ARGP4
+ADDRLP4 536
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+600
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $1251
+ARGP4
+ADDRLP4 540
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+604
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $1254
+ARGP4
+ADDRLP4 544
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+640
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $1257
+ARGP4
+ADDRLP4 548
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+644
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $1260
+ARGP4
+ADDRLP4 552
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+648
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $1263
+ARGP4
+ADDRLP4 556
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+652
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $1266
+ARGP4
+ADDRLP4 560
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+656
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $1269
+ARGP4
+ADDRLP4 564
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+660
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 568
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+664
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 $1275
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+668
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 $1278
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+672
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $1281
+ARGP4
+ADDRLP4 580
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+676
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $1284
+ARGP4
+ADDRLP4 584
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+680
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $1287
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+684
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $1290
+ARGP4
+ADDRLP4 592
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+688
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 $1293
+ARGP4
+ADDRLP4 596
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+696
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $1296
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+700
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $1299
+ARGP4
+ADDRLP4 604
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+720
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $1302
+ARGP4
+ADDRLP4 608
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+724
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $1305
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+728
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $1308
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+732
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $1311
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+736
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $1314
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+740
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $1317
+ARGP4
+ADDRLP4 628
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+364
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $1320
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+368
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $1323
+ARGP4
+ADDRLP4 636
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+372
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $1326
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+376
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $1329
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+388
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $1332
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+392
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 $1335
+ARGP4
+ADDRLP4 652
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+396
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRGP4 $1338
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+380
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRGP4 $1341
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+384
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 $1344
+ARGP4
+ADDRLP4 664
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+400
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 668
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+404
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRGP4 $1350
+ARGP4
+ADDRLP4 672
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+412
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRGP4 $1353
+ARGP4
+ADDRLP4 676
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+416
+ADDRLP4 676
+INDIRI4
+ASGNI4
+ADDRGP4 $1356
+ARGP4
+ADDRLP4 680
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+420
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $1359
+ARGP4
+ADDRLP4 684
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+424
+ADDRLP4 684
+INDIRI4
+ASGNI4
+ADDRGP4 $1362
+ARGP4
+ADDRLP4 688
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+428
+ADDRLP4 688
+INDIRI4
+ASGNI4
+ADDRGP4 $1365
+ARGP4
+ADDRLP4 692
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+432
+ADDRLP4 692
+INDIRI4
+ASGNI4
+ADDRGP4 $1368
+ARGP4
+ADDRLP4 696
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+436
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRGP4 $1371
+ARGP4
+ADDRLP4 700
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+440
+ADDRLP4 700
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6144
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2752
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 27
+ARGI4
+ADDRLP4 704
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 704
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1375
+JUMPV
+LABELV $1372
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $1379
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1376
+LABELV $1379
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $1376
+LABELV $1373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1375
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1372
+ADDRGP4 $1382
+ARGP4
+ADDRLP4 708
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+528
+ADDRLP4 708
+INDIRI4
+ASGNI4
+ADDRGP4 $1385
+ARGP4
+ADDRLP4 712
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+532
+ADDRLP4 712
+INDIRI4
+ASGNI4
+ADDRGP4 $1388
+ARGP4
+ADDRLP4 716
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+536
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 $1391
+ARGP4
+ADDRLP4 720
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+540
+ADDRLP4 720
+INDIRI4
+ASGNI4
+ADDRGP4 $1394
+ARGP4
+ADDRLP4 724
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+496
+ADDRLP4 724
+INDIRI4
+ASGNI4
+ADDRGP4 $1397
+ARGP4
+ADDRLP4 728
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+520
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRGP4 $1400
+ARGP4
+ADDRLP4 732
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+524
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRLP4 736
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+37056
+ADDRLP4 736
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1402
+ADDRLP4 768
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $1407
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 768
+ARGP4
+ADDRLP4 780
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+37060
+ADDP4
+ADDRLP4 780
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+37060
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 744
+ARGP4
+ADDRLP4 756
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 740
+CNSTI4 0
+ASGNI4
+LABELV $1410
+ADDRLP4 784
+ADDRLP4 740
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 788
+ADDRLP4 784
+INDIRI4
+ADDRLP4 744
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 784
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+38084
+ADDP4
+ADDP4
+ADDRLP4 788
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 784
+INDIRI4
+ADDRLP4 756
+ADDP4
+INDIRF4
+ADDRLP4 788
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1411
+ADDRLP4 740
+ADDRLP4 740
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 740
+INDIRI4
+CNSTI4 3
+LTI4 $1410
+LABELV $1403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1405
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+37056
+INDIRI4
+LTI4 $1402
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1415
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 744
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 740
+ADDRLP4 744
+INDIRP4
+ASGNP4
+ADDRLP4 740
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1419
+ADDRGP4 $1417
+JUMPV
+LABELV $1419
+ADDRLP4 740
+INDIRP4
+ARGP4
+ADDRLP4 748
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35008
+ADDP4
+ADDRLP4 748
+INDIRI4
+ASGNI4
+LABELV $1416
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1415
+LABELV $1417
+LABELV $795
+endproc CG_RegisterGraphics 792 16
+export CG_BuildSpectatorString
+proc CG_BuildSpectatorString 12 12
+ADDRGP4 cg+114956
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1424
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1428
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1428
+ADDRGP4 $1435
+ARGP4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 cg+114956
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1428
+LABELV $1425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1424
+ADDRGP4 cg+114956
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+115980
+INDIRI4
+EQI4 $1439
+ADDRGP4 cg+115980
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+115984
+CNSTF4 3212836864
+ASGNF4
+LABELV $1439
+LABELV $1422
+endproc CG_BuildSpectatorString 12 12
+proc CG_RegisterClients 12 4
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1447
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1451
+ADDRGP4 $1448
+JUMPV
+LABELV $1451
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1454
+ADDRGP4 $1448
+JUMPV
+LABELV $1454
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $1448
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1447
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $1444
+endproc CG_RegisterClients 12 4
+export CG_ConfigString
+proc CG_ConfigString 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1459
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1457
+LABELV $1459
+ADDRGP4 $1460
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1457
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $1456
+endproc CG_ConfigString 4 8
+export CG_StartMusic
+proc CG_StartMusic 148 12
+ADDRGP4 cg_music+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1463
+ADDRGP4 cg_music+16
+ARGP4
+ADDRGP4 $1467
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1463
+ADDRLP4 0
+ADDRGP4 cg_music+16
+ASGNP4
+ADDRGP4 $1464
+JUMPV
+LABELV $1463
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $1464
+LABELV $1462
+endproc CG_StartMusic 148 12
+export CG_Init
+proc CG_Init 52 12
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 181720
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 156512
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 958464
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2752
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6144
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31448
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31444
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1474
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1477
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1480
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1483
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1486
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 cg+109152
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+34996
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34992
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+35000
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 cgs+20100+11304
+INDIRU4
+ASGNU4
+ADDRGP4 cgs+31432
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 28
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cgs+20100+11308
+INDIRU4
+ASGNU4
+ADDRGP4 cgs+31436
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 32
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1500
+ARGP4
+ADDRLP4 40
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $1498
+ADDRGP4 $1501
+ARGP4
+ADDRGP4 $1500
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1498
+CNSTI4 21
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $1503
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1506
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+ADDRGP4 $1507
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+ADDRGP4 $1508
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterClients
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+109644
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $186
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+ADDRGP4 challenges_init
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 addChallenge
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+LABELV $1469
+endproc CG_Init 52 12
+export CG_Shutdown
+proc CG_Shutdown 0 0
+ADDRGP4 challenges_save
+CALLV
+pop
+LABELV $1511
+endproc CG_Shutdown 0 0
+export CG_EventHandling
+proc CG_EventHandling 0 0
+LABELV $1512
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 0 0
+LABELV $1513
+endproc CG_KeyEvent 0 0
+export CG_MouseEvent
+proc CG_MouseEvent 0 0
+LABELV $1514
+endproc CG_MouseEvent 0 0
+export SnapVectorTowards
+proc SnapVectorTowards 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1516
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $1520
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1521
+JUMPV
+LABELV $1520
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CNSTI4 1
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1521
+LABELV $1517
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1516
+LABELV $1515
+endproc SnapVectorTowards 12 0
+data
+align 4
+LABELV do_vid_restart
+byte 4 0
+export CG_FairCvars
+code
+proc CG_FairCvars 168 12
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $1523
+ADDRGP4 $1526
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 cg_autovertex+12
+INDIRI4
+CNSTI4 0
+EQI4 $1522
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $1522
+ADDRGP4 $1526
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1522
+JUMPV
+LABELV $1523
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1530
+ADDRGP4 $1533
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 80
+LEI4 $1534
+ADDRGP4 $1533
+ARGP4
+ADDRGP4 $1536
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1534
+ADDRGP4 $100
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1537
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+EQI4 $1537
+ADDRGP4 $100
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1537
+LABELV $1530
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1539
+ADDRGP4 $1533
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 20
+LEI4 $1542
+ADDRGP4 $1533
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1542
+ADDRGP4 $1544
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 3
+LEI4 $1545
+ADDRGP4 $1544
+ARGP4
+ADDRGP4 $132
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1546
+JUMPV
+LABELV $1545
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $1547
+ADDRGP4 $1544
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1547
+LABELV $1546
+ADDRGP4 $1549
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LEI4 $1550
+ADDRGP4 $1549
+ARGP4
+ADDRGP4 $1552
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1551
+JUMPV
+LABELV $1550
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $1553
+ADDRGP4 $1549
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1553
+LABELV $1551
+ADDRGP4 $1555
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LEI4 $1556
+ADDRGP4 $1555
+ARGP4
+ADDRGP4 $1552
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1557
+JUMPV
+LABELV $1556
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $1558
+ADDRGP4 $1555
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1558
+LABELV $1557
+ADDRGP4 $1560
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LEI4 $1561
+ADDRGP4 $1560
+ARGP4
+ADDRGP4 $1552
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1562
+JUMPV
+LABELV $1561
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+GEI4 $1563
+ADDRGP4 $1560
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1563
+LABELV $1562
+LABELV $1539
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1565
+ADDRGP4 $1526
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1566
+ADDRGP4 $1526
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1566
+JUMPV
+LABELV $1565
+ADDRGP4 cg_autovertex+12
+INDIRI4
+CNSTI4 0
+EQI4 $1570
+ADDRGP4 $1526
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $1573
+ADDRGP4 $1526
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $1573
+LABELV $1570
+LABELV $1566
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $1575
+ADDRGP4 do_vid_restart
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $1575
+ADDRGP4 $1577
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1575
+ADDRGP4 do_vid_restart
+CNSTI4 1
+ASGNI4
+LABELV $1522
+endproc CG_FairCvars 168 12
+bss
+export cg_leiWidescreen
+align 4
+LABELV cg_leiWidescreen
+skip 272
+export cg_leiChibi
+align 4
+LABELV cg_leiChibi
+skip 272
+export cg_pmove_msec
+align 4
+LABELV cg_pmove_msec
+skip 272
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+import trap_R_LFX_ParticleEffect
+export wideAdjustX
+align 4
+LABELV wideAdjustX
+skip 4
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_LoadMenus
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+export cg_teamChatBeep
+align 4
+LABELV cg_teamChatBeep
+skip 272
+export cg_chatBeep
+align 4
+LABELV cg_chatBeep
+skip 272
+export cg_weaponOrder
+align 4
+LABELV cg_weaponOrder
+skip 272
+export cg_weaponBarStyle
+align 4
+LABELV cg_weaponBarStyle
+skip 272
+export cg_crosshairColorBlue
+align 4
+LABELV cg_crosshairColorBlue
+skip 272
+export cg_crosshairColorGreen
+align 4
+LABELV cg_crosshairColorGreen
+skip 272
+export cg_crosshairColorRed
+align 4
+LABELV cg_crosshairColorRed
+skip 272
+export cg_ch13size
+align 4
+LABELV cg_ch13size
+skip 272
+export cg_ch13
+align 4
+LABELV cg_ch13
+skip 272
+export cg_ch12size
+align 4
+LABELV cg_ch12size
+skip 272
+export cg_ch12
+align 4
+LABELV cg_ch12
+skip 272
+export cg_ch11size
+align 4
+LABELV cg_ch11size
+skip 272
+export cg_ch11
+align 4
+LABELV cg_ch11
+skip 272
+export cg_ch10size
+align 4
+LABELV cg_ch10size
+skip 272
+export cg_ch10
+align 4
+LABELV cg_ch10
+skip 272
+export cg_ch9size
+align 4
+LABELV cg_ch9size
+skip 272
+export cg_ch9
+align 4
+LABELV cg_ch9
+skip 272
+export cg_ch8size
+align 4
+LABELV cg_ch8size
+skip 272
+export cg_ch8
+align 4
+LABELV cg_ch8
+skip 272
+export cg_ch7size
+align 4
+LABELV cg_ch7size
+skip 272
+export cg_ch7
+align 4
+LABELV cg_ch7
+skip 272
+export cg_ch6size
+align 4
+LABELV cg_ch6size
+skip 272
+export cg_ch6
+align 4
+LABELV cg_ch6
+skip 272
+export cg_ch5size
+align 4
+LABELV cg_ch5size
+skip 272
+export cg_ch5
+align 4
+LABELV cg_ch5
+skip 272
+export cg_ch4size
+align 4
+LABELV cg_ch4size
+skip 272
+export cg_ch4
+align 4
+LABELV cg_ch4
+skip 272
+export cg_ch3size
+align 4
+LABELV cg_ch3size
+skip 272
+export cg_ch3
+align 4
+LABELV cg_ch3
+skip 272
+export cg_ch2size
+align 4
+LABELV cg_ch2size
+skip 272
+export cg_ch2
+align 4
+LABELV cg_ch2
+skip 272
+export cg_ch1size
+align 4
+LABELV cg_ch1size
+skip 272
+export cg_ch1
+align 4
+LABELV cg_ch1
+skip 272
+export cg_differentCrosshairs
+align 4
+LABELV cg_differentCrosshairs
+skip 272
+export cg_crosshairPulse
+align 4
+LABELV cg_crosshairPulse
+skip 272
+export cg_fragmsgsize
+align 4
+LABELV cg_fragmsgsize
+skip 272
+export cg_autovertex
+align 4
+LABELV cg_autovertex
+skip 272
+export cg_vote_custom_commands
+align 4
+LABELV cg_vote_custom_commands
+skip 272
+export cg_cyclegrapple
+align 4
+LABELV cg_cyclegrapple
+skip 272
+export cg_voteflags
+align 4
+LABELV cg_voteflags
+skip 272
+export cg_voip_teamonly
+align 4
+LABELV cg_voip_teamonly
+skip 272
+export cg_hitsound
+align 4
+LABELV cg_hitsound
+skip 272
+export cg_alwaysWeaponBar
+align 4
+LABELV cg_alwaysWeaponBar
+skip 272
+export cl_timeNudge
+align 4
+LABELV cl_timeNudge
+skip 272
+export cg_optimizePrediction
+align 4
+LABELV cg_optimizePrediction
+skip 272
+export cg_projectileNudge
+align 4
+LABELV cg_projectileNudge
+skip 272
+export sv_fps
+align 4
+LABELV sv_fps
+skip 272
+export cg_cmdTimeNudge
+align 4
+LABELV cg_cmdTimeNudge
+skip 272
+export cg_delag
+align 4
+LABELV cg_delag
+skip 272
+export cg_enableFS
+align 4
+LABELV cg_enableFS
+skip 272
+export cg_enableQ
+align 4
+LABELV cg_enableQ
+skip 272
+export cg_enableBreath
+align 4
+LABELV cg_enableBreath
+skip 272
+export cg_enableDust
+align 4
+LABELV cg_enableDust
+skip 272
+export cg_obeliskRespawnDelay
+align 4
+LABELV cg_obeliskRespawnDelay
+skip 272
+export cg_music
+align 4
+LABELV cg_music
+skip 272
+export cg_trueLightning
+align 4
+LABELV cg_trueLightning
+skip 272
+export cg_oldPlasma
+align 4
+LABELV cg_oldPlasma
+skip 272
+export cg_modelEyes_Fwd
+align 4
+LABELV cg_modelEyes_Fwd
+skip 272
+export cg_modelEyes_Right
+align 4
+LABELV cg_modelEyes_Right
+skip 272
+export cg_modelEyes_Up
+align 4
+LABELV cg_modelEyes_Up
+skip 272
+export cg_cameraEyes_Up
+align 4
+LABELV cg_cameraEyes_Up
+skip 272
+export cg_cameraEyes_Fwd
+align 4
+LABELV cg_cameraEyes_Fwd
+skip 272
+export cg_cameraEyes
+align 4
+LABELV cg_cameraEyes
+skip 272
+export cg_cameramode
+align 4
+LABELV cg_cameramode
+skip 272
+export cg_deathcam
+align 4
+LABELV cg_deathcam
+skip 272
+export cg_leiDebug
+align 4
+LABELV cg_leiDebug
+skip 272
+export cg_muzzleflashStyle
+align 4
+LABELV cg_muzzleflashStyle
+skip 272
+export cg_leiSuperGoreyAwesome
+align 4
+LABELV cg_leiSuperGoreyAwesome
+skip 272
+export cg_leiBrassNoise
+align 4
+LABELV cg_leiBrassNoise
+skip 272
+export cg_leiGoreNoise
+align 4
+LABELV cg_leiGoreNoise
+skip 272
+export cg_leiEnhancement
+align 4
+LABELV cg_leiEnhancement
+skip 272
+export cg_oldRocket
+align 4
+LABELV cg_oldRocket
+skip 272
+export cg_oldRail
+align 4
+LABELV cg_oldRail
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_noTaunt
+align 4
+LABELV cg_noTaunt
+skip 272
+export cg_bigFont
+align 4
+LABELV cg_bigFont
+skip 272
+export cg_smallFont
+align 4
+LABELV cg_smallFont
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export cg_cameraOrbitDelay
+align 4
+LABELV cg_cameraOrbitDelay
+skip 272
+export cg_cameraOrbit
+align 4
+LABELV cg_cameraOrbit
+skip 272
+export pmove_float
+align 4
+LABELV pmove_float
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export cg_obituaryOutput
+align 4
+LABELV cg_obituaryOutput
+skip 272
+export cg_scorePlum
+align 4
+LABELV cg_scorePlum
+skip 272
+export cg_noVoiceText
+align 4
+LABELV cg_noVoiceText
+skip 272
+export cg_noVoiceChats
+align 4
+LABELV cg_noVoiceChats
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_blood
+align 4
+LABELV cg_blood
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_teamChatHeight
+align 4
+LABELV cg_teamChatHeight
+skip 272
+export cg_teamChatTime
+align 4
+LABELV cg_teamChatTime
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawSpeed
+align 4
+LABELV cg_drawSpeed
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_lagometer
+align 4
+LABELV cg_lagometer
+skip 272
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 272
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 272
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_brassTime
+align 4
+LABELV cg_brassTime
+skip 272
+export cg_addMarks
+align 4
+LABELV cg_addMarks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_railTrailTime
+align 4
+LABELV cg_railTrailTime
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_gibs
+align 4
+LABELV cg_gibs
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_kickScale
+align 4
+LABELV cg_kickScale
+skip 272
+export cg_bobmodel
+align 4
+LABELV cg_bobmodel
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_bob
+align 4
+LABELV cg_bob
+skip 272
+export cg_runroll
+align 4
+LABELV cg_runroll
+skip 272
+export cg_runpitch
+align 4
+LABELV cg_runpitch
+skip 272
+export cg_centertime
+align 4
+LABELV cg_centertime
+skip 272
+import cg_markPolys
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2752
+export cg_entities
+align 4
+LABELV cg_entities
+skip 958464
+export cg
+align 4
+LABELV cg
+skip 156512
+export cgs
+align 4
+LABELV cgs
+skip 181720
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1577
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1560
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1555
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1552
+byte 1 50
+byte 1 0
+align 1
+LABELV $1549
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1544
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $1536
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $1533
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1526
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1508
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1507
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $1506
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1503
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1501
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1500
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1486
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1483
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1480
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1477
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1474
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1467
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1460
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1435
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1407
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1400
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1397
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $1394
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1391
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1388
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1385
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1382
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1371
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 52
+byte 1 0
+align 1
+LABELV $1368
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 51
+byte 1 0
+align 1
+LABELV $1365
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 50
+byte 1 0
+align 1
+LABELV $1362
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $1359
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 52
+byte 1 0
+align 1
+LABELV $1356
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 51
+byte 1 0
+align 1
+LABELV $1353
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 50
+byte 1 0
+align 1
+LABELV $1350
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $1347
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $1344
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $1341
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 102
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1338
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $1335
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 50
+byte 1 0
+align 1
+LABELV $1332
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1329
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $1326
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $1323
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $1320
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $1317
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $1314
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1311
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1308
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1305
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1302
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1299
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1296
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1293
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1290
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1287
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1284
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1281
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1278
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1275
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1272
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1269
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1266
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 105
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1263
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1260
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1257
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1254
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1251
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1248
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1245
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1242
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1239
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1234
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1231
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1228
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1225
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1222
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1219
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1216
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1213
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1210
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1207
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1204
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1201
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1198
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1195
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1192
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1189
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 0
+align 1
+LABELV $1186
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1183
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $1171
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1168
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1165
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1162
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1159
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1151
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1148
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1145
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1142
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1139
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1131
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 51
+byte 1 0
+align 1
+LABELV $1121
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 49
+byte 1 0
+align 1
+LABELV $1109
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1106
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1103
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1097
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1094
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1091
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1088
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1085
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 51
+byte 1 0
+align 1
+LABELV $1081
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $1077
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $1074
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1070
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $1066
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $1063
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1060
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1057
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1038
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1035
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1031
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1024
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1021
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1017
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1010
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1007
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1004
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $997
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $992
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $989
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $975
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $972
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $969
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $966
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $963
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $960
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $957
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $954
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $951
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $948
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $945
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $936
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $933
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $930
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $927
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $924
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $921
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $918
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $915
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $912
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $909
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $906
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $903
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $900
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $897
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $894
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $891
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $888
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $885
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $882
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $879
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $876
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $873
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 49
+byte 1 0
+align 1
+LABELV $870
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $867
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $864
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $861
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 82
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $858
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $855
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $852
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $849
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $846
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $843
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $840
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $837
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 53
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $833
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 52
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $829
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $825
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $821
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $812
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $807
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $806
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $805
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $804
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $803
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $802
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $801
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $800
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $799
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $798
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $797
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $794
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $791
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $788
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $785
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $782
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $779
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 118
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $776
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $773
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $770
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $767
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $764
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $761
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $758
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $755
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $752
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $749
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $746
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $743
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $740
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $737
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $734
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $731
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $728
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $725
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $722
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $719
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $716
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $713
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $710
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $707
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $704
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $701
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $682
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $678
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $674
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $670
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $666
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $662
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $659
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $654
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $648
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $645
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $642
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $639
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $636
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $633
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $630
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $627
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $624
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $618
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $608
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $605
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $602
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $599
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $596
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $593
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $590
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $587
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $584
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $581
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $578
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $575
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $572
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $569
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $566
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $563
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $557
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $554
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $551
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $548
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $545
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $542
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $539
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $536
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $533
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $530
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $527
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $524
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $521
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $518
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $515
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $512
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $509
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $506
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $503
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 121
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $500
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $497
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $483
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $475
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $472
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $462
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $459
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $456
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $453
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $443
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $440
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $437
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $434
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $431
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $426
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $423
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $420
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $417
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $414
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $411
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $408
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $398
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $395
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $392
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $389
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $386
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $383
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $380
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 50
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $377
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $374
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $371
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 53
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $368
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $364
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $358
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $337
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $290
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $289
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $288
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $287
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $286
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $283
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $277
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $275
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $274
+byte 1 47
+byte 1 49
+byte 1 47
+byte 1 50
+byte 1 47
+byte 1 52
+byte 1 47
+byte 1 51
+byte 1 47
+byte 1 54
+byte 1 47
+byte 1 55
+byte 1 47
+byte 1 56
+byte 1 47
+byte 1 57
+byte 1 47
+byte 1 53
+byte 1 47
+byte 1 0
+align 1
+LABELV $273
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $272
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $269
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $268
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 51
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $267
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $266
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $265
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 49
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $263
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $262
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 48
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $261
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $260
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 57
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 57
+byte 1 0
+align 1
+LABELV $258
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 56
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 56
+byte 1 0
+align 1
+LABELV $256
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 55
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $255
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 55
+byte 1 0
+align 1
+LABELV $254
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 54
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $253
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 54
+byte 1 0
+align 1
+LABELV $252
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 53
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $251
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 53
+byte 1 0
+align 1
+LABELV $250
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 52
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $249
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 52
+byte 1 0
+align 1
+LABELV $248
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 51
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $247
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 51
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 50
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $245
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 50
+byte 1 0
+align 1
+LABELV $244
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 0
+align 1
+LABELV $242
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $241
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 80
+byte 1 117
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $240
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 109
+byte 1 115
+byte 1 103
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $238
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $236
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $235
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $234
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $233
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $232
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $231
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $230
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $229
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $228
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 119
+byte 1 100
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $225
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $224
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 119
+byte 1 100
+byte 1 0
+align 1
+LABELV $223
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $222
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $221
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $220
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 67
+byte 1 104
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $217
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 83
+byte 1 117
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 65
+byte 1 119
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 66
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 78
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $215
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 71
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 78
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $214
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 69
+byte 1 110
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $213
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $212
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $211
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $210
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $209
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $206
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $205
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $204
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $203
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $200
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $198
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $197
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $196
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $194
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $193
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $192
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $191
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $190
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 81
+byte 1 0
+align 1
+LABELV $189
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 83
+byte 1 0
+align 1
+LABELV $188
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $187
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $186
+byte 1 0
+align 1
+LABELV $185
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $184
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $183
+byte 1 42
+byte 1 0
+align 1
+LABELV $182
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $181
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $179
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $178
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $177
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $174
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $170
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $167
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $164
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $162
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $160
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $158
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $156
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $152
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $151
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $148
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $145
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $143
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $138
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $137
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $136
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $134
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $133
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $132
+byte 1 51
+byte 1 0
+align 1
+LABELV $131
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $130
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $129
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $128
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $127
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $126
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $124
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $122
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $121
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $120
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $118
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $117
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $116
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 52
+byte 1 0
+align 1
+LABELV $112
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $110
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $109
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $108
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $104
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $103
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $102
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $101
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $100
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $99
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $98
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $97
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $96
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $95
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $94
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $93
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $92
+byte 1 49
+byte 1 0
+align 1
+LABELV $91
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $90
+byte 1 48
+byte 1 0
+align 1
+LABELV $89
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $86
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
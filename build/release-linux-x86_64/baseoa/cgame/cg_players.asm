@@ -0,0 +1,17053 @@
+data
+export cg_customSoundNames
+align 4
+LABELV cg_customSoundNames
+address $74
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+skip 76
+export CG_CustomSound
+code
+proc CG_CustomSound 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $88
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $92
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $90
+LABELV $92
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $90
+ADDRLP4 4
+CNSTI4 2120
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $97
+JUMPV
+LABELV $94
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $98
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $98
+LABELV $95
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $100
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $94
+LABELV $100
+ADDRGP4 $101
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $87
+endproc CG_CustomSound 16 8
+proc CG_ParseAnimationFile 20088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $103
+CNSTI4 0
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $103
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $105
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $105
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 20040
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRLP4 20048
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $111
+ADDRGP4 $110
+JUMPV
+LABELV $111
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $116
+ADDRGP4 $110
+JUMPV
+LABELV $116
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+EQI4 $122
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $118
+LABELV $122
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $118
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $125
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $123
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $123
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $126
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $129
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 20084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $132
+ADDRGP4 $135
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $113
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $139
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $143
+ADDRGP4 $109
+JUMPV
+LABELV $143
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDP4
+ADDRLP4 20068
+INDIRF4
+ASGNF4
+LABELV $140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $139
+ADDRGP4 $109
+JUMPV
+LABELV $136
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $145
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $148
+ADDRGP4 $110
+JUMPV
+LABELV $148
+ADDRLP4 20072
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 102
+EQI4 $152
+ADDRLP4 20072
+INDIRI4
+CNSTI4 70
+NEI4 $150
+LABELV $152
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $150
+ADDRLP4 20076
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 110
+EQI4 $155
+ADDRLP4 20076
+INDIRI4
+CNSTI4 78
+NEI4 $153
+LABELV $155
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $153
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $145
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $156
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $159
+ADDRLP4 20076
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 48
+LTI4 $162
+ADDRLP4 20076
+INDIRI4
+CNSTI4 57
+GTI4 $162
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $110
+JUMPV
+LABELV $162
+ADDRGP4 $164
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $109
+ADDRGP4 $108
+JUMPV
+LABELV $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $165
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $169
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LTI4 $171
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+GTI4 $171
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+NEI4 $173
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $175
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 33
+NEI4 $177
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $177
+ADDRLP4 0
+INDIRI4
+CNSTI4 42
+NEI4 $179
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRI4
+CNSTI4 34
+NEI4 $181
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $181
+ADDRLP4 0
+INDIRI4
+CNSTI4 35
+NEI4 $183
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+NEI4 $185
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRI4
+CNSTI4 37
+NEI4 $187
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $187
+ADDRLP4 0
+INDIRI4
+CNSTI4 38
+NEI4 $189
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRI4
+CNSTI4 39
+NEI4 $191
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $191
+ADDRLP4 0
+INDIRI4
+CNSTI4 40
+NEI4 $193
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $193
+ADDRLP4 0
+INDIRI4
+CNSTI4 41
+NEI4 $195
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRI4
+CNSTI4 43
+NEI4 $197
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $197
+ADDRLP4 0
+INDIRI4
+CNSTI4 44
+NEI4 $167
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $169
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $201
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $201
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+LTI4 $203
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+GEI4 $203
+ADDRLP4 20064
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20064
+INDIRP4
+ADDRLP4 20064
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $203
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $205
+ADDRGP4 $167
+JUMPV
+LABELV $205
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20068
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $207
+ADDRLP4 20072
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20072
+INDIRP4
+ADDRLP4 20072
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $207
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $209
+ADDRGP4 $167
+JUMPV
+LABELV $209
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20076
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20080
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $211
+ADDRGP4 $167
+JUMPV
+LABELV $211
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20084
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20084
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $213
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $213
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $166
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 45
+LTI4 $165
+LABELV $167
+ADDRLP4 0
+INDIRI4
+CNSTI4 45
+EQI4 $215
+ADDRGP4 $217
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $215
+ADDRLP4 8
+INDIRP4
+CNSTI4 1288
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1308
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1316
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 392
+ADDP4
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1336
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1348
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1352
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1356
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1360
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1364
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1372
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1376
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1384
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1388
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1400
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1404
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1408
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1412
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1416
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1420
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 752
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 836
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 864
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $102
+endproc CG_ParseAnimationFile 20088 12
+proc CG_FileExists 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $219
+CNSTI4 1
+RETI4
+ADDRGP4 $218
+JUMPV
+LABELV $219
+CNSTI4 0
+RETI4
+LABELV $218
+endproc CG_FileExists 8 12
+proc CG_FindClientModelFile 32 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $222
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $222
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $229
+ADDRGP4 $226
+JUMPV
+LABELV $229
+ADDRLP4 8
+ADDRGP4 $230
+ASGNP4
+ADDRGP4 $223
+JUMPV
+LABELV $226
+ADDRLP4 8
+ADDRGP4 $231
+ASGNP4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 8
+ADDRGP4 $120
+ASGNP4
+LABELV $223
+ADDRLP4 4
+ADDRGP4 $232
+ASGNP4
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $240
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $240
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $241
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $244
+CNSTI4 1
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $244
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $246
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $246
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $250
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $250
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $247
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $254
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $254
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $255
+LABELV $247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $256
+CNSTI4 1
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $256
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $260
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $258
+LABELV $260
+ADDRGP4 $238
+JUMPV
+LABELV $258
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $236
+LABELV $238
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $261
+ADDRGP4 $235
+JUMPV
+LABELV $261
+ADDRLP4 4
+ADDRGP4 $263
+ASGNP4
+LABELV $234
+ADDRGP4 $233
+JUMPV
+LABELV $235
+CNSTI4 0
+RETI4
+LABELV $221
+endproc CG_FindClientModelFile 32 40
+proc CG_FindClientHeadFile 32 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $265
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $265
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $272
+ADDRGP4 $269
+JUMPV
+LABELV $272
+ADDRLP4 8
+ADDRGP4 $230
+ASGNP4
+ADDRGP4 $266
+JUMPV
+LABELV $269
+ADDRLP4 8
+ADDRGP4 $231
+ASGNP4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRLP4 8
+ADDRGP4 $120
+ASGNP4
+LABELV $266
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $273
+ADDRLP4 4
+ADDRGP4 $275
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $277
+JUMPV
+LABELV $273
+ADDRLP4 4
+ADDRGP4 $232
+ASGNP4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $279
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $283
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $283
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $284
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $287
+CNSTI4 1
+RETI4
+ADDRGP4 $264
+JUMPV
+LABELV $287
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $289
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $289
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $293
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $293
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $290
+JUMPV
+LABELV $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $295
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $295
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $296
+LABELV $290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $297
+CNSTI4 1
+RETI4
+ADDRGP4 $264
+JUMPV
+LABELV $297
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $301
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $299
+LABELV $301
+ADDRGP4 $281
+JUMPV
+LABELV $299
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $279
+LABELV $281
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $302
+ADDRGP4 $278
+JUMPV
+LABELV $302
+ADDRLP4 4
+ADDRGP4 $275
+ASGNP4
+LABELV $277
+ADDRGP4 $276
+JUMPV
+LABELV $278
+CNSTI4 0
+RETI4
+LABELV $264
+endproc CG_FindClientHeadFile 32 40
+proc CG_RegisterClientSkin 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $307
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRGP4 $310
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $313
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $315
+ADDRGP4 $317
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $315
+LABELV $306
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $320
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $318
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $321
+ADDRGP4 $323
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $321
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $324
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $329
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $327
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $330
+LABELV $333
+CNSTI4 0
+RETI4
+ADDRGP4 $304
+JUMPV
+LABELV $330
+CNSTI4 1
+RETI4
+LABELV $304
+endproc CG_RegisterClientSkin 80 32
+proc CG_RegisterClientModelname 284 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $335
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $336
+JUMPV
+LABELV $335
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_enableFS+12
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $341
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $341
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $343
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $343
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRGP4 $347
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRGP4 $348
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $346
+LABELV $337
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $349
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $351
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $352
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $354
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $357
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $360
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $361
+ADDRGP4 $363
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $361
+LABELV $358
+LABELV $355
+LABELV $352
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $364
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $365
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $367
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $368
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $370
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $373
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $374
+ADDRGP4 $363
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $374
+LABELV $371
+LABELV $368
+LABELV $365
+LABELV $349
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $376
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 264
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $377
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $380
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $382
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $384
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 268
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $385
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $388
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $386
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+LABELV $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $390
+ADDRGP4 $363
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $390
+LABELV $382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $392
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $394
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $394
+ADDRGP4 $396
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $397
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $399
+ARGP4
+ADDRGP4 $400
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $399
+ARGP4
+ADDRGP4 $401
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $395
+ADDRGP4 $396
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $394
+ADDRGP4 $404
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $395
+LABELV $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $405
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $407
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $410
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $411
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $412
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $414
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $415
+ADDRGP4 $410
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $415
+LABELV $412
+LABELV $406
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $419
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $418
+JUMPV
+LABELV $417
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $419
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+LABELV $420
+LABELV $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $423
+CNSTI4 0
+RETI4
+ADDRGP4 $334
+JUMPV
+LABELV $423
+CNSTI4 1
+RETI4
+LABELV $334
+endproc CG_RegisterClientModelname 284 32
+proc CG_ColorFromString 20 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $428
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $426
+LABELV $428
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $425
+JUMPV
+LABELV $426
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $429
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $431
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $433
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $433
+LABELV $425
+endproc CG_ColorFromString 20 4
+proc CG_LoadClientInfo 148 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $436
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRGP4 $441
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $438
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $442
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $442
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $446
+ADDRLP4 20
+ARGP4
+ADDRGP4 $400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 20
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $447
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $450
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $443
+ADDRGP4 $451
+ARGP4
+ADDRGP4 $450
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 $450
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $120
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $454
+ARGP4
+ADDRGP4 $450
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $452
+LABELV $443
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $436
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 92
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $459
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $457
+LABELV $455
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $463
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $463
+ADDRLP4 92
+ADDRGP4 $450
+ASGNP4
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRLP4 92
+ADDRGP4 $450
+ASGNP4
+LABELV $464
+ADDRLP4 16
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $465
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $469
+ADDRGP4 $467
+JUMPV
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $471
+ADDRGP4 $473
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $471
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $474
+ADDRGP4 $473
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $474
+LABELV $466
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $465
+LABELV $467
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $476
+ADDRLP4 96
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 cg_entities+168
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $480
+ADDRLP4 96
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $480
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $480
+LABELV $477
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $476
+LABELV $435
+endproc CG_LoadClientInfo 148 24
+proc CG_CopyClientInfoModel 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 496
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 508
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 512
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 516
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 520
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 524
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 528
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 532
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 536
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 540
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 484
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 544
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 1428
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 48
+CNSTI4 1972
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $484
+endproc CG_CopyClientInfoModel 52 12
+proc CG_ScanForExistingClientInfo 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $489
+JUMPV
+LABELV $486
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $492
+ADDRGP4 $487
+JUMPV
+LABELV $492
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRGP4 $487
+JUMPV
+LABELV $494
+ADDRLP4 8
+CNSTI4 160
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 24
+CNSTI4 288
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 32
+CNSTI4 352
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 40
+CNSTI4 448
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRLP4 48
+CNSTI4 416
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $501
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $501
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $496
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $485
+JUMPV
+LABELV $496
+LABELV $487
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $489
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $486
+CNSTI4 0
+RETI4
+LABELV $485
+endproc CG_ScanForExistingClientInfo 60 8
+proc CG_SetDeferredClientInfo 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $503
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $511
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $509
+LABELV $511
+ADDRGP4 $504
+JUMPV
+LABELV $509
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $517
+ADDRLP4 24
+CNSTI4 160
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $517
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $512
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $512
+ADDRLP4 32
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $512
+LABELV $517
+ADDRGP4 $504
+JUMPV
+LABELV $512
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $502
+JUMPV
+LABELV $504
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $506
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $503
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $518
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $518
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $522
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $530
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $528
+LABELV $530
+ADDRGP4 $523
+JUMPV
+LABELV $528
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $535
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $531
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $531
+ADDRLP4 24
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $531
+LABELV $535
+ADDRGP4 $523
+JUMPV
+LABELV $531
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $502
+JUMPV
+LABELV $523
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $525
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $522
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $502
+JUMPV
+LABELV $518
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $536
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $542
+ADDRGP4 $537
+JUMPV
+LABELV $542
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $502
+JUMPV
+LABELV $537
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $539
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $536
+ADDRGP4 $544
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $502
+endproc CG_SetDeferredClientInfo 36 8
+export CG_NewClientInfo
+proc CG_NewClientInfo 2304 12
+ADDRLP4 2136
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2132
+CNSTI4 2120
+ADDRLP4 2136
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 2136
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 2140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 2124
+ADDRLP4 2140
+INDIRP4
+ASGNP4
+ADDRLP4 2124
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $547
+ADDRLP4 2132
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2120
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $545
+JUMPV
+LABELV $547
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2120
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 2144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2144
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 2148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2148
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 0+76
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+ADDRLP4 2152
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2152
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 0+88
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 2156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2156
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+72
+ADDRLP4 2160
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 2164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2164
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+120
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $560
+ARGP4
+ADDRLP4 2172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2172
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+124
+ADDRLP4 2176
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $562
+ARGP4
+ADDRLP4 2180
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2180
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+128
+ADDRLP4 2184
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $564
+ARGP4
+ADDRLP4 2188
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2188
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 2192
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 2196
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2196
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+132
+ADDRLP4 2200
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 2204
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2204
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+136
+ADDRLP4 2208
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 2212
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2212
+INDIRP4
+ASGNP4
+ADDRLP4 0+416
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 2216
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2216
+INDIRP4
+ASGNP4
+ADDRLP4 0+448
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $574
+ARGP4
+ADDRLP4 2220
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2220
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $578
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $578
+ADDRLP4 0+160
+ARGP4
+ADDRGP4 $450
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+224
+ARGP4
+ADDRGP4 $120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRGP4 $574
+ARGP4
+ADDRLP4 2224
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2224
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2292
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2288
+ADDRLP4 2292
+INDIRP4
+ASGNP4
+ADDRLP4 2292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $586
+ADDRLP4 2288
+ADDRGP4 $120
+ASGNP4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRLP4 2296
+ADDRLP4 2288
+INDIRP4
+ASGNP4
+ADDRLP4 2288
+ADDRLP4 2296
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2296
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $587
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 2288
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+160
+ARGP4
+ADDRLP4 2224
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $579
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $576
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $576
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2292
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2292
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $576
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRLP4 0+160
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+160
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2224
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2224
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $603
+ADDRLP4 0+224
+ARGP4
+ADDRGP4 $120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2128
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $604
+LABELV $576
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $609
+ARGP4
+ADDRLP4 2224
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2224
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $610
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $613
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $613
+ADDRLP4 0+288
+ARGP4
+ADDRGP4 $450
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+352
+ARGP4
+ADDRGP4 $120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRGP4 $621
+ARGP4
+ADDRLP4 2228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2228
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2296
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2292
+ADDRLP4 2296
+INDIRP4
+ASGNP4
+ADDRLP4 2296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $622
+ADDRLP4 2292
+ADDRGP4 $120
+ASGNP4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRLP4 2300
+ADDRLP4 2292
+INDIRP4
+ASGNP4
+ADDRLP4 2292
+ADDRLP4 2300
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2300
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $623
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 2292
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 2228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $614
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $611
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $611
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2296
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2296
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $611
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+288
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2228
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2228
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $639
+ADDRLP4 0+352
+ARGP4
+ADDRGP4 $120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $640
+JUMPV
+LABELV $639
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2128
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $640
+LABELV $611
+ADDRLP4 0
+ARGP4
+ADDRLP4 2228
+ADDRGP4 CG_ScanForExistingClientInfo
+CALLI4
+ASGNI4
+ADDRLP4 2228
+INDIRI4
+CNSTI4 0
+NEI4 $645
+ADDRLP4 2240
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 2240
+INDIRI4
+CNSTI4 4000000
+GEI4 $648
+ADDRLP4 2236
+CNSTI4 1
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRLP4 2236
+CNSTI4 0
+ASGNI4
+LABELV $649
+ADDRLP4 2232
+ADDRLP4 2236
+INDIRI4
+ASGNI4
+ADDRLP4 2244
+CNSTI4 0
+ASGNI4
+ADDRLP4 2232
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+NEI4 $655
+ADDRGP4 cg_deferPlayers+12
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+EQI4 $650
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+NEI4 $650
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+NEI4 $650
+LABELV $655
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_SetDeferredClientInfo
+CALLV
+pop
+ADDRLP4 2232
+INDIRI4
+CNSTI4 0
+EQI4 $651
+ADDRGP4 $658
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0+480
+CNSTI4 0
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $651
+LABELV $645
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 2132
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 2120
+LABELV $545
+endproc CG_NewClientInfo 2304 12
+export CG_LoadDeferredPlayers
+proc CG_LoadDeferredPlayers 20 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+41156
+ASGNP4
+ADDRGP4 $664
+JUMPV
+LABELV $661
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $667
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $667
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $669
+ADDRGP4 $658
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $662
+JUMPV
+LABELV $669
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $667
+LABELV $662
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2120
+ADDP4
+ASGNP4
+LABELV $664
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $661
+LABELV $660
+endproc CG_LoadDeferredPlayers 20 8
+proc CG_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $674
+ADDRFP4 8
+INDIRI4
+CNSTI4 51
+LTI4 $672
+LABELV $674
+ADDRGP4 $675
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $672
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $676
+ADDRGP4 $679
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $676
+LABELV $671
+endproc CG_SetLerpFrameAnimation 12 8
+proc CG_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_animSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $681
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $686
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $684
+LABELV $686
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $684
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $687
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $690
+ADDRGP4 $680
+JUMPV
+LABELV $690
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $692
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $693
+JUMPV
+LABELV $692
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $693
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $695
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $697
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $699
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $699
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $700
+LABELV $697
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $702
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $703
+JUMPV
+LABELV $702
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $704
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $704
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $705
+LABELV $703
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $706
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $710
+ADDRGP4 $713
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $710
+LABELV $706
+LABELV $687
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $714
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $714
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $718
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $718
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $722
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $723
+LABELV $680
+endproc CG_RunLerpFrame 48 12
+proc CG_ClearLerpFrame 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $725
+endproc CG_ClearLerpFrame 16 12
+proc CG_PlayerAnimation 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_noPlayerAnims+12
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $727
+JUMPV
+LABELV $728
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $731
+ADDRLP4 4
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $732
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $734
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $735
+JUMPV
+LABELV $734
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $735
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $727
+endproc CG_PlayerAnimation 20 16
+proc CG_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $737
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $741
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $739
+LABELV $741
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $739
+LABELV $737
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $742
+ADDRGP4 $736
+JUMPV
+LABELV $742
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $744
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $745
+JUMPV
+LABELV $744
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $746
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $747
+LABELV $745
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $748
+ADDRLP4 8
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $751
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $751
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 8
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $754
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $754
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $749
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $756
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $757
+JUMPV
+LABELV $756
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $758
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $758
+LABELV $757
+LABELV $736
+endproc CG_SwingAngles 28 8
+proc CG_AddPainTwitch 12 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $762
+ADDRGP4 $760
+JUMPV
+LABELV $762
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $764
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $765
+JUMPV
+LABELV $764
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $765
+LABELV $760
+endproc CG_AddPainTwitch 12 0
+data
+align 4
+LABELV $767
+byte 4 0
+byte 4 22
+byte 4 45
+byte 4 -22
+byte 4 0
+byte 4 22
+byte 4 -45
+byte 4 -22
+code
+proc CG_PlayerAngles 140 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $774
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+LABELV $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $777
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 7
+EQI4 $780
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $781
+LABELV $777
+ADDRLP4 84
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $784
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 11
+EQI4 $782
+ADDRLP4 88
+INDIRI4
+CNSTI4 12
+EQI4 $782
+LABELV $784
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $785
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+EQF4 $787
+ADDRLP4 96
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1028443341
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $787
+LABELV $785
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $789
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $793
+ADDRLP4 56
+INDIRI4
+CNSTI4 7
+LEI4 $791
+LABELV $793
+ADDRGP4 $794
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $791
+LABELV $790
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $767
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $767
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $799
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1127481344
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1127481344
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRGP4 $800
+JUMPV
+LABELV $799
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $800
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $812
+ADDRLP4 68
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $813
+JUMPV
+LABELV $812
+ADDRLP4 68
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $813
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $814
+ADDRLP4 68
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $767
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRLP4 68
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $815
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $819
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $819
+ADDRLP4 60
+CNSTI4 2120
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $822
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $822
+LABELV $819
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ARGP4
+ADDRLP4 96
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+EQF4 $824
+ADDRLP4 52
+CNSTF4 1028443341
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 136
+ADDRLP4 52
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 100+12
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 100+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 100+12+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 52
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $824
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $838
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $838
+ADDRLP4 60
+CNSTI4 2120
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $841
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 104
+INDIRF4
+ASGNF4
+LABELV $841
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 43
+EQI4 $848
+ADDRLP4 104
+INDIRI4
+CNSTI4 44
+NEI4 $846
+LABELV $848
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+LABELV $846
+LABELV $838
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPainTwitch
+CALLV
+pop
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+LABELV $852
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $766
+endproc CG_PlayerAngles 140 24
+proc CG_HasteTrail 40 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $857
+ADDRGP4 $856
+JUMPV
+LABELV $857
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 15
+EQI4 $860
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+EQI4 $860
+ADDRGP4 $856
+JUMPV
+LABELV $860
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $862
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $862
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+572
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $856
+endproc CG_HasteTrail 40 48
+proc CG_BreathPuffs 64 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 cg_enableBreath+12
+INDIRI4
+CNSTI4 0
+NEI4 $872
+ADDRGP4 $870
+JUMPV
+LABELV $872
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $875
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $875
+ADDRGP4 $870
+JUMPV
+LABELV $875
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $879
+ADDRGP4 $870
+JUMPV
+LABELV $879
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $881
+ADDRGP4 $870
+JUMPV
+LABELV $881
+ADDRLP4 24
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $883
+ADDRGP4 $870
+JUMPV
+LABELV $883
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 44
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3229614080
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1059648963
+ARGF4
+CNSTF4 1153138688
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 400
+ADDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+180272+348
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRLP4 24
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $870
+endproc CG_BreathPuffs 64 48
+proc CG_DustTrail 112 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 0
+NEI4 $900
+ADDRGP4 $899
+JUMPV
+LABELV $900
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $903
+ADDRGP4 $899
+JUMPV
+LABELV $903
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 21
+EQI4 $906
+ADDRLP4 24
+INDIRI4
+CNSTI4 19
+EQI4 $906
+ADDRGP4 $899
+JUMPV
+LABELV $906
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $908
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+44
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $913
+ADDRGP4 $899
+JUMPV
+LABELV $913
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3253731328
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 104
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+CNSTF4 1060320051
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+692
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $899
+endproc CG_DustTrail 112 48
+proc CG_TrailItem 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $922
+endproc CG_TrailItem 192 12
+proc CG_PlayerFlag 356 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+180272+120
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $459
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+8
+ADDRGP4 cgs+180272+124
+INDIRI4
+ASGNI4
+ADDRLP4 140+108
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 280+8
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 22
+EQI4 $954
+ADDRLP4 304
+INDIRI4
+CNSTI4 23
+NEI4 $952
+LABELV $954
+ADDRLP4 320
+CNSTI4 49
+ASGNI4
+ADDRGP4 $953
+JUMPV
+LABELV $952
+ADDRLP4 304
+INDIRI4
+CNSTI4 14
+EQI4 $957
+ADDRLP4 304
+INDIRI4
+CNSTI4 13
+NEI4 $955
+LABELV $957
+ADDRLP4 320
+CNSTI4 49
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $955
+ADDRLP4 320
+CNSTI4 48
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $956
+LABELV $953
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $958
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 308
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 344
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 1063675494
+GEF4 $971
+ADDRLP4 308
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 1065353216
+LEF4 $980
+ADDRLP4 308
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $981
+JUMPV
+LABELV $980
+ADDRLP4 308
+INDIRF4
+CNSTF4 3212836864
+GEF4 $982
+ADDRLP4 308
+CNSTF4 3212836864
+ASGNF4
+LABELV $982
+LABELV $981
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 324
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 0
+GEF4 $994
+ADDRLP4 280+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $995
+JUMPV
+LABELV $994
+ADDRLP4 280+4
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $995
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 0
+GEF4 $998
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $998
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1002
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1002
+ADDRLP4 280+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1041865114
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $971
+LABELV $958
+ADDRLP4 280+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ARGP4
+ADDRLP4 320
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRLP4 140+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+80
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $459
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $936
+endproc CG_PlayerFlag 356 24
+proc CG_PlayerTokens 200 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1015
+ADDRGP4 $1014
+JUMPV
+LABELV $1015
+ADDRLP4 4
+CNSTI4 124
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+116008
+ADDP4
+ASGNP4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $1018
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1014
+JUMPV
+LABELV $1018
+ADDRLP4 180
+INDIRI4
+CNSTI4 10
+LEI4 $1020
+ADDRLP4 180
+CNSTI4 10
+ASGNI4
+LABELV $1020
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1022
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1029
+JUMPV
+LABELV $1026
+ADDRLP4 188
+CNSTI4 12
+ASGNI4
+ADDRLP4 192
+ADDRLP4 188
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 188
+INDIRI4
+SUBI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1027
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1029
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1026
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1023
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1025
+ADDRLP4 8
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+LTI4 $1022
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1033
+JUMPV
+LABELV $1030
+ADDRLP4 188
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 188
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1106247680
+LEF4 $1038
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 152+4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1038
+ADDRLP4 152
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1031
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1033
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1030
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1044
+ADDRLP4 12+8
+ADDRGP4 cgs+180272+20
+INDIRI4
+ASGNI4
+ADDRGP4 $1045
+JUMPV
+LABELV $1044
+ADDRLP4 12+8
+ADDRGP4 cgs+180272+24
+INDIRI4
+ASGNI4
+LABELV $1045
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1058
+JUMPV
+LABELV $1055
+ADDRLP4 12+28
+ADDRLP4 152
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+4
+ADDRLP4 152+4
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+ADDRLP4 152+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRLP4 12+28+24
+ARGP4
+ADDRLP4 12+28+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 12+68
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 176
+CNSTF4 1086918619
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 5000
+ADDI4
+CNSTI4 500
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+CNSTI4 16
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+68+8
+ADDRLP4 12+68+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 152
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1056
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1058
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1055
+LABELV $1014
+endproc CG_PlayerTokens 200 12
+proc CG_PlayerPowerups 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1087
+ADDRGP4 $1086
+JUMPV
+LABELV $1087
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1089
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1089
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1091
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+180272+1256
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $1091
+ADDRLP4 4
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1096
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1098
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+128
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1099
+JUMPV
+LABELV $1098
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+36
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1099
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1096
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1104
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+132
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1107
+JUMPV
+LABELV $1106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+40
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1107
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1104
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1112
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+136
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1115
+JUMPV
+LABELV $1114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+44
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1115
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1112
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_HasteTrail
+CALLV
+pop
+LABELV $1120
+LABELV $1086
+endproc CG_PlayerPowerups 16 20
+proc CG_PlayerFloatSprite 144 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1123
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1123
+ADDRLP4 140
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1124
+JUMPV
+LABELV $1123
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $1124
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1122
+endproc CG_PlayerFloatSprite 144 12
+proc CG_PlayerSprites 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1141
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+272
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+268
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $1149
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+720
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1149
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1153
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+724
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+728
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1157
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $1161
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+732
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1161
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $1165
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+736
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1165
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1169
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+740
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1140
+JUMPV
+LABELV $1169
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1175
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1175
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1175
+ADDRGP4 cgs+34808
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1175
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $1140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+264
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+LABELV $1175
+LABELV $1140
+endproc CG_PlayerSprites 12 8
+lit
+align 4
+LABELV $1186
+byte 4 3245342720
+byte 4 3245342720
+byte 4 0
+align 4
+LABELV $1187
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc CG_PlayerShadow 104 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $1186
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 $1187
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1188
+CNSTI4 0
+RETI4
+ADDRGP4 $1185
+JUMPV
+LABELV $1188
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1191
+CNSTI4 0
+RETI4
+ADDRGP4 $1185
+JUMPV
+LABELV $1191
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1199
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $1199
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $1194
+LABELV $1199
+CNSTI4 0
+RETI4
+ADDRGP4 $1185
+JUMPV
+LABELV $1194
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+EQI4 $1202
+CNSTI4 1
+RETI4
+ADDRGP4 $1185
+JUMPV
+LABELV $1202
+ADDRLP4 56
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+180272+496
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1103101952
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1185
+endproc CG_PlayerShadow 104 44
+proc CG_PlayerSplash 196 28
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1211
+ADDRGP4 $1210
+JUMPV
+LABELV $1211
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1215
+ADDRGP4 $1210
+JUMPV
+LABELV $1215
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+EQI4 $1218
+ADDRGP4 $1210
+JUMPV
+LABELV $1218
+ADDRLP4 96
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1220
+ADDRGP4 $1210
+JUMPV
+LABELV $1220
+ADDRLP4 0
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 192
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 0+48
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 0+48+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 0+72
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 0+72+4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+180272+520
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1210
+endproc CG_PlayerSplash 196 28
+export CG_AddRefEntityWithPowerups
+proc CG_AddRefEntityWithPowerups 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1301
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+556
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1302
+JUMPV
+LABELV $1301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1308
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 2048
+BANDI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1308
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1308
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1313
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1316
+ADDRGP4 $1311
+JUMPV
+LABELV $1313
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+588
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+592
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1311
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+584
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1312
+LABELV $1308
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1321
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1323
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+548
+INDIRI4
+ASGNI4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+544
+INDIRI4
+ASGNI4
+LABELV $1324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1321
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1329
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+DIVI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $1331
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+560
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1331
+LABELV $1329
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1336
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+564
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1336
+LABELV $1302
+LABELV $1300
+endproc CG_AddRefEntityWithPowerups 8 4
+export CG_LightVerts
+proc CG_LightVerts 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_LightForPoint
+CALLI4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1344
+JUMPV
+LABELV $1341
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1347
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $1350
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1351
+JUMPV
+LABELV $1350
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1351
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1354
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1355
+JUMPV
+LABELV $1354
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1355
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1358
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1359
+JUMPV
+LABELV $1358
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1359
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1342
+JUMPV
+LABELV $1347
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1360
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1360
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1364
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1364
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1368
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1368
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1342
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1344
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $1341
+CNSTI4 1
+RETI4
+LABELV $1340
+endproc CG_LightVerts 88 16
+export CG_Player
+proc CG_Player 836 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 764
+CNSTI4 0
+ASGNI4
+ADDRLP4 704
+CNSTF4 0
+ASGNF4
+ADDRLP4 708
+CNSTF4 0
+ASGNF4
+ADDRLP4 712
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 0
+LEI4 $1371
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 1
+NEI4 $1374
+ADDRLP4 708
+CNSTF4 0
+ASGNF4
+ADDRLP4 704
+CNSTF4 1058977874
+ASGNF4
+ADDRLP4 712
+CNSTF4 1076677837
+ASGNF4
+ADDRGP4 $1372
+JUMPV
+LABELV $1374
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 2
+NEI4 $1377
+ADDRLP4 704
+CNSTF4 1064011039
+ASGNF4
+ADDRLP4 708
+CNSTF4 1062333317
+ASGNF4
+ADDRLP4 712
+CNSTF4 1067869798
+ASGNF4
+ADDRGP4 $1372
+JUMPV
+LABELV $1377
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 3
+NEI4 $1380
+ADDRLP4 772
+CNSTF4 1064011039
+ASGNF4
+ADDRLP4 704
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRLP4 708
+CNSTF4 1064849900
+ASGNF4
+ADDRLP4 712
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRGP4 $1372
+JUMPV
+LABELV $1380
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 4
+NEI4 $1372
+ADDRLP4 704
+CNSTF4 1062836634
+ASGNF4
+ADDRLP4 708
+CNSTF4 1067869798
+ASGNF4
+ADDRLP4 712
+CNSTF4 1063843267
+ASGNF4
+ADDRGP4 $1372
+JUMPV
+LABELV $1371
+ADDRLP4 772
+CNSTF4 0
+ASGNF4
+ADDRLP4 712
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRLP4 708
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRLP4 704
+ADDRLP4 772
+INDIRF4
+ASGNF4
+LABELV $1372
+ADDRLP4 752
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 752
+INDIRI4
+CNSTI4 0
+LTI4 $1388
+ADDRLP4 752
+INDIRI4
+CNSTI4 64
+LTI4 $1386
+LABELV $1388
+ADDRGP4 $1389
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1386
+ADDRLP4 560
+CNSTI4 2120
+ADDRLP4 752
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1391
+ADDRGP4 $1370
+JUMPV
+LABELV $1391
+ADDRLP4 716
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1393
+ADDRLP4 764
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1396
+ADDRLP4 716
+CNSTI4 2
+ASGNI4
+LABELV $1396
+LABELV $1397
+LABELV $1393
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 280
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+96
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 140+96
+ARGP4
+ADDRLP4 140+80
+ARGP4
+ADDRLP4 140+100
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSprites
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 736
+ARGP4
+ADDRLP4 776
+ADDRGP4 CG_PlayerShadow
+CALLI4
+ASGNI4
+ADDRLP4 768
+ADDRLP4 776
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSplash
+CALLV
+pop
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 3
+NEI4 $1408
+ADDRLP4 768
+INDIRI4
+CNSTI4 0
+EQI4 $1408
+ADDRLP4 716
+ADDRLP4 716
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $1408
+ADDRLP4 716
+ADDRLP4 716
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $1411
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 716
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerTokens
+CALLV
+pop
+LABELV $1411
+ADDRLP4 0+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1415
+ADDRLP4 0+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1415
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 704
+INDIRF4
+CNSTF4 0
+EQF4 $1420
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1420
+ADDRGP4 cg_enableQ+12
+INDIRI4
+CNSTI4 0
+EQI4 $1464
+ADDRLP4 0+28
+CNSTF4 1062836634
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1062836634
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1062836634
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1062836634
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1062836634
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1062836634
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1062836634
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1062836634
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1062836634
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1464
+ADDRLP4 0+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1513
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+LABELV $1513
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1517
+ADDRGP4 $1370
+JUMPV
+LABELV $1517
+ADDRLP4 560
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1520
+ADDRLP4 280+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+8
+INDIRI4
+CNSTI4 0
+NEI4 $1523
+ADDRGP4 $1370
+JUMPV
+LABELV $1523
+ADDRLP4 280+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 280
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1528
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 764
+INDIRI4
+CNSTI4 0
+EQI4 $1529
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ADDRLP4 280+68+4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 280+68+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 3
+NEI4 $1536
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 headang
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1537
+JUMPV
+LABELV $1536
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+NEI4 $1540
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 headang
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 headang+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1541
+JUMPV
+LABELV $1540
+ADDRGP4 headang
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1541
+LABELV $1537
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1545
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRB
+ASGNB 12
+ADDRLP4 784
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+ADDRLP4 784
+INDIRP4
+ADDRLP4 784
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRLP4 792
+INDIRP4
+ADDRLP4 792
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 800
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ASGNP4
+ADDRLP4 800
+INDIRP4
+ADDRLP4 800
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 headpos
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1545
+LABELV $1529
+ADDRLP4 280+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+EQI4 $1555
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 3
+NEI4 $1551
+LABELV $1555
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+LABELV $1551
+ADDRLP4 280
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 CG_BreathPuffs
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DustTrail
+CALLV
+pop
+ADDRGP4 $1370
+JUMPV
+LABELV $1520
+ADDRLP4 140+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1558
+ADDRGP4 $1370
+JUMPV
+LABELV $1558
+ADDRLP4 140+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1563
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1566
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+LABELV $1566
+ADDRLP4 708
+INDIRF4
+CNSTF4 0
+EQF4 $1570
+ADDRLP4 140+28
+ADDRLP4 140+28
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+4
+ADDRLP4 140+28+4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+8
+ADDRLP4 140+28+8
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12
+ADDRLP4 140+28+12
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+ADDRLP4 140+28+12+4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+ADDRLP4 140+28+12+8
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24
+ADDRLP4 140+28+24
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+4
+ADDRLP4 140+28+24+4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+8
+ADDRLP4 140+28+24+8
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1570
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1614
+ADDRLP4 564
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 564+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 564+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 564+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1619
+ADDRLP4 780
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 732
+ADDRLP4 780
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 7
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ADDRLP4 780
+INDIRF4
+LEF4 $1622
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1622
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 784
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 784
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 788
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 788
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+CNSTF4 1086918619
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 792
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 1090519040
+ADDRLP4 792
+INDIRF4
+MULF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+12
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 564+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 564+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 564+28+12
+ARGP4
+ADDRLP4 564+28+24
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1620
+JUMPV
+LABELV $1619
+ADDRLP4 732
+CNSTF4 1086918619
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 780
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 780
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 784
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 784
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 788
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 1101004800
+ADDRLP4 788
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 792
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 740
+CNSTF4 1106247680
+ADDRLP4 792
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 740+4
+CNSTF4 1127481344
+ADDRLP4 732
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1679
+ADDRLP4 740+4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1679
+ADDRLP4 740+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+28+12
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 796
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 732
+ADDRLP4 796
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1078530011
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ADDRLP4 796
+INDIRF4
+LEF4 $1694
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1694
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 800
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 800
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 804
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 804
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 808
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 1101004800
+ADDRLP4 808
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+CNSTF4 1070141403
+SUBF4
+ARGF4
+ADDRLP4 812
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 740
+CNSTF4 1106247680
+ADDRLP4 812
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 740+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 732
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1711
+ADDRLP4 740+4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1711
+ADDRLP4 740+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 816
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 732
+ADDRLP4 816
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 3
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1070141403
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ADDRLP4 816
+INDIRF4
+LEF4 $1724
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1724
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 820
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 820
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 824
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 824
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+28+12
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 564+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 564+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 564+28+12
+ARGP4
+ADDRLP4 564+28+24
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1620
+LABELV $1614
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1763
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+664
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1763
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1771
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+668
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1771
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1779
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+672
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1779
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1787
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+676
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1787
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $1795
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1797
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1797
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $1796
+JUMPV
+LABELV $1795
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1796
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+NEI4 $1804
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $1801
+LABELV $1804
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+700
+INDIRI4
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+4
+ADDRLP4 420+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 420+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $1811
+ADDRLP4 760
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+ADDRGP4 $1812
+JUMPV
+LABELV $1811
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $1815
+ADDRLP4 760
+CNSTI4 250
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+ADDRGP4 $1816
+JUMPV
+LABELV $1815
+ADDRLP4 760
+CNSTF4 1065353216
+ASGNF4
+LABELV $1816
+LABELV $1812
+ADDRLP4 420+28
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 420+28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+12+4
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 420+28+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+24+8
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1801
+ADDRLP4 756
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1841
+ADDRLP4 756
+INDIRI4
+CNSTI4 500
+GEI4 $1841
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+688
+INDIRI4
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+4
+ADDRLP4 420+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 780
+CNSTF4 0
+ASGNF4
+ADDRLP4 740+8
+ADDRLP4 780
+INDIRF4
+ASGNF4
+ADDRLP4 740+4
+ADDRLP4 780
+INDIRF4
+ASGNF4
+ADDRLP4 740
+ADDRLP4 780
+INDIRF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 420+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 420+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 420+68+8
+ADDRLP4 420+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDRLP4 756
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1140457472
+DIVF4
+CNSTF4 3250585600
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 756
+INDIRI4
+CNSTI4 400
+LEI4 $1854
+ADDRLP4 788
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 760
+ADDRLP4 788
+INDIRF4
+ADDRLP4 756
+INDIRI4
+CNSTI4 1000
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 792
+ADDRLP4 788
+INDIRF4
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 796
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 792
+INDIRF4
+ADDRLP4 796
+INDIRF4
+LTF4 $1858
+ADDRLP4 784
+ADDRLP4 792
+INDIRF4
+ADDRLP4 796
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1859
+JUMPV
+LABELV $1858
+ADDRLP4 784
+ADDRLP4 792
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1859
+ADDRLP4 420+116
+ADDRLP4 784
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 804
+CNSTF4 1132396544
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 808
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 804
+INDIRF4
+ADDRLP4 808
+INDIRF4
+LTF4 $1863
+ADDRLP4 800
+ADDRLP4 804
+INDIRF4
+ADDRLP4 808
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1864
+JUMPV
+LABELV $1863
+ADDRLP4 800
+ADDRLP4 804
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1864
+ADDRLP4 420+116+1
+ADDRLP4 800
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 816
+CNSTF4 1132396544
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 820
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 816
+INDIRF4
+ADDRLP4 820
+INDIRF4
+LTF4 $1868
+ADDRLP4 812
+ADDRLP4 816
+INDIRF4
+ADDRLP4 820
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1869
+JUMPV
+LABELV $1868
+ADDRLP4 812
+ADDRLP4 816
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1869
+ADDRLP4 420+116+2
+ADDRLP4 812
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 828
+CNSTF4 1132396544
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 832
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 828
+INDIRF4
+ADDRLP4 832
+INDIRF4
+LTF4 $1873
+ADDRLP4 824
+ADDRLP4 828
+INDIRF4
+ADDRLP4 832
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1874
+JUMPV
+LABELV $1873
+ADDRLP4 824
+ADDRLP4 828
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1874
+ADDRLP4 420+116+3
+ADDRLP4 824
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1855
+JUMPV
+LABELV $1854
+ADDRLP4 420+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 420+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 420+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 420+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1855
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1841
+ADDRLP4 280+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+8
+INDIRI4
+CNSTI4 0
+NEI4 $1883
+ADDRGP4 $1370
+JUMPV
+LABELV $1883
+ADDRLP4 280+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 280
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1528
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 764
+INDIRI4
+CNSTI4 0
+EQI4 $1888
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ADDRLP4 280+68+4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 280+68+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+NEI4 $1895
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 headang
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1896
+JUMPV
+LABELV $1895
+ADDRGP4 headang
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1896
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1899
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRB
+ASGNB 12
+ADDRLP4 784
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+ADDRLP4 784
+INDIRP4
+ADDRLP4 784
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRLP4 792
+INDIRP4
+ADDRLP4 792
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 800
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ASGNP4
+ADDRLP4 800
+INDIRP4
+ADDRLP4 800
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 headpos
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1899
+LABELV $1888
+ADDRLP4 280+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRLP4 712
+INDIRF4
+CNSTF4 0
+EQF4 $1905
+ADDRLP4 280+28
+ADDRLP4 280+28
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+4
+ADDRLP4 280+28+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+8
+ADDRLP4 280+28+8
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+12
+ADDRLP4 280+28+12
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+12+4
+ADDRLP4 280+28+12+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+12+8
+ADDRLP4 280+28+12+8
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+24
+ADDRLP4 280+28+24
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+24+4
+ADDRLP4 280+28+24+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+24+8
+ADDRLP4 280+28+24+8
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1905
+ADDRLP4 280
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 CG_BreathPuffs
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DustTrail
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_PlayerPowerups
+CALLV
+pop
+LABELV $1370
+endproc CG_Player 836 28
+export CG_ResetPlayerEntity
+proc CG_ResetPlayerEntity 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+CNSTI4 -99999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugPosition+12
+INDIRI4
+CNSTI4 0
+EQI4 $1954
+ADDRGP4 $1957
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1954
+LABELV $1949
+endproc CG_ResetPlayerEntity 48 12
+import cg_leiChibi
+bss
+export enableQ
+align 4
+LABELV enableQ
+skip 4
+export headang
+align 4
+LABELV headang
+skip 12
+export headpos
+align 4
+LABELV headpos
+skip 12
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1957
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 61
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1563
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1528
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1389
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $794
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $713
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 102
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $679
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $675
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $658
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $621
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $609
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $574
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $572
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $570
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $568
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $566
+byte 1 116
+byte 1 116
+byte 1 0
+align 1
+LABELV $564
+byte 1 116
+byte 1 0
+align 1
+LABELV $562
+byte 1 108
+byte 1 0
+align 1
+LABELV $560
+byte 1 119
+byte 1 0
+align 1
+LABELV $558
+byte 1 104
+byte 1 99
+byte 1 0
+align 1
+LABELV $556
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $554
+byte 1 99
+byte 1 50
+byte 1 0
+align 1
+LABELV $552
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $549
+byte 1 110
+byte 1 0
+align 1
+LABELV $544
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $473
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $459
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $454
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $451
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $450
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $441
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $422
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $419
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $414
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $411
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $410
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $407
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $404
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $401
+byte 1 86
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $400
+byte 1 69
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $399
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $396
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $386
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $379
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $378
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $373
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $370
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $367
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $364
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $363
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $360
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $357
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $354
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $351
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $348
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $347
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $340
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $329
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $326
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $323
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $320
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $317
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $314
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $313
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $310
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $286
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $285
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $275
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $263
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $253
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $252
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $243
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $242
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $232
+byte 1 0
+align 1
+LABELV $231
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $230
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $217
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $161
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $158
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $147
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $138
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $135
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $134
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 0
+align 1
+LABELV $131
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $128
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $125
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $121
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $120
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $115
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $86
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $85
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $84
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $83
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $82
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $81
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $80
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $79
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $78
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $77
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $76
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $75
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $74
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
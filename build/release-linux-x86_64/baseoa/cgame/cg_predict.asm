@@ -0,0 +1,4867 @@
+export CG_BuildSolidList
+code
+proc CG_BuildSolidList 32 0
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_numSolidEntities
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg_numTriggerEntities
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg+40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $75
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107596
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $75
+ADDRGP4 cg+107592
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $75
+ADDRLP4 12
+ADDRGP4 cg+40
+INDIRP4
+ASGNP4
+ADDRGP4 $76
+JUMPV
+LABELV $75
+ADDRLP4 12
+ADDRGP4 cg+36
+INDIRP4
+ASGNP4
+LABELV $76
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $85
+JUMPV
+LABELV $82
+ADDRLP4 0
+CNSTI4 936
+CNSTI4 208
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+EQI4 $89
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+EQI4 $89
+ADDRLP4 24
+INDIRI4
+CNSTI4 9
+NEI4 $86
+LABELV $89
+ADDRGP4 cg_numTriggerEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_triggerEntities
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 cg_numTriggerEntities
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 cg_numSolidEntities
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $90
+LABELV $83
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $85
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+LTI4 $82
+LABELV $74
+endproc CG_BuildSolidList 32 0
+proc CG_ClipMoveToEntities 152 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $93
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+NEI4 $97
+ADDRGP4 $94
+JUMPV
+LABELV $97
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $99
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 60
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ASGNP4
+ADDRLP4 136
+CNSTI4 255
+ASGNI4
+ADDRLP4 120
+ADDRLP4 132
+INDIRP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 136
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 136
+INDIRI4
+BANDI4
+CNSTI4 32
+SUBI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 120
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 124
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_CM_TempBoxModel
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRLP4 96
+ADDRLP4 60
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $100
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 trap_CM_TransformedBoxTrace
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $109
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $106
+LABELV $109
+ADDRLP4 4+52
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRFP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $111
+LABELV $107
+ADDRFP4 24
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $114
+ADDRGP4 $92
+JUMPV
+LABELV $114
+LABELV $94
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $96
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $93
+LABELV $92
+endproc CG_ClipMoveToEntities 152 36
+export CG_Trace
+proc CG_Trace 60 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $120
+ADDRLP4 56
+CNSTI4 1022
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 56
+CNSTI4 1023
+ASGNI4
+LABELV $121
+ADDRLP4 0+52
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ClipMoveToEntities
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 56
+LABELV $116
+endproc CG_Trace 60 28
+export CG_PointContents
+proc CG_PointContents 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $127
+ADDRGP4 $124
+JUMPV
+LABELV $127
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+EQI4 $129
+ADDRGP4 $124
+JUMPV
+LABELV $129
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $131
+ADDRGP4 $124
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_CM_TransformedPointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BORI4
+ASGNI4
+LABELV $124
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $123
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $122
+endproc CG_PointContents 36 16
+proc CG_InterpolatePlayerState 80 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+107636
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+40
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRLP4 48
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+LABELV $138
+ADDRGP4 cg+107596
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRGP4 $133
+JUMPV
+LABELV $140
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $145
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+GTI4 $143
+LABELV $145
+ADDRGP4 $133
+JUMPV
+LABELV $143
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 52
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ASGNI4
+LABELV $147
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 64
+ASGNI4
+ADDRLP4 60
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 196
+ASGNI4
+ADDRLP4 64
+ADDRLP4 68
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1127481344
+LEF4 $155
+ADDRLP4 64
+ADDRLP4 64
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 64
+INDIRF4
+CNSTF4 3274964992
+GEF4 $157
+ADDRLP4 64
+ADDRLP4 64
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $157
+LABELV $156
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $153
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 76
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $150
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $149
+LABELV $133
+endproc CG_InterpolatePlayerState 80 8
+proc CG_TouchItem 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $164
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $160
+LABELV $164
+ADDRGP4 $159
+JUMPV
+LABELV $160
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+34828
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $165
+LABELV $169
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $165
+ADDRGP4 cg_predictItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRGP4 $159
+JUMPV
+LABELV $170
+ADDRGP4 cg+107636
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRGP4 $159
+JUMPV
+LABELV $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+NEI4 $177
+ADDRGP4 $159
+JUMPV
+LABELV $177
+ADDRGP4 cgs+31456
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+107636
+ARGP4
+ADDRLP4 12
+ADDRGP4 BG_CanItemBeGrabbed
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $180
+ADDRGP4 $159
+JUMPV
+LABELV $180
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $184
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $187
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $187
+ADDRGP4 $159
+JUMPV
+LABELV $187
+LABELV $184
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $189
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $192
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $192
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $192
+LABELV $189
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $200
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $200
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $194
+LABELV $200
+ADDRGP4 cg+107636+248+12
+INDIRI4
+CNSTI4 1
+NEI4 $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $201
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $201
+ADDRGP4 $159
+JUMPV
+LABELV $201
+ADDRGP4 cg+107636+248+12
+INDIRI4
+CNSTI4 2
+NEI4 $206
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $206
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $206
+ADDRGP4 $159
+JUMPV
+LABELV $206
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+107636+248+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $211
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $211
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $211
+ADDRGP4 cgs+31468
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $218
+ADDRGP4 cgs+34820
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $211
+LABELV $218
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $211
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+107636+248+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $219
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $226
+ADDRGP4 cgs+34820
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $219
+LABELV $226
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $219
+LABELV $194
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $227
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+NEI4 $230
+ADDRGP4 $159
+JUMPV
+LABELV $230
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $233
+ADDRGP4 cgs+34992
+INDIRI4
+ADDRGP4 cg+107636+248+12
+INDIRI4
+EQI4 $159
+ADDRGP4 cgs+180272+1168
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $233
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $243
+ADDRGP4 cgs+34996
+INDIRI4
+ADDRGP4 cg+107636+248+12
+INDIRI4
+EQI4 $159
+ADDRGP4 cgs+180272+1168
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $243
+LABELV $227
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $253
+CNSTI4 19
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+107636
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $257
+ADDRLP4 20
+ADDRGP4 cg+107636+184+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+107636+376
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+107636+376
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $262
+LABELV $257
+LABELV $253
+LABELV $159
+endproc CG_TouchItem 48 12
+proc CG_TouchTriggerPrediction 88 28
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $269
+ADDRGP4 $268
+JUMPV
+LABELV $269
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 2
+NEI4 $276
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $277
+ADDRLP4 72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107636+4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $278
+ADDRLP4 72
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $278
+ADDRGP4 $268
+JUMPV
+LABELV $278
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $282
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_triggerEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $286
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $286
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_TouchItem
+CALLV
+pop
+ADDRGP4 $283
+JUMPV
+LABELV $286
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+EQI4 $288
+ADDRGP4 $283
+JUMPV
+LABELV $288
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRGP4 $283
+JUMPV
+LABELV $290
+ADDRLP4 16
+ARGP4
+ADDRGP4 cg+107636+20
+ARGP4
+ADDRGP4 cg+107636+20
+ARGP4
+ADDRGP4 cg_pmove+180
+ARGP4
+ADDRGP4 cg_pmove+192
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 16+4
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRGP4 $283
+JUMPV
+LABELV $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $301
+ADDRGP4 cg+107632
+CNSTI4 1
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $304
+ADDRGP4 cg+107636
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_TouchJumpPad
+CALLV
+pop
+LABELV $304
+LABELV $302
+LABELV $283
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $285
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numTriggerEntities
+INDIRI4
+LTI4 $282
+ADDRGP4 cg+107636+460
+INDIRI4
+ADDRGP4 cg+107636+456
+INDIRI4
+EQI4 $307
+ADDRGP4 cg+107636+460
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107636+448
+CNSTI4 0
+ASGNI4
+LABELV $307
+LABELV $268
+endproc CG_TouchTriggerPrediction 88 28
+proc IsUnacceptableError 316 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $321
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $321
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $318
+LABELV $321
+CNSTI4 1
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRLP4 40
+CNSTI4 20
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 24
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 28
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1008981770
+LEF4 $324
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $326
+CNSTI4 2
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $324
+ADDRLP4 64
+CNSTI4 32
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 36
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 40
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+CNSTF4 1008981770
+LEF4 $332
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $334
+ADDRLP4 4
+ARGP4
+ADDRLP4 84
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $334
+CNSTI4 3
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $332
+ADDRLP4 88
+CNSTI4 44
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $344
+ADDRLP4 96
+CNSTI4 48
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $344
+ADDRLP4 100
+CNSTI4 52
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $344
+ADDRLP4 104
+CNSTI4 56
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $344
+ADDRLP4 108
+CNSTI4 60
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $344
+ADDRLP4 112
+CNSTI4 64
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $344
+ADDRLP4 116
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $337
+LABELV $344
+CNSTI4 4
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $337
+ADDRLP4 124
+CNSTI4 72
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $350
+ADDRLP4 132
+CNSTI4 76
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $350
+ADDRLP4 136
+CNSTI4 80
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $350
+ADDRLP4 140
+CNSTI4 84
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $350
+ADDRLP4 144
+CNSTI4 88
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $345
+LABELV $350
+CNSTI4 5
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $345
+ADDRLP4 152
+CNSTI4 92
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+CNSTI4 96
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+CNSTI4 100
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+CNSTF4 1008981770
+LEF4 $353
+CNSTI4 6
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $353
+ADDRLP4 172
+CNSTI4 104
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $355
+CNSTI4 7
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $355
+ADDRLP4 176
+CNSTI4 108
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $357
+CNSTI4 8
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $357
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $359
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 188
+CNSTI4 112
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $365
+ADDRLP4 196
+CNSTI4 120
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $363
+LABELV $365
+CNSTI4 9
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $363
+LABELV $360
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $359
+ADDRLP4 184
+CNSTI4 128
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $369
+ADDRLP4 192
+CNSTI4 132
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $369
+ADDRLP4 196
+CNSTI4 136
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $366
+LABELV $369
+CNSTI4 10
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $366
+ADDRLP4 204
+CNSTI4 140
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $373
+ADDRLP4 212
+CNSTI4 144
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $373
+ADDRLP4 216
+CNSTI4 148
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $370
+LABELV $373
+CNSTI4 11
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $370
+ADDRLP4 232
+CNSTI4 152
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 0
+GEF4 $380
+ADDRLP4 236
+CNSTI4 152
+ASGNI4
+ADDRLP4 220
+ADDRFP4 4
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+NEGF4
+ASGNF4
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 240
+CNSTI4 152
+ASGNI4
+ADDRLP4 220
+ADDRFP4 4
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $381
+ADDRLP4 220
+INDIRF4
+CNSTF4 1065353216
+GTF4 $382
+ADDRLP4 244
+CNSTI4 156
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 0
+GEF4 $383
+ADDRLP4 248
+CNSTI4 156
+ASGNI4
+ADDRLP4 224
+ADDRFP4 4
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+NEGF4
+ASGNF4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 252
+CNSTI4 156
+ASGNI4
+ADDRLP4 224
+ADDRFP4 4
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $384
+ADDRLP4 224
+INDIRF4
+CNSTF4 1065353216
+GTF4 $382
+ADDRLP4 256
+CNSTI4 160
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 0
+GEF4 $385
+ADDRLP4 260
+CNSTI4 160
+ASGNI4
+ADDRLP4 228
+ADDRFP4 4
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+NEGF4
+ASGNF4
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 264
+CNSTI4 160
+ASGNI4
+ADDRLP4 228
+ADDRFP4 4
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $386
+ADDRLP4 228
+INDIRF4
+CNSTF4 1065353216
+LEF4 $374
+LABELV $382
+CNSTI4 12
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $374
+ADDRLP4 268
+CNSTI4 164
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $387
+CNSTI4 13
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $387
+ADDRLP4 276
+CNSTI4 168
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $393
+ADDRLP4 284
+CNSTI4 172
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $393
+ADDRLP4 288
+CNSTI4 176
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 288
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $393
+ADDRLP4 292
+CNSTI4 180
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $389
+LABELV $393
+CNSTI4 14
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $389
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 300
+CNSTI4 184
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $398
+CNSTI4 15
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $398
+LABELV $395
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $394
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $400
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 300
+CNSTI4 248
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $404
+CNSTI4 16
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $404
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $400
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $406
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 300
+CNSTI4 312
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $410
+CNSTI4 17
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $410
+LABELV $407
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $406
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $412
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 300
+CNSTI4 376
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $416
+CNSTI4 18
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $416
+LABELV $413
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $412
+ADDRLP4 300
+CNSTI4 440
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 300
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $421
+ADDRLP4 308
+CNSTI4 444
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $421
+ADDRLP4 312
+CNSTI4 448
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $418
+LABELV $421
+CNSTI4 19
+RETI4
+ADDRGP4 $317
+JUMPV
+LABELV $418
+CNSTI4 0
+RETI4
+LABELV $317
+endproc IsUnacceptableError 316 8
+export CG_PredictPlayerState
+proc CG_PredictPlayerState 620 28
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 512
+CNSTI4 0
+ASGNI4
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRLP4 516
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107632
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+109040
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRGP4 cg+109040
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+107636
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+LABELV $424
+ADDRLP4 544
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 544
+INDIRI4
+NEI4 $434
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 544
+INDIRI4
+EQI4 $430
+LABELV $434
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_InterpolatePlayerState
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $430
+ADDRLP4 548
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 548
+INDIRI4
+NEI4 $439
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 548
+INDIRI4
+EQI4 $435
+LABELV $439
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_InterpolatePlayerState
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $435
+ADDRGP4 cg_pmove
+ADDRGP4 cg+107636
+ASGNP4
+ADDRGP4 cg_pmove+232
+ADDRGP4 CG_Trace
+ASGNP4
+ADDRGP4 cg_pmove+236
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRGP4 cg_pmove
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $443
+ADDRGP4 cg_pmove+28
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRGP4 cg_pmove+28
+CNSTI4 33619969
+ASGNI4
+LABELV $444
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $447
+ADDRLP4 552
+ADDRGP4 cg_pmove+28
+ASGNP4
+ADDRLP4 552
+INDIRP4
+ADDRLP4 552
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $447
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+LEI4 $454
+ADDRLP4 552
+CNSTI4 1
+ASGNI4
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 552
+CNSTI4 0
+ASGNI4
+LABELV $455
+ADDRGP4 cg_pmove+36
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+107636
+INDIRB
+ASGNB 468
+ADDRLP4 556
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 476
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 476
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 520
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 560
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $457
+ADDRLP4 560
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $457
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRGP4 $464
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $457
+ADDRLP4 476
+INDIRI4
+ARGI4
+ADDRLP4 484
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRGP4 cg+40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $465
+ADDRLP4 564
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107596
+INDIRI4
+ADDRLP4 564
+INDIRI4
+NEI4 $465
+ADDRGP4 cg+107592
+INDIRI4
+ADDRLP4 564
+INDIRI4
+NEI4 $465
+ADDRGP4 cg+107636
+ADDRGP4 cg+40
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+ADDRGP4 cg+107612
+ADDRGP4 cg+40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRGP4 cg+107636
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 468
+ADDRGP4 cg+107612
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $466
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $478
+ADDRGP4 $481
+ARGP4
+ADDRGP4 $482
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $483
+ADDRGP4 $481
+ARGP4
+ADDRGP4 $486
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $483
+LABELV $479
+ADDRGP4 cg_pmove+216
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove+220
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove+224
+ADDRGP4 pmove_float+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove+228
+ADDRGP4 cgs+31460
+INDIRI4
+ASGNI4
+ADDRGP4 cg_optimizePrediction+12
+INDIRI4
+CNSTI4 0
+EQI4 $495
+ADDRLP4 568
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107596
+INDIRI4
+ADDRLP4 568
+INDIRI4
+NEI4 $502
+ADDRGP4 cg+107592
+INDIRI4
+ADDRLP4 568
+INDIRI4
+EQI4 $498
+LABELV $502
+ADDRGP4 cg+125588
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+156488
+ADDRGP4 cg+156484
+INDIRI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 476
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRGP4 cg+107612
+INDIRI4
+ADDRGP4 cg+125592
+INDIRI4
+NEI4 $506
+ADDRLP4 512
+ADDRGP4 cg+125588
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 576
+CNSTI4 1
+ASGNI4
+ADDRLP4 572
+ADDRGP4 cg+156484
+INDIRI4
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $511
+CNSTI4 468
+ADDRLP4 572
+INDIRI4
+MULI4
+ADDRGP4 cg+125596
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636
+INDIRI4
+NEI4 $517
+ADDRGP4 cg+107636
+ARGP4
+CNSTI4 468
+ADDRLP4 572
+INDIRI4
+MULI4
+ADDRGP4 cg+125596
+ADDP4
+ARGP4
+ADDRLP4 584
+ADDRGP4 IsUnacceptableError
+CALLI4
+ASGNI4
+ADDRLP4 580
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+EQI4 $523
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRGP4 $528
+ARGP4
+ADDRLP4 580
+INDIRI4
+ARGI4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $523
+ADDRGP4 cg_pmove
+INDIRP4
+CNSTI4 468
+ADDRLP4 572
+INDIRI4
+MULI4
+ADDRGP4 cg+125596
+ADDP4
+INDIRB
+ASGNB 468
+ADDRGP4 cg+156484
+ADDRLP4 572
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+ADDRLP4 512
+ADDRGP4 cg+125588
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 576
+CNSTI4 0
+ASGNI4
+ADDRGP4 $513
+JUMPV
+LABELV $517
+LABELV $512
+ADDRLP4 572
+ADDRLP4 572
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+LABELV $514
+ADDRLP4 572
+INDIRI4
+ADDRGP4 cg+156488
+INDIRI4
+NEI4 $511
+LABELV $513
+ADDRLP4 576
+INDIRI4
+CNSTI4 0
+EQI4 $533
+ADDRGP4 cg+125588
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+156488
+ADDRGP4 cg+156484
+INDIRI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 476
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $533
+LABELV $507
+LABELV $499
+ADDRGP4 cg+125592
+ADDRGP4 cg+107612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+156484
+INDIRI4
+ASGNI4
+LABELV $495
+ADDRLP4 480
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 476
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $544
+JUMPV
+LABELV $541
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cg_pmove+4
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRGP4 cg_pmove+216
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRGP4 cg_pmove
+INDIRP4
+ARGP4
+ADDRGP4 cg_pmove+4
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+LABELV $546
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRGP4 cg+107636
+INDIRI4
+GTI4 $550
+ADDRGP4 $542
+JUMPV
+LABELV $550
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+LEI4 $554
+ADDRGP4 $542
+JUMPV
+LABELV $554
+ADDRGP4 cg+107636
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $557
+ADDRGP4 cg+107592
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRLP4 584
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+109048+8
+ADDRLP4 584
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109048+4
+ADDRLP4 584
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109048
+ADDRLP4 584
+INDIRF4
+ASGNF4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $568
+ADDRGP4 $571
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $568
+ADDRGP4 cg+107592
+CNSTI4 0
+ASGNI4
+ADDRGP4 $561
+JUMPV
+LABELV $560
+ADDRGP4 cg+107636+20
+ARGP4
+ADDRGP4 cg+107636+68
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRGP4 cg+107608
+INDIRI4
+ARGI4
+ADDRLP4 584
+ARGP4
+ADDRGP4 cg+107636+152
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRLP4 8+20
+ARGP4
+ADDRLP4 584
+ARGP4
+ADDRLP4 608
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+NEI4 $584
+ADDRGP4 $587
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $584
+LABELV $581
+ADDRLP4 568
+ADDRLP4 8+20
+INDIRF4
+ADDRLP4 584
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 568+4
+ADDRLP4 8+20+4
+INDIRF4
+ADDRLP4 584+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 568+8
+ADDRLP4 8+20+8
+INDIRF4
+ADDRLP4 584+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 568
+ARGP4
+ADDRLP4 608
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 580
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 580
+INDIRF4
+CNSTF4 1036831949
+LEF4 $597
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $599
+ADDRGP4 $602
+ARGP4
+ADDRLP4 580
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $599
+ADDRGP4 cg_errorDecay+12
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 616
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109044
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 612
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 616
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 612
+INDIRF4
+CNSTF4 0
+GEF4 $610
+ADDRLP4 612
+CNSTF4 0
+ASGNF4
+LABELV $610
+ADDRLP4 612
+INDIRF4
+CNSTF4 0
+LEF4 $612
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRGP4 $615
+ARGP4
+ADDRLP4 612
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $612
+ADDRGP4 cg+109048
+ADDRGP4 cg+109048
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109048+4
+ADDRGP4 cg+109048+4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109048+8
+ADDRGP4 cg+109048+8
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 612
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+109048+8
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109048+4
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109048
+ADDRLP4 612
+INDIRF4
+ASGNF4
+LABELV $604
+ADDRGP4 cg+109048
+ADDRLP4 568
+INDIRF4
+ADDRGP4 cg+109048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109048+4
+ADDRLP4 568+4
+INDIRF4
+ADDRGP4 cg+109048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109048+8
+ADDRLP4 568+8
+INDIRF4
+ADDRGP4 cg+109048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109044
+ADDRGP4 cg+107608
+INDIRI4
+ASGNI4
+LABELV $597
+LABELV $561
+LABELV $557
+ADDRGP4 cg_pmove+40
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_pmove+216
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRGP4 cg_pmove+4
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $646
+ADDRGP4 cg_optimizePrediction+12
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRLP4 0
+INDIRI4
+ADDRLP4 512
+INDIRI4
+GEI4 $660
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ADDRGP4 cg+156484
+INDIRI4
+NEI4 $657
+LABELV $660
+ADDRGP4 cg_pmove
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRLP4 508
+ADDRLP4 508
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+125588
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ADDRGP4 cg+156484
+INDIRI4
+EQI4 $655
+CNSTI4 468
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+125596
+ADDP4
+ADDRGP4 cg_pmove
+INDIRP4
+INDIRB
+ASGNB 468
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+ADDRGP4 cg+156488
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $657
+ADDRLP4 516
+ADDRLP4 516
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $667
+CNSTI4 468
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+125596
+ADDP4
+INDIRI4
+ADDRGP4 cg_pmove+4
+INDIRI4
+EQI4 $667
+ADDRGP4 $672
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $667
+ADDRGP4 cg_pmove
+INDIRP4
+CNSTI4 468
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+125596
+ADDP4
+INDIRB
+ASGNB 468
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRGP4 cg_pmove
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRLP4 508
+ADDRLP4 508
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 480
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_TouchTriggerPrediction
+CALLV
+pop
+LABELV $542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $544
+ADDRLP4 0
+INDIRI4
+ADDRLP4 476
+INDIRI4
+LEI4 $541
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 1
+LEI4 $674
+ADDRGP4 $677
+ARGP4
+ADDRGP4 cg_pmove+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $674
+ADDRLP4 480
+INDIRI4
+CNSTI4 0
+NEI4 $680
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRGP4 $685
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $680
+ADDRGP4 cg+107636+20
+ARGP4
+ADDRGP4 cg+107636+68
+INDIRI4
+ARGI4
+ADDRGP4 cg+107612
+INDIRI4
+ARGI4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRGP4 cg+107636+20
+ARGP4
+ADDRGP4 cg+107636+152
+ARGP4
+ADDRGP4 cg+107636+152
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRGP4 cg+107636+108
+INDIRI4
+ADDRLP4 8+108
+INDIRI4
+CNSTI4 2
+ADDI4
+LEI4 $701
+ADDRGP4 $706
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $701
+LABELV $698
+ADDRGP4 cg+107636
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_TransitionPlayerState
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $708
+ADDRGP4 cg+109060
+INDIRI4
+ADDRGP4 cg+107636+108
+INDIRI4
+LEI4 $711
+ADDRGP4 $716
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg+109060
+ADDRGP4 cg+107636+108
+INDIRI4
+ASGNI4
+LABELV $711
+LABELV $708
+LABELV $422
+endproc CG_PredictPlayerState 620 28
+bss
+align 4
+LABELV cg_triggerEntities
+skip 1024
+align 4
+LABELV cg_numTriggerEntities
+skip 4
+align 4
+LABELV cg_solidEntities
+skip 1024
+align 4
+LABELV cg_numSolidEntities
+skip 4
+align 4
+LABELV cg_pmove
+skip 240
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $716
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $706
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $685
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $677
+byte 1 91
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 93
+byte 1 32
+byte 1 0
+align 1
+LABELV $672
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $615
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $602
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $587
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $571
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $528
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $486
+byte 1 51
+byte 1 51
+byte 1 0
+align 1
+LABELV $482
+byte 1 56
+byte 1 0
+align 1
+LABELV $481
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $464
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $329
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 32
+byte 1 0
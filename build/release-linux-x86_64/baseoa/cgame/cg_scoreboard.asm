@@ -0,0 +1,3481 @@
+code
+proc CG_DrawClientScore 1084 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+LTI4 $78
+ADDRLP4 1048
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $75
+LABELV $78
+ADDRGP4 $79
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 1040
+CNSTI4 80
+ASGNI4
+ADDRLP4 1044
+CNSTI4 112
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $81
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $83
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $83
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $85
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $87
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $86
+JUMPV
+LABELV $87
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $89
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $91
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $91
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+LEI4 $93
+ADDRLP4 1052
+INDIRI4
+CNSTI4 5
+GTI4 $93
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $98
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+500-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $94
+JUMPV
+LABELV $98
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+500-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $106
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $109
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $110
+LABELV $106
+LABELV $94
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $112
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $116
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $116
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $117
+LABELV $112
+LABELV $90
+LABELV $86
+LABELV $82
+ADDRLP4 1052
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1127481344
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $121
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $122
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $123
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $126
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $128
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 1060
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $127
+LABELV $124
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $130
+ADDRGP4 localClient
+CNSTI4 1
+ASGNI4
+ADDRLP4 1076
+CNSTI4 3
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $138
+ADDRGP4 cgs+31456
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+LTI4 $133
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $133
+LABELV $138
+ADDRLP4 1072
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 1072
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+LABELV $134
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRLP4 1080
+CNSTF4 0
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+4
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 1072
+INDIRI4
+CNSTI4 1
+NEI4 $144
+ADDRLP4 1056
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1056+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 1072
+INDIRI4
+CNSTI4 2
+NEI4 $148
+ADDRLP4 1080
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+4
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 1080
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+4
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 1060320051
+ASGNF4
+LABELV $149
+LABELV $145
+LABELV $141
+ADDRLP4 1056+12
+CNSTF4 1060320051
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1127219200
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1140850688
+ARGF4
+CNSTF4 1099431936
+ARGF4
+ADDRLP4 1056
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $130
+CNSTI4 160
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $159
+ADDRGP4 $162
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2100
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 50
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 0
+INDIRP4
+CNSTI4 2100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRLP4 1040
+INDIRI4
+CNSTI4 60
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $163
+LABELV $160
+LABELV $156
+LABELV $74
+endproc CG_DrawClientScore 1084 28
+proc CG_TeamScoreboard 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $170
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 2120
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+EQI4 $177
+ADDRGP4 $171
+JUMPV
+LABELV $177
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 40
+NEI4 $180
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawClientScore
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $171
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $173
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+GEI4 $182
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $170
+LABELV $182
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $166
+endproc CG_TeamScoreboard 48 20
+export CG_DrawOldScoreboard
+proc CG_DrawOldScoreboard 76 24
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $183
+JUMPV
+LABELV $184
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $188
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $188
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $183
+JUMPV
+LABELV $188
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+125248
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $194
+ADDRGP4 cg+114784
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $194
+CNSTI4 0
+RETI4
+ADDRGP4 $183
+JUMPV
+LABELV $194
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+NEI4 $206
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 3
+EQI4 $206
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $198
+LABELV $206
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRGP4 colorWhite
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRGP4 cg+114792
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $208
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114924
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $183
+JUMPV
+LABELV $208
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $199
+ADDRGP4 cg+114924
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $212
+ADDRGP4 $215
+ARGP4
+ADDRGP4 cg+114924
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 640
+ADDRLP4 40
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 40
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $212
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $221
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $217
+LABELV $221
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $218
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 640
+ADDRLP4 40
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRGP4 cg+110680
+INDIRI4
+ADDRGP4 cg+110680+4
+INDIRI4
+NEI4 $228
+ADDRGP4 $233
+ARGP4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRGP4 cg+110680
+INDIRI4
+ADDRGP4 cg+110680+4
+INDIRI4
+LTI4 $235
+ADDRGP4 $240
+ARGP4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRGP4 cg+110680+4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRGP4 $244
+ARGP4
+ADDRGP4 cg+110680+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $236
+LABELV $229
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 56
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 640
+ADDRLP4 40
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $218
+ADDRLP4 4
+CNSTI4 86
+ASGNI4
+CNSTF4 1127219200
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+180272+712
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1132724224
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+180272+708
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1135345664
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+180272+716
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1137704960
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+180272+704
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 118
+ASGNI4
+ADDRGP4 cg+110672
+INDIRI4
+CNSTI4 7
+LEI4 $256
+ADDRLP4 24
+CNSTI4 17
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 24
+CNSTI4 7
+ASGNI4
+ADDRLP4 8
+CNSTI4 40
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $257
+ADDRGP4 localClient
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $259
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $259
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+110680
+INDIRI4
+ADDRGP4 cg+110680+4
+INDIRI4
+LTI4 $263
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $264
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+LABELV $260
+ADDRGP4 localClient
+INDIRI4
+CNSTI4 0
+NEI4 $268
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $270
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $275
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 40
+NEI4 $281
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $282
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawClientScore
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $275
+LABELV $271
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $273
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $270
+LABELV $272
+LABELV $268
+ADDRLP4 56
+ADDRGP4 cg+16
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LEI4 $283
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $283
+CNSTI4 1
+RETI4
+LABELV $183
+endproc CG_DrawOldScoreboard 76 24
+proc CG_CenterGiantLine 32 36
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 24
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $286
+endproc CG_CenterGiantLine 32 36
+export CG_DrawOldTourneyScoreboard
+proc CG_DrawOldTourneyScoreboard 112 36
+ADDRGP4 cg+110668
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $291
+ADDRGP4 cg+110668
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $297
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $291
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $304
+ADDRLP4 4
+ADDRGP4 $306
+ASGNP4
+LABELV $304
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CenterGiantLine
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 64
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 10
+ASGNI4
+ADDRLP4 40
+ADDRLP4 32
+INDIRI4
+ADDRLP4 72
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 72
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+CNSTF4 1115684864
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CenterGiantLine
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 160
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $309
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $309
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 $313
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $108
+ARGP4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+CNSTI4 632
+ADDRLP4 88
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $108
+ARGP4
+ADDRGP4 cg+110680+4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+CNSTI4 632
+ADDRLP4 104
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $318
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $323
+ADDRGP4 $319
+JUMPV
+LABELV $323
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $325
+ADDRGP4 $319
+JUMPV
+LABELV $325
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+CNSTI4 632
+ADDRLP4 88
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+LABELV $319
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+LTI4 $318
+LABELV $310
+LABELV $290
+endproc CG_DrawOldTourneyScoreboard 112 36
+bss
+align 4
+LABELV localClient
+skip 4
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $315
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $313
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $308
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $306
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $297
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $244
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $240
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $233
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $225
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $215
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $165
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $162
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 42
+byte 1 0
+align 1
+LABELV $158
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 89
+byte 1 0
+align 1
+LABELV $129
+byte 1 37
+byte 1 53
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $128
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $125
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $115
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $79
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
@@ -0,0 +1,7910 @@
+code
+proc CG_ParseScores 240 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110672
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110672
+INDIRI4
+CNSTI4 64
+LEI4 $77
+ADDRGP4 cg+110672
+CNSTI4 64
+ASGNI4
+LABELV $77
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110680
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110680+4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $89
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $85
+LABELV $89
+ADDRGP4 cgs+34984
+ADDRGP4 cg+110680
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRGP4 cg+110680+4
+INDIRI4
+ASGNI4
+LABELV $85
+ADDRGP4 cg+110688
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $100
+JUMPV
+LABELV $97
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+8
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+12
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+16
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+24
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+28
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+32
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+36
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+40
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+44
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+52
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+48
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 15
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ADDRLP4 208
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+60
+ADDP4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $133
+ADDRLP4 224
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $129
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRLP4 228
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+100
+ADDP4
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+110688+4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+140
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 232
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+2100
+ADDP4
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+110688+60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRGP4 cg+110688+56
+ADDP4
+CNSTI4 2120
+ADDRLP4 236
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $98
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $100
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $97
+LABELV $75
+endproc CG_ParseScores 240 12
+proc CG_ParseAccuracy 32 4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $154
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+CNSTI4 4
+SUBI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+114796-16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+114796-16+4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $154
+LABELV $153
+endproc CG_ParseAccuracy 32 4
+proc CG_ParseElimination 16 4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $168
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $164
+LABELV $168
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34984
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $164
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $163
+endproc CG_ParseElimination 16 4
+proc CG_ParseMappage 1060 12
+CNSTI4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $173
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+CNSTI4 10
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+EQI4 $172
+ADDRLP4 1040
+INDIRI4
+CNSTI4 13
+EQI4 $172
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $177
+LABELV $181
+ADDRLP4 1040
+INDIRI4
+CNSTI4 59
+EQI4 $172
+ADDRGP4 $177
+JUMPV
+LABELV $177
+LABELV $174
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $176
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $173
+ADDRGP4 $182
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $183
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $190
+JUMPV
+LABELV $187
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+CNSTI4 10
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+EQI4 $172
+ADDRLP4 1048
+INDIRI4
+CNSTI4 13
+EQI4 $172
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LTI4 $191
+LABELV $195
+ADDRLP4 1048
+INDIRI4
+CNSTI4 59
+EQI4 $172
+ADDRGP4 $191
+JUMPV
+LABELV $191
+LABELV $188
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $190
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $187
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 1
+GEI4 $196
+ADDRLP4 4
+ADDRGP4 $198
+ASGNP4
+LABELV $196
+ADDRGP4 $199
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $184
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+LTI4 $183
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $172
+endproc CG_ParseMappage 1060 12
+proc CG_ParseDDtimetaken 8 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34832
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $200
+endproc CG_ParseDDtimetaken 8 4
+proc CG_ParseDomPointNames 24 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34836
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34836
+INDIRI4
+CNSTI4 6
+LTI4 $204
+ADDRGP4 cgs+34836
+CNSTI4 6
+ASGNI4
+LABELV $204
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $208
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ARGP4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 19
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $215
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $217
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+GEI4 $220
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $214
+LABELV $220
+LABELV $209
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $211
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+34836
+INDIRI4
+LTI4 $208
+LABELV $202
+endproc CG_ParseDomPointNames 24 12
+proc CG_ParseDomStatus 28 4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34836
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $222
+ADDRGP4 cgs+34836
+CNSTI4 0
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $222
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cgs+34960
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+34836
+INDIRI4
+LTI4 $226
+LABELV $221
+endproc CG_ParseDomStatus 28 4
+proc CG_ParseChallenge 8 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 addChallenge
+CALLV
+pop
+LABELV $232
+endproc CG_ParseChallenge 8 4
+proc CG_ParseObeliskHealth 16 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+156496
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+156500
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $233
+endproc CG_ParseObeliskHealth 16 4
+proc CG_ParseRespawnTime 8 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+156492
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $236
+endproc CG_ParseRespawnTime 8 4
+proc CG_ParseTeam 4 8
+ADDRGP4 cg_voip_teamonly+12
+INDIRI4
+CNSTI4 0
+EQI4 $239
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $239
+LABELV $238
+endproc CG_ParseTeam 4 8
+proc CG_ParseAttackingTeam 12 4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $244
+ADDRGP4 cgs+34820
+CNSTI4 1
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $247
+ADDRGP4 cgs+34820
+CNSTI4 2
+ASGNI4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRGP4 cgs+34820
+CNSTI4 3
+ASGNI4
+LABELV $248
+LABELV $245
+LABELV $243
+endproc CG_ParseAttackingTeam 12 4
+proc CG_ParseTeamInfo 76 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $254
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+LEI4 $252
+LABELV $254
+ADDRGP4 $255
+ARGP4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $256
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $260
+LABELV $262
+ADDRGP4 $263
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $260
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+104
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+108
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+112
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 6
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+116
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+140
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $257
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $259
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $256
+LABELV $251
+endproc CG_ParseTeamInfo 76 8
+export CG_ParseServerinfo
+proc CG_ParseServerinfo 164 16
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31456
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34808
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+EQI4 $282
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $278
+LABELV $282
+ADDRGP4 cgs+34808
+CNSTI4 1
+ASGNI4
+LABELV $278
+ADDRGP4 $284
+ARGP4
+ADDRGP4 cgs+31456
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31460
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31464
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31468
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $293
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31472
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31476
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $297
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31480
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31484
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31488
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $303
+ARGP4
+ADDRLP4 88
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34816
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 96
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34828
+ADDRLP4 100
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 120
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34824
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+181716
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $312
+ARGP4
+ADDRLP4 136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31492
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $317
+ARGP4
+ADDRLP4 140
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31556
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $317
+ARGP4
+ADDRGP4 cgs+31556
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31620
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $321
+ARGP4
+ADDRGP4 cgs+31620
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+181712
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+ARGP4
+ADDRGP4 cgs+181712
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 160
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $274
+endproc CG_ParseServerinfo 164 16
+proc CG_ParseWarmup 24 8
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125252
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $331
+ADDRGP4 cg+125248
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $331
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $334
+ADDRGP4 cg+125248
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $334
+ADDRGP4 cgs+180272+1372
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $334
+LABELV $332
+ADDRGP4 cg+125248
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $329
+endproc CG_ParseWarmup 24 8
+export CG_SetConfigValues
+proc CG_SetConfigValues 36 4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34984
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $350
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $350
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $344
+LABELV $350
+CNSTI4 23
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+34992
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34996
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $357
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $353
+LABELV $357
+CNSTI4 23
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+35000
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $353
+LABELV $345
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+125248
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $340
+endproc CG_SetConfigValues 36 4
+export CG_ShaderStateChanged
+proc CG_ShaderStateChanged 188 12
+CNSTI4 24
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $363
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $363
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 172
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $363
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $363
+ADDRLP4 76
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $369
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 180
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $366
+ADDRLP4 140
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 140
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $366
+LABELV $362
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $373
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $361
+LABELV $373
+LABELV $363
+LABELV $360
+endproc CG_ShaderStateChanged 188 12
+proc CG_ConfigStringModified 48 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $375
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $377
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $379
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $381
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34984
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $384
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 0
+INDIRI4
+CNSTI4 21
+NEI4 $387
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $390
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31684
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31696
+CNSTI4 1
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $394
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31688
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31696
+CNSTI4 1
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $398
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31692
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31696
+CNSTI4 1
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $402
+ADDRGP4 cgs+31700
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $406
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $406
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724-48
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748-48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $412
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $412
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32732-64
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748-64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $418
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $418
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740-72
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748-72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+GTI4 $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32756-14336
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+NEI4 $429
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+GEI4 $432
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35008-128
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+LTI4 $436
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+GEI4 $436
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $437
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032-1152
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+LTI4 $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+GEI4 $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+SUBI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+NEI4 $444
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $452
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $452
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $446
+LABELV $452
+ADDRGP4 cgs+34992
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34996
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $446
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $459
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $445
+LABELV $459
+ADDRGP4 cgs+35000
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+NEI4 $461
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+LABELV $461
+LABELV $445
+LABELV $443
+LABELV $437
+LABELV $433
+LABELV $430
+LABELV $425
+LABELV $419
+LABELV $413
+LABELV $407
+LABELV $403
+LABELV $399
+LABELV $395
+LABELV $391
+LABELV $388
+LABELV $385
+LABELV $382
+LABELV $380
+LABELV $378
+LABELV $376
+LABELV $374
+endproc CG_ConfigStringModified 48 12
+proc CG_AddToTeamChat 56 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $464
+ADDRLP4 12
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+LABELV $465
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $471
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $468
+LABELV $471
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+178800
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+178796
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $468
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+176836
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 55
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 4
+INDIRI4
+CNSTI4 79
+LEI4 $479
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $481
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $481
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+178764
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+178796
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+176836
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $489
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $489
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $489
+ADDRLP4 28
+INDIRI4
+CNSTI4 56
+GTI4 $489
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 48
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $477
+JUMPV
+LABELV $489
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $491
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $491
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $477
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $476
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+178764
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+178796
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRGP4 cgs+178800
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+LEI4 $497
+ADDRGP4 cgs+178800
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $497
+LABELV $463
+endproc CG_AddToTeamChat 56 0
+proc CG_MapRestart 0 12
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRGP4 $507
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $504
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+107620
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107616
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31684
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107624
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 cg+125248
+INDIRI4
+CNSTI4 0
+NEI4 $513
+ADDRGP4 cgs+180272+1368
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $518
+ARGP4
+CNSTI4 120
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $513
+ADDRGP4 $519
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $503
+endproc CG_MapRestart 0 12
+export CG_ParseVoiceChats
+proc CG_ParseVoiceChats 16508 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $522
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16420
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 16420
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $525
+ADDRGP4 $527
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16424
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $525
+ADDRLP4 24
+INDIRI4
+CNSTI4 16384
+LTI4 $528
+ADDRGP4 $530
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16424
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $528
+ADDRLP4 32
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 16416
+ADDRLP4 32
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16416
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $535
+JUMPV
+LABELV $532
+CNSTI4 4420
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $533
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $535
+ADDRLP4 20
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $532
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16424
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16424
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $538
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $536
+LABELV $538
+CNSTI4 1
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $536
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 16432
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16432
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $544
+ARGP4
+ADDRLP4 16436
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16436
+INDIRI4
+CNSTI4 0
+NEI4 $542
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+ADDRLP4 16440
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16440
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRGP4 $548
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16444
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16444
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $546
+LABELV $543
+LABELV $540
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16444
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16444
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $554
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $552
+LABELV $554
+CNSTI4 1
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $552
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16452
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16452
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRLP4 16456
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16456
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRGP4 $558
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16460
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16460
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $555
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16460
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16460
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $564
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $562
+LABELV $564
+CNSTI4 1
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $562
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 16468
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16468
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRGP4 $561
+JUMPV
+LABELV $565
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16472
+INDIRI4
+ASGNI4
+ADDRLP4 16476
+CNSTI4 68
+ASGNI4
+ADDRLP4 16480
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16476
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16480
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16480
+INDIRP4
+ADDRLP4 16476
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16484
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16484
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $570
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $568
+LABELV $570
+CNSTI4 1
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $568
+ADDRLP4 16492
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16496
+CNSTI4 64
+ASGNI4
+ADDRLP4 16492
+INDIRP4
+ADDRLP4 16496
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRLP4 16492
+INDIRP4
+CNSTI4 324
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 16496
+INDIRI4
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRLP4 16500
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 16500
+INDIRP4
+ADDRLP4 16500
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $571
+ADDRLP4 16504
+CNSTI4 64
+ASGNI4
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 16504
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16504
+INDIRI4
+LTI4 $573
+ADDRGP4 $561
+JUMPV
+LABELV $573
+LABELV $560
+ADDRGP4 $559
+JUMPV
+LABELV $561
+ADDRLP4 16460
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16460
+INDIRP4
+ADDRLP4 16460
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $575
+CNSTI4 1
+RETI4
+ADDRGP4 $521
+JUMPV
+LABELV $575
+LABELV $550
+ADDRGP4 $549
+JUMPV
+CNSTI4 1
+RETI4
+LABELV $521
+endproc CG_ParseVoiceChats 16508 16
+export CG_LoadVoiceChats
+proc CG_LoadVoiceChats 12 12
+ADDRLP4 4
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 voiceChatLists
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $579
+ARGP4
+ADDRGP4 voiceChatLists+282952
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $581
+ARGP4
+ADDRGP4 voiceChatLists+565904
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $583
+ARGP4
+ADDRGP4 voiceChatLists+848856
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $585
+ARGP4
+ADDRGP4 voiceChatLists+1131808
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $587
+ARGP4
+ADDRGP4 voiceChatLists+1414760
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $589
+ARGP4
+ADDRGP4 voiceChatLists+1697712
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $591
+ARGP4
+ADDRGP4 voiceChatLists+1980664
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRLP4 8
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $577
+endproc CG_LoadVoiceChats 12 12
+export CG_HeadModelVoiceChats
+proc CG_HeadModelVoiceChats 16424 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16408
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16408
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $595
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $595
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+LTI4 $597
+ADDRGP4 $530
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16412
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $597
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 16404
+ADDRLP4 16
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16404
+ASGNP4
+ADDRLP4 16400
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16412
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $601
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $599
+LABELV $601
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $599
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $602
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+ARGP4
+ADDRLP4 16420
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16420
+INDIRI4
+CNSTI4 0
+NEI4 $606
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $606
+LABELV $603
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $602
+CNSTI4 -1
+RETI4
+LABELV $594
+endproc CG_HeadModelVoiceChats 16424 16
+export CG_GetVoiceChat
+proc CG_GetVoiceChat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $612
+JUMPV
+LABELV $609
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $613
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+CNSTI4 324
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $608
+JUMPV
+LABELV $613
+LABELV $610
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $612
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $609
+CNSTI4 0
+RETI4
+LABELV $608
+endproc CG_GetVoiceChat 20 8
+export CG_VoiceChatListForClient
+proc CG_VoiceChatListForClient 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $618
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $616
+LABELV $618
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $616
+ADDRLP4 148
+CNSTI4 2120
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $620
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $624
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $626
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 289
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $625
+JUMPV
+LABELV $626
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $629
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 289
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $630
+LABELV $625
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $631
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $635
+ADDRGP4 $633
+JUMPV
+LABELV $635
+LABELV $632
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $631
+LABELV $633
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $637
+CNSTI4 282952
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $615
+JUMPV
+LABELV $637
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $640
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $644
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $646
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 76
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_HeadModelVoiceChats
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 -1
+NEI4 $647
+ADDRGP4 $642
+JUMPV
+LABELV $647
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 282952
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $615
+JUMPV
+LABELV $644
+LABELV $641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $640
+LABELV $642
+LABELV $621
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LTI4 $620
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $651
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $655
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $659
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists+64
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $661
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $664
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $668
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $668
+LABELV $665
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $664
+LABELV $666
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $615
+JUMPV
+LABELV $661
+LABELV $659
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $655
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $671
+ADDRGP4 $653
+JUMPV
+LABELV $671
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $652
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LTI4 $651
+LABELV $653
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $673
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $677
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $677
+LABELV $674
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $673
+LABELV $675
+ADDRGP4 voiceChatLists
+RETP4
+LABELV $615
+endproc CG_VoiceChatListForClient 164 20
+export CG_PlayVoiceChat
+proc CG_PlayVoiceChat 0 0
+LABELV $680
+endproc CG_PlayVoiceChat 0 0
+export CG_PlayBufferedVoiceChats
+proc CG_PlayBufferedVoiceChats 0 0
+LABELV $681
+endproc CG_PlayBufferedVoiceChats 0 0
+export CG_AddBufferedVoiceChat
+proc CG_AddBufferedVoiceChat 0 0
+LABELV $682
+endproc CG_AddBufferedVoiceChat 0 0
+export CG_VoiceChatLocal
+proc CG_VoiceChatLocal 0 0
+LABELV $683
+endproc CG_VoiceChatLocal 0 0
+export CG_VoiceChat
+proc CG_VoiceChat 0 0
+LABELV $684
+endproc CG_VoiceChat 0 0
+proc CG_RemoveChatEscapeChar 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 25
+NEI4 $690
+ADDRGP4 $687
+JUMPV
+LABELV $690
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $687
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $686
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $685
+endproc CG_RemoveChatEscapeChar 20 0
+proc CG_ServerCommand 1296 12
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $693
+ADDRGP4 $692
+JUMPV
+LABELV $693
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRLP4 160
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $695
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $695
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 164
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $698
+ADDRGP4 CG_ConfigStringModified
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $698
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 168
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $701
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $701
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $706
+ARGP4
+ADDRLP4 172
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $704
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+CNSTI4 0
+NEI4 $692
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $710
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $710
+CNSTI4 1
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRGP4 $715
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $704
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $718
+ARGP4
+ADDRLP4 176
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $716
+ADDRGP4 cg_teamChatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $719
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $719
+CNSTI4 1
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $715
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $716
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $726
+ARGP4
+ADDRLP4 180
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $724
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $724
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $729
+ARGP4
+ADDRLP4 184
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $727
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $727
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 188
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $730
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $730
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $735
+ARGP4
+ADDRLP4 192
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $733
+ADDRGP4 CG_ParseScores
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $733
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $738
+ARGP4
+ADDRLP4 196
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $736
+ADDRGP4 CG_ParseAccuracy
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $736
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $741
+ARGP4
+ADDRLP4 200
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $739
+ADDRGP4 CG_ParseDDtimetaken
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $739
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $744
+ARGP4
+ADDRLP4 204
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $742
+ADDRGP4 CG_ParseDomPointNames
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $742
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $747
+ARGP4
+ADDRLP4 208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $745
+ADDRGP4 CG_ParseDomStatus
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $745
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $750
+ARGP4
+ADDRLP4 212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $748
+ADDRGP4 CG_ParseElimination
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $748
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRGP4 CG_ParseMappage
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $751
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $756
+ARGP4
+ADDRLP4 220
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $754
+ADDRGP4 CG_ParseAttackingTeam
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $754
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $759
+ARGP4
+ADDRLP4 224
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $757
+ADDRGP4 CG_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $757
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $762
+ARGP4
+ADDRLP4 228
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $760
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $760
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $765
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $763
+ADDRLP4 236
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 4
+NEI4 $692
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 240
+ARGP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 440
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 368
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 240
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $763
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $770
+ARGP4
+ADDRLP4 236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $768
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $768
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $773
+ARGP4
+ADDRLP4 240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $771
+ADDRGP4 cg+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $692
+JUMPV
+LABELV $771
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $777
+ARGP4
+ADDRLP4 244
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $775
+ADDRGP4 CG_ParseChallenge
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $775
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $780
+ARGP4
+ADDRLP4 248
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $778
+ADDRGP4 CG_ParseObeliskHealth
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $778
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $783
+ARGP4
+ADDRLP4 252
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $781
+ADDRGP4 CG_ParseRespawnTime
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $781
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $786
+ARGP4
+ADDRLP4 256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRGP4 CG_ParseTeam
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $784
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $789
+ARGP4
+ADDRLP4 260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $787
+ADDRLP4 264
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1024
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1288
+CNSTI4 1
+ASGNI4
+LABELV $790
+ADDRLP4 1288
+INDIRI4
+ARGI4
+ADDRLP4 1292
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1292
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 264
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $794
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $791
+ADDRLP4 1288
+ADDRLP4 1288
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+CNSTI4 12
+LEI4 $790
+ADDRGP4 $795
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $692
+JUMPV
+LABELV $787
+ADDRGP4 $796
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $692
+endproc CG_ServerCommand 1296 12
+export CG_ExecuteNewServerCommands
+proc CG_ExecuteNewServerCommands 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $799
+JUMPV
+LABELV $798
+ADDRLP4 0
+ADDRGP4 cgs+31444
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_GetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRGP4 CG_ServerCommand
+CALLV
+pop
+LABELV $802
+LABELV $799
+ADDRGP4 cgs+31444
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $798
+LABELV $797
+endproc CG_ExecuteNewServerCommands 12 4
+bss
+export voiceChatBuffer
+align 4
+LABELV voiceChatBuffer
+skip 9984
+export headModelVoiceChat
+align 4
+LABELV headModelVoiceChat
+skip 4352
+export voiceChatLists
+align 4
+LABELV voiceChatLists
+skip 2263616
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $796
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $795
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $794
+byte 1 32
+byte 1 0
+align 1
+LABELV $789
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $786
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $783
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $780
+byte 1 111
+byte 1 104
+byte 1 0
+align 1
+LABELV $777
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $773
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $770
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $765
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $762
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $759
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $756
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $753
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $750
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $747
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $744
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $741
+byte 1 100
+byte 1 100
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $738
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $735
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $732
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $729
+byte 1 118
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $726
+byte 1 118
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $718
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $715
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $706
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $703
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $700
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $697
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $646
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 118
+byte 1 99
+byte 1 0
+align 1
+LABELV $628
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $593
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $591
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 53
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $589
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 52
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $587
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $585
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $583
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $581
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $579
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $578
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $567
+byte 1 125
+byte 1 0
+align 1
+LABELV $558
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $557
+byte 1 123
+byte 1 0
+align 1
+LABELV $548
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $547
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $544
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $541
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $531
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $530
+byte 1 94
+byte 1 49
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $527
+byte 1 94
+byte 1 49
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $520
+byte 1 48
+byte 1 0
+align 1
+LABELV $519
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $518
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 33
+byte 1 0
+align 1
+LABELV $507
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $370
+byte 1 64
+byte 1 0
+align 1
+LABELV $367
+byte 1 58
+byte 1 0
+align 1
+LABELV $364
+byte 1 61
+byte 1 0
+align 1
+LABELV $328
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $327
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $325
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $321
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $317
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $315
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $312
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $311
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $309
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $307
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $306
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $305
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $303
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $301
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $299
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $297
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $295
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $293
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $291
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $289
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $287
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $284
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $276
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $263
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $255
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $242
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $199
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $198
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $182
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
@@ -0,0 +1,4310 @@
+export CG_TestModel_f
+code
+proc CG_TestModel_f 36 12
+ADDRGP4 cg+125584
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+125380
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $78
+ADDRGP4 $74
+JUMPV
+LABELV $78
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+125520
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+125520
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+125380+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+NEI4 $84
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+125380+100
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125380+80
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+125380+96
+CNSTI4 0
+ASGNI4
+LABELV $84
+ADDRGP4 cg+125380+8
+INDIRI4
+CNSTI4 0
+NEI4 $92
+ADDRGP4 $96
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $74
+JUMPV
+LABELV $92
+ADDRGP4 cg+125380+68
+ADDRGP4 cg+109252+24
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+109252+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+125380+68+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+109252+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+125380+68+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+109252+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+109620+4
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+125380+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $74
+endproc CG_TestModel_f 36 12
+export CG_TestGun_f
+proc CG_TestGun_f 0 0
+ADDRGP4 CG_TestModel_f
+CALLV
+pop
+ADDRGP4 cg+125380+8
+INDIRI4
+CNSTI4 0
+NEI4 $128
+ADDRGP4 $127
+JUMPV
+LABELV $128
+ADDRGP4 cg+125584
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+125380+4
+CNSTI4 13
+ASGNI4
+LABELV $127
+endproc CG_TestGun_f 0 0
+export CG_TestModelNextFrame_f
+proc CG_TestModelNextFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+125380+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $138
+ARGP4
+ADDRGP4 cg+125380+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $135
+endproc CG_TestModelNextFrame_f 4 8
+export CG_TestModelPrevFrame_f
+proc CG_TestModelPrevFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+125380+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+125380+80
+INDIRI4
+CNSTI4 0
+GEI4 $144
+ADDRGP4 cg+125380+80
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRGP4 $138
+ARGP4
+ADDRGP4 cg+125380+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $141
+endproc CG_TestModelPrevFrame_f 4 8
+export CG_TestModelNextSkin_f
+proc CG_TestModelNextSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+125380+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $155
+ARGP4
+ADDRGP4 cg+125380+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $152
+endproc CG_TestModelNextSkin_f 4 8
+export CG_TestModelPrevSkin_f
+proc CG_TestModelPrevSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+125380+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+125380+104
+INDIRI4
+CNSTI4 0
+GEI4 $161
+ADDRGP4 cg+125380+104
+CNSTI4 0
+ASGNI4
+LABELV $161
+ADDRGP4 $155
+ARGP4
+ADDRGP4 cg+125380+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $158
+endproc CG_TestModelPrevSkin_f 4 8
+proc CG_AddTestModel 32 4
+ADDRGP4 cg+125520
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+125380+8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125380+8
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRGP4 $96
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $169
+JUMPV
+LABELV $173
+ADDRGP4 cg+125584
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRGP4 cg+125380+68
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125380+28
+ADDRGP4 cg+109252+36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125380+28+12
+ADDRGP4 cg+109252+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125380+28+24
+ADDRGP4 cg+109252+36+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $200
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+125380+68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+109252+36
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+125380+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+109252+36+12
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+125380+68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+109252+36+24
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $201
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $200
+LABELV $177
+ADDRGP4 cg+125380
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $169
+endproc CG_AddTestModel 32 4
+proc CG_CalcVrect 12 8
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $223
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 30
+GEI4 $226
+ADDRGP4 $229
+ARGP4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 120
+LEI4 $231
+ADDRGP4 $229
+ARGP4
+ADDRGP4 $234
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 120
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 0
+ADDRGP4 cg_viewsize+12
+INDIRI4
+ASGNI4
+LABELV $232
+LABELV $227
+LABELV $224
+ADDRGP4 cg+109252+8
+ADDRGP4 cgs+20100+11304
+INDIRU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+MULU4
+CNSTU4 100
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+109252+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+109252+12
+ADDRGP4 cgs+20100+11308
+INDIRU4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+MULU4
+CNSTU4 100
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+109252+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+109252
+ADDRGP4 cgs+20100+11304
+INDIRU4
+ADDRGP4 cg+109252+8
+INDIRI4
+CVIU4 4
+SUBU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 cg+109252+4
+ADDRGP4 cgs+20100+11308
+INDIRU4
+ADDRGP4 cg+109252+12
+INDIRI4
+CVIU4 4
+SUBU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+ASGNI4
+LABELV $222
+endproc CG_CalcVrect 12 8
+proc CG_OffsetThirdPersonView 172 16
+ADDRLP4 36
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 cg+109252+24+8
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRGP4 cg+107636+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 cg+109620
+INDIRB
+ASGNB 12
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $267
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $267
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $267
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+EQI4 $267
+ADDRLP4 60+4
+ADDRGP4 cg+107636+184+16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+109620+4
+ADDRGP4 cg+107636+184+16
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $267
+ADDRGP4 cg_deathcam+12
+INDIRI4
+CNSTI4 2
+NEI4 $283
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $283
+ADDRLP4 36
+CNSTF4 1120403456
+ASGNF4
+LABELV $283
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameramode+12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $288
+ADDRGP4 cg+107636+184
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LEI4 $288
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 100
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+109252+24
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 cg+109620
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 108
+CNSTP4 0
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 112
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+109252+24
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109620
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 116
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 116
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+ADDRLP4 120
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 120
+INDIRF4
+CNSTF4 1055790203
+SUBF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 56
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109252+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1065353216
+GEF4 $352
+ADDRLP4 72
+CNSTF4 1065353216
+ASGNF4
+LABELV $352
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+109620
+CNSTF4 3261411041
+ADDRLP4 140
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ADDRGP4 cg+109252+24+8
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRGP4 cg+109620
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg+109252+24
+ADDRGP4 cg+109252+24
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 144+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24
+ADDRGP4 cg+109252+24
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 156+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 156+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 60
+INDIRF4
+CNSTF4 1110704128
+LEF4 $396
+ADDRLP4 60
+CNSTF4 1110704128
+ASGNF4
+LABELV $396
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 100
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+109252+24
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 cg+109620
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109620
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 108
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 108
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 52
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 56
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109252+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109252+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1065353216
+GEF4 $445
+ADDRLP4 72
+CNSTF4 1065353216
+ASGNF4
+LABELV $445
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+109620
+CNSTF4 3261411041
+ADDRLP4 132
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 cg+109620+4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $289
+LABELV $259
+endproc CG_OffsetThirdPersonView 172 16
+proc CG_StepOffset 8 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109132
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+GEI4 $455
+ADDRLP4 4
+ADDRGP4 cg+109252+24+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+109128
+INDIRF4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+LABELV $455
+LABELV $452
+endproc CG_StepOffset 8 0
+proc CG_OffsetFirstPersonView 80 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $462
+ADDRGP4 $461
+JUMPV
+LABELV $462
+ADDRLP4 8
+ADDRGP4 cg+109252+24
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+109620
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $468
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cg+107636+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $461
+JUMPV
+LABELV $468
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125336
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125336+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125336+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+125280
+INDIRF4
+CNSTF4 0
+EQF4 $479
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $479
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $479
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+EQI4 $479
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125280
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+GEF4 $487
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+125328
+INDIRF4
+MULF4
+ADDRGP4 cg_kickScale+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+125332
+INDIRF4
+MULF4
+ADDRGP4 cg_kickScale+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 24
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+LEF4 $493
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+125328
+INDIRF4
+MULF4
+ADDRGP4 cg_kickScale+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+125332
+INDIRF4
+MULF4
+ADDRGP4 cg_kickScale+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $493
+LABELV $488
+LABELV $479
+ADDRLP4 12
+ADDRGP4 cg+107636+32
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109252+36
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109252+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109252+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg_runpitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 cg_runroll+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_bob+12
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRGP4 cg+125368
+INDIRF4
+CNSTF4 1128792064
+LEF4 $532
+ADDRLP4 64
+ADDRGP4 cg+125368
+INDIRF4
+ASGNF4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 64
+CNSTF4 1128792064
+ASGNF4
+LABELV $533
+ADDRLP4 36
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+125360
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+107636+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $536
+ADDRLP4 4
+CNSTF4 1077936128
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $536
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+125360
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+107636+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $542
+ADDRLP4 4
+CNSTF4 1077936128
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $542
+ADDRGP4 cg+125364
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $546
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $526
+ADDRLP4 64
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRGP4 cg+107636+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109140
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 100
+GEI4 $553
+ADDRLP4 68
+ADDRGP4 cg+109252+24+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg+109136
+INDIRF4
+CNSTI4 100
+ADDRLP4 28
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+SUBF4
+ASGNF4
+LABELV $553
+ADDRGP4 cg_bob+12
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRLP4 32
+ADDRGP4 cg+125360
+INDIRF4
+ADDRGP4 cg+125368
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1086324736
+LEF4 $565
+ADDRLP4 32
+CNSTF4 1086324736
+ASGNF4
+LABELV $565
+ADDRLP4 68
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $559
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109148
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1125515264
+GEF4 $569
+ADDRLP4 40
+ADDRLP4 4
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 cg+109252+24+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg+109144
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $570
+JUMPV
+LABELV $569
+ADDRLP4 4
+INDIRF4
+CNSTF4 1138819072
+GEF4 $575
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1125515264
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 cg+109252+24+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg+109144
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $575
+LABELV $570
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125348
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125348+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRGP4 cg+125348+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $461
+endproc CG_OffsetFirstPersonView 80 0
+export CG_ZoomDown_f
+proc CG_ZoomDown_f 0 0
+ADDRGP4 cg+109632
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $586
+JUMPV
+LABELV $587
+ADDRGP4 cg+109632
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+109636
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $586
+endproc CG_ZoomDown_f 0 0
+export CG_ZoomUp_f
+proc CG_ZoomUp_f 0 0
+ADDRGP4 cg+109632
+INDIRI4
+CNSTI4 0
+NEI4 $594
+ADDRGP4 $593
+JUMPV
+LABELV $594
+ADDRGP4 cg+109632
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+109636
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $593
+endproc CG_ZoomUp_f 0 0
+proc CG_CalcFov 52 8
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $601
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $602
+JUMPV
+LABELV $601
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $609
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $610
+JUMPV
+LABELV $609
+ADDRLP4 0
+INDIRF4
+CNSTF4 1126170624
+LEF4 $611
+ADDRLP4 0
+CNSTF4 1126170624
+ASGNF4
+LABELV $611
+LABELV $610
+LABELV $606
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $613
+ADDRLP4 16
+CNSTF4 1102315520
+ASGNF4
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRLP4 16
+ADDRGP4 cg_zoomFov+8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $617
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRLP4 16
+INDIRF4
+CNSTF4 1126170624
+LEF4 $619
+ADDRLP4 16
+CNSTF4 1126170624
+ASGNF4
+LABELV $619
+LABELV $618
+LABELV $614
+ADDRGP4 cg+109632
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109636
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+LEF4 $626
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $622
+JUMPV
+LABELV $626
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109636
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+GTF4 $630
+ADDRLP4 32
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $630
+LABELV $622
+LABELV $602
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $632
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+CNSTI4 0
+EQI4 $632
+ADDRLP4 0
+CNSTF4 1064178811
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 974997842
+ADDRGP4 cg+125368
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $632
+CNSTF4 1007614517
+ADDRLP4 0
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+109252+12
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRGP4 cg+109252+8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1122316001
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109252+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $643
+ADDRLP4 28
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $644
+ADDRGP4 cg+109252+16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109252+20
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109632
+INDIRI4
+CNSTI4 0
+NEI4 $650
+ADDRGP4 cg+109640
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRGP4 cg+109640
+ADDRGP4 cg+109252+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $651
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $600
+endproc CG_CalcFov 52 8
+proc CG_DamageBlendBlob 164 12
+ADDRGP4 cg+125292
+INDIRF4
+CNSTF4 0
+NEF4 $658
+ADDRGP4 $657
+JUMPV
+LABELV $658
+ADDRGP4 cg+125376
+INDIRI4
+CNSTI4 0
+EQI4 $661
+ADDRGP4 $657
+JUMPV
+LABELV $661
+ADDRLP4 144
+CNSTI4 500
+ASGNI4
+ADDRLP4 140
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125280
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LEI4 $668
+ADDRLP4 140
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $666
+LABELV $668
+ADDRGP4 $657
+JUMPV
+LABELV $666
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+68
+ADDRGP4 cg+109252+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+125284
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+125284
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+125284
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125288
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125288
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+125288
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+132
+CNSTF4 1077936128
+ADDRGP4 cg+125292
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+180272+280
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 156
+CNSTF4 1128792064
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRI4
+CVIF4 4
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $752
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $753
+ADDRLP4 0+116+3
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $657
+endproc CG_DamageBlendBlob 164 12
+proc CG_CalcViewValues 88 16
+ADDRGP4 cg+109252
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+107636
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $758
+ADDRGP4 cg+109252+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109620
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109620
+ARGP4
+ADDRGP4 cg+109252+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $754
+JUMPV
+LABELV $758
+ADDRGP4 cg+125364
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 7
+RSHI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+125360
+ADDRLP4 8
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+156504
+ADDRLP4 16
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+156508
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+125368
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109252+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109620
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+CNSTI4 0
+EQI4 $774
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125372
+INDIRI4
+LEI4 $777
+ADDRGP4 cg+125372
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg_cameraOrbitDelay+12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 cg_thirdPersonAngle+8
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $777
+LABELV $774
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+CNSTF4 0
+LEF4 $786
+ADDRLP4 48
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109044
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+LEF4 $793
+ADDRLP4 52
+INDIRF4
+CNSTF4 1065353216
+GEF4 $793
+ADDRGP4 cg+109252+24
+ADDRGP4 cg+109252+24
+INDIRF4
+ADDRGP4 cg+109048
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+4
+ADDRGP4 cg+109252+24+4
+INDIRF4
+ADDRGP4 cg+109048+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+8
+ADDRGP4 cg+109252+24+8
+INDIRF4
+ADDRGP4 cg+109048+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRGP4 cg+109044
+CNSTI4 0
+ASGNI4
+LABELV $794
+LABELV $786
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+LABELV $818
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $820
+ADDRGP4 cg+107628
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $820
+ADDRGP4 cg+109620+8
+ADDRGP4 headang+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109620
+ADDRGP4 headang
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109620+4
+ADDRGP4 headang+4
+INDIRF4
+ASGNF4
+ADDRGP4 headang
+ARGP4
+ADDRLP4 48
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+NEI4 $831
+ADDRLP4 72
+ADDRGP4 headpos
+ASGNP4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+4
+ADDRGP4 headpos+4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+8
+ADDRGP4 headpos+8
+INDIRF4
+CNSTF4 0
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 headpos
+ASGNP4
+ADDRLP4 84
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+4
+ADDRGP4 headpos+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+8
+ADDRGP4 headpos+8
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $832
+JUMPV
+LABELV $831
+ADDRLP4 72
+ADDRGP4 headpos
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRGP4 cg_cameraEyes_Fwd+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+4
+ADDRGP4 headpos+4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDRGP4 cg_cameraEyes_Fwd+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+8
+ADDRGP4 headpos+8
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDRGP4 cg_cameraEyes_Fwd+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 headpos
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRGP4 cg_cameraEyes_Up+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+4
+ADDRGP4 headpos+4
+INDIRF4
+ADDRLP4 60+4
+INDIRF4
+ADDRGP4 cg_cameraEyes_Up+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 headpos+8
+ADDRGP4 headpos+8
+INDIRF4
+ADDRLP4 60+8
+INDIRF4
+ADDRGP4 cg_cameraEyes_Up+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $832
+ADDRGP4 cg+109252+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 headpos
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 headpos+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109252+24+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 headpos+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $820
+ADDRGP4 cg+109620
+ARGP4
+ADDRGP4 cg+109252+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 0
+EQI4 $877
+ADDRLP4 48
+ADDRGP4 cg+109252+76
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $877
+ADDRLP4 48
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+RETI4
+LABELV $754
+endproc CG_CalcViewValues 88 16
+proc CG_PowerupTimerSounds 16 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $883
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GTI4 $888
+ADDRGP4 $884
+JUMPV
+LABELV $888
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $891
+ADDRGP4 $884
+JUMPV
+LABELV $891
+ADDRLP4 12
+CNSTI4 1000
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+EQI4 $894
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+820
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $894
+LABELV $884
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $883
+LABELV $882
+endproc CG_PowerupTimerSounds 16 16
+export CG_AddBufferedSound
+proc CG_AddBufferedSound 4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $902
+ADDRGP4 $901
+JUMPV
+LABELV $902
+ADDRGP4 cg+125144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125156
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125144
+ADDRGP4 cg+125144
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+125144
+INDIRI4
+ADDRGP4 cg+125148
+INDIRI4
+NEI4 $908
+ADDRLP4 0
+ADDRGP4 cg+125148
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $908
+LABELV $901
+endproc CG_AddBufferedSound 4 0
+proc CG_PlayBufferedSounds 0 8
+ADDRGP4 cg+125152
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $914
+ADDRGP4 cg+125148
+INDIRI4
+ADDRGP4 cg+125144
+INDIRI4
+EQI4 $918
+ADDRGP4 cg+125148
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $918
+ADDRGP4 cg+125148
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125156
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+125148
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+125148
+ADDRGP4 cg+125148
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+125152
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 750
+ADDI4
+ASGNI4
+LABELV $918
+LABELV $914
+LABELV $913
+endproc CG_PlayBufferedSounds 0 8
+export CG_DrawActiveFrame
+proc CG_DrawActiveFrame 16 16
+ADDRGP4 cg+107604
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRGP4 cg+109644
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $935
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $935
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 CG_ProcessSnapshots
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $942
+ADDRGP4 cg+36
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $938
+LABELV $942
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $938
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRGP4 cg+109640
+INDIRF4
+ARGF4
+ADDRGP4 trap_SetUserCmdValue
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 CG_PredictPlayerState
+CALLV
+pop
+ADDRGP4 cg_deathcam+12
+INDIRI4
+CNSTI4 0
+NEI4 $945
+ADDRGP4 cg+107628
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ASGNI4
+ADDRGP4 $946
+JUMPV
+LABELV $945
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $956
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $954
+LABELV $956
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $955
+ADDRGP4 cg+107628
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $946
+ADDRLP4 8
+ADDRGP4 CG_CalcViewValues
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $957
+ADDRGP4 CG_DamageBlendBlob
+CALLV
+pop
+LABELV $957
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 0
+NEI4 $960
+ADDRGP4 CG_AddPacketEntities
+CALLV
+pop
+ADDRGP4 CG_AddMarks
+CALLV
+pop
+ADDRGP4 CG_AddLocalEntities
+CALLV
+pop
+LABELV $960
+ADDRGP4 cg+107636
+ARGP4
+ADDRGP4 CG_AddViewWeapon
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedSounds
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedVoiceChats
+CALLV
+pop
+ADDRGP4 cg+125380+8
+INDIRI4
+CNSTI4 0
+EQI4 $964
+ADDRGP4 CG_AddTestModel
+CALLV
+pop
+LABELV $964
+ADDRGP4 cg+109252+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109252+80
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 CG_PowerupTimerSounds
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+109252+24
+ARGP4
+ADDRGP4 cg+109252+36
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $981
+ADDRGP4 cg+107600
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+107600
+INDIRI4
+CNSTI4 0
+GEI4 $986
+ADDRGP4 cg+107600
+CNSTI4 0
+ASGNI4
+LABELV $986
+ADDRGP4 cg+107608
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 CG_AddLagometerFrameInfo
+CALLV
+pop
+LABELV $981
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+EQF4 $992
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $996
+ADDRLP4 12
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+LEF4 $997
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRGP4 $997
+JUMPV
+LABELV $996
+ADDRLP4 12
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1012
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+LABELV $1012
+LABELV $997
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+CNSTF4 0
+EQF4 $1018
+ADDRGP4 $1022
+ARGP4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1018
+LABELV $992
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActive
+CALLV
+pop
+ADDRGP4 cg_stats+12
+INDIRI4
+CNSTI4 0
+EQI4 $1024
+ADDRGP4 $1027
+ARGP4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1024
+LABELV $932
+endproc CG_DrawActiveFrame 16 16
+import headang
+import headpos
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1027
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1022
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1021
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $234
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $230
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $229
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $138
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $96
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
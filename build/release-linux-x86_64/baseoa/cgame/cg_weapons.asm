@@ -0,0 +1,22583 @@
+code
+proc CG_MachineGunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $75
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRLP4 96
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1109393408
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3259498496
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 15
+BANDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $108
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+180272+244
+INDIRI4
+ASGNI4
+ADDRGP4 cg_leiBrassNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1058642330
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $135
+JUMPV
+LABELV $134
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1053609165
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+LABELV $135
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $74
+endproc CG_MachineGunEjectBrass 144 8
+proc CG_ShotgunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $139
+ADDRGP4 $138
+JUMPV
+LABELV $139
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $142
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3256877056
+ADDF4
+ASGNF4
+LABELV $147
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 3
+ADDRGP4 cg_brassTime+12
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $179
+ADDRLP4 96
+CNSTF4 1036831949
+ASGNF4
+LABELV $179
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+180272+248
+INDIRI4
+ASGNI4
+ADDRGP4 cg_leiBrassNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+LABELV $206
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $143
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LTI4 $142
+LABELV $138
+endproc CG_ShotgunEjectBrass 144 8
+proc CG_NailgunEjectBrass 112 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 88
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1143930880
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+340
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $209
+endproc CG_NailgunEjectBrass 112 48
+export CG_RailTrail
+proc CG_RailTrail 652 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 504
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 508
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 508
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+256
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $249
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $250
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 536
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+LTF4 $252
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $253
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 532
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $255
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $256
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 0
+EQI4 $257
+ADDRLP4 556
+ADDRLP4 20
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+ADDRLP4 556
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 560
+ADDRLP4 20
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 1
+LEI4 $241
+ADDRLP4 564
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+252
+INDIRI4
+ASGNI4
+ADDRLP4 576
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+LTF4 $270
+ADDRLP4 572
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRLP4 572
+ADDRLP4 576
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $271
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 572
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 588
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 592
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+LTF4 $273
+ADDRLP4 584
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 584
+ADDRLP4 588
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $274
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 584
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $276
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $277
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 608
+ADDRLP4 20
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+ADDRLP4 608
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 612
+ADDRLP4 20
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 612
+INDIRP4
+ADDRLP4 612
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 2
+LEI4 $241
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $282
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $283
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $285
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $286
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 644
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 648
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+LTF4 $288
+ADDRLP4 640
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 640
+ADDRLP4 644
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $289
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 640
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $241
+JUMPV
+LABELV $257
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 564
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 564
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 564
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 568
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 572
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 500
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $292
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 488
+ARGP4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $293
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 36
+LTI4 $292
+ADDRLP4 576
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 24
+ADDRLP4 580
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1084227584
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 484
+CNSTI4 -1
+ASGNI4
+ADDRLP4 36
+CNSTI4 18
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $306
+ADDRLP4 4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+EQI4 $310
+ADDRLP4 484
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRLP4 584
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 584
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+ADDI4
+CNSTI4 600
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1066192077
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+252
+INDIRI4
+ASGNI4
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $318
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $319
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $321
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $322
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $324
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $325
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 632
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 636
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 472
+INDIRF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+4
+ADDRLP4 472+4
+INDIRF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+8
+ADDRLP4 472+8
+INDIRF4
+CNSTF4 1082130432
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 472
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $310
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 36
+MODI4
+ASGNI4
+LABELV $307
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $309
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 500
+INDIRF4
+LTF4 $306
+LABELV $241
+endproc CG_RailTrail 652 16
+proc CG_OldRocketTrail 100 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRGP4 $341
+JUMPV
+LABELV $342
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $341
+JUMPV
+LABELV $348
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $359
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $341
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $341
+JUMPV
+LABELV $356
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+340
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $359
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $356
+LABELV $341
+endproc CG_OldRocketTrail 100 48
+proc CG_LeiSmokeTrail 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $363
+ADDRGP4 $362
+JUMPV
+LABELV $363
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1084227584
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8+4
+CNSTF4 1084227584
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8+8
+CNSTF4 1090519040
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 18
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $369
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $380
+ADDRLP4 36
+INDIRI4
+ADDRLP4 56
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 40
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $362
+JUMPV
+LABELV $377
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $381
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $381
+LABELV $378
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $380
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $377
+LABELV $362
+endproc CG_LeiSmokeTrail 88 12
+proc CG_LeiPlasmaTrail 88 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $385
+ADDRGP4 $384
+JUMPV
+LABELV $385
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $391
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $400
+ADDRGP4 $384
+JUMPV
+LABELV $397
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1104674816
+ARGF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTF4 1063675494
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+364
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $398
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $397
+LABELV $384
+endproc CG_LeiPlasmaTrail 88 48
+proc CG_NailTrail 100 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $404
+ADDRGP4 $403
+JUMPV
+LABELV $404
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $410
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $421
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $418
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+444
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $419
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $421
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $418
+LABELV $403
+endproc CG_NailTrail 100 48
+proc CG_OldPlasmaTrail 200 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $429
+ADDRGP4 cg_oldPlasma+12
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $425
+LABELV $429
+ADDRGP4 $424
+JUMPV
+LABELV $425
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 116
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1114636288
+CNSTF4 1123024896
+CNSTF4 1073741824
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+4
+CNSTF4 1109393408
+CNSTF4 1117782016
+CNSTF4 1073741824
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+8
+CNSTF4 1120403456
+CNSTF4 1128792064
+CNSTF4 1073741824
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 600
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 136
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 56
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 140
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 140
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $461
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $461
+ADDRLP4 148
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 148
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 44
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+252
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 156
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $489
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $490
+ADDRLP4 40
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 168
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $492
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $493
+ADDRLP4 40
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 180
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LTF4 $495
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $496
+ADDRLP4 40
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 176
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 63
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 188
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 192
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 196
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $424
+endproc CG_OldPlasmaTrail 200 12
+export CG_GrappleTrail
+proc CG_GrappleTrail 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+788
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84
+ADDRLP4 152
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 0+84
+ARGP4
+ADDRLP4 180
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1115684864
+GEF4 $519
+ADDRGP4 $498
+JUMPV
+LABELV $519
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+180272+408
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $498
+endproc CG_GrappleTrail 184 16
+proc CG_RocketTrail 0 8
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LeiSmokeTrail
+CALLV
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_OldRocketTrail
+CALLV
+pop
+LABELV $536
+LABELV $534
+endproc CG_RocketTrail 0 8
+proc CG_PlasmaTrail 0 8
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $539
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LeiPlasmaTrail
+CALLV
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_OldPlasmaTrail
+CALLV
+pop
+LABELV $540
+LABELV $538
+endproc CG_PlasmaTrail 0 8
+proc CG_GrenadeTrail 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_RocketTrail
+CALLV
+pop
+LABELV $542
+endproc CG_GrenadeTrail 0 8
+export CG_RegisterWeapon
+proc CG_RegisterWeapon 412 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 172
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $544
+ADDRGP4 $543
+JUMPV
+LABELV $544
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRGP4 $543
+JUMPV
+LABELV $546
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 172
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $551
+JUMPV
+LABELV $548
+ADDRLP4 64
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $553
+ADDRLP4 64
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $553
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $550
+JUMPV
+LABELV $553
+LABELV $549
+ADDRLP4 64
+ADDRLP4 64
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $551
+ADDRLP4 64
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $548
+LABELV $550
+ADDRLP4 64
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $555
+ADDRGP4 $557
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $555
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $558
+ADDRLP4 112
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 112
+INDIRI4
+ADDRLP4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 112
+INDIRI4
+ADDRLP4 92
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $559
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+LTI4 $558
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $565
+JUMPV
+LABELV $562
+ADDRLP4 76
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $567
+ADDRLP4 76
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $567
+ADDRGP4 $564
+JUMPV
+LABELV $567
+LABELV $563
+ADDRLP4 76
+ADDRLP4 76
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $565
+ADDRLP4 76
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $562
+LABELV $564
+ADDRLP4 124
+CNSTU4 0
+ASGNU4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $569
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $569
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $569
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $572
+ADDRGP4 $574
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $572
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $575
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $576
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $577
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $579
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $580
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $582
+ADDRGP4 $584
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $582
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $585
+ADDRGP4 $587
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $585
+ADDRLP4 72
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $588
+ADDRGP4 $590
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+LABELV $588
+ADDRLP4 72
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $591
+ADDRGP4 $593
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $591
+ADDRLP4 72
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $594
+ADDRGP4 $596
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $594
+ADDRLP4 72
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $597
+ADDRGP4 $599
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $597
+ADDRLP4 72
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $600
+ADDRGP4 $602
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+LABELV $600
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $603
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $604
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 $607
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+LABELV $605
+ADDRLP4 72
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $608
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $608
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $705-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $705
+address $610
+address $648
+address $655
+address $670
+address $657
+address $613
+address $687
+address $678
+address $698
+address $632
+address $675
+address $664
+address $639
+code
+LABELV $610
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $611
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 200
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 $612
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $613
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $614
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 208
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRGP4 $615
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 212
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 $619
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+260
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $622
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+608
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRGP4 $625
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+936
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $628
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 232
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+940
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRGP4 $631
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 236
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+944
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $632
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrappleTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $636
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+408
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $637
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 248
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRGP4 $638
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $639
+ADDRGP4 $640
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $641
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $642
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $643
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $644
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 272
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+620
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 71
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $648
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $649
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $650
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 284
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $652
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+620
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 62
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $655
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $656
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_ShotgunEjectBrass
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 63
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $657
+ADDRGP4 $658
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $659
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_RocketTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $660
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 312
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $663
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+624
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 65
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $664
+ADDRGP4 $665
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $666
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 324
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $669
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+628
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 70
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $670
+ADDRGP4 $671
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $672
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $669
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+628
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 64
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $675
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_NailgunEjectBrass
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_NailTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1132068864
+ASGNF4
+ADDRGP4 $676
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $677
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 69
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $678
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_PlasmaTrail
+ASGNP4
+ADDRGP4 $679
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $680
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $683
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+616
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $686
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+252
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $687
+ADDRGP4 $688
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $689
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $692
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+612
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $686
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+252
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $697
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+256
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 67
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $698
+ADDRGP4 $699
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $700
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+632
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $659
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 68
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $660
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 408
+INDIRI4
+ASGNI4
+LABELV $609
+LABELV $543
+endproc CG_RegisterWeapon 412 12
+export CG_RegisterItemVisuals
+proc CG_RegisterItemVisuals 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $710
+ADDRFP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $708
+LABELV $710
+ADDRGP4 $711
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 bg_numItems
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $708
+ADDRLP4 4
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRGP4 $707
+JUMPV
+LABELV $712
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $714
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $714
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $720
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $720
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $720
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+NEI4 $716
+LABELV $720
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $721
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $721
+LABELV $716
+LABELV $707
+endproc CG_RegisterItemVisuals 28 12
+proc CG_MapTorsoToWeaponFrame 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $724
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+ADDI4
+GEI4 $724
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6
+ADDI4
+RETI4
+ADDRGP4 $723
+JUMPV
+LABELV $724
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $726
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $726
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $723
+JUMPV
+LABELV $726
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $728
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $728
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $723
+JUMPV
+LABELV $728
+CNSTI4 0
+RETI4
+LABELV $723
+endproc CG_MapTorsoToWeaponFrame 24 0
+proc CG_CalculateWeaponPosition 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+109620
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125364
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $734
+ADDRLP4 0
+ADDRGP4 cg+125368
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $735
+JUMPV
+LABELV $734
+ADDRLP4 0
+ADDRGP4 cg+125368
+INDIRF4
+ASGNF4
+LABELV $735
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 0
+EQI4 $739
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 1
+NEI4 $742
+ADDRLP4 12
+CNSTF4 1025758986
+CNSTF4 1028443341
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1028443341
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1036831949
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $742
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 2
+NEI4 $752
+ADDRLP4 12
+CNSTF4 1025758986
+CNSTF4 1028443341
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $752
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 3
+NEI4 $740
+ADDRLP4 12
+CNSTF4 1025758986
+CNSTF4 1028443341
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1028443341
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+156504
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1036831949
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRGP4 cg+125368
+INDIRF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $740
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 150
+GEI4 $774
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+109144
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1125515264
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 4
+INDIRI4
+CNSTI4 450
+GEI4 $777
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+109144
+INDIRF4
+MULF4
+CNSTI4 450
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1133903872
+DIVF4
+ADDF4
+ASGNF4
+LABELV $777
+LABELV $775
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 0
+NEI4 $780
+ADDRLP4 0
+ADDRGP4 cg+125368
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+CNSTF4 981668463
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $780
+LABELV $730
+endproc CG_CalculateWeaponPosition 84 16
+proc CG_LightningBolt 284 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $786
+ADDRGP4 $785
+JUMPV
+LABELV $786
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $788
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181712
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $788
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 232
+INDIRI4
+NEI4 $795
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 232
+INDIRI4
+EQI4 $788
+LABELV $795
+ADDRGP4 cg+107636+152
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRGP4 cg+107636+20
+INDIRB
+ASGNB 12
+ADDRGP4 $789
+JUMPV
+LABELV $788
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $800
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+CNSTF4 0
+EQF4 $800
+ADDRLP4 252
+ADDRGP4 cg+107636+152
+INDIRB
+ASGNB 12
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+LABELV $807
+ADDRLP4 268
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 268
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 252
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1127481344
+LEF4 $811
+ADDRLP4 264
+ADDRLP4 264
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $811
+ADDRLP4 264
+INDIRF4
+CNSTF4 3274964992
+GEF4 $813
+ADDRLP4 264
+ADDRLP4 264
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $813
+ADDRLP4 272
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 240
+ADDP4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 252
+ADDP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1065353216
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $816
+ADDRLP4 276
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $816
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $818
+ADDRLP4 276
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $818
+LABELV $808
+ADDRLP4 236
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 3
+LTI4 $807
+ADDRLP4 240
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 264
+CNSTP4 0
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRGP4 cg+107636+20
+INDIRB
+ASGNB 12
+ADDRGP4 $801
+JUMPV
+LABELV $800
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $801
+LABELV $789
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 220
+ADDRLP4 140
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1145044992
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 244
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+84
+ADDRLP4 164+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+180272+260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $841
+ADDRLP4 248
+ADDRLP4 0+84
+INDIRF4
+ADDRLP4 0+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248+4
+ADDRLP4 0+84+4
+INDIRF4
+ADDRLP4 0+68+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248+8
+ADDRLP4 0+84+8
+INDIRF4
+ADDRLP4 0+68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+180272+608
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 164+12
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 248
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 164+12+4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 248+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 164+12+8
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 248+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260+4
+ADDRLP4 276
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 280
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260+8
+ADDRLP4 280
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $841
+LABELV $785
+endproc CG_LightningBolt 284 28
+proc CG_SpawnRailTrail 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $875
+ADDRGP4 $874
+JUMPV
+LABELV $875
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $877
+ADDRGP4 $874
+JUMPV
+LABELV $877
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+LABELV $874
+endproc CG_SpawnRailTrail 8 12
+proc CG_MachinegunSpinAngle 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $882
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+LEI4 $884
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+LABELV $884
+ADDRLP4 8
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $883
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $889
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $890
+JUMPV
+LABELV $889
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $890
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $886
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $893
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $895
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $895
+ADDRGP4 $897
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $895
+LABELV $886
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $880
+endproc CG_MachinegunSpinAngle 44 16
+proc CG_AddWeaponWithPowerups 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $899
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $900
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+556
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $900
+JUMPV
+LABELV $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $906
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+568
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $906
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $910
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+552
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $910
+LABELV $900
+LABELV $898
+endproc CG_AddWeaponWithPowerups 0 4
+proc MuzzleFlashStyleQ1 200 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 6
+EQI4 $918
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $918
+ADDRFP4 12
+INDIRI4
+CNSTI4 10
+NEI4 $915
+LABELV $918
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $915
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 200
+LEI4 $919
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $919
+ADDRGP4 $914
+JUMPV
+LABELV $919
+LABELV $916
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 24
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $926
+ADDRGP4 $914
+JUMPV
+LABELV $926
+ADDRLP4 140+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+LEI4 $932
+ADDRLP4 0+28
+CNSTF4 1069547520
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1069547520
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1069547520
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1069547520
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1069547520
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1069547520
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1069547520
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1069547520
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1069547520
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $932
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+NEI4 $977
+ADDRLP4 160
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 168
+CNSTF4 1132396544
+ADDRLP4 160
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $982
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $983
+JUMPV
+LABELV $982
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $983
+ADDRLP4 0+116
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 180
+CNSTF4 1132396544
+ADDRLP4 160
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LTF4 $987
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $988
+JUMPV
+LABELV $987
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $988
+ADDRLP4 0+116+1
+ADDRLP4 176
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 192
+CNSTF4 1132396544
+ADDRLP4 160
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LTF4 $992
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $993
+ADDRLP4 0+116+2
+ADDRLP4 188
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $977
+ADDRLP4 0
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $994
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1001
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1001
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $995
+LABELV $1001
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1002
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1002
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1002
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1007
+ADDRLP4 164
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+NEF4 $1013
+ADDRLP4 164
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+NEF4 $1013
+ADDRLP4 164
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+EQF4 $1010
+LABELV $1013
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 172
+CNSTF4 1064514355
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1010
+LABELV $1007
+LABELV $995
+LABELV $914
+endproc MuzzleFlashStyleQ1 200 20
+export CG_AddPlayerWeapon
+proc CG_AddPlayerWeapon 556 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 332
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 280
+CNSTI4 172
+ADDRLP4 332
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1022
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1018
+LABELV $1022
+ADDRGP4 cg+107636+144
+INDIRI4
+CNSTI4 7
+NEI4 $1023
+ADDRGP4 cg+107636+148
+INDIRI4
+CNSTI4 3
+NEI4 $1023
+ADDRLP4 492
+ADDRGP4 cg+107636+44
+INDIRI4
+CVIF4 4
+CNSTF4 1153138688
+DIVF4
+ASGNF4
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 500
+CNSTF4 1132396544
+CNSTF4 1065353216
+ADDRLP4 492
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 504
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+LTF4 $1037
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1038
+JUMPV
+LABELV $1037
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1038
+ADDRLP4 508
+ADDRLP4 496
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+2
+ADDRLP4 508
+INDIRU1
+ASGNU1
+ADDRLP4 0+116
+ADDRLP4 508
+INDIRU1
+ASGNU1
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1024
+LABELV $1018
+ADDRLP4 0+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1047
+ADDRGP4 $1014
+JUMPV
+LABELV $1047
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1050
+ADDRFP4 8
+INDIRP4
+CNSTI4 604
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 492
+INDIRI4
+EQI4 $1052
+ADDRLP4 280
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 492
+INDIRI4
+EQI4 $1052
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 604
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1052
+ADDRLP4 280
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1054
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $1054
+LABELV $1053
+LABELV $1050
+ADDRLP4 284
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 $1056
+ARGP4
+ADDRGP4 trap_R_LerpTag
+CALLI4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1068
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+NEI4 $1068
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1069
+JUMPV
+LABELV $1068
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1087
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+EQI4 $1084
+LABELV $1087
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1084
+LABELV $1069
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 284+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 284+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 284+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 0+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+ADDRLP4 280
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1117
+ADDRLP4 352
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 352+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 352+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 352+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 496
+ADDRGP4 CG_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 336+8
+ADDRLP4 496
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 352+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 352
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1126
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 352
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+LABELV $1117
+ADDRLP4 496
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 500
+ADDRGP4 cg_entities
+ASGNP4
+ADDRLP4 348
+CNSTI4 936
+ADDRLP4 496
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 500
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CVPU4 4
+ADDRLP4 500
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 936
+DIVI4
+ADDRLP4 496
+INDIRP4
+INDIRI4
+EQI4 $1127
+ADDRLP4 348
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $1127
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $1129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRGP4 MuzzleFlashStyleQ1
+CALLV
+pop
+ADDRGP4 $1014
+JUMPV
+LABELV $1129
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1132
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1138
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1138
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1135
+LABELV $1138
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1135
+ADDRGP4 $1136
+JUMPV
+LABELV $1135
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 120
+LEI4 $1139
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1139
+ADDRGP4 $1014
+JUMPV
+LABELV $1139
+LABELV $1136
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1145
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1145
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1146
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1151
+ADDRGP4 $1014
+JUMPV
+LABELV $1151
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 508
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336+8
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 508
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1156
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1156
+ADDRLP4 336+8
+CNSTF4 0
+ASGNF4
+LABELV $1156
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $994
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1168
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1168
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1014
+LABELV $1168
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1169
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1169
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1169
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1177
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1177
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+EQF4 $1014
+LABELV $1177
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1125515264
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1014
+JUMPV
+LABELV $1132
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 4
+NEI4 $1178
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1184
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1184
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1181
+LABELV $1184
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1181
+ADDRGP4 $1182
+JUMPV
+LABELV $1181
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 240
+LEI4 $1185
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1185
+ADDRGP4 $1014
+JUMPV
+LABELV $1185
+LABELV $1182
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1192
+ADDRGP4 $1014
+JUMPV
+LABELV $1192
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 508
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 336+8
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140+128
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $994
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1205
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1205
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1014
+LABELV $1205
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1206
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1206
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1206
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1214
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1214
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+EQF4 $1014
+LABELV $1214
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1125515264
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1014
+JUMPV
+LABELV $1178
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 5
+NEI4 $1215
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1221
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1221
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1218
+LABELV $1221
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1218
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 400
+LEI4 $1222
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1222
+ADDRGP4 $1014
+JUMPV
+LABELV $1222
+LABELV $1219
+ADDRLP4 504
+CNSTF4 981668463
+CNSTI4 400
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 504
+INDIRF4
+CNSTF4 0
+GEF4 $1226
+ADDRGP4 $1014
+JUMPV
+LABELV $1226
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5
+GEI4 $1231
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+CNSTF4 1144258560
+CNSTF4 1073741824
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1231
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1235
+ADDRGP4 $1014
+JUMPV
+LABELV $1235
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 336+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1241
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1241
+ADDRLP4 512
+CNSTF4 994352038
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 $1242
+JUMPV
+LABELV $1241
+ADDRLP4 512
+CNSTF4 1004888130
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+LABELV $1242
+ADDRLP4 140+28
+ADDRLP4 140+28
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+4
+ADDRLP4 140+28+4
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+8
+ADDRLP4 140+28+8
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12
+ADDRLP4 140+28+12
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+ADDRLP4 140+28+12+4
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+ADDRLP4 140+28+12+8
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24
+ADDRLP4 140+28+24
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+4
+ADDRLP4 140+28+24+4
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+8
+ADDRLP4 140+28+24+8
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+2
+CNSTU1 255
+ASGNU1
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1294
+ADDRLP4 140+28+12
+CNSTF4 3212836864
+ADDRLP4 140+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+CNSTF4 3212836864
+ADDRLP4 140+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+CNSTF4 3212836864
+ADDRLP4 140+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1294
+ADDRLP4 140+128
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 332
+INDIRI4
+CNSTI4 7
+NEI4 $1313
+ADDRLP4 512
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 520
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+LTF4 $1318
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1319
+JUMPV
+LABELV $1318
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1319
+ADDRLP4 140+116
+ADDRLP4 516
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 532
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+LTF4 $1323
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1324
+ADDRLP4 140+116+1
+ADDRLP4 528
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+LTF4 $1328
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1329
+JUMPV
+LABELV $1328
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1329
+ADDRLP4 140+116+2
+ADDRLP4 540
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1313
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $994
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1336
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1336
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1014
+LABELV $1336
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1337
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1337
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1337
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1345
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1345
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+EQF4 $1014
+LABELV $1345
+ADDRLP4 140+68
+ARGP4
+ADDRLP4 524
+ADDRLP4 504
+INDIRF4
+ASGNF4
+CNSTF4 1140457472
+ADDRLP4 524
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 532
+CNSTF4 1082130432
+ADDRLP4 524
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1014
+JUMPV
+LABELV $1215
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 6
+NEI4 $1347
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1353
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1353
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1350
+LABELV $1353
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1350
+ADDRGP4 $1351
+JUMPV
+LABELV $1350
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 200
+LEI4 $1354
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1354
+ADDRGP4 $1014
+JUMPV
+LABELV $1354
+LABELV $1351
+ADDRLP4 504
+CNSTF4 981668463
+CNSTI4 200
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 504
+INDIRF4
+CNSTF4 0
+GEF4 $1358
+ADDRGP4 $1014
+JUMPV
+LABELV $1358
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5
+GEI4 $1363
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+CNSTF4 1135902720
+CNSTF4 1073741824
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1363
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1366
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1366
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1367
+JUMPV
+LABELV $1366
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1367
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1372
+ADDRGP4 $1014
+JUMPV
+LABELV $1372
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1376
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1376
+ADDRLP4 336+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1377
+JUMPV
+LABELV $1376
+ADDRLP4 336+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1377
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 516
+CNSTF4 1000593162
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 140+28
+ADDRLP4 140+28
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+4
+ADDRLP4 140+28+4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+8
+ADDRLP4 140+28+8
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12
+ADDRLP4 140+28+12
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+ADDRLP4 140+28+12+4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+ADDRLP4 140+28+12+8
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24
+ADDRLP4 140+28+24
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+4
+ADDRLP4 140+28+24+4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+8
+ADDRLP4 140+28+24+8
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $1428
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1429
+JUMPV
+LABELV $1428
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1429
+ADDRLP4 140+116
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 536
+CNSTF4 1132396544
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+LTF4 $1433
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1434
+JUMPV
+LABELV $1433
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1434
+ADDRLP4 140+116+1
+ADDRLP4 532
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $1438
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1439
+JUMPV
+LABELV $1438
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1439
+ADDRLP4 140+116+2
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 140+128
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 332
+INDIRI4
+CNSTI4 7
+NEI4 $1441
+ADDRLP4 516
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRLP4 516
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $1446
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1447
+JUMPV
+LABELV $1446
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1447
+ADDRLP4 140+116
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 536
+CNSTF4 1132396544
+ADDRLP4 516
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+LTF4 $1451
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1452
+JUMPV
+LABELV $1451
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1452
+ADDRLP4 140+116+1
+ADDRLP4 532
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRLP4 516
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $1456
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1457
+JUMPV
+LABELV $1456
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1457
+ADDRLP4 140+116+2
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1441
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $994
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1464
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1464
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1014
+LABELV $1464
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1465
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1465
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1465
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 524
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRF4
+NEF4 $1473
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRF4
+NEF4 $1473
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRF4
+EQF4 $1014
+LABELV $1473
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+ADDRLP4 532
+ADDRLP4 504
+INDIRF4
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1014
+JUMPV
+LABELV $1347
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1477
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1477
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1474
+LABELV $1477
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1474
+ADDRGP4 $1475
+JUMPV
+LABELV $1474
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 20
+LEI4 $1478
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1478
+ADDRGP4 $1014
+JUMPV
+LABELV $1478
+LABELV $1475
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1485
+ADDRGP4 $1014
+JUMPV
+LABELV $1485
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 508
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336+8
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 508
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 332
+INDIRI4
+CNSTI4 7
+NEI4 $1491
+ADDRLP4 512
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 520
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+LTF4 $1496
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1497
+JUMPV
+LABELV $1496
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1497
+ADDRLP4 140+116
+ADDRLP4 516
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 532
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+LTF4 $1501
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1502
+JUMPV
+LABELV $1501
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1502
+ADDRLP4 140+116+1
+ADDRLP4 528
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+LTF4 $1506
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1507
+JUMPV
+LABELV $1506
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1507
+ADDRLP4 140+116+2
+ADDRLP4 540
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1491
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $994
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1514
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1514
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1508
+LABELV $1514
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 516
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+NEF4 $1520
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+NEF4 $1520
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+EQF4 $1517
+LABELV $1520
+ADDRLP4 520
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140+68
+ARGP4
+ADDRLP4 520
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1517
+LABELV $1508
+LABELV $1014
+endproc CG_AddPlayerWeapon 556 28
+export CG_AddViewWeapon
+proc CG_AddViewWeapon 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1523
+ADDRGP4 $1522
+JUMPV
+LABELV $1523
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1525
+ADDRGP4 $1522
+JUMPV
+LABELV $1525
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1527
+ADDRGP4 $1522
+JUMPV
+LABELV $1527
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 0
+NEI4 $1530
+ADDRGP4 cg+107636+104
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1522
+ADDRLP4 168
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRLP4 180
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 168
+ADDRLP4 168
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRGP4 $1522
+JUMPV
+LABELV $1530
+ADDRGP4 cg+125584
+INDIRI4
+CNSTI4 0
+EQI4 $1554
+ADDRGP4 $1522
+JUMPV
+LABELV $1554
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+LEI4 $1557
+ADDRLP4 140
+CNSTF4 3192704205
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $1558
+JUMPV
+LABELV $1557
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+LABELV $1558
+ADDRLP4 144
+ADDRGP4 cg+108104
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 160
+CNSTI4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CalculateWeaponPosition
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+8
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+CNSTI4 0
+EQI4 $1633
+ADDRLP4 168
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1634
+JUMPV
+LABELV $1633
+ADDRLP4 164
+CNSTI4 2120
+ADDRLP4 144
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1634
+ADDRLP4 0+8
+ADDRLP4 160
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+108104
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+LABELV $1522
+endproc CG_AddViewWeapon 184 16
+export CG_DrawWeaponSelect
+proc CG_DrawWeaponSelect 40 12
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $1648
+ADDRGP4 $1647
+JUMPV
+LABELV $1648
+ADDRGP4 cg+125268
+INDIRI4
+ARGI4
+CNSTI4 1400
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 cg_alwaysWeaponBar+12
+INDIRI4
+CNSTI4 0
+EQI4 $1653
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 16
+ASGNP4
+LABELV $1653
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1659
+ADDRGP4 $1647
+JUMPV
+LABELV $1659
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+125260
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1663
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1667
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1667
+LABELV $1664
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1663
+ADDRLP4 36
+ADDRGP4 cg_weaponBarStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $1669
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+GTI4 $1669
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1680
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1680
+address $1672
+address $1673
+address $1674
+address $1675
+address $1676
+address $1677
+address $1678
+address $1679
+code
+LABELV $1672
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawWeaponBar0
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1673
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawWeaponBar1
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1674
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar2
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1675
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar3
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1676
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar4
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1677
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar5
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1678
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar6
+CALLV
+pop
+ADDRGP4 $1670
+JUMPV
+LABELV $1679
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar7
+CALLV
+pop
+LABELV $1669
+LABELV $1670
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1647
+endproc CG_DrawWeaponSelect 40 12
+export CG_DrawWeaponBar0
+proc CG_DrawWeaponBar0 24 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 380
+ASGNI4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1682
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1686
+ADDRGP4 $1683
+JUMPV
+LABELV $1686
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1688
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1688
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1690
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1683
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1683
+JUMPV
+LABELV $1690
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1695
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1695
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1700
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1700
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1705
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1705
+LABELV $1683
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1682
+LABELV $1681
+endproc CG_DrawWeaponBar0 24 20
+export CG_DrawWeaponBar1
+proc CG_DrawWeaponBar1 100 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 380
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40+4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 56+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 56+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1717
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1721
+ADDRGP4 $1718
+JUMPV
+LABELV $1721
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1723
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1723
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1725
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1718
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1718
+JUMPV
+LABELV $1725
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $1730
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1730
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 $1743-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1743
+address $1732
+address $1733
+address $1734
+address $1735
+address $1736
+address $1737
+address $1738
+address $1739
+address $1730
+address $1740
+address $1741
+address $1742
+code
+LABELV $1732
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1733
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1734
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1735
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1736
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1737
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1738
+ADDRLP4 16
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1739
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1740
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1741
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1742
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1731
+JUMPV
+LABELV $1730
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $1731
+ADDRLP4 80
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LTI4 $1745
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $1745
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1747
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1747
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+GTI4 $1749
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 38
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1749
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LEI4 $1751
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+GTI4 $1751
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 38
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1751
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $1753
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 38
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1753
+LABELV $1747
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 88
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1756
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 92
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 96
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1756
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1761
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 92
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1761
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1766
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1766
+LABELV $1718
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1717
+LABELV $1707
+endproc CG_DrawWeaponBar1 100 20
+export CG_DrawWeaponBar2
+proc CG_DrawWeaponBar2 88 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1778
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1782
+ADDRGP4 $1779
+JUMPV
+LABELV $1782
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1784
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1784
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1786
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1779
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1779
+JUMPV
+LABELV $1786
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1790
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1793
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1791
+JUMPV
+LABELV $1793
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $1791
+JUMPV
+LABELV $1790
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1796
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1797
+JUMPV
+LABELV $1796
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1797
+LABELV $1791
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1800
+ADDRGP4 $1803
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1800
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1805
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1805
+LABELV $1779
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1778
+LABELV $1768
+endproc CG_DrawWeaponBar2 88 24
+export CG_DrawWeaponBar3
+proc CG_DrawWeaponBar3 136 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1820
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1824
+ADDRGP4 $1821
+JUMPV
+LABELV $1824
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1826
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1826
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1828
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1821
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1821
+JUMPV
+LABELV $1828
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1833
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1833
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LSHI4
+ADDRGP4 $1846-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1846
+address $1835
+address $1836
+address $1837
+address $1838
+address $1839
+address $1840
+address $1841
+address $1842
+address $1833
+address $1843
+address $1844
+address $1845
+code
+LABELV $1835
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1836
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1837
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1838
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1839
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1840
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1841
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1842
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1843
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1844
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1845
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1834
+JUMPV
+LABELV $1833
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $1834
+ADDRLP4 112
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LTI4 $1848
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $1848
+ADDRLP4 16
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1850
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1850
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+GTI4 $1852
+CNSTF4 1112276992
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 20
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1852
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LEI4 $1854
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+GTI4 $1854
+CNSTF4 1112276992
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 20
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1854
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $1856
+CNSTF4 1112276992
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 20
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1856
+LABELV $1850
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1858
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1861
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1859
+JUMPV
+LABELV $1861
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $1859
+JUMPV
+LABELV $1858
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1864
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1865
+JUMPV
+LABELV $1864
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1865
+LABELV $1859
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 120
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1868
+ADDRGP4 $1803
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 128
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1868
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1872
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1872
+LABELV $1821
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1820
+LABELV $1807
+endproc CG_DrawWeaponBar3 136 24
+export CG_DrawWeaponBar4
+proc CG_DrawWeaponBar4 92 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1880
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1884
+ADDRGP4 $1881
+JUMPV
+LABELV $1884
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1886
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1886
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1888
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1881
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1881
+JUMPV
+LABELV $1888
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $1893
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1893
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 $1906-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1906
+address $1895
+address $1896
+address $1897
+address $1898
+address $1899
+address $1900
+address $1901
+address $1902
+address $1893
+address $1903
+address $1904
+address $1905
+code
+LABELV $1895
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1896
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1897
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1898
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1899
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1900
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1901
+ADDRLP4 32
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1902
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1903
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1904
+ADDRLP4 32
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1905
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1893
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $1894
+ADDRLP4 4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+GEF4 $1910
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $1908
+LABELV $1910
+ADDRLP4 4
+CNSTF4 1120403456
+ASGNF4
+LABELV $1908
+ADDRLP4 12+8
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1912
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1913
+JUMPV
+LABELV $1912
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1913
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1916
+ADDRGP4 $1803
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1916
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1920
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1920
+LABELV $1881
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1880
+LABELV $1874
+endproc CG_DrawWeaponBar4 92 24
+export CG_DrawWeaponBar5
+proc CG_DrawWeaponBar5 88 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 380
+ASGNI4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 15
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1932
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1936
+ADDRGP4 $1933
+JUMPV
+LABELV $1936
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1938
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1938
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1940
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1933
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1933
+JUMPV
+LABELV $1940
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1944
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1947
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1945
+JUMPV
+LABELV $1947
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $1945
+JUMPV
+LABELV $1944
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1950
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1951
+JUMPV
+LABELV $1950
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1951
+LABELV $1945
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1954
+ADDRGP4 $1803
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1954
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1958
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1958
+LABELV $1933
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1932
+LABELV $1922
+endproc CG_DrawWeaponBar5 88 24
+export CG_DrawWeaponBar6
+proc CG_DrawWeaponBar6 132 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 380
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+CNSTI4 15
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1973
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1977
+ADDRGP4 $1974
+JUMPV
+LABELV $1977
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1979
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1979
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1981
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1974
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1974
+JUMPV
+LABELV $1981
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1986
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1986
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LSHI4
+ADDRGP4 $1999-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1999
+address $1988
+address $1989
+address $1990
+address $1991
+address $1992
+address $1993
+address $1994
+address $1995
+address $1986
+address $1996
+address $1997
+address $1998
+code
+LABELV $1988
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1989
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1990
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1991
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1992
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1993
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1994
+ADDRLP4 16
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1995
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1996
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1997
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1998
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1987
+JUMPV
+LABELV $1986
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $1987
+ADDRLP4 112
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LTI4 $2001
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $2001
+ADDRLP4 20
+CNSTI4 26
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $2003
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2003
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+GTI4 $2005
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2005
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LEI4 $2007
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+GTI4 $2007
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2007
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $2009
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2009
+LABELV $2003
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2011
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $2014
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $2012
+JUMPV
+LABELV $2014
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $2012
+JUMPV
+LABELV $2011
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $2017
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $2018
+JUMPV
+LABELV $2017
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2018
+LABELV $2012
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 120
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2021
+ADDRGP4 $1803
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 128
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $2021
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2025
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2025
+LABELV $1974
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1973
+LABELV $1960
+endproc CG_DrawWeaponBar6 132 24
+export CG_DrawWeaponBar7
+proc CG_DrawWeaponBar7 92 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 380
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+CNSTI4 15
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2033
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2037
+ADDRGP4 $2034
+JUMPV
+LABELV $2037
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2039
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $2039
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2041
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2034
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2034
+JUMPV
+LABELV $2041
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $2046
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $2046
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 $2059-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2059
+address $2048
+address $2049
+address $2050
+address $2051
+address $2052
+address $2053
+address $2054
+address $2055
+address $2046
+address $2056
+address $2057
+address $2058
+code
+LABELV $2048
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2049
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2050
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2051
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2052
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2053
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2054
+ADDRLP4 32
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2055
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2056
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2057
+ADDRLP4 32
+CNSTF4 1084227584
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2058
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $2047
+JUMPV
+LABELV $2046
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+LABELV $2047
+ADDRLP4 4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2063
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $2061
+LABELV $2063
+ADDRLP4 4
+CNSTF4 1120403456
+ASGNF4
+LABELV $2061
+ADDRLP4 12+8
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $2065
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $2066
+JUMPV
+LABELV $2065
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2066
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2069
+ADDRGP4 $1803
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $2069
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2073
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2073
+LABELV $2034
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2033
+LABELV $2027
+endproc CG_DrawWeaponBar7 92 24
+proc CG_WeaponSelectable 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2076
+CNSTI4 0
+RETI4
+ADDRGP4 $2075
+JUMPV
+LABELV $2076
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2079
+CNSTI4 0
+RETI4
+ADDRGP4 $2075
+JUMPV
+LABELV $2079
+CNSTI4 1
+RETI4
+LABELV $2075
+endproc CG_WeaponSelectable 0 0
+export CG_NextWeapon_f
+proc CG_NextWeapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2083
+ADDRGP4 $2082
+JUMPV
+LABELV $2083
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2086
+ADDRGP4 $2082
+JUMPV
+LABELV $2086
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+109152
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2092
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2092
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2096
+ADDRLP4 8
+ADDRGP4 cg+109152
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 16
+NEI4 $2101
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2101
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 1
+NEI4 $2105
+ADDRGP4 $2097
+JUMPV
+LABELV $2105
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2108
+ADDRGP4 $2097
+JUMPV
+LABELV $2108
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 0
+NEI4 $2111
+ADDRGP4 cg+109152
+CNSTI4 10
+ASGNI4
+LABELV $2111
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2115
+ADDRGP4 cg_cyclegrapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $2115
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2097
+JUMPV
+LABELV $2115
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2120
+ADDRGP4 $2098
+JUMPV
+LABELV $2120
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2123
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2123
+LABELV $2097
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2096
+LABELV $2098
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $2127
+ADDRGP4 cg+109152
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2127
+LABELV $2082
+endproc CG_NextWeapon_f 16 4
+export CG_PrevWeapon_f
+proc CG_PrevWeapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2131
+ADDRGP4 $2130
+JUMPV
+LABELV $2131
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2134
+ADDRGP4 $2130
+JUMPV
+LABELV $2134
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+109152
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2140
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2140
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2144
+ADDRLP4 8
+ADDRGP4 cg+109152
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 -1
+NEI4 $2149
+ADDRGP4 cg+109152
+CNSTI4 15
+ASGNI4
+LABELV $2149
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 1
+NEI4 $2153
+ADDRGP4 $2145
+JUMPV
+LABELV $2153
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2156
+ADDRGP4 $2145
+JUMPV
+LABELV $2156
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 0
+NEI4 $2159
+ADDRGP4 cg+109152
+CNSTI4 10
+ASGNI4
+LABELV $2159
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2163
+ADDRGP4 cg_cyclegrapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $2163
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2145
+JUMPV
+LABELV $2163
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2168
+ADDRGP4 $2146
+JUMPV
+LABELV $2168
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2171
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2171
+LABELV $2145
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2144
+LABELV $2146
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $2175
+ADDRGP4 cg+109152
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2175
+LABELV $2130
+endproc CG_PrevWeapon_f 16 4
+export CG_Weapon_f
+proc CG_Weapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2179
+ADDRGP4 $2178
+JUMPV
+LABELV $2179
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2182
+ADDRGP4 $2178
+JUMPV
+LABELV $2182
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $2187
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $2185
+LABELV $2187
+ADDRGP4 $2178
+JUMPV
+LABELV $2185
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2190
+ADDRGP4 $2178
+JUMPV
+LABELV $2190
+ADDRGP4 cg+109152
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2178
+endproc CG_Weapon_f 16 4
+export CG_OutOfAmmoChange
+proc CG_OutOfAmmoChange 8 4
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+LABELV $2197
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2201
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2201
+ADDRGP4 cg+109152
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2199
+JUMPV
+LABELV $2201
+LABELV $2198
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $2197
+LABELV $2199
+LABELV $2194
+endproc CG_OutOfAmmoChange 8 4
+export CG_FireWeapon
+proc CG_FireWeapon 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $2211
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $2205
+LABELV $2211
+ADDRGP4 cgs+34812
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LTI4 $2205
+ADDRGP4 $2204
+JUMPV
+LABELV $2205
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2212
+ADDRGP4 $2204
+JUMPV
+LABELV $2212
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 14
+LTI4 $2214
+ADDRGP4 $2216
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $2204
+JUMPV
+LABELV $2214
+ADDRLP4 4
+CNSTI4 172
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+CNSTI4 2
+LEI4 $2219
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2219
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2221
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2223
+ADDRGP4 $2204
+JUMPV
+LABELV $2223
+LABELV $2221
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2225
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+804
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2225
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2229
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2233
+ADDRGP4 $2231
+JUMPV
+LABELV $2233
+LABELV $2230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2229
+LABELV $2231
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $2235
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2237
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2237
+LABELV $2235
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2239
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+LEI4 $2239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2239
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PredictWeaponEffects
+CALLV
+pop
+LABELV $2204
+endproc CG_FireWeapon 28 16
+export CG_MissileHitWall
+proc CG_MissileHitWall 124 44
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+CNSTI4 600
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $2245
+ADDRLP4 64
+INDIRI4
+CNSTI4 13
+GTI4 $2245
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 $2408-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2408
+address $2388
+address $2350
+address $2288
+address $2300
+address $2263
+address $2314
+address $2326
+address $2338
+address $2245
+address $2247
+address $2276
+address $2360
+code
+LABELV $2245
+LABELV $2247
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $2248
+ADDRLP4 4
+ADDRGP4 cgs+180272+980
+INDIRI4
+ASGNI4
+ADDRGP4 $2249
+JUMPV
+LABELV $2248
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $2252
+ADDRLP4 4
+ADDRGP4 cgs+180272+984
+INDIRI4
+ASGNI4
+ADDRGP4 $2253
+JUMPV
+LABELV $2252
+ADDRLP4 4
+ADDRGP4 cgs+180272+976
+INDIRI4
+ASGNI4
+LABELV $2253
+LABELV $2249
+ADDRLP4 0
+ADDRGP4 cgs+180272+536
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+CNSTI4 10
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2263
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 72
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+GEI4 $2264
+ADDRLP4 4
+ADDRGP4 cgs+180272+940
+INDIRI4
+ASGNI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2264
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $2268
+ADDRLP4 4
+ADDRGP4 cgs+180272+936
+INDIRI4
+ASGNI4
+ADDRGP4 $2269
+JUMPV
+LABELV $2268
+ADDRLP4 4
+ADDRGP4 cgs+180272+944
+INDIRI4
+ASGNI4
+LABELV $2269
+LABELV $2265
+ADDRLP4 0
+ADDRGP4 cgs+180272+536
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 $2246
+JUMPV
+LABELV $2276
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+628
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+972
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2288
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+628
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+964
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2300
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+624
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+964
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+CNSTI4 1000
+ASGNI4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2314
+ADDRLP4 24
+ADDRGP4 cgs+180272+600
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+968
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+540
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 30
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2326
+ADDRLP4 24
+ADDRGP4 cgs+180272+600
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+616
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+968
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+540
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2338
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+632
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+964
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2350
+ADDRLP4 24
+ADDRGP4 cgs+180272+596
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+620
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+528
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2246
+JUMPV
+LABELV $2360
+ADDRLP4 24
+ADDRGP4 cgs+180272+596
+INDIRI4
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 1996
+NEI4 $2363
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2246
+JUMPV
+LABELV $2363
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $2366
+ADDRLP4 4
+ADDRGP4 cgs+180272+992
+INDIRI4
+ASGNI4
+ADDRGP4 $2367
+JUMPV
+LABELV $2366
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $2370
+ADDRLP4 4
+ADDRGP4 cgs+180272+996
+INDIRI4
+ASGNI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2370
+ADDRLP4 4
+ADDRGP4 cgs+180272+988
+INDIRI4
+ASGNI4
+LABELV $2371
+LABELV $2367
+ADDRLP4 0
+ADDRGP4 cgs+180272+528
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+GEI4 $2378
+ADDRLP4 4
+ADDRGP4 cgs+180272+948
+INDIRI4
+ASGNI4
+ADDRGP4 $2379
+JUMPV
+LABELV $2378
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $2382
+ADDRLP4 4
+ADDRGP4 cgs+180272+952
+INDIRI4
+ASGNI4
+ADDRGP4 $2383
+JUMPV
+LABELV $2382
+ADDRLP4 4
+ADDRGP4 cgs+180272+956
+INDIRI4
+ASGNI4
+LABELV $2383
+LABELV $2379
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $2246
+JUMPV
+LABELV $2388
+ADDRLP4 24
+ADDRGP4 cgs+180272+596
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+620
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+528
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $2395
+ADDRLP4 4
+ADDRGP4 cgs+180272+948
+INDIRI4
+ASGNI4
+ADDRGP4 $2396
+JUMPV
+LABELV $2395
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $2399
+ADDRLP4 4
+ADDRGP4 cgs+180272+952
+INDIRI4
+ASGNI4
+ADDRGP4 $2400
+JUMPV
+LABELV $2399
+ADDRLP4 4
+ADDRGP4 cgs+180272+956
+INDIRI4
+ASGNI4
+LABELV $2400
+LABELV $2396
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2246
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $2246
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2410
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2410
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+NEI4 $2412
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2415
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_MakeExplosion
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $2417
+ADDRLP4 40
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 2120
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+76
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1132396544
+ADDRLP4 80
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+LTF4 $2422
+ADDRLP4 76
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2423
+JUMPV
+LABELV $2422
+ADDRLP4 76
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2423
+ADDRLP4 80
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 96
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 100
+CNSTF4 1132396544
+ADDRLP4 96
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+LTF4 $2425
+ADDRLP4 92
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2426
+JUMPV
+LABELV $2425
+ADDRLP4 92
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2426
+ADDRLP4 96
+INDIRP4
+CNSTI4 269
+ADDP4
+ADDRLP4 92
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 112
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTF4 1132396544
+ADDRLP4 112
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LTF4 $2428
+ADDRLP4 108
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2429
+JUMPV
+LABELV $2428
+ADDRLP4 108
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2429
+ADDRLP4 112
+INDIRP4
+CNSTI4 270
+ADDP4
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+INDIRP4
+CNSTI4 271
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $2417
+LABELV $2415
+LABELV $2412
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+180272+540
+INDIRI4
+NEI4 $2433
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2434
+JUMPV
+LABELV $2433
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $2434
+ADDRLP4 32
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $2435
+ADDRLP4 76
+CNSTI4 2120
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+76
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 84
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $2436
+JUMPV
+LABELV $2435
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 80
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $2436
+LABELV $2242
+endproc CG_MissileHitWall 124 44
+export CG_MissileHitPlayer
+proc CG_MissileHitPlayer 4 20
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2440
+CNSTI4 14
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2441
+JUMPV
+LABELV $2440
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+LABELV $2441
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2444
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $2444
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2446-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2446
+address $2445
+address $2445
+address $2444
+address $2444
+address $2444
+address $2444
+address $2444
+address $2445
+address $2445
+address $2445
+code
+LABELV $2445
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2444
+LABELV $2439
+endproc CG_MissileHitPlayer 4 20
+proc CG_ShotgunPellet 148 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+CNSTP4 0
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $2450
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2451
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $2451
+JUMPV
+LABELV $2450
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2455
+ADDRLP4 88
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2456
+ADDRLP4 64
+ADDRLP4 88+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 88+12
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2456
+JUMPV
+LABELV $2455
+ADDRLP4 60
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2463
+ADDRLP4 88
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 88+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2467
+ADDRLP4 64
+ADDRLP4 88+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 88+12
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $2467
+LABELV $2463
+LABELV $2456
+LABELV $2451
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2472
+ADDRGP4 $2448
+JUMPV
+LABELV $2472
+CNSTI4 936
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2475
+CNSTI4 3
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $2476
+JUMPV
+LABELV $2475
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2482
+ADDRGP4 $2448
+JUMPV
+LABELV $2482
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2485
+CNSTI4 3
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $2486
+JUMPV
+LABELV $2485
+CNSTI4 3
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2486
+LABELV $2476
+LABELV $2448
+endproc CG_ShotgunPellet 148 28
+export CG_ShotgunPattern
+proc CG_ShotgunPattern 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $2493
+ADDRFP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 20+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPellet
+CALLV
+pop
+LABELV $2494
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+LTI4 $2493
+LABELV $2492
+endproc CG_ShotgunPattern 84 12
+export CG_ShotgunFire
+proc CG_ShotgunFire 52 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 36
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1107296256
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2524
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $2525
+JUMPV
+LABELV $2524
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1147207680
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+180272+348
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $2525
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPattern
+CALLV
+pop
+LABELV $2513
+endproc CG_ShotgunFire 52 48
+export CG_Tracer
+proc CG_Tracer 236 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+CNSTI4 4
+ASGNI4
+ADDRLP4 108+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 8
+ASGNI4
+ADDRLP4 108+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2534
+ADDRGP4 $2531
+JUMPV
+LABELV $2534
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg_tracerLength+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $2537
+ADDRLP4 156
+ADDRLP4 164
+INDIRF4
+ASGNF4
+LABELV $2537
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+109252+36+12
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 144
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+ADDRLP4 144
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+180272+284
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 232
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 168
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 1056964608
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+808
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2531
+endproc CG_Tracer 236 16
+proc CG_CalcMuzzlePoint 40 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2719
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2718
+JUMPV
+LABELV $2719
+ADDRLP4 12
+CNSTI4 936
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2727
+CNSTI4 0
+RETI4
+ADDRGP4 $2718
+JUMPV
+LABELV $2727
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $2731
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $2729
+LABELV $2731
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $2730
+JUMPV
+LABELV $2729
+ADDRGP4 cg_enableQ+12
+INDIRI4
+CNSTI4 0
+EQI4 $2732
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1102053376
+ADDF4
+ASGNF4
+ADDRGP4 $2733
+JUMPV
+LABELV $2732
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $2733
+LABELV $2730
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2718
+endproc CG_CalcMuzzlePoint 40 16
+export CG_Bullet
+proc CG_Bullet 108 28
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2738
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+CNSTF4 0
+LEF4 $2738
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $2741
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2743
+ADDRLP4 100
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2743
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $2744
+JUMPV
+LABELV $2743
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2745
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 20+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2746
+ADDRLP4 76
+ADDRLP4 20+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 20+12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2746
+JUMPV
+LABELV $2745
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2753
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 20+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2756
+ADDRLP4 76
+ADDRLP4 20+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 20+12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $2756
+LABELV $2753
+LABELV $2746
+LABELV $2744
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+GEF4 $2761
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Tracer
+CALLV
+pop
+LABELV $2761
+LABELV $2741
+LABELV $2738
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2764
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2766
+CNSTI4 14
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2765
+JUMPV
+LABELV $2766
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+ADDRGP4 $2765
+JUMPV
+LABELV $2764
+CNSTI4 2
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2765
+LABELV $2737
+endproc CG_Bullet 108 28
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2216
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 87
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 85
+byte 1 77
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $1803
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1126
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1056
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $994
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $897
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $711
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $704
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $703
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $700
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $699
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $697
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $692
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $689
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $688
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $686
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $683
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $680
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 104
+byte 1 121
+byte 1 112
+byte 1 114
+byte 1 98
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $679
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $677
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $676
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $672
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $671
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $669
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $666
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $665
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $663
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $660
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $659
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $658
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $656
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $652
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $650
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $649
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $647
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $644
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $643
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $642
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $641
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $640
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $638
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $637
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $636
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 82
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $633
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $631
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $628
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $625
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $622
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $619
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $614
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $612
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $611
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $607
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $604
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $603
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $602
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $599
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $596
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $593
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $590
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $587
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $584
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $581
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $580
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $579
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $578
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $577
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $576
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $575
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $574
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $571
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $557
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
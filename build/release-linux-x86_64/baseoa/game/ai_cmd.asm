@@ -0,0 +1,10286 @@
+export BotGetItemTeamGoal
+code
+proc BotGetItemTeamGoal 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $62
+CNSTI4 0
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $64
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $67
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $69
+ADDRGP4 $65
+JUMPV
+LABELV $69
+CNSTI4 1
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $67
+LABELV $65
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $64
+CNSTI4 0
+RETI4
+LABELV $61
+endproc BotGetItemTeamGoal 12 12
+export BotGetMessageTeamGoal
+proc BotGetMessageTeamGoal 12 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotGetItemTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $72
+CNSTI4 1
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotFindWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $74
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $74
+CNSTI4 0
+RETI4
+LABELV $71
+endproc BotGetMessageTeamGoal 12 12
+export BotGetTime
+proc BotGetTime 600 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $77
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRLP4 588
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 588
+INDIRI4
+CNSTI4 0
+EQI4 $79
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 107
+NEI4 $81
+ADDRLP4 584
+CNSTF4 1287568416
+ASGNF4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 109
+NEI4 $84
+ADDRLP4 584
+CNSTF4 1142292480
+ASGNF4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 108
+NEI4 $87
+ADDRLP4 584
+CNSTF4 1155596288
+ASGNF4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 256
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 105
+NEI4 $90
+ADDRLP4 0
+ARGP4
+ADDRLP4 592
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 584
+CNSTF4 1114636288
+ADDRLP4 592
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 106
+NEI4 $93
+ADDRLP4 0
+ARGP4
+ADDRLP4 596
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 596
+INDIRF4
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 584
+CNSTF4 0
+ASGNF4
+LABELV $94
+LABELV $91
+LABELV $88
+LABELV $85
+LABELV $82
+ADDRLP4 584
+INDIRF4
+CNSTF4 0
+LEF4 $96
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDF4
+RETF4
+ADDRGP4 $76
+JUMPV
+LABELV $96
+LABELV $79
+LABELV $77
+CNSTF4 0
+RETF4
+LABELV $76
+endproc BotGetTime 600 16
+bss
+align 4
+LABELV $99
+skip 4
+export FindClientByName
+code
+proc FindClientByName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $99
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRGP4 $102
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $99
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $100
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $107
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $107
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $99
+INDIRI4
+GEI4 $109
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $103
+LABELV $109
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $114
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $114
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $99
+INDIRI4
+GEI4 $116
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $110
+LABELV $116
+CNSTI4 -1
+RETI4
+LABELV $98
+endproc FindClientByName 1040 12
+bss
+align 4
+LABELV $118
+skip 4
+export FindEnemyByName
+code
+proc FindEnemyByName 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $118
+INDIRI4
+CNSTI4 0
+NEI4 $119
+ADDRGP4 $102
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $118
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $119
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $125
+ADDRGP4 $122
+JUMPV
+LABELV $125
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $127
+LABELV $122
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $118
+INDIRI4
+GEI4 $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $121
+LABELV $129
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRGP4 $131
+JUMPV
+LABELV $134
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $136
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $136
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $118
+INDIRI4
+GEI4 $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $130
+LABELV $138
+CNSTI4 -1
+RETI4
+LABELV $117
+endproc FindEnemyByName 1044 12
+bss
+align 4
+LABELV $140
+skip 4
+export NumPlayersOnSameTeam
+code
+proc NumPlayersOnSameTeam 1048 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $140
+INDIRI4
+CNSTI4 0
+NEI4 $141
+ADDRGP4 $102
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $140
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $141
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $147
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $149
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+LABELV $147
+LABELV $144
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $146
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $140
+INDIRI4
+GEI4 $151
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $143
+LABELV $151
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $139
+endproc NumPlayersOnSameTeam 1048 12
+export BotGetPatrolWaypoints
+proc BotGetPatrolWaypoints 680 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 592
+CNSTP4 0
+ASGNP4
+ADDRLP4 652
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 8
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRLP4 656
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $156
+ADDRLP4 264
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRLP4 660
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $159
+ADDRLP4 8
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRLP4 596+12
+INDIRI4
+ARGI4
+ADDRLP4 664
+ADDRGP4 BotCreateWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $162
+ADDRGP4 $155
+JUMPV
+LABELV $162
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $164
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $167
+ADDRLP4 672
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 672
+INDIRU4
+EQU4 $168
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 672
+INDIRU4
+NEU4 $164
+LABELV $168
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $169
+ADDRLP4 592
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $170
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $171
+ADDRLP4 652
+CNSTI4 1
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $171
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $174
+ADDRLP4 652
+CNSTI4 2
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $174
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 264
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+LABELV $178
+LABELV $154
+ADDRGP4 $153
+JUMPV
+LABELV $155
+ADDRLP4 660
+CNSTU4 0
+ASGNU4
+ADDRLP4 592
+INDIRP4
+CVPU4 4
+ADDRLP4 660
+INDIRU4
+EQU4 $182
+ADDRLP4 592
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 660
+INDIRU4
+NEU4 $180
+LABELV $182
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $183
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 592
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+ADDRLP4 652
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $152
+endproc BotGetPatrolWaypoints 680 16
+export BotAddressedToBot
+proc BotAddressedToBot 1572 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 840
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 840
+ARGP4
+ADDRLP4 1228
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 1228
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+GEI4 $185
+CNSTI4 0
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $185
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $187
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 584
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1100
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 101
+NEI4 $192
+CNSTI4 1
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $192
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 102
+NEI4 $195
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 328
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 328
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+EQI4 $198
+ADDRLP4 1100
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1236
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $200
+CNSTI4 1
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1240
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1240
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $202
+CNSTI4 1
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $202
+LABELV $198
+ADDRLP4 0
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 584
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 328
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 328
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRLP4 1100
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1236
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $206
+CNSTI4 1
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1240
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1240
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $191
+CNSTI4 1
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $196
+LABELV $190
+ADDRLP4 584
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRLP4 1232
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $189
+LABELV $191
+CNSTI4 0
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $187
+ADDRLP4 1232+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 1560
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRLP4 1232+256
+INDIRI4
+CNSTI4 202
+EQI4 $211
+LABELV $214
+ADDRLP4 1564
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1568
+ADDRGP4 NumPlayersOnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1564
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDRLP4 1568
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+DIVF4
+LEF4 $215
+CNSTI4 0
+RETI4
+ADDRGP4 $184
+JUMPV
+LABELV $215
+LABELV $211
+CNSTI4 1
+RETI4
+LABELV $184
+endproc BotAddressedToBot 1572 16
+export BotGPSToPosition
+proc BotGPSToPosition 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $218
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $223
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $222
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $225
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $225
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $230
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+GTI4 $230
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $231
+LABELV $228
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+LABELV $229
+CNSTI4 1
+ARGI4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $219
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LTI4 $218
+CNSTI4 1
+RETI4
+LABELV $217
+endproc BotGPSToPosition 24 12
+export BotMatch_HelpAccompany
+proc BotMatch_HelpAccompany 1272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRGP4 $233
+JUMPV
+LABELV $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $236
+ADDRGP4 $233
+JUMPV
+LABELV $236
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 656
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRLP4 1256
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $238
+ADDRLP4 656+256
+INDIRI4
+CNSTI4 100
+NEI4 $238
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 260
+ARGP4
+ADDRLP4 1260
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $241
+ADDRLP4 984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1264
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $233
+JUMPV
+LABELV $243
+ADDRLP4 984
+CNSTI4 1
+ASGNI4
+LABELV $242
+LABELV $239
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $245
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $248
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $245
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $250
+ADDRGP4 $233
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+EQI4 $252
+ADDRLP4 516+24
+ARGP4
+ADDRLP4 1260
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 988
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 516+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $255
+LABELV $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $258
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $260
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 992
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 1264
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRGP4 $233
+JUMPV
+LABELV $262
+LABELV $260
+LABELV $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $264
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $267
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 1264
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 1264
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $271
+LABELV $233
+endproc BotMatch_HelpAccompany 1272 16
+export BotMatch_DefendKeyArea
+proc BotMatch_DefendKeyArea 544 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $277
+ADDRGP4 $276
+JUMPV
+LABELV $277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 $276
+JUMPV
+LABELV $279
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRGP4 $276
+JUMPV
+LABELV $281
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 540
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $276
+endproc BotMatch_DefendKeyArea 544 16
+export BotMatch_TakeA
+proc BotMatch_TakeA 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $286
+ADDRGP4 $285
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRGP4 $285
+JUMPV
+LABELV $288
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 272
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $285
+endproc BotMatch_TakeA 280 16
+export BotMatch_TakeB
+proc BotMatch_TakeB 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $293
+ADDRGP4 $292
+JUMPV
+LABELV $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $295
+ADDRGP4 $292
+JUMPV
+LABELV $295
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 272
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $292
+endproc BotMatch_TakeB 280 16
+export BotMatch_GetItem
+proc BotMatch_GetItem 540 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRGP4 $299
+JUMPV
+LABELV $300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $302
+ADDRGP4 $299
+JUMPV
+LABELV $302
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRGP4 $299
+JUMPV
+LABELV $304
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $299
+endproc BotMatch_GetItem 540 16
+export BotMatch_Camp
+proc BotMatch_Camp 688 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 660
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRGP4 $306
+JUMPV
+LABELV $307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+NEI4 $309
+ADDRGP4 $306
+JUMPV
+LABELV $309
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 668
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $311
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $315
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $317
+ADDRGP4 $306
+JUMPV
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRLP4 516+24
+ARGP4
+ADDRLP4 672
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 656
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 516+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $322
+LABELV $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $316
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 672
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 676
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $306
+JUMPV
+LABELV $327
+LABELV $316
+LABELV $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 680
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 680
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 684
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 684
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $306
+endproc BotMatch_Camp 688 16
+export BotMatch_Patrol
+proc BotMatch_Patrol 284 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $332
+ADDRGP4 $331
+JUMPV
+LABELV $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRGP4 $331
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotGetPatrolWaypoints
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRGP4 $331
+JUMPV
+LABELV $336
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 276
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $331
+endproc BotMatch_Patrol 284 16
+export BotMatch_GetFlag
+proc BotMatch_GetFlag 284 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 4
+EQI4 $343
+ADDRLP4 260
+INDIRI4
+CNSTI4 9
+NEI4 $341
+LABELV $343
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $348
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+NEI4 $342
+LABELV $348
+ADDRGP4 $340
+JUMPV
+LABELV $341
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $340
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $357
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $357
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+NEI4 $350
+LABELV $357
+ADDRGP4 $340
+JUMPV
+LABELV $350
+LABELV $342
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRGP4 $340
+JUMPV
+LABELV $358
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 272
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 4
+EQI4 $362
+ADDRLP4 276
+INDIRI4
+CNSTI4 9
+NEI4 $360
+LABELV $362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $360
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $340
+endproc BotMatch_GetFlag 284 16
+export BotMatch_AttackEnemyBase
+proc BotMatch_AttackEnemyBase 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 4
+EQI4 $366
+ADDRLP4 260
+INDIRI4
+CNSTI4 9
+NEI4 $364
+LABELV $366
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotMatch_GetFlag
+CALLV
+pop
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 264
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 5
+EQI4 $370
+ADDRLP4 264
+INDIRI4
+CNSTI4 6
+EQI4 $370
+ADDRLP4 264
+INDIRI4
+CNSTI4 7
+NEI4 $363
+LABELV $370
+ADDRLP4 268
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 268
+INDIRI4
+EQI4 $375
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 268
+INDIRI4
+NEI4 $368
+LABELV $375
+ADDRGP4 $363
+JUMPV
+LABELV $368
+LABELV $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $376
+ADDRGP4 $363
+JUMPV
+LABELV $376
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 276
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $363
+endproc BotMatch_AttackEnemyBase 280 16
+export BotMatch_Harvest
+proc BotMatch_Harvest 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $378
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $387
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $387
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+NEI4 $380
+LABELV $387
+ADDRGP4 $378
+JUMPV
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRGP4 $378
+JUMPV
+LABELV $388
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $378
+endproc BotMatch_Harvest 272 16
+export BotMatch_RushBase
+proc BotMatch_RushBase 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 4
+EQI4 $393
+ADDRLP4 260
+INDIRI4
+CNSTI4 9
+NEI4 $391
+LABELV $393
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+EQI4 $398
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 264
+INDIRI4
+NEI4 $392
+LABELV $398
+ADDRGP4 $390
+JUMPV
+LABELV $391
+ADDRLP4 264
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 5
+EQI4 $401
+ADDRLP4 264
+INDIRI4
+CNSTI4 7
+NEI4 $390
+LABELV $401
+ADDRLP4 268
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 268
+INDIRI4
+EQI4 $406
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 268
+INDIRI4
+NEI4 $400
+LABELV $406
+ADDRGP4 $390
+JUMPV
+LABELV $400
+LABELV $392
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $390
+JUMPV
+LABELV $407
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 276
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $390
+endproc BotMatch_RushBase 280 16
+export BotMatch_TaskPreference
+proc BotMatch_TaskPreference 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRGP4 $409
+JUMPV
+LABELV $410
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 304
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $412
+ADDRGP4 $409
+JUMPV
+LABELV $412
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $417
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $418
+ADDRLP4 312
+INDIRI4
+CNSTI4 4
+EQI4 $419
+ADDRGP4 $414
+JUMPV
+LABELV $417
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $418
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $419
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -4
+BANDI4
+ASGNI4
+LABELV $414
+LABELV $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSetTeamMateTaskPreference
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $421
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $409
+endproc BotMatch_TaskPreference 320 16
+export BotMatch_ReturnFlag
+proc BotMatch_ReturnFlag 276 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 4
+EQI4 $423
+ADDRLP4 260
+INDIRI4
+CNSTI4 9
+EQI4 $423
+ADDRLP4 260
+INDIRI4
+CNSTI4 5
+EQI4 $423
+ADDRGP4 $422
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $425
+ADDRGP4 $422
+JUMPV
+LABELV $425
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 272
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $422
+endproc BotMatch_ReturnFlag 276 16
+export BotMatch_JoinSubteam
+proc BotMatch_JoinSubteam 528 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRGP4 $427
+JUMPV
+LABELV $430
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7011
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 524
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $427
+endproc BotMatch_JoinSubteam 528 16
+export BotMatch_LeaveSubteam
+proc BotMatch_LeaveSubteam 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $434
+ADDRGP4 $433
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $436
+ADDRGP4 $433
+JUMPV
+LABELV $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $440
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRGP4 $441
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $433
+endproc BotMatch_LeaveSubteam 280 16
+export BotMatch_WhichTeam
+proc BotMatch_WhichTeam 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $443
+ADDRGP4 $442
+JUMPV
+LABELV $443
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $445
+ADDRGP4 $442
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $449
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $450
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $442
+endproc BotMatch_WhichTeam 16 16
+export BotMatch_CheckPoint
+proc BotMatch_CheckPoint 572 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 536
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $451
+JUMPV
+LABELV $452
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 540
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 544
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 532
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 $456
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4+4
+ARGP4
+ADDRLP4 4+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 548
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $464
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $460
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotFindWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $465
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $467
+ADDRLP4 560
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $467
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $469
+ADDRLP4 568
+CNSTI4 92
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $470
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $465
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 556
+ADDRGP4 BotCreateWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 556
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $476
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $473
+LABELV $451
+endproc BotMatch_CheckPoint 572 24
+export BotMatch_FormationSpace
+proc BotMatch_FormationSpace 280 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $478
+ADDRGP4 $477
+JUMPV
+LABELV $478
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $480
+ADDRGP4 $477
+JUMPV
+LABELV $480
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $482
+ADDRLP4 4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1092357823
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 4
+ARGP4
+ADDRLP4 272
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1107296256
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+LABELV $483
+ADDRLP4 0
+INDIRF4
+CNSTF4 1111490560
+LTF4 $486
+ADDRLP4 0
+INDIRF4
+CNSTF4 1140457472
+LEF4 $484
+LABELV $486
+ADDRLP4 0
+CNSTF4 1120403456
+ASGNF4
+LABELV $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $477
+endproc BotMatch_FormationSpace 280 16
+export BotMatch_Dismiss
+proc BotMatch_Dismiss 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 $487
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $490
+ADDRGP4 $487
+JUMPV
+LABELV $490
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $492
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $487
+endproc BotMatch_Dismiss 272 16
+export BotMatch_Suicide
+proc BotMatch_Suicide 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $494
+ADDRGP4 $493
+JUMPV
+LABELV $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $496
+ADDRGP4 $493
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $498
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRGP4 $499
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $493
+endproc BotMatch_Suicide 272 16
+export BotMatch_StartTeamLeaderShip
+proc BotMatch_StartTeamLeaderShip 268 16
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRGP4 $500
+JUMPV
+LABELV $501
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $503
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+LTI4 $505
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+LABELV $505
+LABELV $504
+LABELV $500
+endproc BotMatch_StartTeamLeaderShip 268 16
+export BotMatch_StopTeamLeaderShip
+proc BotMatch_StopTeamLeaderShip 528 16
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $508
+ADDRGP4 $507
+JUMPV
+LABELV $508
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $510
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 520
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 4
+ARGP4
+ADDRLP4 520
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+LABELV $511
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $512
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 520
+ADDRGP4 ClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 520
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $514
+LABELV $512
+LABELV $507
+endproc BotMatch_StopTeamLeaderShip 528 16
+export BotMatch_WhoIsTeamLeader
+proc BotMatch_WhoIsTeamLeader 264 12
+ADDRLP4 256
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $517
+ADDRGP4 $516
+JUMPV
+LABELV $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $521
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+LABELV $519
+LABELV $516
+endproc BotMatch_WhoIsTeamLeader 264 12
+export BotMatch_WhatAreYouDoing
+proc BotMatch_WhatAreYouDoing 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRLP4 520
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 1
+LTI4 $525
+ADDRLP4 520
+INDIRI4
+CNSTI4 17
+GTI4 $525
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $557-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $557
+address $528
+address $530
+address $532
+address $542
+address $544
+address $546
+address $538
+address $538
+address $540
+address $534
+address $536
+address $550
+address $548
+address $525
+address $525
+address $552
+address $554
+code
+LABELV $528
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $529
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $533
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $539
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $541
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $543
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $545
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $549
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $551
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $552
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $554
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $555
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $556
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $526
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 528
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $522
+endproc BotMatch_WhatAreYouDoing 532 16
+export BotMatch_WhatIsMyCommand
+proc BotMatch_WhatIsMyCommand 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRGP4 $559
+JUMPV
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $559
+endproc BotMatch_WhatIsMyCommand 40 12
+export BotNearestVisibleItem
+proc BotNearestVisibleItem 252 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 68
+CNSTI4 -1
+ASGNI4
+LABELV $563
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $567
+ADDRGP4 $564
+JUMPV
+LABELV $567
+ADDRLP4 56
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+GEF4 $573
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $575
+ADDRLP4 140
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $575
+LABELV $573
+LABELV $564
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GTI4 $563
+ADDRLP4 140
+INDIRF4
+RETF4
+LABELV $562
+endproc BotNearestVisibleItem 252 28
+lit
+align 4
+LABELV $579
+address $580
+address $581
+address $582
+address $583
+address $584
+address $585
+address $586
+address $587
+address $588
+address $589
+address $590
+address $591
+address $592
+address $593
+address $594
+address $595
+address $596
+address $597
+address $598
+address $599
+address $600
+address $601
+address $602
+address $603
+address $604
+address $605
+address $606
+address $607
+byte 4 0
+export BotMatch_WhereAreYou
+code
+proc BotMatch_WhereAreYou 496 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 $579
+INDIRB
+ASGNB 116
+ADDRLP4 456
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $608
+ADDRGP4 $578
+JUMPV
+LABELV $608
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 460
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $610
+ADDRGP4 $578
+JUMPV
+LABELV $610
+ADDRLP4 184
+CNSTI4 -1
+ASGNI4
+ADDRLP4 124
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $612
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 464
+ADDRGP4 BotNearestVisibleItem
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 464
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+GEF4 $616
+ADDRLP4 124
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $616
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $612
+ADDRLP4 184
+INDIRI4
+CNSTI4 -1
+EQI4 $618
+ADDRLP4 464
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 4
+EQI4 $623
+ADDRLP4 464
+INDIRI4
+CNSTI4 9
+EQI4 $623
+ADDRLP4 464
+INDIRI4
+CNSTI4 5
+NEI4 $620
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 444
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 484
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 484
+INDIRI4
+ADDRLP4 448
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $626
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $629
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $621
+JUMPV
+LABELV $626
+ADDRLP4 488
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 444
+INDIRI4
+ADDRLP4 488
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $632
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $621
+JUMPV
+LABELV $630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRLP4 468
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 6
+EQI4 $636
+ADDRLP4 468
+INDIRI4
+CNSTI4 7
+NEI4 $634
+LABELV $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 444
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRLP4 488
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 488
+INDIRI4
+ADDRLP4 448
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $629
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $635
+JUMPV
+LABELV $639
+ADDRLP4 492
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 492
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 444
+INDIRI4
+ADDRLP4 492
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $641
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $632
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $635
+JUMPV
+LABELV $641
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $635
+LABELV $621
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 188
+ARGP4
+ADDRLP4 472
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 452
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 452
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $618
+LABELV $578
+endproc BotMatch_WhereAreYou 496 20
+export BotMatch_LeadTheWay
+proc BotMatch_LeadTheWay 680 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 664
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+NEI4 $644
+ADDRGP4 $643
+JUMPV
+LABELV $644
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 668
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 668
+INDIRI4
+CNSTI4 0
+NEI4 $646
+ADDRGP4 $643
+JUMPV
+LABELV $646
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $648
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 400
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 400
+ARGP4
+ADDRLP4 672
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $650
+ADDRLP4 656
+CNSTI4 0
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $650
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 676
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $652
+ADDRGP4 $643
+JUMPV
+LABELV $652
+ADDRLP4 656
+CNSTI4 1
+ASGNI4
+ADDRGP4 $649
+JUMPV
+LABELV $648
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 144
+ARGP4
+ADDRLP4 672
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 656
+CNSTI4 0
+ASGNI4
+LABELV $649
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $654
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $643
+JUMPV
+LABELV $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $656
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 672
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 660
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ADDRLP4 4+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $659
+LABELV $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $662
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 400
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $665
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $643
+JUMPV
+LABELV $662
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6888
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 672
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 672
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+NEGF4
+ASGNF4
+LABELV $643
+endproc BotMatch_LeadTheWay 680 16
+export BotMatch_Kill
+proc BotMatch_Kill 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $667
+ADDRGP4 $666
+JUMPV
+LABELV $667
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $669
+ADDRGP4 $666
+JUMPV
+LABELV $669
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 524
+ADDRGP4 FindEnemyByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $671
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 528
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $666
+JUMPV
+LABELV $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 528
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $666
+endproc BotMatch_Kill 532 16
+export BotMatch_CTF
+proc BotMatch_CTF 180 16
+ADDRLP4 164
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+EQI4 $676
+ADDRLP4 164
+INDIRI4
+CNSTI4 9
+NEI4 $674
+LABELV $676
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $677
+ADDRLP4 0
+ARGP4
+ADDRGP4 $629
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+NEI4 $680
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 176
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 $680
+JUMPV
+LABELV $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $683
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 176
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $683
+LABELV $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $675
+JUMPV
+LABELV $677
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $685
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $675
+ADDRLP4 0
+ARGP4
+ADDRGP4 $629
+ARGP4
+ADDRLP4 168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $690
+JUMPV
+LABELV $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $690
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $691
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+CNSTI4 0
+EQI4 $693
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 168
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+LABELV $693
+LABELV $691
+LABELV $675
+LABELV $673
+endproc BotMatch_CTF 180 16
+export BotMatch_EnterGame
+proc BotMatch_EnterGame 44 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $696
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $696
+LABELV $695
+endproc BotMatch_EnterGame 44 16
+export BotMatch_NewLeader
+proc BotMatch_NewLeader 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $699
+ADDRGP4 $698
+JUMPV
+LABELV $699
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $698
+endproc BotMatch_NewLeader 48 16
+export BotMatchMessage
+proc BotMatchMessage 344 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 774
+ARGU4
+ADDRLP4 328
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $703
+CNSTI4 0
+RETI4
+ADDRGP4 $701
+JUMPV
+LABELV $703
+ADDRLP4 332
+ADDRLP4 0+256
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 90
+EQI4 $742
+ADDRLP4 336
+CNSTI4 91
+ASGNI4
+ADDRLP4 332
+INDIRI4
+ADDRLP4 336
+INDIRI4
+EQI4 $743
+ADDRLP4 332
+INDIRI4
+ADDRLP4 336
+INDIRI4
+GTI4 $746
+LABELV $745
+ADDRLP4 340
+ADDRLP4 0+256
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 1
+LTI4 $705
+ADDRLP4 340
+INDIRI4
+CNSTI4 33
+GTI4 $705
+ADDRLP4 340
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $747-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $747
+address $739
+address $738
+address $708
+address $708
+address $709
+address $715
+address $712
+address $730
+address $731
+address $732
+address $706
+address $733
+address $720
+address $721
+address $724
+address $726
+address $727
+address $706
+address $729
+address $710
+address $723
+address $711
+address $736
+address $719
+address $737
+address $735
+address $716
+address $734
+address $722
+address $717
+address $713
+address $714
+address $741
+code
+LABELV $746
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 300
+EQI4 $718
+ADDRGP4 $705
+JUMPV
+LABELV $708
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_HelpAccompany
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $709
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_DefendKeyArea
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $710
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Camp
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $711
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Patrol
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $712
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetFlag
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_AttackEnemyBase
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $714
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Harvest
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $715
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_RushBase
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $716
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_ReturnFlag
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $717
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_TaskPreference
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CTF
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $719
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetItem
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $720
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_JoinSubteam
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $721
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_LeaveSubteam
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $722
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhichTeam
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $723
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CheckPoint
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $724
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $725
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $725
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_FormationSpace
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $729
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Dismiss
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_StartTeamLeaderShip
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $731
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_StopTeamLeaderShip
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $732
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhoIsTeamLeader
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $733
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhatAreYouDoing
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $734
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhatIsMyCommand
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $735
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhereAreYou
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $736
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_LeadTheWay
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Kill
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $738
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_EnterGame
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $739
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_NewLeader
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Suicide
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_TakeA
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_TakeB
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $705
+CNSTI4 1
+ARGI4
+ADDRGP4 $744
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $706
+CNSTI4 1
+RETI4
+LABELV $701
+endproc BotMatchMessage 344 12
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+bss
+export notleader
+align 4
+LABELV notleader
+skip 256
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $744
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $725
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $633
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $632
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $629
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $628
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $607
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $606
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $605
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $604
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $603
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $602
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $601
+byte 1 71
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $600
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $599
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $598
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $597
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $596
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $595
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $594
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $593
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $592
+byte 1 70
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $591
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $590
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $589
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $588
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $587
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $586
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $585
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $584
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $583
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $582
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $581
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $580
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $556
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $555
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 0
+align 1
+LABELV $553
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $551
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $549
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $547
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $545
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $543
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $541
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $539
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $537
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $535
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $533
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $531
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $529
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $521
+byte 1 73
+byte 1 39
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $499
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $498
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $492
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $476
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 0
+align 1
+LABELV $475
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 0
+align 1
+LABELV $464
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $456
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $450
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $449
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $441
+byte 1 0
+align 1
+LABELV $440
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $432
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $421
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $420
+byte 1 107
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $269
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 0
+align 1
+LABELV $268
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $249
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $232
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $158
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 63
+byte 1 0
+align 1
+LABELV $102
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
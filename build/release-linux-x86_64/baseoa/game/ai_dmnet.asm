@@ -0,0 +1,18213 @@
+export BotResetNodeSwitches
+code
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $61
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $63
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $67
+JUMPV
+LABELV $64
+CNSTI4 1
+ARGI4
+ADDRGP4 $68
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $65
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $67
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $64
+CNSTI4 4
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $62
+endproc BotDumpNodeSwitches 40 20
+export BotRecordNodeSwitch
+proc BotRecordNodeSwitch 44 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $71
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 40
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $70
+endproc BotRecordNodeSwitch 44 32
+lit
+align 4
+LABELV $73
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $74
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+export BotGetAirGoal
+code
+proc BotGetAirGoal 140 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRGP4 $73
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRGP4 $74
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $77
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $72
+JUMPV
+LABELV $81
+LABELV $77
+CNSTI4 0
+RETI4
+LABELV $72
+endproc BotGetAirGoal 140 28
+export BotGoForAir
+proc BotGoForAir 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+GEF4 $85
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $89
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $92
+CNSTI4 1
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+LABELV $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $89
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $85
+CNSTI4 0
+RETI4
+LABELV $84
+endproc BotGoForAir 68 24
+export BotNearbyGoal
+proc BotNearbyGoal 20 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $95
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $95
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 300
+GEI4 $99
+ADDRFP4 12
+CNSTF4 1112014848
+ASGNF4
+LABELV $99
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $94
+endproc BotNearbyGoal 20 24
+export BotReachedGoal
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $104
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $106
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $108
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $103
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $103
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $103
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $103
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $103
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $102
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $120
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $119
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $124
+CNSTI4 1
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $124
+LABELV $119
+LABELV $103
+CNSTI4 0
+RETI4
+LABELV $101
+endproc BotReachedGoal 40 16
+export BotGetItemLongTermGoal
+proc BotGetItemLongTermGoal 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $128
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $129
+LABELV $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $133
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $126
+JUMPV
+LABELV $131
+CNSTI4 1
+RETI4
+LABELV $126
+endproc BotGetItemLongTermGoal 20 16
+export BotGetLongTermGoal
+proc BotGetLongTermGoal 684 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $136
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $138
+ADDRLP4 620
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $146
+ADDRLP4 4
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1176256512
+GEF4 $147
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $147
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $157
+ADDRLP4 272+24
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 272+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $160
+LABELV $157
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $163
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $165
+ADDRLP4 620
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+GEF4 $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 452
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+84+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+72+8
+INDIRF4
+ADDF4
+LEF4 $182
+ADDRLP4 644
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24
+INDIRF4
+ADDRLP4 452+84
+INDIRF4
+ADDF4
+ADDRLP4 272+24
+INDIRF4
+ADDRLP4 272+72
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+LEF4 $192
+ADDRLP4 452+24
+INDIRF4
+ADDRLP4 452+72
+INDIRF4
+ADDF4
+ADDRLP4 272+24
+INDIRF4
+ADDRLP4 272+84
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+GEF4 $192
+ADDRLP4 648
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24+4
+INDIRF4
+ADDRLP4 452+84+4
+INDIRF4
+ADDF4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRLP4 272+72+4
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+LEF4 $202
+ADDRLP4 452+24+4
+INDIRF4
+ADDRLP4 452+72+4
+INDIRF4
+ADDF4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRLP4 272+84+4
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+ADDF4
+GEF4 $202
+ADDRLP4 652
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+84+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+72+8
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+LEF4 $220
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+72+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+84+8
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+ADDF4
+GEF4 $220
+ADDRLP4 272+36
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 656
+CNSTP4 0
+ASGNP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 608
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 272+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 272+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 272+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 608+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 608+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LEF4 $247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 608
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $247
+LABELV $220
+LABELV $202
+LABELV $192
+LABELV $182
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 644
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 644
+INDIRF4
+ASGNF4
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+GEF4 $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $255
+LABELV $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 648
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 648
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1028443341
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $266
+LABELV $265
+LABELV $262
+LABELV $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $268
+ADDRLP4 4
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 652
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $277
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 592
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 592+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 592+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 656
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 656
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $277
+LABELV $269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 656
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $180
+LABELV $171
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 272+24
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $289
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 272+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $289
+LABELV $286
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 632
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $292
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+INDIRF4
+LEF4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $297
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $299
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $301
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $303
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $301
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1167663104
+GEF4 $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 640
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 640
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $309
+LABELV $306
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $310
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $312
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $312
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 640
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+INDIRF4
+CNSTF4 1167663104
+GEF4 $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 648
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $320
+LABELV $317
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $321
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $321
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $323
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $323
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $323
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $327
+ADDRLP4 4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 644
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 1167663104
+GEF4 $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 652
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 652
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $335
+LABELV $332
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $336
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $338
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+NEI4 $341
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $341
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $344
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $346
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $346
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $348
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $350
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $348
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $351
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $351
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $356
+LABELV $354
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $346
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 7
+EQI4 $361
+ADDRLP4 632
+INDIRI4
+CNSTI4 8
+NEI4 $359
+LABELV $361
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $359
+ADDRLP4 636
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 0
+EQF4 $362
+ADDRLP4 636
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 640
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $366
+ARGP4
+ADDRLP4 640
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $362
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $367
+ADDRLP4 4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 648
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 648
+INDIRF4
+CNSTF4 1163984896
+GEF4 $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 652
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 652
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $381
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $376
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 592
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 592+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 592+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 660
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 660
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 660
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 656
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 656
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+GEF4 $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $390
+LABELV $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 664
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $371
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $400
+LABELV $398
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 6188
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $402
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $374
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $404
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $404
+ADDRLP4 636
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 0
+EQF4 $406
+ADDRLP4 636
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $406
+ADDRLP4 16
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $411
+JUMPV
+LABELV $408
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $412
+ADDRLP4 16
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $412
+LABELV $409
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $411
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $415
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $422
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+ADDRLP4 648
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $421
+JUMPV
+LABELV $422
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+ADDRLP4 648
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+ADDRLP4 652
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $424
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+ADDRLP4 648
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 648
+INDIRP4
+ADDRLP4 648
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+ADDRLP4 652
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $425
+LABELV $421
+LABELV $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $426
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $428
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $429
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $404
+ADDRLP4 636
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 4
+EQI4 $433
+ADDRLP4 636
+INDIRI4
+CNSTI4 9
+NEI4 $431
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $434
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 640
+INDIRF4
+CNSTF4 0
+EQF4 $436
+ADDRLP4 640
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 644
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 1
+EQI4 $443
+ADDRLP4 644
+INDIRI4
+CNSTI4 2
+EQI4 $444
+ADDRGP4 $440
+JUMPV
+LABELV $443
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $444
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 660
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 1
+EQI4 $450
+ADDRLP4 660
+INDIRI4
+CNSTI4 2
+EQI4 $451
+ADDRGP4 $447
+JUMPV
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $448
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $447
+LABELV $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $454
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 644
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 1
+EQI4 $459
+ADDRLP4 644
+INDIRI4
+CNSTI4 2
+EQI4 $460
+ADDRGP4 $456
+JUMPV
+LABELV $459
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $457
+JUMPV
+LABELV $460
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 668
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 668
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $468
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $432
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 0
+EQF4 $471
+ADDRLP4 644
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+EQI4 $478
+ADDRLP4 648
+INDIRI4
+CNSTI4 2
+EQI4 $479
+ADDRGP4 $475
+JUMPV
+LABELV $478
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $476
+JUMPV
+LABELV $479
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $482
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $431
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $484
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $486
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 640
+INDIRF4
+CNSTF4 0
+EQF4 $488
+ADDRLP4 640
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $488
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $492
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 640
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 1
+EQI4 $499
+ADDRLP4 640
+INDIRI4
+CNSTI4 2
+EQI4 $500
+ADDRGP4 $496
+JUMPV
+LABELV $499
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $500
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $505
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $507
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $507
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 0
+EQF4 $509
+ADDRLP4 644
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $511
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $512
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+EQI4 $516
+ADDRLP4 648
+INDIRI4
+CNSTI4 2
+EQI4 $517
+ADDRGP4 $513
+JUMPV
+LABELV $516
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $517
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $518
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $520
+ADDRLP4 664
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 664
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $520
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $507
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $485
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 0
+EQF4 $524
+ADDRLP4 644
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $524
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $524
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $526
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $526
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $484
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $528
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $529
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 0
+EQF4 $532
+ADDRLP4 644
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $511
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $512
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+EQI4 $537
+ADDRLP4 648
+INDIRI4
+CNSTI4 2
+EQI4 $538
+ADDRGP4 $534
+JUMPV
+LABELV $537
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $538
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 660
+INDIRF4
+CNSTF4 1112014848
+LEF4 $539
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $539
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRLP4 668
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 668
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $541
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 676
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 676
+INDIRF4
+CNSTF4 1163984896
+GEF4 $545
+ADDRLP4 680
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 680
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $545
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $547
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $547
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $528
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $549
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 640
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 1
+EQI4 $556
+ADDRLP4 640
+INDIRI4
+CNSTI4 2
+EQI4 $557
+ADDRGP4 $553
+JUMPV
+LABELV $556
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $557
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $554
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+NEI4 $558
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $558
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $560
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $564
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 644
+INDIRF4
+CNSTF4 0
+EQF4 $566
+ADDRLP4 644
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $566
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $511
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $512
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $566
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+EQI4 $571
+ADDRLP4 648
+INDIRI4
+CNSTI4 2
+EQI4 $572
+ADDRGP4 $568
+JUMPV
+LABELV $571
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $572
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRLP4 664
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CNSTF4 1084227584
+ADDRLP4 664
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $575
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $577
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $577
+ADDRLP4 648
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 648
+INDIRF4
+CNSTF4 0
+EQF4 $579
+ADDRLP4 648
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $581
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $512
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $579
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 656
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1077936128
+ADDRLP4 656
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $584
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $577
+LABELV $549
+LABELV $529
+LABELV $485
+LABELV $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+RETI4
+LABELV $135
+endproc BotGetLongTermGoal 684 20
+export BotLongTermGoal
+proc BotLongTermGoal 448 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $587
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $589
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 416
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 416
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+RETI4
+ADDRGP4 $586
+JUMPV
+LABELV $589
+ADDRLP4 416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 416
+INDIRF4
+CNSTF4 0
+GEF4 $592
+ADDRLP4 416
+INDIRF4
+NEGF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 420
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 420
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 412
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRLP4 424
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRLP4 424
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $598
+LABELV $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 424
+INDIRF4
+CNSTF4 0
+EQF4 $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 6888
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 6888
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $603
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 436
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 408
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $607
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 440
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $609
+ADDRLP4 408
+INDIRF4
+CNSTF4 1176256512
+GEF4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $611
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $586
+JUMPV
+LABELV $607
+ADDRLP4 408
+INDIRF4
+CNSTF4 1215570944
+LEF4 $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 440
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $615
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 444
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $586
+JUMPV
+LABELV $613
+LABELV $587
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 416
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+RETI4
+LABELV $586
+endproc BotLongTermGoal 448 20
+export AIEnter_Intermission
+proc AIEnter_Intermission 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $625
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $624
+endproc AIEnter_Intermission 8 16
+export AINode_Intermission
+proc AINode_Intermission 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $629
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $633
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $629
+CNSTI4 1
+RETI4
+LABELV $628
+endproc AINode_Intermission 16 8
+export AIEnter_Observer
+proc AIEnter_Observer 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $635
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $634
+endproc AIEnter_Observer 0 16
+export AINode_Observer
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $637
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $639
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $637
+CNSTI4 1
+RETI4
+LABELV $636
+endproc AINode_Observer 4 8
+export AIEnter_Stand
+proc AIEnter_Stand 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $641
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $640
+endproc AIEnter_Stand 0 16
+export AINode_Stand
+proc AINode_Stand 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $643
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_HitTalking
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+LABELV $645
+LABELV $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $647
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $642
+JUMPV
+LABELV $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $642
+JUMPV
+LABELV $652
+CNSTI4 1
+RETI4
+LABELV $642
+endproc AINode_Stand 24 12
+export AIEnter_Respawn
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $656
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $657
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $658
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+LABELV $655
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $662
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $664
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $661
+JUMPV
+LABELV $662
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $665
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $667
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $667
+LABELV $665
+LABELV $661
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $669
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $669
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+LABELV $669
+CNSTI4 1
+RETI4
+LABELV $659
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 88 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $672
+CNSTI4 2
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $672
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $674
+CNSTI4 3
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $674
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $676
+CNSTI4 8
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $676
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $678
+CNSTI4 6
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $678
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 5064
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $680
+CNSTI4 13
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $680
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $682
+ADDRFP4 0
+INDIRP4
+CNSTI4 5056
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $682
+CNSTI4 11
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $682
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $684
+ADDRFP4 0
+INDIRP4
+CNSTI4 5060
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $684
+CNSTI4 12
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $684
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $686
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $686
+CNSTI4 4
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $686
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $688
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $688
+CNSTI4 7
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $688
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $690
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $690
+CNSTI4 5
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $690
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LEI4 $692
+CNSTI4 9
+RETI4
+ADDRGP4 $671
+JUMPV
+LABELV $692
+CNSTI4 -1
+RETI4
+LABELV $671
+endproc BotSelectActivateWeapon 88 0
+export BotClearPath
+proc BotClearPath 376 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $697
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 236
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 236+8
+ADDRLP4 236+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 236
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 236+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 236+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $706
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $706
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $708
+ADDRLP4 340
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $710
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRLP4 248
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 352
+CNSTP4 0
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $718
+ADDRLP4 248+80
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $714
+LABELV $718
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $714
+LABELV $712
+LABELV $710
+LABELV $708
+LABELV $697
+LABELV $695
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $719
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $719
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $721
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $721
+ADDRLP4 228
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 232
+CNSTI4 -1
+ASGNI4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRGP4 $726
+JUMPV
+LABELV $723
+ADDRLP4 220
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 12+12+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+12+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+12+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 336
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+GEF4 $737
+ADDRLP4 228
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 220
+INDIRI4
+ASGNI4
+LABELV $737
+LABELV $724
+ADDRLP4 220
+ADDRLP4 220
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $726
+ADDRLP4 220
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+LTI4 $723
+ADDRLP4 232
+INDIRI4
+CNSTI4 -1
+EQI4 $739
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 236
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 236+8
+ADDRLP4 236+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 236
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 236+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 236+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $748
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $748
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $750
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $750
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $751
+JUMPV
+LABELV $750
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $752
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $752
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $753
+LABELV $751
+LABELV $749
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $754
+ADDRLP4 360
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $756
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $758
+ADDRLP4 248
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $764
+ADDRLP4 248+80
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $760
+LABELV $764
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $760
+LABELV $758
+LABELV $756
+LABELV $754
+LABELV $739
+LABELV $721
+LABELV $694
+endproc BotClearPath 376 28
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $766
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $765
+endproc AIEnter_Seek_ActivateEntity 0 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 380 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $768
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $770
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $768
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $771
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $773
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $771
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $774
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $776
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $777
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+ADDRLP4 332
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $777
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $780
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $780
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $782
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $784
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $782
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 344
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 344
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+EQI4 $785
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 356
+CNSTP4 0
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $791
+ADDRLP4 72+80
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $787
+LABELV $791
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $792
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 368
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 368
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 308
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 308
+ARGP4
+ADDRLP4 376
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $796
+LABELV $792
+LABELV $787
+LABELV $785
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $798
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 156+24
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $800
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $800
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $803
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $805
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $805
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $807
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $803
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $798
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $808
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $810
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $812
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $812
+LABELV $810
+LABELV $809
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $814
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $816
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $816
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $818
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $814
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $819
+CNSTI4 0
+RETI4
+ADDRGP4 $767
+JUMPV
+LABELV $819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $821
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $821
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $799
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $823
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $825
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $825
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $832
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $836
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $836
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $832
+LABELV $823
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $839
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $843
+ADDRLP4 352
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $844
+JUMPV
+LABELV $843
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $854
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $855
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $852
+LABELV $844
+LABELV $840
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $861
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $861
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 352
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $865
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $869
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $869
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $868
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+LABELV $865
+CNSTI4 1
+RETI4
+LABELV $767
+endproc AINode_Seek_ActivateEntity 380 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $871
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $872
+JUMPV
+LABELV $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRGP4 $875
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $872
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $870
+endproc AIEnter_Seek_NBG 204 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $877
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $879
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $876
+JUMPV
+LABELV $877
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $880
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $882
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $876
+JUMPV
+LABELV $880
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $883
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $885
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $876
+JUMPV
+LABELV $883
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $886
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $886
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $889
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $889
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $891
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $893
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $895
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $895
+LABELV $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $897
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1028443341
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $899
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $876
+JUMPV
+LABELV $897
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $900
+CNSTI4 0
+RETI4
+ADDRGP4 $876
+JUMPV
+LABELV $900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $902
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $904
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $908
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $909
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 184
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $917
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $919
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+LABELV $919
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $921
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $922
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 188
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $917
+LABELV $909
+LABELV $905
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $928
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $928
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 176
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $935
+JUMPV
+LABELV $934
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $935
+LABELV $932
+CNSTI4 1
+RETI4
+LABELV $876
+endproc AINode_Seek_NBG 192 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $938
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $941
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $941
+ARGP4
+ADDRGP4 $875
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $939
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $937
+endproc AIEnter_Seek_LTG 204 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $943
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $945
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $943
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $948
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $949
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $951
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $949
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotChat_Random
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $954
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $952
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $955
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $955
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $958
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $958
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $960
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $960
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $962
+ADDRLP4 168
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $964
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $964
+LABELV $962
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $966
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $970
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $970
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $966
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $971
+CNSTI4 1
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $973
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWantsToCamp
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $975
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $976
+JUMPV
+LABELV $975
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $976
+ADDRLP4 180
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 4
+EQI4 $979
+ADDRLP4 180
+INDIRI4
+CNSTI4 9
+NEI4 $977
+LABELV $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $978
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $978
+JUMPV
+LABELV $977
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $982
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $983
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRGP4 $983
+JUMPV
+LABELV $982
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $986
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $988
+ADDRLP4 108
+CNSTI4 80
+ASGNI4
+LABELV $988
+LABELV $986
+LABELV $983
+LABELV $978
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $990
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $992
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $990
+LABELV $973
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $993
+CNSTI4 0
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $993
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $995
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $997
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $998
+JUMPV
+LABELV $997
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1001
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $1002
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 196
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1010
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1012
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1013
+JUMPV
+LABELV $1012
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 0
+EQF4 $1018
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1019
+JUMPV
+LABELV $1018
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $1022
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1022
+LABELV $1019
+LABELV $1013
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1010
+LABELV $1002
+LABELV $998
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1028
+CNSTI4 1
+RETI4
+LABELV $942
+endproc AINode_Seek_LTG 212 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $1032
+endproc AIEnter_Battle_Fight 4 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $1034
+endproc AIEnter_Battle_SuicidalFight 4 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 292 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1038
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1041
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1039
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $1042
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1044
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1042
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+EQI4 $1045
+LABELV $1045
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1047
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1049
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1050
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1051
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1054
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $1054
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+NEI4 $1056
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotChat_Kill
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $1056
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $1057
+JUMPV
+LABELV $1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1058
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $1057
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1050
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $1059
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1059
+LABELV $1051
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $1061
+ADDRLP4 0
+ARGP4
+ADDRLP4 232
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRLP4 236
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1045220557
+GEF4 $1063
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1065
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1063
+LABELV $1061
+ADDRLP4 196
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1067
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1073
+ADDRLP4 236
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1069
+LABELV $1073
+ADDRLP4 196+8
+ADDRLP4 196+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1069
+LABELV $1067
+ADDRLP4 196
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRLP4 196
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $1075
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $1077
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1081
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1079
+LABELV $1077
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+INDIRI4
+LEI4 $1082
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1086
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1084
+LABELV $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 0
+NEF4 $1087
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1089
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1091
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1089
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1091
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1087
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1092
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1092
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1095
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1095
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1097
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1097
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1099
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $1101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1105
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1035
+JUMPV
+LABELV $1103
+LABELV $1101
+CNSTI4 1
+RETI4
+LABELV $1035
+endproc AINode_Battle_Fight 292 20
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $1106
+endproc AIEnter_Battle_Chase 0 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 204 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1111
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1114
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1117
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1115
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1120
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+EQF4 $1121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1107
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1121
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 156
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1123
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1125
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1123
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1126
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1128
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1126
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1129
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $1132
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1132
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1134
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1148
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 0
+EQF4 $1152
+ADDRLP4 180
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $1150
+LABELV $1152
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1153
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1150
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1125515264
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $1156
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1158
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1156
+LABELV $1154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1159
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $1161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1162
+JUMPV
+LABELV $1161
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1165
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1168
+JUMPV
+LABELV $1167
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1169
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1170
+JUMPV
+LABELV $1169
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1170
+LABELV $1168
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 192
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1165
+LABELV $1162
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $1176
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+NEI4 $1180
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1184
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1182
+CNSTI4 1
+RETI4
+LABELV $1108
+endproc AINode_Battle_Chase 204 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1186
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $1185
+endproc AIEnter_Battle_Retreat 0 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1190
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1191
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1193
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1191
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1196
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1194
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1199
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1197
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 296
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1202
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1203
+LABELV $1203
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1205
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1208
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1210
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1212
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1210
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 332
+INDIRF4
+CNSTF4 0
+EQF4 $1213
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1216
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1222
+ADDRLP4 336
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1218
+LABELV $1222
+ADDRLP4 252+8
+ADDRLP4 252+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1218
+LABELV $1216
+ADDRLP4 252
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1224
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1224
+LABELV $1213
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $1226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1228
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1226
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1229
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 336
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1231
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1233
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1231
+LABELV $1229
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 340
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1236
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1234
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1237
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 264
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 344
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 4
+EQI4 $1241
+ADDRLP4 344
+INDIRI4
+CNSTI4 9
+NEI4 $1239
+LABELV $1241
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1240
+ADDRLP4 264
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $1240
+JUMPV
+LABELV $1239
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1245
+ADDRLP4 264
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $1245
+JUMPV
+LABELV $1244
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1250
+ADDRLP4 264
+CNSTF4 1117782016
+ASGNF4
+LABELV $1250
+LABELV $1248
+LABELV $1245
+LABELV $1240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 264
+INDIRF4
+ARGF4
+ADDRLP4 352
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1254
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1187
+JUMPV
+LABELV $1252
+LABELV $1237
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1258
+JUMPV
+LABELV $1257
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 348
+INDIRI4
+NEI4 $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 348
+INDIRI4
+NEI4 $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 268
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1265
+JUMPV
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1266
+ADDRLP4 272
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1267
+JUMPV
+LABELV $1266
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1267
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1265
+LABELV $1261
+LABELV $1258
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1273
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1187
+endproc AINode_Battle_Retreat 368 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1278
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1277
+endproc AIEnter_Battle_NBG 0 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 356 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1282
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1285
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1283
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1288
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1286
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1291
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1289
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 292
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1294
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1292
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1295
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1298
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1300
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+CNSTF4 0
+EQF4 $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1305
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1311
+ADDRLP4 320
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1307
+LABELV $1311
+ADDRLP4 252+8
+ADDRLP4 252+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1307
+LABELV $1305
+ADDRLP4 252
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1313
+ADDRLP4 324
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1313
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1313
+LABELV $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $1315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1316
+JUMPV
+LABELV $1315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1317
+LABELV $1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1319
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1323
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+ADDRGP4 $1322
+JUMPV
+LABELV $1321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1323
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $1322
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1319
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1326
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1327
+JUMPV
+LABELV $1326
+ADDRLP4 336
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 336
+INDIRI4
+NEI4 $1330
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 336
+INDIRI4
+NEI4 $1330
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1334
+JUMPV
+LABELV $1333
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1335
+ADDRLP4 268
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1336
+JUMPV
+LABELV $1335
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1336
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 352
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1334
+LABELV $1330
+LABELV $1327
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1342
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1342
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1279
+endproc AINode_Battle_NBG 356 20
+import dom_points_bot
+bss
+export nodeswitch
+align 1
+LABELV nodeswitch
+skip 7344
+export numnodeswitches
+align 4
+LABELV numnodeswitches
+skip 4
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import AIEnter_Seek_Camp
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1323
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1294
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1291
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1288
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1285
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1282
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1278
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1254
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1236
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1233
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1228
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1212
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1202
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1199
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1196
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1193
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1190
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1186
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1184
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1158
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1153
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1128
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $1125
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1120
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1117
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1114
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1111
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1107
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1105
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1091
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1086
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1081
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1065
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1058
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1049
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1044
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1041
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1038
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1033
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $992
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $970
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $954
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $951
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $948
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $945
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $941
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $936
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $899
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $885
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $882
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $879
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $875
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $874
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $869
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $818
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $807
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $784
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $776
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $773
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $770
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $766
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $664
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $656
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $654
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $641
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $639
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $635
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $633
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $625
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $594
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $591
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $581
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $512
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $511
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $474
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $473
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $439
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $438
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $428
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $415
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $414
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 0
+align 1
+LABELV $381
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $380
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $371
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $366
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $358
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $355
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $350
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $343
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $340
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $329
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $326
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $325
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $314
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 0
+align 1
+LABELV $303
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 0
+align 1
+LABELV $294
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $285
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $263
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $167
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $141
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $140
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $71
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $69
+byte 1 0
+align 1
+LABELV $68
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $63
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
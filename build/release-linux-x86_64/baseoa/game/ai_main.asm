@@ -0,0 +1,11623 @@
+export BotAI_Print
+code
+proc BotAI_Print 2056 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 2052
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+LTI4 $63
+ADDRLP4 2052
+INDIRI4
+CNSTI4 5
+GTI4 $63
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $76-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $76
+address $65
+address $67
+address $69
+address $71
+address $73
+code
+LABELV $65
+ADDRGP4 $66
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $64
+JUMPV
+LABELV $67
+ADDRGP4 $68
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $64
+JUMPV
+LABELV $69
+ADDRGP4 $70
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $64
+JUMPV
+LABELV $71
+ADDRGP4 $72
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $64
+JUMPV
+LABELV $73
+ADDRGP4 $74
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $64
+JUMPV
+LABELV $63
+ADDRGP4 $75
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $64
+LABELV $61
+endproc BotAI_Print 2056 16
+export BotAI_Trace
+proc BotAI_Trace 56 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0+24+12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 41
+ADDP4
+ADDRLP4 0+24+17
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+24+16
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0+44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $78
+endproc BotAI_Trace 56 28
+export BotAI_GetClientState
+proc BotAI_GetClientState 4 12
+ADDRLP4 0
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $92
+CNSTI4 0
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $94
+CNSTI4 0
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $94
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 468
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $91
+endproc BotAI_GetClientState 4 12
+export BotAI_GetEntityState
+proc BotAI_GetEntityState 8 12
+ADDRLP4 0
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 208
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $97
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $99
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $99
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $101
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $101
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_instantgib+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $101
+ADDRGP4 g_rockets+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $101
+ADDRGP4 g_elimination_allgametypes+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $101
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $101
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $101
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $101
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 208
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $96
+endproc BotAI_GetEntityState 8 12
+export BotAI_GetSnapshotEntity
+proc BotAI_GetSnapshotEntity 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_BotGetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $110
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 208
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $109
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $109
+endproc BotAI_GetSnapshotEntity 8 12
+export BotAI_BotInitialChat
+proc BotAI_BotInitialChat 56 44
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $114
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $118
+ADDRGP4 $116
+JUMPV
+LABELV $118
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $115
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $114
+LABELV $116
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8+4
+INDIRP4
+ARGP4
+ADDRLP4 8+8
+INDIRP4
+ARGP4
+ADDRLP4 8+12
+INDIRP4
+ARGP4
+ADDRLP4 8+16
+INDIRP4
+ARGP4
+ADDRLP4 8+20
+INDIRP4
+ARGP4
+ADDRLP4 8+24
+INDIRP4
+ARGP4
+ADDRLP4 8+28
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotInitialChat
+CALLV
+pop
+LABELV $112
+endproc BotAI_BotInitialChat 56 44
+export BotTestAAS
+proc BotTestAAS 64 16
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testsolid+12
+INDIRI4
+CNSTI4 0
+EQI4 $128
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $131
+ADDRGP4 $127
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $133
+CNSTI4 1
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $129
+JUMPV
+LABELV $133
+CNSTI4 1
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRGP4 bot_testclusters+12
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRGP4 $127
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $142
+CNSTI4 1
+ARGI4
+ADDRGP4 $144
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $143
+LABELV $137
+LABELV $129
+LABELV $127
+endproc BotTestAAS 64 16
+export BotReportStatus
+proc BotReportStatus 564 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 548
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $148
+ADDRLP4 288
+ADDRGP4 $150
+ASGNP4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 288
+ADDRGP4 $151
+ASGNP4
+LABELV $149
+ADDRLP4 256
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 552
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 4
+EQI4 $155
+ADDRLP4 552
+INDIRI4
+CNSTI4 9
+NEI4 $153
+LABELV $155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+EQI4 $154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 1
+NEI4 $158
+ADDRLP4 256
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $154
+JUMPV
+LABELV $158
+ADDRLP4 256
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 1
+NEI4 $166
+ADDRLP4 256
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $166
+ADDRLP4 256
+ARGP4
+ADDRGP4 $161
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 1
+NEI4 $172
+ADDRLP4 256
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 256
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $175
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $173
+LABELV $170
+LABELV $168
+LABELV $163
+LABELV $154
+ADDRLP4 556
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 1
+LTI4 $176
+ADDRLP4 556
+INDIRI4
+CNSTI4 17
+GTI4 $176
+ADDRLP4 556
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $208-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $208
+address $179
+address $181
+address $183
+address $193
+address $195
+address $197
+address $189
+address $189
+address $191
+address $185
+address $187
+address $201
+address $199
+address $176
+address $176
+address $203
+address $205
+code
+LABELV $179
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $187
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $189
+CNSTI4 1
+ARGI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $191
+CNSTI4 1
+ARGI4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $193
+CNSTI4 1
+ARGI4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $195
+CNSTI4 1
+ARGI4
+ADDRGP4 $196
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $197
+CNSTI4 1
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $199
+CNSTI4 1
+ARGI4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $201
+CNSTI4 1
+ARGI4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $203
+CNSTI4 1
+ARGI4
+ADDRGP4 $204
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $205
+CNSTI4 1
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $176
+CNSTI4 1
+ARGI4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $177
+LABELV $147
+endproc BotReportStatus 564 24
+export BotTeamplayReport
+proc BotTeamplayReport 1056 12
+CNSTI4 1
+ARGI4
+ADDRGP4 $211
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $212
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $218
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $216
+LABELV $218
+ADDRGP4 $213
+JUMPV
+LABELV $216
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRLP4 4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $219
+LABELV $222
+ADDRGP4 $213
+JUMPV
+LABELV $219
+ADDRLP4 4
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 1
+NEI4 $223
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotReportStatus
+CALLV
+pop
+LABELV $223
+LABELV $213
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $215
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $226
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $212
+LABELV $226
+CNSTI4 1
+ARGI4
+ADDRGP4 $227
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $228
+ADDRLP4 1032
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $234
+ADDRLP4 1032
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $232
+LABELV $234
+ADDRGP4 $229
+JUMPV
+LABELV $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $235
+LABELV $237
+ADDRGP4 $229
+JUMPV
+LABELV $235
+ADDRLP4 4
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 2
+NEI4 $238
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotReportStatus
+CALLV
+pop
+LABELV $238
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $228
+LABELV $240
+LABELV $210
+endproc BotTeamplayReport 1056 12
+export BotSetInfoConfigString
+proc BotSetInfoConfigString 884 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 864
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 864
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRLP4 544
+ADDRGP4 $150
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRLP4 544
+ADDRGP4 $151
+ASGNP4
+LABELV $243
+ADDRLP4 512
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 868
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 4
+EQI4 $246
+ADDRLP4 868
+INDIRI4
+CNSTI4 9
+NEI4 $244
+LABELV $246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 872
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 872
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 512
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 872
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 872
+INDIRI4
+CNSTI4 0
+EQI4 $251
+ADDRLP4 512
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 872
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 872
+INDIRI4
+CNSTI4 0
+EQI4 $256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 876
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 876
+INDIRI4
+CNSTI4 1
+NEI4 $258
+ADDRLP4 512
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 512
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $259
+LABELV $256
+LABELV $254
+LABELV $251
+LABELV $245
+ADDRLP4 872
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 872
+INDIRI4
+CNSTI4 1
+LTI4 $261
+ADDRLP4 872
+INDIRI4
+CNSTI4 17
+GTI4 $261
+ADDRLP4 872
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $294-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $294
+address $264
+address $266
+address $268
+address $278
+address $280
+address $282
+address $274
+address $274
+address $276
+address $270
+address $272
+address $286
+address $284
+address $261
+address $261
+address $288
+address $290
+code
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $268
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $274
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $276
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $277
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $278
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $279
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $280
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $281
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $282
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $284
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $286
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $287
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $288
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $290
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $291
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 808
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 808+44
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $293
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $262
+ADDRGP4 $296
+ARGP4
+ADDRLP4 544
+INDIRP4
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 880
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 548
+ADDRLP4 880
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $241
+endproc BotSetInfoConfigString 884 16
+export BotUpdateInfoConfigStrings
+proc BotUpdateInfoConfigStrings 1044 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $298
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $304
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $302
+LABELV $304
+ADDRGP4 $299
+JUMPV
+LABELV $302
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRLP4 4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $305
+LABELV $307
+ADDRGP4 $299
+JUMPV
+LABELV $305
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetInfoConfigString
+CALLV
+pop
+LABELV $299
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $301
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $308
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $298
+LABELV $308
+LABELV $297
+endproc BotUpdateInfoConfigStrings 1044 12
+export BotInterbreedBots
+proc BotInterbreedBots 288 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $310
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $314
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 276
+INDIRI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 280
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $315
+LABELV $311
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $310
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_GeneticParentsAndChildSelection
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $316
+ADDRLP4 276
+CNSTI4 2
+ASGNI4
+ADDRLP4 280
+ADDRGP4 botstates
+ASGNP4
+ADDRLP4 284
+CNSTI4 6528
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotInterbreedGoalFuzzyLogic
+CALLV
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $316
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $318
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $322
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6032
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6028
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $322
+LABELV $319
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $318
+LABELV $309
+endproc BotInterbreedBots 288 20
+export BotWriteInterbreeded
+proc BotWriteInterbreeded 24 8
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $325
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $329
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 4
+CNSTF4 3212836864
+ASGNF4
+LABELV $330
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $331
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $331
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $325
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $333
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotSaveGoalFuzzyLogic
+CALLV
+pop
+LABELV $333
+LABELV $324
+endproc BotWriteInterbreeded 24 8
+export BotInterbreedEndMatch
+proc BotInterbreedEndMatch 8 8
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRGP4 $335
+JUMPV
+LABELV $336
+ADDRLP4 0
+ADDRGP4 bot_interbreedmatchcount
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 bot_interbreedcycle+12
+INDIRI4
+LTI4 $338
+ADDRGP4 bot_interbreedmatchcount
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $341
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRGP4 BotWriteInterbreeded
+CALLV
+pop
+ADDRGP4 $345
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $341
+ADDRGP4 BotInterbreedBots
+CALLV
+pop
+LABELV $338
+LABELV $335
+endproc BotInterbreedEndMatch 8 8
+export BotInterbreeding
+proc BotInterbreeding 16 20
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRGP4 $347
+JUMPV
+LABELV $348
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+EQI4 $351
+ADDRGP4 $354
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $353
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $351
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $355
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $359
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $359
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $359
+LABELV $356
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $355
+ADDRGP4 $361
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $363
+ADDRGP4 $368
+ARGP4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+CNSTI4 50
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $364
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $366
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bot_interbreedbots+12
+INDIRI4
+LTI4 $363
+ADDRGP4 $371
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 bot_interbreed
+CNSTI4 1
+ASGNI4
+LABELV $347
+endproc BotInterbreeding 16 20
+export BotEntityInfo
+proc BotEntityInfo 0 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AAS_EntityInfo
+CALLV
+pop
+LABELV $372
+endproc BotEntityInfo 0 8
+export NumBots
+proc NumBots 0 0
+ADDRGP4 numbots
+INDIRI4
+RETI4
+LABELV $373
+endproc NumBots 0 0
+export BotTeamLeader
+proc BotTeamLeader 12 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $375
+CNSTI4 0
+RETI4
+ADDRGP4 $374
+JUMPV
+LABELV $375
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $379
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $377
+LABELV $379
+CNSTI4 0
+RETI4
+ADDRGP4 $374
+JUMPV
+LABELV $377
+CNSTI4 1
+RETI4
+LABELV $374
+endproc BotTeamLeader 12 4
+export AngleDifference
+proc AngleDifference 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $381
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $382
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $385
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $385
+LABELV $382
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $380
+endproc AngleDifference 12 0
+export BotChangeViewAngle
+proc BotChangeViewAngle 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+NEF4 $388
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $387
+JUMPV
+LABELV $388
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $390
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $391
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $394
+LABELV $391
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $396
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $397
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $400
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $400
+LABELV $397
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+RETF4
+LABELV $387
+endproc BotChangeViewAngle 24 4
+export BotChangeViewAngles
+proc BotChangeViewAngles 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $403
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTF4 1008981770
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1155596288
+ARGF4
+ADDRLP4 32
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 16
+CNSTF4 1028443341
+ASGNF4
+ADDRLP4 8
+CNSTF4 1135869952
+ASGNF4
+LABELV $406
+ADDRLP4 8
+INDIRF4
+CNSTF4 1131413504
+GEF4 $407
+ADDRLP4 8
+CNSTF4 1131413504
+ASGNF4
+LABELV $407
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $409
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $413
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $416
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $416
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 BotChangeViewAngle
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $418
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $418
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $420
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $420
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $422
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $422
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+GEF4 $424
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $424
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1055286886
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $414
+LABELV $410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $426
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $402
+endproc BotChangeViewAngles 80 16
+export BotInputToUserCommand
+proc BotInputToUserCommand 152 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $429
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 60
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $435
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $439
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $439
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $441
+ADDRLP4 76
+CNSTI4 16
+ASGNI4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+BORI4
+ASGNI4
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $445
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $447
+ADDRLP4 92
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 134217728
+BANDI4
+CNSTI4 0
+EQI4 $453
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $453
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $455
+ADDRLP4 108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 108
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+SUBI4
+CVII2 4
+ASGNI2
+ADDRLP4 112
+INDIRP4
+ADDRLP4 4
+INDIRI2
+CVII4 2
+ASGNI4
+LABELV $456
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $459
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+LABELV $460
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTF4 1123942400
+ADDRLP4 108
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1137180672
+DIVF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 36
+INDIRF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 128
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $468
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 140
+INDIRF4
+ASGNF4
+LABELV $468
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $470
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+LABELV $470
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $472
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 48
+INDIRF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+LABELV $472
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $474
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $474
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $476
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+CNSTI1 -127
+ASGNI1
+LABELV $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $478
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+CNSTI1 -127
+ASGNI1
+LABELV $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $480
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $482
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+CNSTI1 127
+ASGNI1
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $484
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+CNSTI1 -127
+ASGNI1
+LABELV $484
+LABELV $428
+endproc BotInputToUserCommand 152 16
+export BotUpdateInput
+proc BotUpdateInput 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $487
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $488
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $487
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotChangeViewAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_EA_GetInput
+CALLV
+pop
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 4+32
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 -10
+BANDI4
+ASGNI4
+LABELV $494
+LABELV $491
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotInputToUserCommand
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $497
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $497
+LABELV $486
+endproc BotUpdateInput 64 16
+export BotAIRegularUpdate
+proc BotAIRegularUpdate 0 0
+ADDRGP4 regularupdate_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $502
+ADDRGP4 trap_BotUpdateEntityItems
+CALLV
+pop
+ADDRGP4 regularupdate_time
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $502
+LABELV $501
+endproc BotAIRegularUpdate 0 0
+export RemoveColorEscapeSequences
+proc RemoveColorEscapeSequences 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $505
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $509
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $509
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $509
+ADDRLP4 16
+INDIRI4
+CNSTI4 56
+GTI4 $509
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $509
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 126
+LEI4 $511
+ADDRGP4 $506
+JUMPV
+LABELV $511
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $506
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $508
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $505
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $504
+endproc RemoveColorEscapeSequences 28 0
+export BotAI
+proc BotAI 1092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_ResetInput
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $516
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $514
+LABELV $516
+CNSTI4 4
+ARGI4
+ADDRGP4 $517
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $514
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1040
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $521
+ADDRGP4 $519
+JUMPV
+LABELV $521
+ADDRLP4 1044
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 RemoveColorEscapeSequences
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 12
+ARGP4
+ADDRGP4 $528
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $526
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 12
+ARGP4
+ADDRGP4 $531
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $529
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRLP4 12
+ARGP4
+ADDRGP4 $534
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 12
+ARGP4
+ADDRGP4 $537
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $535
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 12
+ARGP4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $538
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRLP4 12
+ARGP4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $541
+LABELV $541
+LABELV $539
+LABELV $536
+LABELV $533
+LABELV $530
+LABELV $527
+LABELV $524
+LABELV $519
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1040
+ADDRGP4 trap_BotGetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $544
+ADDRLP4 1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 1056
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+LABELV $545
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $544
+ADDRLP4 1044
+ADDRLP4 4
+INDIRP4
+CNSTI4 6060
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4936
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1060
+ADDRLP4 4
+INDIRP4
+CNSTI4 4944
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4948
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 BotDeathmatchAI
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $548
+ADDRLP4 1076
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1084
+ADDRLP4 1076
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1076
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 1088
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+LABELV $549
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $548
+CNSTI4 1
+RETI4
+LABELV $513
+endproc BotAI 1092 12
+export BotScheduleBotThink
+proc BotScheduleBotThink 16 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $553
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $559
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $557
+LABELV $559
+ADDRGP4 $554
+JUMPV
+LABELV $557
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 numbots
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $553
+LABELV $552
+endproc BotScheduleBotThink 16 0
+export BotWriteSessionData
+proc BotWriteSessionData 20 72
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $562
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6808
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6816
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6820
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6812
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6772
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6796
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6800
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6804
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $563
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $561
+endproc BotWriteSessionData 20 72
+export BotReadSessionData
+proc BotReadSessionData 1036 76
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $563
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $562
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6808
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6816
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6820
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6812
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6772
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6796
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6800
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6804
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $564
+endproc BotReadSessionData 1036 76
+export BotAISetupClient
+proc BotAISetupClient 508 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $566
+CNSTU4 9088
+ARGU4
+ADDRLP4 440
+ADDRGP4 BG_CanAlloc
+CALLI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 0
+NEI4 $568
+CNSTI4 4
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $568
+CNSTU4 9088
+ARGU4
+ADDRLP4 444
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+ADDRLP4 444
+INDIRP4
+ASGNP4
+LABELV $566
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $571
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $571
+CNSTI4 4
+ARGI4
+ADDRGP4 $573
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $571
+ADDRLP4 444
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 444
+INDIRI4
+CNSTI4 0
+NEI4 $574
+CNSTI4 4
+ARGI4
+ADDRGP4 $576
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $574
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 452
+ADDRGP4 trap_BotLoadCharacter
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $577
+CNSTI4 4
+ARGI4
+ADDRGP4 $579
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $577
+ADDRLP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 292
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_BotAllocGoalState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_BotLoadItemWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $580
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $580
+ADDRLP4 464
+ADDRGP4 trap_BotAllocWeaponState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_BotLoadWeaponWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $582
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $582
+ADDRLP4 472
+ADDRGP4 trap_BotAllocChatState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 21
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_BotLoadChatFile
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $584
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 480
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 480
+INDIRI4
+CNSTI4 102
+EQI4 $588
+ADDRLP4 480
+INDIRI4
+CNSTI4 70
+NEI4 $586
+LABELV $588
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRLP4 484
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 109
+EQI4 $591
+ADDRLP4 484
+INDIRI4
+CNSTI4 77
+NEI4 $589
+LABELV $591
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $590
+LABELV $587
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ADDRGP4 trap_BotAllocMoveState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 496
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+ADDRLP4 496
+INDIRF4
+ASGNF4
+ADDRLP4 500
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 500
+INDIRP4
+ADDRLP4 500
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRGP4 $594
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChatTest
+CALLV
+pop
+LABELV $592
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $595
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $597
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotReadSessionData
+CALLV
+pop
+LABELV $597
+CNSTI4 1
+RETI4
+LABELV $565
+endproc BotAISetupClient 508 16
+export BotAIShutdownClient
+proc BotAIShutdownClient 20 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $602
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $600
+LABELV $602
+CNSTI4 0
+RETI4
+ADDRGP4 $599
+JUMPV
+LABELV $600
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWriteSessionData
+CALLV
+pop
+LABELV $603
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_ExitGame
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $605
+ADDRLP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeMoveState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeCharacter
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 9088
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $599
+endproc BotAIShutdownClient 20 12
+export BotResetState
+proc BotResetState 800 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+CNSTI4 292
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 324
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+CNSTI4 468
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 9088
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 324
+ARGP4
+CNSTI4 468
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 292
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRLP4 792
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+LABELV $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+LABELV $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetWeaponState
+CALLV
+pop
+LABELV $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $614
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $614
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $616
+LABELV $607
+endproc BotResetState 800 12
+export BotAILoadMap
+proc BotAILoadMap 280 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $619
+ADDRLP4 4
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRGP4 $346
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 trap_BotLibLoadMap
+CALLI4
+pop
+LABELV $619
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $623
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $627
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $627
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $623
+ADDRGP4 BotSetupDeathmatchAI
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $618
+endproc BotAILoadMap 280 16
+bss
+align 4
+LABELV $630
+skip 4
+align 4
+LABELV $631
+skip 4
+align 4
+LABELV $632
+skip 4
+export BotAIStartFrame
+code
+proc BotAIStartFrame 164 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_CheckBotSpawn
+CALLV
+pop
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_report
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_report+12
+INDIRI4
+CNSTI4 0
+EQI4 $633
+ADDRGP4 BotUpdateInfoConfigStrings
+CALLV
+pop
+LABELV $633
+ADDRGP4 bot_pause+12
+INDIRI4
+CNSTI4 0
+EQI4 $636
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $639
+ADDRLP4 128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $645
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $643
+LABELV $645
+ADDRGP4 $640
+JUMPV
+LABELV $643
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $646
+ADDRGP4 $640
+JUMPV
+LABELV $646
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 509
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 510
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 511
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $640
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $639
+CNSTI4 1
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $636
+ADDRGP4 bot_memorydump+12
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRGP4 $652
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $653
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $649
+ADDRGP4 bot_saveroutingcache+12
+INDIRI4
+CNSTI4 0
+EQI4 $655
+ADDRGP4 $658
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $659
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $655
+ADDRGP4 BotInterbreeding
+CALLV
+pop
+ADDRGP4 bot_thinktime+12
+INDIRI4
+CNSTI4 200
+LEI4 $660
+ADDRGP4 $663
+ARGP4
+ADDRGP4 $664
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $660
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRGP4 $632
+INDIRI4
+EQI4 $665
+ADDRGP4 $632
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+LABELV $665
+ADDRLP4 132
+ADDRGP4 $630
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRI4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 132
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRGP4 $631
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+LEI4 $669
+ADDRLP4 124
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRLP4 124
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+LABELV $670
+ADDRGP4 $631
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $673
+ADDRLP4 144
+ADDRGP4 $631
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 trap_BotLibStartFrame
+CALLI4
+pop
+ADDRLP4 148
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $675
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $675
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $677
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $681
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $683
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $683
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $685
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $685
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_instantgib+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $685
+ADDRGP4 g_rockets+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $685
+ADDRGP4 g_elimination_allgametypes+12
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $685
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $685
+ADDRLP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 152
+INDIRI4
+EQI4 $685
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $685
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $693
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $693
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $693
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $695
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $695
+ADDRLP4 4
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+NEI4 $697
+ADDRLP4 4
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 ProximityMine_Trigger
+CVPU4 4
+NEU4 $699
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $678
+JUMPV
+LABELV $699
+LABELV $697
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $702
+ADDRLP4 8+20
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $703
+JUMPV
+LABELV $702
+ADDRLP4 8+20
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $703
+ADDRLP4 8+32
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+44
+ADDRLP4 4
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+56
+ADDRLP4 4
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 432
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 8+72
+CNSTI4 3
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRLP4 8+72
+CNSTI4 2
+ASGNI4
+LABELV $711
+ADDRLP4 8+68
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+76
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+80
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+84
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+88
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+92
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+96
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+104
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+108
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+100
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+LABELV $678
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $677
+ADDRGP4 BotAIRegularUpdate
+CALLV
+pop
+LABELV $673
+ADDRLP4 144
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRGP4 floattime
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $724
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $730
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $728
+LABELV $730
+ADDRGP4 $725
+JUMPV
+LABELV $728
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $731
+ADDRLP4 156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 160
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $733
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $733
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $735
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotAI
+CALLI4
+pop
+LABELV $735
+LABELV $731
+LABELV $725
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $724
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $738
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $744
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $742
+LABELV $744
+ADDRGP4 $739
+JUMPV
+LABELV $742
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $745
+ADDRGP4 $739
+JUMPV
+LABELV $745
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateInput
+CALLV
+pop
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $739
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $738
+CNSTI4 1
+RETI4
+LABELV $629
+endproc BotAIStartFrame 164 12
+export BotInitLibrary
+proc BotInitLibrary 212 16
+ADDRGP4 $749
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $750
+ADDRLP4 0
+ARGP4
+ADDRGP4 $752
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $750
+ADDRGP4 $753
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $354
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $754
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $755
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $756
+ADDRGP4 $755
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $756
+ADDRGP4 $758
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $759
+ADDRGP4 $758
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $759
+ADDRGP4 $761
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $762
+ADDRGP4 $761
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $762
+ADDRGP4 $353
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $764
+ADDRLP4 0
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $764
+ADDRGP4 $353
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $766
+ARGP4
+ADDRGP4 bot_developer+16
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $768
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $769
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $770
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $771
+ADDRGP4 $773
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $771
+ADDRGP4 $774
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $775
+ADDRGP4 $774
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $775
+ADDRGP4 $777
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $778
+ADDRGP4 $780
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $778
+ADDRGP4 $781
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $782
+ADDRGP4 $784
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $782
+ADDRGP4 $785
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $786
+ADDRGP4 $788
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $786
+ADDRGP4 $789
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 184
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $790
+ADDRGP4 $792
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $790
+ADDRGP4 $659
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRGP4 $658
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $793
+ADDRGP4 $361
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $795
+ADDRLP4 0
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $795
+ADDRGP4 $361
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $797
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $798
+ADDRGP4 $800
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $798
+ADDRGP4 $801
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRGP4 $804
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $802
+ADDRGP4 $805
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRGP4 $808
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $806
+ADDRLP4 208
+ADDRGP4 trap_BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+RETI4
+LABELV $748
+endproc BotInitLibrary 212 16
+export BotAISetup
+proc BotAISetup 8 16
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 $663
+ARGP4
+ADDRGP4 $810
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 $653
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 $659
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 $811
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_report
+ARGP4
+ADDRGP4 $812
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 $813
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 $814
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_developer
+ARGP4
+ADDRGP4 $766
+ARGP4
+ADDRGP4 $654
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 $371
+ARGP4
+ADDRGP4 $346
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedbots
+ARGP4
+ADDRGP4 $815
+ARGP4
+ADDRGP4 $816
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedcycle
+ARGP4
+ADDRGP4 $817
+ARGP4
+ADDRGP4 $818
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 $345
+ARGP4
+ADDRGP4 $346
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $819
+CNSTI4 1
+RETI4
+ADDRGP4 $809
+JUMPV
+LABELV $819
+ADDRGP4 botstates
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 256
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRGP4 BotInitLibrary
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $821
+CNSTI4 0
+RETI4
+ADDRGP4 $809
+JUMPV
+LABELV $821
+CNSTI4 1
+RETI4
+LABELV $809
+endproc BotAISetup 8 16
+export BotAIShutdown
+proc BotAIShutdown 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $824
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $826
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $830
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $830
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $830
+LABELV $827
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $826
+ADDRGP4 $825
+JUMPV
+LABELV $824
+ADDRGP4 trap_BotLibShutdown
+CALLI4
+pop
+LABELV $825
+CNSTI4 1
+RETI4
+LABELV $823
+endproc BotAIShutdown 8 8
+import ProximityMine_Trigger
+bss
+export bot_interbreedwrite
+align 4
+LABELV bot_interbreedwrite
+skip 272
+export bot_interbreedcycle
+align 4
+LABELV bot_interbreedcycle
+skip 272
+export bot_interbreedbots
+align 4
+LABELV bot_interbreedbots
+skip 272
+export bot_interbreedchar
+align 4
+LABELV bot_interbreedchar
+skip 272
+export bot_developer
+align 4
+LABELV bot_developer
+skip 272
+export bot_testclusters
+align 4
+LABELV bot_testclusters
+skip 272
+export bot_testsolid
+align 4
+LABELV bot_testsolid
+skip 272
+export bot_report
+align 4
+LABELV bot_report
+skip 272
+export bot_pause
+align 4
+LABELV bot_pause
+skip 272
+export bot_saveroutingcache
+align 4
+LABELV bot_saveroutingcache
+skip 272
+export bot_memorydump
+align 4
+LABELV bot_memorydump
+skip 272
+export bot_thinktime
+align 4
+LABELV bot_thinktime
+skip 272
+export bot_interbreedmatchcount
+align 4
+LABELV bot_interbreedmatchcount
+skip 4
+export bot_interbreed
+align 4
+LABELV bot_interbreed
+skip 4
+export regularupdate_time
+align 4
+LABELV regularupdate_time
+skip 4
+export numbots
+align 4
+LABELV numbots
+skip 4
+export botstates
+align 4
+LABELV botstates
+skip 256
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+export floattime
+align 4
+LABELV floattime
+skip 4
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $818
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $817
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $816
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $815
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $814
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $813
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $812
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $811
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $810
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $808
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $805
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $804
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $801
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $800
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $797
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $792
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $789
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $788
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $785
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $784
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $781
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $780
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $777
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $774
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $773
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $770
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $769
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $768
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $766
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $761
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $758
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $755
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $754
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $753
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $752
+byte 1 56
+byte 1 0
+align 1
+LABELV $749
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $664
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $663
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $659
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $658
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $654
+byte 1 48
+byte 1 0
+align 1
+LABELV $653
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $652
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $621
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $594
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $579
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $576
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $573
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $563
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $562
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $543
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $540
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $537
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $534
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $531
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $528
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $525
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 0
+align 1
+LABELV $517
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $371
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $368
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 52
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $362
+byte 1 49
+byte 1 0
+align 1
+LABELV $361
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $354
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $353
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $346
+byte 1 0
+align 1
+LABELV $345
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $296
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 97
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $293
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $291
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 0
+align 1
+LABELV $289
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 0
+align 1
+LABELV $287
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $285
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $283
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $281
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $279
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $277
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $275
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $273
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $271
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $269
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $267
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $265
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $260
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $249
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $227
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 116
+byte 1 0
+align 1
+LABELV $221
+byte 1 110
+byte 1 0
+align 1
+LABELV $211
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $207
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $206
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 10
+byte 1 0
+align 1
+LABELV $204
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 10
+byte 1 0
+align 1
+LABELV $202
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $198
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $196
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $194
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $192
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $188
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $184
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $182
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $180
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 94
+byte 1 52
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $174
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $161
+byte 1 94
+byte 1 52
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $160
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $152
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $151
+byte 1 32
+byte 1 0
+align 1
+LABELV $150
+byte 1 76
+byte 1 0
+align 1
+LABELV $145
+byte 1 13
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $144
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 33
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $136
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $135
+byte 1 13
+byte 1 101
+byte 1 109
+byte 1 116
+byte 1 112
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $75
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $74
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $72
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $70
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $68
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $66
+byte 1 37
+byte 1 115
+byte 1 0
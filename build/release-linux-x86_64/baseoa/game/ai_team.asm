@@ -0,0 +1,14227 @@
+export BotValidTeamLeader
+code
+proc BotValidTeamLeader 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $62
+CNSTI4 0
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $64
+CNSTI4 0
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $64
+CNSTI4 1
+RETI4
+LABELV $61
+endproc BotValidTeamLeader 8 4
+bss
+align 4
+LABELV $67
+skip 4
+export BotNumTeamMates
+code
+proc BotNumTeamMates 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $67
+INDIRI4
+CNSTI4 0
+NEI4 $68
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $67
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $68
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $71
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $78
+ADDRLP4 4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $75
+LABELV $78
+ADDRGP4 $72
+JUMPV
+LABELV $75
+ADDRLP4 4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $79
+ADDRGP4 $72
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $82
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+LABELV $72
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $74
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $67
+INDIRI4
+GEI4 $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $71
+LABELV $84
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $66
+endproc BotNumTeamMates 1064 12
+export BotClientTravelTimeToGoal
+proc BotClientTravelTimeToGoal 480 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $87
+CNSTI4 1
+RETI4
+ADDRGP4 $85
+JUMPV
+LABELV $87
+ADDRLP4 468
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+RETI4
+LABELV $85
+endproc BotClientTravelTimeToGoal 480 16
+bss
+align 4
+LABELV $91
+skip 4
+export BotSortTeamMatesByBaseTravelTime
+code
+proc BotSortTeamMatesByBaseTravelTime 1356 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+CNSTP4 0
+ASGNP4
+ADDRLP4 1304
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 4
+EQI4 $95
+ADDRLP4 1304
+INDIRI4
+CNSTI4 5
+EQI4 $95
+ADDRLP4 1304
+INDIRI4
+CNSTI4 9
+NEI4 $92
+LABELV $95
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $96
+ADDRLP4 1300
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $96
+ADDRLP4 1300
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $98
+ADDRLP4 1300
+ADDRGP4 redobelisk
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 1300
+ADDRGP4 blueobelisk
+ASGNP4
+LABELV $99
+LABELV $93
+ADDRGP4 $91
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1308
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $91
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+LABELV $100
+ADDRLP4 1312
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 268
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1316
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 276
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $106
+LABELV $108
+ADDRGP4 $103
+JUMPV
+LABELV $106
+ADDRLP4 276
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRLP4 1332
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 3
+NEI4 $109
+ADDRGP4 $103
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1340
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $113
+ADDRLP4 272
+INDIRI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+GEI4 $117
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $119
+ADDRLP4 1344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1348
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $122
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $119
+ADDRGP4 $115
+JUMPV
+LABELV $117
+LABELV $114
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $116
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $113
+LABELV $115
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $124
+ADDRGP4 $104
+JUMPV
+LABELV $124
+LABELV $111
+LABELV $103
+ADDRLP4 268
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 268
+INDIRI4
+ADDRGP4 $91
+INDIRI4
+GEI4 $126
+ADDRLP4 268
+INDIRI4
+CNSTI4 64
+LTI4 $102
+LABELV $126
+LABELV $104
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $90
+endproc BotSortTeamMatesByBaseTravelTime 1356 12
+bss
+align 4
+LABELV $128
+skip 4
+export BotSortTeamMatesByRelativeTravelTime2ddA
+code
+proc BotSortTeamMatesByRelativeTravelTime2ddA 1364 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRLP4 1308
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $128
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1312
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $128
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+LABELV $129
+ADDRLP4 1316
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $131
+ADDRLP4 272
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1320
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 276
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $135
+LABELV $137
+ADDRGP4 $132
+JUMPV
+LABELV $135
+ADDRLP4 276
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1332
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1332
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 3
+NEI4 $138
+ADDRGP4 $132
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1340
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1344
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1348
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1348
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 268
+INDIRF4
+ADDRLP4 1300
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $142
+ADDRLP4 268
+INDIRF4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+GEF4 $146
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $148
+ADDRLP4 1352
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1352
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1356
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $149
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $151
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $148
+ADDRGP4 $144
+JUMPV
+LABELV $146
+LABELV $143
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $142
+LABELV $144
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $153
+ADDRGP4 $133
+JUMPV
+LABELV $153
+LABELV $140
+LABELV $132
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $134
+ADDRLP4 272
+INDIRI4
+ADDRGP4 $128
+INDIRI4
+GEI4 $155
+ADDRLP4 272
+INDIRI4
+CNSTI4 64
+LTI4 $131
+LABELV $155
+LABELV $133
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $127
+endproc BotSortTeamMatesByRelativeTravelTime2ddA 1364 12
+export BotSetTeamMateTaskPreference
+proc BotSetTeamMateTaskPreference 36 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $156
+endproc BotSetTeamMateTaskPreference 36 12
+export BotGetTeamMateTaskPreference
+proc BotGetTeamMateTaskPreference 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $159
+CNSTI4 0
+RETI4
+ADDRGP4 $158
+JUMPV
+LABELV $159
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $162
+CNSTI4 0
+RETI4
+ADDRGP4 $158
+JUMPV
+LABELV $162
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+RETI4
+LABELV $158
+endproc BotGetTeamMateTaskPreference 40 12
+export BotSortTeamMatesByTaskPreference
+proc BotSortTeamMatesByTaskPreference 804 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 788
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 792
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $170
+ADDRLP4 796
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $172
+ADDRLP4 796
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 276
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 796
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 532
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $173
+LABELV $171
+LABELV $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $166
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 792
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 792
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 792
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 796
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 796
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 532
+ARGP4
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+ADDRLP4 796
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 272
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 268
+INDIRI4
+CVIU4 4
+ADDRLP4 800
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+RETI4
+LABELV $165
+endproc BotSortTeamMatesByTaskPreference 804 12
+export BotSayTeamOrderAlways
+proc BotSayTeamOrderAlways 548 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $175
+ADDRGP4 $174
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $179
+LABELV $174
+endproc BotSayTeamOrderAlways 548 20
+export BotSayTeamOrder
+proc BotSayTeamOrder 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $181
+endproc BotSayTeamOrder 0 8
+export BotVoiceChat
+proc BotVoiceChat 0 0
+LABELV $182
+endproc BotVoiceChat 0 0
+export BotVoiceChatOnly
+proc BotVoiceChatOnly 0 0
+LABELV $183
+endproc BotVoiceChatOnly 0 0
+export BotSayVoiceTeamOrder
+proc BotSayVoiceTeamOrder 0 0
+LABELV $184
+endproc BotSayVoiceTeamOrder 0 0
+export BotCTFOrders_BothFlagsNotAtBase
+proc BotCTFOrders_BothFlagsNotAtBase 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+EQI4 $187
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+EQI4 $190
+ADDRLP4 352
+INDIRI4
+CNSTI4 3
+EQI4 $199
+ADDRGP4 $186
+JUMPV
+LABELV $190
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $191
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $192
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $187
+JUMPV
+LABELV $199
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $200
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $201
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $205
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $207
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $207
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $204
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $215
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $204
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $223
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $226
+LABELV $204
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $229
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $232
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $233
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $237
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $237
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $240
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $246
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $247
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $247
+ADDRLP4 360
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 360
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 360
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $249
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $251
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $253
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $257
+ADDRGP4 $254
+JUMPV
+LABELV $257
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $259
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $261
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $267
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $270
+LABELV $260
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $273
+LABELV $254
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $256
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $253
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $280
+ADDRGP4 $277
+JUMPV
+LABELV $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $282
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $285
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $285
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $288
+LABELV $277
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $279
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $276
+LABELV $252
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $294
+JUMPV
+LABELV $291
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $295
+ADDRGP4 $292
+JUMPV
+LABELV $295
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $299
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $302
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $302
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $246
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $306
+LABELV $292
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $294
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $291
+LABELV $187
+LABELV $185
+endproc BotCTFOrders_BothFlagsNotAtBase 368 20
+export BotCTFOrders_FlagNotAtBase
+proc BotCTFOrders_FlagNotAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $311
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+CNSTI4 0
+LEI4 $314
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $317
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $318
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $320
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $317
+ADDRGP4 $310
+JUMPV
+LABELV $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $321
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $322
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $327
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $333
+ADDRGP4 $323
+JUMPV
+LABELV $327
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $322
+JUMPV
+LABELV $333
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $340
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $340
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $342
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $342
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $345
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $347
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $344
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $348
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $349
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $351
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $348
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $355
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $358
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $362
+ADDRGP4 $354
+JUMPV
+LABELV $358
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $355
+JUMPV
+LABELV $362
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $369
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $369
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $371
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $371
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $373
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $374
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $376
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $373
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $380
+JUMPV
+LABELV $377
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $378
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $377
+LABELV $355
+LABELV $322
+LABELV $310
+endproc BotCTFOrders_FlagNotAtBase 320 16
+export BotCTFOrders_EnemyFlagNotAtBase
+proc BotCTFOrders_EnemyFlagNotAtBase 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $385
+ADDRGP4 $384
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $389
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $391
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $395
+ADDRGP4 $388
+JUMPV
+LABELV $391
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $392
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $393
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $389
+JUMPV
+LABELV $395
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $396
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $397
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $399
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $400
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 300
+CNSTF4 1058642330
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 6
+LEI4 $404
+ADDRLP4 300
+CNSTI4 6
+ASGNI4
+LABELV $404
+ADDRLP4 304
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 3
+LEI4 $406
+ADDRLP4 304
+CNSTI4 3
+ASGNI4
+LABELV $406
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $408
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $412
+ADDRGP4 $409
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $409
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $411
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $416
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $420
+ADDRGP4 $417
+JUMPV
+LABELV $420
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $417
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $419
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $416
+ADDRGP4 $389
+JUMPV
+LABELV $414
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $429
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $433
+ADDRGP4 $430
+JUMPV
+LABELV $433
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $430
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $432
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $429
+LABELV $389
+LABELV $384
+endproc BotCTFOrders_EnemyFlagNotAtBase 360 20
+export BotDDorders_Standard
+proc BotDDorders_Standard 304 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $440
+ADDRGP4 $439
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 300
+ADDRGP4 BotSortTeamMatesByRelativeTravelTime2ddA
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $444
+ADDRGP4 $443
+JUMPV
+LABELV $443
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $446
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $450
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $447
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $449
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $446
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $454
+JUMPV
+LABELV $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $452
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $454
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $451
+LABELV $444
+LABELV $439
+endproc BotDDorders_Standard 304 16
+export BotCTFOrders_BothFlagsAtBase
+proc BotCTFOrders_BothFlagsAtBase 328 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $457
+ADDRGP4 $456
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+ADDRLP4 300
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+ADDRLP4 316
+INDIRI4
+LEI4 $460
+ADDRGP4 level+9256
+INDIRI4
+ADDRGP4 level+9236
+INDIRI4
+ADDI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 1
+NEI4 $463
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+LABELV $463
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $472
+JUMPV
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $470
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $472
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $469
+ADDRGP4 $456
+JUMPV
+LABELV $467
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $474
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $476
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $473
+ADDRGP4 $456
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $477
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $478
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $482
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $486
+ADDRGP4 $479
+JUMPV
+LABELV $482
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $478
+JUMPV
+LABELV $486
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $478
+JUMPV
+LABELV $479
+ADDRLP4 324
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 324
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 324
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $493
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $493
+ADDRLP4 308
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 4
+LEI4 $495
+ADDRLP4 308
+CNSTI4 4
+ASGNI4
+LABELV $495
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $500
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $497
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $501
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $502
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $504
+ADDRLP4 0
+INDIRI4
+ADDRLP4 308
+INDIRI4
+LTI4 $501
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $509
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $511
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $515
+ADDRGP4 $508
+JUMPV
+LABELV $511
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $515
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $522
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $522
+ADDRLP4 324
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 308
+ADDRLP4 324
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 324
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 5
+LEI4 $524
+ADDRLP4 308
+CNSTI4 5
+ASGNI4
+LABELV $524
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $529
+JUMPV
+LABELV $526
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $529
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $526
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $533
+JUMPV
+LABELV $530
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $533
+ADDRLP4 0
+INDIRI4
+ADDRLP4 308
+INDIRI4
+LTI4 $530
+LABELV $509
+LABELV $478
+LABELV $456
+endproc BotCTFOrders_BothFlagsAtBase 328 16
+export BotCTFOrders
+proc BotCTFOrders 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $538
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $539
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $540
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $540
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $546
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $546
+address $542
+address $543
+address $544
+address $545
+code
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsAtBase
+CALLV
+pop
+ADDRGP4 $541
+JUMPV
+LABELV $543
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_EnemyFlagNotAtBase
+CALLV
+pop
+ADDRGP4 $541
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_FlagNotAtBase
+CALLV
+pop
+ADDRGP4 $541
+JUMPV
+LABELV $545
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsNotAtBase
+CALLV
+pop
+LABELV $540
+LABELV $541
+LABELV $537
+endproc BotCTFOrders 20 4
+export BotDDorders
+proc BotDDorders 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDDorders_Standard
+CALLV
+pop
+LABELV $547
+endproc BotDDorders 0 4
+export BotCreateGroup
+proc BotCreateGroup 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $549
+ADDRGP4 $548
+JUMPV
+LABELV $549
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $555
+JUMPV
+LABELV $552
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $556
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $557
+JUMPV
+LABELV $556
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $553
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $555
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $552
+LABELV $548
+endproc BotCreateGroup 76 20
+bss
+align 4
+LABELV $559
+skip 4
+export BotTeamOrders
+code
+proc BotTeamOrders 1320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $559
+INDIRI4
+CNSTI4 0
+NEI4 $560
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1288
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $559
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+LABELV $560
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $562
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $568
+ADDRLP4 4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 0
+NEI4 $566
+LABELV $568
+ADDRGP4 $563
+JUMPV
+LABELV $566
+ADDRLP4 4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 3
+NEI4 $569
+ADDRGP4 $563
+JUMPV
+LABELV $569
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1032
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $571
+LABELV $563
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $565
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $559
+INDIRI4
+GEI4 $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $562
+LABELV $573
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $574
+ADDRLP4 1028
+INDIRI4
+CNSTI4 5
+GTI4 $574
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $589-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $589
+address $575
+address $575
+address $578
+address $579
+address $581
+code
+LABELV $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRLP4 1028
+INDIRI4
+CNSTI4 10
+GTI4 $575
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $588
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1304
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1304
+INDIRI4
+LSHI4
+ADDRLP4 1032
+ADDP4
+ARGP4
+ADDRLP4 1304
+INDIRI4
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+LABELV $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $588
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $585
+LABELV $575
+LABELV $558
+endproc BotTeamOrders 1320 12
+export Bot1FCTFOrders_FlagAtCenter
+proc Bot1FCTFOrders_FlagAtCenter 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $592
+ADDRGP4 $591
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $595
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $596
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $600
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $604
+ADDRGP4 $597
+JUMPV
+LABELV $600
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $596
+JUMPV
+LABELV $604
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $596
+JUMPV
+LABELV $597
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $610
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $610
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $612
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $612
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $617
+JUMPV
+LABELV $614
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $615
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $617
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $614
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $618
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $619
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $618
+ADDRGP4 $596
+JUMPV
+LABELV $595
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $626
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $628
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $632
+ADDRGP4 $625
+JUMPV
+LABELV $628
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $632
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $639
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $639
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $641
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $641
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $643
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $644
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $646
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $643
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $650
+JUMPV
+LABELV $647
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $648
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $650
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $647
+LABELV $626
+LABELV $596
+LABELV $591
+endproc Bot1FCTFOrders_FlagAtCenter 320 16
+export Bot1FCTFOrders_TeamHasFlag
+proc Bot1FCTFOrders_TeamHasFlag 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $655
+ADDRGP4 $654
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $658
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $659
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $663
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $669
+ADDRGP4 $660
+JUMPV
+LABELV $663
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $664
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $665
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $669
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $670
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $671
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $673
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $674
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $680
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $679
+JUMPV
+LABELV $680
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $679
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $660
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $682
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $682
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $684
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $684
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $690
+ADDRGP4 $687
+JUMPV
+LABELV $690
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $687
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $686
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $694
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $698
+ADDRGP4 $695
+JUMPV
+LABELV $698
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $702
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $703
+JUMPV
+LABELV $702
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $695
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $697
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $694
+ADDRGP4 $659
+JUMPV
+LABELV $692
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $710
+JUMPV
+LABELV $707
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $711
+ADDRGP4 $708
+JUMPV
+LABELV $711
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $708
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $710
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $707
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $718
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $720
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $724
+ADDRGP4 $717
+JUMPV
+LABELV $720
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $721
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $722
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $724
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $725
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $726
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $728
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $729
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $733
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $734
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $717
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $735
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $735
+ADDRLP4 304
+CNSTF4 1061997773
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 8
+LEI4 $737
+ADDRLP4 304
+CNSTI4 8
+ASGNI4
+LABELV $737
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $739
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $743
+ADDRGP4 $740
+JUMPV
+LABELV $743
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $740
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $742
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $739
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $748
+JUMPV
+LABELV $745
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $749
+ADDRGP4 $746
+JUMPV
+LABELV $749
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $753
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $754
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $746
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $748
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $745
+LABELV $718
+LABELV $659
+LABELV $654
+endproc Bot1FCTFOrders_TeamHasFlag 360 20
+export Bot1FCTFOrders_EnemyHasFlag
+proc Bot1FCTFOrders_EnemyHasFlag 316 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $759
+ADDRGP4 $758
+JUMPV
+LABELV $759
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $762
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $763
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $767
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $771
+ADDRGP4 $764
+JUMPV
+LABELV $767
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $763
+JUMPV
+LABELV $771
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $763
+JUMPV
+LABELV $764
+ADDRLP4 300
+CNSTF4 1061997773
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 8
+LEI4 $778
+ADDRLP4 300
+CNSTI4 8
+ASGNI4
+LABELV $778
+ADDRLP4 304
+CNSTF4 1036831949
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+LEI4 $780
+ADDRLP4 304
+CNSTI4 1
+ASGNI4
+LABELV $780
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $785
+JUMPV
+LABELV $782
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $783
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $785
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $782
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $789
+JUMPV
+LABELV $786
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $791
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $787
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $789
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $786
+ADDRGP4 $763
+JUMPV
+LABELV $762
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $795
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $797
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $801
+ADDRGP4 $794
+JUMPV
+LABELV $797
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $795
+JUMPV
+LABELV $801
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $791
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRLP4 300
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 7
+LEI4 $808
+ADDRLP4 300
+CNSTI4 7
+ASGNI4
+LABELV $808
+ADDRLP4 304
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+LEI4 $810
+ADDRLP4 304
+CNSTI4 2
+ASGNI4
+LABELV $810
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $815
+JUMPV
+LABELV $812
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $813
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $815
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $812
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $819
+JUMPV
+LABELV $816
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $791
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $817
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $819
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $816
+LABELV $795
+LABELV $763
+LABELV $758
+endproc Bot1FCTFOrders_EnemyHasFlag 316 16
+export Bot1FCTFOrders_EnemyDroppedFlag
+proc Bot1FCTFOrders_EnemyDroppedFlag 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $824
+ADDRGP4 $823
+JUMPV
+LABELV $824
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $827
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $828
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $832
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $836
+ADDRGP4 $829
+JUMPV
+LABELV $832
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $828
+JUMPV
+LABELV $836
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $828
+JUMPV
+LABELV $829
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $843
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $843
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $845
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $845
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $850
+JUMPV
+LABELV $847
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $848
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $850
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $847
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $854
+JUMPV
+LABELV $851
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $852
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $854
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $851
+ADDRGP4 $828
+JUMPV
+LABELV $827
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $859
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $861
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $865
+ADDRGP4 $858
+JUMPV
+LABELV $861
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $859
+JUMPV
+LABELV $865
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $859
+JUMPV
+LABELV $858
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $872
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $872
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $874
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $874
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $879
+JUMPV
+LABELV $876
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $877
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $879
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $876
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $883
+JUMPV
+LABELV $880
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $881
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $883
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $880
+LABELV $859
+LABELV $828
+LABELV $823
+endproc Bot1FCTFOrders_EnemyDroppedFlag 320 16
+export Bot1FCTFOrders
+proc Bot1FCTFOrders 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $888
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GTI4 $888
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $895
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $895
+address $891
+address $892
+address $893
+address $894
+code
+LABELV $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_FlagAtCenter
+CALLV
+pop
+ADDRGP4 $889
+JUMPV
+LABELV $892
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_TeamHasFlag
+CALLV
+pop
+ADDRGP4 $889
+JUMPV
+LABELV $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_EnemyHasFlag
+CALLV
+pop
+ADDRGP4 $889
+JUMPV
+LABELV $894
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_EnemyDroppedFlag
+CALLV
+pop
+LABELV $888
+LABELV $889
+LABELV $887
+endproc Bot1FCTFOrders 8 4
+export BotObeliskOrders
+proc BotObeliskOrders 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $897
+ADDRGP4 $896
+JUMPV
+LABELV $897
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $900
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $901
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $905
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $909
+ADDRGP4 $902
+JUMPV
+LABELV $905
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $901
+JUMPV
+LABELV $909
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $901
+JUMPV
+LABELV $902
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $916
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $916
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $918
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $918
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $923
+JUMPV
+LABELV $920
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $921
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $923
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $920
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $927
+JUMPV
+LABELV $924
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $925
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $927
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $924
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $932
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $934
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $938
+ADDRGP4 $931
+JUMPV
+LABELV $934
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $938
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $945
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $945
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $947
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $947
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $952
+JUMPV
+LABELV $949
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $950
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $952
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $949
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $953
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $954
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $956
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $953
+LABELV $932
+LABELV $901
+LABELV $896
+endproc BotObeliskOrders 320 16
+export BotHarvesterOrders
+proc BotHarvesterOrders 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $961
+ADDRGP4 $960
+JUMPV
+LABELV $961
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $964
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $965
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $969
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $974
+ADDRGP4 $966
+JUMPV
+LABELV $969
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $974
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $965
+JUMPV
+LABELV $966
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $981
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $981
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $983
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $983
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $988
+JUMPV
+LABELV $985
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $986
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $988
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $985
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $992
+JUMPV
+LABELV $989
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $990
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $992
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $989
+ADDRGP4 $965
+JUMPV
+LABELV $964
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $997
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $999
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $1003
+ADDRGP4 $996
+JUMPV
+LABELV $999
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $997
+JUMPV
+LABELV $1003
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $997
+JUMPV
+LABELV $996
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $1010
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $1010
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $1012
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $1012
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1017
+JUMPV
+LABELV $1014
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $1015
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1017
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $1014
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1021
+JUMPV
+LABELV $1018
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $1019
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1021
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $1018
+LABELV $997
+LABELV $965
+LABELV $960
+endproc BotHarvesterOrders 320 16
+export FindHumanTeamLeader
+proc FindHumanTeamLeader 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1026
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1033
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1037
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1041
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $1043
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotVoiceChat_Defend
+CALLV
+pop
+LABELV $1043
+LABELV $1041
+CNSTI4 1
+RETI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1039
+LABELV $1037
+LABELV $1033
+LABELV $1030
+LABELV $1027
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1026
+CNSTI4 0
+RETI4
+LABELV $1025
+endproc FindHumanTeamLeader 12 12
+export BotTeamAI
+proc BotTeamAI 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $1047
+ADDRGP4 $1046
+JUMPV
+LABELV $1047
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1052
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+NEI4 $1050
+LABELV $1052
+ADDRGP4 $1046
+JUMPV
+LABELV $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotValidTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1053
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 FindHumanTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $1055
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $1057
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $1057
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1059
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1060
+JUMPV
+LABELV $1059
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1060
+LABELV $1057
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $1061
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1063
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1061
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1046
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1046
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1066
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1067
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1046
+JUMPV
+LABELV $1055
+LABELV $1053
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1068
+ADDRGP4 $1046
+JUMPV
+LABELV $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotNumTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+LTI4 $1070
+ADDRLP4 52
+INDIRI4
+CNSTI4 11
+GTI4 $1070
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1122-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1122
+address $1072
+address $1078
+address $1099
+address $1110
+address $1116
+address $1070
+address $1078
+address $1070
+address $1092
+code
+LABELV $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1075
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1073
+LABELV $1075
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1073
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1071
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $1071
+JUMPV
+LABELV $1078
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1084
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1084
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1084
+ADDRGP4 lastRoundNumber
+INDIRI4
+ADDRGP4 level+9236
+INDIRI4
+EQI4 $1079
+LABELV $1084
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 lastRoundNumber
+ADDRGP4 level+9236
+INDIRI4
+ASGNI4
+LABELV $1079
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $1086
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $1088
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1088
+LABELV $1086
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1071
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1071
+JUMPV
+LABELV $1092
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1096
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1096
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1093
+LABELV $1096
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1093
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1071
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDDorders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1071
+JUMPV
+LABELV $1099
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1103
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1100
+LABELV $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $1106
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1106
+LABELV $1104
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1071
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1071
+JUMPV
+LABELV $1110
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1113
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1111
+LABELV $1113
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1111
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1071
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRGP4 $1071
+JUMPV
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1119
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1117
+LABELV $1119
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1117
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1071
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+LABELV $1070
+LABELV $1071
+LABELV $1046
+endproc BotTeamAI 72 12
+bss
+export lastRoundNumber
+align 4
+LABELV lastRoundNumber
+skip 4
+export ctftaskpreferences
+align 4
+LABELV ctftaskpreferences
+skip 2560
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1067
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1066
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1063
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $971
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $791
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $668
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $667
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $455
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 98
+byte 1 0
+align 1
+LABELV $450
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $329
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $328
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $246
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $222
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $214
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $210
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $198
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $197
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $180
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $81
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 110
+byte 1 0
+align 1
+LABELV $70
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
@@ -0,0 +1,32396 @@
+data
+export g_admin_cmds
+align 4
+LABELV g_admin_cmds
+address $60
+address G_admin_adjustban
+address $61
+address $62
+address $63
+address $64
+address G_admin_admintest
+address $65
+address $66
+address $67
+address $68
+address G_admin_allready
+address $69
+address $70
+address $67
+address $71
+address G_admin_ban
+address $61
+address $72
+address $73
+address $74
+address G_admin_cancelvote
+address $75
+address $76
+address $67
+address $77
+address G_admin_disorient
+address $78
+address $79
+address $80
+address $81
+address G_admin_help
+address $82
+address $83
+address $84
+address $85
+address G_admin_kick
+address $86
+address $87
+address $88
+address $89
+address G_admin_listadmins
+address $90
+address $91
+address $92
+address $93
+address G_admin_listplayers
+address $94
+address $95
+address $67
+address $96
+address G_admin_lock
+address $97
+address $98
+address $99
+address $100
+address G_admin_map
+address $101
+address $102
+address $103
+address $104
+address G_admin_mute
+address $105
+address $106
+address $107
+address $108
+address G_admin_namelog
+address $109
+address $110
+address $111
+address $112
+address G_admin_nextmap
+address $113
+address $114
+address $67
+address $115
+address G_admin_orient
+address $78
+address $116
+address $107
+address $117
+address G_admin_passvote
+address $118
+address $119
+address $67
+address $120
+address G_admin_putteam
+address $121
+address $122
+address $123
+address $124
+address G_admin_readconfig
+address $125
+address $126
+address $67
+address $127
+address G_admin_rename
+address $128
+address $129
+address $130
+address $131
+address G_admin_restart
+address $132
+address $133
+address $67
+address $134
+address G_admin_setlevel
+address $135
+address $136
+address $137
+address $138
+address G_admin_showbans
+address $139
+address $140
+address $141
+address $142
+address G_admin_shuffle
+address $143
+address $144
+skip 4
+address $145
+address G_admin_slap
+address $146
+address $147
+address $148
+address $149
+address G_admin_spec999
+address $150
+address $151
+address $67
+address $152
+address G_admin_time
+address $153
+address $154
+address $67
+address $155
+address G_admin_unban
+address $61
+address $156
+address $157
+address $158
+address G_admin_unlock
+address $97
+address $159
+address $99
+address $160
+address G_admin_mute
+address $105
+address $161
+address $107
+address $162
+address G_admin_warn
+address $163
+address $164
+address $165
+align 4
+LABELV adminNumCmds
+byte 4 31
+align 4
+LABELV admin_level_maxname
+byte 4 0
+export G_admin_permission
+code
+proc G_admin_permission 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $167
+CNSTI4 1
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $167
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $178
+CNSTI4 1
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $180
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $185
+CNSTI4 0
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $187
+ADDRGP4 $181
+JUMPV
+LABELV $187
+LABELV $183
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $182
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $189
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $194
+CNSTI4 0
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $194
+LABELV $192
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $191
+ADDRLP4 24
+ADDRFP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+EQI4 $197
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+EQI4 $197
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $198
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $189
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $176
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $175
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $173
+LABELV $170
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+GEI4 $199
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $169
+LABELV $199
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $203
+JUMPV
+LABELV $200
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $204
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $209
+CNSTI4 1
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $209
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $211
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $216
+CNSTI4 0
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $216
+LABELV $214
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $213
+ADDRLP4 24
+ADDRFP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+EQI4 $219
+ADDRLP4 24
+INDIRI4
+CNSTI4 33
+EQI4 $219
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $220
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $211
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $207
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $206
+LABELV $204
+LABELV $201
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $203
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+GEI4 $221
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $200
+LABELV $221
+CNSTI4 0
+RETI4
+LABELV $166
+endproc G_admin_permission 28 8
+lit
+align 1
+LABELV $223
+byte 1 0
+skip 31
+align 1
+LABELV $224
+byte 1 0
+skip 31
+export G_admin_name_check
+code
+proc G_admin_name_check 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $223
+INDIRB
+ASGNB 32
+ADDRLP4 40
+ADDRGP4 $224
+INDIRB
+ASGNB 32
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $225
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $225
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $228
+ADDRLP4 36
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $233
+ADDRGP4 $229
+JUMPV
+LABELV $233
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+NEI4 $235
+ADDRGP4 $229
+JUMPV
+LABELV $235
+ADDRLP4 36
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $239
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $237
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $228
+ADDRGP4 g_adminNameProtect+12
+INDIRI4
+CNSTI4 0
+NEI4 $240
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $240
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $246
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $247
+ADDRGP4 $244
+JUMPV
+LABELV $247
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $249
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $246
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $252
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $243
+LABELV $252
+CNSTI4 1
+RETI4
+LABELV $222
+endproc G_admin_name_check 84 16
+proc admin_higher_guid 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $258
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $258
+LABELV $255
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $257
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $260
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $254
+LABELV $260
+LABELV $256
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $261
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+GEI4 $267
+CNSTI4 0
+RETI4
+ADDRGP4 $253
+JUMPV
+LABELV $267
+ADDRGP4 $269
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $271
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $272
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $253
+JUMPV
+LABELV $265
+LABELV $262
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $273
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $261
+LABELV $273
+CNSTI4 1
+RETI4
+LABELV $253
+endproc admin_higher_guid 28 8
+proc admin_higher 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $275
+CNSTI4 1
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $275
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $277
+CNSTI4 1
+RETI4
+ADDRGP4 $274
+JUMPV
+LABELV $277
+ADDRLP4 0
+CNSTI4 516
+ASGNI4
+ADDRLP4 4
+CNSTI4 912
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 admin_higher_guid
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $274
+endproc admin_higher 12 8
+lit
+align 1
+LABELV $280
+byte 1 0
+skip 1023
+code
+proc admin_writeconfig 1072 12
+ADDRLP4 12
+ADDRGP4 $280
+INDIRB
+ASGNB 1024
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $281
+ADDRGP4 $284
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $279
+JUMPV
+LABELV $281
+CNSTP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+GEI4 $286
+ADDRGP4 $288
+ARGP4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $279
+JUMPV
+LABELV $286
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $290
+ADDRGP4 $294
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $295
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $296
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $291
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $293
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $299
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $290
+LABELV $299
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRGP4 $301
+JUMPV
+LABELV $304
+ADDRGP4 $306
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $296
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $307
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $295
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $301
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $303
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $308
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $300
+LABELV $308
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $312
+JUMPV
+LABELV $309
+ADDRLP4 1060
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $313
+ADDRGP4 $310
+JUMPV
+LABELV $313
+ADDRGP4 $315
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $296
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $307
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $316
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $317
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $318
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 155
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $319
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $320
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $310
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $312
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $321
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $309
+LABELV $321
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $322
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRGP4 $326
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $327
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $328
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $329
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $330
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $331
+ADDRGP4 $335
+ARGP4
+ADDRLP4 1064
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $332
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $334
+ADDRLP4 1064
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $331
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $323
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $325
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $336
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $322
+LABELV $336
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $340
+JUMPV
+LABELV $337
+ADDRLP4 1068
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $341
+ADDRLP4 1068
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $341
+ADDRGP4 $338
+JUMPV
+LABELV $341
+ADDRGP4 $343
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRGP4 $296
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $307
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $316
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $344
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $318
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1129
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $319
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_int
+CALLV
+pop
+ADDRGP4 $345
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 writeFile_string
+CALLV
+pop
+ADDRGP4 $298
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $338
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $346
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $337
+LABELV $346
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $279
+endproc admin_writeconfig 1072 12
+proc admin_default_levels 16 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $348
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $349
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $351
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $352
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $348
+LABELV $352
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $353
+CNSTU4 100
+ARGU4
+ADDRLP4 12
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $354
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $353
+ADDRGP4 g_admin_levels
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $357
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $360
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $362
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+8
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $366
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+12
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $368
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+12
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+16
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $372
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+16
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $374
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+20
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 $376
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 g_admin_levels+20
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 admin_level_maxname
+CNSTI4 15
+ASGNI4
+LABELV $347
+endproc admin_default_levels 16 12
+export G_admin_level
+proc G_admin_level 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $380
+CNSTI4 32
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $380
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $379
+JUMPV
+LABELV $386
+LABELV $383
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $388
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $382
+LABELV $388
+CNSTI4 0
+RETI4
+LABELV $379
+endproc G_admin_level 8 8
+proc admin_command_permission 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $390
+CNSTI4 1
+RETI4
+ADDRGP4 $389
+JUMPV
+LABELV $390
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $392
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $396
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $398
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $402
+CNSTI4 1
+RETI4
+ADDRGP4 $389
+JUMPV
+LABELV $402
+LABELV $399
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $401
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $398
+LABELV $396
+LABELV $393
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $395
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $404
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $392
+LABELV $404
+CNSTI4 0
+RETI4
+LABELV $389
+endproc admin_command_permission 20 8
+proc admin_log 1528 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1172
+CNSTP4 0
+ASGNP4
+ADDRGP4 g_adminLog+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $405
+JUMPV
+LABELV $406
+ADDRGP4 g_adminLog+16
+ARGP4
+ADDRLP4 1176
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1480
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1188
+ADDRLP4 1480
+INDIRI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+GEI4 $410
+ADDRGP4 $412
+ARGP4
+ADDRGP4 g_adminLog+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $405
+JUMPV
+LABELV $410
+ADDRLP4 144
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 1488
+CNSTI4 60
+ASGNI4
+ADDRLP4 1180
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1488
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1488
+INDIRI4
+ADDRLP4 1180
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 1496
+CNSTI4 10
+ASGNI4
+ADDRLP4 1184
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1184
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $415
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $417
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1500
+INDIRI4
+CNSTI4 0
+NEI4 $421
+ADDRLP4 132
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $423
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $427
+ADDRLP4 136
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 136
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $419
+JUMPV
+LABELV $427
+LABELV $424
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $426
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $423
+LABELV $429
+ADDRGP4 $419
+JUMPV
+LABELV $421
+LABELV $418
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $420
+ADDRLP4 140
+INDIRI4
+CNSTI4 1024
+GEI4 $430
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $417
+LABELV $430
+LABELV $419
+LABELV $415
+ADDRLP4 1500
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1500
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $431
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1192
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1192
+ARGP4
+ADDRLP4 1224
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1504
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 1
+NEI4 $433
+ADDRLP4 1172
+CNSTI4 816
+ADDRLP4 1224
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $433
+LABELV $431
+ADDRLP4 1172
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $435
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 1504
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+EQI4 $435
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1520
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 1180
+INDIRI4
+ARGI4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $444
+ADDRLP4 1508
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 1508
+CNSTI4 -1
+ASGNI4
+LABELV $445
+ADDRLP4 1508
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $446
+ADDRLP4 1512
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 1512
+ADDRGP4 $440
+ASGNP4
+LABELV $447
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $448
+ADDRLP4 1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 1516
+ADDRGP4 $442
+ASGNP4
+LABELV $449
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1524
+ADDRLP4 1172
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1524
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1524
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1520
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1520
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $450
+ARGP4
+ADDRLP4 1180
+INDIRI4
+ARGI4
+ADDRLP4 1184
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $454
+ADDRLP4 1508
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 1508
+CNSTI4 -1
+ASGNI4
+LABELV $455
+ADDRLP4 1508
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $456
+ADDRLP4 1512
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRLP4 1512
+ADDRGP4 $440
+ASGNP4
+LABELV $457
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $458
+ADDRLP4 1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 1516
+ADDRGP4 $442
+ASGNP4
+LABELV $459
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1520
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $436
+ADDRLP4 148
+ARGP4
+ADDRLP4 1508
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 148
+ARGP4
+ADDRLP4 1508
+INDIRI4
+ARGI4
+ADDRLP4 1176
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 1176
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $405
+endproc admin_log 1528 56
+lit
+align 1
+LABELV $461
+byte 1 0
+skip 31
+align 1
+LABELV $462
+byte 1 0
+skip 31
+align 1
+LABELV $463
+byte 1 0
+skip 31
+code
+proc admin_listadmins 168 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRGP4 $461
+INDIRB
+ASGNB 32
+ADDRLP4 53
+ADDRGP4 $462
+INDIRB
+ASGNB 32
+ADDRLP4 12
+ADDRGP4 $463
+INDIRB
+ASGNB 32
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $464
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $471
+ADDRLP4 132
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $469
+LABELV $471
+ADDRGP4 $465
+JUMPV
+LABELV $469
+ADDRLP4 136
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 136
+INDIRP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $472
+ADDRGP4 $465
+JUMPV
+LABELV $472
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 936
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $474
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $478
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $482
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $484
+ADDRLP4 160
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $488
+ADDRLP4 160
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $488
+ADDRLP4 164
+ADDRLP4 160
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRLP4 164
+INDIRI4
+CNSTI4 48
+LTI4 $488
+ADDRLP4 164
+INDIRI4
+CNSTI4 56
+GTI4 $488
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $488
+LABELV $485
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $487
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $484
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $490
+ARGP4
+ADDRGP4 admin_level_maxname
+INDIRI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $480
+JUMPV
+LABELV $482
+LABELV $479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $481
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $491
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $478
+LABELV $491
+LABELV $480
+ADDRGP4 $492
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $465
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $467
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $493
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $464
+LABELV $493
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $497
+JUMPV
+LABELV $494
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $498
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $500
+ADDRGP4 $495
+JUMPV
+LABELV $500
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $502
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $509
+ADDRLP4 140
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $507
+LABELV $509
+ADDRGP4 $503
+JUMPV
+LABELV $507
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 53
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 53
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $510
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $510
+LABELV $503
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $505
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $502
+LABELV $504
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRGP4 $495
+JUMPV
+LABELV $512
+LABELV $498
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $514
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $515
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $514
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $518
+ADDRLP4 136
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+NEI4 $522
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $524
+ADDRLP4 152
+ADDRLP4 140
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $528
+ADDRLP4 152
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $528
+ADDRLP4 156
+ADDRLP4 152
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 156
+INDIRI4
+CNSTI4 48
+LTI4 $528
+ADDRLP4 156
+INDIRI4
+CNSTI4 56
+GTI4 $528
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $528
+LABELV $525
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $527
+ADDRLP4 140
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $524
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $490
+ARGP4
+ADDRGP4 admin_level_maxname
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $520
+JUMPV
+LABELV $522
+LABELV $519
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $521
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $530
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $518
+LABELV $530
+LABELV $520
+ADDRGP4 $492
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $495
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $497
+ADDRLP4 8
+INDIRI4
+CNSTI4 1024
+GEI4 $532
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $532
+ADDRLP4 128
+INDIRI4
+CNSTI4 20
+LTI4 $494
+LABELV $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+ADDRLP4 128
+INDIRI4
+RETI4
+LABELV $460
+endproc admin_listadmins 168 24
+export G_admin_duration
+proc G_admin_duration 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1576800000
+GTI4 $536
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $534
+LABELV $536
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $537
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRI4
+CNSTI4 31536000
+LTI4 $538
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $540
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1274059200
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRI4
+CNSTI4 7776000
+LTI4 $541
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $543
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1226024960
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRFP4 0
+INDIRI4
+CNSTI4 86400
+LTI4 $544
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $546
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1202241536
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRI4
+CNSTI4 3600
+LTI4 $547
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $549
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1163984896
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $547
+ADDRFP4 0
+INDIRI4
+CNSTI4 60
+LTI4 $550
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $552
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1114636288
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $550
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $553
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $551
+LABELV $548
+LABELV $545
+LABELV $542
+LABELV $539
+LABELV $535
+LABELV $533
+endproc G_admin_duration 4 16
+export G_admin_ban_check
+proc G_admin_ban_check 80 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $555
+CNSTI4 0
+RETI4
+ADDRGP4 $554
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $558
+CNSTI4 0
+RETI4
+ADDRGP4 $554
+JUMPV
+LABELV $558
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $560
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $561
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $565
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $565
+ADDRGP4 $562
+JUMPV
+LABELV $565
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $567
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $570
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $554
+JUMPV
+LABELV $567
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $571
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $571
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 44
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $573
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $554
+JUMPV
+LABELV $571
+LABELV $562
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $564
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $574
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $561
+LABELV $574
+CNSTI4 0
+RETI4
+LABELV $554
+endproc G_admin_ban_check 80 24
+export G_admin_cmd_check
+proc G_admin_cmd_check 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $576
+CNSTI4 0
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $576
+ADDRLP4 12
+ARGP4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $582
+ADDRLP4 12
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 57
+ARGI4
+ADDRLP4 40
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $578
+LABELV $582
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+LABELV $578
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $583
+ADDRLP4 4
+ADDRLP4 12+1
+ASGNP4
+ADDRGP4 $584
+JUMPV
+LABELV $583
+CNSTI4 0
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $584
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $589
+JUMPV
+LABELV $586
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $590
+ADDRGP4 $587
+JUMPV
+LABELV $590
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 admin_command_permission
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $592
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $594
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 G_FloodLimited
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $594
+CNSTI4 1
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $594
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRGP4 $596
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+LABELV $593
+CNSTI4 1
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $587
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $589
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $597
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $586
+LABELV $597
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $598
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $602
+ADDRGP4 $599
+JUMPV
+LABELV $602
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $604
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 G_FloodLimited
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $607
+CNSTI4 1
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+4
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+ADDRGP4 $605
+JUMPV
+LABELV $604
+ADDRGP4 $596
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 admin_log
+CALLV
+pop
+LABELV $605
+CNSTI4 1
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $599
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $601
+ADDRLP4 0
+INDIRI4
+ADDRGP4 adminNumCmds
+INDIRI4
+LTI4 $598
+CNSTI4 0
+RETI4
+LABELV $575
+endproc G_admin_cmd_check 60 12
+export G_admin_namelog_cleanup
+proc G_admin_namelog_cleanup 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $614
+JUMPV
+LABELV $611
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $612
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $614
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+GEI4 $615
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $611
+LABELV $615
+LABELV $610
+endproc G_admin_namelog_cleanup 8 4
+export G_admin_namelog_update
+proc G_admin_namelog_update 104 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 2140
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $620
+JUMPV
+LABELV $617
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $621
+ADDRGP4 $618
+JUMPV
+LABELV $621
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $623
+ADDRLP4 80
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $623
+ADDRLP4 80
+INDIRI4
+CNSTI4 -1
+EQI4 $623
+ADDRGP4 $618
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $625
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $625
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $627
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $631
+ADDRGP4 $629
+JUMPV
+LABELV $631
+LABELV $628
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $630
+ADDRLP4 96
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $633
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $627
+LABELV $633
+LABELV $629
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $634
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $634
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRLP4 100
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $638
+JUMPV
+LABELV $637
+ADDRLP4 100
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $638
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $616
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $625
+LABELV $618
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $620
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $641
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $617
+LABELV $641
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+LTI4 $642
+ADDRGP4 $644
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $616
+JUMPV
+LABELV $642
+CNSTU4 244
+ARGU4
+ADDRLP4 84
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 244
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $645
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $646
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $645
+ADDRLP4 76
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 76
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $650
+ADDRLP4 88
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRLP4 88
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $651
+ADDRLP4 76
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+LABELV $616
+endproc G_admin_namelog_update 104 12
+lit
+align 1
+LABELV $752
+byte 1 0
+skip 1023
+export G_admin_readconfig
+code
+proc G_admin_readconfig 1188 24
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 80
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_admin_cleanup
+CALLV
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $653
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $656
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 admin_default_levels
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $653
+ADDRGP4 g_admin+16
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $658
+ADDRGP4 $660
+ARGP4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 admin_default_levels
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $658
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 88
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 admin_level_maxname
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 g_admin+16
+ARGP4
+ADDRGP4 COM_BeginParseSession
+CALLV
+pop
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 12
+ARGP4
+ADDRLP4 100
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $666
+ADDRGP4 $665
+JUMPV
+LABELV $666
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $670
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $668
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+LTI4 $671
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $671
+CNSTU4 100
+ARGU4
+ADDRLP4 108
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $673
+ADDRLP4 44
+INDIRI4
+CNSTI4 1024
+LTI4 $676
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $676
+CNSTU4 136
+ARGU4
+ADDRLP4 112
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $680
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $678
+ADDRLP4 52
+INDIRI4
+CNSTI4 1024
+LTI4 $681
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $681
+CNSTU4 212
+ARGU4
+ADDRLP4 116
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $685
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $683
+ADDRLP4 60
+INDIRI4
+CNSTI4 64
+LTI4 $686
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $686
+CNSTU4 268
+ARGU4
+ADDRLP4 120
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 124
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $690
+ARGP4
+ADDRLP4 120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $688
+ADDRLP4 72
+INDIRI4
+CNSTI4 1024
+LTI4 $691
+CNSTI4 0
+RETI4
+ADDRGP4 $652
+JUMPV
+LABELV $691
+CNSTU4 1184
+ARGU4
+ADDRLP4 124
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $695
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $694
+JUMPV
+LABELV $695
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $698
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $694
+JUMPV
+LABELV $698
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $701
+ADDRLP4 12
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $694
+JUMPV
+LABELV $701
+ADDRGP4 $704
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $707
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $707
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $711
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $709
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $709
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $697
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $712
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $712
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $714
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $714
+ADDRGP4 $716
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $705
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $717
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $719
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $719
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $711
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $721
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $721
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $723
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $723
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $727
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $725
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $725
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $730
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $728
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 155
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $728
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $733
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $731
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 176
+ADDP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $731
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $736
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $734
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $734
+ADDRGP4 $737
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $717
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $738
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $742
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $740
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $739
+JUMPV
+LABELV $740
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $745
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $743
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $739
+JUMPV
+LABELV $743
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $748
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $746
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $739
+JUMPV
+LABELV $746
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $751
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $749
+ADDRLP4 148
+ADDRGP4 $752
+INDIRB
+ASGNB 1024
+ADDRLP4 144
+ADDRLP4 148
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRLP4 144
+ARGP4
+ADDRLP4 1176
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 1172
+ADDRLP4 1176
+INDIRP4
+ASGNP4
+ADDRLP4 1172
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $756
+ADDRGP4 $755
+JUMPV
+LABELV $756
+ADDRLP4 1180
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1172
+INDIRP4
+ARGP4
+ADDRLP4 1184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+LABELV $754
+ADDRLP4 140
+INDIRI4
+CNSTI4 32
+LTI4 $753
+LABELV $755
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $739
+JUMPV
+LABELV $749
+ADDRGP4 $758
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $739
+JUMPV
+LABELV $738
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $759
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $761
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $761
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $711
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $763
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $763
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $765
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $765
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $769
+ARGP4
+ADDRLP4 136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $767
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $767
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $730
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $770
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1129
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $770
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $733
+ARGP4
+ADDRLP4 144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $772
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1180
+ADDP4
+ARGP4
+ADDRGP4 readFile_int
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $772
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $776
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $774
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 readFile_string
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $774
+ADDRGP4 $777
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+ADDRGP4 $760
+JUMPV
+LABELV $759
+ADDRGP4 $778
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 COM_ParseError
+CALLV
+pop
+LABELV $760
+LABELV $739
+LABELV $718
+LABELV $706
+LABELV $694
+LABELV $689
+LABELV $684
+LABELV $679
+LABELV $674
+LABELV $669
+LABELV $664
+ADDRGP4 $663
+JUMPV
+LABELV $665
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRGP4 $779
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $780
+ADDRGP4 admin_default_levels
+CALLV
+pop
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $785
+JUMPV
+LABELV $782
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 admin_level_maxname
+INDIRI4
+LEI4 $786
+ADDRGP4 admin_level_maxname
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $786
+LABELV $783
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $785
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $788
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $782
+LABELV $788
+LABELV $781
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $792
+JUMPV
+LABELV $789
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $794
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 G_admin_level
+CALLI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1000
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+LABELV $794
+LABELV $790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $792
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $789
+CNSTI4 1
+RETI4
+LABELV $652
+endproc G_admin_readconfig 1188 24
+export G_admin_time
+proc G_admin_time 40 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 $797
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $796
+endproc G_admin_time 40 16
+lit
+align 1
+LABELV $801
+byte 1 0
+skip 31
+align 1
+LABELV $802
+byte 1 0
+skip 31
+align 1
+LABELV $803
+byte 1 0
+skip 31
+export G_admin_setlevel
+code
+proc G_admin_setlevel 260 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $801
+INDIRB
+ASGNB 32
+ADDRLP4 116
+ADDRGP4 $802
+INDIRB
+ASGNB 32
+ADDRLP4 69
+ADDRGP4 $803
+INDIRB
+ASGNB 32
+ADDRLP4 112
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+CNSTI4 -1
+ASGNI4
+ADDRLP4 180
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $804
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $806
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $804
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 69
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 168
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 168
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 69
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $810
+JUMPV
+LABELV $807
+ADDRLP4 188
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 48
+LTI4 $813
+ADDRLP4 188
+INDIRI4
+CNSTI4 57
+LEI4 $811
+LABELV $813
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $811
+LABELV $808
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $810
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $814
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $807
+LABELV $814
+LABELV $809
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $815
+ADDRLP4 4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $815
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $817
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRI4
+LEI4 $817
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $819
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $817
+ADDRLP4 200
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 200
+INDIRU4
+NEU4 $820
+ADDRGP4 g_admin_levels
+INDIRP4
+CVPU4 4
+ADDRLP4 200
+INDIRU4
+NEU4 $820
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_admin_readconfig
+CALLI4
+pop
+LABELV $820
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $825
+JUMPV
+LABELV $822
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $826
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $826
+LABELV $823
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $825
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $828
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $822
+LABELV $828
+LABELV $824
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $829
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $831
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $829
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 208
+INDIRI4
+EQI4 $832
+ADDRLP4 160
+INDIRI4
+ADDRLP4 208
+INDIRI4
+LTI4 $832
+ADDRLP4 160
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $832
+ADDRLP4 112
+CNSTI4 816
+ADDRLP4 160
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $832
+ADDRLP4 220
+CNSTU4 0
+ASGNU4
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 220
+INDIRU4
+EQU4 $835
+ADDRLP4 224
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+CVPU4 4
+ADDRLP4 220
+INDIRU4
+EQU4 $835
+ADDRLP4 224
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $835
+ADDRLP4 116
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $836
+JUMPV
+LABELV $835
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $837
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+LTI4 $837
+ADDRLP4 160
+INDIRI4
+CNSTI4 1088
+GEI4 $837
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins-256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $837
+ADDRLP4 116
+ARGP4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins-256
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins-256
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $838
+JUMPV
+LABELV $837
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $845
+JUMPV
+LABELV $842
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 69
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 69
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 232
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $846
+ADDRLP4 116
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $846
+LABELV $843
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $845
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $849
+ADDRLP4 236
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 236
+INDIRI4
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $849
+ADDRLP4 108
+INDIRI4
+ADDRLP4 236
+INDIRI4
+LTI4 $842
+LABELV $849
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $853
+JUMPV
+LABELV $850
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $855
+ADDRGP4 $851
+JUMPV
+LABELV $855
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $857
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $857
+ADDRLP4 112
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $851
+JUMPV
+LABELV $857
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 69
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 69
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 244
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $859
+ADDRLP4 112
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $859
+LABELV $851
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $853
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+GEI4 $861
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+LTI4 $850
+LABELV $861
+ADDRLP4 244
+CNSTU4 0
+ASGNU4
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 244
+INDIRU4
+EQU4 $862
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 244
+INDIRU4
+EQU4 $862
+ADDRLP4 116
+ARGP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $862
+LABELV $838
+LABELV $836
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $864
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $866
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $864
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+LEI4 $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $869
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 admin_listadmins
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $870
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 236
+ADDRGP4 admin_higher_guid
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $870
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $872
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $870
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $873
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $877
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+LABELV $877
+LABELV $874
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $876
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $879
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $873
+LABELV $879
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $880
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+NEI4 $882
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $800
+JUMPV
+LABELV $882
+CNSTU4 136
+ARGU4
+ADDRLP4 244
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 164
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+ADDRLP4 164
+INDIRP4
+ASGNP4
+LABELV $880
+ADDRGP4 $885
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $887
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $888
+JUMPV
+LABELV $887
+ADDRLP4 244
+ADDRGP4 $442
+ASGNP4
+LABELV $888
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 256
+CNSTU4 0
+ASGNU4
+ADDRLP4 112
+INDIRP4
+CVPU4 4
+ADDRLP4 256
+INDIRU4
+EQU4 $889
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 256
+INDIRU4
+EQU4 $889
+ADDRLP4 112
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1000
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $889
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $894
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $892
+JUMPV
+LABELV $891
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $892
+CNSTI4 1
+RETI4
+LABELV $800
+endproc G_admin_setlevel 260 16
+proc admin_create_ban 60 36
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTU4 212
+ARGU4
+ADDRLP4 52
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $896
+CNSTI4 0
+RETI4
+ADDRGP4 $895
+JUMPV
+LABELV $896
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 155
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 $898
+ARGP4
+ADDRLP4 8+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+ADDRLP4 8+20
+INDIRI4
+CNSTI4 100
+MODI4
+ARGI4
+ADDRLP4 8+8
+INDIRI4
+ARGI4
+ADDRLP4 8+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $904
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 $442
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $905
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $906
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $907
+JUMPV
+LABELV $906
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $907
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $908
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRGP4 $910
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $909
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $914
+JUMPV
+LABELV $911
+LABELV $912
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $914
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $915
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $911
+LABELV $915
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+NEI4 $916
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $918
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $895
+JUMPV
+LABELV $916
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $895
+endproc admin_create_ban 60 36
+proc admin_create_warning 60 36
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTU4 1184
+ARGU4
+ADDRLP4 52
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $920
+CNSTI4 0
+RETI4
+ADDRGP4 $919
+JUMPV
+LABELV $920
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1129
+ADDP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 $898
+ARGP4
+ADDRLP4 8+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+ADDRLP4 8+20
+INDIRI4
+CNSTI4 100
+MODI4
+ARGI4
+ADDRLP4 8+8
+INDIRI4
+ARGI4
+ADDRLP4 8+4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $927
+ADDRLP4 4
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $928
+JUMPV
+LABELV $927
+ADDRLP4 4
+INDIRP4
+CNSTI4 1147
+ADDP4
+ARGP4
+ADDRGP4 $442
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $928
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $929
+ADDRLP4 4
+INDIRP4
+CNSTI4 1180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRLP4 4
+INDIRP4
+CNSTI4 1180
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $930
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $931
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRGP4 $933
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRLP4 4
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $932
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $937
+JUMPV
+LABELV $934
+LABELV $935
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $937
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $938
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $934
+LABELV $938
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+NEI4 $939
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $941
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $919
+JUMPV
+LABELV $939
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $919
+endproc admin_create_warning 60 36
+export G_admin_parse_time
+proc G_admin_parse_time 52 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $944
+JUMPV
+LABELV $943
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+LTI4 $948
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+LEI4 $950
+LABELV $948
+CNSTI4 -1
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $949
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $950
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $952
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+LEI4 $949
+LABELV $952
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $953
+ADDRGP4 $945
+JUMPV
+LABELV $953
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+CNSTI4 109
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $961
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $964
+LABELV $963
+ADDRLP4 40
+CNSTI4 100
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $959
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $955
+LABELV $965
+ADDRLP4 20
+INDIRI4
+CNSTI4 104
+EQI4 $960
+ADDRGP4 $955
+JUMPV
+LABELV $964
+ADDRLP4 48
+CNSTI4 115
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $956
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $955
+LABELV $966
+ADDRLP4 20
+INDIRI4
+CNSTI4 119
+EQI4 $958
+ADDRGP4 $955
+JUMPV
+LABELV $958
+ADDRLP4 0
+CNSTI4 7
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $959
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $960
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+LABELV $961
+ADDRLP4 0
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 $956
+JUMPV
+LABELV $955
+CNSTI4 -1
+RETI4
+ADDRGP4 $942
+JUMPV
+LABELV $956
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $944
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $943
+LABELV $945
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $967
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $967
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $942
+endproc G_admin_parse_time 52 0
+export G_admin_kick
+proc G_admin_kick 1396 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 296
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1328
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+EQI4 $970
+ADDRLP4 296
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $970
+ADDRLP4 1332
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+ADDRLP4 296
+INDIRI4
+GEI4 $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $974
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $969
+JUMPV
+LABELV $972
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1336
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1340
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 1
+EQI4 $975
+ADDRLP4 8
+ARGP4
+ADDRLP4 300
+INDIRI4
+ARGI4
+ADDRLP4 304
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $977
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 1344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $969
+JUMPV
+LABELV $975
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 0
+NEI4 $978
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $980
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $969
+JUMPV
+LABELV $978
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $983
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $969
+JUMPV
+LABELV $981
+ADDRGP4 $984
+ARGP4
+ADDRGP4 g_adminTempBan+16
+ARGP4
+ADDRLP4 1352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1352
+INDIRP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 1356
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $988
+ADDRLP4 1348
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $989
+JUMPV
+LABELV $988
+ADDRLP4 1348
+ADDRGP4 $986
+ASGNP4
+LABELV $989
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRGP4 admin_create_ban
+CALLI4
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $990
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $990
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $997
+ADDRGP4 $994
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1364
+ADDRLP4 1372
+INDIRP4
+ASGNP4
+ADDRGP4 $998
+JUMPV
+LABELV $997
+ADDRLP4 1364
+ADDRGP4 $67
+ASGNP4
+LABELV $998
+ADDRGP4 $993
+ARGP4
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $999
+ADDRLP4 1368
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1000
+JUMPV
+LABELV $999
+ADDRLP4 1368
+ADDRGP4 $986
+ASGNP4
+LABELV $1000
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRLP4 1376
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1005
+ADDRGP4 $1002
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1388
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1380
+ADDRLP4 1388
+INDIRP4
+ASGNP4
+ADDRGP4 $1006
+JUMPV
+LABELV $1005
+ADDRLP4 1380
+ADDRGP4 $67
+ASGNP4
+LABELV $1006
+ADDRGP4 $1001
+ARGP4
+ADDRLP4 1380
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1007
+ADDRLP4 1384
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1008
+JUMPV
+LABELV $1007
+ADDRLP4 1384
+ADDRGP4 $986
+ASGNP4
+LABELV $1008
+ADDRLP4 1384
+INDIRP4
+ARGP4
+ADDRLP4 1392
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1392
+INDIRP4
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $969
+endproc G_admin_kick 1396 24
+export G_admin_ban
+proc G_admin_ban 1284 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 -1
+ASGNI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1196
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1200
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+ADDRLP4 1192
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $1011
+JUMPV
+LABELV $1010
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1204
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $1016
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1208
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1212
+CNSTI4 0
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+ADDRLP4 1212
+INDIRI4
+NEI4 $1016
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+ADDRLP4 1212
+INDIRI4
+EQI4 $1012
+LABELV $1016
+ADDRLP4 1192
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRGP4 $1013
+JUMPV
+LABELV $1012
+ADDRLP4 1192
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+LABELV $1013
+LABELV $1011
+ADDRLP4 1216
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+ADDRLP4 1192
+INDIRI4
+GEI4 $1017
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1019
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1017
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 92
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 92
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 168
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 168
+ARGP4
+ADDRLP4 1220
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 1220
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+GTI4 $1020
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1022
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1224
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $1022
+ADDRGP4 $1025
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1228
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1228
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1232
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $1023
+JUMPV
+LABELV $1022
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1228
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+EQI4 $1028
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1029
+JUMPV
+LABELV $1028
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1030
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1029
+LABELV $1023
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1232
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 1232
+INDIRP4
+ASGNP4
+ADDRGP4 $1021
+JUMPV
+LABELV $1020
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1031
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1224
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+NEI4 $1031
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1228
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1228
+INDIRI4
+LEI4 $1031
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1232
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1236
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 1236
+INDIRI4
+ASGNI4
+LABELV $1031
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 1232
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 128
+ADDRLP4 1232
+INDIRP4
+ASGNP4
+LABELV $1021
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1041
+JUMPV
+LABELV $1038
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1042
+ADDRGP4 $1039
+JUMPV
+LABELV $1042
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1044
+ADDRGP4 $1039
+JUMPV
+LABELV $1044
+ADDRGP4 $1048
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1224
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $1046
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRLP4 88
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $1040
+JUMPV
+LABELV $1046
+LABELV $1039
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1041
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1049
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1038
+LABELV $1049
+LABELV $1040
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1050
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1054
+ADDRGP4 $1051
+JUMPV
+LABELV $1054
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 1228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1228
+INDIRI4
+CNSTI4 0
+NEI4 $1056
+ADDRLP4 1232
+CNSTI4 1
+ASGNI4
+ADDRLP4 88
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRGP4 $1052
+JUMPV
+LABELV $1056
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1061
+JUMPV
+LABELV $1058
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1232
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1062
+ADDRLP4 72
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1064
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1064
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1062
+LABELV $1059
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1061
+ADDRLP4 1236
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1236
+INDIRI4
+GEI4 $1066
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1236
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1058
+LABELV $1066
+LABELV $1051
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1053
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $1068
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1068
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1050
+LABELV $1068
+LABELV $1052
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $1069
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1071
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1069
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+LEI4 $1072
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1074
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1078
+JUMPV
+LABELV $1075
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1079
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1080
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1079
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1086
+JUMPV
+LABELV $1083
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 1236
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1087
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1089
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1091
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1089
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1095
+ADDRGP4 $1048
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1244
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1240
+ADDRLP4 1244
+INDIRP4
+ASGNP4
+ADDRGP4 $1096
+JUMPV
+LABELV $1095
+ADDRLP4 1240
+ADDRGP4 $1093
+ASGNP4
+LABELV $1096
+ADDRGP4 $1092
+ARGP4
+ADDRLP4 1240
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 1248
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 1248
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1252
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1087
+LABELV $1084
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1086
+ADDRLP4 1240
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1240
+INDIRI4
+GEI4 $1097
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1240
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1083
+LABELV $1097
+LABELV $1076
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1078
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1098
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1075
+LABELV $1098
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1072
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1099
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 1236
+ADDRGP4 admin_higher_guid
+CALLI4
+ASGNI4
+ADDRLP4 1236
+INDIRI4
+CNSTI4 0
+NEI4 $1099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1101
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1099
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRGP4 $1104
+ARGP4
+ADDRLP4 1240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $1102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1105
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1102
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1107
+ADDRLP4 1244
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $1108
+JUMPV
+LABELV $1107
+ADDRLP4 1244
+CNSTI4 -1
+ASGNI4
+LABELV $1108
+ADDRLP4 1244
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1248
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+INDIRP4
+ARGP4
+ADDRLP4 1248
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 1248
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 admin_create_ban
+CALLI4
+pop
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 240
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1112
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1110
+JUMPV
+LABELV $1109
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 1256
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $1113
+LABELV $1115
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1116
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1114
+JUMPV
+LABELV $1113
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1114
+LABELV $1110
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1117
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1122
+ADDRLP4 1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1123
+JUMPV
+LABELV $1122
+ADDRLP4 1260
+ADDRGP4 $442
+ASGNP4
+LABELV $1123
+ADDRLP4 1260
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1124
+ADDRLP4 1264
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $1125
+JUMPV
+LABELV $1124
+ADDRLP4 1264
+ADDRGP4 $910
+ASGNP4
+LABELV $1125
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1117
+ADDRGP4 $1126
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1129
+ADDRLP4 1260
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1130
+JUMPV
+LABELV $1129
+ADDRLP4 1260
+ADDRGP4 $442
+ASGNP4
+LABELV $1130
+ADDRLP4 1260
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1131
+ADDRLP4 1264
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $1132
+JUMPV
+LABELV $1131
+ADDRLP4 1264
+ADDRGP4 $910
+ASGNP4
+LABELV $1132
+ADDRLP4 1264
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1268
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1133
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1136
+ADDRLP4 1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1137
+JUMPV
+LABELV $1136
+ADDRLP4 1272
+ADDRGP4 $442
+ASGNP4
+LABELV $1137
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1138
+ADDRLP4 1276
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRGP4 $1139
+JUMPV
+LABELV $1138
+ADDRLP4 1276
+ADDRGP4 $910
+ASGNP4
+LABELV $1139
+ADDRLP4 1276
+INDIRP4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1009
+endproc G_admin_ban 1284 24
+export G_admin_unban
+proc G_admin_unban 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1141
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1143
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1141
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1148
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GTI4 $1148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1144
+LABELV $1148
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1149
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1144
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1150
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 32
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1150
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1153
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1150
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1154
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 36
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1154
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+LEI4 $1154
+ADDRGP4 $1159
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1154
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1162
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1165
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1166
+JUMPV
+LABELV $1165
+ADDRLP4 44
+ADDRGP4 $442
+ASGNP4
+LABELV $1166
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1167
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1167
+CNSTI4 1
+RETI4
+LABELV $1140
+endproc G_admin_unban 56 16
+lit
+align 1
+LABELV $1171
+byte 1 0
+skip 31
+export G_admin_adjustban
+code
+proc G_admin_adjustban 1156 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 1045
+ADDRGP4 $1171
+INDIRB
+ASGNB 32
+ADDRLP4 1044
+CNSTI1 0
+ASGNI1
+ADDRLP4 1092
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $1172
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1174
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1172
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1077
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1077
+ARGP4
+ADDRLP4 1096
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $1179
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+GTI4 $1179
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1175
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1180
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1175
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1182
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1104
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1184
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1182
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1185
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1108
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1185
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1112
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+ADDRLP4 1112
+INDIRI4
+LEI4 $1185
+ADDRGP4 $1189
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1185
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1116
+ADDRLP4 12
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 43
+EQI4 $1193
+ADDRLP4 1116
+INDIRI4
+CNSTI4 45
+NEI4 $1191
+LABELV $1193
+ADDRLP4 1044
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $1191
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1195
+ADDRLP4 1120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1195
+ADDRLP4 1120
+CNSTI4 0
+ASGNI4
+LABELV $1196
+ADDRLP4 1120
+INDIRI4
+ADDRLP4 12
+ADDP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+GEI4 $1197
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1198
+JUMPV
+LABELV $1197
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $1199
+ADDRLP4 1128
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1128
+INDIRI4
+NEI4 $1201
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+ADDRLP4 1128
+INDIRI4
+EQI4 $1201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1203
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1201
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $1204
+ADDRLP4 1084
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1205
+JUMPV
+LABELV $1204
+ADDRLP4 1044
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $1206
+ADDRLP4 1084
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1207
+JUMPV
+LABELV $1206
+ADDRLP4 1084
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1207
+LABELV $1205
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+GTI4 $1208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1210
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1208
+ADDRGP4 g_adminMaxBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1132
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $1200
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1136
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+ADDRLP4 1136
+INDIRI4
+LEI4 $1200
+ADDRGP4 $1215
+ARGP4
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_adminMaxBan+16
+ARGP4
+ADDRLP4 1144
+ADDRGP4 G_admin_parse_time
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1144
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1200
+JUMPV
+LABELV $1199
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRLP4 1128
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $1218
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1210
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1219
+LABELV $1200
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+EQI4 $1221
+ADDRLP4 1132
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRLP4 1132
+CNSTI4 -1
+ASGNI4
+LABELV $1222
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1045
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+LABELV $1198
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 1128
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1128
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1223
+ADDRLP4 0
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1223
+ADDRGP4 $1225
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1233
+ADDRLP4 1132
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1234
+JUMPV
+LABELV $1233
+ADDRLP4 1132
+ADDRGP4 $442
+ASGNP4
+LABELV $1234
+ADDRLP4 1132
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+LTI4 $1235
+ADDRLP4 1136
+ADDRGP4 $1227
+ASGNP4
+ADDRGP4 $1236
+JUMPV
+LABELV $1235
+ADDRLP4 1136
+ADDRGP4 $67
+ASGNP4
+LABELV $1236
+ADDRLP4 1136
+INDIRP4
+ARGP4
+ADDRLP4 1045
+ARGP4
+ADDRLP4 1148
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1148
+INDIRI4
+LTI4 $1237
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1148
+INDIRI4
+EQI4 $1237
+ADDRLP4 1140
+ADDRGP4 $1229
+ASGNP4
+ADDRGP4 $1238
+JUMPV
+LABELV $1237
+ADDRLP4 1140
+ADDRGP4 $67
+ASGNP4
+LABELV $1238
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1239
+ADDRLP4 1144
+ADDRGP4 $1231
+ASGNP4
+ADDRGP4 $1240
+JUMPV
+LABELV $1239
+ADDRLP4 1144
+ADDRGP4 $67
+ASGNP4
+LABELV $1240
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1152
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1241
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1241
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1243
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1243
+CNSTI4 1
+RETI4
+LABELV $1170
+endproc G_admin_adjustban 1156 36
+export G_admin_putteam
+proc G_admin_putteam 1384 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 1356
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $1247
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1249
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1247
+ADDRLP4 296
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1360
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 1360
+INDIRI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 1
+EQI4 $1250
+ADDRLP4 40
+ARGP4
+ADDRLP4 328
+INDIRI4
+ARGI4
+ADDRLP4 332
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1252
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 1364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1250
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 816
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 1364
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+NEI4 $1253
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1255
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1253
+ADDRLP4 36
+CNSTI4 816
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1368
+ADDRGP4 G_TeamFromString
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $1256
+ADDRGP4 $1258
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1372
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1372
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1256
+ADDRLP4 36
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1259
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1259
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1261
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1263
+ADDRLP4 1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1264
+JUMPV
+LABELV $1263
+ADDRLP4 1372
+ADDRGP4 $442
+ASGNP4
+LABELV $1264
+ADDRLP4 1372
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRLP4 1380
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1380
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1246
+endproc G_admin_putteam 1384 16
+export G_admin_map
+proc G_admin_map 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1268
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1265
+JUMPV
+LABELV $1266
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRGP4 $1271
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1269
+ADDRGP4 $1272
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1265
+JUMPV
+LABELV $1269
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1275
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1277
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1278
+JUMPV
+LABELV $1277
+ADDRLP4 80
+ADDRGP4 $442
+ASGNP4
+LABELV $1278
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1265
+endproc G_admin_map 88 12
+export G_admin_mute
+proc G_admin_mute 1372 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 296
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1280
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $1280
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1280
+ADDRLP4 1348
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1282
+ADDRGP4 $1284
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1282
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 264
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1352
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 1352
+INDIRI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 1
+EQI4 $1285
+ADDRLP4 4
+ARGP4
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRLP4 320
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1287
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 1356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1285
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+NEI4 $1288
+ADDRGP4 $1290
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1288
+ADDRLP4 260
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1291
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1295
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1293
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1296
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1297
+ARGP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1299
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1300
+JUMPV
+LABELV $1299
+ADDRLP4 1364
+ADDRGP4 $442
+ASGNP4
+LABELV $1300
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 1368
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1292
+JUMPV
+LABELV $1291
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1303
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1279
+JUMPV
+LABELV $1301
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1304
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1305
+ARGP4
+ADDRLP4 260
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1307
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1308
+JUMPV
+LABELV $1307
+ADDRLP4 1364
+ADDRGP4 $442
+ASGNP4
+LABELV $1308
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 1368
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1292
+CNSTI4 1
+RETI4
+LABELV $1279
+endproc G_admin_mute 1372 16
+lit
+align 1
+LABELV $1310
+byte 1 0
+skip 31
+align 1
+LABELV $1311
+byte 1 0
+skip 31
+export G_admin_listadmins
+code
+proc G_admin_listadmins 116 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRGP4 $1310
+INDIRB
+ASGNB 32
+ADDRLP4 4
+ADDRGP4 $1311
+INDIRB
+ASGNB 32
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1315
+JUMPV
+LABELV $1312
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1316
+ADDRGP4 $1313
+JUMPV
+LABELV $1316
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1313
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1315
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1318
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1312
+LABELV $1318
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1319
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1321
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1309
+JUMPV
+LABELV $1319
+ADDRLP4 88
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+NEI4 $1322
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1327
+JUMPV
+LABELV $1324
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 48
+LTI4 $1328
+ADDRLP4 92
+INDIRI4
+CNSTI4 57
+GTI4 $1328
+ADDRGP4 $1325
+JUMPV
+LABELV $1328
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $1325
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1327
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $1330
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1324
+LABELV $1330
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1331
+ADDRLP4 4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $1333
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1333
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $1332
+ADDRLP4 40
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1332
+JUMPV
+LABELV $1331
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+LABELV $1332
+LABELV $1322
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GEI4 $1339
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $1337
+LABELV $1339
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $1337
+ADDRLP4 40
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1340
+ADDRGP4 $1342
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1309
+JUMPV
+LABELV $1340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 96
+ADDRGP4 admin_listadmins
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1343
+ADDRGP4 $1345
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1344
+JUMPV
+LABELV $1343
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRGP4 $1346
+ARGP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1349
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1350
+JUMPV
+LABELV $1349
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $1350
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+ADDRLP4 36
+INDIRI4
+LEI4 $1351
+ADDRLP4 104
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1352
+JUMPV
+LABELV $1351
+ADDRLP4 104
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1352
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+ADDRLP4 36
+INDIRI4
+GEI4 $1353
+ADDRGP4 $1355
+ARGP4
+ADDRLP4 40
+INDIRI4
+CNSTI4 20
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+LABELV $1344
+CNSTI4 1
+RETI4
+LABELV $1309
+endproc G_admin_listadmins 116 16
+lit
+align 1
+LABELV $1357
+byte 1 0
+skip 31
+align 1
+LABELV $1358
+byte 1 0
+skip 31
+align 1
+LABELV $1359
+byte 1 0
+skip 31
+export G_admin_listplayers
+code
+proc G_admin_listplayers 196 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $1357
+INDIRB
+ASGNB 32
+ADDRLP4 124
+ADDRGP4 $1358
+INDIRB
+ASGNB 32
+ADDRLP4 12
+ADDRGP4 $1359
+INDIRB
+ASGNB 32
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRGP4 $1360
+ARGP4
+ADDRGP4 level+72
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1365
+JUMPV
+LABELV $1362
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 159
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1091
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1367
+ADDRLP4 159
+ARGP4
+ADDRGP4 $139
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1369
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1368
+JUMPV
+LABELV $1367
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1370
+ADDRLP4 159
+ARGP4
+ADDRGP4 $1372
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1373
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1371
+JUMPV
+LABELV $1370
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1374
+ADDRLP4 159
+ARGP4
+ADDRGP4 $1376
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1377
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1375
+JUMPV
+LABELV $1374
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1378
+ADDRLP4 159
+ARGP4
+ADDRGP4 $146
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1380
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1378
+LABELV $1375
+LABELV $1371
+LABELV $1368
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1381
+ADDRLP4 159
+ARGP4
+ADDRGP4 $153
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+ADDRGP4 $1383
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1381
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1384
+ADDRGP4 $1363
+JUMPV
+LABELV $1384
+LABELV $1382
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1386
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 936
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1387
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1386
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 161
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1390
+ADDRLP4 161
+ARGP4
+ADDRGP4 $101
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1390
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 124
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 92
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1395
+JUMPV
+LABELV $1392
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $1396
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1398
+CNSTI4 816
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 176
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $1398
+ADDRGP4 $1394
+JUMPV
+LABELV $1398
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 180
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 124
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1394
+ADDRLP4 92
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 33
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1394
+JUMPV
+LABELV $1396
+LABELV $1393
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1395
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1402
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1392
+LABELV $1402
+LABELV $1394
+ADDRLP4 44
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1406
+JUMPV
+LABELV $1403
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1407
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1409
+ADDRLP4 188
+ADDRLP4 176
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1413
+ADDRLP4 188
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1413
+ADDRLP4 192
+ADDRLP4 188
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $1413
+ADDRLP4 192
+INDIRI4
+CNSTI4 48
+LTI4 $1413
+ADDRLP4 192
+INDIRI4
+CNSTI4 56
+GTI4 $1413
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1413
+LABELV $1410
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1412
+ADDRLP4 176
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1409
+ADDRLP4 44
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $490
+ARGP4
+ADDRGP4 admin_level_maxname
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1405
+JUMPV
+LABELV $1407
+LABELV $1404
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1406
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $1415
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1403
+LABELV $1415
+LABELV $1405
+ADDRGP4 $1416
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRLP4 159
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 161
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1421
+ADDRLP4 180
+ADDRGP4 $1417
+ASGNP4
+ADDRGP4 $1422
+JUMPV
+LABELV $1421
+ADDRLP4 180
+ADDRGP4 $67
+ASGNP4
+LABELV $1422
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 92
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1423
+ADDRLP4 184
+ADDRGP4 $1419
+ASGNP4
+ADDRGP4 $1424
+JUMPV
+LABELV $1423
+ADDRLP4 184
+ADDRGP4 $67
+ASGNP4
+LABELV $1424
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1363
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1365
+ADDRLP4 88
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1356
+endproc G_admin_listplayers 196 48
+lit
+align 1
+LABELV $1426
+byte 1 0
+skip 31
+align 1
+LABELV $1427
+byte 1 0
+skip 63
+align 1
+LABELV $1428
+byte 1 0
+skip 63
+align 1
+LABELV $1429
+byte 1 0
+skip 31
+export G_admin_showbans
+code
+proc G_admin_showbans 368 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+CNSTI4 -1
+ASGNI4
+ADDRLP4 276
+CNSTI4 1
+ASGNI4
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+ADDRGP4 $1426
+INDIRB
+ASGNB 32
+ADDRLP4 32
+ADDRGP4 $1427
+INDIRB
+ASGNB 64
+ADDRLP4 180
+ADDRGP4 $1428
+INDIRB
+ASGNB 64
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRGP4 $1429
+INDIRB
+ASGNB 32
+CNSTP4 0
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1433
+JUMPV
+LABELV $1430
+ADDRLP4 308
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1434
+ADDRLP4 308
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1434
+ADDRGP4 $1431
+JUMPV
+LABELV $1434
+ADDRLP4 292
+ADDRLP4 292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1433
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1436
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1430
+LABELV $1436
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+GEI4 $1437
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1439
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1425
+JUMPV
+LABELV $1437
+ADDRLP4 312
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $1440
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 316
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $1442
+ADDRLP4 116
+ARGP4
+ADDRLP4 320
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 116
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+LABELV $1442
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1447
+JUMPV
+LABELV $1444
+ADDRLP4 320
+ADDRLP4 0
+INDIRI4
+ADDRLP4 116
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 48
+LTI4 $1450
+ADDRLP4 320
+INDIRI4
+CNSTI4 57
+LEI4 $1448
+LABELV $1450
+ADDRLP4 324
+ADDRLP4 0
+INDIRI4
+ADDRLP4 116
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 46
+EQI4 $1448
+ADDRLP4 324
+INDIRI4
+CNSTI4 45
+EQI4 $1448
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1446
+JUMPV
+LABELV $1448
+LABELV $1445
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1447
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $1451
+ADDRLP4 0
+INDIRI4
+ADDRLP4 116
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1444
+LABELV $1451
+LABELV $1446
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $1452
+ADDRLP4 116
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRGP4 $1453
+JUMPV
+LABELV $1452
+ADDRLP4 116
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 324
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 324
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1454
+ADDRLP4 104
+ADDRLP4 116
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $1455
+JUMPV
+LABELV $1454
+ADDRLP4 116
+ARGP4
+ADDRLP4 328
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 116
+CNSTI1 0
+ASGNI1
+LABELV $1455
+LABELV $1453
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+LEI4 $1456
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1457
+JUMPV
+LABELV $1456
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+GEI4 $1458
+ADDRLP4 0
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1463
+JUMPV
+LABELV $1460
+ADDRLP4 328
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRLP4 328
+INDIRI4
+ADDRLP4 332
+INDIRI4
+EQI4 $1466
+ADDRLP4 328
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 332
+INDIRI4
+LEI4 $1464
+LABELV $1466
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1464
+LABELV $1461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1463
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1467
+ADDRLP4 100
+INDIRI4
+ADDRLP4 296
+INDIRI4
+NEGI4
+LTI4 $1460
+LABELV $1467
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1458
+LABELV $1457
+LABELV $1440
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+GEI4 $1468
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+LABELV $1468
+ADDRLP4 296
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LEI4 $1470
+ADDRGP4 $1472
+ARGP4
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1425
+JUMPV
+LABELV $1470
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1476
+JUMPV
+LABELV $1473
+ADDRLP4 316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1477
+ADDRLP4 316
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1477
+ADDRGP4 $1474
+JUMPV
+LABELV $1477
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1479
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 320
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1481
+ADDRGP4 $1474
+JUMPV
+LABELV $1481
+LABELV $1479
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1483
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1483
+ADDRGP4 $1474
+JUMPV
+LABELV $1483
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LEI4 $1485
+ADDRLP4 276
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $1485
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 280
+INDIRI4
+LEI4 $1487
+ADDRLP4 280
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $1487
+LABELV $1474
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1476
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $1489
+ADDRLP4 100
+INDIRI4
+CNSTI4 10
+LTI4 $1473
+LABELV $1489
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1493
+JUMPV
+LABELV $1490
+ADDRLP4 316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1494
+ADDRLP4 316
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1494
+ADDRGP4 $1491
+JUMPV
+LABELV $1494
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1496
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 320
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1498
+ADDRGP4 $1491
+JUMPV
+LABELV $1498
+LABELV $1496
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1500
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1500
+ADDRGP4 $1491
+JUMPV
+LABELV $1500
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 155
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1505
+JUMPV
+LABELV $1502
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTU4 11
+LTU4 $1506
+ADDRGP4 $1504
+JUMPV
+LABELV $1506
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $1508
+ADDRGP4 $1504
+JUMPV
+LABELV $1508
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1503
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1505
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1511
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1502
+LABELV $1511
+LABELV $1504
+ADDRLP4 288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ARGI4
+ADDRLP4 244
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1512
+ADDRLP4 336
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1516
+ADDRLP4 336
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1516
+ADDRLP4 340
+ADDRLP4 336
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1516
+ADDRLP4 340
+INDIRI4
+CNSTI4 48
+LTI4 $1516
+ADDRLP4 340
+INDIRI4
+CNSTI4 56
+GTI4 $1516
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1516
+LABELV $1513
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1515
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1512
+ADDRLP4 32
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $1521
+JUMPV
+LABELV $1518
+ADDRLP4 348
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1522
+ADDRLP4 348
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1522
+ADDRLP4 352
+ADDRLP4 348
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $1522
+ADDRLP4 352
+INDIRI4
+CNSTI4 48
+LTI4 $1522
+ADDRLP4 352
+INDIRI4
+CNSTI4 56
+GTI4 $1522
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1522
+LABELV $1519
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1521
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1518
+ADDRLP4 180
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1524
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRLP4 360
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRLP4 360
+INDIRP4
+CNSTI4 105
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 364
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1493
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $1525
+ADDRLP4 100
+INDIRI4
+CNSTI4 10
+LTI4 $1490
+LABELV $1525
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1528
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1526
+LABELV $1528
+ADDRGP4 $1529
+ARGP4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1532
+ADDRLP4 316
+ADDRGP4 $1530
+ASGNP4
+ADDRGP4 $1533
+JUMPV
+LABELV $1532
+ADDRLP4 316
+ADDRGP4 $700
+ASGNP4
+LABELV $1533
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1527
+JUMPV
+LABELV $1526
+ADDRGP4 $1534
+ARGP4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1536
+ADDRLP4 316
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1537
+JUMPV
+LABELV $1536
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+LABELV $1537
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1527
+ADDRLP4 0
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $1538
+ADDRGP4 $1540
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 116
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1544
+ADDRLP4 316
+ADDRGP4 $1541
+ASGNP4
+ADDRGP4 $1545
+JUMPV
+LABELV $1544
+ADDRLP4 316
+ADDRGP4 $67
+ASGNP4
+LABELV $1545
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1546
+ADDRLP4 320
+ADDRLP4 116
+ASGNP4
+ADDRGP4 $1547
+JUMPV
+LABELV $1546
+ADDRLP4 320
+ADDRGP4 $67
+ASGNP4
+LABELV $1547
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1425
+endproc G_admin_showbans 368 32
+export G_admin_help
+proc G_admin_help 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1549
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1554
+JUMPV
+LABELV $1551
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1555
+ADDRGP4 $1558
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1555
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $1559
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1559
+LABELV $1552
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1554
+ADDRLP4 0
+INDIRI4
+ADDRGP4 adminNumCmds
+INDIRI4
+LTI4 $1551
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1564
+JUMPV
+LABELV $1561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 admin_command_permission
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1565
+ADDRGP4 $1562
+JUMPV
+LABELV $1565
+ADDRGP4 $1558
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $1567
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1567
+LABELV $1562
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1564
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $1569
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1561
+LABELV $1569
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1570
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1570
+ADDRGP4 $1572
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1573
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1548
+JUMPV
+LABELV $1549
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 33
+NEI4 $1576
+ADDRLP4 32
+ADDRLP4 12+1
+ASGNP4
+ADDRGP4 $1577
+JUMPV
+LABELV $1576
+ADDRLP4 32
+ADDRLP4 12
+ASGNP4
+LABELV $1577
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1581
+JUMPV
+LABELV $1578
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1582
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1584
+ADDRGP4 $1587
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1548
+JUMPV
+LABELV $1584
+ADDRGP4 $1588
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1589
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1591
+ARGP4
+ADDRLP4 52
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 g_admin_cmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 g_admin_cmds+16
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1593
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_admin_cmds+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1548
+JUMPV
+LABELV $1582
+LABELV $1579
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1581
+ADDRLP4 0
+INDIRI4
+ADDRGP4 adminNumCmds
+INDIRI4
+LTI4 $1578
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1598
+JUMPV
+LABELV $1595
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 admin_command_permission
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1601
+ADDRGP4 $1587
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1548
+JUMPV
+LABELV $1601
+ADDRGP4 $1603
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1604
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRGP4 $1605
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1548
+JUMPV
+LABELV $1599
+LABELV $1596
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1598
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $1606
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1595
+LABELV $1606
+ADDRGP4 $1607
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1548
+endproc G_admin_help 64 12
+export G_admin_admintest
+proc G_admin_admintest 40 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1609
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1611
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1608
+JUMPV
+LABELV $1609
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1615
+JUMPV
+LABELV $1612
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1616
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1614
+JUMPV
+LABELV $1616
+LABELV $1613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1615
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1618
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1612
+LABELV $1618
+LABELV $1614
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1619
+CNSTI4 0
+RETI4
+ADDRGP4 $1608
+JUMPV
+LABELV $1619
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1624
+JUMPV
+LABELV $1621
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1625
+ADDRGP4 $1622
+JUMPV
+LABELV $1625
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1627
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1623
+JUMPV
+LABELV $1627
+LABELV $1622
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1624
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $1629
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1621
+LABELV $1629
+LABELV $1623
+ADDRGP4 $1630
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1635
+ADDRLP4 24
+ADDRGP4 $1631
+ASGNP4
+ADDRGP4 $1636
+JUMPV
+LABELV $1635
+ADDRLP4 24
+ADDRGP4 $67
+ASGNP4
+LABELV $1636
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1637
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRGP4 $1638
+JUMPV
+LABELV $1637
+ADDRLP4 28
+ADDRGP4 $67
+ASGNP4
+LABELV $1638
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1639
+ADDRLP4 32
+ADDRGP4 $1419
+ASGNP4
+ADDRGP4 $1640
+JUMPV
+LABELV $1639
+ADDRLP4 32
+ADDRGP4 $67
+ASGNP4
+LABELV $1640
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1608
+endproc G_admin_admintest 40 24
+export G_admin_allready
+proc G_admin_allready 16 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+NEI4 $1642
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1645
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1641
+JUMPV
+LABELV $1642
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1649
+JUMPV
+LABELV $1646
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1651
+ADDRGP4 $1647
+JUMPV
+LABELV $1651
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1653
+ADDRGP4 $1647
+JUMPV
+LABELV $1653
+ADDRLP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1647
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1649
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1646
+ADDRGP4 $1655
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1657
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1658
+JUMPV
+LABELV $1657
+ADDRLP4 8
+ADDRGP4 $442
+ASGNP4
+LABELV $1658
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1641
+endproc G_admin_allready 16 8
+export G_admin_cancelvote
+proc G_admin_cancelvote 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2404
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1660
+ADDRGP4 level+4480
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1660
+ADDRGP4 level+4480+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1660
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1666
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1659
+JUMPV
+LABELV $1660
+ADDRGP4 level+2416
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+2412
+CNSTI4 0
+ASGNI4
+ADDRGP4 CheckVote
+CALLV
+pop
+ADDRGP4 level+4496
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4488
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 level+4496+4
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4488+4
+CNSTI4 0
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 $1678
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1680
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1681
+JUMPV
+LABELV $1680
+ADDRLP4 4
+ADDRGP4 $442
+ASGNP4
+LABELV $1681
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1659
+endproc G_admin_cancelvote 12 8
+export G_admin_passvote
+proc G_admin_passvote 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2404
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1683
+ADDRGP4 level+4480
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1683
+ADDRGP4 level+4480+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1683
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1689
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1682
+JUMPV
+LABELV $1683
+ADDRGP4 level+2412
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+2416
+CNSTI4 0
+ASGNI4
+ADDRGP4 CheckVote
+CALLV
+pop
+ADDRGP4 level+4488
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4496
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 level+4488+4
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRGP4 level+4496+4
+CNSTI4 0
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 $1701
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1703
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1704
+JUMPV
+LABELV $1703
+ADDRLP4 4
+ADDRGP4 $442
+ASGNP4
+LABELV $1704
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1682
+endproc G_admin_passvote 12 8
+export G_admin_spec999
+proc G_admin_spec999 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1709
+JUMPV
+LABELV $1706
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1711
+ADDRGP4 $1707
+JUMPV
+LABELV $1711
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1713
+ADDRGP4 $1707
+JUMPV
+LABELV $1713
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1715
+ADDRGP4 $1707
+JUMPV
+LABELV $1715
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+NEI4 $1717
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1719
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+ADDRGP4 $1720
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1722
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1723
+JUMPV
+LABELV $1722
+ADDRLP4 8
+ADDRGP4 $442
+ASGNP4
+LABELV $1723
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1717
+LABELV $1707
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1709
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1706
+CNSTI4 1
+RETI4
+LABELV $1705
+endproc G_admin_spec999 16 12
+export G_admin_rename
+proc G_admin_rename 2448 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 2340
+CNSTP4 0
+ASGNP4
+ADDRLP4 2412
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 2412
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+GEI4 $1725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1727
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1725
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2344
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 2416
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 2336
+ADDRLP4 2416
+INDIRP4
+ASGNP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 2336
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2344
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 2420
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 2408
+ADDRLP4 2420
+INDIRI4
+ASGNI4
+ADDRLP4 2420
+INDIRI4
+CNSTI4 1
+EQI4 $1728
+ADDRLP4 0
+ARGP4
+ADDRLP4 2408
+INDIRI4
+ARGI4
+ADDRLP4 1312
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1730
+ARGP4
+ADDRLP4 1312
+ARGP4
+ADDRLP4 2424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2424
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1728
+ADDRLP4 2340
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2340
+INDIRP4
+ARGP4
+ADDRLP4 2424
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 2424
+INDIRI4
+CNSTI4 0
+NEI4 $1731
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1733
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1731
+ADDRLP4 2340
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 1312
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2428
+ADDRGP4 G_admin_name_check
+CALLI4
+ASGNI4
+ADDRLP4 2428
+INDIRI4
+CNSTI4 0
+NEI4 $1734
+ADDRGP4 $1730
+ARGP4
+ADDRLP4 1312
+ARGP4
+ADDRLP4 2432
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2432
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1734
+ADDRLP4 2432
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1016
+ADDP4
+ASGNP4
+ADDRLP4 2432
+INDIRP4
+ADDRLP4 2432
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 2436
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2336
+ADDRLP4 2436
+INDIRP4
+ASGNP4
+ADDRLP4 2376
+ARGP4
+ADDRLP4 2336
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+ADDRGP4 $700
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $1736
+ARGP4
+ADDRLP4 2376
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1738
+ADDRLP4 2440
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1739
+JUMPV
+LABELV $1738
+ADDRLP4 2440
+ADDRGP4 $442
+ASGNP4
+LABELV $1739
+ADDRLP4 2440
+INDIRP4
+ARGP4
+ADDRLP4 2444
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 2444
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1724
+endproc G_admin_rename 2448 16
+lit
+align 1
+LABELV $1741
+byte 1 0
+skip 255
+export G_admin_restart
+code
+proc G_admin_restart 324 12
+ADDRLP4 0
+ADDRGP4 $1741
+INDIRB
+ASGNB 256
+ADDRLP4 256
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $1742
+ADDRGP4 $1744
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+LABELV $1742
+CNSTI4 2
+ARGI4
+ADDRGP4 $1745
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1746
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1748
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1749
+JUMPV
+LABELV $1748
+ADDRLP4 260
+ADDRGP4 $442
+ASGNP4
+LABELV $1749
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1740
+endproc G_admin_restart 324 12
+export G_admin_nextmap
+proc G_admin_nextmap 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1751
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1753
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1754
+JUMPV
+LABELV $1753
+ADDRLP4 0
+ADDRGP4 $442
+ASGNP4
+LABELV $1754
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1755
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1757
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1758
+JUMPV
+LABELV $1757
+ADDRLP4 8
+ADDRGP4 $442
+ASGNP4
+LABELV $1758
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1750
+endproc G_admin_nextmap 16 8
+lit
+align 1
+LABELV $1760
+byte 1 0
+skip 31
+align 1
+LABELV $1761
+byte 1 0
+skip 31
+align 1
+LABELV $1762
+byte 1 0
+skip 31
+export G_admin_namelog
+code
+proc G_admin_namelog 152 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $1760
+INDIRB
+ASGNB 32
+ADDRLP4 49
+ADDRGP4 $1761
+INDIRB
+ASGNB 32
+ADDRLP4 8
+ADDRGP4 $1762
+INDIRB
+ASGNB 32
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $1763
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 88
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 88
+ARGP4
+ADDRLP4 49
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+LABELV $1763
+ADDRGP4 G_admin_buffer_begin
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1768
+JUMPV
+LABELV $1765
+ADDRLP4 88
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1769
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 $1774
+JUMPV
+LABELV $1771
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 49
+ARGP4
+ADDRLP4 132
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1775
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1773
+JUMPV
+LABELV $1775
+LABELV $1772
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1774
+ADDRLP4 136
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+GEI4 $1777
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1771
+LABELV $1777
+LABELV $1773
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $1778
+ADDRGP4 $1766
+JUMPV
+LABELV $1778
+LABELV $1769
+ADDRLP4 120
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1780
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1781
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1780
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1784
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1091
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1784
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $1788
+ADDRGP4 $1048
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRGP4 $1789
+JUMPV
+LABELV $1788
+ADDRLP4 132
+ADDRGP4 $1093
+ASGNP4
+LABELV $1789
+ADDRGP4 $1786
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1793
+JUMPV
+LABELV $1790
+ADDRGP4 $1794
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1791
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1793
+ADDRLP4 148
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 148
+INDIRI4
+GEI4 $1795
+ADDRLP4 0
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1790
+LABELV $1795
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+LABELV $1766
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1768
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+GEI4 $1796
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_namelog
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1765
+LABELV $1796
+ADDRGP4 $1797
+ARGP4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_buffer_end
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1759
+endproc G_admin_namelog 152 16
+lit
+align 1
+LABELV $1799
+byte 1 0
+skip 1
+export G_admin_lock
+code
+proc G_admin_lock 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1799
+INDIRB
+ASGNB 2
+ADDRLP4 8
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1800
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1802
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1798
+JUMPV
+LABELV $1800
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_TeamFromString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1803
+ADDRGP4 level+9456
+INDIRI4
+CNSTI4 0
+EQI4 $1805
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1808
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1798
+JUMPV
+LABELV $1805
+ADDRGP4 level+9456
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1804
+JUMPV
+LABELV $1803
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1810
+ADDRGP4 level+9460
+INDIRI4
+CNSTI4 0
+EQI4 $1812
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1815
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1798
+JUMPV
+LABELV $1812
+ADDRGP4 level+9460
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1811
+JUMPV
+LABELV $1810
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1817
+ADDRGP4 level+9464
+INDIRI4
+CNSTI4 0
+EQI4 $1819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1822
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1798
+JUMPV
+LABELV $1819
+ADDRGP4 level+9464
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1818
+JUMPV
+LABELV $1817
+ADDRGP4 $1824
+ARGP4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1798
+JUMPV
+LABELV $1818
+LABELV $1811
+LABELV $1804
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1825
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1827
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1828
+JUMPV
+LABELV $1827
+ADDRLP4 16
+ADDRGP4 $442
+ASGNP4
+LABELV $1828
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1798
+endproc G_admin_lock 28 12
+lit
+align 1
+LABELV $1830
+byte 1 0
+skip 1
+export G_admin_unlock
+code
+proc G_admin_unlock 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1830
+INDIRB
+ASGNB 2
+ADDRLP4 8
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1831
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1833
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1831
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 G_TeamFromString
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1834
+ADDRGP4 level+9456
+INDIRI4
+CNSTI4 0
+NEI4 $1836
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1839
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1836
+ADDRGP4 level+9456
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1834
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1841
+ADDRGP4 level+9460
+INDIRI4
+CNSTI4 0
+NEI4 $1843
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1846
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1843
+ADDRGP4 level+9460
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1842
+JUMPV
+LABELV $1841
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1848
+ADDRGP4 level+9464
+INDIRI4
+CNSTI4 0
+NEI4 $1850
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1853
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1850
+ADDRGP4 level+9464
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1849
+JUMPV
+LABELV $1848
+ADDRGP4 $1855
+ARGP4
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1849
+LABELV $1842
+LABELV $1835
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1856
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1858
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1859
+JUMPV
+LABELV $1858
+ADDRLP4 16
+ADDRGP4 $442
+ASGNP4
+LABELV $1859
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1829
+endproc G_admin_unlock 28 12
+export G_admin_disorient
+proc G_admin_disorient 1364 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1324
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1863
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1860
+JUMPV
+LABELV $1861
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1328
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1328
+INDIRP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1332
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 1332
+INDIRI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 1
+EQI4 $1864
+ADDRLP4 8
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRLP4 300
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1866
+ARGP4
+ADDRLP4 300
+ARGP4
+ADDRLP4 1336
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1336
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1860
+JUMPV
+LABELV $1864
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+NEI4 $1867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1869
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1860
+JUMPV
+LABELV $1867
+ADDRLP4 1340
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 1
+EQI4 $1870
+ADDRLP4 1340
+INDIRI4
+CNSTI4 2
+EQI4 $1870
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+EQI4 $1870
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1872
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1860
+JUMPV
+LABELV $1870
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1873
+ADDRGP4 $1875
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1860
+JUMPV
+LABELV $1873
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1876
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1877
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1883
+ADDRLP4 1348
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1884
+JUMPV
+LABELV $1883
+ADDRLP4 1348
+ADDRGP4 $1878
+ASGNP4
+LABELV $1884
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1885
+ADDRLP4 1352
+ADDRGP4 $1880
+ASGNP4
+ADDRGP4 $1886
+JUMPV
+LABELV $1885
+ADDRLP4 1352
+ADDRGP4 $67
+ASGNP4
+LABELV $1886
+ADDRLP4 1352
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1887
+ADDRLP4 1356
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1888
+JUMPV
+LABELV $1887
+ADDRLP4 1356
+ADDRGP4 $67
+ASGNP4
+LABELV $1888
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1860
+endproc G_admin_disorient 1364 16
+export G_admin_orient
+proc G_admin_orient 1340 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1320
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1890
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1892
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1889
+JUMPV
+LABELV $1890
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1324
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 1324
+INDIRI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 1
+EQI4 $1893
+ADDRLP4 4
+ARGP4
+ADDRLP4 292
+INDIRI4
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1895
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1889
+JUMPV
+LABELV $1893
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1896
+ADDRGP4 $1898
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1889
+JUMPV
+LABELV $1896
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1899
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1900
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1902
+ADDRLP4 1332
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1903
+JUMPV
+LABELV $1902
+ADDRLP4 1332
+ADDRGP4 $1878
+ASGNP4
+LABELV $1903
+ADDRLP4 1332
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1336
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1889
+endproc G_admin_orient 1340 16
+export G_admin_slap
+proc G_admin_slap 1380 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1336
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+GEI4 $1905
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1907
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1904
+JUMPV
+LABELV $1905
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 268
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 300
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 300
+ARGP4
+ADDRLP4 1340
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1908
+ADDRLP4 4
+CNSTI4 25
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1344
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1344
+INDIRP4
+ASGNP4
+ADDRGP4 $1909
+JUMPV
+LABELV $1908
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 1344
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1344
+INDIRP4
+ASGNP4
+LABELV $1909
+ADDRLP4 268
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1344
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 1344
+INDIRI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+CNSTI4 1
+EQI4 $1910
+ADDRLP4 12
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1912
+ARGP4
+ADDRLP4 312
+ARGP4
+ADDRLP4 1348
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1904
+JUMPV
+LABELV $1910
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1348
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $1913
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1915
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1904
+JUMPV
+LABELV $1913
+ADDRLP4 1352
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 1
+EQI4 $1916
+ADDRLP4 1352
+INDIRI4
+CNSTI4 2
+EQI4 $1916
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+EQI4 $1916
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1918
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1904
+JUMPV
+LABELV $1916
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $1919
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $1921
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1356
+CNSTP4 0
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1356
+INDIRP4
+ARGP4
+ADDRLP4 1360
+CNSTP4 0
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+CNSTI4 500
+ARGI4
+ADDRLP4 1364
+CNSTI4 0
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+ARGI4
+ADDRLP4 1364
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $1921
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+LABELV $1919
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1923
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1924
+JUMPV
+LABELV $1923
+ADDRLP4 1356
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ADDRLP4 1356
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1924
+ADDRGP4 $1925
+ARGP4
+ADDRLP4 1356
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 1356
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 304
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+ADDRGP4 $1926
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1927
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1931
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1932
+JUMPV
+LABELV $1931
+ADDRLP4 1364
+ADDRGP4 $1878
+ASGNP4
+LABELV $1932
+ADDRLP4 1364
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1933
+ADDRLP4 1368
+ADDRGP4 $1880
+ASGNP4
+ADDRGP4 $1934
+JUMPV
+LABELV $1933
+ADDRLP4 1368
+ADDRGP4 $67
+ASGNP4
+LABELV $1934
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1935
+ADDRLP4 1372
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $1936
+JUMPV
+LABELV $1935
+ADDRLP4 1372
+ADDRGP4 $67
+ASGNP4
+LABELV $1936
+ADDRLP4 1372
+INDIRP4
+ARGP4
+ADDRLP4 1376
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1904
+endproc G_admin_slap 1380 32
+export G_admin_warn_check
+proc G_admin_warn_check 32 8
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 945
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1938
+CNSTI4 0
+RETI4
+ADDRGP4 $1937
+JUMPV
+LABELV $1938
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1940
+CNSTI4 0
+RETI4
+ADDRGP4 $1937
+JUMPV
+LABELV $1940
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1945
+JUMPV
+LABELV $1942
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 1180
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 1
+GEI4 $1946
+ADDRGP4 $1943
+JUMPV
+LABELV $1946
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 65
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1950
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1948
+LABELV $1950
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1948
+LABELV $1943
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1945
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1951
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_warnings
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1942
+LABELV $1951
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $1937
+endproc G_admin_warn_check 32 8
+export G_admin_warn
+proc G_admin_warn 1460 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 1404
+ADDRGP4 G_admin_permission
+CALLI4
+ASGNI4
+ADDRLP4 1404
+INDIRI4
+CNSTI4 0
+EQI4 $1953
+ADDRLP4 300
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1954
+JUMPV
+LABELV $1953
+ADDRLP4 300
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $1954
+ADDRLP4 1408
+ADDRGP4 G_SayArgc
+CALLI4
+ASGNI4
+ADDRLP4 1408
+INDIRI4
+ADDRLP4 300
+INDIRI4
+GEI4 $1955
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1957
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1952
+JUMPV
+LABELV $1955
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SayArgv
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 336
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_SanitiseString
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 1412
+ADDRGP4 G_SayConcatArgs
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 g_warningExpire+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1416
+ADDRGP4 G_ClientNumbersFromString
+CALLI4
+ASGNI4
+ADDRLP4 372
+ADDRLP4 1416
+INDIRI4
+ASGNI4
+ADDRLP4 1416
+INDIRI4
+CNSTI4 1
+EQI4 $1959
+ADDRLP4 44
+ARGP4
+ADDRLP4 372
+INDIRI4
+ARGI4
+ADDRLP4 376
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_MatchOnePlayer
+CALLV
+pop
+ADDRGP4 $1961
+ARGP4
+ADDRLP4 376
+ARGP4
+ADDRLP4 1420
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1420
+INDIRP4
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1952
+JUMPV
+LABELV $1959
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1420
+ADDRGP4 admin_higher
+CALLI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 0
+NEI4 $1962
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1915
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1952
+JUMPV
+LABELV $1962
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1965
+ADDRLP4 1424
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1966
+JUMPV
+LABELV $1965
+ADDRLP4 1424
+CNSTI4 -1
+ASGNI4
+LABELV $1966
+ADDRLP4 1424
+INDIRI4
+ARGI4
+ADDRLP4 304
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 G_admin_duration
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1428
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1428
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1428
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1428
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 admin_create_warning
+CALLI4
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1967
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1970
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 $1968
+JUMPV
+LABELV $1967
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1968
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1432
+ADDRGP4 G_admin_warn_check
+CALLI4
+ASGNI4
+ADDRLP4 1400
+ADDRLP4 1432
+INDIRI4
+ASGNI4
+ADDRGP4 $1971
+ARGP4
+ADDRLP4 1436
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRLP4 368
+ADDRLP4 1436
+INDIRI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+ARGI4
+ADDRGP4 G_GlobalSound
+CALLV
+pop
+ADDRGP4 g_maxWarnings+12
+INDIRI4
+CNSTI4 0
+EQI4 $1972
+ADDRLP4 1400
+INDIRI4
+ADDRGP4 g_maxWarnings+12
+INDIRI4
+LTI4 $1975
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1440
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 1440
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1978
+ARGP4
+ADDRGP4 admin_create_ban
+CALLI4
+pop
+ADDRGP4 g_admin+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1979
+ADDRGP4 admin_writeconfig
+CALLV
+pop
+LABELV $1979
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1984
+ADDRGP4 $994
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1444
+ADDRLP4 1448
+INDIRP4
+ASGNP4
+ADDRGP4 $1985
+JUMPV
+LABELV $1984
+ADDRLP4 1444
+ADDRGP4 $1982
+ASGNP4
+LABELV $1985
+ADDRGP4 $993
+ARGP4
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRGP4 $1978
+ARGP4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1001
+ARGP4
+ADDRGP4 $1986
+ARGP4
+ADDRGP4 $1978
+ARGP4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1952
+JUMPV
+LABELV $1975
+ADDRGP4 $1987
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1440
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1440
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1988
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1992
+ADDRLP4 1444
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $1993
+JUMPV
+LABELV $1992
+ADDRLP4 1444
+ADDRGP4 $1878
+ASGNP4
+LABELV $1993
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1994
+ADDRLP4 1448
+ADDRGP4 $1880
+ASGNP4
+ADDRGP4 $1995
+JUMPV
+LABELV $1994
+ADDRLP4 1448
+ADDRGP4 $67
+ASGNP4
+LABELV $1995
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1996
+ADDRLP4 1452
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $1997
+JUMPV
+LABELV $1996
+ADDRLP4 1452
+ADDRGP4 $67
+ASGNP4
+LABELV $1997
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1952
+JUMPV
+LABELV $1972
+ADDRGP4 $1987
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1440
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1440
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1988
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2001
+ADDRLP4 1444
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $2002
+JUMPV
+LABELV $2001
+ADDRLP4 1444
+ADDRGP4 $1878
+ASGNP4
+LABELV $2002
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2003
+ADDRLP4 1448
+ADDRGP4 $1880
+ASGNP4
+ADDRGP4 $2004
+JUMPV
+LABELV $2003
+ADDRLP4 1448
+ADDRGP4 $67
+ASGNP4
+LABELV $2004
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2005
+ADDRLP4 1452
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $2006
+JUMPV
+LABELV $2005
+ADDRLP4 1452
+ADDRGP4 $67
+ASGNP4
+LABELV $2006
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1952
+endproc G_admin_warn 1460 24
+export G_admin_shuffle
+proc G_admin_shuffle 8 8
+CNSTI4 2
+ARGI4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $2008
+ARGP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2010
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $2011
+JUMPV
+LABELV $2010
+ADDRLP4 0
+ADDRGP4 $442
+ASGNP4
+LABELV $2011
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2007
+endproc G_admin_shuffle 8 8
+export G_admin_print
+proc G_admin_print 1032 12
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2013
+ADDRGP4 $2016
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level+4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $2014
+JUMPV
+LABELV $2013
+ADDRGP4 $2019
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $2017
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_DecolorString
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $2018
+JUMPV
+LABELV $2017
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $2018
+LABELV $2014
+LABELV $2012
+endproc G_admin_print 1032 12
+export G_admin_buffer_begin
+proc G_admin_buffer_begin 0 0
+ADDRGP4 g_bfb
+CNSTI1 0
+ASGNI1
+LABELV $2020
+endproc G_admin_buffer_begin 0 0
+export G_admin_buffer_end
+proc G_admin_buffer_end 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 g_bfb
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+LABELV $2021
+endproc G_admin_buffer_end 0 8
+export G_admin_buffer_print
+proc G_admin_buffer_print 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 g_bfb
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 1009
+LTI4 $2023
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 g_bfb
+ARGP4
+ADDRGP4 G_admin_print
+CALLV
+pop
+ADDRGP4 g_bfb
+CNSTI1 0
+ASGNI1
+LABELV $2023
+ADDRGP4 g_bfb
+ARGP4
+CNSTI4 32000
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $2022
+endproc G_admin_buffer_print 8 12
+export G_admin_cleanup
+proc G_admin_cleanup 20 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2029
+JUMPV
+LABELV $2026
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2027
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2029
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $2030
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_levels
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2026
+LABELV $2030
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2034
+JUMPV
+LABELV $2031
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2032
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2034
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $2035
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_admins
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2031
+LABELV $2035
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2039
+JUMPV
+LABELV $2036
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2037
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2039
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $2040
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_bans
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2036
+LABELV $2040
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2044
+JUMPV
+LABELV $2041
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_Free
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2042
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2044
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $2045
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_admin_commands
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2041
+LABELV $2045
+LABELV $2025
+endproc G_admin_cleanup 20 4
+bss
+export g_admin_warnings
+align 4
+LABELV g_admin_warnings
+skip 4096
+export g_admin_namelog
+align 4
+LABELV g_admin_namelog
+skip 512
+export g_admin_commands
+align 4
+LABELV g_admin_commands
+skip 256
+export g_admin_bans
+align 4
+LABELV g_admin_bans
+skip 4096
+export g_admin_admins
+align 4
+LABELV g_admin_admins
+skip 4096
+export g_admin_levels
+align 4
+LABELV g_admin_levels
+skip 128
+align 1
+LABELV g_bfb
+skip 32000
+import monster_die
+import MapInfoPrint
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2019
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2016
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $2008
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1988
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1987
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1986
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 45
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1982
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $1978
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1971
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1970
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1961
+byte 1 94
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1957
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 124
+byte 1 105
+byte 1 112
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1927
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1926
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1925
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1918
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $1915
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 0
+align 1
+LABELV $1912
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1907
+byte 1 94
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $1900
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 34
+byte 1 0
+align 1
+LABELV $1899
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1898
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1895
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1892
+byte 1 94
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 0
+align 1
+LABELV $1880
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1878
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 69
+byte 1 0
+align 1
+LABELV $1877
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1876
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 32
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1875
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1872
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1869
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 0
+align 1
+LABELV $1866
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1863
+byte 1 94
+byte 1 47
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $1856
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1855
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 34
+byte 1 37
+byte 1 99
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1853
+byte 1 94
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1846
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1839
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1833
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 124
+byte 1 98
+byte 1 124
+byte 1 102
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1825
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1824
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 34
+byte 1 37
+byte 1 99
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1822
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 33
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1815
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1808
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1802
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 124
+byte 1 98
+byte 1 124
+byte 1 102
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1797
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1794
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 0
+align 1
+LABELV $1786
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 53
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $1755
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1751
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1746
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1745
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1744
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1736
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1733
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1730
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1727
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1720
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1719
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1701
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1689
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1678
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1666
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1655
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 89
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1645
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1631
+byte 1 40
+byte 1 0
+align 1
+LABELV $1630
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1611
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1607
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1605
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1604
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 68
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1603
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1593
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1591
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1589
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 70
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1588
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1587
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1573
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1572
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1558
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 0
+align 1
+LABELV $1541
+byte 1 32
+byte 1 0
+align 1
+LABELV $1540
+byte 1 32
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1534
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 41
+byte 1 46
+byte 1 0
+align 1
+LABELV $1530
+byte 1 73
+byte 1 80
+byte 1 0
+align 1
+LABELV $1529
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1524
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 53
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 56
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 48
+byte 1 115
+byte 1 10
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 92
+byte 1 95
+byte 1 95
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1472
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1439
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1419
+byte 1 41
+byte 1 0
+align 1
+LABELV $1417
+byte 1 40
+byte 1 97
+byte 1 46
+byte 1 107
+byte 1 46
+byte 1 97
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $1416
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 37
+byte 1 49
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1383
+byte 1 94
+byte 1 53
+byte 1 0
+align 1
+LABELV $1380
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $1377
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $1376
+byte 1 70
+byte 1 0
+align 1
+LABELV $1373
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $1372
+byte 1 82
+byte 1 0
+align 1
+LABELV $1369
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $1360
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1355
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1346
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1345
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1342
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1321
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1305
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1304
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 49
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 39
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 0
+align 1
+LABELV $1303
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1297
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1296
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 49
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 34
+byte 1 0
+align 1
+LABELV $1295
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1290
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1287
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1284
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1275
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1273
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1272
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1271
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $1268
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 91
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1261
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1258
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1255
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1252
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1249
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 124
+byte 1 97
+byte 1 124
+byte 1 115
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1231
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $1229
+byte 1 44
+byte 1 32
+byte 1 0
+align 1
+LABELV $1227
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $1225
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 35
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1215
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1210
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1203
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1189
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1184
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1180
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 10
+byte 1 0
+align 1
+LABELV $1174
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1162
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 35
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1159
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1153
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1149
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 10
+byte 1 0
+align 1
+LABELV $1143
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1133
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1126
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1119
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1116
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1112
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1105
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1104
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1101
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $1093
+byte 1 45
+byte 1 0
+align 1
+LABELV $1092
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 53
+byte 1 115
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1091
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $1074
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1071
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1048
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1035
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1030
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1025
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1019
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 124
+byte 1 105
+byte 1 112
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $1002
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1001
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 46
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $994
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $993
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $986
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $984
+byte 1 49
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $983
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $980
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $977
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $974
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $941
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $933
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $918
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $910
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $898
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $894
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $885
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $884
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $872
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 10
+byte 1 0
+align 1
+LABELV $869
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $866
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 33
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $831
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $819
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $806
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 33
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $797
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $779
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $778
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $777
+byte 1 91
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $776
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $769
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $758
+byte 1 91
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $751
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $748
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $745
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $742
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $737
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $736
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $733
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $730
+byte 1 109
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $727
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $716
+byte 1 91
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $711
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $704
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 103
+byte 1 110
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $703
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $700
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $697
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $690
+byte 1 91
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 93
+byte 1 0
+align 1
+LABELV $685
+byte 1 91
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $680
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $675
+byte 1 91
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $670
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 0
+align 1
+LABELV $660
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $656
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 71
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $596
+byte 1 94
+byte 1 51
+byte 1 33
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 94
+byte 1 55
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $581
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $580
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $573
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $569
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $560
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $557
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $553
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $552
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $549
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $546
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 0
+align 1
+LABELV $543
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $540
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $537
+byte 1 80
+byte 1 69
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 78
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $492
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 40
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $490
+byte 1 37
+byte 1 42
+byte 1 115
+byte 1 0
+align 1
+LABELV $450
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $442
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $440
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 88
+byte 1 0
+align 1
+LABELV $438
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $437
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $412
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $378
+byte 1 42
+byte 1 0
+align 1
+LABELV $376
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $374
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 112
+byte 1 80
+byte 1 119
+byte 1 114
+byte 1 107
+byte 1 109
+byte 1 102
+byte 1 75
+byte 1 110
+byte 1 99
+byte 1 78
+byte 1 63
+byte 1 77
+byte 1 86
+byte 1 100
+byte 1 66
+byte 1 98
+byte 1 101
+byte 1 68
+byte 1 83
+byte 1 53
+byte 1 49
+byte 1 0
+align 1
+LABELV $372
+byte 1 94
+byte 1 51
+byte 1 83
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $370
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 112
+byte 1 80
+byte 1 119
+byte 1 114
+byte 1 107
+byte 1 109
+byte 1 102
+byte 1 75
+byte 1 110
+byte 1 99
+byte 1 78
+byte 1 63
+byte 1 0
+align 1
+LABELV $368
+byte 1 94
+byte 1 50
+byte 1 74
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $366
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 112
+byte 1 80
+byte 1 119
+byte 1 114
+byte 1 0
+align 1
+LABELV $364
+byte 1 94
+byte 1 54
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $362
+byte 1 105
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 0
+align 1
+LABELV $360
+byte 1 94
+byte 1 53
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $358
+byte 1 97
+byte 1 104
+byte 1 67
+byte 1 0
+align 1
+LABELV $357
+byte 1 94
+byte 1 52
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $345
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $344
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $343
+byte 1 91
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $335
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $330
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $329
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $328
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $327
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $326
+byte 1 91
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $320
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $319
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $318
+byte 1 109
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $317
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $316
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $315
+byte 1 91
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $306
+byte 1 91
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $298
+byte 1 10
+byte 1 0
+align 1
+LABELV $297
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $296
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $295
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 0
+align 1
+LABELV $294
+byte 1 91
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $288
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $284
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $269
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $251
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $227
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $165
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $164
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $163
+byte 1 119
+byte 1 0
+align 1
+LABELV $162
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $161
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $160
+byte 1 117
+byte 1 110
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $159
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $158
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $157
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $156
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $155
+byte 1 117
+byte 1 110
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $154
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $153
+byte 1 67
+byte 1 0
+align 1
+LABELV $152
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $151
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $150
+byte 1 80
+byte 1 0
+align 1
+LABELV $149
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 0
+align 1
+LABELV $148
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $147
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 117
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $146
+byte 1 83
+byte 1 0
+align 1
+LABELV $145
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $144
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 102
+byte 1 0
+align 1
+LABELV $142
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 73
+byte 1 80
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $140
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 40
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 41
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $139
+byte 1 66
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $137
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 124
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $136
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $135
+byte 1 115
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $133
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 40
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 41
+byte 1 0
+align 1
+LABELV $132
+byte 1 114
+byte 1 0
+align 1
+LABELV $131
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $130
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $129
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $128
+byte 1 78
+byte 1 0
+align 1
+LABELV $127
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $126
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $125
+byte 1 71
+byte 1 0
+align 1
+LABELV $124
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 0
+align 1
+LABELV $123
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 104
+byte 1 124
+byte 1 97
+byte 1 124
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $122
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $121
+byte 1 112
+byte 1 0
+align 1
+LABELV $120
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $119
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $118
+byte 1 86
+byte 1 0
+align 1
+LABELV $117
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $116
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 102
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 33
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $114
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $113
+byte 1 110
+byte 1 0
+align 1
+LABELV $112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $111
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $110
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 101
+byte 1 0
+align 1
+LABELV $108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $107
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $106
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $105
+byte 1 109
+byte 1 0
+align 1
+LABELV $104
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $103
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $101
+byte 1 77
+byte 1 0
+align 1
+LABELV $100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $99
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 97
+byte 1 124
+byte 1 104
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 0
+align 1
+LABELV $98
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $97
+byte 1 75
+byte 1 0
+align 1
+LABELV $96
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $95
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $94
+byte 1 105
+byte 1 0
+align 1
+LABELV $93
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $92
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $91
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $90
+byte 1 68
+byte 1 0
+align 1
+LABELV $89
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $88
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $87
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $86
+byte 1 107
+byte 1 0
+align 1
+LABELV $85
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $84
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $83
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $82
+byte 1 104
+byte 1 0
+align 1
+LABELV $81
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 0
+align 1
+LABELV $80
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $79
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $78
+byte 1 100
+byte 1 0
+align 1
+LABELV $77
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $76
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $75
+byte 1 99
+byte 1 0
+align 1
+LABELV $74
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $73
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 124
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 35
+byte 1 124
+byte 1 73
+byte 1 80
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $72
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 39
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 104
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 109
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $71
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $70
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $69
+byte 1 121
+byte 1 0
+align 1
+LABELV $68
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $67
+byte 1 0
+align 1
+LABELV $66
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $65
+byte 1 97
+byte 1 0
+align 1
+LABELV $64
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $63
+byte 1 91
+byte 1 94
+byte 1 51
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 35
+byte 1 94
+byte 1 55
+byte 1 93
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 32
+byte 1 40
+byte 1 94
+byte 1 53
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $62
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 39
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 100
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 100
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 39
+byte 1 104
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 109
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 45
+byte 1 44
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $61
+byte 1 98
+byte 1 0
+align 1
+LABELV $60
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 0
@@ -0,0 +1,6362 @@
+export trap_Cvar_VariableValue
+code
+proc trap_Cvar_VariableValue 132 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $61
+endproc trap_Cvar_VariableValue 132 12
+export G_ParseInfos
+proc G_ParseInfos 2104 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $64
+JUMPV
+LABELV $63
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $66
+ADDRGP4 $65
+JUMPV
+LABELV $66
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $68
+ADDRGP4 $71
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $65
+JUMPV
+LABELV $68
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $72
+ADDRGP4 $74
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $65
+JUMPV
+LABELV $72
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $76
+JUMPV
+LABELV $75
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $78
+ADDRGP4 $80
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $81
+ADDRGP4 $77
+JUMPV
+LABELV $81
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $84
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $84
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $76
+ADDRGP4 $75
+JUMPV
+LABELV $77
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $89
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $90
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+ADDI4
+ADDRLP4 2076
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 2080
+ADDRGP4 BG_CanAlloc
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $87
+ADDRGP4 $65
+JUMPV
+LABELV $87
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2084
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $89
+ARGP4
+ADDRLP4 2088
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $90
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2092
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2092
+INDIRP4
+ARGP4
+ADDRLP4 2096
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+ADDRLP4 2088
+INDIRI4
+ADDI4
+ADDRLP4 2096
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 2100
+ADDRGP4 BG_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2100
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $91
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $91
+LABELV $64
+ADDRGP4 $63
+JUMPV
+LABELV $65
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $62
+endproc G_ParseInfos 2104 12
+proc G_LoadArenasFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $94
+ADDRGP4 $96
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $93
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $97
+ADDRGP4 $99
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $93
+JUMPV
+LABELV $97
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 g_numArenas
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 G_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $93
+endproc G_LoadArenasFromFile 8216 16
+proc G_LoadArenas 1460 16
+ADDRGP4 g_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 $102
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 148+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $103
+ADDRLP4 148+16
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRGP4 $107
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+LABELV $104
+ADDRGP4 $108
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 420
+ASGNP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1448
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+LABELV $111
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $113
+ADDRLP4 136
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $110
+ADDRGP4 $115
+ARGP4
+ADDRGP4 g_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRGP4 $121
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numArenas
+INDIRI4
+LTI4 $116
+LABELV $100
+endproc G_LoadArenas 1460 16
+export G_GetArenaInfoByMap
+proc G_GetArenaInfoByMap 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $122
+JUMPV
+LABELV $127
+LABELV $124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numArenas
+INDIRI4
+LTI4 $123
+CNSTP4 0
+RETP4
+LABELV $122
+endproc G_GetArenaInfoByMap 12 8
+proc PlayerIntroSound 80 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $131
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+LABELV $132
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $133
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+LABELV $133
+ADDRGP4 $136
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $130
+endproc PlayerIntroSound 80 12
+export G_AddRandomBot
+proc G_AddRandomBot 88 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $138
+ADDRGP4 $137
+JUMPV
+LABELV $138
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $140
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $145
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $150
+ADDRGP4 $146
+JUMPV
+LABELV $150
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $152
+ADDRGP4 $146
+JUMPV
+LABELV $152
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $156
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $156
+ADDRGP4 $146
+JUMPV
+LABELV $156
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $158
+ADDRGP4 $147
+JUMPV
+LABELV $158
+LABELV $146
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $148
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $145
+LABELV $147
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $160
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $160
+LABELV $141
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $143
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $140
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $166
+JUMPV
+LABELV $163
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $167
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $172
+ADDRGP4 $168
+JUMPV
+LABELV $172
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $174
+ADDRGP4 $168
+JUMPV
+LABELV $174
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $178
+ADDRGP4 $168
+JUMPV
+LABELV $178
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $180
+ADDRGP4 $169
+JUMPV
+LABELV $180
+LABELV $168
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $170
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $167
+LABELV $169
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $182
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $185
+ADDRGP4 $187
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $188
+ADDRLP4 60
+ADDRGP4 $190
+ASGNP4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $191
+ADDRLP4 60
+ADDRGP4 $193
+ASGNP4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 60
+ADDRGP4 $102
+ASGNP4
+LABELV $192
+LABELV $189
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 35
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 20+35
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 $195
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $185
+LABELV $182
+LABELV $164
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $166
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $163
+LABELV $137
+endproc G_AddRandomBot 88 20
+export G_RemoveRandomBot
+proc G_RemoveRandomBot 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $200
+JUMPV
+LABELV $197
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $202
+ADDRGP4 $198
+JUMPV
+LABELV $202
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $204
+ADDRGP4 $198
+JUMPV
+LABELV $204
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $208
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $208
+ADDRGP4 $198
+JUMPV
+LABELV $208
+ADDRGP4 $210
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $198
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $200
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $197
+CNSTI4 0
+RETI4
+LABELV $196
+endproc G_RemoveRandomBot 16 8
+export G_CountHumanPlayers
+proc G_CountHumanPlayers 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $212
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $217
+ADDRGP4 $213
+JUMPV
+LABELV $217
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $219
+ADDRGP4 $213
+JUMPV
+LABELV $219
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $223
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $223
+ADDRGP4 $213
+JUMPV
+LABELV $223
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $213
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $215
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $212
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $211
+endproc G_CountHumanPlayers 20 0
+export G_CountBotPlayers
+proc G_CountBotPlayers 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $231
+ADDRGP4 $227
+JUMPV
+LABELV $231
+CNSTI4 816
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $233
+ADDRGP4 $227
+JUMPV
+LABELV $233
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $237
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $237
+ADDRGP4 $227
+JUMPV
+LABELV $237
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $227
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $226
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $239
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $240
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $246
+ADDRGP4 $240
+JUMPV
+LABELV $246
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $240
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $239
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $225
+endproc G_CountBotPlayers 24 0
+bss
+align 4
+LABELV $251
+skip 4
+export G_CheckMinimumPlayers
+code
+proc G_CheckMinimumPlayers 40 4
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $252
+ADDRGP4 $250
+JUMPV
+LABELV $252
+ADDRGP4 $251
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $255
+ADDRGP4 $250
+JUMPV
+LABELV $255
+ADDRGP4 $251
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 bot_minplayers+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $260
+ADDRGP4 $250
+JUMPV
+LABELV $260
+ADDRLP4 12
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $251
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 600000
+ADDI4
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $262
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $265
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $265
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $268
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $268
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $272
+CNSTI4 1
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $274
+CNSTI4 1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $274
+LABELV $273
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $276
+CNSTI4 2
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $266
+JUMPV
+LABELV $276
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $266
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $266
+CNSTI4 2
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $280
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $283
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $283
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 20
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $287
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $287
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $281
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $281
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $281
+CNSTI4 -1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+NEI4 $293
+LABELV $296
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $297
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $297
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $301
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $303
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $303
+CNSTI4 0
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $303
+LABELV $302
+LABELV $293
+LABELV $281
+LABELV $266
+LABELV $250
+endproc G_CheckMinimumPlayers 40 4
+export G_CheckBotSpawn
+proc G_CheckBotSpawn 1032 12
+ADDRGP4 G_CheckMinimumPlayers
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $306
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $310
+ADDRGP4 $307
+JUMPV
+LABELV $310
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $313
+ADDRGP4 $307
+JUMPV
+LABELV $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $318
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 PlayerIntroSound
+CALLV
+pop
+LABELV $318
+LABELV $307
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $306
+LABELV $305
+endproc G_CheckBotSpawn 1032 12
+proc AddBotToSpawnQueue 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $323
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $322
+JUMPV
+LABELV $327
+LABELV $324
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $323
+ADDRGP4 $332
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $322
+endproc AddBotToSpawnQueue 4 4
+export G_RemoveQueuedBotBegin
+proc G_RemoveQueuedBotBegin 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $334
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $338
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $338
+LABELV $335
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $334
+LABELV $333
+endproc G_RemoveQueuedBotBegin 4 0
+export G_BotConnect
+proc G_BotConnect 1340 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0+144
+ADDRLP4 1324
+INDIRF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0+148
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1332
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+EQI4 $350
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 BotAISetupClient
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+NEI4 $348
+LABELV $350
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $351
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $341
+JUMPV
+LABELV $348
+CNSTI4 1
+RETI4
+LABELV $341
+endproc G_BotConnect 1340 12
+proc G_AddBot 1136 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 G_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $353
+ADDRGP4 $355
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $353
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $357
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+LABELV $357
+ADDRLP4 1064
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $359
+ADDRLP4 1064
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $359
+ADDRLP4 1048
+ADDRFP4 16
+INDIRP4
+ASGNP4
+LABELV $359
+ADDRLP4 4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $361
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $363
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $365
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $366
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+GEF4 $366
+ADDRLP4 4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+LTF4 $370
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+GEF4 $370
+ADDRLP4 4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRGP4 $372
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+LTF4 $373
+ADDRFP4 4
+INDIRF4
+CNSTF4 1082130432
+GEF4 $373
+ADDRLP4 4
+ARGP4
+ADDRGP4 $368
+ARGP4
+ADDRGP4 $375
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $373
+LABELV $371
+LABELV $367
+ADDRLP4 0
+ADDRGP4 $321
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $376
+ADDRLP4 1040
+ADDRGP4 $378
+ASGNP4
+LABELV $376
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $379
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $380
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $381
+ADDRLP4 1044
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+LABELV $381
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $383
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $384
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $385
+ADDRLP4 1028
+ADDRGP4 $387
+ASGNP4
+LABELV $385
+ADDRLP4 4
+ARGP4
+ADDRGP4 $388
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $389
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $390
+ADDRLP4 1028
+ADDRGP4 $392
+ASGNP4
+LABELV $390
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $393
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $394
+ADDRLP4 1028
+ADDRGP4 $396
+ASGNP4
+LABELV $394
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $398
+ADDRGP4 $400
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $398
+ADDRLP4 1108
+ADDRGP4 trap_BotAllocateClient
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+NEI4 $401
+ADDRGP4 $403
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $404
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $401
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $407
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $405
+LABELV $407
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $408
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $408
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 1
+NEI4 $411
+ADDRFP4 8
+ADDRGP4 $190
+ASGNP4
+ADDRGP4 $409
+JUMPV
+LABELV $411
+ADDRFP4 8
+ADDRGP4 $193
+ASGNP4
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRFP4 8
+ADDRGP4 $190
+ASGNP4
+LABELV $409
+LABELV $405
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $413
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1052
+CNSTI4 816
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 1124
+ADDRLP4 1052
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+ADDRLP4 1124
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1052
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1128
+CNSTI4 1
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+ARGI4
+ADDRLP4 1128
+INDIRI4
+ARGI4
+ADDRLP4 1132
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 1132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRGP4 $352
+JUMPV
+LABELV $414
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $416
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AddBotToSpawnQueue
+CALLV
+pop
+LABELV $352
+endproc G_AddBot 1136 12
+export Svcmd_AddBot_f
+proc Svcmd_AddBot_f 4116 20
+ADDRGP4 $421
+ARGP4
+ADDRLP4 4104
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4104
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 4108
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 0
+NEI4 $419
+LABELV $422
+ADDRGP4 $418
+JUMPV
+LABELV $419
+CNSTI4 1
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $423
+ADDRGP4 $425
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $423
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $426
+ADDRLP4 4096
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRLP4 0
+ARGP4
+ADDRLP4 4112
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4096
+ADDRLP4 4112
+INDIRF4
+ASGNF4
+LABELV $427
+CNSTI4 3
+ARGI4
+ADDRLP4 3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $428
+ADDRLP4 4100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 0
+ARGP4
+ADDRLP4 4112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4100
+ADDRLP4 4112
+INDIRI4
+ASGNI4
+LABELV $429
+CNSTI4 5
+ARGI4
+ADDRLP4 2048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 4096
+INDIRF4
+ARGF4
+ADDRLP4 3072
+ARGP4
+ADDRLP4 4100
+INDIRI4
+ARGI4
+ADDRLP4 2048
+ARGP4
+ADDRGP4 G_AddBot
+CALLV
+pop
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $430
+ADDRGP4 $434
+ARGP4
+ADDRLP4 4112
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4112
+INDIRI4
+CNSTI4 0
+EQI4 $430
+CNSTI4 -1
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $430
+LABELV $418
+endproc Svcmd_AddBot_f 4116 20
+export Svcmd_BotList_f
+proc Svcmd_BotList_f 4120 20
+ADDRGP4 $437
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $438
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 4100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4100
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $442
+ADDRLP4 4
+ARGP4
+ADDRGP4 $444
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 4104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4104
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1028
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $445
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $445
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 4108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 4108
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $447
+ADDRLP4 2052
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 4112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 4112
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 3076
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $449
+ADDRLP4 3076
+ARGP4
+ADDRGP4 $451
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $449
+ADDRGP4 $452
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $439
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $441
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $438
+LABELV $436
+endproc Svcmd_BotList_f 4120 20
+proc G_SpawnBots 1060 16
+ADDRLP4 1040
+CNSTP4 0
+ASGNP4
+ADDRGP4 podium1
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 podium2
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 podium3
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $454
+ADDRGP4 $187
+ARGP4
+ADDRGP4 $456
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+LEF4 $457
+ADDRGP4 $187
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1084227584
+ASGNF4
+LABELV $457
+LABELV $455
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $460
+JUMPV
+LABELV $462
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $463
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $462
+LABELV $465
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $466
+ADDRGP4 $461
+JUMPV
+LABELV $466
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $469
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $471
+ADDRLP4 1052
+INDIRI4
+CNSTI4 32
+NEI4 $468
+LABELV $471
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $472
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $472
+ADDRGP4 $474
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1500
+ADDI4
+ASGNI4
+LABELV $460
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $463
+LABELV $461
+LABELV $453
+endproc G_SpawnBots 1060 16
+proc G_LoadBotsFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $476
+ADDRGP4 $96
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $476
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $478
+ADDRGP4 $99
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $478
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 g_numBots
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 G_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $475
+endproc G_LoadBotsFromFile 8216 16
+proc G_LoadBots 1456 16
+ADDRGP4 $421
+ARGP4
+ADDRLP4 1440
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 1440
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRGP4 $480
+JUMPV
+LABELV $481
+ADDRGP4 g_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $483
+ARGP4
+ADDRGP4 $102
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $484
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRGP4 $488
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $485
+ADDRGP4 $108
+ARGP4
+ADDRGP4 $489
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $490
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 1448
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $491
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $493
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $490
+ADDRGP4 $494
+ARGP4
+ADDRGP4 g_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $480
+endproc G_LoadBots 1456 16
+export G_GetBotInfoByNumber
+proc G_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $498
+ADDRFP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $496
+LABELV $498
+ADDRGP4 $499
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $495
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $495
+endproc G_GetBotInfoByNumber 8 8
+export G_GetBotInfoByName
+proc G_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $501
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $500
+JUMPV
+LABELV $505
+LABELV $502
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $504
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $501
+CNSTP4 0
+RETP4
+LABELV $500
+endproc G_GetBotInfoByName 16 8
+export G_InitBots
+proc G_InitBots 1148 16
+ADDRGP4 G_LoadBots
+CALLV
+pop
+ADDRGP4 G_LoadArenas
+CALLV
+pop
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 $508
+ARGP4
+ADDRGP4 $509
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_autominplayers
+ARGP4
+ADDRGP4 $510
+ARGP4
+ADDRGP4 $509
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $511
+ADDRLP4 84
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 84
+ARGP4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 1112
+ADDRGP4 G_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $515
+ADDRGP4 $507
+JUMPV
+LABELV $515
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $517
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRGP4 $517
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRGP4 $517
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $519
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRGP4 $520
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRGP4 $520
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $522
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+NEI4 $523
+ADDRLP4 16
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+NEI4 $523
+ADDRGP4 $517
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $520
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $523
+ADDRLP4 8
+CNSTI4 2000
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $526
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $529
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $527
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $527
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_SpawnBots
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRGP4 bot_autominplayers+12
+INDIRI4
+CNSTI4 0
+EQI4 $533
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $536
+ADDRGP4 $508
+ARGP4
+ADDRGP4 $539
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 1108
+ADDRGP4 MinSpawnpointCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1108
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 1112
+CNSTI4 3
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1112
+INDIRI4
+GEI4 $540
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 1112
+INDIRI4
+LTI4 $543
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+EQI4 $540
+LABELV $543
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+LABELV $540
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $544
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $544
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+NEI4 $544
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $544
+ADDRGP4 $121
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $508
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $537
+LABELV $533
+LABELV $512
+LABELV $507
+endproc G_InitBots 1148 16
+import podium3
+import podium2
+import podium1
+bss
+export bot_autominplayers
+align 4
+LABELV bot_autominplayers
+skip 272
+export bot_minplayers
+align 4
+LABELV bot_minplayers
+skip 272
+align 4
+LABELV botSpawnQueue
+skip 128
+align 4
+LABELV g_arenaInfos
+skip 4096
+export g_numArenas
+align 4
+LABELV g_numArenas
+skip 4
+align 4
+LABELV g_botInfos
+skip 4096
+align 4
+LABELV g_numBots
+skip 4
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $539
+byte 1 50
+byte 1 0
+align 1
+LABELV $532
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $529
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $526
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $525
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $520
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $517
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $514
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $510
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $509
+byte 1 48
+byte 1 0
+align 1
+LABELV $508
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $499
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $494
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $489
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $488
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $483
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $474
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $456
+byte 1 49
+byte 1 0
+align 1
+LABELV $452
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $451
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $444
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $437
+byte 1 94
+byte 1 49
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $435
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $434
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $425
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 45
+byte 1 53
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $421
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $413
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $404
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $403
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $400
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $397
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $396
+byte 1 53
+byte 1 0
+align 1
+LABELV $393
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $392
+byte 1 52
+byte 1 0
+align 1
+LABELV $389
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $388
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $384
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $383
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $380
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $379
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $378
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $375
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $372
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $369
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $368
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $365
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $364
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $363
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $362
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $361
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $356
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $355
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $351
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $346
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $344
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $342
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $332
+byte 1 94
+byte 1 51
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $321
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $210
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $193
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $190
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $187
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $144
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $136
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 10
+byte 1 0
+align 1
+LABELV $135
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $129
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $121
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $120
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $115
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $114
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $109
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $102
+byte 1 0
+align 1
+LABELV $101
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $99
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $96
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $90
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $89
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 0
+align 1
+LABELV $86
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $83
+byte 1 125
+byte 1 0
+align 1
+LABELV $80
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $74
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $71
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $70
+byte 1 123
+byte 1 0
@@ -0,0 +1,11180 @@
+data
+align 4
+LABELV playerMins
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+align 4
+LABELV playerMaxs
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1107296256
+export SP_info_player_deathmatch
+code
+proc SP_info_player_deathmatch 8 12
+ADDRGP4 $61
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $63
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+LABELV $63
+ADDRGP4 $65
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $66
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $66
+LABELV $60
+endproc SP_info_player_deathmatch 8 12
+export SP_info_player_start
+proc SP_info_player_start 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $69
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SP_info_player_deathmatch
+CALLV
+pop
+LABELV $68
+endproc SP_info_player_start 0 4
+export SP_domination_point
+proc SP_domination_point 0 0
+LABELV $70
+endproc SP_domination_point 0 0
+export SP_info_player_intermission
+proc SP_info_player_intermission 0 0
+LABELV $71
+endproc SP_info_player_intermission 0 0
+export SpotWouldTelefrag
+proc SpotWouldTelefrag 4144 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4108
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 playerMins
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 playerMins+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 playerMins+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108
+ARGP4
+ADDRLP4 4120
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4140
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $84
+JUMPV
+LABELV $81
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $85
+CNSTI4 1
+RETI4
+ADDRGP4 $72
+JUMPV
+LABELV $85
+LABELV $82
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $84
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $81
+CNSTI4 0
+RETI4
+LABELV $72
+endproc SpotWouldTelefrag 4144 16
+export SelectNearestDeathmatchSpawnPoint
+proc SelectNearestDeathmatchSpawnPoint 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $93
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $93
+LABELV $89
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $88
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $87
+endproc SelectNearestDeathmatchSpawnPoint 44 12
+proc SelectRandomDeathmatchSpawnPoint 540 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 528
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 528
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 528
+INDIRP4
+ASGNP4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $99
+ADDRGP4 $97
+JUMPV
+LABELV $99
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 536
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRGP4 $97
+JUMPV
+LABELV $101
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 532
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 532
+INDIRP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $96
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $95
+JUMPV
+LABELV $103
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 524
+ADDRLP4 536
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $95
+endproc SelectRandomDeathmatchSpawnPoint 540 12
+export SelectSpawnPoint
+proc SelectSpawnPoint 24 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 SelectNearestDeathmatchSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 SelectRandomDeathmatchSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $106
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 SelectRandomDeathmatchSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $108
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 SelectRandomDeathmatchSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $108
+LABELV $106
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $110
+ADDRGP4 g_cheats+12
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRGP4 $115
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $112
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+LABELV $110
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $105
+endproc SelectSpawnPoint 24 4
+proc SelectInitialSpawnPoint 20 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $120
+ADDRGP4 $118
+JUMPV
+LABELV $120
+ADDRLP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $122
+ADDRGP4 $119
+JUMPV
+LABELV $122
+LABELV $118
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $117
+LABELV $119
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $126
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $124
+LABELV $126
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $116
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $116
+endproc SelectInitialSpawnPoint 20 16
+proc SelectSpectatorSpawnPoint 0 0
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 level+9160
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 level+9172
+INDIRB
+ASGNB 12
+CNSTP4 0
+RETP4
+LABELV $127
+endproc SelectSpectatorSpawnPoint 0 0
+export InitBodyQue
+proc InitBodyQue 12 0
+ADDRGP4 level+9192
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $132
+ADDRLP4 8
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $136
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9196
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $133
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $132
+LABELV $130
+endproc InitBodyQue 12 0
+export BodySink
+proc BodySink 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6500
+LEI4 $139
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $138
+endproc BodySink 4 4
+export CopyToBodyQue
+proc CopyToBodyQue 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $144
+ADDRGP4 $143
+JUMPV
+LABELV $144
+ADDRLP4 4
+ADDRGP4 level+9192
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9196
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 level+9192
+ADDRGP4 level+9192
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 8
+MODI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $150
+ADDRGP4 level+9192
+ADDRGP4 level+9192
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 8
+MODI4
+ASGNI4
+LABELV $151
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $153
+ADDRGP4 level+9192
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9196
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $150
+LABELV $158
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 208
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $159
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $161
+ADDRLP4 8
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $166
+ADDRGP4 $162
+JUMPV
+LABELV $166
+ADDRLP4 8
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $168
+ADDRGP4 $162
+JUMPV
+LABELV $168
+ADDRLP4 8
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 28
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRGP4 $162
+JUMPV
+LABELV $170
+ADDRLP4 8
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $164
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $161
+LABELV $163
+LABELV $159
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 568
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $174
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $175
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $177
+ADDRLP4 24
+INDIRI4
+CNSTI4 5
+GTI4 $177
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $183
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $183
+address $180
+address $180
+address $181
+address $181
+address $182
+address $182
+code
+LABELV $180
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $181
+ADDRLP4 44
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $182
+LABELV $177
+ADDRLP4 52
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $178
+ADDRLP4 32
+CNSTI4 424
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 436
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+CNSTI4 448
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+CNSTI4 464
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+CNSTI4 476
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 65537
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 BodySink
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $185
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $186
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $143
+endproc CopyToBodyQue 56 8
+export SetClientViewAngle
+proc SetClientViewAngle 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $188
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1199570944
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $189
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $187
+endproc SetClientViewAngle 16 0
+export ClientRespawn
+proc ClientRespawn 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $193
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $193
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CopyToBodyQue
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $192
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_lms_mode+12
+INDIRI4
+CNSTI4 2
+EQI4 $211
+ADDRGP4 g_lms_mode+12
+INDIRI4
+CNSTI4 3
+NEI4 $205
+LABELV $211
+ADDRGP4 level+9236
+INDIRI4
+ADDRGP4 level+9240
+INDIRI4
+NEI4 $205
+ADDRGP4 LMSpoint
+CALLV
+pop
+LABELV $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $202
+LABELV $198
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $218
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $218
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $212
+LABELV $218
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $212
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $212
+ADDRGP4 $192
+JUMPV
+LABELV $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $219
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $219
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRLP4 8
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $219
+LABELV $192
+endproc ClientRespawn 16 8
+export respawnRound
+proc respawnRound 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $227
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $227
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $227
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $227
+LABELV $224
+endproc respawnRound 12 8
+export TeamCvarSet
+proc TeamCvarSet 28 12
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $233
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $238
+ADDRGP4 $234
+JUMPV
+LABELV $238
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $240
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $242
+ADDRGP4 $244
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRGP4 $245
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $243
+LABELV $240
+LABELV $234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $236
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $233
+ADDRGP4 g_redTeamClientNumbers+16
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $246
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $246
+ADDRGP4 $249
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $250
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $251
+JUMPV
+LABELV $255
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $257
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRGP4 $244
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRGP4 $245
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $260
+LABELV $257
+LABELV $251
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $253
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $250
+ADDRGP4 g_blueTeamClientNumbers+16
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $261
+ADDRGP4 $264
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $265
+ADDRGP4 g_redTeamClientNumbers
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 SendYourTeamMessageToTeam
+CALLV
+pop
+LABELV $265
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $267
+ADDRGP4 g_blueTeamClientNumbers
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 SendYourTeamMessageToTeam
+CALLV
+pop
+LABELV $267
+LABELV $232
+endproc TeamCvarSet 28 12
+export TeamCount
+proc TeamCount 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $270
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $275
+ADDRGP4 $271
+JUMPV
+LABELV $275
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $277
+ADDRGP4 $271
+JUMPV
+LABELV $277
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $279
+ADDRGP4 $271
+JUMPV
+LABELV $279
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $281
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $281
+LABELV $271
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $273
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $270
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $269
+endproc TeamCount 8 0
+export TeamLivingCount
+proc TeamLivingCount 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $286
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $288
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $293
+ADDRGP4 $289
+JUMPV
+LABELV $293
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $295
+ADDRGP4 $289
+JUMPV
+LABELV $295
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $297
+ADDRGP4 $289
+JUMPV
+LABELV $297
+ADDRLP4 16
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $299
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $301
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $299
+LABELV $301
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $299
+LABELV $289
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $291
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $288
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $283
+endproc TeamLivingCount 24 0
+export TeamLivingHumanCount
+proc TeamLivingHumanCount 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $305
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $306
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $312
+ADDRGP4 $308
+JUMPV
+LABELV $312
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $314
+ADDRGP4 $308
+JUMPV
+LABELV $314
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $316
+ADDRGP4 $308
+JUMPV
+LABELV $316
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $318
+ADDRGP4 $308
+JUMPV
+LABELV $318
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $322
+ADDRGP4 $308
+JUMPV
+LABELV $322
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $326
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $324
+LABELV $326
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $324
+LABELV $308
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $307
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $302
+endproc TeamLivingHumanCount 20 0
+export TeamHumanParticipantsCount
+proc TeamHumanParticipantsCount 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $328
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $333
+ADDRGP4 $329
+JUMPV
+LABELV $333
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $335
+ADDRGP4 $329
+JUMPV
+LABELV $335
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $337
+ADDRGP4 $329
+JUMPV
+LABELV $337
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $339
+ADDRGP4 $329
+JUMPV
+LABELV $339
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $343
+ADDRGP4 $329
+JUMPV
+LABELV $343
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $329
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $331
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $328
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $327
+endproc TeamHumanParticipantsCount 8 0
+export TeamHealthCount
+proc TeamHealthCount 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $351
+ADDRGP4 $347
+JUMPV
+LABELV $351
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $353
+ADDRGP4 $347
+JUMPV
+LABELV $353
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $355
+ADDRGP4 $347
+JUMPV
+LABELV $355
+ADDRLP4 8
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $357
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $357
+ADDRLP4 8
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $357
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $357
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $349
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $346
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $345
+endproc TeamHealthCount 16 0
+export RespawnAll
+proc RespawnAll 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $360
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $365
+ADDRGP4 $361
+JUMPV
+LABELV $365
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $367
+ADDRGP4 $361
+JUMPV
+LABELV $367
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $369
+ADDRGP4 $361
+JUMPV
+LABELV $369
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRGP4 g_lms_lives+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 respawnRound
+CALLV
+pop
+LABELV $361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $363
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $360
+LABELV $359
+endproc RespawnAll 8 4
+export RespawnDead
+proc RespawnDead 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $376
+JUMPV
+LABELV $373
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $378
+ADDRGP4 $374
+JUMPV
+LABELV $378
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $380
+ADDRGP4 $374
+JUMPV
+LABELV $380
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRGP4 g_lms_lives+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRGP4 $374
+JUMPV
+LABELV $383
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $385
+ADDRGP4 $374
+JUMPV
+LABELV $385
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRGP4 g_lms_lives+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 respawnRound
+CALLV
+pop
+LABELV $374
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $376
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $373
+LABELV $372
+endproc RespawnDead 8 4
+export DisableWeapons
+proc DisableWeapons 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $389
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $394
+ADDRGP4 $390
+JUMPV
+LABELV $394
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $396
+ADDRGP4 $390
+JUMPV
+LABELV $396
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $398
+ADDRGP4 $390
+JUMPV
+LABELV $398
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $392
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $389
+ADDRGP4 ProximityMine_RemoveAll
+CALLV
+pop
+LABELV $388
+endproc DisableWeapons 12 0
+export EnableWeapons
+proc EnableWeapons 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $401
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $402
+JUMPV
+LABELV $406
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $408
+ADDRGP4 $402
+JUMPV
+LABELV $408
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $404
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $401
+LABELV $400
+endproc EnableWeapons 12 0
+export LMSpoint
+proc LMSpoint 20 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $411
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $412
+JUMPV
+LABELV $416
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $418
+ADDRGP4 $412
+JUMPV
+LABELV $418
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRGP4 $412
+JUMPV
+LABELV $420
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $422
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $412
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $414
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $411
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $410
+endproc LMSpoint 20 20
+export TeamLeader
+proc TeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $424
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $429
+ADDRGP4 $425
+JUMPV
+LABELV $429
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $431
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $423
+JUMPV
+LABELV $433
+LABELV $431
+LABELV $425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $424
+CNSTI4 -1
+RETI4
+LABELV $423
+endproc TeamLeader 4 0
+export PickTeam
+proc PickTeam 28 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9456
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $438
+ADDRGP4 level+9460
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $438
+ADDRGP4 $442
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 3
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $438
+ADDRLP4 0+8
+INDIRI4
+ADDRLP4 0+4
+INDIRI4
+LEI4 $443
+ADDRGP4 level+9456
+INDIRI4
+CNSTI4 0
+NEI4 $443
+CNSTI4 1
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $443
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 0+8
+INDIRI4
+LEI4 $448
+ADDRGP4 level+9460
+INDIRI4
+CNSTI4 0
+NEI4 $448
+CNSTI4 2
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $448
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 level+44+4
+INDIRI4
+LEI4 $453
+ADDRGP4 level+9456
+INDIRI4
+CNSTI4 0
+NEI4 $453
+CNSTI4 1
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $453
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $460
+ADDRGP4 level+9460
+INDIRI4
+CNSTI4 0
+NEI4 $460
+CNSTI4 2
+RETI4
+ADDRGP4 $435
+JUMPV
+LABELV $460
+CNSTI4 2
+RETI4
+LABELV $435
+endproc PickTeam 28 8
+proc ClientCleanName 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $471
+JUMPV
+LABELV $468
+LABELV $469
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $471
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $468
+ADDRGP4 $475
+JUMPV
+LABELV $472
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $476
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LEI4 $478
+ADDRGP4 $473
+JUMPV
+LABELV $478
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $480
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $480
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $482
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $482
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRLP4 32
+INDIRI4
+CNSTI4 48
+LTI4 $482
+ADDRLP4 32
+INDIRI4
+CNSTI4 56
+GTI4 $482
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 0
+NEI4 $484
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $484
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $482
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $486
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_isalpha
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $486
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $486
+LABELV $488
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $486
+LABELV $481
+LABELV $477
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $473
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $475
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $489
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $472
+LABELV $489
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+GEI4 $490
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+LABELV $490
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $494
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $492
+LABELV $494
+ADDRGP4 $495
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $492
+LABELV $467
+endproc ClientCleanName 36 12
+export ClientUserinfoChanged
+proc ClientUserinfoChanged 7420 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2192
+CNSTI4 0
+ASGNI4
+ADDRLP4 2056
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 7332
+ADDRGP4 Info_Validate
+CALLI4
+ASGNI4
+ADDRLP4 7332
+INDIRI4
+CNSTI4 0
+NEI4 $497
+ADDRLP4 4
+ARGP4
+ADDRGP4 $499
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $497
+ADDRLP4 4
+ARGP4
+ADDRGP4 $500
+ARGP4
+ADDRLP4 7336
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7336
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRLP4 7340
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 7340
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $501
+ADDRLP4 4
+ARGP4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 7344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7344
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 7348
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 7348
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $506
+ADDRLP4 4
+ARGP4
+ADDRGP4 $507
+ARGP4
+ADDRLP4 7352
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7352
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 7356
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 7356
+INDIRI4
+CNSTI4 0
+NEI4 $508
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 7360
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRLP4 7360
+INDIRI4
+ASGNI4
+LABELV $509
+ADDRLP4 4
+ARGP4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 7360
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7360
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 7364
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRLP4 7364
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 7368
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7368
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientCleanName
+CALLV
+pop
+ADDRLP4 1032
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 7372
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 7372
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRLP4 7376
+ADDRLP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 7376
+INDIRI4
+CNSTI4 0
+EQI4 $514
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 7376
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRGP4 g_minNameChangePeriod+8
+INDIRF4
+MULF4
+GTF4 $514
+ADDRGP4 $518
+ARGP4
+ADDRGP4 g_minNameChangePeriod+12
+INDIRI4
+ARGI4
+ADDRLP4 7380
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2056
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 7380
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 2192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRGP4 g_maxNameChanges+12
+INDIRI4
+CNSTI4 0
+LEI4 $520
+ADDRLP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRI4
+ADDRGP4 g_maxNameChanges+12
+INDIRI4
+LTI4 $520
+ADDRGP4 $524
+ARGP4
+ADDRGP4 g_maxNameChanges+12
+INDIRI4
+ARGI4
+ADDRLP4 7380
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2056
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 7380
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 2192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRLP4 0
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRLP4 2056
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRGP4 $528
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 2192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 2056
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 6304
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 7380
+ADDRGP4 G_admin_name_check
+CALLI4
+ASGNI4
+ADDRLP4 7380
+INDIRI4
+CNSTI4 0
+NEI4 $529
+ADDRGP4 $531
+ARGP4
+ADDRLP4 6304
+ARGP4
+ADDRLP4 7384
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2056
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 7384
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 2192
+CNSTI4 1
+ASGNI4
+LABELV $529
+LABELV $527
+LABELV $521
+LABELV $515
+ADDRLP4 2056
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $532
+ADDRLP4 2192
+CNSTI4 0
+ASGNI4
+LABELV $532
+ADDRLP4 2192
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $538
+ADDRLP4 7384
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRLP4 7384
+ADDRGP4 $536
+ASGNP4
+LABELV $539
+ADDRLP4 7384
+INDIRP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $540
+ADDRLP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 7384
+ADDRLP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ASGNP4
+ADDRLP4 7384
+INDIRP4
+ADDRLP4 7384
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $540
+LABELV $535
+LABELV $512
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $550
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $550
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $550
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $543
+LABELV $550
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $543
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $551
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $543
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $552
+ADDRLP4 1032
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 7380
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 7380
+INDIRI4
+CNSTI4 0
+EQI4 $554
+ADDRGP4 $556
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 7384
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 7384
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $554
+LABELV $552
+ADDRLP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $557
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 200
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRLP4 4
+ARGP4
+ADDRGP4 $559
+ARGP4
+ADDRLP4 7380
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 7380
+INDIRP4
+ARGP4
+ADDRLP4 7384
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 6300
+ADDRLP4 7384
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 6300
+INDIRI4
+ASGNI4
+ADDRLP4 7388
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 7388
+INDIRI4
+CNSTI4 1
+LTI4 $562
+ADDRLP4 7388
+INDIRI4
+CNSTI4 100
+LEI4 $560
+LABELV $562
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $560
+LABELV $558
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $563
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+NEI4 $563
+ADDRLP4 4
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 7384
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2060
+ARGP4
+ADDRLP4 7384
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 7388
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2124
+ARGP4
+ADDRLP4 7388
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRLP4 4
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 7384
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2060
+ARGP4
+ADDRLP4 7384
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 7388
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2124
+ARGP4
+ADDRLP4 7388
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $564
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $570
+ADDRLP4 7384
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_ffa_gt
+INDIRI4
+ADDRLP4 7384
+INDIRI4
+NEI4 $570
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 7384
+INDIRI4
+EQI4 $570
+ADDRLP4 4
+ARGP4
+ADDRGP4 $575
+ARGP4
+ADDRLP4 7388
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7388
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $578
+ARGP4
+ADDRLP4 7392
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 7392
+INDIRI4
+CNSTI4 0
+EQI4 $580
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 7396
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 7396
+INDIRI4
+CNSTI4 0
+NEI4 $576
+LABELV $580
+ADDRLP4 2188
+CNSTI4 1
+ASGNI4
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 7400
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 7400
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $584
+ARGP4
+ADDRLP4 7404
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 7404
+INDIRI4
+CNSTI4 0
+NEI4 $581
+LABELV $585
+ADDRLP4 2188
+CNSTI4 2
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 7408
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 2188
+ADDRLP4 7408
+INDIRI4
+ASGNI4
+LABELV $582
+LABELV $577
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDRLP4 2188
+INDIRI4
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 2188
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $571
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $586
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $586
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRLP4 4
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 7388
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7388
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $592
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 7396
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 7396
+INDIRI4
+CNSTI4 0
+EQI4 $590
+LABELV $592
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $591
+JUMPV
+LABELV $590
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $591
+LABELV $587
+ADDRLP4 4
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 7388
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 7388
+INDIRP4
+ARGP4
+ADDRLP4 7392
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2196
+ADDRLP4 7392
+INDIRI4
+ASGNI4
+ADDRLP4 2200
+ADDRLP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $594
+ADDRLP4 7396
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_ffa_gt
+INDIRI4
+ADDRLP4 7396
+INDIRI4
+NEI4 $594
+ADDRGP4 g_instantgib+12
+INDIRI4
+ADDRLP4 7396
+INDIRI4
+EQI4 $594
+ADDRLP4 7400
+ADDRLP4 2188
+INDIRI4
+ASGNI4
+ADDRLP4 7400
+INDIRI4
+CNSTI4 1
+EQI4 $600
+ADDRLP4 7400
+INDIRI4
+CNSTI4 2
+EQI4 $603
+ADDRGP4 $595
+JUMPV
+LABELV $600
+ADDRLP4 7404
+CNSTI1 52
+ASGNI1
+ADDRLP4 2204
+ADDRLP4 7404
+INDIRI1
+ASGNI1
+ADDRLP4 3228
+ADDRLP4 7404
+INDIRI1
+ASGNI1
+ADDRLP4 2204+1
+CNSTI1 0
+ASGNI1
+ADDRLP4 3228+1
+CNSTI1 0
+ASGNI1
+ADDRGP4 $595
+JUMPV
+LABELV $603
+ADDRLP4 7405
+CNSTI1 49
+ASGNI1
+ADDRLP4 2204
+ADDRLP4 7405
+INDIRI1
+ASGNI1
+ADDRLP4 3228
+ADDRLP4 7405
+INDIRI1
+ASGNI1
+ADDRLP4 2204+1
+CNSTI1 0
+ASGNI1
+ADDRLP4 3228+1
+CNSTI1 0
+ASGNI1
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRLP4 4
+ARGP4
+ADDRGP4 $606
+ARGP4
+ADDRLP4 7400
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2204
+ARGP4
+ADDRLP4 7400
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 7404
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 7404
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $595
+ADDRLP4 4
+ARGP4
+ADDRGP4 $608
+ARGP4
+ADDRLP4 7400
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4252
+ARGP4
+ADDRLP4 7400
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $609
+ARGP4
+ADDRLP4 7404
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5276
+ARGP4
+ADDRLP4 7404
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2056
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $610
+ADDRLP4 4
+ARGP4
+ADDRGP4 $613
+ARGP4
+ADDRLP4 7408
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $612
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 2188
+INDIRI4
+ARGI4
+ADDRLP4 2060
+ARGP4
+ADDRLP4 2124
+ARGP4
+ADDRLP4 2204
+ARGP4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 7408
+INDIRP4
+ARGP4
+ADDRLP4 2196
+INDIRI4
+ARGI4
+ADDRLP4 2200
+INDIRI4
+ARGI4
+ADDRLP4 7416
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7416
+INDIRP4
+ASGNP4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRGP4 $614
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2060
+ARGP4
+ADDRLP4 2124
+ARGP4
+ADDRLP4 4252
+ARGP4
+ADDRLP4 5276
+ARGP4
+ADDRLP4 2204
+ARGP4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2196
+INDIRI4
+ARGI4
+ADDRLP4 2200
+INDIRI4
+ARGI4
+ADDRLP4 7412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 7412
+INDIRP4
+ASGNP4
+LABELV $611
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 7408
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $615
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 7408
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $496
+endproc ClientUserinfoChanged 7420 56
+lit
+align 1
+LABELV $618
+byte 1 0
+skip 1023
+export ClientConnect
+code
+proc ClientConnect 2136 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRGP4 $618
+INDIRB
+ASGNB 1024
+ADDRLP4 1036
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 2140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 2068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $500
+ARGP4
+ADDRLP4 2072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 G_FilterPacket
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRLP4 2080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 0
+NEI4 $619
+ADDRGP4 $621
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $622
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $619
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2084
+ADDRGP4 G_admin_ban_check
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRGP4 $625
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 2088
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2088
+INDIRP4
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $623
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $626
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRLP4 2088
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+CNSTI4 0
+EQI4 $626
+ADDRLP4 12
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 2092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 2092
+INDIRP4
+ASGNP4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $629
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 2096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2096
+INDIRI4
+CNSTI4 0
+EQI4 $629
+ADDRGP4 g_password+16
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 2100
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2100
+INDIRI4
+CNSTI4 0
+EQI4 $629
+ADDRGP4 $635
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $629
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $636
+LABELV $637
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $639
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $644
+ADDRLP4 2108
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 48
+LTI4 $641
+ADDRLP4 2108
+INDIRI4
+CNSTI4 57
+LEI4 $636
+LABELV $641
+ADDRLP4 2112
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2112
+INDIRI4
+CNSTI4 65
+LTI4 $642
+ADDRLP4 2112
+INDIRI4
+CNSTI4 70
+LEI4 $636
+LABELV $642
+ADDRLP4 2116
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2116
+INDIRI4
+CNSTI4 48
+LTI4 $643
+ADDRLP4 2116
+INDIRI4
+CNSTI4 57
+LEI4 $636
+LABELV $643
+ADDRLP4 2120
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 912
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2120
+INDIRI4
+CNSTI4 97
+LTI4 $644
+ADDRLP4 2120
+INDIRI4
+CNSTI4 102
+LEI4 $636
+LABELV $644
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 32
+GEU4 $645
+ADDRGP4 $647
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $645
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $648
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $653
+ADDRGP4 $649
+JUMPV
+LABELV $653
+ADDRLP4 2124
+CNSTI4 912
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 2124
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ADDRLP4 2124
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 2128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2128
+INDIRI4
+CNSTI4 0
+NEI4 $655
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 2132
+ADDRGP4 G_ClientIsLagging
+CALLI4
+ASGNI4
+ADDRLP4 2132
+INDIRI4
+CNSTI4 0
+NEI4 $657
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $659
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $660
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $657
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $661
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+LABELV $655
+LABELV $649
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $651
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $648
+LABELV $626
+ADDRLP4 4
+INDIRP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRLP4 2092
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2092
+INDIRI4
+CNSTI4 0
+NEI4 $662
+ADDRLP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $662
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 2096
+ADDRGP4 G_admin_level
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1000
+ADDP4
+ADDRLP4 2096
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 2100
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 2100
+INDIRI4
+NEI4 $667
+ADDRGP4 level+64
+INDIRI4
+ADDRLP4 2100
+INDIRI4
+EQI4 $664
+LABELV $667
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_InitSessionData
+CALLV
+pop
+LABELV $664
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_ReadSessionData
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $668
+ADDRLP4 2104
+ADDRLP4 1036
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 2104
+INDIRP4
+ADDRLP4 2104
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $673
+ADDRLP4 2108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 2108
+CNSTI4 0
+ASGNI4
+LABELV $674
+ADDRLP4 2108
+INDIRI4
+ARGI4
+ADDRLP4 2112
+ADDRGP4 G_BotConnect
+CALLI4
+ASGNI4
+ADDRLP4 2112
+INDIRI4
+CNSTI4 0
+NEI4 $670
+ADDRGP4 $675
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $670
+LABELV $668
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $676
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $677
+ADDRGP4 $679
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 2104
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 2104
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $677
+ADDRLP4 2104
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 2104
+INDIRI4
+LTI4 $680
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 2104
+INDIRI4
+EQI4 $680
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 BroadcastTeamChange
+CALLV
+pop
+LABELV $680
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 g_delagHitscan+12
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $686
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $684
+JUMPV
+LABELV $683
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $687
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $684
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_admin_namelog_update
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $617
+endproc ClientConnect 2136 12
+export motd
+proc motd 1052 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 $689
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 g_motdfile+16
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $691
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+CVIU4 4
+CNSTU4 1022
+LEU4 $693
+ADDRLP4 1024
+CNSTU4 1022
+ADDRLP4 1028
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+LABELV $693
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 0
+ADDP4
+ARGP4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ADDRLP4 0
+ADDP4
+CNSTI1 34
+ASGNI1
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ADDRLP4 0+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $696
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 1024
+INDIRI4
+ADDI4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+CVPU4 4
+SUBU4
+CVUI4 4
+SUBI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $697
+ADDRLP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 1048
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $696
+LABELV $691
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $688
+endproc motd 1052 12
+export ClientBegin
+proc ClientBegin 1092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 2140
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $700
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $703
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $703
+ADDRLP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $706
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $708
+ADDRGP4 $711
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9428
+CNSTI4 1
+ASGNI4
+LABELV $708
+LABELV $706
+CNSTI4 -1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 1060
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 1064
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $716
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+EQI4 $713
+LABELV $716
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 level+9432
+INDIRI4
+LEI4 $714
+ADDRGP4 level+9432
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+LEI4 $721
+ADDRLP4 1040
+INDIRI4
+ADDRGP4 level+9432
+INDIRI4
+LEI4 $722
+ADDRGP4 level+9432
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 1036
+INDIRI4
+ADDRGP4 level+9432
+INDIRI4
+LEI4 $727
+ADDRGP4 level+9432
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+LABELV $727
+LABELV $722
+LABELV $714
+ADDRLP4 1032
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 468
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $731
+ADDRLP4 8
+ARGP4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PlayerStore_restore
+CALLV
+pop
+LABELV $731
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $733
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $744
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+NEI4 $742
+ADDRGP4 level+9144
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $733
+LABELV $742
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $743
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $733
+LABELV $743
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $744
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $733
+LABELV $744
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRLP4 1080
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1080
+INDIRP4
+ASGNP4
+ADDRLP4 1084
+CNSTI4 168
+ASGNI4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1084
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 1084
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $745
+ADDRGP4 $748
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $745
+LABELV $733
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 motd
+CALLV
+pop
+ADDRGP4 $749
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+NEI4 $750
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DominationPointNamesMessage
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DominationPointStatusMessage
+CALLV
+pop
+LABELV $750
+ADDRGP4 TeamCvarSet
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 custom_vote_info
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $753
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 SendCustomVoteCommands
+CALLV
+pop
+LABELV $753
+LABELV $699
+endproc ClientBegin 1092 12
+export ClientSpawn
+proc ClientSpawn 1928 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $764
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $764
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $756
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $756
+LABELV $764
+ADDRLP4 1852
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+ADDRLP4 1852
+INDIRI4
+EQI4 $765
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 1852
+INDIRI4
+EQI4 $756
+LABELV $765
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $756
+ADDRGP4 level+9236
+INDIRI4
+ADDRGP4 level+9240
+INDIRI4
+EQI4 $773
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_elimination_activewarmup+12
+INDIRI4
+MULI4
+SUBI4
+GEI4 $766
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 1856
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 1856
+INDIRI4
+CNSTI4 0
+EQI4 $766
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 1860
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 1860
+INDIRI4
+CNSTI4 0
+EQI4 $766
+LABELV $773
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $774
+ADDRGP4 $777
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $774
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $766
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+ADDRGP4 level+9236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 $757
+JUMPV
+LABELV $756
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $780
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $780
+LABELV $757
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $782
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $782
+ADDRLP4 1856
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+ADDRLP4 1856
+INDIRI4
+EQI4 $787
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 1856
+INDIRI4
+EQI4 $782
+LABELV $787
+ADDRGP4 level+9236
+INDIRI4
+ADDRGP4 level+9240
+INDIRI4
+NEI4 $788
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+LEI4 $788
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $792
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_lms_mode+12
+INDIRI4
+CNSTI4 2
+EQI4 $800
+ADDRGP4 g_lms_mode+12
+INDIRI4
+CNSTI4 3
+NEI4 $794
+LABELV $800
+ADDRGP4 level+9236
+INDIRI4
+ADDRGP4 level+9240
+INDIRI4
+NEI4 $794
+ADDRGP4 LMSpoint
+CALLV
+pop
+LABELV $794
+ADDRGP4 $777
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $792
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $788
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $802
+ADDRLP4 1860
+ADDRLP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+ASGNP4
+ADDRLP4 1860
+INDIRP4
+ADDRLP4 1860
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $802
+LABELV $782
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $810
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $809
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $804
+LABELV $809
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $810
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $804
+LABELV $810
+ADDRLP4 188
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1864
+ADDRGP4 SelectSpectatorSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1844
+ADDRLP4 1864
+INDIRP4
+ASGNP4
+ADDRGP4 $805
+JUMPV
+LABELV $804
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 11
+NEI4 $811
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1864
+ADDRGP4 SelectDoubleDominationSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1844
+ADDRLP4 1864
+INDIRP4
+ASGNP4
+ADDRGP4 $812
+JUMPV
+LABELV $811
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+NEI4 $814
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1864
+ADDRGP4 SelectDominationSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1844
+ADDRLP4 1864
+INDIRP4
+ASGNP4
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+LTI4 $817
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+NEI4 $817
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1868
+ADDRGP4 SelectCTFSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1844
+ADDRLP4 1868
+INDIRP4
+ASGNP4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $820
+ADDRLP4 1864
+CNSTI4 8192
+ASGNI4
+ADDRGP4 $821
+JUMPV
+LABELV $820
+ADDRLP4 1864
+CNSTI4 16384
+ASGNI4
+LABELV $821
+ADDRLP4 1872
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ADDRLP4 1872
+INDIRI4
+NEI4 $822
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRLP4 1872
+INDIRI4
+EQI4 $822
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1864
+INDIRI4
+ARGI4
+ADDRLP4 1876
+ADDRGP4 SelectInitialSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1844
+ADDRLP4 1876
+INDIRP4
+ASGNP4
+ADDRGP4 $823
+JUMPV
+LABELV $822
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1864
+INDIRI4
+ARGI4
+ADDRLP4 1876
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 1844
+ADDRLP4 1876
+INDIRP4
+ASGNP4
+LABELV $823
+LABELV $818
+LABELV $815
+LABELV $812
+LABELV $805
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1864
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1864
+INDIRP4
+ADDRLP4 1864
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 540676
+BANDI4
+ASGNI4
+ADDRLP4 200
+ADDRLP4 200
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_ResetHistory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 2012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1240
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRB
+ASGNB 556
+ADDRLP4 1796
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRB
+ASGNB 28
+ADDRLP4 1824
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1836
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1828
+ADDRLP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1832
+ADDRLP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2028
+ADDP4
+ARGP4
+CNSTI4 112
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 1840
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+ADDRLP4 1240
+INDIRB
+ASGNB 556
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+ADDRLP4 1796
+INDIRB
+ASGNB 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ADDRLP4 1824
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1252
+ADDP4
+ADDRLP4 1836
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1120
+ADDP4
+ADDRLP4 1828
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1116
+ADDP4
+ADDRLP4 1832
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2028
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 112
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 1124
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 1840
+INDIRI4
+ASGNI4
+ADDRLP4 1880
+ADDRLP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ASGNP4
+ADDRLP4 1880
+INDIRP4
+ADDRLP4 1880
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1152
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 204
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 204
+ARGP4
+ADDRGP4 $559
+ARGP4
+ADDRLP4 1888
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1888
+INDIRP4
+ARGP4
+ADDRLP4 1892
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 1892
+INDIRI4
+ASGNI4
+ADDRLP4 1896
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1896
+INDIRI4
+CNSTI4 1
+LTI4 $827
+ADDRLP4 1896
+INDIRI4
+CNSTI4 100
+LEI4 $825
+LABELV $827
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $825
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 2140
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $828
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 33619969
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 player_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 playerMins
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRGP4 playerMaxs
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $829
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $829
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $829
+ADDRGP4 g_elimination_allgametypes+12
+INDIRI4
+CNSTI4 0
+NEI4 $829
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $835
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $836
+JUMPV
+LABELV $835
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $836
+ADDRLP4 1904
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1904
+INDIRP4
+ADDRLP4 1904
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 1912
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1912
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 1912
+INDIRI4
+ASGNI4
+ADDRGP4 $830
+JUMPV
+LABELV $829
+ADDRLP4 1904
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1904
+INDIRP4
+ADDRLP4 1904
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 g_elimination_machinegun+12
+INDIRI4
+CNSTI4 0
+LEI4 $838
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ADDRGP4 g_elimination_machinegun+12
+INDIRI4
+ASGNI4
+LABELV $838
+ADDRGP4 g_elimination_shotgun+12
+INDIRI4
+CNSTI4 0
+LEI4 $842
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+ADDRGP4 g_elimination_shotgun+12
+INDIRI4
+ASGNI4
+LABELV $842
+ADDRGP4 g_elimination_grenade+12
+INDIRI4
+CNSTI4 0
+LEI4 $846
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 392
+ADDP4
+ADDRGP4 g_elimination_grenade+12
+INDIRI4
+ASGNI4
+LABELV $846
+ADDRGP4 g_elimination_rocket+12
+INDIRI4
+CNSTI4 0
+LEI4 $850
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 396
+ADDP4
+ADDRGP4 g_elimination_rocket+12
+INDIRI4
+ASGNI4
+LABELV $850
+ADDRGP4 g_elimination_lightning+12
+INDIRI4
+CNSTI4 0
+LEI4 $854
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 400
+ADDP4
+ADDRGP4 g_elimination_lightning+12
+INDIRI4
+ASGNI4
+LABELV $854
+ADDRGP4 g_elimination_railgun+12
+INDIRI4
+CNSTI4 0
+LEI4 $858
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+ADDRGP4 g_elimination_railgun+12
+INDIRI4
+ASGNI4
+LABELV $858
+ADDRGP4 g_elimination_plasmagun+12
+INDIRI4
+CNSTI4 0
+LEI4 $862
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+ADDRGP4 g_elimination_plasmagun+12
+INDIRI4
+ASGNI4
+LABELV $862
+ADDRGP4 g_elimination_bfg+12
+INDIRI4
+CNSTI4 0
+LEI4 $866
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+ADDRGP4 g_elimination_bfg+12
+INDIRI4
+ASGNI4
+LABELV $866
+ADDRGP4 g_elimination_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $870
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $870
+ADDRGP4 g_elimination_nail+12
+INDIRI4
+CNSTI4 0
+LEI4 $873
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDRGP4 g_elimination_nail+12
+INDIRI4
+ASGNI4
+LABELV $873
+ADDRGP4 g_elimination_mine+12
+INDIRI4
+CNSTI4 0
+LEI4 $877
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ADDRGP4 g_elimination_mine+12
+INDIRI4
+ASGNI4
+LABELV $877
+ADDRGP4 g_elimination_chain+12
+INDIRI4
+CNSTI4 0
+LEI4 $881
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRGP4 g_elimination_chain+12
+INDIRI4
+ASGNI4
+LABELV $881
+ADDRLP4 1908
+ADDRGP4 g_elimination_startArmor+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 1908
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 1908
+INDIRI4
+ASGNI4
+ADDRLP4 1912
+ADDRGP4 g_elimination_startHealth+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1912
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 1912
+INDIRI4
+ASGNI4
+LABELV $830
+ADDRGP4 g_instantgib+12
+INDIRI4
+CNSTI4 0
+EQI4 $887
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+CNSTI4 999
+ASGNI4
+ADDRGP4 g_instantgib+12
+INDIRI4
+CNSTI4 1
+LEI4 $890
+ADDRLP4 1904
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1904
+INDIRP4
+ADDRLP4 1904
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $890
+LABELV $887
+ADDRGP4 g_rockets+12
+INDIRI4
+CNSTI4 0
+EQI4 $893
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 396
+ADDP4
+CNSTI4 999
+ASGNI4
+LABELV $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 188
+INDIRB
+ASGNB 12
+ADDRLP4 1904
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1904
+INDIRP4
+ADDRLP4 1904
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $902
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $902
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $896
+LABELV $902
+ADDRLP4 1908
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1908
+INDIRP4
+ADDRLP4 1908
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $896
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 2140
+DIVI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1228
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $911
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $909
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $903
+LABELV $909
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $911
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $911
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $903
+LABELV $911
+ADDRGP4 $904
+JUMPV
+LABELV $903
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_KillBox
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $904
+ADDRLP4 1916
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1916
+INDIRP4
+ADDRLP4 1916
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1136
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1140
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 22
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRLP4 1844
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 13
+ASGNI4
+LABELV $918
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $922
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $922
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $920
+JUMPV
+LABELV $922
+LABELV $919
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $918
+LABELV $920
+LABELV $916
+ADDRLP4 0
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $934
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $932
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $926
+LABELV $932
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $934
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $934
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $926
+LABELV $934
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $926
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRGP4 g_spawnprotect+12
+INDIRI4
+CNSTI4 0
+EQI4 $935
+ADDRLP4 0
+INDIRP4
+CNSTI4 2024
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $935
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 RespawnTimeMessage
+CALLV
+pop
+LABELV $755
+endproc ClientSpawn 1928 20
+export ClientDisconnect
+proc ClientDisconnect 1516 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_RemoveQueuedBotBegin
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 816
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $939
+ADDRGP4 $938
+JUMPV
+LABELV $939
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientLeaving
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 G_admin_namelog_update
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $944
+JUMPV
+LABELV $941
+ADDRLP4 1032
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $948
+ADDRLP4 1032
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $946
+LABELV $948
+ADDRLP4 1036
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $946
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $946
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $946
+LABELV $942
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $944
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $941
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $950
+ADDRLP4 1032
+CNSTI4 1
+ASGNI4
+ADDRGP4 $951
+JUMPV
+LABELV $950
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+LABELV $951
+ADDRLP4 0
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $952
+ADDRLP4 1036
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $952
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $954
+ADDRLP4 1040
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $954
+ADDRLP4 1044
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 g_entities+833952
+ARGP4
+CNSTI4 100000
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRGP4 player_die
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $959
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+LABELV $959
+LABELV $952
+ADDRLP4 1040
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $963
+ADDRLP4 1040
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $963
+ADDRLP4 8
+ARGP4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 1512
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1512
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+INDIRB
+ASGNB 468
+ADDRLP4 1044
+ARGP4
+ADDRGP4 PlayerStore_store
+CALLV
+pop
+LABELV $963
+ADDRGP4 $965
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $966
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+NEI4 $966
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+NEI4 $966
+ADDRGP4 level+84+4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $966
+ADDRLP4 1048
+CNSTI4 2140
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1040
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+84
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $966
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $975
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+NEI4 $975
+ADDRGP4 level+9144
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+EQI4 $975
+CNSTI4 2
+ARGI4
+ADDRGP4 $979
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9148
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9144
+CNSTI4 0
+ASGNI4
+LABELV $975
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $983
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 260
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRGP4 $984
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRGP4 CountVotes
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $985
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $985
+LABELV $938
+endproc ClientDisconnect 1516 20
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import CalculateRanks
+import AddScore
+import player_die
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import EndEliminationRound
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $984
+byte 1 0
+align 1
+LABELV $983
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $979
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $965
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $828
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $777
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 34
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $749
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $748
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $711
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $689
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 0
+align 1
+LABELV $687
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $686
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 79
+byte 1 78
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $679
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $676
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $675
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $661
+byte 1 71
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $660
+byte 1 68
+byte 1 117
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 0
+align 1
+LABELV $659
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 34
+byte 1 0
+align 1
+LABELV $647
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 71
+byte 1 85
+byte 1 73
+byte 1 68
+byte 1 0
+align 1
+LABELV $635
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $633
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $628
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $625
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $622
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $621
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $616
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $615
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 105
+byte 1 100
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $614
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 116
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $613
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $612
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $609
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $608
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $607
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $606
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $593
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $589
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $584
+byte 1 98
+byte 1 0
+align 1
+LABELV $583
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $579
+byte 1 114
+byte 1 0
+align 1
+LABELV $578
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $575
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $569
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $568
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $567
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $566
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $559
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $556
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $551
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $536
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $531
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $528
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $524
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $518
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 100
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $511
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $510
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $507
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $504
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $503
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $500
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $499
+byte 1 92
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 92
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $495
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $442
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 33
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $422
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $264
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $249
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $245
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $244
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $172
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $136
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 65
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 34
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $69
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $65
+byte 1 110
+byte 1 111
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $62
+byte 1 48
+byte 1 0
+align 1
+LABELV $61
+byte 1 110
+byte 1 111
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
@@ -0,0 +1,9151 @@
+export ScorePlum
+code
+proc ScorePlum 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 65
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $60
+endproc ScorePlum 12 8
+export AddScore
+proc AddScore 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $62
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $64
+ADDRGP4 $61
+JUMPV
+LABELV $64
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $67
+ADDRGP4 $61
+JUMPV
+LABELV $67
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 level+76
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $70
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $70
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $74
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+NEI4 $70
+LABELV $74
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $75
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $80
+ADDRGP4 $76
+JUMPV
+LABELV $80
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $82
+ADDRGP4 $76
+JUMPV
+LABELV $82
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $84
+ADDRGP4 $76
+JUMPV
+LABELV $84
+ADDRLP4 8
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+NEGI4
+ARGI4
+ADDRGP4 ScorePlum
+CALLV
+pop
+LABELV $76
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $78
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $75
+ADDRGP4 $71
+JUMPV
+LABELV $70
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ScorePlum
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $86
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $90
+ARGP4
+ADDRLP4 20
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $86
+LABELV $71
+ADDRGP4 $93
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $61
+endproc AddScore 28 20
+export TossClientItems
+proc TossClientItems 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $99
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $95
+LABELV $99
+ADDRGP4 $94
+JUMPV
+LABELV $95
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $102
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+NEI4 $100
+LABELV $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $103
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $105
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $105
+LABELV $100
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_instantgib+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $115
+ADDRGP4 g_rockets+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $115
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $115
+ADDRGP4 g_elimination_allgametypes+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $107
+LABELV $115
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $116
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $116
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 BG_FindItemForWeapon
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Drop_Item
+CALLP4
+pop
+LABELV $116
+LABELV $108
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $118
+ADDRLP4 16
+CNSTF4 1110704128
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $121
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $125
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $128
+ADDRGP4 $122
+JUMPV
+LABELV $128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $131
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $131
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+LABELV $125
+LABELV $122
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $121
+LABELV $118
+LABELV $94
+endproc TossClientItems 44 12
+export TossClientCubes
+proc TossClientCubes 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 G_EntitiesFree
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRGP4 $133
+JUMPV
+LABELV $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $136
+ADDRGP4 $138
+ARGP4
+ADDRLP4 48
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRGP4 $139
+ARGP4
+ADDRLP4 48
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+LABELV $137
+ADDRLP4 16+4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 56
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 0
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1125515264
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1128792064
+ADDF4
+ADDF4
+ASGNF4
+ADDRGP4 neutralObelisk
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $148
+ADDRLP4 28
+ADDRGP4 neutralObelisk
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1110441984
+ADDF4
+ASGNF4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+LABELV $149
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 LaunchItem
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_cubeTimeout+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 G_FreeEntity
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $133
+endproc TossClientCubes 68 16
+export TossClientPersistantPowerups
+proc TossClientPersistantPowerups 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $156
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $158
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1176
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1176
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $155
+endproc TossClientPersistantPowerups 12 4
+export LookAtKiller
+proc LookAtKiller 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTU4 0
+EQU4 $161
+ADDRLP4 12
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $161
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 28
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 32
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+CNSTU4 0
+EQU4 $165
+ADDRLP4 16
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $165
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 28
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 32
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $166
+LABELV $162
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ADDRGP4 vectoyaw
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vectoyaw
+CALLF4
+pop
+LABELV $160
+endproc LookAtKiller 40 4
+export GibEntity
+proc GibEntity 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $170
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $172
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $176
+ADDRGP4 $173
+JUMPV
+LABELV $176
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $178
+ADDRGP4 $173
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $180
+ADDRGP4 $173
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $172
+LABELV $174
+LABELV $170
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $169
+endproc GibEntity 12 12
+export body_die
+proc body_die 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+LEI4 $184
+ADDRGP4 $183
+JUMPV
+LABELV $184
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -39
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $186
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+LABELV $183
+endproc body_die 0 8
+data
+align 4
+LABELV modNames
+address $189
+address $190
+address $191
+address $192
+address $193
+address $194
+address $195
+address $196
+address $197
+address $198
+address $199
+address $200
+address $201
+address $202
+address $203
+address $204
+address $205
+address $206
+address $207
+address $208
+address $209
+address $210
+address $211
+address $212
+address $213
+address $214
+address $215
+address $216
+address $217
+export Kamikaze_DeathActivate
+code
+proc Kamikaze_DeathActivate 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_StartKamikaze
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $218
+endproc Kamikaze_DeathActivate 0 4
+export Kamikaze_DeathTimer
+proc Kamikaze_DeathTimer 16 0
+ADDRLP4 4
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $182
+ASGNP4
+ADDRLP4 8
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 Kamikaze_DeathActivate
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $219
+endproc Kamikaze_DeathTimer 16 0
+export CheckAlmostCapture
+proc CheckAlmostCapture 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $225
+ADDRLP4 20
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $225
+ADDRLP4 20
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $222
+LABELV $225
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $230
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $226
+LABELV $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $231
+ADDRLP4 4
+ADDRGP4 $233
+ASGNP4
+ADDRGP4 $227
+JUMPV
+LABELV $231
+ADDRLP4 4
+ADDRGP4 $234
+ASGNP4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $235
+ADDRLP4 4
+ADDRGP4 $234
+ASGNP4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 4
+ADDRGP4 $233
+ASGNP4
+LABELV $236
+LABELV $227
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $237
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $238
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $240
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $237
+LABELV $240
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $241
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $241
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1128792064
+GEF4 $245
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $247
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $247
+LABELV $245
+LABELV $241
+LABELV $222
+LABELV $221
+endproc CheckAlmostCapture 56 12
+export CheckAlmostScored
+proc CheckAlmostScored 44 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $252
+ADDRLP4 16
+ADDRGP4 $254
+ASGNP4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 16
+ADDRGP4 $255
+ASGNP4
+LABELV $253
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $256
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1128792064
+GEF4 $260
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $262
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $262
+LABELV $260
+LABELV $256
+LABELV $250
+LABELV $249
+endproc CheckAlmostScored 44 12
+bss
+align 4
+LABELV $461
+skip 4
+export player_die
+code
+proc player_die 120 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $267
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $265
+LABELV $267
+ADDRGP4 $264
+JUMPV
+LABELV $265
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $268
+ADDRGP4 $264
+JUMPV
+LABELV $268
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UnTimeShiftClient
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunStreakLogic
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostCapture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostScored
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $271
+ADDRGP4 $264
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $275
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 G_FreeEntity
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $278
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $280
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $279
+JUMPV
+LABELV $280
+ADDRLP4 12
+ADDRGP4 $282
+ASGNP4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $283
+ASGNP4
+LABELV $279
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $286
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $284
+LABELV $286
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $283
+ASGNP4
+LABELV $284
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $289
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 29
+LTU4 $287
+LABELV $289
+ADDRLP4 20
+ADDRGP4 $290
+ASGNP4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 20
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modNames
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $288
+ADDRGP4 $291
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 60
+ARGI4
+ADDRLP4 52
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $299
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $298
+LABELV $299
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+LTI4 $292
+LABELV $298
+ADDRLP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $300
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $300
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1124
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $302
+LABELV $304
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $301
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $301
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $314
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $313
+LABELV $314
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+LTI4 $301
+LABELV $313
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $321
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $319
+LABELV $321
+ADDRGP4 level+76
+INDIRI4
+CNSTI4 3
+GEI4 $301
+LABELV $319
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $301
+JUMPV
+LABELV $302
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $322
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $322
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $322
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $326
+ADDRLP4 84
+CNSTI4 424
+ASGNI4
+ADDRLP4 88
+CNSTI4 8
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+BANDI4
+ADDRLP4 92
+INDIRI4
+NEI4 $328
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+BANDI4
+ADDRLP4 92
+INDIRI4
+NEI4 $328
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 201
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $328
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $330
+ARGP4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $326
+ADDRLP4 88
+CNSTI4 424
+ASGNI4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+BANDI4
+ADDRLP4 96
+INDIRI4
+NEI4 $333
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+BANDI4
+ADDRLP4 96
+INDIRI4
+NEI4 $333
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $333
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $335
+ADDRFP4 16
+INDIRI4
+CNSTI4 28
+GTI4 $335
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $356-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $356
+address $339
+address $337
+address $338
+address $340
+address $340
+address $341
+address $341
+address $343
+address $343
+address $344
+address $342
+address $348
+address $348
+address $335
+address $353
+address $353
+address $354
+address $355
+address $353
+address $335
+address $335
+address $353
+address $349
+address $350
+address $351
+address $335
+address $335
+address $352
+code
+LABELV $337
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 201
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $338
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 202
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $339
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 203
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $340
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 204
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $341
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 205
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $342
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 206
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $343
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 207
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $344
+ADDRGP4 g_instantgib+12
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 215
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $345
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 208
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $348
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 209
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $349
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 212
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $350
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 211
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $351
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 213
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $352
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 210
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $353
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 214
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $354
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 217
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $355
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 216
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $335
+LABELV $336
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $358
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 401
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 406
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $360
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $362
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 402
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 407
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $364
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 328
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 404
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 328
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $368
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 409
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $368
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 403
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $372
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 408
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 410
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $376
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 411
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $376
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $378
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 412
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $378
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LEI4 $380
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 405
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $380
+LABELV $333
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $382
+ADDRGP4 g_altExcellent+12
+INDIRI4
+CNSTI4 0
+EQI4 $385
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 908
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_checkForMultiKill
+CALLV
+pop
+LABELV $385
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 288
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $330
+ARGP4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 108
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $388
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 302
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $389
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $383
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1156
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $394
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $394
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $403
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $402
+LABELV $403
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+LTI4 $394
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $407
+ADDRGP4 level+76
+INDIRI4
+CNSTI4 3
+GEI4 $404
+LABELV $407
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $404
+LABELV $394
+LABELV $301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_FragBonuses
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $410
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $412
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $414
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $414
+LABELV $413
+LABELV $411
+LABELV $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientPersistantPowerups
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientCubes
+CALLV
+pop
+LABELV $416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $419
+ADDRLP4 72
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $424
+ADDRGP4 $420
+JUMPV
+LABELV $424
+ADDRLP4 72
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $426
+ADDRGP4 $420
+JUMPV
+LABELV $426
+ADDRLP4 72
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $428
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+LABELV $428
+LABELV $420
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 LookAtKiller
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1136
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1700
+ADDI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 g_respawntime+12
+INDIRI4
+CNSTI4 0
+LEI4 $431
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $437
+JUMPV
+LABELV $434
+LABELV $435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1136
+ADDP4
+INDIRI4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_respawntime+12
+INDIRI4
+MULI4
+MULI4
+GTI4 $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1136
+ADDP4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_respawntime+12
+INDIRI4
+MULI4
+MULI4
+ASGNI4
+LABELV $431
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $446
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $446
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $440
+LABELV $446
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+GTI4 $447
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_elimination_activewarmup+12
+INDIRI4
+MULI4
+SUBI4
+LEI4 $447
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1136
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 800
+MODI4
+ADDI4
+ASGNI4
+LABELV $447
+LABELV $440
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1136
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 RespawnTimeMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $460
+ADDRLP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+NEU4 $460
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $458
+LABELV $460
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $455
+LABELV $458
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRLP4 84
+ADDRGP4 $461
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $464
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+EQI4 $465
+ADDRLP4 84
+INDIRI4
+CNSTI4 2
+EQI4 $466
+ADDRGP4 $462
+JUMPV
+LABELV $464
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $465
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $466
+LABELV $462
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -39
+ASGNI4
+LABELV $467
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 92
+CNSTI4 128
+ASGNI4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+BANDI4
+ADDRLP4 92
+INDIRI4
+BXORI4
+ADDRLP4 24
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 100
+CNSTI4 128
+ASGNI4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+BANDI4
+ADDRLP4 100
+INDIRI4
+BXORI4
+ADDRLP4 24
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $461
+INDIRI4
+CNSTI4 57
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRLP4 104
+ADDRGP4 $461
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 3
+MODI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $469
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Kamikaze_DeathTimer
+CALLV
+pop
+LABELV $469
+LABELV $456
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $264
+endproc player_die 120 28
+export CheckArmor
+proc CheckArmor 20 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $472
+CNSTI4 0
+RETI4
+ADDRGP4 $471
+JUMPV
+LABELV $472
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $474
+CNSTI4 0
+RETI4
+ADDRGP4 $471
+JUMPV
+LABELV $474
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $476
+CNSTI4 0
+RETI4
+ADDRGP4 $471
+JUMPV
+LABELV $476
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1059648963
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $478
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $478
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $480
+CNSTI4 0
+RETI4
+ADDRGP4 $471
+JUMPV
+LABELV $480
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $471
+endproc CheckArmor 20 4
+export RaySphereIntersections
+proc RaySphereIntersections 96 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $483
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 2
+RETI4
+ADDRGP4 $482
+JUMPV
+LABELV $483
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $485
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $482
+JUMPV
+LABELV $485
+CNSTI4 0
+RETI4
+LABELV $482
+endproc RaySphereIntersections 96 4
+export G_InvulnerabilityEffect
+proc G_InvulnerabilityEffect 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $488
+CNSTI4 0
+RETI4
+ADDRGP4 $487
+JUMPV
+LABELV $488
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTF4 1109917696
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ADDRGP4 RaySphereIntersections
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 71
+ARGI4
+ADDRLP4 48
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $496
+ADDRLP4 60
+ADDRLP4 36
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $496
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $498
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $500
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $500
+CNSTI4 1
+RETI4
+ADDRGP4 $487
+JUMPV
+LABELV $490
+CNSTI4 0
+RETI4
+LABELV $487
+endproc G_InvulnerabilityEffect 64 20
+proc catchup_damage 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_catchup+12
+INDIRI4
+CNSTI4 0
+GTI4 $503
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $503
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 5
+ADDI4
+GTI4 $506
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $506
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+SUBI4
+CNSTI4 5
+SUBI4
+ADDRGP4 g_catchup+12
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+MULI4
+CNSTI4 100
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+GEI4 $509
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+RETI4
+ADDRGP4 $502
+JUMPV
+LABELV $509
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $502
+endproc catchup_damage 8 0
+export G_Damage
+proc G_Damage 148 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRGP4 $511
+JUMPV
+LABELV $512
+ADDRGP4 level+9140
+INDIRI4
+CNSTI4 0
+EQI4 $514
+ADDRGP4 $511
+JUMPV
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $517
+ADDRFP4 28
+INDIRI4
+CNSTI4 27
+EQI4 $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1240
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $519
+ADDRLP4 44
+CNSTU4 0
+ASGNU4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $511
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $511
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 G_InvulnerabilityEffect
+CALLI4
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $519
+LABELV $517
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $524
+ADDRFP4 4
+ADDRGP4 g_entities+833952
+ASGNP4
+LABELV $524
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $527
+ADDRFP4 8
+ADDRGP4 g_entities+833952
+ASGNP4
+LABELV $527
+ADDRLP4 48
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 48
+INDIRU4
+ADDRGP4 g_entities+833952
+CVPU4 4
+EQU4 $534
+ADDRLP4 48
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $534
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $530
+LABELV $534
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $530
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $530
+ADDRFP4 28
+INDIRI4
+CNSTI4 19
+EQI4 $538
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+EQI4 $538
+ADDRFP4 28
+INDIRI4
+CNSTI4 15
+EQI4 $538
+ADDRFP4 28
+INDIRI4
+CNSTI4 22
+EQI4 $538
+ADDRFP4 28
+INDIRI4
+CNSTI4 20
+NEI4 $530
+LABELV $538
+ADDRLP4 0
+INDIRP4
+CNSTI4 1260
+ADDP4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $539
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRFP4 8
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+LABELV $540
+LABELV $530
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $511
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $511
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $542
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CheckObeliskAttack
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRGP4 $511
+JUMPV
+LABELV $546
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $549
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $549
+ADDRLP4 72
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 72
+INDIRP4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRLP4 72
+INDIRP4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $551
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $551
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+LABELV $549
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $554
+ADDRLP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $556
+ADDRGP4 $511
+JUMPV
+LABELV $556
+LABELV $554
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $558
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $559
+ADDRLP4 8
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 200
+LEI4 $560
+ADDRLP4 8
+CNSTI4 200
+ASGNI4
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $562
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $562
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $564
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $566
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $566
+ADDRLP4 84
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 92
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 96
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ADDRLP4 96
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 72+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 84
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $575
+ADDRLP4 112
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 50
+GEI4 $577
+ADDRLP4 112
+CNSTI4 50
+ASGNI4
+LABELV $577
+ADDRLP4 112
+INDIRI4
+CNSTI4 200
+LEI4 $579
+ADDRLP4 112
+CNSTI4 200
+ASGNI4
+LABELV $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $575
+ADDRGP4 g_awardpushing+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $581
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1256
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1256
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1260
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $582
+LABELV $566
+ADDRFP4 24
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $587
+ADDRFP4 28
+INDIRI4
+CNSTI4 27
+EQI4 $589
+ADDRFP4 28
+INDIRI4
+CNSTI4 17
+EQI4 $589
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $589
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $589
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+NEI4 $601
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $601
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $602
+LABELV $601
+ADDRGP4 g_elimination_selfdamage+12
+INDIRI4
+CNSTI4 2
+GEI4 $591
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $602
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $591
+LABELV $602
+ADDRGP4 $511
+JUMPV
+LABELV $591
+LABELV $589
+ADDRFP4 28
+INDIRI4
+CNSTI4 25
+NEI4 $603
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTU4 0
+ASGNU4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+ADDRLP4 92
+INDIRU4
+EQU4 $605
+ADDRLP4 96
+ADDRLP4 88
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+ADDRLP4 92
+INDIRU4
+EQU4 $605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRGP4 $511
+JUMPV
+LABELV $605
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $607
+ADDRGP4 $511
+JUMPV
+LABELV $607
+LABELV $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $609
+ADDRGP4 $511
+JUMPV
+LABELV $609
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $611
+ADDRLP4 88
+INDIRP4
+CNSTI4 2024
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1136
+ADDP4
+INDIRI4
+ADDRGP4 g_spawnprotect+12
+INDIRI4
+ADDI4
+LEI4 $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 2024
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+LEI4 $620
+ADDRFP4 28
+INDIRI4
+CNSTI4 14
+LTI4 $621
+LABELV $620
+ADDRFP4 28
+INDIRI4
+CNSTI4 18
+EQI4 $621
+ADDRFP4 28
+INDIRI4
+CNSTI4 22
+LEI4 $617
+LABELV $621
+ADDRGP4 $511
+JUMPV
+LABELV $617
+LABELV $614
+LABELV $611
+LABELV $587
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $622
+ADDRLP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $622
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 62
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $626
+ADDRFP4 28
+INDIRI4
+CNSTI4 19
+NEI4 $624
+LABELV $626
+ADDRGP4 $511
+JUMPV
+LABELV $624
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $622
+ADDRLP4 80
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 80
+INDIRU4
+EQU4 $627
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 80
+INDIRU4
+EQU4 $627
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $627
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $627
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 3
+EQI4 $627
+ADDRLP4 92
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $627
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $629
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $630
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+LABELV $627
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $631
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $631
+ADDRLP4 100
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+EQU4 $633
+ADDRLP4 104
+CNSTI4 516
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+EQU4 $633
+ADDRFP4 8
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+EQU4 $633
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 516
+ASGNI4
+ADDRLP4 112
+CNSTI4 248
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 catchup_damage
+CALLI4
+ASGNI4
+ADDRFP4 20
+ADDRLP4 116
+INDIRI4
+ASGNI4
+LABELV $633
+ADDRGP4 g_damageModifier+8
+INDIRF4
+CNSTF4 1008981770
+LEF4 $635
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRGP4 g_damageModifier+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $635
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+GEI4 $639
+ADDRFP4 20
+CNSTI4 1
+ASGNI4
+LABELV $639
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $641
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $641
+ADDRFP4 20
+CNSTI4 0
+ASGNI4
+LABELV $641
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $653
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $653
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $653
+ADDRGP4 g_elimination_allgametypes+12
+INDIRI4
+CNSTI4 0
+EQI4 $644
+LABELV $653
+ADDRGP4 g_elimination_selfdamage+12
+INDIRI4
+CNSTI4 1
+GEI4 $644
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $654
+ADDRFP4 28
+INDIRI4
+CNSTI4 19
+NEI4 $644
+LABELV $654
+ADDRFP4 20
+CNSTI4 0
+ASGNI4
+LABELV $644
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $663
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $663
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $655
+LABELV $663
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+GEI4 $655
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+EQI4 $664
+ADDRFP4 28
+INDIRI4
+CNSTI4 15
+NEI4 $655
+LABELV $664
+ADDRFP4 20
+CNSTI4 1000
+ASGNI4
+LABELV $655
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CheckArmor
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 g_debugDamage+12
+INDIRI4
+CNSTI4 0
+EQI4 $665
+ADDRGP4 $668
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $665
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $670
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $672
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRI4
+CNSTI4 -1
+LEI4 $674
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1256
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+CNSTI4 1022
+ASGNI4
+LABELV $675
+LABELV $673
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $676
+ADDRLP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1108
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $677
+LABELV $670
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $684
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+EQI4 $684
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $678
+LABELV $684
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_CheckHurtCarrier
+CALLV
+pop
+LABELV $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1128
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1132
+ADDP4
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $685
+ADDRGP4 g_vampire+8
+INDIRF4
+CNSTF4 0
+LEF4 $687
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $687
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $687
+ADDRLP4 132
+CNSTI4 732
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LEI4 $687
+ADDRFP4 0
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LEI4 $687
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+GEI4 $690
+ADDRLP4 136
+ADDRFP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 g_vampire+8
+INDIRF4
+MULF4
+CVFI4 4
+ADDI4
+ASGNI4
+ADDRGP4 $691
+JUMPV
+LABELV $690
+ADDRLP4 136
+CNSTI4 732
+ASGNI4
+ADDRLP4 140
+ADDRFP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 g_vampire+8
+INDIRF4
+MULF4
+CVFI4 4
+ADDI4
+ASGNI4
+LABELV $691
+ADDRFP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRGP4 g_vampireMaxHealth+12
+INDIRI4
+LEI4 $694
+ADDRFP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 g_vampireMaxHealth+12
+INDIRI4
+ASGNI4
+LABELV $694
+LABELV $687
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $702
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $704
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -999
+GEI4 $706
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -999
+ASGNI4
+LABELV $706
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $702
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $708
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $708
+LABELV $698
+LABELV $511
+endproc G_Damage 148 24
+export CanDamage
+proc CanDamage 128 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1056964608
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $721
+ADDRLP4 24+52
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $717
+LABELV $721
+CNSTI4 1
+RETI4
+ADDRGP4 $710
+JUMPV
+LABELV $717
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 96
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $723
+CNSTI4 1
+RETI4
+ADDRGP4 $710
+JUMPV
+LABELV $723
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 104
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $727
+CNSTI4 1
+RETI4
+ADDRGP4 $710
+JUMPV
+LABELV $727
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 112
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $731
+CNSTI4 1
+RETI4
+ADDRGP4 $710
+JUMPV
+LABELV $731
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 120
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $735
+CNSTI4 1
+RETI4
+ADDRGP4 $710
+JUMPV
+LABELV $735
+CNSTI4 0
+RETI4
+LABELV $710
+endproc CanDamage 128 28
+export G_RadiusDamage
+proc G_RadiusDamage 4196 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4168
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $739
+ADDRFP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $739
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $741
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4144
+ADDP4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4156
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $742
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $741
+ADDRLP4 4144
+ARGP4
+ADDRLP4 4156
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4172
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4140
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $748
+JUMPV
+LABELV $745
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+NEU4 $749
+ADDRGP4 $746
+JUMPV
+LABELV $749
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRGP4 $746
+JUMPV
+LABELV $751
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $753
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $757
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $758
+JUMPV
+LABELV $757
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $759
+ADDRLP4 4184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4184
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4184
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $760
+JUMPV
+LABELV $759
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $760
+LABELV $758
+LABELV $754
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $753
+ADDRLP4 8
+ARGP4
+ADDRLP4 4176
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4176
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LTF4 $761
+ADDRGP4 $746
+JUMPV
+LABELV $761
+ADDRLP4 40
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4180
+ADDRGP4 CanDamage
+CALLI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+CNSTI4 0
+EQI4 $763
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4184
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 4184
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRLP4 4168
+CNSTI4 1
+ASGNI4
+LABELV $765
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $763
+LABELV $746
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $748
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4140
+INDIRI4
+LTI4 $745
+ADDRLP4 4168
+INDIRI4
+RETI4
+LABELV $738
+endproc G_RadiusDamage 4196 32
+export monster_die
+proc monster_die 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $771
+ADDRLP4 8
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $771
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1164
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $771
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $773
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $773
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 G_FreeEntity
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $773
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 LookAtKiller
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $781
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+NEU4 $781
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $779
+LABELV $781
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $776
+LABELV $779
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -39
+ASGNI4
+LABELV $782
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+LABELV $777
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $770
+endproc monster_die 28 12
+import neutralObelisk
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $668
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $388
+byte 1 69
+byte 1 88
+byte 1 67
+byte 1 69
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $331
+byte 1 71
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $330
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $291
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $290
+byte 1 60
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 62
+byte 1 0
+align 1
+LABELV $283
+byte 1 60
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 62
+byte 1 0
+align 1
+LABELV $282
+byte 1 60
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 0
+align 1
+LABELV $255
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $254
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $234
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $233
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $217
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 0
+align 1
+LABELV $216
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $215
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 0
+align 1
+LABELV $214
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $213
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $212
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 78
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 0
+align 1
+LABELV $211
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 72
+byte 1 85
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $210
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $209
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $208
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $207
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 70
+byte 1 82
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $206
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 82
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $205
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 86
+byte 1 65
+byte 1 0
+align 1
+LABELV $204
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $203
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $202
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $201
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $200
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $199
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $198
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 77
+byte 1 65
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $197
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 77
+byte 1 65
+byte 1 0
+align 1
+LABELV $196
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $195
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $194
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $193
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $192
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 67
+byte 1 72
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $191
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $190
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $189
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $182
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $139
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $138
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $93
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $90
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
@@ -0,0 +1,15420 @@
+data
+align 4
+LABELV gameCvarTable
+address g_cheats
+address $61
+address $62
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $63
+address $64
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $65
+address $66
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_restarted
+address $67
+address $68
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_gametype
+address $69
+address $68
+byte 4 38
+byte 4 0
+byte 4 0
+skip 4
+address g_maxclients
+address $70
+address $71
+byte 4 37
+byte 4 0
+byte 4 0
+skip 4
+address g_maxGameClients
+address $72
+address $68
+byte 4 37
+byte 4 0
+byte 4 0
+skip 4
+address g_dmflags
+address $73
+address $68
+byte 4 5
+byte 4 0
+byte 4 1
+skip 4
+address g_videoflags
+address $74
+address $75
+byte 4 5
+byte 4 0
+byte 4 1
+skip 4
+address g_elimflags
+address $76
+address $68
+byte 4 4
+byte 4 0
+byte 4 0
+skip 4
+address g_voteflags
+address $77
+address $68
+byte 4 4
+byte 4 0
+byte 4 0
+skip 4
+address g_fraglimit
+address $78
+address $79
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_timelimit
+address $80
+address $68
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_capturelimit
+address $81
+address $71
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_synchronousClients
+address $82
+address $68
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address g_friendlyFire
+address $83
+address $68
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_teamAutoJoin
+address $84
+address $68
+byte 4 1
+skip 12
+address g_teamForceBalance
+address $85
+address $68
+byte 4 1
+skip 12
+address g_warmup
+address $86
+address $79
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_doWarmup
+address $87
+address $68
+byte 4 5
+byte 4 0
+byte 4 1
+skip 4
+address g_logfile
+address $88
+address $89
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_logfileSync
+address $90
+address $68
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_password
+address $91
+address $62
+byte 4 2
+byte 4 0
+byte 4 0
+skip 4
+address g_banIPs
+address $92
+address $62
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_filterBan
+address $93
+address $94
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_needpass
+address $95
+address $68
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+address g_dedicated
+address $96
+address $68
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_speed
+address $97
+address $98
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_gravity
+address $99
+address $100
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_gravityModifier
+address $101
+address $94
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_damageModifier
+address $102
+address $68
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_knockback
+address $103
+address $104
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_quadfactor
+address $105
+address $106
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_weaponRespawn
+address $107
+address $108
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_weaponTeamRespawn
+address $109
+address $110
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_forcerespawn
+address $111
+address $79
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_respawntime
+address $112
+address $68
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_inactivity
+address $113
+address $68
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_debugMove
+address $114
+address $68
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_debugDamage
+address $115
+address $68
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_debugAlloc
+address $116
+address $68
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_motd
+address $117
+address $62
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_motdfile
+address $118
+address $119
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_blood
+address $120
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_podiumDist
+address $121
+address $122
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_podiumDrop
+address $123
+address $124
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_allowVote
+address $125
+address $94
+byte 4 5
+byte 4 0
+byte 4 0
+skip 4
+address g_maxvotes
+address $126
+address $106
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_voteNames
+address $127
+address $128
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_voteBan
+address $129
+address $68
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_voteGametypes
+address $130
+address $131
+byte 4 5
+byte 4 0
+byte 4 0
+skip 4
+address g_voteMaxTimelimit
+address $132
+address $104
+byte 4 5
+byte 4 0
+byte 4 0
+skip 4
+address g_voteMinTimelimit
+address $133
+address $68
+byte 4 5
+byte 4 0
+byte 4 0
+skip 4
+address g_voteMaxFraglimit
+address $134
+address $68
+byte 4 5
+byte 4 0
+byte 4 0
+skip 4
+address g_voteMinFraglimit
+address $135
+address $68
+byte 4 5
+byte 4 0
+byte 4 0
+skip 4
+address g_votemaps
+address $136
+address $137
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_votecustom
+address $138
+address $139
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_listEntity
+address $140
+address $68
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskHealth
+address $141
+address $142
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskRegenPeriod
+address $143
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskRegenAmount
+address $144
+address $145
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_obeliskRespawnDelay
+address $146
+address $147
+byte 4 4
+byte 4 0
+byte 4 0
+skip 4
+address g_cubeTimeout
+address $148
+address $110
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_enableFS
+address $149
+address $68
+byte 4 4
+byte 4 0
+byte 4 1
+byte 4 0
+address cg_enableQ
+address $150
+address $68
+byte 4 4
+byte 4 0
+byte 4 1
+byte 4 0
+address g_enableDust
+address $151
+address $68
+byte 4 4
+byte 4 0
+byte 4 1
+byte 4 0
+address g_enableBreath
+address $152
+address $68
+byte 4 4
+byte 4 0
+byte 4 1
+byte 4 0
+address g_proxMineTimeout
+address $153
+address $154
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_smoothClients
+address $155
+address $94
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address pmove_fixed
+address $156
+address $68
+byte 4 9
+byte 4 0
+byte 4 0
+skip 4
+address pmove_msec
+address $157
+address $158
+byte 4 9
+byte 4 0
+byte 4 0
+skip 4
+address pmove_float
+address $159
+address $94
+byte 4 9
+byte 4 0
+byte 4 1
+skip 4
+address g_delagHitscan
+address $160
+address $68
+byte 4 5
+byte 4 0
+byte 4 1
+skip 4
+address g_truePing
+address $161
+address $68
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address sv_fps
+address $162
+address $79
+byte 4 9
+byte 4 0
+byte 4 0
+skip 4
+address g_lagLightning
+address $163
+address $94
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_delagPrefilter
+address $164
+address $94
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_rankings
+address $165
+address $68
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_music
+address $166
+address $62
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_spawnprotect
+address $167
+address $168
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_selfdamage
+address $169
+address $68
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_startHealth
+address $170
+address $171
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_startArmor
+address $172
+address $173
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_bfg
+address $174
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_grapple
+address $175
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_roundtime
+address $176
+address $177
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_warmup
+address $178
+address $75
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_activewarmup
+address $179
+address $108
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_allgametypes
+address $180
+address $68
+byte 4 1056
+byte 4 0
+byte 4 0
+skip 4
+address g_elimination_machinegun
+address $181
+address $168
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_shotgun
+address $182
+address $168
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_grenade
+address $183
+address $184
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_rocket
+address $185
+address $186
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_railgun
+address $187
+address $79
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_lightning
+address $188
+address $189
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_plasmagun
+address $190
+address $171
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_chain
+address $191
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_mine
+address $192
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_nail
+address $193
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_ctf_oneway
+address $194
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_elimination_lockspectator
+address $195
+address $68
+byte 4 1024
+byte 4 0
+byte 4 1
+skip 4
+address g_awardpushing
+address $196
+address $94
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_runes
+address $197
+address $68
+byte 4 33
+byte 4 0
+byte 4 0
+skip 4
+address g_rockets
+address $198
+address $68
+byte 4 1060
+byte 4 0
+byte 4 0
+skip 4
+address g_instantgib
+address $199
+address $68
+byte 4 36
+byte 4 0
+byte 4 0
+skip 4
+address g_vampire
+address $200
+address $201
+byte 4 1024
+byte 4 0
+byte 4 1
+skip 4
+address g_regen
+address $202
+address $68
+byte 4 1024
+byte 4 0
+byte 4 1
+skip 4
+address g_vampireMaxHealth
+address $203
+address $168
+byte 4 1024
+byte 4 0
+byte 4 1
+skip 4
+address g_lms_lives
+address $204
+address $94
+byte 4 1024
+byte 4 0
+byte 4 1
+skip 4
+address g_lms_mode
+address $205
+address $68
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_catchup
+address $206
+address $68
+byte 4 1025
+byte 4 0
+byte 4 1
+skip 4
+address g_autonextmap
+address $207
+address $68
+byte 4 1025
+byte 4 0
+byte 4 0
+skip 4
+address g_mappools
+address $208
+address $209
+byte 4 1025
+byte 4 0
+byte 4 0
+skip 4
+address g_humanplayers
+address $210
+address $68
+byte 4 1088
+byte 4 0
+byte 4 0
+skip 4
+address g_redTeamClientNumbers
+address $211
+address $68
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_blueTeamClientNumbers
+address $212
+address $68
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_sprees
+address $213
+address $214
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_altExcellent
+address $215
+address $68
+byte 4 4
+byte 4 0
+byte 4 1
+skip 4
+address g_spreeDiv
+address $216
+address $108
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_floodMaxDemerits
+address $217
+address $218
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_floodMinTime
+address $219
+address $220
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_admin
+address $221
+address $222
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_adminLog
+address $223
+address $224
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_adminParseSay
+address $225
+address $94
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_adminNameProtect
+address $226
+address $94
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_adminTempBan
+address $227
+address $228
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_adminMaxBan
+address $229
+address $230
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_specChat
+address $231
+address $94
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_publicAdminMessages
+address $232
+address $94
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_maxWarnings
+address $233
+address $106
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_warningExpire
+address $234
+address $235
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_minNameChangePeriod
+address $236
+address $147
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_maxNameChanges
+address $237
+address $186
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_timestamp_startgame
+address $238
+address $239
+byte 4 4
+byte 4 0
+byte 4 0
+skip 4
+address g_execute_gametype_script
+address $240
+address $68
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_emptyCommand
+address $241
+address $242
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_emptyTime
+address $243
+address $68
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+align 4
+LABELV gameCvarTableSize
+byte 4 137
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $245
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $245
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $259
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $259
+address $247
+address $248
+address $249
+address $253
+address $251
+address $252
+address $255
+address $250
+address $256
+address $257
+address $258
+code
+LABELV $247
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_InitGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $248
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_ShutdownGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $249
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $250
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $251
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $252
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientDisconnect
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $253
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRGP4 $254
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $255
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $256
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_RunFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $257
+ADDRLP4 8
+ADDRGP4 ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $258
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotAIStartFrame
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $244
+JUMPV
+LABELV $245
+CNSTI4 -1
+RETI4
+LABELV $244
+endproc vmMain 16 12
+export G_Printf
+proc G_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $260
+endproc G_Printf 1028 16
+export G_Error
+proc G_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $262
+endproc G_Error 1028 16
+export G_FindTeams
+proc G_FindTeams 56 12
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $268
+JUMPV
+LABELV $265
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $270
+ADDRGP4 $266
+JUMPV
+LABELV $270
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $272
+ADDRGP4 $266
+JUMPV
+LABELV $272
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $274
+ADDRGP4 $266
+JUMPV
+LABELV $274
+ADDRLP4 4
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+ADDRGP4 $279
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRGP4 $277
+JUMPV
+LABELV $281
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $283
+ADDRGP4 $277
+JUMPV
+LABELV $283
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $285
+ADDRGP4 $277
+JUMPV
+LABELV $285
+ADDRLP4 36
+CNSTI4 656
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $287
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 776
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $289
+ADDRLP4 52
+CNSTI4 652
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $289
+LABELV $287
+LABELV $277
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $279
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $276
+LABELV $266
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $268
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $265
+ADDRGP4 $291
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $264
+endproc G_FindTeams 56 12
+export G_RemapTeamShaders
+proc G_RemapTeamShaders 0 0
+LABELV $292
+endproc G_RemapTeamShaders 0 0
+export G_RegisterCvars
+proc G_RegisterCvars 20 16
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $297
+JUMPV
+LABELV $294
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $300
+LABELV $295
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $297
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $294
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $302
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+LTI4 $308
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 14
+LTI4 $304
+LABELV $308
+ADDRGP4 $309
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $69
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $304
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+EQI4 $315
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+NEI4 $311
+LABELV $315
+ADDRGP4 g_ffa_gt
+CNSTI4 1
+ASGNI4
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRGP4 g_ffa_gt
+CNSTI4 0
+ASGNI4
+LABELV $312
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+LABELV $293
+endproc G_RegisterCvars 20 16
+export G_UpdateCvars
+proc G_UpdateCvars 72 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $322
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $323
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+EQI4 $325
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_gametype
+CVPU4 4
+NEU4 $327
+ADDRGP4 $240
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $327
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRGP4 $331
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $329
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_votecustom
+CVPU4 4
+NEU4 $332
+ADDRGP4 VoteParseCustomVotes
+CALLI4
+pop
+LABELV $332
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 20
+INDIRU4
+ADDRGP4 g_instantgib
+CVPU4 4
+EQU4 $337
+ADDRLP4 20
+INDIRU4
+ADDRGP4 g_rockets
+CVPU4 4
+EQU4 $337
+ADDRLP4 20
+INDIRU4
+ADDRGP4 g_elimination_allgametypes
+CVPU4 4
+NEU4 $334
+LABELV $337
+ADDRGP4 $338
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $334
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 g_voteNames
+CVPU4 4
+NEU4 $339
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 28
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $341
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $341
+ADDRGP4 $345
+ARGP4
+ADDRLP4 32
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $343
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $343
+ADDRGP4 $348
+ARGP4
+ADDRLP4 36
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $346
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $346
+ADDRGP4 $351
+ARGP4
+ADDRLP4 40
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $349
+ADDRGP4 $354
+ARGP4
+ADDRLP4 44
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $352
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $352
+ADDRGP4 $69
+ARGP4
+ADDRLP4 48
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $355
+ADDRGP4 $87
+ARGP4
+ADDRLP4 52
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $357
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $357
+ADDRGP4 $80
+ARGP4
+ADDRLP4 56
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $359
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $359
+ADDRGP4 $78
+ARGP4
+ADDRLP4 60
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $361
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $361
+ADDRGP4 $365
+ARGP4
+ADDRLP4 64
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $363
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $363
+ADDRGP4 $366
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $339
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $367
+LABELV $325
+LABELV $323
+LABELV $320
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $322
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $319
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $369
+LABELV $318
+endproc G_UpdateCvars 72 12
+proc G_UpdateTimestamp 48 28
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_RealTime
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $372
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+RETI4
+LABELV $371
+endproc G_UpdateTimestamp 48 28
+export Q_StrToLower
+proc Q_StrToLower 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $379
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 65
+LTI4 $383
+ADDRLP4 4
+INDIRI4
+CNSTI4 90
+GTI4 $383
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+LABELV $383
+LABELV $380
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $379
+LABELV $378
+endproc Q_StrToLower 12 4
+proc G_RunScript 104 16
+ADDRLP4 0
+ARGP4
+CNSTI4 100
+ARGI4
+ADDRGP4 $386
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_snprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_StrToLower
+CALLV
+pop
+ADDRGP4 $387
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 100
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $388
+CNSTI4 1
+RETI4
+ADDRGP4 $385
+JUMPV
+LABELV $388
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 100
+ARGI4
+ADDRGP4 $390
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_snprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_StrToLower
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $385
+endproc G_RunScript 104 16
+proc G_CheckGametypeScripts 4 8
+ADDRGP4 g_execute_gametype_script+12
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRGP4 $395
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunScript
+CALLI4
+pop
+ADDRGP4 $240
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $392
+CNSTI4 0
+RETI4
+LABELV $391
+endproc G_CheckGametypeScripts 4 8
+export G_InitGame
+proc G_InitGame 1292 20
+ADDRGP4 $398
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $399
+ARGP4
+ADDRGP4 $64
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $400
+ARGP4
+ADDRGP4 $66
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 srand
+CALLV
+pop
+ADDRGP4 G_RegisterCvars
+CALLV
+pop
+ADDRGP4 G_UpdateTimestamp
+CALLI4
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $401
+ADDRGP4 g_instantgib+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_rockets+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_vampire+8
+CNSTF4 0
+ASGNF4
+LABELV $401
+ADDRGP4 G_ProcessIPBans
+CALLV
+pop
+ADDRGP4 BG_InitMemory
+CALLV
+pop
+ADDRGP4 level
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 9488
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 level+40
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $410
+ARGP4
+ADDRLP4 260
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRGP4 level+348
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $411
+ADDRGP4 g_logfile+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $411
+ADDRGP4 g_logfileSync+12
+INDIRI4
+CNSTI4 0
+EQI4 $415
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 level+20
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 level+20
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $416
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRGP4 $425
+ARGP4
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $422
+ADDRLP4 264
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRGP4 $427
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $428
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 264
+ARGP4
+ADDRLP4 1288
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 1288
+INDIRI4
+ARGI4
+CNSTI4 1024
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRGP4 $430
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $412
+ADDRGP4 VoteParseCustomVotes
+CALLI4
+pop
+ADDRGP4 G_InitWorldSession
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_admin_readconfig
+CALLI4
+pop
+ADDRGP4 G_ReadAltKillSettings
+CALLI4
+pop
+ADDRGP4 g_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 835584
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+4
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 level+24
+ADDRGP4 g_maxclients+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_clients
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 136960
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level
+ADDRGP4 g_clients
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $437
+JUMPV
+LABELV $434
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $437
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $434
+ADDRGP4 level+12
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $441
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+524
+ADDP4
+ADDRGP4 $446
+ASGNP4
+LABELV $442
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $441
+ADDRGP4 level+4
+INDIRP4
+ARGP4
+ADDRGP4 level+12
+INDIRI4
+ARGI4
+CNSTI4 816
+ARGI4
+ADDRGP4 level
+INDIRP4
+ARGP4
+CNSTI4 2140
+ARGI4
+ADDRGP4 trap_LocateGameData
+CALLV
+pop
+ADDRGP4 InitBodyQue
+CALLV
+pop
+ADDRGP4 ClearRegisteredItems
+CALLV
+pop
+ADDRGP4 G_SpawnEntitiesFromString
+CALLV
+pop
+ADDRGP4 G_FindTeams
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $453
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $449
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $449
+LABELV $453
+ADDRGP4 G_CheckTeamItems
+CALLV
+pop
+LABELV $449
+ADDRGP4 SaveRegisteredItems
+CALLV
+pop
+ADDRGP4 $454
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $459
+ADDRGP4 $458
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $455
+LABELV $459
+ADDRGP4 $460
+ARGP4
+ADDRGP4 G_ModelIndex
+CALLI4
+pop
+LABELV $455
+ADDRGP4 $463
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAISetup
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAILoadMap
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_InitBots
+CALLV
+pop
+LABELV $461
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+ADDRGP4 level+9236
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9240
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9232
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_elimination_warmup+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 level+9252
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 level+9256
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+MODI4
+ASGNI4
+ADDRGP4 level+9432
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9428
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 11
+NEI4 $473
+ADDRGP4 Team_SpawnDoubleDominationPoints
+CALLI4
+pop
+LABELV $473
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+NEI4 $476
+ADDRGP4 level+9300
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $480
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9276
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $481
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $480
+ADDRGP4 level+9304
+CNSTI4 0
+ASGNI4
+LABELV $476
+ADDRGP4 PlayerStoreInit
+CALLV
+pop
+ADDRLP4 276
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 280
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $486
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $486
+ADDRGP4 $345
+ARGP4
+ADDRLP4 284
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $488
+ADDRGP4 $348
+ARGP4
+ADDRLP4 288
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $490
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $490
+ADDRGP4 $351
+ARGP4
+ADDRLP4 292
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $492
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $492
+ADDRGP4 $354
+ARGP4
+ADDRLP4 296
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $494
+ADDRGP4 $69
+ARGP4
+ADDRLP4 300
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $496
+ADDRGP4 $87
+ARGP4
+ADDRLP4 304
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $498
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $498
+ADDRGP4 $80
+ARGP4
+ADDRLP4 308
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $500
+ADDRGP4 $78
+ARGP4
+ADDRLP4 312
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $502
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $502
+ADDRGP4 $365
+ARGP4
+ADDRLP4 316
+ADDRGP4 allowedVote
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $504
+ADDRGP4 $366
+ARGP4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 320
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 G_CheckGametypeScripts
+CALLI4
+pop
+ADDRGP4 $506
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRGP4 mapinfo
+ARGP4
+ADDRGP4 MapInfoGet
+CALLV
+pop
+ADDRGP4 mapinfo
+ARGP4
+ADDRGP4 MapInfoPrint
+CALLV
+pop
+ADDRGP4 $510
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 276
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 G_RunScript
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRGP4 $511
+ARGP4
+ADDRGP4 G_RunScript
+CALLI4
+pop
+LABELV $508
+ADDRGP4 $514
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 G_RunScript
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRGP4 $516
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRGP4 G_RunScript
+CALLI4
+pop
+LABELV $512
+LABELV $397
+endproc G_InitGame 1292 20
+export G_ShutdownGame
+proc G_ShutdownGame 4 4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+EQI4 $520
+ADDRGP4 $523
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $427
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 level+20
+CNSTI4 0
+ASGNI4
+LABELV $520
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRGP4 G_admin_cleanup
+CALLV
+pop
+ADDRGP4 G_admin_namelog_cleanup
+CALLV
+pop
+ADDRGP4 $463
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdown
+CALLI4
+pop
+LABELV $526
+LABELV $518
+endproc G_ShutdownGame 4 4
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $528
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $530
+endproc Com_Printf 1028 16
+export AddTournamentPlayer
+proc AddTournamentPlayer 24 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+LTI4 $533
+ADDRGP4 $532
+JUMPV
+LABELV $533
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $536
+ADDRGP4 $532
+JUMPV
+LABELV $536
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $542
+JUMPV
+LABELV $539
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $544
+ADDRGP4 $540
+JUMPV
+LABELV $544
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $546
+ADDRGP4 $540
+JUMPV
+LABELV $546
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $550
+ADDRLP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $548
+LABELV $550
+ADDRGP4 $540
+JUMPV
+LABELV $548
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $553
+ADDRLP4 20
+CNSTI4 1028
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $551
+LABELV $553
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $551
+LABELV $540
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $542
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $539
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $554
+ADDRGP4 $532
+JUMPV
+LABELV $554
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+CNSTI4 816
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 2140
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $532
+endproc AddTournamentPlayer 24 8
+export AddTournamentQueue
+proc AddTournamentQueue 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $559
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $566
+ADDRLP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $567
+JUMPV
+LABELV $566
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $568
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $568
+LABELV $567
+LABELV $564
+LABELV $560
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $562
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $559
+LABELV $558
+endproc AddTournamentQueue 12 0
+export RemoveTournamentLoser
+proc RemoveTournamentLoser 4 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $571
+ADDRGP4 $570
+JUMPV
+LABELV $571
+ADDRLP4 0
+ADDRGP4 level+84+4
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $576
+ADDRGP4 $570
+JUMPV
+LABELV $576
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $570
+endproc RemoveTournamentLoser 4 8
+export RemoveTournamentWinner
+proc RemoveTournamentWinner 4 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $580
+ADDRGP4 $579
+JUMPV
+LABELV $580
+ADDRLP4 0
+ADDRGP4 level+84
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $584
+ADDRGP4 $579
+JUMPV
+LABELV $584
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $579
+endproc RemoveTournamentWinner 4 8
+export AdjustTournamentScores
+proc AdjustTournamentScores 8 4
+ADDRLP4 0
+ADDRGP4 level+84
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $588
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1040
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $588
+ADDRLP4 0
+ADDRGP4 level+84+4
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $592
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1044
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $592
+LABELV $586
+endproc AdjustTournamentScores 8 4
+export SortRanks
+proc SortRanks 44 0
+ADDRLP4 8
+CNSTI4 2140
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $597
+ADDRLP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $595
+LABELV $597
+CNSTI4 1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $595
+ADDRLP4 4
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $600
+ADDRLP4 4
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $598
+LABELV $600
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $598
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $601
+CNSTI4 1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $601
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $603
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $603
+ADDRLP4 24
+CNSTI4 1024
+ASGNI4
+ADDRLP4 28
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $605
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $605
+ADDRLP4 32
+CNSTI4 1028
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $607
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $607
+ADDRLP4 36
+CNSTI4 1028
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $609
+CNSTI4 1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $609
+CNSTI4 0
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $611
+CNSTI4 1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $611
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $613
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $613
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $621
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $615
+LABELV $621
+ADDRGP4 level+9236
+INDIRI4
+ADDRGP4 level+9240
+INDIRI4
+NEI4 $615
+ADDRLP4 32
+CNSTI4 1248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $615
+ADDRLP4 0
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $622
+CNSTI4 1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $622
+ADDRLP4 4
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $624
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $624
+LABELV $615
+ADDRLP4 36
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $626
+CNSTI4 -1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $626
+ADDRLP4 40
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $628
+CNSTI4 1
+RETI4
+ADDRGP4 $594
+JUMPV
+LABELV $628
+CNSTI4 0
+RETI4
+LABELV $594
+endproc SortRanks 44 0
+export CalculateRanks
+proc CalculateRanks 56 16
+ADDRGP4 level+340
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+344
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+76
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $636
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4504
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $637
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $636
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $641
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 level+72
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9144
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $651
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $651
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 32
+INDIRI4
+NEI4 $651
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $651
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $656
+ADDRLP4 40
+ADDRGP4 level+76
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $659
+ADDRLP4 44
+ADDRGP4 level+80
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $662
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $666
+ADDRLP4 48
+ADDRGP4 level+4504
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $667
+JUMPV
+LABELV $666
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $669
+ADDRLP4 52
+ADDRGP4 level+4504+4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $669
+LABELV $667
+LABELV $662
+ADDRGP4 level+340
+INDIRI4
+CNSTI4 -1
+NEI4 $673
+ADDRGP4 level+340
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRGP4 level+344
+INDIRI4
+CNSTI4 -1
+NEI4 $677
+ADDRGP4 level+344
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $677
+LABELV $674
+LABELV $659
+LABELV $656
+LABELV $646
+LABELV $642
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $644
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $641
+ADDRGP4 level+84
+ARGP4
+ADDRGP4 level+72
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 SortRanks
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $684
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $684
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $690
+JUMPV
+LABELV $687
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $693
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $699
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $699
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $700
+LABELV $694
+LABELV $688
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $690
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+72
+INDIRI4
+LTI4 $687
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $708
+JUMPV
+LABELV $705
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $713
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $711
+LABELV $713
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $712
+JUMPV
+LABELV $711
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84-4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $712
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $718
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 1
+NEI4 $718
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $718
+LABELV $706
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $708
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+80
+INDIRI4
+LTI4 $705
+LABELV $685
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $723
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $723
+ADDRGP4 $366
+ARGP4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $366
+ARGP4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 0
+NEI4 $730
+ADDRGP4 $366
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $366
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 1
+NEI4 $733
+ADDRGP4 $366
+ARGP4
+CNSTI4 2140
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $366
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRGP4 $366
+ARGP4
+CNSTI4 2140
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $366
+ARGP4
+CNSTI4 2140
+ADDRGP4 level+84+4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $734
+LABELV $731
+LABELV $724
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $740
+ADDRGP4 g_humanplayers+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $743
+ADDRGP4 $366
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $743
+ADDRLP4 20
+INDIRI4
+ADDRGP4 level+9480
+INDIRI4
+LEI4 $746
+ADDRGP4 $749
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9480
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $746
+LABELV $630
+endproc CalculateRanks 56 16
+export SendScoreboardMessageToAllClients
+proc SendScoreboardMessageToAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $752
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $757
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 EliminationMessage
+CALLV
+pop
+LABELV $757
+LABELV $753
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $755
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $752
+LABELV $751
+endproc SendScoreboardMessageToAllClients 4 4
+proc WriteAccForAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $763
+JUMPV
+LABELV $760
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $765
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 LogAcc
+CALLV
+pop
+LABELV $765
+LABELV $761
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $763
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $760
+LABELV $759
+endproc WriteAccForAllClients 4 4
+proc SendVictoryChallenge 16 8
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9480
+INDIRI4
+CNSTI4 2
+LTI4 $772
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+EQI4 $768
+LABELV $772
+ADDRGP4 $767
+JUMPV
+LABELV $768
+ADDRLP4 12
+ADDRGP4 g_gametype+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $767
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+GTI4 $767
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $788
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $788
+address $776
+address $777
+address $767
+address $767
+address $779
+address $780
+address $781
+address $782
+address $783
+address $784
+address $778
+address $785
+address $786
+address $787
+code
+LABELV $776
+ADDRLP4 8
+CNSTI4 101
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $777
+ADDRLP4 8
+CNSTI4 102
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $778
+ADDRLP4 8
+CNSTI4 110
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $779
+ADDRLP4 8
+CNSTI4 104
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $780
+ADDRLP4 8
+CNSTI4 105
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $781
+ADDRLP4 8
+CNSTI4 106
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $782
+ADDRLP4 8
+CNSTI4 107
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $783
+ADDRLP4 8
+CNSTI4 108
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $784
+ADDRLP4 8
+CNSTI4 109
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $785
+ADDRLP4 8
+CNSTI4 111
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $786
+ADDRLP4 8
+CNSTI4 112
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $787
+ADDRLP4 8
+CNSTI4 113
+ASGNI4
+LABELV $774
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $789
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $789
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $792
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $797
+ADDRGP4 $793
+JUMPV
+LABELV $797
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $799
+ADDRGP4 $793
+JUMPV
+LABELV $799
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $801
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $801
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $801
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $807
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+GEI4 $807
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $807
+LABELV $793
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $795
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $792
+ADDRGP4 $790
+JUMPV
+LABELV $789
+CNSTI4 816
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $790
+LABELV $767
+endproc SendVictoryChallenge 16 8
+export SendEliminationMessageToAllClients
+proc SendEliminationMessageToAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $818
+JUMPV
+LABELV $815
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $820
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 EliminationMessage
+CALLV
+pop
+LABELV $820
+LABELV $816
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $818
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $815
+LABELV $814
+endproc SendEliminationMessageToAllClients 4 4
+export SendDDtimetakenMessageToAllClients
+proc SendDDtimetakenMessageToAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $826
+JUMPV
+LABELV $823
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $828
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DoubleDominationScoreTimeMessage
+CALLV
+pop
+LABELV $828
+LABELV $824
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $826
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $823
+LABELV $822
+endproc SendDDtimetakenMessageToAllClients 4 4
+export SendDominationPointsStatusMessageToAllClients
+proc SendDominationPointsStatusMessageToAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $831
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $836
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DominationPointStatusMessage
+CALLV
+pop
+LABELV $836
+LABELV $832
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $834
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $831
+LABELV $830
+endproc SendDominationPointsStatusMessageToAllClients 4 4
+export SendYourTeamMessageToTeam
+proc SendYourTeamMessageToTeam 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $842
+JUMPV
+LABELV $839
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $844
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $844
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 YourTeamMessage
+CALLV
+pop
+LABELV $844
+LABELV $840
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $842
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $839
+LABELV $838
+endproc SendYourTeamMessageToTeam 8 4
+export MoveClientToIntermission
+proc MoveClientToIntermission 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $847
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $847
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRGP4 level+9160
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 level+9160
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 level+9172
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $846
+endproc MoveClientToIntermission 0 12
+export FindIntermissionPoint
+proc FindIntermissionPoint 32 16
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $853
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $854
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 level+9160
+ARGP4
+ADDRGP4 level+9172
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRGP4 level+9160
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 level+9172
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $860
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_PickTarget
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $862
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 level+9160
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 level+9160+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 level+9160+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 level+9172
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $862
+LABELV $860
+LABELV $855
+LABELV $852
+endproc FindIntermissionPoint 32 16
+export BeginIntermission
+proc BeginIntermission 8 4
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $873
+ADDRGP4 $872
+JUMPV
+LABELV $873
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $876
+ADDRGP4 AdjustTournamentScores
+CALLV
+pop
+LABELV $876
+ADDRGP4 level+9144
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $884
+JUMPV
+LABELV $881
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $886
+ADDRGP4 $882
+JUMPV
+LABELV $886
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $888
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientRespawn
+CALLV
+pop
+LABELV $888
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+LABELV $882
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $884
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $881
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $890
+ADDRGP4 UpdateTournamentInfo
+CALLV
+pop
+ADDRGP4 SpawnModelsOnVictoryPads
+CALLV
+pop
+LABELV $890
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $872
+endproc BeginIntermission 8 4
+export ExitLevel
+proc ExitLevel 27864 12
+ADDRGP4 BotInterbreedEndMatch
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $894
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 0
+NEI4 $893
+ADDRGP4 RemoveTournamentLoser
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $900
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9148
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $893
+JUMPV
+LABELV $894
+ADDRGP4 $354
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $904
+ARGP4
+ADDRLP4 2056
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRGP4 g_autonextmap+12
+INDIRI4
+CNSTI4 0
+EQI4 $905
+ADDRGP4 $366
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRLP4 3232
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 g_mappools+16
+ARGP4
+ADDRLP4 3232
+INDIRP4
+ARGP4
+ADDRLP4 3236
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3084
+ARGP4
+ADDRLP4 3236
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3084
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $910
+ADDRLP4 3084
+ARGP4
+ADDRLP4 3228
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 3228
+INDIRI4
+CNSTI4 0
+NEI4 $912
+ADDRGP4 $914
+ARGP4
+ADDRLP4 3084
+ARGP4
+ADDRLP4 3240
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3240
+INDIRP4
+ARGP4
+ADDRLP4 3228
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $912
+ADDRLP4 3228
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRLP4 3244
+CNSTI4 0
+ASGNI4
+ADDRLP4 23740
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 23740
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 3228
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 23736
+ADDRLP4 23740
+ASGNP4
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRLP4 23736
+ARGP4
+ADDRLP4 27836
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 27840
+CNSTI4 20
+ASGNI4
+ADDRLP4 27840
+INDIRI4
+ADDRLP4 3244
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+ARGP4
+ADDRLP4 27836
+INDIRP4
+ARGP4
+ADDRLP4 27840
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 3244
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $920
+ADDRGP4 $919
+JUMPV
+LABELV $920
+ADDRGP4 $922
+ARGP4
+CNSTI4 20
+ADDRLP4 3244
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 3244
+ADDRLP4 3244
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $918
+ADDRGP4 $917
+JUMPV
+LABELV $919
+ADDRLP4 3228
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 23732
+CNSTI4 0
+ASGNI4
+LABELV $923
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+LEI4 $928
+ADDRLP4 27840
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 27836
+ADDRLP4 27840
+INDIRI4
+ADDRLP4 3244
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $929
+JUMPV
+LABELV $928
+ADDRLP4 27836
+CNSTI4 0
+ASGNI4
+LABELV $929
+ADDRLP4 23728
+ADDRLP4 27836
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 27844
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+CNSTI4 20
+ADDRLP4 23728
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+ARGP4
+ADDRLP4 27844
+INDIRP4
+ARGP4
+ADDRLP4 27848
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 27848
+INDIRI4
+CNSTI4 0
+NEI4 $930
+ADDRGP4 $924
+JUMPV
+LABELV $930
+ADDRGP4 $932
+ARGP4
+CNSTI4 20
+ADDRLP4 23728
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+ARGP4
+ADDRLP4 27852
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 27852
+INDIRP4
+ARGP4
+ADDRLP4 3080
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 3080
+INDIRI4
+CNSTI4 0
+EQI4 $933
+ADDRGP4 $935
+ARGP4
+ADDRLP4 23728
+INDIRI4
+ARGI4
+CNSTI4 20
+ADDRLP4 23728
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $936
+ARGP4
+CNSTI4 20
+ADDRLP4 23728
+INDIRI4
+MULI4
+ADDRLP4 3248
+ADDP4
+ARGP4
+ADDRLP4 27860
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 27860
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $354
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 3080
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $925
+JUMPV
+LABELV $933
+LABELV $924
+ADDRLP4 23732
+ADDRLP4 23732
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 23732
+INDIRI4
+CNSTI4 10
+LTI4 $923
+LABELV $925
+LABELV $915
+LABELV $910
+LABELV $905
+ADDRLP4 8
+ARGP4
+ADDRGP4 $939
+ARGP4
+ADDRLP4 3080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3080
+INDIRI4
+CNSTI4 0
+NEI4 $937
+ADDRLP4 2056
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 3084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3084
+INDIRI4
+CNSTI4 0
+EQI4 $937
+ADDRGP4 $354
+ARGP4
+ADDRGP4 $940
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $941
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $938
+JUMPV
+LABELV $937
+CNSTI4 2
+ARGI4
+ADDRGP4 $942
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $938
+ADDRGP4 level+9148
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9144
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+44+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+44+8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $952
+JUMPV
+LABELV $949
+ADDRLP4 4
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $954
+ADDRGP4 $950
+JUMPV
+LABELV $954
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $950
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $952
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $949
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $959
+JUMPV
+LABELV $956
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $961
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $961
+LABELV $957
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $959
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $956
+LABELV $893
+endproc ExitLevel 27864 12
+export G_LogPrintf
+proc G_LogPrintf 1068 24
+ADDRLP4 1024
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 1044
+CNSTI4 60
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 1056
+CNSTI4 10
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $965
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1028
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 0+7
+ARGP4
+CNSTI4 1017
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRGP4 $386
+ARGP4
+ADDRLP4 0+7
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $968
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+NEI4 $972
+ADDRGP4 $963
+JUMPV
+LABELV $972
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 level+20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $963
+endproc G_LogPrintf 1068 24
+export LogExit
+proc LogExit 24 20
+ADDRGP4 $977
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9140
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 WriteAccForAllClients
+CALLV
+pop
+ADDRGP4 SendVictoryChallenge
+CALLV
+pop
+CNSTI4 22
+ARGI4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $981
+ADDRLP4 8
+CNSTI4 32
+ASGNI4
+LABELV $981
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $983
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $983
+ADDRGP4 $986
+ARGP4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $983
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $994
+JUMPV
+LABELV $991
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $996
+ADDRGP4 $992
+JUMPV
+LABELV $996
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $998
+ADDRGP4 $992
+JUMPV
+LABELV $998
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $1001
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1002
+JUMPV
+LABELV $1001
+ADDRLP4 16
+CNSTI4 999
+ASGNI4
+LABELV $1002
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $1003
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $992
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $994
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $991
+LABELV $976
+endproc LogExit 24 20
+export CheckIntermissionExit
+proc CheckIntermissionExit 28 0
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $1006
+ADDRGP4 $1005
+JUMPV
+LABELV $1006
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $1012
+JUMPV
+LABELV $1009
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1014
+ADDRGP4 $1010
+JUMPV
+LABELV $1014
+CNSTI4 816
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1016
+ADDRGP4 $1010
+JUMPV
+LABELV $1016
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1020
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+GEI4 $1021
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $1021
+JUMPV
+LABELV $1020
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1021
+LABELV $1010
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1012
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1009
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1027
+JUMPV
+LABELV $1024
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1029
+ADDRGP4 $1025
+JUMPV
+LABELV $1029
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1025
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1027
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1024
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 5000
+ADDI4
+GEI4 $1031
+ADDRGP4 $1005
+JUMPV
+LABELV $1031
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $1035
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1037
+ADDRGP4 level+9152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1005
+JUMPV
+LABELV $1037
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1040
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $1005
+JUMPV
+LABELV $1040
+LABELV $1035
+ADDRGP4 level+9152
+INDIRI4
+CNSTI4 0
+NEI4 $1042
+ADDRGP4 level+9152
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9156
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $1042
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9156
+INDIRI4
+CNSTI4 10000
+ADDI4
+GEI4 $1048
+ADDRGP4 $1005
+JUMPV
+LABELV $1048
+ADDRGP4 ExitLevel
+CALLV
+pop
+LABELV $1005
+endproc CheckIntermissionExit 28 0
+export ScoreIsTied
+proc ScoreIsTied 24 0
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $1053
+CNSTI4 0
+RETI4
+ADDRGP4 $1052
+JUMPV
+LABELV $1053
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $1061
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $1056
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+CNSTI4 0
+EQI4 $1056
+LABELV $1061
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+EQI4 $1078
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+EQI4 $1078
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+NEI4 $1075
+LABELV $1078
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1075
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1076
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1052
+JUMPV
+LABELV $1056
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $1079
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $1079
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $1087
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1088
+JUMPV
+LABELV $1087
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1088
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1052
+JUMPV
+LABELV $1079
+ADDRLP4 12
+CNSTI4 2140
+ASGNI4
+ADDRLP4 16
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+84+4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1093
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1094
+JUMPV
+LABELV $1093
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1094
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $1052
+endproc ScoreIsTied 24 0
+export CheckExitRules
+proc CheckExitRules 20 8
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $1096
+ADDRGP4 CheckIntermissionExit
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1096
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1099
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1104
+ADDRGP4 $1100
+JUMPV
+LABELV $1104
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1100
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1102
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1099
+ADDRGP4 level+9140
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9140
+INDIRI4
+SUBI4
+CNSTI4 1000
+LTI4 $1095
+ADDRGP4 level+9140
+CNSTI4 0
+ASGNI4
+ADDRGP4 BeginIntermission
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1106
+ADDRLP4 8
+ADDRGP4 ScoreIsTied
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1114
+ADDRGP4 $1095
+JUMPV
+LABELV $1114
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $1116
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1116
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 60000
+DIVI4
+ADDRGP4 g_timelimit+12
+INDIRI4
+LTI4 $1120
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1125
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1126
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1120
+LABELV $1116
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $1127
+ADDRGP4 $1095
+JUMPV
+LABELV $1127
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+LTI4 $1134
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+LEI4 $1130
+LABELV $1134
+ADDRGP4 g_fraglimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $1130
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $1135
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1140
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1141
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1135
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $1142
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1147
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1141
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1142
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1151
+JUMPV
+LABELV $1148
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1153
+ADDRGP4 $1149
+JUMPV
+LABELV $1153
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1155
+ADDRGP4 $1149
+JUMPV
+LABELV $1155
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $1157
+ADDRGP4 $1141
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $1160
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1157
+LABELV $1149
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1151
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1148
+LABELV $1130
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+LTI4 $1161
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+GEI4 $1161
+ADDRGP4 g_capturelimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $1161
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $1165
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1170
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1171
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1165
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $1172
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1177
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1171
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+LABELV $1172
+LABELV $1161
+LABELV $1095
+endproc CheckExitRules 20 8
+export CheckDoubleDomination
+proc CheckDoubleDomination 16 20
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 1
+GEI4 $1179
+ADDRGP4 $1178
+JUMPV
+LABELV $1179
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $1182
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 level+9264
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1194
+ADDRGP4 level+9268
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1193
+LABELV $1194
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9264
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1178
+ADDRGP4 level+9268
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1178
+LABELV $1193
+ADDRGP4 level+9272
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 level+32
+INDIRI4
+GTI4 $1178
+ADDRGP4 Team_RemoveDoubleDominationPoints
+CALLI4
+pop
+ADDRGP4 level+9232
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+ADDRGP4 $1178
+JUMPV
+LABELV $1182
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 11
+EQI4 $1197
+ADDRGP4 $1178
+JUMPV
+LABELV $1197
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRGP4 $1178
+JUMPV
+LABELV $1200
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9264
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1203
+ADDRGP4 level+9268
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1203
+ADDRGP4 level+9272
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 level+32
+INDIRI4
+GTI4 $1203
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1209
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 level+9160
+ARGP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1211
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_DD_bonusAtPoints
+CALLV
+pop
+ADDRGP4 Team_RemoveDoubleDominationPoints
+CALLI4
+pop
+ADDRGP4 level+9232
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $1203
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 level+9264
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1214
+ADDRGP4 level+9268
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1214
+ADDRGP4 level+9272
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 level+32
+INDIRI4
+GTI4 $1214
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1220
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 level+9160
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1211
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_DD_bonusAtPoints
+CALLV
+pop
+ADDRGP4 Team_RemoveDoubleDominationPoints
+CALLI4
+pop
+ADDRGP4 level+9232
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $1214
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+ADDRGP4 level+9264
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1230
+ADDRGP4 level+9268
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1224
+LABELV $1230
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+LEI4 $1224
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1231
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 Team_SpawnDoubleDominationPoints
+CALLI4
+pop
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $1224
+LABELV $1178
+endproc CheckDoubleDomination 16 20
+export CheckDomination
+proc CheckDomination 20 28
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 1
+LTI4 $1237
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+EQI4 $1233
+LABELV $1237
+ADDRGP4 $1232
+JUMPV
+LABELV $1233
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRGP4 $1232
+JUMPV
+LABELV $1238
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $1241
+ADDRGP4 $1232
+JUMPV
+LABELV $1241
+ADDRGP4 level+9304
+INDIRI4
+CNSTI4 3
+LEI4 $1244
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+LABELV $1244
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDRGP4 level+9300
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI4
+MULI4
+LTI4 $1247
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1254
+JUMPV
+LABELV $1251
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9276
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1256
+ADDRGP4 level+9160
+ARGP4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+LABELV $1256
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 level+9276
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1260
+ADDRGP4 level+9160
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+LABELV $1260
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9276
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1264
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9276
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $1252
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1254
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+9304
+INDIRI4
+LTI4 $1251
+ADDRLP4 8
+ADDRGP4 level+9300
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1270
+JUMPV
+LABELV $1269
+ADDRLP4 12
+ADDRGP4 level+9300
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1270
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDRGP4 level+9300
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI4
+MULI4
+GTI4 $1269
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $1247
+LABELV $1232
+endproc CheckDomination 20 28
+export CheckTournament
+proc CheckTournament 32 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 0
+NEI4 $1276
+ADDRGP4 $1275
+JUMPV
+LABELV $1276
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $1279
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $1282
+ADDRGP4 AddTournamentPlayer
+CALLV
+pop
+LABELV $1282
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $1285
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $1275
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $366
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $1293
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $1275
+JUMPV
+LABELV $1285
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $1294
+ADDRGP4 $1275
+JUMPV
+LABELV $1294
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+352
+INDIRI4
+EQI4 $1297
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $1297
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $1304
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+NEI4 $1275
+ADDRGP4 g_warmup+12
+INDIRI4
+CNSTI4 1
+LEI4 $1310
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $1311
+JUMPV
+LABELV $1310
+ADDRGP4 level+16
+CNSTI4 0
+ASGNI4
+LABELV $1311
+ADDRGP4 $366
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $1275
+JUMPV
+LABELV $1304
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $1280
+ADDRLP4 0
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $67
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $900
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1275
+JUMPV
+LABELV $1279
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $1324
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $1324
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LEI4 $1328
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+NEI4 $1328
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1337
+ADDRLP4 4+8
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $1329
+LABELV $1337
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1328
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $1338
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1338
+LABELV $1329
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1341
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $1275
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $366
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $1293
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $1275
+JUMPV
+LABELV $1341
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $1348
+ADDRGP4 $1275
+JUMPV
+LABELV $1348
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+352
+INDIRI4
+EQI4 $1351
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $1351
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $1358
+ADDRGP4 g_warmup+12
+INDIRI4
+CNSTI4 1
+LEI4 $1361
+ADDRLP4 20
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $1362
+JUMPV
+LABELV $1361
+ADDRGP4 level+16
+CNSTI4 0
+ASGNI4
+LABELV $1362
+ADDRGP4 $366
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $1275
+JUMPV
+LABELV $1358
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $1369
+ADDRLP4 20
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $67
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $900
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+LABELV $1369
+LABELV $1324
+LABELV $1280
+LABELV $1275
+endproc CheckTournament 32 8
+export PrintTeam
+proc PrintTeam 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1379
+JUMPV
+LABELV $1376
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1381
+ADDRGP4 $1377
+JUMPV
+LABELV $1381
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1377
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1379
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1376
+LABELV $1375
+endproc PrintTeam 4 8
+export SetLeader
+proc SetLeader 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1384
+ADDRGP4 $1386
+ARGP4
+CNSTI4 2140
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $1383
+JUMPV
+LABELV $1384
+CNSTI4 2140
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1387
+ADDRGP4 $1389
+ARGP4
+CNSTI4 2140
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $1383
+JUMPV
+LABELV $1387
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1393
+JUMPV
+LABELV $1390
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1395
+ADDRGP4 $1391
+JUMPV
+LABELV $1395
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $1397
+LABELV $1391
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1393
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1390
+CNSTI4 2140
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $1399
+ARGP4
+CNSTI4 2140
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+LABELV $1383
+endproc SetLeader 8 8
+export CheckTeamLeader
+proc CheckTeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1401
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1406
+ADDRGP4 $1402
+JUMPV
+LABELV $1406
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1408
+ADDRGP4 $1403
+JUMPV
+LABELV $1408
+LABELV $1402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1404
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1401
+LABELV $1403
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1410
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1416
+JUMPV
+LABELV $1413
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1418
+ADDRGP4 $1414
+JUMPV
+LABELV $1418
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1420
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1415
+JUMPV
+LABELV $1420
+LABELV $1414
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1416
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1413
+LABELV $1415
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1427
+JUMPV
+LABELV $1424
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1429
+ADDRGP4 $1425
+JUMPV
+LABELV $1429
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1048
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1426
+JUMPV
+LABELV $1425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1427
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1424
+LABELV $1426
+LABELV $1410
+LABELV $1400
+endproc CheckTeamLeader 4 0
+export CheckTeamVote
+proc CheckTeamVote 20 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1432
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1433
+JUMPV
+LABELV $1432
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1431
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1435
+LABELV $1433
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1436
+ADDRGP4 $1431
+JUMPV
+LABELV $1436
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $1439
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1443
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1440
+JUMPV
+LABELV $1439
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4488
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4504
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+LEI4 $1444
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1448
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $1451
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2432
+ADDP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1449
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2432+7
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 SetLeader
+CALLV
+pop
+ADDRGP4 $1445
+JUMPV
+LABELV $1449
+ADDRGP4 $1455
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2432
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $1445
+JUMPV
+LABELV $1444
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4496
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4504
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+LTI4 $1431
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1443
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $1458
+LABELV $1445
+LABELV $1440
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $1431
+endproc CheckTeamVote 20 12
+proc CheckEmpty 8 8
+ADDRGP4 g_emptyTime+12
+INDIRI4
+CNSTI4 0
+NEI4 $1463
+ADDRGP4 $1462
+JUMPV
+LABELV $1463
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_humanplayers+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $1470
+ADDRGP4 level+9484
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1466
+LABELV $1470
+ADDRGP4 level+9484
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $1467
+JUMPV
+LABELV $1466
+ADDRGP4 level+9484
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_emptyTime+12
+INDIRI4
+MULI4
+ADDI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $1473
+ADDRGP4 level+9484
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $1455
+ARGP4
+ADDRGP4 g_emptyCommand+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1473
+LABELV $1467
+LABELV $1462
+endproc CheckEmpty 8 8
+data
+align 4
+LABELV $1482
+byte 4 -1
+export CheckCvars
+code
+proc CheckCvars 4 8
+ADDRGP4 g_password+4
+INDIRI4
+ADDRGP4 $1482
+INDIRI4
+EQI4 $1483
+ADDRGP4 $1482
+ADDRGP4 g_password+4
+INDIRI4
+ASGNI4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1487
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $1491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1487
+ADDRGP4 $95
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1488
+JUMPV
+LABELV $1487
+ADDRGP4 $95
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1488
+LABELV $1483
+LABELV $1481
+endproc CheckCvars 4 8
+export G_RunThink
+proc G_RunThink 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $1493
+ADDRGP4 $1492
+JUMPV
+LABELV $1493
+ADDRLP4 0
+INDIRF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $1495
+ADDRGP4 $1492
+JUMPV
+LABELV $1495
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1498
+ADDRGP4 $1500
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $1498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1492
+endproc G_RunThink 8 4
+export G_RunFrame
+proc G_RunFrame 48 12
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 0
+EQI4 $1502
+ADDRGP4 $1501
+JUMPV
+LABELV $1502
+ADDRLP4 8
+ADDRGP4 level+28
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+36
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 level+32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_UpdateCvars
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $1515
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $1509
+LABELV $1515
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1509
+ADDRGP4 g_elimination_lockspectator+12
+INDIRI4
+CNSTI4 1
+LEI4 $1509
+ADDRGP4 $366
+ARGP4
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1510
+JUMPV
+LABELV $1509
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_elimflags+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1517
+ADDRGP4 g_elimination_lockspectator+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1517
+ADDRGP4 $366
+ARGP4
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1517
+LABELV $1510
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1522
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $1522
+ADDRGP4 $366
+ARGP4
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 SendAttackingTeamMessageToAllClients
+CALLV
+pop
+ADDRGP4 $1523
+JUMPV
+LABELV $1522
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1527
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $1527
+ADDRGP4 $366
+ARGP4
+ADDRGP4 g_elimflags+12
+INDIRI4
+CNSTI4 -2
+BANDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1527
+LABELV $1523
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1535
+JUMPV
+LABELV $1532
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1537
+ADDRGP4 $1533
+JUMPV
+LABELV $1537
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 300
+LEI4 $1539
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1542
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1544
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1544
+LABELV $1542
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1546
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $1533
+JUMPV
+LABELV $1546
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1548
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $1548
+LABELV $1539
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1550
+ADDRGP4 $1533
+JUMPV
+LABELV $1550
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1552
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1552
+ADDRGP4 $1533
+JUMPV
+LABELV $1552
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1556
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1554
+LABELV $1556
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunItem
+CALLV
+pop
+ADDRGP4 $1533
+JUMPV
+LABELV $1554
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $1557
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMover
+CALLV
+pop
+ADDRGP4 $1533
+JUMPV
+LABELV $1557
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $1559
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunClient
+CALLV
+pop
+ADDRGP4 $1533
+JUMPV
+LABELV $1559
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunThink
+CALLV
+pop
+LABELV $1533
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $1535
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1532
+ADDRGP4 level+36
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 G_TimeShiftAllClients
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1565
+JUMPV
+LABELV $1562
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1567
+ADDRGP4 $1563
+JUMPV
+LABELV $1567
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1569
+ADDRGP4 $1563
+JUMPV
+LABELV $1569
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1571
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMissile
+CALLV
+pop
+LABELV $1571
+LABELV $1563
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $1565
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1562
+CNSTP4 0
+ARGP4
+ADDRGP4 G_UnTimeShiftAllClients
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1576
+JUMPV
+LABELV $1573
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1578
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+LABELV $1578
+LABELV $1574
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $1576
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1573
+ADDRGP4 CheckTournament
+CALLV
+pop
+ADDRGP4 CheckElimination
+CALLV
+pop
+ADDRGP4 CheckLMS
+CALLV
+pop
+ADDRGP4 CheckDoubleDomination
+CALLV
+pop
+ADDRGP4 CheckDomination
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+NEI4 $1580
+ADDRGP4 Team_Dom_SpawnPoints
+CALLV
+pop
+LABELV $1580
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+NEI4 $1583
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+LEI4 $1583
+ADDRGP4 Possession_SpawnFlag
+CALLV
+pop
+LABELV $1583
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 CheckTeamStatus
+CALLV
+pop
+ADDRGP4 CheckVote
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 CheckEmpty
+CALLV
+pop
+ADDRGP4 CheckCvars
+CALLV
+pop
+ADDRGP4 g_listEntity+12
+INDIRI4
+CNSTI4 0
+EQI4 $1587
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1590
+ADDRGP4 $1594
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1591
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $1590
+ADDRGP4 $140
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1587
+ADDRLP4 32
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 level+9436
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $1501
+endproc G_RunFrame 48 12
+export MapInfoPrint
+proc MapInfoPrint 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1598
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $1599
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $1600
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $1601
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1597
+endproc MapInfoPrint 0 8
+bss
+export mapinfo
+align 4
+LABELV mapinfo
+skip 9328
+export g_emptyTime
+align 4
+LABELV g_emptyTime
+skip 272
+export g_emptyCommand
+align 4
+LABELV g_emptyCommand
+skip 272
+export g_execute_gametype_script
+align 4
+LABELV g_execute_gametype_script
+skip 272
+export g_timestamp_startgame
+align 4
+LABELV g_timestamp_startgame
+skip 272
+export g_enableFS
+align 4
+LABELV g_enableFS
+skip 272
+export cg_enableQ
+align 4
+LABELV cg_enableQ
+skip 272
+export g_listEntity
+align 4
+LABELV g_listEntity
+skip 272
+export g_podiumDrop
+align 4
+LABELV g_podiumDrop
+skip 272
+export g_podiumDist
+align 4
+LABELV g_podiumDist
+skip 272
+export g_logfileSync
+align 4
+LABELV g_logfileSync
+skip 272
+export g_logfile
+align 4
+LABELV g_logfile
+skip 272
+import enableQ
+export g_clients
+align 4
+LABELV g_clients
+skip 136960
+import monster_die
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+export g_maxNameChanges
+align 4
+LABELV g_maxNameChanges
+skip 272
+export g_minNameChangePeriod
+align 4
+LABELV g_minNameChangePeriod
+skip 272
+export g_warningExpire
+align 4
+LABELV g_warningExpire
+skip 272
+export g_maxWarnings
+align 4
+LABELV g_maxWarnings
+skip 272
+export g_publicAdminMessages
+align 4
+LABELV g_publicAdminMessages
+skip 272
+export g_specChat
+align 4
+LABELV g_specChat
+skip 272
+export g_adminMaxBan
+align 4
+LABELV g_adminMaxBan
+skip 272
+export g_adminTempBan
+align 4
+LABELV g_adminTempBan
+skip 272
+export g_adminNameProtect
+align 4
+LABELV g_adminNameProtect
+skip 272
+export g_adminParseSay
+align 4
+LABELV g_adminParseSay
+skip 272
+export g_adminLog
+align 4
+LABELV g_adminLog
+skip 272
+export g_admin
+align 4
+LABELV g_admin
+skip 272
+export g_floodMinTime
+align 4
+LABELV g_floodMinTime
+skip 272
+export g_floodMaxDemerits
+align 4
+LABELV g_floodMaxDemerits
+skip 272
+export g_spreeDiv
+align 4
+LABELV g_spreeDiv
+skip 272
+export g_altExcellent
+align 4
+LABELV g_altExcellent
+skip 272
+export g_sprees
+align 4
+LABELV g_sprees
+skip 272
+export g_delagPrefilter
+align 4
+LABELV g_delagPrefilter
+skip 272
+export g_lagLightning
+align 4
+LABELV g_lagLightning
+skip 272
+export sv_fps
+align 4
+LABELV sv_fps
+skip 272
+export g_truePing
+align 4
+LABELV g_truePing
+skip 272
+export g_delagHitscan
+align 4
+LABELV g_delagHitscan
+skip 272
+export g_blueTeamClientNumbers
+align 4
+LABELV g_blueTeamClientNumbers
+skip 272
+export g_redTeamClientNumbers
+align 4
+LABELV g_redTeamClientNumbers
+skip 272
+export g_humanplayers
+align 4
+LABELV g_humanplayers
+skip 272
+export g_maxvotes
+align 4
+LABELV g_maxvotes
+skip 272
+export g_voteMaxFraglimit
+align 4
+LABELV g_voteMaxFraglimit
+skip 272
+export g_voteMinFraglimit
+align 4
+LABELV g_voteMinFraglimit
+skip 272
+export g_voteMaxTimelimit
+align 4
+LABELV g_voteMaxTimelimit
+skip 272
+export g_voteMinTimelimit
+align 4
+LABELV g_voteMinTimelimit
+skip 272
+export g_voteGametypes
+align 4
+LABELV g_voteGametypes
+skip 272
+export g_voteBan
+align 4
+LABELV g_voteBan
+skip 272
+export g_voteNames
+align 4
+LABELV g_voteNames
+skip 272
+export g_mappools
+align 4
+LABELV g_mappools
+skip 272
+export g_autonextmap
+align 4
+LABELV g_autonextmap
+skip 272
+export g_catchup
+align 4
+LABELV g_catchup
+skip 272
+export g_runes
+align 4
+LABELV g_runes
+skip 272
+export g_awardpushing
+align 4
+LABELV g_awardpushing
+skip 272
+export g_elimination_ctf_oneway
+align 4
+LABELV g_elimination_ctf_oneway
+skip 272
+export g_lms_mode
+align 4
+LABELV g_lms_mode
+skip 272
+export g_lms_lives
+align 4
+LABELV g_lms_lives
+skip 272
+export g_ffa_gt
+align 4
+LABELV g_ffa_gt
+skip 4
+export g_regen
+align 4
+LABELV g_regen
+skip 272
+export g_vampireMaxHealth
+align 4
+LABELV g_vampireMaxHealth
+skip 272
+export g_vampire
+align 4
+LABELV g_vampire
+skip 272
+export g_instantgib
+align 4
+LABELV g_instantgib
+skip 272
+export g_rockets
+align 4
+LABELV g_rockets
+skip 272
+export g_elimination_lockspectator
+align 4
+LABELV g_elimination_lockspectator
+skip 272
+export g_elimination_nail
+align 4
+LABELV g_elimination_nail
+skip 272
+export g_elimination_mine
+align 4
+LABELV g_elimination_mine
+skip 272
+export g_elimination_chain
+align 4
+LABELV g_elimination_chain
+skip 272
+export g_elimination_plasmagun
+align 4
+LABELV g_elimination_plasmagun
+skip 272
+export g_elimination_lightning
+align 4
+LABELV g_elimination_lightning
+skip 272
+export g_elimination_railgun
+align 4
+LABELV g_elimination_railgun
+skip 272
+export g_elimination_rocket
+align 4
+LABELV g_elimination_rocket
+skip 272
+export g_elimination_grenade
+align 4
+LABELV g_elimination_grenade
+skip 272
+export g_elimination_shotgun
+align 4
+LABELV g_elimination_shotgun
+skip 272
+export g_elimination_machinegun
+align 4
+LABELV g_elimination_machinegun
+skip 272
+export g_elimination_allgametypes
+align 4
+LABELV g_elimination_allgametypes
+skip 272
+export g_elimination_activewarmup
+align 4
+LABELV g_elimination_activewarmup
+skip 272
+export g_elimination_warmup
+align 4
+LABELV g_elimination_warmup
+skip 272
+export g_elimination_roundtime
+align 4
+LABELV g_elimination_roundtime
+skip 272
+export g_elimination_grapple
+align 4
+LABELV g_elimination_grapple
+skip 272
+export g_elimination_bfg
+align 4
+LABELV g_elimination_bfg
+skip 272
+export g_elimination_startArmor
+align 4
+LABELV g_elimination_startArmor
+skip 272
+export g_elimination_startHealth
+align 4
+LABELV g_elimination_startHealth
+skip 272
+export g_elimination_selfdamage
+align 4
+LABELV g_elimination_selfdamage
+skip 272
+export g_spawnprotect
+align 4
+LABELV g_spawnprotect
+skip 272
+export g_music
+align 4
+LABELV g_music
+skip 272
+export g_proxMineTimeout
+align 4
+LABELV g_proxMineTimeout
+skip 272
+export g_enableBreath
+align 4
+LABELV g_enableBreath
+skip 272
+export g_enableDust
+align 4
+LABELV g_enableDust
+skip 272
+export g_rankings
+align 4
+LABELV g_rankings
+skip 272
+export pmove_float
+align 4
+LABELV pmove_float
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export g_smoothClients
+align 4
+LABELV g_smoothClients
+skip 272
+export g_cubeTimeout
+align 4
+LABELV g_cubeTimeout
+skip 272
+export g_obeliskRespawnDelay
+align 4
+LABELV g_obeliskRespawnDelay
+skip 272
+export g_obeliskRegenAmount
+align 4
+LABELV g_obeliskRegenAmount
+skip 272
+export g_obeliskRegenPeriod
+align 4
+LABELV g_obeliskRegenPeriod
+skip 272
+export g_obeliskHealth
+align 4
+LABELV g_obeliskHealth
+skip 272
+export g_filterBan
+align 4
+LABELV g_filterBan
+skip 272
+export g_banIPs
+align 4
+LABELV g_banIPs
+skip 272
+export g_teamForceBalance
+align 4
+LABELV g_teamForceBalance
+skip 272
+export g_teamAutoJoin
+align 4
+LABELV g_teamAutoJoin
+skip 272
+export g_allowVote
+align 4
+LABELV g_allowVote
+skip 272
+export g_blood
+align 4
+LABELV g_blood
+skip 272
+export g_doWarmup
+align 4
+LABELV g_doWarmup
+skip 272
+export g_warmup
+align 4
+LABELV g_warmup
+skip 272
+export g_votecustom
+align 4
+LABELV g_votecustom
+skip 272
+export g_votemaps
+align 4
+LABELV g_votemaps
+skip 272
+export g_motdfile
+align 4
+LABELV g_motdfile
+skip 272
+export g_motd
+align 4
+LABELV g_motd
+skip 272
+export g_synchronousClients
+align 4
+LABELV g_synchronousClients
+skip 272
+export g_weaponTeamRespawn
+align 4
+LABELV g_weaponTeamRespawn
+skip 272
+export g_weaponRespawn
+align 4
+LABELV g_weaponRespawn
+skip 272
+export g_debugDamage
+align 4
+LABELV g_debugDamage
+skip 272
+export g_debugAlloc
+align 4
+LABELV g_debugAlloc
+skip 272
+export g_debugMove
+align 4
+LABELV g_debugMove
+skip 272
+export g_inactivity
+align 4
+LABELV g_inactivity
+skip 272
+export g_respawntime
+align 4
+LABELV g_respawntime
+skip 272
+export g_forcerespawn
+align 4
+LABELV g_forcerespawn
+skip 272
+export g_quadfactor
+align 4
+LABELV g_quadfactor
+skip 272
+export g_knockback
+align 4
+LABELV g_knockback
+skip 272
+export g_speed
+align 4
+LABELV g_speed
+skip 272
+export g_damageModifier
+align 4
+LABELV g_damageModifier
+skip 272
+export g_gravityModifier
+align 4
+LABELV g_gravityModifier
+skip 272
+export g_gravity
+align 4
+LABELV g_gravity
+skip 272
+export g_needpass
+align 4
+LABELV g_needpass
+skip 272
+export g_password
+align 4
+LABELV g_password
+skip 272
+export g_friendlyFire
+align 4
+LABELV g_friendlyFire
+skip 272
+export g_capturelimit
+align 4
+LABELV g_capturelimit
+skip 272
+export g_timelimit
+align 4
+LABELV g_timelimit
+skip 272
+export g_fraglimit
+align 4
+LABELV g_fraglimit
+skip 272
+export g_voteflags
+align 4
+LABELV g_voteflags
+skip 272
+export g_elimflags
+align 4
+LABELV g_elimflags
+skip 272
+export g_videoflags
+align 4
+LABELV g_videoflags
+skip 272
+export g_dmflags
+align 4
+LABELV g_dmflags
+skip 272
+export g_restarted
+align 4
+LABELV g_restarted
+skip 272
+export g_maxGameClients
+align 4
+LABELV g_maxGameClients
+skip 272
+export g_maxclients
+align 4
+LABELV g_maxclients
+skip 272
+export g_cheats
+align 4
+LABELV g_cheats
+skip 272
+export g_dedicated
+align 4
+LABELV g_dedicated
+skip 272
+export g_gametype
+align 4
+LABELV g_gametype
+skip 272
+export g_entities
+align 4
+LABELV g_entities
+skip 835584
+export level
+align 4
+LABELV level
+skip 9488
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1601
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1600
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1599
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1598
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1594
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1500
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $1491
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1455
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1451
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1448
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1443
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1399
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1389
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1386
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1293
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $1264
+byte 1 68
+byte 1 79
+byte 1 77
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1231
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 65
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1220
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1211
+byte 1 68
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1209
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1177
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1171
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1170
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1160
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1147
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1141
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1140
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1126
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $1125
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $1003
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $986
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $977
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $965
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $942
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $941
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $940
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $939
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $936
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $935
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $932
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $922
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $914
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 111
+byte 1 114
+byte 1 103
+byte 1 0
+align 1
+LABELV $904
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $900
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $853
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $749
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $578
+byte 1 115
+byte 1 0
+align 1
+LABELV $557
+byte 1 102
+byte 1 0
+align 1
+LABELV $523
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $519
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $516
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $514
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $511
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $510
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $506
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $463
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $460
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $458
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $454
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $446
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $430
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $429
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $428
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $427
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $425
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $410
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $400
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $399
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $398
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $395
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $390
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 10
+byte 1 0
+align 1
+LABELV $387
+byte 1 76
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $386
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $372
+byte 1 37
+byte 1 48
+byte 1 52
+byte 1 105
+byte 1 45
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 45
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $366
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $365
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $354
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $351
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $348
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $345
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $338
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $331
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $309
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $291
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $254
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $243
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $242
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $241
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $240
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $239
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 49
+byte 1 45
+byte 1 48
+byte 1 49
+byte 1 45
+byte 1 48
+byte 1 49
+byte 1 32
+byte 1 48
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $238
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $237
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $236
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $235
+byte 1 51
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $234
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $233
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $232
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 65
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $231
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $230
+byte 1 50
+byte 1 119
+byte 1 0
+align 1
+LABELV $229
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $228
+byte 1 50
+byte 1 109
+byte 1 0
+align 1
+LABELV $227
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $226
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $225
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $224
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $223
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $222
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $221
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $220
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $219
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $218
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $217
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $216
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 68
+byte 1 105
+byte 1 118
+byte 1 0
+align 1
+LABELV $215
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $214
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $213
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $212
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $211
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $210
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $209
+byte 1 48
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 49
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 51
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 100
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 52
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 53
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 54
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 55
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 56
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 57
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 49
+byte 1 48
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 49
+byte 1 49
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 49
+byte 1 50
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 49
+byte 1 51
+byte 1 92
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 100
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 92
+byte 1 0
+align 1
+LABELV $208
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $207
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $206
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $205
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $204
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $203
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $202
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $201
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $200
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $199
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $198
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $197
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $196
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $195
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $194
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $193
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $192
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $191
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $190
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $189
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $188
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $187
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $186
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $185
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $184
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $183
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $182
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $181
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $180
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $179
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $178
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $177
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $176
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $175
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $174
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $173
+byte 1 49
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $172
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $171
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $170
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $169
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $168
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $167
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $166
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $165
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $164
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $163
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $162
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $161
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $160
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $159
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $158
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $157
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $156
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $155
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $154
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $153
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $152
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $151
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $150
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 81
+byte 1 0
+align 1
+LABELV $149
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 83
+byte 1 0
+align 1
+LABELV $148
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 98
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $147
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $146
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $145
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $144
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $143
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $142
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $141
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $140
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $139
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $138
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $137
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $136
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $135
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $134
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $133
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $132
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $131
+byte 1 47
+byte 1 48
+byte 1 47
+byte 1 49
+byte 1 47
+byte 1 51
+byte 1 47
+byte 1 52
+byte 1 47
+byte 1 53
+byte 1 47
+byte 1 54
+byte 1 47
+byte 1 55
+byte 1 47
+byte 1 56
+byte 1 47
+byte 1 57
+byte 1 47
+byte 1 49
+byte 1 48
+byte 1 47
+byte 1 49
+byte 1 49
+byte 1 47
+byte 1 49
+byte 1 50
+byte 1 47
+byte 1 49
+byte 1 51
+byte 1 47
+byte 1 0
+align 1
+LABELV $130
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $129
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $128
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 0
+align 1
+LABELV $127
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $126
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $125
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $124
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $123
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $122
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $121
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $120
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $119
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $118
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $117
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $116
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 0
+align 1
+LABELV $115
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $114
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $113
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $112
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $110
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $108
+byte 1 53
+byte 1 0
+align 1
+LABELV $107
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $106
+byte 1 51
+byte 1 0
+align 1
+LABELV $105
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $104
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $103
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $102
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $101
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $100
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $98
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $96
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $95
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 0
+align 1
+LABELV $93
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $92
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $91
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $90
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $89
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $88
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $87
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $86
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $85
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $83
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $82
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $81
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $80
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $79
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $78
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $76
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $75
+byte 1 55
+byte 1 0
+align 1
+LABELV $74
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $73
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $72
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $71
+byte 1 56
+byte 1 0
+align 1
+LABELV $70
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $69
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $68
+byte 1 48
+byte 1 0
+align 1
+LABELV $67
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $66
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 57
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 0
+align 1
+LABELV $65
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $64
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $63
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $62
+byte 1 0
+align 1
+LABELV $61
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
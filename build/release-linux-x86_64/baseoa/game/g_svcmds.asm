@@ -0,0 +1,3398 @@
+code
+proc StringToFilter 164 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTU4 0
+ASGNU4
+ADDRLP4 136
+ADDRLP4 144
+INDIRU4
+ASGNU4
+ADDRLP4 140
+ADDRLP4 144
+INDIRU4
+ASGNU4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $61
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 48
+LTI4 $67
+ADDRLP4 148
+INDIRI4
+CNSTI4 57
+LEI4 $65
+LABELV $67
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $68
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $70
+ADDRGP4 $63
+JUMPV
+LABELV $70
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $62
+JUMPV
+LABELV $68
+ADDRGP4 $72
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $60
+JUMPV
+LABELV $65
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 152
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 160
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+ADDRLP4 152
+INDIRI4
+ADDRLP4 160
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 156
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 0
+ADDP4
+ADDRLP4 156
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $74
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 48
+LTI4 $76
+ADDRLP4 152
+INDIRI4
+CNSTI4 57
+LEI4 $73
+LABELV $76
+ADDRLP4 128
+INDIRI4
+ADDRLP4 0
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+ADDRLP4 156
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $77
+ADDRGP4 $63
+JUMPV
+LABELV $77
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $62
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $61
+LABELV $63
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 136
+INDIRU4
+ASGNU4
+CNSTI4 1
+RETI4
+LABELV $60
+endproc StringToFilter 164 8
+proc UpdateIPBans 348 12
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $83
+JUMPV
+LABELV $80
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $84
+ADDRGP4 $81
+JUMPV
+LABELV $84
+ADDRLP4 336
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 68
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $88
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 255
+EQI4 $92
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRGP4 $95
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $93
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $99
+ADDRLP4 344
+ADDRGP4 $96
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 344
+ADDRGP4 $97
+ASGNP4
+LABELV $100
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $89
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $88
+ADDRLP4 80
+ARGP4
+ADDRLP4 340
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 344
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+ADDRLP4 344
+INDIRI4
+ADDI4
+CNSTI4 256
+GEI4 $101
+ADDRLP4 80
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRGP4 $103
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $82
+JUMPV
+LABELV $102
+LABELV $81
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $83
+ADDRLP4 76
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $80
+LABELV $82
+ADDRGP4 $104
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $79
+endproc UpdateIPBans 348 12
+export G_FilterPacket
+proc G_FilterPacket 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 10
+ADDRLP4 8
+INDIRP4
+INDIRU1
+CVUI4 1
+MULI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $110
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+LTI4 $112
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+LEI4 $109
+LABELV $112
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 12
+INDIRI4
+CNSTI4 58
+NEI4 $113
+LABELV $115
+ADDRGP4 $108
+JUMPV
+LABELV $113
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $107
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $116
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $106
+LABELV $116
+LABELV $108
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+BANDU4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+NEU4 $121
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $127
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $121
+LABELV $118
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $117
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $131
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $105
+endproc G_FilterPacket 20 0
+proc AddIP 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $137
+ADDRGP4 $135
+JUMPV
+LABELV $137
+LABELV $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $136
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $133
+LABELV $135
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+NEI4 $140
+ADDRGP4 numIPFilters
+INDIRI4
+CNSTI4 1024
+NEI4 $142
+ADDRGP4 $144
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $132
+JUMPV
+LABELV $142
+ADDRLP4 4
+ADDRGP4 numIPFilters
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $145
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+LABELV $145
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+LABELV $132
+endproc AddIP 8 8
+export G_ProcessIPBans
+proc G_ProcessIPBans 276 12
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_banIPs+16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 264
+ADDRGP4 g_banIPs+16
+ASGNP4
+ADDRLP4 0
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 $153
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 268
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $158
+ADDRGP4 $152
+JUMPV
+LABELV $157
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $158
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $157
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $160
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $160
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $151
+LABELV $153
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $150
+LABELV $152
+LABELV $148
+endproc G_ProcessIPBans 276 12
+export Svcmd_AddIP_f
+proc Svcmd_AddIP_f 1028 12
+ADDRLP4 1024
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $163
+ADDRGP4 $165
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $163
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $162
+endproc Svcmd_AddIP_f 1028 12
+export Svcmd_RemoveIP_f
+proc Svcmd_RemoveIP_f 1048 12
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+GEI4 $167
+ADDRGP4 $169
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $167
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRGP4 $166
+JUMPV
+LABELV $170
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $172
+ADDRLP4 1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+NEU4 $176
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ADDRLP4 4+4
+INDIRU4
+NEU4 $176
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+ADDRGP4 $181
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+ADDRGP4 $166
+JUMPV
+LABELV $176
+LABELV $173
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $172
+ADDRGP4 $182
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $166
+endproc Svcmd_RemoveIP_f 1048 12
+export Svcmd_EntityList_f
+proc Svcmd_EntityList_f 16 8
+ADDRLP4 0
+ADDRGP4 g_entities+816
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRGP4 $186
+JUMPV
+LABELV $190
+ADDRGP4 $192
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $193
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+GTI4 $193
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $221
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $221
+address $196
+address $198
+address $200
+address $202
+address $204
+address $206
+address $208
+address $210
+address $212
+address $214
+address $216
+address $218
+code
+LABELV $196
+ADDRGP4 $197
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $198
+ADDRGP4 $199
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $200
+ADDRGP4 $201
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $202
+ADDRGP4 $203
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $204
+ADDRGP4 $205
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $206
+ADDRGP4 $207
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $208
+ADDRGP4 $209
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $210
+ADDRGP4 $211
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $212
+ADDRGP4 $213
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $214
+ADDRGP4 $215
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $216
+ADDRGP4 $217
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $218
+ADDRGP4 $219
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRGP4 $220
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $194
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $222
+ADDRGP4 $224
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $222
+ADDRGP4 $225
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $186
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $188
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $185
+LABELV $183
+endproc Svcmd_EntityList_f 16 8
+export ClientForString
+proc ClientForString 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+LTI4 $227
+ADDRLP4 12
+INDIRI4
+CNSTI4 57
+GTI4 $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $232
+ADDRLP4 20
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $229
+LABELV $232
+ADDRGP4 $233
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $226
+JUMPV
+LABELV $229
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRGP4 $236
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $226
+JUMPV
+LABELV $234
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $237
+ADDRLP4 0
+CNSTI4 2140
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRGP4 $238
+JUMPV
+LABELV $242
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $226
+JUMPV
+LABELV $244
+LABELV $238
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $240
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $237
+ADDRGP4 $246
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $226
+endproc ClientForString 24 8
+export Svcmd_ForceTeam_f
+proc Svcmd_ForceTeam_f 1032 12
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $248
+ADDRGP4 $247
+JUMPV
+LABELV $248
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 816
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 2140
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $247
+endproc Svcmd_ForceTeam_f 1032 12
+export ClientKick_f
+proc ClientKick_f 1040 12
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $251
+ADDRLP4 1032
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 48
+LTI4 $257
+ADDRLP4 1032
+INDIRI4
+CNSTI4 57
+LEI4 $255
+LABELV $257
+ADDRGP4 $258
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $250
+JUMPV
+LABELV $255
+LABELV $252
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $254
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $251
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+CNSTI4 2140
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 945
+ADDP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRGP4 $262
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $250
+JUMPV
+LABELV $259
+ADDRLP4 1028
+INDIRI4
+ARGI4
+ADDRGP4 $263
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+LABELV $250
+endproc ClientKick_f 1040 12
+export EndGame_f
+proc EndGame_f 0 0
+ADDRGP4 ExitLevel
+CALLV
+pop
+LABELV $264
+endproc EndGame_f 0 0
+data
+export svcmds
+align 4
+LABELV svcmds
+address $266
+byte 4 0
+address Svcmd_EntityList_f
+address $267
+byte 4 0
+address Svcmd_ForceTeam_f
+address $268
+byte 4 0
+address Svcmd_GameMem_f
+address $269
+byte 4 0
+address Svcmd_AddBot_f
+address $270
+byte 4 0
+address Svcmd_BotList_f
+address $271
+byte 4 0
+address Svcmd_AbortPodium_f
+address $272
+byte 4 0
+address Svcmd_AddIP_f
+address $273
+byte 4 0
+address Svcmd_RemoveIP_f
+address $274
+byte 4 0
+address Svcmd_ListIP_f
+address $275
+byte 4 0
+address Svcmd_Status_f
+address $276
+byte 4 0
+address Svcmd_EjectClient_f
+address $277
+byte 4 0
+address Svcmd_DumpUser_f
+address $278
+byte 4 1
+address Svcmd_CenterPrint_f
+address $279
+byte 4 1
+address Svcmd_TeamMessage_f
+address $280
+byte 4 1
+address Svcmd_MessageWrapper
+address $281
+byte 4 1
+address Svcmd_Chat_f
+address $282
+byte 4 0
+address ShuffleTeams
+address $283
+byte 4 0
+address ClientKick_f
+address $284
+byte 4 0
+address EndGame_f
+export ConsoleCommand
+code
+proc ConsoleCommand 1036 12
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $286
+ADDRLP4 4
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 svcmds
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 svcmds+4
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+EQI4 $292
+ADDRGP4 g_dedicated+12
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+NEI4 $292
+CNSTI4 0
+RETI4
+ADDRGP4 $285
+JUMPV
+LABELV $292
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 svcmds+8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $285
+JUMPV
+LABELV $290
+LABELV $287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $289
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 19
+LTU4 $286
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1028
+ADDRGP4 G_admin_cmd_check
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $297
+CNSTI4 1
+RETI4
+ADDRGP4 $285
+JUMPV
+LABELV $297
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $299
+ADDRGP4 $302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $299
+CNSTI4 0
+RETI4
+LABELV $285
+endproc ConsoleCommand 1036 12
+bss
+align 4
+LABELV numIPFilters
+skip 4
+align 4
+LABELV ipFilters
+skip 8192
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $302
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $284
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $283
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $282
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $280
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $279
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $278
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $277
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $276
+byte 1 101
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $275
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $274
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $273
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $272
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $271
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $270
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $268
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $267
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $266
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $263
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $262
+byte 1 75
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $261
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $258
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $246
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $236
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $233
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $220
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $219
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $217
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $215
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 0
+align 1
+LABELV $213
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $211
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 65
+byte 1 75
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $209
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $207
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $205
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $203
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $201
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $199
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $197
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $192
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 0
+align 1
+LABELV $182
+byte 1 68
+byte 1 105
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $181
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 118
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $144
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $104
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $103
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $97
+byte 1 32
+byte 1 0
+align 1
+LABELV $96
+byte 1 46
+byte 1 0
+align 1
+LABELV $95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $94
+byte 1 42
+byte 1 0
+align 1
+LABELV $72
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
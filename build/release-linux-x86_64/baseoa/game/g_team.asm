@@ -0,0 +1,15475 @@
+export Team_InitGame
+code
+proc Team_InitGame 12 12
+ADDRGP4 teamgame
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 36
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRGP4 g_gametype+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $62
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $62
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $70-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $70
+address $64
+address $68
+address $62
+address $62
+address $62
+address $64
+address $62
+address $64
+address $67
+address $68
+code
+LABELV $64
+ADDRGP4 teamgame+8
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 teamgame+12
+CNSTI4 -1
+ASGNI4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 ddA
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 ddB
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $62
+JUMPV
+LABELV $67
+ADDRGP4 dominationPointsSpawned
+CNSTI4 0
+ASGNI4
+ADDRGP4 $62
+JUMPV
+LABELV $68
+ADDRGP4 teamgame+16
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $62
+LABELV $60
+endproc Team_InitGame 12 12
+export OtherTeam
+proc OtherTeam 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $73
+CNSTI4 2
+RETI4
+ADDRGP4 $72
+JUMPV
+LABELV $73
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $75
+CNSTI4 1
+RETI4
+ADDRGP4 $72
+JUMPV
+LABELV $75
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $72
+endproc OtherTeam 0 0
+export TeamName
+proc TeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $78
+ADDRGP4 $80
+RETP4
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $81
+ADDRGP4 $83
+RETP4
+ADDRGP4 $77
+JUMPV
+LABELV $81
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $84
+ADDRGP4 $86
+RETP4
+ADDRGP4 $77
+JUMPV
+LABELV $84
+ADDRGP4 $87
+RETP4
+LABELV $77
+endproc TeamName 0 0
+export OtherTeamName
+proc OtherTeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $89
+ADDRGP4 $83
+RETP4
+ADDRGP4 $88
+JUMPV
+LABELV $89
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $91
+ADDRGP4 $80
+RETP4
+ADDRGP4 $88
+JUMPV
+LABELV $91
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $93
+ADDRGP4 $86
+RETP4
+ADDRGP4 $88
+JUMPV
+LABELV $93
+ADDRGP4 $87
+RETP4
+LABELV $88
+endproc OtherTeamName 0 0
+export TeamColorString
+proc TeamColorString 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $96
+ADDRGP4 $98
+RETP4
+ADDRGP4 $95
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $99
+ADDRGP4 $101
+RETP4
+ADDRGP4 $95
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $102
+ADDRGP4 $104
+RETP4
+ADDRGP4 $95
+JUMPV
+LABELV $102
+ADDRGP4 $105
+RETP4
+LABELV $95
+endproc TeamColorString 0 0
+export PrintMsg
+proc PrintMsg 1048 16
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LTU4 $108
+ADDRGP4 $110
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $108
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 0
+INDIRP4
+CNSTI1 39
+ASGNI1
+LABELV $112
+ADDRLP4 4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $111
+ADDRGP4 $115
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $116
+ADDRLP4 1040
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ASGNI4
+LABELV $117
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $106
+endproc PrintMsg 1048 16
+export G_TeamFromString
+proc G_TeamFromString 32 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 98
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $125
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $127
+LABELV $126
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $119
+ADDRLP4 0
+INDIRI4
+CNSTI4 51
+GTI4 $119
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $128-192
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $128
+address $122
+address $123
+address $124
+address $125
+code
+LABELV $127
+ADDRLP4 24
+CNSTI4 102
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $123
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $119
+LABELV $130
+ADDRLP4 0
+INDIRI4
+CNSTI4 114
+EQI4 $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 115
+EQI4 $122
+ADDRGP4 $119
+JUMPV
+LABELV $122
+CNSTI4 3
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $123
+CNSTI4 0
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $124
+CNSTI4 1
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $125
+CNSTI4 2
+RETI4
+ADDRGP4 $118
+JUMPV
+LABELV $119
+CNSTI4 4
+RETI4
+LABELV $118
+endproc G_TeamFromString 32 4
+export AddTeamScore
+proc AddTeamScore 12 8
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+EQI4 $132
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $135
+ADDRGP4 level+44+4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $137
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $137
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+GTI4 $143
+ADDRGP4 level+44+4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $143
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRGP4 level+44+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+4
+INDIRI4
+NEI4 $153
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 level+44+4
+INDIRI4
+GTI4 $159
+ADDRGP4 level+44+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+4
+INDIRI4
+LEI4 $159
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 9
+ASGNI4
+LABELV $160
+LABELV $154
+LABELV $136
+LABELV $132
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $131
+endproc AddTeamScore 12 8
+export OnSameTeam
+proc OnSameTeam 16 0
+ADDRLP4 0
+CNSTI4 516
+ASGNI4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $173
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $171
+LABELV $173
+CNSTI4 0
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $171
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $177
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+NEI4 $174
+LABELV $177
+CNSTI4 0
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $174
+ADDRLP4 8
+CNSTI4 516
+ASGNI4
+ADDRLP4 12
+CNSTI4 1024
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $178
+CNSTI4 1
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $178
+CNSTI4 0
+RETI4
+LABELV $170
+endproc OnSameTeam 16 0
+data
+align 1
+LABELV ctfFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 42
+byte 1 42
+byte 1 50
+align 1
+LABELV oneFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+export Team_SetFlagStatus
+code
+proc Team_SetFlagStatus 16 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $183
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $188
+ADDRGP4 $181
+JUMPV
+LABELV $183
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $182
+ADDRGP4 teamgame+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $188
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $182
+ADDRGP4 teamgame+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $193
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $182
+ADDRGP4 teamgame+16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $181
+LABELV $182
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $198
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $204
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $200
+LABELV $204
+ADDRLP4 12
+ADDRGP4 ctfFlagStatusRemap
+ASGNP4
+ADDRLP4 8
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+2
+CNSTI1 0
+ASGNI1
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 11
+NEI4 $209
+ADDRLP4 12
+ADDRGP4 oneFlagStatusRemap
+ASGNP4
+ADDRLP4 8
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+2
+CNSTI1 0
+ASGNI1
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRLP4 8
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRGP4 oneFlagStatusRemap
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+CNSTI1 0
+ASGNI1
+LABELV $210
+LABELV $201
+CNSTI4 23
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $198
+LABELV $180
+endproc Team_SetFlagStatus 16 8
+export Team_CheckDroppedItem
+proc Team_CheckDroppedItem 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $219
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $221
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $223
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $223
+LABELV $222
+LABELV $220
+LABELV $218
+endproc Team_CheckDroppedItem 0 8
+export Team_ForceGesture
+proc Team_ForceGesture 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $226
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRGP4 $227
+JUMPV
+LABELV $230
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $232
+ADDRGP4 $227
+JUMPV
+LABELV $232
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $234
+ADDRGP4 $227
+JUMPV
+LABELV $234
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $227
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $226
+LABELV $225
+endproc Team_ForceGesture 12 0
+export Team_DD_bonusAtPoints
+proc Team_DD_bonusAtPoints 100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $241
+ADDRGP4 $238
+JUMPV
+LABELV $241
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $243
+ADDRGP4 $238
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $245
+ADDRGP4 $236
+JUMPV
+LABELV $245
+ADDRLP4 36
+CNSTI4 488
+ASGNI4
+ADDRLP4 40
+ADDRGP4 ddA
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 492
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 496
+ASGNI4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 ddA
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 488
+ASGNI4
+ADDRLP4 60
+ADDRGP4 ddB
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 492
+ASGNI4
+ADDRLP4 16+4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 496
+ASGNI4
+ADDRLP4 16+8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 ddB
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1148846080
+GEF4 $253
+ADDRLP4 76
+CNSTI4 488
+ASGNI4
+ADDRGP4 ddA
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $251
+LABELV $253
+ADDRLP4 16
+ARGP4
+ADDRLP4 84
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 1148846080
+GEF4 $254
+ADDRLP4 88
+CNSTI4 488
+ASGNI4
+ADDRGP4 ddB
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $251
+LABELV $254
+ADDRGP4 $236
+JUMPV
+LABELV $251
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $238
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+LTI4 $237
+LABELV $236
+endproc Team_DD_bonusAtPoints 100 12
+export Team_FragBonuses
+proc Team_FragBonuses 296 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+CNSTI4 516
+ASGNI4
+ADDRLP4 72
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $260
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $260
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $256
+LABELV $260
+ADDRGP4 $255
+JUMPV
+LABELV $256
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 88
+CNSTI4 1024
+ASGNI4
+ADDRLP4 48
+ADDRLP4 84
+INDIRP4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRP4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $261
+ADDRGP4 $255
+JUMPV
+LABELV $261
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $263
+ADDRLP4 52
+CNSTI4 7
+ASGNI4
+ADDRLP4 60
+CNSTI4 8
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 60
+CNSTI4 7
+ASGNI4
+LABELV $264
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+EQI4 $269
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+NEI4 $265
+LABELV $269
+ADDRLP4 60
+CNSTI4 9
+ASGNI4
+LABELV $265
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $270
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $270
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $273
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $276
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $276
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 580
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $279
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $280
+JUMPV
+LABELV $279
+CNSTP4 0
+ARGP4
+ADDRGP4 $283
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $284
+ARGP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $280
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $285
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $289
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $292
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $294
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $297
+ARGP4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 104
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $294
+LABELV $290
+LABELV $286
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $298
+ADDRLP4 8
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $303
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $303
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $303
+LABELV $299
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $301
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $298
+ADDRGP4 $255
+JUMPV
+LABELV $273
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 56
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 580
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 112
+CNSTI4 516
+ASGNI4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 120
+CNSTI4 140
+ASGNI4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 132
+CNSTI4 512
+ASGNI4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $310
+ADDRLP4 8
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $315
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $315
+LABELV $311
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $313
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $310
+ADDRGP4 $255
+JUMPV
+LABELV $305
+ADDRLP4 96
+CNSTI4 516
+ASGNI4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 0
+EQF4 $317
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRLP4 100
+INDIRF4
+SUBF4
+CNSTF4 1174011904
+GEF4 $317
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 112
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $322
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 305
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $322
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 124
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $317
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+EQF4 $326
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CNSTF4 1174011904
+GEF4 $326
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 305
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $329
+ADDRGP4 $320
+ARGP4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 120
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $326
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 11
+NEI4 $333
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRGP4 level+9264
+INDIRI4
+NEI4 $336
+ADDRLP4 112
+CNSTI4 488
+ASGNI4
+ADDRLP4 116
+ADDRGP4 ddA
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 492
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 496
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 ddA
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 488
+ASGNI4
+ADDRLP4 136
+ADDRGP4 ddA
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 492
+ASGNI4
+ADDRLP4 36+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 496
+ASGNI4
+ADDRLP4 36+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 ddA
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1148846080
+GEF4 $346
+ADDRLP4 152
+CNSTI4 488
+ASGNI4
+ADDRGP4 ddA
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $345
+LABELV $346
+ADDRLP4 36
+ARGP4
+ADDRLP4 160
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1148846080
+GEF4 $343
+ADDRLP4 164
+CNSTI4 488
+ASGNI4
+ADDRGP4 ddA
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $343
+LABELV $345
+ADDRLP4 172
+CNSTI4 516
+ASGNI4
+ADDRLP4 176
+CNSTI4 1024
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $343
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRGP4 level+9268
+INDIRI4
+NEI4 $347
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9272
+INDIRI4
+SUBI4
+CNSTI4 7000
+LEI4 $347
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $348
+ADDRLP4 180
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 568
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 188
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $352
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 305
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $352
+ADDRLP4 192
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 196
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $343
+LABELV $336
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRGP4 level+9268
+INDIRI4
+NEI4 $255
+ADDRLP4 112
+CNSTI4 488
+ASGNI4
+ADDRLP4 116
+ADDRGP4 ddB
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 492
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 496
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 ddB
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 488
+ASGNI4
+ADDRLP4 136
+ADDRGP4 ddB
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 492
+ASGNI4
+ADDRLP4 36+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 496
+ASGNI4
+ADDRLP4 36+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 ddB
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1148846080
+GEF4 $366
+ADDRLP4 152
+CNSTI4 488
+ASGNI4
+ADDRGP4 ddB
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $365
+LABELV $366
+ADDRLP4 36
+ARGP4
+ADDRLP4 160
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1148846080
+GEF4 $255
+ADDRLP4 164
+CNSTI4 488
+ASGNI4
+ADDRGP4 ddB
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $255
+LABELV $365
+ADDRLP4 172
+CNSTI4 516
+ASGNI4
+ADDRLP4 176
+CNSTI4 1024
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $255
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRGP4 level+9264
+INDIRI4
+NEI4 $367
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9272
+INDIRI4
+SUBI4
+CNSTI4 7000
+LEI4 $367
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $368
+ADDRLP4 180
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 568
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 184
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $372
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 305
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $372
+ADDRGP4 $320
+ARGP4
+ADDRLP4 188
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 192
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 196
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $333
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $376
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+EQI4 $382
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+EQI4 $384
+ADDRGP4 $255
+JUMPV
+LABELV $382
+ADDRLP4 20
+ADDRGP4 $383
+ASGNP4
+ADDRGP4 $377
+JUMPV
+LABELV $384
+ADDRLP4 20
+ADDRGP4 $385
+ASGNP4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $386
+ADDRLP4 20
+ADDRGP4 $389
+ASGNP4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+EQI4 $393
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+EQI4 $395
+ADDRGP4 $255
+JUMPV
+LABELV $393
+ADDRLP4 20
+ADDRGP4 $394
+ASGNP4
+ADDRGP4 $391
+JUMPV
+LABELV $395
+ADDRLP4 20
+ADDRGP4 $396
+ASGNP4
+LABELV $391
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $397
+ADDRLP4 12
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $402
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $402
+ADDRGP4 $399
+JUMPV
+LABELV $402
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+LABELV $398
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $397
+LABELV $399
+LABELV $387
+LABELV $377
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $406
+JUMPV
+LABELV $407
+LABELV $405
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $404
+LABELV $406
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $409
+ADDRGP4 $255
+JUMPV
+LABELV $409
+ADDRLP4 116
+CNSTI4 488
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 492
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+CNSTI4 496
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 488
+ASGNI4
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 492
+ASGNI4
+ADDRLP4 36+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+CNSTI4 496
+ASGNI4
+ADDRLP4 36+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1148846080
+GEF4 $425
+ADDRLP4 156
+CNSTI4 488
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $424
+LABELV $425
+ADDRLP4 36
+ARGP4
+ADDRLP4 164
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1148846080
+GEF4 $415
+ADDRLP4 168
+CNSTI4 488
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $415
+LABELV $424
+ADDRLP4 176
+CNSTI4 516
+ASGNI4
+ADDRLP4 180
+CNSTI4 1024
+ASGNI4
+ADDRLP4 184
+ADDRFP4 8
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $415
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $415
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $428
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $428
+ADDRLP4 192
+CNSTI4 2
+ASGNI4
+ADDRGP4 level+9256
+INDIRI4
+ADDRGP4 level+9236
+INDIRI4
+ADDI4
+ADDRLP4 192
+INDIRI4
+MODI4
+ADDRLP4 188
+INDIRI4
+NEI4 $429
+ADDRLP4 184
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $428
+LABELV $429
+ADDRLP4 196
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9256
+INDIRI4
+ADDRGP4 level+9236
+INDIRI4
+ADDI4
+CNSTI4 2
+MODI4
+ADDRLP4 196
+INDIRI4
+NEI4 $415
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 196
+INDIRI4
+NEI4 $415
+LABELV $428
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 200
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 568
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 204
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 305
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $430
+ADDRGP4 $320
+ARGP4
+ADDRLP4 208
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 208
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 212
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+ADDRLP4 212
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 216
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $415
+ADDRLP4 200
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 200
+INDIRU4
+CNSTU4 0
+EQU4 $434
+ADDRLP4 200
+INDIRU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $434
+ADDRLP4 208
+CNSTI4 488
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216
+CNSTI4 492
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+CNSTI4 496
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+CNSTI4 488
+ASGNI4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 228
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTI4 492
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 240
+CNSTI4 496
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 240
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1148846080
+GEF4 $443
+ADDRLP4 248
+CNSTI4 488
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $442
+LABELV $443
+ADDRLP4 36
+ARGP4
+ADDRLP4 256
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1148846080
+GEF4 $440
+ADDRLP4 260
+CNSTI4 488
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $440
+LABELV $442
+ADDRLP4 268
+CNSTI4 516
+ASGNI4
+ADDRLP4 272
+CNSTI4 1024
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $440
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 276
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 305
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $444
+ADDRGP4 $320
+ARGP4
+ADDRLP4 284
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 284
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 288
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 292
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $440
+LABELV $434
+LABELV $255
+endproc Team_FragBonuses 296 40
+export Team_CheckHurtCarrier
+proc Team_CheckHurtCarrier 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 516
+ASGNI4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $451
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+NEU4 $449
+LABELV $451
+ADDRGP4 $448
+JUMPV
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $452
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $453
+JUMPV
+LABELV $452
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $453
+ADDRLP4 12
+CNSTI4 516
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRLP4 20
+CNSTI4 1024
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $454
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $454
+ADDRLP4 24
+CNSTI4 516
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRLP4 32
+CNSTI4 1024
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $457
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $457
+LABELV $448
+endproc Team_CheckHurtCarrier 36 0
+export Team_ResetFlag
+proc Team_ResetFlag 20 12
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $463
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $464
+ADDRGP4 $461
+JUMPV
+LABELV $463
+ADDRLP4 4
+ADDRGP4 $394
+ASGNP4
+ADDRGP4 $462
+JUMPV
+LABELV $464
+ADDRLP4 4
+ADDRGP4 $396
+ASGNP4
+ADDRGP4 $462
+JUMPV
+LABELV $465
+ADDRLP4 4
+ADDRGP4 $466
+ASGNP4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+CNSTP4 0
+RETP4
+ADDRGP4 $460
+JUMPV
+LABELV $462
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $470
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RespawnItem
+CALLV
+pop
+LABELV $471
+LABELV $468
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $467
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $460
+endproc Team_ResetFlag 20 12
+export Team_Dom_SpawnPoints
+proc Team_Dom_SpawnPoints 24 12
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 dominationPointsSpawned
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRGP4 $472
+JUMPV
+LABELV $473
+ADDRGP4 dominationPointsSpawned
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 16
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $476
+CNSTP4 0
+ARGP4
+ADDRGP4 $478
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $472
+JUMPV
+LABELV $476
+CNSTP4 0
+ARGP4
+ADDRGP4 $479
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $480
+ASGNP4
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $484
+ADDRGP4 $483
+JUMPV
+LABELV $484
+ADDRLP4 4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $486
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $489
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRGP4 $492
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $493
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+LABELV $487
+ADDRLP4 20
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $482
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $481
+LABELV $483
+ADDRGP4 level+9304
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $472
+endproc Team_Dom_SpawnPoints 24 12
+export getDomPointNumber
+proc getDomPointNumber 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $502
+CNSTI4 0
+RETI4
+ADDRGP4 $496
+JUMPV
+LABELV $502
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $504
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $496
+JUMPV
+LABELV $504
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $500
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $506
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+9304
+INDIRI4
+LTI4 $497
+LABELV $506
+CNSTI4 0
+RETI4
+LABELV $496
+endproc getDomPointNumber 8 0
+export Team_Dom_TakePoint
+proc Team_Dom_TakePoint 44 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 getDomPointNumber
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $508
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $508
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $510
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+LABELV $510
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $512
+ADDRGP4 $514
+ARGP4
+ADDRLP4 24
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $515
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $517
+ADDRGP4 $519
+ARGP4
+ADDRLP4 24
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $520
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+LABELV $517
+LABELV $513
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 28
+CNSTU4 0
+ASGNU4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 28
+INDIRU4
+EQU4 $524
+ADDRLP4 24
+INDIRU4
+ADDRLP4 28
+INDIRU4
+NEU4 $522
+LABELV $524
+CNSTP4 0
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $507
+JUMPV
+LABELV $522
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 dom_points
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9276
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $527
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+9308
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 SendDominationPointsStatusMessageToAllClients
+CALLV
+pop
+LABELV $507
+endproc Team_Dom_TakePoint 44 28
+export Team_DD_RemovePointAgfx
+proc Team_DD_RemovePointAgfx 0 4
+ADDRGP4 ddA
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $530
+ADDRGP4 ddA
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 ddA
+CNSTP4 0
+ASGNP4
+LABELV $530
+LABELV $529
+endproc Team_DD_RemovePointAgfx 0 4
+export Team_DD_RemovePointBgfx
+proc Team_DD_RemovePointBgfx 0 4
+ADDRGP4 ddB
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $533
+ADDRGP4 ddB
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 ddB
+CNSTP4 0
+ASGNP4
+LABELV $533
+LABELV $532
+endproc Team_DD_RemovePointBgfx 0 4
+export Team_DD_makeA2team
+proc Team_DD_makeA2team 16 8
+ADDRGP4 Team_DD_RemovePointAgfx
+CALLV
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $538
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $536
+LABELV $538
+ADDRGP4 $535
+JUMPV
+LABELV $536
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $539
+ADDRGP4 $541
+ARGP4
+ADDRLP4 4
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $542
+ADDRGP4 $544
+ARGP4
+ADDRLP4 4
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRGP4 $547
+ARGP4
+ADDRLP4 4
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $545
+LABELV $543
+LABELV $540
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 8
+INDIRU4
+EQU4 $550
+ADDRLP4 4
+INDIRU4
+ADDRLP4 8
+INDIRU4
+NEU4 $548
+LABELV $550
+CNSTP4 0
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $548
+ADDRLP4 12
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRGP4 ddA
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 ddA
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ddA
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 ddA
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRGP4 ddA
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+LABELV $535
+endproc Team_DD_makeA2team 16 8
+proc Team_DD_makeB2team 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 Team_DD_RemovePointBgfx
+CALLV
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $554
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $552
+LABELV $554
+ADDRGP4 $551
+JUMPV
+LABELV $552
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $555
+ADDRGP4 $557
+ARGP4
+ADDRLP4 4
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $555
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $558
+ADDRGP4 $560
+ARGP4
+ADDRLP4 4
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $558
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $561
+ADDRGP4 $563
+ARGP4
+ADDRLP4 4
+ADDRGP4 BG_FindItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $561
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 8
+INDIRU4
+EQU4 $566
+ADDRLP4 4
+INDIRU4
+ADDRLP4 8
+INDIRU4
+NEU4 $564
+LABELV $566
+CNSTP4 0
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $551
+JUMPV
+LABELV $564
+ADDRLP4 12
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRGP4 ddB
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 ddB
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 ddB
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 ddB
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SpawnItem
+CALLV
+pop
+ADDRGP4 ddB
+INDIRP4
+ARGP4
+ADDRGP4 FinishSpawningItem
+CALLV
+pop
+LABELV $551
+endproc Team_DD_makeB2team 16 8
+proc Team_ResetFlags 0 4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $572
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $568
+LABELV $572
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+EQI4 $577
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+NEI4 $573
+LABELV $577
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+LABELV $573
+LABELV $569
+LABELV $567
+endproc Team_ResetFlags 0 4
+export Team_ReturnFlagSound
+proc Team_ReturnFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $579
+ADDRGP4 $581
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $578
+JUMPV
+LABELV $579
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+GTI4 $582
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9232
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_elimination_activewarmup+12
+INDIRI4
+MULI4
+SUBI4
+LEI4 $582
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $582
+ADDRGP4 $578
+JUMPV
+LABELV $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $590
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $591
+JUMPV
+LABELV $590
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $591
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $578
+endproc Team_ReturnFlagSound 12 8
+export Team_TakeFlagSound
+proc Team_TakeFlagSound 16 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $593
+ADDRGP4 $595
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $592
+JUMPV
+LABELV $593
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $598
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $609
+ADDRGP4 $596
+JUMPV
+LABELV $598
+ADDRGP4 teamgame+12
+INDIRI4
+CNSTI4 0
+EQI4 $599
+ADDRGP4 teamgame+24
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $602
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $602
+ADDRGP4 $592
+JUMPV
+LABELV $602
+LABELV $599
+ADDRGP4 teamgame+24
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $597
+JUMPV
+LABELV $609
+ADDRGP4 teamgame+8
+INDIRI4
+CNSTI4 0
+EQI4 $610
+ADDRGP4 teamgame+20
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $613
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $613
+ADDRGP4 $592
+JUMPV
+LABELV $613
+LABELV $610
+ADDRGP4 teamgame+20
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $596
+LABELV $597
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 8
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $620
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 5
+ASGNI4
+LABELV $621
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $592
+endproc Team_TakeFlagSound 16 8
+export Team_CaptureFlagSound
+proc Team_CaptureFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $623
+ADDRGP4 $625
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $622
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $626
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $627
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $622
+endproc Team_CaptureFlagSound 12 8
+export Team_ReturnFlag
+proc Team_ReturnFlag 12 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $629
+CNSTP4 0
+ARGP4
+ADDRGP4 $631
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $630
+ADDRGP4 $635
+ARGP4
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $636
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $637
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $640
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $638
+JUMPV
+LABELV $637
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $641
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $644
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $641
+LABELV $638
+LABELV $630
+LABELV $628
+endproc Team_ReturnFlag 12 24
+export Team_FreeEntity
+proc Team_FreeEntity 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $647
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $648
+JUMPV
+LABELV $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $649
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $651
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+LABELV $651
+LABELV $650
+LABELV $648
+LABELV $646
+endproc Team_FreeEntity 0 4
+export Team_DroppedFlagThink
+proc Team_DroppedFlagThink 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $654
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $656
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $658
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $658
+LABELV $657
+LABELV $655
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+LABELV $653
+endproc Team_DroppedFlagThink 8 8
+export updateDDpoints
+proc updateDDpoints 0 8
+CNSTI4 1
+ARGI4
+ADDRGP4 level+9264
+INDIRI4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 level+9268
+INDIRI4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $660
+endproc updateDDpoints 0 8
+export Team_SpawnDoubleDominationPoints
+proc Team_SpawnDoubleDominationPoints 12 12
+ADDRGP4 level+9264
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9268
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateDDpoints
+CALLV
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $394
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $666
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_DD_makeA2team
+CALLV
+pop
+LABELV $666
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $668
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_DD_makeB2team
+CALLV
+pop
+LABELV $668
+CNSTI4 1
+RETI4
+LABELV $663
+endproc Team_SpawnDoubleDominationPoints 12 12
+export Team_RemoveDoubleDominationPoints
+proc Team_RemoveDoubleDominationPoints 0 8
+ADDRGP4 level+9264
+CNSTI4 3
+ASGNI4
+ADDRGP4 level+9268
+CNSTI4 3
+ASGNI4
+ADDRGP4 updateDDpoints
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Team_DD_makeA2team
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 Team_DD_makeB2team
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $670
+endproc Team_RemoveDoubleDominationPoints 0 8
+export Team_TouchDoubleDominationPoint
+proc Team_TouchDoubleDominationPoint 48 24
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $674
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $675
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 level+9264
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $676
+ADDRGP4 level+9268
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $676
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9272
+INDIRI4
+SUBI4
+CNSTI4 7000
+LEI4 $680
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $680
+LABELV $676
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $684
+ADDRGP4 level+9264
+INDIRI4
+CNSTI4 3
+NEI4 $686
+CNSTI4 0
+RETI4
+ADDRGP4 $673
+JUMPV
+LABELV $686
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+9264
+INDIRI4
+NEI4 $689
+CNSTI4 0
+RETI4
+ADDRGP4 $673
+JUMPV
+LABELV $689
+ADDRGP4 level+9264
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $693
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_DD_makeA2team
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $694
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $697
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $697
+LABELV $695
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+9268
+INDIRI4
+NEI4 $699
+ADDRGP4 level+9272
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 SendDDtimetakenMessageToAllClients
+CALLV
+pop
+LABELV $699
+LABELV $684
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $705
+ADDRGP4 level+9268
+INDIRI4
+CNSTI4 3
+NEI4 $707
+CNSTI4 0
+RETI4
+ADDRGP4 $673
+JUMPV
+LABELV $707
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+9268
+INDIRI4
+NEI4 $710
+CNSTI4 0
+RETI4
+ADDRGP4 $673
+JUMPV
+LABELV $710
+ADDRGP4 level+9268
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_DD_makeB2team
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $716
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $718
+LABELV $716
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+9264
+INDIRI4
+NEI4 $720
+ADDRGP4 level+9272
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 SendDDtimetakenMessageToAllClients
+CALLV
+pop
+LABELV $720
+LABELV $705
+ADDRGP4 updateDDpoints
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $673
+endproc Team_TouchDoubleDominationPoint 48 24
+export Team_TouchOurFlag
+proc Team_TouchOurFlag 76 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+EQI4 $730
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+NEI4 $726
+LABELV $730
+ADDRLP4 12
+CNSTI4 9
+ASGNI4
+ADDRGP4 $727
+JUMPV
+LABELV $726
+ADDRLP4 8
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $731
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 12
+CNSTI4 7
+ASGNI4
+LABELV $732
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $733
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $735
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $736
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $739
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $737
+JUMPV
+LABELV $736
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $740
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $743
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $740
+LABELV $737
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $725
+JUMPV
+LABELV $733
+LABELV $727
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $746
+CNSTI4 0
+RETI4
+ADDRGP4 $725
+JUMPV
+LABELV $746
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $748
+CNSTP4 0
+ARGP4
+ADDRGP4 $751
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $752
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $754
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $757
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $754
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $758
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $761
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $758
+LABELV $749
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 teamgame
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 teamgame+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $765
+ADDRGP4 EndEliminationRound
+CALLV
+pop
+LABELV $765
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 304
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $769
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $770
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $770
+ADDRGP4 level+9428
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $770
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 303
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $770
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_CaptureFlagSound
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $776
+JUMPV
+LABELV $773
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $780
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $778
+LABELV $780
+ADDRGP4 $774
+JUMPV
+LABELV $778
+ADDRLP4 52
+CNSTI4 1024
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $781
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 3231711232
+ASGNF4
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+EQU4 $783
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $783
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $785
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 584
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $788
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 304
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $788
+ADDRGP4 $320
+ARGP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $791
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $785
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $793
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 584
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+9428
+INDIRI4
+CNSTI4 0
+NEI4 $796
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 304
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $796
+ADDRGP4 $320
+ARGP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $791
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $793
+LABELV $782
+LABELV $774
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $776
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $773
+ADDRGP4 Team_ResetFlags
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $725
+endproc Team_TouchOurFlag 76 28
+export Team_TouchEnemyFlag
+proc Team_TouchEnemyFlag 16 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $801
+CNSTP4 0
+ARGP4
+ADDRGP4 $804
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $805
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $806
+CNSTI4 0
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $806
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $802
+JUMPV
+LABELV $801
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $808
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $809
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $812
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $810
+JUMPV
+LABELV $809
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+NEI4 $813
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $816
+ARGP4
+ADDRGP4 level+9236
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $813
+LABELV $810
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $818
+ADDRLP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $819
+JUMPV
+LABELV $818
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+LABELV $819
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $802
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_TakeFlagSound
+CALLV
+pop
+CNSTI4 -1
+RETI4
+LABELV $800
+endproc Team_TouchEnemyFlag 16 28
+export Pickup_Team
+proc Pickup_Team 24 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $822
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $822
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $825
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+EQI4 $828
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $830
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRGP4 $831
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $829
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $825
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 12
+NEI4 $832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_Dom_TakePoint
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $832
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $835
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $836
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $837
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $838
+JUMPV
+LABELV $837
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $466
+ARGP4
+ADDRLP4 16
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $839
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $841
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $840
+LABELV $838
+LABELV $836
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+NEI4 $842
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Possession_TouchFlag
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $842
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $845
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $848
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_TouchEnemyFlag
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $848
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+EQI4 $850
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_TouchOurFlag
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $850
+CNSTI4 0
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $845
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 11
+NEI4 $852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_TouchDoubleDominationPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $852
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+NEI4 $855
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_TouchOurFlag
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $821
+JUMPV
+LABELV $855
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_TouchEnemyFlag
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $821
+endproc Pickup_Team 24 28
+export Team_GetLocation
+proc Team_GetLocation 48 8
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+CNSTF4 1296039936
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 level+9188
+INDIRP4
+ASGNP4
+ADDRGP4 $861
+JUMPV
+LABELV $858
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $867
+ADDRGP4 $859
+JUMPV
+LABELV $867
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $869
+ADDRGP4 $859
+JUMPV
+LABELV $869
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $859
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $861
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $858
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $857
+endproc Team_GetLocation 48 8
+export Team_GetLocationMsg
+proc Team_GetLocationMsg 12 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $872
+CNSTI4 0
+RETI4
+ADDRGP4 $871
+JUMPV
+LABELV $872
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $874
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $876
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $876
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $878
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $878
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $880
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $875
+JUMPV
+LABELV $874
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $881
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $875
+CNSTI4 1
+RETI4
+LABELV $871
+endproc Team_GetLocationMsg 12 24
+export SelectRandomEntityFilter
+proc SelectRandomEntityFilter 532 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $884
+JUMPV
+LABELV $883
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $886
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRFP4 4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $888
+ADDRGP4 $884
+JUMPV
+LABELV $888
+LABELV $886
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 524
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 128
+NEI4 $890
+ADDRGP4 $885
+JUMPV
+LABELV $890
+LABELV $884
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 524
+INDIRP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $883
+LABELV $885
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $892
+CNSTP4 0
+RETP4
+ADDRGP4 $882
+JUMPV
+LABELV $892
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+ADDRLP4 528
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+RETP4
+LABELV $882
+endproc SelectRandomEntityFilter 532 12
+export SelectRandomEntity
+proc SelectRandomEntity 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+ADDRGP4 SelectRandomEntityFilter
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $894
+endproc SelectRandomEntity 4 8
+export SelectRandomTeamSpawnPoint
+proc SelectRandomTeamSpawnPoint 152 12
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+NEI4 $896
+ADDRGP4 level+9236
+INDIRI4
+ADDRGP4 level+9256
+INDIRI4
+ADDI4
+CNSTI4 2
+MODI4
+CNSTI4 1
+NEI4 $899
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $903
+ADDRFP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $904
+JUMPV
+LABELV $903
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $905
+ADDRFP4 4
+CNSTI4 1
+ASGNI4
+LABELV $905
+LABELV $904
+LABELV $899
+LABELV $896
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $907
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $909
+ADDRLP4 8
+ADDRGP4 $911
+ASGNP4
+ADDRGP4 $908
+JUMPV
+LABELV $909
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $912
+ADDRLP4 8
+ADDRGP4 $914
+ASGNP4
+ADDRGP4 $908
+JUMPV
+LABELV $912
+CNSTP4 0
+RETP4
+ADDRGP4 $895
+JUMPV
+LABELV $907
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $915
+ADDRLP4 8
+ADDRGP4 $917
+ASGNP4
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $918
+ADDRLP4 8
+ADDRGP4 $920
+ASGNP4
+ADDRGP4 $919
+JUMPV
+LABELV $918
+CNSTP4 0
+RETP4
+ADDRGP4 $895
+JUMPV
+LABELV $919
+LABELV $916
+LABELV $908
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $924
+ADDRGP4 $922
+JUMPV
+LABELV $924
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $926
+ADDRGP4 $923
+JUMPV
+LABELV $926
+LABELV $922
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $921
+LABELV $923
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $928
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $895
+JUMPV
+LABELV $928
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $895
+endproc SelectRandomTeamSpawnPoint 152 12
+export SelectRandomDDSpawnPoint
+proc SelectRandomDDSpawnPoint 152 12
+ADDRLP4 8
+ADDRGP4 $931
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $933
+JUMPV
+LABELV $932
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $935
+ADDRGP4 $933
+JUMPV
+LABELV $935
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $937
+ADDRGP4 $934
+JUMPV
+LABELV $937
+LABELV $933
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $932
+LABELV $934
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $939
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $930
+JUMPV
+LABELV $939
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $930
+endproc SelectRandomDDSpawnPoint 152 12
+export SelectRandomTeamDDSpawnPoint
+proc SelectRandomTeamDDSpawnPoint 152 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $942
+ADDRLP4 8
+ADDRGP4 $944
+ASGNP4
+ADDRGP4 $943
+JUMPV
+LABELV $942
+ADDRLP4 8
+ADDRGP4 $945
+ASGNP4
+LABELV $943
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $947
+JUMPV
+LABELV $946
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $949
+ADDRGP4 $947
+JUMPV
+LABELV $949
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $951
+ADDRGP4 $948
+JUMPV
+LABELV $951
+LABELV $947
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $946
+LABELV $948
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $953
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $941
+JUMPV
+LABELV $953
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $941
+endproc SelectRandomTeamDDSpawnPoint 152 12
+export SelectRandomTeamDomSpawnPoint
+proc SelectRandomTeamDomSpawnPoint 152 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $956
+ADDRLP4 8
+ADDRGP4 $958
+ASGNP4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRLP4 8
+ADDRGP4 $959
+ASGNP4
+LABELV $957
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $961
+JUMPV
+LABELV $960
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $963
+ADDRGP4 $961
+JUMPV
+LABELV $963
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $965
+ADDRGP4 $962
+JUMPV
+LABELV $965
+LABELV $961
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $960
+LABELV $962
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $967
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $955
+JUMPV
+LABELV $967
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $955
+endproc SelectRandomTeamDomSpawnPoint 152 12
+export SelectCTFSpawnPoint
+proc SelectCTFSpawnPoint 12 16
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SelectRandomTeamSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $970
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $969
+JUMPV
+LABELV $970
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $969
+endproc SelectCTFSpawnPoint 12 16
+export SelectDoubleDominationSpawnPoint
+proc SelectDoubleDominationSpawnPoint 12 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SelectRandomTeamDDSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $973
+ADDRLP4 8
+ADDRGP4 SelectRandomDDSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $973
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $975
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $972
+JUMPV
+LABELV $975
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $972
+endproc SelectDoubleDominationSpawnPoint 12 16
+export SelectDominationSpawnPoint
+proc SelectDominationSpawnPoint 12 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SelectRandomTeamDomSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $978
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $977
+JUMPV
+LABELV $978
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $977
+endproc SelectDominationSpawnPoint 12 16
+proc SortClients 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+SUBI4
+RETI4
+LABELV $980
+endproc SortClients 0 0
+export TeamplayInfoMessage
+proc TeamplayInfoMessage 9412 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $982
+ADDRGP4 $981
+JUMPV
+LABELV $982
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $984
+ADDRLP4 9380
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 9380
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $988
+ADDRLP4 9380
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $986
+LABELV $988
+ADDRGP4 $981
+JUMPV
+LABELV $986
+ADDRLP4 12
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $985
+JUMPV
+LABELV $984
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $985
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $990
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $990
+ADDRGP4 $981
+JUMPV
+LABELV $990
+ADDRLP4 9384
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 9384
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9384
+INDIRI4
+ASGNI4
+ADDRGP4 $995
+JUMPV
+LABELV $992
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $998
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $998
+ADDRLP4 9392
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9392
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 9396
+CNSTI4 2
+ASGNI4
+ADDRLP4 9392
+INDIRI4
+ADDRLP4 9396
+INDIRI4
+LSHI4
+ADDRLP4 9252
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 9396
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $998
+LABELV $993
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $995
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+GEI4 $1002
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $1002
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $992
+LABELV $1002
+ADDRLP4 9252
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 SortClients
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRLP4 1060
+CNSTI1 0
+ASGNI1
+ADDRLP4 9392
+CNSTI4 0
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 9392
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 9392
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9392
+INDIRI4
+ASGNI4
+ADDRGP4 $1006
+JUMPV
+LABELV $1003
+ADDRLP4 4
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1008
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1008
+ADDRLP4 9400
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 9400
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 9400
+INDIRP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 9400
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 9400
+INDIRP4
+INDIRP4
+CNSTI4 1248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+ADDRLP4 9404
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 9404
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 9404
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 9404
+INDIRI4
+ASGNI4
+LABELV $1010
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+GEI4 $1012
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $1012
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+GEI4 $1014
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $1014
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1016
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 9408
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 9408
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+ADDI4
+CVIU4 4
+CNSTU4 8192
+LEU4 $1017
+ADDRGP4 $1005
+JUMPV
+LABELV $1017
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1060
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1048
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1008
+LABELV $1004
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1006
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+GEI4 $1020
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+GEI4 $1020
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $1003
+LABELV $1020
+LABELV $1005
+ADDRGP4 $1021
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ARGP4
+ADDRLP4 9400
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 816
+DIVI4
+ARGI4
+ADDRLP4 9400
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $981
+endproc TeamplayInfoMessage 9412 36
+export CheckTeamStatus
+proc CheckTeamStatus 24 4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $1023
+ADDRGP4 level+60
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1029
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1034
+ADDRGP4 $1030
+JUMPV
+LABELV $1034
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $1038
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $1036
+LABELV $1038
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1039
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1040
+JUMPV
+LABELV $1039
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1040
+LABELV $1036
+LABELV $1030
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1032
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1029
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1044
+JUMPV
+LABELV $1041
+ADDRLP4 0
+CNSTI4 816
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1046
+ADDRGP4 $1042
+JUMPV
+LABELV $1046
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TeamplayInfoMessage
+CALLV
+pop
+LABELV $1048
+LABELV $1042
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1044
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $1041
+LABELV $1023
+LABELV $1022
+endproc CheckTeamStatus 24 4
+export SP_team_CTF_redplayer
+proc SP_team_CTF_redplayer 0 0
+LABELV $1050
+endproc SP_team_CTF_redplayer 0 0
+export SP_team_CTF_blueplayer
+proc SP_team_CTF_blueplayer 0 0
+LABELV $1051
+endproc SP_team_CTF_blueplayer 0 0
+export SP_team_CTF_redspawn
+proc SP_team_CTF_redspawn 0 0
+LABELV $1052
+endproc SP_team_CTF_redspawn 0 0
+export SP_team_CTF_bluespawn
+proc SP_team_CTF_bluespawn 0 0
+LABELV $1053
+endproc SP_team_CTF_bluespawn 0 0
+proc ObeliskHealthChange 8 0
+ADDRLP4 0
+CNSTI4 100
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1056
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1056
+ADDRLP4 4
+ADDRGP4 level+9468
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1059
+ADDRLP4 4
+ADDRGP4 level+9472
+INDIRI4
+ASGNI4
+LABELV $1059
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1062
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1064
+ADDRGP4 level+9468
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1065
+JUMPV
+LABELV $1064
+ADDRGP4 level+9472
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1065
+ADDRGP4 level+9476
+CNSTI4 1
+ASGNI4
+ADDRGP4 ObeliskHealthMessage
+CALLV
+pop
+LABELV $1062
+LABELV $1054
+endproc ObeliskHealthChange 8 0
+proc ObeliskRegen 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_obeliskRegenPeriod+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ObeliskHealthChange
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+LTI4 $1072
+ADDRGP4 $1069
+JUMPV
+LABELV $1072
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 63
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 g_obeliskRegenAmount+12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+LEI4 $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+ASGNI4
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 255
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1069
+endproc ObeliskRegen 12 12
+proc ObeliskRespawn 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 ObeliskRegen
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_obeliskRegenPeriod+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1081
+endproc ObeliskRespawn 0 0
+proc ObeliskDie 44 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 ObeliskRespawn
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_obeliskRespawnDelay+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 69
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 304
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $769
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $1089
+ARGP4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1090
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 32
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1090
+ADDRGP4 level+9428
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1090
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 303
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $1090
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ObeliskHealthChange
+CALLV
+pop
+ADDRGP4 teamgame+28
+CNSTI4 0
+ASGNI4
+ADDRGP4 teamgame+32
+CNSTI4 0
+ASGNI4
+LABELV $1085
+endproc ObeliskDie 44 24
+proc ObeliskTouch 64 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1096
+ADDRGP4 $1095
+JUMPV
+LABELV $1096
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+EQI4 $1098
+ADDRGP4 $1095
+JUMPV
+LABELV $1098
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $1100
+ADDRGP4 $1095
+JUMPV
+LABELV $1100
+CNSTP4 0
+ARGP4
+ADDRGP4 $1102
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LEI4 $1106
+ADDRLP4 12
+ADDRGP4 $1103
+ASGNP4
+ADDRGP4 $1107
+JUMPV
+LABELV $1106
+ADDRLP4 12
+ADDRGP4 $1104
+ASGNP4
+LABELV $1107
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $1108
+ARGP4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LEI4 $1110
+ADDRLP4 20
+ADDRGP4 $1103
+ASGNP4
+ADDRGP4 $1111
+JUMPV
+LABELV $1110
+ADDRLP4 20
+ADDRGP4 $1104
+ASGNP4
+LABELV $1111
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 5
+ADDRLP4 4
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1148
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 304
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1116
+JUMPV
+LABELV $1113
+ADDRGP4 $320
+ARGP4
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $769
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1117
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 56
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1117
+ADDRGP4 level+9428
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1117
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 303
+ARGI4
+ADDRGP4 ChallengeMessage
+CALLV
+pop
+LABELV $1117
+LABELV $1114
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1116
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1113
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_CaptureFlagSound
+CALLV
+pop
+LABELV $1095
+endproc ObeliskTouch 64 40
+proc ObeliskPain 16 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1121
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1121
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 255
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+DIVI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1124
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 70
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $1124
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $1126
+ARGP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $1120
+endproc ObeliskPain 16 28
+proc SpawnObelisk 100 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+CNSTF4 1118699520
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 2048
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $1128
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 g_obeliskHealth+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 ObeliskDie
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ADDRGP4 ObeliskPain
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 ObeliskRegen
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_obeliskRegenPeriod+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $1128
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1134
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 ObeliskTouch
+ASGNP4
+LABELV $1134
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1137
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRGP4 $1138
+JUMPV
+LABELV $1137
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+CNSTF4 1166016512
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 16+4
+INDIRI4
+CNSTI4 0
+EQI4 $1141
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $1144
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRGP4 $1142
+JUMPV
+LABELV $1141
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 16+52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16+12
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+LABELV $1142
+LABELV $1138
+ADDRLP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1127
+endproc SpawnObelisk 100 28
+export SP_team_redobelisk
+proc SP_team_redobelisk 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LEI4 $1151
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+LEI4 $1148
+LABELV $1151
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $1147
+JUMPV
+LABELV $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 SpawnObelisk
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1152
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 SpawnObelisk
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $1147
+endproc SP_team_redobelisk 12 12
+export SP_team_blueobelisk
+proc SP_team_blueobelisk 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LEI4 $1162
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+LEI4 $1159
+LABELV $1162
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $1158
+JUMPV
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+NEI4 $1163
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 SpawnObelisk
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1163
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1166
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 SpawnObelisk
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1166
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $1158
+endproc SP_team_blueobelisk 12 12
+export SP_team_neutralobelisk
+proc SP_team_neutralobelisk 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+EQI4 $1170
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+EQI4 $1170
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 13
+EQI4 $1170
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $1169
+JUMPV
+LABELV $1170
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 7
+NEI4 $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SpawnObelisk
+CALLP4
+ASGNP4
+ADDRGP4 neutralObelisk
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 neutralObelisk
+INDIRP4
+CNSTI4 528
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $1169
+endproc SP_team_neutralobelisk 8 12
+export CheckObeliskAttack
+proc CheckObeliskAttack 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 ObeliskDie
+CVPU4 4
+EQU4 $1179
+CNSTI4 0
+RETI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1179
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1181
+CNSTI4 0
+RETI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1181
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+NEI4 $1183
+CNSTI4 1
+RETI4
+ADDRGP4 $1178
+JUMPV
+LABELV $1183
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1192
+ADDRGP4 teamgame+28
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 20000
+SUBI4
+LTI4 $1191
+LABELV $1192
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1185
+ADDRGP4 teamgame+32
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 20000
+SUBI4
+GEI4 $1185
+LABELV $1191
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1193
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 teamgame+28
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $1194
+JUMPV
+LABELV $1193
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 teamgame+32
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $1194
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $1185
+CNSTI4 0
+RETI4
+LABELV $1178
+endproc CheckObeliskAttack 12 8
+export ShuffleTeams
+proc ShuffleTeams 36 8
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $1203
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+NEI4 $1200
+LABELV $1203
+ADDRGP4 $1199
+JUMPV
+LABELV $1200
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1207
+JUMPV
+LABELV $1204
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+CNSTI4 816
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+CVPU4 4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 2140
+DIVI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1209
+ADDRGP4 $1205
+JUMPV
+LABELV $1209
+ADDRLP4 16
+CNSTI4 2140
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1024
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $1218
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $1214
+LABELV $1218
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LEI4 $1219
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1221
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $1222
+LABELV $1219
+CNSTI4 2140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1214
+LABELV $1205
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1207
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+72
+INDIRI4
+LTI4 $1204
+CNSTI4 2
+ARGI4
+ADDRGP4 $1226
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $1199
+endproc ShuffleTeams 36 8
+bss
+export dominationPointsSpawned
+align 4
+LABELV dominationPointsSpawned
+skip 4
+export dom_points
+align 4
+LABELV dom_points
+skip 24
+export ddB
+align 4
+LABELV ddB
+skip 4
+export ddA
+align 4
+LABELV ddA
+skip 4
+export neutralObelisk
+align 4
+LABELV neutralObelisk
+skip 4
+export teamgame
+align 4
+LABELV teamgame
+skip 36
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1226
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $1144
+byte 1 83
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1126
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1108
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1104
+byte 1 0
+align 1
+LABELV $1103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1102
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1089
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $1021
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1016
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $959
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $958
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $945
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $944
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $931
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 0
+align 1
+LABELV $920
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $917
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $914
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $911
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $881
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $880
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $841
+byte 1 68
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $831
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 44
+byte 1 0
+align 1
+LABELV $830
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $816
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $812
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $808
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $805
+byte 1 49
+byte 1 70
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $804
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $791
+byte 1 65
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $769
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 84
+byte 1 85
+byte 1 82
+byte 1 69
+byte 1 0
+align 1
+LABELV $761
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $757
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $753
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $752
+byte 1 49
+byte 1 70
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $751
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $743
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $739
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $735
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $715
+byte 1 68
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $714
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 66
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $704
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $694
+byte 1 68
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $693
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 65
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $640
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $636
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $635
+byte 1 49
+byte 1 70
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $631
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $625
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $595
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $581
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $563
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 32
+byte 1 40
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 41
+byte 1 0
+align 1
+LABELV $560
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 32
+byte 1 40
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 41
+byte 1 0
+align 1
+LABELV $557
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 32
+byte 1 40
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $547
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 32
+byte 1 40
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 41
+byte 1 0
+align 1
+LABELV $544
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 32
+byte 1 40
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 41
+byte 1 0
+align 1
+LABELV $541
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 32
+byte 1 40
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $527
+byte 1 68
+byte 1 79
+byte 1 77
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $525
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $520
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $519
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $515
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $514
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $493
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $492
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $489
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $480
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $479
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $478
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 10
+byte 1 0
+align 1
+LABELV $475
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $466
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $396
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $394
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $389
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $385
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $383
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $321
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 69
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $320
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $309
+byte 1 72
+byte 1 65
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $308
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $297
+byte 1 49
+byte 1 102
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $292
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $288
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $284
+byte 1 80
+byte 1 79
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $283
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $282
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $110
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 115
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $105
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $104
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $101
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $98
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $87
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 0
+align 1
+LABELV $86
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $83
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 0
+align 1
+LABELV $80
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 0
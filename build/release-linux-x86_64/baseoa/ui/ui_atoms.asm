@@ -0,0 +1,5914 @@
+export Com_Error
+code
+proc Com_Error 1032 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $82
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $80
+endproc Com_Error 1032 16
+export Com_Printf
+proc Com_Printf 1032 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $82
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $83
+endproc Com_Printf 1032 16
+export UI_ClampCvar
+proc UI_ClampCvar 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $86
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $85
+JUMPV
+LABELV $86
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $88
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $85
+JUMPV
+LABELV $88
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $85
+endproc UI_ClampCvar 0 0
+export UI_StartDemoLoop
+proc UI_StartDemoLoop 0 8
+CNSTI4 2
+ARGI4
+ADDRGP4 $91
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $90
+endproc UI_StartDemoLoop 0 8
+export UI_PushMenu
+proc UI_PushMenu 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $93
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $98
+ADDRGP4 uis+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $98
+LABELV $94
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $96
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+16
+INDIRI4
+LTI4 $93
+LABELV $95
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+16
+INDIRI4
+NEI4 $102
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 8
+LTI4 $105
+ADDRGP4 $108
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $105
+ADDRLP4 12
+ADDRGP4 uis+16
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $102
+ADDRGP4 uis+20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 m_entersound
+CNSTI4 1
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+NEU4 $116
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $116
+LABELV $113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $112
+LABELV $114
+ADDRGP4 uis+11448
+CNSTI4 1
+ASGNI4
+LABELV $92
+endproc UI_PushMenu 16 8
+export UI_PopMenu
+proc UI_PopMenu 4 8
+ADDRGP4 menu_out_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 uis+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 0
+GEI4 $121
+ADDRGP4 $124
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $121
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 0
+EQI4 $125
+ADDRGP4 uis+20
+ADDRGP4 uis+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+24-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 uis+11448
+CNSTI4 1
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+LABELV $126
+LABELV $119
+endproc UI_PopMenu 4 8
+export UI_ForceMenuOff
+proc UI_ForceMenuOff 4 8
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 uis+20
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRGP4 $136
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $133
+endproc UI_ForceMenuOff 4 8
+export UI_LerpColor
+proc UI_LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $139
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $145
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $145
+LABELV $144
+LABELV $140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $139
+LABELV $138
+endproc UI_LerpColor 12 0
+data
+align 4
+LABELV propMap
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 11
+byte 4 122
+byte 4 7
+byte 4 154
+byte 4 181
+byte 4 14
+byte 4 55
+byte 4 122
+byte 4 17
+byte 4 79
+byte 4 122
+byte 4 18
+byte 4 101
+byte 4 122
+byte 4 23
+byte 4 153
+byte 4 122
+byte 4 18
+byte 4 9
+byte 4 93
+byte 4 7
+byte 4 207
+byte 4 122
+byte 4 8
+byte 4 230
+byte 4 122
+byte 4 9
+byte 4 177
+byte 4 122
+byte 4 18
+byte 4 30
+byte 4 152
+byte 4 18
+byte 4 85
+byte 4 181
+byte 4 7
+byte 4 34
+byte 4 93
+byte 4 11
+byte 4 110
+byte 4 181
+byte 4 6
+byte 4 130
+byte 4 152
+byte 4 14
+byte 4 22
+byte 4 64
+byte 4 17
+byte 4 41
+byte 4 64
+byte 4 12
+byte 4 58
+byte 4 64
+byte 4 17
+byte 4 78
+byte 4 64
+byte 4 18
+byte 4 98
+byte 4 64
+byte 4 19
+byte 4 120
+byte 4 64
+byte 4 18
+byte 4 141
+byte 4 64
+byte 4 18
+byte 4 204
+byte 4 64
+byte 4 16
+byte 4 162
+byte 4 64
+byte 4 17
+byte 4 182
+byte 4 64
+byte 4 18
+byte 4 59
+byte 4 181
+byte 4 7
+byte 4 35
+byte 4 181
+byte 4 7
+byte 4 203
+byte 4 152
+byte 4 14
+byte 4 56
+byte 4 93
+byte 4 14
+byte 4 228
+byte 4 152
+byte 4 14
+byte 4 177
+byte 4 181
+byte 4 18
+byte 4 28
+byte 4 122
+byte 4 22
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 60
+byte 4 152
+byte 4 7
+byte 4 106
+byte 4 151
+byte 4 13
+byte 4 83
+byte 4 152
+byte 4 7
+byte 4 128
+byte 4 122
+byte 4 17
+byte 4 4
+byte 4 152
+byte 4 21
+byte 4 134
+byte 4 181
+byte 4 5
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 153
+byte 4 152
+byte 4 13
+byte 4 11
+byte 4 181
+byte 4 5
+byte 4 180
+byte 4 152
+byte 4 13
+byte 4 79
+byte 4 93
+byte 4 17
+byte 4 0
+byte 4 0
+byte 4 -1
+align 4
+LABELV propMapB
+byte 4 11
+byte 4 12
+byte 4 33
+byte 4 49
+byte 4 12
+byte 4 31
+byte 4 85
+byte 4 12
+byte 4 31
+byte 4 120
+byte 4 12
+byte 4 30
+byte 4 156
+byte 4 12
+byte 4 21
+byte 4 183
+byte 4 12
+byte 4 21
+byte 4 207
+byte 4 12
+byte 4 32
+byte 4 13
+byte 4 55
+byte 4 30
+byte 4 49
+byte 4 55
+byte 4 13
+byte 4 66
+byte 4 55
+byte 4 29
+byte 4 101
+byte 4 55
+byte 4 31
+byte 4 135
+byte 4 55
+byte 4 21
+byte 4 158
+byte 4 55
+byte 4 40
+byte 4 204
+byte 4 55
+byte 4 32
+byte 4 12
+byte 4 97
+byte 4 31
+byte 4 48
+byte 4 97
+byte 4 31
+byte 4 82
+byte 4 97
+byte 4 30
+byte 4 118
+byte 4 97
+byte 4 30
+byte 4 153
+byte 4 97
+byte 4 30
+byte 4 185
+byte 4 97
+byte 4 25
+byte 4 213
+byte 4 97
+byte 4 30
+byte 4 11
+byte 4 139
+byte 4 32
+byte 4 42
+byte 4 139
+byte 4 51
+byte 4 93
+byte 4 139
+byte 4 32
+byte 4 126
+byte 4 139
+byte 4 31
+byte 4 158
+byte 4 139
+byte 4 25
+code
+proc UI_DrawBannerString2 60 36
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRGP4 uis+11440
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $154
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1098907648
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 40
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $157
+ADDRLP4 40
+INDIRI4
+CNSTI4 90
+GTI4 $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 65
+SUBI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1041235968
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1108344832
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 uis+11416
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $157
+LABELV $155
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $152
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $151
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $147
+endproc UI_DrawBannerString2 60 36
+export UI_DrawBannerString
+proc UI_DrawBannerString 44 16
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $168
+JUMPV
+LABELV $167
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $170
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $172
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 propMapB-780+8
+ADDP4
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDI4
+ASGNI4
+LABELV $172
+LABELV $171
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $168
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $167
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $179
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $180
+ADDRGP4 $177
+JUMPV
+LABELV $179
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $180
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $177
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $182
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_DrawBannerString2
+CALLV
+pop
+LABELV $182
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawBannerString2
+CALLV
+pop
+LABELV $166
+endproc UI_DrawBannerString 44 16
+export UI_ProportionalStringWidth
+proc UI_ProportionalStringWidth 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $192
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $189
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $188
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $187
+endproc UI_ProportionalStringWidth 16 0
+proc UI_DrawProportionalString2 60 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRGP4 uis+11440
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $201
+ADDRLP4 8
+CNSTF4 1090519040
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $204
+ADDRLP4 40
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1037565952
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1104674816
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $204
+LABELV $202
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1077936128
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $199
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $198
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $194
+endproc UI_DrawProportionalString2 60 36
+export UI_ProportionalSizeScale
+proc UI_ProportionalSizeScale 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $214
+CNSTF4 1061158912
+RETF4
+ADDRGP4 $213
+JUMPV
+LABELV $214
+CNSTF4 1065353216
+RETF4
+LABELV $213
+endproc UI_ProportionalSizeScale 0 0
+export UI_DrawProportionalString
+proc UI_DrawProportionalString 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $218
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $220
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $221
+ADDRGP4 $218
+JUMPV
+LABELV $220
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $221
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $218
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $223
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+11408
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $223
+ADDRFP4 12
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 36
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1060320051
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+11408
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $216
+JUMPV
+LABELV $229
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $235
+ADDRLP4 36
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1060320051
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+11408
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+11412
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $216
+JUMPV
+LABELV $235
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 uis+11408
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $216
+endproc UI_DrawProportionalString 52 24
+export UI_DrawProportionalString_AutoWrapped
+proc UI_DrawProportionalString_AutoWrapped 1072 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $250
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $248
+LABELV $250
+ADDRGP4 $247
+JUMPV
+LABELV $248
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+ASGNP4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+LABELV $254
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $255
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+EQI4 $257
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $254
+LABELV $257
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $258
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $260
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $260
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $262
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $253
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $253
+JUMPV
+LABELV $262
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $266
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $253
+JUMPV
+LABELV $266
+LABELV $259
+LABELV $252
+ADDRGP4 $251
+JUMPV
+LABELV $253
+LABELV $247
+endproc UI_DrawProportionalString_AutoWrapped 1072 20
+proc UI_DrawString2 76 36
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEGI4
+GEI4 $269
+ADDRGP4 $268
+JUMPV
+LABELV $269
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRGP4 uis+11440
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $279
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $279
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 56
+INDIRI4
+CNSTI4 48
+LTI4 $279
+ADDRLP4 56
+INDIRI4
+CNSTI4 56
+GTI4 $279
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 24+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $281
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $277
+JUMPV
+LABELV $279
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 255
+BANDI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $284
+ADDRLP4 60
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 64
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+RSHI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRI4
+CNSTI4 15
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 uis+11404
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $284
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $277
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $276
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $268
+endproc UI_DrawString2 76 36
+export UI_DrawString
+proc UI_DrawString 84 24
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $288
+ADDRGP4 $287
+JUMPV
+LABELV $288
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $290
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+ADDRLP4 64
+INDIRI4
+EQI4 $290
+ADDRGP4 $287
+JUMPV
+LABELV $290
+ADDRFP4 12
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $293
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+CNSTI4 16
+ASGNI4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRFP4 12
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $295
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+ADDRLP4 4
+CNSTI4 48
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 68
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $296
+LABELV $294
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $297
+ADDRLP4 68
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 68
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 76
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 UI_LerpColor
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+ASGNP4
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRLP4 24
+ADDRFP4 16
+INDIRP4
+ASGNP4
+LABELV $298
+ADDRLP4 68
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+EQI4 $306
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+EQI4 $307
+ADDRGP4 $304
+JUMPV
+LABELV $306
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $304
+JUMPV
+LABELV $307
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+LABELV $304
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $308
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 28+12
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $308
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawString2
+CALLV
+pop
+LABELV $287
+endproc UI_DrawString 84 24
+export UI_DrawChar
+proc UI_DrawChar 2 20
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0+1
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $313
+endproc UI_DrawChar 2 20
+export UI_IsFullscreen
+proc UI_IsFullscreen 4 0
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $316
+ADDRLP4 0
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $316
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $315
+JUMPV
+LABELV $316
+CNSTI4 0
+RETI4
+LABELV $315
+endproc UI_IsFullscreen 4 0
+proc NeedCDAction 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $321
+CNSTI4 2
+ARGI4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $321
+LABELV $320
+endproc NeedCDAction 0 8
+proc NeedCDKeyAction 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $325
+CNSTI4 2
+ARGI4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $325
+LABELV $324
+endproc NeedCDKeyAction 0 8
+export UI_SetActiveMenu
+proc UI_SetActiveMenu 8 12
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $328
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $328
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $341
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $341
+address $331
+address $332
+address $337
+address $333
+address $335
+address $339
+address $339
+code
+LABELV $331
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $332
+ADDRGP4 UI_MainMenu
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $333
+ADDRGP4 $334
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 NeedCDAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $335
+ADDRGP4 $336
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 NeedCDKeyAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $337
+ADDRGP4 $136
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_InGameMenu
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $339
+LABELV $328
+ADDRGP4 $340
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $329
+LABELV $327
+endproc UI_SetActiveMenu 8 12
+export UI_KeyEvent
+proc UI_KeyEvent 16 8
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $343
+ADDRGP4 $342
+JUMPV
+LABELV $343
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $346
+ADDRGP4 $342
+JUMPV
+LABELV $346
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $348
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $353
+ADDRLP4 0
+INDIRI4
+ADDRGP4 menu_null_sound
+INDIRI4
+EQI4 $353
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $353
+LABELV $342
+endproc UI_KeyEvent 16 8
+export UI_MouseEvent
+proc UI_MouseEvent 24 8
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $356
+ADDRGP4 $355
+JUMPV
+LABELV $356
+ADDRLP4 8
+ADDRGP4 uis+8
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11440
+INDIRF4
+NEGF4
+GEF4 $360
+ADDRGP4 uis+8
+ADDRGP4 uis+11440
+INDIRF4
+NEGF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRGP4 uis+8
+INDIRI4
+CVIF4 4
+ADDRGP4 uis+11440
+INDIRF4
+CNSTF4 1142947840
+ADDF4
+LEF4 $366
+ADDRGP4 uis+8
+ADDRGP4 uis+11440
+INDIRF4
+CNSTF4 1142947840
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $366
+LABELV $361
+ADDRLP4 12
+ADDRGP4 uis+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uis+12
+INDIRI4
+CNSTI4 0
+GEI4 $373
+ADDRGP4 uis+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRGP4 uis+12
+INDIRI4
+CNSTI4 480
+LEI4 $377
+ADDRGP4 uis+12
+CNSTI4 480
+ASGNI4
+LABELV $377
+LABELV $374
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $381
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+CNSTU4 0
+EQU4 $387
+ADDRGP4 $382
+JUMPV
+LABELV $387
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $397
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+GTI4 $397
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+LTI4 $397
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+LEI4 $389
+LABELV $397
+ADDRGP4 $382
+JUMPV
+LABELV $389
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $398
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1048576
+BANDU4
+CNSTU4 0
+NEU4 $404
+ADDRGP4 menu_move_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $404
+LABELV $398
+ADDRLP4 20
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 512
+BORU4
+ASGNU4
+ADDRGP4 $355
+JUMPV
+LABELV $382
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $384
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $381
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $410
+ADDRLP4 16
+ADDRGP4 uis+20
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294966783
+BANDU4
+ASGNU4
+LABELV $410
+LABELV $355
+endproc UI_MouseEvent 24 8
+bss
+align 1
+LABELV $416
+skip 1024
+export UI_Argv
+code
+proc UI_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $416
+RETP4
+LABELV $415
+endproc UI_Argv 0 12
+bss
+align 1
+LABELV $418
+skip 1024
+export UI_Cvar_VariableString
+code
+proc UI_Cvar_VariableString 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $418
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $418
+RETP4
+LABELV $417
+endproc UI_Cvar_VariableString 0 12
+export UI_Cache_f
+proc UI_Cache_f 0 0
+ADDRGP4 MainMenu_Cache
+CALLV
+pop
+ADDRGP4 InGame_Cache
+CALLV
+pop
+ADDRGP4 ConfirmMenu_Cache
+CALLV
+pop
+ADDRGP4 PlayerModel_Cache
+CALLV
+pop
+ADDRGP4 PlayerSettings_Cache
+CALLV
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 Demos_Cache
+CALLV
+pop
+ADDRGP4 UI_CinematicsMenu_Cache
+CALLV
+pop
+ADDRGP4 Preferences_Cache
+CALLV
+pop
+ADDRGP4 ServerInfo_Cache
+CALLV
+pop
+ADDRGP4 SpecifyServer_Cache
+CALLV
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SPSkillMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_SPPostgameMenu_Cache
+CALLV
+pop
+ADDRGP4 TeamMain_Cache
+CALLV
+pop
+ADDRGP4 UI_AddBots_Cache
+CALLV
+pop
+ADDRGP4 UI_RemoveBots_Cache
+CALLV
+pop
+ADDRGP4 UI_SetupMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_CDKeyMenu_Cache
+CALLV
+pop
+ADDRGP4 UI_ModsMenu_Cache
+CALLV
+pop
+LABELV $419
+endproc UI_Cache_f 0 0
+export UI_ConsoleCommand
+proc UI_ConsoleCommand 96 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uis+4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $423
+ADDRGP4 UI_SPLevelMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $423
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $428
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $426
+ADDRGP4 UI_SPPostgameMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $426
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $431
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $429
+ADDRGP4 UI_Cache_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $429
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $434
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $432
+ADDRGP4 UI_CinematicsMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $432
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $435
+ADDRGP4 UI_TeamOrdersMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $435
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $440
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRGP4 UI_SPUnlock_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $438
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $443
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $441
+ADDRGP4 UI_SPUnlockMedals_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $441
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $446
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $444
+ADDRGP4 UI_CDKeyMenu_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $444
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $449
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $447
+CNSTI4 1
+ARGI4
+ADDRLP4 48
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 mappage
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 56
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 60
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+32
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+64
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 5
+ARGI4
+ADDRLP4 68
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+96
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 6
+ARGI4
+ADDRLP4 72
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+128
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 7
+ARGI4
+ADDRLP4 76
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+160
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 8
+ARGI4
+ADDRLP4 80
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+192
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 9
+ARGI4
+ADDRLP4 84
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+224
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 10
+ARGI4
+ADDRLP4 88
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+256
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 11
+ARGI4
+ADDRLP4 92
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRGP4 mappage+4+288
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 UI_VoteMapMenuInternal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $447
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $469
+ADDRGP4 WriteMapList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $420
+JUMPV
+LABELV $469
+CNSTI4 0
+RETI4
+LABELV $420
+endproc UI_ConsoleCommand 96 12
+export UI_Shutdown
+proc UI_Shutdown 0 0
+LABELV $472
+endproc UI_Shutdown 0 0
+export UI_Init
+proc UI_Init 28 4
+ADDRGP4 UI_RegisterCvars
+CALLV
+pop
+ADDRGP4 UI_InitGameinfo
+CALLV
+pop
+ADDRGP4 uis+56
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 uis+56+11304
+INDIRU4
+ASGNU4
+ADDRGP4 uis+11432
+CNSTF4 986500301
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 uis+56+11308
+INDIRU4
+ASGNU4
+ADDRGP4 uis+11436
+CNSTF4 990414985
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+MULF4
+ASGNF4
+CNSTU4 480
+ADDRGP4 uis+56+11304
+INDIRU4
+MULU4
+CNSTU4 640
+ADDRGP4 uis+56+11308
+INDIRU4
+MULU4
+LEU4 $481
+ADDRLP4 8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 12
+ADDRGP4 uis+56+11304
+INDIRU4
+ASGNU4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTU4 1
+ASGNU4
+ADDRLP4 24
+ADDRGP4 uis+56+11308
+INDIRU4
+ASGNU4
+ADDRGP4 uis+11440
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRU4
+ADDRLP4 16
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 12
+INDIRU4
+ADDRLP4 20
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+CNSTF4 1068149419
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 16
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 20
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 uis+11432
+ADDRGP4 uis+11436
+INDIRF4
+ASGNF4
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRGP4 uis+11440
+CNSTF4 0
+ASGNF4
+LABELV $482
+ADDRGP4 Menu_Cache
+CALLV
+pop
+ADDRGP4 uis+20
+CNSTP4 0
+ASGNP4
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+LABELV $473
+endproc UI_Init 28 4
+export UI_AdjustFrom640
+proc UI_AdjustFrom640 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ADDRGP4 uis+11440
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 uis+11432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 uis+11436
+INDIRF4
+MULF4
+ASGNF4
+LABELV $497
+endproc UI_AdjustFrom640 16 0
+export UI_DrawNamedPic
+proc UI_DrawNamedPic 16 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $503
+endproc UI_DrawNamedPic 16 36
+export UI_DrawHandlePic
+proc UI_DrawHandlePic 16 36
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $505
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $506
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $507
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $508
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $504
+endproc UI_DrawHandlePic 16 36
+export UI_DrawBackgroundPic
+proc UI_DrawBackgroundPic 28 36
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 8
+ADDRGP4 uis+56+11304
+INDIRU4
+ASGNU4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+CNSTU4 1
+ASGNU4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRU4
+ADDRLP4 12
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 8
+INDIRU4
+ADDRLP4 16
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 uis+56+11308
+INDIRU4
+ASGNU4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRU4
+ADDRLP4 12
+INDIRI4
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 20
+INDIRU4
+ADDRLP4 16
+INDIRU4
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $509
+endproc UI_DrawBackgroundPic 28 36
+export UI_FillRect
+proc UI_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $514
+endproc UI_FillRect 4 36
+export UI_DrawRect
+proc UI_DrawRect 24 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 uis+11392
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $516
+endproc UI_DrawRect 24 36
+export UI_SetColor
+proc UI_SetColor 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $521
+endproc UI_SetColor 0 4
+export UI_UpdateScreen
+proc UI_UpdateScreen 0 0
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $522
+endproc UI_UpdateScreen 0 0
+export UI_Refresh
+proc UI_Refresh 24 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uis+4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uis+4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 trap_Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $526
+ADDRGP4 $523
+JUMPV
+LABELV $526
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRGP4 uis+20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $528
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $531
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRGP4 uis+11396
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBackgroundPic
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRGP4 uis+11400
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBackgroundPic
+CALLV
+pop
+LABELV $535
+LABELV $531
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $539
+ADDRGP4 uis+20
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRGP4 uis+20
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $540
+ADDRGP4 uis+11448
+INDIRI4
+CNSTI4 0
+EQI4 $544
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+ADDRGP4 uis+11448
+CNSTI4 0
+ASGNI4
+LABELV $544
+LABELV $528
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 uis+11420
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 uis+11388
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRGP4 $554
+ARGP4
+ADDRGP4 uis+8
+INDIRI4
+ARGI4
+ADDRGP4 uis+12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $551
+ADDRGP4 m_entersound
+INDIRI4
+CNSTI4 0
+EQI4 $557
+ADDRGP4 menu_in_sound
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 m_entersound
+CNSTI4 0
+ASGNI4
+LABELV $557
+LABELV $523
+endproc UI_Refresh 24 20
+export UI_DrawTextBox
+proc UI_DrawTextBox 24 20
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $559
+endproc UI_DrawTextBox 24 20
+export UI_CursorInRect
+proc UI_CursorInRect 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $569
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $569
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+GTI4 $569
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+LEI4 $561
+LABELV $569
+CNSTI4 0
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $561
+CNSTI4 1
+RETI4
+LABELV $560
+endproc UI_CursorInRect 8 0
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+bss
+export uis
+align 4
+LABELV uis
+skip 11452
+export m_entersound
+align 4
+LABELV m_entersound
+skip 4
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $554
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $471
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $449
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $446
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $443
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $440
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $437
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $434
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $431
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $428
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $425
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $340
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $338
+byte 1 49
+byte 1 0
+align 1
+LABELV $336
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 67
+byte 1 68
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $334
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 67
+byte 1 68
+byte 1 0
+align 1
+LABELV $323
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $137
+byte 1 48
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $124
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 80
+byte 1 111
+byte 1 112
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $108
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 80
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $91
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $82
+byte 1 37
+byte 1 115
+byte 1 0
@@ -0,0 +1,7442 @@
+data
+align 4
+LABELV autoswitch_items
+address $83
+address $84
+address $85
+address $86
+address $87
+byte 4 0
+align 4
+LABELV controls_binding_color
+byte 4 1058306785
+byte 4 1060320051
+byte 4 1062165545
+byte 4 1065353216
+align 4
+LABELV g_bindings
+address $88
+address $89
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $90
+address $91
+byte 4 1
+byte 4 0
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $92
+address $93
+byte 4 2
+byte 4 1
+byte 4 138
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $94
+address $95
+byte 4 3
+byte 4 2
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $96
+address $97
+byte 4 4
+byte 4 3
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $98
+address $99
+byte 4 5
+byte 4 6
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $100
+address $101
+byte 4 6
+byte 4 7
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $102
+address $103
+byte 4 7
+byte 4 4
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $104
+address $105
+byte 4 8
+byte 4 5
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $106
+address $107
+byte 4 9
+byte 4 8
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $108
+address $109
+byte 4 10
+byte 4 9
+byte 4 135
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $110
+address $111
+byte 4 11
+byte 4 0
+byte 4 136
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $112
+address $113
+byte 4 12
+byte 4 10
+byte 4 141
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $114
+address $115
+byte 4 13
+byte 4 11
+byte 4 140
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $116
+address $117
+byte 4 14
+byte 4 0
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $118
+address $119
+byte 4 15
+byte 4 0
+byte 4 144
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $120
+address $121
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $122
+address $123
+byte 4 17
+byte 4 12
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $124
+address $125
+byte 4 18
+byte 4 13
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $126
+address $127
+byte 4 19
+byte 4 14
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $128
+address $129
+byte 4 20
+byte 4 15
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $130
+address $131
+byte 4 21
+byte 4 16
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $132
+address $133
+byte 4 22
+byte 4 17
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $134
+address $135
+byte 4 23
+byte 4 18
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $136
+address $137
+byte 4 24
+byte 4 19
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $138
+address $139
+byte 4 25
+byte 4 20
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $140
+address $141
+byte 4 26
+byte 4 21
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $142
+address $143
+byte 4 27
+byte 4 26
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $144
+address $145
+byte 4 28
+byte 4 27
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $146
+address $147
+byte 4 29
+byte 4 28
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $148
+address $149
+byte 4 30
+byte 4 22
+byte 4 137
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $150
+address $151
+byte 4 31
+byte 4 0
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $152
+address $153
+byte 4 32
+byte 4 0
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $154
+address $155
+byte 4 33
+byte 4 23
+byte 4 180
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $156
+address $157
+byte 4 34
+byte 4 25
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $158
+address $159
+byte 4 35
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $160
+address $161
+byte 4 36
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $162
+address $163
+byte 4 37
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $164
+address $165
+byte 4 38
+byte 4 25
+byte 4 113
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $166
+address $167
+byte 4 39
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_configcvars
+address $168
+byte 4 0
+byte 4 0
+address $169
+byte 4 0
+byte 4 0
+address $170
+byte 4 0
+byte 4 0
+address $171
+byte 4 0
+byte 4 0
+address $172
+byte 4 0
+byte 4 0
+address $173
+byte 4 0
+byte 4 0
+address $174
+byte 4 0
+byte 4 0
+address $175
+byte 4 0
+byte 4 0
+address $176
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV g_movement_controls
+address s_controls+3356
+address s_controls+1708
+address s_controls+1168
+address s_controls+1228
+address s_controls+1288
+address s_controls+1348
+address s_controls+1408
+address s_controls+1468
+address s_controls+1528
+address s_controls+1588
+address s_controls+1648
+byte 4 0
+align 4
+LABELV g_weapons_controls
+address s_controls+2548
+address s_controls+2668
+address s_controls+2608
+address s_controls+3540
+address s_controls+1828
+address s_controls+1768
+address s_controls+1888
+address s_controls+1948
+address s_controls+2008
+address s_controls+2068
+address s_controls+2128
+address s_controls+2188
+address s_controls+2248
+address s_controls+2308
+address s_controls+2368
+address s_controls+2428
+address s_controls+2488
+byte 4 0
+align 4
+LABELV g_looking_controls
+address s_controls+3216
+address s_controls+3292
+address s_controls+3152
+address s_controls+2728
+address s_controls+2788
+address s_controls+2848
+address s_controls+2908
+address s_controls+2972
+address s_controls+3032
+address s_controls+5564
+address s_controls+5628
+byte 4 0
+align 4
+LABELV g_misc_controls
+address s_controls+3420
+address s_controls+3480
+address s_controls+3636
+address s_controls+3092
+address s_controls+5200
+address s_controls+5260
+address s_controls+5320
+address s_controls+5380
+address s_controls+5440
+address s_controls+5500
+byte 4 0
+align 4
+LABELV g_controls
+address g_movement_controls
+address g_looking_controls
+address g_weapons_controls
+address g_misc_controls
+code
+proc Controls_InitCvars 28 8
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $227
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $231
+ADDRGP4 $229
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $228
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $227
+JUMPV
+LABELV $229
+LABELV $226
+endproc Controls_InitCvars 28 8
+proc Controls_GetCvarDefault 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $234
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $238
+CNSTF4 0
+RETF4
+ADDRGP4 $233
+JUMPV
+LABELV $238
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $240
+ADDRGP4 $236
+JUMPV
+LABELV $240
+LABELV $235
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $234
+JUMPV
+LABELV $236
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+RETF4
+LABELV $233
+endproc Controls_GetCvarDefault 12 8
+proc Controls_GetCvarValue 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_configcvars
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $243
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $247
+CNSTF4 0
+RETF4
+ADDRGP4 $242
+JUMPV
+LABELV $247
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRGP4 $245
+JUMPV
+LABELV $249
+LABELV $244
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $245
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+RETF4
+LABELV $242
+endproc Controls_GetCvarValue 12 8
+proc Controls_UpdateModel 20 28
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+5776+8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5776+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5776
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+5788+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5788+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5788
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5776+4
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 s_controls+5788+4
+ADDRGP4 s_controls+5776+4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5800
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+5804
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+5808
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+5812
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $273
+ADDRLP4 8
+INDIRI4
+CNSTI4 28
+GTI4 $273
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $342-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $342
+address $274
+address $276
+address $278
+address $280
+address $282
+address $290
+address $296
+address $284
+address $287
+address $302
+address $304
+address $306
+address $308
+address $310
+address $312
+address $314
+address $316
+address $318
+address $320
+address $322
+address $324
+address $332
+address $334
+address $336
+address $340
+address $326
+address $328
+address $330
+code
+LABELV $274
+ADDRGP4 s_controls+5800
+CNSTI4 15
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $276
+ADDRGP4 s_controls+5800
+CNSTI4 14
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $278
+ADDRGP4 s_controls+5800
+CNSTI4 16
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $280
+ADDRGP4 s_controls+5800
+CNSTI4 18
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $282
+ADDRGP4 s_controls+5800
+CNSTI4 23
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $284
+ADDRLP4 12
+ADDRGP4 s_controls+5776+4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $273
+JUMPV
+LABELV $287
+ADDRLP4 16
+ADDRGP4 s_controls+5776+4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $273
+JUMPV
+LABELV $290
+ADDRGP4 s_controls+5800
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+5788+4
+ADDRGP4 s_controls+5776+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $273
+JUMPV
+LABELV $296
+ADDRGP4 s_controls+5800
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+5788+4
+ADDRGP4 s_controls+5776+4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $273
+JUMPV
+LABELV $302
+ADDRGP4 s_controls+5776
+CNSTF4 3258187776
+ASGNF4
+ADDRGP4 $273
+JUMPV
+LABELV $304
+ADDRGP4 s_controls+5776
+CNSTF4 1110704128
+ASGNF4
+ADDRGP4 $273
+JUMPV
+LABELV $306
+ADDRGP4 s_controls+5808
+CNSTI4 1
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $308
+ADDRGP4 s_controls+5808
+CNSTI4 2
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $310
+ADDRGP4 s_controls+5808
+CNSTI4 3
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $312
+ADDRGP4 s_controls+5808
+CNSTI4 4
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $314
+ADDRGP4 s_controls+5808
+CNSTI4 5
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $316
+ADDRGP4 s_controls+5808
+CNSTI4 6
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $318
+ADDRGP4 s_controls+5808
+CNSTI4 7
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $320
+ADDRGP4 s_controls+5808
+CNSTI4 8
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $322
+ADDRGP4 s_controls+5808
+CNSTI4 9
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $324
+ADDRGP4 s_controls+5808
+CNSTI4 10
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $326
+ADDRGP4 s_controls+5808
+CNSTI4 11
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $328
+ADDRGP4 s_controls+5808
+CNSTI4 12
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $330
+ADDRGP4 s_controls+5808
+CNSTI4 13
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $332
+ADDRGP4 s_controls+5804
+CNSTI4 7
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $334
+ADDRGP4 s_controls+5804
+CNSTI4 6
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $336
+ADDRGP4 s_controls+5800
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+5804
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+5808
+CNSTI4 0
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $340
+ADDRGP4 s_controls+5812
+CNSTI4 1
+ASGNI4
+LABELV $273
+ADDRGP4 s_controls+3696
+ARGP4
+ADDRGP4 s_controls+5800
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5804
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5776
+ARGP4
+ADDRGP4 s_controls+5788
+ARGP4
+ADDRGP4 s_controls+5808
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5812
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $251
+endproc Controls_UpdateModel 20 28
+proc Controls_Update 96 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $352
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $356
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $357
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $359
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $356
+LABELV $353
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $352
+ADDRLP4 8
+ADDRGP4 s_controls+5704
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_controls
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $361
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294938623
+BANDU4
+ASGNU4
+LABELV $362
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $364
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $361
+ADDRLP4 16
+CNSTI4 480
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $365
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 320
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 488
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $366
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $368
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $365
+ADDRGP4 s_controls+5708
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $375
+JUMPV
+LABELV $372
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $373
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $375
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $372
+ADDRLP4 28
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+5904+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $351
+JUMPV
+LABELV $369
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $381
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $382
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $384
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $381
+ADDRLP4 28
+ADDRGP4 s_controls+952+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+880+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 s_controls+1024+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 s_controls+1096+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 s_controls+952+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 s_controls+880+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 s_controls+1024+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 s_controls+1096+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 s_controls+5704
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $403
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+GTI4 $403
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $426
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $426
+address $406
+address $411
+address $416
+address $421
+code
+LABELV $406
+ADDRLP4 64
+ADDRGP4 s_controls+880+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 s_controls+880+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $404
+JUMPV
+LABELV $411
+ADDRLP4 72
+ADDRGP4 s_controls+952+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 s_controls+952+44
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $404
+JUMPV
+LABELV $416
+ADDRLP4 80
+ADDRGP4 s_controls+1024+44
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 84
+ADDRGP4 s_controls+1024+44
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $404
+JUMPV
+LABELV $421
+ADDRLP4 88
+ADDRGP4 s_controls+1096+44
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 92
+ADDRGP4 s_controls+1096+44
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+LABELV $403
+LABELV $404
+LABELV $351
+endproc Controls_Update 96 0
+proc Controls_DrawKeyBinding 120 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+NEU4 $429
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+LABELV $430
+ADDRLP4 48
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 -1
+NEI4 $432
+ADDRLP4 12
+ARGP4
+ADDRGP4 $434
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 -1
+EQI4 $436
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $436
+LABELV $433
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $439
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16400
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 s_controls+5708
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 61
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $445
+ARGP4
+CNSTI4 16401
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $442
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 374
+ARGI4
+ADDRGP4 $446
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 393
+ARGI4
+ADDRGP4 $447
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $448
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 controls_binding_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $449
+LABELV $440
+LABELV $427
+endproc Controls_DrawKeyBinding 120 20
+proc Controls_StatusBar 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $453
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $452
+endproc Controls_StatusBar 0 20
+proc Controls_DrawPlayer 76 24
+ADDRGP4 $455
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 s_controls+5712
+ARGP4
+ADDRLP4 68
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $456
+ADDRGP4 s_controls+3696
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_controls+5712
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $456
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_controls+3696
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $454
+endproc Controls_DrawPlayer 76 24
+proc Controls_GetKeyAssignment 280 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $464
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $468
+ADDRGP4 $465
+JUMPV
+LABELV $468
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $470
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+NEI4 $472
+ADDRGP4 $466
+JUMPV
+LABELV $472
+LABELV $470
+LABELV $465
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $464
+LABELV $466
+LABELV $463
+endproc Controls_GetKeyAssignment 280 12
+proc Controls_GetConfig 88 12
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $475
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $479
+ADDRGP4 $477
+JUMPV
+LABELV $479
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $476
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $475
+JUMPV
+LABELV $477
+ADDRGP4 $169
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $485
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $486
+ADDRGP4 s_controls+3152+60
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3292+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3356+60
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3540+64
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 48
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1106247680
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3216+68
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 56
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5564+60
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 64
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1028443341
+ARGF4
+CNSTF4 1061158912
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5628+68
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 72
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2908+60
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 80
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 UI_ClampCvar
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5500+60
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $474
+endproc Controls_GetConfig 88 12
+proc Controls_SetConfig 24 8
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $504
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $508
+ADDRGP4 $506
+JUMPV
+LABELV $508
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $510
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $512
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $512
+LABELV $510
+LABELV $505
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $504
+JUMPV
+LABELV $506
+ADDRGP4 s_controls+3152+60
+INDIRI4
+CNSTI4 0
+EQI4 $514
+ADDRGP4 $169
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 12
+INDIRF4
+NEGF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRGP4 $169
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $515
+ADDRGP4 $174
+ARGP4
+ADDRGP4 s_controls+3292+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $168
+ARGP4
+ADDRGP4 s_controls+3356+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $170
+ARGP4
+ADDRGP4 s_controls+3540+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $171
+ARGP4
+ADDRGP4 s_controls+3216+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $172
+ARGP4
+ADDRGP4 s_controls+5564+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $173
+ARGP4
+ADDRGP4 s_controls+5628+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $175
+ARGP4
+ADDRGP4 s_controls+2908+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $176
+ARGP4
+ADDRGP4 s_controls+5500+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $534
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $503
+endproc Controls_SetConfig 24 8
+proc Controls_SetDefaults 48 4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $536
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $540
+ADDRGP4 $538
+JUMPV
+LABELV $540
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $537
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $536
+JUMPV
+LABELV $538
+ADDRGP4 $169
+ARGP4
+ADDRLP4 12
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $545
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $546
+ADDRGP4 s_controls+3152+60
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 16
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3292+60
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3356+60
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3540+64
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 28
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3216+68
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 32
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5564+60
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 36
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5628+68
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 40
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2908+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 44
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5500+60
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $535
+endproc Controls_SetDefaults 48 4
+proc Controls_MenuKey 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+5708
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $564
+ADDRLP4 24
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $569
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $576
+LABELV $575
+ADDRLP4 32
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $570
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $574
+LABELV $577
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+EQI4 $569
+ADDRGP4 $574
+JUMPV
+LABELV $576
+ADDRLP4 40
+CNSTI4 171
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $569
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LTI4 $574
+LABELV $578
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $570
+ADDRGP4 $574
+JUMPV
+LABELV $569
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $570
+ADDRGP4 s_controls+5196
+INDIRI4
+CNSTI4 0
+EQI4 $574
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $574
+JUMPV
+LABELV $564
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $579
+ADDRGP4 $574
+JUMPV
+LABELV $579
+ADDRLP4 24
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $583
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $581
+LABELV $586
+ADDRFP4 0
+INDIRI4
+CNSTI4 96
+EQI4 $574
+ADDRGP4 $581
+JUMPV
+LABELV $583
+ADDRGP4 s_controls+5708
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $581
+LABELV $565
+ADDRGP4 s_controls+5196
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $588
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $590
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $594
+ADDRGP4 $592
+JUMPV
+LABELV $594
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $596
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $596
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $598
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $598
+LABELV $591
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $590
+JUMPV
+LABELV $592
+LABELV $588
+ADDRLP4 8
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $601
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $605
+ADDRGP4 $603
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $607
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $609
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $611
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $613
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $611
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $603
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $613
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $609
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $616
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $616
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $618
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $618
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $618
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $613
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $613
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $607
+LABELV $602
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $601
+JUMPV
+LABELV $603
+ADDRGP4 s_controls+5708
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $563
+JUMPV
+LABELV $621
+LABELV $574
+ADDRGP4 s_controls
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $563
+endproc Controls_MenuKey 44 8
+proc Controls_ResetDefaults_Action 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $624
+ADDRGP4 $623
+JUMPV
+LABELV $624
+ADDRGP4 s_controls+5196
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $623
+endproc Controls_ResetDefaults_Action 0 0
+proc Controls_ResetDefaults_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $628
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $629
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $627
+endproc Controls_ResetDefaults_Draw 0 20
+proc Controls_MenuEvent 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 40
+LTI4 $631
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+GTI4 $670
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $671-160
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $671
+address $666
+address $666
+address $666
+address $666
+address $666
+address $666
+address $666
+address $666
+address $666
+code
+LABELV $670
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $631
+ADDRLP4 0
+INDIRI4
+CNSTI4 107
+GTI4 $631
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $673-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $673
+address $634
+address $638
+address $642
+address $646
+address $650
+address $654
+address $660
+address $663
+code
+LABELV $634
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 s_controls+5704
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $638
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 s_controls+5704
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $642
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 s_controls+5704
+CNSTI4 2
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $646
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 s_controls+5704
+CNSTI4 3
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $650
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 $653
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Draw
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Action
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $654
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 s_controls+5196
+INDIRI4
+CNSTI4 0
+EQI4 $657
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+LABELV $657
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $660
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $663
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $632
+JUMPV
+LABELV $666
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $632
+ADDRGP4 s_controls+5196
+CNSTI4 1
+ASGNI4
+LABELV $631
+LABELV $632
+LABELV $630
+endproc Controls_MenuEvent 12 12
+proc Controls_ActionEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $676
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $678
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $681
+ADDRGP4 s_controls+5708
+INDIRI4
+CNSTI4 0
+NEI4 $681
+ADDRGP4 s_controls+5708
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $681
+LABELV $679
+LABELV $677
+LABELV $675
+endproc Controls_ActionEvent 0 4
+proc Controls_InitModel 4 12
+ADDRGP4 s_controls+3696
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1500
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $455
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_controls+3696
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $685
+endproc Controls_InitModel 4 12
+proc Controls_InitWeapons 4 4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $692
+JUMPV
+LABELV $689
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $694
+ADDRGP4 $690
+JUMPV
+LABELV $694
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+LABELV $690
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $692
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $689
+LABELV $688
+endproc Controls_InitWeapons 4 4
+proc Controls_Menu_AddPText 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTU4 264
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 152
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $696
+endproc Controls_Menu_AddPText 4 0
+bss
+align 1
+LABELV $698
+skip 32
+code
+proc Controls_MenuInit 4 16
+ADDRGP4 s_controls
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 5976
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 s_controls+528
+ADDRGP4 Controls_MenuKey
+ASGNP4
+ADDRGP4 s_controls+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+544+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_controls+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+544+60
+ADDRGP4 $711
+ASGNP4
+ADDRGP4 s_controls+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_controls+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+616+4
+ADDRGP4 $719
+ASGNP4
+ADDRGP4 s_controls+616+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+616+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+616+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_controls+616+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+616+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_controls+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+704+4
+ADDRGP4 $733
+ASGNP4
+ADDRGP4 s_controls+704+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+704+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_controls+704+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_controls+704+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+704+80
+CNSTI4 334
+ASGNI4
+ADDRLP4 0
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_controls+952
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 101
+ARGI4
+ADDRGP4 $745
+ARGP4
+ADDRGP4 Controls_Menu_AddPText
+CALLV
+pop
+ADDRGP4 s_controls+880
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 100
+ARGI4
+ADDRGP4 $747
+ARGP4
+ADDRGP4 Controls_Menu_AddPText
+CALLV
+pop
+ADDRGP4 s_controls+1024
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 102
+ARGI4
+ADDRGP4 $749
+ARGP4
+ADDRGP4 Controls_Menu_AddPText
+CALLV
+pop
+ADDRGP4 s_controls+1096
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 103
+ARGI4
+ADDRGP4 $751
+ARGP4
+ADDRGP4 Controls_Menu_AddPText
+CALLV
+pop
+ADDRGP4 s_controls+5816
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+5816+4
+ADDRGP4 $755
+ASGNP4
+ADDRGP4 s_controls+5816+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_controls+5816+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+5816+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_controls+5816+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_controls+5816+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5816+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_controls+5816+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_controls+5816+60
+ADDRGP4 $772
+ASGNP4
+ADDRGP4 s_controls+792
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+792+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_controls+792+56
+ADDRGP4 Controls_DrawPlayer
+ASGNP4
+ADDRGP4 s_controls+792+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_controls+792+16
+CNSTI4 -40
+ASGNI4
+ADDRGP4 s_controls+792+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+792+80
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_controls+1168
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1168+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1168+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1168+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1168+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+1228
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1228+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1228+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1228+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1228+8
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_controls+1288
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1288+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1288+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1288+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1288+8
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+1348
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1348+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1348+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1348+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1348+8
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+1408
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1408+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1408+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1408+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1408+8
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_controls+1468
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1468+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1468+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1468+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1468+8
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_controls+1528
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1528+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1528+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1528+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1528+8
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+1588
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1588+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1588+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1588+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1588+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+1648
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1648+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1648+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1648+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1648+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+1708
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1708+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1708+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1708+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1708+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1828
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1828+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1828+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1828+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1828+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_controls+1768
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1768+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1768+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1768+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1768+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_controls+1888
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1888+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1888+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1888+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1888+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_controls+1948
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1948+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1948+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1948+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1948+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_controls+2008
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2008+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2008+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2008+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2008+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_controls+2068
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2068+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2068+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2068+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2068+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+2128
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2128+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2128+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2128+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2128+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_controls+2188
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2188+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2188+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2188+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2188+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_controls+2248
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2248+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2248+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2248+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2248+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 s_controls+2308
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2308+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2308+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2308+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2308+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_controls+2368
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2368+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2368+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2368+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2368+8
+CNSTI4 27
+ASGNI4
+ADDRGP4 s_controls+2428
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2428+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2428+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2428+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2428+8
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_controls+2488
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2488+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2488+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2488+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2488+8
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_controls+2548
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2548+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2548+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2548+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2548+8
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_controls+2608
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2608+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2608+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2608+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2608+8
+CNSTI4 31
+ASGNI4
+ADDRGP4 s_controls+2668
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2668+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2668+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2668+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2668+8
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_controls+2728
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2728+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2728+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2728+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2728+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_controls+2788
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2788+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2788+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2788+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2788+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_controls+2848
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2848+44
+CNSTU4 12420
+ASGNU4
+ADDRGP4 s_controls+2848+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2848+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2848+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+2908
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2908+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2908+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2908+4
+ADDRGP4 $1054
+ASGNP4
+ADDRGP4 s_controls+2908+8
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+2908+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2908+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2972
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2972+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2972+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2972+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2972+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_controls+3032
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3032+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3032+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3032+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3032+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+3636
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3636+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3636+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3636+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3636+8
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+3420
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3420+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3420+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3420+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3420+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+3480
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3480+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3480+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3480+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3480+8
+CNSTI4 39
+ASGNI4
+ADDRGP4 s_controls+3152
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+3152+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3152+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3152+4
+ADDRGP4 $1113
+ASGNP4
+ADDRGP4 s_controls+3152+8
+CNSTI4 41
+ASGNI4
+ADDRGP4 s_controls+3152+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3152+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3292
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+3292+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3292+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3292+4
+ADDRGP4 $1127
+ASGNP4
+ADDRGP4 s_controls+3292+8
+CNSTI4 47
+ASGNI4
+ADDRGP4 s_controls+3292+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3292+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3356
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+3356+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3356+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3356+4
+ADDRGP4 $1141
+ASGNP4
+ADDRGP4 s_controls+3356+8
+CNSTI4 42
+ASGNI4
+ADDRGP4 s_controls+3356+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3356+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3540
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+3540+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3540+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3540+4
+ADDRGP4 $1155
+ASGNP4
+ADDRGP4 s_controls+3540+8
+CNSTI4 43
+ASGNI4
+ADDRGP4 s_controls+3540+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3540+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3540+76
+ADDRGP4 autoswitch_items
+ASGNP4
+ADDRGP4 s_controls+3216
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+3216+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3216+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3216+4
+ADDRGP4 $1171
+ASGNP4
+ADDRGP4 s_controls+3216+8
+CNSTI4 44
+ASGNI4
+ADDRGP4 s_controls+3216+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3216+60
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 s_controls+3216+64
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 s_controls+3216+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3092
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3092+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3092+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3092+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3092+8
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_controls+5200
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5200+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5200+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5200+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5200+8
+CNSTI4 34
+ASGNI4
+ADDRGP4 s_controls+5260
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5260+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5260+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5260+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5260+8
+CNSTI4 35
+ASGNI4
+ADDRGP4 s_controls+5320
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5320+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5320+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5320+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5320+8
+CNSTI4 36
+ASGNI4
+ADDRGP4 s_controls+5380
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5380+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5380+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5380+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5380+8
+CNSTI4 37
+ASGNI4
+ADDRGP4 s_controls+5440
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5440+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5440+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5440+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5440+8
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_controls+5500
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+5500+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+5500+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5500+4
+ADDRGP4 $1243
+ASGNP4
+ADDRGP4 s_controls+5500+8
+CNSTI4 48
+ASGNI4
+ADDRGP4 s_controls+5500+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5500+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+5564
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+5564+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+5564+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5564+4
+ADDRGP4 $1257
+ASGNP4
+ADDRGP4 s_controls+5564+8
+CNSTI4 45
+ASGNI4
+ADDRGP4 s_controls+5564+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5564+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+5628
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+5628+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5628+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+5628+4
+ADDRGP4 $1271
+ASGNP4
+ADDRGP4 s_controls+5628+8
+CNSTI4 46
+ASGNI4
+ADDRGP4 s_controls+5628+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5628+60
+CNSTF4 1028443341
+ASGNF4
+ADDRGP4 s_controls+5628+64
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 s_controls+5628+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+5904
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+5904+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_controls+5904+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5904+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_controls+5904+60
+ADDRGP4 $698
+ASGNP4
+ADDRGP4 s_controls+5904+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+5904+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5904
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+952
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1024
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1096
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3216
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3292
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3152
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2728
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2788
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2848
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2908
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2972
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3032
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5564
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5628
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3356
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1708
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1168
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1228
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1348
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1408
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1468
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1528
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1588
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1648
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2548
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2668
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3540
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1828
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1948
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2008
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2068
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2188
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2248
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2308
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2428
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2488
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3420
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3480
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3636
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3092
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5200
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5260
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5320
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5380
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5440
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5500
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5816
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1354
+ARGP4
+ADDRGP4 s_controls+5904+60
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+5904+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 Controls_InitCvars
+CALLV
+pop
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 Controls_InitModel
+CALLV
+pop
+ADDRGP4 Controls_InitWeapons
+CALLV
+pop
+ADDRGP4 s_controls+5704
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $697
+endproc Controls_MenuInit 4 16
+export Controls_Cache
+proc Controls_Cache 0 4
+ADDRGP4 $755
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $772
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $719
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $733
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1360
+endproc Controls_Cache 0 4
+export UI_ControlsMenu
+proc UI_ControlsMenu 0 4
+ADDRGP4 Controls_MenuInit
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1361
+endproc UI_ControlsMenu 0 4
+bss
+align 4
+LABELV s_controls
+skip 5976
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1354
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1271
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $1257
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1243
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1171
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1155
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1141
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1127
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1113
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1054
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $772
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $755
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $751
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $749
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $747
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $745
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 75
+byte 1 0
+align 1
+LABELV $733
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $719
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $711
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 83
+byte 1 0
+align 1
+LABELV $653
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 79
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 83
+byte 1 63
+byte 1 0
+align 1
+LABELV $629
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $628
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $613
+byte 1 0
+align 1
+LABELV $534
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $455
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $453
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $447
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $446
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $445
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $438
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $434
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $174
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $173
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $172
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $171
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $170
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $169
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $167
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $166
+byte 1 43
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 0
+align 1
+LABELV $165
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $164
+byte 1 43
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $160
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $158
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $156
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $153
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $152
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $151
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $150
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $149
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $148
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $146
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $144
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $143
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $142
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $141
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $140
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $139
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $138
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $137
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $136
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $135
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $134
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $133
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $132
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $131
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $130
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $129
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $128
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $127
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $126
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $125
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $124
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $123
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $122
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $121
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $120
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $118
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $117
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $116
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $115
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $114
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $112
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $111
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $110
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $108
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $107
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $106
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $105
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $104
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $103
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $102
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $100
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $99
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $98
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $97
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $96
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $95
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $94
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $93
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $92
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $91
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $90
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $89
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $88
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $87
+byte 1 78
+byte 1 69
+byte 1 87
+byte 1 38
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $86
+byte 1 66
+byte 1 69
+byte 1 84
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $85
+byte 1 78
+byte 1 69
+byte 1 87
+byte 1 0
+align 1
+LABELV $84
+byte 1 65
+byte 1 76
+byte 1 87
+byte 1 65
+byte 1 89
+byte 1 83
+byte 1 0
+align 1
+LABELV $83
+byte 1 78
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
@@ -0,0 +1,4317 @@
+export UI_Alloc
+code
+proc UI_Alloc 12 0
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 131072
+LEI4 $81
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+CNSTP4 0
+RETP4
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 31
+ADDI4
+CNSTI4 -32
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $80
+endproc UI_Alloc 12 0
+export UI_InitMemory
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $83
+endproc UI_InitMemory 4 0
+export UI_ParseInfos
+proc UI_ParseInfos 2084 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $88
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRGP4 $93
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $90
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $94
+ADDRGP4 $96
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $94
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $100
+ADDRGP4 $102
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $99
+JUMPV
+LABELV $100
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRGP4 $99
+JUMPV
+LABELV $103
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $106
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $106
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $98
+ADDRGP4 $97
+JUMPV
+LABELV $99
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $110
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+ADDI4
+ADDRLP4 2076
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2080
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $111
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $111
+LABELV $86
+ADDRGP4 $85
+JUMPV
+LABELV $87
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $84
+endproc UI_ParseInfos 2084 12
+proc UI_LoadArenasFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $114
+ADDRGP4 $116
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $113
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $117
+ADDRGP4 $119
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $113
+JUMPV
+LABELV $117
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 ui_numArenas
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $113
+endproc UI_LoadArenasFromFile 8216 16
+proc UI_LoadArenas 20960 16
+ADDRGP4 ui_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 20648
+ARGP4
+ADDRGP4 $121
+ARGP4
+ADDRGP4 $122
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 20648+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $123
+ADDRLP4 20648+16
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRGP4 $127
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $124
+ADDRGP4 $128
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTI4 20480
+ARGI4
+ADDRLP4 20920
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 20920
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 168
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 20924
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 20924
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 Q_snprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $135
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20928
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20928
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $131
+ADDRLP4 20924
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 20924
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 144
+INDIRI4
+ADDRLP4 20924
+INDIRI4
+ADDI4
+ADDRLP4 136
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $133
+ADDRLP4 140
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LTI4 $130
+ADDRGP4 $136
+ARGP4
+ADDRGP4 ui_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 20928
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20928
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRGP4 $139
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $137
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $140
+ADDRGP4 $145
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20932
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20932
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $141
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $143
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $140
+ADDRLP4 20932
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_numSinglePlayerArenas
+ADDRLP4 20932
+INDIRI4
+ASGNI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ADDRLP4 20932
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20932
+INDIRI4
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $146
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 20936
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20936
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $151
+ADDRGP4 $147
+JUMPV
+LABELV $151
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 20940
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 20940
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $153
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 20944
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 20944
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $157
+ADDRLP4 20948
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ASGNP4
+ADDRLP4 20948
+INDIRP4
+ADDRLP4 20948
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $147
+JUMPV
+LABELV $157
+ADDRLP4 20948
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 20948
+INDIRP4
+ADDRLP4 20948
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $153
+LABELV $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $146
+ADDRLP4 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRLP4 20936
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 20936
+INDIRP4
+ADDRLP4 20936
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 20944
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20944
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $159
+ADDRLP4 20936
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 20936
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 160
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 164
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20936
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 20940
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20940
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $166
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 20944
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 20944
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 20948
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 20948
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $170
+ADDRGP4 $145
+ARGP4
+ADDRLP4 20952
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 20952
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20952
+INDIRI4
+ARGI4
+ADDRLP4 20956
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20956
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $170
+ADDRGP4 $145
+ARGP4
+ADDRLP4 20952
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 20952
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20952
+INDIRI4
+ARGI4
+ADDRLP4 20956
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20956
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $168
+LABELV $166
+ADDRGP4 $145
+ARGP4
+ADDRLP4 20944
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 20944
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20944
+INDIRI4
+ARGI4
+ADDRLP4 20948
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20948
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $163
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $162
+LABELV $120
+endproc UI_LoadArenas 20960 16
+export UI_GetArenaInfoByNumber
+proc UI_GetArenaInfoByNumber 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $175
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $173
+LABELV $175
+ADDRGP4 $176
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $177
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $181
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $181
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $181
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $177
+CNSTP4 0
+RETP4
+LABELV $172
+endproc UI_GetArenaInfoByNumber 24 8
+export UI_GetArenaInfoByMap
+proc UI_GetArenaInfoByMap 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $183
+JUMPV
+LABELV $188
+LABELV $185
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $187
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $184
+CNSTP4 0
+RETP4
+LABELV $183
+endproc UI_GetArenaInfoByMap 12 8
+export UI_GetSpecialArenaInfo
+proc UI_GetSpecialArenaInfo 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $196
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $191
+JUMPV
+LABELV $196
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $192
+CNSTP4 0
+RETP4
+LABELV $191
+endproc UI_GetSpecialArenaInfo 12 8
+proc UI_LoadBotsFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $199
+ADDRGP4 $116
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $201
+ADDRGP4 $119
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $201
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 ui_numBots
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $203
+ADDRGP4 $205
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $203
+LABELV $198
+endproc UI_LoadBotsFromFile 8216 16
+proc UI_LoadBots 1452 16
+ADDRGP4 ui_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRGP4 $122
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $208
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRGP4 $212
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $209
+ADDRGP4 $128
+ARGP4
+ADDRGP4 $213
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1440
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1440
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1444
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_snprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $215
+ADDRLP4 1444
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $217
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $214
+ADDRGP4 $218
+ARGP4
+ADDRGP4 ui_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $206
+endproc UI_LoadBots 1452 16
+export UI_GetBotInfoByNumber
+proc UI_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $222
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $220
+LABELV $222
+ADDRGP4 $223
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $219
+JUMPV
+LABELV $220
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $219
+endproc UI_GetBotInfoByNumber 8 8
+export UI_GetBotInfoByName
+proc UI_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $230
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $224
+JUMPV
+LABELV $230
+LABELV $226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $228
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $225
+CNSTP4 0
+RETP4
+LABELV $224
+endproc UI_GetBotInfoByName 16 8
+export UI_GetBestScore
+proc UI_GetBestScore 1088 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 1056
+INDIRU4
+EQU4 $235
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 1056
+INDIRU4
+NEU4 $233
+LABELV $235
+ADDRGP4 $232
+JUMPV
+LABELV $233
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $238
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LEI4 $236
+LABELV $238
+ADDRGP4 $232
+JUMPV
+LABELV $236
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $239
+ADDRGP4 $243
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $244
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $247
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $245
+LABELV $247
+ADDRGP4 $240
+JUMPV
+LABELV $245
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $250
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $248
+LABELV $250
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $248
+LABELV $240
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LEI4 $239
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+LABELV $232
+endproc UI_GetBestScore 1088 16
+export UI_SetBestScore
+proc UI_SetBestScore 1084 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $254
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+LEI4 $252
+LABELV $254
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRGP4 $255
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $258
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $256
+LABELV $258
+ADDRGP4 $251
+JUMPV
+LABELV $256
+ADDRGP4 $243
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $244
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRLP4 1044
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $259
+ADDRGP4 $251
+JUMPV
+LABELV $259
+ADDRGP4 $145
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $243
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $251
+endproc UI_SetBestScore 1084 16
+export UI_LogAwardData
+proc UI_LogAwardData 1056 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $264
+ADDRGP4 $266
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $264
+ADDRGP4 $267
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 1040
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $267
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $261
+endproc UI_LogAwardData 1056 16
+export UI_GetAwardLevel
+proc UI_GetAwardLevel 1048 16
+ADDRGP4 $267
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+RETI4
+LABELV $269
+endproc UI_GetAwardLevel 1048 16
+export UI_TierCompleted
+proc UI_TierCompleted 60 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $271
+ADDRGP4 $273
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $274
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $274
+ADDRGP4 $276
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $279
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $277
+LABELV $279
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $277
+CNSTI4 -1
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $271
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $280
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $284
+CNSTI4 -1
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $284
+LABELV $281
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $280
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $270
+endproc UI_TierCompleted 60 12
+export UI_ShowTierVideo
+proc UI_ShowTierVideo 1052 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $286
+JUMPV
+LABELV $287
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $290
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $291
+CNSTI4 0
+RETI4
+ADDRGP4 $286
+JUMPV
+LABELV $291
+ADDRGP4 $145
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $289
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $286
+endproc UI_ShowTierVideo 1052 16
+export UI_CanShowTierVideo
+proc UI_CanShowTierVideo 1048 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $294
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $294
+ADDRGP4 uis+11444
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+EQI4 $296
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $296
+ADDRGP4 $289
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $290
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $299
+CNSTI4 1
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $299
+CNSTI4 0
+RETI4
+LABELV $293
+endproc UI_CanShowTierVideo 1048 16
+export UI_GetCurrentGame
+proc UI_GetCurrentGame 32 12
+ADDRGP4 $273
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $302
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LEI4 $304
+LABELV $306
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $301
+JUMPV
+LABELV $304
+LABELV $302
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $311
+LABELV $313
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $301
+JUMPV
+LABELV $311
+LABELV $308
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+LTI4 $307
+ADDRGP4 $276
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $314
+CNSTI4 -1
+RETI4
+ADDRGP4 $301
+JUMPV
+LABELV $314
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $301
+endproc UI_GetCurrentGame 32 12
+export UI_NewGame
+proc UI_NewGame 0 8
+ADDRGP4 $317
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $318
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $319
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $320
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $321
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $267
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $289
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $316
+endproc UI_NewGame 0 8
+export UI_GetNumArenas
+proc UI_GetNumArenas 0 0
+ADDRGP4 ui_numArenas
+INDIRI4
+RETI4
+LABELV $322
+endproc UI_GetNumArenas 0 0
+export UI_GetNumSPArenas
+proc UI_GetNumSPArenas 0 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+RETI4
+LABELV $323
+endproc UI_GetNumSPArenas 0 0
+export UI_GetNumSPTiers
+proc UI_GetNumSPTiers 0 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+DIVI4
+RETI4
+LABELV $324
+endproc UI_GetNumSPTiers 0 0
+export UI_GetNumBots
+proc UI_GetNumBots 0 0
+ADDRGP4 ui_numBots
+INDIRI4
+RETI4
+LABELV $325
+endproc UI_GetNumBots 0 0
+export UI_SPUnlock_f
+proc UI_SPUnlock_f 1048 16
+ADDRGP4 $317
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $327
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $328
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $330
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+LTI4 $327
+ADDRGP4 $317
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $332
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ShowTierVideo
+CALLI4
+pop
+LABELV $333
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LEI4 $332
+ADDRGP4 $336
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu_ReInit
+CALLV
+pop
+LABELV $326
+endproc UI_SPUnlock_f 1048 16
+export UI_SPUnlockMedals_f
+proc UI_SPUnlockMedals_f 1044 16
+ADDRGP4 $267
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $338
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $339
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $338
+ADDRGP4 $267
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $343
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $337
+endproc UI_SPUnlockMedals_f 1044 16
+export UI_InitGameinfo
+proc UI_InitGameinfo 0 0
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 uis+11444
+CNSTI4 0
+ASGNI4
+LABELV $344
+endproc UI_InitGameinfo 0 0
+bss
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV memoryPool
+skip 131072
+align 4
+LABELV ui_numSpecialSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_numSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_arenaInfos
+skip 4096
+align 4
+LABELV ui_numArenas
+skip 4
+align 4
+LABELV ui_botInfos
+skip 4096
+export ui_numBots
+align 4
+LABELV ui_numBots
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $343
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $342
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $336
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $331
+byte 1 49
+byte 1 0
+align 1
+LABELV $321
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 53
+byte 1 0
+align 1
+LABELV $320
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 52
+byte 1 0
+align 1
+LABELV $319
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 51
+byte 1 0
+align 1
+LABELV $318
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $317
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $290
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $289
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $276
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $273
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $268
+byte 1 97
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $267
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $266
+byte 1 94
+byte 1 49
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 68
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $255
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $244
+byte 1 108
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $243
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $229
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $223
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $218
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $213
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $212
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $207
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $205
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $176
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $161
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $156
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $155
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $150
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $145
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $144
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $139
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $136
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $135
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $129
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $128
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $127
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $122
+byte 1 0
+align 1
+LABELV $121
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $119
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $116
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $110
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $109
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 0
+align 1
+LABELV $108
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $105
+byte 1 125
+byte 1 0
+align 1
+LABELV $102
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $96
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $93
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $92
+byte 1 123
+byte 1 0
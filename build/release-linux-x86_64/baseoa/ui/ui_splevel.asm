@@ -0,0 +1,5044 @@
+code
+proc PlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $82
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 0
+ADDRGP4 $84
+ASGNP4
+LABELV $83
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $86
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $88
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $86
+LABELV $81
+endproc PlayerIcon 80 20
+proc PlayerIconHandle 68 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+LABELV $89
+endproc PlayerIconHandle 68 12
+proc UI_SPLevelMenu_SetBots 1064 12
+ADDRGP4 levelMenuInfo+2768
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $92
+ADDRGP4 $90
+JUMPV
+LABELV $92
+ADDRGP4 levelMenuInfo+2204
+INDIRP4
+ARGP4
+ADDRGP4 $95
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $97
+JUMPV
+LABELV $100
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $101
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $100
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $103
+ADDRGP4 $98
+JUMPV
+LABELV $103
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $106
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 1040
+INDIRI4
+CNSTI4 32
+NEI4 $105
+LABELV $108
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $109
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1044
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $109
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $111
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+LABELV $111
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $114
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $118
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 PlayerIconHandle
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2772
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1060
+CNSTI4 10
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2800
+ADDP4
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2772
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1048
+CNSTI4 10
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2800
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $115
+CNSTI4 10
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2800
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 1048
+ADDRGP4 levelMenuInfo+2768
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $129
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+CNSTI4 7
+LTI4 $101
+LABELV $129
+LABELV $98
+LABELV $90
+endproc UI_SPLevelMenu_SetBots 1064 12
+proc UI_SPLevelMenu_SetMenuArena 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2468
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2468
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2532
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2548
+ADDP4
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2532
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $137
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2532
+ADDP4
+CNSTI4 8
+ASGNI4
+LABELV $137
+ADDRGP4 $142
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $143
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRGP4 $147
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $143
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+704+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $150
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+704+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $151
+JUMPV
+LABELV $150
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+704+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $151
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+704+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $130
+endproc UI_SPLevelMenu_SetMenuArena 84 12
+proc UI_SPLevelMenu_SetMenuItems 44 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $159
+ADDRGP4 selectedArena
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $161
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $161
+LABELV $160
+ADDRLP4 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $165
+ADDRLP4 12
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $163
+LABELV $165
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $163
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $166
+ADDRGP4 $168
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $166
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+NEI4 $169
+ADDRGP4 $171
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2204
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+704+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+704
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+704+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2208
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 levelMenuInfo+704+88+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 levelMenuInfo+704+176+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 levelMenuInfo+704+264+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 levelMenuInfo+2212+64
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+2212+128
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+2212+192
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+704+88+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $204
+ADDRGP4 $206
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2204
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+704+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+704
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+704+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2208
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 levelMenuInfo+704+88+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 levelMenuInfo+704+176+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 levelMenuInfo+704+264+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 levelMenuInfo+2212+64
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+2212+128
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+2212+192
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+704+88+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRGP4 levelMenuInfo+704+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+704
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+704+32
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2208
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $244
+ADDRLP4 4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+LABELV $245
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $244
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $248
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+2204
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $248
+LABELV $205
+LABELV $170
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $251
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+616+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+616+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $252
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $257
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+1056+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+1056+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $258
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+LABELV $158
+endproc UI_SPLevelMenu_SetMenuItems 44 12
+proc UI_SPLevelMenu_ResetDraw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $264
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $265
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 410
+ARGI4
+ADDRGP4 $266
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 437
+ARGI4
+ADDRGP4 $267
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $263
+endproc UI_SPLevelMenu_ResetDraw 0 20
+proc UI_SPLevelMenu_ResetAction 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $269
+ADDRGP4 $268
+JUMPV
+LABELV $269
+ADDRGP4 UI_NewGame
+CALLV
+pop
+ADDRGP4 $171
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $271
+ADDRGP4 $168
+ARGP4
+CNSTF4 3229614080
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRGP4 $168
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $272
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $268
+endproc UI_SPLevelMenu_ResetAction 4 8
+proc UI_SPLevelMenu_ResetEvent 0 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $274
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRGP4 $276
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetDraw
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+LABELV $273
+endproc UI_SPLevelMenu_ResetEvent 0 12
+proc UI_SPLevelMenu_LevelEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $278
+ADDRGP4 $277
+JUMPV
+LABELV $278
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $282
+ADDRLP4 0
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $280
+LABELV $282
+ADDRGP4 $277
+JUMPV
+LABELV $280
+ADDRLP4 4
+ADDRGP4 selectedArena
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+2204
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+ADDRGP4 $168
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $277
+endproc UI_SPLevelMenu_LevelEvent 12 8
+proc UI_SPLevelMenu_LeftArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $285
+ADDRGP4 $284
+JUMPV
+LABELV $285
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $287
+ADDRGP4 $284
+JUMPV
+LABELV $287
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $284
+endproc UI_SPLevelMenu_LeftArrowEvent 4 0
+proc UI_SPLevelMenu_RightArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $290
+ADDRGP4 $289
+JUMPV
+LABELV $290
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $292
+ADDRGP4 $289
+JUMPV
+LABELV $292
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $289
+endproc UI_SPLevelMenu_RightArrowEvent 4 0
+proc UI_SPLevelMenu_PlayerEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $295
+ADDRGP4 $294
+JUMPV
+LABELV $295
+ADDRGP4 UI_PlayerSettingsMenu
+CALLV
+pop
+LABELV $294
+endproc UI_SPLevelMenu_PlayerEvent 0 0
+proc UI_SPLevelMenu_AwardEvent 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $298
+ADDRGP4 $297
+JUMPV
+LABELV $298
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 17
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2744
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $297
+endproc UI_SPLevelMenu_AwardEvent 4 8
+proc UI_SPLevelMenu_NextEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $302
+ADDRGP4 $301
+JUMPV
+LABELV $302
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $304
+ADDRGP4 $301
+JUMPV
+LABELV $304
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $306
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $306
+ADDRGP4 levelMenuInfo+2204
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPSkillMenu
+CALLV
+pop
+LABELV $301
+endproc UI_SPLevelMenu_NextEvent 0 4
+proc UI_SPLevelMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $310
+ADDRGP4 $309
+JUMPV
+LABELV $310
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $312
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $312
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $309
+endproc UI_SPLevelMenu_BackEvent 0 0
+proc UI_SPLevelMenu_CustomEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $315
+ADDRGP4 $314
+JUMPV
+LABELV $315
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+LABELV $314
+endproc UI_SPLevelMenu_CustomEvent 0 4
+proc UI_SPLevelMenu_MenuDraw 1160 20
+ADDRGP4 levelMenuInfo+2200
+INDIRI4
+CNSTI4 0
+EQI4 $318
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRGP4 $121
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 314
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $118
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 levelMenuInfo+2592
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $321
+ADDRGP4 levelMenuInfo+2592
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2592
+ARGP4
+ADDRGP4 levelMenuInfo+2656
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1144+68
+CNSTI4 0
+ASGNI4
+LABELV $321
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 340
+ASGNI4
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+LABELV $331
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2720
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $336
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $338
+ADDRLP4 4
+CNSTI4 224
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $339
+ADDRLP4 1136
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+NEI4 $340
+ADDRGP4 $332
+JUMPV
+LABELV $340
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+LTI4 $342
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+LTI4 $345
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $347
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $346
+LABELV $343
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $336
+LABELV $332
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $331
+ADDRGP4 $349
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 18
+ARGI4
+CNSTI4 38
+ARGI4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $350
+ADDRLP4 1140
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+704+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+704+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $353
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+2208
+INDIRI4
+LTI4 $350
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $359
+CNSTI4 320
+ARGI4
+CNSTI4 216
+ARGI4
+ADDRGP4 $361
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $317
+JUMPV
+LABELV $359
+ADDRLP4 88
+ADDRGP4 color_white
+INDIRF4
+ASGNF4
+ADDRLP4 88+4
+ADDRGP4 color_white+4
+INDIRF4
+ASGNF4
+ADDRLP4 88+8
+ADDRGP4 color_white+8
+INDIRF4
+ASGNF4
+ADDRLP4 88+12
+ADDRGP4 color_white+12
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 1140
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 88+12
+CNSTF4 1056964608
+ADDRLP4 1140
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $373
+JUMPV
+LABELV $370
+ADDRLP4 1148
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+704+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+704+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2468
+ADDP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2532
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $380
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1119879168
+ARGF4
+ADDRLP4 1152
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2548
+ADDP4
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2572-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $380
+ADDRLP4 0
+INDIRI4
+ADDRGP4 selectedArena
+INDIRI4
+NEI4 $386
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+704
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $388
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $388
+ADDRLP4 1156
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1124204544
+ARGF4
+CNSTF4 1122500608
+ARGF4
+ADDRGP4 levelMenuInfo+2564
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+704
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $392
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1132462080
+ARGF4
+CNSTF4 1130692608
+ARGF4
+ADDRGP4 levelMenuInfo+2568
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $392
+LABELV $387
+LABELV $371
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $373
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+2208
+INDIRI4
+LTI4 $370
+ADDRLP4 8
+CNSTI4 192
+ASGNI4
+ADDRGP4 levelMenuInfo+2204
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+2204
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 90
+CNSTI4 7
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $401
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+CNSTI4 18
+ADDI4
+CNSTI4 90
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2772
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2772
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 22
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRGP4 $410
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $407
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2800
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $404
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+2768
+INDIRI4
+LTI4 $401
+LABELV $317
+endproc UI_SPLevelMenu_MenuDraw 1160 20
+export UI_SPLevelMenu_Cache
+proc UI_SPLevelMenu_Cache 32 8
+ADDRGP4 $413
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $414
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $415
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $416
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $147
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $417
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $418
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $419
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $422
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $423
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $424
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $425
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $426
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $427
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $428
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $429
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ui_medalSounds
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 levelMenuInfo+2744
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $430
+ADDRGP4 $414
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2564
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2568
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $417
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2572
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $418
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2572+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $419
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2572+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2572+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2572+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $412
+endproc UI_SPLevelMenu_Cache 32 8
+proc UI_SPLevelMenu_Init 128 12
+ADDRGP4 $447
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $450
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+LEI4 $448
+LABELV $450
+ADDRGP4 $447
+ARGP4
+ADDRGP4 $451
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+LABELV $448
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2872
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+524
+ADDRGP4 UI_SPLevelMenu_MenuDraw
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_Cache
+CALLV
+pop
+ADDRGP4 levelMenuInfo+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 levelMenuInfo+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+544+60
+ADDRGP4 $462
+ASGNP4
+ADDRGP4 levelMenuInfo+544+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 levelMenuInfo+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+616+4
+ADDRGP4 $415
+ASGNP4
+ADDRGP4 levelMenuInfo+616+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+616+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 levelMenuInfo+616+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+616+48
+ADDRGP4 UI_SPLevelMenu_LeftArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+616+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+616+76
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+616+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+616+60
+ADDRGP4 $416
+ASGNP4
+ADDRGP4 levelMenuInfo+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+704+4
+ADDRGP4 levelMenuInfo+2212
+ASGNP4
+ADDRGP4 levelMenuInfo+704+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+704+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+704+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+704+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 levelMenuInfo+704+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+704+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+704+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+704+88
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+704+88+4
+ADDRGP4 levelMenuInfo+2212+64
+ASGNP4
+ADDRGP4 levelMenuInfo+704+88+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+704+88+12
+CNSTI4 186
+ASGNI4
+ADDRGP4 levelMenuInfo+704+88+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+704+88+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 levelMenuInfo+704+88+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+704+88+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+704+88+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+4
+ADDRGP4 levelMenuInfo+2212+128
+ASGNP4
+ADDRGP4 levelMenuInfo+704+176+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+704+176+12
+CNSTI4 326
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+704+176+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+704+176+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+4
+ADDRGP4 levelMenuInfo+2212+192
+ASGNP4
+ADDRGP4 levelMenuInfo+704+264+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+704+264+12
+CNSTI4 466
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+704+264+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+704+264+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+1056
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1056+4
+ADDRGP4 $415
+ASGNP4
+ADDRGP4 levelMenuInfo+1056+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1056+12
+CNSTI4 606
+ASGNI4
+ADDRGP4 levelMenuInfo+1056+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1056+48
+ADDRGP4 UI_SPLevelMenu_RightArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1056+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 levelMenuInfo+1056+76
+CNSTI4 -16
+ASGNI4
+ADDRGP4 levelMenuInfo+1056+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+1056+60
+ADDRGP4 $416
+ASGNP4
+ADDRGP4 $118
+ARGP4
+ADDRGP4 levelMenuInfo+2592
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2592
+ARGP4
+ADDRGP4 levelMenuInfo+2656
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1144
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1144+4
+ADDRGP4 levelMenuInfo+2656
+ASGNP4
+ADDRGP4 levelMenuInfo+1144+44
+CNSTU4 2052
+ASGNU4
+ADDRGP4 levelMenuInfo+1144+12
+CNSTI4 288
+ASGNI4
+ADDRGP4 levelMenuInfo+1144+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 levelMenuInfo+1144+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+1144+48
+ADDRGP4 UI_SPLevelMenu_PlayerEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1144+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1144+80
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $630
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetAwardLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2720
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $631
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $630
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+ADDRGP4 levelMenuInfo+2720+16
+ADDRLP4 92
+INDIRI4
+ADDRGP4 levelMenuInfo+2720+16
+INDIRI4
+ADDRLP4 92
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 340
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $639
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2720
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $643
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 8
+CNSTI4 224
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $647
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+44
+ADDP4
+CNSTU4 1050628
+ASGNU4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+16
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+48
+ADDP4
+ADDRGP4 UI_SPLevelMenu_AwardEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+76
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232+80
+ADDP4
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $643
+LABELV $640
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $639
+ADDRGP4 levelMenuInfo+1760
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1760+4
+ADDRGP4 $422
+ASGNP4
+ADDRGP4 levelMenuInfo+1760+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1760+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1760+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1760+48
+ADDRGP4 UI_SPLevelMenu_BackEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1760+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 levelMenuInfo+1760+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1760+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1760+60
+ADDRGP4 $423
+ASGNP4
+ADDRGP4 levelMenuInfo+1848
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1848+4
+ADDRGP4 $426
+ASGNP4
+ADDRGP4 levelMenuInfo+1848+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1848+12
+CNSTI4 170
+ASGNI4
+ADDRGP4 levelMenuInfo+1848+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1848+48
+ADDRGP4 UI_SPLevelMenu_ResetEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1848+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 levelMenuInfo+1848+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1848+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1848+60
+ADDRGP4 $427
+ASGNP4
+ADDRGP4 levelMenuInfo+1936
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1936+4
+ADDRGP4 $428
+ASGNP4
+ADDRGP4 levelMenuInfo+1936+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1936+12
+CNSTI4 342
+ASGNI4
+ADDRGP4 levelMenuInfo+1936+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1936+48
+ADDRGP4 UI_SPLevelMenu_CustomEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1936+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 levelMenuInfo+1936+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1936+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1936+60
+ADDRGP4 $429
+ASGNP4
+ADDRGP4 levelMenuInfo+2024
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+2024+4
+ADDRGP4 $424
+ASGNP4
+ADDRGP4 levelMenuInfo+2024+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 levelMenuInfo+2024+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+2024+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+2024+48
+ADDRGP4 UI_SPLevelMenu_NextEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+2024+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 levelMenuInfo+2024+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+2024+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+2024+60
+ADDRGP4 $425
+ASGNP4
+ADDRGP4 levelMenuInfo+2112
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+2112+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 levelMenuInfo+2112+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+2112+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+2112+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+2112+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+704+88
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+704+176
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+704+264
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 100
+ADDRGP4 levelMenuInfo+704+32
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 levelMenuInfo+704+88+32
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 levelMenuInfo+704+176+32
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 levelMenuInfo+704+264+32
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1056
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1144
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $777
+JUMPV
+LABELV $774
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+1232
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $775
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $777
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $774
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1848
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1936
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+2024
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+2112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $168
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $784
+ADDRLP4 20
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 4
+ASGNI4
+ADDRGP4 selectedArenaSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRGP4 selectedArenaSet
+ADDRGP4 currentSet
+INDIRI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRGP4 currentGame
+INDIRI4
+ASGNI4
+LABELV $785
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $446
+endproc UI_SPLevelMenu_Init 128 12
+export UI_SPLevelMenu
+proc UI_SPLevelMenu 36 8
+ADDRGP4 trainingTier
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $787
+ADDRGP4 minTier
+ADDRGP4 trainingTier
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRGP4 minTier
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 -2
+ASGNI4
+LABELV $788
+ADDRLP4 16
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRGP4 finalTier
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $789
+ADDRGP4 maxTier
+ADDRGP4 finalTier
+INDIRI4
+ASGNI4
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRLP4 24
+ADDRGP4 maxTier
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRGP4 finalTier
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+GEI4 $791
+ADDRGP4 maxTier
+ADDRGP4 minTier
+INDIRI4
+ASGNI4
+LABELV $791
+LABELV $790
+ADDRLP4 24
+ADDRGP4 UI_GetCurrentGame
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $793
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 maxTier
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $795
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $795
+LABELV $793
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $797
+ADDRGP4 currentSet
+CNSTI4 -1
+ASGNI4
+ADDRGP4 currentGame
+CNSTI4 0
+ASGNI4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 currentSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 currentGame
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+ASGNI4
+LABELV $798
+ADDRGP4 UI_SPLevelMenu_Init
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+2024
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $786
+endproc UI_SPLevelMenu 36 8
+export UI_SPLevelMenu_f
+proc UI_SPLevelMenu_f 0 4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $800
+endproc UI_SPLevelMenu_f 0 4
+export UI_SPLevelMenu_ReInit
+proc UI_SPLevelMenu_ReInit 0 0
+ADDRGP4 levelMenuInfo+2200
+CNSTI4 1
+ASGNI4
+LABELV $802
+endproc UI_SPLevelMenu_ReInit 0 0
+bss
+align 4
+LABELV maxTier
+skip 4
+align 4
+LABELV minTier
+skip 4
+align 4
+LABELV finalTier
+skip 4
+align 4
+LABELV trainingTier
+skip 4
+align 4
+LABELV currentGame
+skip 4
+align 4
+LABELV currentSet
+skip 4
+align 4
+LABELV selectedArena
+skip 4
+align 4
+LABELV selectedArenaSet
+skip 4
+align 4
+LABELV levelMenuInfo
+skip 2872
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $462
+byte 1 67
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 83
+byte 1 69
+byte 1 32
+byte 1 76
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 0
+align 1
+LABELV $451
+byte 1 50
+byte 1 0
+align 1
+LABELV $447
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $429
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $428
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $427
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $426
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $425
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $424
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $423
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $422
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $421
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $420
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $419
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $418
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $417
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $416
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $415
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $414
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $413
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $410
+byte 1 63
+byte 1 0
+align 1
+LABELV $399
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $397
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $361
+byte 1 65
+byte 1 67
+byte 1 67
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 78
+byte 1 73
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $349
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $348
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $347
+byte 1 37
+byte 1 105
+byte 1 107
+byte 1 0
+align 1
+LABELV $344
+byte 1 37
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $276
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 63
+byte 1 0
+align 1
+LABELV $267
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $266
+byte 1 68
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $265
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $264
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $206
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $172
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $171
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $168
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $142
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $131
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $121
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $118
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $88
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $85
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $84
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
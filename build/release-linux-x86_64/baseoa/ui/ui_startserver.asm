@@ -0,0 +1,13494 @@
+data
+align 4
+LABELV gametype_items
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+byte 4 0
+align 4
+LABELV gametype_remap
+byte 4 0
+byte 4 3
+byte 4 1
+byte 4 4
+byte 4 5
+byte 4 6
+byte 4 7
+byte 4 8
+byte 4 9
+byte 4 10
+byte 4 11
+byte 4 12
+byte 4 13
+align 4
+LABELV gametype_remap2
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 4
+byte 4 5
+byte 4 6
+byte 4 7
+byte 4 8
+byte 4 9
+byte 4 10
+byte 4 11
+byte 4 12
+byte 4 13
+code
+proc GametypeBits 68 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $98
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $100
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $103
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $106
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $106
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $109
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $109
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $112
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $112
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $115
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $118
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $121
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $124
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $124
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $127
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $130
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $133
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $136
+LABELV $96
+ADDRGP4 $95
+JUMPV
+LABELV $97
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $94
+endproc GametypeBits 68 8
+bss
+align 1
+LABELV $140
+skip 512
+code
+proc StartServer_Update 52 16
+ADDRLP4 20
+ADDRGP4 s_startserver+2972
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $142
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 s_startserver+2968
+INDIRI4
+LTI4 $146
+ADDRGP4 $165
+JUMPV
+LABELV $146
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $140
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $140
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+44
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+44
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $143
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $142
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 28
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $163
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $162
+ADDRGP4 s_startserver+2968
+INDIRI4
+CNSTI4 0
+NEI4 $176
+ADDRLP4 28
+ADDRGP4 s_startserver+2712+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_startserver+2800+60
+INDIRP4
+ARGP4
+ADDRGP4 $183
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 28
+ADDRGP4 s_startserver+2712+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRGP4 s_startserver+2964
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $187
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GEI4 $187
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 40
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+44
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+LABELV $187
+ADDRGP4 s_startserver+2964
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+2800+60
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $177
+ADDRGP4 s_startserver+2800+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+LABELV $139
+endproc StartServer_Update 52 16
+proc StartServer_MapEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $200
+ADDRGP4 $199
+JUMPV
+LABELV $200
+ADDRGP4 s_startserver+2964
+ADDRGP4 s_startserver+2972
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $199
+endproc StartServer_MapEvent 0 0
+proc WriteMapList2File 64 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $205
+ADDRGP4 $207
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRLP4 36
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $208
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $213
+ADDRGP4 $209
+JUMPV
+LABELV $213
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $208
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $204
+endproc WriteMapList2File 64 12
+export WriteMapList
+proc WriteMapList 416 12
+ADDRGP4 $217
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $218
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $219
+ADDRGP4 $223
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 404
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 404
+INDIRP4
+ARGP4
+ADDRLP4 408
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 412
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+LEI4 $224
+ADDRGP4 $226
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 WriteMapList2File
+CALLV
+pop
+LABELV $224
+LABELV $220
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $219
+LABELV $216
+endproc WriteMapList 416 12
+proc StartServer_GametypeEvent 60 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $228
+ADDRGP4 $227
+JUMPV
+LABELV $228
+ADDRLP4 24
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2968
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 32
+ADDRGP4 gametype_remap
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ADDRGP4 s_startserver+792+64
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 s_startserver+792+64
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $233
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $233
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $237
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 s_startserver+792+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 mapinfo
+ARGP4
+ADDRGP4 MapInfoGet
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $243
+ADDRLP4 0
+INDIRI4
+ADDRGP4 mapinfo+9312
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 121
+EQI4 $251
+ADDRLP4 0
+INDIRI4
+ADDRGP4 mapinfo+9312
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 89
+NEI4 $247
+LABELV $251
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $247
+ADDRLP4 0
+INDIRI4
+ADDRGP4 mapinfo+9312
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 110
+EQI4 $256
+ADDRLP4 0
+INDIRI4
+ADDRGP4 mapinfo+9312
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 78
+NEI4 $252
+LABELV $256
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BCOMI4
+BANDI4
+ASGNI4
+LABELV $252
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $243
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $257
+ADDRGP4 $238
+JUMPV
+LABELV $257
+ADDRGP4 s_startserver+2968
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 s_startserver+2968
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $238
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $240
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $237
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_startserver+2976
+ADDRGP4 s_startserver+2968
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 36
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 s_startserver+2972
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2964
+CNSTI4 0
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $227
+endproc StartServer_GametypeEvent 60 12
+proc StartServer_MenuEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $267
+ADDRGP4 $266
+JUMPV
+LABELV $267
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+LTI4 $269
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+GTI4 $269
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $293-76
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $293
+address $272
+address $277
+address $292
+address $283
+address $288
+code
+LABELV $272
+ADDRGP4 s_startserver+2972
+INDIRI4
+CNSTI4 0
+LEI4 $270
+ADDRLP4 8
+ADDRGP4 s_startserver+2972
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $270
+JUMPV
+LABELV $277
+ADDRGP4 s_startserver+2972
+INDIRI4
+ADDRGP4 s_startserver+2976
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $270
+ADDRLP4 8
+ADDRGP4 s_startserver+2972
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $270
+JUMPV
+LABELV $283
+ADDRGP4 $284
+ARGP4
+ADDRGP4 s_startserver+792+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+2960
+INDIRI4
+ARGI4
+ADDRGP4 UI_ServerOptionsMenu
+CALLV
+pop
+ADDRGP4 $270
+JUMPV
+LABELV $288
+ADDRGP4 $289
+ARGP4
+ADDRGP4 s_startserver+888+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $270
+JUMPV
+LABELV $292
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $269
+LABELV $270
+LABELV $266
+endproc StartServer_MenuEvent 12 8
+proc StartServer_LevelshotDraw 64 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $296
+ADDRGP4 $295
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $300
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $300
+LABELV $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $302
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $304
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1105199104
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 48
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 s_startserver+2972
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 28
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 64
+BANDU4
+CNSTU4 0
+EQU4 $308
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $308
+LABELV $295
+endproc StartServer_LevelshotDraw 64 20
+bss
+align 1
+LABELV $311
+skip 64
+code
+proc StartServer_MenuInit 40 12
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 7076
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 $289
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+EQF4 $315
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $316
+ADDRGP4 s_startserver+888+60
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+544+60
+ADDRGP4 $326
+ASGNP4
+ADDRGP4 s_startserver+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_startserver+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+616+4
+ADDRGP4 $334
+ASGNP4
+ADDRGP4 s_startserver+616+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+616+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+616+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_startserver+616+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+616+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_startserver+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+704+4
+ADDRGP4 $348
+ASGNP4
+ADDRGP4 s_startserver+704+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+704+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_startserver+704+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_startserver+704+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+704+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_startserver+888
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_startserver+888+4
+ADDRGP4 $362
+ASGNP4
+ADDRGP4 s_startserver+888+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_startserver+888+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+888+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_startserver+888+12
+CNSTI4 344
+ASGNI4
+ADDRGP4 s_startserver+888+16
+CNSTI4 368
+ASGNI4
+ADDRGP4 s_startserver+792
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+792+4
+ADDRGP4 $376
+ASGNP4
+ADDRGP4 s_startserver+792+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_startserver+792+48
+ADDRGP4 StartServer_GametypeEvent
+ASGNP4
+ADDRGP4 s_startserver+792+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+792+12
+CNSTI4 296
+ASGNI4
+ADDRGP4 s_startserver+792+16
+CNSTI4 70
+ASGNI4
+ADDRGP4 s_startserver+792+76
+ADDRGP4 gametype_items
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $389
+ADDRLP4 20
+CNSTI4 140
+ASGNI4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MODI4
+MULI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+MULI4
+CNSTI4 96
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+80
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+60
+ADDP4
+ADDRGP4 $408
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+64
+ADDP4
+ADDRGP4 $411
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952+56
+ADDP4
+ADDRGP4 StartServer_LevelshotDraw
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+48
+ADDP4
+ADDRGP4 StartServer_MapEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+76
+ADDP4
+CNSTI4 256
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+80
+ADDP4
+CNSTI4 248
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656+60
+ADDP4
+ADDRGP4 $439
+ASGNP4
+LABELV $390
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $389
+ADDRGP4 s_startserver+2360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2360+4
+ADDRGP4 $443
+ASGNP4
+ADDRGP4 s_startserver+2360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+2360+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+2360+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+2360+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+2360+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+2448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2448+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+2448+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2448+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_startserver+2448+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+2448+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+2448+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2448+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+2448+60
+ADDRGP4 $471
+ASGNP4
+ADDRGP4 s_startserver+2536
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2536+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+2536+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2536+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_startserver+2536+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 s_startserver+2536+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+2536+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2536+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+2536+60
+ADDRGP4 $489
+ASGNP4
+ADDRGP4 s_startserver+2800
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_startserver+2800+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_startserver+2800+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+2800+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_startserver+2800+60
+ADDRGP4 $311
+ASGNP4
+ADDRGP4 s_startserver+2800+64
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_startserver+2800+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_startserver+2624
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2624+4
+ADDRGP4 $506
+ASGNP4
+ADDRGP4 s_startserver+2624+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+2624+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2624+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_startserver+2624+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2624+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+2624+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+2624+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2624+60
+ADDRGP4 $523
+ASGNP4
+ADDRGP4 s_startserver+2712
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2712+4
+ADDRGP4 $527
+ASGNP4
+ADDRGP4 s_startserver+2712+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_startserver+2712+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2712+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_startserver+2712+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+2712+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+2712+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+2712+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2712+60
+ADDRGP4 $544
+ASGNP4
+ADDRGP4 s_startserver+2872
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2872+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_startserver+2872+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2872+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2872+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+2872+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $560
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+952
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1656
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $561
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $560
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2624
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2712
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 StartServer_GametypeEvent
+CALLV
+pop
+LABELV $310
+endproc StartServer_MenuInit 40 12
+export StartServer_Cache
+proc StartServer_Cache 104 16
+ADDRGP4 $506
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $523
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $527
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $544
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $334
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $348
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $439
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $411
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $443
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $471
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $489
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $575
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $581
+JUMPV
+LABELV $578
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 68
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $579
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $581
+ADDRLP4 96
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $578
+LABELV $576
+LABELV $574
+endproc StartServer_Cache 104 16
+export UI_StartServerMenu
+proc UI_StartServerMenu 0 4
+ADDRGP4 StartServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_startserver+2960
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $582
+endproc UI_StartServerMenu 0 4
+data
+align 4
+LABELV playerType_list
+address $585
+address $586
+address $587
+byte 4 0
+align 4
+LABELV playerTeam_list
+address $588
+address $589
+byte 4 0
+align 4
+LABELV botSkill_list
+address $590
+address $591
+address $592
+address $593
+address $594
+byte 4 0
+align 4
+LABELV lmsMode_list
+address $595
+address $596
+address $597
+address $598
+byte 4 0
+align 4
+LABELV pmove_list
+address $599
+address $600
+address $601
+address $602
+byte 4 0
+code
+proc BotAlreadySelected 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $604
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $608
+ADDRGP4 $605
+JUMPV
+LABELV $608
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $612
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $612
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $612
+ADDRLP4 4
+CNSTI4 96
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+64
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_serveroptions+6532
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+64
+ADDP4
+INDIRI4
+EQI4 $612
+ADDRGP4 $605
+JUMPV
+LABELV $612
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $622
+CNSTI4 1
+RETI4
+ADDRGP4 $603
+JUMPV
+LABELV $622
+LABELV $605
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $604
+CNSTI4 0
+RETI4
+LABELV $603
+endproc BotAlreadySelected 12 8
+proc ServerOptions_Start 192 24
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+ADDRLP4 124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1124+60+12
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRGP4 s_serveroptions+1788+60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 s_serveroptions+2184+60
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRGP4 s_serveroptions+2248+60
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 s_serveroptions+2312+64
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 s_serveroptions+2472+60
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 s_serveroptions+2536+60
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 s_serveroptions+2408+60
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRGP4 s_serveroptions+2600+64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 s_serveroptions+2696+64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 $656
+JUMPV
+LABELV $653
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $657
+ADDRGP4 $654
+JUMPV
+LABELV $657
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $661
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $661
+ADDRGP4 $654
+JUMPV
+LABELV $661
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $654
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $656
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $653
+ADDRLP4 140
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $666
+ADDRLP4 140
+INDIRI4
+CNSTI4 13
+GTI4 $666
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $711
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $711
+address $669
+address $672
+address $666
+address $675
+address $679
+address $683
+address $687
+address $691
+address $695
+address $698
+address $701
+address $704
+address $666
+address $708
+code
+LABELV $669
+LABELV $666
+ADDRGP4 $670
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $671
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $672
+ADDRGP4 $673
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $674
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $675
+ADDRGP4 $676
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $677
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $678
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $679
+ADDRGP4 $680
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $681
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $682
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $683
+ADDRGP4 $684
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $685
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $686
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $687
+ADDRGP4 $688
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $689
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $690
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $691
+ADDRGP4 $692
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $693
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $694
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $695
+ADDRGP4 $696
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $697
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $698
+ADDRGP4 $699
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $700
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $701
+ADDRGP4 $702
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $703
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $704
+ADDRGP4 $705
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $706
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $707
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $708
+ADDRGP4 $709
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $710
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $667
+CNSTF4 0
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 144
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $712
+ARGP4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 148
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $713
+ARGP4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 156
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 164
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $715
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $716
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $717
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $718
+ARGP4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $719
+ARGP4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $720
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $721
+ARGP4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $722
+ARGP4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 172
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+EQI4 $725
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+EQI4 $729
+ADDRLP4 172
+INDIRI4
+CNSTI4 3
+EQI4 $730
+ADDRGP4 $723
+JUMPV
+LABELV $725
+ADDRGP4 $726
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $727
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $728
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $729
+ADDRGP4 $726
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $727
+ARGP4
+CNSTF4 1093664768
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $728
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $730
+ADDRGP4 $726
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $728
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRGP4 $726
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $728
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $724
+ADDRGP4 $731
+ARGP4
+ADDRGP4 s_serveroptions+1852+60+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 s_startserver+2964
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 180
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $737
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $738
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $739
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $743
+ADDRGP4 $740
+JUMPV
+LABELV $743
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $747
+ADDRGP4 $740
+JUMPV
+LABELV $747
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $750
+ADDRGP4 $740
+JUMPV
+LABELV $750
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $753
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $753
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $753
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $758
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $762
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $754
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $740
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $739
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $764
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $764
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $764
+ADDRGP4 $769
+ARGP4
+ADDRGP4 s_serveroptions+4880+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $764
+LABELV $625
+endproc ServerOptions_Start 192 24
+proc ServerOptions_InitPlayerItems 16 12
+ADDRGP4 s_serveroptions+6296
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $774
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $776
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $777
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $776
+ADDRGP4 s_serveroptions+6296
+INDIRI4
+CNSTI4 0
+EQI4 $782
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $787
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+NEI4 $782
+LABELV $787
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $788
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $789
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $788
+LABELV $782
+ADDRLP4 8
+ADDRGP4 s_serveroptions+2864+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_serveroptions+2864+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $798
+ARGP4
+ADDRGP4 s_serveroptions+6336
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_serveroptions+6336
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $802
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $802
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $802
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $807
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $808
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $807
+ADDRGP4 $816
+JUMPV
+LABELV $813
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $814
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $816
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $813
+ADDRGP4 $803
+JUMPV
+LABELV $802
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $819
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $820
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $819
+LABELV $803
+LABELV $772
+endproc ServerOptions_InitPlayerItems 16 12
+proc ServerOptions_SetPlayerItems 16 0
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+2792+60
+ADDRGP4 $828
+ASGNP4
+ADDRLP4 8
+ADDRGP4 s_serveroptions+4016+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294963199
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $831
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $835
+ADDRLP4 12
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $836
+JUMPV
+LABELV $835
+ADDRLP4 12
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $836
+LABELV $832
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $834
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $831
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $849
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $849
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+NEI4 $843
+LABELV $849
+ADDRGP4 $825
+JUMPV
+LABELV $843
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $853
+JUMPV
+LABELV $850
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $854
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $855
+LABELV $851
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $853
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $850
+LABELV $825
+endproc ServerOptions_SetPlayerItems 16 0
+proc ServerOptions_Event 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+LTI4 $863
+ADDRLP4 0
+INDIRI4
+CNSTI4 29
+GTI4 $863
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $879-88
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $879
+address $873
+address $863
+address $863
+address $866
+address $869
+address $863
+address $870
+address $876
+code
+LABELV $866
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $867
+ADDRGP4 $864
+JUMPV
+LABELV $867
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $864
+JUMPV
+LABELV $869
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $864
+JUMPV
+LABELV $870
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $871
+ADDRGP4 $864
+JUMPV
+LABELV $871
+ADDRGP4 ServerOptions_Start
+CALLV
+pop
+ADDRGP4 $864
+JUMPV
+LABELV $873
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $864
+ADDRGP4 $864
+JUMPV
+LABELV $876
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $877
+ADDRGP4 $864
+JUMPV
+LABELV $877
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $863
+LABELV $864
+LABELV $862
+endproc ServerOptions_Event 8 0
+proc ServerOptions_PlayerNameEvent 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $882
+ADDRGP4 $881
+JUMPV
+LABELV $882
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+6532
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu
+CALLV
+pop
+LABELV $881
+endproc ServerOptions_PlayerNameEvent 4 4
+proc ServerOptions_StatusBar 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $887
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $886
+endproc ServerOptions_StatusBar 0 20
+proc ServerOptions_StatusBar_Instantgib 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $889
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $888
+endproc ServerOptions_StatusBar_Instantgib 0 20
+proc ServerOptions_StatusBar_Allrockets 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $891
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $890
+endproc ServerOptions_StatusBar_Allrockets 0 20
+proc ServerOptions_StatusBar_Pure 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $893
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $892
+endproc ServerOptions_StatusBar_Pure 0 20
+proc ServerOptions_StatusBar_Oneway 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $895
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $894
+endproc ServerOptions_StatusBar_Oneway 0 20
+proc ServerOptions_StatusBar_Pmove 8 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $897
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GTI4 $897
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $909
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $909
+address $900
+address $903
+address $903
+address $906
+code
+LABELV $900
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $901
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $902
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $898
+JUMPV
+LABELV $903
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $904
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $905
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $898
+JUMPV
+LABELV $906
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $907
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $905
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $898
+JUMPV
+LABELV $897
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $908
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $898
+LABELV $896
+endproc ServerOptions_StatusBar_Pmove 8 20
+proc ServerOptions_LevelshotDraw 20 20
+ADDRGP4 s_serveroptions+6528
+INDIRI4
+CNSTI4 0
+EQI4 $911
+ADDRGP4 s_serveroptions+6532
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRGP4 s_serveroptions+6536
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6528
+CNSTI4 0
+ASGNI4
+LABELV $911
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_serveroptions+6304
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_remap2
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_items
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $910
+endproc ServerOptions_LevelshotDraw 20 20
+proc ServerOptions_InitBotNames 1072 12
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $921
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $921
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $921
+ADDRGP4 s_serveroptions+6336+16
+ARGP4
+ADDRGP4 $928
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6336+32
+ARGP4
+ADDRGP4 $931
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6336+48
+ARGP4
+ADDRGP4 $934
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+EQI4 $935
+ADDRGP4 mapinfo+12
+INDIRI4
+CNSTI4 4
+GEI4 $935
+ADDRGP4 s_serveroptions+2864+288+64
+CNSTI4 2
+ASGNI4
+LABELV $935
+ADDRGP4 s_serveroptions+6336+64
+ARGP4
+ADDRGP4 $944
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 mapinfo+12
+INDIRI4
+CNSTI4 5
+GEI4 $945
+ADDRGP4 s_serveroptions+2864+384+64
+CNSTI4 2
+ASGNI4
+LABELV $945
+ADDRGP4 s_serveroptions+6336+80
+ARGP4
+ADDRGP4 $953
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+2864+480+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+6336+96
+ARGP4
+ADDRGP4 $959
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6336+112
+ARGP4
+ADDRGP4 $962
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6336+128
+ARGP4
+ADDRGP4 $965
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6336+144
+ARGP4
+ADDRGP4 $953
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+EQI4 $968
+ADDRGP4 mapinfo+12
+INDIRI4
+CNSTI4 4
+GEI4 $968
+ADDRGP4 s_serveroptions+2864+864+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $969
+JUMPV
+LABELV $968
+ADDRGP4 s_serveroptions+2864+864+64
+CNSTI4 1
+ASGNI4
+LABELV $969
+ADDRGP4 s_serveroptions+6336+160
+ARGP4
+ADDRGP4 $944
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 mapinfo+12
+INDIRI4
+CNSTI4 5
+GEI4 $980
+ADDRGP4 s_serveroptions+2864+960+64
+CNSTI4 2
+ASGNI4
+LABELV $980
+ADDRGP4 s_serveroptions+6336+176
+ARGP4
+ADDRGP4 $953
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+2864+1056+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $991
+ARGP4
+ADDRGP4 mapinfo+12
+INDIRI4
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $920
+JUMPV
+LABELV $921
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+6304
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $994
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $996
+JUMPV
+LABELV $998
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $999
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $998
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1001
+ADDRGP4 $997
+JUMPV
+LABELV $1001
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1004
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+NEI4 $1003
+LABELV $1006
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1007
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1007
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $798
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1011
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1009
+ADDRLP4 8
+ADDRGP4 $1012
+ASGNP4
+LABELV $1009
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $996
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1015
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $999
+LABELV $1015
+LABELV $997
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1019
+JUMPV
+LABELV $1016
+ADDRLP4 1056
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $1023
+ADDRLP4 1056
+INDIRI4
+CNSTI4 1
+EQI4 $1026
+ADDRLP4 1056
+INDIRI4
+CNSTI4 2
+EQI4 $1029
+ADDRGP4 $1020
+JUMPV
+LABELV $1023
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRGP4 $1025
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1021
+JUMPV
+LABELV $1026
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRGP4 $1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1021
+JUMPV
+LABELV $1029
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $1021
+JUMPV
+LABELV $1020
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ARGP4
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1021
+LABELV $1017
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1019
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+LTI4 $1016
+ADDRGP4 $1037
+JUMPV
+LABELV $1034
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1035
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1037
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $1034
+ADDRGP4 $1043
+JUMPV
+LABELV $1040
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1044
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $1044
+LABELV $1041
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1043
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $1040
+LABELV $920
+endproc ServerOptions_InitBotNames 1072 12
+bss
+align 1
+LABELV $1051
+skip 64
+code
+proc ServerOptions_SetMenuItems 272 16
+ADDRLP4 4
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1052
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+GTI4 $1052
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1170
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1170
+address $1055
+address $1062
+address $1052
+address $1069
+address $1079
+address $1090
+address $1100
+address $1110
+address $1120
+address $1127
+address $1134
+address $1141
+address $1151
+address $1163
+code
+LABELV $1055
+LABELV $1052
+ADDRGP4 $670
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1124+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $671
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1053
+JUMPV
+LABELV $1062
+ADDRGP4 $673
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1124+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $674
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1053
+JUMPV
+LABELV $1069
+ADDRGP4 $676
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1124+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $677
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1078
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1079
+ADDRGP4 $1083
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $681
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1089
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1090
+ADDRGP4 $684
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $685
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1099
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 108
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 108
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1100
+ADDRGP4 $688
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $689
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 124
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1109
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 132
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1110
+ADDRGP4 $692
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 140
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $693
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 148
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1120
+ADDRGP4 $696
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 164
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $697
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1053
+JUMPV
+LABELV $1127
+ADDRGP4 $699
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $700
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 184
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1053
+JUMPV
+LABELV $1134
+ADDRGP4 $702
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 192
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1124+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 196
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $703
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 200
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 204
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1053
+JUMPV
+LABELV $1141
+ADDRGP4 $705
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 208
+INDIRF4
+ARGF4
+ADDRLP4 212
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 212
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $706
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 216
+INDIRF4
+ARGF4
+ADDRLP4 220
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1150
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 224
+INDIRF4
+ARGF4
+ADDRLP4 228
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 228
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1151
+ADDRGP4 $1155
+ARGP4
+ADDRLP4 232
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 232
+INDIRF4
+ARGF4
+ADDRLP4 236
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1456+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 236
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1159
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 240
+INDIRF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 244
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1162
+ARGP4
+ADDRLP4 248
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 248
+INDIRF4
+ARGF4
+ADDRLP4 252
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1788+60
+ADDRLP4 252
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1163
+ADDRGP4 $709
+ARGP4
+ADDRLP4 256
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 256
+INDIRF4
+ARGF4
+ADDRLP4 260
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1124+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 260
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $710
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 264
+INDIRF4
+ARGF4
+ADDRLP4 268
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+792+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1053
+ADDRGP4 $731
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+1852+60+12
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $717
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2184+60
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1181
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2248+60
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $719
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2472+60
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $720
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2536+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $721
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1077936128
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2600+64
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $722
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2408+60
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+2312+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $726
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1192
+ADDRGP4 s_serveroptions+2312+64
+CNSTI4 1
+ASGNI4
+LABELV $1192
+ADDRGP4 $726
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1196
+ADDRGP4 $727
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1093664768
+NEF4 $1196
+ADDRGP4 s_serveroptions+2312+64
+CNSTI4 2
+ASGNI4
+LABELV $1196
+ADDRGP4 $728
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 0
+EQF4 $1200
+ADDRGP4 s_serveroptions+2312+64
+CNSTI4 3
+ASGNI4
+LABELV $1200
+ADDRGP4 s_startserver+2964
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $150
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $1051
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 s_serveroptions+616+4
+ADDRGP4 $1051
+ASGNP4
+ADDRGP4 s_serveroptions+6304
+ARGP4
+ADDRGP4 s_startserver+2800+60
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_serveroptions+6304
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 s_startserver+2800+60
+INDIRP4
+ARGP4
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+ARGI4
+ADDRGP4 mapinfo
+ARGP4
+ADDRGP4 MapInfoGet
+CALLV
+pop
+ADDRGP4 ServerOptions_InitPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_InitBotNames
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+LABELV $1050
+endproc ServerOptions_SetMenuItems 272 16
+proc PlayerName_Draw 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1217
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1218
+JUMPV
+LABELV $1217
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1218
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $1219
+ADDRLP4 4
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $1220
+JUMPV
+LABELV $1219
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1221
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $1223
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $1224
+JUMPV
+LABELV $1223
+ADDRLP4 4
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $1224
+LABELV $1222
+LABELV $1220
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1225
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $1225
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $1215
+endproc PlayerName_Draw 52 20
+proc ServerOptions_MenuInit 44 12
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6552
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_serveroptions+6296
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1095761920
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+6300
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 s_serveroptions+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_serveroptions+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_serveroptions+544+60
+ADDRGP4 $326
+ASGNP4
+ADDRGP4 s_serveroptions+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_serveroptions+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+616+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_serveroptions+616+12
+CNSTI4 352
+ASGNI4
+ADDRGP4 s_serveroptions+616+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+616+76
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_serveroptions+616+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_serveroptions+616+64
+ADDRGP4 $411
+ASGNP4
+ADDRGP4 s_serveroptions+616+56
+ADDRGP4 ServerOptions_LevelshotDraw
+ASGNP4
+ADDRGP4 s_serveroptions+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+704+44
+CNSTU4 16452
+ASGNU4
+ADDRGP4 s_serveroptions+704+12
+CNSTI4 314
+ASGNI4
+ADDRGP4 s_serveroptions+704+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+704+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+704+80
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+704+60
+ADDRGP4 $439
+ASGNP4
+ADDRLP4 4
+CNSTI4 268
+ASGNI4
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 4
+LTI4 $1275
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+NEI4 $1271
+LABELV $1275
+ADDRGP4 s_serveroptions+1124
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1124+4
+ADDRGP4 $1279
+ASGNP4
+ADDRGP4 s_serveroptions+1124+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+1124+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1124+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1124+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+1124+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+1124+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1272
+JUMPV
+LABELV $1271
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+NEI4 $1294
+ADDRGP4 s_serveroptions+1124
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1124+4
+ADDRGP4 $1300
+ASGNP4
+ADDRGP4 s_serveroptions+1124+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+1124+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1124+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1124+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+1124+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+1124+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1295
+JUMPV
+LABELV $1294
+ADDRGP4 s_serveroptions+1456
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1456+4
+ADDRGP4 $1318
+ASGNP4
+ADDRGP4 s_serveroptions+1456+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+1456+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1456+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1456+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+1456+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+1456+60+268
+CNSTI4 3
+ASGNI4
+LABELV $1295
+LABELV $1272
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+792
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+792+4
+ADDRGP4 $1336
+ASGNP4
+ADDRGP4 s_serveroptions+792+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+792+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+792+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+792+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+792+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+792+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $1351
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $1351
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $1351
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 8
+EQI4 $1351
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 9
+EQI4 $1351
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+1788
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+1788+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+1788+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1788+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1788+4
+ADDRGP4 $1367
+ASGNP4
+LABELV $1351
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 9
+NEI4 $1368
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2408
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2408+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2408+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2408+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2408+4
+ADDRGP4 $1380
+ASGNP4
+ADDRGP4 s_serveroptions+2408+52
+ADDRGP4 ServerOptions_StatusBar_Oneway
+ASGNP4
+LABELV $1368
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2184
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2184+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2184+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2184+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2184+4
+ADDRGP4 $1392
+ASGNP4
+ADDRGP4 s_serveroptions+2184+52
+ADDRGP4 ServerOptions_StatusBar_Pure
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2472
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2472+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2472+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2472+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2472+4
+ADDRGP4 $1404
+ASGNP4
+ADDRGP4 s_serveroptions+2472+52
+ADDRGP4 ServerOptions_StatusBar_Instantgib
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2536
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2536+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2536+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2536+4
+ADDRGP4 $1416
+ASGNP4
+ADDRGP4 s_serveroptions+2536+52
+ADDRGP4 ServerOptions_StatusBar_Allrockets
+ASGNP4
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+NEI4 $1419
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2600
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+2600+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2600+4
+ADDRGP4 $1427
+ASGNP4
+ADDRGP4 s_serveroptions+2600+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2600+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2600+76
+ADDRGP4 lmsMode_list
+ASGNP4
+LABELV $1419
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2312
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+2312+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2312+4
+ADDRGP4 $1439
+ASGNP4
+ADDRGP4 s_serveroptions+2312+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2312+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2312+76
+ADDRGP4 pmove_list
+ASGNP4
+ADDRGP4 s_serveroptions+2312+52
+ADDRGP4 ServerOptions_StatusBar_Pmove
+ASGNP4
+ADDRGP4 s_serveroptions+6296
+INDIRI4
+CNSTI4 0
+EQI4 $1448
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2248
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2248+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2248+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2248+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2248+4
+ADDRGP4 $1460
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+1852
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1852+4
+ADDRGP4 $1464
+ASGNP4
+ADDRGP4 s_serveroptions+1852+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+1852+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1852+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1852+60+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+1852+60+268
+CNSTI4 64
+ASGNI4
+LABELV $1448
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+2696
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+2696+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2696+4
+ADDRGP4 $1482
+ASGNP4
+ADDRGP4 s_serveroptions+2696+4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 s_serveroptions+2696+12
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 16
+ADDI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2696+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2696+76
+ADDRGP4 botSkill_list
+ASGNP4
+ADDRGP4 s_serveroptions+2696+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2792
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_serveroptions+2792+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+2792+12
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+2792+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2792+68
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_serveroptions+2792+64
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1504
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+8
+ADDP4
+CNSTI4 25
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+48
+ADDP4
+ADDRGP4 ServerOptions_Event
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+12
+ADDP4
+CNSTI4 32
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864+76
+ADDP4
+ADDRGP4 playerType_list
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+12
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+48
+ADDP4
+ADDRGP4 ServerOptions_PlayerNameEvent
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+56
+ADDP4
+ADDRGP4 PlayerName_Draw
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+64
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+6336
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 s_serveroptions+4016+24
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 s_serveroptions+4016+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 s_serveroptions+4016+32
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 s_serveroptions+4016+16
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+4016+20
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+4016+12
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+4016+28
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+4016+12
+ADDP4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+12
+ADDP4
+CNSTI4 240
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880+76
+ADDP4
+ADDRGP4 playerTeam_list
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1505
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1504
+ADDRGP4 s_serveroptions+6208
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+6208+4
+ADDRGP4 $506
+ASGNP4
+ADDRGP4 s_serveroptions+6208+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_serveroptions+6208+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+6208+8
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_serveroptions+6208+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+6208+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+6208+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+6208+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+6208+60
+ADDRGP4 $523
+ASGNP4
+ADDRGP4 s_serveroptions+6120
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+6120+4
+ADDRGP4 $527
+ASGNP4
+ADDRGP4 s_serveroptions+6120+44
+CNSTU4 28944
+ASGNU4
+ADDRGP4 s_serveroptions+6120+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+6120+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_serveroptions+6120+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+6120+16
+CNSTI4 344
+ASGNI4
+ADDRGP4 s_serveroptions+6120+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+6120+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+6120+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+6120+60
+ADDRGP4 $544
+ASGNP4
+ADDRGP4 s_serveroptions+6032
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+6032+4
+ADDRGP4 $1609
+ASGNP4
+ADDRGP4 s_serveroptions+6032+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_serveroptions+6032+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+6032+8
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_serveroptions+6032+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+6032+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+6032+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+6032+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+6032+60
+ADDRGP4 $1626
+ASGNP4
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2696
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1632
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1636
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2864
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1636
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4016
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $1640
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $1640
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4880
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1640
+LABELV $1633
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1632
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 4
+LTI4 $1651
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $1651
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+NEI4 $1645
+LABELV $1651
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1124
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1646
+JUMPV
+LABELV $1645
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1646
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 3
+LTI4 $1655
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+EQI4 $1655
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 13
+EQI4 $1655
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 8
+EQI4 $1655
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 9
+EQI4 $1655
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1788
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1655
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2184
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2472
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 10
+NEI4 $1666
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2600
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1666
+ADDRGP4 s_serveroptions+6300
+INDIRI4
+CNSTI4 9
+NEI4 $1670
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2408
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1670
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2312
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+6296
+INDIRI4
+CNSTI4 0
+EQI4 $1675
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2248
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1852
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1675
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+6208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+6120
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+6032
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ServerOptions_SetMenuItems
+CALLV
+pop
+LABELV $1227
+endproc ServerOptions_MenuInit 44 12
+export ServerOptions_Cache
+proc ServerOptions_Cache 0 4
+ADDRGP4 $506
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $523
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1609
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1626
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $439
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $411
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1683
+endproc ServerOptions_Cache 0 4
+proc UI_ServerOptionsMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ServerOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1684
+endproc UI_ServerOptionsMenu 0 4
+proc UI_BotSelectMenu_SortCompare 44 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $798
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $798
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+LABELV $1686
+endproc UI_BotSelectMenu_SortCompare 44 8
+proc UI_BotSelectMenu_BuildList 12 16
+ADDRGP4 botSelectInfo+5028
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+5024
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+5032
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $1692
+ADDRLP4 8
+ADDRGP4 botSelectInfo+5032
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1692
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1699
+JUMPV
+LABELV $1696
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+5040
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1697
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1699
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+LTI4 $1696
+ADDRGP4 botSelectInfo+5040
+ARGP4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 UI_BotSelectMenu_SortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $1687
+endproc UI_BotSelectMenu_BuildList 12 16
+proc ServerPlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1706
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1707
+JUMPV
+LABELV $1706
+ADDRLP4 0
+ADDRGP4 $1708
+ASGNP4
+LABELV $1707
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1709
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1710
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1708
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $1710
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1712
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1710
+LABELV $1705
+endproc ServerPlayerIcon 80 20
+proc UI_BotSelectMenu_UpdateGrid 36 12
+ADDRLP4 4
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1715
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+GEI4 $1719
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+5040
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1723
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+9136
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ServerPlayerIcon
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $798
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+10160
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+10160
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+9136
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+10160
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BotAlreadySelected
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1730
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $1731
+JUMPV
+LABELV $1730
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $1731
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1720
+JUMPV
+LABELV $1719
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+10160
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1720
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1716
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1715
+ADDRLP4 0
+ADDRGP4 botSelectInfo+5036
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+5032
+INDIRI4
+CNSTI4 1
+LEI4 $1755
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+CNSTI4 0
+LEI4 $1758
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4672+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1759
+JUMPV
+LABELV $1758
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4672+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1759
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+ADDRGP4 botSelectInfo+5032
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1765
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4760+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1756
+JUMPV
+LABELV $1765
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4760+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $1756
+JUMPV
+LABELV $1755
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4672+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 botSelectInfo+4760+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1756
+LABELV $1713
+endproc UI_BotSelectMenu_UpdateGrid 36 12
+proc UI_BotSelectMenu_Default 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1781
+JUMPV
+LABELV $1778
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $798
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1783
+ADDRGP4 $1780
+JUMPV
+LABELV $1783
+LABELV $1779
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1781
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+LTI4 $1778
+LABELV $1780
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+NEI4 $1785
+ADDRGP4 botSelectInfo+5036
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1785
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1792
+JUMPV
+LABELV $1789
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+5040
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1794
+ADDRGP4 $1791
+JUMPV
+LABELV $1794
+LABELV $1790
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1792
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+LTI4 $1789
+LABELV $1791
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+5024
+INDIRI4
+NEI4 $1797
+ADDRGP4 botSelectInfo+5036
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1797
+ADDRGP4 botSelectInfo+5036
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1777
+endproc UI_BotSelectMenu_Default 28 8
+proc UI_BotSelectMenu_LeftEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1803
+ADDRGP4 $1802
+JUMPV
+LABELV $1803
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+CNSTI4 0
+LEI4 $1805
+ADDRLP4 0
+ADDRGP4 botSelectInfo+5028
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 botSelectInfo+5036
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1805
+LABELV $1802
+endproc UI_BotSelectMenu_LeftEvent 4 0
+proc UI_BotSelectMenu_RightEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1812
+ADDRGP4 $1811
+JUMPV
+LABELV $1812
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+ADDRGP4 botSelectInfo+5032
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1814
+ADDRLP4 0
+ADDRGP4 botSelectInfo+5028
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botSelectInfo+5036
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1814
+LABELV $1811
+endproc UI_BotSelectMenu_RightEvent 4 0
+proc UI_BotSelectMenu_BotEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1822
+ADDRGP4 $1821
+JUMPV
+LABELV $1822
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1824
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1825
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1824
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+5036
+ADDRGP4 botSelectInfo+5028
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1821
+endproc UI_BotSelectMenu_BotEvent 12 0
+proc UI_BotSelectMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1839
+ADDRGP4 $1838
+JUMPV
+LABELV $1839
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $1838
+endproc UI_BotSelectMenu_BackEvent 0 0
+proc UI_BotSelectMenu_SelectEvent 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1842
+ADDRGP4 $1841
+JUMPV
+LABELV $1842
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 s_serveroptions+6528
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+6536
+ARGP4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+5036
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+10160
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1841
+endproc UI_BotSelectMenu_SelectEvent 4 12
+export UI_BotSelectMenu_Cache
+proc UI_BotSelectMenu_Cache 0 4
+ADDRGP4 $506
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $523
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1849
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1850
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1851
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1852
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $443
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $471
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $489
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1848
+endproc UI_BotSelectMenu_Cache 0 4
+proc UI_BotSelectMenu_Init 36 12
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 10416
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botSelectInfo+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 botSelectInfo+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 botSelectInfo+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 botSelectInfo+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+544+60
+ADDRGP4 $1863
+ASGNP4
+ADDRGP4 botSelectInfo+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 botSelectInfo+544+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1871
+JUMPV
+LABELV $1868
+ADDRLP4 4
+CNSTI4 180
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1872
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+9136
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+60
+ADDP4
+ADDRGP4 $1852
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+48
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+60
+ADDP4
+ADDRGP4 $1851
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+10160
+ADDP4
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432+64
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1873
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $1872
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 86
+ADDI4
+ASGNI4
+LABELV $1869
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1871
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $1868
+ADDRGP4 botSelectInfo+4584
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4584+4
+ADDRGP4 $443
+ASGNP4
+ADDRGP4 botSelectInfo+4584+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 botSelectInfo+4584+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4584+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4584+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4584+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4672
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4672+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4672+48
+ADDRGP4 UI_BotSelectMenu_LeftEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4672+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4672+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4672+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4672+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4672+60
+ADDRGP4 $471
+ASGNP4
+ADDRGP4 botSelectInfo+4760
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4760+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4760+48
+ADDRGP4 UI_BotSelectMenu_RightEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4760+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 botSelectInfo+4760+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4760+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4760+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4760+60
+ADDRGP4 $489
+ASGNP4
+ADDRGP4 botSelectInfo+4936
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4936+4
+ADDRGP4 $506
+ASGNP4
+ADDRGP4 botSelectInfo+4936+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4936+48
+ADDRGP4 UI_BotSelectMenu_BackEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4936+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 botSelectInfo+4936+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4936+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4936+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4936+60
+ADDRGP4 $523
+ASGNP4
+ADDRGP4 botSelectInfo+4848
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4848+4
+ADDRGP4 $1849
+ASGNP4
+ADDRGP4 botSelectInfo+4848+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 botSelectInfo+4848+48
+ADDRGP4 UI_BotSelectMenu_SelectEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4848+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+4848+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4848+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4848+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4848+60
+ADDRGP4 $1850
+ASGNP4
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $2013
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+616
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+2024
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 72
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3432
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $2014
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $2013
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4672
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4760
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4936
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4848
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_BuildList
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Default
+CALLV
+pop
+ADDRGP4 botSelectInfo+5028
+ADDRGP4 botSelectInfo+5036
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1853
+endproc UI_BotSelectMenu_Init 36 12
+export UI_BotSelectMenu
+proc UI_BotSelectMenu 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Init
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $2027
+endproc UI_BotSelectMenu 0 4
+bss
+align 4
+LABELV botSelectInfo
+skip 10416
+align 4
+LABELV s_serveroptions
+skip 6552
+align 4
+LABELV mapinfo
+skip 9328
+align 4
+LABELV s_startserver
+skip 7076
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1863
+byte 1 83
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $1852
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1851
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1850
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1849
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1723
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1712
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1709
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1708
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1626
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1609
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1482
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1464
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1460
+byte 1 79
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 76
+byte 1 65
+byte 1 78
+byte 1 58
+byte 1 0
+align 1
+LABELV $1439
+byte 1 80
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $1427
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1416
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $1404
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 58
+byte 1 0
+align 1
+LABELV $1392
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1380
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 58
+byte 1 0
+align 1
+LABELV $1367
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1336
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1318
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1300
+byte 1 83
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $1279
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1181
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1162
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1159
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1155
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1150
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1119
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1109
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1099
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1089
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1083
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1078
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $1033
+byte 1 83
+byte 1 107
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $1031
+byte 1 75
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 0
+align 1
+LABELV $1028
+byte 1 77
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $1025
+byte 1 71
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1012
+byte 1 83
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1011
+byte 1 0
+align 1
+LABELV $994
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $991
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $965
+byte 1 103
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $962
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $959
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 0
+align 1
+LABELV $953
+byte 1 115
+byte 1 107
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $944
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $934
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 0
+align 1
+LABELV $931
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 0
+align 1
+LABELV $928
+byte 1 103
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 111
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $908
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $907
+byte 1 80
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $905
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $904
+byte 1 80
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $902
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $901
+byte 1 80
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $895
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $893
+byte 1 82
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 107
+byte 1 51
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $891
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 46
+byte 1 32
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $889
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $887
+byte 1 48
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $828
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $798
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $769
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $762
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $758
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $738
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $737
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $731
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $728
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $727
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $726
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $722
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $721
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $720
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $719
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $718
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $717
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $716
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $715
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $714
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $713
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $712
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $710
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $709
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $707
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $706
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $705
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $703
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $702
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $700
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $699
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $697
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $696
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $694
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $693
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $692
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $690
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $689
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $688
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $686
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $685
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $684
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $682
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $681
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $680
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $678
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $677
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $676
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $674
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $673
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $671
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $670
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $602
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $601
+byte 1 70
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 57
+byte 1 49
+byte 1 72
+byte 1 122
+byte 1 0
+align 1
+LABELV $600
+byte 1 70
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 53
+byte 1 72
+byte 1 122
+byte 1 0
+align 1
+LABELV $599
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $598
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 45
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $597
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 43
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $596
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 45
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $595
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 43
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $594
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $593
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $592
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $591
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $590
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $589
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $588
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $587
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $586
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $585
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $575
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $544
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $527
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $523
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $506
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $489
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $471
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $443
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $439
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $411
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $408
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $376
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $362
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 0
+align 1
+LABELV $348
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $334
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $326
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $289
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $284
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $226
+byte 1 87
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $223
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $218
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $217
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $215
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $212
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $207
+byte 1 87
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 50
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $183
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 83
+byte 1 32
+byte 1 70
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $151
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $150
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $138
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $135
+byte 1 100
+byte 1 100
+byte 1 0
+align 1
+LABELV $132
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $129
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $126
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $123
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $120
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $117
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $108
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $102
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $93
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $92
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $91
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $90
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $89
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $88
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $87
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $86
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $85
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $83
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $82
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $81
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
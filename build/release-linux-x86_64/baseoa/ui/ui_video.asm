@@ -0,0 +1,5857 @@
+data
+align 4
+LABELV driverinfo_artlist
+address $80
+address $81
+address $82
+address $83
+byte 4 0
+code
+proc DriverInfo_Event 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $86
+ADDRGP4 $85
+JUMPV
+LABELV $86
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $91
+ADDRGP4 $88
+JUMPV
+LABELV $91
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $88
+LABELV $89
+LABELV $85
+endproc DriverInfo_Event 4 0
+proc DriverInfo_MenuDraw 12 20
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRGP4 $93
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 $94
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 192
+ARGI4
+ADDRGP4 $95
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRGP4 uis+56+256
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 uis+56+512
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 128
+ARGI4
+ADDRGP4 uis+56
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $101
+ARGP4
+ADDRGP4 uis+56+11272
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+11276
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+11280
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 168
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 208
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $108
+CNSTI4 316
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 324
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $109
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $111
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_driverinfo+2160
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $108
+ADDRGP4 s_driverinfo+2160
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $116
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_driverinfo+2160
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $116
+LABELV $92
+endproc DriverInfo_MenuDraw 12 20
+export DriverInfo_Cache
+proc DriverInfo_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $123
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $127
+ADDRGP4 $125
+JUMPV
+LABELV $127
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $125
+LABELV $122
+endproc DriverInfo_Cache 4 4
+proc UI_DriverInfo_Menu 32 12
+ADDRGP4 s_driverinfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2164
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 s_driverinfo+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+524
+ADDRGP4 DriverInfo_MenuDraw
+ASGNP4
+ADDRGP4 s_driverinfo+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_driverinfo+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_driverinfo+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_driverinfo+544+60
+ADDRGP4 $139
+ASGNP4
+ADDRGP4 s_driverinfo+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_driverinfo+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+704+4
+ADDRGP4 $80
+ASGNP4
+ADDRGP4 s_driverinfo+704+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+704+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+704+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_driverinfo+704+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+704+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_driverinfo+792
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+792+4
+ADDRGP4 $81
+ASGNP4
+ADDRGP4 s_driverinfo+792+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+792+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_driverinfo+792+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_driverinfo+792+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+792+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_driverinfo+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+616+4
+ADDRGP4 $82
+ASGNP4
+ADDRGP4 s_driverinfo+616+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_driverinfo+616+48
+ADDRGP4 DriverInfo_Event
+ASGNP4
+ADDRGP4 s_driverinfo+616+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_driverinfo+616+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+616+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_driverinfo+616+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_driverinfo+616+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_driverinfo+616+60
+ADDRGP4 $83
+ASGNP4
+ADDRGP4 s_driverinfo+880
+ARGP4
+ADDRGP4 uis+56+1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 s_driverinfo+880
+ASGNP4
+ADDRGP4 $194
+JUMPV
+LABELV $197
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $198
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $197
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $205
+ADDRLP4 24
+ADDRGP4 s_driverinfo+2160
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $205
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRLP4 28
+INDIRI4
+CNSTI4 32
+NEI4 $204
+LABELV $207
+LABELV $194
+ADDRGP4 s_driverinfo+2160
+INDIRI4
+CNSTI4 40
+GEI4 $208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $198
+LABELV $208
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $209
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $215
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 62
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1904
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $215
+LABELV $210
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $212
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_driverinfo+2160
+INDIRI4
+LTI4 $209
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $129
+endproc UI_DriverInfo_Menu 32 12
+data
+align 4
+LABELV s_ivo_templates
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 4
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+align 4
+LABELV builtinResolutions
+address $225
+address $226
+address $227
+address $228
+address $229
+address $230
+address $231
+address $232
+address $233
+address $234
+address $235
+address $236
+byte 4 0
+align 4
+LABELV knownRatios
+address $237
+address $238
+address $239
+address $240
+address $241
+address $242
+address $243
+address $244
+address $245
+address $246
+address $247
+address $248
+address $249
+address $250
+byte 4 0
+byte 4 0
+align 4
+LABELV resolutions
+address builtinResolutions
+align 4
+LABELV resolutionsDetected
+byte 4 0
+code
+proc GraphicsOptions_FindBuiltinResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $254
+CNSTI4 -1
+RETI4
+ADDRGP4 $251
+JUMPV
+LABELV $254
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $256
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $260
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $251
+JUMPV
+LABELV $260
+LABELV $257
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $259
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $256
+CNSTI4 -1
+RETI4
+LABELV $251
+endproc GraphicsOptions_FindBuiltinResolution 12 8
+proc GraphicsOptions_FindDetectedResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $263
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $265
+CNSTI4 -1
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $265
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $267
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $271
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $271
+LABELV $268
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $270
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $267
+CNSTI4 -1
+RETI4
+LABELV $262
+endproc GraphicsOptions_FindDetectedResolution 12 8
+proc GraphicsOptions_GetAspectRatios 48 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $279
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $283
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $281
+JUMPV
+LABELV $283
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $279
+LABELV $281
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $286
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRGP4 $288
+JUMPV
+LABELV $290
+LABELV $287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $289
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $286
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $292
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ratioBuf
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $275
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $277
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $273
+endproc GraphicsOptions_GetAspectRatios 48 16
+proc GraphicsOptions_GetInitialVideo 0 0
+ADDRGP4 s_ivo+44
+ADDRGP4 s_graphicsoptions+1368+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+4
+ADDRGP4 s_graphicsoptions+1540+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+48
+ADDRGP4 s_graphicsoptions+1924+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+8
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_ivo+12
+ADDRGP4 s_graphicsoptions+1636+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+16
+ADDRGP4 s_graphicsoptions+1732+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+20
+ADDRGP4 s_graphicsoptions+1828+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+24
+ADDRGP4 s_graphicsoptions+2404+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+32
+ADDRGP4 s_graphicsoptions+2116+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+36
+ADDRGP4 s_graphicsoptions+2212+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+40
+ADDRGP4 s_graphicsoptions+2308+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+28
+ADDRGP4 s_graphicsoptions+2020+64
+INDIRI4
+ASGNI4
+LABELV $294
+endproc GraphicsOptions_GetInitialVideo 0 0
+proc GraphicsOptions_GetResolutions 24 12
+ADDRGP4 $334
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 resbuf
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 resbuf
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $335
+ADDRLP4 4
+ADDRGP4 resbuf
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 16
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $340
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $340
+LABELV $338
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $342
+ADDRLP4 8
+INDIRU4
+CNSTU4 31
+LTU4 $337
+LABELV $342
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $343
+ADDRGP4 resolutions
+ADDRGP4 detectedResolutions
+ASGNP4
+ADDRGP4 resolutionsDetected
+CNSTI4 1
+ASGNI4
+LABELV $343
+LABELV $335
+LABELV $333
+endproc GraphicsOptions_GetResolutions 24 12
+proc GraphicsOptions_CheckConfig 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $346
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+44
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1368+64
+INDIRI4
+EQI4 $350
+ADDRGP4 $347
+JUMPV
+LABELV $350
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+EQI4 $355
+ADDRGP4 $347
+JUMPV
+LABELV $355
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+4
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1540+64
+INDIRI4
+EQI4 $359
+ADDRGP4 $347
+JUMPV
+LABELV $359
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+EQF4 $364
+ADDRGP4 $347
+JUMPV
+LABELV $364
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+12
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1636+64
+INDIRI4
+EQI4 $369
+ADDRGP4 $347
+JUMPV
+LABELV $369
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+16
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1732+64
+INDIRI4
+EQI4 $374
+ADDRGP4 $347
+JUMPV
+LABELV $374
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+20
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1828+64
+INDIRI4
+EQI4 $379
+ADDRGP4 $347
+JUMPV
+LABELV $379
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+24
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+2404+64
+INDIRI4
+EQI4 $384
+ADDRGP4 $347
+JUMPV
+LABELV $384
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+32
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+2116+64
+INDIRI4
+EQI4 $389
+ADDRGP4 $347
+JUMPV
+LABELV $389
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+36
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+2212+64
+INDIRI4
+EQI4 $394
+ADDRGP4 $347
+JUMPV
+LABELV $394
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+40
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+2308+64
+INDIRI4
+EQI4 $399
+ADDRGP4 $347
+JUMPV
+LABELV $399
+ADDRGP4 s_graphicsoptions+1080+64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $349
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 5
+LTU4 $346
+ADDRGP4 s_graphicsoptions+1080+64
+CNSTI4 5
+ASGNI4
+LABELV $345
+endproc GraphicsOptions_CheckConfig 8 4
+proc GraphicsOptions_UpdateMenuItems 8 0
+ADDRGP4 s_graphicsoptions+1368+64
+INDIRI4
+CNSTI4 1
+NEI4 $409
+ADDRGP4 s_graphicsoptions+1540+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1540+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1540+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $410
+ADDRGP4 s_graphicsoptions+1924+64
+INDIRI4
+CNSTI4 0
+NEI4 $419
+ADDRGP4 s_graphicsoptions+2020+64
+INDIRI4
+CNSTI4 0
+NEI4 $423
+ADDRGP4 s_graphicsoptions+2020+64
+CNSTI4 1
+ASGNI4
+LABELV $423
+LABELV $419
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_ivo
+INDIRI4
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+EQI4 $431
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $431
+ADDRGP4 s_ivo+4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1540+64
+INDIRI4
+EQI4 $437
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $437
+ADDRGP4 s_ivo+48
+INDIRI4
+ADDRGP4 s_graphicsoptions+1924+64
+INDIRI4
+EQI4 $444
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $444
+ADDRGP4 s_ivo+8
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+EQF4 $451
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $451
+ADDRGP4 s_ivo+12
+INDIRI4
+ADDRGP4 s_graphicsoptions+1636+64
+INDIRI4
+EQI4 $458
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $458
+ADDRGP4 s_ivo+16
+INDIRI4
+ADDRGP4 s_graphicsoptions+1732+64
+INDIRI4
+EQI4 $465
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $465
+ADDRGP4 s_ivo+20
+INDIRI4
+ADDRGP4 s_graphicsoptions+1828+64
+INDIRI4
+EQI4 $472
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $472
+ADDRGP4 s_ivo+24
+INDIRI4
+ADDRGP4 s_graphicsoptions+2404+64
+INDIRI4
+EQI4 $479
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $479
+ADDRGP4 s_ivo+44
+INDIRI4
+ADDRGP4 s_graphicsoptions+1368+64
+INDIRI4
+EQI4 $486
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $486
+ADDRGP4 s_ivo+28
+INDIRI4
+ADDRGP4 s_graphicsoptions+2020+64
+INDIRI4
+EQI4 $493
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $493
+ADDRGP4 s_ivo+32
+INDIRI4
+ADDRGP4 s_graphicsoptions+2116+64
+INDIRI4
+EQI4 $500
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $500
+ADDRGP4 s_ivo+36
+INDIRI4
+ADDRGP4 s_graphicsoptions+2212+64
+INDIRI4
+EQI4 $507
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $507
+ADDRGP4 s_ivo+40
+INDIRI4
+ADDRGP4 s_graphicsoptions+2308+64
+INDIRI4
+EQI4 $514
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2572+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $514
+ADDRGP4 GraphicsOptions_CheckConfig
+CALLV
+pop
+LABELV $408
+endproc GraphicsOptions_UpdateMenuItems 8 0
+proc GraphicsOptions_ApplyChanges 52 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $522
+ADDRGP4 $521
+JUMPV
+LABELV $522
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+2020+64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $530
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $531
+ADDRGP4 $524
+JUMPV
+LABELV $528
+ADDRGP4 $529
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $530
+ADDRGP4 $529
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $531
+ADDRGP4 $529
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $524
+LABELV $525
+ADDRGP4 $532
+ARGP4
+CNSTF4 1077936128
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $535
+ARGP4
+ADDRGP4 s_graphicsoptions+1924+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 -1
+EQI4 $546
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $540
+LABELV $546
+ADDRGP4 s_graphicsoptions+1272+64
+CNSTI4 0
+ASGNI4
+LABELV $540
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 GraphicsOptions_FindBuiltinResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $551
+ADDRLP4 12
+ARGP4
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 44
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 48
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $557
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $558
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $551
+ADDRGP4 $559
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRGP4 $559
+ARGP4
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $539
+ADDRGP4 $562
+ARGP4
+ADDRGP4 s_graphicsoptions+1540+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $565
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $566
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $567
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $568
+ARGP4
+ADDRGP4 s_graphicsoptions+1636+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $571
+ARGP4
+ADDRGP4 s_graphicsoptions+1732+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $574
+ARGP4
+ADDRGP4 s_graphicsoptions+1828+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $577
+ARGP4
+ADDRGP4 s_graphicsoptions+2404+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+2308+64
+INDIRI4
+CNSTI4 0
+EQI4 $580
+ADDRGP4 $584
+ARGP4
+ADDRGP4 s_graphicsoptions+2308+64
+INDIRI4
+CNSTI4 1
+LSHI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $587
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRGP4 $587
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $581
+ADDRGP4 s_graphicsoptions+2116+64
+INDIRI4
+CNSTI4 2
+NEI4 $588
+ADDRGP4 $592
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $593
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRGP4 s_graphicsoptions+2116+64
+INDIRI4
+CNSTI4 1
+NEI4 $594
+ADDRGP4 $592
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $593
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRGP4 $592
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $593
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $595
+LABELV $589
+ADDRGP4 s_graphicsoptions+2212+64
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRGP4 $602
+ARGP4
+ADDRGP4 $603
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $599
+JUMPV
+LABELV $598
+ADDRGP4 $602
+ARGP4
+ADDRGP4 $604
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $599
+CNSTI4 2
+ARGI4
+ADDRGP4 $605
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $521
+endproc GraphicsOptions_ApplyChanges 52 12
+proc GraphicsOptions_Event 16 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $607
+ADDRGP4 $606
+JUMPV
+LABELV $607
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 101
+LTI4 $609
+ADDRLP4 4
+INDIRI4
+CNSTI4 110
+GTI4 $609
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $673-404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $673
+address $668
+address $609
+address $638
+address $617
+address $667
+address $610
+address $670
+address $671
+address $672
+address $612
+code
+LABELV $612
+ADDRGP4 s_graphicsoptions+1272+64
+ADDRGP4 s_graphicsoptions+1176+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $617
+ADDRGP4 s_graphicsoptions+1368+64
+INDIRI4
+CNSTI4 1
+NEI4 $618
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 2
+GEI4 $622
+ADDRGP4 s_graphicsoptions+1272+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 6
+LEI4 $628
+ADDRGP4 s_graphicsoptions+1272+64
+CNSTI4 6
+ASGNI4
+LABELV $628
+LABELV $623
+LABELV $618
+ADDRGP4 s_graphicsoptions+1176+64
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $638
+ADDRLP4 0
+CNSTI4 52
+ADDRGP4 s_graphicsoptions+1080+64
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1176+64
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1464+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1636+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2116+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2212+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2308+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1540+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1732+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1828+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2404+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $667
+ADDRGP4 UI_DriverInfo_Menu
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $668
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $670
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $671
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $672
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+LABELV $609
+LABELV $610
+LABELV $606
+endproc GraphicsOptions_Event 16 4
+proc GraphicsOptions_TQEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $676
+ADDRGP4 $675
+JUMPV
+LABELV $676
+ADDRGP4 s_graphicsoptions+1464+68
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $675
+endproc GraphicsOptions_TQEvent 0 0
+export GraphicsOptions_MenuDraw
+proc GraphicsOptions_MenuDraw 0 4
+ADDRGP4 GraphicsOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $682
+endproc GraphicsOptions_MenuDraw 0 4
+proc GraphicsOptions_SetMenuItems 1056 12
+ADDRGP4 $559
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 0
+GEI4 $686
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $690
+ADDRGP4 $557
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1022
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 12+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 120
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 12
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1048
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $696
+JUMPV
+LABELV $693
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $697
+ADDRGP4 s_graphicsoptions+1272+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $695
+JUMPV
+LABELV $697
+LABELV $694
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $696
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $693
+LABELV $695
+ADDRGP4 s_graphicsoptions+1272+64
+INDIRI4
+CNSTI4 0
+GEI4 $691
+ADDRGP4 s_graphicsoptions+1272+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $691
+JUMPV
+LABELV $690
+ADDRGP4 s_graphicsoptions+1272+64
+CNSTI4 3
+ASGNI4
+LABELV $691
+LABELV $686
+ADDRGP4 $562
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1540+64
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1924+64
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1732+64
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $574
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1828+64
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $577
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+2404+64
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $587
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+EQF4 $719
+ADDRGP4 $584
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+2308+64
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $719
+ADDRGP4 $532
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1464+68
+CNSTF4 1077936128
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+CNSTF4 0
+GEF4 $725
+ADDRGP4 s_graphicsoptions+1464+68
+CNSTF4 0
+ASGNF4
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRGP4 s_graphicsoptions+1464+68
+INDIRF4
+CNSTF4 1077936128
+LEF4 $731
+ADDRGP4 s_graphicsoptions+1464+68
+CNSTF4 1077936128
+ASGNF4
+LABELV $731
+LABELV $726
+ADDRGP4 $529
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 48
+CNSTI4 16
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $743
+ADDRLP4 36
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $750
+LABELV $749
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRGP4 $737
+JUMPV
+LABELV $750
+ADDRLP4 36
+INDIRI4
+CNSTI4 32
+EQI4 $746
+ADDRGP4 $737
+JUMPV
+LABELV $737
+LABELV $740
+ADDRGP4 s_graphicsoptions+2020+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $743
+ADDRGP4 s_graphicsoptions+2020+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $746
+ADDRGP4 s_graphicsoptions+2020+64
+CNSTI4 2
+ASGNI4
+LABELV $738
+ADDRGP4 $602
+ARGP4
+ADDRLP4 52
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $604
+ARGP4
+ADDRLP4 56
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRGP4 s_graphicsoptions+2212+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRGP4 s_graphicsoptions+2212+64
+CNSTI4 1
+ASGNI4
+LABELV $752
+ADDRGP4 $592
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+LEF4 $757
+ADDRGP4 $593
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1101004800
+LTF4 $759
+ADDRGP4 s_graphicsoptions+2116+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $758
+JUMPV
+LABELV $759
+ADDRGP4 s_graphicsoptions+2116+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $758
+JUMPV
+LABELV $757
+ADDRGP4 s_graphicsoptions+2116+64
+CNSTI4 2
+ASGNI4
+LABELV $758
+LABELV $683
+endproc GraphicsOptions_SetMenuItems 1056 12
+data
+align 4
+LABELV $768
+address $769
+address $770
+byte 4 0
+align 4
+LABELV $771
+address $769
+address $772
+address $773
+byte 4 0
+align 4
+LABELV $774
+address $775
+address $776
+address $777
+address $778
+address $779
+address $780
+byte 4 0
+align 4
+LABELV $781
+address $782
+address $783
+byte 4 0
+align 4
+LABELV $784
+address $785
+address $786
+byte 4 0
+align 4
+LABELV $787
+address $788
+address $789
+address $790
+address $791
+address $792
+byte 4 0
+align 4
+LABELV $793
+address $794
+address $795
+address $796
+byte 4 0
+align 4
+LABELV $797
+address $788
+address $798
+byte 4 0
+export GraphicsOptions_MenuInit
+code
+proc GraphicsOptions_MenuInit 4 12
+ADDRGP4 s_graphicsoptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2748
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 GraphicsOptions_GetResolutions
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetAspectRatios
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+536
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+524
+ADDRGP4 GraphicsOptions_MenuDraw
+ASGNP4
+ADDRGP4 s_graphicsoptions+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_graphicsoptions+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_graphicsoptions+544+60
+ADDRGP4 $809
+ASGNP4
+ADDRGP4 s_graphicsoptions+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_graphicsoptions+544+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+616+4
+ADDRGP4 $80
+ASGNP4
+ADDRGP4 s_graphicsoptions+616+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+616+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+616+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_graphicsoptions+616+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+616+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_graphicsoptions+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+704+4
+ADDRGP4 $81
+ASGNP4
+ADDRGP4 s_graphicsoptions+704+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+704+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_graphicsoptions+704+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_graphicsoptions+704+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+704+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_graphicsoptions+792
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+792+44
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_graphicsoptions+792+8
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_graphicsoptions+792+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+792+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+792+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_graphicsoptions+792+60
+ADDRGP4 $853
+ASGNP4
+ADDRGP4 s_graphicsoptions+792+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+792+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+864
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+864+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+864+8
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_graphicsoptions+864+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+864+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+864+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_graphicsoptions+864+60
+ADDRGP4 $871
+ASGNP4
+ADDRGP4 s_graphicsoptions+864+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+864+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+936
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+936+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+936+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_graphicsoptions+936+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+936+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+936+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_graphicsoptions+936+60
+ADDRGP4 $889
+ASGNP4
+ADDRGP4 s_graphicsoptions+936+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+936+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+1008
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+1008+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+1008+8
+CNSTI4 109
+ASGNI4
+ADDRGP4 s_graphicsoptions+1008+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1008+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+1008+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_graphicsoptions+1008+60
+ADDRGP4 $907
+ASGNP4
+ADDRGP4 s_graphicsoptions+1008+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+1008+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+CNSTI4 114
+ASGNI4
+ADDRGP4 s_graphicsoptions+1080
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1080+4
+ADDRGP4 $915
+ASGNP4
+ADDRGP4 s_graphicsoptions+1080+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1080+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1080+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1080+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1080+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_graphicsoptions+1080+76
+ADDRGP4 $774
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1368
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1368+4
+ADDRGP4 $931
+ASGNP4
+ADDRGP4 s_graphicsoptions+1368+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1368+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1368+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1368+76
+ADDRGP4 $768
+ASGNP4
+ADDRGP4 s_graphicsoptions+1368+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1924
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1924+4
+ADDRGP4 $945
+ASGNP4
+ADDRGP4 s_graphicsoptions+1924+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1924+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1924+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1924+76
+ADDRGP4 $797
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1176
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1176+4
+ADDRGP4 $957
+ASGNP4
+ADDRGP4 s_graphicsoptions+1176+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1176+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1176+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1176+76
+ADDRGP4 ratios
+ASGNP4
+ADDRGP4 s_graphicsoptions+1176+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1176+8
+CNSTI4 110
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272+4
+ADDRGP4 $973
+ASGNP4
+ADDRGP4 s_graphicsoptions+1272+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1272+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1272+76
+ADDRGP4 resolutions
+INDIRP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+1272+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1272+8
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1540
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1540+4
+ADDRGP4 $989
+ASGNP4
+ADDRGP4 s_graphicsoptions+1540+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1540+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1540+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1540+76
+ADDRGP4 $797
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1636
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1636+4
+ADDRGP4 $1001
+ASGNP4
+ADDRGP4 s_graphicsoptions+1636+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1636+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1636+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1636+76
+ADDRGP4 $781
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1732
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1732+4
+ADDRGP4 $1013
+ASGNP4
+ADDRGP4 s_graphicsoptions+1732+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1732+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1732+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1732+76
+ADDRGP4 $797
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1828
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1828+4
+ADDRGP4 $1025
+ASGNP4
+ADDRGP4 s_graphicsoptions+1828+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1828+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1828+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1828+76
+ADDRGP4 $797
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2404
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+2404+4
+ADDRGP4 $1037
+ASGNP4
+ADDRGP4 s_graphicsoptions+2404+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+2404+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+2404+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2404+76
+ADDRGP4 $797
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2116
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+2116+4
+ADDRGP4 $1049
+ASGNP4
+ADDRGP4 s_graphicsoptions+2116+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+2116+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+2116+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2116+76
+ADDRGP4 $793
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1464
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+1464+4
+ADDRGP4 $1061
+ASGNP4
+ADDRGP4 s_graphicsoptions+1464+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1464+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1464+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1464+60
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_graphicsoptions+1464+64
+CNSTF4 1077936128
+ASGNF4
+ADDRGP4 s_graphicsoptions+1464+48
+ADDRGP4 GraphicsOptions_TQEvent
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+4
+ADDRGP4 $1077
+ASGNP4
+ADDRGP4 s_graphicsoptions+2020+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+2020+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+76
+ADDRGP4 $771
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2212
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+2212+4
+ADDRGP4 $1089
+ASGNP4
+ADDRGP4 s_graphicsoptions+2212+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+2212+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+2212+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2212+76
+ADDRGP4 $784
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2308
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+2308+4
+ADDRGP4 $1101
+ASGNP4
+ADDRGP4 s_graphicsoptions+2308+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+2308+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+2308+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2308+76
+ADDRGP4 $787
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2500
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+2500+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_graphicsoptions+2500+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2500+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_graphicsoptions+2500+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+2500+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2500+60
+ADDRGP4 $1123
+ASGNP4
+ADDRGP4 s_graphicsoptions+2500+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_graphicsoptions+2500+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660+4
+ADDRGP4 $82
+ASGNP4
+ADDRGP4 s_graphicsoptions+2660+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_graphicsoptions+2660+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2660+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+2660+60
+ADDRGP4 $83
+ASGNP4
+ADDRGP4 s_graphicsoptions+2572
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2572+4
+ADDRGP4 $1150
+ASGNP4
+ADDRGP4 s_graphicsoptions+2572+44
+CNSTU4 20752
+ASGNU4
+ADDRGP4 s_graphicsoptions+2572+48
+ADDRGP4 GraphicsOptions_ApplyChanges
+ASGNP4
+ADDRGP4 s_graphicsoptions+2572+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_graphicsoptions+2572+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+2572+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+2572+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+2572+60
+ADDRGP4 $1165
+ASGNP4
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+864
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+936
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1008
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1080
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1924
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1176
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1272
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1540
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1636
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1732
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1828
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2404
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2116
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1464
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2020
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2212
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2308
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2500
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2660
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2572
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 GraphicsOptions_SetMenuItems
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetInitialVideo
+CALLV
+pop
+LABELV $767
+endproc GraphicsOptions_MenuInit 4 12
+export GraphicsOptions_Cache
+proc GraphicsOptions_Cache 0 4
+ADDRGP4 $80
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $81
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $82
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $83
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1150
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1165
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1191
+endproc GraphicsOptions_Cache 0 4
+export UI_GraphicsOptionsMenu
+proc UI_GraphicsOptionsMenu 0 8
+ADDRGP4 GraphicsOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+792
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $1192
+endproc UI_GraphicsOptionsMenu 0 8
+bss
+align 4
+LABELV detectedResolutions
+skip 128
+align 1
+LABELV resbuf
+skip 1024
+align 4
+LABELV resToRatio
+skip 128
+align 4
+LABELV ratioToRes
+skip 128
+align 1
+LABELV ratioBuf
+skip 256
+align 4
+LABELV ratios
+skip 128
+align 4
+LABELV s_graphicsoptions
+skip 2748
+align 4
+LABELV s_ivo
+skip 52
+align 4
+LABELV s_driverinfo
+skip 2164
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteGametypeMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1165
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1150
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1123
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $1101
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $1089
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1077
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $1061
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1049
+byte 1 71
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1037
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 58
+byte 1 0
+align 1
+LABELV $1025
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 58
+byte 1 0
+align 1
+LABELV $1013
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $1001
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $989
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $973
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $957
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 58
+byte 1 0
+align 1
+LABELV $945
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $931
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $915
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $907
+byte 1 78
+byte 1 69
+byte 1 84
+byte 1 87
+byte 1 79
+byte 1 82
+byte 1 75
+byte 1 0
+align 1
+LABELV $889
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $871
+byte 1 68
+byte 1 73
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 0
+align 1
+LABELV $853
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 72
+byte 1 73
+byte 1 67
+byte 1 83
+byte 1 0
+align 1
+LABELV $809
+byte 1 83
+byte 1 89
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $798
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $796
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $795
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $794
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $792
+byte 1 56
+byte 1 120
+byte 1 0
+align 1
+LABELV $791
+byte 1 54
+byte 1 120
+byte 1 0
+align 1
+LABELV $790
+byte 1 52
+byte 1 120
+byte 1 0
+align 1
+LABELV $789
+byte 1 50
+byte 1 120
+byte 1 0
+align 1
+LABELV $788
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $786
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $785
+byte 1 66
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $783
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 40
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 41
+byte 1 0
+align 1
+LABELV $782
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 40
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 41
+byte 1 0
+align 1
+LABELV $780
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $779
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $778
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $777
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $776
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $775
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $773
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $772
+byte 1 49
+byte 1 54
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $770
+byte 1 86
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 0
+align 1
+LABELV $769
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $605
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $604
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $603
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $602
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $593
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $592
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $587
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $584
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 0
+align 1
+LABELV $577
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $574
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $571
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $568
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $567
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $566
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $565
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $562
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $559
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $558
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $557
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $535
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $532
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $529
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $334
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $278
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $250
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $249
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $248
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $247
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $246
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $245
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $244
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $243
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $242
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $241
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $240
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $239
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $238
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $237
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $236
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $235
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $234
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $233
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $232
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $231
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $230
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $229
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $228
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $227
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $226
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $225
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $139
+byte 1 68
+byte 1 82
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $95
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $94
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $93
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $83
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $82
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $81
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
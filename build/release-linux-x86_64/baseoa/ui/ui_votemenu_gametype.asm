@@ -0,0 +1,2582 @@
+data
+align 4
+LABELV votemenu_Gametype_artlist
+address $80
+address $81
+address $82
+address $83
+byte 4 0
+code
+proc VoteMenu_Gametype_Event 8 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $86
+ADDRGP4 $85
+JUMPV
+LABELV $86
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 114
+GTI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $120-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $120
+address $91
+address $88
+address $94
+address $96
+address $98
+address $100
+address $102
+address $104
+address $106
+address $108
+address $110
+address $112
+address $114
+address $116
+address $118
+code
+LABELV $91
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $92
+ADDRGP4 $89
+JUMPV
+LABELV $92
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $94
+CNSTI4 2
+ARGI4
+ADDRGP4 $95
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $96
+CNSTI4 2
+ARGI4
+ADDRGP4 $97
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $98
+CNSTI4 2
+ARGI4
+ADDRGP4 $99
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $100
+CNSTI4 2
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $102
+CNSTI4 2
+ARGI4
+ADDRGP4 $103
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $104
+CNSTI4 2
+ARGI4
+ADDRGP4 $105
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $106
+CNSTI4 2
+ARGI4
+ADDRGP4 $107
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $108
+CNSTI4 2
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $110
+CNSTI4 2
+ARGI4
+ADDRGP4 $111
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $112
+CNSTI4 2
+ARGI4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $114
+CNSTI4 2
+ARGI4
+ADDRGP4 $115
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $116
+CNSTI4 2
+ARGI4
+ADDRGP4 $117
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $89
+JUMPV
+LABELV $118
+CNSTI4 2
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $88
+LABELV $89
+LABELV $85
+endproc VoteMenu_Gametype_Event 8 8
+proc setGametypeMenutext 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTU4 264
+ASGNU4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $123
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 24576
+BORU4
+ASGNU4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRGP4 s_votemenu_Gametype+1780
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $125
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 320
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 VoteMenu_Gametype_Event
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 17
+ASGNI4
+LABELV $122
+endproc setGametypeMenutext 4 0
+proc VoteMenu_Gametype_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 votemenu_Gametype_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $133
+ADDRGP4 $131
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 votemenu_Gametype_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $131
+LABELV $128
+endproc VoteMenu_Gametype_Cache 4 4
+proc UI_VoteMenu_Gametype_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 $136
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 color_white
+ARGP4
+ADDRGP4 UI_DrawBannerString
+CALLV
+pop
+CNSTF4 1118699520
+ARGF4
+CNSTF4 1116995584
+ARGF4
+CNSTF4 1139343360
+ARGF4
+CNSTF4 1134952448
+ARGF4
+ADDRGP4 $137
+ARGP4
+ADDRGP4 UI_DrawNamedPic
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $135
+endproc UI_VoteMenu_Gametype_Draw 0 20
+export UI_VoteGametypeMenuInternal
+proc UI_VoteGametypeMenuInternal 4 20
+ADDRGP4 VoteMenu_Gametype_Cache
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype+532
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+536
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+524
+ADDRGP4 UI_VoteMenu_Gametype_Draw
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+544
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+544+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+544+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+544+60
+ADDRGP4 $136
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+544+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+544+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 98
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+792
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 102
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1728
+INDIRI4
+ARGI4
+ADDRGP4 $155
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+864
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 103
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1732
+INDIRI4
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+936
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 104
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1736
+INDIRI4
+ARGI4
+ADDRGP4 $161
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1008
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 105
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1740
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1080
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 106
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1744
+INDIRI4
+ARGI4
+ADDRGP4 $167
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1152
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 107
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1748
+INDIRI4
+ARGI4
+ADDRGP4 $170
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1224
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 108
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1752
+INDIRI4
+ARGI4
+ADDRGP4 $173
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1296
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 109
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1756
+INDIRI4
+ARGI4
+ADDRGP4 $176
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1368
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 110
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1760
+INDIRI4
+ARGI4
+ADDRGP4 $179
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1440
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 111
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1764
+INDIRI4
+ARGI4
+ADDRGP4 $182
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1512
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1768
+INDIRI4
+ARGI4
+ADDRGP4 $185
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1584
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 113
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1772
+INDIRI4
+ARGI4
+ADDRGP4 $188
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1656
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 114
+ARGI4
+ADDRGP4 s_votemenu_Gametype+1776
+INDIRI4
+ARGI4
+ADDRGP4 $191
+ARGP4
+ADDRGP4 setGametypeMenutext
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+ADDI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616+4
+ADDRGP4 $80
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+616+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_votemenu_Gametype+616+48
+ADDRGP4 VoteMenu_Gametype_Event
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+616+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616+12
+CNSTI4 192
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+616+60
+ADDRGP4 $81
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+704+4
+ADDRGP4 $82
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+704+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_votemenu_Gametype+704+48
+ADDRGP4 VoteMenu_Gametype_Event
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+704+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+704+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+704+16
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+704+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+704+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+704+60
+ADDRGP4 $83
+ASGNP4
+LABELV $138
+endproc UI_VoteGametypeMenuInternal 4 20
+export UI_VoteGametypeMenu
+proc UI_VoteGametypeMenu 1088 12
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1784
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $232
+ADDRGP4 s_votemenu_Gametype+1728
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1732
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1736
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1740
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1744
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1748
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1752
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1756
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1760
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1764
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1768
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1772
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_votemenu_Gametype+1776
+CNSTI4 1
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1728
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1732
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1736
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1740
+ADDRLP4 1048
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1744
+ADDRLP4 1052
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1748
+ADDRLP4 1056
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1752
+ADDRLP4 1060
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1756
+ADDRLP4 1064
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1760
+ADDRLP4 1068
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1764
+ADDRLP4 1072
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1768
+ADDRLP4 1076
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1772
+ADDRLP4 1080
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stristr
+CALLP4
+ASGNP4
+ADDRGP4 s_votemenu_Gametype+1776
+ADDRLP4 1084
+INDIRP4
+CVPU4 4
+CVUI4 4
+ASGNI4
+LABELV $233
+ADDRGP4 UI_VoteGametypeMenuInternal
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+864
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+936
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1008
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1080
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1152
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1224
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1440
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 s_votemenu_Gametype+1656
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_votemenu_Gametype
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $230
+endproc UI_VoteGametypeMenu 1088 12
+bss
+align 4
+LABELV s_votemenu_Gametype
+skip 1784
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_VoteCustomMenu
+import UI_FirstConnectMenu
+import FirstConnect_Cache
+import UI_SpecifyPasswordMenu
+import SpecifyPassword_Cache
+import UI_VoteMapMenuInternal
+import UI_VoteMapMenu
+import UI_VoteKickMenu
+import UI_VoteTimelimitMenu
+import UI_VoteFraglimitMenu
+import UI_VoteMenuMenu
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import WriteMapList
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import UI_Challenges
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_SetDefaultCvar
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import GetMapInfoUI
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import mappage
+import ui_browserOnlyHumans
+import ui_setupchecked
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_dom_friendly
+import ui_dom_timelimit
+import ui_dom_capturelimit
+import ui_dd_friendly
+import ui_dd_timelimit
+import ui_dd_capturelimit
+import ui_lms_timelimit
+import ui_lms_fraglimit
+import ui_ctf_elimination_timelimit
+import ui_ctf_elimination_capturelimit
+import ui_elimination_timelimit
+import ui_elimination_capturelimit
+import ui_harvester_friendly
+import ui_harvester_timelimit
+import ui_harvester_capturelimit
+import ui_overload_friendly
+import ui_overload_timelimit
+import ui_overload_capturelimit
+import ui_1fctf_friendly
+import ui_1fctf_timelimit
+import ui_1fctf_capturelimit
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $273
+byte 1 47
+byte 1 49
+byte 1 51
+byte 1 47
+byte 1 0
+align 1
+LABELV $271
+byte 1 47
+byte 1 49
+byte 1 50
+byte 1 47
+byte 1 0
+align 1
+LABELV $269
+byte 1 47
+byte 1 49
+byte 1 49
+byte 1 47
+byte 1 0
+align 1
+LABELV $267
+byte 1 47
+byte 1 49
+byte 1 48
+byte 1 47
+byte 1 0
+align 1
+LABELV $265
+byte 1 47
+byte 1 57
+byte 1 47
+byte 1 0
+align 1
+LABELV $263
+byte 1 47
+byte 1 56
+byte 1 47
+byte 1 0
+align 1
+LABELV $261
+byte 1 47
+byte 1 55
+byte 1 47
+byte 1 0
+align 1
+LABELV $259
+byte 1 47
+byte 1 54
+byte 1 47
+byte 1 0
+align 1
+LABELV $257
+byte 1 47
+byte 1 53
+byte 1 47
+byte 1 0
+align 1
+LABELV $255
+byte 1 47
+byte 1 52
+byte 1 47
+byte 1 0
+align 1
+LABELV $253
+byte 1 47
+byte 1 51
+byte 1 47
+byte 1 0
+align 1
+LABELV $251
+byte 1 47
+byte 1 49
+byte 1 47
+byte 1 0
+align 1
+LABELV $249
+byte 1 47
+byte 1 48
+byte 1 47
+byte 1 0
+align 1
+LABELV $234
+byte 1 42
+byte 1 0
+align 1
+LABELV $231
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $191
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $188
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $185
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $182
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $179
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $176
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $173
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $170
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $167
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $164
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $161
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $158
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $155
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $137
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $136
+byte 1 67
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 89
+byte 1 80
+byte 1 69
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $117
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $113
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $109
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $103
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $101
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $99
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $97
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $95
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $83
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $82
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $81
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $80
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
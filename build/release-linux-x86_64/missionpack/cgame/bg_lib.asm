@@ -0,0 +1,8341 @@
+code
+proc swapfunc 24 0
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GTI4 $24
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $26
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $27
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $26
+ADDRGP4 $25
+JUMPV
+LABELV $24
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $29
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $30
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $29
+LABELV $25
+LABELV $23
+endproc swapfunc 24 0
+proc med3 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $38
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $40
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $41
+JUMPV
+LABELV $40
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $42
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $43
+JUMPV
+LABELV $42
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $43
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $41
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $39
+JUMPV
+LABELV $38
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $44
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $45
+JUMPV
+LABELV $44
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $46
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $47
+JUMPV
+LABELV $46
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $47
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $45
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $39
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $32
+endproc med3 40 8
+export qsort
+proc qsort 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $49
+ADDRLP4 52
+CNSTU4 3
+ASGNU4
+ADDRLP4 56
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CVUI4 4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+NEU4 $54
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+EQU4 $52
+LABELV $54
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRGP4 $53
+JUMPV
+LABELV $52
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTU4 4
+NEU4 $55
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 $56
+JUMPV
+LABELV $55
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+LABELV $56
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $53
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+GEI4 $57
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $62
+JUMPV
+LABELV $59
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $66
+JUMPV
+LABELV $63
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $67
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $68
+JUMPV
+LABELV $67
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $68
+LABELV $64
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $66
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $69
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+GTI4 $63
+LABELV $69
+LABELV $60
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $62
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $59
+ADDRGP4 $48
+JUMPV
+LABELV $57
+ADDRLP4 32
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+LEI4 $70
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 40
+LEI4 $72
+ADDRLP4 40
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+DIVI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 88
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $72
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $70
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $74
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $75
+ADDRLP4 72
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $83
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $86
+ADDRLP4 20
+ADDRFP4 8
+INDIRI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $83
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $81
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $87
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LEI4 $80
+LABELV $87
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $94
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $91
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $89
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $95
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $88
+LABELV $95
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+LEU4 $96
+ADDRGP4 $78
+JUMPV
+LABELV $96
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $98
+ADDRLP4 96
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $99
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $78
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $106
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $111
+LABELV $107
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $109
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $112
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GTI4 $106
+LABELV $112
+LABELV $103
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $105
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $102
+ADDRGP4 $48
+JUMPV
+LABELV $100
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 88
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+SUBU4
+CVUI4 4
+GEI4 $114
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+LABELV $115
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $116
+ADDRLP4 100
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 100
+INDIRU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+SUBU4
+CVUI4 4
+ADDRFP4 8
+INDIRI4
+SUBI4
+GEI4 $119
+ADDRLP4 96
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 96
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRFP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $120
+ADDRLP4 12
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $121
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $121
+ADDRLP4 108
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $123
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $123
+ADDRLP4 116
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $125
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $49
+JUMPV
+LABELV $125
+LABELV $48
+endproc qsort 124 16
+export strlen
+proc strlen 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $129
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $128
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $127
+endproc strlen 4 0
+export strcat
+proc strcat 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $133
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $132
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $136
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $135
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $131
+endproc strcat 16 0
+export strcpy
+proc strcpy 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $140
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $139
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $138
+endproc strcpy 16 0
+export strcmp
+proc strcmp 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $144
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $147
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $147
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $143
+LABELV $147
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+SUBI4
+RETI4
+LABELV $142
+endproc strcmp 12 0
+export strchr
+proc strchr 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $152
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $148
+JUMPV
+LABELV $152
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $150
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $149
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $154
+CNSTP4 0
+RETP4
+ADDRGP4 $148
+JUMPV
+LABELV $154
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $148
+endproc strchr 0 0
+export strrchr
+proc strrchr 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $160
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $160
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $158
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $157
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $162
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $156
+JUMPV
+LABELV $162
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $156
+endproc strrchr 4 0
+export strstr
+proc strstr 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $168
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $172
+ADDRGP4 $170
+JUMPV
+LABELV $172
+LABELV $169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $171
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $168
+LABELV $170
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $174
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $164
+JUMPV
+LABELV $174
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $166
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $165
+CNSTP4 0
+RETP4
+LABELV $164
+endproc strstr 8 0
+export tolower
+proc tolower 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $177
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $177
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $177
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $176
+endproc tolower 4 0
+export toupper
+proc toupper 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $180
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $180
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32
+ADDI4
+ASGNI4
+LABELV $180
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $179
+endproc toupper 4 0
+export memmove
+proc memmove 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+LEU4 $183
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $186
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $185
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $190
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $189
+LABELV $184
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $182
+endproc memmove 8 0
+proc powN 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $194
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 1
+NEI4 $199
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $199
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $197
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $196
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRFP4 4
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $201
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+DIVF4
+RETF4
+ADDRGP4 $193
+JUMPV
+LABELV $201
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+NEGI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 powN
+CALLF4
+ASGNF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $193
+endproc powN 8 8
+export tan
+proc tan 8 4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $203
+endproc tan 8 4
+data
+align 4
+LABELV randSeed
+byte 4 0
+export srand
+code
+proc srand 0 0
+ADDRGP4 randSeed
+ADDRFP4 0
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $204
+endproc srand 0 0
+export rand
+proc rand 4 0
+ADDRLP4 0
+ADDRGP4 randSeed
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 69069
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32767
+BANDI4
+RETI4
+LABELV $205
+endproc rand 4 0
+export atof
+proc atof 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $210
+CNSTF4 0
+RETF4
+ADDRGP4 $206
+JUMPV
+LABELV $210
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $207
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $215
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $216
+ADDRGP4 $212
+JUMPV
+LABELV $215
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $213
+JUMPV
+LABELV $216
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $213
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+EQI4 $217
+LABELV $219
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $224
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $222
+LABELV $224
+ADDRGP4 $218
+JUMPV
+LABELV $222
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $220
+ADDRGP4 $219
+JUMPV
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $218
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $225
+ADDRLP4 20
+CNSTF4 1036831949
+ASGNF4
+LABELV $227
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $230
+LABELV $232
+ADDRGP4 $229
+JUMPV
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $228
+ADDRGP4 $227
+JUMPV
+LABELV $229
+LABELV $225
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+RETF4
+LABELV $206
+endproc atof 36 0
+export _atof
+proc _atof 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTF4 0
+RETF4
+ADDRGP4 $233
+JUMPV
+LABELV $237
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $235
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $234
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $242
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $243
+ADDRGP4 $239
+JUMPV
+LABELV $242
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $243
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $240
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+EQI4 $244
+LABELV $246
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $251
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $249
+LABELV $251
+ADDRGP4 $248
+JUMPV
+LABELV $249
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1092616192
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $247
+ADDRGP4 $246
+JUMPV
+LABELV $248
+LABELV $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $252
+ADDRLP4 24
+CNSTF4 1036831949
+ASGNF4
+LABELV $254
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $259
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $257
+LABELV $259
+ADDRGP4 $256
+JUMPV
+LABELV $257
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1036831949
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $255
+ADDRGP4 $254
+JUMPV
+LABELV $256
+LABELV $252
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+RETF4
+LABELV $233
+endproc _atof 40 0
+export strtod
+proc strtod 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $262
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+EQI4 $261
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $261
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+EQI4 $261
+ADDRLP4 8
+INDIRI4
+CNSTI4 13
+EQI4 $261
+ADDRLP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $261
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $266
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $267
+ADDRLP4 16
+CNSTU4 2147483647
+ASGNU4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $267
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 40
+NEI4 $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 41
+NEI4 $271
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CNSTI4 8388607
+BANDI4
+CNSTI4 2139095040
+BORI4
+CVIU4 4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $273
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $273
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $271
+LABELV $269
+ADDRLP4 16
+CNSTU4 2147483647
+ASGNU4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $277
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 16
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 20
+CNSTU4 2139095040
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $278
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ASGNP4
+LABELV $281
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $275
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $283
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $285
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $285
+LABELV $284
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $289
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $287
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 48
+LTI4 $293
+ADDRLP4 32
+INDIRI4
+CNSTI4 57
+GTI4 $293
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $295
+ADDRLP4 40
+INDIRI4
+CNSTI4 70
+GTI4 $295
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1115815936
+SUBF4
+ASGNF4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 97
+LTI4 $292
+ADDRLP4 48
+INDIRI4
+CNSTI4 102
+GTI4 $292
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1098907648
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1092616192
+ADDF4
+ADDRLP4 52
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1120010240
+SUBF4
+ASGNF4
+LABELV $298
+LABELV $296
+LABELV $294
+LABELV $291
+ADDRGP4 $290
+JUMPV
+LABELV $292
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $299
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $299
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $301
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1031798784
+ASGNF4
+LABELV $303
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $307
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $307
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 65
+LTI4 $309
+ADDRLP4 44
+INDIRI4
+CNSTI4 70
+GTI4 $309
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 97
+LTI4 $305
+ADDRLP4 52
+INDIRI4
+CNSTI4 102
+GTI4 $305
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 56
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $312
+LABELV $310
+LABELV $308
+LABELV $304
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRGP4 $303
+JUMPV
+LABELV $305
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $313
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $313
+LABELV $301
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+EQU4 $315
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 112
+NEI4 $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $317
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $319
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $319
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $317
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $315
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $321
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $321
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $287
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 $326
+JUMPV
+LABELV $323
+LABELV $324
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1092616192
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+LABELV $326
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $327
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+LEI4 $323
+LABELV $327
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $328
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $328
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $330
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $335
+JUMPV
+LABELV $332
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $333
+ADDRLP4 40
+ADDRLP4 40
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ASGNF4
+LABELV $335
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 48
+LTI4 $336
+ADDRLP4 48
+INDIRI4
+CNSTI4 57
+LEI4 $332
+LABELV $336
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+GEU4 $337
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $337
+LABELV $330
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+EQU4 $339
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 40
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 101
+NEI4 $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 48
+ADDRGP4 strtol
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $341
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $343
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $343
+ADDRLP4 0
+INDIRF4
+RETF4
+ADDRGP4 $260
+JUMPV
+LABELV $341
+CNSTF4 1092616192
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $339
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $345
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $345
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $260
+endproc strtod 60 12
+export atoi
+proc atoi 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $351
+CNSTI4 0
+RETI4
+ADDRGP4 $347
+JUMPV
+LABELV $351
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $349
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $348
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $356
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $357
+ADDRGP4 $353
+JUMPV
+LABELV $356
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $357
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $354
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $358
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $363
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $361
+LABELV $363
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $359
+ADDRGP4 $358
+JUMPV
+LABELV $360
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+RETI4
+LABELV $347
+endproc atoi 28 0
+export _atoi
+proc _atoi 32 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $368
+CNSTI4 0
+RETI4
+ADDRGP4 $364
+JUMPV
+LABELV $368
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $366
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $365
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $373
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $374
+ADDRGP4 $370
+JUMPV
+LABELV $373
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $374
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $371
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $375
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $380
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $378
+LABELV $380
+ADDRGP4 $377
+JUMPV
+LABELV $378
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $376
+ADDRGP4 $375
+JUMPV
+LABELV $377
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+RETI4
+LABELV $364
+endproc _atoi 32 0
+export strtol
+proc strtol 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $382
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $382
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $387
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $387
+ADDRFP4 8
+INDIRI4
+CNSTI4 36
+LEI4 $389
+LABELV $387
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $388
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $389
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+EQI4 $388
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+EQI4 $388
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $388
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+EQI4 $388
+ADDRLP4 12
+INDIRI4
+CNSTI4 9
+EQI4 $388
+ADDRLP4 12
+INDIRI4
+CNSTI4 11
+EQI4 $388
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $391
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $393
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $393
+LABELV $392
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $395
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $397
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 120
+EQI4 $401
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+NEI4 $399
+LABELV $401
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRFP4 8
+INDIRI4
+CNSTI4 16
+EQI4 $402
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $404
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $404
+CNSTI4 0
+RETI4
+ADDRGP4 $381
+JUMPV
+LABELV $402
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+LABELV $406
+LABELV $400
+LABELV $395
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $408
+ADDRFP4 8
+CNSTI4 10
+ASGNI4
+LABELV $408
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $413
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $413
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $415
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+GTI4 $415
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 97
+SUBI4
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 65
+LTI4 $412
+ADDRLP4 28
+INDIRI4
+CNSTI4 90
+GTI4 $412
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+ADDI4
+CNSTI4 65
+SUBI4
+ASGNI4
+LABELV $418
+LABELV $416
+LABELV $414
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $419
+ADDRGP4 $412
+JUMPV
+LABELV $419
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 -2147483648
+ADDI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+GEI4 $421
+ADDRLP4 0
+CNSTI4 -2147483648
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $422
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $423
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $423
+LABELV $411
+ADDRGP4 $410
+JUMPV
+LABELV $412
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2147483648
+NEI4 $427
+ADDRLP4 0
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $428
+LABELV $425
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $381
+endproc strtol 32 0
+export abs
+proc abs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $431
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $432
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $429
+endproc abs 4 0
+export fabs
+proc fabs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $435
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+LABELV $436
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $433
+endproc fabs 4 0
+proc dopr 276 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $441
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $444
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $444
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $551
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $551
+address $445
+address $448
+address $458
+address $463
+address $466
+address $473
+address $484
+address $489
+address $444
+code
+LABELV $445
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $446
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $447
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 60
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $448
+ADDRLP4 64
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $454
+ADDRLP4 64
+INDIRI4
+CNSTI4 35
+EQI4 $455
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $449
+LABELV $457
+ADDRLP4 64
+INDIRI4
+CNSTI4 43
+EQI4 $453
+ADDRLP4 64
+INDIRI4
+CNSTI4 45
+EQI4 $452
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+EQI4 $456
+ADDRGP4 $449
+JUMPV
+LABELV $452
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $453
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $454
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $455
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 96
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $456
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $449
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $458
+ADDRLP4 80
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 80
+INDIRI4
+GTI4 $459
+ADDRLP4 80
+INDIRI4
+CNSTI4 57
+GTI4 $459
+ADDRLP4 16
+CNSTI4 10
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $459
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $461
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 88
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $461
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $463
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $464
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $464
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $466
+ADDRLP4 84
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 84
+INDIRI4
+GTI4 $467
+ADDRLP4 84
+INDIRI4
+CNSTI4 57
+GTI4 $467
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $469
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $469
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $444
+JUMPV
+LABELV $467
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $471
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $471
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $473
+ADDRLP4 88
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 96
+CNSTI4 104
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $477
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GTI4 $481
+LABELV $480
+ADDRLP4 88
+INDIRI4
+CNSTI4 76
+EQI4 $479
+ADDRGP4 $475
+JUMPV
+LABELV $481
+ADDRLP4 88
+INDIRI4
+CNSTI4 108
+EQI4 $478
+ADDRGP4 $475
+JUMPV
+LABELV $477
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $475
+JUMPV
+LABELV $478
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 108
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $475
+JUMPV
+LABELV $479
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $475
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $482
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $482
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $484
+ADDRLP4 100
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 108
+EQI4 $488
+ADDRGP4 $486
+JUMPV
+LABELV $488
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 104
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 104
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $486
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $489
+ADDRLP4 104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 69
+EQI4 $525
+ADDRLP4 112
+CNSTI4 71
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $529
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $546
+LABELV $545
+ADDRLP4 104
+INDIRI4
+CNSTI4 37
+EQI4 $543
+ADDRGP4 $491
+JUMPV
+LABELV $546
+ADDRLP4 120
+CNSTI4 88
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $514
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $491
+LABELV $547
+ADDRLP4 104
+INDIRI4
+CNSTI4 99
+LTI4 $491
+ADDRLP4 104
+INDIRI4
+CNSTI4 120
+GTI4 $491
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $548-396
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $548
+address $533
+address $493
+address $526
+address $522
+address $530
+address $491
+address $493
+address $491
+address $491
+address $491
+address $491
+address $536
+address $500
+address $535
+address $491
+address $491
+address $534
+address $491
+address $507
+address $491
+address $544
+address $515
+code
+LABELV $493
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $494
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 128
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII2 4
+CVII4 2
+ASGNI4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $496
+ADDRLP4 132
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 132
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $498
+ADDRLP4 136
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 140
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $499
+LABELV $497
+LABELV $495
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $500
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $501
+ADDRLP4 148
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 148
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $503
+ADDRLP4 152
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 152
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $505
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 156
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 160
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 160
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $506
+LABELV $504
+LABELV $502
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $507
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $508
+ADDRLP4 168
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $508
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $510
+ADDRLP4 172
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 172
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $512
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 176
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 180
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 180
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $513
+LABELV $511
+LABELV $509
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $514
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $515
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $516
+ADDRLP4 188
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 188
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $518
+ADDRLP4 192
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 192
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $520
+ADDRLP4 196
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 196
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRLP4 200
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 200
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $521
+LABELV $519
+LABELV $517
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $522
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $523
+ADDRLP4 208
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 208
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRLP4 212
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $524
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 216
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $525
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $526
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $527
+ADDRLP4 220
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 220
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 224
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 224
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $528
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $529
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $530
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $531
+ADDRLP4 232
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 232
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $532
+JUMPV
+LABELV $531
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 236
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 240
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 248
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 248
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $534
+ADDRLP4 252
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 252
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 fmtstr
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 256
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $535
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 260
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CVUI4 4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 264
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $536
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $537
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRGP4 $491
+JUMPV
+LABELV $537
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $539
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $539
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $541
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $541
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $543
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $544
+ADDRLP4 272
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 272
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $491
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+LABELV $444
+LABELV $439
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $438
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $552
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $554
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $555
+LABELV $552
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $437
+endproc dopr 276 32
+proc fmtstr 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $557
+ADDRFP4 12
+ADDRGP4 $559
+ASGNP4
+LABELV $557
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $563
+JUMPV
+LABELV $560
+LABELV $561
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $563
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $560
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $564
+ADDRFP4 24
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $564
+ADDRLP4 8
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $564
+ADDRLP4 0
+ADDRFP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $566
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $566
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 20
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $571
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $570
+ADDRGP4 $574
+JUMPV
+LABELV $573
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $574
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $576
+ADDRFP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $573
+ADDRLP4 12
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $573
+LABELV $576
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 28
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $578
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $577
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $556
+endproc fmtstr 32 16
+proc fmtint 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $581
+ADDRFP4 24
+CNSTI4 0
+ASGNI4
+LABELV $581
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRFP4 28
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $583
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $585
+ADDRLP4 48
+CNSTI4 45
+ASGNI4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+NEGI4
+CVIU4 4
+ASGNU4
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $587
+ADDRLP4 48
+CNSTI4 43
+ASGNI4
+ADDRGP4 $588
+JUMPV
+LABELV $587
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $589
+ADDRLP4 48
+CNSTI4 32
+ASGNI4
+LABELV $589
+LABELV $588
+LABELV $586
+LABELV $583
+ADDRFP4 28
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $591
+ADDRLP4 44
+ADDRGP4 $593
+ASGNP4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 44
+ADDRGP4 $594
+ASGNP4
+LABELV $592
+LABELV $595
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+MODU4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+DIVU4
+ASGNU4
+LABELV $596
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $598
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+LTU4 $595
+LABELV $598
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+NEU4 $599
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $599
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 40
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $603
+ADDRLP4 52
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $604
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $606
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $607
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $607
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $609
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $609
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $614
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $615
+ADDRLP4 40
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $611
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $619
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $619
+JUMPV
+LABELV $618
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $619
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $618
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $629
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRLP4 72
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $626
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GTI4 $625
+ADDRGP4 $629
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $629
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $628
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 80
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $632
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $631
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $580
+endproc fmtint 84 16
+proc abs_val 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $635
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $635
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $634
+endproc abs_val 4 0
+proc round 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+LTF4 $638
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $638
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $637
+endproc round 8 0
+proc fmtfp 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $641
+ADDRFP4 20
+CNSTI4 6
+ASGNI4
+LABELV $641
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 abs_val
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $643
+ADDRLP4 72
+CNSTI4 45
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $645
+ADDRLP4 72
+CNSTI4 43
+ASGNI4
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $647
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+LABELV $647
+LABELV $646
+LABELV $644
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 9
+LEI4 $649
+ADDRFP4 20
+CNSTI4 9
+ASGNI4
+LABELV $649
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 92
+INDIRF4
+LTF4 $651
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTF4 1092616192
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 powN
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $651
+LABELV $653
+ADDRLP4 100
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $657
+ADDRLP4 96
+ADDRGP4 $593
+ASGNP4
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRLP4 96
+ADDRGP4 $594
+ASGNP4
+LABELV $658
+ADDRLP4 100
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $654
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+LTI4 $653
+LABELV $659
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+NEI4 $660
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $660
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $662
+ADDRLP4 100
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $666
+ADDRLP4 96
+ADDRGP4 $593
+ASGNP4
+ADDRGP4 $667
+JUMPV
+LABELV $666
+ADDRLP4 96
+ADDRGP4 $594
+ASGNP4
+LABELV $667
+ADDRLP4 100
+INDIRI4
+ADDRLP4 48
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $663
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $668
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $662
+LABELV $668
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+NEI4 $669
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $669
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $672
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $673
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRFP4 20
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GEI4 $674
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $674
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $676
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $676
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $678
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $678
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $688
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LEI4 $688
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $685
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $684
+ADDRGP4 $688
+JUMPV
+LABELV $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $688
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $687
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $693
+JUMPV
+LABELV $692
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 112
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $693
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $692
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRLP4 120
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $698
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+GTI4 $697
+ADDRGP4 $701
+JUMPV
+LABELV $700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $701
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $700
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $704
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $703
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $640
+endproc fmtfp 136 16
+proc dopr_outch 8 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 8
+INDIRI4
+GEI4 $707
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRI1
+ASGNI1
+LABELV $707
+CNSTI4 1
+RETI4
+LABELV $706
+endproc dopr_outch 8 0
+export Q_vsnprintf
+proc Q_vsnprintf 4 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $710
+ADDRFP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $710
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 dopr
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $709
+endproc Q_vsnprintf 4 16
+export Q_snprintf
+proc Q_snprintf 12 16
+ADDRLP4 0
+ADDRFP4 8+4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $712
+endproc Q_snprintf 12 16
+export sscanf
+proc sscanf 88 4
+ADDRLP4 8
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+EQI4 $719
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $717
+JUMPV
+LABELV $719
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $721
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+GTI4 $721
+ADDRFP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 -1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRLP4 4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $722
+ADDRLP4 24
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $725
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $726
+ADDRLP4 0
+INDIRI4
+CNSTI4 105
+EQI4 $725
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $723
+LABELV $736
+ADDRLP4 0
+INDIRI4
+CNSTI4 115
+EQI4 $727
+ADDRLP4 0
+INDIRI4
+CNSTI4 117
+EQI4 $725
+ADDRGP4 $723
+JUMPV
+LABELV $725
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $724
+JUMPV
+LABELV $726
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 _atof
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $724
+JUMPV
+LABELV $727
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $729
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+EQI4 $728
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+EQI4 $728
+ADDRLP4 56
+INDIRI4
+CNSTI4 10
+EQI4 $728
+ADDRLP4 56
+INDIRI4
+CNSTI4 13
+EQI4 $728
+ADDRLP4 56
+INDIRI4
+CNSTI4 9
+EQI4 $728
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+EQI4 $728
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 60
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+ADDRLP4 60
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $732
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $735
+ADDRLP4 76
+INDIRI4
+CNSTI4 32
+EQI4 $735
+ADDRLP4 76
+INDIRI4
+CNSTI4 12
+EQI4 $735
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+EQI4 $735
+ADDRLP4 76
+INDIRI4
+CNSTI4 13
+EQI4 $735
+ADDRLP4 76
+INDIRI4
+CNSTI4 9
+EQI4 $735
+ADDRLP4 76
+INDIRI4
+CNSTI4 11
+EQI4 $735
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 80
+INDIRI4
+GTI4 $731
+LABELV $735
+ADDRLP4 84
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $723
+LABELV $724
+LABELV $717
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $716
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $714
+endproc sscanf 88 4
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import strncpy
+lit
+align 1
+LABELV $594
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $593
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 0
+align 1
+LABELV $559
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $289
+byte 1 48
+byte 1 120
+byte 1 0
+align 1
+LABELV $282
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $277
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 0
+align 1
+LABELV $266
+byte 1 110
+byte 1 97
+byte 1 110
+byte 1 0
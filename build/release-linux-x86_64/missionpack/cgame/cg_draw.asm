@@ -0,0 +1,11155 @@
+data
+export menuScoreboard
+align 4
+LABELV menuScoreboard
+byte 4 0
+export CG_Text_Width
+code
+proc CG_Text_Width 52 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cgDC+228+56
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $87
+ADDRLP4 12
+ADDRGP4 cgDC+228+20604
+ASGNP4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $92
+ADDRLP4 12
+ADDRGP4 cgDC+228+41152
+ASGNP4
+LABELV $92
+LABELV $88
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $97
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $99
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $99
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $99
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $104
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $104
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $104
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $104
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+GTI4 $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $102
+JUMPV
+LABELV $104
+ADDRLP4 16
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $102
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $107
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $101
+LABELV $107
+LABELV $97
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $84
+endproc CG_Text_Width 52 4
+export CG_Text_Height
+proc CG_Text_Height 48 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cgDC+228+56
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $111
+ADDRLP4 20
+ADDRGP4 cgDC+228+20604
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRFP4 4
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $116
+ADDRLP4 20
+ADDRGP4 cgDC+228+41152
+ASGNP4
+LABELV $116
+LABELV $112
+ADDRLP4 24
+ADDRFP4 4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $123
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $123
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $123
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $128
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $128
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $128
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $128
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+GTI4 $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $126
+JUMPV
+LABELV $128
+ADDRLP4 12
+CNSTI4 80
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+GEF4 $130
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $130
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $133
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $133
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $125
+LABELV $133
+LABELV $121
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $108
+endproc CG_Text_Height 48 4
+export CG_Text_PaintChar
+proc CG_Text_PaintChar 12 36
+ADDRLP4 8
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $134
+endproc CG_Text_PaintChar 12 36
+export CG_Text_Paint
+proc CG_Text_Paint 80 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgDC+228+56
+ASGNP4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $138
+ADDRLP4 28
+ADDRGP4 cgDC+228+20604
+ASGNP4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $143
+ADDRLP4 28
+ADDRGP4 cgDC+228+41152
+ASGNP4
+LABELV $143
+LABELV $139
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $148
+ADDRLP4 36
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LEI4 $150
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $150
+ADDRLP4 32
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $150
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $155
+ADDRLP4 52
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $155
+ADDRLP4 52
+INDIRI4
+CNSTI4 48
+LTI4 $155
+ADDRLP4 52
+INDIRI4
+CNSTI4 56
+GTI4 $155
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $153
+JUMPV
+LABELV $155
+ADDRLP4 56
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $160
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $158
+LABELV $160
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $162
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+LABELV $163
+ADDRLP4 64
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 colorBlack+12
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintChar
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $158
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintChar
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+ADDRLP4 36
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $153
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $168
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $168
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $152
+LABELV $168
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $148
+LABELV $135
+endproc CG_Text_Paint 80 40
+export CG_Draw3DModel
+proc CG_Draw3DModel 512 16
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+EQI4 $174
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $170
+LABELV $174
+ADDRGP4 $169
+JUMPV
+LABELV $170
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $169
+endproc CG_Draw3DModel 512 16
+export CG_Draw3DModelEyes
+proc CG_Draw3DModelEyes 512 16
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+EQI4 $194
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $190
+LABELV $194
+ADDRGP4 $189
+JUMPV
+LABELV $190
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $189
+endproc CG_Draw3DModelEyes 512 16
+export CG_DrawHead
+proc CG_DrawHead 56 36
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $214
+ADDRGP4 $209
+JUMPV
+LABELV $214
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2104
+ADDP4
+ARGP4
+ADDRGP4 CG_Draw3DModelEyes
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $228
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $228
+LABELV $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $231
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $231
+LABELV $209
+endproc CG_DrawHead 56 36
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 72 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $236
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $236
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 cgs+180272+36
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 56
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $253
+ADDRLP4 48
+ADDRGP4 cgs+180272+36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $254
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+NEI4 $260
+ADDRLP4 48
+ADDRGP4 cgs+180272+40
+INDIRI4
+ASGNI4
+LABELV $260
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+LABELV $265
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+NEI4 $254
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $275
+ADDRLP4 48
+ADDRGP4 cgs+180272+40
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $276
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+NEI4 $282
+ADDRLP4 48
+ADDRGP4 cgs+180272+40
+INDIRI4
+ASGNI4
+LABELV $282
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+NEI4 $287
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+LABELV $287
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 3
+NEI4 $276
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $235
+ADDRLP4 48
+ADDRGP4 cgs+180272+44
+INDIRI4
+ASGNI4
+LABELV $298
+LABELV $276
+LABELV $254
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $301
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $304
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $306
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $235
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $309
+LABELV $307
+LABELV $305
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $310
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $310
+LABELV $301
+LABELV $237
+LABELV $235
+endproc CG_DrawFlagModel 72 32
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $315
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $313
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $320
+LABELV $316
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+180272+192
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $313
+endproc CG_DrawTeamBackground 20 20
+proc CG_DrawAttacker 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $326
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $325
+JUMPV
+LABELV $326
+ADDRGP4 cg+125008
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $325
+JUMPV
+LABELV $330
+ADDRLP4 0
+ADDRGP4 cg+107636+248+24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $340
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $336
+LABELV $340
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $325
+JUMPV
+LABELV $336
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125008
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10000
+LEI4 $343
+ADDRGP4 cg+125008
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $325
+JUMPV
+LABELV $343
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $325
+endproc CG_DrawAttacker 52 24
+proc CG_DrawSpeedMeter 40 16
+ADDRGP4 cg+114788
+INDIRI4
+CNSTI4 0
+EQI4 $350
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $349
+JUMPV
+LABELV $350
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 cg_drawSpeed+12
+INDIRI4
+CNSTI4 1
+NEI4 $355
+CNSTI4 635
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+ADDRGP4 $349
+JUMPV
+LABELV $355
+CNSTI4 320
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 300
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $349
+endproc CG_DrawSpeedMeter 40 16
+proc CG_DrawSnapshot 16 16
+ADDRGP4 $359
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31444
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $358
+endproc CG_DrawSnapshot 16 16
+bss
+align 4
+LABELV $364
+skip 16
+align 4
+LABELV $365
+skip 4
+align 4
+LABELV $366
+skip 4
+code
+proc CG_DrawFPS 56 16
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $366
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $365
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $364
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 $365
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $367
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $369
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $364
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $370
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $369
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $373
+ADDRLP4 24
+CNSTI4 4000
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $375
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $367
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $363
+endproc CG_DrawFPS 56 16
+proc CG_DrawPossessionString 44 16
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $377
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $376
+JUMPV
+LABELV $377
+ADDRLP4 4
+ADDRGP4 $380
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 0
+LEI4 $381
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 1000
+GEI4 $381
+ADDRLP4 12
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $381
+ADDRLP4 8
+ADDRGP4 colorYellow
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $390
+ADDRGP4 $392
+ARGP4
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $388
+JUMPV
+LABELV $390
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $393
+ADDRGP4 $395
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 colorGreen
+ASGNP4
+ADDRGP4 $388
+JUMPV
+LABELV $393
+ADDRGP4 $396
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $397
+ADDRLP4 24
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $401
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 28
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg_entities+776
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+NEF4 $413
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg_entities+776+4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+NEF4 $413
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg_entities+776+8
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+EQF4 $405
+LABELV $413
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+776
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 $416
+ARGP4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CNSTI4 10
+DIVI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 colorYellow
+ASGNP4
+LABELV $405
+LABELV $401
+LABELV $398
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $397
+LABELV $388
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $376
+endproc CG_DrawPossessionString 44 16
+proc CG_DrawTimer 56 16
+ADDRLP4 20
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+34804
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $417
+endproc CG_DrawTimer 56 16
+proc CG_DrawLMSmode 12 16
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRGP4 $425
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 1
+NEI4 $426
+ADDRGP4 $429
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 2
+NEI4 $430
+ADDRGP4 $433
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRGP4 cgs+34824
+INDIRI4
+CNSTI4 3
+NEI4 $434
+ADDRGP4 $437
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRGP4 $438
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $435
+LABELV $431
+LABELV $427
+LABELV $423
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $421
+endproc CG_DrawLMSmode 12 16
+proc CG_DrawCTFoneway 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $440
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $439
+JUMPV
+LABELV $440
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+112
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $444
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $439
+JUMPV
+LABELV $444
+ADDRGP4 cgs+34820
+INDIRI4
+CNSTI4 2
+NEI4 $447
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+64
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $451
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRGP4 cgs+34820
+INDIRI4
+CNSTI4 1
+NEI4 $452
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $456
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $453
+JUMPV
+LABELV $452
+ADDRGP4 $457
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $453
+LABELV $448
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $439
+endproc CG_DrawCTFoneway 28 16
+proc CG_DrawDomStatus 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $459
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34960
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $468
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $470
+ADDRGP4 $464
+JUMPV
+LABELV $468
+ADDRLP4 12
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $470
+ADDRLP4 12
+ARGP4
+ADDRGP4 g_color_table+64
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 12
+ARGP4
+ADDRGP4 g_color_table+112
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $465
+ADDRGP4 $473
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+LABELV $460
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $462
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+34836
+INDIRI4
+LTI4 $459
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $458
+endproc CG_DrawDomStatus 44 16
+proc CG_DrawEliminationTimer 92 16
+ADDRLP4 24
+ADDRGP4 cgs+34812
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $477
+ADDRGP4 cgs+34816
+INDIRI4
+CNSTI4 0
+NEI4 $477
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $475
+JUMPV
+LABELV $477
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+112
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $482
+ADDRLP4 4
+CNSTI4 1000
+ADDRGP4 cgs+34816
+INDIRI4
+MULI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 29999
+GTI4 $487
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+48
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $487
+ADDRLP4 4
+INDIRI4
+CNSTI4 9999
+GTI4 $490
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $490
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+NEGI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_color_table+32
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 64
+CNSTI4 1000
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+125248
+INDIRI4
+CNSTI4 0
+NEI4 $495
+ADDRGP4 $498
+ARGP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 cg+125252
+INDIRI4
+EQI4 $499
+ADDRGP4 cg+125252
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $505
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $508
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $511
+ADDRGP4 $504
+JUMPV
+LABELV $505
+ADDRGP4 cgs+180272+1364
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $504
+JUMPV
+LABELV $508
+ADDRGP4 cgs+180272+1360
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $504
+JUMPV
+LABELV $511
+ADDRGP4 cgs+180272+1356
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $504
+LABELV $499
+ADDRLP4 48
+CNSTF4 1055286886
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg+125252
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $518
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $519
+ADDRGP4 $514
+JUMPV
+LABELV $517
+ADDRLP4 56
+CNSTI4 28
+ASGNI4
+ADDRLP4 48
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $515
+JUMPV
+LABELV $518
+ADDRLP4 56
+CNSTI4 24
+ASGNI4
+ADDRLP4 48
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $515
+JUMPV
+LABELV $519
+ADDRLP4 56
+CNSTI4 20
+ASGNI4
+ADDRLP4 48
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 48
+CNSTF4 1055286886
+ASGNF4
+LABELV $515
+LABELV $495
+LABELV $483
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 60
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 10
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $520
+ADDRGP4 $522
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRGP4 $523
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 84
+INDIRP4
+ASGNP4
+LABELV $521
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 88
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 40
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $475
+endproc CG_DrawEliminationTimer 92 16
+proc CG_DrawTeamOverlay 152 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $525
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $524
+JUMPV
+LABELV $525
+ADDRLP4 92
+CNSTI4 304
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $528
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $528
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $524
+JUMPV
+LABELV $528
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $533
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRLP4 96
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $534
+ADDRLP4 48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $538
+JUMPV
+LABELV $535
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $540
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $540
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $543
+ADDRLP4 56
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $543
+LABELV $540
+LABELV $536
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $538
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $535
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $524
+JUMPV
+LABELV $545
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+LEI4 $547
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+LABELV $547
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $549
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $553
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $553
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $555
+ADDRLP4 44
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $555
+LABELV $553
+LABELV $550
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $549
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LEI4 $557
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+LABELV $557
+ADDRLP4 80
+ADDRLP4 56
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+CNSTI4 32
+ADDI4
+CNSTI4 56
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $559
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 80
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $560
+ADDRLP4 84
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $562
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $563
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $564
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+180272+192
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $577
+JUMPV
+LABELV $574
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $579
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $589
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $587
+LABELV $589
+ADDRLP4 20
+ADDRGP4 $590
+ASGNP4
+LABELV $587
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $591
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $591
+ADDRLP4 132
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $585
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 128
+CNSTI4 3
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 8
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+CNSTI4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $594
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $595
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $600
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $601
+JUMPV
+LABELV $600
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CNSTI4 8
+SUBI4
+ASGNI4
+LABELV $601
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $602
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $606
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $608
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 148
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $610
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $611
+LABELV $608
+LABELV $606
+LABELV $603
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $602
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $579
+LABELV $575
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $577
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $574
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $524
+endproc CG_DrawTeamOverlay 152 36
+proc CG_DrawFollowMessage 20 16
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $620
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $613
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $620
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $613
+LABELV $620
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $612
+JUMPV
+LABELV $613
+ADDRGP4 $621
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $612
+endproc CG_DrawFollowMessage 20 16
+proc CG_DrawFragMsgIcons 32 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 10
+ASGNI4
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7000
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $623
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $622
+JUMPV
+LABELV $623
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $625
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+CNSTF4 1045220557
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $626
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 300
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1045220557
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $629
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $627
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $622
+endproc CG_DrawFragMsgIcons 32 32
+proc CG_DrawFragMsgText 8 32
+CNSTI4 276
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832+68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7000
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $633
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $633
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1101004800
+ARGF4
+CNSTI4 13
+ADDRFP4 4
+INDIRI4
+MULI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1045220557
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $630
+endproc CG_DrawFragMsgText 8 32
+proc CG_DrawFragMessage 284 12
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $636
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $640
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832+68
+ADDP4
+INDIRI4
+CNSTI4 7000
+ADDI4
+LEI4 $643
+ADDRLP4 4
+CNSTI4 276
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $643
+LABELV $640
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $649
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+NEI4 $652
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832+76
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFragMsgText
+CALLV
+pop
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 3
+LTI4 $657
+ADDRLP4 4
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+178832
+ADDP4
+INDIRB
+ASGNB 276
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFragMsgIcons
+CALLV
+pop
+LABELV $657
+LABELV $653
+LABELV $649
+LABELV $637
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $636
+LABELV $635
+endproc CG_DrawFragMessage 284 12
+proc CG_DrawUpperRight 24 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $662
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cgs+34808
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $662
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $662
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $662
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $667
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+EQI4 $667
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawLMSmode
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $668
+JUMPV
+LABELV $667
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $671
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawCTFoneway
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $672
+JUMPV
+LABELV $671
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 12
+NEI4 $674
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawDomStatus
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $675
+JUMPV
+LABELV $674
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $677
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawPossessionString
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $677
+LABELV $675
+LABELV $672
+LABELV $668
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $680
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $680
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $683
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $686
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $683
+LABELV $686
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $683
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $693
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $693
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $687
+LABELV $693
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawEliminationTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $687
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 CG_DrawFollowMessage
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $694
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $694
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $697
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 CG_DrawAttacker
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $697
+ADDRGP4 cg_drawSpeed+12
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 CG_DrawSpeedMeter
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $700
+LABELV $661
+endproc CG_DrawUpperRight 24 12
+proc CG_DrawReward 68 36
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $704
+ADDRGP4 $703
+JUMPV
+LABELV $704
+ADDRGP4 cg+125020
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $708
+ADDRGP4 cg+125016
+INDIRI4
+CNSTI4 0
+LEI4 $703
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $716
+JUMPV
+LABELV $713
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+125104
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+125104+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+125064
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+125064+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+125024
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+125024+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $714
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $716
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+125016
+INDIRI4
+LTI4 $713
+ADDRGP4 cg+125020
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cg+125016
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+125020
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 cg+125104
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $711
+LABELV $708
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+125024
+INDIRI4
+CNSTI4 10
+LTI4 $732
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133772800
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+125064
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $736
+ARGP4
+ADDRGP4 cg+125024
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $733
+JUMPV
+LABELV $732
+ADDRLP4 12
+ADDRGP4 cg+125024
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $742
+JUMPV
+LABELV $739
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+125064
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $740
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $742
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $739
+LABELV $733
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $703
+endproc CG_DrawReward 68 36
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $745
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $751
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $750
+JUMPV
+LABELV $751
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $750
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $766
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $762
+LABELV $766
+ADDRGP4 $761
+JUMPV
+LABELV $762
+ADDRLP4 24
+ADDRGP4 $767
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $768
+ADDRGP4 $761
+JUMPV
+LABELV $768
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $761
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_lagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $777
+ADDRGP4 cgs+31452
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $773
+LABELV $777
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $772
+JUMPV
+LABELV $773
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 336
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+328
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $783
+JUMPV
+LABELV $780
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $785
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $787
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $787
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $790
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $790
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $786
+JUMPV
+LABELV $785
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $794
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $796
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $796
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $799
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $799
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $794
+LABELV $786
+LABELV $781
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $783
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $780
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $806
+JUMPV
+LABELV $803
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $809
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $811
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $812
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $812
+JUMPV
+LABELV $811
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $817
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $817
+LABELV $812
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $820
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $820
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $810
+JUMPV
+LABELV $809
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $824
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $826
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $826
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $824
+LABELV $810
+LABELV $804
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $806
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $803
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $835
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $831
+LABELV $835
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 $836
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $831
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $772
+endproc CG_DrawLagometer 76 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+123956
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+123944
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123952
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123948
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124980
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+123956
+ASGNP4
+ADDRGP4 $847
+JUMPV
+LABELV $846
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $849
+ADDRLP4 4
+ADDRGP4 cg+124980
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $849
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $847
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $846
+LABELV $837
+endproc CG_CenterPrint 8 12
+proc CG_DrawCenterString 1068 32
+ADDRGP4 cg+123944
+INDIRI4
+CNSTI4 0
+NEI4 $853
+ADDRGP4 $852
+JUMPV
+LABELV $853
+ADDRGP4 cg+123944
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $858
+ADDRGP4 $852
+JUMPV
+LABELV $858
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+123956
+ASGNP4
+ADDRLP4 12
+ADDRGP4 cg+123952
+INDIRI4
+ADDRGP4 cg+124980
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $864
+JUMPV
+LABELV $863
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $866
+ADDRLP4 1056
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $872
+ADDRLP4 1056
+INDIRI4
+CNSTI4 10
+NEI4 $870
+LABELV $872
+ADDRGP4 $868
+JUMPV
+LABELV $870
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $867
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LTI4 $866
+LABELV $868
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 32
+ARGP4
+CNSTF4 1056964608
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ARGP4
+CNSTF4 1056964608
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1060
+ADDRGP4 CG_Text_Height
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 640
+ADDRLP4 20
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+ADDI4
+ADDI4
+ASGNI4
+ADDRGP4 $874
+JUMPV
+LABELV $873
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $874
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $876
+ADDRLP4 1064
+INDIRI4
+CNSTI4 10
+NEI4 $873
+LABELV $876
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $877
+ADDRGP4 $865
+JUMPV
+LABELV $877
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $864
+ADDRGP4 $863
+JUMPV
+LABELV $865
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $852
+endproc CG_DrawCenterString 1068 32
+proc CG_DrawCenter1FctfString 0 0
+LABELV $879
+endproc CG_DrawCenter1FctfString 0 0
+proc CG_DrawCenterDDString 0 0
+LABELV $880
+endproc CG_DrawCenterDDString 0 0
+proc CG_DrawCrosshair 92 36
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg+107636+144
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $884
+ADDRGP4 $881
+JUMPV
+LABELV $884
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $887
+ADDRGP4 $881
+JUMPV
+LABELV $887
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $890
+ADDRGP4 $881
+JUMPV
+LABELV $890
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $893
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $894
+JUMPV
+LABELV $893
+ADDRLP4 32
+ADDRGP4 cg_crosshairColorRed+8
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRGP4 cg_crosshairColorGreen+8
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+ADDRGP4 cg_crosshairColorBlue+8
+INDIRF4
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $894
+ADDRGP4 cg_differentCrosshairs+12
+INDIRI4
+CNSTI4 1
+NEI4 $902
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+LTI4 $905
+ADDRLP4 32
+INDIRI4
+CNSTI4 13
+GTI4 $905
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $948-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $948
+address $907
+address $910
+address $913
+address $916
+address $919
+address $922
+address $925
+address $928
+address $931
+address $934
+address $937
+address $940
+address $943
+code
+LABELV $907
+ADDRLP4 36
+ADDRGP4 cg_ch1size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch1+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $910
+ADDRLP4 40
+ADDRGP4 cg_ch2size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch2+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $913
+ADDRLP4 44
+ADDRGP4 cg_ch3size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch3+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $916
+ADDRLP4 48
+ADDRGP4 cg_ch4size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch4+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $919
+ADDRLP4 52
+ADDRGP4 cg_ch5size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch5+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $922
+ADDRLP4 56
+ADDRGP4 cg_ch6size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch6+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $925
+ADDRLP4 60
+ADDRGP4 cg_ch7size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch7+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $928
+ADDRLP4 64
+ADDRGP4 cg_ch8size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch8+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $931
+ADDRLP4 68
+ADDRGP4 cg_ch9size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch9+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $934
+ADDRLP4 72
+ADDRGP4 cg_ch10size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch10+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $937
+ADDRLP4 76
+ADDRGP4 cg_ch11size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch11+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $940
+ADDRLP4 80
+ADDRGP4 cg_ch12size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch12+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $943
+ADDRLP4 84
+ADDRGP4 cg_ch13size+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_ch13+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $905
+ADDRLP4 88
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $902
+ADDRLP4 32
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+LABELV $903
+ADDRGP4 cg_crosshairPulse+12
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125264
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+LEF4 $957
+ADDRLP4 32
+INDIRF4
+CNSTF4 1128792064
+GEF4 $957
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $957
+LABELV $952
+ADDRLP4 16
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+ADDRGP4 wideAdjustX
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $961
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $961
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $965
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $965
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 36
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+109252
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+109252+8
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+109252+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+109252+12
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $881
+endproc CG_DrawCrosshair 92 36
+proc CG_ScanForCrosshairEntity 96 28
+ADDRLP4 56
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109252+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109252+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+109252+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $992
+ADDRGP4 $976
+JUMPV
+LABELV $992
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $996
+ADDRGP4 $976
+JUMPV
+LABELV $996
+CNSTI4 936
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $998
+ADDRGP4 $976
+JUMPV
+LABELV $998
+ADDRGP4 cg+124992
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124996
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $976
+endproc CG_ScanForCrosshairEntity 96 28
+proc CG_DrawCrosshairNames 24 32
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1007
+ADDRGP4 $1006
+JUMPV
+LABELV $1007
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $1010
+ADDRGP4 $1006
+JUMPV
+LABELV $1010
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1013
+ADDRGP4 $1006
+JUMPV
+LABELV $1013
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+124996
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1017
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1006
+JUMPV
+LABELV $1017
+ADDRLP4 4
+CNSTI4 2120
+ADDRGP4 cg+124992
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1050253722
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+CNSTF4 1128136704
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1006
+endproc CG_DrawCrosshairNames 24 32
+proc CG_DrawSpectator 0 16
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $1023
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1024
+CNSTI4 200
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1027
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $1025
+JUMPV
+LABELV $1024
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1028
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1028
+CNSTI4 8
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1032
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1028
+LABELV $1025
+LABELV $1022
+endproc CG_DrawSpectator 0 16
+proc CG_DrawVote 12 20
+ADDRGP4 cgs+31684
+INDIRI4
+CNSTI4 0
+NEI4 $1034
+ADDRGP4 $1033
+JUMPV
+LABELV $1034
+ADDRGP4 cgs+31696
+INDIRI4
+CNSTI4 0
+EQI4 $1037
+ADDRGP4 cgs+31696
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1037
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+31684
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1045
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1045
+ADDRGP4 $1047
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31700
+ARGP4
+ADDRGP4 cgs+31688
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31692
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $1051
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 76
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1033
+endproc CG_DrawVote 12 20
+proc CG_DrawTeamVote 24 20
+CNSTI4 2120
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1053
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1053
+CNSTI4 2120
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1052
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1059
+LABELV $1054
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1063
+ADDRGP4 $1052
+JUMPV
+LABELV $1063
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1066
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1066
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1074
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1074
+ADDRGP4 $1076
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32756
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32732
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1052
+endproc CG_DrawTeamVote 24 20
+data
+align 4
+LABELV $1081
+byte 4 1
+code
+proc CG_DrawScoreboard 16 8
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1082
+ADDRLP4 4
+ADDRGP4 menuScoreboard
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -1048577
+BANDI4
+ASGNI4
+LABELV $1082
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1081
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1084
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $1088
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $1088
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1081
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1088
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+125248
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1094
+ADDRGP4 cg+114784
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1094
+CNSTI4 0
+RETI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1094
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+NEI4 $1106
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 3
+EQI4 $1106
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $1098
+LABELV $1106
+ADDRLP4 0
+ADDRGP4 colorWhite
+ASGNP4
+ADDRGP4 $1099
+JUMPV
+LABELV $1098
+ADDRGP4 cg+114792
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1108
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114924
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1081
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1108
+LABELV $1099
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1112
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1114
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1114
+ADDRGP4 $1118
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 menuScoreboard
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $1115
+JUMPV
+LABELV $1114
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 menuScoreboard
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $1115
+LABELV $1112
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1120
+ADDRGP4 $1081
+INDIRI4
+CNSTI4 0
+EQI4 $1122
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+ADDRGP4 $1081
+CNSTI4 0
+ASGNI4
+LABELV $1122
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $1120
+ADDRLP4 8
+ADDRGP4 cg+16
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LEI4 $1124
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $1124
+CNSTI4 1
+RETI4
+LABELV $1080
+endproc CG_DrawScoreboard 16 8
+export CG_DrawAccboard
+proc CG_DrawAccboard 44 24
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+114912
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1128
+CNSTI4 0
+RETI4
+ADDRGP4 $1127
+JUMPV
+LABELV $1128
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1131
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+344+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $1135
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1135
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1135
+LABELV $1132
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $1131
+CNSTI4 500
+ARGI4
+CNSTI4 150
+ARGI4
+CNSTI4 75
+ARGI4
+ADDRLP4 12
+CNSTI4 20
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1139
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+344+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1143
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+EQI4 $1143
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1143
+CNSTF4 1140785152
+ARGF4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+344+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+114796
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1149
+ADDRGP4 $1152
+ARGP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+CNSTF4 1120403456
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+114796+4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 cg+114796
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRGP4 $1156
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 536
+ARGI4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $1150
+JUMPV
+LABELV $1149
+CNSTI4 536
+ARGI4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 160
+ADDI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 $1157
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1150
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1143
+LABELV $1140
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $1139
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1127
+endproc CG_DrawAccboard 44 24
+proc CG_DrawIntermission 4 0
+ADDRGP4 cg+114792
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114788
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1158
+endproc CG_DrawIntermission 4 0
+proc CG_DrawFollow 36 36
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1163
+CNSTI4 0
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1163
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 248
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 $1169
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 2120
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1162
+endproc CG_DrawFollow 36 36
+proc CG_DrawAmmoWarning 12 16
+ADDRGP4 cgs+34828
+INDIRI4
+CNSTI4 0
+EQI4 $1174
+ADDRGP4 $1173
+JUMPV
+LABELV $1174
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1177
+ADDRGP4 $1173
+JUMPV
+LABELV $1177
+ADDRGP4 cg+124984
+INDIRI4
+CNSTI4 0
+NEI4 $1180
+ADDRGP4 $1173
+JUMPV
+LABELV $1180
+ADDRGP4 cg+124984
+INDIRI4
+CNSTI4 2
+NEI4 $1183
+ADDRLP4 0
+ADDRGP4 $1186
+ASGNP4
+ADDRGP4 $1184
+JUMPV
+LABELV $1183
+ADDRLP4 0
+ADDRGP4 $1187
+ASGNP4
+LABELV $1184
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1173
+endproc CG_DrawAmmoWarning 12 16
+bss
+align 4
+LABELV $1189
+skip 4
+align 4
+LABELV $1190
+skip 4
+align 4
+LABELV $1191
+skip 4
+code
+proc CG_DrawProxWarning 44 16
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1192
+ADDRGP4 $1189
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1188
+JUMPV
+LABELV $1192
+ADDRGP4 $1189
+INDIRI4
+CNSTI4 0
+NEI4 $1195
+ADDRGP4 $1189
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 $1190
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1191
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1195
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 $1189
+INDIRI4
+LEI4 $1198
+ADDRLP4 40
+ADDRGP4 $1190
+ASGNP4
+ADDRLP4 36
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1191
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $1189
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $1198
+LABELV $1196
+ADDRGP4 $1191
+INDIRI4
+CNSTI4 0
+EQI4 $1202
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1204
+ARGP4
+ADDRGP4 $1191
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1205
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1203
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $1188
+endproc CG_DrawProxWarning 44 16
+proc CG_DrawWarmup 52 32
+ADDRLP4 4
+ADDRGP4 cg+125248
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1209
+ADDRGP4 $1207
+JUMPV
+LABELV $1209
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1211
+ADDRLP4 8
+ADDRGP4 $1213
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+125252
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1207
+JUMPV
+LABELV $1211
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1215
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1218
+ADDRLP4 36
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $1223
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1223
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1228
+ADDRLP4 12
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 $1229
+JUMPV
+LABELV $1228
+ADDRLP4 24
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+LABELV $1229
+LABELV $1223
+LABELV $1219
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1221
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $1218
+ADDRLP4 36
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $1216
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $1216
+ADDRGP4 $1234
+ARGP4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1058642330
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1114636288
+ARGF4
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $1216
+JUMPV
+LABELV $1215
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 0
+NEI4 $1235
+ADDRLP4 8
+ADDRGP4 $1238
+ASGNP4
+ADDRGP4 $1236
+JUMPV
+LABELV $1235
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+NEI4 $1239
+ADDRLP4 8
+ADDRGP4 $1242
+ASGNP4
+ADDRGP4 $1240
+JUMPV
+LABELV $1239
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $1243
+ADDRLP4 8
+ADDRGP4 $1246
+ASGNP4
+ADDRGP4 $1244
+JUMPV
+LABELV $1243
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+NEI4 $1247
+ADDRLP4 8
+ADDRGP4 $1250
+ASGNP4
+ADDRGP4 $1248
+JUMPV
+LABELV $1247
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $1251
+ADDRLP4 8
+ADDRGP4 $1254
+ASGNP4
+ADDRGP4 $1252
+JUMPV
+LABELV $1251
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $1255
+ADDRLP4 8
+ADDRGP4 $1258
+ASGNP4
+ADDRGP4 $1256
+JUMPV
+LABELV $1255
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $1259
+ADDRLP4 8
+ADDRGP4 $1262
+ASGNP4
+ADDRGP4 $1260
+JUMPV
+LABELV $1259
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1263
+ADDRLP4 8
+ADDRGP4 $1266
+ASGNP4
+ADDRGP4 $1264
+JUMPV
+LABELV $1263
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+NEI4 $1267
+ADDRLP4 8
+ADDRGP4 $1270
+ASGNP4
+ADDRGP4 $1268
+JUMPV
+LABELV $1267
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $1271
+ADDRLP4 8
+ADDRGP4 $1274
+ASGNP4
+ADDRGP4 $1272
+JUMPV
+LABELV $1271
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 12
+NEI4 $1275
+ADDRLP4 8
+ADDRGP4 $1278
+ASGNP4
+ADDRGP4 $1276
+JUMPV
+LABELV $1275
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $1279
+ADDRLP4 8
+ADDRGP4 $1282
+ASGNP4
+ADDRGP4 $1280
+JUMPV
+LABELV $1279
+ADDRLP4 8
+ADDRGP4 $1283
+ASGNP4
+LABELV $1280
+LABELV $1276
+LABELV $1272
+LABELV $1268
+LABELV $1264
+LABELV $1260
+LABELV $1256
+LABELV $1252
+LABELV $1248
+LABELV $1244
+LABELV $1240
+LABELV $1236
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1058642330
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1216
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1285
+ADDRGP4 cg+125248
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1285
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+125252
+INDIRI4
+EQI4 $1289
+ADDRGP4 cg+125252
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1295
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1298
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1301
+ADDRGP4 $1294
+JUMPV
+LABELV $1295
+ADDRGP4 cgs+180272+1364
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1294
+JUMPV
+LABELV $1298
+ADDRGP4 cgs+180272+1360
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1294
+JUMPV
+LABELV $1301
+ADDRGP4 cgs+180272+1356
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1294
+LABELV $1289
+ADDRLP4 20
+CNSTF4 1055286886
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+125252
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1307
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+EQI4 $1308
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+EQI4 $1309
+ADDRGP4 $1304
+JUMPV
+LABELV $1307
+ADDRLP4 28
+CNSTI4 28
+ASGNI4
+ADDRLP4 20
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $1305
+JUMPV
+LABELV $1308
+ADDRLP4 28
+CNSTI4 24
+ASGNI4
+ADDRLP4 20
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $1305
+JUMPV
+LABELV $1309
+ADDRLP4 28
+CNSTI4 20
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+ADDRLP4 28
+CNSTI4 16
+ASGNI4
+ADDRLP4 20
+CNSTF4 1055286886
+ASGNF4
+LABELV $1305
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1123680256
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1207
+endproc CG_DrawWarmup 52 32
+export CG_DrawTimedMenus
+proc CG_DrawTimedMenus 4 8
+ADDRGP4 cg+125012
+INDIRI4
+CNSTI4 0
+EQI4 $1311
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125012
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2500
+LEI4 $1316
+ADDRGP4 $1318
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $1319
+ARGP4
+ADDRGP4 $1320
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cg+125012
+CNSTI4 0
+ASGNI4
+LABELV $1316
+LABELV $1311
+LABELV $1310
+endproc CG_DrawTimedMenus 4 8
+proc CG_Draw2D 12 4
+ADDRGP4 cgs+180216
+INDIRI4
+CNSTI4 0
+EQI4 $1323
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+180220
+INDIRI4
+LEI4 $1323
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+LABELV $1323
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1328
+ADDRGP4 $1322
+JUMPV
+LABELV $1328
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1331
+ADDRGP4 $1322
+JUMPV
+LABELV $1331
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1334
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1322
+JUMPV
+LABELV $1334
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1337
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1340
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1340
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1338
+JUMPV
+LABELV $1337
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114784
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1342
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1342
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1346
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 CG_DrawTimedMenus
+CALLV
+pop
+LABELV $1346
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRGP4 CG_DrawProxWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1349
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1349
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+LABELV $1342
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1351
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1351
+LABELV $1351
+LABELV $1338
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+NEI4 $1355
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+LABELV $1355
+ADDRGP4 CG_DrawFragMessage
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1358
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+LABELV $1358
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114788
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+114788
+INDIRI4
+CNSTI4 0
+NEI4 $1361
+ADDRGP4 CG_DrawCenterDDString
+CALLV
+pop
+ADDRGP4 CG_DrawCenter1FctfString
+CALLV
+pop
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1361
+ADDRLP4 8
+ADDRGP4 CG_DrawAccboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114916
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1322
+endproc CG_Draw2D 12 4
+proc CG_DrawTourneyScoreboard 0 0
+LABELV $1365
+endproc CG_DrawTourneyScoreboard 0 0
+export CG_DrawActive
+proc CG_DrawActive 8 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1367
+ADDRGP4 $1370
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1366
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1366
+JUMPV
+LABELV $1367
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1373
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1373
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1366
+JUMPV
+LABELV $1373
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRGP4 cg+109252
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+LABELV $1366
+endproc CG_DrawActive 8 4
+export CG_UpdateMediaFraction
+proc CG_UpdateMediaFraction 0 0
+ADDRGP4 cg+156512
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $1378
+endproc CG_UpdateMediaFraction 0 0
+export CG_UpdateSoundFraction
+proc CG_UpdateSoundFraction 0 0
+ADDRGP4 cg+156516
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $1380
+endproc CG_UpdateSoundFraction 0 0
+export CG_UpdateGraphicFraction
+proc CG_UpdateGraphicFraction 0 0
+ADDRGP4 cg+156520
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $1382
+endproc CG_UpdateGraphicFraction 0 0
+export CG_DrawLoadingScreen
+proc CG_DrawLoadingScreen 8 8
+ADDRGP4 $1370
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1385
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+ADDRGP4 $1386
+JUMPV
+LABELV $1385
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+LABELV $1386
+LABELV $1384
+endproc CG_DrawLoadingScreen 8 8
+import trap_Cmd_ExecuteText
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import cgDC
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+import drawTeamOverlayModificationCount
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1370
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1320
+byte 1 48
+byte 1 0
+align 1
+LABELV $1319
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 88
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1318
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1288
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1283
+byte 1 0
+align 1
+LABELV $1282
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1278
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1274
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1270
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1266
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $1262
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1258
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1254
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1250
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1246
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1242
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1238
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1234
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1213
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1205
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 72
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 69
+byte 1 69
+byte 1 78
+byte 1 32
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $1204
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 77
+byte 1 66
+byte 1 85
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1187
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1186
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1169
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1157
+byte 1 45
+byte 1 37
+byte 1 0
+align 1
+LABELV $1156
+byte 1 37
+byte 1 0
+align 1
+LABELV $1152
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1119
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1118
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1076
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1051
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1047
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1032
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1027
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1023
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $836
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $771
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $767
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $736
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $629
+byte 1 40
+byte 1 94
+byte 1 49
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 94
+byte 1 55
+byte 1 41
+byte 1 0
+align 1
+LABELV $621
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $593
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $590
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $523
+byte 1 32
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $522
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $498
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $473
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $457
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $456
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $451
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $438
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $437
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $433
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $429
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $425
+byte 1 76
+byte 1 77
+byte 1 83
+byte 1 58
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 43
+byte 1 32
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $420
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $416
+byte 1 37
+byte 1 100
+byte 1 48
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $396
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $395
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $392
+byte 1 83
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $380
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $375
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $359
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $354
+byte 1 37
+byte 1 105
+byte 1 117
+byte 1 47
+byte 1 115
+byte 1 0
+align 1
+LABELV $348
+byte 1 110
+byte 1 0
@@ -0,0 +1,10348 @@
+bss
+align 1
+LABELV $76
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $77
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $79
+ASGNP4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 4
+ADDRGP4 $80
+ASGNP4
+LABELV $78
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $81
+ADDRLP4 0
+ADDRGP4 $83
+ASGNP4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $84
+ADDRLP4 0
+ADDRGP4 $86
+ASGNP4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $87
+ADDRLP4 0
+ADDRGP4 $89
+ASGNP4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $90
+ADDRLP4 0
+ADDRGP4 $92
+ASGNP4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $93
+ADDRLP4 0
+ADDRGP4 $95
+ASGNP4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $96
+ADDRLP4 0
+ADDRGP4 $98
+ASGNP4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $99
+ADDRGP4 $101
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $102
+ADDRGP4 $104
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $105
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRGP4 $108
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $106
+LABELV $103
+LABELV $100
+LABELV $97
+LABELV $94
+LABELV $91
+LABELV $88
+LABELV $85
+LABELV $82
+ADDRGP4 $76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $76
+RETP4
+LABELV $75
+endproc CG_PlaceString 12 20
+proc CG_Obituary 152 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRGP4 cgs+178832+1104
+ASGNP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $115
+ADDRLP4 40
+INDIRI4
+CNSTI4 64
+LTI4 $113
+LABELV $115
+ADDRGP4 $116
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $113
+ADDRLP4 104
+CNSTI4 2120
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $120
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $118
+LABELV $120
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 128
+INDIRP4
+ASGNP4
+LABELV $119
+ADDRLP4 40
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $121
+ADDRGP4 $110
+JUMPV
+LABELV $121
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 132
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 100
+ADDRGP4 $80
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1022
+EQI4 $125
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRLP4 52
+INDIRI4
+CNSTI4 14
+LTI4 $129
+ADDRLP4 52
+INDIRI4
+CNSTI4 22
+GTI4 $129
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $165-56
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $165
+address $143
+address $147
+address $151
+address $139
+address $129
+address $135
+address $131
+address $155
+address $159
+code
+LABELV $131
+ADDRLP4 48
+ADDRGP4 $132
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $135
+ADDRLP4 48
+ADDRGP4 $136
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $139
+ADDRLP4 48
+ADDRGP4 $140
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $143
+ADDRLP4 48
+ADDRGP4 $144
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $147
+ADDRLP4 48
+ADDRGP4 $148
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $151
+ADDRLP4 48
+ADDRGP4 $152
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $155
+ADDRLP4 48
+ADDRGP4 $156
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $159
+ADDRLP4 48
+ADDRGP4 $160
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+LABELV $130
+LABELV $126
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $167
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 13
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $205
+ADDRLP4 52
+INDIRI4
+ADDRLP4 140
+INDIRI4
+GTI4 $229
+LABELV $228
+ADDRLP4 52
+INDIRI4
+CNSTI4 5
+EQI4 $175
+ADDRLP4 52
+INDIRI4
+CNSTI4 7
+EQI4 $185
+ADDRLP4 52
+INDIRI4
+CNSTI4 9
+EQI4 $195
+ADDRGP4 $169
+JUMPV
+LABELV $229
+ADDRLP4 52
+INDIRI4
+CNSTI4 25
+EQI4 $209
+ADDRLP4 52
+INDIRI4
+CNSTI4 26
+EQI4 $171
+ADDRGP4 $169
+JUMPV
+LABELV $171
+ADDRLP4 48
+ADDRGP4 $172
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+764
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $175
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $176
+ADDRLP4 48
+ADDRGP4 $178
+ASGNP4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $179
+ADDRLP4 48
+ADDRGP4 $181
+ASGNP4
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 48
+ADDRGP4 $182
+ASGNP4
+LABELV $180
+LABELV $177
+ADDRLP4 92
+ADDRGP4 cgs+180272+760
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $185
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $186
+ADDRLP4 48
+ADDRGP4 $188
+ASGNP4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $189
+ADDRLP4 48
+ADDRGP4 $191
+ASGNP4
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 48
+ADDRGP4 $192
+ASGNP4
+LABELV $190
+LABELV $187
+ADDRLP4 92
+ADDRGP4 cgs+180272+792
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $195
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $196
+ADDRLP4 48
+ADDRGP4 $198
+ASGNP4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $199
+ADDRLP4 48
+ADDRGP4 $201
+ASGNP4
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRLP4 48
+ADDRGP4 $202
+ASGNP4
+LABELV $200
+LABELV $197
+ADDRLP4 92
+ADDRGP4 cgs+180272+780
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $205
+ADDRLP4 48
+ADDRGP4 $206
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+744
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $209
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $210
+ADDRLP4 48
+ADDRGP4 $212
+ASGNP4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $213
+ADDRLP4 48
+ADDRGP4 $215
+ASGNP4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 48
+ADDRGP4 $216
+ASGNP4
+LABELV $214
+LABELV $211
+ADDRLP4 92
+ADDRGP4 cgs+180272+784
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+NEI4 $219
+ADDRLP4 48
+ADDRGP4 $221
+ASGNP4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 108
+INDIRI4
+CNSTI4 2
+NEI4 $222
+ADDRLP4 48
+ADDRGP4 $224
+ASGNP4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 48
+ADDRGP4 $225
+ASGNP4
+LABELV $223
+LABELV $220
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+LABELV $170
+LABELV $167
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $230
+ADDRLP4 8
+ARGP4
+ADDRLP4 136
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 1
+EQI4 $236
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 4
+NEI4 $232
+LABELV $236
+ADDRGP4 $237
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $232
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+LTI4 $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $241
+ADDRLP4 140
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832
+ADDP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832+276
+ADDP4
+INDIRB
+ASGNB 276
+LABELV $242
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $241
+ADDRGP4 cgs+178832+1104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 276
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 200
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $230
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $252
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+GEI4 $255
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRGP4 $263
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRGP4 $264
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+ASGNP4
+LABELV $262
+LABELV $256
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_singlePlayerActive+12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+EQI4 $269
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $265
+LABELV $269
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1098907648
+ADDRGP4 cg_fragmsgsize+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $265
+LABELV $252
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $271
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 140
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $124
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 40
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $274
+ADDRGP4 cg+114924
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $274
+LABELV $272
+ADDRLP4 4
+INDIRI4
+CNSTI4 1022
+EQI4 $279
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+LTI4 $281
+ADDRLP4 52
+INDIRI4
+CNSTI4 28
+GTI4 $281
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $394-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $394
+address $295
+address $287
+address $291
+address $299
+address $304
+address $309
+address $313
+address $317
+address $322
+address $325
+address $329
+address $333
+address $333
+address $281
+address $370
+address $366
+address $382
+address $361
+address $374
+address $387
+address $281
+address $378
+address $338
+address $342
+address $347
+address $352
+address $357
+address $283
+code
+LABELV $283
+ADDRLP4 48
+ADDRGP4 $284
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+756
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $287
+ADDRLP4 48
+ADDRGP4 $288
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+752
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $291
+ADDRLP4 48
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+772
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $295
+ADDRLP4 48
+ADDRGP4 $296
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+796
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $299
+ADDRLP4 48
+ADDRGP4 $300
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $301
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+760
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $304
+ADDRLP4 48
+ADDRGP4 $305
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $306
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+760
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $309
+ADDRLP4 48
+ADDRGP4 $300
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $310
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+792
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $313
+ADDRLP4 48
+ADDRGP4 $314
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $310
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+792
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $317
+ADDRLP4 48
+ADDRGP4 $318
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $319
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+780
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $322
+ADDRLP4 48
+ADDRGP4 $318
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $319
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+780
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $325
+ADDRLP4 48
+ADDRGP4 $326
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+788
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $329
+ADDRLP4 48
+ADDRGP4 $330
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+768
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $333
+ADDRLP4 48
+ADDRGP4 $334
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $335
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+744
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $338
+ADDRLP4 48
+ADDRGP4 $339
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+776
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $342
+ADDRLP4 48
+ADDRGP4 $343
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $344
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+748
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $347
+ADDRLP4 48
+ADDRGP4 $348
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $349
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+784
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $352
+ADDRLP4 48
+ADDRGP4 $353
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $354
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+764
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $357
+ADDRLP4 48
+ADDRGP4 $358
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+784
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $361
+ADDRLP4 48
+ADDRGP4 $362
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $363
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $366
+ADDRLP4 48
+ADDRGP4 $367
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $370
+ADDRLP4 48
+ADDRGP4 $371
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $374
+ADDRLP4 48
+ADDRGP4 $375
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $378
+ADDRLP4 48
+ADDRGP4 $379
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $382
+ADDRLP4 48
+ADDRGP4 $383
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $384
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $387
+ADDRLP4 48
+ADDRGP4 $388
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 48
+ADDRGP4 $391
+ASGNP4
+ADDRLP4 92
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+LABELV $282
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 48
+ADDRGP4 $400
+ASGNP4
+ADDRLP4 100
+ADDRGP4 $80
+ASGNP4
+LABELV $398
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 1
+EQI4 $405
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 4
+NEI4 $401
+LABELV $405
+ADDRGP4 $406
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $401
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+LTI4 $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $410
+ADDRLP4 144
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cgs+178832
+ADDP4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 cgs+178832+276
+ADDP4
+INDIRB
+ASGNB 276
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $410
+ADDRGP4 cgs+178832+1104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 276
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 144
+CNSTI4 32
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTI4 200
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $396
+LABELV $279
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 1
+EQI4 $425
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 4
+NEI4 $421
+LABELV $425
+ADDRGP4 $426
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $421
+ADDRGP4 cg_obituaryOutput+12
+INDIRI4
+CNSTI4 2
+LTI4 $427
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $430
+ADDRLP4 140
+CNSTI4 276
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832
+ADDP4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cgs+178832+276
+ADDP4
+INDIRB
+ASGNB 276
+LABELV $431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $430
+ADDRGP4 cgs+178832+1104
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 276
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 140
+CNSTI4 32
+ASGNI4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cgs+180272+800
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 200
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $427
+LABELV $110
+endproc CG_Obituary 152 20
+proc CG_UseItem 32 16
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $446
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $444
+LABELV $446
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $444
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRGP4 $452
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $451
+LABELV $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $454
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $454
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $472
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $472
+address $456
+address $455
+address $460
+address $455
+address $455
+address $469
+code
+LABELV $454
+LABELV $456
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+816
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $460
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $461
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+GEI4 $461
+ADDRLP4 16
+CNSTI4 2120
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $461
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+1260
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $469
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+1012
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $455
+LABELV $443
+endproc CG_UseItem 32 16
+proc CG_WeaponHigher 28 16
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg_weaponOrder+16
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 16
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg_weaponOrder+16
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+EQU4 $479
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+NEU4 $477
+LABELV $479
+CNSTI4 0
+RETI4
+ADDRGP4 $473
+JUMPV
+LABELV $477
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+LEU4 $480
+CNSTI4 1
+RETI4
+ADDRGP4 $473
+JUMPV
+LABELV $480
+CNSTI4 0
+RETI4
+LABELV $473
+endproc CG_WeaponHigher 28 16
+proc CG_ItemPickup 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125256
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125260
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125264
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $488
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 1
+NEI4 $491
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $491
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $491
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 2
+NEI4 $499
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $499
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $499
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 3
+NEI4 $508
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_WeaponHigher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $508
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 4
+NEI4 $517
+ADDRLP4 4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $517
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_WeaponHigher
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $517
+LABELV $488
+LABELV $482
+endproc CG_ItemPickup 12 8
+export CG_WaterLevel
+proc CG_WaterLevel 52 8
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3250061312
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $532
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $530
+LABELV $532
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRGP4 cg_enableQ+12
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102053376
+ADDF4
+ASGNF4
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $535
+LABELV $531
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $539
+ADDRLP4 40
+CNSTF4 3250585600
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $543
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+LABELV $546
+LABELV $543
+LABELV $539
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $528
+endproc CG_WaterLevel 52 8
+export CG_PainEvent
+proc CG_PainEvent 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $549
+ADDRGP4 $548
+JUMPV
+LABELV $549
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $552
+ADDRLP4 0
+ADDRGP4 $554
+ASGNP4
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $555
+ADDRLP4 0
+ADDRGP4 $557
+ASGNP4
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $558
+ADDRLP4 0
+ADDRGP4 $560
+ASGNP4
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRLP4 0
+ADDRGP4 $561
+ASGNP4
+LABELV $559
+LABELV $556
+LABELV $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $562
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $564
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $564
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $548
+endproc CG_PainEvent 16 16
+lit
+align 4
+LABELV $715
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_EntityEvent
+code
+proc CG_EntityEvent 140 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRGP4 $573
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $570
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $574
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $569
+ADDRGP4 $579
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $574
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $582
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $580
+LABELV $582
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $580
+ADDRLP4 12
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $584
+ADDRLP4 8
+INDIRI4
+CNSTI4 82
+GTI4 $584
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1388-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1388
+address $586
+address $596
+address $607
+address $618
+address $629
+address $680
+address $680
+address $680
+address $680
+address $640
+address $654
+address $666
+address $710
+address $722
+address $769
+address $776
+address $783
+address $790
+address $796
+address $831
+address $845
+address $853
+address $860
+address $865
+address $870
+address $875
+address $880
+address $885
+address $890
+address $895
+address $900
+address $905
+address $910
+address $915
+address $920
+address $925
+address $930
+address $935
+address $584
+address $967
+address $960
+address $940
+address $950
+address $978
+address $1153
+address $1162
+address $1173
+address $1127
+address $1114
+address $1052
+address $1057
+address $1062
+address $1067
+address $1140
+address $584
+address $1300
+address $1308
+address $1308
+address $1308
+address $1317
+address $1322
+address $1335
+address $1348
+address $1361
+address $1047
+address $989
+address $1004
+address $1011
+address $1016
+address $1024
+address $1029
+address $1037
+address $1042
+address $1378
+address $1373
+address $727
+address $733
+address $739
+address $745
+address $751
+address $757
+address $763
+code
+LABELV $586
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $590
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $587
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cgs+180272+824
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $596
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $597
+ADDRGP4 $600
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $597
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $607
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRGP4 $611
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $608
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $618
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRGP4 $622
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $619
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $629
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $630
+ADDRGP4 $633
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $630
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $640
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $641
+ADDRGP4 $644
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $641
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1096
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $585
+ADDRGP4 cg+109144
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 cg+109148
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $654
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $655
+ADDRGP4 $658
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $655
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $561
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $585
+ADDRGP4 cg+109144
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+109148
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $666
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $667
+ADDRGP4 $670
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $667
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $585
+ADDRGP4 cg+109144
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+109148
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $680
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $681
+ADDRGP4 $684
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $681
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $685
+ADDRGP4 $585
+JUMPV
+LABELV $685
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $697
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 60
+INDIRI4
+NEI4 $697
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $697
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $689
+LABELV $697
+ADDRGP4 $585
+JUMPV
+LABELV $689
+ADDRLP4 48
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109132
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 200
+GEI4 $700
+ADDRLP4 52
+ADDRGP4 cg+109128
+INDIRF4
+CNSTI4 200
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $701
+JUMPV
+LABELV $700
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $701
+ADDRLP4 56
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 cg+109128
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109128
+INDIRF4
+CNSTF4 1107296256
+LEF4 $704
+ADDRGP4 cg+109128
+CNSTF4 1107296256
+ASGNF4
+LABELV $704
+ADDRGP4 cg+109132
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $710
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRGP4 $714
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $711
+ADDRLP4 48
+ADDRGP4 $715
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 48
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+180272+340
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+180272+1104
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $721
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $722
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRGP4 $726
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $723
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $721
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $727
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRGP4 $731
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $728
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $733
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRGP4 $737
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $734
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $738
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $739
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRGP4 $743
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $740
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $744
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $745
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $746
+ADDRGP4 $749
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $746
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $750
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $751
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $752
+ADDRGP4 $755
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $752
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $756
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $757
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $758
+ADDRGP4 $761
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $758
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $762
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $763
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $764
+ADDRGP4 $767
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $764
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 53
+ARGI4
+ADDRGP4 $768
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $769
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $770
+ADDRGP4 $773
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $770
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1244
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $776
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $777
+ADDRGP4 $780
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $777
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1248
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $783
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $784
+ADDRGP4 $787
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $784
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1252
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $790
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $791
+ADDRGP4 $794
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $791
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $795
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $796
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $797
+ADDRGP4 $800
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $797
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $803
+ADDRLP4 72
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $801
+LABELV $803
+ADDRGP4 $585
+JUMPV
+LABELV $801
+ADDRLP4 68
+CNSTI4 52
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 68
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 5
+EQI4 $806
+ADDRLP4 76
+INDIRI4
+CNSTI4 8
+NEI4 $804
+LABELV $806
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1464
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $805
+JUMPV
+LABELV $804
+ADDRLP4 68
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $809
+ADDRLP4 80
+ADDRLP4 68
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 10
+LTI4 $810
+ADDRLP4 80
+INDIRI4
+CNSTI4 13
+GTI4 $810
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $826-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $826
+address $814
+address $817
+address $820
+address $823
+code
+LABELV $814
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1440
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $810
+JUMPV
+LABELV $817
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1436
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $810
+JUMPV
+LABELV $820
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1432
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $810
+JUMPV
+LABELV $823
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1428
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $810
+JUMPV
+LABELV $809
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $810
+LABELV $805
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $585
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $831
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $832
+ADDRGP4 $835
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $832
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $838
+ADDRLP4 72
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $836
+LABELV $838
+ADDRGP4 $585
+JUMPV
+LABELV $836
+ADDRLP4 68
+CNSTI4 52
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $839
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $839
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $585
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $845
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $846
+ADDRGP4 $849
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $846
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $585
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $853
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $854
+ADDRGP4 $857
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $854
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+812
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $860
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $861
+ADDRGP4 $864
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $865
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $866
+ADDRGP4 $869
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $866
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $870
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $871
+ADDRGP4 $874
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $875
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $876
+ADDRGP4 $879
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $880
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $881
+ADDRGP4 $884
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $881
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $885
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $886
+ADDRGP4 $889
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $886
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $890
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $891
+ADDRGP4 $894
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $895
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $896
+ADDRGP4 $899
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $896
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $900
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $901
+ADDRGP4 $904
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $901
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $905
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $906
+ADDRGP4 $909
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $906
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $910
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $911
+ADDRGP4 $914
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $911
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $915
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $916
+ADDRGP4 $919
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $916
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $920
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $921
+ADDRGP4 $924
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $921
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $925
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $926
+ADDRGP4 $929
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $926
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $930
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $931
+ADDRGP4 $934
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $931
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $935
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $936
+ADDRGP4 $939
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $936
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $940
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $941
+ADDRGP4 $944
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $941
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1076
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $947
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $947
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $950
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $951
+ADDRGP4 $954
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $951
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1080
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $957
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $957
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $960
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $961
+ADDRGP4 $964
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $961
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1088
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $967
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRGP4 $971
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1088
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+CNSTI4 41
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $978
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRGP4 $982
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $979
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $983
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1468
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $983
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1472
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $989
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $990
+ADDRGP4 $993
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $990
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $994
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1476
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $994
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $998
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1480
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $998
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1484
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1004
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1005
+ADDRGP4 $1008
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1005
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+1488
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1011
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1012
+ADDRGP4 $1015
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1012
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_KamikazeEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1016
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1017
+ADDRGP4 $1020
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1017
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $1021
+CNSTI4 17
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ObeliskExplode
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1024
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1025
+ADDRGP4 $1028
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1025
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_ObeliskPain
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1029
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+ADDRGP4 $1033
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1030
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $1034
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1034
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 CG_InvulnerabilityImpact
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1037
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1038
+ADDRGP4 $1041
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1038
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_InvulnerabilityJuiced
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1042
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1043
+ADDRGP4 $1046
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1043
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_LightningBoltBeam
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1047
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+ADDRGP4 $1051
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1052
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1053
+ADDRGP4 $1056
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1053
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1057
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1058
+ADDRGP4 $1061
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1058
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1062
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1063
+ADDRGP4 $1066
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1063
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1067
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1068
+ADDRGP4 $1071
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1068
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1072
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181764
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1072
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 108
+INDIRI4
+NEI4 $1079
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1072
+LABELV $1079
+ADDRGP4 $585
+JUMPV
+LABELV $1072
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1080
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1080
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+NEI4 $1084
+ADDRLP4 112
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1085
+JUMPV
+LABELV $1084
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+NEI4 $1098
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1098
+LABELV $1085
+LABELV $1080
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $585
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1114
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+ADDRGP4 $1118
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1115
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1119
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181764
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $1119
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 112
+INDIRI4
+NEI4 $1126
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 112
+INDIRI4
+EQI4 $1119
+LABELV $1126
+ADDRGP4 $585
+JUMPV
+LABELV $1119
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1022
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1127
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1128
+ADDRGP4 $1131
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1128
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1132
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181764
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1132
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 116
+INDIRI4
+NEI4 $1139
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1132
+LABELV $1139
+ADDRGP4 $585
+JUMPV
+LABELV $1132
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1140
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1141
+ADDRGP4 $1144
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1141
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1145
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181764
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1145
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 120
+INDIRI4
+NEI4 $1152
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1145
+LABELV $1152
+ADDRGP4 $585
+JUMPV
+LABELV $1145
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1153
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1154
+ADDRGP4 $1157
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1154
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1158
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1158
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1162
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1163
+ADDRGP4 $1166
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1163
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1167
+CNSTP4 0
+ARGP4
+ADDRLP4 124
+CNSTI4 184
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1167
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1173
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1174
+ADDRGP4 $1177
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1174
+ADDRLP4 124
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+LTI4 $585
+ADDRLP4 124
+INDIRI4
+CNSTI4 13
+GTI4 $585
+ADDRLP4 124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1299
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1299
+address $1181
+address $1189
+address $1197
+address $1207
+address $1217
+address $1243
+address $1269
+address $1275
+address $1281
+address $1284
+address $1287
+address $1290
+address $1293
+address $1296
+code
+LABELV $1181
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1182
+ADDRGP4 cgs+180272+1292
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1182
+ADDRGP4 cgs+180272+1296
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1189
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1190
+ADDRGP4 cgs+180272+1292
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1190
+ADDRGP4 cgs+180272+1296
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1197
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1198
+ADDRGP4 cgs+180272+1300
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1199
+JUMPV
+LABELV $1198
+ADDRGP4 cgs+180272+1304
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $1199
+ADDRGP4 cgs+180272+1320
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1207
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1208
+ADDRGP4 cgs+180272+1300
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $1209
+JUMPV
+LABELV $1208
+ADDRGP4 cgs+180272+1304
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $1209
+ADDRGP4 cgs+180272+1316
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1217
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $1222
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $1218
+LABELV $1222
+ADDRGP4 $585
+JUMPV
+LABELV $1218
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1223
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1226
+ADDRGP4 cgs+180272+1340
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1226
+ADDRGP4 cgs+180272+1328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1223
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $585
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1236
+ADDRGP4 cgs+180272+1332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1236
+ADDRGP4 cgs+180272+1336
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1243
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+NEI4 $1248
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+EQI4 $1244
+LABELV $1248
+ADDRGP4 $585
+JUMPV
+LABELV $1244
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1249
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1252
+ADDRGP4 cgs+180272+1340
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1252
+ADDRGP4 cgs+180272+1328
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1249
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $585
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $1262
+ADDRGP4 cgs+180272+1332
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1262
+ADDRGP4 cgs+180272+1336
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1269
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $585
+ADDRGP4 cgs+180272+1348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1275
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $585
+ADDRGP4 cgs+180272+1348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1281
+ADDRGP4 cgs+180272+1272
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1284
+ADDRGP4 cgs+180272+1276
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1287
+ADDRGP4 cgs+180272+1280
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1290
+ADDRGP4 cgs+180272+1284
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1293
+ADDRGP4 cgs+180272+1288
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1296
+ADDRGP4 cgs+180272+1008
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1300
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1301
+ADDRGP4 $1304
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1301
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1308
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1309
+ADDRGP4 $1312
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1309
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+LTI4 $1313
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $1315
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1313
+ADDRGP4 $1316
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1317
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1318
+ADDRGP4 $1321
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1318
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1322
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1323
+ADDRGP4 $1326
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1323
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1327
+ADDRGP4 cg+125000
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+125004
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1327
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+804
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1335
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1336
+ADDRGP4 $1339
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1336
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1340
+ADDRGP4 cg+125000
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+125004
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1340
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+1460
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1348
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1349
+ADDRGP4 $1352
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1349
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1353
+ADDRGP4 cg+125000
+CNSTI4 5
+ASGNI4
+ADDRGP4 cg+125004
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1353
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+1456
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1361
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1362
+ADDRGP4 $1365
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1362
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $1366
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+180272+1060
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1366
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+CNSTI4 16
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $1373
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1374
+ADDRGP4 $1377
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1374
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $1378
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1379
+ADDRGP4 $1382
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $1383
+ADDRGP4 $1386
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1383
+ADDRGP4 $1387
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $585
+LABELV $569
+endproc CG_EntityEvent 140 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $1391
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1393
+ADDRGP4 $1390
+JUMPV
+LABELV $1393
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1395
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1395
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+ASGNI4
+ADDRGP4 $1392
+JUMPV
+LABELV $1391
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+NEI4 $1397
+ADDRGP4 $1390
+JUMPV
+LABELV $1397
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $1399
+ADDRGP4 $1390
+JUMPV
+LABELV $1399
+LABELV $1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $1390
+endproc CG_CheckEvents 8 12
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1387
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1386
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1382
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1377
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1365
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $1352
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1339
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1326
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1321
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $1316
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1315
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1312
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $1304
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1177
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1166
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1157
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1144
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1131
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $1118
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1071
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1066
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $1061
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $1056
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1051
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $1046
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1041
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $1033
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 85
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $1028
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $1020
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1015
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $1008
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $993
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 10
+byte 1 0
+align 1
+LABELV $982
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $971
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $964
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $954
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $944
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $939
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $934
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $929
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $924
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $919
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $914
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 10
+byte 1 0
+align 1
+LABELV $909
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 10
+byte 1 0
+align 1
+LABELV $904
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $899
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 10
+byte 1 0
+align 1
+LABELV $894
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $889
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $884
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $879
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $874
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $869
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $864
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $857
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $849
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $835
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $800
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $795
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $794
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $787
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $780
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $773
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $768
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $767
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $762
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $761
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 68
+byte 1 66
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $756
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $755
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 70
+byte 1 76
+byte 1 65
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $750
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $749
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 76
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 77
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $744
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $743
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $738
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $737
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 89
+byte 1 69
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $732
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $731
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $726
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $721
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $714
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $684
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $671
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $670
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $658
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $633
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $622
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $611
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $600
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $590
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $579
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $573
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $567
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $566
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $561
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $560
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $557
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $554
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $474
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 0
+align 1
+LABELV $453
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $452
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $442
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $426
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $420
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $406
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $400
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $391
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $388
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $384
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $383
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $379
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $375
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $371
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $367
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $363
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $362
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $358
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $354
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $353
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $349
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 77
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $348
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $344
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $343
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $339
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $335
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $334
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $330
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $326
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $319
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $318
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $314
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $310
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $306
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $305
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $301
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $300
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $296
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $292
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $288
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $284
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $273
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $264
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $263
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 94
+byte 1 49
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $258
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $251
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $237
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $224
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $221
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $216
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $215
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $212
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $206
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $202
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $201
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $198
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $192
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $191
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $188
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $182
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $181
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $178
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $172
+byte 1 103
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $160
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $156
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $152
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $148
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $140
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $132
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $124
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $123
+byte 1 110
+byte 1 0
+align 1
+LABELV $116
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $107
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $104
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $101
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $98
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $95
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $92
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $89
+byte 1 94
+byte 1 51
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $86
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $83
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $80
+byte 1 0
+align 1
+LABELV $79
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
@@ -0,0 +1,26619 @@
+data
+export forceModelModificationCount
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $85
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $85
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $101
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $101
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $99
+code
+LABELV $87
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $88
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $89
+ADDRLP4 4
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $90
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+ADDRGP4 CG_FairCvars
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $91
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $92
+ADDRLP4 12
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $93
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $94
+ADDRGP4 cgDC+216
+ADDRGP4 cgs+178804
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+220
+ADDRGP4 cgs+178808
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $99
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRGP4 $100
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $86
+CNSTI4 -1
+RETI4
+LABELV $84
+endproc vmMain 16 12
+data
+align 4
+LABELV cvarTable
+address cg_ignore
+address $103
+address $104
+byte 4 0
+address cg_autoswitch
+address $105
+address $106
+byte 4 1
+address cg_drawGun
+address $107
+address $106
+byte 4 1
+address cg_zoomFov
+address $108
+address $109
+byte 4 1
+address cg_fov
+address $110
+address $111
+byte 4 1
+address cg_viewsize
+address $112
+address $113
+byte 4 1
+address cg_shadows
+address $114
+address $106
+byte 4 1
+address cg_gibs
+address $115
+address $106
+byte 4 1
+address cg_draw2D
+address $116
+address $106
+byte 4 1
+address cg_drawStatus
+address $117
+address $106
+byte 4 1
+address cg_drawTimer
+address $118
+address $104
+byte 4 1
+address cg_drawFPS
+address $119
+address $104
+byte 4 1
+address cg_drawSnapshot
+address $120
+address $104
+byte 4 1
+address cg_draw3dIcons
+address $121
+address $106
+byte 4 1
+address cg_drawIcons
+address $122
+address $106
+byte 4 1
+address cg_drawAmmoWarning
+address $123
+address $106
+byte 4 1
+address cg_drawAttacker
+address $124
+address $106
+byte 4 1
+address cg_drawSpeed
+address $125
+address $104
+byte 4 1
+address cg_drawCrosshair
+address $126
+address $127
+byte 4 1
+address cg_drawCrosshairNames
+address $128
+address $106
+byte 4 1
+address cg_drawRewards
+address $129
+address $106
+byte 4 1
+address cg_crosshairSize
+address $130
+address $131
+byte 4 1
+address cg_crosshairHealth
+address $132
+address $106
+byte 4 1
+address cg_crosshairX
+address $133
+address $104
+byte 4 1
+address cg_crosshairY
+address $134
+address $104
+byte 4 1
+address cg_brassTime
+address $135
+address $136
+byte 4 1
+address cg_simpleItems
+address $137
+address $104
+byte 4 1
+address cg_addMarks
+address $138
+address $106
+byte 4 1
+address cg_lagometer
+address $139
+address $106
+byte 4 1
+address cg_railTrailTime
+address $140
+address $141
+byte 4 1
+address cg_gun_x
+address $142
+address $104
+byte 4 512
+address cg_gun_y
+address $143
+address $104
+byte 4 512
+address cg_gun_z
+address $144
+address $104
+byte 4 512
+address cg_centertime
+address $145
+address $146
+byte 4 512
+address cg_runpitch
+address $147
+address $148
+byte 4 1
+address cg_runroll
+address $149
+address $150
+byte 4 1
+address cg_bob
+address $151
+address $106
+byte 4 1
+address cg_bobup
+address $152
+address $150
+byte 4 512
+address cg_bobpitch
+address $153
+address $148
+byte 4 1
+address cg_bobroll
+address $154
+address $148
+byte 4 1
+address cg_bobmodel
+address $155
+address $104
+byte 4 1
+address cg_kickScale
+address $156
+address $157
+byte 4 1
+address cg_swingSpeed
+address $158
+address $159
+byte 4 512
+address cg_animSpeed
+address $160
+address $106
+byte 4 512
+address cg_debugAnim
+address $161
+address $104
+byte 4 512
+address cg_debugPosition
+address $162
+address $104
+byte 4 512
+address cg_debugEvents
+address $163
+address $104
+byte 4 512
+address cg_errorDecay
+address $164
+address $113
+byte 4 0
+address cg_nopredict
+address $165
+address $104
+byte 4 0
+address cg_noPlayerAnims
+address $166
+address $104
+byte 4 512
+address cg_showmiss
+address $167
+address $104
+byte 4 0
+address cg_footsteps
+address $168
+address $106
+byte 4 512
+address cg_tracerChance
+address $169
+address $170
+byte 4 512
+address cg_tracerWidth
+address $171
+address $106
+byte 4 512
+address cg_tracerLength
+address $172
+address $113
+byte 4 512
+address cg_thirdPersonRange
+address $173
+address $174
+byte 4 512
+address cg_thirdPersonAngle
+address $175
+address $104
+byte 4 512
+address cg_thirdPerson
+address $176
+address $104
+byte 4 0
+address cg_teamChatTime
+address $177
+address $178
+byte 4 1
+address cg_teamChatHeight
+address $179
+address $104
+byte 4 1
+address cg_forceModel
+address $180
+address $104
+byte 4 1
+address cg_predictItems
+address $181
+address $106
+byte 4 1
+address cg_deferPlayers
+address $182
+address $104
+byte 4 1
+address cg_drawTeamOverlay
+address $183
+address $104
+byte 4 1
+address cg_teamOverlayUserinfo
+address $184
+address $104
+byte 4 66
+address cg_stats
+address $185
+address $104
+byte 4 0
+address cg_drawFriend
+address $186
+address $106
+byte 4 1
+address cg_teamChatsOnly
+address $187
+address $104
+byte 4 1
+address cg_noVoiceChats
+address $188
+address $104
+byte 4 1
+address cg_noVoiceText
+address $189
+address $104
+byte 4 1
+address cg_buildScript
+address $190
+address $104
+byte 4 0
+address cg_paused
+address $191
+address $104
+byte 4 64
+address cg_blood
+address $192
+address $106
+byte 4 1
+address cg_alwaysWeaponBar
+address $193
+address $104
+byte 4 1
+address cg_hitsound
+address $194
+address $104
+byte 4 1
+address cg_voip_teamonly
+address $195
+address $106
+byte 4 1
+address cg_voteflags
+address $196
+address $197
+byte 4 64
+address cg_cyclegrapple
+address $198
+address $106
+byte 4 1
+address cg_vote_custom_commands
+address $199
+address $200
+byte 4 64
+address cg_synchronousClients
+address $201
+address $104
+byte 4 8
+address cg_autovertex
+address $202
+address $104
+byte 4 1
+address cg_redTeamName
+address $203
+address $204
+byte 4 7
+address cg_blueTeamName
+address $205
+address $206
+byte 4 7
+address cg_currentSelectedPlayer
+address $207
+address $104
+byte 4 1
+address cg_currentSelectedPlayerName
+address $208
+address $200
+byte 4 1
+address cg_singlePlayer
+address $209
+address $104
+byte 4 2
+address cg_singlePlayerActive
+address $209
+address $104
+byte 4 2
+address cg_recordSPDemo
+address $210
+address $104
+byte 4 1
+address cg_recordSPDemoName
+address $211
+address $200
+byte 4 1
+address cg_hudFiles
+address $212
+address $213
+byte 4 1
+address cg_enableFS
+address $214
+address $104
+byte 4 4
+address cg_enableQ
+address $215
+address $104
+byte 4 4
+address cg_enableDust
+address $216
+address $104
+byte 4 4
+address cg_enableBreath
+address $217
+address $104
+byte 4 4
+address cg_obeliskRespawnDelay
+address $218
+address $219
+byte 4 4
+address cg_cameraOrbit
+address $220
+address $104
+byte 4 512
+address cg_cameraOrbitDelay
+address $221
+address $222
+byte 4 1
+address cg_timescaleFadeEnd
+address $223
+address $106
+byte 4 0
+address cg_timescaleFadeSpeed
+address $224
+address $104
+byte 4 0
+address cg_timescale
+address $225
+address $106
+byte 4 0
+address cg_scorePlum
+address $226
+address $106
+byte 4 3
+address cg_obituaryOutput
+address $227
+address $146
+byte 4 1
+address pmove_fixed
+address $228
+address $104
+byte 4 8
+address pmove_msec
+address $229
+address $230
+byte 4 8
+address pmove_float
+address $231
+address $106
+byte 4 8
+address cg_noTaunt
+address $232
+address $104
+byte 4 1
+address cg_noProjectileTrail
+address $233
+address $104
+byte 4 1
+address cg_smallFont
+address $234
+address $235
+byte 4 1
+address cg_bigFont
+address $236
+address $170
+byte 4 1
+address cg_oldRail
+address $237
+address $104
+byte 4 1
+address cg_oldRocket
+address $238
+address $106
+byte 4 1
+address cg_leiEnhancement
+address $239
+address $104
+byte 4 1
+address cg_leiGoreNoise
+address $240
+address $104
+byte 4 1
+address cg_leiBrassNoise
+address $241
+address $104
+byte 4 1
+address cg_leiSuperGoreyAwesome
+address $242
+address $104
+byte 4 1
+address cg_leiDebug
+address $243
+address $104
+byte 4 1
+address cg_leiChibi
+address $244
+address $104
+byte 4 512
+address cg_leiWidescreen
+address $245
+address $106
+byte 4 1
+address cg_deathcam
+address $246
+address $106
+byte 4 1
+address cg_cameramode
+address $247
+address $104
+byte 4 1
+address cg_cameraEyes
+address $248
+address $104
+byte 4 1
+address cg_cameraEyes_Fwd
+address $249
+address $146
+byte 4 512
+address cg_cameraEyes_Up
+address $250
+address $146
+byte 4 512
+address cg_modelEyes_Up
+address $251
+address $146
+byte 4 1
+address cg_modelEyes_Right
+address $252
+address $146
+byte 4 1
+address cg_modelEyes_Fwd
+address $253
+address $146
+byte 4 1
+address cg_oldPlasma
+address $254
+address $106
+byte 4 1
+address cg_delag
+address $255
+address $106
+byte 4 3
+address cg_cmdTimeNudge
+address $256
+address $104
+byte 4 3
+address sv_fps
+address $257
+address $258
+byte 4 8
+address cg_projectileNudge
+address $259
+address $104
+byte 4 1
+address cg_optimizePrediction
+address $260
+address $106
+byte 4 1
+address cl_timeNudge
+address $261
+address $104
+byte 4 1
+address cg_trueLightning
+address $262
+address $263
+byte 4 1
+address cg_music
+address $264
+address $200
+byte 4 1
+address cg_fragmsgsize
+address $265
+address $157
+byte 4 1
+address cg_crosshairPulse
+address $266
+address $106
+byte 4 1
+address cg_differentCrosshairs
+address $267
+address $104
+byte 4 1
+address cg_ch1
+address $268
+address $106
+byte 4 1
+address cg_ch1size
+address $269
+address $131
+byte 4 1
+address cg_ch2
+address $270
+address $106
+byte 4 1
+address cg_ch2size
+address $271
+address $131
+byte 4 1
+address cg_ch3
+address $272
+address $106
+byte 4 1
+address cg_ch3size
+address $273
+address $131
+byte 4 1
+address cg_ch4
+address $274
+address $106
+byte 4 1
+address cg_ch4size
+address $275
+address $131
+byte 4 1
+address cg_ch5
+address $276
+address $106
+byte 4 1
+address cg_ch5size
+address $277
+address $131
+byte 4 1
+address cg_ch6
+address $278
+address $106
+byte 4 1
+address cg_ch6size
+address $279
+address $131
+byte 4 1
+address cg_ch7
+address $280
+address $106
+byte 4 1
+address cg_ch7size
+address $281
+address $131
+byte 4 1
+address cg_ch8
+address $282
+address $106
+byte 4 1
+address cg_ch8size
+address $283
+address $131
+byte 4 1
+address cg_ch9
+address $284
+address $106
+byte 4 1
+address cg_ch9size
+address $285
+address $131
+byte 4 1
+address cg_ch10
+address $286
+address $106
+byte 4 1
+address cg_ch10size
+address $287
+address $131
+byte 4 1
+address cg_ch11
+address $288
+address $106
+byte 4 1
+address cg_ch11size
+address $289
+address $131
+byte 4 1
+address cg_ch12
+address $290
+address $106
+byte 4 1
+address cg_ch12size
+address $291
+address $131
+byte 4 1
+address cg_ch13
+address $292
+address $106
+byte 4 1
+address cg_ch13size
+address $293
+address $131
+byte 4 1
+address cg_crosshairColorRed
+address $294
+address $157
+byte 4 1
+address cg_crosshairColorGreen
+address $295
+address $157
+byte 4 1
+address cg_crosshairColorBlue
+address $296
+address $157
+byte 4 1
+address cg_weaponBarStyle
+address $297
+address $104
+byte 4 1
+address cg_weaponOrder
+address $298
+address $299
+byte 4 1
+address cg_chatBeep
+address $300
+address $106
+byte 4 1
+address cg_teamChatBeep
+address $301
+address $106
+byte 4 1
+address cg_muzzleflashStyle
+address $302
+address $106
+byte 4 1
+align 4
+LABELV cvarTableSize
+byte 4 172
+export CG_RegisterCvars
+code
+proc CG_RegisterCvars 1036 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $307
+JUMPV
+LABELV $304
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $305
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $307
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $304
+ADDRGP4 $308
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31452
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $311
+ARGP4
+ADDRGP4 $312
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $313
+ARGP4
+ADDRGP4 $312
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 $315
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $316
+ARGP4
+ADDRGP4 $317
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $303
+endproc CG_RegisterCvars 1036 16
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $319
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $323
+ADDRGP4 $320
+JUMPV
+LABELV $323
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $320
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $319
+LABELV $318
+endproc CG_ForceModelChange 12 4
+export CG_UpdateCvars
+proc CG_UpdateCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $329
+JUMPV
+LABELV $326
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_cmdTimeNudge
+CVPU4 4
+NEU4 $330
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 999
+ARGI4
+ADDRGP4 CG_Cvar_ClampInt
+CALLI4
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 cl_timeNudge
+CVPU4 4
+NEU4 $332
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 -50
+ARGI4
+CNSTI4 50
+ARGI4
+ADDRGP4 CG_Cvar_ClampInt
+CALLI4
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_errorDecay
+CVPU4 4
+NEU4 $334
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 250
+ARGI4
+ADDRGP4 CG_Cvar_ClampInt
+CALLI4
+pop
+LABELV $334
+LABELV $333
+LABELV $331
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $327
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $329
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $326
+ADDRGP4 drawTeamOverlayModificationCount
+INDIRI4
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+EQI4 $336
+ADDRGP4 drawTeamOverlayModificationCount
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+LEI4 $340
+ADDRGP4 $184
+ARGP4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRGP4 $184
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $341
+LABELV $336
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+EQI4 $343
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $343
+LABELV $325
+endproc CG_UpdateCvars 12 16
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 0 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124996
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $348
+CNSTI4 -1
+RETI4
+ADDRGP4 $347
+JUMPV
+LABELV $348
+ADDRGP4 cg+124992
+INDIRI4
+RETI4
+LABELV $347
+endproc CG_CrosshairPlayer 0 0
+export CG_LastAttacker
+proc CG_LastAttacker 0 0
+ADDRGP4 cg+125008
+INDIRI4
+CNSTI4 0
+NEI4 $354
+CNSTI4 -1
+RETI4
+ADDRGP4 $353
+JUMPV
+LABELV $354
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+RETI4
+LABELV $353
+endproc CG_LastAttacker 0 0
+export CG_Printf
+proc CG_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $358
+endproc CG_Printf 1028 16
+export CG_Error
+proc CG_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $360
+endproc CG_Error 1028 16
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $362
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $365
+endproc Com_Printf 1028 16
+bss
+align 1
+LABELV $368
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $368
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $368
+RETP4
+LABELV $367
+endproc CG_Argv 0 12
+proc CG_RegisterItemSounds 96 12
+ADDRLP4 76
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $370
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $370
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $374
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $376
+LABELV $374
+ADDRGP4 $369
+JUMPV
+LABELV $375
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $379
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $378
+LABELV $381
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $384
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $382
+LABELV $384
+ADDRGP4 $385
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $382
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $386
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $386
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+ARGP4
+ADDRGP4 $391
+ARGP4
+ADDRLP4 92
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $388
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $388
+LABELV $376
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $375
+LABELV $369
+endproc CG_RegisterItemSounds 96 12
+proc CG_RegisterSounds 740 16
+ADDRGP4 CG_LoadVoiceChats
+CALLV
+pop
+ADDRGP4 $395
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1144
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $398
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1148
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $401
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1152
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $404
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1164
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $407
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1160
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $410
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1156
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $413
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1356
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $416
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1360
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $419
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1364
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $422
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1368
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $425
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1372
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $428
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1424
+ADDRLP4 376
+INDIRI4
+ASGNI4
+CNSTF4 1051260355
+ARGF4
+ADDRGP4 CG_UpdateSoundFraction
+CALLV
+pop
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $435
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $434
+LABELV $435
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $429
+LABELV $434
+ADDRGP4 $438
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1268
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $441
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1280
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $444
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1284
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1288
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $450
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1180
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $453
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1272
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1276
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $438
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1292
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $461
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1296
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $464
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1300
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $467
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1304
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $470
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1308
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $473
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1312
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $480
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $480
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $474
+LABELV $480
+ADDRGP4 $483
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1316
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $486
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1320
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $489
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1328
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $492
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1336
+ADDRLP4 444
+INDIRI4
+ASGNI4
+LABELV $474
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $497
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $493
+LABELV $497
+ADDRGP4 $467
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1324
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $502
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1340
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $505
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1332
+ADDRLP4 440
+INDIRI4
+ASGNI4
+LABELV $493
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+EQI4 $510
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $506
+LABELV $510
+ADDRGP4 $513
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1348
+ADDRLP4 432
+INDIRI4
+ASGNI4
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 CG_UpdateSoundFraction
+CALLV
+pop
+CNSTF4 1050253722
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+LABELV $506
+LABELV $429
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $524
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $524
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $524
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $524
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $514
+LABELV $524
+ADDRGP4 $527
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1344
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $530
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1352
+ADDRLP4 384
+INDIRI4
+ASGNI4
+LABELV $514
+ADDRGP4 $533
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+808
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $536
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+812
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $539
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+820
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+816
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $545
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1060
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $548
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1064
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $551
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1068
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $554
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1072
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $557
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1108
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1112
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $563
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1116
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $566
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1120
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $569
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1124
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $572
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1128
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $575
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1132
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $578
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1136
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $581
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1140
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $584
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1012
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $587
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1016
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $590
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1020
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $593
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1024
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $596
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1028
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $599
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1428
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $602
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1432
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $605
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1436
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $608
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1440
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $611
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1032
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $614
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1036
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $617
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1040
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $620
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1044
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $623
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1076
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $626
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1080
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $629
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1088
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $632
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1084
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $635
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1092
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $638
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1096
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 cg_hitsound+12
+INDIRI4
+CNSTI4 0
+EQI4 $642
+ADDRGP4 $639
+JUMPV
+LABELV $642
+LABELV $639
+ADDRGP4 $645
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1168
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $648
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1172
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1176
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 532
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1184
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $657
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 536
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1188
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 540
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1192
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $663
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 544
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1196
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $666
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 548
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1200
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $669
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 552
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1204
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $672
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 556
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1208
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $675
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 560
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1212
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $678
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 564
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1216
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $681
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 568
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1220
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 $684
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 572
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1224
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 $687
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1228
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $690
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1232
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $693
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1236
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $696
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1240
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $699
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1244
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 $702
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1248
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $705
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1252
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $708
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1104
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $709
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $713
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 608
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824
+ADDP4
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $716
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+16
+ADDP4
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $720
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+32
+ADDP4
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $724
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 620
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+48
+ADDP4
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $728
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+64
+ADDP4
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 628
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+96
+ADDP4
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $736
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 632
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+824+80
+ADDP4
+ADDRLP4 632
+INDIRI4
+ASGNI4
+LABELV $710
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $709
+CNSTI4 27
+ARGI4
+ADDRLP4 608
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $743
+JUMPV
+LABELV $740
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $741
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $743
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $740
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $744
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 612
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $748
+ADDRGP4 $746
+JUMPV
+LABELV $748
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $750
+ADDRGP4 $745
+JUMPV
+LABELV $750
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032
+ADDP4
+ADDRLP4 616
+INDIRI4
+ASGNI4
+LABELV $745
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $744
+LABELV $746
+CNSTF4 1062836634
+ARGF4
+ADDRGP4 CG_UpdateSoundFraction
+CALLV
+pop
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 $755
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1256
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $758
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1260
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $761
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 620
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+804
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $764
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+948
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $767
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 628
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+952
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $770
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 632
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+956
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $773
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+960
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $776
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+964
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $779
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 644
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+968
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $782
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 648
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+972
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 $785
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 652
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+976
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRGP4 $788
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 656
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+980
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRGP4 $791
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 660
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+984
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 $794
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 664
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+988
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $797
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 668
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+992
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRGP4 $800
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 672
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+996
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRGP4 $803
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 676
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1264
+ADDRLP4 676
+INDIRI4
+ASGNI4
+ADDRGP4 $806
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 680
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1000
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $809
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 684
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1004
+ADDRLP4 684
+INDIRI4
+ASGNI4
+ADDRGP4 $812
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 688
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1008
+ADDRLP4 688
+INDIRI4
+ASGNI4
+ADDRGP4 $815
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 692
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1048
+ADDRLP4 692
+INDIRI4
+ASGNI4
+ADDRGP4 $818
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 696
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1052
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRGP4 $821
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 700
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1056
+ADDRLP4 700
+INDIRI4
+ASGNI4
+ADDRGP4 $824
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 704
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1476
+ADDRLP4 704
+INDIRI4
+ASGNI4
+ADDRGP4 $827
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 708
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1480
+ADDRLP4 708
+INDIRI4
+ASGNI4
+ADDRGP4 $830
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 712
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1484
+ADDRLP4 712
+INDIRI4
+ASGNI4
+ADDRGP4 $833
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 716
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1488
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 $836
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 720
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1456
+ADDRLP4 720
+INDIRI4
+ASGNI4
+ADDRGP4 $839
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 724
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1460
+ADDRLP4 724
+INDIRI4
+ASGNI4
+ADDRGP4 $842
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 728
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1464
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRGP4 $845
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 732
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1468
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRGP4 $848
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 736
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1472
+ADDRLP4 736
+INDIRI4
+ASGNI4
+ADDRGP4 $849
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $850
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $851
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $852
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $853
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $854
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $855
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $856
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $857
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $858
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $859
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $860
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $861
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $862
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $863
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $864
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $865
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $866
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $867
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $868
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $869
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $870
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $871
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+ADDRGP4 $872
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $392
+endproc CG_RegisterSounds 740 16
+data
+align 4
+LABELV $874
+address $875
+address $876
+address $877
+address $878
+address $879
+address $880
+address $881
+address $882
+address $883
+address $884
+address $885
+code
+proc CG_RegisterGraphics 796 16
+ADDRGP4 cg+109252
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $890
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $891
+ADDRLP4 264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 $874
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 cgs+180272+452
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $892
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $891
+ADDRGP4 $899
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $903
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $907
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+8
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $911
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+12
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $915
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+500+16
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $918
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+280
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+196
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+704
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $927
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+708
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $930
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+712
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $933
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+716
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+340
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $939
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+344
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $942
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+348
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $945
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+444
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $948
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+448
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $951
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+352
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $954
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+360
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $957
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+328
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $960
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+272
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $963
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+356
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $966
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+284
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+276
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $972
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+744
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $975
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+748
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $978
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+752
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $981
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+756
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $984
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+760
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $987
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+764
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $990
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+768
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $993
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+772
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $996
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+776
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $999
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+780
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $1002
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+784
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1005
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+788
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1008
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+792
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1011
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+796
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1014
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+800
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1015
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GEI4 $1019
+ADDRGP4 $1023
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1020
+JUMPV
+LABELV $1019
+ADDRGP4 $1026
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+SUBI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+288
+ADDP4
+ADDRLP4 436
+INDIRI4
+ASGNI4
+LABELV $1020
+LABELV $1016
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $1015
+ADDRGP4 $1029
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+332
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1032
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+336
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1035
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+544
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1038
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+552
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1041
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+564
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1044
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+568
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1047
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+556
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1050
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+560
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $1053
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+572
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $1064
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $1064
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $1064
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $1064
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1054
+LABELV $1064
+ADDRGP4 $1067
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+20
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1070
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+24
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1014
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+28
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+32
+ADDRLP4 464
+INDIRI4
+ASGNI4
+LABELV $1054
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1076
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $1076
+ADDRGP4 $1082
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+588
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1085
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+592
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1076
+ADDRGP4 $1088
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+584
+ADDRLP4 452
+INDIRI4
+ASGNI4
+LABELV $1077
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $1089
+ADDRGP4 $1095
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88+4
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1099
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88+8
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1102
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1032
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+88+12
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1109
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104+4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1113
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104+8
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1116
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1032
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+104+12
+ADDRLP4 480
+INDIRI4
+ASGNI4
+LABELV $1089
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $1132
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $1132
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $1132
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $1132
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $1132
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+LABELV $1132
+ADDRGP4 $1135
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+36
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1138
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+40
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1141
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+44
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1144
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+48
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1148
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+48+4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1152
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+48+8
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1155
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+60
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1159
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+60+4
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1163
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+60+8
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1166
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+120
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1169
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+124
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $1172
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+128
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $1175
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+132
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1178
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+136
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1181
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+140
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $1184
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+144
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $1187
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+148
+ADDRLP4 516
+INDIRI4
+ASGNI4
+LABELV $1120
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $1194
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $1194
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1188
+LABELV $1194
+ADDRGP4 $1141
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+44
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1199
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1148
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72+4
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1159
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72+8
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+72+12
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1188
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+EQI4 $1214
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1210
+LABELV $1214
+ADDRGP4 $1217
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+624
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1220
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+152
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1223
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+156
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1226
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+160
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1229
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+164
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1210
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $1234
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1230
+LABELV $1234
+ADDRGP4 $1237
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+168
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1240
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+172
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1243
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+176
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1246
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+180
+ADDRLP4 464
+INDIRI4
+ASGNI4
+LABELV $1230
+ADDRGP4 $1249
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+576
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1053
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+692
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1258
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $1257
+LABELV $1258
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1252
+LABELV $1257
+ADDRGP4 $1261
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+264
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1264
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+548
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1267
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+580
+ADDRLP4 468
+INDIRI4
+ASGNI4
+LABELV $1252
+ADDRGP4 $1270
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+192
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+184
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1276
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+188
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1279
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+244
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1282
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+248
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1285
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+200
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+204
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1291
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+208
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1294
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+212
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $1297
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+216
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $1300
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+220
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1303
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+224
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1306
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+228
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $1309
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+232
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $1312
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+236
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $1282
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+240
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $1317
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+268
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $1320
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+636
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $1323
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+596
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $1326
+ARGP4
+ADDRLP4 536
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+600
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $1329
+ARGP4
+ADDRLP4 540
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+604
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $1332
+ARGP4
+ADDRLP4 544
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+640
+ADDRLP4 544
+INDIRI4
+ASGNI4
+CNSTF4 1045220557
+ARGF4
+ADDRGP4 CG_UpdateGraphicFraction
+CALLV
+pop
+CNSTF4 1059648963
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 $1335
+ARGP4
+ADDRLP4 548
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+648
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $1338
+ARGP4
+ADDRLP4 552
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+652
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $1341
+ARGP4
+ADDRLP4 556
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+656
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $1344
+ARGP4
+ADDRLP4 560
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+660
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $1347
+ARGP4
+ADDRLP4 564
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+664
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $1350
+ARGP4
+ADDRLP4 568
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+668
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 $1353
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+672
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 $1356
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+676
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $1359
+ARGP4
+ADDRLP4 580
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+680
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $1362
+ARGP4
+ADDRLP4 584
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+684
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $1365
+ARGP4
+ADDRLP4 588
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+688
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $1368
+ARGP4
+ADDRLP4 592
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+696
+ADDRLP4 592
+INDIRI4
+ASGNI4
+CNSTF4 1060320051
+ARGF4
+ADDRGP4 CG_UpdateGraphicFraction
+CALLV
+pop
+CNSTF4 1062836634
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 $1371
+ARGP4
+ADDRLP4 596
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+700
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $1374
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+720
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $1377
+ARGP4
+ADDRLP4 604
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+724
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $1380
+ARGP4
+ADDRLP4 608
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+728
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $1383
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+732
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $1386
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+736
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $1389
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+740
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $1392
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+364
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $1395
+ARGP4
+ADDRLP4 628
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+368
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $1398
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+372
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $1401
+ARGP4
+ADDRLP4 636
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+376
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $1404
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+388
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $1407
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+392
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $1410
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+396
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 $1413
+ARGP4
+ADDRLP4 652
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+380
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRGP4 $1416
+ARGP4
+ADDRLP4 656
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+384
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRGP4 $1419
+ARGP4
+ADDRLP4 660
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+400
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 $1422
+ARGP4
+ADDRLP4 664
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+404
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $1425
+ARGP4
+ADDRLP4 668
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+412
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRGP4 $1428
+ARGP4
+ADDRLP4 672
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+416
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRGP4 $1431
+ARGP4
+ADDRLP4 676
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+420
+ADDRLP4 676
+INDIRI4
+ASGNI4
+ADDRGP4 $1434
+ARGP4
+ADDRLP4 680
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+424
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $1437
+ARGP4
+ADDRLP4 684
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+428
+ADDRLP4 684
+INDIRI4
+ASGNI4
+ADDRGP4 $1440
+ARGP4
+ADDRLP4 688
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+432
+ADDRLP4 688
+INDIRI4
+ASGNI4
+ADDRGP4 $1443
+ARGP4
+ADDRLP4 692
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+436
+ADDRLP4 692
+INDIRI4
+ASGNI4
+ADDRGP4 $1446
+ARGP4
+ADDRLP4 696
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+440
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6144
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2752
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 27
+ARGI4
+ADDRLP4 700
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 700
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1450
+JUMPV
+LABELV $1447
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $1454
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1451
+LABELV $1454
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $1451
+LABELV $1448
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1450
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1447
+ADDRGP4 $1457
+ARGP4
+ADDRLP4 704
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+528
+ADDRLP4 704
+INDIRI4
+ASGNI4
+ADDRGP4 $1460
+ARGP4
+ADDRLP4 708
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+532
+ADDRLP4 708
+INDIRI4
+ASGNI4
+ADDRGP4 $1463
+ARGP4
+ADDRLP4 712
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+536
+ADDRLP4 712
+INDIRI4
+ASGNI4
+ADDRGP4 $1466
+ARGP4
+ADDRLP4 716
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+540
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 $1469
+ARGP4
+ADDRLP4 720
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+496
+ADDRLP4 720
+INDIRI4
+ASGNI4
+ADDRGP4 $1472
+ARGP4
+ADDRLP4 724
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+520
+ADDRLP4 724
+INDIRI4
+ASGNI4
+ADDRGP4 $1475
+ARGP4
+ADDRLP4 728
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+524
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRLP4 732
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+37056
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1480
+JUMPV
+LABELV $1477
+ADDRLP4 764
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $1482
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 764
+ARGP4
+ADDRLP4 776
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+37060
+ADDP4
+ADDRLP4 776
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+37060
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 740
+ARGP4
+ADDRLP4 752
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 736
+CNSTI4 0
+ASGNI4
+LABELV $1485
+ADDRLP4 780
+ADDRLP4 736
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 784
+ADDRLP4 780
+INDIRI4
+ADDRLP4 740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 780
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+38084
+ADDP4
+ADDP4
+ADDRLP4 784
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 780
+INDIRI4
+ADDRLP4 752
+ADDP4
+INDIRF4
+ADDRLP4 784
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1486
+ADDRLP4 736
+ADDRLP4 736
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 736
+INDIRI4
+CNSTI4 3
+LTI4 $1485
+LABELV $1478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1480
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+37056
+INDIRI4
+LTI4 $1477
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1490
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 740
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 736
+ADDRLP4 740
+INDIRP4
+ASGNP4
+ADDRLP4 736
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1494
+ADDRGP4 $1492
+JUMPV
+LABELV $1494
+ADDRLP4 736
+INDIRP4
+ARGP4
+ADDRLP4 744
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35008
+ADDP4
+ADDRLP4 744
+INDIRI4
+ASGNI4
+LABELV $1491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1490
+LABELV $1492
+ADDRGP4 $1499
+ARGP4
+ADDRLP4 736
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1376
+ADDRLP4 736
+INDIRI4
+ASGNI4
+ADDRGP4 $1502
+ARGP4
+ADDRLP4 740
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1380
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRGP4 $1505
+ARGP4
+ADDRLP4 744
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1384
+ADDRLP4 744
+INDIRI4
+ASGNI4
+ADDRGP4 $1508
+ARGP4
+ADDRLP4 748
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1388
+ADDRLP4 748
+INDIRI4
+ASGNI4
+ADDRGP4 $1511
+ARGP4
+ADDRLP4 752
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1392
+ADDRLP4 752
+INDIRI4
+ASGNI4
+ADDRGP4 $1514
+ARGP4
+ADDRLP4 756
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1396
+ADDRLP4 756
+INDIRI4
+ASGNI4
+ADDRGP4 $1517
+ARGP4
+ADDRLP4 760
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1400
+ADDRLP4 760
+INDIRI4
+ASGNI4
+ADDRGP4 $1520
+ARGP4
+ADDRLP4 764
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1404
+ADDRLP4 764
+INDIRI4
+ASGNI4
+ADDRGP4 $1523
+ARGP4
+ADDRLP4 768
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1408
+ADDRLP4 768
+INDIRI4
+ASGNI4
+ADDRGP4 $1526
+ARGP4
+ADDRLP4 772
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1444
+ADDRLP4 772
+INDIRI4
+ASGNI4
+ADDRGP4 $1529
+ARGP4
+ADDRLP4 776
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1452
+ADDRLP4 776
+INDIRI4
+ASGNI4
+ADDRGP4 $1532
+ARGP4
+ADDRLP4 780
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1448
+ADDRLP4 780
+INDIRI4
+ASGNI4
+ADDRGP4 $1535
+ARGP4
+ADDRLP4 784
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1412
+ADDRLP4 784
+INDIRI4
+ASGNI4
+ADDRGP4 $1539
+ARGP4
+ADDRLP4 788
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1412+4
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $1543
+ARGP4
+ADDRLP4 792
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+1412+8
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRGP4 $1544
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+ADDRGP4 $1545
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+ADDRGP4 $1546
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+LABELV $873
+endproc CG_RegisterGraphics 796 16
+export CG_BuildSpectatorString
+proc CG_BuildSpectatorString 12 12
+ADDRGP4 cg+114956
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1549
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1553
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1553
+ADDRGP4 $1560
+ARGP4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 cg+114956
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1553
+LABELV $1550
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1549
+ADDRGP4 cg+114956
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+115980
+INDIRI4
+EQI4 $1564
+ADDRGP4 cg+115980
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+115984
+CNSTF4 3212836864
+ASGNF4
+LABELV $1564
+LABELV $1547
+endproc CG_BuildSpectatorString 12 12
+proc CG_RegisterClients 12 4
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1572
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1576
+ADDRGP4 $1573
+JUMPV
+LABELV $1576
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1579
+ADDRGP4 $1573
+JUMPV
+LABELV $1579
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $1573
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1572
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $1569
+endproc CG_RegisterClients 12 4
+export CG_ConfigString
+proc CG_ConfigString 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1584
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1582
+LABELV $1584
+ADDRGP4 $1585
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1582
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $1581
+endproc CG_ConfigString 4 8
+export CG_StartMusic
+proc CG_StartMusic 148 12
+ADDRGP4 cg_music+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1588
+ADDRGP4 cg_music+16
+ARGP4
+ADDRGP4 $1592
+ARGP4
+ADDRLP4 132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1588
+ADDRLP4 0
+ADDRGP4 cg_music+16
+ASGNP4
+ADDRGP4 $1589
+JUMPV
+LABELV $1588
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $1589
+LABELV $1587
+endproc CG_StartMusic 148 12
+bss
+align 1
+LABELV $1595
+skip 32768
+export CG_GetMenuBuffer
+code
+proc CG_GetMenuBuffer 16 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1596
+ADDRGP4 $1598
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1594
+JUMPV
+LABELV $1596
+ADDRLP4 0
+INDIRI4
+CNSTI4 32768
+LTI4 $1599
+ADDRGP4 $1601
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1594
+JUMPV
+LABELV $1599
+ADDRGP4 $1595
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $1595
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $1595
+RETP4
+LABELV $1594
+endproc CG_GetMenuBuffer 16 16
+export CG_Asset_Parse
+proc CG_Asset_Parse 1220 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1603
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1603
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1608
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1609
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $1612
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1612
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1617
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1614
+CNSTI4 1
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1614
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1621
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1618
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $1624
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1622
+LABELV $1624
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1622
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+56
+ARGP4
+ADDRGP4 cgDC+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1610
+JUMPV
+LABELV $1618
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1631
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $1628
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $1634
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1632
+LABELV $1634
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1632
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+20604
+ARGP4
+ADDRGP4 cgDC+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1610
+JUMPV
+LABELV $1628
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1641
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1638
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $1644
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1642
+LABELV $1644
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1642
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+41152
+ARGP4
+ADDRGP4 cgDC+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1610
+JUMPV
+LABELV $1638
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1651
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1648
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1652
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1652
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61704
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1648
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1659
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1656
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1660
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1660
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61796
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1656
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1667
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1664
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1668
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1668
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61800
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1664
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1675
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1672
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $1676
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1676
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61808
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1672
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1683
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $1680
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $1684
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1684
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61804
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1680
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1691
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $1688
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $1692
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1692
+ADDRGP4 cgDC+228+4
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61700
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1688
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1703
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $1700
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+61812
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1700
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1711
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $1708
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+61816
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1708
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1719
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1716
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+61820
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1716
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1727
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1724
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+61824
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1724
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1735
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $1732
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+61828
+ARGP4
+ADDRLP4 1116
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1732
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1743
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $1740
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+61832
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $1744
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1744
+ADDRGP4 cgDC+228+61848
+ADDRGP4 cgDC+228+61832+12
+INDIRF4
+ASGNF4
+ADDRGP4 $1610
+JUMPV
+LABELV $1740
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1756
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $1753
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+32
+ARGP4
+ADDRLP4 1124
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1753
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1764
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $1761
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+36
+ARGP4
+ADDRLP4 1128
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1761
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1772
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $1769
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+40
+ARGP4
+ADDRLP4 1132
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1769
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1780
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $1777
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+44
+ARGP4
+ADDRLP4 1136
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1777
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1788
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $1785
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+228+48
+ARGP4
+ADDRLP4 1140
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1785
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1796
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $1793
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1144
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $1797
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1797
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61752
+ADDRLP4 1148
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1793
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $1801
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1148
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $1805
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1805
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1152
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61756
+ADDRLP4 1152
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1801
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1812
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $1809
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1152
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $1813
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1813
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61760
+ADDRLP4 1156
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1809
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1820
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $1817
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1156
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $1821
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1821
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1160
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61724
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1817
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1828
+ARGP4
+ADDRLP4 1156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $1825
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1160
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $1829
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1829
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1164
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61728
+ADDRLP4 1164
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1825
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1836
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $1833
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1164
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $1837
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1837
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1168
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61736
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1833
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1844
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $1841
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1168
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $1845
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1845
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1172
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61708
+ADDRLP4 1172
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1841
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1852
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $1849
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1172
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $1853
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1853
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1176
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61712
+ADDRLP4 1176
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1849
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1860
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $1857
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1176
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $1861
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1861
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1180
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61716
+ADDRLP4 1180
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1857
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1868
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $1865
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1180
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $1869
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1869
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1184
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61720
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1865
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1876
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $1873
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1184
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $1877
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1877
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1188
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61856
+ADDRLP4 1188
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1873
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1884
+ARGP4
+ADDRLP4 1184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $1881
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1188
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $1885
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1885
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1192
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1881
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1892
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $1889
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1192
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $1893
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1893
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1196
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+4
+ADDRLP4 1196
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1889
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1901
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $1898
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1196
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $1902
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1902
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1200
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+8
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1898
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1910
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $1907
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1200
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $1911
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1911
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1204
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+12
+ADDRLP4 1204
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1907
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1919
+ARGP4
+ADDRLP4 1200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $1916
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1204
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $1920
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1920
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+16
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1916
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1928
+ARGP4
+ADDRLP4 1204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $1925
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1208
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $1929
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1929
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1212
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+20
+ADDRLP4 1212
+INDIRI4
+ASGNI4
+ADDRGP4 $1610
+JUMPV
+LABELV $1925
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1937
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $1934
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1212
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $1938
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1938
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+24
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+LABELV $1934
+LABELV $1610
+ADDRGP4 $1609
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $1602
+endproc CG_Asset_Parse 1220 12
+export CG_ParseMenu
+proc CG_ParseMenu 1064 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1944
+ADDRGP4 $1946
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+LABELV $1944
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1950
+ADDRGP4 $1943
+JUMPV
+LABELV $1949
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $1952
+ADDRGP4 $1951
+JUMPV
+LABELV $1952
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $1954
+ADDRGP4 $1951
+JUMPV
+LABELV $1954
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1960
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1957
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 CG_Asset_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $1951
+ADDRGP4 $1950
+JUMPV
+LABELV $1957
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1966
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1963
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Menu_New
+CALLV
+pop
+LABELV $1963
+LABELV $1950
+ADDRGP4 $1949
+JUMPV
+LABELV $1951
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $1943
+endproc CG_ParseMenu 1064 8
+export CG_Load_Menu
+proc CG_Load_Menu 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $1971
+CNSTI4 0
+RETI4
+ADDRGP4 $1967
+JUMPV
+LABELV $1970
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1617
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1973
+CNSTI4 1
+RETI4
+ADDRGP4 $1967
+JUMPV
+LABELV $1973
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1977
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1975
+LABELV $1977
+CNSTI4 0
+RETI4
+ADDRGP4 $1967
+JUMPV
+LABELV $1975
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+LABELV $1971
+ADDRGP4 $1970
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $1967
+endproc CG_Load_Menu 20 8
+bss
+align 1
+LABELV $1979
+skip 4096
+export CG_LoadMenus
+code
+proc CG_LoadMenus 52 16
+ADDRLP4 20
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1980
+ADDRGP4 $1982
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+ADDRGP4 $213
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1983
+ADDRGP4 $1985
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $1983
+LABELV $1980
+ADDRLP4 12
+INDIRI4
+CNSTI4 4096
+LTI4 $1986
+ADDRGP4 $1601
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $1978
+JUMPV
+LABELV $1986
+ADDRGP4 $1979
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ADDRGP4 $1979
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $1979
+ARGP4
+ADDRGP4 COM_Compress
+CALLI4
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 $1979
+ASGNP4
+ADDRGP4 $1989
+JUMPV
+LABELV $1988
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1994
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1994
+ADDRLP4 36
+INDIRI4
+CNSTI4 125
+NEI4 $1991
+LABELV $1994
+ADDRGP4 $1990
+JUMPV
+LABELV $1991
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1617
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1995
+ADDRGP4 $1990
+JUMPV
+LABELV $1995
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1999
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $1997
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_Load_Menu
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1990
+LABELV $1997
+LABELV $1989
+ADDRGP4 $1988
+JUMPV
+LABELV $1990
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $2002
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $1978
+endproc CG_LoadMenus 52 16
+proc CG_OwnerDrawHandleKey 0 0
+CNSTI4 0
+RETI4
+LABELV $2003
+endproc CG_OwnerDrawHandleKey 0 0
+proc CG_FeederCount 8 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $2005
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2010
+JUMPV
+LABELV $2007
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2012
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2012
+LABELV $2008
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2010
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $2007
+ADDRGP4 $2006
+JUMPV
+LABELV $2005
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $2016
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2021
+JUMPV
+LABELV $2018
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2023
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2023
+LABELV $2019
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2021
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $2018
+ADDRGP4 $2017
+JUMPV
+LABELV $2016
+ADDRFP4 0
+INDIRF4
+CNSTF4 1093664768
+NEF4 $2027
+ADDRGP4 cg+110672
+INDIRI4
+RETI4
+ADDRGP4 $2004
+JUMPV
+LABELV $2027
+LABELV $2017
+LABELV $2006
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $2004
+endproc CG_FeederCount 8 0
+export CG_SetScoreSelection
+proc CG_SetScoreSelection 28 16
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2035
+JUMPV
+LABELV $2032
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2037
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2038
+JUMPV
+LABELV $2037
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2041
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2041
+LABELV $2038
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+NEI4 $2045
+ADDRGP4 cg+110676
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2045
+LABELV $2033
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2035
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $2032
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2049
+ADDRGP4 $2030
+JUMPV
+LABELV $2049
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $2051
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $2051
+ADDRLP4 24
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110676
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2055
+ADDRLP4 24
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $2055
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2052
+JUMPV
+LABELV $2051
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 cg+110676
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $2052
+LABELV $2030
+endproc CG_SetScoreSelection 28 16
+proc CG_InfoFromScoreIndex 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $2062
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $2062
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2069
+JUMPV
+LABELV $2066
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2071
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2075
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+RETP4
+ADDRGP4 $2061
+JUMPV
+LABELV $2075
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2071
+LABELV $2067
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2069
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $2066
+LABELV $2062
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 2120
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+RETP4
+LABELV $2061
+endproc CG_InfoFromScoreIndex 12 0
+proc CG_FeederItemText 44 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $2082
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2083
+JUMPV
+LABELV $2082
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $2084
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $2084
+LABELV $2083
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2087
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2087
+ADDRLP4 28
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $2089
+ADDRLP4 28
+INDIRI4
+CNSTI4 6
+GTI4 $2089
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2141
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2141
+address $2091
+address $2109
+address $2116
+address $2133
+address $2134
+address $2135
+address $2137
+code
+LABELV $2091
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $2092
+CNSTI4 9
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2090
+JUMPV
+LABELV $2092
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2095
+CNSTI4 7
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2090
+JUMPV
+LABELV $2095
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2098
+CNSTI4 8
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2090
+JUMPV
+LABELV $2098
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $2101
+ADDRLP4 32
+INDIRI4
+CNSTI4 5
+GTI4 $2101
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+500-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2090
+JUMPV
+LABELV $2101
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $2090
+ADDRGP4 $2108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2109
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $2110
+ADDRGP4 $200
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2110
+ADDRLP4 0
+INDIRP4
+CNSTI4 2100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2112
+ADDRFP4 12
+INDIRP4
+ADDRGP4 cgs+180272+1408
+INDIRI4
+ASGNI4
+ADDRGP4 $2090
+JUMPV
+LABELV $2112
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $2090
+JUMPV
+LABELV $2116
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2117
+ADDRGP4 $2120
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2117
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $2121
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $2123
+ADDRGP4 $2126
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2123
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2127
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2127
+ADDRGP4 $2129
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2127
+ADDRGP4 $200
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2121
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2090
+ADDRGP4 $2132
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2133
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2134
+ADDRGP4 $2108
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2135
+ADDRGP4 $2136
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2137
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $2138
+ADDRGP4 $2140
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2138
+ADDRGP4 $2136
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $2081
+JUMPV
+LABELV $2089
+LABELV $2090
+LABELV $2087
+ADDRGP4 $200
+RETP4
+LABELV $2081
+endproc CG_FeederItemText 44 12
+proc CG_FeederItemImage 0 0
+CNSTI4 0
+RETI4
+LABELV $2142
+endproc CG_FeederItemImage 0 0
+proc CG_FeederSelection 20 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $2144
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $2144
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $2149
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2150
+JUMPV
+LABELV $2149
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+LABELV $2150
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2154
+JUMPV
+LABELV $2151
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+56
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2156
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $2160
+ADDRGP4 cg+110676
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2160
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2156
+LABELV $2152
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2154
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $2151
+ADDRGP4 $2145
+JUMPV
+LABELV $2144
+ADDRGP4 cg+110676
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $2145
+LABELV $2143
+endproc CG_FeederSelection 20 0
+proc CG_Cvar_Get 132 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 128
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $2164
+endproc CG_Cvar_Get 132 12
+export CG_Text_PaintWithCursor
+proc CG_Text_PaintWithCursor 0 32
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $2165
+endproc CG_Text_PaintWithCursor 0 32
+proc CG_OwnerDrawWidth 48 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 39
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2169
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $2177
+LABELV $2176
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 29
+EQI4 $2172
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+EQI4 $2174
+ADDRGP4 $2167
+JUMPV
+LABELV $2177
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 49
+EQI4 $2170
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+EQI4 $2171
+ADDRGP4 $2167
+JUMPV
+LABELV $2169
+ADDRLP4 16
+ADDRGP4 CG_GameTypeString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $2166
+JUMPV
+LABELV $2170
+ADDRLP4 24
+ADDRGP4 CG_GetGameStatusText
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $2166
+JUMPV
+LABELV $2171
+ADDRLP4 32
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+RETI4
+ADDRGP4 $2166
+JUMPV
+LABELV $2172
+ADDRGP4 cg_redTeamName+16
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+ADDRGP4 $2166
+JUMPV
+LABELV $2174
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $2166
+JUMPV
+LABELV $2167
+CNSTI4 0
+RETI4
+LABELV $2166
+endproc CG_OwnerDrawWidth 48 12
+proc CG_PlayCinematic 4 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $2178
+endproc CG_PlayCinematic 4 24
+proc CG_StopCinematic 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $2179
+endproc CG_StopCinematic 0 4
+proc CG_DrawCinematic 0 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+LABELV $2180
+endproc CG_DrawCinematic 0 20
+proc CG_RunCinematicFrame 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+LABELV $2181
+endproc CG_RunCinematicFrame 0 4
+export CG_LoadHudMenu
+proc CG_LoadHudMenu 1028 12
+ADDRGP4 cgDC
+ADDRGP4 trap_R_RegisterShaderNoMip
+ASGNP4
+ADDRGP4 cgDC+4
+ADDRGP4 trap_R_SetColor
+ASGNP4
+ADDRGP4 cgDC+8
+ADDRGP4 CG_DrawPic
+ASGNP4
+ADDRGP4 cgDC+12
+ADDRGP4 trap_R_DrawStretchPic
+ASGNP4
+ADDRGP4 cgDC+16
+ADDRGP4 CG_Text_Paint
+ASGNP4
+ADDRGP4 cgDC+20
+ADDRGP4 CG_Text_Width
+ASGNP4
+ADDRGP4 cgDC+24
+ADDRGP4 CG_Text_Height
+ASGNP4
+ADDRGP4 cgDC+28
+ADDRGP4 trap_R_RegisterModel
+ASGNP4
+ADDRGP4 cgDC+32
+ADDRGP4 trap_R_ModelBounds
+ASGNP4
+ADDRGP4 cgDC+36
+ADDRGP4 CG_FillRect
+ASGNP4
+ADDRGP4 cgDC+40
+ADDRGP4 CG_DrawRect
+ASGNP4
+ADDRGP4 cgDC+44
+ADDRGP4 CG_DrawSides
+ASGNP4
+ADDRGP4 cgDC+48
+ADDRGP4 CG_DrawTopBottom
+ASGNP4
+ADDRGP4 cgDC+52
+ADDRGP4 trap_R_ClearScene
+ASGNP4
+ADDRGP4 cgDC+56
+ADDRGP4 trap_R_AddRefEntityToScene
+ASGNP4
+ADDRGP4 cgDC+60
+ADDRGP4 trap_R_RenderScene
+ASGNP4
+ADDRGP4 cgDC+64
+ADDRGP4 trap_R_RegisterFont
+ASGNP4
+ADDRGP4 cgDC+68
+ADDRGP4 CG_OwnerDraw
+ASGNP4
+ADDRGP4 cgDC+72
+ADDRGP4 CG_GetValue
+ASGNP4
+ADDRGP4 cgDC+76
+ADDRGP4 CG_OwnerDrawVisible
+ASGNP4
+ADDRGP4 cgDC+80
+ADDRGP4 CG_RunMenuScript
+ASGNP4
+ADDRGP4 cgDC+84
+ADDRGP4 CG_GetTeamColor
+ASGNP4
+ADDRGP4 cgDC+96
+ADDRGP4 trap_Cvar_Set
+ASGNP4
+ADDRGP4 cgDC+88
+ADDRGP4 trap_Cvar_VariableStringBuffer
+ASGNP4
+ADDRGP4 cgDC+92
+ADDRGP4 CG_Cvar_Get
+ASGNP4
+ADDRGP4 cgDC+100
+ADDRGP4 CG_Text_PaintWithCursor
+ASGNP4
+ADDRGP4 cgDC+112
+ADDRGP4 trap_S_StartLocalSound
+ASGNP4
+ADDRGP4 cgDC+116
+ADDRGP4 CG_OwnerDrawHandleKey
+ASGNP4
+ADDRGP4 cgDC+120
+ADDRGP4 CG_FeederCount
+ASGNP4
+ADDRGP4 cgDC+128
+ADDRGP4 CG_FeederItemImage
+ASGNP4
+ADDRGP4 cgDC+124
+ADDRGP4 CG_FeederItemText
+ASGNP4
+ADDRGP4 cgDC+132
+ADDRGP4 CG_FeederSelection
+ASGNP4
+ADDRGP4 cgDC+152
+ADDRGP4 Com_Error
+ASGNP4
+ADDRGP4 cgDC+156
+ADDRGP4 Com_Printf
+ASGNP4
+ADDRGP4 cgDC+164
+ADDRGP4 CG_OwnerDrawWidth
+ASGNP4
+ADDRGP4 cgDC+168
+ADDRGP4 trap_S_RegisterSound
+ASGNP4
+ADDRGP4 cgDC+172
+ADDRGP4 trap_S_StartBackgroundTrack
+ASGNP4
+ADDRGP4 cgDC+176
+ADDRGP4 trap_S_StopBackgroundTrack
+ASGNP4
+ADDRGP4 cgDC+180
+ADDRGP4 CG_PlayCinematic
+ASGNP4
+ADDRGP4 cgDC+184
+ADDRGP4 CG_StopCinematic
+ASGNP4
+ADDRGP4 cgDC+188
+ADDRGP4 CG_DrawCinematic
+ASGNP4
+ADDRGP4 cgDC+192
+ADDRGP4 CG_RunCinematicFrame
+ASGNP4
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $212
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2224
+ADDRLP4 0
+ADDRGP4 $213
+ASGNP4
+LABELV $2224
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadMenus
+CALLV
+pop
+LABELV $2182
+endproc CG_LoadHudMenu 1028 12
+export CG_AssetCache
+proc CG_AssetCache 76 4
+ADDRGP4 $2229
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61704
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2232
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61856
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2235
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2239
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $2243
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2247
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2251
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $2255
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $2259
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61860+24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $2262
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61724
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $2262
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61728
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $2267
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61712
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $2270
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61708
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $2273
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61716
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $2276
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61720
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $2279
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61736
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $2282
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61752
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $2285
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61756
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $2285
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+228+61760
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+228+32
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cgDC+228+36
+CNSTF4 1119879168
+ASGNF4
+ADDRGP4 cgDC+228+40
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cgDC+228+44
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 cgDC+228+48
+CNSTF4 1101004800
+ASGNF4
+LABELV $2226
+endproc CG_AssetCache 76 4
+export CG_Init
+proc CG_Init 52 12
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 181772
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 164980
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 958464
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2752
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6144
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31448
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31444
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2303
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2306
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2309
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $2312
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2315
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 CG_AssetCache
+CALLV
+pop
+ADDRGP4 CG_LoadHudMenu
+CALLV
+pop
+ADDRGP4 $2316
+ARGP4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cg+109152
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+34996
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34992
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+35000
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 cgs+20100+11304
+INDIRU4
+ASGNU4
+ADDRGP4 cgs+31432
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 28
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cgs+20100+11308
+INDIRU4
+ASGNU4
+ADDRGP4 cgs+31436
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 32
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2330
+ARGP4
+ADDRLP4 40
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2328
+ADDRGP4 $2331
+ARGP4
+ADDRGP4 $2330
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $2328
+CNSTI4 21
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 cgs+31492
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 CG_LoadHudMenu
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_UpdateSoundFraction
+CALLV
+pop
+CNSTF4 1058642330
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_UpdateGraphicFraction
+CALLV
+pop
+CNSTF4 1063675494
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 CG_RegisterClients
+CALLV
+pop
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_UpdateMediaFraction
+CALLV
+pop
+ADDRGP4 CG_AssetCache
+CALLV
+pop
+ADDRGP4 CG_LoadHudMenu
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+109644
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_InitTeamChat
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+ADDRGP4 challenges_init
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 addChallenge
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 $2316
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cg+164976
+CNSTI4 1
+ASGNI4
+LABELV $2298
+endproc CG_Init 52 12
+export CG_Shutdown
+proc CG_Shutdown 0 0
+ADDRGP4 challenges_save
+CALLV
+pop
+LABELV $2338
+endproc CG_Shutdown 0 0
+export SnapVectorTowards
+proc SnapVectorTowards 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2340
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $2344
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2345
+JUMPV
+LABELV $2344
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CNSTI4 1
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $2345
+LABELV $2341
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2340
+LABELV $2339
+endproc SnapVectorTowards 12 0
+data
+align 4
+LABELV do_vid_restart
+byte 4 0
+export CG_FairCvars
+code
+proc CG_FairCvars 168 12
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $2347
+ADDRGP4 $2350
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 cg_autovertex+12
+INDIRI4
+CNSTI4 0
+EQI4 $2346
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2346
+ADDRGP4 $2350
+ARGP4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2346
+JUMPV
+LABELV $2347
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2354
+ADDRGP4 $2357
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 80
+LEI4 $2358
+ADDRGP4 $2357
+ARGP4
+ADDRGP4 $2360
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2358
+ADDRGP4 $114
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $2361
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+EQI4 $2361
+ADDRGP4 $114
+ARGP4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2361
+LABELV $2354
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2363
+ADDRGP4 $2357
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 20
+LEI4 $2366
+ADDRGP4 $2357
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2366
+ADDRGP4 $2368
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 3
+LEI4 $2369
+ADDRGP4 $2368
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2370
+JUMPV
+LABELV $2369
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $2371
+ADDRGP4 $2368
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2371
+LABELV $2370
+ADDRGP4 $2373
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LEI4 $2374
+ADDRGP4 $2373
+ARGP4
+ADDRGP4 $2376
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2375
+JUMPV
+LABELV $2374
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $2377
+ADDRGP4 $2373
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2377
+LABELV $2375
+ADDRGP4 $2379
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LEI4 $2380
+ADDRGP4 $2379
+ARGP4
+ADDRGP4 $2376
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2381
+JUMPV
+LABELV $2380
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $2382
+ADDRGP4 $2379
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2382
+LABELV $2381
+ADDRGP4 $2384
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 2
+LEI4 $2385
+ADDRGP4 $2384
+ARGP4
+ADDRGP4 $2376
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2386
+JUMPV
+LABELV $2385
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+GEI4 $2387
+ADDRGP4 $2384
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2387
+LABELV $2386
+LABELV $2363
+ADDRGP4 cgs+31464
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2389
+ADDRGP4 $2350
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $2390
+ADDRGP4 $2350
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2390
+JUMPV
+LABELV $2389
+ADDRGP4 cg_autovertex+12
+INDIRI4
+CNSTI4 0
+EQI4 $2394
+ADDRGP4 $2350
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $2397
+ADDRGP4 $2350
+ARGP4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $2397
+LABELV $2394
+LABELV $2390
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $2399
+ADDRGP4 do_vid_restart
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $2399
+ADDRGP4 $2401
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $2399
+ADDRGP4 do_vid_restart
+CNSTI4 1
+ASGNI4
+LABELV $2346
+endproc CG_FairCvars 168 12
+bss
+export cg_leiWidescreen
+align 4
+LABELV cg_leiWidescreen
+skip 272
+export cg_leiChibi
+align 4
+LABELV cg_leiChibi
+skip 272
+export cg_pmove_msec
+align 4
+LABELV cg_pmove_msec
+skip 272
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+export cgDC
+align 4
+LABELV cgDC
+skip 73504
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_R_LFX_ParticleEffect
+export wideAdjustX
+align 4
+LABELV wideAdjustX
+skip 4
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+export cg_teamChatBeep
+align 4
+LABELV cg_teamChatBeep
+skip 272
+export cg_chatBeep
+align 4
+LABELV cg_chatBeep
+skip 272
+export cg_weaponOrder
+align 4
+LABELV cg_weaponOrder
+skip 272
+export cg_weaponBarStyle
+align 4
+LABELV cg_weaponBarStyle
+skip 272
+export cg_crosshairColorBlue
+align 4
+LABELV cg_crosshairColorBlue
+skip 272
+export cg_crosshairColorGreen
+align 4
+LABELV cg_crosshairColorGreen
+skip 272
+export cg_crosshairColorRed
+align 4
+LABELV cg_crosshairColorRed
+skip 272
+export cg_ch13size
+align 4
+LABELV cg_ch13size
+skip 272
+export cg_ch13
+align 4
+LABELV cg_ch13
+skip 272
+export cg_ch12size
+align 4
+LABELV cg_ch12size
+skip 272
+export cg_ch12
+align 4
+LABELV cg_ch12
+skip 272
+export cg_ch11size
+align 4
+LABELV cg_ch11size
+skip 272
+export cg_ch11
+align 4
+LABELV cg_ch11
+skip 272
+export cg_ch10size
+align 4
+LABELV cg_ch10size
+skip 272
+export cg_ch10
+align 4
+LABELV cg_ch10
+skip 272
+export cg_ch9size
+align 4
+LABELV cg_ch9size
+skip 272
+export cg_ch9
+align 4
+LABELV cg_ch9
+skip 272
+export cg_ch8size
+align 4
+LABELV cg_ch8size
+skip 272
+export cg_ch8
+align 4
+LABELV cg_ch8
+skip 272
+export cg_ch7size
+align 4
+LABELV cg_ch7size
+skip 272
+export cg_ch7
+align 4
+LABELV cg_ch7
+skip 272
+export cg_ch6size
+align 4
+LABELV cg_ch6size
+skip 272
+export cg_ch6
+align 4
+LABELV cg_ch6
+skip 272
+export cg_ch5size
+align 4
+LABELV cg_ch5size
+skip 272
+export cg_ch5
+align 4
+LABELV cg_ch5
+skip 272
+export cg_ch4size
+align 4
+LABELV cg_ch4size
+skip 272
+export cg_ch4
+align 4
+LABELV cg_ch4
+skip 272
+export cg_ch3size
+align 4
+LABELV cg_ch3size
+skip 272
+export cg_ch3
+align 4
+LABELV cg_ch3
+skip 272
+export cg_ch2size
+align 4
+LABELV cg_ch2size
+skip 272
+export cg_ch2
+align 4
+LABELV cg_ch2
+skip 272
+export cg_ch1size
+align 4
+LABELV cg_ch1size
+skip 272
+export cg_ch1
+align 4
+LABELV cg_ch1
+skip 272
+export cg_differentCrosshairs
+align 4
+LABELV cg_differentCrosshairs
+skip 272
+export cg_crosshairPulse
+align 4
+LABELV cg_crosshairPulse
+skip 272
+export cg_fragmsgsize
+align 4
+LABELV cg_fragmsgsize
+skip 272
+export cg_autovertex
+align 4
+LABELV cg_autovertex
+skip 272
+export cg_vote_custom_commands
+align 4
+LABELV cg_vote_custom_commands
+skip 272
+export cg_cyclegrapple
+align 4
+LABELV cg_cyclegrapple
+skip 272
+export cg_voteflags
+align 4
+LABELV cg_voteflags
+skip 272
+export cg_voip_teamonly
+align 4
+LABELV cg_voip_teamonly
+skip 272
+export cg_hitsound
+align 4
+LABELV cg_hitsound
+skip 272
+export cg_alwaysWeaponBar
+align 4
+LABELV cg_alwaysWeaponBar
+skip 272
+export cl_timeNudge
+align 4
+LABELV cl_timeNudge
+skip 272
+export cg_optimizePrediction
+align 4
+LABELV cg_optimizePrediction
+skip 272
+export cg_projectileNudge
+align 4
+LABELV cg_projectileNudge
+skip 272
+export sv_fps
+align 4
+LABELV sv_fps
+skip 272
+export cg_cmdTimeNudge
+align 4
+LABELV cg_cmdTimeNudge
+skip 272
+export cg_delag
+align 4
+LABELV cg_delag
+skip 272
+export cg_enableFS
+align 4
+LABELV cg_enableFS
+skip 272
+export cg_enableQ
+align 4
+LABELV cg_enableQ
+skip 272
+export cg_enableBreath
+align 4
+LABELV cg_enableBreath
+skip 272
+export cg_enableDust
+align 4
+LABELV cg_enableDust
+skip 272
+export cg_obeliskRespawnDelay
+align 4
+LABELV cg_obeliskRespawnDelay
+skip 272
+export cg_recordSPDemoName
+align 4
+LABELV cg_recordSPDemoName
+skip 272
+export cg_recordSPDemo
+align 4
+LABELV cg_recordSPDemo
+skip 272
+export cg_singlePlayerActive
+align 4
+LABELV cg_singlePlayerActive
+skip 272
+export cg_singlePlayer
+align 4
+LABELV cg_singlePlayer
+skip 272
+export cg_currentSelectedPlayerName
+align 4
+LABELV cg_currentSelectedPlayerName
+skip 272
+export cg_currentSelectedPlayer
+align 4
+LABELV cg_currentSelectedPlayer
+skip 272
+export cg_blueTeamName
+align 4
+LABELV cg_blueTeamName
+skip 272
+export cg_redTeamName
+align 4
+LABELV cg_redTeamName
+skip 272
+export cg_music
+align 4
+LABELV cg_music
+skip 272
+export cg_trueLightning
+align 4
+LABELV cg_trueLightning
+skip 272
+export cg_oldPlasma
+align 4
+LABELV cg_oldPlasma
+skip 272
+export cg_modelEyes_Fwd
+align 4
+LABELV cg_modelEyes_Fwd
+skip 272
+export cg_modelEyes_Right
+align 4
+LABELV cg_modelEyes_Right
+skip 272
+export cg_modelEyes_Up
+align 4
+LABELV cg_modelEyes_Up
+skip 272
+export cg_cameraEyes_Up
+align 4
+LABELV cg_cameraEyes_Up
+skip 272
+export cg_cameraEyes_Fwd
+align 4
+LABELV cg_cameraEyes_Fwd
+skip 272
+export cg_cameraEyes
+align 4
+LABELV cg_cameraEyes
+skip 272
+export cg_cameramode
+align 4
+LABELV cg_cameramode
+skip 272
+export cg_deathcam
+align 4
+LABELV cg_deathcam
+skip 272
+export cg_leiDebug
+align 4
+LABELV cg_leiDebug
+skip 272
+export cg_muzzleflashStyle
+align 4
+LABELV cg_muzzleflashStyle
+skip 272
+export cg_leiSuperGoreyAwesome
+align 4
+LABELV cg_leiSuperGoreyAwesome
+skip 272
+export cg_leiBrassNoise
+align 4
+LABELV cg_leiBrassNoise
+skip 272
+export cg_leiGoreNoise
+align 4
+LABELV cg_leiGoreNoise
+skip 272
+export cg_leiEnhancement
+align 4
+LABELV cg_leiEnhancement
+skip 272
+export cg_oldRocket
+align 4
+LABELV cg_oldRocket
+skip 272
+export cg_oldRail
+align 4
+LABELV cg_oldRail
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_noTaunt
+align 4
+LABELV cg_noTaunt
+skip 272
+export cg_bigFont
+align 4
+LABELV cg_bigFont
+skip 272
+export cg_smallFont
+align 4
+LABELV cg_smallFont
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export cg_cameraOrbitDelay
+align 4
+LABELV cg_cameraOrbitDelay
+skip 272
+export cg_cameraOrbit
+align 4
+LABELV cg_cameraOrbit
+skip 272
+export pmove_float
+align 4
+LABELV pmove_float
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export cg_obituaryOutput
+align 4
+LABELV cg_obituaryOutput
+skip 272
+export cg_scorePlum
+align 4
+LABELV cg_scorePlum
+skip 272
+export cg_noVoiceText
+align 4
+LABELV cg_noVoiceText
+skip 272
+export cg_noVoiceChats
+align 4
+LABELV cg_noVoiceChats
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_blood
+align 4
+LABELV cg_blood
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_teamChatHeight
+align 4
+LABELV cg_teamChatHeight
+skip 272
+export cg_teamChatTime
+align 4
+LABELV cg_teamChatTime
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawSpeed
+align 4
+LABELV cg_drawSpeed
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_lagometer
+align 4
+LABELV cg_lagometer
+skip 272
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 272
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 272
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_brassTime
+align 4
+LABELV cg_brassTime
+skip 272
+export cg_addMarks
+align 4
+LABELV cg_addMarks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_railTrailTime
+align 4
+LABELV cg_railTrailTime
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_gibs
+align 4
+LABELV cg_gibs
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_kickScale
+align 4
+LABELV cg_kickScale
+skip 272
+export cg_bobmodel
+align 4
+LABELV cg_bobmodel
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_bob
+align 4
+LABELV cg_bob
+skip 272
+export cg_runroll
+align 4
+LABELV cg_runroll
+skip 272
+export cg_runpitch
+align 4
+LABELV cg_runpitch
+skip 272
+export cg_centertime
+align 4
+LABELV cg_centertime
+skip 272
+import cg_markPolys
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2752
+export cg_entities
+align 4
+LABELV cg_entities
+skip 958464
+export cg
+align 4
+LABELV cg
+skip 164980
+export cgs
+align 4
+LABELV cgs
+skip 181772
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2401
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2384
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2379
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2376
+byte 1 50
+byte 1 0
+align 1
+LABELV $2373
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $2368
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2360
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2357
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2350
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2331
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2330
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $2316
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2315
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2312
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2309
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2306
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2303
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2285
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2282
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2279
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2276
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2273
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2270
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2267
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 100
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2262
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2259
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2255
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $2251
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2247
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2243
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $2239
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $2235
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2232
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $2229
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2140
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2136
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 0
+align 1
+LABELV $2132
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2129
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2126
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2120
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $2108
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2002
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1999
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1985
+byte 1 94
+byte 1 49
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1982
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1966
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $1960
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $1946
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1937
+byte 1 102
+byte 1 120
+byte 1 87
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1928
+byte 1 102
+byte 1 120
+byte 1 67
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $1919
+byte 1 102
+byte 1 120
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1910
+byte 1 102
+byte 1 120
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1901
+byte 1 102
+byte 1 120
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1892
+byte 1 102
+byte 1 120
+byte 1 89
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1884
+byte 1 102
+byte 1 120
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1876
+byte 1 102
+byte 1 120
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1868
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 82
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1860
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 76
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1852
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1844
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $1836
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $1828
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1820
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 72
+byte 1 111
+byte 1 114
+byte 1 122
+byte 1 0
+align 1
+LABELV $1812
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1804
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 0
+align 1
+LABELV $1796
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1788
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1780
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1772
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1764
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1756
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $1743
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1735
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 89
+byte 1 0
+align 1
+LABELV $1727
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 88
+byte 1 0
+align 1
+LABELV $1719
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1711
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1703
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1691
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1683
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1675
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1667
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1659
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1651
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1641
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1631
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1621
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1617
+byte 1 125
+byte 1 0
+align 1
+LABELV $1608
+byte 1 123
+byte 1 0
+align 1
+LABELV $1601
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1598
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1592
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1585
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1560
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1546
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1545
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $1544
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $1543
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1539
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1535
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1532
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1529
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1526
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $1523
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1520
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1517
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1514
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1511
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1508
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1505
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1502
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1499
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1482
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1475
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1472
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $1469
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1466
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1463
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1460
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1457
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1446
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 52
+byte 1 0
+align 1
+LABELV $1443
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 51
+byte 1 0
+align 1
+LABELV $1440
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 50
+byte 1 0
+align 1
+LABELV $1437
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $1434
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 52
+byte 1 0
+align 1
+LABELV $1431
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 51
+byte 1 0
+align 1
+LABELV $1428
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 50
+byte 1 0
+align 1
+LABELV $1425
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 49
+byte 1 0
+align 1
+LABELV $1422
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $1419
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $1416
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 102
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1413
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $1410
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 50
+byte 1 0
+align 1
+LABELV $1407
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1404
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $1401
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $1398
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $1395
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $1392
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $1389
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1386
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1383
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1380
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1377
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1374
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1371
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1368
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1365
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1362
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1359
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1356
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1353
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1350
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1347
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1344
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1341
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 105
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1338
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1335
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1332
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1329
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1326
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1323
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1320
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1317
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1312
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1309
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1306
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1303
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1300
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1297
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1294
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1291
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1288
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1285
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1282
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1279
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1276
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1273
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1270
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1267
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 0
+align 1
+LABELV $1264
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1261
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $1249
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1246
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1243
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1240
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1237
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1229
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1226
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1223
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1220
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1217
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1209
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 51
+byte 1 0
+align 1
+LABELV $1199
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 49
+byte 1 0
+align 1
+LABELV $1187
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1184
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1181
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1178
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1175
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1172
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1169
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1166
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1163
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 51
+byte 1 0
+align 1
+LABELV $1159
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $1155
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $1152
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1148
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $1144
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $1141
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1138
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1135
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1116
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1113
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1109
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 98
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1102
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1099
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1095
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1088
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1085
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1082
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1075
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1070
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1067
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1053
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $1050
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1047
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1044
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1041
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1038
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1035
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1032
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1029
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1026
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 0
+align 1
+LABELV $1023
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $1014
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1011
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1008
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1005
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1002
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $999
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $996
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $993
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $990
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $987
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $984
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $981
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $978
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $975
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $972
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $969
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $966
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $963
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $960
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $957
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $954
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $951
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 49
+byte 1 0
+align 1
+LABELV $948
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $945
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $942
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $939
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 82
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $936
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $933
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $930
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $927
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $924
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $921
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $918
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $915
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 53
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $911
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 52
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $907
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $903
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $899
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $890
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $885
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $884
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $883
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $882
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $881
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $880
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $879
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $878
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $877
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $876
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $875
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $872
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $871
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $870
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $869
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $868
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $867
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $866
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $865
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $864
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $863
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $862
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $861
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 107
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $860
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $859
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $858
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $857
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $856
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $855
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $854
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $853
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $852
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $851
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $850
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $849
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $848
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $845
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $842
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $839
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $836
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $833
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 118
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $830
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $827
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $824
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $821
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $818
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $815
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $812
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $809
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $806
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $803
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $800
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $797
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $794
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $791
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $788
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $785
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $782
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $779
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $776
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $773
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $770
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $767
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $764
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $761
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $758
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $755
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $736
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $732
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $728
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $724
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $720
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $716
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $713
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $708
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $705
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $702
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $699
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $696
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $693
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $690
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $687
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $684
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $681
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $678
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $675
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $672
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $669
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $666
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $663
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $660
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $657
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $654
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $648
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $645
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $638
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $635
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $632
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $629
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $626
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $623
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $620
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $617
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $614
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $611
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $608
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $605
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $602
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $599
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $596
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $593
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $590
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $587
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $584
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $581
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $578
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $575
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $572
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $569
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $566
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $563
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $560
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $557
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $554
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $551
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $548
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $545
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $542
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $539
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $536
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $533
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 121
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $530
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $527
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $513
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $505
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $502
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $492
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $489
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $486
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $483
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $473
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $470
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $467
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $464
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $461
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $456
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $453
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $450
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $447
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $444
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $441
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $438
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $428
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $425
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $422
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $419
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $416
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $413
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $410
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $407
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 50
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $404
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $401
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $398
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 53
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $395
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $391
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $385
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $364
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $317
+byte 1 42
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 0
+align 1
+LABELV $316
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $315
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 0
+align 1
+LABELV $314
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $313
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $312
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $311
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $308
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $302
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $301
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $299
+byte 1 47
+byte 1 49
+byte 1 47
+byte 1 50
+byte 1 47
+byte 1 52
+byte 1 47
+byte 1 51
+byte 1 47
+byte 1 54
+byte 1 47
+byte 1 55
+byte 1 47
+byte 1 56
+byte 1 47
+byte 1 57
+byte 1 47
+byte 1 53
+byte 1 47
+byte 1 0
+align 1
+LABELV $298
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $297
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $296
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $295
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $294
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $293
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 51
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $292
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $291
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $290
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $289
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 49
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $288
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $287
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 48
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $286
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $285
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 57
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $284
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 57
+byte 1 0
+align 1
+LABELV $283
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 56
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $282
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 56
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 55
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $280
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 55
+byte 1 0
+align 1
+LABELV $279
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 54
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $278
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 54
+byte 1 0
+align 1
+LABELV $277
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 53
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 53
+byte 1 0
+align 1
+LABELV $275
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 52
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $274
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 52
+byte 1 0
+align 1
+LABELV $273
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 51
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $272
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 51
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 50
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 50
+byte 1 0
+align 1
+LABELV $269
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $268
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 49
+byte 1 0
+align 1
+LABELV $267
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 105
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $266
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 80
+byte 1 117
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $265
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 109
+byte 1 115
+byte 1 103
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $263
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $262
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $261
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $260
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $258
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $257
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $256
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 78
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $255
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $254
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $253
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 119
+byte 1 100
+byte 1 0
+align 1
+LABELV $252
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 82
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $251
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $250
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $249
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 95
+byte 1 70
+byte 1 119
+byte 1 100
+byte 1 0
+align 1
+LABELV $248
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 69
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $247
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $245
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $244
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 67
+byte 1 104
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $242
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 83
+byte 1 117
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 65
+byte 1 119
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $241
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 66
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 78
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $240
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 71
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 78
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 69
+byte 1 110
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $238
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $236
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $235
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $234
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $233
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $232
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $231
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $230
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $229
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $228
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $224
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $223
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $222
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $221
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $220
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $219
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $218
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $217
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $216
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $215
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 81
+byte 1 0
+align 1
+LABELV $214
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 83
+byte 1 0
+align 1
+LABELV $213
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $212
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $211
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $210
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $209
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $206
+byte 1 69
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $205
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $204
+byte 1 86
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $203
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $201
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $200
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $198
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $197
+byte 1 42
+byte 1 0
+align 1
+LABELV $196
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $194
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $193
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 66
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $192
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $191
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $190
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $189
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $188
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $187
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $186
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $185
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $184
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $183
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $182
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $181
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $179
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $178
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $177
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $174
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $170
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $167
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $160
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $159
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $158
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $157
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $156
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $152
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $151
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $150
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $148
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $146
+byte 1 51
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $143
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $141
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $138
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $137
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $136
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $134
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $133
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $132
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $131
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $130
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $129
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $128
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $127
+byte 1 52
+byte 1 0
+align 1
+LABELV $126
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $124
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $122
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $121
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $120
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $118
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $117
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $116
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $112
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $110
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $109
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $108
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $106
+byte 1 49
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $104
+byte 1 48
+byte 1 0
+align 1
+LABELV $103
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $100
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
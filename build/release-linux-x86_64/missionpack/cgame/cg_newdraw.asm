@@ -0,0 +1,14374 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+export CG_InitTeamChat
+code
+proc CG_InitTeamChat 0 12
+ADDRGP4 teamChat1
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 256
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 teamChat2
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 256
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 systemChat
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 256
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $84
+endproc CG_InitTeamChat 0 12
+export CG_SetPrintString
+proc CG_SetPrintString 0 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRGP4 systemChat
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRGP4 teamChat2
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 teamChat1
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $87
+LABELV $85
+endproc CG_SetPrintString 0 12
+export CG_CheckOrderPending
+proc CG_CheckOrderPending 28 12
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $93
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+LEI4 $89
+LABELV $93
+ADDRGP4 $88
+JUMPV
+LABELV $89
+ADDRGP4 cgs+180216
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cgs+180212
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $97
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+GTI4 $97
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $125-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $125
+address $100
+address $104
+address $108
+address $112
+address $119
+address $122
+address $116
+code
+LABELV $100
+ADDRLP4 8
+ADDRGP4 $101
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $102
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $103
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $104
+ADDRLP4 8
+ADDRGP4 $105
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $106
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $107
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $108
+ADDRLP4 8
+ADDRGP4 $109
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $110
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $111
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $112
+ADDRLP4 8
+ADDRGP4 $113
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $114
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $115
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $116
+ADDRLP4 8
+ADDRGP4 $117
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $118
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $119
+ADDRLP4 8
+ADDRGP4 $120
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $121
+ASGNP4
+ADDRGP4 $98
+JUMPV
+LABELV $122
+ADDRLP4 8
+ADDRGP4 $123
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $124
+ASGNP4
+LABELV $97
+LABELV $98
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $127
+ADDRGP4 $130
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $128
+JUMPV
+LABELV $127
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $131
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $131
+ADDRGP4 $135
+ARGP4
+ADDRGP4 cgs+180212
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $130
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $137
+ADDRGP4 $139
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $137
+LABELV $132
+LABELV $128
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $141
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $141
+ADDRGP4 cgs+180216
+CNSTI4 0
+ASGNI4
+LABELV $94
+LABELV $88
+endproc CG_CheckOrderPending 28 12
+export CG_SetSelectedPlayerName
+proc CG_SetSelectedPlayerName 8 8
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $145
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $145
+ADDRLP4 0
+CNSTI4 2120
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $146
+ADDRGP4 $153
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $155
+ARGP4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cgs+180212
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRGP4 $153
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $146
+LABELV $144
+endproc CG_SetSelectedPlayerName 8 8
+export CG_GetSelectedPlayer
+proc CG_GetSelectedPlayer 0 0
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LTI4 $164
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $160
+LABELV $164
+ADDRGP4 cg_currentSelectedPlayer+12
+CNSTI4 0
+ASGNI4
+LABELV $160
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+RETI4
+LABELV $159
+endproc CG_GetSelectedPlayer 0 0
+export CG_SelectNextPlayer
+proc CG_SelectNextPlayer 4 0
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg_currentSelectedPlayer+12
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LEI4 $169
+ADDRGP4 cg_currentSelectedPlayer+12
+CNSTI4 0
+ASGNI4
+LABELV $169
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $167
+endproc CG_SelectNextPlayer 4 0
+export CG_SelectPrevPlayer
+proc CG_SelectPrevPlayer 4 0
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+CNSTI4 0
+LEI4 $174
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+GEI4 $174
+ADDRLP4 0
+ADDRGP4 cg_currentSelectedPlayer+12
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $175
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $173
+endproc CG_SelectPrevPlayer 4 0
+proc CG_DrawPlayerArmorIcon 36 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRGP4 $180
+JUMPV
+LABELV $181
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $188
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $184
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $184
+LABELV $188
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+188
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+184
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $191
+LABELV $185
+LABELV $180
+endproc CG_DrawPlayerArmorIcon 36 32
+proc CG_DrawPlayerArmorValue 32 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $205
+LABELV $202
+endproc CG_DrawPlayerArmorValue 32 32
+proc CG_DrawPlayerAmmoIcon 52 32
+ADDRLP4 0
+CNSTI4 936
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $213
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $209
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $209
+LABELV $213
+ADDRLP4 32
+CNSTI4 172
+ADDRGP4 cg+107636+144
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $210
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $219
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $222
+CNSTI4 172
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $222
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $222
+LABELV $219
+LABELV $210
+LABELV $207
+endproc CG_DrawPlayerAmmoIcon 52 32
+proc CG_DrawPlayerAmmoValue 36 32
+ADDRLP4 0
+CNSTI4 936
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+LEI4 $237
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $239
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $240
+LABELV $237
+LABELV $235
+LABELV $232
+endproc CG_DrawPlayerAmmoValue 36 32
+proc CG_DrawPlayerHead 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125280
+INDIRF4
+CNSTF4 0
+EQF4 $244
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125280
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $244
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+125280
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1067450368
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 20
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1069547520
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 20
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+ADDRGP4 cg+125284
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+125316
+CNSTF4 1110704128
+ADDRGP4 cg+125284
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125304
+CNSTF4 1101004800
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125300
+CNSTF4 1084227584
+ADDRLP4 60
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+125320
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+125308
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125308
+INDIRI4
+LTI4 $260
+ADDRGP4 cg+125316
+ADDRGP4 cg+125304
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125312
+ADDRGP4 cg+125300
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125320
+ADDRGP4 cg+125308
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+125308
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125304
+CNSTF4 1101004800
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+125300
+CNSTF4 1084227584
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+LABELV $260
+ADDRLP4 20
+CNSTF4 1067450368
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $245
+ADDRGP4 cg+125320
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $274
+ADDRGP4 cg+125320
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $274
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+125320
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+125308
+INDIRI4
+ADDRGP4 cg+125320
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+125316
+INDIRF4
+ADDRGP4 cg+125304
+INDIRF4
+ADDRGP4 cg+125316
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+125312
+INDIRF4
+ADDRGP4 cg+125300
+INDIRF4
+ADDRGP4 cg+125312
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $241
+endproc CG_DrawPlayerHead 68 24
+proc CG_DrawSelectedPlayerHealth 36 32
+ADDRLP4 24
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $297
+LABELV $294
+LABELV $292
+endproc CG_DrawSelectedPlayerHealth 36 32
+proc CG_DrawSelectedPlayerArmor 36 32
+ADDRLP4 24
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $300
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $302
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $305
+LABELV $302
+LABELV $300
+LABELV $298
+endproc CG_DrawSelectedPlayerArmor 36 32
+export CG_StatusHandle
+proc CG_StatusHandle 8 0
+ADDRLP4 0
+ADDRGP4 cgs+180272+1380
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $309
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+GTI4 $309
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $334-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $334
+address $311
+address $314
+address $317
+address $320
+address $326
+address $329
+address $323
+code
+LABELV $311
+ADDRLP4 0
+ADDRGP4 cgs+180272+1380
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $314
+ADDRLP4 0
+ADDRGP4 cgs+180272+1392
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $317
+ADDRLP4 0
+ADDRGP4 cgs+180272+1376
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $320
+ADDRLP4 0
+ADDRGP4 cgs+180272+1388
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $323
+ADDRLP4 0
+ADDRGP4 cgs+180272+1384
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $326
+ADDRLP4 0
+ADDRGP4 cgs+180272+1400
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $329
+ADDRLP4 0
+ADDRGP4 cgs+180272+1404
+INDIRI4
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 0
+ADDRGP4 cgs+180272+1380
+INDIRI4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $306
+endproc CG_StatusHandle 8 0
+proc CG_DrawSelectedPlayerStatus 16 20
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $338
+ADDRLP4 0
+INDIRP4
+CNSTI4 2100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $340
+ADDRGP4 $336
+JUMPV
+LABELV $340
+ADDRGP4 cgs+180216
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+180220
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $345
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $345
+ADDRGP4 $336
+JUMPV
+LABELV $345
+ADDRGP4 cgs+180212
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $343
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $338
+LABELV $336
+endproc CG_DrawSelectedPlayerStatus 16 20
+proc CG_DrawPlayerStatus 16 20
+ADDRLP4 0
+CNSTI4 2120
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRLP4 4
+ADDRGP4 cgs+180272+1408
+INDIRI4
+ASGNI4
+LABELV $356
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $354
+LABELV $351
+endproc CG_DrawPlayerStatus 16 20
+proc CG_DrawSelectedPlayerName 20 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 4
+ADDRGP4 cgs+180224
+INDIRI4
+ASGNI4
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $365
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $366
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $366
+LABELV $360
+endproc CG_DrawSelectedPlayerName 20 32
+proc CG_DrawSelectedPlayerLocation 24 32
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $370
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $374
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $372
+LABELV $374
+ADDRLP4 8
+ADDRGP4 $375
+ASGNP4
+LABELV $372
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $370
+LABELV $368
+endproc CG_DrawSelectedPlayerLocation 24 32
+proc CG_DrawPlayerLocation 20 32
+ADDRLP4 0
+CNSTI4 2120
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $379
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $383
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $381
+LABELV $383
+ADDRLP4 4
+ADDRGP4 $375
+ASGNP4
+LABELV $381
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $379
+LABELV $376
+endproc CG_DrawPlayerLocation 20 32
+proc CG_DrawSelectedPlayerWeapon 12 20
+ADDRLP4 4
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $386
+CNSTI4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $389
+LABELV $386
+LABELV $384
+endproc CG_DrawSelectedPlayerWeapon 12 20
+proc CG_DrawPlayerScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $397
+LABELV $394
+endproc CG_DrawPlayerScore 28 32
+proc CG_DrawPlayerItem 36 32
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 4+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $403
+LABELV $400
+LABELV $398
+endproc CG_DrawPlayerItem 36 32
+proc CG_DrawSelectedPlayerPowerup 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $416
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $420
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $422
+ADDRLP4 24
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 40
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $412
+JUMPV
+LABELV $422
+LABELV $420
+LABELV $417
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $416
+LABELV $414
+LABELV $412
+endproc CG_DrawSelectedPlayerPowerup 44 20
+proc CG_DrawSelectedPlayerHead 80 32
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 60
+ADDRGP4 cgs+180224
+INDIRI4
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 64
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $429
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $430
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $432
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $435
+ADDRGP4 $424
+JUMPV
+LABELV $435
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $451
+LABELV $433
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+196
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $454
+LABELV $430
+LABELV $424
+endproc CG_DrawSelectedPlayerHead 80 32
+proc CG_DrawPlayerHealth 32 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $460
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $461
+LABELV $458
+endproc CG_DrawPlayerHealth 32 32
+proc CG_DrawRedScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+34984
+INDIRI4
+CNSTI4 -9999
+NEI4 $463
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $466
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 cgs+34984
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $464
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $462
+endproc CG_DrawRedScore 28 32
+proc CG_DrawBlueScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+34988
+INDIRI4
+CNSTI4 -9999
+NEI4 $469
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $466
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 cgs+34988
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $470
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $468
+endproc CG_DrawBlueScore 28 32
+proc CG_DrawRedName 4 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $473
+endproc CG_DrawRedName 4 32
+proc CG_DrawBlueName 4 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $475
+endproc CG_DrawBlueName 4 32
+proc CG_DrawBlueFlagName 16 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $478
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $483
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $483
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+140
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $483
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $477
+JUMPV
+LABELV $483
+LABELV $479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $481
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $478
+LABELV $477
+endproc CG_DrawBlueFlagName 16 32
+lit
+align 4
+LABELV $501
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $508
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawBlueFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $493
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $493
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $493
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $492
+ADDRLP4 0
+ADDRGP4 $501
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $492
+JUMPV
+LABELV $493
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $504
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $504
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $506
+ADDRLP4 8
+ADDRGP4 $508
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 0
+LTI4 $509
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 2
+GTI4 $509
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+1412
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+1412
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $510
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $506
+LABELV $505
+LABELV $492
+endproc CG_DrawBlueFlagStatus 28 20
+proc CG_DrawBlueFlagHead 36 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $519
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $524
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $524
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+140
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $524
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $518
+JUMPV
+LABELV $524
+LABELV $520
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $522
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $519
+LABELV $518
+endproc CG_DrawBlueFlagHead 36 24
+proc CG_DrawRedFlagName 16 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $536
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $541
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $541
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+140
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $541
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $535
+JUMPV
+LABELV $541
+LABELV $537
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $539
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $536
+LABELV $535
+endproc CG_DrawRedFlagName 16 32
+lit
+align 4
+LABELV $559
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $566
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_DrawRedFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $551
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $551
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $551
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $550
+ADDRLP4 0
+ADDRGP4 $559
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+28
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $550
+JUMPV
+LABELV $551
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $562
+CNSTI4 7
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $564
+ADDRLP4 8
+ADDRGP4 $566
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 0
+LTI4 $567
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+GTI4 $567
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+1412
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $568
+JUMPV
+LABELV $567
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+1412
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $568
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $564
+LABELV $563
+LABELV $550
+endproc CG_DrawRedFlagStatus 28 20
+proc CG_DrawRedFlagHead 36 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $577
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $582
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $582
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+140
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $582
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $576
+JUMPV
+LABELV $582
+LABELV $578
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $580
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $577
+LABELV $576
+endproc CG_DrawRedFlagHead 36 24
+proc CG_HarvesterSkulls 72 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+EQI4 $595
+ADDRGP4 $593
+JUMPV
+LABELV $595
+ADDRLP4 0
+INDIRI4
+CNSTI4 99
+LEI4 $598
+ADDRLP4 0
+CNSTI4 99
+ASGNI4
+LABELV $598
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $600
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $603
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $603
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 20+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $612
+ADDRLP4 44
+ADDRGP4 cgs+180272+20
+INDIRI4
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $612
+ADDRLP4 44
+ADDRGP4 cgs+180272+24
+INDIRI4
+ASGNI4
+LABELV $613
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 1108082688
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $619
+ADDRLP4 44
+ADDRGP4 cgs+180272+28
+INDIRI4
+ASGNI4
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRLP4 44
+ADDRGP4 cgs+180272+32
+INDIRI4
+ASGNI4
+LABELV $620
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $604
+LABELV $600
+LABELV $593
+endproc CG_HarvesterSkulls 72 32
+lit
+align 4
+LABELV $637
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_OneFlagStatus 32 20
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $627
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $627
+ADDRGP4 $626
+JUMPV
+LABELV $627
+CNSTI4 9
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $631
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 0
+LTI4 $633
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 4
+GTI4 $633
+ADDRLP4 8
+ADDRGP4 $637
+INDIRB
+ASGNB 16
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 2
+NEI4 $638
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 3
+NEI4 $643
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 4
+NEI4 $647
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+LABELV $647
+LABELV $644
+LABELV $639
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+180272+1412
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $633
+LABELV $631
+LABELV $626
+endproc CG_OneFlagStatus 32 20
+proc CG_DrawCTFPowerUp 8 20
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $657
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+LEI4 $653
+LABELV $657
+ADDRGP4 $652
+JUMPV
+LABELV $653
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $659
+LABELV $652
+endproc CG_DrawCTFPowerUp 8 20
+proc CG_DrawTeamColor 8 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+LABELV $662
+endproc CG_DrawTeamColor 8 24
+proc CG_DrawAreaPowerUp 240 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $670
+ADDRLP4 200
+ADDRLP4 148+4
+ASGNP4
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRLP4 200
+ADDRLP4 148
+ASGNP4
+LABELV $671
+ADDRLP4 192
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $673
+ADDRGP4 $664
+JUMPV
+LABELV $673
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $675
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $679
+ADDRGP4 $676
+JUMPV
+LABELV $679
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LEI4 $684
+ADDRLP4 140
+INDIRI4
+CNSTI4 999000
+LTI4 $682
+LABELV $684
+ADDRGP4 $676
+JUMPV
+LABELV $682
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $688
+JUMPV
+LABELV $685
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $689
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+ADDRLP4 212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $692
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $694
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $691
+ADDRGP4 $687
+JUMPV
+LABELV $689
+LABELV $686
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $688
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $685
+LABELV $687
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $676
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $675
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $697
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $701
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $703
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 188
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 216+12
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $704
+ADDRLP4 168
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ARGF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 148+12
+INDIRF4
+ARGF4
+ADDRLP4 216
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 148
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ADDRLP4 148+12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+ADDRLP4 148+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $701
+LABELV $698
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $700
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $697
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $664
+endproc CG_DrawAreaPowerUp 240 32
+export CG_GetValue
+proc CG_GetValue 44 0
+ADDRLP4 4
+CNSTI4 936
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 20
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $730
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $738
+LABELV $737
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $726
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $732
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+EQI4 $727
+ADDRGP4 $721
+JUMPV
+LABELV $738
+ADDRLP4 24
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 27
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $735
+ADDRLP4 24
+INDIRI4
+CNSTI4 28
+EQI4 $733
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $721
+LABELV $739
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 40
+EQI4 $722
+ADDRLP4 32
+INDIRI4
+CNSTI4 41
+EQI4 $724
+ADDRGP4 $721
+JUMPV
+LABELV $722
+ADDRLP4 36
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2120
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $724
+ADDRLP4 40
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2120
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $726
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $727
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $721
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $730
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $732
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $733
+ADDRGP4 cgs+34984
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $735
+ADDRGP4 cgs+34988
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $717
+JUMPV
+LABELV $721
+CNSTF4 3212836864
+RETF4
+LABELV $717
+endproc CG_GetValue 44 0
+export CG_OtherTeamHasFlag
+proc CG_OtherTeamHasFlag 8 0
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $747
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $747
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $741
+LABELV $747
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $749
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $752
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 3
+NEI4 $752
+CNSTI4 1
+RETI4
+ADDRGP4 $740
+JUMPV
+LABELV $752
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $755
+ADDRGP4 cgs+35000
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $755
+CNSTI4 1
+RETI4
+ADDRGP4 $740
+JUMPV
+LABELV $755
+CNSTI4 0
+RETI4
+ADDRGP4 $740
+JUMPV
+LABELV $749
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $758
+ADDRGP4 cgs+34992
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $758
+CNSTI4 1
+RETI4
+ADDRGP4 $740
+JUMPV
+LABELV $758
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $761
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 1
+NEI4 $761
+CNSTI4 1
+RETI4
+ADDRGP4 $740
+JUMPV
+LABELV $761
+CNSTI4 0
+RETI4
+ADDRGP4 $740
+JUMPV
+LABELV $741
+CNSTI4 0
+RETI4
+LABELV $740
+endproc CG_OtherTeamHasFlag 8 0
+export CG_YourTeamHasFlag
+proc CG_YourTeamHasFlag 8 0
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $771
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $771
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $765
+LABELV $771
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $773
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $776
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 2
+NEI4 $776
+CNSTI4 1
+RETI4
+ADDRGP4 $764
+JUMPV
+LABELV $776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $779
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 3
+NEI4 $779
+CNSTI4 1
+RETI4
+ADDRGP4 $764
+JUMPV
+LABELV $779
+CNSTI4 0
+RETI4
+ADDRGP4 $764
+JUMPV
+LABELV $773
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $782
+ADDRGP4 cgs+34996
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $782
+CNSTI4 1
+RETI4
+ADDRGP4 $764
+JUMPV
+LABELV $782
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $785
+ADDRGP4 cgs+34992
+INDIRI4
+CNSTI4 1
+NEI4 $785
+CNSTI4 1
+RETI4
+ADDRGP4 $764
+JUMPV
+LABELV $785
+CNSTI4 0
+RETI4
+ADDRGP4 $764
+JUMPV
+LABELV $765
+CNSTI4 0
+RETI4
+LABELV $764
+endproc CG_YourTeamHasFlag 8 0
+export CG_OwnerDrawVisible
+proc CG_OwnerDrawVisible 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $789
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $793
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $794
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $789
+ADDRFP4 0
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $795
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+EQI4 $799
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $799
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $800
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $795
+ADDRFP4 0
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $801
+ADDRLP4 0
+ADDRGP4 CG_OtherTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $801
+ADDRFP4 0
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $803
+ADDRLP4 0
+ADDRGP4 CG_YourTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $803
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $805
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $807
+ADDRGP4 cgs+34992
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $811
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 2
+NEI4 $807
+LABELV $811
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $807
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $812
+ADDRGP4 cgs+34996
+INDIRI4
+CNSTI4 1
+EQI4 $816
+ADDRGP4 cgs+35000
+INDIRI4
+CNSTI4 3
+NEI4 $812
+LABELV $816
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $812
+CNSTI4 0
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $805
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $817
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $819
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $819
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $819
+LABELV $817
+ADDRFP4 0
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $823
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $829
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $825
+LABELV $829
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $825
+LABELV $823
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $830
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $832
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $832
+CNSTI4 0
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $830
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $835
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $837
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $837
+CNSTI4 0
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $835
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $840
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $846
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $842
+LABELV $846
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $842
+LABELV $840
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $847
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+NEI4 $849
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $849
+CNSTI4 0
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $847
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $852
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 25
+GEI4 $854
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $854
+LABELV $852
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $857
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 25
+LTI4 $859
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $859
+LABELV $857
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $862
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $864
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $864
+LABELV $862
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $867
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $869
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $869
+LABELV $867
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $872
+LABELV $872
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $874
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $882
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $882
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $876
+LABELV $882
+CNSTI4 1
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $876
+LABELV $874
+CNSTI4 0
+RETI4
+LABELV $788
+endproc CG_OwnerDrawVisible 4 0
+proc CG_DrawPlayerHasFlag 16 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $885
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $886
+JUMPV
+LABELV $885
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+LABELV $886
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107636+312+28
+INDIRI4
+CNSTI4 0
+EQI4 $887
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $888
+JUMPV
+LABELV $887
+ADDRGP4 cg+107636+312+32
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $892
+ADDRGP4 cg+107636+312+36
+INDIRI4
+CNSTI4 0
+EQI4 $897
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $897
+LABELV $893
+LABELV $888
+LABELV $883
+endproc CG_DrawPlayerHasFlag 16 24
+proc CG_DrawAreaSystemChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 systemChat
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $902
+endproc CG_DrawAreaSystemChat 8 32
+proc CG_DrawAreaTeamChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $903
+endproc CG_DrawAreaTeamChat 8 32
+proc CG_DrawAreaChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat2
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $904
+endproc CG_DrawAreaChat 8 32
+export CG_GetKillerText
+proc CG_GetKillerText 8 8
+ADDRLP4 0
+ADDRGP4 $906
+ASGNP4
+ADDRGP4 cg+114924
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $907
+ADDRGP4 $910
+ARGP4
+ADDRGP4 cg+114924
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $907
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $905
+endproc CG_GetKillerText 8 8
+proc CG_DrawKiller 24 32
+ADDRGP4 cg+114924
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $913
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $913
+LABELV $912
+endproc CG_DrawKiller 24 32
+proc CG_DrawCapFragLimit 16 32
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $922
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+NEI4 $922
+ADDRLP4 4
+ADDRGP4 cgs+31480
+INDIRI4
+ASGNI4
+ADDRGP4 $923
+JUMPV
+LABELV $922
+ADDRLP4 4
+ADDRGP4 cgs+31476
+INDIRI4
+ASGNI4
+LABELV $923
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $916
+endproc CG_DrawCapFragLimit 16 32
+proc CG_Draw1stPlace 8 32
+ADDRGP4 cgs+34984
+INDIRI4
+CNSTI4 -9999
+EQI4 $926
+ADDRGP4 $924
+ARGP4
+ADDRGP4 cgs+34984
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $926
+LABELV $925
+endproc CG_Draw1stPlace 8 32
+proc CG_Draw2ndPlace 8 32
+ADDRGP4 cgs+34988
+INDIRI4
+CNSTI4 -9999
+EQI4 $931
+ADDRGP4 $924
+ARGP4
+ADDRGP4 cgs+34988
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $931
+LABELV $930
+endproc CG_Draw2ndPlace 8 32
+export CG_GetGameStatusText
+proc CG_GetGameStatusText 12 12
+ADDRLP4 0
+ADDRGP4 $906
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $940
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $936
+LABELV $940
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $937
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $944
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $937
+JUMPV
+LABELV $936
+ADDRGP4 cg+110680
+INDIRI4
+ADDRGP4 cg+110680+4
+INDIRI4
+NEI4 $947
+ADDRGP4 $952
+ARGP4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $948
+JUMPV
+LABELV $947
+ADDRGP4 cg+110680
+INDIRI4
+ADDRGP4 cg+110680+4
+INDIRI4
+LTI4 $954
+ADDRGP4 $959
+ARGP4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRGP4 cg+110680+4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRGP4 $963
+ARGP4
+ADDRGP4 cg+110680+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+110680
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $955
+LABELV $948
+LABELV $937
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $935
+endproc CG_GetGameStatusText 12 12
+proc CG_DrawGameStatus 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 CG_GetGameStatusText
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $967
+endproc CG_DrawGameStatus 8 32
+export CG_GameTypeString
+proc CG_GameTypeString 0 0
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 0
+NEI4 $969
+ADDRGP4 $972
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $969
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+NEI4 $973
+ADDRGP4 $976
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $973
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $977
+ADDRGP4 $980
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $977
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+NEI4 $981
+ADDRGP4 $984
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $981
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 6
+NEI4 $985
+ADDRGP4 $988
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $985
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $989
+ADDRGP4 $992
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $989
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+NEI4 $993
+ADDRGP4 $996
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $993
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $997
+ADDRGP4 $1000
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $997
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+NEI4 $1001
+ADDRGP4 $1004
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $1001
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $1005
+ADDRGP4 $1008
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $1005
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 12
+NEI4 $1009
+ADDRGP4 $1012
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $1009
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $1013
+ADDRGP4 $1016
+RETP4
+ADDRGP4 $968
+JUMPV
+LABELV $1013
+ADDRGP4 $906
+RETP4
+LABELV $968
+endproc CG_GameTypeString 0 0
+proc CG_DrawGameType 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 CG_GameTypeString
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1017
+endproc CG_DrawGameType 8 32
+proc CG_Text_Paint_Limit 76 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1019
+ADDRLP4 28
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cgDC+228+56
+ASGNP4
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $1023
+ADDRLP4 36
+ADDRGP4 cgDC+228+20604
+ASGNP4
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LEF4 $1028
+ADDRLP4 36
+ADDRGP4 cgDC+228+41152
+ASGNP4
+LABELV $1028
+LABELV $1024
+ADDRLP4 32
+ADDRFP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $1033
+ADDRLP4 24
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $1033
+ADDRLP4 24
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $1033
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1035
+ADDRLP4 0
+CNSTI4 80
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1038
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $1038
+ADDRLP4 56
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1038
+ADDRLP4 56
+INDIRI4
+CNSTI4 48
+LTI4 $1038
+ADDRLP4 56
+INDIRI4
+CNSTI4 56
+GTI4 $1038
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 9
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $1036
+JUMPV
+LABELV $1038
+ADDRLP4 60
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+LEF4 $1041
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1037
+JUMPV
+LABELV $1041
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintChar
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $1036
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1044
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1044
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $1035
+LABELV $1044
+LABELV $1037
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1019
+LABELV $1018
+endproc CG_Text_Paint_Limit 76 40
+export CG_DrawNewTeamInfo
+proc CG_DrawNewTeamInfo 112 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $1047
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1048
+JUMPV
+LABELV $1047
+ADDRLP4 72
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $1048
+ADDRLP4 32
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1052
+JUMPV
+LABELV $1049
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1054
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $1054
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 64
+INDIRF4
+LEF4 $1057
+ADDRLP4 64
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1057
+LABELV $1054
+LABELV $1050
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1052
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $1049
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $1059
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1063
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1063
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+LEF4 $1065
+ADDRLP4 68
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1065
+LABELV $1063
+LABELV $1060
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $1059
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1070
+JUMPV
+LABELV $1067
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $1072
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1075
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1079
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1081
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+LABELV $1081
+LABELV $1079
+LABELV $1076
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $1075
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1108344832
+ADDF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 84
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+696
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 2100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1085
+ADDRLP4 44
+ADDRGP4 cgs+180272+1408
+INDIRI4
+ASGNI4
+ADDRGP4 $1086
+JUMPV
+LABELV $1085
+ADDRGP4 cgs+180216
+INDIRI4
+CNSTI4 0
+EQI4 $1089
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+180220
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $1092
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1092
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1092
+ADDRGP4 cgs+180212
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1089
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 88
+INDIRI4
+ASGNI4
+LABELV $1090
+LABELV $1086
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1098
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1098
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 88
+INDIRF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1102
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1100
+LABELV $1102
+ADDRLP4 20
+ADDRGP4 $375
+ASGNP4
+LABELV $1100
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+CNSTF4 1073741824
+ADDF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $1103
+ADDRGP4 $1069
+JUMPV
+LABELV $1103
+LABELV $1072
+LABELV $1068
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1070
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $1067
+LABELV $1069
+LABELV $1045
+endproc CG_DrawNewTeamInfo 112 32
+export CG_DrawTeamSpectators
+proc CG_DrawTeamSpectators 20 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+115980
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+ADDRGP4 cg+115984
+INDIRF4
+CNSTF4 3212836864
+NEF4 $1109
+ADDRGP4 cg+115984
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+115992
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+115996
+CNSTI4 -1
+ASGNI4
+LABELV $1109
+ADDRGP4 cg+116000
+INDIRI4
+ADDRGP4 cg+115980
+INDIRI4
+LEI4 $1115
+ADDRGP4 cg+116000
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+115992
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+115996
+CNSTI4 -1
+ASGNI4
+LABELV $1115
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+115988
+INDIRI4
+LEI4 $1122
+ADDRGP4 cg+115988
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRGP4 cg+115992
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+GTF4 $1128
+ADDRGP4 cg+116000
+INDIRI4
+ADDRGP4 cg+115980
+INDIRI4
+GEI4 $1131
+ADDRGP4 cg+116000
+INDIRI4
+ADDRGP4 cg+114956
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+115992
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+116000
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1129
+JUMPV
+LABELV $1131
+ADDRGP4 cg+116000
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+115996
+INDIRI4
+CNSTI4 0
+LTI4 $1140
+ADDRGP4 cg+115992
+ADDRGP4 cg+115996
+INDIRI4
+ASGNI4
+ADDRGP4 $1141
+JUMPV
+LABELV $1140
+ADDRGP4 cg+115992
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $1141
+ADDRGP4 cg+115996
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1129
+JUMPV
+LABELV $1128
+ADDRLP4 4
+ADDRGP4 cg+115992
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+115996
+INDIRI4
+CNSTI4 0
+LTI4 $1148
+ADDRLP4 8
+ADDRGP4 cg+115996
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1148
+LABELV $1129
+LABELV $1122
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+115992
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg+116000
+INDIRI4
+ADDRGP4 cg+114956
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRGP4 cg+115996
+INDIRI4
+CNSTI4 0
+LTI4 $1155
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 cg+115996
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg+114956
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 cg+116000
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+LABELV $1155
+ADDRGP4 cg+116000
+INDIRI4
+CNSTI4 0
+EQI4 $1161
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1161
+ADDRGP4 cg+115996
+INDIRI4
+CNSTI4 -1
+NEI4 $1162
+ADDRGP4 cg+115996
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1161
+ADDRGP4 cg+115996
+CNSTI4 -1
+ASGNI4
+LABELV $1162
+LABELV $1106
+LABELV $1105
+endproc CG_DrawTeamSpectators 20 32
+export CG_DrawMedal
+proc CG_DrawMedal 32 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+110676
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 53
+LTI4 $1172
+ADDRLP4 12
+INDIRI4
+CNSTI4 59
+GTI4 $1182
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1183-212
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1183
+address $1174
+address $1175
+address $1176
+address $1177
+address $1178
+address $1179
+address $1180
+code
+LABELV $1182
+ADDRFP4 0
+INDIRI4
+CNSTI4 69
+EQI4 $1181
+ADDRGP4 $1172
+JUMPV
+LABELV $1174
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1175
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1176
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1177
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1178
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1179
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1180
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1173
+JUMPV
+LABELV $1181
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1172
+LABELV $1173
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1185
+ADDRFP4 0
+INDIRI4
+CNSTI4 58
+EQI4 $1187
+ADDRFP4 0
+INDIRI4
+CNSTI4 53
+NEI4 $1189
+ADDRGP4 $1191
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1188
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1188
+JUMPV
+LABELV $1189
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1188
+JUMPV
+LABELV $1187
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $1194
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1194
+ADDRLP4 4
+ADDRGP4 $1196
+ASGNP4
+LABELV $1188
+LABELV $1185
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1197
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1092616192
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1197
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1169
+endproc CG_DrawMedal 32 32
+proc CG_DrawProgressBar 84 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1101004800
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1058642330
+GEF4 $1200
+ADDRLP4 0
+CNSTF4 1058642330
+ASGNF4
+LABELV $1200
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+CNSTF4 0
+LTF4 $1202
+ADDRLP4 0
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1202
+ADDRFP4 24
+INDIRF4
+CNSTF4 0
+GEF4 $1204
+ADDRFP4 24
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1205
+JUMPV
+LABELV $1204
+ADDRFP4 24
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1206
+ADDRFP4 24
+CNSTF4 1065353216
+ASGNF4
+LABELV $1206
+LABELV $1205
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $1208
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1209
+JUMPV
+LABELV $1208
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1209
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $1226
+ADDRLP4 12
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 $1228
+ARGP4
+CNSTF4 1120403456
+ADDRFP4 24
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1109393408
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1231
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+EQI4 $1233
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+EQI4 $1232
+ADDRGP4 $1229
+JUMPV
+LABELV $1231
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $1230
+JUMPV
+LABELV $1232
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1092616192
+DIVF4
+SUBF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 68
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $1230
+JUMPV
+LABELV $1233
+ADDRLP4 76
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 76
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 76
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $1230
+JUMPV
+LABELV $1229
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRF4
+ASGNF4
+LABELV $1230
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1226
+LABELV $1199
+endproc CG_DrawProgressBar 84 32
+lit
+align 4
+LABELV $1235
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawProgressLabel 44 32
+ADDRLP4 0
+ADDRGP4 $1235
+INDIRB
+ASGNB 16
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1238
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $1240
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $1239
+ADDRGP4 $1236
+JUMPV
+LABELV $1238
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1237
+JUMPV
+LABELV $1239
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1237
+JUMPV
+LABELV $1240
+ADDRLP4 32
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 32
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1237
+JUMPV
+LABELV $1236
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+LABELV $1237
+ADDRFP4 28
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1241
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $1242
+JUMPV
+LABELV $1241
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1242
+LABELV $1234
+endproc CG_DrawProgressLabel 44 32
+proc CG_DrawMediaProgress 0 28
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+156512
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawProgressBar
+CALLV
+pop
+LABELV $1243
+endproc CG_DrawMediaProgress 0 28
+proc CG_DrawMediaProgressLabel 0 32
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 $1246
+ARGP4
+ADDRGP4 cg+156512
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawProgressLabel
+CALLV
+pop
+LABELV $1245
+endproc CG_DrawMediaProgressLabel 0 32
+proc CG_DrawSoundProgress 0 28
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+156516
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawProgressBar
+CALLV
+pop
+LABELV $1248
+endproc CG_DrawSoundProgress 0 28
+proc CG_DrawSoundProgressLabel 0 32
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 $1251
+ARGP4
+ADDRGP4 cg+156516
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawProgressLabel
+CALLV
+pop
+LABELV $1250
+endproc CG_DrawSoundProgressLabel 0 32
+proc CG_DrawGraphicProgress 0 28
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+156520
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawProgressBar
+CALLV
+pop
+LABELV $1253
+endproc CG_DrawGraphicProgress 0 28
+proc CG_DrawGraphicProgressLabel 0 32
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 $1256
+ARGP4
+ADDRGP4 cg+156520
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawProgressLabel
+CALLV
+pop
+LABELV $1255
+endproc CG_DrawGraphicProgressLabel 0 32
+proc CG_DrawLevelShot 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1259
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $1260
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1261
+ADDRGP4 $1263
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $1261
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $1264
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1258
+endproc CG_DrawLevelShot 48 20
+proc CG_DrawLoadingString 1076 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1266
+ADDRGP4 $1265
+JUMPV
+LABELV $1266
+ADDRLP4 4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1268
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Q_snprintf
+CALLI4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1048
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1044
+CNSTF4 1109393408
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRGP4 $1270
+JUMPV
+LABELV $1269
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1268
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ADDRFP4 28
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Q_snprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1056
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1273
+JUMPV
+LABELV $1272
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1060
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1275
+ADDRGP4 $1274
+JUMPV
+LABELV $1275
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1064
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1273
+ADDRLP4 1028
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GTF4 $1272
+LABELV $1274
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1279
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $1281
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $1280
+ADDRGP4 $1277
+JUMPV
+LABELV $1279
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1278
+JUMPV
+LABELV $1280
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1028
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1278
+JUMPV
+LABELV $1281
+ADDRLP4 1072
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 1072
+INDIRF4
+DIVF4
+ADDF4
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 1072
+INDIRF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1278
+JUMPV
+LABELV $1277
+ADDRLP4 1040
+CNSTF4 0
+ASGNF4
+LABELV $1278
+ADDRLP4 1040
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRLP4 1044
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+MULF4
+ADDF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1068
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1270
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LTI4 $1269
+LABELV $1265
+endproc CG_DrawLoadingString 1076 32
+proc CG_DrawLevelName 8 32
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawLoadingString
+CALLV
+pop
+LABELV $1282
+endproc CG_DrawLevelName 8 32
+proc CG_DrawMOTD 8 32
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawLoadingString
+CALLV
+pop
+LABELV $1283
+endproc CG_DrawMOTD 8 32
+proc CG_DrawHostname 1036 32
+CNSTI4 0
+ARGI4
+ADDRLP4 1028
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $1285
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawLoadingString
+CALLV
+pop
+LABELV $1284
+endproc CG_DrawHostname 1036 32
+proc CG_DrawTimeLimit 40 32
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1287
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1288
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $1290
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawLoadingString
+CALLV
+pop
+LABELV $1288
+LABELV $1286
+endproc CG_DrawTimeLimit 40 32
+proc CG_DrawFragLimit 24 32
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1292
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1293
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawLoadingString
+CALLV
+pop
+LABELV $1293
+LABELV $1291
+endproc CG_DrawFragLimit 24 32
+proc CG_DrawCaptureLimit 40 32
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1296
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $1297
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+NEI4 $1297
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1296
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1297
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $1305
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+LEI4 $1301
+LABELV $1305
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $1292
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $1301
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1306
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawLoadingString
+CALLV
+pop
+LABELV $1306
+LABELV $1295
+endproc CG_DrawCaptureLimit 40 32
+export CG_OwnerDraw
+proc CG_OwnerDraw 20 28
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $1309
+ADDRGP4 $1308
+JUMPV
+LABELV $1309
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $1316
+ADDRLP4 16
+INDIRI4
+CNSTI4 88
+GTI4 $1316
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1386-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1386
+address $1317
+address $1319
+address $1333
+address $1336
+address $1320
+address $1322
+address $1323
+address $1329
+address $1330
+address $1326
+address $1331
+address $1332
+address $1316
+address $1316
+address $1316
+address $1316
+address $1316
+address $1316
+address $1334
+address $1335
+address $1341
+address $1342
+address $1343
+address $1344
+address $1345
+address $1346
+address $1338
+address $1337
+address $1339
+address $1340
+address $1347
+address $1349
+address $1350
+address $1351
+address $1352
+address $1353
+address $1316
+address $1355
+address $1360
+address $1327
+address $1328
+address $1354
+address $1316
+address $1316
+address $1316
+address $1357
+address $1358
+address $1359
+address $1361
+address $1362
+address $1318
+address $1321
+address $1363
+address $1363
+address $1363
+address $1363
+address $1363
+address $1363
+address $1363
+address $1364
+address $1365
+address $1324
+address $1325
+address $1356
+address $1348
+address $1369
+address $1370
+address $1371
+address $1363
+address $1316
+address $1316
+address $1316
+address $1316
+address $1316
+address $1372
+address $1373
+address $1374
+address $1379
+address $1380
+address $1381
+address $1375
+address $1376
+address $1377
+address $1378
+address $1385
+address $1383
+address $1382
+address $1384
+code
+LABELV $1317
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1318
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1319
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorValue
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1320
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1321
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1322
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoValue
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1323
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1324
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1325
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1326
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerStatus
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1327
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerArmor
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1328
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHealth
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1329
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1330
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerLocation
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1331
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerWeapon
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1332
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerPowerup
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1333
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerHead
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1334
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerItem
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1335
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerScore
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1336
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerHealth
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1337
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedScore
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1338
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueScore
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1339
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1340
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1341
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawBlueFlagHead
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1342
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagStatus
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1343
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1344
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawRedFlagHead
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1345
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagStatus
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1346
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1347
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1348
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1349
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_OneFlagStatus
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1350
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerLocation
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1351
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTeamColor
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1352
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawCTFPowerUp
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1353
+ADDRLP4 0
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaPowerUp
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1354
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawPlayerStatus
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1355
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1356
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1357
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaSystemChat
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1358
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaTeamChat
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1359
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaChat
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1360
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameType
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1361
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameStatus
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1362
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawKiller
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1363
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawMedal
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1364
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamSpectators
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1365
+ADDRGP4 cg_currentSelectedPlayer+12
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+NEI4 $1316
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawNewTeamInfo
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1369
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawCapFragLimit
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1370
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw1stPlace
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1371
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2ndPlace
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1372
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawLevelShot
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1373
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_DrawMediaProgress
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1374
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawMediaProgressLabel
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1375
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_DrawSoundProgress
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1376
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSoundProgressLabel
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1377
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_DrawGraphicProgress
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1378
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGraphicProgressLabel
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1379
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawLevelName
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1380
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawMOTD
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1381
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawHostname
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1382
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTimeLimit
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1383
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFragLimit
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1384
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawCaptureLimit
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1385
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawHostname
+CALLV
+pop
+LABELV $1316
+LABELV $1308
+endproc CG_OwnerDraw 20 28
+export CG_MouseEvent
+proc CG_MouseEvent 16 12
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 0
+EQI4 $1396
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 2
+NEI4 $1389
+LABELV $1396
+ADDRGP4 cg+114784
+INDIRI4
+CNSTI4 0
+NEI4 $1389
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1388
+JUMPV
+LABELV $1389
+ADDRLP4 4
+ADDRGP4 cgs+178804
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+178804
+INDIRI4
+CNSTI4 0
+GEI4 $1398
+ADDRGP4 cgs+178804
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1399
+JUMPV
+LABELV $1398
+ADDRGP4 cgs+178804
+INDIRI4
+CNSTI4 640
+LEI4 $1402
+ADDRGP4 cgs+178804
+CNSTI4 640
+ASGNI4
+LABELV $1402
+LABELV $1399
+ADDRLP4 8
+ADDRGP4 cgs+178808
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+178808
+INDIRI4
+CNSTI4 0
+GEI4 $1407
+ADDRGP4 cgs+178808
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1408
+JUMPV
+LABELV $1407
+ADDRGP4 cgs+178808
+INDIRI4
+CNSTI4 480
+LEI4 $1411
+ADDRGP4 cgs+178808
+CNSTI4 480
+ASGNI4
+LABELV $1411
+LABELV $1408
+ADDRGP4 cgs+178804
+INDIRI4
+ARGI4
+ADDRGP4 cgs+178808
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Display_CursorType
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+178828
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1418
+ADDRGP4 cgs+178828
+ADDRGP4 cgs+180272+1448
+INDIRI4
+ASGNI4
+ADDRGP4 $1419
+JUMPV
+LABELV $1418
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $1423
+ADDRGP4 cgs+178828
+ADDRGP4 cgs+180272+1452
+INDIRI4
+ASGNI4
+LABELV $1423
+LABELV $1419
+ADDRGP4 cgs+178824
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1428
+ADDRGP4 cgs+178824
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1429
+JUMPV
+LABELV $1428
+CNSTP4 0
+ARGP4
+ADDRGP4 cgs+178804
+INDIRI4
+ARGI4
+ADDRGP4 cgs+178808
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $1429
+LABELV $1388
+endproc CG_MouseEvent 16 12
+export CG_HideTeamMenu
+proc CG_HideTeamMenu 0 4
+ADDRGP4 $1435
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $1436
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $1434
+endproc CG_HideTeamMenu 0 4
+export CG_ShowTeamMenu
+proc CG_ShowTeamMenu 0 4
+ADDRGP4 $1435
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $1437
+endproc CG_ShowTeamMenu 0 4
+export CG_EventHandling
+proc CG_EventHandling 0 0
+ADDRGP4 cgs+178812
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1440
+ADDRGP4 CG_HideTeamMenu
+CALLV
+pop
+ADDRGP4 $1441
+JUMPV
+LABELV $1440
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1442
+ADDRGP4 $1443
+JUMPV
+LABELV $1442
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1444
+LABELV $1444
+LABELV $1443
+LABELV $1441
+LABELV $1438
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 8 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1447
+ADDRGP4 $1446
+JUMPV
+LABELV $1447
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107636+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1456
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 2
+NEI4 $1449
+ADDRGP4 cg+114784
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1449
+LABELV $1456
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1446
+JUMPV
+LABELV $1449
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+178804
+INDIRI4
+ARGI4
+ADDRGP4 cgs+178808
+INDIRI4
+ARGI4
+ADDRGP4 Display_HandleKey
+CALLV
+pop
+ADDRGP4 cgs+178824
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1459
+ADDRGP4 cgs+178824
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1460
+JUMPV
+LABELV $1459
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+NEI4 $1463
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1463
+ADDRGP4 cgs+178804
+INDIRI4
+ARGI4
+ADDRGP4 cgs+178808
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+178824
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1463
+LABELV $1460
+LABELV $1446
+endproc CG_KeyEvent 8 16
+export CG_ClientNumFromName
+proc CG_ClientNumFromName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1472
+JUMPV
+LABELV $1469
+ADDRLP4 4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1474
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+41156+4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1474
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1468
+JUMPV
+LABELV $1474
+LABELV $1470
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1472
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $1469
+CNSTI4 -1
+RETI4
+LABELV $1468
+endproc CG_ClientNumFromName 12 8
+export CG_ShowResponseHead
+proc CG_ShowResponseHead 0 8
+ADDRGP4 $1480
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $1481
+ARGP4
+ADDRGP4 $1482
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 cg+125012
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1479
+endproc CG_ShowResponseHead 0 8
+export CG_RunMenuScript
+proc CG_RunMenuScript 0 0
+LABELV $1485
+endproc CG_RunMenuScript 0 0
+export CG_GetTeamColor
+proc CG_GetTeamColor 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1487
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $1488
+JUMPV
+LABELV $1487
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1490
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRGP4 $1491
+JUMPV
+LABELV $1490
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1043207291
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+LABELV $1491
+LABELV $1488
+LABELV $1486
+endproc CG_GetTeamColor 8 0
+import cgDC
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1482
+byte 1 55
+byte 1 50
+byte 1 0
+align 1
+LABELV $1481
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 88
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1480
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1436
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1435
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1296
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1292
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1290
+byte 1 37
+byte 1 48
+byte 1 49
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $1287
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1285
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1268
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1264
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $1263
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1260
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1259
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1256
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $1251
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1246
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1228
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $1196
+byte 1 87
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1191
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $1016
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1012
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1008
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1004
+byte 1 76
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1000
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $996
+byte 1 69
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $992
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $988
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $984
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $980
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $976
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $972
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $963
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $959
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $952
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $944
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $924
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $910
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $906
+byte 1 0
+align 1
+LABELV $466
+byte 1 45
+byte 1 0
+align 1
+LABELV $375
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $206
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $158
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $135
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $130
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $124
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $123
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $121
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $120
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $118
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $117
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $115
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $114
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $113
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $111
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $109
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $107
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $106
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $105
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $103
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $102
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
@@ -0,0 +1,17134 @@
+data
+export cg_customSoundNames
+align 4
+LABELV cg_customSoundNames
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+address $84
+address $85
+address $86
+address $87
+skip 76
+export CG_CustomSound
+code
+proc CG_CustomSound 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $89
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $89
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $93
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $91
+LABELV $93
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $91
+ADDRLP4 4
+CNSTI4 2120
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $95
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $99
+LABELV $96
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $98
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $101
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $95
+LABELV $101
+ADDRGP4 $102
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $88
+endproc CG_CustomSound 16 8
+proc CG_ParseAnimationFile 20088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $104
+CNSTI4 0
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $106
+ADDRGP4 $108
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $106
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 20040
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRLP4 20048
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $112
+ADDRGP4 $111
+JUMPV
+LABELV $112
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $116
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $114
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $117
+ADDRGP4 $111
+JUMPV
+LABELV $117
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $119
+LABELV $123
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $119
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $124
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $124
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $127
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $130
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 20084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 0
+NEI4 $133
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $133
+ADDRGP4 $136
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $114
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $139
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $140
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $144
+ADDRGP4 $110
+JUMPV
+LABELV $144
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDP4
+ADDRLP4 20068
+INDIRF4
+ASGNF4
+LABELV $141
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $140
+ADDRGP4 $110
+JUMPV
+LABELV $137
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $149
+ADDRGP4 $111
+JUMPV
+LABELV $149
+ADDRLP4 20072
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 102
+EQI4 $153
+ADDRLP4 20072
+INDIRI4
+CNSTI4 70
+NEI4 $151
+LABELV $153
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $151
+ADDRLP4 20076
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 110
+EQI4 $156
+ADDRLP4 20076
+INDIRI4
+CNSTI4 78
+NEI4 $154
+LABELV $156
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $154
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $146
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $157
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $157
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $160
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $160
+ADDRLP4 20076
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 48
+LTI4 $163
+ADDRLP4 20076
+INDIRI4
+CNSTI4 57
+GTI4 $163
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $111
+JUMPV
+LABELV $163
+ADDRGP4 $165
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $110
+ADDRGP4 $109
+JUMPV
+LABELV $111
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $170
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LTI4 $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+GTI4 $172
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+NEI4 $174
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $174
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $176
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $176
+ADDRLP4 0
+INDIRI4
+CNSTI4 33
+NEI4 $178
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRI4
+CNSTI4 42
+NEI4 $180
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRI4
+CNSTI4 34
+NEI4 $182
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $182
+ADDRLP4 0
+INDIRI4
+CNSTI4 35
+NEI4 $184
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+NEI4 $186
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRI4
+CNSTI4 37
+NEI4 $188
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 38
+NEI4 $190
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 39
+NEI4 $192
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 40
+NEI4 $194
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $194
+ADDRLP4 0
+INDIRI4
+CNSTI4 41
+NEI4 $196
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $196
+ADDRLP4 0
+INDIRI4
+CNSTI4 43
+NEI4 $198
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $198
+ADDRLP4 0
+INDIRI4
+CNSTI4 44
+NEI4 $168
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRB
+ASGNB 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $170
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $202
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $202
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+LTI4 $204
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+GEI4 $204
+ADDRLP4 20064
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20064
+INDIRP4
+ADDRLP4 20064
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $204
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $206
+ADDRGP4 $168
+JUMPV
+LABELV $206
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20068
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $208
+ADDRLP4 20072
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20072
+INDIRP4
+ADDRLP4 20072
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $208
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $210
+ADDRGP4 $168
+JUMPV
+LABELV $210
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20076
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20080
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $212
+ADDRGP4 $168
+JUMPV
+LABELV $212
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20084
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20084
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $214
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $214
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 45
+LTI4 $166
+LABELV $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 45
+EQI4 $216
+ADDRGP4 $218
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $216
+ADDRLP4 8
+INDIRP4
+CNSTI4 1288
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1308
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1316
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 392
+ADDP4
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 1336
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1344
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1348
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1352
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1356
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1360
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1364
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1372
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1376
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1384
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1388
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1400
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1404
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1408
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1412
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1416
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1420
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 724
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 752
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 836
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 864
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $103
+endproc CG_ParseAnimationFile 20088 12
+proc CG_FileExists 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $220
+CNSTI4 1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $220
+CNSTI4 0
+RETI4
+LABELV $219
+endproc CG_FileExists 8 12
+proc CG_FindClientModelFile 32 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $223
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $223
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $230
+ADDRGP4 $227
+JUMPV
+LABELV $230
+ADDRLP4 8
+ADDRGP4 $231
+ASGNP4
+ADDRGP4 $224
+JUMPV
+LABELV $227
+ADDRLP4 8
+ADDRGP4 $232
+ASGNP4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 8
+ADDRGP4 $121
+ASGNP4
+LABELV $224
+ADDRLP4 4
+ADDRGP4 $233
+ASGNP4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $241
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $241
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $241
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $242
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $245
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $245
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $247
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $247
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $251
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $251
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $248
+JUMPV
+LABELV $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $255
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $255
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $256
+LABELV $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $257
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $257
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $261
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $259
+LABELV $261
+ADDRGP4 $239
+JUMPV
+LABELV $259
+LABELV $238
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $237
+LABELV $239
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $262
+ADDRGP4 $236
+JUMPV
+LABELV $262
+ADDRLP4 4
+ADDRGP4 $264
+ASGNP4
+LABELV $235
+ADDRGP4 $234
+JUMPV
+LABELV $236
+CNSTI4 0
+RETI4
+LABELV $222
+endproc CG_FindClientModelFile 32 40
+proc CG_FindClientHeadFile 32 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $266
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $266
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $273
+ADDRGP4 $270
+JUMPV
+LABELV $273
+ADDRLP4 8
+ADDRGP4 $231
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $270
+ADDRLP4 8
+ADDRGP4 $232
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 8
+ADDRGP4 $121
+ASGNP4
+LABELV $267
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $274
+ADDRLP4 4
+ADDRGP4 $276
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $274
+ADDRLP4 4
+ADDRGP4 $233
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $280
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $284
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $284
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $284
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $286
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $285
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $288
+CNSTI4 1
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $288
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $290
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $290
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $294
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $291
+JUMPV
+LABELV $294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $296
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $296
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $297
+LABELV $291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $298
+CNSTI4 1
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $298
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $302
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $300
+LABELV $302
+ADDRGP4 $282
+JUMPV
+LABELV $300
+LABELV $281
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $280
+LABELV $282
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $303
+ADDRGP4 $279
+JUMPV
+LABELV $303
+ADDRLP4 4
+ADDRGP4 $276
+ASGNP4
+LABELV $278
+ADDRGP4 $277
+JUMPV
+LABELV $279
+CNSTI4 0
+RETI4
+LABELV $265
+endproc CG_FindClientHeadFile 32 40
+proc CG_RegisterClientSkin 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $308
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRGP4 $311
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $312
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $316
+ADDRGP4 $318
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $316
+LABELV $307
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $322
+ADDRGP4 $324
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $322
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $325
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $328
+ADDRGP4 $330
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $328
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+NEI4 $331
+LABELV $334
+CNSTI4 0
+RETI4
+ADDRGP4 $305
+JUMPV
+LABELV $331
+CNSTI4 1
+RETI4
+LABELV $305
+endproc CG_RegisterClientSkin 80 32
+proc CG_RegisterClientModelname 284 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $336
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_enableFS+12
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $341
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $344
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $344
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $346
+ADDRGP4 $348
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRGP4 $349
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $347
+LABELV $338
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $350
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $352
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $353
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $356
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $358
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $359
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $361
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $362
+ADDRGP4 $364
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $362
+LABELV $359
+LABELV $356
+LABELV $353
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $365
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $366
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $368
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $369
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $371
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $372
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $374
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRGP4 $364
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $375
+LABELV $372
+LABELV $369
+LABELV $366
+LABELV $350
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $377
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 264
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $378
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $381
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $381
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+LABELV $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $385
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 268
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $388
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $386
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $389
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $387
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRGP4 $364
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $391
+LABELV $383
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $393
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $395
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $395
+ADDRGP4 $397
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $398
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $400
+ARGP4
+ADDRGP4 $401
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $400
+ARGP4
+ADDRGP4 $402
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $399
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $396
+ADDRGP4 $397
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $395
+ADDRGP4 $405
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $396
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $408
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $411
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $412
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $413
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $415
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $411
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $416
+LABELV $413
+LABELV $407
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $418
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 $423
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $421
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+LABELV $421
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $424
+CNSTI4 0
+RETI4
+ADDRGP4 $335
+JUMPV
+LABELV $424
+CNSTI4 1
+RETI4
+LABELV $335
+endproc CG_RegisterClientModelname 284 32
+proc CG_ColorFromString 20 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $429
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $427
+LABELV $429
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $426
+JUMPV
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $430
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $432
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $432
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $434
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $434
+LABELV $426
+endproc CG_ColorFromString 20 4
+proc CG_LoadClientInfo 148 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $437
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $437
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $441
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 20
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $442
+LABELV $437
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $445
+ADDRLP4 20
+ARGP4
+ADDRGP4 $447
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $445
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $448
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRGP4 $453
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $450
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $454
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $454
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $458
+ADDRLP4 20
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 20
+ARGP4
+ADDRGP4 $402
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $459
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRGP4 $464
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $455
+JUMPV
+LABELV $454
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 $467
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $121
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $465
+ADDRGP4 $468
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $465
+LABELV $455
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $448
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRLP4 92
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $471
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $471
+LABELV $469
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $477
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $477
+ADDRLP4 92
+ADDRGP4 $462
+ASGNP4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 92
+ADDRGP4 $467
+ASGNP4
+LABELV $478
+ADDRLP4 16
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $479
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $483
+ADDRGP4 $481
+JUMPV
+LABELV $483
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $485
+ADDRGP4 $487
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $485
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRGP4 $487
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1972
+ADDP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $488
+LABELV $480
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $479
+LABELV $481
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $490
+ADDRLP4 96
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 cg_entities+168
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $494
+ADDRLP4 96
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $494
+CNSTI4 936
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $494
+LABELV $491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $490
+LABELV $436
+endproc CG_LoadClientInfo 148 24
+proc CG_CopyClientInfoModel 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 496
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 508
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 512
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 516
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 520
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 524
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 528
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 532
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 536
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 540
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 484
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 544
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 1428
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 48
+CNSTI4 1972
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $498
+endproc CG_CopyClientInfoModel 52 12
+proc CG_ScanForExistingClientInfo 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $503
+JUMPV
+LABELV $500
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $506
+ADDRGP4 $501
+JUMPV
+LABELV $506
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRGP4 $501
+JUMPV
+LABELV $508
+ADDRLP4 8
+CNSTI4 160
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 24
+CNSTI4 288
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 32
+CNSTI4 352
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 40
+CNSTI4 448
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 48
+CNSTI4 416
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $515
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $515
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $510
+LABELV $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $499
+JUMPV
+LABELV $510
+LABELV $501
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $503
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $500
+CNSTI4 0
+RETI4
+LABELV $499
+endproc CG_ScanForExistingClientInfo 60 8
+proc CG_SetDeferredClientInfo 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $520
+JUMPV
+LABELV $517
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $525
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $523
+LABELV $525
+ADDRGP4 $518
+JUMPV
+LABELV $523
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $531
+ADDRLP4 24
+CNSTI4 160
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $531
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $526
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $526
+ADDRLP4 32
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $526
+LABELV $531
+ADDRGP4 $518
+JUMPV
+LABELV $526
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $516
+JUMPV
+LABELV $518
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $520
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $517
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $532
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $532
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $536
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $544
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $542
+LABELV $544
+ADDRGP4 $537
+JUMPV
+LABELV $542
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $549
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $545
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $545
+ADDRLP4 24
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $545
+LABELV $549
+ADDRGP4 $537
+JUMPV
+LABELV $545
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $516
+JUMPV
+LABELV $537
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $539
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $536
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $516
+JUMPV
+LABELV $532
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $553
+JUMPV
+LABELV $550
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $556
+ADDRGP4 $551
+JUMPV
+LABELV $556
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $516
+JUMPV
+LABELV $551
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $553
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $550
+ADDRGP4 $558
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $516
+endproc CG_SetDeferredClientInfo 36 8
+export CG_NewClientInfo
+proc CG_NewClientInfo 2304 12
+ADDRLP4 2136
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2132
+CNSTI4 2120
+ADDRLP4 2136
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 2136
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 2140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 2124
+ADDRLP4 2140
+INDIRP4
+ASGNP4
+ADDRLP4 2124
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $561
+ADDRLP4 2132
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2120
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $559
+JUMPV
+LABELV $561
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2120
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRLP4 2144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2144
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 2148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2148
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 0+76
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $568
+ARGP4
+ADDRLP4 2152
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2152
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 0+88
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 2156
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2156
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+72
+ADDRLP4 2160
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 2164
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2164
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+120
+ADDRLP4 2168
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $574
+ARGP4
+ADDRLP4 2172
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2172
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2176
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+124
+ADDRLP4 2176
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $576
+ARGP4
+ADDRLP4 2180
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2180
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+128
+ADDRLP4 2184
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $578
+ARGP4
+ADDRLP4 2188
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2188
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 2192
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $580
+ARGP4
+ADDRLP4 2196
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2196
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2200
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+132
+ADDRLP4 2200
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 2204
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2204
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+ADDRLP4 2208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+136
+ADDRLP4 2208
+INDIRI4
+ASGNI4
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $584
+ARGP4
+ADDRLP4 2212
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2212
+INDIRP4
+ASGNP4
+ADDRLP4 0+416
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $586
+ARGP4
+ADDRLP4 2216
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2216
+INDIRP4
+ASGNP4
+ADDRLP4 0+448
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 2220
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2220
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $589
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $592
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $592
+ADDRLP4 0+160
+ARGP4
+ADDRGP4 $462
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+224
+ARGP4
+ADDRGP4 $121
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRGP4 $588
+ARGP4
+ADDRLP4 2224
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2224
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2292
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2288
+ADDRLP4 2292
+INDIRP4
+ASGNP4
+ADDRLP4 2292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $600
+ADDRLP4 2288
+ADDRGP4 $121
+ASGNP4
+ADDRGP4 $601
+JUMPV
+LABELV $600
+ADDRLP4 2296
+ADDRLP4 2288
+INDIRP4
+ASGNP4
+ADDRLP4 2288
+ADDRLP4 2296
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2296
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $601
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 2288
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+160
+ARGP4
+ADDRLP4 2224
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $593
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $590
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $590
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2292
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2292
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $590
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 0+160
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+160
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2224
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2224
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $617
+ADDRLP4 0+224
+ARGP4
+ADDRGP4 $121
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2128
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $618
+LABELV $590
+ADDRLP4 2124
+INDIRP4
+ARGP4
+ADDRGP4 $623
+ARGP4
+ADDRLP4 2224
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2120
+ADDRLP4 2224
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $627
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $627
+ADDRLP4 0+288
+ARGP4
+ADDRGP4 $462
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+352
+ARGP4
+ADDRGP4 $121
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $628
+JUMPV
+LABELV $627
+ADDRGP4 $635
+ARGP4
+ADDRLP4 2228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 2228
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2296
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2292
+ADDRLP4 2296
+INDIRP4
+ASGNP4
+ADDRLP4 2296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $636
+ADDRLP4 2292
+ADDRGP4 $121
+ASGNP4
+ADDRGP4 $637
+JUMPV
+LABELV $636
+ADDRLP4 2300
+ADDRLP4 2292
+INDIRP4
+ASGNP4
+ADDRLP4 2292
+ADDRLP4 2300
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 2300
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $637
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 2292
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 2228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $628
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $625
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+EQI4 $625
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2296
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2296
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $625
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 2120
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+288
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 2228
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2128
+ADDRLP4 2228
+INDIRP4
+ASGNP4
+ADDRLP4 2128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $653
+ADDRLP4 0+352
+ARGP4
+ADDRGP4 $121
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 2128
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2128
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $654
+LABELV $625
+ADDRLP4 0
+ARGP4
+ADDRLP4 2228
+ADDRGP4 CG_ScanForExistingClientInfo
+CALLI4
+ASGNI4
+ADDRLP4 2228
+INDIRI4
+CNSTI4 0
+NEI4 $659
+ADDRLP4 2240
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 2240
+INDIRI4
+CNSTI4 4000000
+GEI4 $662
+ADDRLP4 2236
+CNSTI4 1
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $662
+ADDRLP4 2236
+CNSTI4 0
+ASGNI4
+LABELV $663
+ADDRLP4 2232
+ADDRLP4 2236
+INDIRI4
+ASGNI4
+ADDRLP4 2244
+CNSTI4 0
+ASGNI4
+ADDRLP4 2232
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+NEI4 $669
+ADDRGP4 cg_deferPlayers+12
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+EQI4 $664
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+NEI4 $664
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 2244
+INDIRI4
+NEI4 $664
+LABELV $669
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_SetDeferredClientInfo
+CALLV
+pop
+ADDRLP4 2232
+INDIRI4
+CNSTI4 0
+EQI4 $665
+ADDRGP4 $672
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0+480
+CNSTI4 0
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $665
+LABELV $659
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 2132
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 2120
+LABELV $559
+endproc CG_NewClientInfo 2304 12
+export CG_LoadDeferredPlayers
+proc CG_LoadDeferredPlayers 20 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+41156
+ASGNP4
+ADDRGP4 $678
+JUMPV
+LABELV $675
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $681
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $681
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $683
+ADDRGP4 $672
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $676
+JUMPV
+LABELV $683
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $681
+LABELV $676
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2120
+ADDP4
+ASGNP4
+LABELV $678
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31488
+INDIRI4
+LTI4 $675
+LABELV $674
+endproc CG_LoadDeferredPlayers 20 8
+proc CG_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $688
+ADDRFP4 8
+INDIRI4
+CNSTI4 51
+LTI4 $686
+LABELV $688
+ADDRGP4 $689
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $686
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $690
+ADDRGP4 $693
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $690
+LABELV $685
+endproc CG_SetLerpFrameAnimation 12 8
+proc CG_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_animSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $695
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $695
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $700
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $698
+LABELV $700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $698
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $701
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $704
+ADDRGP4 $694
+JUMPV
+LABELV $704
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $706
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $707
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $709
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $711
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $713
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $714
+LABELV $711
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $716
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $716
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $718
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $719
+JUMPV
+LABELV $718
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $719
+LABELV $717
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $720
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $724
+ADDRGP4 $727
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $724
+LABELV $720
+LABELV $701
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $728
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $728
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $732
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $732
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $736
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $737
+JUMPV
+LABELV $736
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $737
+LABELV $694
+endproc CG_RunLerpFrame 48 12
+proc CG_ClearLerpFrame 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $739
+endproc CG_ClearLerpFrame 16 12
+proc CG_PlayerAnimation 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_noPlayerAnims+12
+INDIRI4
+CNSTI4 0
+EQI4 $742
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $742
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $745
+ADDRLP4 4
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $746
+JUMPV
+LABELV $745
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $746
+ADDRLP4 0
+CNSTI4 2120
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $748
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $749
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $741
+endproc CG_PlayerAnimation 20 16
+proc CG_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $755
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $753
+LABELV $755
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $753
+LABELV $751
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $756
+ADDRGP4 $750
+JUMPV
+LABELV $756
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $758
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $759
+JUMPV
+LABELV $758
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $760
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $761
+LABELV $759
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $762
+ADDRLP4 8
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $765
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $765
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $763
+JUMPV
+LABELV $762
+ADDRLP4 8
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $768
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $768
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $763
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $770
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $771
+JUMPV
+LABELV $770
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $772
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $772
+LABELV $771
+LABELV $750
+endproc CG_SwingAngles 28 8
+proc CG_AddPainTwitch 12 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $776
+ADDRGP4 $774
+JUMPV
+LABELV $776
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $778
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $779
+JUMPV
+LABELV $778
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $779
+LABELV $774
+endproc CG_AddPainTwitch 12 0
+data
+align 4
+LABELV $781
+byte 4 0
+byte 4 22
+byte 4 45
+byte 4 -22
+byte 4 0
+byte 4 22
+byte 4 -45
+byte 4 -22
+code
+proc CG_PlayerAngles 140 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $788
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+LABELV $788
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $791
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 7
+EQI4 $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $795
+LABELV $791
+ADDRLP4 84
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $798
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 11
+EQI4 $796
+ADDRLP4 88
+INDIRI4
+CNSTI4 12
+EQI4 $796
+LABELV $798
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $796
+ADDRFP4 0
+INDIRP4
+CNSTI4 800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+EQF4 $801
+ADDRLP4 96
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1028443341
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $801
+LABELV $799
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $803
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $804
+JUMPV
+LABELV $803
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+LTI4 $807
+ADDRLP4 56
+INDIRI4
+CNSTI4 7
+LEI4 $805
+LABELV $807
+ADDRGP4 $808
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $805
+LABELV $804
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $781
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $781
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $813
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1127481344
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1127481344
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRGP4 $814
+JUMPV
+LABELV $813
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $814
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $826
+ADDRLP4 68
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $826
+ADDRLP4 68
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $827
+ADDRGP4 cg_cameramode+12
+INDIRI4
+CNSTI4 1
+NEI4 $828
+ADDRLP4 68
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $781
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 68
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $829
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $833
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $833
+ADDRLP4 60
+CNSTI4 2120
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $836
+LABELV $833
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ARGP4
+ADDRLP4 96
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+EQF4 $838
+ADDRLP4 52
+CNSTF4 1028443341
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 136
+ADDRLP4 52
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 100+12
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 100+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 100+12+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 52
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 136
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $838
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $852
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $852
+ADDRLP4 60
+CNSTI4 2120
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $855
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 104
+INDIRF4
+ASGNF4
+LABELV $855
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 43
+EQI4 $862
+ADDRLP4 104
+INDIRI4
+CNSTI4 44
+NEI4 $860
+LABELV $862
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+LABELV $860
+LABELV $852
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPainTwitch
+CALLV
+pop
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $866
+ADDRFP4 0
+INDIRP4
+CNSTI4 820
+ADDP4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+LABELV $866
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $780
+endproc CG_PlayerAngles 140 24
+proc CG_HasteTrail 40 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $871
+ADDRGP4 $870
+JUMPV
+LABELV $871
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 15
+EQI4 $874
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+EQI4 $874
+ADDRGP4 $870
+JUMPV
+LABELV $874
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $876
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+572
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $870
+endproc CG_HasteTrail 40 48
+proc CG_BreathPuffs 64 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 cg_enableBreath+12
+INDIRI4
+CNSTI4 0
+NEI4 $886
+ADDRGP4 $884
+JUMPV
+LABELV $886
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $889
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $889
+ADDRGP4 $884
+JUMPV
+LABELV $889
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $893
+ADDRGP4 $884
+JUMPV
+LABELV $893
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $895
+ADDRGP4 $884
+JUMPV
+LABELV $895
+ADDRLP4 24
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $897
+ADDRGP4 $884
+JUMPV
+LABELV $897
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 44
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3229614080
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1059648963
+ARGF4
+CNSTF4 1153138688
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 400
+ADDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+180272+348
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRLP4 24
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $884
+endproc CG_BreathPuffs 64 48
+proc CG_DustTrail 112 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_enableDust+12
+INDIRI4
+CNSTI4 0
+NEI4 $914
+ADDRGP4 $913
+JUMPV
+LABELV $914
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $917
+ADDRGP4 $913
+JUMPV
+LABELV $917
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 21
+EQI4 $920
+ADDRLP4 24
+INDIRI4
+CNSTI4 19
+EQI4 $920
+ADDRGP4 $913
+JUMPV
+LABELV $920
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $922
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $922
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+44
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $927
+ADDRGP4 $913
+JUMPV
+LABELV $927
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3253731328
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 104
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+CNSTF4 1060320051
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+692
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $913
+endproc CG_DustTrail 112 48
+proc CG_TrailItem 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $936
+endproc CG_TrailItem 192 12
+proc CG_PlayerFlag 356 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+180272+120
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $473
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+8
+ADDRGP4 cgs+180272+124
+INDIRI4
+ASGNI4
+ADDRLP4 140+108
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 280+8
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 22
+EQI4 $968
+ADDRLP4 304
+INDIRI4
+CNSTI4 23
+NEI4 $966
+LABELV $968
+ADDRLP4 320
+CNSTI4 49
+ASGNI4
+ADDRGP4 $967
+JUMPV
+LABELV $966
+ADDRLP4 304
+INDIRI4
+CNSTI4 14
+EQI4 $971
+ADDRLP4 304
+INDIRI4
+CNSTI4 13
+NEI4 $969
+LABELV $971
+ADDRLP4 320
+CNSTI4 49
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+ADDRGP4 $970
+JUMPV
+LABELV $969
+ADDRLP4 320
+CNSTI4 48
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $970
+LABELV $967
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 308
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 344
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 1063675494
+GEF4 $985
+ADDRLP4 308
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 1065353216
+LEF4 $994
+ADDRLP4 308
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $995
+JUMPV
+LABELV $994
+ADDRLP4 308
+INDIRF4
+CNSTF4 3212836864
+GEF4 $996
+ADDRLP4 308
+CNSTF4 3212836864
+ASGNF4
+LABELV $996
+LABELV $995
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 324
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 0
+GEF4 $1008
+ADDRLP4 280+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRLP4 280+4
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $1009
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 0
+GEF4 $1012
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1012
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1016
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1016
+ADDRLP4 280+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1041865114
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $985
+LABELV $972
+ADDRLP4 280+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ARGP4
+ADDRLP4 320
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRLP4 140+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+80
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $473
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $950
+endproc CG_PlayerFlag 356 24
+proc CG_PlayerTokens 200 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+LTI4 $1029
+ADDRGP4 $1028
+JUMPV
+LABELV $1029
+ADDRLP4 4
+CNSTI4 124
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg+116008
+ADDP4
+ASGNP4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $1032
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1028
+JUMPV
+LABELV $1032
+ADDRLP4 180
+INDIRI4
+CNSTI4 10
+LEI4 $1034
+ADDRLP4 180
+CNSTI4 10
+ASGNI4
+LABELV $1034
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1039
+JUMPV
+LABELV $1036
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1043
+JUMPV
+LABELV $1040
+ADDRLP4 188
+CNSTI4 12
+ASGNI4
+ADDRLP4 192
+ADDRLP4 188
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 188
+INDIRI4
+SUBI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1041
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1043
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1040
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1037
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1039
+ADDRLP4 8
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+SUBI4
+LTI4 $1036
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1047
+JUMPV
+LABELV $1044
+ADDRLP4 188
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 164
+ADDRLP4 188
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 188
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1106247680
+LEF4 $1052
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 152+4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 164+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1052
+ADDRLP4 152
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1045
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1047
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1044
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1058
+ADDRLP4 12+8
+ADDRGP4 cgs+180272+20
+INDIRI4
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1058
+ADDRLP4 12+8
+ADDRGP4 cgs+180272+24
+INDIRI4
+ASGNI4
+LABELV $1059
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1069
+ADDRLP4 12+28
+ADDRLP4 152
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+4
+ADDRLP4 152+4
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+ADDRLP4 152+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+28
+ARGP4
+ADDRLP4 12+28+24
+ARGP4
+ADDRLP4 12+28+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 12+68
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 176
+CNSTF4 1086918619
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 5000
+ADDI4
+CNSTI4 500
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+CNSTI4 16
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+68+8
+ADDRLP4 12+68+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 152
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1070
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1072
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+LTI4 $1069
+LABELV $1028
+endproc CG_PlayerTokens 200 12
+proc CG_PlayerPowerups 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1101
+ADDRGP4 $1100
+JUMPV
+LABELV $1101
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1103
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1103
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1105
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+180272+1256
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $1105
+ADDRLP4 4
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1110
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+128
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1113
+JUMPV
+LABELV $1112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+36
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1113
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1110
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1118
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+132
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1121
+JUMPV
+LABELV $1120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+40
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1121
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1118
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1126
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+136
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $1129
+JUMPV
+LABELV $1128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+44
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $1129
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1126
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_HasteTrail
+CALLV
+pop
+LABELV $1134
+LABELV $1100
+endproc CG_PlayerPowerups 16 20
+proc CG_PlayerFloatSprite 144 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1137
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1137
+ADDRLP4 140
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1138
+JUMPV
+LABELV $1137
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $1138
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1136
+endproc CG_PlayerFloatSprite 144 12
+proc CG_PlayerSprites 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1155
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+272
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+268
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $1163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+720
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1163
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+724
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1167
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1171
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+728
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1171
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $1175
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+732
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1175
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $1179
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+736
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1183
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+740
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $1154
+JUMPV
+LABELV $1183
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1189
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1189
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1189
+ADDRGP4 cgs+34808
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1189
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $1154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+180272+264
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+LABELV $1189
+LABELV $1154
+endproc CG_PlayerSprites 12 8
+lit
+align 4
+LABELV $1200
+byte 4 3245342720
+byte 4 3245342720
+byte 4 0
+align 4
+LABELV $1201
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc CG_PlayerShadow 104 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $1200
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 $1201
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1202
+CNSTI4 0
+RETI4
+ADDRGP4 $1199
+JUMPV
+LABELV $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1205
+CNSTI4 0
+RETI4
+ADDRGP4 $1199
+JUMPV
+LABELV $1205
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $1213
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $1213
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $1208
+LABELV $1213
+CNSTI4 0
+RETI4
+ADDRGP4 $1199
+JUMPV
+LABELV $1208
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+EQI4 $1216
+CNSTI4 1
+RETI4
+ADDRGP4 $1199
+JUMPV
+LABELV $1216
+ADDRLP4 56
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+180272+496
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1103101952
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1199
+endproc CG_PlayerShadow 104 44
+proc CG_PlayerSplash 196 28
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $1225
+ADDRGP4 $1224
+JUMPV
+LABELV $1225
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1229
+ADDRGP4 $1224
+JUMPV
+LABELV $1229
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+EQI4 $1232
+ADDRGP4 $1224
+JUMPV
+LABELV $1232
+ADDRLP4 96
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $1234
+ADDRGP4 $1224
+JUMPV
+LABELV $1234
+ADDRLP4 0
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 192
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 0+48
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 0+48+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 0+72
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 0+72+4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+180272+520
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1224
+endproc CG_PlayerSplash 196 28
+export CG_AddRefEntityWithPowerups
+proc CG_AddRefEntityWithPowerups 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1315
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $1316
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+556
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1316
+JUMPV
+LABELV $1315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1322
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 2048
+BANDI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1322
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1322
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1327
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1330
+ADDRGP4 $1325
+JUMPV
+LABELV $1327
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+588
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1326
+JUMPV
+LABELV $1330
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+592
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1326
+JUMPV
+LABELV $1325
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+584
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1326
+LABELV $1322
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1335
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1337
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+548
+INDIRI4
+ASGNI4
+ADDRGP4 $1338
+JUMPV
+LABELV $1337
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+544
+INDIRI4
+ASGNI4
+LABELV $1338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1335
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1343
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+DIVI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $1345
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+560
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1345
+LABELV $1343
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1350
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+564
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1350
+LABELV $1316
+LABELV $1314
+endproc CG_AddRefEntityWithPowerups 8 4
+export CG_LightVerts
+proc CG_LightVerts 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_LightForPoint
+CALLI4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1358
+JUMPV
+LABELV $1355
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1361
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $1364
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1365
+JUMPV
+LABELV $1364
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1365
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1368
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1369
+JUMPV
+LABELV $1368
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1369
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1372
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1373
+JUMPV
+LABELV $1372
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1373
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1356
+JUMPV
+LABELV $1361
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1374
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1374
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1378
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1378
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1382
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1382
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1356
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1358
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $1355
+CNSTI4 1
+RETI4
+LABELV $1354
+endproc CG_LightVerts 88 16
+export CG_Player
+proc CG_Player 836 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 764
+CNSTI4 0
+ASGNI4
+ADDRLP4 704
+CNSTF4 0
+ASGNF4
+ADDRLP4 708
+CNSTF4 0
+ASGNF4
+ADDRLP4 712
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 0
+LEI4 $1385
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 1
+NEI4 $1388
+ADDRLP4 708
+CNSTF4 0
+ASGNF4
+ADDRLP4 704
+CNSTF4 1058977874
+ASGNF4
+ADDRLP4 712
+CNSTF4 1076677837
+ASGNF4
+ADDRGP4 $1386
+JUMPV
+LABELV $1388
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 2
+NEI4 $1391
+ADDRLP4 704
+CNSTF4 1064011039
+ASGNF4
+ADDRLP4 708
+CNSTF4 1062333317
+ASGNF4
+ADDRLP4 712
+CNSTF4 1067869798
+ASGNF4
+ADDRGP4 $1386
+JUMPV
+LABELV $1391
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 3
+NEI4 $1394
+ADDRLP4 772
+CNSTF4 1064011039
+ASGNF4
+ADDRLP4 704
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRLP4 708
+CNSTF4 1064849900
+ASGNF4
+ADDRLP4 712
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRGP4 $1386
+JUMPV
+LABELV $1394
+ADDRGP4 cg_leiChibi+12
+INDIRI4
+CNSTI4 4
+NEI4 $1386
+ADDRLP4 704
+CNSTF4 1062836634
+ASGNF4
+ADDRLP4 708
+CNSTF4 1067869798
+ASGNF4
+ADDRLP4 712
+CNSTF4 1063843267
+ASGNF4
+ADDRGP4 $1386
+JUMPV
+LABELV $1385
+ADDRLP4 772
+CNSTF4 0
+ASGNF4
+ADDRLP4 712
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRLP4 708
+ADDRLP4 772
+INDIRF4
+ASGNF4
+ADDRLP4 704
+ADDRLP4 772
+INDIRF4
+ASGNF4
+LABELV $1386
+ADDRLP4 752
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 752
+INDIRI4
+CNSTI4 0
+LTI4 $1402
+ADDRLP4 752
+INDIRI4
+CNSTI4 64
+LTI4 $1400
+LABELV $1402
+ADDRGP4 $1403
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1400
+ADDRLP4 560
+CNSTI4 2120
+ADDRLP4 752
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1405
+ADDRGP4 $1384
+JUMPV
+LABELV $1405
+ADDRLP4 716
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1407
+ADDRLP4 764
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1410
+ADDRLP4 716
+CNSTI4 2
+ASGNI4
+LABELV $1410
+LABELV $1411
+LABELV $1407
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 280
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+96
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 140+96
+ARGP4
+ADDRLP4 140+80
+ARGP4
+ADDRLP4 140+100
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSprites
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 736
+ARGP4
+ADDRLP4 776
+ADDRGP4 CG_PlayerShadow
+CALLI4
+ASGNI4
+ADDRLP4 768
+ADDRLP4 776
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSplash
+CALLV
+pop
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 3
+NEI4 $1422
+ADDRLP4 768
+INDIRI4
+CNSTI4 0
+EQI4 $1422
+ADDRLP4 716
+ADDRLP4 716
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $1422
+ADDRLP4 716
+ADDRLP4 716
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 7
+NEI4 $1425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 716
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerTokens
+CALLV
+pop
+LABELV $1425
+ADDRLP4 0+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1429
+ADDRLP4 0+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1429
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 704
+INDIRF4
+CNSTF4 0
+EQF4 $1434
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 704
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1434
+ADDRGP4 cg_enableQ+12
+INDIRI4
+CNSTI4 0
+EQI4 $1478
+ADDRLP4 0+28
+CNSTF4 1062836634
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1062836634
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1062836634
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1062836634
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1062836634
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1062836634
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1062836634
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1062836634
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1062836634
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1478
+ADDRLP4 0+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1527
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+LABELV $1527
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1531
+ADDRGP4 $1384
+JUMPV
+LABELV $1531
+ADDRLP4 560
+INDIRP4
+CNSTI4 2116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1534
+ADDRLP4 280+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+8
+INDIRI4
+CNSTI4 0
+NEI4 $1537
+ADDRGP4 $1384
+JUMPV
+LABELV $1537
+ADDRLP4 280+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 280
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1542
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 764
+INDIRI4
+CNSTI4 0
+EQI4 $1543
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ADDRLP4 280+68+4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 280+68+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 3
+NEI4 $1550
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 headang
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1551
+JUMPV
+LABELV $1550
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+NEI4 $1554
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 headang
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 headang+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1555
+JUMPV
+LABELV $1554
+ADDRGP4 headang
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1555
+LABELV $1551
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1559
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRB
+ASGNB 12
+ADDRLP4 784
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+ADDRLP4 784
+INDIRP4
+ADDRLP4 784
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRLP4 792
+INDIRP4
+ADDRLP4 792
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 800
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ASGNP4
+ADDRLP4 800
+INDIRP4
+ADDRLP4 800
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 headpos
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1559
+LABELV $1543
+ADDRLP4 280+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+EQI4 $1569
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 3
+NEI4 $1565
+LABELV $1569
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+LABELV $1565
+ADDRLP4 280
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 CG_BreathPuffs
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DustTrail
+CALLV
+pop
+ADDRGP4 $1384
+JUMPV
+LABELV $1534
+ADDRLP4 140+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1572
+ADDRGP4 $1384
+JUMPV
+LABELV $1572
+ADDRLP4 140+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1577
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1580
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRI4
+CNSTI4 4
+BANDI4
+ASGNI4
+LABELV $1580
+ADDRLP4 708
+INDIRF4
+CNSTF4 0
+EQF4 $1584
+ADDRLP4 140+28
+ADDRLP4 140+28
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+4
+ADDRLP4 140+28+4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+8
+ADDRLP4 140+28+8
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12
+ADDRLP4 140+28+12
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+ADDRLP4 140+28+12+4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+ADDRLP4 140+28+12+8
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24
+ADDRLP4 140+28+24
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+4
+ADDRLP4 140+28+24+4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+8
+ADDRLP4 140+28+24+8
+INDIRF4
+ADDRLP4 708
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1584
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1628
+ADDRLP4 564
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 564+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 564+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 564+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1633
+ADDRLP4 780
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 732
+ADDRLP4 780
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 7
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ADDRLP4 780
+INDIRF4
+LEF4 $1636
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1636
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 784
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 784
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 788
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 788
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+CNSTF4 1086918619
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 792
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 1090519040
+ADDRLP4 792
+INDIRF4
+MULF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+12
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 564+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 564+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 564+28+12
+ARGP4
+ADDRLP4 564+28+24
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1634
+JUMPV
+LABELV $1633
+ADDRLP4 732
+CNSTF4 1086918619
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 780
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 780
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 784
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 784
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 788
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 1101004800
+ADDRLP4 788
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 792
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 740
+CNSTF4 1106247680
+ADDRLP4 792
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 740+4
+CNSTF4 1127481344
+ADDRLP4 732
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1693
+ADDRLP4 740+4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1693
+ADDRLP4 740+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+28+12
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 796
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 732
+ADDRLP4 796
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1078530011
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ADDRLP4 796
+INDIRF4
+LEF4 $1708
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1708
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 800
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 800
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 804
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 804
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 808
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 1101004800
+ADDRLP4 808
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+CNSTF4 1070141403
+SUBF4
+ARGF4
+ADDRLP4 812
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 740
+CNSTF4 1106247680
+ADDRLP4 812
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 740+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 732
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1725
+ADDRLP4 740+4
+ADDRLP4 740+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1725
+ADDRLP4 740+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 816
+CNSTF4 1086918619
+ASGNF4
+ADDRLP4 732
+ADDRLP4 816
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 3
+DIVI4
+CNSTI4 255
+BANDI4
+CVIF4 4
+MULF4
+CNSTF4 1132396544
+DIVF4
+CNSTF4 1070141403
+ADDF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ADDRLP4 816
+INDIRF4
+LEF4 $1738
+ADDRLP4 732
+ADDRLP4 732
+INDIRF4
+CNSTF4 1086918619
+SUBF4
+ASGNF4
+LABELV $1738
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 820
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 720
+CNSTF4 1101004800
+ADDRLP4 820
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 732
+INDIRF4
+ARGF4
+ADDRLP4 824
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 720+4
+CNSTF4 1101004800
+ADDRLP4 824
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 720+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+68
+ADDRLP4 140+68
+INDIRF4
+ADDRLP4 720
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+4
+ADDRLP4 140+68+4
+INDIRF4
+ADDRLP4 720+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+68+8
+ADDRLP4 140+68+8
+INDIRF4
+ADDRLP4 720+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564+28+12
+ADDRLP4 720
+INDIRB
+ASGNB 12
+ADDRLP4 564+28+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 564+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 564+28+24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 564+28+12
+ARGP4
+ADDRLP4 564+28+24
+ARGP4
+ADDRLP4 564+28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+656
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 564+8
+ADDRGP4 cgs+180272+660
+INDIRI4
+ASGNI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1634
+LABELV $1628
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1777
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+664
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1777
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1785
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+668
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1785
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1793
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+672
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1793
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1801
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+676
+INDIRI4
+ASGNI4
+ADDRLP4 420+80
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+96
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1801
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $1809
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1811
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $1811
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $1810
+JUMPV
+LABELV $1809
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1810
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+NEI4 $1818
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $1815
+LABELV $1818
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+700
+INDIRI4
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+4
+ADDRLP4 420+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 420+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $1825
+ADDRLP4 760
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+ADDRGP4 $1826
+JUMPV
+LABELV $1825
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 250
+GEI4 $1829
+ADDRLP4 760
+CNSTI4 250
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+CNSTF4 1132068864
+DIVF4
+ASGNF4
+ADDRGP4 $1830
+JUMPV
+LABELV $1829
+ADDRLP4 760
+CNSTF4 1065353216
+ASGNF4
+LABELV $1830
+LABELV $1826
+ADDRLP4 420+28
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 420+28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+12+4
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 420+28+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+24
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 420+28+24+8
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1815
+ADDRLP4 756
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 560
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1855
+ADDRLP4 756
+INDIRI4
+CNSTI4 500
+GEI4 $1855
+ADDRLP4 420
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 140
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 420+8
+ADDRGP4 cgs+180272+688
+INDIRI4
+ASGNI4
+ADDRLP4 420+108
+CNSTI4 0
+ASGNI4
+ADDRLP4 420+4
+ADDRLP4 420+4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 780
+CNSTF4 0
+ASGNF4
+ADDRLP4 740+8
+ADDRLP4 780
+INDIRF4
+ASGNF4
+ADDRLP4 740+4
+ADDRLP4 780
+INDIRF4
+ASGNF4
+ADDRLP4 740
+ADDRLP4 780
+INDIRF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 420+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 420+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 420+68+8
+ADDRLP4 420+68+8
+INDIRF4
+CNSTF4 1117782016
+ADDRLP4 756
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1140457472
+DIVF4
+CNSTF4 3250585600
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 756
+INDIRI4
+CNSTI4 400
+LEI4 $1868
+ADDRLP4 788
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 760
+ADDRLP4 788
+INDIRF4
+ADDRLP4 756
+INDIRI4
+CNSTI4 1000
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 792
+ADDRLP4 788
+INDIRF4
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 796
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 792
+INDIRF4
+ADDRLP4 796
+INDIRF4
+LTF4 $1872
+ADDRLP4 784
+ADDRLP4 792
+INDIRF4
+ADDRLP4 796
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1873
+JUMPV
+LABELV $1872
+ADDRLP4 784
+ADDRLP4 792
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1873
+ADDRLP4 420+116
+ADDRLP4 784
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 804
+CNSTF4 1132396544
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 808
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 804
+INDIRF4
+ADDRLP4 808
+INDIRF4
+LTF4 $1877
+ADDRLP4 800
+ADDRLP4 804
+INDIRF4
+ADDRLP4 808
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1878
+JUMPV
+LABELV $1877
+ADDRLP4 800
+ADDRLP4 804
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1878
+ADDRLP4 420+116+1
+ADDRLP4 800
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 816
+CNSTF4 1132396544
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 820
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 816
+INDIRF4
+ADDRLP4 820
+INDIRF4
+LTF4 $1882
+ADDRLP4 812
+ADDRLP4 816
+INDIRF4
+ADDRLP4 820
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1883
+JUMPV
+LABELV $1882
+ADDRLP4 812
+ADDRLP4 816
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1883
+ADDRLP4 420+116+2
+ADDRLP4 812
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 828
+CNSTF4 1132396544
+ADDRLP4 760
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 832
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 828
+INDIRF4
+ADDRLP4 832
+INDIRF4
+LTF4 $1887
+ADDRLP4 824
+ADDRLP4 828
+INDIRF4
+ADDRLP4 832
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1888
+JUMPV
+LABELV $1887
+ADDRLP4 824
+ADDRLP4 828
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1888
+ADDRLP4 420+116+3
+ADDRLP4 824
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $1869
+JUMPV
+LABELV $1868
+ADDRLP4 420+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 420+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 420+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 420+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1869
+ADDRLP4 420
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1855
+ADDRLP4 280+8
+ADDRLP4 560
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+8
+INDIRI4
+CNSTI4 0
+NEI4 $1897
+ADDRGP4 $1384
+JUMPV
+LABELV $1897
+ADDRLP4 280+108
+ADDRLP4 560
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 280
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1542
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 764
+INDIRI4
+CNSTI4 0
+EQI4 $1902
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ADDRLP4 280+68+4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ADDRLP4 280+68+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 2
+NEI4 $1909
+ADDRLP4 280+28
+ARGP4
+ADDRGP4 headang
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1910
+JUMPV
+LABELV $1909
+ADDRGP4 headang
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1910
+ADDRGP4 cg_cameraEyes+12
+INDIRI4
+CNSTI4 0
+EQI4 $1913
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ADDRLP4 280+68
+INDIRB
+ASGNB 12
+ADDRLP4 784
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+ADDRLP4 784
+INDIRP4
+ADDRLP4 784
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRLP4 792
+INDIRP4
+ADDRLP4 792
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 800
+ADDRFP4 0
+INDIRP4
+CNSTI4 812
+ADDP4
+ASGNP4
+ADDRLP4 800
+INDIRP4
+ADDRLP4 800
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 headpos
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1913
+LABELV $1902
+ADDRLP4 280+24
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 716
+INDIRI4
+ASGNI4
+ADDRLP4 712
+INDIRF4
+CNSTF4 0
+EQF4 $1919
+ADDRLP4 280+28
+ADDRLP4 280+28
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+4
+ADDRLP4 280+28+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+8
+ADDRLP4 280+28+8
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+12
+ADDRLP4 280+28+12
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+12+4
+ADDRLP4 280+28+12+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+12+8
+ADDRLP4 280+28+12+8
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+24
+ADDRLP4 280+28+24
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+24+4
+ADDRLP4 280+28+24+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280+28+24+8
+ADDRLP4 280+28+24+8
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1919
+ADDRLP4 280
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 CG_BreathPuffs
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_DustTrail
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 560
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_PlayerPowerups
+CALLV
+pop
+LABELV $1384
+endproc CG_Player 836 28
+export CG_ResetPlayerEntity
+proc CG_ResetPlayerEntity 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+CNSTI4 -99999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugPosition+12
+INDIRI4
+CNSTI4 0
+EQI4 $1968
+ADDRGP4 $1971
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1968
+LABELV $1963
+endproc CG_ResetPlayerEntity 48 12
+import cg_leiChibi
+bss
+export enableQ
+align 4
+LABELV enableQ
+skip 4
+export headang
+align 4
+LABELV headang
+skip 12
+export headpos
+align 4
+LABELV headpos
+skip 12
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1971
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 61
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1577
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1542
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1403
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $808
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $727
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 102
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $693
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $689
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $672
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $635
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $623
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $588
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $586
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $584
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $582
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $580
+byte 1 116
+byte 1 116
+byte 1 0
+align 1
+LABELV $578
+byte 1 116
+byte 1 0
+align 1
+LABELV $576
+byte 1 108
+byte 1 0
+align 1
+LABELV $574
+byte 1 119
+byte 1 0
+align 1
+LABELV $572
+byte 1 104
+byte 1 99
+byte 1 0
+align 1
+LABELV $570
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $568
+byte 1 99
+byte 1 50
+byte 1 0
+align 1
+LABELV $566
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $563
+byte 1 110
+byte 1 0
+align 1
+LABELV $558
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $487
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $473
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $468
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $467
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $464
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $463
+byte 1 42
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 0
+align 1
+LABELV $462
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 105
+byte 1 0
+align 1
+LABELV $453
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $447
+byte 1 47
+byte 1 0
+align 1
+LABELV $423
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $420
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $415
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $412
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $411
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $408
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $405
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 86
+byte 1 105
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $401
+byte 1 69
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $400
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $397
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $388
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $380
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $379
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $374
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $371
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $368
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $365
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $364
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $361
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $358
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $355
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $352
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $349
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $348
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $341
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $330
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $327
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $324
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $321
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $318
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $315
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $314
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $311
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $308
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $287
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $286
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $276
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $254
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $253
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $244
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $243
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $233
+byte 1 0
+align 1
+LABELV $232
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $231
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $218
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $159
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $148
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $139
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $136
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $135
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 0
+align 1
+LABELV $132
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $129
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $126
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $122
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $121
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $116
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $108
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $87
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $86
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $85
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $84
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $83
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $82
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $81
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $80
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $79
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $78
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $77
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $76
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $75
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
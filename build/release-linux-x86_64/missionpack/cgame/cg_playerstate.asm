@@ -0,0 +1,2857 @@
+export CG_CheckAmmo
+code
+proc CG_CheckAmmo 24 8
+ADDRLP4 8
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $77
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $83
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $81
+LABELV $83
+ADDRGP4 $78
+JUMPV
+LABELV $81
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+GTI4 $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $89-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $89
+address $86
+address $86
+address $86
+address $84
+address $86
+address $84
+address $84
+address $84
+address $84
+address $86
+code
+LABELV $86
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $85
+ADDRLP4 4
+INDIRI4
+CNSTI4 5000
+LTI4 $91
+ADDRGP4 cg+124984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $91
+LABELV $78
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $77
+ADDRLP4 12
+ADDRGP4 cg+124984
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRGP4 cg+124984
+CNSTI4 2
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRGP4 cg+124984
+CNSTI4 1
+ASGNI4
+LABELV $96
+ADDRGP4 cg+124984
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $99
+ADDRGP4 cgs+180272+1084
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $99
+LABELV $75
+endproc CG_CheckAmmo 24 8
+export CG_DamageFeedback
+proc CG_DamageFeedback 84 16
+ADDRGP4 cg+125008
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 40
+GEI4 $108
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 28
+CNSTF4 1109393408
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $109
+ADDRLP4 12
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+GEF4 $110
+ADDRLP4 12
+CNSTF4 1084227584
+ASGNF4
+LABELV $110
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+LEF4 $112
+ADDRLP4 12
+CNSTF4 1092616192
+ASGNF4
+LABELV $112
+ADDRLP4 60
+CNSTI4 255
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $114
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $114
+ADDRGP4 cg+125284
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+125288
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+125332
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+125328
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 64
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 68
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 56
+ADDRLP4 64
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 64
+INDIRF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+109252+36
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+109252+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+109252+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 76
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1036831949
+GEF4 $166
+ADDRLP4 44
+CNSTF4 1036831949
+ASGNF4
+LABELV $166
+ADDRGP4 cg+125332
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+125328
+ADDRLP4 12
+INDIRF4
+NEGF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1036831949
+GTF4 $170
+ADDRLP4 16
+CNSTF4 1036831949
+ASGNF4
+LABELV $170
+ADDRGP4 cg+125284
+ADDRLP4 24
+INDIRF4
+NEGF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+125288
+ADDRLP4 48
+INDIRF4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $115
+ADDRGP4 cg+125284
+INDIRF4
+CNSTF4 1065353216
+LEF4 $174
+ADDRGP4 cg+125284
+CNSTF4 1065353216
+ASGNF4
+LABELV $174
+ADDRGP4 cg+125284
+INDIRF4
+CNSTF4 3212836864
+GEF4 $178
+ADDRGP4 cg+125284
+CNSTF4 3212836864
+ASGNF4
+LABELV $178
+ADDRGP4 cg+125288
+INDIRF4
+CNSTF4 1065353216
+LEF4 $182
+ADDRGP4 cg+125288
+CNSTF4 1065353216
+ASGNF4
+LABELV $182
+ADDRGP4 cg+125288
+INDIRF4
+CNSTF4 3212836864
+GEF4 $186
+ADDRGP4 cg+125288
+CNSTF4 3212836864
+ASGNF4
+LABELV $186
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+LEF4 $190
+ADDRLP4 12
+CNSTF4 1092616192
+ASGNF4
+LABELV $190
+ADDRGP4 cg+125292
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 cg+125324
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 500
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+125280
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $104
+endproc CG_DamageFeedback 84 16
+export CG_Respawn
+proc CG_Respawn 0 0
+ADDRGP4 cg+107592
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $197
+endproc CG_Respawn 0 0
+export CG_CheckPlayerstateEvents
+proc CG_CheckPlayerstateEvents 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 128
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $204
+ADDRLP4 4
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $204
+ADDRLP4 4
+ADDRGP4 cg+108104
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $207
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $213
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+LEI4 $211
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 112
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $211
+LABELV $213
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+109064
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 cg+109060
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $211
+LABELV $208
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $210
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $207
+LABELV $203
+endproc CG_CheckPlayerstateEvents 52 8
+export CG_CheckChangedPredictableEvents
+proc CG_CheckChangedPredictableEvents 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+108104
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109060
+INDIRI4
+LTI4 $222
+ADDRGP4 $219
+JUMPV
+LABELV $222
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109060
+INDIRI4
+CNSTI4 16
+SUBI4
+LEI4 $225
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cg+109064
+ADDP4
+INDIRI4
+EQI4 $228
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+109064
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $232
+ADDRGP4 $235
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $232
+LABELV $228
+LABELV $225
+LABELV $219
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $221
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $218
+LABELV $216
+endproc CG_CheckChangedPredictableEvents 24 8
+proc pushReward 4 0
+ADDRGP4 cg+125016
+INDIRI4
+CNSTI4 9
+GEI4 $237
+ADDRLP4 0
+ADDRGP4 cg+125016
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+125016
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125104
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125016
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125064
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125016
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+125024
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $237
+LABELV $236
+endproc pushReward 4 0
+export CG_CheckLocalSounds
+proc CG_CheckLocalSounds 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 260
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $248
+ADDRGP4 $247
+JUMPV
+LABELV $248
+ADDRLP4 16
+CNSTI4 252
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $250
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 8
+RSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 50
+LEI4 $252
+ADDRGP4 cgs+180272+1172
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $252
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $258
+ADDRLP4 24
+INDIRI4
+CNSTI4 100
+LEI4 $256
+LABELV $258
+ADDRGP4 cgs+180272+1176
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $256
+ADDRGP4 cgs+180272+1168
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRLP4 20
+CNSTI4 252
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $263
+ADDRGP4 cgs+180272+1180
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $263
+LABELV $251
+ADDRLP4 24
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $269
+ADDRGP4 cg+108104
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+LABELV $269
+LABELV $267
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 $247
+JUMPV
+LABELV $272
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTI4 304
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $275
+ADDRGP4 cgs+180272+1268
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+740
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $275
+ADDRLP4 32
+CNSTI4 284
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $283
+ADDRLP4 4
+ADDRGP4 cgs+180272+1208
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 4
+ADDRGP4 cgs+180272+1184
+INDIRI4
+ASGNI4
+LABELV $284
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+720
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $281
+ADDRGP4 cgs+181768
+INDIRI4
+CNSTI4 0
+NEI4 $291
+ADDRLP4 36
+CNSTI4 288
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $296
+ADDRLP4 4
+ADDRGP4 cgs+180272+1212
+INDIRI4
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 4
+ADDRGP4 cgs+180272+1188
+INDIRI4
+ASGNI4
+LABELV $297
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+724
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $294
+LABELV $291
+ADDRLP4 36
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $304
+ADDRFP4 4
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $306
+ADDRLP4 4
+ADDRGP4 cgs+180272+1216
+INDIRI4
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 4
+ADDRGP4 cgs+180272+1196
+INDIRI4
+ASGNI4
+LABELV $307
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+728
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $304
+ADDRLP4 40
+CNSTI4 292
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $314
+ADDRGP4 cgs+180272+1204
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+732
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $314
+ADDRLP4 44
+CNSTI4 296
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $320
+ADDRGP4 cgs+180272+1200
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+736
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 pushReward
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $320
+ADDRLP4 48
+CNSTI4 268
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $326
+ADDRLP4 52
+CNSTI4 268
+ASGNI4
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+BANDI4
+EQI4 $328
+ADDRGP4 cgs+180272+1192
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 60
+CNSTI4 268
+ASGNI4
+ADDRLP4 64
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BANDI4
+EQI4 $332
+ADDRGP4 cgs+180272+1196
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 68
+CNSTI4 268
+ASGNI4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+BANDI4
+EQI4 $336
+ADDRGP4 cgs+180272+1352
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $336
+LABELV $333
+LABELV $329
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $326
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LEI4 $340
+ADDRLP4 52
+CNSTI4 340
+ASGNI4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $346
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $347
+LABELV $346
+ADDRLP4 60
+CNSTI4 344
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $348
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $347
+LABELV $348
+ADDRLP4 68
+CNSTI4 348
+ASGNI4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $343
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $343
+LABELV $347
+ADDRGP4 cgs+180272+1344
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $343
+LABELV $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $351
+ADDRGP4 cg+125248
+INDIRI4
+CNSTI4 0
+NEI4 $353
+ADDRLP4 52
+CNSTI4 256
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $356
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $362
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 1
+NEI4 $358
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $363
+ADDRGP4 cgs+180272+1220
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 16384
+NEI4 $367
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+EQI4 $367
+ADDRGP4 cgs+180272+1224
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 56
+CNSTI4 256
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 16384
+EQI4 $372
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+CNSTI4 0
+NEI4 $372
+ADDRGP4 cgs+180272+1228
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $372
+LABELV $368
+LABELV $364
+LABELV $358
+LABELV $356
+LABELV $353
+LABELV $351
+ADDRGP4 cgs+31484
+INDIRI4
+CNSTI4 0
+LEI4 $376
+ADDRGP4 cgs+31484
+INDIRI4
+CNSTI4 1000
+GTI4 $376
+ADDRLP4 52
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+34804
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+107616
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $382
+ADDRLP4 52
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+CNSTI4 2000
+ADDI4
+LEI4 $382
+ADDRLP4 56
+ADDRGP4 cg+107616
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 cgs+180272+1152
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRGP4 cg+107616
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $389
+ADDRLP4 52
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+CNSTI4 60000
+SUBI4
+LEI4 $389
+ADDRLP4 56
+ADDRGP4 cg+107616
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cgs+180272+1144
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRGP4 cgs+31484
+INDIRI4
+CNSTI4 5
+LEI4 $396
+ADDRGP4 cg+107616
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $396
+ADDRLP4 52
+INDIRI4
+CNSTI4 1000
+CNSTI4 60
+ADDRGP4 cgs+31484
+INDIRI4
+MULI4
+MULI4
+CNSTI4 300000
+SUBI4
+LEI4 $396
+ADDRLP4 56
+ADDRGP4 cg+107616
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cgs+180272+1148
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $396
+LABELV $390
+LABELV $383
+LABELV $376
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 0
+LEI4 $404
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+GEI4 $404
+ADDRLP4 8
+ADDRGP4 cgs+34984
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+NEI4 $409
+ADDRGP4 cgs+34988
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $409
+ADDRLP4 8
+ADDRGP4 cgs+34988
+INDIRI4
+ASGNI4
+LABELV $409
+ADDRGP4 cg+107620
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+31476
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $414
+ADDRLP4 52
+ADDRGP4 cg+107620
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 7
+BORI4
+ASGNI4
+ADDRGP4 cgs+180272+1164
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $421
+ADDRGP4 cg+107620
+INDIRI4
+ADDRLP4 52
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $421
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+NEI4 $421
+ADDRLP4 56
+ADDRGP4 cg+107620
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 3
+BORI4
+ASGNI4
+ADDRGP4 cgs+180272+1160
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $422
+JUMPV
+LABELV $421
+ADDRLP4 56
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $429
+ADDRGP4 cg+107620
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $429
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+31476
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+NEI4 $429
+ADDRLP4 60
+ADDRGP4 cg+107620
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 cgs+180272+1156
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $429
+LABELV $422
+LABELV $415
+LABELV $404
+LABELV $247
+endproc CG_CheckLocalSounds 76 12
+export CG_TransitionPlayerState
+proc CG_TransitionPlayerState 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $438
+ADDRGP4 cg+107592
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 468
+LABELV $438
+ADDRLP4 8
+CNSTI4 168
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DamageFeedback
+CALLV
+pop
+LABELV $441
+ADDRLP4 12
+CNSTI4 264
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $443
+ADDRGP4 CG_Respawn
+CALLV
+pop
+LABELV $443
+ADDRGP4 cg+107624
+INDIRI4
+CNSTI4 0
+EQI4 $445
+ADDRGP4 CG_Respawn
+CALLV
+pop
+ADDRGP4 cg+107624
+CNSTI4 0
+ASGNI4
+LABELV $445
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $449
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckLocalSounds
+CALLV
+pop
+LABELV $449
+ADDRGP4 CG_CheckAmmo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CheckPlayerstateEvents
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 164
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $452
+ADDRLP4 20
+CNSTI4 164
+ASGNI4
+ADDRGP4 cg+109136
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+109140
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $452
+LABELV $437
+endproc CG_TransitionPlayerState 24 12
+import eventnames
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $235
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
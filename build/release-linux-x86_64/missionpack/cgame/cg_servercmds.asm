@@ -0,0 +1,9100 @@
+lit
+align 4
+LABELV validOrders
+address $76
+byte 4 1
+address $77
+byte 4 1
+address $78
+byte 4 2
+address $79
+byte 4 2
+address $80
+byte 4 3
+address $81
+byte 4 7
+address $82
+byte 4 4
+address $83
+byte 4 5
+address $84
+byte 4 6
+align 4
+LABELV numValidOrders
+byte 4 9
+code
+proc CG_ValidOrder 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $86
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 validOrders
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $90
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 validOrders+4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $85
+JUMPV
+LABELV $90
+LABELV $87
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numValidOrders
+INDIRI4
+LTI4 $86
+CNSTI4 -1
+RETI4
+LABELV $85
+endproc CG_ValidOrder 8 8
+proc CG_ParseScores 240 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110672
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110672
+INDIRI4
+CNSTI4 64
+LEI4 $95
+ADDRGP4 cg+110672
+CNSTI4 64
+ASGNI4
+LABELV $95
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110680
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110680+4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $107
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $103
+LABELV $107
+ADDRGP4 cgs+34984
+ADDRGP4 cg+110680
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRGP4 cg+110680+4
+INDIRI4
+ASGNI4
+LABELV $103
+ADDRGP4 cg+110688
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $115
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+8
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+12
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+16
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+24
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+28
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+32
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+36
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+40
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+44
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+52
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+CNSTI4 14
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+48
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 15
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ADDRLP4 208
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688+60
+ADDP4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $151
+ADDRLP4 224
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $147
+LABELV $151
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $147
+ADDRLP4 228
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+100
+ADDP4
+ADDRLP4 228
+INDIRI4
+ADDRGP4 cg+110688+4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+140
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 232
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+2100
+ADDP4
+ADDRLP4 232
+INDIRI4
+ADDRGP4 cg+110688+60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRGP4 cg+110688+56
+ADDP4
+CNSTI4 2120
+ADDRLP4 236
+INDIRI4
+ADDRGP4 cg+110688
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $116
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $118
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110672
+INDIRI4
+LTI4 $115
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_SetScoreSelection
+CALLV
+pop
+LABELV $93
+endproc CG_ParseScores 240 12
+proc CG_ParseAccuracy 32 4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $172
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+CNSTI4 4
+SUBI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+114796-16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 4
+SUBI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 cg+114796-16+4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $173
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $172
+LABELV $171
+endproc CG_ParseAccuracy 32 4
+proc CG_ParseElimination 16 4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $186
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $182
+LABELV $186
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34984
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $182
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $181
+endproc CG_ParseElimination 16 4
+proc CG_ParseMappage 1060 12
+CNSTI4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $194
+JUMPV
+LABELV $191
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+CNSTI4 10
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+EQI4 $190
+ADDRLP4 1040
+INDIRI4
+CNSTI4 13
+EQI4 $190
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $195
+LABELV $199
+ADDRLP4 1040
+INDIRI4
+CNSTI4 59
+EQI4 $190
+ADDRGP4 $195
+JUMPV
+LABELV $195
+LABELV $192
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $194
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $191
+ADDRGP4 $200
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $201
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $208
+JUMPV
+LABELV $205
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+CNSTI4 10
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+EQI4 $190
+ADDRLP4 1048
+INDIRI4
+CNSTI4 13
+EQI4 $190
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LTI4 $209
+LABELV $213
+ADDRLP4 1048
+INDIRI4
+CNSTI4 59
+EQI4 $190
+ADDRGP4 $209
+JUMPV
+LABELV $209
+LABELV $206
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $205
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 1
+GEI4 $214
+ADDRLP4 4
+ADDRGP4 $216
+ASGNP4
+LABELV $214
+ADDRGP4 $217
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $202
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+LTI4 $201
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $190
+endproc CG_ParseMappage 1060 12
+proc CG_ParseDDtimetaken 8 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34832
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $218
+endproc CG_ParseDDtimetaken 8 4
+proc CG_ParseDomPointNames 24 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34836
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34836
+INDIRI4
+CNSTI4 6
+LTI4 $222
+ADDRGP4 cgs+34836
+CNSTI4 6
+ASGNI4
+LABELV $222
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ARGP4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 19
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $233
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $235
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+34840
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+GEI4 $238
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $232
+LABELV $238
+LABELV $227
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+34836
+INDIRI4
+LTI4 $226
+LABELV $220
+endproc CG_ParseDomPointNames 24 12
+proc CG_ParseDomStatus 28 4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34836
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $240
+ADDRGP4 cgs+34836
+CNSTI4 0
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $240
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $244
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 cgs+34960
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $245
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $247
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+34836
+INDIRI4
+LTI4 $244
+LABELV $239
+endproc CG_ParseDomStatus 28 4
+proc CG_ParseChallenge 8 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 addChallenge
+CALLV
+pop
+LABELV $250
+endproc CG_ParseChallenge 8 4
+proc CG_ParseObeliskHealth 16 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+156496
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+156500
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $251
+endproc CG_ParseObeliskHealth 16 4
+proc CG_ParseRespawnTime 8 4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+156492
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $254
+endproc CG_ParseRespawnTime 8 4
+proc CG_ParseTeam 4 8
+ADDRGP4 cg_voip_teamonly+12
+INDIRI4
+CNSTI4 0
+EQI4 $257
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $260
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $257
+LABELV $256
+endproc CG_ParseTeam 4 8
+proc CG_ParseAttackingTeam 12 4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $262
+ADDRGP4 cgs+34820
+CNSTI4 1
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $265
+ADDRGP4 cgs+34820
+CNSTI4 2
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRGP4 cgs+34820
+CNSTI4 3
+ASGNI4
+LABELV $266
+LABELV $263
+LABELV $261
+endproc CG_ParseAttackingTeam 12 4
+proc CG_ParseTeamInfo 76 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $272
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+LEI4 $270
+LABELV $272
+ADDRGP4 $273
+ARGP4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $269
+JUMPV
+LABELV $270
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $278
+LABELV $280
+ADDRGP4 $281
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $269
+JUMPV
+LABELV $278
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+104
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+108
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+112
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 6
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+116
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2120
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+140
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $275
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $277
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $274
+LABELV $269
+endproc CG_ParseTeamInfo 76 8
+export CG_ParseServerinfo
+proc CG_ParseServerinfo 164 16
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31456
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34808
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 10
+EQI4 $300
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $296
+LABELV $300
+ADDRGP4 cgs+34808
+CNSTI4 1
+ASGNI4
+LABELV $296
+ADDRGP4 $302
+ARGP4
+ADDRGP4 cgs+31456
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31460
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31464
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31468
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31472
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $313
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31476
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $315
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31480
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $317
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31484
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $319
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31488
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 88
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34816
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 96
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34828
+ADDRLP4 100
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 120
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34824
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 128
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+181768
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $330
+ARGP4
+ADDRLP4 136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31492
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 140
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31556
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $335
+ARGP4
+ADDRGP4 cgs+31556
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRLP4 144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31620
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $339
+ARGP4
+ADDRGP4 cgs+31620
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+181764
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $302
+ARGP4
+ADDRGP4 cgs+181764
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRLP4 160
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $345
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $292
+endproc CG_ParseServerinfo 164 16
+proc CG_ParseWarmup 24 8
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+125252
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $349
+ADDRGP4 cg+125248
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $349
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $352
+ADDRGP4 cg+125248
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $352
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $355
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 14
+GEI4 $355
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRGP4 cgs+180272+1424
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRGP4 cgs+180272+1372
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $356
+LABELV $352
+LABELV $350
+ADDRGP4 cg+125248
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $347
+endproc CG_ParseWarmup 24 8
+export CG_SetConfigValues
+proc CG_SetConfigValues 36 4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34984
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $375
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $375
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $369
+LABELV $375
+CNSTI4 23
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+34992
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34996
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $382
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $378
+LABELV $382
+CNSTI4 23
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+35000
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $378
+LABELV $370
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+125248
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $365
+endproc CG_SetConfigValues 36 4
+export CG_ShaderStateChanged
+proc CG_ShaderStateChanged 188 12
+CNSTI4 24
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $388
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $388
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 172
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $388
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $388
+ADDRLP4 76
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $394
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 180
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $391
+ADDRLP4 140
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 140
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $391
+LABELV $387
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $398
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $386
+LABELV $398
+LABELV $388
+LABELV $385
+endproc CG_ShaderStateChanged 188 12
+proc CG_ConfigStringModified 48 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $400
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $402
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $402
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $404
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $406
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34984
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $409
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34988
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 0
+INDIRI4
+CNSTI4 21
+NEI4 $412
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $415
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31684
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31696
+CNSTI4 1
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $419
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31688
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31696
+CNSTI4 1
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $423
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31692
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31696
+CNSTI4 1
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $427
+ADDRGP4 cgs+31700
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+180272+1232
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $433
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $433
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724-48
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748-48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $439
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $439
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32732-64
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748-64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $445
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $445
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740-72
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32748-72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+GTI4 $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32756-14336
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+180272+1232
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+NEI4 $458
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $461
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+GEI4 $461
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35008-128
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+LTI4 $465
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+GEI4 $465
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $466
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36032-1152
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+LTI4 $471
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+GEI4 $471
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+SUBI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+NEI4 $473
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $481
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+EQI4 $481
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 11
+NEI4 $475
+LABELV $481
+ADDRGP4 cgs+34992
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34996
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $475
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 5
+EQI4 $488
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 13
+NEI4 $474
+LABELV $488
+ADDRGP4 cgs+35000
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+NEI4 $490
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+LABELV $490
+LABELV $474
+LABELV $472
+LABELV $466
+LABELV $462
+LABELV $459
+LABELV $452
+LABELV $446
+LABELV $440
+LABELV $434
+LABELV $428
+LABELV $424
+LABELV $420
+LABELV $416
+LABELV $413
+LABELV $410
+LABELV $407
+LABELV $405
+LABELV $403
+LABELV $401
+LABELV $399
+endproc CG_ConfigStringModified 48 12
+proc CG_AddToTeamChat 56 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $493
+ADDRLP4 12
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+LABELV $494
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $500
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $497
+LABELV $500
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+178800
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+178796
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $497
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+176836
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 55
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 4
+INDIRI4
+CNSTI4 79
+LEI4 $508
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $510
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $510
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+178764
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+178796
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+176836
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $508
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $518
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $518
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $518
+ADDRLP4 28
+INDIRI4
+CNSTI4 56
+GTI4 $518
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 48
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $506
+JUMPV
+LABELV $518
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $520
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $520
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $506
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $505
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+178764
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+178796
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRGP4 cgs+178800
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+LEI4 $526
+ADDRGP4 cgs+178800
+ADDRGP4 cgs+178796
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $526
+LABELV $492
+endproc CG_AddToTeamChat 56 0
+proc CG_MapRestart 12 12
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $533
+ADDRGP4 $536
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $533
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+107620
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107616
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31684
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107624
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 cg+125248
+INDIRI4
+CNSTI4 0
+NEI4 $542
+ADDRGP4 cgs+180272+1368
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $547
+ARGP4
+CNSTI4 120
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $542
+ADDRGP4 cg_singlePlayerActive+12
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRGP4 $302
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $551
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_recordSPDemo+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $553
+ADDRGP4 cg_recordSPDemoName+16
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+EQI4 $553
+ADDRGP4 $557
+ARGP4
+ADDRGP4 cg_recordSPDemoName+16
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $553
+LABELV $548
+ADDRGP4 $559
+ARGP4
+ADDRGP4 $560
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $532
+endproc CG_MapRestart 12 12
+export CG_ParseVoiceChats
+proc CG_ParseVoiceChats 16508 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16420
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 16420
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRGP4 $567
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16424
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $565
+ADDRLP4 24
+INDIRI4
+CNSTI4 16384
+LTI4 $568
+ADDRGP4 $570
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16424
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $568
+ADDRLP4 32
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 16416
+ADDRLP4 32
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16416
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $575
+JUMPV
+LABELV $572
+CNSTI4 4420
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $573
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $575
+ADDRLP4 20
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $572
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16424
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16424
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $578
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $576
+LABELV $578
+CNSTI4 1
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $576
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRLP4 16432
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16432
+INDIRI4
+CNSTI4 0
+NEI4 $579
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $584
+ARGP4
+ADDRLP4 16436
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16436
+INDIRI4
+CNSTI4 0
+NEI4 $582
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $587
+ARGP4
+ADDRLP4 16440
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16440
+INDIRI4
+CNSTI4 0
+NEI4 $585
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRGP4 $588
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16444
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16444
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $586
+LABELV $583
+LABELV $580
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16444
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16444
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $594
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $592
+LABELV $594
+CNSTI4 1
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $592
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16452
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16452
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $597
+ARGP4
+ADDRLP4 16456
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16456
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRGP4 $598
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16460
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16460
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $595
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $599
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16460
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16460
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $604
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $602
+LABELV $604
+CNSTI4 1
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $602
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 16468
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16468
+INDIRI4
+CNSTI4 0
+NEI4 $605
+ADDRGP4 $601
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16472
+INDIRI4
+ASGNI4
+ADDRLP4 16476
+CNSTI4 68
+ASGNI4
+ADDRLP4 16480
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16476
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16480
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16480
+INDIRP4
+ADDRLP4 16476
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16484
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16484
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $610
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $608
+LABELV $610
+CNSTI4 1
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $608
+ADDRLP4 16492
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16496
+CNSTI4 64
+ASGNI4
+ADDRLP4 16492
+INDIRP4
+ADDRLP4 16496
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRLP4 16492
+INDIRP4
+CNSTI4 324
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 16496
+INDIRI4
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 16500
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 16500
+INDIRP4
+ADDRLP4 16500
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $611
+ADDRLP4 16504
+CNSTI4 64
+ASGNI4
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 16504
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16504
+INDIRI4
+LTI4 $613
+ADDRGP4 $601
+JUMPV
+LABELV $613
+LABELV $600
+ADDRGP4 $599
+JUMPV
+LABELV $601
+ADDRLP4 16460
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16460
+INDIRP4
+ADDRLP4 16460
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $615
+CNSTI4 1
+RETI4
+ADDRGP4 $561
+JUMPV
+LABELV $615
+LABELV $590
+ADDRGP4 $589
+JUMPV
+CNSTI4 1
+RETI4
+LABELV $561
+endproc CG_ParseVoiceChats 16508 16
+export CG_LoadVoiceChats
+proc CG_LoadVoiceChats 12 12
+ADDRLP4 4
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $618
+ARGP4
+ADDRGP4 voiceChatLists
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $619
+ARGP4
+ADDRGP4 voiceChatLists+282952
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $621
+ARGP4
+ADDRGP4 voiceChatLists+565904
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $623
+ARGP4
+ADDRGP4 voiceChatLists+848856
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $625
+ARGP4
+ADDRGP4 voiceChatLists+1131808
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $627
+ARGP4
+ADDRGP4 voiceChatLists+1414760
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $629
+ARGP4
+ADDRGP4 voiceChatLists+1697712
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $631
+ARGP4
+ADDRGP4 voiceChatLists+1980664
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRLP4 8
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRGP4 $633
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $617
+endproc CG_LoadVoiceChats 12 12
+export CG_HeadModelVoiceChats
+proc CG_HeadModelVoiceChats 16424 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16408
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16408
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $635
+CNSTI4 -1
+RETI4
+ADDRGP4 $634
+JUMPV
+LABELV $635
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+LTI4 $637
+ADDRGP4 $570
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16412
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $634
+JUMPV
+LABELV $637
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 16404
+ADDRLP4 16
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16404
+ASGNP4
+ADDRLP4 16400
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16412
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $641
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $639
+LABELV $641
+CNSTI4 -1
+RETI4
+ADDRGP4 $634
+JUMPV
+LABELV $639
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $642
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+ARGP4
+ADDRLP4 16420
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16420
+INDIRI4
+CNSTI4 0
+NEI4 $646
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $634
+JUMPV
+LABELV $646
+LABELV $643
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $642
+CNSTI4 -1
+RETI4
+LABELV $634
+endproc CG_HeadModelVoiceChats 16424 16
+export CG_GetVoiceChat
+proc CG_GetVoiceChat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $652
+JUMPV
+LABELV $649
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $653
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+CNSTI4 324
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $648
+JUMPV
+LABELV $653
+LABELV $650
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $652
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $649
+CNSTI4 0
+RETI4
+LABELV $648
+endproc CG_GetVoiceChat 20 8
+export CG_VoiceChatListForClient
+proc CG_VoiceChatListForClient 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $658
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $656
+LABELV $658
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $656
+ADDRLP4 148
+CNSTI4 2120
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $660
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $664
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $666
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 289
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $666
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $668
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $669
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 289
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $670
+LABELV $665
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $671
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $675
+ADDRGP4 $673
+JUMPV
+LABELV $675
+LABELV $672
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $671
+LABELV $673
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $677
+CNSTI4 282952
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $655
+JUMPV
+LABELV $677
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $680
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $684
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $686
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 76
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_HeadModelVoiceChats
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 -1
+NEI4 $687
+ADDRGP4 $682
+JUMPV
+LABELV $687
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 282952
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $655
+JUMPV
+LABELV $684
+LABELV $681
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $680
+LABELV $682
+LABELV $661
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LTI4 $660
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $691
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $695
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $699
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists+64
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $701
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $704
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $708
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $706
+JUMPV
+LABELV $708
+LABELV $705
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $704
+LABELV $706
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $655
+JUMPV
+LABELV $701
+LABELV $699
+LABELV $696
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $695
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $711
+ADDRGP4 $693
+JUMPV
+LABELV $711
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $692
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LTI4 $691
+LABELV $693
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $713
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $717
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $715
+JUMPV
+LABELV $717
+LABELV $714
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $713
+LABELV $715
+ADDRGP4 voiceChatLists
+RETP4
+LABELV $655
+endproc CG_VoiceChatListForClient 164 20
+export CG_PlayVoiceChat
+proc CG_PlayVoiceChat 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $721
+ADDRGP4 $720
+JUMPV
+LABELV $721
+ADDRGP4 cg_noVoiceChats+12
+INDIRI4
+CNSTI4 0
+NEI4 $724
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $727
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_ValidOrder
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $730
+ADDRGP4 cgs+180228
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 cgs+180240
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cgs+180232
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+180236
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $730
+ADDRGP4 CG_ShowResponseHead
+CALLV
+pop
+LABELV $727
+LABELV $724
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $738
+ADDRGP4 cg_noVoiceText+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $738
+ADDRFP4 0
+INDIRP4
+CNSTI4 162
+ADDP4
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $741
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 162
+ADDP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $738
+CNSTI4 312
+ADDRGP4 cg+125244
+INDIRI4
+MULI4
+ADDRGP4 voiceChatBuffer+4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $720
+endproc CG_PlayVoiceChat 8 12
+export CG_PlayBufferedVoiceChats
+proc CG_PlayBufferedVoiceChats 0 4
+ADDRGP4 cg+125236
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $745
+ADDRGP4 cg+125244
+INDIRI4
+ADDRGP4 cg+125240
+INDIRI4
+EQI4 $749
+CNSTI4 312
+ADDRGP4 cg+125244
+INDIRI4
+MULI4
+ADDRGP4 voiceChatBuffer+4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $749
+CNSTI4 312
+ADDRGP4 cg+125244
+INDIRI4
+MULI4
+ADDRGP4 voiceChatBuffer
+ADDP4
+ARGP4
+ADDRGP4 CG_PlayVoiceChat
+CALLV
+pop
+ADDRGP4 cg+125244
+ADDRGP4 cg+125244
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 32
+MODI4
+ASGNI4
+ADDRGP4 cg+125236
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $749
+LABELV $745
+LABELV $744
+endproc CG_PlayBufferedVoiceChats 0 4
+export CG_AddBufferedVoiceChat
+proc CG_AddBufferedVoiceChat 8 12
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $761
+ADDRGP4 $760
+JUMPV
+LABELV $761
+ADDRLP4 0
+CNSTI4 312
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+125240
+INDIRI4
+MULI4
+ADDRGP4 voiceChatBuffer
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 cg+125240
+ADDRGP4 cg+125240
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 32
+MODI4
+ASGNI4
+ADDRGP4 cg+125240
+INDIRI4
+ADDRGP4 cg+125244
+INDIRI4
+NEI4 $767
+CNSTI4 312
+ADDRGP4 cg+125244
+INDIRI4
+MULI4
+ADDRGP4 voiceChatBuffer
+ADDP4
+ARGP4
+ADDRGP4 CG_PlayVoiceChat
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg+125244
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $767
+LABELV $760
+endproc CG_AddBufferedVoiceChat 8 12
+export CG_VoiceChatLocal
+proc CG_VoiceChatLocal 344 28
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $774
+ADDRGP4 $773
+JUMPV
+LABELV $774
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $779
+ADDRFP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $777
+LABELV $779
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+LABELV $777
+ADDRLP4 320
+CNSTI4 2120
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRGP4 cgs+180224
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 336
+ADDRGP4 CG_VoiceChatListForClient
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 336
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 324
+ARGP4
+ADDRLP4 316
+ARGP4
+ADDRLP4 340
+ADDRGP4 CG_GetVoiceChat
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $782
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $787
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+CNSTI4 0
+NEI4 $784
+LABELV $787
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+12
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $792
+ADDRLP4 4+162
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 $796
+ARGP4
+ADDRLP4 320
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $793
+JUMPV
+LABELV $792
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $797
+ADDRLP4 4+162
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 $801
+ARGP4
+ADDRLP4 320
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 4+162
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 $804
+ARGP4
+ADDRLP4 320
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $798
+LABELV $793
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddBufferedVoiceChat
+CALLV
+pop
+LABELV $784
+LABELV $782
+LABELV $773
+endproc CG_VoiceChatLocal 344 28
+export CG_VoiceChat
+proc CG_VoiceChat 64 20
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noTaunt+12
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $811
+ARGP4
+ADDRLP4 44
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $812
+ARGP4
+ADDRLP4 48
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $813
+ARGP4
+ADDRLP4 52
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $814
+ARGP4
+ADDRLP4 56
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $815
+ARGP4
+ADDRLP4 60
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $809
+LABELV $819
+ADDRGP4 $805
+JUMPV
+LABELV $809
+LABELV $806
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_VoiceChatLocal
+CALLV
+pop
+LABELV $805
+endproc CG_VoiceChat 64 20
+proc CG_RemoveChatEscapeChar 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $821
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 25
+NEI4 $825
+ADDRGP4 $822
+JUMPV
+LABELV $825
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $822
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $824
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $821
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $820
+endproc CG_RemoveChatEscapeChar 20 0
+proc CG_ServerCommand 1296 12
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $828
+ADDRGP4 $827
+JUMPV
+LABELV $828
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $832
+ARGP4
+ADDRLP4 160
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $830
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $830
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $835
+ARGP4
+ADDRLP4 164
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $833
+ADDRGP4 CG_ConfigStringModified
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $833
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $838
+ARGP4
+ADDRLP4 168
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $836
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $841
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 180
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $843
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $842
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 184
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $839
+LABELV $843
+ADDRGP4 cgs+180272+1240
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $839
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $848
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 188
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $850
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $849
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 192
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $827
+LABELV $850
+ADDRGP4 cgs+180272+1236
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $836
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $855
+ARGP4
+ADDRLP4 172
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $853
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+CNSTI4 0
+NEI4 $827
+ADDRGP4 cg_chatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $859
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $859
+CNSTI4 1
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRGP4 $741
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $853
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $866
+ARGP4
+ADDRLP4 176
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $864
+ADDRGP4 cg_teamChatBeep+12
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRGP4 cgs+180272+1092
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $867
+CNSTI4 1
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $741
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $864
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $874
+ARGP4
+ADDRLP4 180
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $872
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $872
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $877
+ARGP4
+ADDRLP4 184
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $875
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $875
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $880
+ARGP4
+ADDRLP4 188
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $878
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $878
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $883
+ARGP4
+ADDRLP4 192
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $881
+ADDRGP4 CG_ParseScores
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $881
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $886
+ARGP4
+ADDRLP4 196
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $884
+ADDRGP4 CG_ParseAccuracy
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $884
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $889
+ARGP4
+ADDRLP4 200
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $887
+ADDRGP4 CG_ParseDDtimetaken
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $887
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $892
+ARGP4
+ADDRLP4 204
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $890
+ADDRGP4 CG_ParseDomPointNames
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $890
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $895
+ARGP4
+ADDRLP4 208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $893
+ADDRGP4 CG_ParseDomStatus
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $893
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $898
+ARGP4
+ADDRLP4 212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $896
+ADDRGP4 CG_ParseElimination
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $896
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $901
+ARGP4
+ADDRLP4 216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $899
+ADDRGP4 CG_ParseMappage
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $899
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $904
+ARGP4
+ADDRLP4 220
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $902
+ADDRGP4 CG_ParseAttackingTeam
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $902
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $907
+ARGP4
+ADDRLP4 224
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $905
+ADDRGP4 CG_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $905
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $910
+ARGP4
+ADDRLP4 228
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $908
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $908
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $913
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $911
+ADDRLP4 236
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 4
+NEI4 $827
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 240
+ARGP4
+ADDRLP4 432
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 436
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 440
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 368
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 240
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $911
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $918
+ARGP4
+ADDRLP4 236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $916
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $916
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $919
+ADDRGP4 cg+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $827
+JUMPV
+LABELV $919
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $925
+ARGP4
+ADDRLP4 244
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $923
+ADDRGP4 CG_ParseChallenge
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $923
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $928
+ARGP4
+ADDRLP4 248
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $926
+ADDRGP4 CG_ParseObeliskHealth
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $926
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $931
+ARGP4
+ADDRLP4 252
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $929
+ADDRGP4 CG_ParseRespawnTime
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $929
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $934
+ARGP4
+ADDRLP4 256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $932
+ADDRGP4 CG_ParseTeam
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $932
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $937
+ARGP4
+ADDRLP4 260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $935
+ADDRLP4 264
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1024
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1288
+CNSTI4 1
+ASGNI4
+LABELV $938
+ADDRLP4 1288
+INDIRI4
+ARGI4
+ADDRLP4 1292
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 264
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1292
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 264
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $942
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $939
+ADDRLP4 1288
+ADDRLP4 1288
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+CNSTI4 12
+LEI4 $938
+ADDRGP4 $943
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $827
+JUMPV
+LABELV $935
+ADDRGP4 $944
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $827
+endproc CG_ServerCommand 1296 12
+export CG_ExecuteNewServerCommands
+proc CG_ExecuteNewServerCommands 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $946
+ADDRLP4 0
+ADDRGP4 cgs+31444
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_GetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $950
+ADDRGP4 CG_ServerCommand
+CALLV
+pop
+LABELV $950
+LABELV $947
+ADDRGP4 cgs+31444
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $946
+LABELV $945
+endproc CG_ExecuteNewServerCommands 12 4
+bss
+export voiceChatBuffer
+align 4
+LABELV voiceChatBuffer
+skip 9984
+export headModelVoiceChat
+align 4
+LABELV headModelVoiceChat
+skip 4352
+export voiceChatLists
+align 4
+LABELV voiceChatLists
+skip 2263616
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponBar7
+import CG_DrawWeaponBar6
+import CG_DrawWeaponBar5
+import CG_DrawWeaponBar4
+import CG_DrawWeaponBar3
+import CG_DrawWeaponBar2
+import CG_DrawWeaponBar1
+import CG_DrawWeaponBar0
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $944
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $943
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $942
+byte 1 32
+byte 1 0
+align 1
+LABELV $937
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $934
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $931
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $928
+byte 1 111
+byte 1 104
+byte 1 0
+align 1
+LABELV $925
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $921
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $918
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $913
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $910
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $907
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $904
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $901
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $898
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $895
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $892
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $889
+byte 1 100
+byte 1 100
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $886
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $883
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $880
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $877
+byte 1 118
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $874
+byte 1 118
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $866
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $855
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $849
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $848
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $842
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $841
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $838
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $835
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $832
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $815
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $814
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $813
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $812
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $811
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $804
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $801
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $796
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 93
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $741
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $686
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 118
+byte 1 99
+byte 1 0
+align 1
+LABELV $668
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $633
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $631
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 53
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $629
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 52
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $627
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $625
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $623
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $619
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $618
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $607
+byte 1 125
+byte 1 0
+align 1
+LABELV $598
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $597
+byte 1 123
+byte 1 0
+align 1
+LABELV $588
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $587
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $584
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $581
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $571
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $570
+byte 1 94
+byte 1 49
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $567
+byte 1 94
+byte 1 49
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $560
+byte 1 48
+byte 1 0
+align 1
+LABELV $559
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $557
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $551
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $547
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 33
+byte 1 0
+align 1
+LABELV $536
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $395
+byte 1 64
+byte 1 0
+align 1
+LABELV $392
+byte 1 58
+byte 1 0
+align 1
+LABELV $389
+byte 1 61
+byte 1 0
+align 1
+LABELV $346
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $345
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $343
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $339
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $335
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $333
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $330
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $329
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $327
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $325
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $324
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $323
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $321
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $319
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $317
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $315
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $313
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $311
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $309
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $307
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $305
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $302
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $294
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $281
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $273
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $260
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $217
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $216
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $200
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $84
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $83
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $82
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $81
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $80
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $79
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $78
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $77
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $76
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
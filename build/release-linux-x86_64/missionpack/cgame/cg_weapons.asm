@@ -0,0 +1,22595 @@
+code
+proc CG_MachineGunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $76
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRLP4 96
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1109393408
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3259498496
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 15
+BANDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $109
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $109
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+180272+244
+INDIRI4
+ASGNI4
+ADDRGP4 cg_leiBrassNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $135
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1058642330
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1053609165
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+LABELV $136
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $75
+endproc CG_MachineGunEjectBrass 144 8
+proc CG_ShotgunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $140
+ADDRGP4 $139
+JUMPV
+LABELV $140
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $143
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $147
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3256877056
+ADDF4
+ASGNF4
+LABELV $148
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 3
+ADDRGP4 cg_brassTime+12
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $180
+ADDRLP4 96
+CNSTF4 1036831949
+ASGNF4
+LABELV $180
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+180272+248
+INDIRI4
+ASGNI4
+ADDRGP4 cg_leiBrassNoise+12
+INDIRI4
+CNSTI4 0
+EQI4 $206
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+LABELV $207
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LTI4 $143
+LABELV $139
+endproc CG_ShotgunEjectBrass 144 8
+proc CG_NailgunEjectBrass 112 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 88
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1143930880
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+340
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $210
+endproc CG_NailgunEjectBrass 112 48
+export CG_RailTrail
+proc CG_RailTrail 652 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 504
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 508
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 508
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+256
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $250
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $251
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 536
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+LTF4 $253
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $254
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 532
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $256
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $257
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRLP4 556
+ADDRLP4 20
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+ADDRLP4 556
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 560
+ADDRLP4 20
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 1
+LEI4 $242
+ADDRLP4 564
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 564
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+252
+INDIRI4
+ASGNI4
+ADDRLP4 576
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+LTF4 $271
+ADDRLP4 572
+ADDRLP4 576
+INDIRF4
+ADDRLP4 580
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 572
+ADDRLP4 576
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $272
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 572
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 588
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 592
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+LTF4 $274
+ADDRLP4 584
+ADDRLP4 588
+INDIRF4
+ADDRLP4 592
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 584
+ADDRLP4 588
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $275
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 584
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $277
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $278
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 608
+ADDRLP4 20
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+ADDRLP4 608
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 612
+ADDRLP4 20
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 612
+INDIRP4
+ADDRLP4 612
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 2
+LEI4 $242
+ADDRLP4 620
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $283
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $284
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 616
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 632
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 636
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+LTF4 $286
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 628
+ADDRLP4 632
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $287
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 628
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 644
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 648
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+LTF4 $289
+ADDRLP4 640
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRLP4 640
+ADDRLP4 644
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $290
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 640
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $258
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 564
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 564
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 564
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 568
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 572
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 500
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $293
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 488
+ARGP4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $294
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 36
+LTI4 $293
+ADDRLP4 576
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 576
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 24
+ADDRLP4 580
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1084227584
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 484
+CNSTI4 -1
+ASGNI4
+ADDRLP4 36
+CNSTI4 18
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $307
+ADDRLP4 4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+EQI4 $311
+ADDRLP4 484
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRLP4 584
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 584
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+ADDI4
+CNSTI4 600
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1066192077
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+252
+INDIRI4
+ASGNI4
+ADDRLP4 600
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 604
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+LTF4 $319
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 596
+ADDRLP4 600
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $320
+ADDRLP4 20
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 596
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $322
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $323
+ADDRLP4 20
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $325
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $326
+ADDRLP4 20
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 632
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 636
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 472
+INDIRF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+4
+ADDRLP4 472+4
+INDIRF4
+ADDRLP4 632
+INDIRF4
+ADDRLP4 636
+INDIRI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+8
+ADDRLP4 472+8
+INDIRF4
+CNSTF4 1082130432
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 472
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $311
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 36
+MODI4
+ASGNI4
+LABELV $308
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $310
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 500
+INDIRF4
+LTF4 $307
+LABELV $242
+endproc CG_RailTrail 652 16
+proc CG_OldRocketTrail 100 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $343
+ADDRGP4 $342
+JUMPV
+LABELV $343
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $349
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $360
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $342
+JUMPV
+LABELV $357
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+340
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $358
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $360
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $357
+LABELV $342
+endproc CG_OldRocketTrail 100 48
+proc CG_LeiSmokeTrail 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRGP4 $363
+JUMPV
+LABELV $364
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1084227584
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8+4
+CNSTF4 1084227584
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8+8
+CNSTF4 1090519040
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 18
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $370
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 36
+INDIRI4
+ADDRLP4 56
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $363
+ADDRLP4 40
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $378
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $382
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $382
+LABELV $379
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $381
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $378
+LABELV $363
+endproc CG_LeiSmokeTrail 88 12
+proc CG_LeiPlasmaTrail 88 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $386
+ADDRGP4 $385
+JUMPV
+LABELV $386
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $392
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRGP4 $385
+JUMPV
+LABELV $398
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1104674816
+ARGF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTF4 1063675494
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+364
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $399
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $401
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $398
+LABELV $385
+endproc CG_LeiPlasmaTrail 88 48
+proc CG_NailTrail 100 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $405
+ADDRGP4 $404
+JUMPV
+LABELV $405
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $411
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $404
+JUMPV
+LABELV $419
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 cgs+180272+444
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $420
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $419
+LABELV $404
+endproc CG_NailTrail 100 48
+proc CG_OldPlasmaTrail 200 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $430
+ADDRGP4 cg_oldPlasma+12
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $426
+LABELV $430
+ADDRGP4 $425
+JUMPV
+LABELV $426
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 116
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1114636288
+CNSTF4 1123024896
+CNSTF4 1073741824
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+4
+CNSTF4 1109393408
+CNSTF4 1117782016
+CNSTF4 1073741824
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+8
+CNSTF4 1120403456
+CNSTF4 1128792064
+CNSTF4 1073741824
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 600
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 136
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 56
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 140
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 140
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $462
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $462
+ADDRLP4 148
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 148
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 44
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+252
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 156
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $490
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $491
+ADDRLP4 40
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 168
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $493
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $494
+ADDRLP4 40
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 180
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LTF4 $496
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $497
+ADDRLP4 40
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 176
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 63
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 188
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 192
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 196
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 196
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $425
+endproc CG_OldPlasmaTrail 200 12
+export CG_GrappleTrail
+proc CG_GrappleTrail 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+776
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+788
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84
+ADDRLP4 152
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 0+84
+ARGP4
+ADDRLP4 180
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1115684864
+GEF4 $520
+ADDRGP4 $499
+JUMPV
+LABELV $520
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+180272+408
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $499
+endproc CG_GrappleTrail 184 16
+proc CG_RocketTrail 0 8
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LeiSmokeTrail
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_OldRocketTrail
+CALLV
+pop
+LABELV $537
+LABELV $535
+endproc CG_RocketTrail 0 8
+proc CG_PlasmaTrail 0 8
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LeiPlasmaTrail
+CALLV
+pop
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_OldPlasmaTrail
+CALLV
+pop
+LABELV $541
+LABELV $539
+endproc CG_PlasmaTrail 0 8
+proc CG_GrenadeTrail 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_RocketTrail
+CALLV
+pop
+LABELV $543
+endproc CG_GrenadeTrail 0 8
+export CG_RegisterWeapon
+proc CG_RegisterWeapon 412 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 172
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRGP4 $544
+JUMPV
+LABELV $545
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $547
+ADDRGP4 $544
+JUMPV
+LABELV $547
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 172
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $552
+JUMPV
+LABELV $549
+ADDRLP4 64
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $554
+ADDRLP4 64
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $554
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 $551
+JUMPV
+LABELV $554
+LABELV $550
+ADDRLP4 64
+ADDRLP4 64
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $552
+ADDRLP4 64
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $549
+LABELV $551
+ADDRLP4 64
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $556
+ADDRGP4 $558
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $556
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $559
+ADDRLP4 112
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 112
+INDIRI4
+ADDRLP4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 112
+INDIRI4
+ADDRLP4 92
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $560
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+LTI4 $559
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $566
+JUMPV
+LABELV $563
+ADDRLP4 76
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $568
+ADDRLP4 76
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $568
+ADDRGP4 $565
+JUMPV
+LABELV $568
+LABELV $564
+ADDRLP4 76
+ADDRLP4 76
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $566
+ADDRLP4 76
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $563
+LABELV $565
+ADDRLP4 124
+CNSTU4 0
+ASGNU4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $570
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $570
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $570
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $572
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $573
+ADDRGP4 $575
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $576
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $577
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $578
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $579
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $580
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $582
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $583
+ADDRGP4 $585
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $583
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $586
+ADDRGP4 $588
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $586
+ADDRLP4 72
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $589
+ADDRGP4 $591
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+LABELV $589
+ADDRLP4 72
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $592
+ADDRGP4 $594
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $592
+ADDRLP4 72
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $595
+ADDRGP4 $597
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 176
+INDIRI4
+ASGNI4
+LABELV $595
+ADDRLP4 72
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRGP4 $600
+ARGP4
+ADDRLP4 180
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 180
+INDIRI4
+ASGNI4
+LABELV $598
+ADDRLP4 72
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $601
+ADDRGP4 $603
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+LABELV $601
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $604
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $605
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $606
+ADDRGP4 $608
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+LABELV $606
+ADDRLP4 72
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $609
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $609
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $706-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $706
+address $611
+address $649
+address $656
+address $671
+address $658
+address $614
+address $688
+address $679
+address $699
+address $633
+address $676
+address $665
+address $640
+code
+LABELV $611
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $612
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 200
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 $613
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $614
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $615
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 208
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 212
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $617
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 $620
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+260
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $623
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+608
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRGP4 $626
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+936
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $629
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 232
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+940
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRGP4 $632
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 236
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+944
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $633
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $634
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrappleTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $637
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+408
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $638
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 248
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRGP4 $639
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $640
+ADDRGP4 $641
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $642
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $643
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $644
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $645
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 272
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $648
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+620
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 71
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $649
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $650
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 284
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $652
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $653
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $648
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+620
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 62
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $656
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $657
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_ShotgunEjectBrass
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 63
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $658
+ADDRGP4 $659
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_RocketTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $661
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 312
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $664
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+624
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 65
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $665
+ADDRGP4 $666
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $667
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 324
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $670
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+628
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 70
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $671
+ADDRGP4 $672
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $673
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $670
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+628
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 64
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $676
+ADDRLP4 72
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_NailgunEjectBrass
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_NailTrail
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1132068864
+ASGNF4
+ADDRGP4 $677
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $678
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 69
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $679
+ADDRLP4 72
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_PlasmaTrail
+ASGNP4
+ADDRGP4 $680
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $681
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $684
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+616
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $687
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+252
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $688
+ADDRGP4 $689
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $690
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $693
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+612
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $687
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+252
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $698
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+256
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 67
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $699
+ADDRGP4 $700
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $701
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $704
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+180272+632
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $705
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTI4 68
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $609
+ADDRLP4 72
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $661
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 408
+INDIRI4
+ASGNI4
+LABELV $610
+LABELV $544
+endproc CG_RegisterWeapon 412 12
+export CG_RegisterItemVisuals
+proc CG_RegisterItemVisuals 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $711
+ADDRFP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $709
+LABELV $711
+ADDRGP4 $712
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 bg_numItems
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $709
+ADDRLP4 4
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $713
+ADDRGP4 $708
+JUMPV
+LABELV $713
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $715
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $715
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $721
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $721
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $721
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+NEI4 $717
+LABELV $721
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $722
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $722
+LABELV $717
+LABELV $708
+endproc CG_RegisterItemVisuals 28 12
+proc CG_MapTorsoToWeaponFrame 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $725
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+ADDI4
+GEI4 $725
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6
+ADDI4
+RETI4
+ADDRGP4 $724
+JUMPV
+LABELV $725
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $727
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $727
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $724
+JUMPV
+LABELV $727
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $729
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $729
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $724
+JUMPV
+LABELV $729
+CNSTI4 0
+RETI4
+LABELV $724
+endproc CG_MapTorsoToWeaponFrame 24 0
+proc CG_CalculateWeaponPosition 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+109620
+INDIRB
+ASGNB 12
+ADDRGP4 cg+125364
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $735
+ADDRLP4 0
+ADDRGP4 cg+125368
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $736
+JUMPV
+LABELV $735
+ADDRLP4 0
+ADDRGP4 cg+125368
+INDIRF4
+ASGNF4
+LABELV $736
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 1
+NEI4 $743
+ADDRLP4 12
+CNSTF4 1025758986
+CNSTF4 1028443341
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1028443341
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1036831949
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $743
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 2
+NEI4 $753
+ADDRLP4 12
+CNSTF4 1025758986
+CNSTF4 1028443341
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $753
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 3
+NEI4 $741
+ADDRLP4 12
+CNSTF4 1025758986
+CNSTF4 1028443341
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1028443341
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+156504
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1036831949
+CNSTF4 1032805417
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 64
+INDIRF4
+ADDRLP4 68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $741
+JUMPV
+LABELV $740
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRGP4 cg+125368
+INDIRF4
+ADDRGP4 cg+125360
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $741
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109148
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 150
+GEI4 $775
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+109144
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1125515264
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRLP4 4
+INDIRI4
+CNSTI4 450
+GEI4 $778
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+109144
+INDIRF4
+MULF4
+CNSTI4 450
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1133903872
+DIVF4
+ADDF4
+ASGNF4
+LABELV $778
+LABELV $776
+ADDRGP4 cg_bobmodel+12
+INDIRI4
+CNSTI4 0
+NEI4 $781
+ADDRLP4 0
+ADDRGP4 cg+125368
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+CNSTF4 981668463
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $781
+LABELV $731
+endproc CG_CalculateWeaponPosition 84 16
+proc CG_LightningBolt 284 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $787
+ADDRGP4 $786
+JUMPV
+LABELV $787
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $789
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+181764
+INDIRI4
+ADDRLP4 232
+INDIRI4
+EQI4 $789
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 232
+INDIRI4
+NEI4 $796
+ADDRGP4 cg_delag+12
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 232
+INDIRI4
+EQI4 $789
+LABELV $796
+ADDRGP4 cg+107636+152
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRGP4 cg+107636+20
+INDIRB
+ASGNB 12
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $801
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+CNSTF4 0
+EQF4 $801
+ADDRLP4 252
+ADDRGP4 cg+107636+152
+INDIRB
+ASGNB 12
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+LABELV $808
+ADDRLP4 268
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 268
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 252
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1127481344
+LEF4 $812
+ADDRLP4 264
+ADDRLP4 264
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $812
+ADDRLP4 264
+INDIRF4
+CNSTF4 3274964992
+GEF4 $814
+ADDRLP4 264
+ADDRLP4 264
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $814
+ADDRLP4 272
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 240
+ADDP4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 252
+ADDP4
+INDIRF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1065353216
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $817
+ADDRLP4 276
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $817
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $819
+ADDRLP4 276
+ADDRLP4 236
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $819
+LABELV $809
+ADDRLP4 236
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 3
+LTI4 $808
+ADDRLP4 240
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 264
+CNSTP4 0
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRGP4 cg+107636+20
+INDIRB
+ASGNB 12
+ADDRGP4 $802
+JUMPV
+LABELV $801
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 236
+CNSTP4 0
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $802
+LABELV $790
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 220
+ADDRLP4 140
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1145044992
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 244
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRP4
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+84
+ADDRLP4 164+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+180272+260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $842
+ADDRLP4 248
+ADDRLP4 0+84
+INDIRF4
+ADDRLP4 0+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248+4
+ADDRLP4 0+84+4
+INDIRF4
+ADDRLP4 0+68+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248+8
+ADDRLP4 0+84+8
+INDIRF4
+ADDRLP4 0+68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+180272+608
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 164+12
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 248
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 164+12+4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 248+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 164+12+8
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 248+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 272
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260+4
+ADDRLP4 276
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 280
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 260+8
+ADDRLP4 280
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $842
+LABELV $786
+endproc CG_LightningBolt 284 28
+proc CG_SpawnRailTrail 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $876
+ADDRGP4 $875
+JUMPV
+LABELV $876
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $878
+ADDRGP4 $875
+JUMPV
+LABELV $878
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 2120
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+LABELV $875
+endproc CG_SpawnRailTrail 8 12
+proc CG_MachinegunSpinAngle 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $883
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $884
+JUMPV
+LABELV $883
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+LEI4 $885
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+LABELV $885
+ADDRLP4 8
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $884
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $890
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $891
+JUMPV
+LABELV $890
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $891
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $887
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $894
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $895
+JUMPV
+LABELV $894
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $895
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $896
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $896
+ADDRGP4 $898
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $896
+LABELV $887
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $881
+endproc CG_MachinegunSpinAngle 44 16
+proc CG_AddWeaponWithPowerups 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $900
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+556
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+568
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $907
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $911
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+180272+552
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $911
+LABELV $901
+LABELV $899
+endproc CG_AddWeaponWithPowerups 0 4
+proc MuzzleFlashStyleQ1 200 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 6
+EQI4 $919
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $919
+ADDRFP4 12
+INDIRI4
+CNSTI4 10
+NEI4 $916
+LABELV $919
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $916
+ADDRGP4 $917
+JUMPV
+LABELV $916
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 200
+LEI4 $920
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $920
+ADDRGP4 $915
+JUMPV
+LABELV $920
+LABELV $917
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 24
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $927
+ADDRGP4 $915
+JUMPV
+LABELV $927
+ADDRLP4 140+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+LEI4 $933
+ADDRLP4 0+28
+CNSTF4 1069547520
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1069547520
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1069547520
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1069547520
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1069547520
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1069547520
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1069547520
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1069547520
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1069547520
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $933
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+NEI4 $978
+ADDRLP4 160
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 168
+CNSTF4 1132396544
+ADDRLP4 160
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+LTF4 $983
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $984
+JUMPV
+LABELV $983
+ADDRLP4 164
+ADDRLP4 168
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $984
+ADDRLP4 0+116
+ADDRLP4 164
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 180
+CNSTF4 1132396544
+ADDRLP4 160
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LTF4 $988
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $989
+JUMPV
+LABELV $988
+ADDRLP4 176
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $989
+ADDRLP4 0+116+1
+ADDRLP4 176
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 192
+CNSTF4 1132396544
+ADDRLP4 160
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LTF4 $993
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $994
+JUMPV
+LABELV $993
+ADDRLP4 188
+ADDRLP4 192
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $994
+ADDRLP4 0+116+2
+ADDRLP4 188
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $978
+ADDRLP4 0
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $995
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1002
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1002
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $996
+LABELV $1002
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1003
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1003
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1003
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1008
+ADDRLP4 164
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+NEF4 $1014
+ADDRLP4 164
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+NEF4 $1014
+ADDRLP4 164
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+EQF4 $1011
+LABELV $1014
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 172
+CNSTF4 1064514355
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1011
+LABELV $1008
+LABELV $996
+LABELV $915
+endproc MuzzleFlashStyleQ1 200 20
+export CG_AddPlayerWeapon
+proc CG_AddPlayerWeapon 556 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 332
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 280
+CNSTI4 172
+ADDRLP4 332
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1023
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $1019
+LABELV $1023
+ADDRGP4 cg+107636+144
+INDIRI4
+CNSTI4 7
+NEI4 $1024
+ADDRGP4 cg+107636+148
+INDIRI4
+CNSTI4 3
+NEI4 $1024
+ADDRLP4 492
+ADDRGP4 cg+107636+44
+INDIRI4
+CVIF4 4
+CNSTF4 1153138688
+DIVF4
+ASGNF4
+ADDRLP4 0+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 500
+CNSTF4 1132396544
+CNSTF4 1065353216
+ADDRLP4 492
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 504
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+LTF4 $1038
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1039
+JUMPV
+LABELV $1038
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1039
+ADDRLP4 508
+ADDRLP4 496
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+116+2
+ADDRLP4 508
+INDIRU1
+ASGNU1
+ADDRLP4 0+116
+ADDRLP4 508
+INDIRU1
+ASGNU1
+ADDRGP4 $1025
+JUMPV
+LABELV $1024
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+LABELV $1025
+LABELV $1019
+ADDRLP4 0+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1048
+ADDRGP4 $1015
+JUMPV
+LABELV $1048
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1051
+ADDRFP4 8
+INDIRP4
+CNSTI4 604
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 492
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 492
+INDIRI4
+EQI4 $1053
+ADDRLP4 280
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 492
+INDIRI4
+EQI4 $1053
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 604
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1053
+ADDRLP4 280
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1055
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $1055
+LABELV $1054
+LABELV $1051
+ADDRLP4 284
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 $1057
+ARGP4
+ADDRGP4 trap_R_LerpTag
+CALLI4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1069
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 2
+NEI4 $1069
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1070
+JUMPV
+LABELV $1069
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1088
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 3
+EQI4 $1085
+LABELV $1088
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 284+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1085
+LABELV $1070
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 284+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 284+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 284+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 0+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+ADDRLP4 280
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1118
+ADDRLP4 352
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 352+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 352+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 352+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 496
+ADDRGP4 CG_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 336+8
+ADDRLP4 496
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 352+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 352
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1127
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 352
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+LABELV $1118
+ADDRLP4 496
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 500
+ADDRGP4 cg_entities
+ASGNP4
+ADDRLP4 348
+CNSTI4 936
+ADDRLP4 496
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 500
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CVPU4 4
+ADDRLP4 500
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 936
+DIVI4
+ADDRLP4 496
+INDIRP4
+INDIRI4
+EQI4 $1128
+ADDRLP4 348
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $1128
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 2
+NEI4 $1130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRGP4 MuzzleFlashStyleQ1
+CALLV
+pop
+ADDRGP4 $1015
+JUMPV
+LABELV $1130
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 3
+NEI4 $1133
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1139
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1139
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1136
+LABELV $1139
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1136
+ADDRGP4 $1137
+JUMPV
+LABELV $1136
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 120
+LEI4 $1140
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1140
+ADDRGP4 $1015
+JUMPV
+LABELV $1140
+LABELV $1137
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1146
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1146
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1147
+JUMPV
+LABELV $1146
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1147
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1152
+ADDRGP4 $1015
+JUMPV
+LABELV $1152
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 508
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336+8
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 508
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1157
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1157
+ADDRLP4 336+8
+CNSTF4 0
+ASGNF4
+LABELV $1157
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $995
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1169
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1169
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1015
+LABELV $1169
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1170
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1170
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1170
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1178
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1178
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+EQF4 $1015
+LABELV $1178
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1125515264
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1015
+JUMPV
+LABELV $1133
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 4
+NEI4 $1179
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1185
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1185
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1182
+LABELV $1185
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1182
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 240
+LEI4 $1186
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1186
+ADDRGP4 $1015
+JUMPV
+LABELV $1186
+LABELV $1183
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1193
+ADDRGP4 $1015
+JUMPV
+LABELV $1193
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 508
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 336+8
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140+128
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $995
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1206
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1206
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1015
+LABELV $1206
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1207
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1207
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1207
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1215
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1215
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+EQF4 $1015
+LABELV $1215
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1125515264
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1015
+JUMPV
+LABELV $1179
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 5
+NEI4 $1216
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1222
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1222
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1219
+LABELV $1222
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1219
+ADDRGP4 $1220
+JUMPV
+LABELV $1219
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 400
+LEI4 $1223
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1223
+ADDRGP4 $1015
+JUMPV
+LABELV $1223
+LABELV $1220
+ADDRLP4 504
+CNSTF4 981668463
+CNSTI4 400
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 504
+INDIRF4
+CNSTF4 0
+GEF4 $1227
+ADDRGP4 $1015
+JUMPV
+LABELV $1227
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5
+GEI4 $1232
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+CNSTF4 1144258560
+CNSTF4 1073741824
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1232
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1236
+ADDRGP4 $1015
+JUMPV
+LABELV $1236
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 336+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1242
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1242
+ADDRLP4 512
+CNSTF4 994352038
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 $1243
+JUMPV
+LABELV $1242
+ADDRLP4 512
+CNSTF4 1004888130
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+LABELV $1243
+ADDRLP4 140+28
+ADDRLP4 140+28
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+4
+ADDRLP4 140+28+4
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+8
+ADDRLP4 140+28+8
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12
+ADDRLP4 140+28+12
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+ADDRLP4 140+28+12+4
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+ADDRLP4 140+28+12+8
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24
+ADDRLP4 140+28+24
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+4
+ADDRLP4 140+28+24+4
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+8
+ADDRLP4 140+28+24+8
+INDIRF4
+ADDRLP4 512
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+2
+CNSTU1 255
+ASGNU1
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $1295
+ADDRLP4 140+28+12
+CNSTF4 3212836864
+ADDRLP4 140+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+CNSTF4 3212836864
+ADDRLP4 140+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+CNSTF4 3212836864
+ADDRLP4 140+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1295
+ADDRLP4 140+128
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 332
+INDIRI4
+CNSTI4 7
+NEI4 $1314
+ADDRLP4 512
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 520
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+LTF4 $1319
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1320
+JUMPV
+LABELV $1319
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1320
+ADDRLP4 140+116
+ADDRLP4 516
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 532
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+LTF4 $1324
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1325
+JUMPV
+LABELV $1324
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1325
+ADDRLP4 140+116+1
+ADDRLP4 528
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+LTF4 $1329
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1330
+JUMPV
+LABELV $1329
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1330
+ADDRLP4 140+116+2
+ADDRLP4 540
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1314
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $995
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1337
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1337
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1015
+LABELV $1337
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1338
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1338
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1338
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1346
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+NEF4 $1346
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 520
+INDIRF4
+EQF4 $1015
+LABELV $1346
+ADDRLP4 140+68
+ARGP4
+ADDRLP4 524
+ADDRLP4 504
+INDIRF4
+ASGNF4
+CNSTF4 1140457472
+ADDRLP4 524
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 532
+CNSTF4 1082130432
+ADDRLP4 524
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1015
+JUMPV
+LABELV $1216
+ADDRGP4 cg_muzzleflashStyle+12
+INDIRI4
+CNSTI4 6
+NEI4 $1348
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1354
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1354
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1351
+LABELV $1354
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1351
+ADDRGP4 $1352
+JUMPV
+LABELV $1351
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 200
+LEI4 $1355
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1355
+ADDRGP4 $1015
+JUMPV
+LABELV $1355
+LABELV $1352
+ADDRLP4 504
+CNSTF4 981668463
+CNSTI4 200
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 504
+INDIRF4
+CNSTF4 0
+GEF4 $1359
+ADDRGP4 $1015
+JUMPV
+LABELV $1359
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5
+GEI4 $1364
+ADDRLP4 512
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+CNSTF4 1135902720
+CNSTF4 1073741824
+ADDRLP4 512
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1364
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1367
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1367
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1368
+JUMPV
+LABELV $1367
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1368
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRGP4 $1015
+JUMPV
+LABELV $1373
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1377
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1377
+ADDRLP4 336+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1378
+JUMPV
+LABELV $1377
+ADDRLP4 336+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 888
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1378
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 516
+CNSTF4 1000593162
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 140+28
+ADDRLP4 140+28
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+4
+ADDRLP4 140+28+4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+8
+ADDRLP4 140+28+8
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12
+ADDRLP4 140+28+12
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+4
+ADDRLP4 140+28+12+4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+12+8
+ADDRLP4 140+28+12+8
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24
+ADDRLP4 140+28+24
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+4
+ADDRLP4 140+28+24+4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140+28+24+8
+ADDRLP4 140+28+24+8
+INDIRF4
+ADDRLP4 516
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $1429
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1430
+JUMPV
+LABELV $1429
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1430
+ADDRLP4 140+116
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 536
+CNSTF4 1132396544
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+LTF4 $1434
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1435
+JUMPV
+LABELV $1434
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1435
+ADDRLP4 140+116+1
+ADDRLP4 532
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $1439
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1440
+JUMPV
+LABELV $1439
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1440
+ADDRLP4 140+116+2
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 140+128
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 332
+INDIRI4
+CNSTI4 7
+NEI4 $1442
+ADDRLP4 516
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRLP4 516
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $1447
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1448
+JUMPV
+LABELV $1447
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1448
+ADDRLP4 140+116
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 536
+CNSTF4 1132396544
+ADDRLP4 516
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+LTF4 $1452
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+ADDRLP4 540
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1453
+JUMPV
+LABELV $1452
+ADDRLP4 532
+ADDRLP4 536
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1453
+ADDRLP4 140+116+1
+ADDRLP4 532
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 548
+CNSTF4 1132396544
+ADDRLP4 516
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 504
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 552
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+LTF4 $1457
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+ADDRLP4 552
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1458
+JUMPV
+LABELV $1457
+ADDRLP4 544
+ADDRLP4 548
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1458
+ADDRLP4 140+116+2
+ADDRLP4 544
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1442
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $995
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1465
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1465
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1015
+LABELV $1465
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 100
+GEI4 $1466
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1466
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+LABELV $1466
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 524
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRF4
+NEF4 $1474
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRF4
+NEF4 $1474
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 524
+INDIRF4
+EQF4 $1015
+LABELV $1474
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+ADDRLP4 532
+ADDRLP4 504
+INDIRF4
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 532
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRGP4 $1015
+JUMPV
+LABELV $1348
+ADDRLP4 332
+INDIRI4
+CNSTI4 6
+EQI4 $1478
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+EQI4 $1478
+ADDRLP4 332
+INDIRI4
+CNSTI4 10
+NEI4 $1475
+LABELV $1478
+ADDRLP4 348
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1475
+ADDRGP4 $1476
+JUMPV
+LABELV $1475
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 20
+LEI4 $1479
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1479
+ADDRGP4 $1015
+JUMPV
+LABELV $1479
+LABELV $1476
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1486
+ADDRGP4 $1015
+JUMPV
+LABELV $1486
+ADDRLP4 336+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 336
+CNSTF4 0
+ASGNF4
+ADDRLP4 508
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336+8
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 508
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 336
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 332
+INDIRI4
+CNSTI4 7
+NEI4 $1492
+ADDRLP4 512
+CNSTI4 2120
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 520
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+LTF4 $1497
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1498
+JUMPV
+LABELV $1497
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1498
+ADDRLP4 140+116
+ADDRLP4 516
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 532
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+LTF4 $1502
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1503
+JUMPV
+LABELV $1502
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1503
+ADDRLP4 140+116+1
+ADDRLP4 528
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544
+CNSTF4 1132396544
+ADDRLP4 512
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+LTF4 $1507
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1508
+JUMPV
+LABELV $1507
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1508
+ADDRLP4 140+116+2
+ADDRLP4 540
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $1492
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $995
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1515
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1515
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $1509
+LABELV $1515
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 516
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+NEF4 $1521
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+NEF4 $1521
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 516
+INDIRF4
+EQF4 $1518
+LABELV $1521
+ADDRLP4 520
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140+68
+ARGP4
+ADDRLP4 520
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $1518
+LABELV $1509
+LABELV $1015
+endproc CG_AddPlayerWeapon 556 28
+export CG_AddViewWeapon
+proc CG_AddViewWeapon 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1524
+ADDRGP4 $1523
+JUMPV
+LABELV $1524
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1526
+ADDRGP4 $1523
+JUMPV
+LABELV $1526
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1528
+ADDRGP4 $1523
+JUMPV
+LABELV $1528
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 0
+NEI4 $1531
+ADDRGP4 cg+107636+104
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1523
+ADDRLP4 168
+ADDRGP4 cg+109252+24
+INDIRB
+ASGNB 12
+ADDRLP4 180
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 168
+ADDRLP4 168
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 936
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRGP4 $1523
+JUMPV
+LABELV $1531
+ADDRGP4 cg+125584
+INDIRI4
+CNSTI4 0
+EQI4 $1555
+ADDRGP4 $1523
+JUMPV
+LABELV $1555
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+LEI4 $1558
+ADDRLP4 140
+CNSTF4 3192704205
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $1559
+JUMPV
+LABELV $1558
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+LABELV $1559
+ADDRLP4 144
+ADDRGP4 cg+108104
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 160
+CNSTI4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CalculateWeaponPosition
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+8
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+CNSTI4 0
+EQI4 $1634
+ADDRLP4 168
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1635
+JUMPV
+LABELV $1634
+ADDRLP4 164
+CNSTI4 2120
+ADDRLP4 144
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1635
+ADDRLP4 0+8
+ADDRLP4 160
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+108104
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+LABELV $1523
+endproc CG_AddViewWeapon 184 16
+export CG_DrawWeaponSelect
+proc CG_DrawWeaponSelect 40 12
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $1649
+ADDRGP4 $1648
+JUMPV
+LABELV $1649
+ADDRGP4 cg+125268
+INDIRI4
+ARGI4
+CNSTI4 1400
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 cg_alwaysWeaponBar+12
+INDIRI4
+CNSTI4 0
+EQI4 $1654
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 16
+ASGNP4
+LABELV $1654
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1660
+ADDRGP4 $1648
+JUMPV
+LABELV $1660
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+125260
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1664
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1668
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1668
+LABELV $1665
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1664
+ADDRLP4 36
+ADDRGP4 cg_weaponBarStyle+12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $1670
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+GTI4 $1670
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1681
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1681
+address $1673
+address $1674
+address $1675
+address $1676
+address $1677
+address $1678
+address $1679
+address $1680
+code
+LABELV $1673
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawWeaponBar0
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1674
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawWeaponBar1
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1675
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar2
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1676
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar3
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1677
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar4
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1678
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar5
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1679
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar6
+CALLV
+pop
+ADDRGP4 $1671
+JUMPV
+LABELV $1680
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawWeaponBar7
+CALLV
+pop
+LABELV $1670
+LABELV $1671
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1648
+endproc CG_DrawWeaponSelect 40 12
+export CG_DrawWeaponBar0
+proc CG_DrawWeaponBar0 24 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 380
+ASGNI4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1683
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1687
+ADDRGP4 $1684
+JUMPV
+LABELV $1687
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1689
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1689
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1691
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1684
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1684
+JUMPV
+LABELV $1691
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1696
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1696
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1701
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1701
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1706
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1706
+LABELV $1684
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1683
+LABELV $1682
+endproc CG_DrawWeaponBar0 24 20
+export CG_DrawWeaponBar1
+proc CG_DrawWeaponBar1 100 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 380
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40+4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 56+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 56+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1718
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1722
+ADDRGP4 $1719
+JUMPV
+LABELV $1722
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1724
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1724
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1726
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1719
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1719
+JUMPV
+LABELV $1726
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $1731
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1731
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 $1744-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1744
+address $1733
+address $1734
+address $1735
+address $1736
+address $1737
+address $1738
+address $1739
+address $1740
+address $1731
+address $1741
+address $1742
+address $1743
+code
+LABELV $1733
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1734
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1735
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1736
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1737
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1738
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1739
+ADDRLP4 16
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1740
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1741
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1742
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1743
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1732
+JUMPV
+LABELV $1731
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $1732
+ADDRLP4 80
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LTI4 $1746
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $1746
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1748
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1748
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+GTI4 $1750
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 38
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1750
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LEI4 $1752
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+GTI4 $1752
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 38
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1752
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $1754
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 38
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 56
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1754
+LABELV $1748
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 88
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1757
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 92
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 92
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 96
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+276
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1757
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1762
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 92
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRGP4 cgs+180272+336
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1762
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1767
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1767
+LABELV $1719
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1718
+LABELV $1708
+endproc CG_DrawWeaponBar1 100 20
+export CG_DrawWeaponBar2
+proc CG_DrawWeaponBar2 88 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1779
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1783
+ADDRGP4 $1780
+JUMPV
+LABELV $1783
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1785
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1785
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1787
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1780
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1780
+JUMPV
+LABELV $1787
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1791
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1794
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1792
+JUMPV
+LABELV $1794
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $1792
+JUMPV
+LABELV $1791
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1797
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1798
+JUMPV
+LABELV $1797
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1798
+LABELV $1792
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1801
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1801
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1806
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1806
+LABELV $1780
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1779
+LABELV $1769
+endproc CG_DrawWeaponBar2 88 24
+export CG_DrawWeaponBar3
+proc CG_DrawWeaponBar3 136 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1821
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1825
+ADDRGP4 $1822
+JUMPV
+LABELV $1825
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1827
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1827
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1829
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1822
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1822
+JUMPV
+LABELV $1829
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1834
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1834
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LSHI4
+ADDRGP4 $1847-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1847
+address $1836
+address $1837
+address $1838
+address $1839
+address $1840
+address $1841
+address $1842
+address $1843
+address $1834
+address $1844
+address $1845
+address $1846
+code
+LABELV $1836
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1837
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1838
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1839
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1840
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1841
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1842
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1843
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1844
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1845
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1846
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1835
+JUMPV
+LABELV $1834
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $1835
+ADDRLP4 112
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LTI4 $1849
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $1849
+ADDRLP4 16
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $1851
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $1851
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+GTI4 $1853
+CNSTF4 1112276992
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 20
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1853
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LEI4 $1855
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+GTI4 $1855
+CNSTF4 1112276992
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 20
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1855
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $1857
+CNSTF4 1112276992
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 20
+ADDI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1857
+LABELV $1851
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1859
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1862
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1860
+JUMPV
+LABELV $1862
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $1860
+JUMPV
+LABELV $1859
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1865
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1866
+JUMPV
+LABELV $1865
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1866
+LABELV $1860
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 120
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1869
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 128
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1869
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1873
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1873
+LABELV $1822
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1821
+LABELV $1808
+endproc CG_DrawWeaponBar3 136 24
+export CG_DrawWeaponBar4
+proc CG_DrawWeaponBar4 92 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1881
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1885
+ADDRGP4 $1882
+JUMPV
+LABELV $1885
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1887
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1887
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1889
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1882
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1882
+JUMPV
+LABELV $1889
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $1894
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1894
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 $1907-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1907
+address $1896
+address $1897
+address $1898
+address $1899
+address $1900
+address $1901
+address $1902
+address $1903
+address $1894
+address $1904
+address $1905
+address $1906
+code
+LABELV $1896
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1897
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1898
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1899
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1900
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1901
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1902
+ADDRLP4 32
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1903
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1904
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1905
+ADDRLP4 32
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1906
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1894
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $1895
+ADDRLP4 4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+GEF4 $1911
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $1909
+LABELV $1911
+ADDRLP4 4
+CNSTF4 1120403456
+ASGNF4
+LABELV $1909
+ADDRLP4 12+8
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1913
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1914
+JUMPV
+LABELV $1913
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1112014848
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1914
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1917
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1917
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1921
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1921
+LABELV $1882
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1881
+LABELV $1875
+endproc CG_DrawWeaponBar4 92 24
+export CG_DrawWeaponBar5
+proc CG_DrawWeaponBar5 88 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 380
+ASGNI4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 15
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1933
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1937
+ADDRGP4 $1934
+JUMPV
+LABELV $1937
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1939
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1939
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1941
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1934
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1934
+JUMPV
+LABELV $1941
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1945
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1948
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1946
+JUMPV
+LABELV $1948
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $1946
+JUMPV
+LABELV $1945
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $1951
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $1952
+JUMPV
+LABELV $1951
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $1952
+LABELV $1946
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1955
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $1955
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1959
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1959
+LABELV $1934
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1933
+LABELV $1923
+endproc CG_DrawWeaponBar5 88 24
+export CG_DrawWeaponBar6
+proc CG_DrawWeaponBar6 132 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 380
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+CNSTI4 15
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 28+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 80+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1974
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1978
+ADDRGP4 $1975
+JUMPV
+LABELV $1978
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1980
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $1980
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1982
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $1975
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1975
+JUMPV
+LABELV $1982
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1987
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1987
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LSHI4
+ADDRGP4 $2000-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2000
+address $1989
+address $1990
+address $1991
+address $1992
+address $1993
+address $1994
+address $1995
+address $1996
+address $1987
+address $1997
+address $1998
+address $1999
+code
+LABELV $1989
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1990
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1991
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1992
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1993
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1994
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1995
+ADDRLP4 16
+CNSTI4 50
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1996
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1997
+ADDRLP4 16
+CNSTI4 10
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1998
+ADDRLP4 16
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1999
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRGP4 $1988
+JUMPV
+LABELV $1987
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $1988
+ADDRLP4 112
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+LTI4 $2002
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+LABELV $2002
+ADDRLP4 20
+CNSTI4 26
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $2004
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2004
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+GTI4 $2006
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2006
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+LEI4 $2008
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+GTI4 $2008
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2008
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LEI4 $2010
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2010
+LABELV $2004
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2012
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $2015
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $2013
+JUMPV
+LABELV $2015
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 64
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 $2013
+JUMPV
+LABELV $2012
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $2018
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $2019
+JUMPV
+LABELV $2018
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2019
+LABELV $2013
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 120
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2022
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 128
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $2022
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2026
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2026
+LABELV $1975
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1974
+LABELV $1961
+endproc CG_DrawWeaponBar6 132 24
+export CG_DrawWeaponBar7
+proc CG_DrawWeaponBar7 92 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 380
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+CNSTI4 15
+ADDRFP4 0
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2034
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2038
+ADDRGP4 $2035
+JUMPV
+LABELV $2038
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2040
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $2040
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2042
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2035
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2035
+JUMPV
+LABELV $2042
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $2047
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $2047
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 $2060-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2060
+address $2049
+address $2050
+address $2051
+address $2052
+address $2053
+address $2054
+address $2055
+address $2056
+address $2047
+address $2057
+address $2058
+address $2059
+code
+LABELV $2049
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2050
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2051
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2052
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2053
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2054
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2055
+ADDRLP4 32
+CNSTF4 1112014848
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2056
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2057
+ADDRLP4 32
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2058
+ADDRLP4 32
+CNSTF4 1084227584
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2059
+ADDRLP4 32
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $2048
+JUMPV
+LABELV $2047
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+LABELV $2048
+ADDRLP4 4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2064
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $2062
+LABELV $2064
+ADDRLP4 4
+CNSTF4 1120403456
+ASGNF4
+LABELV $2062
+ADDRLP4 12+8
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109152
+INDIRI4
+NEI4 $2066
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_DrawRect
+CALLV
+pop
+ADDRGP4 $2067
+JUMPV
+LABELV $2066
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1108869120
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $2067
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 80
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+CNSTI4 172
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2070
+ADDRGP4 $1804
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 88
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 20
+ADDI4
+ARGI4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $2070
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $2074
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2074
+LABELV $2035
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2034
+LABELV $2028
+endproc CG_DrawWeaponBar7 92 24
+proc CG_WeaponSelectable 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2077
+CNSTI4 0
+RETI4
+ADDRGP4 $2076
+JUMPV
+LABELV $2077
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2080
+CNSTI4 0
+RETI4
+ADDRGP4 $2076
+JUMPV
+LABELV $2080
+CNSTI4 1
+RETI4
+LABELV $2076
+endproc CG_WeaponSelectable 0 0
+export CG_NextWeapon_f
+proc CG_NextWeapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2084
+ADDRGP4 $2083
+JUMPV
+LABELV $2084
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2087
+ADDRGP4 $2083
+JUMPV
+LABELV $2087
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+109152
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2093
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2093
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2097
+ADDRLP4 8
+ADDRGP4 cg+109152
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 16
+NEI4 $2102
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2102
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 1
+NEI4 $2106
+ADDRGP4 $2098
+JUMPV
+LABELV $2106
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2109
+ADDRGP4 $2098
+JUMPV
+LABELV $2109
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 0
+NEI4 $2112
+ADDRGP4 cg+109152
+CNSTI4 10
+ASGNI4
+LABELV $2112
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2116
+ADDRGP4 cg_cyclegrapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $2116
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2098
+JUMPV
+LABELV $2116
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2121
+ADDRGP4 $2099
+JUMPV
+LABELV $2121
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2124
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2124
+LABELV $2098
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2097
+LABELV $2099
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $2128
+ADDRGP4 cg+109152
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2128
+LABELV $2083
+endproc CG_NextWeapon_f 16 4
+export CG_PrevWeapon_f
+proc CG_PrevWeapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2132
+ADDRGP4 $2131
+JUMPV
+LABELV $2132
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2135
+ADDRGP4 $2131
+JUMPV
+LABELV $2135
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+109152
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2141
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2141
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2145
+ADDRLP4 8
+ADDRGP4 cg+109152
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 -1
+NEI4 $2150
+ADDRGP4 cg+109152
+CNSTI4 15
+ASGNI4
+LABELV $2150
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 1
+NEI4 $2154
+ADDRGP4 $2146
+JUMPV
+LABELV $2154
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2157
+ADDRGP4 $2146
+JUMPV
+LABELV $2157
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 0
+NEI4 $2160
+ADDRGP4 cg+109152
+CNSTI4 10
+ASGNI4
+LABELV $2160
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2164
+ADDRGP4 cg_cyclegrapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $2164
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2146
+JUMPV
+LABELV $2164
+ADDRGP4 cg+109152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2169
+ADDRGP4 $2147
+JUMPV
+LABELV $2169
+ADDRGP4 cg+109152
+INDIRI4
+CNSTI4 10
+NEI4 $2172
+ADDRGP4 cg+109152
+CNSTI4 0
+ASGNI4
+LABELV $2172
+LABELV $2146
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2145
+LABELV $2147
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $2176
+ADDRGP4 cg+109152
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $2176
+LABELV $2131
+endproc CG_PrevWeapon_f 16 4
+export CG_Weapon_f
+proc CG_Weapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2180
+ADDRGP4 $2179
+JUMPV
+LABELV $2180
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2183
+ADDRGP4 $2179
+JUMPV
+LABELV $2183
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $2188
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $2186
+LABELV $2188
+ADDRGP4 $2179
+JUMPV
+LABELV $2186
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $2191
+ADDRGP4 $2179
+JUMPV
+LABELV $2191
+ADDRGP4 cg+109152
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2179
+endproc CG_Weapon_f 16 4
+export CG_OutOfAmmoChange
+proc CG_OutOfAmmoChange 8 4
+ADDRGP4 cg+125268
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+LABELV $2198
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2202
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2202
+ADDRGP4 cg+109152
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2200
+JUMPV
+LABELV $2202
+LABELV $2199
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $2198
+LABELV $2200
+LABELV $2195
+endproc CG_OutOfAmmoChange 8 4
+export CG_FireWeapon
+proc CG_FireWeapon 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 8
+EQI4 $2212
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 9
+NEI4 $2206
+LABELV $2212
+ADDRGP4 cgs+34812
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LTI4 $2206
+ADDRGP4 $2205
+JUMPV
+LABELV $2206
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2213
+ADDRGP4 $2205
+JUMPV
+LABELV $2213
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 14
+LTI4 $2215
+ADDRGP4 $2217
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $2205
+JUMPV
+LABELV $2215
+ADDRLP4 4
+CNSTI4 172
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 892
+ADDP4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+INDIRI4
+CNSTI4 2
+LEI4 $2220
+ADDRFP4 0
+INDIRP4
+CNSTI4 912
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2220
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2222
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2224
+ADDRGP4 $2205
+JUMPV
+LABELV $2224
+LABELV $2222
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2226
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+180272+804
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2226
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2230
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2234
+ADDRGP4 $2232
+JUMPV
+LABELV $2234
+LABELV $2231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2230
+LABELV $2232
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $2236
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2238
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2238
+LABELV $2236
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2240
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+LEI4 $2240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PredictWeaponEffects
+CALLV
+pop
+LABELV $2205
+endproc CG_FireWeapon 28 16
+export CG_MissileHitWall
+proc CG_MissileHitWall 124 44
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+CNSTI4 600
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $2246
+ADDRLP4 64
+INDIRI4
+CNSTI4 13
+GTI4 $2246
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRGP4 $2409-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2409
+address $2389
+address $2351
+address $2289
+address $2301
+address $2264
+address $2315
+address $2327
+address $2339
+address $2246
+address $2248
+address $2277
+address $2361
+code
+LABELV $2246
+LABELV $2248
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $2249
+ADDRLP4 4
+ADDRGP4 cgs+180272+980
+INDIRI4
+ASGNI4
+ADDRGP4 $2250
+JUMPV
+LABELV $2249
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $2253
+ADDRLP4 4
+ADDRGP4 cgs+180272+984
+INDIRI4
+ASGNI4
+ADDRGP4 $2254
+JUMPV
+LABELV $2253
+ADDRLP4 4
+ADDRGP4 cgs+180272+976
+INDIRI4
+ASGNI4
+LABELV $2254
+LABELV $2250
+ADDRLP4 0
+ADDRGP4 cgs+180272+536
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+CNSTI4 10
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2264
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 72
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+GEI4 $2265
+ADDRLP4 4
+ADDRGP4 cgs+180272+940
+INDIRI4
+ASGNI4
+ADDRGP4 $2266
+JUMPV
+LABELV $2265
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $2269
+ADDRLP4 4
+ADDRGP4 cgs+180272+936
+INDIRI4
+ASGNI4
+ADDRGP4 $2270
+JUMPV
+LABELV $2269
+ADDRLP4 4
+ADDRGP4 cgs+180272+944
+INDIRI4
+ASGNI4
+LABELV $2270
+LABELV $2266
+ADDRLP4 0
+ADDRGP4 cgs+180272+536
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 $2247
+JUMPV
+LABELV $2277
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+628
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+972
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2289
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+628
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+964
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2301
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+624
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+964
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 48
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+CNSTI4 1000
+ASGNI4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2315
+ADDRLP4 24
+ADDRGP4 cgs+180272+600
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+612
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+968
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+540
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 30
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2327
+ADDRLP4 24
+ADDRGP4 cgs+180272+600
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+616
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+968
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+540
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2339
+ADDRLP4 24
+ADDRGP4 cgs+180272+604
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+632
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cgs+180272+964
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+532
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2351
+ADDRLP4 24
+ADDRGP4 cgs+180272+596
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+620
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+528
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2361
+ADDRLP4 24
+ADDRGP4 cgs+180272+596
+INDIRI4
+ASGNI4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 1996
+NEI4 $2364
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2247
+JUMPV
+LABELV $2364
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $2367
+ADDRLP4 4
+ADDRGP4 cgs+180272+992
+INDIRI4
+ASGNI4
+ADDRGP4 $2368
+JUMPV
+LABELV $2367
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $2371
+ADDRLP4 4
+ADDRGP4 cgs+180272+996
+INDIRI4
+ASGNI4
+ADDRGP4 $2372
+JUMPV
+LABELV $2371
+ADDRLP4 4
+ADDRGP4 cgs+180272+988
+INDIRI4
+ASGNI4
+LABELV $2372
+LABELV $2368
+ADDRLP4 0
+ADDRGP4 cgs+180272+528
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+GEI4 $2379
+ADDRLP4 4
+ADDRGP4 cgs+180272+948
+INDIRI4
+ASGNI4
+ADDRGP4 $2380
+JUMPV
+LABELV $2379
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $2383
+ADDRLP4 4
+ADDRGP4 cgs+180272+952
+INDIRI4
+ASGNI4
+ADDRGP4 $2384
+JUMPV
+LABELV $2383
+ADDRLP4 4
+ADDRGP4 cgs+180272+956
+INDIRI4
+ASGNI4
+LABELV $2384
+LABELV $2380
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $2247
+JUMPV
+LABELV $2389
+ADDRLP4 24
+ADDRGP4 cgs+180272+596
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+180272+620
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+180272+528
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 84
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $2396
+ADDRLP4 4
+ADDRGP4 cgs+180272+948
+INDIRI4
+ASGNI4
+ADDRGP4 $2397
+JUMPV
+LABELV $2396
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $2400
+ADDRLP4 4
+ADDRGP4 cgs+180272+952
+INDIRI4
+ASGNI4
+ADDRGP4 $2401
+JUMPV
+LABELV $2400
+ADDRLP4 4
+ADDRGP4 cgs+180272+956
+INDIRI4
+ASGNI4
+LABELV $2401
+LABELV $2397
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 36
+CNSTI4 10
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $2247
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2411
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2411
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+NEI4 $2413
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2416
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_MakeExplosion
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $2418
+ADDRLP4 40
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 2120
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+76
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1132396544
+ADDRLP4 80
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+LTF4 $2423
+ADDRLP4 76
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2424
+JUMPV
+LABELV $2423
+ADDRLP4 76
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2424
+ADDRLP4 80
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 96
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 100
+CNSTF4 1132396544
+ADDRLP4 96
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+LTF4 $2426
+ADDRLP4 92
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2427
+JUMPV
+LABELV $2426
+ADDRLP4 92
+ADDRLP4 100
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2427
+ADDRLP4 96
+INDIRP4
+CNSTI4 269
+ADDP4
+ADDRLP4 92
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 112
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTF4 1132396544
+ADDRLP4 112
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LTF4 $2429
+ADDRLP4 108
+ADDRLP4 116
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2430
+JUMPV
+LABELV $2429
+ADDRLP4 108
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2430
+ADDRLP4 112
+INDIRP4
+CNSTI4 270
+ADDP4
+ADDRLP4 108
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+INDIRP4
+CNSTI4 271
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $2418
+LABELV $2416
+LABELV $2413
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+180272+540
+INDIRI4
+NEI4 $2434
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2435
+JUMPV
+LABELV $2434
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $2435
+ADDRLP4 32
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $2436
+ADDRLP4 76
+CNSTI4 2120
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+41156+76
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 84
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $2437
+JUMPV
+LABELV $2436
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 80
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $2437
+LABELV $2243
+endproc CG_MissileHitWall 124 44
+export CG_MissileHitPlayer
+proc CG_MissileHitPlayer 4 20
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2441
+CNSTI4 14
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2442
+JUMPV
+LABELV $2441
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+LABELV $2442
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2445
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $2445
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2447-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2447
+address $2446
+address $2446
+address $2445
+address $2445
+address $2445
+address $2445
+address $2445
+address $2446
+address $2446
+address $2446
+code
+LABELV $2446
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2445
+LABELV $2440
+endproc CG_MissileHitPlayer 4 20
+proc CG_ShotgunPellet 148 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+CNSTP4 0
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $2451
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $2452
+JUMPV
+LABELV $2451
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2456
+ADDRLP4 88
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2457
+ADDRLP4 64
+ADDRLP4 88+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 88+12
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2457
+JUMPV
+LABELV $2456
+ADDRLP4 60
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2464
+ADDRLP4 88
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 88+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2468
+ADDRLP4 64
+ADDRLP4 88+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 88+12
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $2468
+LABELV $2464
+LABELV $2457
+LABELV $2452
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2473
+ADDRGP4 $2449
+JUMPV
+LABELV $2473
+CNSTI4 936
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2476
+CNSTI4 3
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $2477
+JUMPV
+LABELV $2476
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2483
+ADDRGP4 $2449
+JUMPV
+LABELV $2483
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $2486
+CNSTI4 3
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $2487
+JUMPV
+LABELV $2486
+CNSTI4 3
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2487
+LABELV $2477
+LABELV $2449
+endproc CG_ShotgunPellet 148 28
+export CG_ShotgunPattern
+proc CG_ShotgunPattern 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $2494
+ADDRFP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 20+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPellet
+CALLV
+pop
+LABELV $2495
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+LTI4 $2494
+LABELV $2493
+endproc CG_ShotgunPattern 84 12
+export CG_ShotgunFire
+proc CG_ShotgunFire 52 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 36
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1107296256
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2525
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $2526
+JUMPV
+LABELV $2525
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1147207680
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+180272+348
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $2526
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPattern
+CALLV
+pop
+LABELV $2514
+endproc CG_ShotgunFire 52 48
+export CG_Tracer
+proc CG_Tracer 236 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+CNSTI4 4
+ASGNI4
+ADDRLP4 108+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 8
+ASGNI4
+ADDRLP4 108+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2535
+ADDRGP4 $2532
+JUMPV
+LABELV $2535
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg_tracerLength+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $2538
+ADDRLP4 156
+ADDRLP4 164
+INDIRF4
+ASGNF4
+LABELV $2538
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+109252+36+12
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+109252+36+12
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+109252+36+12+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+109252+36+12+8
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 144
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg+109252+36+24
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+109252+36+24+4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+109252+36+24+8
+INDIRF4
+ADDRLP4 144
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+180272+284
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 232
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 168
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 1056964608
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+180272+808
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $2532
+endproc CG_Tracer 236 16
+proc CG_CalcMuzzlePoint 40 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $2720
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2719
+JUMPV
+LABELV $2720
+ADDRLP4 12
+CNSTI4 936
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2728
+CNSTI4 0
+RETI4
+ADDRGP4 $2719
+JUMPV
+LABELV $2728
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $2732
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $2730
+LABELV $2732
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $2731
+JUMPV
+LABELV $2730
+ADDRGP4 cg_enableQ+12
+INDIRI4
+CNSTI4 0
+EQI4 $2733
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1102053376
+ADDF4
+ASGNF4
+ADDRGP4 $2734
+JUMPV
+LABELV $2733
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $2734
+LABELV $2731
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2719
+endproc CG_CalcMuzzlePoint 40 16
+export CG_Bullet
+proc CG_Bullet 108 28
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2739
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+CNSTF4 0
+LEF4 $2739
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $2742
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2744
+ADDRLP4 100
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2744
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $2745
+JUMPV
+LABELV $2744
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2746
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 20+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2747
+ADDRLP4 76
+ADDRLP4 20+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 20+12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2747
+JUMPV
+LABELV $2746
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $2754
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 20+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2757
+ADDRLP4 76
+ADDRLP4 20+24
+INDIRB
+ASGNB 12
+CNSTI4 19
+ARGI4
+ADDRLP4 20+12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+LABELV $2757
+LABELV $2754
+LABELV $2747
+LABELV $2745
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+GEF4 $2762
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Tracer
+CALLV
+pop
+LABELV $2762
+LABELV $2742
+LABELV $2739
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2765
+ADDRGP4 cg_leiEnhancement+12
+INDIRI4
+CNSTI4 0
+EQI4 $2767
+CNSTI4 14
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LFX_ParticleEffect
+CALLV
+pop
+ADDRGP4 $2766
+JUMPV
+LABELV $2767
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+ADDRGP4 $2766
+JUMPV
+LABELV $2765
+CNSTI4 2
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $2766
+LABELV $2738
+endproc CG_Bullet 108 28
+import trap_R_LFX_ParticleEffect
+import wideAdjustX
+import initparticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import addChallenge
+import getChallenge
+import challenges_save
+import challenges_init
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_TransitionEntity
+import CG_ProcessSnapshots
+import CG_SpurtBlood
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_UpdateGraphicFraction
+import CG_UpdateSoundFraction
+import CG_UpdateMediaFraction
+import CG_DrawLoadingScreen
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_FairCvars
+import SnapVectorTowards
+import CG_BuildSpectatorString
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import CG_Cvar_ClampInt
+import CG_PredictWeaponEffects
+import cg_teamChatBeep
+import cg_chatBeep
+import cg_weaponOrder
+import cg_weaponBarStyle
+import cg_crosshairColorBlue
+import cg_crosshairColorGreen
+import cg_crosshairColorRed
+import cg_ch13size
+import cg_ch13
+import cg_ch12size
+import cg_ch12
+import cg_ch11size
+import cg_ch11
+import cg_ch10size
+import cg_ch10
+import cg_ch9size
+import cg_ch9
+import cg_ch8size
+import cg_ch8
+import cg_ch7size
+import cg_ch7
+import cg_ch6size
+import cg_ch6
+import cg_ch5size
+import cg_ch5
+import cg_ch4size
+import cg_ch4
+import cg_ch3size
+import cg_ch3
+import cg_ch2size
+import cg_ch2
+import cg_ch1size
+import cg_ch1
+import cg_differentCrosshairs
+import cg_crosshairPulse
+import cg_fragmsgsize
+import cg_autovertex
+import cg_vote_custom_commands
+import cg_cyclegrapple
+import cg_voteflags
+import cg_voip_teamonly
+import cg_hitsound
+import cg_alwaysWeaponBar
+import cl_timeNudge
+import cg_optimizePrediction
+import cg_projectileNudge
+import sv_fps
+import cg_cmdTimeNudge
+import cg_delag
+import cg_enableFS
+import cg_enableQ
+import cg_enableBreath
+import cg_enableDust
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_singlePlayerActive
+import cg_singlePlayer
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_blueTeamName
+import cg_redTeamName
+import cg_music
+import cg_trueLightning
+import cg_oldPlasma
+import cg_modelEyes_Fwd
+import cg_modelEyes_Right
+import cg_modelEyes_Up
+import cg_cameraEyes_Up
+import cg_cameraEyes_Fwd
+import cg_cameraEyes
+import cg_cameramode
+import cg_deathcam
+import cg_leiDebug
+import cg_muzzleflashStyle
+import cg_leiSuperGoreyAwesome
+import cg_leiBrassNoise
+import cg_leiGoreNoise
+import cg_leiEnhancement
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import cg_obituaryOutput
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawSpeed
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_kickScale
+import cg_bobmodel
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_bob
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2217
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 87
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 85
+byte 1 77
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $1804
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1127
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1057
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $995
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $898
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $712
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $705
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $704
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $701
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $700
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $698
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $693
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $690
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $689
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $687
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $684
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $681
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 104
+byte 1 121
+byte 1 112
+byte 1 114
+byte 1 98
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $680
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $678
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $677
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $673
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $672
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $670
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $667
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $666
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $664
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $661
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $660
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $659
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $657
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $653
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $652
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $650
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $648
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $645
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $644
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $643
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $642
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $641
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $639
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $638
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $637
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 82
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $634
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $632
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $629
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $626
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $623
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $620
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $617
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $613
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $612
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $608
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $605
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $604
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $603
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $600
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $597
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $594
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $591
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $588
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $585
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $582
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $581
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 53
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $580
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $579
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $578
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $577
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $576
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $575
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $572
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $558
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,9237 @@
+bss
+align 4
+LABELV $62
+skip 4
+export BotNumActivePlayers
+code
+proc BotNumActivePlayers 1060 12
+ADDRGP4 $62
+INDIRI4
+CNSTI4 0
+NEI4 $63
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $62
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $63
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $66
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $73
+ADDRLP4 0
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $70
+LABELV $73
+ADDRGP4 $67
+JUMPV
+LABELV $70
+ADDRLP4 0
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $74
+ADDRGP4 $67
+JUMPV
+LABELV $74
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $67
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $69
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 $62
+INDIRI4
+GEI4 $77
+ADDRLP4 1024
+INDIRI4
+CNSTI4 64
+LTI4 $66
+LABELV $77
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $61
+endproc BotNumActivePlayers 1060 12
+bss
+align 4
+LABELV $79
+skip 4
+export BotIsFirstInRankings
+code
+proc BotIsFirstInRankings 1524 12
+ADDRGP4 $79
+INDIRI4
+CNSTI4 0
+NEI4 $80
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1500
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $79
+ADDRLP4 1500
+INDIRI4
+ASGNI4
+LABELV $80
+ADDRLP4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $85
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1504
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+EQI4 $88
+ADDRLP4 4
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 1508
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1508
+INDIRP4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+NEI4 $86
+LABELV $88
+ADDRGP4 $83
+JUMPV
+LABELV $86
+ADDRLP4 4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 3
+NEI4 $89
+ADDRGP4 $83
+JUMPV
+LABELV $89
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1028+248
+INDIRI4
+GEI4 $91
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $91
+LABELV $83
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $85
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $79
+INDIRI4
+GEI4 $94
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $82
+LABELV $94
+CNSTI4 1
+RETI4
+LABELV $78
+endproc BotIsFirstInRankings 1524 12
+bss
+align 4
+LABELV $96
+skip 4
+export BotIsLastInRankings
+code
+proc BotIsLastInRankings 1524 12
+ADDRGP4 $96
+INDIRI4
+CNSTI4 0
+NEI4 $97
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1500
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $96
+ADDRLP4 1500
+INDIRI4
+ASGNI4
+LABELV $97
+ADDRLP4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1504
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRLP4 4
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 1508
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1508
+INDIRP4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+NEI4 $103
+LABELV $105
+ADDRGP4 $100
+JUMPV
+LABELV $103
+ADDRLP4 4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 3
+NEI4 $106
+ADDRGP4 $100
+JUMPV
+LABELV $106
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1028+248
+INDIRI4
+LEI4 $108
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $108
+LABELV $100
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $102
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $96
+INDIRI4
+GEI4 $111
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $99
+LABELV $111
+CNSTI4 1
+RETI4
+LABELV $95
+endproc BotIsLastInRankings 1524 12
+bss
+align 1
+LABELV $113
+skip 32
+align 4
+LABELV $114
+skip 4
+export BotFirstClientInRankings
+code
+proc BotFirstClientInRankings 1532 12
+ADDRGP4 $114
+INDIRI4
+CNSTI4 0
+NEI4 $115
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1504
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $114
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+LABELV $115
+ADDRLP4 1496
+CNSTI4 -999999
+ASGNI4
+ADDRLP4 1508
+CNSTI4 0
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRLP4 4
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+NEI4 $121
+LABELV $123
+ADDRGP4 $118
+JUMPV
+LABELV $121
+ADDRLP4 4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 1524
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1524
+INDIRP4
+ARGP4
+ADDRLP4 1528
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 3
+NEI4 $124
+ADDRGP4 $118
+JUMPV
+LABELV $124
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1028+248
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+LEI4 $126
+ADDRLP4 1496
+ADDRLP4 1028+248
+INDIRI4
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $126
+LABELV $118
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $114
+INDIRI4
+GEI4 $130
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $117
+LABELV $130
+ADDRLP4 1500
+INDIRI4
+ARGI4
+ADDRGP4 $113
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $113
+RETP4
+LABELV $112
+endproc BotFirstClientInRankings 1532 12
+bss
+align 1
+LABELV $132
+skip 32
+align 4
+LABELV $133
+skip 4
+export BotLastClientInRankings
+code
+proc BotLastClientInRankings 1532 12
+ADDRGP4 $133
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1504
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $133
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+LABELV $134
+ADDRLP4 1496
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1508
+CNSTI4 0
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+EQI4 $142
+ADDRLP4 4
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+NEI4 $140
+LABELV $142
+ADDRGP4 $137
+JUMPV
+LABELV $140
+ADDRLP4 4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 1524
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1524
+INDIRP4
+ARGP4
+ADDRLP4 1528
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 3
+NEI4 $143
+ADDRGP4 $137
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1028+248
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+GEI4 $145
+ADDRLP4 1496
+ADDRLP4 1028+248
+INDIRI4
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $145
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $139
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $133
+INDIRI4
+GEI4 $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $136
+LABELV $149
+ADDRLP4 1500
+INDIRI4
+ARGI4
+ADDRGP4 $132
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $132
+RETP4
+LABELV $131
+endproc BotLastClientInRankings 1532 12
+bss
+align 4
+LABELV $151
+skip 4
+align 1
+LABELV $152
+skip 32
+export BotRandomOpponentName
+code
+proc BotRandomOpponentName 1324 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $151
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1292
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $151
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+LABELV $153
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $155
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $159
+ADDRGP4 $156
+JUMPV
+LABELV $159
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1300
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRLP4 4
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 0
+NEI4 $161
+LABELV $163
+ADDRGP4 $156
+JUMPV
+LABELV $161
+ADDRLP4 4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+ADDRLP4 1316
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 3
+NEI4 $164
+ADDRGP4 $156
+JUMPV
+LABELV $164
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1320
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+EQI4 $166
+ADDRGP4 $156
+JUMPV
+LABELV $166
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $156
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $158
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $151
+INDIRI4
+GEI4 $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $155
+LABELV $168
+ADDRLP4 1304
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1304
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 1028
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $169
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+GTI4 $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $152
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $152
+RETP4
+ADDRGP4 $150
+JUMPV
+LABELV $173
+LABELV $170
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $169
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 $152
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $152
+RETP4
+LABELV $150
+endproc BotRandomOpponentName 1324 12
+bss
+align 1
+LABELV $176
+skip 128
+export BotMapTitle
+code
+proc BotMapTitle 1028 12
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 127
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRGP4 $176+127
+CNSTI1 0
+ASGNI1
+ADDRGP4 $176
+RETP4
+LABELV $175
+endproc BotMapTitle 1028 12
+export BotWeaponNameForMeansOfDeath
+proc BotWeaponNameForMeansOfDeath 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $180
+ADDRLP4 0
+INDIRI4
+CNSTI4 28
+GTI4 $180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $213-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $213
+address $182
+address $184
+address $186
+address $188
+address $188
+address $190
+address $190
+address $192
+address $192
+address $194
+address $196
+address $198
+address $198
+address $180
+address $180
+address $180
+address $180
+address $180
+address $180
+address $180
+address $180
+address $180
+address $200
+address $202
+address $204
+address $206
+address $208
+address $210
+code
+LABELV $182
+ADDRGP4 $183
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $184
+ADDRGP4 $185
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $186
+ADDRGP4 $187
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $188
+ADDRGP4 $189
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $190
+ADDRGP4 $191
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $192
+ADDRGP4 $193
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $194
+ADDRGP4 $195
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $196
+ADDRGP4 $197
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $198
+ADDRGP4 $199
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $200
+ADDRGP4 $201
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $202
+ADDRGP4 $203
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $204
+ADDRGP4 $205
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $206
+ADDRGP4 $207
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $208
+ADDRGP4 $209
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $210
+ADDRGP4 $211
+RETP4
+ADDRGP4 $179
+JUMPV
+LABELV $180
+ADDRGP4 $212
+RETP4
+LABELV $179
+endproc BotWeaponNameForMeansOfDeath 4 0
+export BotRandomWeaponName
+proc BotRandomWeaponName 12 0
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1094608486
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $216
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+GTI4 $216
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $229
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $229
+address $218
+address $219
+address $220
+address $221
+address $222
+address $223
+address $224
+address $225
+address $226
+address $227
+address $228
+code
+LABELV $218
+ADDRGP4 $185
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $219
+ADDRGP4 $183
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $220
+ADDRGP4 $187
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $221
+ADDRGP4 $189
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $222
+ADDRGP4 $191
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $223
+ADDRGP4 $193
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $224
+ADDRGP4 $195
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $225
+ADDRGP4 $197
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $226
+ADDRGP4 $201
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $227
+ADDRGP4 $203
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $228
+ADDRGP4 $205
+RETP4
+ADDRGP4 $215
+JUMPV
+LABELV $216
+ADDRGP4 $199
+RETP4
+LABELV $215
+endproc BotRandomWeaponName 12 0
+export BotVisibleEnemies
+proc BotVisibleEnemies 172 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $235
+ADDRGP4 $232
+JUMPV
+LABELV $235
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRGP4 $232
+JUMPV
+LABELV $237
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $242
+ADDRLP4 4+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $239
+LABELV $242
+ADDRGP4 $232
+JUMPV
+LABELV $239
+ADDRLP4 4
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $243
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $232
+JUMPV
+LABELV $243
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRGP4 $232
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+LEF4 $247
+CNSTI4 1
+RETI4
+ADDRGP4 $230
+JUMPV
+LABELV $247
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $231
+CNSTI4 0
+RETI4
+LABELV $230
+endproc BotVisibleEnemies 172 20
+export BotValidChatPosition
+proc BotValidChatPosition 172 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $250
+CNSTI4 1
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $252
+CNSTI4 1
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $252
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $254
+LABELV $260
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $254
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+EQI4 $262
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $262
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $265
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $265
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 168
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 168
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 60+80
+INDIRI4
+CNSTI4 1022
+EQI4 $269
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $269
+CNSTI4 1
+RETI4
+LABELV $249
+endproc BotValidChatPosition 172 28
+export BotChat_EnterGame
+proc BotChat_EnterGame 68 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $273
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $276
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $276
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $278
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $278
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $280
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $285
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $285
+LABELV $282
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $289
+CNSTI4 0
+RETI4
+ADDRGP4 $272
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $272
+endproc BotChat_EnterGame 68 32
+export BotChat_ExitGame
+proc BotChat_ExitGame 64 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $294
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $297
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $297
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $299
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $299
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $301
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $303
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $306
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $306
+LABELV $303
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $308
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $293
+endproc BotChat_ExitGame 64 32
+export BotChat_StartLevel
+proc BotChat_StartLevel 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $312
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $315
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $317
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $317
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $319
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $322
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $327
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $327
+LABELV $324
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $329
+CNSTI4 0
+RETI4
+ADDRGP4 $311
+JUMPV
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $311
+endproc BotChat_StartLevel 56 16
+export BotChat_EndLevel
+proc BotChat_EndLevel 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $333
+CNSTI4 0
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $336
+CNSTI4 0
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $338
+CNSTI4 0
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $338
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $342
+CNSTI4 1
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $340
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $344
+CNSTI4 0
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $346
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $349
+CNSTI4 0
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $349
+LABELV $346
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $351
+CNSTI4 0
+RETI4
+ADDRGP4 $332
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotIsLastInRankings
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $357
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $332
+endproc BotChat_EndLevel 80 32
+export BotChat_Death
+proc BotChat_Death 124 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $361
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $364
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $366
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $366
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $368
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $371
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $371
+LABELV $368
+ADDRLP4 40
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+GTI4 $373
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $373
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $375
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+GEI4 $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 0
+ARGP4
+ADDRGP4 $377
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $376
+ADDRLP4 48
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $380
+CNSTI4 0
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 60
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $360
+JUMPV
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $391
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 19
+NEI4 $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $403
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 17
+EQI4 $403
+ADDRLP4 88
+INDIRI4
+CNSTI4 20
+EQI4 $403
+ADDRLP4 88
+INDIRI4
+CNSTI4 21
+EQI4 $403
+ADDRLP4 88
+INDIRI4
+CNSTI4 22
+EQI4 $403
+ADDRLP4 88
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $397
+LABELV $403
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $405
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $407
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $410
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $410
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $409
+JUMPV
+LABELV $408
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+EQI4 $415
+ADDRLP4 104
+INDIRI4
+CNSTI4 10
+EQI4 $415
+ADDRLP4 104
+INDIRI4
+CNSTI4 12
+EQI4 $415
+ADDRLP4 104
+INDIRI4
+CNSTI4 13
+NEI4 $411
+LABELV $415
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $418
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $421
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 116
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 116
+INDIRF4
+GEF4 $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $424
+LABELV $412
+LABELV $409
+LABELV $406
+LABELV $398
+LABELV $395
+LABELV $392
+LABELV $389
+LABELV $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $360
+endproc BotChat_Death 124 20
+export BotChat_Kill
+proc BotChat_Kill 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $428
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $431
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $433
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $433
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $435
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $438
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $440
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $440
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $442
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $444
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $446
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $450
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $456
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $458
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $459
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $461
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 84
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 84
+INDIRF4
+GEF4 $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $466
+LABELV $463
+LABELV $460
+LABELV $457
+LABELV $454
+LABELV $449
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $427
+endproc BotChat_Kill 88 16
+export BotChat_EnemySuicide
+proc BotChat_EnemySuicide 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $470
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $473
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $473
+ADDRLP4 36
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+GTI4 $475
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $477
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $477
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $479
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $479
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $484
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $484
+LABELV $481
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $486
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $486
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $488
+CNSTI4 0
+RETI4
+ADDRGP4 $469
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRLP4 0
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $491
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $469
+endproc BotChat_EnemySuicide 56 16
+export BotChat_HitTalking
+proc BotChat_HitTalking 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $495
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $495
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $498
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $498
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $500
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $500
+ADDRLP4 0
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $503
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $503
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $505
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $509
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $507
+LABELV $509
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $507
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 52
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $510
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $510
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $512
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $512
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $514
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+LEF4 $517
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $517
+LABELV $514
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $519
+CNSTI4 0
+RETI4
+ADDRGP4 $494
+JUMPV
+LABELV $519
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $494
+endproc BotChat_HitTalking 68 20
+export BotChat_HitNoDeath
+proc BotChat_HitNoDeath 216 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $526
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $526
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $528
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $528
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $532
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $530
+LABELV $532
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $530
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $533
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $536
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $536
+ADDRLP4 188
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+GTI4 $538
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $540
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $540
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $542
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $542
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $544
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 180
+INDIRF4
+MULF4
+LEF4 $547
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $547
+LABELV $544
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $549
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $549
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $551
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 208
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $553
+CNSTI4 0
+RETI4
+ADDRGP4 $524
+JUMPV
+LABELV $553
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $524
+endproc BotChat_HitNoDeath 216 20
+export BotChat_HitNoKill
+proc BotChat_HitNoKill 208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $558
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $558
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $561
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $561
+ADDRLP4 180
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+GTI4 $563
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $565
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $565
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $567
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $567
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $569
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+LEF4 $572
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $572
+LABELV $569
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $574
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $574
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $576
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 200
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $578
+CNSTI4 0
+RETI4
+ADDRGP4 $557
+JUMPV
+LABELV $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $557
+endproc BotChat_HitNoKill 208 20
+export BotChat_Random
+proc BotChat_Random 96 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $583
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $586
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $588
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $588
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $590
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $590
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+EQI4 $595
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+EQI4 $595
+ADDRLP4 40
+INDIRI4
+CNSTI4 5
+NEI4 $592
+LABELV $595
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+LEF4 $596
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $596
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $601
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $601
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1048576000
+LEF4 $603
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $603
+LABELV $598
+ADDRLP4 52
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+GTI4 $605
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $607
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $609
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $612
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $582
+JUMPV
+LABELV $613
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 76
+INDIRF4
+GEF4 $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $617
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $618
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $582
+endproc BotChat_Random 96 36
+export BotChatTime
+proc BotChatTime 0 0
+CNSTF4 1073741824
+RETF4
+LABELV $619
+endproc BotChatTime 0 0
+export BotChatTest
+proc BotChatTest 184 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $621
+ADDRGP4 $620
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $627
+JUMPV
+LABELV $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $625
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $627
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $629
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $631
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $635
+JUMPV
+LABELV $632
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $633
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $635
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $637
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $639
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 64
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $358
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $643
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $644
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $645
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $647
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $644
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $648
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $649
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $651
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $652
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $653
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $659
+JUMPV
+LABELV $656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $657
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $659
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $660
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $661
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $663
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $667
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $665
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $667
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $407
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $407
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $669
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $671
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $418
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $418
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $673
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $675
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $421
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $421
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $677
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $422
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $683
+JUMPV
+LABELV $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $681
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $683
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $684
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $685
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $687
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $684
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $691
+JUMPV
+LABELV $688
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $689
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $691
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $688
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $695
+JUMPV
+LABELV $692
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $693
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $695
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $696
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $458
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $697
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $699
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $696
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $461
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $703
+JUMPV
+LABELV $700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $461
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $701
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $703
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 124
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $705
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $707
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $708
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $709
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $711
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $708
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $715
+JUMPV
+LABELV $712
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $713
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $715
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $712
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 816
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 1128
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $721
+JUMPV
+LABELV $718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $719
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $721
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $718
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $725
+JUMPV
+LABELV $722
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $723
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $725
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $726
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $581
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $727
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $729
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $731
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $617
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $732
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $617
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 172
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $733
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $735
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $732
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $618
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $739
+JUMPV
+LABELV $736
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $618
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 176
+ADDRGP4 $292
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $737
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $739
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $736
+LABELV $620
+endproc BotChatTest 184 36
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_blueteam
+import g_redteam
+import g_singlePlayer
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $618
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $617
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $581
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $556
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $523
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $493
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $492
+byte 1 0
+align 1
+LABELV $468
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $467
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $464
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $461
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $458
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $455
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $450
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $426
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $425
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $422
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $421
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $418
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $410
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $407
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $404
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $396
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $393
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $390
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $387
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $382
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $377
+byte 1 91
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $359
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $358
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $355
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $331
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $321
+byte 1 118
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $310
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $292
+byte 1 91
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 93
+byte 1 0
+align 1
+LABELV $291
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $212
+byte 1 91
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $211
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $209
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $207
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $205
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $203
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $201
+byte 1 78
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $199
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $197
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $195
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $193
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $191
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $189
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $187
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $185
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $183
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $76
+byte 1 116
+byte 1 0
+align 1
+LABELV $72
+byte 1 110
+byte 1 0
+align 1
+LABELV $65
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
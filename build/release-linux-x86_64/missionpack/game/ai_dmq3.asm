@@ -0,0 +1,31764 @@
+data
+align 4
+LABELV $62
+address $63
+address $64
+address $65
+address $66
+address $67
+address $68
+address $69
+address $70
+address $71
+address $67
+address $72
+address $73
+address $74
+address $75
+export untrap_BotGetLevelItemGoal
+code
+proc untrap_BotGetLevelItemGoal 148 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 136
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $79
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $79
+ADDRLP4 140
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $82
+ADDRLP4 140
+INDIRI4
+CVIU4 4
+CNSTU4 14
+GEU4 $82
+ADDRLP4 128
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $62
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $83
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $82
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $83
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+LABELV $77
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+GTI4 $76
+CNSTI4 -1
+RETI4
+LABELV $61
+endproc untrap_BotGetLevelItemGoal 148 16
+export BotSetUserInfo
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $86
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 4 0
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $88
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $88
+CNSTI4 0
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $90
+CNSTI4 1
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $92
+CNSTI4 2
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $92
+CNSTI4 0
+RETI4
+LABELV $87
+endproc BotCTFCarryingFlag 4 0
+export BotTeam
+proc BotTeam 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $97
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $95
+LABELV $97
+CNSTI4 0
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $95
+CNSTI4 2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $98
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $98
+CNSTI4 2140
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 1024
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $100
+CNSTI4 2
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $100
+CNSTI4 0
+RETI4
+LABELV $94
+endproc BotTeam 4 0
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $106
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $107
+ADDRGP4 $103
+JUMPV
+LABELV $106
+CNSTI4 2
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $107
+CNSTI4 1
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $103
+CNSTI4 0
+RETI4
+LABELV $102
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $109
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $108
+JUMPV
+LABELV $109
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $108
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $112
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $111
+JUMPV
+LABELV $112
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $111
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 472 8
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+LTI4 $115
+ADDRLP4 468
+INDIRI4
+CNSTI4 64
+GEI4 $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $117
+CNSTI4 1
+RETI4
+ADDRGP4 $114
+JUMPV
+LABELV $117
+LABELV $115
+CNSTI4 0
+RETI4
+LABELV $114
+endproc EntityIsDead 472 8
+export EntityCarriesFlag
+proc EntityCarriesFlag 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $121
+CNSTI4 1
+RETI4
+ADDRGP4 $120
+JUMPV
+LABELV $121
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $123
+CNSTI4 1
+RETI4
+ADDRGP4 $120
+JUMPV
+LABELV $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $125
+CNSTI4 1
+RETI4
+ADDRGP4 $120
+JUMPV
+LABELV $125
+CNSTI4 0
+RETI4
+LABELV $120
+endproc EntityCarriesFlag 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $128
+CNSTI4 0
+RETI4
+ADDRGP4 $127
+JUMPV
+LABELV $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $130
+CNSTI4 1
+RETI4
+ADDRGP4 $127
+JUMPV
+LABELV $130
+CNSTI4 0
+RETI4
+LABELV $127
+endproc EntityIsInvisible 4 4
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $133
+CNSTI4 1
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $133
+CNSTI4 0
+RETI4
+LABELV $132
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $136
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $136
+CNSTI4 0
+RETI4
+LABELV $135
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $139
+CNSTI4 1
+RETI4
+ADDRGP4 $138
+JUMPV
+LABELV $139
+CNSTI4 0
+RETI4
+LABELV $138
+endproc EntityHasQuad 0 0
+export EntityHasKamikaze
+proc EntityHasKamikaze 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $142
+CNSTI4 1
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $142
+CNSTI4 0
+RETI4
+LABELV $141
+endproc EntityHasKamikaze 0 0
+export EntityCarriesCubes
+proc EntityCarriesCubes 208 8
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $145
+CNSTI4 0
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $145
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+204
+INDIRI4
+CNSTI4 0
+LEI4 $147
+CNSTI4 1
+RETI4
+ADDRGP4 $144
+JUMPV
+LABELV $147
+CNSTI4 0
+RETI4
+LABELV $144
+endproc EntityCarriesCubes 208 8
+export Bot1FCTFCarryingFlag
+proc Bot1FCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+EQI4 $151
+CNSTI4 0
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $151
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $153
+CNSTI4 1
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $153
+CNSTI4 0
+RETI4
+LABELV $150
+endproc Bot1FCTFCarryingFlag 0 0
+export BotHarvesterCarryingCubes
+proc BotHarvesterCarryingCubes 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $156
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $158
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $160
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $160
+CNSTI4 0
+RETI4
+LABELV $155
+endproc BotHarvesterCarryingCubes 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $162
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 172 12
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+LTI4 $166
+ADDRLP4 144
+INDIRI4
+CNSTI4 17
+GTI4 $166
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $193-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $193
+address $167
+address $170
+address $177
+address $178
+address $179
+address $180
+address $181
+address $181
+address $182
+address $183
+address $184
+address $185
+address $186
+address $166
+address $166
+address $187
+address $190
+code
+LABELV $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 152
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 4
+EQI4 $176
+ADDRLP4 152
+INDIRI4
+CNSTI4 9
+EQI4 $176
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+NEI4 $174
+LABELV $176
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $173
+LABELV $174
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $171
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $171
+LABELV $173
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $171
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $177
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $178
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $179
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $180
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $181
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $182
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $184
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $185
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $187
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+NEI4 $188
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $189
+LABELV $190
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+NEI4 $191
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $192
+LABELV $166
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+LABELV $167
+ADDRGP4 $196
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $165
+endproc BotSetTeamStatus 172 12
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $200
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $198
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $207
+LABELV $204
+LABELV $201
+LABELV $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $213
+ADDRLP4 20
+INDIRI4
+CNSTI4 9
+NEI4 $211
+LABELV $213
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 60
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $216
+LABELV $214
+LABELV $211
+CNSTI4 1
+RETI4
+ADDRGP4 $197
+JUMPV
+LABELV $209
+CNSTI4 0
+RETI4
+LABELV $197
+endproc BotSetLastOrderedTask 68 16
+export BotRefuseOrder
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRGP4 $218
+JUMPV
+LABELV $219
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $221
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $221
+LABELV $218
+endproc BotRefuseOrder 8 12
+export BotCTFSeekGoals
+proc BotCTFSeekGoals 240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+EQI4 $232
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+EQI4 $237
+ADDRGP4 $229
+JUMPV
+LABELV $232
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $237
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 200
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 160
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $230
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1124073472
+GEF4 $244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $245
+ADDRGP4 $196
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $246
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $224
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+NEI4 $249
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $250
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $224
+JUMPV
+LABELV $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $255
+LABELV $253
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+NEI4 $257
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $267
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $224
+LABELV $267
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+LTI4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $224
+LABELV $270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $259
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $276
+LABELV $276
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 4
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+CNSTI4 6
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+CNSTI4 8
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+CNSTI4 9
+EQI4 $224
+ADDRLP4 196
+INDIRI4
+CNSTI4 10
+EQI4 $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $272
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $224
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+EQI4 $224
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $290
+ADDRGP4 $224
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $292
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $294
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 4
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 5
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 6
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 8
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 9
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 10
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 14
+EQI4 $307
+ADDRLP4 204
+INDIRI4
+CNSTI4 15
+NEI4 $296
+LABELV $307
+ADDRGP4 $224
+JUMPV
+LABELV $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRGP4 $224
+JUMPV
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $310
+ADDRGP4 $224
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $312
+ADDRGP4 $224
+JUMPV
+LABELV $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1112014848
+GEF4 $314
+ADDRGP4 $224
+JUMPV
+LABELV $314
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $318
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $319
+JUMPV
+LABELV $318
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $319
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $317
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $320
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $320
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $324
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $324
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+NEI4 $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $325
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $224
+endproc BotCTFSeekGoals 240 12
+export BotCTFRetreatGoals
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $333
+LABELV $331
+LABELV $330
+endproc BotCTFRetreatGoals 8 4
+export BotDDSeekGoals
+proc BotDDSeekGoals 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $338
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+EQI4 $342
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+NEI4 $340
+LABELV $342
+ADDRGP4 $335
+JUMPV
+LABELV $340
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 17
+ASGNI4
+LABELV $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $347
+ADDRGP4 $196
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $347
+ADDRGP4 $196
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 17
+NEI4 $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $351
+ADDRGP4 $196
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRGP4 $196
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $352
+LABELV $349
+LABELV $346
+LABELV $335
+endproc BotDDSeekGoals 20 12
+export Bot1FCTFSeekGoals
+proc Bot1FCTFSeekGoals 208 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $246
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $353
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 164
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $360
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $366
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+LTI4 $368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $368
+LABELV $366
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 3
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 8
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 9
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 13
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 10
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 14
+EQI4 $381
+ADDRLP4 164
+INDIRI4
+CNSTI4 15
+NEI4 $370
+LABELV $381
+ADDRGP4 $353
+JUMPV
+LABELV $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 13
+EQI4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+NEI4 $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+LTI4 $390
+LABELV $390
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $397
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+EQI4 $397
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+EQI4 $397
+ADDRLP4 168
+INDIRI4
+CNSTI4 9
+EQI4 $397
+ADDRLP4 168
+INDIRI4
+CNSTI4 10
+NEI4 $392
+LABELV $397
+ADDRGP4 $353
+JUMPV
+LABELV $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+NEI4 $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $386
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRGP4 $353
+JUMPV
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $404
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+EQI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $406
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 2
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 3
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 4
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 5
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 6
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 8
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 9
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 13
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 10
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 14
+EQI4 $420
+ADDRLP4 176
+INDIRI4
+CNSTI4 15
+NEI4 $408
+LABELV $420
+ADDRGP4 $353
+JUMPV
+LABELV $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $421
+ADDRGP4 $353
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $423
+ADDRGP4 $353
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $425
+ADDRGP4 $353
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1112014848
+GEF4 $427
+ADDRGP4 $353
+JUMPV
+LABELV $427
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $432
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $430
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $433
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $436
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $436
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+NEI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $437
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $353
+endproc Bot1FCTFSeekGoals 208 12
+export Bot1FCTFRetreatGoals
+proc Bot1FCTFRetreatGoals 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $445
+LABELV $443
+LABELV $442
+endproc Bot1FCTFRetreatGoals 12 8
+export BotObeliskSeekGoals
+proc BotObeliskSeekGoals 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRGP4 $447
+JUMPV
+LABELV $448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $450
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 9
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 14
+EQI4 $464
+ADDRLP4 16
+INDIRI4
+CNSTI4 15
+NEI4 $452
+LABELV $464
+ADDRGP4 $447
+JUMPV
+LABELV $452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRGP4 $447
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $467
+ADDRGP4 $447
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1112014848
+GEF4 $469
+ADDRGP4 $447
+JUMPV
+LABELV $469
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $474
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $472
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $475
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $475
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $480
+JUMPV
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $481
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $481
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $485
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $486
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $482
+LABELV $476
+LABELV $447
+endproc BotObeliskSeekGoals 52 12
+export BotGoHarvest
+proc BotGoHarvest 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6160
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $487
+endproc BotGoHarvest 4 12
+export BotObeliskRetreatGoals
+proc BotObeliskRetreatGoals 0 0
+LABELV $490
+endproc BotObeliskRetreatGoals 0 0
+export BotHarvesterSeekGoals
+proc BotHarvesterSeekGoals 208 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $491
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRGP4 $491
+JUMPV
+LABELV $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 168
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $500
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $500
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $502
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $502
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 3
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 4
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 9
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 13
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 12
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 10
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 14
+EQI4 $515
+ADDRLP4 168
+INDIRI4
+CNSTI4 15
+NEI4 $504
+LABELV $515
+ADDRGP4 $491
+JUMPV
+LABELV $504
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $516
+ADDRGP4 $491
+JUMPV
+LABELV $516
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $518
+ADDRGP4 $491
+JUMPV
+LABELV $518
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1112014848
+GEF4 $520
+ADDRGP4 $491
+JUMPV
+LABELV $520
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $522
+LABELV $522
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $524
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $526
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $526
+LABELV $524
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $528
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $530
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $531
+JUMPV
+LABELV $530
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $531
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $529
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $532
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $532
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $536
+ADDRLP4 196
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $536
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 196
+INDIRI4
+EQI4 $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+NEI4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $541
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $537
+LABELV $533
+LABELV $491
+endproc BotHarvesterSeekGoals 208 12
+export BotHarvesterRetreatGoals
+proc BotHarvesterRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $543
+LABELV $542
+endproc BotHarvesterRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $552
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $550
+LABELV $552
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $550
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $553
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $555
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskRetreatGoals
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $555
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $549
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterRetreatGoals
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $561
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $559
+LABELV $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $562
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $564
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskSeekGoals
+CALLV
+pop
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $566
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterSeekGoals
+CALLV
+pop
+LABELV $566
+LABELV $565
+LABELV $563
+LABELV $560
+LABELV $549
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 11
+NEI4 $568
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDDSeekGoals
+CALLV
+pop
+LABELV $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $547
+endproc BotTeamGoals 4 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $570
+JUMPV
+LABELV $571
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $574
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $570
+JUMPV
+LABELV $574
+CNSTI4 0
+RETI4
+LABELV $570
+endproc BotPointAreaNum 68 20
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $579
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $577
+LABELV $579
+CNSTI4 3
+ARGI4
+ADDRGP4 $580
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $581
+RETP4
+ADDRGP4 $576
+JUMPV
+LABELV $577
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $576
+endproc ClientName 1032 12
+export ClientSkin
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $586
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $584
+LABELV $586
+CNSTI4 3
+ARGI4
+ADDRGP4 $587
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $581
+RETP4
+ADDRGP4 $583
+JUMPV
+LABELV $584
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $583
+endproc ClientSkin 1032 12
+bss
+align 4
+LABELV $590
+skip 4
+export ClientFromName
+code
+proc ClientFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $590
+INDIRI4
+CNSTI4 0
+NEI4 $591
+ADDRGP4 $593
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $590
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $591
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $597
+JUMPV
+LABELV $594
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $589
+JUMPV
+LABELV $598
+LABELV $595
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $597
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $590
+INDIRI4
+GEI4 $600
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $594
+LABELV $600
+CNSTI4 -1
+RETI4
+LABELV $589
+endproc ClientFromName 1040 12
+bss
+align 4
+LABELV $602
+skip 4
+export ClientOnSameTeamFromName
+code
+proc ClientOnSameTeamFromName 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $602
+INDIRI4
+CNSTI4 0
+NEI4 $603
+ADDRGP4 $593
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $602
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $603
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $608
+JUMPV
+LABELV $605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $609
+ADDRGP4 $606
+JUMPV
+LABELV $609
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $611
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $601
+JUMPV
+LABELV $611
+LABELV $606
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $608
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $602
+INDIRI4
+GEI4 $613
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $605
+LABELV $613
+CNSTI4 -1
+RETI4
+LABELV $601
+endproc ClientOnSameTeamFromName 1044 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $618
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $622
+ADDRGP4 $620
+JUMPV
+LABELV $622
+LABELV $619
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $624
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $618
+LABELV $624
+LABELV $620
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $625
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $614
+JUMPV
+LABELV $625
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $616
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $615
+CNSTP4 0
+RETP4
+LABELV $614
+endproc stristr 12 4
+export EasyClientName
+proc EasyClientName 200 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $628
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $629
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $631
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $628
+ADDRLP4 5
+ARGP4
+ADDRGP4 $636
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $635
+JUMPV
+LABELV $632
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $633
+ADDRLP4 5
+ARGP4
+ADDRGP4 $636
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $635
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $632
+ADDRLP4 5
+ARGP4
+ADDRGP4 $637
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $638
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $639
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $639
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $641
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $642
+JUMPV
+LABELV $641
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 184
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 184
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $642
+LABELV $639
+ADDRLP4 172
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 109
+EQI4 $647
+ADDRLP4 172
+INDIRI4
+CNSTI4 77
+NEI4 $643
+LABELV $647
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $648
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $643
+LABELV $648
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $643
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $652
+JUMPV
+LABELV $651
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $657
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $658
+LABELV $657
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $659
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $658
+LABELV $659
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $654
+LABELV $658
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $660
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $660
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $661
+JUMPV
+LABELV $660
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 196
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $661
+LABELV $655
+LABELV $652
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $651
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $627
+endproc EasyClientName 200 12
+export BotSynonymContext
+proc BotSynonymContext 12 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRLP4 4
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $666
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $666
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $663
+LABELV $666
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $667
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $667
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $669
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $671
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $670
+JUMPV
+LABELV $671
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $673
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $675
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $676
+LABELV $673
+LABELV $670
+LABELV $664
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $662
+endproc BotSynonymContext 12 4
+export BotChooseWeapon
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $680
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $678
+LABELV $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRGP4 g_instantgib+12
+INDIRI4
+CNSTI4 0
+EQI4 $681
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRGP4 g_rockets+12
+INDIRI4
+CNSTI4 0
+EQI4 $684
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $685
+LABELV $682
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $679
+LABELV $677
+endproc BotChooseWeapon 20 8
+export BotSetupForMovement
+proc BotSetupForMovement 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 68
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $701
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $701
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $704
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $704
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $707
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $707
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $707
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $711
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $714
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $714
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $689
+endproc BotSetupForMovement 92 12
+export BotCheckItemPickup
+proc BotCheckItemPickup 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GTI4 $719
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 0
+NEI4 $719
+ADDRGP4 $718
+JUMPV
+LABELV $719
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $721
+ADDRFP4 0
+INDIRP4
+CNSTI4 5080
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $721
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $721
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $723
+ADDRFP4 0
+INDIRP4
+CNSTI4 5088
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $723
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $723
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5080
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $725
+ADDRFP4 0
+INDIRP4
+CNSTI4 5088
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $725
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $727
+ADDRFP4 0
+INDIRP4
+CNSTI4 5116
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $727
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $727
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $729
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $729
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $729
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $731
+ADDRFP4 0
+INDIRP4
+CNSTI4 5124
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $731
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $731
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $733
+ADDRFP4 0
+INDIRP4
+CNSTI4 5128
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $733
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $733
+LABELV $725
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $735
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $737
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $739
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $743
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $744
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $747
+ADDRLP4 24
+INDIRI4
+CNSTI4 13
+EQI4 $747
+ADDRLP4 24
+INDIRI4
+CNSTI4 12
+EQI4 $747
+ADDRLP4 32
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $750
+ADDRLP4 32
+INDIRI4
+CNSTI4 9
+NEI4 $749
+LABELV $750
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $747
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $747
+LABELV $749
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $751
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $747
+LABELV $751
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $743
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $747
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $744
+LABELV $742
+LABELV $739
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $738
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $752
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $754
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $756
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 24
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_spSkill+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $757
+ADDRLP4 28
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+EQI4 $761
+ADDRLP4 28
+INDIRI4
+CNSTI4 9
+NEI4 $760
+LABELV $761
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $757
+LABELV $760
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $762
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $757
+LABELV $762
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $756
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $757
+LABELV $755
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $752
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $738
+LABELV $735
+LABELV $718
+endproc BotCheckItemPickup 48 12
+export BotUpdateInventory
+proc BotUpdateInventory 1332 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $765
+ADDRLP4 1028
+CNSTI4 1
+ASGNI4
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+LABELV $766
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $768
+ADDRLP4 1036
+CNSTI4 1
+ASGNI4
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+LABELV $769
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $771
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $772
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $774
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+LABELV $775
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $777
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $778
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $780
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $781
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $783
+ADDRLP4 1076
+CNSTI4 1
+ASGNI4
+ADDRGP4 $784
+JUMPV
+LABELV $783
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+LABELV $784
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $786
+ADDRLP4 1084
+CNSTI4 1
+ASGNI4
+ADDRGP4 $787
+JUMPV
+LABELV $786
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+LABELV $787
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $789
+ADDRLP4 1092
+CNSTI4 1
+ASGNI4
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+LABELV $790
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $792
+ADDRLP4 1100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $793
+JUMPV
+LABELV $792
+ADDRLP4 1100
+CNSTI4 0
+ASGNI4
+LABELV $793
+ADDRFP4 0
+INDIRP4
+CNSTI4 5008
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $795
+ADDRLP4 1108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $796
+JUMPV
+LABELV $795
+ADDRLP4 1108
+CNSTI4 0
+ASGNI4
+LABELV $796
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $798
+ADDRLP4 1116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $799
+JUMPV
+LABELV $798
+ADDRLP4 1116
+CNSTI4 0
+ASGNI4
+LABELV $799
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $801
+ADDRLP4 1124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $802
+JUMPV
+LABELV $801
+ADDRLP4 1124
+CNSTI4 0
+ASGNI4
+LABELV $802
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5056
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5060
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5064
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $804
+ADDRLP4 1180
+CNSTI4 1
+ASGNI4
+ADDRGP4 $805
+JUMPV
+LABELV $804
+ADDRLP4 1180
+CNSTI4 0
+ASGNI4
+LABELV $805
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+ADDRLP4 1180
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $807
+ADDRLP4 1188
+CNSTI4 1
+ASGNI4
+ADDRGP4 $808
+JUMPV
+LABELV $807
+ADDRLP4 1188
+CNSTI4 0
+ASGNI4
+LABELV $808
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+ADDRLP4 1188
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 36
+NEI4 $810
+ADDRLP4 1196
+CNSTI4 1
+ASGNI4
+ADDRGP4 $811
+JUMPV
+LABELV $810
+ADDRLP4 1196
+CNSTI4 0
+ASGNI4
+LABELV $811
+ADDRFP4 0
+INDIRP4
+CNSTI4 5080
+ADDP4
+ADDRLP4 1196
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 37
+NEI4 $813
+ADDRLP4 1204
+CNSTI4 1
+ASGNI4
+ADDRGP4 $814
+JUMPV
+LABELV $813
+ADDRLP4 1204
+CNSTI4 0
+ASGNI4
+LABELV $814
+ADDRFP4 0
+INDIRP4
+CNSTI4 5084
+ADDP4
+ADDRLP4 1204
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 38
+NEI4 $816
+ADDRLP4 1212
+CNSTI4 1
+ASGNI4
+ADDRGP4 $817
+JUMPV
+LABELV $816
+ADDRLP4 1212
+CNSTI4 0
+ASGNI4
+LABELV $817
+ADDRFP4 0
+INDIRP4
+CNSTI4 5088
+ADDP4
+ADDRLP4 1212
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRLP4 1220
+CNSTI4 1
+ASGNI4
+ADDRGP4 $820
+JUMPV
+LABELV $819
+ADDRLP4 1220
+CNSTI4 0
+ASGNI4
+LABELV $820
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+ADDRLP4 1220
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $822
+ADDRLP4 1228
+CNSTI4 1
+ASGNI4
+ADDRGP4 $823
+JUMPV
+LABELV $822
+ADDRLP4 1228
+CNSTI4 0
+ASGNI4
+LABELV $823
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+ADDRLP4 1228
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $825
+ADDRLP4 1236
+CNSTI4 1
+ASGNI4
+ADDRGP4 $826
+JUMPV
+LABELV $825
+ADDRLP4 1236
+CNSTI4 0
+ASGNI4
+LABELV $826
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+ADDRLP4 1236
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $828
+ADDRLP4 1244
+CNSTI4 1
+ASGNI4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 1244
+CNSTI4 0
+ASGNI4
+LABELV $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+ADDRLP4 1244
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $831
+ADDRLP4 1252
+CNSTI4 1
+ASGNI4
+ADDRGP4 $832
+JUMPV
+LABELV $831
+ADDRLP4 1252
+CNSTI4 0
+ASGNI4
+LABELV $832
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+ADDRLP4 1252
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $834
+ADDRLP4 1260
+CNSTI4 1
+ASGNI4
+ADDRGP4 $835
+JUMPV
+LABELV $834
+ADDRLP4 1260
+CNSTI4 0
+ASGNI4
+LABELV $835
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 42
+NEI4 $837
+ADDRLP4 1268
+CNSTI4 1
+ASGNI4
+ADDRGP4 $838
+JUMPV
+LABELV $837
+ADDRLP4 1268
+CNSTI4 0
+ASGNI4
+LABELV $838
+ADDRFP4 0
+INDIRP4
+CNSTI4 5116
+ADDP4
+ADDRLP4 1268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 43
+NEI4 $840
+ADDRLP4 1276
+CNSTI4 1
+ASGNI4
+ADDRGP4 $841
+JUMPV
+LABELV $840
+ADDRLP4 1276
+CNSTI4 0
+ASGNI4
+LABELV $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 5120
+ADDP4
+ADDRLP4 1276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 44
+NEI4 $843
+ADDRLP4 1284
+CNSTI4 1
+ASGNI4
+ADDRGP4 $844
+JUMPV
+LABELV $843
+ADDRLP4 1284
+CNSTI4 0
+ASGNI4
+LABELV $844
+ADDRFP4 0
+INDIRP4
+CNSTI4 5124
+ADDP4
+ADDRLP4 1284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 45
+NEI4 $846
+ADDRLP4 1292
+CNSTI4 1
+ASGNI4
+ADDRGP4 $847
+JUMPV
+LABELV $846
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+LABELV $847
+ADDRFP4 0
+INDIRP4
+CNSTI4 5128
+ADDP4
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $849
+ADDRLP4 1300
+CNSTI4 1
+ASGNI4
+ADDRGP4 $850
+JUMPV
+LABELV $849
+ADDRLP4 1300
+CNSTI4 0
+ASGNI4
+LABELV $850
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+ADDRLP4 1300
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $852
+ADDRLP4 1308
+CNSTI4 1
+ASGNI4
+ADDRGP4 $853
+JUMPV
+LABELV $852
+ADDRLP4 1308
+CNSTI4 0
+ASGNI4
+LABELV $853
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $855
+ADDRLP4 1316
+CNSTI4 1
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $855
+ADDRLP4 1316
+CNSTI4 0
+ASGNI4
+LABELV $856
+ADDRFP4 0
+INDIRP4
+CNSTI4 5140
+ADDP4
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 1
+NEI4 $857
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $858
+JUMPV
+LABELV $857
+ADDRFP4 0
+INDIRP4
+CNSTI4 5144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5148
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $858
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $763
+endproc BotUpdateInventory 1332 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5756
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5752
+ADDP4
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $859
+endproc BotUpdateBattleInventory 160 8
+export BotUseKamikaze
+proc BotUseKamikaze 292 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5080
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $870
+ADDRGP4 $869
+JUMPV
+LABELV $870
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $872
+ADDRGP4 $869
+JUMPV
+LABELV $872
+ADDRFP4 0
+INDIRP4
+CNSTI4 6104
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRLP4 264
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 4
+EQI4 $876
+ADDRLP4 264
+INDIRI4
+CNSTI4 9
+NEI4 $874
+LABELV $876
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $877
+ADDRGP4 $869
+JUMPV
+LABELV $877
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $879
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1233125376
+GEF4 $888
+ADDRGP4 $869
+JUMPV
+LABELV $888
+LABELV $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $875
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 284
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 284
+INDIRF4
+CNSTF4 1233125376
+GEF4 $875
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $869
+JUMPV
+LABELV $874
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $901
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $903
+ADDRGP4 $869
+JUMPV
+LABELV $903
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $905
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1233125376
+GEF4 $914
+ADDRGP4 $869
+JUMPV
+LABELV $914
+LABELV $905
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $902
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 284
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 284
+INDIRF4
+CNSTF4 1233125376
+GEF4 $902
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $869
+JUMPV
+LABELV $901
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $927
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+EQI4 $932
+ADDRGP4 $929
+JUMPV
+LABELV $932
+ADDRLP4 176
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRLP4 176
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $930
+ADDRLP4 164
+ADDRLP4 176
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 164+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 164+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1229937705
+GEF4 $928
+ADDRLP4 180
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 288
+CNSTP4 0
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 180+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $944
+ADDRLP4 180+80
+INDIRI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $928
+LABELV $944
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $869
+JUMPV
+LABELV $927
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $945
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $947
+ADDRGP4 $869
+JUMPV
+LABELV $947
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $949
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 1233125376
+GEF4 $958
+ADDRGP4 $869
+JUMPV
+LABELV $958
+LABELV $949
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $960
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 284
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 284
+INDIRF4
+CNSTF4 1233125376
+GEF4 $969
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $869
+JUMPV
+LABELV $969
+LABELV $960
+LABELV $945
+LABELV $928
+LABELV $902
+LABELV $875
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 156
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 268
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 2
+LEI4 $971
+ADDRLP4 268
+INDIRI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $971
+LABELV $869
+endproc BotUseKamikaze 292 28
+export BotUseInvulnerability
+proc BotUseInvulnerability 152 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5088
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $974
+ADDRGP4 $973
+JUMPV
+LABELV $974
+ADDRFP4 0
+INDIRP4
+CNSTI4 6108
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $976
+ADDRGP4 $973
+JUMPV
+LABELV $976
+ADDRFP4 0
+INDIRP4
+CNSTI4 6108
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 4
+EQI4 $980
+ADDRLP4 116
+INDIRI4
+CNSTI4 9
+NEI4 $978
+LABELV $980
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $981
+ADDRGP4 $973
+JUMPV
+LABELV $981
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $983
+ADDRGP4 $973
+JUMPV
+LABELV $983
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+EQI4 $988
+ADDRGP4 $985
+JUMPV
+LABELV $988
+ADDRLP4 28
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $986
+JUMPV
+LABELV $985
+ADDRLP4 28
+ADDRGP4 ctf_redflag
+ASGNP4
+LABELV $986
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 140
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1193033728
+GEF4 $979
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1000
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $979
+LABELV $1000
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $973
+JUMPV
+LABELV $978
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $1003
+ADDRGP4 $973
+JUMPV
+LABELV $1003
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $1005
+ADDRGP4 $973
+JUMPV
+LABELV $1005
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+EQI4 $1010
+ADDRGP4 $1007
+JUMPV
+LABELV $1010
+ADDRLP4 28
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $1008
+JUMPV
+LABELV $1007
+ADDRLP4 28
+ADDRGP4 ctf_redflag
+ASGNP4
+LABELV $1008
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 140
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1193033728
+GEF4 $1002
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1022
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1002
+LABELV $1022
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $973
+JUMPV
+LABELV $1001
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1023
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 1
+EQI4 $1028
+ADDRGP4 $1025
+JUMPV
+LABELV $1028
+ADDRLP4 28
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRLP4 28
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1026
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 132
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1202702336
+GEF4 $1024
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 140
+CNSTP4 0
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1040
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1024
+LABELV $1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+ADDRGP4 $973
+JUMPV
+LABELV $1023
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1041
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $1043
+ADDRGP4 $973
+JUMPV
+LABELV $1043
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $1045
+ADDRGP4 $973
+JUMPV
+LABELV $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+EQI4 $1050
+ADDRGP4 $1047
+JUMPV
+LABELV $1050
+ADDRLP4 28
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1048
+JUMPV
+LABELV $1047
+ADDRLP4 28
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1048
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 140
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1193033728
+GEF4 $1056
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1062
+ADDRLP4 32+80
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1058
+LABELV $1062
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $1058
+LABELV $1056
+LABELV $1041
+LABELV $1024
+LABELV $1002
+LABELV $979
+LABELV $973
+endproc BotUseInvulnerability 152 28
+export BotBattleUseItems
+proc BotBattleUseItems 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1066
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1068
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $1068
+LABELV $1066
+LABELV $1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1070
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $1072
+LABELV $1070
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseKamikaze
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseInvulnerability
+CALLV
+pop
+LABELV $1063
+endproc BotBattleUseItems 12 4
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1075
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1075
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1074
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1079
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1079
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1080
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1077
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1082
+CNSTI4 1
+RETI4
+ADDRGP4 $1081
+JUMPV
+LABELV $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1086
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $1084
+CNSTI4 1
+RETI4
+ADDRGP4 $1081
+JUMPV
+LABELV $1084
+CNSTI4 0
+RETI4
+LABELV $1081
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9144
+INDIRI4
+CNSTI4 0
+EQI4 $1088
+CNSTI4 1
+RETI4
+ADDRGP4 $1087
+JUMPV
+LABELV $1088
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $1094
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $1092
+LABELV $1094
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1092
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1093
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1087
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $1095
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $1098
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1099
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $1098
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $1099
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1100
+CNSTI4 2
+ARGI4
+ADDRGP4 $1102
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1097
+JUMPV
+LABELV $1100
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1097
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1107
+JUMPV
+LABELV $1104
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1108
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1103
+JUMPV
+LABELV $1108
+LABELV $1105
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1107
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1104
+CNSTP4 0
+RETP4
+LABELV $1103
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1114
+JUMPV
+LABELV $1111
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1112
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1114
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1111
+LABELV $1110
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1116
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $1117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $1116
+LABELV $1115
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1123
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $1123
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1124
+JUMPV
+LABELV $1123
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1124
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1121
+endproc TeamPlayIsOn 4 0
+export BotAggression
+proc BotAggression 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1126
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1130
+ADDRFP4 0
+INDIRP4
+CNSTI4 5752
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1128
+LABELV $1130
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1128
+LABELV $1126
+ADDRFP4 0
+INDIRP4
+CNSTI4 5756
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $1131
+CNSTF4 0
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1131
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1133
+CNSTF4 0
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1133
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1137
+CNSTF4 0
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1137
+LABELV $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1139
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1141
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1143
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1145
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1147
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1147
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1147
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1149
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $1149
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1149
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $1151
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $1125
+JUMPV
+LABELV $1151
+CNSTF4 0
+RETF4
+LABELV $1125
+endproc BotAggression 28 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1154
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1153
+JUMPV
+LABELV $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1156
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1153
+JUMPV
+LABELV $1156
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1158
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1153
+JUMPV
+LABELV $1158
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1160
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1153
+JUMPV
+LABELV $1160
+CNSTF4 0
+RETF4
+LABELV $1153
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 152 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+EQI4 $1165
+ADDRLP4 140
+INDIRI4
+CNSTI4 9
+NEI4 $1163
+LABELV $1165
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1164
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1163
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1169
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1168
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1172
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1174
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1176
+ADDRLP4 144
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1176
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1176
+LABELV $1174
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1180
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1180
+CNSTI4 0
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1172
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1184
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1184
+LABELV $1182
+LABELV $1169
+LABELV $1164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1186
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1188
+CNSTI4 0
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1188
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1190
+CNSTI4 0
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1190
+LABELV $1186
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1192
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1194
+CNSTI4 1
+RETI4
+ADDRGP4 $1162
+JUMPV
+LABELV $1194
+CNSTI4 0
+RETI4
+LABELV $1162
+endproc BotWantsToRetreat 152 8
+export BotWantsToChase
+proc BotWantsToChase 152 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 4
+EQI4 $1199
+ADDRLP4 140
+INDIRI4
+CNSTI4 9
+NEI4 $1197
+LABELV $1199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+CNSTI4 0
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1200
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1198
+CNSTI4 1
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1197
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1204
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1206
+CNSTI4 0
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1206
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1205
+CNSTI4 1
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1204
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1210
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1211
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1211
+ADDRLP4 144
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1211
+CNSTI4 0
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1210
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1220
+CNSTI4 0
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1220
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $1222
+CNSTI4 1
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1222
+LABELV $1218
+LABELV $1211
+LABELV $1205
+LABELV $1198
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1224
+CNSTI4 0
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1226
+CNSTI4 1
+RETI4
+ADDRGP4 $1196
+JUMPV
+LABELV $1226
+CNSTI4 0
+RETI4
+LABELV $1196
+endproc BotWantsToChase 152 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $1228
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $1230
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1230
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1233
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1233
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $1235
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1235
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+EQI4 $1244
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 9
+EQI4 $1244
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 10
+NEI4 $1237
+LABELV $1244
+ADDRGP4 g_elimination_selfdamage+12
+INDIRI4
+CNSTI4 0
+NEI4 $1237
+CNSTI4 1
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1245
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1245
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1247
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 90
+GEI4 $1249
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1251
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1251
+LABELV $1249
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1253
+CNSTI4 0
+RETI4
+ADDRGP4 $1229
+JUMPV
+LABELV $1253
+CNSTI4 1
+RETI4
+LABELV $1229
+endproc BotCanAndWantsToRocketJump 8 16
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1256
+CNSTI4 0
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1256
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1258
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1260
+CNSTI4 0
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1260
+LABELV $1258
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1262
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1262
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1264
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1264
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1266
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1266
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1266
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1268
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 5056
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1270
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1270
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 5060
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1272
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1274
+ADDRFP4 0
+INDIRP4
+CNSTI4 5064
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1274
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1274
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1276
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1276
+CNSTI4 1
+RETI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1276
+CNSTI4 0
+RETI4
+LABELV $1255
+endproc BotHasPersistantPowerupAndWeapon 32 0
+export BotGoCamp
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $1279
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $1280
+JUMPV
+LABELV $1279
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1280
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1278
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 172 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1282
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1282
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $1292
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+NEI4 $1284
+LABELV $1292
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1284
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $1293
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1293
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $1295
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1297
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1297
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1301
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1299
+LABELV $1301
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1299
+LABELV $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1303
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $1299
+LABELV $1303
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1299
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $1307
+JUMPV
+LABELV $1304
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 164
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1309
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $1309
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1309
+LABELV $1305
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $1307
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1304
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $1311
+CNSTI4 0
+RETI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1281
+endproc BotWantsToCamp 172 16
+export BotDontAvoid
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $1315
+JUMPV
+LABELV $1314
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $1315
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1314
+LABELV $1313
+endproc BotDontAvoid 68 12
+export BotGoForPowerups
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1319
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1320
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1321
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1322
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1323
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1318
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $1325
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1329
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1331
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1332
+JUMPV
+LABELV $1331
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1332
+LABELV $1329
+ADDRLP4 112
+INDIRF4
+CNSTF4 1061158912
+GEF4 $1333
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1335
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1336
+JUMPV
+LABELV $1335
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1336
+LABELV $1333
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1128792064
+LEF4 $1347
+ADDRLP4 164
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $1364
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1370
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $1324
+JUMPV
+LABELV $1370
+LABELV $1364
+LABELV $1347
+LABELV $1326
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 10
+LTI4 $1325
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1324
+endproc BotRoamGoal 180 28
+lit
+align 4
+LABELV $1374
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 400 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $1374
+INDIRB
+ASGNB 12
+ADDRLP4 332
+ADDRFP4 4
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6124
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1375
+ADDRLP4 136+40
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 136+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1372
+JUMPV
+LABELV $1375
+ADDRLP4 80
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 356
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1389
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1372
+JUMPV
+LABELV $1389
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 192+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 192+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 192+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 368
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1402
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 340
+INDIRF4
+GEF4 $1404
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1405
+JUMPV
+LABELV $1404
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1406
+ADDRLP4 376
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 344
+INDIRF4
+GEF4 $1406
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 344
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1406
+LABELV $1405
+LABELV $1402
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1408
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $1408
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $1410
+ADDRFP4 4
+INDIRP4
+CNSTI4 6128
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1412
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1413
+JUMPV
+LABELV $1412
+ADDRFP4 4
+INDIRP4
+CNSTI4 6128
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1413
+LABELV $1410
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1414
+ADDRLP4 372
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $1415
+JUMPV
+LABELV $1414
+ADDRLP4 72
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 76
+CNSTF4 1109393408
+ASGNF4
+LABELV $1415
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $1416
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $1418
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $1420
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1372
+JUMPV
+LABELV $1420
+LABELV $1418
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $1422
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $1424
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1372
+JUMPV
+LABELV $1424
+LABELV $1422
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1372
+JUMPV
+LABELV $1416
+ADDRLP4 376
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $1426
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 336
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1426
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+LEF4 $1428
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $1430
+ADDRLP4 392
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1430
+LABELV $1428
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $1432
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1439
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $1439
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $1445
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1446
+JUMPV
+LABELV $1445
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $1453
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $1461
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1461
+LABELV $1454
+LABELV $1446
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $1469
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1372
+JUMPV
+LABELV $1469
+ADDRLP4 396
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ADDRLP4 396
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1433
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $1432
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+LABELV $1372
+endproc BotAttackMove 400 16
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1474
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1472
+LABELV $1474
+CNSTI4 0
+RETI4
+ADDRGP4 $1471
+JUMPV
+LABELV $1472
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1477
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1475
+LABELV $1477
+CNSTI4 0
+RETI4
+ADDRGP4 $1471
+JUMPV
+LABELV $1475
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1478
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+EQI4 $1478
+ADDRLP4 8
+CNSTI4 2140
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1024
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1480
+CNSTI4 1
+RETI4
+ADDRGP4 $1471
+JUMPV
+LABELV $1480
+LABELV $1478
+CNSTI4 0
+RETI4
+LABELV $1471
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1483
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $1487
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1488
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $1488
+JUMPV
+LABELV $1487
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $1491
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1491
+LABELV $1488
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $1493
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $1494
+CNSTI4 0
+RETI4
+ADDRGP4 $1482
+JUMPV
+LABELV $1493
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $1497
+CNSTI4 0
+RETI4
+ADDRGP4 $1482
+JUMPV
+LABELV $1497
+LABELV $1494
+LABELV $1484
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $1483
+CNSTI4 1
+RETI4
+LABELV $1482
+endproc InFieldOfVision 32 4
+export BotEntityVisible
+proc BotEntityVisible 380 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 148+72
+INDIRF4
+ADDRLP4 148+84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 148+72+4
+INDIRF4
+ADDRLP4 148+84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 148+72+8
+INDIRF4
+ADDRLP4 148+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 84
+ADDRLP4 332
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 1056964608
+ADDRLP4 84+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 148+24
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 148+24+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 148+24+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 84
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 320
+ARGP4
+ADDRLP4 340
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1529
+CNSTF4 0
+RETF4
+ADDRGP4 $1499
+JUMPV
+LABELV $1529
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 316
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 316
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 296
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $1531
+ADDRLP4 96
+CNSTI4 65537
+ASGNI4
+ADDRLP4 116
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1535
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $1535
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1537
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1539
+ADDRLP4 116
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1539
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $1537
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 356
+CNSTP4 0
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1541
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 -57
+BANDI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 360
+CNSTP4 0
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+LABELV $1544
+LABELV $1541
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1551
+ADDRLP4 0+80
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $1547
+LABELV $1551
+ADDRLP4 84
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 360
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 364
+CNSTI4 0
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRLP4 364
+INDIRI4
+EQI4 $1552
+ADDRLP4 304
+INDIRI4
+ADDRLP4 364
+INDIRI4
+EQI4 $1552
+ADDRLP4 136
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $1553
+JUMPV
+LABELV $1552
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1561
+ADDRLP4 120
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 368
+CNSTP4 0
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRGP4 $1562
+JUMPV
+LABELV $1561
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1571
+ADDRLP4 104
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 368
+CNSTP4 0
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 136
+ADDRLP4 104
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 104+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 104+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $1572
+JUMPV
+LABELV $1571
+ADDRLP4 300
+CNSTF4 0
+ASGNF4
+LABELV $1572
+LABELV $1562
+LABELV $1553
+ADDRLP4 372
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+GEF4 $1584
+ADDRLP4 368
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1585
+JUMPV
+LABELV $1584
+ADDRLP4 368
+CNSTF4 981668463
+ADDRLP4 300
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1585
+ADDRLP4 292
+ADDRLP4 372
+INDIRF4
+ADDRLP4 368
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 292
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LEF4 $1586
+ADDRLP4 296
+ADDRLP4 292
+INDIRF4
+ASGNF4
+LABELV $1586
+ADDRLP4 296
+INDIRF4
+CNSTF4 1064514355
+LTF4 $1588
+ADDRLP4 296
+INDIRF4
+RETF4
+ADDRGP4 $1499
+JUMPV
+LABELV $1588
+LABELV $1547
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $1590
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 148+72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1591
+JUMPV
+LABELV $1590
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $1595
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 148+84+8
+INDIRF4
+ADDRLP4 148+72+8
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $1595
+LABELV $1591
+LABELV $1532
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 3
+LTI4 $1531
+ADDRLP4 296
+INDIRF4
+RETF4
+LABELV $1499
+endproc BotEntityVisible 380 28
+export BotFindEnemy
+proc BotFindEnemy 468 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 336
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $1604
+ADDRLP4 344
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1605
+JUMPV
+LABELV $1604
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+LABELV $1605
+ADDRLP4 160
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1606
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1608
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1608
+ADDRLP4 144
+ADDRLP4 196+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 196+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 196+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 364
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRGP4 $1607
+JUMPV
+LABELV $1606
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+LABELV $1607
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1617
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 456
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 1
+NEI4 $1619
+ADDRLP4 356
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1620
+JUMPV
+LABELV $1619
+ADDRLP4 356
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1620
+ADDRLP4 360
+ADDRLP4 356
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 360+8
+ADDRLP4 360+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 372
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 464
+CNSTP4 0
+ASGNP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRLP4 464
+INDIRP4
+ARGP4
+ADDRLP4 360
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 372+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1626
+ADDRLP4 372+80
+INDIRI4
+ADDRLP4 356
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1622
+LABELV $1626
+ADDRLP4 356
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+NEI4 $1627
+CNSTI4 0
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1627
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+ADDRLP4 356
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1622
+LABELV $1617
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1632
+JUMPV
+LABELV $1629
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1633
+ADDRGP4 $1630
+JUMPV
+LABELV $1633
+ADDRLP4 140
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1635
+ADDRGP4 $1630
+JUMPV
+LABELV $1635
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1637
+ADDRGP4 $1630
+JUMPV
+LABELV $1637
+ADDRLP4 0
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $1642
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1639
+LABELV $1642
+ADDRGP4 $1630
+JUMPV
+LABELV $1639
+ADDRLP4 0
+ARGP4
+ADDRLP4 360
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1643
+ADDRLP4 0
+ARGP4
+ADDRLP4 364
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $1643
+ADDRGP4 $1630
+JUMPV
+LABELV $1643
+CNSTI4 816
+ADDRLP4 140
+INDIRI4
+MULI4
+ADDRGP4 g_entities+536
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1645
+ADDRGP4 $1630
+JUMPV
+LABELV $1645
+ADDRLP4 176
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1648
+ADDRLP4 0
+ARGP4
+ADDRLP4 368
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $1648
+ADDRGP4 $1630
+JUMPV
+LABELV $1648
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $1650
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1167663104
+GEF4 $1661
+ADDRGP4 $1630
+JUMPV
+LABELV $1661
+LABELV $1650
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 380
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $1670
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1672
+ADDRLP4 156
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LEF4 $1672
+ADDRGP4 $1630
+JUMPV
+LABELV $1672
+LABELV $1670
+ADDRLP4 384
+CNSTF4 1165623296
+ADDRLP4 164
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 384
+INDIRF4
+MULF4
+LEF4 $1674
+ADDRGP4 $1630
+JUMPV
+LABELV $1674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $1676
+ADDRGP4 $1630
+JUMPV
+LABELV $1676
+ADDRLP4 392
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 392
+INDIRI4
+GEI4 $1678
+ADDRLP4 160
+INDIRI4
+ADDRLP4 392
+INDIRI4
+NEI4 $1680
+ADDRLP4 0
+ARGP4
+ADDRLP4 396
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $1678
+LABELV $1680
+ADDRLP4 168
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1679
+JUMPV
+LABELV $1678
+ADDRLP4 156
+INDIRF4
+CNSTF4 1226845760
+LEF4 $1682
+ADDRLP4 400
+CNSTF4 1226845760
+ASGNF4
+ADDRGP4 $1683
+JUMPV
+LABELV $1682
+ADDRLP4 400
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $1683
+ADDRLP4 168
+CNSTF4 1127481344
+CNSTF4 1119092736
+ADDRLP4 400
+INDIRF4
+CNSTF4 1172557824
+DIVF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $1679
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 0
+GTF4 $1684
+ADDRGP4 $1630
+JUMPV
+LABELV $1684
+ADDRLP4 412
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 412
+INDIRI4
+GEI4 $1686
+ADDRLP4 156
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1686
+ADDRLP4 160
+INDIRI4
+ADDRLP4 412
+INDIRI4
+NEI4 $1686
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $1686
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+36
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $1695
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 428
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $1698
+ADDRGP4 $1630
+JUMPV
+LABELV $1698
+LABELV $1695
+LABELV $1686
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+ADDRLP4 0+20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1701
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1702
+JUMPV
+LABELV $1701
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1702
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1602
+JUMPV
+LABELV $1630
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1632
+ADDRLP4 140
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1703
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $1629
+LABELV $1703
+CNSTI4 0
+RETI4
+LABELV $1602
+endproc BotFindEnemy 468 28
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1708
+JUMPV
+LABELV $1705
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1709
+ADDRGP4 $1706
+JUMPV
+LABELV $1709
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1711
+ADDRGP4 $1706
+JUMPV
+LABELV $1711
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1713
+ADDRGP4 $1706
+JUMPV
+LABELV $1713
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1715
+ADDRGP4 $1706
+JUMPV
+LABELV $1715
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1717
+ADDRGP4 $1706
+JUMPV
+LABELV $1717
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1704
+JUMPV
+LABELV $1706
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1708
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1719
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1705
+LABELV $1719
+CNSTI4 -1
+RETI4
+LABELV $1704
+endproc BotTeamFlagCarrierVisible 164 20
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 152 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1724
+JUMPV
+LABELV $1721
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1725
+ADDRGP4 $1722
+JUMPV
+LABELV $1725
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1727
+ADDRGP4 $1722
+JUMPV
+LABELV $1727
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $1729
+ADDRGP4 $1722
+JUMPV
+LABELV $1729
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1731
+ADDRGP4 $1722
+JUMPV
+LABELV $1731
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1720
+JUMPV
+LABELV $1722
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1724
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1733
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1721
+LABELV $1733
+CNSTI4 -1
+RETI4
+LABELV $1720
+endproc BotTeamFlagCarrier 152 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1738
+JUMPV
+LABELV $1735
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1739
+ADDRGP4 $1736
+JUMPV
+LABELV $1739
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1741
+ADDRGP4 $1736
+JUMPV
+LABELV $1741
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1743
+ADDRGP4 $1736
+JUMPV
+LABELV $1743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1745
+ADDRGP4 $1736
+JUMPV
+LABELV $1745
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1747
+ADDRGP4 $1736
+JUMPV
+LABELV $1747
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1734
+JUMPV
+LABELV $1736
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1738
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1749
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1735
+LABELV $1749
+CNSTI4 -1
+RETI4
+LABELV $1734
+endproc BotEnemyFlagCarrierVisible 164 20
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1751
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1751
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1753
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1753
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1758
+JUMPV
+LABELV $1755
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1759
+ADDRGP4 $1756
+JUMPV
+LABELV $1759
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1761
+ADDRGP4 $1756
+JUMPV
+LABELV $1761
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $1763
+ADDRGP4 $1756
+JUMPV
+LABELV $1763
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1772
+ADDRGP4 $1756
+JUMPV
+LABELV $1772
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1774
+ADDRGP4 $1756
+JUMPV
+LABELV $1774
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1776
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1777
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1776
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1780
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1780
+LABELV $1777
+LABELV $1756
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1758
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1782
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1755
+LABELV $1782
+LABELV $1750
+endproc BotVisibleTeamMatesAndEnemies 192 20
+export BotTeamCubeCarrierVisible
+proc BotTeamCubeCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1787
+JUMPV
+LABELV $1784
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1788
+ADDRGP4 $1785
+JUMPV
+LABELV $1788
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1790
+ADDRGP4 $1785
+JUMPV
+LABELV $1790
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1792
+ADDRGP4 $1785
+JUMPV
+LABELV $1792
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1794
+ADDRGP4 $1785
+JUMPV
+LABELV $1794
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1796
+ADDRGP4 $1785
+JUMPV
+LABELV $1796
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1783
+JUMPV
+LABELV $1785
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1787
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1798
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1784
+LABELV $1798
+CNSTI4 -1
+RETI4
+LABELV $1783
+endproc BotTeamCubeCarrierVisible 164 20
+export BotEnemyCubeCarrierVisible
+proc BotEnemyCubeCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1803
+JUMPV
+LABELV $1800
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1804
+ADDRGP4 $1801
+JUMPV
+LABELV $1804
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1806
+ADDRGP4 $1801
+JUMPV
+LABELV $1806
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1808
+ADDRGP4 $1801
+JUMPV
+LABELV $1808
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1810
+ADDRGP4 $1801
+JUMPV
+LABELV $1810
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1812
+ADDRGP4 $1801
+JUMPV
+LABELV $1812
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1799
+JUMPV
+LABELV $1801
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1803
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1814
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1800
+LABELV $1814
+CNSTI4 -1
+RETI4
+LABELV $1799
+endproc BotEnemyCubeCarrierVisible 164 20
+lit
+align 4
+LABELV $1816
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1817
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1148 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 860
+ADDRGP4 $1816
+INDIRB
+ASGNB 12
+ADDRLP4 872
+ADDRGP4 $1817
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1818
+ADDRGP4 $1815
+JUMPV
+LABELV $1818
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1820
+ADDRLP4 824
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 984
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1827
+ADDRLP4 984
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1823
+LABELV $1827
+ADDRLP4 824+8
+ADDRLP4 824+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+LABELV $1823
+ADDRLP4 140
+ADDRLP4 824
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 824+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 824+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 824
+INDIRB
+ASGNB 12
+ADDRGP4 $1815
+JUMPV
+LABELV $1820
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 984
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 988
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1833
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 992
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 856
+CNSTF4 1056964608
+ADDRLP4 992
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1835
+ADDRGP4 $1815
+JUMPV
+LABELV $1835
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1837
+ADDRGP4 $1815
+JUMPV
+LABELV $1837
+LABELV $1833
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+NEI4 $1839
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1840
+JUMPV
+LABELV $1839
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+NEI4 $1842
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1843
+JUMPV
+LABELV $1842
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1845
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1846
+JUMPV
+LABELV $1845
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+NEI4 $1848
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1849
+JUMPV
+LABELV $1848
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+NEI4 $1851
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1852
+JUMPV
+LABELV $1851
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $1854
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1855
+JUMPV
+LABELV $1854
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 8
+NEI4 $1857
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1858
+JUMPV
+LABELV $1857
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+NEI4 $1860
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+LABELV $1860
+LABELV $1858
+LABELV $1855
+LABELV $1852
+LABELV $1849
+LABELV $1846
+LABELV $1843
+LABELV $1840
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1863
+ADDRLP4 156
+CNSTF4 953267991
+ASGNF4
+LABELV $1863
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 996
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+EQI4 $1865
+ADDRLP4 1000
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $1867
+ADDRLP4 156
+CNSTF4 1053609165
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1867
+LABELV $1865
+ADDRLP4 712
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1000
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1888
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+LABELV $1888
+ADDRLP4 736
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1891
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6252
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1008
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1008
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1900
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRF4
+ADDRLP4 712+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRF4
+ADDRLP4 712+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1902
+ADDRLP4 156
+CNSTF4 1060320051
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1902
+LABELV $1900
+LABELV $1891
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 836
+ADDRLP4 1008
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+EQI4 $1906
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 844
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRLP4 160+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 860
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1914
+ADDRLP4 740+80
+INDIRI4
+ADDRLP4 0+20
+INDIRI4
+EQI4 $1914
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1914
+ADDRLP4 160+272
+INDIRF4
+CNSTF4 0
+EQF4 $1920
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1020
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1020
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6252
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1936
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1934
+LABELV $1936
+ADDRLP4 736
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1937
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1937
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1132
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1132
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 1032+8
+ADDRLP4 1032+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1140
+CNSTF4 0
+ASGNF4
+ADDRLP4 968+8
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968+4
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1144
+CNSTI4 0
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 968
+ARGP4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 840
+INDIRF4
+MULF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 724
+ADDRLP4 1044
+INDIRB
+ASGNB 12
+ADDRGP4 $1938
+JUMPV
+LABELV $1937
+ADDRLP4 736
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1970
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1036
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1040
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 980
+ADDRLP4 1040
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 840
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 980
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1970
+LABELV $1938
+LABELV $1934
+LABELV $1920
+ADDRLP4 736
+INDIRF4
+CNSTF4 1058642330
+LEF4 $2005
+ADDRLP4 160+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2005
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $2009
+ADDRLP4 956
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 956+8
+ADDRLP4 956+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 956
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 944
+ADDRLP4 724
+INDIRB
+ASGNB 12
+ADDRLP4 740+4
+INDIRI4
+CNSTI4 0
+EQI4 $2017
+ADDRLP4 944+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $2018
+JUMPV
+LABELV $2017
+ADDRLP4 944+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $2018
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 1020
+CNSTP4 0
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 944
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 1024
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1112014848
+GEF4 $2026
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 944
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 944+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1163984896
+GEF4 $2040
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 844
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 844+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 844+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1032
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1032
+INDIRF4
+CNSTF4 1176256512
+LEF4 $2051
+ADDRLP4 740+12+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 740+12
+ARGP4
+ADDRLP4 1036
+CNSTP4 0
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2058
+ADDRLP4 724
+ADDRLP4 944
+INDIRB
+ASGNB 12
+LABELV $2058
+LABELV $2051
+LABELV $2040
+LABELV $2026
+LABELV $2009
+LABELV $2005
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724
+ADDRLP4 724
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+4
+ADDRLP4 724+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1020
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 1024
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1907
+JUMPV
+LABELV $1906
+ADDRLP4 724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1056964608
+LEF4 $2064
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+EQI4 $2072
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+EQI4 $2072
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $2066
+LABELV $2072
+ADDRLP4 884+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 884+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 824
+ARGP4
+ADDRLP4 1016
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 1016
+INDIRI4
+CNSTI4 0
+EQI4 $2085
+ADDRLP4 140
+ADDRLP4 824
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 824+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 824+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1024
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1170735104
+LEF4 $2091
+ADDRLP4 724
+ADDRLP4 824
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $2091
+LABELV $2085
+ADDRLP4 156
+CNSTF4 1065353216
+ASGNF4
+LABELV $2066
+LABELV $2064
+LABELV $1907
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+EQI4 $2094
+ADDRLP4 740
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 740+12
+INDIRB
+ASGNB 12
+ADDRGP4 $2095
+JUMPV
+LABELV $2094
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 724
+INDIRB
+ASGNB 12
+LABELV $2095
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+EQI4 $2109
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+EQI4 $2109
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+EQI4 $2109
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $2101
+LABELV $2109
+ADDRLP4 140
+ARGP4
+ADDRLP4 1016
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1016
+INDIRF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+LEF4 $2110
+ADDRLP4 840
+CNSTF4 1125515264
+ASGNF4
+LABELV $2110
+ADDRLP4 940
+CNSTF4 1053609165
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 940
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2101
+ADDRLP4 156
+INDIRF4
+CNSTF4 1061997773
+GEF4 $2112
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $2114
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 140
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2115
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 3
+LTI4 $2114
+LABELV $2112
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1028
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRP4
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1036
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1032
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1044
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $2120
+ADDRLP4 156
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2123
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $2123
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $2125
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $2125
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $2123
+LABELV $2120
+LABELV $1815
+endproc BotAimAtEnemy 1148 52
+lit
+align 4
+LABELV $2128
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $2129
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 1032 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 948
+ADDRGP4 $2128
+INDIRB
+ASGNB 12
+ADDRLP4 960
+ADDRGP4 $2129
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 788
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $2130
+ADDRLP4 788+20
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2138
+ADDRLP4 788+20
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2132
+LABELV $2138
+ADDRLP4 976
+CNSTI4 816
+ASGNI4
+ADDRLP4 976
+INDIRI4
+ADDRLP4 788+20
+INDIRI4
+MULI4
+ADDRGP4 g_entities+772
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2139
+ADDRLP4 976
+INDIRI4
+ADDRLP4 788+20
+INDIRI4
+MULI4
+ADDRGP4 g_entities+772
+ADDP4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2139
+ADDRGP4 $2127
+JUMPV
+LABELV $2139
+LABELV $2132
+LABELV $2130
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 976
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 700
+ADDRLP4 976
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $2145
+ADDRGP4 $2127
+JUMPV
+LABELV $2145
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $2147
+ADDRGP4 $2127
+JUMPV
+LABELV $2147
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $2149
+ADDRGP4 $2127
+JUMPV
+LABELV $2149
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $2151
+ADDRGP4 $2127
+JUMPV
+LABELV $2151
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 932
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2153
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 932
+INDIRF4
+LEF4 $2155
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 932
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2156
+JUMPV
+LABELV $2155
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 932
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2156
+LABELV $2153
+ADDRLP4 580
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2159
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1163984896
+LEF4 $2161
+ADDRGP4 $2127
+JUMPV
+LABELV $2161
+LABELV $2159
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1176256512
+GEF4 $2163
+ADDRLP4 928
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $2164
+JUMPV
+LABELV $2163
+ADDRLP4 928
+CNSTF4 1112014848
+ASGNF4
+LABELV $2164
+ADDRLP4 580
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRLP4 928
+INDIRF4
+ARGF4
+ADDRLP4 936
+ARGP4
+ADDRLP4 996
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+NEI4 $2165
+ADDRGP4 $2127
+JUMPV
+LABELV $2165
+ADDRLP4 704
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1004
+CNSTP4 0
+ASGNP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 704+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2167
+ADDRLP4 704+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $2167
+ADDRGP4 $2127
+JUMPV
+LABELV $2167
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 676
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 1016
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 688
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ARGP4
+ADDRLP4 960
+ARGP4
+ADDRLP4 688
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 0
+LTI4 $2201
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 64
+GEI4 $2201
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $2205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592+80
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+EQI4 $2208
+ADDRGP4 $2127
+JUMPV
+LABELV $2208
+LABELV $2205
+LABELV $2201
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2214
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $2211
+LABELV $2214
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2215
+CNSTF4 1148846080
+ADDRLP4 592+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $2219
+ADDRLP4 1028
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 972
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 592+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 972
+INDIRF4
+CNSTF4 0
+LEF4 $2227
+ADDRGP4 $2127
+JUMPV
+LABELV $2227
+LABELV $2219
+LABELV $2215
+LABELV $2211
+ADDRLP4 24+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2229
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2230
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $2230
+JUMPV
+LABELV $2229
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $2230
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $2127
+endproc BotCheckAttack 1032 28
+lit
+align 4
+LABELV $2240
+byte 4 1143930880
+byte 4 1129054208
+byte 4 1143472128
+align 4
+LABELV $2241
+byte 4 1148256256
+byte 4 1139408896
+byte 4 1143603200
+align 4
+LABELV $2242
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 1428 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 $2235
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTI4 127
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 144+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 144
+ARGP4
+ADDRGP4 $2239
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $2237
+ADDRLP4 1324
+ADDRGP4 $2240
+INDIRB
+ASGNB 12
+ADDRLP4 1336
+ADDRGP4 $2241
+INDIRB
+ASGNB 12
+ADDRLP4 1348
+ADDRGP4 $2242
+INDIRB
+ASGNB 12
+ADDRLP4 1360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+ADDRLP4 1360
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1324
+INDIRF4
+LEF4 $2243
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1336
+INDIRF4
+GEF4 $2243
+ADDRLP4 1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1324+4
+INDIRF4
+LEF4 $2245
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1336+4
+INDIRF4
+GEF4 $2245
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 1324+8
+INDIRF4
+GEF4 $2249
+ADDRGP4 $2234
+JUMPV
+LABELV $2249
+LABELV $2245
+LABELV $2243
+ADDRLP4 1368
+CNSTI4 0
+ASGNI4
+ADDRLP4 1296
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRGP4 $2255
+JUMPV
+LABELV $2252
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2256
+ADDRGP4 $2253
+JUMPV
+LABELV $2256
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2258
+ADDRGP4 $2253
+JUMPV
+LABELV $2258
+ADDRLP4 0
+ARGP4
+ADDRLP4 1372
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $2263
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2260
+LABELV $2263
+ADDRGP4 $2253
+JUMPV
+LABELV $2260
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1324
+INDIRF4
+LEF4 $2264
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1336
+INDIRF4
+GEF4 $2264
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1324+4
+INDIRF4
+LEF4 $2268
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1336+4
+INDIRF4
+GEF4 $2268
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1324+8
+INDIRF4
+GEF4 $2276
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+EQI4 $2281
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2254
+JUMPV
+LABELV $2281
+ADDRLP4 1296
+CNSTI4 1
+ASGNI4
+LABELV $2276
+LABELV $2268
+LABELV $2264
+LABELV $2253
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2255
+ADDRLP4 140
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $2283
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $2252
+LABELV $2283
+LABELV $2254
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $2238
+ADDRLP4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ADDRLP4 1376
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1348
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+4
+ADDRLP4 1348+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+8
+ADDRLP4 1348+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1384
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1312
+ADDRLP4 1384
+INDIRF4
+ASGNF4
+ADDRLP4 1388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1392
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1396
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1396
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1400
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1396
+INDIRP4
+ADDRLP4 1400
+INDIRF4
+ASGNF4
+ADDRLP4 1404
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+ADDRLP4 1408
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1404
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1412
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1412
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1416
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1412
+INDIRP4
+ADDRLP4 1416
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRLP4 1424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1424
+INDIRI4
+CNSTI4 0
+EQI4 $2238
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $2238
+JUMPV
+LABELV $2237
+ADDRLP4 144
+ARGP4
+ADDRGP4 $2294
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $2292
+ADDRLP4 1328
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ADDRLP4 1328
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+LABELV $2292
+LABELV $2238
+LABELV $2234
+endproc BotMapScripts 1428 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2296
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $2297
+JUMPV
+LABELV $2296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2298
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $2299
+JUMPV
+LABELV $2298
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2299
+LABELV $2297
+LABELV $2295
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2304
+JUMPV
+LABELV $2301
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2306
+ADDRGP4 $2302
+JUMPV
+LABELV $2306
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2308
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2308
+ADDRGP4 $2302
+JUMPV
+LABELV $2308
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2310
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $2310
+ADDRGP4 $2302
+JUMPV
+LABELV $2310
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2312
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2314
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2314
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2316
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2316
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2300
+JUMPV
+LABELV $2312
+LABELV $2302
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $2304
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2301
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2318
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $2318
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2320
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $2320
+CNSTI4 0
+RETI4
+LABELV $2300
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $2323
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $2324
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 648 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ADDRGP4 $2323
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRGP4 $2324
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 564
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 160
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 160
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2325
+CNSTI4 0
+RETI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2325
+ADDRLP4 160+1
+ARGP4
+ADDRLP4 568
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $2328
+CNSTI4 0
+RETI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2328
+ADDRLP4 572
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 576
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2332
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 328
+INDIRF4
+CNSTF4 0
+NEF4 $2333
+ADDRLP4 328
+CNSTF4 1082130432
+ASGNF4
+LABELV $2333
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2335
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 112
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 584
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2358
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $2359
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 600
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 604
+CNSTP4 0
+ASGNP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2371
+ADDRLP4 356+80
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $2367
+LABELV $2371
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2367
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2372
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2376
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2377
+JUMPV
+LABELV $2376
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2377
+LABELV $2373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2372
+ADDRLP4 608
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2389
+JUMPV
+LABELV $2386
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 0
+EQI4 $2390
+ADDRGP4 $2388
+JUMPV
+LABELV $2390
+LABELV $2387
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2389
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2386
+LABELV $2388
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2392
+LABELV $2392
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2394
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2396
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2400
+ADDRLP4 616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 628
+ADDRLP4 616
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 628
+INDIRP4
+INDIRF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2401
+JUMPV
+LABELV $2400
+ADDRLP4 632
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 636
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 640
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 644
+ADDRLP4 632
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2401
+LABELV $2397
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2396
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2394
+CNSTI4 0
+RETI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2359
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2402
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2406
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2407
+JUMPV
+LABELV $2406
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2407
+LABELV $2403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2402
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2419
+JUMPV
+LABELV $2416
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+EQI4 $2420
+ADDRGP4 $2418
+JUMPV
+LABELV $2420
+LABELV $2417
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2419
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $2416
+LABELV $2418
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $2422
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2432
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2436
+ADDRLP4 604
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 616
+ADDRLP4 604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2437
+JUMPV
+LABELV $2436
+ADDRLP4 620
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 628
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 632
+ADDRLP4 620
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 632
+INDIRP4
+ADDRLP4 632
+INDIRP4
+INDIRF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2437
+LABELV $2433
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2432
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2322
+JUMPV
+LABELV $2422
+CNSTI4 0
+RETI4
+LABELV $2322
+endproc BotFuncButtonActivateGoal 648 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1096 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2439
+CNSTI4 0
+RETI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2439
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2442
+CNSTI4 0
+RETI4
+ADDRGP4 $2438
+JUMPV
+LABELV $2442
+ADDRLP4 1084
+CNSTF4 0
+ASGNF4
+ADDRLP4 1064+8
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064+4
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1088
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1092
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2438
+endproc BotFuncDoorActivateGoal 1096 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 300 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2457
+CNSTI4 0
+RETI4
+ADDRGP4 $2456
+JUMPV
+LABELV $2457
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $2460
+CNSTI4 0
+RETI4
+ADDRGP4 $2456
+JUMPV
+LABELV $2460
+ADDRLP4 280
+CNSTF4 0
+ASGNF4
+ADDRLP4 240+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2479
+JUMPV
+LABELV $2476
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $2480
+ADDRGP4 $2478
+JUMPV
+LABELV $2480
+LABELV $2477
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2479
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $2476
+LABELV $2478
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $2482
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2456
+JUMPV
+LABELV $2482
+CNSTI4 0
+RETI4
+LABELV $2456
+endproc BotTriggerMultipleActivateGoal 300 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2493
+CNSTI4 0
+RETI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2493
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2492
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2496
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2500
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $2502
+ADDRLP4 4
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2502
+LABELV $2500
+LABELV $2497
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $2496
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $2504
+ADDRLP4 12
+CNSTI4 244
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 240
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $2495
+JUMPV
+LABELV $2504
+CNSTI4 0
+RETI4
+LABELV $2495
+endproc BotPushOntoActivateGoalStack 24 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2508
+JUMPV
+LABELV $2507
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $2508
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2507
+LABELV $2506
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2514
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2515
+JUMPV
+LABELV $2514
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2515
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2511
+ADDRGP4 $2510
+JUMPV
+LABELV $2511
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2516
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $2517
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2519
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $2516
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2521
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2522
+JUMPV
+LABELV $2521
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2522
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $2510
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2527
+JUMPV
+LABELV $2524
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2528
+ADDRGP4 $2525
+JUMPV
+LABELV $2528
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2530
+CNSTI4 1
+RETI4
+ADDRGP4 $2523
+JUMPV
+LABELV $2530
+LABELV $2525
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2527
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2524
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2532
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2536
+ADDRGP4 $2533
+JUMPV
+LABELV $2536
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2538
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $2540
+CNSTI4 1
+RETI4
+ADDRGP4 $2523
+JUMPV
+LABELV $2540
+LABELV $2538
+LABELV $2533
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $2532
+CNSTI4 0
+RETI4
+LABELV $2523
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3320 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 244
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3052
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2543
+ARGP4
+ADDRLP4 3052+104
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRGP4 $2548
+JUMPV
+LABELV $2545
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2549
+ADDRGP4 $2546
+JUMPV
+LABELV $2549
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2551
+ADDRGP4 $2547
+JUMPV
+LABELV $2551
+LABELV $2546
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+LABELV $2548
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2545
+LABELV $2547
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2553
+CNSTI4 3
+ARGI4
+ADDRGP4 $2555
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2553
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2556
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2557
+CNSTI4 3
+ARGI4
+ADDRGP4 $2559
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2557
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2562
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2560
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2358
+ARGP4
+ADDRLP4 3208
+ARGP4
+ADDRLP4 3264
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+EQI4 $2563
+ADDRLP4 3208
+INDIRF4
+CNSTF4 0
+EQF4 $2565
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2565
+LABELV $2563
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2567
+ARGP4
+ADDRLP4 3204
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3204
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2568
+CNSTI4 0
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2568
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2572
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2570
+ADDRLP4 3272
+CNSTF4 0
+ASGNF4
+ADDRLP4 3192+8
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192+4
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+LABELV $2570
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3052+24
+ARGP4
+ADDRLP4 3272
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+NEI4 $2575
+CNSTI4 0
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2575
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2578
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3212
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+EQI4 $2581
+ADDRLP4 3280
+CNSTF4 0
+ASGNF4
+ADDRLP4 3216+8
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216+4
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3048
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2588
+JUMPV
+LABELV $2585
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2589
+ADDRGP4 $2587
+JUMPV
+LABELV $2589
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2591
+ADDRGP4 $2586
+JUMPV
+LABELV $2591
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2593
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2593
+LABELV $2586
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2588
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $2585
+LABELV $2587
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2598
+JUMPV
+LABELV $2595
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2599
+ADDRGP4 $2597
+JUMPV
+LABELV $2599
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+EQI4 $2601
+ADDRGP4 $2596
+JUMPV
+LABELV $2601
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2603
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2603
+LABELV $2596
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2598
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $2595
+LABELV $2597
+LABELV $2581
+LABELV $2578
+LABELV $2560
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2607
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2605
+CNSTI4 0
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2605
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2610
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2608
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2611
+CNSTI4 3
+ARGI4
+ADDRGP4 $2614
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2611
+CNSTI4 0
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2608
+CNSTI4 0
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3272
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2618
+JUMPV
+LABELV $2615
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2622
+JUMPV
+LABELV $2619
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2625
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $2623
+ADDRGP4 $2620
+JUMPV
+LABELV $2623
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $2626
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRGP4 $2621
+JUMPV
+LABELV $2626
+LABELV $2620
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+LABELV $2622
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2619
+LABELV $2621
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2628
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2630
+CNSTI4 3
+ARGI4
+ADDRGP4 $2633
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2630
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2616
+JUMPV
+LABELV $2628
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2556
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $2634
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2616
+CNSTI4 3
+ARGI4
+ADDRGP4 $2639
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2616
+JUMPV
+LABELV $2634
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2607
+ARGP4
+ADDRLP4 3284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+NEI4 $2640
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3288
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2642
+ADDRGP4 $2616
+JUMPV
+LABELV $2642
+ADDRLP4 3292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2644
+ADDRLP4 3292
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2644
+ADDRLP4 3296
+CNSTI4 44
+ASGNI4
+ADDRLP4 3292
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2644
+ADDRLP4 3300
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3292
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+LEF4 $2644
+ADDRLP4 3292
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2644
+ADDRGP4 $2616
+JUMPV
+LABELV $2644
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $2646
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3312
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3312
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2648
+ADDRGP4 $2616
+JUMPV
+LABELV $2648
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2646
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2640
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2652
+ARGP4
+ADDRLP4 3288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $2650
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3292
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $2653
+ADDRGP4 $2616
+JUMPV
+LABELV $2653
+ADDRLP4 3296
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2655
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2655
+ADDRLP4 3300
+CNSTI4 44
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2655
+ADDRLP4 3304
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3296
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+LEF4 $2655
+ADDRLP4 3296
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2655
+ADDRGP4 $2616
+JUMPV
+LABELV $2655
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3308
+INDIRI4
+CNSTI4 0
+EQI4 $2657
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3316
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3316
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2659
+ADDRGP4 $2616
+JUMPV
+LABELV $2659
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2657
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2542
+JUMPV
+LABELV $2650
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2663
+ARGP4
+ADDRLP4 3292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $2661
+ADDRGP4 $2616
+JUMPV
+LABELV $2661
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2666
+ARGP4
+ADDRLP4 3296
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3296
+INDIRI4
+CNSTI4 0
+EQI4 $2668
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2667
+ARGP4
+ADDRLP4 3300
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3300
+INDIRI4
+CNSTI4 0
+NEI4 $2664
+LABELV $2668
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2610
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $2669
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3308
+INDIRI4
+ASGNI4
+LABELV $2669
+LABELV $2664
+LABELV $2616
+LABELV $2618
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $2672
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $2615
+LABELV $2672
+CNSTI4 0
+RETI4
+LABELV $2542
+endproc BotGetActivateGoal 3320 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 144 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $2674
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $2674
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $2677
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2679
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2673
+JUMPV
+LABELV $2677
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $2673
+endproc BotGoForActivateGoal 144 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $2556
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2681
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2683
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2682
+JUMPV
+LABELV $2681
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2684
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2682
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $2680
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 32 16
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $2685
+endproc BotRandomMove 32 16
+lit
+align 4
+LABELV $2689
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 484 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 192
+ADDRGP4 $2689
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2690
+ADDRFP4 0
+INDIRP4
+CNSTI4 6204
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2688
+JUMPV
+LABELV $2690
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2692
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $2688
+JUMPV
+LABELV $2692
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 452
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 452
+INDIRI4
+EQI4 $2694
+ADDRLP4 28+104
+INDIRI4
+ADDRLP4 452
+INDIRI4
+LEI4 $2694
+ADDRLP4 28+104
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $2694
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28+20
+INDIRI4
+ARGI4
+ADDRLP4 204
+ARGP4
+ADDRLP4 456
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+EQI4 $2699
+ADDRLP4 460
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 460
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2701
+ADDRLP4 460
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2701
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2701
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204+4+40
+INDIRI4
+ARGI4
+ADDRLP4 464
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 464
+INDIRI4
+CNSTI4 0
+NEI4 $2703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $2703
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2700
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $2700
+ADDRGP4 $2688
+JUMPV
+LABELV $2699
+ADDRLP4 204
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $2700
+LABELV $2694
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 460
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 460
+INDIRF4
+CNSTF4 1036831949
+GEF4 $2711
+ADDRLP4 180
+CNSTF4 0
+ASGNF4
+ADDRLP4 464
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180+4
+CNSTF4 1135869952
+ADDRLP4 464
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 180+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 468
+CNSTP4 0
+ASGNP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+ADDRLP4 468
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2711
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 168+8
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2716
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2716
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+NEI4 $2724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $2722
+LABELV $2724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 472
+INDIRI4
+CNSTI4 0
+NEI4 $2725
+ADDRLP4 476
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 480
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 480
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 480
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $2725
+LABELV $2722
+ADDRFP4 0
+INDIRP4
+CNSTI4 6204
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2733
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2735
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2736
+JUMPV
+LABELV $2735
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2737
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2737
+LABELV $2736
+LABELV $2733
+LABELV $2688
+endproc BotAIBlocked 484 16
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 324 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2740
+CNSTI4 0
+RETI4
+ADDRGP4 $2739
+JUMPV
+LABELV $2740
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2743
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+LEF4 $2743
+CNSTI4 0
+RETI4
+ADDRGP4 $2739
+JUMPV
+LABELV $2743
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2745
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2746
+ADDRLP4 300
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 300
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 300
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2746
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2746
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2758
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2758
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2758
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2760
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2739
+JUMPV
+LABELV $2760
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2746
+JUMPV
+LABELV $2745
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2764
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2767
+LABELV $2767
+LABELV $2764
+LABELV $2746
+CNSTI4 0
+RETI4
+LABELV $2739
+endproc BotAIPredictObstacles 324 44
+export BotCheckConsoleMessages
+proc BotCheckConsoleMessages 1012 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2771
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 trap_BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 10
+GEI4 $2774
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2776
+ADDRLP4 952
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 952
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $2776
+ADDRGP4 $2773
+JUMPV
+LABELV $2776
+LABELV $2774
+ADDRLP4 276
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2781
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 952
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $2784
+ADDRLP4 276
+ADDRLP4 288+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $2784
+LABELV $2781
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 trap_BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $2790
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2793
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $2793
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 960
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $2797
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2797
+ADDRLP4 288+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2800
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2800
+ADDRLP4 288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 872
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 616
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 872
+ARGP4
+ADDRLP4 964
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 964
+INDIRI4
+NEI4 $2803
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2772
+JUMPV
+LABELV $2803
+ADDRLP4 616
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2805
+ADDRGP4 $2808
+ARGP4
+ADDRGP4 $2809
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 968
+CNSTP4 0
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2810
+CNSTI4 1
+ARGI4
+ADDRGP4 $2812
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2806
+JUMPV
+LABELV $2810
+CNSTI4 1
+ARGI4
+ADDRGP4 $2813
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2806
+JUMPV
+LABELV $2805
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $2814
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2814
+ADDRLP4 976
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $2814
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 944
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 988
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $2816
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 944
+INDIRF4
+GEF4 $2816
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 996
+CNSTP4 0
+ASGNP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 0
+EQI4 $2818
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1008
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1008
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2820
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $2773
+JUMPV
+LABELV $2818
+LABELV $2816
+LABELV $2814
+LABELV $2806
+LABELV $2793
+LABELV $2790
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2772
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+NEI4 $2771
+LABELV $2773
+LABELV $2770
+endproc BotCheckConsoleMessages 1012 48
+export BotCheckForGrenades
+proc BotCheckForGrenades 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2824
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2822
+LABELV $2824
+ADDRGP4 $2821
+JUMPV
+LABELV $2822
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $2821
+endproc BotCheckForGrenades 8 16
+export BotCheckForProxMines
+proc BotCheckForProxMines 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2828
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $2826
+LABELV $2828
+ADDRGP4 $2825
+JUMPV
+LABELV $2826
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2829
+ADDRGP4 $2825
+JUMPV
+LABELV $2829
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $2833
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $2831
+LABELV $2833
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $2834
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $2831
+LABELV $2834
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $2835
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $2831
+LABELV $2835
+ADDRGP4 $2825
+JUMPV
+LABELV $2831
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $2836
+ADDRGP4 $2825
+JUMPV
+LABELV $2836
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2825
+endproc BotCheckForProxMines 40 16
+export BotCheckForKamikazeBody
+proc BotCheckForKamikazeBody 0 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $2839
+ADDRGP4 $2838
+JUMPV
+LABELV $2839
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2841
+ADDRGP4 $2838
+JUMPV
+LABELV $2841
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $2838
+endproc BotCheckForKamikazeBody 0 0
+export BotCheckEvents
+proc BotCheckEvents 320 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 816
+ADDRLP4 272
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+NEI4 $2844
+ADDRGP4 $2843
+JUMPV
+LABELV $2844
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+CNSTI4 816
+ADDRLP4 276
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $2848
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $2849
+JUMPV
+LABELV $2848
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $2849
+ADDRLP4 280
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 1
+LTI4 $2850
+ADDRLP4 280
+INDIRI4
+CNSTI4 76
+GTI4 $2850
+ADDRLP4 280
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2929-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2929
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2851
+address $2850
+address $2850
+address $2850
+address $2914
+address $2850
+address $2850
+address $2915
+address $2870
+address $2882
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2852
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2850
+address $2851
+code
+LABELV $2852
+ADDRLP4 284
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2853
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 288
+INDIRI4
+EQI4 $2858
+ADDRLP4 300
+INDIRI4
+CNSTI4 1023
+EQI4 $2858
+ADDRLP4 300
+INDIRI4
+CNSTI4 1022
+NEI4 $2855
+LABELV $2858
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2856
+JUMPV
+LABELV $2855
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2856
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2853
+ADDRLP4 288
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2859
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2860
+JUMPV
+LABELV $2859
+ADDRLP4 300
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+NEI4 $2861
+ADDRLP4 284
+INDIRI4
+ADDRLP4 300
+INDIRI4
+NEI4 $2861
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2861
+LABELV $2860
+LABELV $2854
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $2851
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+124
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $2851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $2851
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2870
+ADDRLP4 284
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+LTI4 $2873
+ADDRLP4 284
+INDIRI4
+CNSTI4 256
+LEI4 $2871
+LABELV $2873
+CNSTI4 3
+ARGI4
+ADDRGP4 $2874
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2851
+JUMPV
+LABELV $2871
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2877
+ARGP4
+ADDRLP4 288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $2875
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2878
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRGP4 $2851
+JUMPV
+LABELV $2875
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2881
+ARGP4
+ADDRLP4 292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $2851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $2851
+JUMPV
+LABELV $2882
+ADDRLP4 284
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 4
+EQI4 $2885
+ADDRLP4 284
+INDIRI4
+CNSTI4 9
+NEI4 $2883
+LABELV $2885
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+LTI4 $2851
+ADDRLP4 288
+INDIRI4
+CNSTI4 5
+GTI4 $2851
+ADDRLP4 288
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2895
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2895
+address $2889
+address $2890
+address $2891
+address $2892
+address $2893
+address $2894
+code
+LABELV $2889
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2890
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2891
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2892
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2893
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2894
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2883
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $2851
+ADDRLP4 288
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+LTI4 $2851
+ADDRLP4 288
+INDIRI4
+CNSTI4 5
+GTI4 $2851
+ADDRLP4 288
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2913
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2913
+address $2901
+address $2902
+address $2903
+address $2904
+address $2905
+address $2909
+code
+LABELV $2901
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2902
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2903
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2904
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2905
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+NEI4 $2907
+ADDRLP4 296
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2908
+JUMPV
+LABELV $2907
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+LABELV $2908
+ADDRLP4 300
+INDIRP4
+CNSTI4 6960
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2909
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 2
+NEI4 $2911
+ADDRLP4 308
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2912
+JUMPV
+LABELV $2911
+ADDRLP4 308
+CNSTI4 1
+ASGNI4
+LABELV $2912
+ADDRLP4 312
+INDIRP4
+CNSTI4 6960
+ADDP4
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2914
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2851
+JUMPV
+LABELV $2915
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2851
+ADDRLP4 284
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+LTI4 $2920
+ADDRLP4 284
+INDIRI4
+CNSTI4 256
+LEI4 $2918
+LABELV $2920
+CNSTI4 3
+ARGI4
+ADDRGP4 $2921
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2851
+JUMPV
+LABELV $2918
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2924
+ARGP4
+ADDRLP4 288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $2851
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2851
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $2850
+LABELV $2851
+LABELV $2843
+endproc BotCheckEvents 320 12
+export BotCheckSnapshot
+proc BotCheckSnapshot 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2933
+JUMPV
+LABELV $2932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForProxMines
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForKamikazeBody
+CALLV
+pop
+LABELV $2933
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 208
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 -1
+NEI4 $2932
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+180
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+184
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $2931
+endproc BotCheckSnapshot 216 16
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2938
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $2940
+ADDRGP4 $2937
+JUMPV
+LABELV $2940
+LABELV $2938
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2937
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2943
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2945
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $2942
+JUMPV
+LABELV $2945
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2947
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $2947
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2947
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+RETP4
+ADDRGP4 $2942
+JUMPV
+LABELV $2943
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $2942
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2950
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $2951
+JUMPV
+LABELV $2950
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $2951
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2952
+CNSTI4 0
+RETI4
+ADDRGP4 $2949
+JUMPV
+LABELV $2952
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2954
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2954
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2949
+endproc BotGetAlternateRouteGoal 28 0
+export BotSetupAlternativeRouteGoals
+proc BotSetupAlternativeRouteGoals 16 32
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $2957
+ADDRGP4 $2956
+JUMPV
+LABELV $2957
+ADDRLP4 0
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $2961
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $2959
+LABELV $2961
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2964
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2962
+CNSTI4 2
+ARGI4
+ADDRGP4 $2965
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2962
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $2960
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $2960
+JUMPV
+LABELV $2959
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $2973
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2977
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2975
+CNSTI4 2
+ARGI4
+ADDRGP4 $2978
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2975
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $2974
+JUMPV
+LABELV $2973
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $2983
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2977
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2985
+CNSTI4 2
+ARGI4
+ADDRGP4 $2987
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2985
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $2984
+JUMPV
+LABELV $2983
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $2992
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2977
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 4
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $2994
+CNSTI4 2
+ARGI4
+ADDRGP4 $2996
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2994
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $2992
+LABELV $2984
+LABELV $2974
+LABELV $2960
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $2956
+endproc BotSetupAlternativeRouteGoals 16 32
+export BotDeathmatchAI
+proc BotDeathmatchAI 1492 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $3002
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $3004
+ADDRGP4 $3001
+JUMPV
+LABELV $3004
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 148
+ARGP4
+ADDRGP4 $3006
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6020
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3007
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $3007
+ADDRLP4 1316
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $3010
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4756
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $3007
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $3011
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $3012
+JUMPV
+LABELV $3011
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $3013
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $3014
+JUMPV
+LABELV $3013
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $3014
+LABELV $3012
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1172
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1172
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $3002
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1464
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1464
+INDIRI4
+CNSTI4 0
+NEI4 $3015
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $3015
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1468
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1468
+INDIRI4
+CNSTI4 0
+NEI4 $3017
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1472
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 0
+NEI4 $3017
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $3017
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3019
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3021
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $3019
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3022
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $3022
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1480
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 1480
+INDIRI4
+CNSTI4 0
+EQI4 $3024
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1488
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1488
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3026
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $3024
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $3022
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3027
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1484
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1484
+INDIRI4
+CNSTI4 0
+EQI4 $3031
+ADDRGP4 $3029
+JUMPV
+LABELV $3031
+LABELV $3028
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $3027
+LABELV $3029
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3033
+ADDRGP4 $3001
+JUMPV
+LABELV $3033
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3001
+endproc BotDeathmatchAI 1492 16
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3039
+JUMPV
+LABELV $3036
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3041
+ADDRGP4 $3037
+JUMPV
+LABELV $3041
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3043
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $3043
+ADDRGP4 $3037
+JUMPV
+LABELV $3043
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3045
+ADDRGP4 $3037
+JUMPV
+LABELV $3045
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $3049
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3035
+JUMPV
+LABELV $3049
+LABELV $3037
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $3039
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3036
+LABELV $3035
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3055
+JUMPV
+LABELV $3052
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3057
+ADDRGP4 $3053
+JUMPV
+LABELV $3057
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3059
+ADDRGP4 $3053
+JUMPV
+LABELV $3059
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $3063
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3051
+JUMPV
+LABELV $3063
+LABELV $3053
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 816
+ADDP4
+ASGNP4
+LABELV $3055
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3052
+LABELV $3051
+endproc BotSetEntityNumForGoal 36 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $3069
+JUMPV
+LABELV $3066
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2556
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $3070
+ADDRGP4 $3067
+JUMPV
+LABELV $3070
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $3072
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2572
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $3074
+CNSTI4 0
+RETI4
+ADDRGP4 $3065
+JUMPV
+LABELV $3074
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $3078
+CNSTI4 0
+RETI4
+ADDRGP4 $3065
+JUMPV
+LABELV $3078
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $3065
+JUMPV
+LABELV $3072
+LABELV $3067
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $3069
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3066
+CNSTI4 0
+RETI4
+LABELV $3065
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 168 16
+ADDRGP4 $3081
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 maxclients
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 $3082
+ARGP4
+ADDRGP4 $2809
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 $3083
+ARGP4
+ADDRGP4 $3084
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $3085
+ARGP4
+ADDRGP4 $3084
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $3086
+ARGP4
+ADDRGP4 $3084
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $2808
+ARGP4
+ADDRGP4 $3084
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $3087
+ARGP4
+ADDRGP4 $3084
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $3088
+ARGP4
+ADDRGP4 $2809
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $3089
+ARGP4
+ADDRGP4 $3090
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 148
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 4
+EQI4 $3093
+ADDRLP4 148
+INDIRI4
+CNSTI4 9
+NEI4 $3091
+LABELV $3093
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 152
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+GEI4 $3094
+CNSTI4 2
+ARGI4
+ADDRGP4 $3097
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3094
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3100
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 156
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $3092
+CNSTI4 2
+ARGI4
+ADDRGP4 $3101
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3092
+JUMPV
+LABELV $3091
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 11
+NEI4 $3102
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 152
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+GEI4 $3104
+CNSTI4 2
+ARGI4
+ADDRGP4 $3106
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3104
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3100
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 156
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $3103
+CNSTI4 2
+ARGI4
+ADDRGP4 $3109
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3103
+JUMPV
+LABELV $3102
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 12
+NEI4 $3110
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3112
+ARGP4
+ADDRGP4 dom_points_bot
+ARGP4
+ADDRLP4 152
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $3113
+CNSTI4 2
+ARGI4
+ADDRGP4 $3115
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3114
+JUMPV
+LABELV $3113
+ADDRGP4 $3116
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 dom_points_bot
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+LABELV $3114
+ADDRLP4 136
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3120
+JUMPV
+LABELV $3117
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $3112
+ARGP4
+CNSTI4 56
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRGP4 dom_points_bot
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $3122
+CNSTI4 2
+ARGI4
+ADDRGP4 $3124
+ARGP4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3123
+JUMPV
+LABELV $3122
+ADDRGP4 $3116
+ARGP4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 dom_points_bot
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+LABELV $3123
+LABELV $3118
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3120
+ADDRLP4 136
+INDIRI4
+ADDRGP4 level+9304
+INDIRI4
+LTI4 $3117
+ADDRGP4 $3111
+JUMPV
+LABELV $3110
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $3125
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2964
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 152
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+GEI4 $3127
+CNSTI4 2
+ARGI4
+ADDRGP4 $3129
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3127
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 156
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $3130
+CNSTI4 2
+ARGI4
+ADDRGP4 $3097
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3130
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3100
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 160
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+GEI4 $3126
+CNSTI4 2
+ARGI4
+ADDRGP4 $3101
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3126
+JUMPV
+LABELV $3125
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $3134
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3138
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 152
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+GEI4 $3136
+CNSTI4 2
+ARGI4
+ADDRGP4 $3139
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3136
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $3140
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3143
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 156
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $3141
+CNSTI4 2
+ARGI4
+ADDRGP4 $3144
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3141
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $3145
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+ADDRGP4 $3135
+JUMPV
+LABELV $3134
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $3146
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3138
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 152
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+GEI4 $3148
+CNSTI4 2
+ARGI4
+ADDRGP4 $3150
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3148
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $3140
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3143
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 156
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+GEI4 $3151
+CNSTI4 2
+ARGI4
+ADDRGP4 $3153
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3151
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $3145
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2977
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 160
+ADDRGP4 untrap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+GEI4 $3154
+CNSTI4 2
+ARGI4
+ADDRGP4 $2996
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3154
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 $3156
+ARGP4
+ADDRGP4 BotSetEntityNumForGoal
+CALLV
+pop
+LABELV $3146
+LABELV $3135
+LABELV $3126
+LABELV $3111
+LABELV $3103
+LABELV $3092
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $3160
+JUMPV
+LABELV $3157
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $3161
+ADDRGP4 $3158
+JUMPV
+LABELV $3161
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $3163
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 164
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $3166
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $3166
+LABELV $3163
+LABELV $3158
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 160
+INDIRI4
+ASGNI4
+LABELV $3160
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3157
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $3080
+endproc BotSetupDeathmatchAI 168 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $3168
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export dom_points_bot
+align 4
+LABELV dom_points_bot
+skip 336
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+import bot_developer
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export bot_predictobstacles
+align 4
+LABELV bot_predictobstacles
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export neutralobelisk
+align 4
+LABELV neutralobelisk
+skip 56
+export blueobelisk
+align 4
+LABELV blueobelisk
+skip 56
+export redobelisk
+align 4
+LABELV redobelisk
+skip 56
+export ctf_neutralflag
+align 4
+LABELV ctf_neutralflag
+skip 56
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export bot_rocketjump
+align 4
+LABELV bot_rocketjump
+skip 272
+export bot_grapple
+align 4
+LABELV bot_grapple
+skip 272
+export maxclients
+align 4
+LABELV maxclients
+skip 4
+export gametype
+align 4
+LABELV gametype
+skip 4
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_blueteam
+import g_redteam
+import g_singlePlayer
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3156
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3153
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3150
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3145
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3144
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3143
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3140
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3139
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3138
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3129
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3124
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3116
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $3115
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $3112
+byte 1 68
+byte 1 111
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $3109
+byte 1 68
+byte 1 68
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 10
+byte 1 0
+align 1
+LABELV $3106
+byte 1 68
+byte 1 68
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 10
+byte 1 0
+align 1
+LABELV $3101
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3100
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3097
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3096
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3090
+byte 1 50
+byte 1 0
+align 1
+LABELV $3089
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3088
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3087
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3086
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3085
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3084
+byte 1 48
+byte 1 0
+align 1
+LABELV $3083
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3082
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $3081
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3026
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3021
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $3010
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3006
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2996
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $2987
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $2978
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $2977
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $2965
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2964
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2924
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2921
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2881
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2878
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2877
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2874
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2820
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2813
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $2812
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $2809
+byte 1 49
+byte 1 0
+align 1
+LABELV $2808
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2684
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2683
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2679
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2667
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2666
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2663
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2652
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2639
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2633
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $2625
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $2614
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2610
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2607
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2572
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2567
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $2562
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2559
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2556
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2555
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2543
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2358
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2335
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2332
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2294
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2239
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2235
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1323
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1322
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1321
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1320
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1319
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1102
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1086
+byte 1 116
+byte 1 0
+align 1
+LABELV $756
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $743
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $638
+byte 1 93
+byte 1 0
+align 1
+LABELV $637
+byte 1 91
+byte 1 0
+align 1
+LABELV $636
+byte 1 32
+byte 1 0
+align 1
+LABELV $593
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $588
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $587
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $582
+byte 1 110
+byte 1 0
+align 1
+LABELV $581
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $580
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $271
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $246
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $223
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $196
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $195
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $81
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $75
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $74
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $73
+byte 1 100
+byte 1 100
+byte 1 0
+align 1
+LABELV $72
+byte 1 108
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $71
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $70
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $69
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $68
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $67
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $66
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $65
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $64
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $63
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
@@ -0,0 +1,14412 @@
+export BotValidTeamLeader
+code
+proc BotValidTeamLeader 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $62
+CNSTI4 0
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $64
+CNSTI4 0
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $64
+CNSTI4 1
+RETI4
+LABELV $61
+endproc BotValidTeamLeader 8 4
+bss
+align 4
+LABELV $67
+skip 4
+export BotNumTeamMates
+code
+proc BotNumTeamMates 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $67
+INDIRI4
+CNSTI4 0
+NEI4 $68
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $67
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $68
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $71
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $78
+ADDRLP4 4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $75
+LABELV $78
+ADDRGP4 $72
+JUMPV
+LABELV $75
+ADDRLP4 4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $79
+ADDRGP4 $72
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $82
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+LABELV $72
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $74
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $67
+INDIRI4
+GEI4 $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $71
+LABELV $84
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $66
+endproc BotNumTeamMates 1064 12
+export BotClientTravelTimeToGoal
+proc BotClientTravelTimeToGoal 480 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $87
+CNSTI4 1
+RETI4
+ADDRGP4 $85
+JUMPV
+LABELV $87
+ADDRLP4 468
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+RETI4
+LABELV $85
+endproc BotClientTravelTimeToGoal 480 16
+bss
+align 4
+LABELV $91
+skip 4
+export BotSortTeamMatesByBaseTravelTime
+code
+proc BotSortTeamMatesByBaseTravelTime 1356 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+CNSTP4 0
+ASGNP4
+ADDRLP4 1304
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 4
+EQI4 $95
+ADDRLP4 1304
+INDIRI4
+CNSTI4 5
+EQI4 $95
+ADDRLP4 1304
+INDIRI4
+CNSTI4 9
+NEI4 $92
+LABELV $95
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $96
+ADDRLP4 1300
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $96
+ADDRLP4 1300
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $98
+ADDRLP4 1300
+ADDRGP4 redobelisk
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 1300
+ADDRGP4 blueobelisk
+ASGNP4
+LABELV $99
+LABELV $93
+ADDRGP4 $91
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1308
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $91
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+LABELV $100
+ADDRLP4 1312
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 268
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1316
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 276
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $106
+LABELV $108
+ADDRGP4 $103
+JUMPV
+LABELV $106
+ADDRLP4 276
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRLP4 1332
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 3
+NEI4 $109
+ADDRGP4 $103
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1340
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $113
+ADDRLP4 272
+INDIRI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+GEI4 $117
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $119
+ADDRLP4 1344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1348
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $122
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $119
+ADDRGP4 $115
+JUMPV
+LABELV $117
+LABELV $114
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $116
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $113
+LABELV $115
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $124
+ADDRGP4 $104
+JUMPV
+LABELV $124
+LABELV $111
+LABELV $103
+ADDRLP4 268
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 268
+INDIRI4
+ADDRGP4 $91
+INDIRI4
+GEI4 $126
+ADDRLP4 268
+INDIRI4
+CNSTI4 64
+LTI4 $102
+LABELV $126
+LABELV $104
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $90
+endproc BotSortTeamMatesByBaseTravelTime 1356 12
+bss
+align 4
+LABELV $128
+skip 4
+export BotSortTeamMatesByRelativeTravelTime2ddA
+code
+proc BotSortTeamMatesByRelativeTravelTime2ddA 1364 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRLP4 1308
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $128
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1312
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $128
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+LABELV $129
+ADDRLP4 1316
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $131
+ADDRLP4 272
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1320
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 276
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $135
+LABELV $137
+ADDRGP4 $132
+JUMPV
+LABELV $135
+ADDRLP4 276
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1332
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1332
+INDIRP4
+ARGP4
+ADDRLP4 1336
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 3
+NEI4 $138
+ADDRGP4 $132
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1340
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+ADDRLP4 1344
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1344
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1348
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1348
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 268
+INDIRF4
+ADDRLP4 1300
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $142
+ADDRLP4 268
+INDIRF4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+GEF4 $146
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $148
+ADDRLP4 1352
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1352
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1356
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $149
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $151
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $148
+ADDRGP4 $144
+JUMPV
+LABELV $146
+LABELV $143
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $142
+LABELV $144
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $153
+ADDRGP4 $133
+JUMPV
+LABELV $153
+LABELV $140
+LABELV $132
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $134
+ADDRLP4 272
+INDIRI4
+ADDRGP4 $128
+INDIRI4
+GEI4 $155
+ADDRLP4 272
+INDIRI4
+CNSTI4 64
+LTI4 $131
+LABELV $155
+LABELV $133
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $127
+endproc BotSortTeamMatesByRelativeTravelTime2ddA 1364 12
+export BotSetTeamMateTaskPreference
+proc BotSetTeamMateTaskPreference 36 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $156
+endproc BotSetTeamMateTaskPreference 36 12
+export BotGetTeamMateTaskPreference
+proc BotGetTeamMateTaskPreference 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $159
+CNSTI4 0
+RETI4
+ADDRGP4 $158
+JUMPV
+LABELV $159
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $162
+CNSTI4 0
+RETI4
+ADDRGP4 $158
+JUMPV
+LABELV $162
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+RETI4
+LABELV $158
+endproc BotGetTeamMateTaskPreference 40 12
+export BotSortTeamMatesByTaskPreference
+proc BotSortTeamMatesByTaskPreference 804 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 788
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 792
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $170
+ADDRLP4 796
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $172
+ADDRLP4 796
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 276
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 796
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 532
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $173
+LABELV $171
+LABELV $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $166
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 792
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 792
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 792
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 796
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 796
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 532
+ARGP4
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+ADDRLP4 796
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 272
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 268
+INDIRI4
+CVIU4 4
+ADDRLP4 800
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+RETI4
+LABELV $165
+endproc BotSortTeamMatesByTaskPreference 804 12
+export BotSayTeamOrderAlways
+proc BotSayTeamOrderAlways 548 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $175
+ADDRGP4 $174
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $179
+LABELV $174
+endproc BotSayTeamOrderAlways 548 20
+export BotSayTeamOrder
+proc BotSayTeamOrder 256 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+LABELV $181
+endproc BotSayTeamOrder 256 12
+export BotVoiceChat
+proc BotVoiceChat 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $183
+ADDRGP4 $185
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRGP4 $186
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $184
+LABELV $182
+endproc BotVoiceChat 4 12
+export BotVoiceChatOnly
+proc BotVoiceChatOnly 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $188
+ADDRGP4 $190
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRGP4 $191
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $189
+LABELV $187
+endproc BotVoiceChatOnly 4 12
+export BotSayVoiceTeamOrder
+proc BotSayVoiceTeamOrder 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $192
+endproc BotSayVoiceTeamOrder 0 12
+export BotCTFOrders_BothFlagsNotAtBase
+proc BotCTFOrders_BothFlagsNotAtBase 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+EQI4 $195
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+EQI4 $198
+ADDRLP4 352
+INDIRI4
+CNSTI4 3
+EQI4 $207
+ADDRGP4 $194
+JUMPV
+LABELV $198
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $199
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $200
+JUMPV
+LABELV $199
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $200
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $207
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $208
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $209
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $211
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $213
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $215
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $213
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $223
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $231
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $231
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $234
+LABELV $212
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $237
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $237
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $240
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $241
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $245
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $245
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $248
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $195
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $255
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $255
+ADDRLP4 360
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 360
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 360
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $257
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $261
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $265
+ADDRGP4 $262
+JUMPV
+LABELV $265
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $267
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $269
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $268
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $275
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $275
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $278
+LABELV $268
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $281
+LABELV $262
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $264
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $261
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $288
+ADDRGP4 $285
+JUMPV
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $290
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $293
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $293
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $296
+LABELV $285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $287
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $284
+LABELV $260
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $299
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $303
+ADDRGP4 $300
+JUMPV
+LABELV $303
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $307
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $307
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $310
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $254
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $314
+LABELV $300
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $302
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $299
+LABELV $195
+LABELV $193
+endproc BotCTFOrders_BothFlagsNotAtBase 368 20
+export BotCTFOrders_FlagNotAtBase
+proc BotCTFOrders_FlagNotAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $319
+ADDRGP4 $318
+JUMPV
+LABELV $319
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+CNSTI4 0
+LEI4 $322
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $325
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $328
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $325
+ADDRGP4 $318
+JUMPV
+LABELV $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $329
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $330
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $335
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $341
+ADDRGP4 $331
+JUMPV
+LABELV $335
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $341
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $331
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $348
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $348
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $350
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $350
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $352
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $353
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $355
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $352
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $356
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $359
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $356
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $363
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $366
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $370
+ADDRGP4 $362
+JUMPV
+LABELV $366
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $370
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $377
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $377
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $379
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $379
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $381
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $382
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $384
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $381
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $385
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $386
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $388
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $385
+LABELV $363
+LABELV $330
+LABELV $318
+endproc BotCTFOrders_FlagNotAtBase 320 16
+export BotCTFOrders_EnemyFlagNotAtBase
+proc BotCTFOrders_EnemyFlagNotAtBase 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $393
+ADDRGP4 $392
+JUMPV
+LABELV $393
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $397
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $399
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $403
+ADDRGP4 $396
+JUMPV
+LABELV $399
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $400
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $403
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $404
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $405
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $407
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $408
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 300
+CNSTF4 1058642330
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 6
+LEI4 $412
+ADDRLP4 300
+CNSTI4 6
+ASGNI4
+LABELV $412
+ADDRLP4 304
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 3
+LEI4 $414
+ADDRLP4 304
+CNSTI4 3
+ASGNI4
+LABELV $414
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $419
+JUMPV
+LABELV $416
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $420
+ADDRGP4 $417
+JUMPV
+LABELV $420
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $417
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $419
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $424
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $428
+ADDRGP4 $425
+JUMPV
+LABELV $428
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $424
+ADDRGP4 $397
+JUMPV
+LABELV $422
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $437
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $441
+ADDRGP4 $438
+JUMPV
+LABELV $441
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $438
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $440
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $437
+LABELV $397
+LABELV $392
+endproc BotCTFOrders_EnemyFlagNotAtBase 360 20
+export BotDDorders_Standard
+proc BotDDorders_Standard 304 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $448
+ADDRGP4 $447
+JUMPV
+LABELV $448
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 300
+ADDRGP4 BotSortTeamMatesByRelativeTravelTime2ddA
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $452
+ADDRGP4 $451
+JUMPV
+LABELV $451
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $457
+JUMPV
+LABELV $454
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $458
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $455
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $457
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $454
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $459
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $460
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $462
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $459
+LABELV $452
+LABELV $447
+endproc BotDDorders_Standard 304 16
+export BotCTFOrders_BothFlagsAtBase
+proc BotCTFOrders_BothFlagsAtBase 328 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $465
+ADDRGP4 $464
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 312
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+ADDRLP4 300
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 g_elimination_ctf_oneway+12
+INDIRI4
+ADDRLP4 316
+INDIRI4
+LEI4 $468
+ADDRGP4 level+9256
+INDIRI4
+ADDRGP4 level+9236
+INDIRI4
+ADDI4
+CNSTI4 2
+MODI4
+CNSTI4 0
+NEI4 $471
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 1
+NEI4 $471
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+LABELV $471
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $480
+JUMPV
+LABELV $477
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $480
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $477
+ADDRGP4 $464
+JUMPV
+LABELV $475
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $482
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $484
+ADDRLP4 0
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $481
+ADDRGP4 $464
+JUMPV
+LABELV $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $485
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $486
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $490
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $494
+ADDRGP4 $487
+JUMPV
+LABELV $490
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $494
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $487
+ADDRLP4 324
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 324
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 324
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $501
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $501
+ADDRLP4 308
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 4
+LEI4 $503
+ADDRLP4 308
+CNSTI4 4
+ASGNI4
+LABELV $503
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $506
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $508
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $505
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $512
+JUMPV
+LABELV $509
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $510
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $512
+ADDRLP4 0
+INDIRI4
+ADDRLP4 308
+INDIRI4
+LTI4 $509
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $517
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $519
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $523
+ADDRGP4 $516
+JUMPV
+LABELV $519
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $523
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $530
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $530
+ADDRLP4 324
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 308
+ADDRLP4 324
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 324
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 5
+LEI4 $532
+ADDRLP4 308
+CNSTI4 5
+ASGNI4
+LABELV $532
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $537
+JUMPV
+LABELV $534
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $535
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $537
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $534
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $538
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $539
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $541
+ADDRLP4 0
+INDIRI4
+ADDRLP4 308
+INDIRI4
+LTI4 $538
+LABELV $517
+LABELV $486
+LABELV $464
+endproc BotCTFOrders_BothFlagsAtBase 328 16
+export BotCTFOrders
+proc BotCTFOrders 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $546
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $547
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $548
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $548
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $554
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $554
+address $550
+address $551
+address $552
+address $553
+code
+LABELV $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsAtBase
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_EnemyFlagNotAtBase
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $552
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_FlagNotAtBase
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsNotAtBase
+CALLV
+pop
+LABELV $548
+LABELV $549
+LABELV $545
+endproc BotCTFOrders 20 4
+export BotDDorders
+proc BotDDorders 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDDorders_Standard
+CALLV
+pop
+LABELV $555
+endproc BotDDorders 0 4
+export BotCreateGroup
+proc BotCreateGroup 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $557
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $563
+JUMPV
+LABELV $560
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $564
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $565
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $561
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $563
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $560
+LABELV $556
+endproc BotCreateGroup 76 20
+bss
+align 4
+LABELV $567
+skip 4
+export BotTeamOrders
+code
+proc BotTeamOrders 1320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $567
+INDIRI4
+CNSTI4 0
+NEI4 $568
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1288
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $567
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+LABELV $568
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRGP4 $573
+JUMPV
+LABELV $570
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 4
+ARGP4
+ADDRGP4 $77
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 0
+NEI4 $574
+LABELV $576
+ADDRGP4 $571
+JUMPV
+LABELV $574
+ADDRLP4 4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 3
+NEI4 $577
+ADDRGP4 $571
+JUMPV
+LABELV $577
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1032
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $579
+LABELV $571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $567
+INDIRI4
+GEI4 $581
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $570
+LABELV $581
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $582
+ADDRLP4 1028
+INDIRI4
+CNSTI4 5
+GTI4 $582
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $597-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $597
+address $583
+address $583
+address $586
+address $587
+address $589
+code
+LABELV $586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $587
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $589
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 1028
+INDIRI4
+CNSTI4 10
+GTI4 $583
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $596
+JUMPV
+LABELV $593
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1304
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1304
+INDIRI4
+LSHI4
+ADDRLP4 1032
+ADDP4
+ARGP4
+ADDRLP4 1304
+INDIRI4
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+LABELV $594
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $596
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $593
+LABELV $583
+LABELV $566
+endproc BotTeamOrders 1320 12
+export Bot1FCTFOrders_FlagAtCenter
+proc Bot1FCTFOrders_FlagAtCenter 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $600
+ADDRGP4 $599
+JUMPV
+LABELV $600
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $603
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $604
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $608
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $612
+ADDRGP4 $605
+JUMPV
+LABELV $608
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $612
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $605
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $618
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $618
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $620
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $620
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $625
+JUMPV
+LABELV $622
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $623
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $625
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $622
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $629
+JUMPV
+LABELV $626
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $627
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $629
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $626
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $634
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $636
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $640
+ADDRGP4 $633
+JUMPV
+LABELV $636
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $634
+JUMPV
+LABELV $640
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $634
+JUMPV
+LABELV $633
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $647
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $647
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $649
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $649
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $652
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $654
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $651
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $658
+JUMPV
+LABELV $655
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $656
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $658
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $655
+LABELV $634
+LABELV $604
+LABELV $599
+endproc Bot1FCTFOrders_FlagAtCenter 320 16
+export Bot1FCTFOrders_TeamHasFlag
+proc Bot1FCTFOrders_TeamHasFlag 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $663
+ADDRGP4 $662
+JUMPV
+LABELV $663
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $666
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $667
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $671
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $677
+ADDRGP4 $668
+JUMPV
+LABELV $671
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $672
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $673
+JUMPV
+LABELV $672
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $673
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $677
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $678
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $679
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $681
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $682
+JUMPV
+LABELV $681
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $682
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $686
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $688
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $687
+JUMPV
+LABELV $688
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $668
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $690
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $690
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $692
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $692
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $694
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $698
+ADDRGP4 $695
+JUMPV
+LABELV $698
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $695
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $697
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $694
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $705
+JUMPV
+LABELV $702
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $706
+ADDRGP4 $703
+JUMPV
+LABELV $706
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $710
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $711
+JUMPV
+LABELV $710
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $711
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $703
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $705
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $702
+ADDRGP4 $667
+JUMPV
+LABELV $700
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $718
+JUMPV
+LABELV $715
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $719
+ADDRGP4 $716
+JUMPV
+LABELV $719
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $716
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $718
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $715
+ADDRGP4 $667
+JUMPV
+LABELV $666
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $726
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $728
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $732
+ADDRGP4 $725
+JUMPV
+LABELV $728
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $729
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $730
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $726
+JUMPV
+LABELV $732
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $733
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $734
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $736
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $737
+JUMPV
+LABELV $736
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $737
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $742
+JUMPV
+LABELV $741
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $743
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $743
+ADDRLP4 304
+CNSTF4 1061997773
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 8
+LEI4 $745
+ADDRLP4 304
+CNSTI4 8
+ASGNI4
+LABELV $745
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $750
+JUMPV
+LABELV $747
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $751
+ADDRGP4 $748
+JUMPV
+LABELV $751
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $748
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $750
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $747
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $756
+JUMPV
+LABELV $753
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $757
+ADDRGP4 $754
+JUMPV
+LABELV $757
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $761
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $762
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $754
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $756
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $753
+LABELV $726
+LABELV $667
+LABELV $662
+endproc Bot1FCTFOrders_TeamHasFlag 360 20
+export Bot1FCTFOrders_EnemyHasFlag
+proc Bot1FCTFOrders_EnemyHasFlag 316 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $767
+ADDRGP4 $766
+JUMPV
+LABELV $767
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $770
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $771
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $775
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $779
+ADDRGP4 $772
+JUMPV
+LABELV $775
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $771
+JUMPV
+LABELV $779
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $771
+JUMPV
+LABELV $772
+ADDRLP4 300
+CNSTF4 1061997773
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 8
+LEI4 $786
+ADDRLP4 300
+CNSTI4 8
+ASGNI4
+LABELV $786
+ADDRLP4 304
+CNSTF4 1036831949
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 1
+LEI4 $788
+ADDRLP4 304
+CNSTI4 1
+ASGNI4
+LABELV $788
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $793
+JUMPV
+LABELV $790
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $791
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $793
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $790
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $797
+JUMPV
+LABELV $794
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $795
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $797
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $794
+ADDRGP4 $771
+JUMPV
+LABELV $770
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $803
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $805
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $809
+ADDRGP4 $802
+JUMPV
+LABELV $805
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $803
+JUMPV
+LABELV $809
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $803
+JUMPV
+LABELV $802
+ADDRLP4 300
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 7
+LEI4 $816
+ADDRLP4 300
+CNSTI4 7
+ASGNI4
+LABELV $816
+ADDRLP4 304
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+LEI4 $818
+ADDRLP4 304
+CNSTI4 2
+ASGNI4
+LABELV $818
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $823
+JUMPV
+LABELV $820
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $821
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $823
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $820
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $827
+JUMPV
+LABELV $824
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $799
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $825
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $827
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $824
+LABELV $803
+LABELV $771
+LABELV $766
+endproc Bot1FCTFOrders_EnemyHasFlag 316 16
+export Bot1FCTFOrders_EnemyDroppedFlag
+proc Bot1FCTFOrders_EnemyDroppedFlag 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $832
+ADDRGP4 $831
+JUMPV
+LABELV $832
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $835
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $836
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $840
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $844
+ADDRGP4 $837
+JUMPV
+LABELV $840
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $836
+JUMPV
+LABELV $844
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $836
+JUMPV
+LABELV $837
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $851
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $851
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $853
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $853
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $858
+JUMPV
+LABELV $855
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $856
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $858
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $855
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $862
+JUMPV
+LABELV $859
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $860
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $862
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $859
+ADDRGP4 $836
+JUMPV
+LABELV $835
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $867
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $869
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $873
+ADDRGP4 $866
+JUMPV
+LABELV $869
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $867
+JUMPV
+LABELV $873
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $867
+JUMPV
+LABELV $866
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $880
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $880
+ADDRLP4 304
+CNSTF4 1058642330
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $882
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $882
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $887
+JUMPV
+LABELV $884
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $885
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $887
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $884
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $891
+JUMPV
+LABELV $888
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $889
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $891
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $888
+LABELV $867
+LABELV $836
+LABELV $831
+endproc Bot1FCTFOrders_EnemyDroppedFlag 320 16
+export Bot1FCTFOrders
+proc Bot1FCTFOrders 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6960
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $896
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GTI4 $896
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $903
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $903
+address $899
+address $900
+address $901
+address $902
+code
+LABELV $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_FlagAtCenter
+CALLV
+pop
+ADDRGP4 $897
+JUMPV
+LABELV $900
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_TeamHasFlag
+CALLV
+pop
+ADDRGP4 $897
+JUMPV
+LABELV $901
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_EnemyHasFlag
+CALLV
+pop
+ADDRGP4 $897
+JUMPV
+LABELV $902
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders_EnemyDroppedFlag
+CALLV
+pop
+LABELV $896
+LABELV $897
+LABELV $895
+endproc Bot1FCTFOrders 8 4
+export BotObeliskOrders
+proc BotObeliskOrders 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $905
+ADDRGP4 $904
+JUMPV
+LABELV $905
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $908
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $909
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $913
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $917
+ADDRGP4 $910
+JUMPV
+LABELV $913
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $909
+JUMPV
+LABELV $917
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $909
+JUMPV
+LABELV $910
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $924
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $924
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $926
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $926
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $931
+JUMPV
+LABELV $928
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $929
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $931
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $928
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $935
+JUMPV
+LABELV $932
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $933
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $935
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $932
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $940
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $942
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $946
+ADDRGP4 $939
+JUMPV
+LABELV $942
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $940
+JUMPV
+LABELV $946
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $940
+JUMPV
+LABELV $939
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $953
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $953
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $955
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $955
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $960
+JUMPV
+LABELV $957
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $958
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $960
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $957
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $964
+JUMPV
+LABELV $961
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $675
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $962
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $964
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $961
+LABELV $940
+LABELV $909
+LABELV $904
+endproc BotObeliskOrders 320 16
+export BotHarvesterOrders
+proc BotHarvesterOrders 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $969
+ADDRGP4 $968
+JUMPV
+LABELV $969
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $972
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $973
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $977
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $982
+ADDRGP4 $974
+JUMPV
+LABELV $977
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $973
+JUMPV
+LABELV $982
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $973
+JUMPV
+LABELV $974
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $989
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $989
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $991
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $991
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $996
+JUMPV
+LABELV $993
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $994
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $996
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $993
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1000
+JUMPV
+LABELV $997
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $998
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1000
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $997
+ADDRGP4 $973
+JUMPV
+LABELV $972
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $1005
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $1007
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $1011
+ADDRGP4 $1004
+JUMPV
+LABELV $1007
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $1005
+JUMPV
+LABELV $1011
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $1005
+JUMPV
+LABELV $1004
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $1018
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $1018
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $1020
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $1020
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1025
+JUMPV
+LABELV $1022
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $337
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $1023
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1025
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $1022
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1029
+JUMPV
+LABELV $1026
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $979
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $676
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $1027
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1029
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $1026
+LABELV $1005
+LABELV $973
+LABELV $968
+endproc BotHarvesterOrders 320 16
+export FindHumanTeamLeader
+proc FindHumanTeamLeader 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1034
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1038
+CNSTI4 816
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $1041
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1047
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1049
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 3
+GEI4 $1051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotVoiceChat_Defend
+CALLV
+pop
+LABELV $1051
+LABELV $1049
+CNSTI4 1
+RETI4
+ADDRGP4 $1033
+JUMPV
+LABELV $1047
+LABELV $1045
+LABELV $1041
+LABELV $1038
+LABELV $1035
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1034
+CNSTI4 0
+RETI4
+LABELV $1033
+endproc FindHumanTeamLeader 12 12
+export BotTeamAI
+proc BotTeamAI 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 2
+LEI4 $1055
+ADDRGP4 $1054
+JUMPV
+LABELV $1055
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1060
+ADDRGP4 g_ffa_gt
+INDIRI4
+CNSTI4 1
+NEI4 $1058
+LABELV $1060
+ADDRGP4 $1054
+JUMPV
+LABELV $1058
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotValidTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 FindHumanTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $1063
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $1065
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $1065
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1067
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1068
+JUMPV
+LABELV $1067
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1068
+LABELV $1065
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $1069
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1069
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1071
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1069
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1054
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1054
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1074
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $1075
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1054
+JUMPV
+LABELV $1063
+LABELV $1061
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+ADDRGP4 $1054
+JUMPV
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotNumTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+LTI4 $1078
+ADDRLP4 52
+INDIRI4
+CNSTI4 11
+GTI4 $1078
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1130-12
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1130
+address $1080
+address $1086
+address $1107
+address $1118
+address $1124
+address $1078
+address $1086
+address $1078
+address $1100
+code
+LABELV $1080
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1083
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1081
+LABELV $1083
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1081
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1079
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $1079
+JUMPV
+LABELV $1086
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1092
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1092
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1092
+ADDRGP4 lastRoundNumber
+INDIRI4
+ADDRGP4 level+9236
+INDIRI4
+EQI4 $1087
+LABELV $1092
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 lastRoundNumber
+ADDRGP4 level+9236
+INDIRI4
+ASGNI4
+LABELV $1087
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $1094
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $1096
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1096
+LABELV $1094
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1079
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1079
+JUMPV
+LABELV $1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1104
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1101
+LABELV $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1101
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1079
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDDorders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1079
+JUMPV
+LABELV $1107
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1111
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1111
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1108
+LABELV $1111
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1108
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $1112
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $1114
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1114
+LABELV $1112
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $1079
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1079
+JUMPV
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1121
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1119
+LABELV $1121
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1119
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1079
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRGP4 $1079
+JUMPV
+LABELV $1124
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1125
+LABELV $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1125
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $1079
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $1079
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+LABELV $1078
+LABELV $1079
+LABELV $1054
+endproc BotTeamAI 72 12
+bss
+export lastRoundNumber
+align 4
+LABELV lastRoundNumber
+skip 4
+export ctftaskpreferences
+align 4
+LABELV ctftaskpreferences
+skip 2560
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import monster_die
+import MapInfoPrint
+import G_admin_namelog_cleanup
+import G_admin_cleanup
+import G_admin_duration
+import G_admin_buffer_end
+import G_admin_buffer_begin
+import G_admin_buffer_print
+import G_admin_print
+import G_admin_shuffle
+import G_admin_warn
+import G_admin_slap
+import G_admin_orient
+import G_admin_disorient
+import G_admin_unlock
+import G_admin_lock
+import G_admin_namelog
+import G_admin_nextmap
+import G_admin_restart
+import G_admin_rename
+import G_admin_spec999
+import G_admin_passvote
+import G_admin_cancelvote
+import G_admin_allready
+import G_admin_admintest
+import G_admin_help
+import G_admin_showbans
+import G_admin_mute
+import G_admin_map
+import G_admin_listplayers
+import G_admin_listadmins
+import G_admin_putteam
+import G_admin_unban
+import G_admin_ban
+import G_admin_adjustban
+import G_admin_kick
+import G_admin_setlevel
+import G_admin_time
+import G_admin_parse_time
+import G_admin_level
+import G_admin_namelog_update
+import G_admin_name_check
+import G_admin_permission
+import G_admin_readconfig
+import G_admin_cmd_check
+import G_admin_ban_check
+import G_ConfigClientExcellent
+import G_checkForMultiKill
+import G_CheckForSpree
+import G_RunStreakLogic
+import G_ReadAltKillSettings
+import Svcmd_MessageWrapper
+import Svcmd_ListIP_f
+import Svcmd_Chat_f
+import Svcmd_DumpUser_f
+import Svcmd_EjectClient_f
+import Svcmd_BannerPrint_f
+import Svcmd_CenterPrint_f
+import Svcmd_TeamMessage_f
+import Svcmd_Status_f
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_maxNameChanges
+import g_minNameChangePeriod
+import g_warningExpire
+import g_maxWarnings
+import g_publicAdminMessages
+import g_specChat
+import g_adminMaxBan
+import g_adminTempBan
+import g_adminNameProtect
+import g_adminParseSay
+import g_adminLog
+import g_admin
+import g_floodMinTime
+import g_floodMaxDemerits
+import g_spreeDiv
+import g_altExcellent
+import g_sprees
+import g_delagPrefilter
+import g_lagLightning
+import sv_fps
+import g_truePing
+import g_delagHitscan
+import g_blueTeamClientNumbers
+import g_redTeamClientNumbers
+import g_humanplayers
+import g_maxvotes
+import g_voteMaxFraglimit
+import g_voteMinFraglimit
+import g_voteMaxTimelimit
+import g_voteMinTimelimit
+import g_voteGametypes
+import g_voteBan
+import g_voteNames
+import g_mappools
+import g_autonextmap
+import g_catchup
+import g_runes
+import g_awardpushing
+import g_elimination_ctf_oneway
+import g_lms_mode
+import g_lms_lives
+import g_ffa_gt
+import g_regen
+import g_vampireMaxHealth
+import g_vampire
+import g_instantgib
+import g_rockets
+import g_elimination_lockspectator
+import g_elimination_nail
+import g_elimination_mine
+import g_elimination_chain
+import g_elimination_plasmagun
+import g_elimination_lightning
+import g_elimination_railgun
+import g_elimination_rocket
+import g_elimination_grenade
+import g_elimination_shotgun
+import g_elimination_machinegun
+import g_elimination_allgametypes
+import g_elimination_activewarmup
+import g_elimination_warmup
+import g_elimination_roundtime
+import g_elimination_grapple
+import g_elimination_bfg
+import g_elimination_startArmor
+import g_elimination_startHealth
+import g_elimination_selfdamage
+import g_spawnprotect
+import g_music
+import g_proxMineTimeout
+import g_enableBreath
+import g_enableDust
+import g_blueteam
+import g_redteam
+import g_singlePlayer
+import g_rankings
+import pmove_float
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_votecustom
+import g_votemaps
+import g_motdfile
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_respawntime
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_damageModifier
+import g_gravityModifier
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_voteflags
+import g_elimflags
+import g_videoflags
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Team_ForceGesture
+import Team_DD_bonusAtPoints
+import Team_RemoveDoubleDominationPoints
+import Team_SpawnDoubleDominationPoints
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_Dom_SpawnPoints
+import SelectDominationSpawnPoint
+import SelectDoubleDominationSpawnPoint
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import getCustomVote
+import VoteParseCustomVotes
+import allowedFraglimit
+import allowedTimelimit
+import allowedGametype
+import allowedMap
+import getMappage
+import custom_vote_info
+import ClientLeaving
+import CountVotes
+import CheckVote
+import allowedVote
+import Possession_TouchFlag
+import Possession_SpawnFlag
+import PlayerStore_restore
+import PlayerStore_store
+import PlayerStoreInit
+import LogAcc
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import Team_SetFlagStatus
+import SelectRandomEntity
+import SelectRandomEntityFilter
+import G_TeamFromString
+import ShuffleTeams
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import CheckTeamVote
+import LogExit
+import G_Error
+import G_Printf
+import SendYourTeamMessageToTeam
+import SendDominationPointsStatusMessageToAllClients
+import SendDDtimetakenMessageToAllClients
+import SendEliminationMessageToAllClients
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import ExitLevel
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import SendCustomVoteCommands
+import ChallengeMessage
+import DominationPointStatusMessage
+import DominationPointNamesMessage
+import RespawnTimeMessage
+import EliminationMessage
+import DeathmatchScoreboardMessage
+import ObeliskHealthMessage
+import AttackingTeamMessage
+import YourTeamMessage
+import DoubleDominationScoreTimeMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_StartKamikaze
+import FireWeapon
+import ClientForString
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import ClientRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import LMSpoint
+import EndEliminationRound
+import DisableWeapons
+import EnableWeapons
+import RespawnDead
+import RespawnAll
+import TeamHumanParticipantsCount
+import TeamLivingHumanCount
+import TeamHealthCount
+import TeamLivingCount
+import TeamCount
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftForTrace
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import MinSpawnpointCount
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import MatchTeam
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import ProximityMine_RemoveAll
+import G_RunMissile
+import TossClientCubes
+import TossClientPersistantPowerups
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_GlobalSound
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import writeFile_string
+import writeFile_int
+import readFile_string
+import readFile_int
+import WarmupEliminationRound
+import StartLMSRound
+import SendAttackingTeamMessageToAllClients
+import RestartEliminationRound
+import CheckLMS
+import CheckElimination
+import SanitizeString
+import G_ClientIsLagging
+import G_ClientNumberFromString
+import Cmd_AdminMessage_f
+import G_FloodLimited
+import G_ClientNumbersFromString
+import G_SanitiseString
+import G_MatchOnePlayer
+import G_DecolorString
+import G_SayConcatArgs
+import G_SayArgv
+import G_SayArgc
+import G_Say
+import ConcatArgs
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import enableq
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1075
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1074
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1071
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $979
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $799
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $676
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $675
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $463
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 98
+byte 1 0
+align 1
+LABELV $458
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $337
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $336
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $254
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $230
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $222
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $206
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $205
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $191
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $190
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $186
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $185
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $180
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $81
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 110
+byte 1 0
+align 1
+LABELV $70
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
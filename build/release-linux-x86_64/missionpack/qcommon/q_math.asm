@@ -0,0 +1,4249 @@
+data
+export vec3_origin
+align 4
+LABELV vec3_origin
+byte 4 0
+byte 4 0
+byte 4 0
+export axisDefault
+align 4
+LABELV axisDefault
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorBlack
+align 4
+LABELV colorBlack
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorRed
+align 4
+LABELV colorRed
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorGreen
+align 4
+LABELV colorGreen
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export colorBlue
+align 4
+LABELV colorBlue
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export colorYellow
+align 4
+LABELV colorYellow
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export colorMagenta
+align 4
+LABELV colorMagenta
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export colorCyan
+align 4
+LABELV colorCyan
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorWhite
+align 4
+LABELV colorWhite
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorLtGrey
+align 4
+LABELV colorLtGrey
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1065353216
+export colorMdGrey
+align 4
+LABELV colorMdGrey
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+export colorDkGrey
+align 4
+LABELV colorDkGrey
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1065353216
+export g_color_table
+align 4
+LABELV g_color_table
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1065353216
+lit
+align 4
+LABELV bytedirs
+byte 4 3204879951
+byte 4 0
+byte 4 1062847556
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3197577718
+byte 4 0
+byte 4 1064605338
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1064532072
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1062847556
+byte 4 1057396303
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 0
+byte 4 1057396303
+byte 4 1062847556
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1057396303
+byte 4 0
+byte 4 1062847556
+byte 4 1050094070
+byte 4 0
+byte 4 1064605338
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3205921044
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3208081647
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204879951
+byte 4 1062847556
+byte 4 0
+byte 4 0
+byte 4 1062847556
+byte 4 3204879951
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3202531056
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 3196491359
+byte 4 1064532072
+byte 4 3190184938
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064605338
+byte 4 1050094070
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1049007711
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1062847556
+byte 4 1057396303
+byte 4 0
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1057396303
+byte 4 1062847556
+byte 4 0
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1064605338
+byte 4 1050094070
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1062847556
+byte 4 3204879951
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 0
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1062847556
+byte 4 0
+byte 4 1057396303
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1064532072
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1057396303
+byte 4 0
+byte 4 3210331204
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1062847556
+byte 4 0
+byte 4 3204879951
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1063074669
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1064532072
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3209632701
+byte 4 0
+byte 4 1057396303
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3210331204
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3197577718
+byte 4 0
+byte 4 3212088986
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3212015720
+byte 4 0
+byte 4 0
+byte 4 3212836864
+byte 4 1050094070
+byte 4 0
+byte 4 3212088986
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3212015720
+byte 4 0
+byte 4 3210331204
+byte 4 3204879951
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 0
+byte 4 3204879951
+byte 4 3210331204
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1056964608
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3207605577
+byte 4 0
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212836864
+byte 4 0
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3190184938
+byte 4 0
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3212088986
+byte 4 1050094070
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1049007711
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1057396303
+byte 4 3210331204
+byte 4 0
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3196491359
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3204879951
+byte 4 3210331204
+byte 4 0
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3201942579
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 0
+byte 4 3204879951
+byte 4 1062847556
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1058437396
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3212088986
+byte 4 1050094070
+byte 4 0
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212836864
+byte 4 0
+byte 4 0
+byte 4 3210331204
+byte 4 0
+byte 4 1057396303
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212015720
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3210331204
+byte 4 0
+byte 4 3204879951
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3201942579
+export DirToByte
+code
+proc DirToByte 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $24
+CNSTI4 0
+RETI4
+ADDRGP4 $23
+JUMPV
+LABELV $24
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $26
+ADDRLP4 20
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 bytedirs+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 bytedirs+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $32
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $32
+LABELV $27
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $26
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $23
+endproc DirToByte 24 0
+export ByteToDir
+proc ByteToDir 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $37
+ADDRFP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $35
+LABELV $37
+ADDRFP4 4
+INDIRP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $34
+JUMPV
+LABELV $35
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $34
+endproc ByteToDir 4 0
+export Q_random
+proc Q_random 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 69069
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+RETF4
+LABELV $38
+endproc Q_random 4 0
+export Q_crandom
+proc Q_crandom 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+RETF4
+LABELV $39
+endproc Q_crandom 4 4
+export RotatePointAroundVector
+proc RotatePointAroundVector 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTF4 1078530011
+ADDRFP4 12
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $40
+endproc RotatePointAroundVector 72 12
+export RotateAroundDirection
+proc RotateAroundDirection 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $46
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $46
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $45
+endproc RotateAroundDirection 24 16
+export vectoangles
+proc vectoangles 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $49
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $49
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $51
+ADDRLP4 4
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $50
+JUMPV
+LABELV $51
+ADDRLP4 4
+CNSTF4 1132920832
+ASGNF4
+ADDRGP4 $50
+JUMPV
+LABELV $49
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $53
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 24
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $54
+JUMPV
+LABELV $53
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $55
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $56
+JUMPV
+LABELV $55
+ADDRLP4 0
+CNSTF4 1132920832
+ASGNF4
+LABELV $56
+LABELV $54
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $57
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $57
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1127481344
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $59
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $59
+LABELV $50
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $48
+endproc vectoangles 40 8
+export AnglesToAxis
+proc AnglesToAxis 16 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $61
+endproc AnglesToAxis 16 16
+export AxisClear
+proc AxisClear 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $66
+endproc AxisClear 0 0
+export AxisCopy
+proc AxisCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 24
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $67
+endproc AxisCopy 8 0
+export AngleSubtract
+proc AngleSubtract 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $70
+JUMPV
+LABELV $69
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $70
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+GTF4 $69
+ADDRGP4 $73
+JUMPV
+LABELV $72
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $73
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $72
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $68
+endproc AngleSubtract 4 0
+export AnglesSubtract
+proc AnglesSubtract 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $75
+endproc AnglesSubtract 20 8
+export AngleMod
+proc AngleMod 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $76
+endproc AngleMod 0 0
+export RadiusFromBounds
+proc RadiusFromBounds 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $78
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $83
+ADDRLP4 32
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 32
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $84
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $79
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $78
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+LABELV $77
+endproc RadiusFromBounds 36 4
+export BoundsIntersect
+proc BoundsIntersect 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LTF4 $92
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $92
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $92
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+GTF4 $92
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $92
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $86
+LABELV $92
+CNSTI4 0
+RETI4
+ADDRGP4 $85
+JUMPV
+LABELV $86
+CNSTI4 1
+RETI4
+LABELV $85
+endproc BoundsIntersect 24 0
+export BoundsIntersectSphere
+proc BoundsIntersectSphere 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $100
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $100
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $100
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $100
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $100
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $94
+LABELV $100
+CNSTI4 0
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $94
+CNSTI4 1
+RETI4
+LABELV $93
+endproc BoundsIntersectSphere 36 0
+export BoundsIntersectPoint
+proc BoundsIntersectPoint 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $108
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $108
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $108
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $108
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $108
+ADDRLP4 28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $102
+LABELV $108
+CNSTI4 0
+RETI4
+ADDRGP4 $101
+JUMPV
+LABELV $102
+CNSTI4 1
+RETI4
+LABELV $101
+endproc BoundsIntersectPoint 32 0
+export VectorNormalize
+proc VectorNormalize 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $110
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $110
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $109
+endproc VectorNormalize 44 4
+export VectorNormalize2
+proc VectorNormalize2 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $113
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $114
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $112
+endproc VectorNormalize2 40 4
+export _VectorMA
+proc _VectorMA 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $115
+endproc _VectorMA 8 0
+export _DotProduct
+proc _DotProduct 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $116
+endproc _DotProduct 16 0
+export _VectorSubtract
+proc _VectorSubtract 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $117
+endproc _VectorSubtract 8 0
+export _VectorAdd
+proc _VectorAdd 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $118
+endproc _VectorAdd 8 0
+export _VectorCopy
+proc _VectorCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $119
+endproc _VectorCopy 8 0
+export _VectorScale
+proc _VectorScale 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $120
+endproc _VectorScale 8 0
+export Vector4Scale
+proc Vector4Scale 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $121
+endproc Vector4Scale 12 0
+export Q_log2
+proc Q_log2 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $123
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $122
+endproc Q_log2 8 0
+export Q_rsqrt
+proc Q_rsqrt 24 0
+ADDRLP4 12
+CNSTF4 1069547520
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 1597463007
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $126
+endproc Q_rsqrt 24 0
+export MatrixMultiply
+proc MatrixMultiply 104 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 20
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 24
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 28
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTI4 32
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $127
+endproc MatrixMultiply 104 0
+bss
+align 4
+LABELV $129
+skip 4
+align 4
+LABELV $130
+skip 4
+align 4
+LABELV $131
+skip 4
+align 4
+LABELV $132
+skip 4
+align 4
+LABELV $133
+skip 4
+align 4
+LABELV $134
+skip 4
+export AngleVectors
+code
+proc AngleVectors 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $131
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $134
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $130
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $133
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $129
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $132
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $135
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $133
+INDIRF4
+ADDRGP4 $134
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $133
+INDIRF4
+ADDRGP4 $131
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $130
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $135
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $137
+ADDRLP4 28
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $129
+INDIRF4
+MULF4
+ADDRGP4 $130
+INDIRF4
+MULF4
+ADDRGP4 $134
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $132
+INDIRF4
+MULF4
+ADDRGP4 $131
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $129
+INDIRF4
+MULF4
+ADDRGP4 $130
+INDIRF4
+MULF4
+ADDRGP4 $131
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $132
+INDIRF4
+MULF4
+ADDRGP4 $134
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ADDRGP4 $129
+INDIRF4
+MULF4
+ADDRGP4 $133
+INDIRF4
+MULF4
+ASGNF4
+LABELV $137
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $139
+ADDRFP4 12
+INDIRP4
+ADDRGP4 $132
+INDIRF4
+ADDRGP4 $130
+INDIRF4
+MULF4
+ADDRGP4 $134
+INDIRF4
+MULF4
+ADDRGP4 $129
+INDIRF4
+NEGF4
+ADDRGP4 $131
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $132
+INDIRF4
+ADDRGP4 $130
+INDIRF4
+MULF4
+ADDRGP4 $131
+INDIRF4
+MULF4
+ADDRGP4 $129
+INDIRF4
+NEGF4
+ADDRGP4 $134
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $132
+INDIRF4
+ADDRGP4 $133
+INDIRF4
+MULF4
+ASGNF4
+LABELV $139
+LABELV $128
+endproc AngleVectors 36 4
+export PerpendicularVector
+proc PerpendicularVector 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $142
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $144
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $146
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $141
+JUMPV
+LABELV $146
+LABELV $145
+LABELV $143
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $141
+endproc PerpendicularVector 36 4
+export VectorCompare
+proc VectorCompare 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+NEF4 $152
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $152
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+EQF4 $149
+LABELV $152
+CNSTI4 0
+RETI4
+ADDRGP4 $148
+JUMPV
+LABELV $149
+CNSTI4 1
+RETI4
+LABELV $148
+endproc VectorCompare 16 0
+export VectorLength
+proc VectorLength 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+LABELV $153
+endproc VectorLength 20 4
+export VectorLengthSquared
+proc VectorLengthSquared 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $154
+endproc VectorLengthSquared 16 0
+export Distance
+proc Distance 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $155
+endproc Distance 32 4
+export DistanceSquared
+proc DistanceSquared 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $158
+endproc DistanceSquared 32 0
+export VectorInverse
+proc VectorInverse 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $165
+endproc VectorInverse 12 0
+export CrossProduct
+proc CrossProduct 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $166
+endproc CrossProduct 40 0
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Matrix4Compare
+import PlaneFromPoints
+import Q_acos
+import AddPointToBounds
+import qsnapvectorsse
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
@@ -0,0 +1,5529 @@
+export Com_Clamp
+code
+proc Com_Clamp 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $24
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $23
+JUMPV
+LABELV $24
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $26
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $23
+JUMPV
+LABELV $26
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $23
+endproc Com_Clamp 0 0
+export COM_SkipPath
+proc COM_SkipPath 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $30
+JUMPV
+LABELV $29
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $30
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $29
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $28
+endproc COM_SkipPath 4 0
+export COM_GetExtension
+proc COM_GetExtension 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $35
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $37
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $35
+LABELV $37
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+RETP4
+ADDRGP4 $34
+JUMPV
+LABELV $35
+ADDRGP4 $38
+RETP4
+LABELV $34
+endproc COM_GetExtension 16 8
+export COM_StripExtension
+proc COM_StripExtension 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 20
+CNSTU4 0
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 20
+INDIRU4
+EQU4 $40
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 20
+INDIRU4
+EQU4 $42
+ADDRLP4 24
+INDIRU4
+ADDRLP4 16
+INDIRU4
+GEU4 $40
+LABELV $42
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+GEI4 $44
+ADDRLP4 28
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $45
+JUMPV
+LABELV $44
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $45
+ADDRFP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $40
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $46
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LEI4 $46
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $47
+JUMPV
+LABELV $46
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $47
+LABELV $39
+endproc COM_StripExtension 32 12
+export COM_CompareExtension
+proc COM_CompareExtension 20 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $49
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $51
+CNSTI4 1
+RETI4
+ADDRGP4 $48
+JUMPV
+LABELV $51
+LABELV $49
+CNSTI4 0
+RETI4
+LABELV $48
+endproc COM_CompareExtension 20 8
+export COM_DefaultExtension
+proc COM_DefaultExtension 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 46
+ARGI4
+ADDRLP4 8
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $54
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 12
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $56
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+GEU4 $54
+LABELV $56
+ADDRGP4 $53
+JUMPV
+LABELV $54
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $53
+endproc COM_DefaultExtension 16 12
+export CopyShortSwap
+proc CopyShortSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $57
+endproc CopyShortSwap 8 0
+export CopyLongSwap
+proc CopyLongSwap 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+LABELV $58
+endproc CopyLongSwap 8 0
+export ShortSwap
+proc ShortSwap 2 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 0
+ADDRFP4 0
+INDIRI2
+CVII4 2
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 1
+ADDRFP4 0
+INDIRI2
+CVII4 2
+CNSTI4 8
+RSHI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $59
+endproc ShortSwap 2 0
+export ShortNoSwap
+proc ShortNoSwap 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRI2
+CVII4 2
+RETI4
+LABELV $60
+endproc ShortNoSwap 0 0
+export LongSwap
+proc LongSwap 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 2
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 3
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDRLP4 16
+INDIRI4
+LSHI4
+BORI4
+ADDRLP4 2
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BORI4
+ADDRLP4 3
+INDIRU1
+CVUI4 1
+BORI4
+RETI4
+LABELV $61
+endproc LongSwap 24 0
+export LongNoSwap
+proc LongNoSwap 0 0
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $62
+endproc LongNoSwap 0 0
+export Long64Swap
+proc Long64Swap 12 0
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 7
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRP4
+CNSTI4 6
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+2
+ADDRFP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+3
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+5
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+6
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+7
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 8
+LABELV $63
+endproc Long64Swap 12 0
+export Long64NoSwap
+proc Long64NoSwap 0 0
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 8
+LABELV $72
+endproc Long64NoSwap 0 0
+export FloatSwap
+proc FloatSwap 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 LongSwap
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $74
+endproc FloatSwap 8 4
+export FloatNoSwap
+proc FloatNoSwap 0 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+RETF4
+LABELV $75
+endproc FloatNoSwap 0 0
+export COM_BeginParseSession
+proc COM_BeginParseSession 0 16
+ADDRGP4 com_lines
+CNSTI4 1
+ASGNI4
+ADDRGP4 com_tokenline
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_parsename
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $76
+endproc COM_BeginParseSession 0 16
+export COM_GetCurrentParseLine
+proc COM_GetCurrentParseLine 0 0
+ADDRGP4 com_tokenline
+INDIRI4
+CNSTI4 0
+EQI4 $79
+ADDRGP4 com_tokenline
+INDIRI4
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRGP4 com_lines
+INDIRI4
+RETI4
+LABELV $78
+endproc COM_GetCurrentParseLine 0 0
+export COM_Parse
+proc COM_Parse 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $81
+endproc COM_Parse 4 8
+bss
+align 1
+LABELV $83
+skip 4096
+export COM_ParseError
+code
+proc COM_ParseError 8 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $83
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $85
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $82
+endproc COM_ParseError 8 16
+bss
+align 1
+LABELV $87
+skip 4096
+export COM_ParseWarning
+code
+proc COM_ParseWarning 8 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $87
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRGP4 COM_GetCurrentParseLine
+CALLI4
+ASGNI4
+ADDRGP4 $89
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $86
+endproc COM_ParseWarning 8 16
+export COM_Compress
+proc COM_Compress 44 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $91
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 20
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $96
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+NEI4 $96
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $99
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRLP4 24
+INDIRI4
+CNSTI4 10
+NEI4 $98
+LABELV $101
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $102
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $102
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $105
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $107
+ADDRLP4 28
+INDIRI4
+CNSTI4 42
+NEI4 $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $104
+LABELV $107
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $112
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $110
+LABELV $112
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+EQI4 $115
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $113
+LABELV $115
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $116
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $118
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $118
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $120
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $124
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $126
+LABELV $123
+ADDRGP4 $122
+JUMPV
+LABELV $124
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $121
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $121
+LABELV $114
+LABELV $111
+LABELV $103
+LABELV $97
+LABELV $94
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $91
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $90
+endproc COM_Compress 44 0
+export COM_ParseExt
+proc COM_ParseExt 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+CNSTI1 0
+ASGNI1
+ADDRGP4 com_tokenline
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $133
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $129
+JUMPV
+LABELV $135
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CNSTI4 10
+NEI4 $138
+ADDRLP4 12
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $139
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $129
+JUMPV
+LABELV $138
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $142
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $129
+JUMPV
+LABELV $142
+LABELV $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $136
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ADDRLP4 12
+INDIRU1
+ASGNU1
+ADDRLP4 12
+INDIRU1
+CVUI4 1
+CNSTI4 32
+LEI4 $135
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $134
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $146
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $149
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $151
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+NEI4 $148
+LABELV $151
+ADDRGP4 $145
+JUMPV
+LABELV $146
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $155
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $157
+ADDRLP4 16
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $157
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $155
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $154
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $145
+LABELV $133
+ADDRGP4 $136
+JUMPV
+LABELV $134
+ADDRGP4 com_tokenline
+ADDRGP4 com_lines
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CNSTI4 34
+NEI4 $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 34
+EQI4 $166
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $164
+LABELV $166
+ADDRLP4 8
+INDIRU4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $129
+JUMPV
+LABELV $164
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CNSTI4 10
+NEI4 $167
+ADDRLP4 20
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $167
+ADDRLP4 8
+INDIRU4
+CNSTU4 1023
+GEU4 $169
+ADDRLP4 8
+INDIRU4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $169
+LABELV $162
+ADDRGP4 $161
+JUMPV
+LABELV $159
+LABELV $171
+ADDRLP4 8
+INDIRU4
+CNSTU4 1023
+GEU4 $174
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CVII1 4
+ASGNI1
+LABELV $174
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $172
+ADDRLP4 4
+INDIRU1
+CVUI4 1
+CNSTI4 32
+GTI4 $171
+ADDRLP4 8
+INDIRU4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+LABELV $129
+endproc COM_ParseExt 24 0
+proc COM_MatchToken 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $177
+CNSTI4 1
+ARGI4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $177
+LABELV $176
+endproc COM_MatchToken 12 16
+export SkipRestOfLine
+proc SkipRestOfLine 16 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $184
+ADDRGP4 $180
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $186
+ADDRLP4 8
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $185
+JUMPV
+LABELV $186
+LABELV $184
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $183
+LABELV $185
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $180
+endproc SkipRestOfLine 16 0
+export Parse1DMatrix
+proc Parse1DMatrix 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $190
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $191
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $193
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $190
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $188
+endproc Parse1DMatrix 16 8
+export Parse2DMatrix
+proc Parse2DMatrix 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $196
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse1DMatrix
+CALLV
+pop
+LABELV $197
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $199
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $196
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $195
+endproc Parse2DMatrix 8 12
+export Parse3DMatrix
+proc Parse3DMatrix 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse2DMatrix
+CALLV
+pop
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $201
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $200
+endproc Parse3DMatrix 12 16
+export Com_HexStrToInt
+proc Com_HexStrToInt 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $206
+LABELV $208
+CNSTI4 -1
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 120
+NEI4 $209
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 24
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $215
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+GTI4 $215
+ADDRLP4 16
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVII1 4
+ASGNI1
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 28
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 97
+LTI4 $217
+ADDRLP4 28
+INDIRI4
+CNSTI4 102
+GTI4 $217
+ADDRLP4 16
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+CNSTI4 10
+ADDI4
+CVII1 4
+ASGNI1
+ADDRGP4 $218
+JUMPV
+LABELV $217
+CNSTI4 -1
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $218
+LABELV $216
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+LABELV $212
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $211
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $209
+CNSTI4 -1
+RETI4
+LABELV $205
+endproc Com_HexStrToInt 32 4
+export Q_isprint
+proc Q_isprint 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $220
+ADDRLP4 0
+INDIRI4
+CNSTI4 126
+GTI4 $220
+CNSTI4 1
+RETI4
+ADDRGP4 $219
+JUMPV
+LABELV $220
+CNSTI4 0
+RETI4
+LABELV $219
+endproc Q_isprint 4 0
+export Q_islower
+proc Q_islower 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $223
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $223
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $223
+CNSTI4 0
+RETI4
+LABELV $222
+endproc Q_islower 4 0
+export Q_isupper
+proc Q_isupper 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $226
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $226
+CNSTI4 1
+RETI4
+ADDRGP4 $225
+JUMPV
+LABELV $226
+CNSTI4 0
+RETI4
+LABELV $225
+endproc Q_isupper 4 0
+export Q_isalpha
+proc Q_isalpha 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $232
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+LEI4 $231
+LABELV $232
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $229
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $229
+LABELV $231
+CNSTI4 1
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $229
+CNSTI4 0
+RETI4
+LABELV $228
+endproc Q_isalpha 8 0
+export Q_isintegral
+proc Q_isintegral 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+NEF4 $235
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $233
+endproc Q_isintegral 8 0
+export Q_strncpyz
+proc Q_strncpyz 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $237
+endproc Q_strncpyz 0 12
+export Q_stricmpn
+proc Q_stricmpn 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $239
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $241
+CNSTI4 0
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $241
+CNSTI4 -1
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $239
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $243
+CNSTI4 1
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $243
+LABELV $245
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $248
+CNSTI4 0
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $248
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $250
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $250
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $250
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+LTI4 $252
+ADDRLP4 4
+INDIRI4
+CNSTI4 122
+GTI4 $252
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $252
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $254
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $257
+ADDRLP4 32
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $258
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $254
+LABELV $246
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $245
+CNSTI4 0
+RETI4
+LABELV $238
+endproc Q_stricmpn 36 0
+export Q_strncmp
+proc Q_strncmp 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $260
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $263
+CNSTI4 0
+RETI4
+ADDRGP4 $259
+JUMPV
+LABELV $263
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $265
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $268
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $269
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $259
+JUMPV
+LABELV $265
+LABELV $261
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $260
+CNSTI4 0
+RETI4
+LABELV $259
+endproc Q_strncmp 28 0
+export Q_stricmp
+proc Q_stricmp 12 12
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $272
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $272
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $273
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $270
+endproc Q_stricmp 12 12
+export Q_strlwr
+proc Q_strlwr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $276
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $275
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $274
+endproc Q_strlwr 12 4
+export Q_strupr
+proc Q_strupr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $280
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $279
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $278
+endproc Q_strupr 12 4
+export Q_strcat
+proc Q_strcat 12 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $283
+CNSTI4 0
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $283
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $282
+endproc Q_strcat 12 12
+export Q_stristr
+proc Q_stristr 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $287
+ADDRLP4 16
+ADDRLP4 1
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $289
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+GTI4 $289
+ADDRLP4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $289
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $291
+LABELV $294
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 28
+INDIRI1
+ASGNI1
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $297
+CNSTP4 0
+RETP4
+ADDRGP4 $286
+JUMPV
+LABELV $297
+ADDRLP4 32
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $299
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+GTI4 $299
+ADDRLP4 0
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $299
+LABELV $295
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+NEI4 $294
+LABELV $292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $291
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $287
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $286
+endproc Q_stristr 36 12
+export Q_PrintStrlen
+proc Q_PrintStrlen 20 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $305
+CNSTI4 0
+RETI4
+ADDRGP4 $301
+JUMPV
+LABELV $304
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $307
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $307
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $307
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+LTI4 $307
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+GTI4 $307
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $307
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $305
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $304
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $301
+endproc Q_PrintStrlen 20 0
+export Q_CleanStr
+proc Q_CleanStr 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $313
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $313
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $313
+ADDRLP4 16
+INDIRI4
+CNSTI4 56
+GTI4 $313
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $315
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+GTI4 $315
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $315
+LABELV $314
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $311
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $310
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $309
+endproc Q_CleanStr 28 0
+export Q_CountChar
+proc Q_CountChar 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $318
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $322
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $322
+LABELV $319
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $321
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $318
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $317
+endproc Q_CountChar 4 0
+export Com_sprintf
+proc Com_sprintf 12 16
+ADDRLP4 4
+ADDRFP4 8+4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $326
+ADDRGP4 $328
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $326
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $324
+endproc Com_sprintf 12 16
+bss
+align 1
+LABELV $330
+skip 64000
+data
+align 4
+LABELV $331
+byte 4 0
+export va
+code
+proc va 12 16
+ADDRLP4 4
+CNSTI4 32000
+ADDRGP4 $331
+INDIRI4
+CNSTI4 1
+BANDI4
+MULI4
+ADDRGP4 $330
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 $331
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 32000
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $329
+endproc va 12 16
+export Com_TruncateLongString
+proc Com_TruncateLongString 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GTI4 $334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 29
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $336
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 -29
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $335
+LABELV $333
+endproc Com_TruncateLongString 8 12
+bss
+align 1
+LABELV $338
+skip 16384
+data
+align 4
+LABELV $339
+byte 4 0
+export Info_ValueForKey
+code
+proc Info_ValueForKey 8220 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8196
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+EQU4 $342
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+NEU4 $340
+LABELV $342
+ADDRGP4 $38
+RETP4
+ADDRGP4 $337
+JUMPV
+LABELV $340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8200
+INDIRI4
+CNSTI4 8192
+LTI4 $343
+CNSTI4 1
+ARGI4
+ADDRGP4 $345
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $343
+ADDRLP4 8204
+ADDRGP4 $339
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $349
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $354
+ADDRGP4 $38
+RETP4
+ADDRGP4 $337
+JUMPV
+LABELV $354
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $352
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $351
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $339
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $338
+ADDP4
+ASGNP4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $357
+ADDRLP4 8208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 92
+EQI4 $359
+ADDRLP4 8208
+INDIRI4
+CNSTI4 0
+NEI4 $356
+LABELV $359
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8212
+INDIRI4
+CNSTI4 0
+NEI4 $360
+ADDRGP4 $339
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $338
+ADDP4
+RETP4
+ADDRGP4 $337
+JUMPV
+LABELV $360
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $362
+ADDRGP4 $350
+JUMPV
+LABELV $362
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $349
+ADDRGP4 $348
+JUMPV
+LABELV $350
+ADDRGP4 $38
+RETP4
+LABELV $337
+endproc Info_ValueForKey 8220 8
+export Info_NextPair
+proc Info_NextPair 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $365
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $365
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $370
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $364
+JUMPV
+LABELV $370
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $368
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $367
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $373
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 92
+EQI4 $375
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $372
+LABELV $375
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $364
+endproc Info_NextPair 20 0
+export Info_RemoveKey
+proc Info_RemoveKey 2080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2056
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 1024
+LTI4 $377
+CNSTI4 1
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $377
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 2060
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $383
+ADDRGP4 $376
+JUMPV
+LABELV $382
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $385
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $385
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $390
+ADDRGP4 $376
+JUMPV
+LABELV $390
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $388
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $387
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $395
+ADDRGP4 $376
+JUMPV
+LABELV $395
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $393
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 92
+EQI4 $397
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $392
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $376
+JUMPV
+LABELV $398
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $400
+ADDRGP4 $376
+JUMPV
+LABELV $400
+LABELV $383
+ADDRGP4 $382
+JUMPV
+LABELV $376
+endproc Info_RemoveKey 2080 12
+export Info_RemoveKey_Big
+proc Info_RemoveKey_Big 16416 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16392
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 16392
+INDIRI4
+CNSTI4 8192
+LTI4 $403
+CNSTI4 1
+ARGI4
+ADDRGP4 $405
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $403
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 16396
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $409
+ADDRGP4 $402
+JUMPV
+LABELV $408
+ADDRLP4 8196
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $411
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $411
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $416
+ADDRGP4 $402
+JUMPV
+LABELV $416
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $414
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $413
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8200
+ASGNP4
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $421
+ADDRGP4 $402
+JUMPV
+LABELV $421
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $419
+ADDRLP4 16404
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16404
+INDIRI4
+CNSTI4 92
+EQI4 $423
+ADDRLP4 16404
+INDIRI4
+CNSTI4 0
+NEI4 $418
+LABELV $423
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16408
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+NEI4 $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16412
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8196
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16412
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $402
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $426
+ADDRGP4 $402
+JUMPV
+LABELV $426
+LABELV $409
+ADDRGP4 $408
+JUMPV
+LABELV $402
+endproc Info_RemoveKey_Big 16416 12
+export Info_Validate
+proc Info_Validate 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 0
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $429
+CNSTI4 0
+RETI4
+ADDRGP4 $428
+JUMPV
+LABELV $429
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $431
+CNSTI4 0
+RETI4
+ADDRGP4 $428
+JUMPV
+LABELV $431
+CNSTI4 1
+RETI4
+LABELV $428
+endproc Info_Validate 8 8
+export Info_SetValueForKey
+proc Info_SetValueForKey 1048 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $434
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1024
+LTI4 $441
+CNSTI4 1
+ARGI4
+ADDRGP4 $437
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $438
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $444
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $442
+LABELV $444
+ADDRGP4 $445
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $433
+JUMPV
+LABELV $442
+LABELV $439
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $441
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $438
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $448
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $446
+LABELV $448
+ADDRGP4 $433
+JUMPV
+LABELV $446
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $449
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+ADDI4
+CNSTI4 1024
+LTI4 $450
+ADDRGP4 $452
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $433
+JUMPV
+LABELV $450
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $433
+endproc Info_SetValueForKey 1048 20
+export Info_SetValueForKey_Big
+proc Info_SetValueForKey_Big 8208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $434
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8196
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8196
+INDIRI4
+CNSTI4 8192
+LTI4 $459
+CNSTI4 1
+ARGI4
+ADDRGP4 $437
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $456
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8200
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8200
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $462
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8204
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $460
+LABELV $462
+ADDRGP4 $445
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $453
+JUMPV
+LABELV $460
+LABELV $457
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $459
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $456
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey_Big
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $463
+ADDRGP4 $453
+JUMPV
+LABELV $463
+ADDRLP4 4
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 $449
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8200
+INDIRI4
+ADDRLP4 8204
+INDIRI4
+ADDI4
+CNSTI4 8192
+LTI4 $465
+ADDRGP4 $467
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $453
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $453
+endproc Info_SetValueForKey_Big 8208 20
+proc Com_CharIsOneOfCharset 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $472
+JUMPV
+LABELV $469
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRFP4 0
+INDIRI1
+CVII4 1
+NEI4 $473
+CNSTI4 1
+RETI4
+ADDRGP4 $468
+JUMPV
+LABELV $473
+LABELV $470
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $472
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $469
+CNSTI4 0
+RETI4
+LABELV $468
+endproc Com_CharIsOneOfCharset 8 4
+export Com_SkipCharset
+proc Com_SkipCharset 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $480
+LABELV $477
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $476
+LABELV $478
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $475
+endproc Com_SkipCharset 8 8
+export Com_SkipTokens
+proc Com_SkipTokens 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $485
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $488
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $487
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $490
+ADDRGP4 $484
+JUMPV
+LABELV $490
+LABELV $486
+LABELV $483
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $482
+LABELV $484
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $492
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $481
+JUMPV
+LABELV $492
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $481
+endproc Com_SkipTokens 20 8
+bss
+align 4
+LABELV com_tokenline
+skip 4
+align 4
+LABELV com_lines
+skip 4
+align 1
+LABELV com_parsename
+skip 1024
+align 1
+LABELV com_token
+skip 1024
+import Com_Printf
+import Com_Error
+import Q_isanumber
+import Com_RandomBytes
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $467
+byte 1 66
+byte 1 73
+byte 1 71
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $452
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $449
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $445
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $437
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $434
+byte 1 92
+byte 1 59
+byte 1 34
+byte 1 0
+align 1
+LABELV $405
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $379
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $345
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $336
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $328
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $285
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $194
+byte 1 41
+byte 1 0
+align 1
+LABELV $189
+byte 1 40
+byte 1 0
+align 1
+LABELV $179
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $89
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $85
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $77
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $38
+byte 1 0
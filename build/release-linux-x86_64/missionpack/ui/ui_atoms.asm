@@ -0,0 +1,4300 @@
+export Com_Error
+code
+proc Com_Error 1032 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $91
+endproc Com_Error 1032 16
+export Com_Printf
+proc Com_Printf 1032 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $94
+endproc Com_Printf 1032 16
+data
+export newUI
+align 4
+LABELV newUI
+byte 4 0
+export UI_ClampCvar
+code
+proc UI_ClampCvar 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $97
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $99
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $96
+JUMPV
+LABELV $99
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $96
+endproc UI_ClampCvar 0 0
+export UI_StartDemoLoop
+proc UI_StartDemoLoop 0 8
+CNSTI4 2
+ARGI4
+ADDRGP4 $102
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $101
+endproc UI_StartDemoLoop 0 8
+bss
+align 1
+LABELV $104
+skip 1024
+export UI_Argv
+code
+proc UI_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $104
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $104
+RETP4
+LABELV $103
+endproc UI_Argv 0 12
+bss
+align 1
+LABELV $106
+skip 1024
+export UI_Cvar_VariableString
+code
+proc UI_Cvar_VariableString 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $106
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $106
+RETP4
+LABELV $105
+endproc UI_Cvar_VariableString 0 12
+export UI_SetBestScores
+proc UI_SetBestScores 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $109
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $113
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $116
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $119
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $118
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $125
+ARGP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 60
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRGP4 $109
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $119
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $139
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $140
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $125
+ARGP4
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 60
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 132
+INDIRI4
+DIVI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 132
+INDIRI4
+MODI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $127
+LABELV $107
+endproc UI_SetBestScores 144 12
+export UI_LoadBestScores
+proc UI_LoadBestScores 144 24
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $145
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 132
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $146
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 136
+INDIRI4
+CVIU4 4
+CNSTU4 64
+NEU4 $148
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+LABELV $148
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $146
+ADDRLP4 68
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_SetBestScores
+CALLV
+pop
+ADDRGP4 $151
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $150
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 uiInfo+73520
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $153
+ADDRGP4 uiInfo+73520
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $153
+LABELV $144
+endproc UI_LoadBestScores 144 24
+export UI_ClearScores
+proc UI_ClearScores 4200 16
+ADDRGP4 $157
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 88
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4184
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4184
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $159
+ADDRLP4 0
+ADDRLP4 88
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $161
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4188
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4188
+INDIRI4
+ASGNI4
+ADDRGP4 $167
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4192
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4192
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4196
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 4196
+INDIRI4
+CNSTI4 0
+LTI4 $165
+ADDRLP4 20
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $165
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $162
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $164
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $161
+LABELV $159
+ADDRLP4 24
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_SetBestScores
+CALLV
+pop
+LABELV $156
+endproc UI_ClearScores 4200 16
+proc UI_Cache_f 0 0
+ADDRGP4 Display_CacheAll
+CALLV
+pop
+LABELV $168
+endproc UI_Cache_f 0 0
+proc UI_CalcPostGameStats 1456 20
+ADDRLP4 1088
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 64
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1160
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1224
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 1228
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 1160
+ARGP4
+ADDRLP4 1224
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 1096
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1092
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1316
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+LTI4 $172
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRLP4 1296
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 1296
+INDIRI4
+CVIU4 4
+CNSTU4 64
+NEU4 $174
+ADDRLP4 1096
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+LABELV $174
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $172
+CNSTI4 3
+ARGI4
+ADDRLP4 1320
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+16
+ADDRLP4 1324
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 1328
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRLP4 1332
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+20
+ADDRLP4 1332
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 1336
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1336
+INDIRP4
+ARGP4
+ADDRLP4 1340
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+24
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 1344
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1344
+INDIRP4
+ARGP4
+ADDRLP4 1348
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+28
+ADDRLP4 1348
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 1352
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1352
+INDIRP4
+ARGP4
+ADDRLP4 1356
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+32
+ADDRLP4 1356
+INDIRI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 1360
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+ARGP4
+ADDRLP4 1364
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+36
+ADDRLP4 1364
+INDIRI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRLP4 1368
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1368
+INDIRP4
+ARGP4
+ADDRLP4 1372
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+60
+ADDRLP4 1372
+INDIRI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRLP4 1376
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ARGP4
+ADDRLP4 1380
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 1380
+INDIRI4
+ASGNI4
+CNSTI4 11
+ARGI4
+ADDRLP4 1384
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1384
+INDIRP4
+ARGP4
+ADDRLP4 1388
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 1388
+INDIRI4
+ASGNI4
+CNSTI4 12
+ARGI4
+ADDRLP4 1392
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+ARGP4
+ADDRLP4 1396
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 1396
+INDIRI4
+ASGNI4
+CNSTI4 13
+ARGI4
+ADDRLP4 1400
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1400
+INDIRP4
+ARGP4
+ADDRLP4 1404
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1404
+INDIRI4
+ASGNI4
+CNSTI4 14
+ARGI4
+ADDRLP4 1408
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+ARGP4
+ADDRLP4 1412
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+40
+ADDRLP4 1412
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 1416
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0+44
+ADDRLP4 1300
+INDIRI4
+CVIF4 4
+ADDRLP4 1416
+INDIRF4
+SUBF4
+CNSTF4 1148846080
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1292
+ADDRLP4 1224
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 112
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+83384+40
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+INDIRI4
+ADDRLP4 1292
+INDIRI4
+GEI4 $192
+ADDRLP4 0+48
+CNSTI4 10
+ADDRLP4 1292
+INDIRI4
+ADDRLP4 0+44
+INDIRI4
+SUBI4
+MULI4
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 0+48
+CNSTI4 0
+ASGNI4
+LABELV $193
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 0+8
+INDIRI4
+LEI4 $198
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+GTI4 $198
+ADDRLP4 0+52
+CNSTI4 100
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 0+52
+CNSTI4 0
+ASGNI4
+LABELV $199
+ADDRGP4 $206
+ARGP4
+ADDRLP4 1420
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0+56
+ADDRLP4 1420
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 0
+GTI4 $207
+ADDRLP4 0+56
+CNSTI4 1
+ASGNI4
+LABELV $207
+ADDRLP4 0
+ADDRLP4 0+60
+INDIRI4
+ADDRLP4 0+52
+INDIRI4
+ADDI4
+ADDRLP4 0+48
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 0+56
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 0+8
+INDIRI4
+LEI4 $218
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1096
+INDIRI4
+LEI4 $218
+ADDRLP4 1424
+CNSTI4 1
+ASGNI4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRLP4 1424
+CNSTI4 0
+ASGNI4
+LABELV $219
+ADDRLP4 1088
+ADDRLP4 1424
+INDIRI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRGP4 uiInfo+73504
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 20000
+ADDI4
+ASGNI4
+ADDRLP4 1228
+ARGP4
+ADDRLP4 1092
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1428
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1428
+INDIRI4
+CNSTI4 0
+LTI4 $224
+ADDRLP4 1296
+CNSTI4 64
+ASGNI4
+ADDRLP4 1296
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+ADDRLP4 1092
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $224
+LABELV $220
+ADDRLP4 0+44
+INDIRI4
+ADDRLP4 1096+44
+INDIRI4
+GEI4 $226
+ADDRGP4 uiInfo+73508
+ADDRGP4 uiInfo+208
+INDIRI4
+CNSTI4 20000
+ADDI4
+ASGNI4
+LABELV $226
+ADDRGP4 $233
+ARGP4
+ADDRLP4 1428
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $232
+ARGP4
+ADDRLP4 1428
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $235
+ARGP4
+ADDRLP4 1432
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 1432
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $237
+ARGP4
+ADDRLP4 1436
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $236
+ARGP4
+ADDRLP4 1436
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $239
+ARGP4
+ADDRLP4 1440
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $238
+ARGP4
+ADDRLP4 1440
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $241
+ARGP4
+ADDRLP4 1444
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $240
+ARGP4
+ADDRLP4 1444
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $243
+ARGP4
+ADDRLP4 1448
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $245
+ARGP4
+ADDRLP4 1452
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetBestScores
+CALLV
+pop
+ADDRLP4 1088
+INDIRI4
+ARGI4
+ADDRGP4 UI_ShowPostGame
+CALLV
+pop
+LABELV $169
+endproc UI_CalcPostGameStats 1456 20
+export UI_ConsoleCommand
+proc UI_ConsoleCommand 232 12
+ADDRGP4 uiInfo+212
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+208
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uiInfo+208
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $250
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_ShowPostGame
+CALLV
+pop
+LABELV $250
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRGP4 UI_Report
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $253
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $256
+ADDRGP4 UI_Load
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $256
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+NEI4 $262
+CNSTI4 1
+ARGI4
+ADDRLP4 220
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 224
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 228
+ADDRGP4 UI_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $262
+LABELV $259
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $266
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRGP4 UI_CalcPostGameStats
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $264
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRGP4 UI_Cache_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $267
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $270
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $270
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $273
+CNSTI4 1
+RETI4
+ADDRGP4 $246
+JUMPV
+LABELV $273
+CNSTI4 0
+RETI4
+LABELV $246
+endproc UI_ConsoleCommand 232 12
+export UI_Shutdown
+proc UI_Shutdown 0 0
+LABELV $276
+endproc UI_Shutdown 0 0
+export UI_AdjustFrom640
+proc UI_AdjustFrom640 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+200
+INDIRF4
+MULF4
+ADDRGP4 uiInfo+204
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+200
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+196
+INDIRF4
+MULF4
+ASGNF4
+LABELV $277
+endproc UI_AdjustFrom640 16 0
+export UI_DrawNamedPic
+proc UI_DrawNamedPic 16 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $283
+endproc UI_DrawNamedPic 16 36
+export UI_DrawHandlePic
+proc UI_DrawHandlePic 16 36
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $285
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $286
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $287
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $288
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $284
+endproc UI_DrawHandlePic 16 36
+export UI_FillRect
+proc UI_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $289
+endproc UI_FillRect 4 36
+export UI_DrawSides
+proc UI_DrawSides 12 36
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $291
+endproc UI_DrawSides 12 36
+export UI_DrawTopBottom
+proc UI_DrawTopBottom 12 36
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+73488
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $294
+endproc UI_DrawTopBottom 12 36
+export UI_DrawRect
+proc UI_DrawRect 0 16
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawTopBottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawSides
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $297
+endproc UI_DrawRect 0 16
+export UI_SetColor
+proc UI_SetColor 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $298
+endproc UI_SetColor 0 4
+export UI_UpdateScreen
+proc UI_UpdateScreen 0 0
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $299
+endproc UI_UpdateScreen 0 0
+export UI_DrawTextBox
+proc UI_DrawTextBox 24 20
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $300
+endproc UI_DrawTextBox 24 20
+export UI_CursorInRect
+proc UI_CursorInRect 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+216
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $310
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $310
+ADDRGP4 uiInfo+216
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+GTI4 $310
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+LEI4 $302
+LABELV $310
+CNSTI4 0
+RETI4
+ADDRGP4 $301
+JUMPV
+LABELV $302
+CNSTI4 1
+RETI4
+LABELV $301
+endproc UI_CursorInRect 8 0
+import wideAdjustX
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetBotNameByNumber
+import UI_LoadBots
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_R_RemapShader
+import trap_RealTime
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_S_StartBackgroundTrack
+import trap_S_StopBackgroundTrack
+import trap_R_RegisterFont
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_CompareServers
+import trap_LAN_ServerStatus
+import trap_LAN_ResetPings
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_SaveCachedServers
+import trap_LAN_LoadCachedServers
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+bss
+export m_entersound
+align 4
+LABELV m_entersound
+skip 4
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Init
+import uiInfo
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayersBust
+import UI_DrawPlayerOC
+import UI_DrawPlayerII
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import SP_LoadGame
+import UI_LoadArenas
+import UI_ShowPostGame
+import UI_AdjustTimeByGame
+import _UI_SetActiveMenu
+import UI_LoadMenus
+import UI_Load
+import UI_Report
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_introPlayed
+import ui_humansonly
+import ui_serverStatusTimeOut
+import ui_bigFont
+import ui_smallFont
+import ui_scoreTime
+import ui_scoreShutoutBonus
+import ui_scoreSkillBonus
+import ui_scoreTimeBonus
+import ui_scoreBase
+import ui_scoreTeam
+import ui_scorePerfect
+import ui_scoreScore
+import ui_scoreGauntlets
+import ui_scoreAssists
+import ui_scoreDefends
+import ui_scoreExcellents
+import ui_scoreImpressives
+import ui_scoreAccuracy
+import ui_singlePlayerActive
+import ui_lastServerRefresh_3
+import ui_lastServerRefresh_2
+import ui_lastServerRefresh_1
+import ui_lastServerRefresh_0
+import ui_selectedPlayerName
+import ui_selectedPlayer
+import ui_currentOpponent
+import ui_mapIndex
+import ui_currentNetMap
+import ui_currentMap
+import ui_currentTier
+import ui_introFiles
+import ui_menuFiles
+import ui_opponentName
+import ui_dedicated
+import ui_serverFilterType
+import ui_netSource
+import ui_joinGameType
+import ui_actualNetGameType
+import ui_netGameType
+import ui_gameType
+import ui_fragLimit
+import ui_captureLimit
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import Item_Text_AutoWrapped_Paint
+import trap_PC_SourceFileAndLine
+import trap_PC_ReadToken
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_AddGlobalDefine
+import Controls_SetDefaults
+import Controls_SetConfig
+import Controls_GetConfig
+import UI_OutOfMemory
+import UI_InitMemory
+import UI_Alloc
+import Display_CacheAll
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Item_EnableShowViaCvar
+import Menu_PaintEnd
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import MapInfoGet
+import MatchesGametype
+import BG_TeamName
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_DefragmentMemory
+import BG_Free
+import BG_InitMemory
+import BG_Alloc
+import BG_CanAlloc
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_SetValueForKey_Big
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import Matrix4Compare
+import RotateAroundDirection
+import RotatePointAroundVector
+import PlaneFromPoints
+import AnglesSubtract
+import AngleSubtract
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_acos
+import Q_log2
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import AddPointToBounds
+import RadiusFromBounds
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import Distance
+import DistanceSquared
+import VectorCompare
+import VectorInverse
+import VectorLength
+import VectorLengthSquared
+import CrossProduct
+import qsnapvectorsse
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import Hunk_AllocDebug
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $275
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $272
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $269
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $266
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $261
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $258
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $255
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $252
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $245
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $244
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $243
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $242
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $241
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $240
+byte 1 103
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $239
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $238
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $237
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $236
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $235
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $234
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $233
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $232
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $206
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $188
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $167
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $158
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $157
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $151
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $150
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 100
+byte 1 109
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $145
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $143
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $142
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $141
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $140
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $139
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $138
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $137
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $136
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 50
+byte 1 0
+align 1
+LABELV $135
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $134
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $133
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $132
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $131
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $130
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $129
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 50
+byte 1 0
+align 1
+LABELV $126
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $125
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $124
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $123
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $122
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $121
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $120
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $119
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $118
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $117
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $116
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $115
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $114
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $112
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $111
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $110
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $108
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $102
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $93
+byte 1 37
+byte 1 115
+byte 1 0
@@ -111,6 +111,7 @@ typedef struct bot_synonym_s
 {
 	char *string;
 	float weight;
+	int stringnum;						//string number in the synonym automaton
 	struct bot_synonym_s *next;
 } bot_synonym_t;
 //list with synonyms
@@ -126,6 +127,7 @@ typedef struct bot_synonymlist_s
 typedef struct bot_matchstring_s
 {
 	char *string;
+	int stringnum;						//string number in the match automaton
 	struct bot_matchstring_s *next;
 } bot_matchstring_t;
 
@@ -165,6 +167,21 @@ typedef struct bot_replychat_s
 	struct bot_replychat_s *next;
 } bot_replychat_t;
 
+//automaton used to find all the strings of a set that occur in a message
+//with a single case insensitive pass over the message (Aho-Corasick)
+typedef struct bot_stringautomaton_s
+{
+	int numstates;						//number of automaton states
+	int numclasses;						//number of character classes
+	int numstrings;						//number of unique strings
+	unsigned char charclass[256];		//character class of every upper case character
+	int *transitions;					//numstates * numclasses state transitions
+	int *output;						//string ending in each state or -1
+	int *dictlink;						//next state on the fail chain with output or 0
+	int *found;							//scan number in which each string was found
+	int scannum;						//number of the last scan
+} bot_stringautomaton_t;
+
 //string list
 typedef struct bot_stringlist_s
 {
@@ -205,6 +222,10 @@ bot_consolemessage_t *freeconsolemessages = NULL;
 bot_matchtemplate_t *matchtemplates = NULL;
 //list with synonyms
 bot_synonymlist_t *synonyms = NULL;
+//automaton with all the synonym strings
+bot_stringautomaton_t *synonymautomaton = NULL;
+//automaton with all the match template strings
+bot_stringautomaton_t *matchautomaton = NULL;
 //list with random strings
 bot_randomlist_t *randomstrings = NULL;
 //reply chats
@@ -547,9 +568,12 @@ char *StringContainsWord(char *str1, char *str2, int casesensitive)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-void StringReplaceWords(char *string, char *synonym, char *replacement)
+int StringReplaceWords(char *string, char *synonym, char *replacement)
 {
 	char *str, *str2;
+	int numreplaced;
+
+	numreplaced = 0;
 
 	//find the synonym in the string
 	str = StringContainsWord(string, synonym, qfalse);
@@ -569,12 +593,164 @@ void StringReplaceWords(char *string, char *synonym, char *replacement)
 			memmove(str + strlen(replacement), str+strlen(synonym), strlen(str+strlen(synonym))+1);
 			//append the synonum replacement
 			memcpy(str, replacement, strlen(replacement));
+			numreplaced++;
 		} //end if
 		//find the next synonym in the string
 		str = StringContainsWord(str+strlen(replacement), synonym, qfalse);
 	} //end if
+	return numreplaced;
 } //end of the function StringReplaceWords
 //===========================================================================
+// builds an automaton that finds all the given strings in a message
+// with one case insensitive pass over the message
+// the string numbers of the unique strings are stored in stringnums
+//
+// Parameter:			strings		: strings to find
+//						stringnums	: unique string number of every string
+//						numstrings	: number of strings
+// Returns:				the automaton or NULL if there are no strings
+// Changes Globals:		-
+//===========================================================================
+bot_stringautomaton_t *BotBuildStringAutomaton(char **strings, int *stringnums, int numstrings)
+{
+	int i, c, maxstates, numclasses, numunique, state, next, fail;
+	int *queue, *faillink, queuestart, queueend;
+	unsigned char charclass[256];
+	char *ptr;
+	bot_stringautomaton_t *sa;
+
+	//give every upper case character that occurs in a string its own class,
+	//all other characters share class zero (when there are more than 255
+	//different characters the remaining ones also end up in class zero which
+	//only causes false positives)
+	memset(charclass, 0, sizeof(charclass));
+	numclasses = 1;
+	maxstates = 1;
+	for (i = 0; i < numstrings; i++)
+	{
+		for (ptr = strings[i]; *ptr; ptr++)
+		{
+			c = toupper((unsigned char) *ptr);
+			if (!charclass[c] && numclasses < 256)
+			{
+				charclass[c] = numclasses++;
+			} //end if
+			maxstates++;
+		} //end for
+	} //end for
+	if (maxstates <= 1) return NULL;
+	//
+	sa = (bot_stringautomaton_t *) GetClearedMemory(sizeof(bot_stringautomaton_t) +
+						maxstates * numclasses * sizeof(int) +
+						maxstates * 2 * sizeof(int) +
+						numstrings * sizeof(int));
+	sa->transitions = (int *) ((char *) sa + sizeof(bot_stringautomaton_t));
+	sa->output = sa->transitions + maxstates * numclasses;
+	sa->dictlink = sa->output + maxstates;
+	sa->found = sa->dictlink + maxstates;
+	memcpy(sa->charclass, charclass, sizeof(charclass));
+	sa->numclasses = numclasses;
+	for (i = 0; i < maxstates; i++) sa->output[i] = -1;
+	//build the trie, state zero is the root and never a child
+	sa->numstates = 1;
+	numunique = 0;
+	for (i = 0; i < numstrings; i++)
+	{
+		stringnums[i] = -1;
+		if (!*strings[i]) continue;
+		state = 0;
+		for (ptr = strings[i]; *ptr; ptr++)
+		{
+			c = sa->charclass[toupper((unsigned char) *ptr)];
+			next = sa->transitions[state * numclasses + c];
+			if (!next)
+			{
+				next = sa->numstates++;
+				sa->transitions[state * numclasses + c] = next;
+			} //end if
+			state = next;
+		} //end for
+		//the same string may be used several times
+		if (sa->output[state] < 0) sa->output[state] = numunique++;
+		stringnums[i] = sa->output[state];
+	} //end for
+	sa->numstrings = numunique;
+	//breadth first calculate the fail links and turn the trie into
+	//a deterministic automaton
+	queue = (int *) GetClearedMemory(sa->numstates * 2 * sizeof(int));
+	faillink = queue + sa->numstates;
+	queuestart = queueend = 0;
+	for (c = 0; c < numclasses; c++)
+	{
+		next = sa->transitions[c];
+		if (next) queue[queueend++] = next;
+	} //end for
+	while(queuestart < queueend)
+	{
+		state = queue[queuestart++];
+		fail = faillink[state];
+		//the dictionary link is the closest state on the fail chain with output
+		if (sa->output[fail] >= 0) sa->dictlink[state] = fail;
+		else sa->dictlink[state] = sa->dictlink[fail];
+		//
+		for (c = 0; c < numclasses; c++)
+		{
+			next = sa->transitions[state * numclasses + c];
+			if (next)
+			{
+				faillink[next] = sa->transitions[fail * numclasses + c];
+				queue[queueend++] = next;
+			} //end if
+			else
+			{
+				sa->transitions[state * numclasses + c] = sa->transitions[fail * numclasses + c];
+			} //end else
+		} //end for
+	} //end while
+	FreeMemory(queue);
+	return sa;
+} //end of the function BotBuildStringAutomaton
+//===========================================================================
+// marks all the automaton strings that occur in the given string
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotScanStringAutomaton(bot_stringautomaton_t *sa, char *str)
+{
+	int state, s;
+
+	sa->scannum++;
+	if (sa->scannum <= 0)
+	{
+		memset(sa->found, 0, sa->numstrings * sizeof(int));
+		sa->scannum = 1;
+	} //end if
+	state = 0;
+	for (; *str; str++)
+	{
+		state = sa->transitions[state * sa->numclasses + sa->charclass[toupper((unsigned char) *str)]];
+		for (s = state; s; s = sa->dictlink[s])
+		{
+			if (sa->output[s] >= 0) sa->found[sa->output[s]] = sa->scannum;
+		} //end for
+	} //end for
+} //end of the function BotScanStringAutomaton
+//===========================================================================
+// returns true if the string was found with the last scan
+// strings that are not part of the automaton are always considered found
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotStringAutomatonFound(bot_stringautomaton_t *sa, int stringnum)
+{
+	if (stringnum < 0 || stringnum >= sa->numstrings) return qtrue;
+	return sa->found[stringnum] == sa->scannum;
+} //end of the function BotStringAutomatonFound
+//===========================================================================
 //
 // Parameter:				-
 // Returns:					-
@@ -768,6 +944,49 @@ bot_synonymlist_t *BotLoadSynonyms(char *filename)
 	return synlist;
 } //end of the function BotLoadSynonyms
 //===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+bot_stringautomaton_t *BotBuildSynonymAutomaton(bot_synonymlist_t *synlist)
+{
+	int numstrings, *stringnums;
+	char **strings;
+	bot_synonymlist_t *syn;
+	bot_synonym_t *synonym;
+	bot_stringautomaton_t *sa;
+
+	numstrings = 0;
+	for (syn = synlist; syn; syn = syn->next)
+	{
+		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next) numstrings++;
+	} //end for
+	if (!numstrings) return NULL;
+	strings = (char **) GetClearedMemory(numstrings * (sizeof(char *) + sizeof(int)));
+	stringnums = (int *) (strings + numstrings);
+	numstrings = 0;
+	for (syn = synlist; syn; syn = syn->next)
+	{
+		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next)
+		{
+			strings[numstrings++] = synonym->string;
+		} //end for
+	} //end for
+	sa = BotBuildStringAutomaton(strings, stringnums, numstrings);
+	numstrings = 0;
+	for (syn = synlist; syn; syn = syn->next)
+	{
+		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next)
+		{
+			synonym->stringnum = sa ? stringnums[numstrings] : -1;
+			numstrings++;
+		} //end for
+	} //end for
+	FreeMemory(strings);
+	return sa;
+} //end of the function BotBuildSynonymAutomaton
+//===========================================================================
 // replace all the synonyms in the string
 //
 // Parameter:				-
@@ -779,12 +998,27 @@ void BotReplaceSynonyms(char *string, unsigned long int context)
 	bot_synonymlist_t *syn;
 	bot_synonym_t *synonym;
 
+	//find all the synonyms in the string with one pass
+	if (synonymautomaton) BotScanStringAutomaton(synonymautomaton, string);
 	for (syn = synonyms; syn; syn = syn->next)
 	{
 		if (!(syn->context & context)) continue;
 		for (synonym = syn->firstsynonym->next; synonym; synonym = synonym->next)
 		{
-			StringReplaceWords(string, synonym->string, syn->firstsynonym->string);
+			if (synonymautomaton)
+			{
+				//the synonym can't be replaced if it doesn't occur in the string
+				if (!BotStringAutomatonFound(synonymautomaton, synonym->stringnum)) continue;
+				//a replacement changes the string so rescan it
+				if (StringReplaceWords(string, synonym->string, syn->firstsynonym->string))
+				{
+					BotScanStringAutomaton(synonymautomaton, string);
+				} //end if
+			} //end if
+			else
+			{
+				StringReplaceWords(string, synonym->string, syn->firstsynonym->string);
+			} //end else
 		} //end for
 	} //end for
 } //end of the function BotReplaceSynonyms
@@ -800,6 +1034,7 @@ void BotReplaceWeightedSynonyms(char *string, unsigned long int context)
 	bot_synonym_t *synonym, *replacement;
 	float weight, curweight;
 
+	if (synonymautomaton) BotScanStringAutomaton(synonymautomaton, string);
 	for (syn = synonyms; syn; syn = syn->next)
 	{
 		if (!(syn->context & context)) continue;
@@ -817,7 +1052,18 @@ void BotReplaceWeightedSynonyms(char *string, unsigned long int context)
 		for (synonym = syn->firstsynonym; synonym; synonym = synonym->next)
 		{
 			if (synonym == replacement) continue;
-			StringReplaceWords(string, synonym->string, replacement->string);
+			if (synonymautomaton)
+			{
+				if (!BotStringAutomatonFound(synonymautomaton, synonym->stringnum)) continue;
+				if (StringReplaceWords(string, synonym->string, replacement->string))
+				{
+					BotScanStringAutomaton(synonymautomaton, string);
+				} //end if
+			} //end if
+			else
+			{
+				StringReplaceWords(string, synonym->string, replacement->string);
+			} //end else
 		} //end for
 	} //end for
 } //end of the function BotReplaceWeightedSynonyms
@@ -833,6 +1079,7 @@ void BotReplaceReplySynonyms(char *string, unsigned long int context)
 	bot_synonymlist_t *syn;
 	bot_synonym_t *synonym;
 
+	if (synonymautomaton) BotScanStringAutomaton(synonymautomaton, string);
 	for (str1 = string; *str1; )
 	{
 		//go to the start of the next word
@@ -844,6 +1091,9 @@ void BotReplaceReplySynonyms(char *string, unsigned long int context)
 			if (!(syn->context & context)) continue;
 			for (synonym = syn->firstsynonym->next; synonym; synonym = synonym->next)
 			{
+				//if the synonym doesn't occur anywhere in the string continue
+				if (synonymautomaton &&
+					!BotStringAutomatonFound(synonymautomaton, synonym->stringnum)) continue;
 				//if the synonym is not at the front of the string continue
 				str2 = StringContainsWord(str1, synonym->string, qfalse);
 				if (!str2 || str2 != str1) continue;
@@ -858,6 +1108,7 @@ void BotReplaceReplySynonyms(char *string, unsigned long int context)
 				//append the synonum replacement
 				memcpy(str1, replacement, strlen(replacement));
 				//
+				if (synonymautomaton) BotScanStringAutomaton(synonymautomaton, string);
 				break;
 			} //end for
 			//if a synonym has been replaced
@@ -1225,6 +1476,7 @@ bot_matchpiece_t *BotLoadMatchPieces(source_t *source, char *endtoken)
 				StripDoubleQuotes(token.string);
 				matchstring = (bot_matchstring_t *) GetClearedHunkMemory(sizeof(bot_matchstring_t) + strlen(token.string) + 1);
 				matchstring->string = (char *) matchstring + sizeof(bot_matchstring_t);
+				matchstring->stringnum = -1;
 				strcpy(matchstring->string, token.string);
 				if (!strlen(token.string)) emptystring = qtrue;
 				matchstring->next = NULL;
@@ -1374,6 +1626,87 @@ bot_matchtemplate_t *BotLoadMatchTemplates(char *matchfile)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
+bot_stringautomaton_t *BotBuildMatchAutomaton(bot_matchtemplate_t *matches)
+{
+	int numstrings, *stringnums;
+	char **strings;
+	bot_matchtemplate_t *mt;
+	bot_matchpiece_t *mp;
+	bot_matchstring_t *ms;
+	bot_stringautomaton_t *sa;
+
+	numstrings = 0;
+	for (mt = matches; mt; mt = mt->next)
+	{
+		for (mp = mt->first; mp; mp = mp->next)
+		{
+			if (mp->type != MT_STRING) continue;
+			for (ms = mp->firststring; ms; ms = ms->next) numstrings++;
+		} //end for
+	} //end for
+	if (!numstrings) return NULL;
+	strings = (char **) GetClearedMemory(numstrings * (sizeof(char *) + sizeof(int)));
+	stringnums = (int *) (strings + numstrings);
+	numstrings = 0;
+	for (mt = matches; mt; mt = mt->next)
+	{
+		for (mp = mt->first; mp; mp = mp->next)
+		{
+			if (mp->type != MT_STRING) continue;
+			for (ms = mp->firststring; ms; ms = ms->next)
+			{
+				strings[numstrings++] = ms->string;
+			} //end for
+		} //end for
+	} //end for
+	sa = BotBuildStringAutomaton(strings, stringnums, numstrings);
+	numstrings = 0;
+	for (mt = matches; mt; mt = mt->next)
+	{
+		for (mp = mt->first; mp; mp = mp->next)
+		{
+			if (mp->type != MT_STRING) continue;
+			for (ms = mp->firststring; ms; ms = ms->next)
+			{
+				ms->stringnum = sa ? stringnums[numstrings] : -1;
+				numstrings++;
+			} //end for
+		} //end for
+	} //end for
+	FreeMemory(strings);
+	return sa;
+} //end of the function BotBuildMatchAutomaton
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int StringsPossiblyMatch(bot_stringautomaton_t *sa, bot_matchpiece_t *pieces)
+{
+	bot_matchpiece_t *mp;
+	bot_matchstring_t *ms;
+
+	for (mp = pieces; mp; mp = mp->next)
+	{
+		if (mp->type != MT_STRING) continue;
+		for (ms = mp->firststring; ms; ms = ms->next)
+		{
+			//an empty string always matches
+			if (!*ms->string) break;
+			if (BotStringAutomatonFound(sa, ms->stringnum)) break;
+		} //end for
+		//none of the strings of this piece occurs in the message
+		if (!ms) return qfalse;
+	} //end for
+	return qtrue;
+} //end of the function StringsPossiblyMatch
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
 int StringsMatch(bot_matchpiece_t *pieces, bot_match_t *match)
 {
 	int lastvariable, index;
@@ -1463,10 +1796,14 @@ int BotFindMatch(char *str, bot_match_t *match, unsigned long int context)
 	{
 		match->string[strlen(match->string)-1] = '\0';
 	} //end while
+	//find all the match strings in the string with one pass
+	if (matchautomaton) BotScanStringAutomaton(matchautomaton, match->string);
 	//compare the string with all the match strings
 	for (ms = matchtemplates; ms; ms = ms->next)
 	{
 		if (!(ms->context & context)) continue;
+		//skip templates with strings that don't occur in the string
+		if (matchautomaton && !StringsPossiblyMatch(matchautomaton, ms->first)) continue;
 		//reset the match variable offsets
 		for (i = 0; i < MAX_MATCHVARIABLES; i++) match->variables[i].offset = -1;
 		//
@@ -2980,6 +3317,12 @@ int BotSetupChatAI(void)
 	randomstrings = BotLoadRandomStrings(file);
 	file = LibVarString("matchfile", "match.c");
 	matchtemplates = BotLoadMatchTemplates(file);
+	//compile the synonyms and match templates into automatons
+	if (LibVarValue("chatautomaton", "1"))
+	{
+		synonymautomaton = BotBuildSynonymAutomaton(synonyms);
+		matchautomaton = BotBuildMatchAutomaton(matchtemplates);
+	} //end if
 	//
 	if (!LibVarValue("nochat", "0"))
 	{
@@ -3024,6 +3367,10 @@ void BotShutdownChatAI(void)
 	} //end for
 	if (consolemessageheap) FreeMemory(consolemessageheap);
 	consolemessageheap = NULL;
+	if (matchautomaton) FreeMemory(matchautomaton);
+	matchautomaton = NULL;
+	if (synonymautomaton) FreeMemory(synonymautomaton);
+	synonymautomaton = NULL;
 	if (matchtemplates) BotFreeMatchTemplates(matchtemplates);
 	matchtemplates = NULL;
 	if (randomstrings) FreeMemory(randomstrings);
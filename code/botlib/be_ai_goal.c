@@ -227,6 +227,8 @@ void BotInterbreedGoalFuzzyLogic(int parent1, int parent2, int child)
 	p2 = BotGoalStateFromHandle(parent2);
 	c = BotGoalStateFromHandle(child);
 
+	//the child gets its own copy of a shared weight config
+	c->itemweightconfig = PrivateWeightConfig(c->itemweightconfig);
 	InterbreedWeightConfigs(p1->itemweightconfig, p2->itemweightconfig,
 									c->itemweightconfig);
 } //end of the function BotInterbreedingGoalFuzzyLogic
@@ -256,6 +258,8 @@ void BotMutateGoalFuzzyLogic(int goalstate, float range)
 
 	gs = BotGoalStateFromHandle(goalstate);
 
+	//don't mutate the weights of other bots sharing the config
+	gs->itemweightconfig = PrivateWeightConfig(gs->itemweightconfig);
 	EvolveWeightConfig(gs->itemweightconfig);
 } //end of the function BotMutateGoalFuzzyLogic
 //===========================================================================
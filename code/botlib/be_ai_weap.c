@@ -403,8 +403,8 @@ void BotGetWeaponInfo(int weaponstate, int weapon, weaponinfo_t *weaponinfo)
 //===========================================================================
 int BotChooseBestFightWeapon(int weaponstate, int *inventory)
 {
-	int i, index, bestweapon;
-	float weight, bestweight;
+	int i, first, num, bestweapon;
+	float weights[MAX_WEIGHTS], bestweight;
 	weaponconfig_t *wc;
 	bot_weaponstate_t *ws;
 
@@ -418,17 +418,22 @@ int BotChooseBestFightWeapon(int weaponstate, int *inventory)
 
 	bestweight = 0;
 	bestweapon = 0;
-	for (i = 0; i < wc->numweapons; i++)
+	for (first = 0; first < wc->numweapons; first += num)
 	{
-		if (!wc->weaponinfo[i].valid) continue;
-		index = ws->weaponweightindex[i];
-		if (index < 0) continue;
-		weight = FuzzyWeight(inventory, ws->weaponweightconfig, index);
-		if (weight > bestweight)
+		num = wc->numweapons - first;
+		if (num > MAX_WEIGHTS) num = MAX_WEIGHTS;
+		//evaluate the weights of all the weapons at once
+		FuzzyWeights(inventory, ws->weaponweightconfig, &ws->weaponweightindex[first], weights, num);
+		for (i = 0; i < num; i++)
 		{
-			bestweight = weight;
-			bestweapon = i;
-		} //end if
+			if (!wc->weaponinfo[first + i].valid) continue;
+			if (ws->weaponweightindex[first + i] < 0) continue;
+			if (weights[i] > bestweight)
+			{
+				bestweight = weights[i];
+				bestweapon = first + i;
+			} //end if
+		} //end for
 	} //end for
 	return bestweapon;
 } //end of the function BotChooseBestFightWeapon
@@ -131,13 +131,6 @@ void FreeFuzzySeperators_r(fuzzyseperator_t *fs)
 //===========================================================================
 void FreeWeightConfig2(weightconfig_t *config)
 {
-	int i;
-
-	for (i = 0; i < config->numweights; i++)
-	{
-		FreeFuzzySeperators_r(config->weights[i].firstseperator);
-		if (config->weights[i].name) FreeMemory(config->weights[i].name);
-	} //end for
 	FreeMemory(config);
 } //end of the function FreeWeightConfig2
 //===========================================================================
@@ -148,10 +141,137 @@ void FreeWeightConfig2(weightconfig_t *config)
 //===========================================================================
 void FreeWeightConfig(weightconfig_t *config)
 {
-	if (!LibVarGetValue("bot_reloadcharacters")) return;
+	//shared configs are freed when the weights are shut down
+	if (config->shared) return;
 	FreeWeightConfig2(config);
 } //end of the function FreeWeightConfig
 //===========================================================================
+// returns a copy of the config when it's shared with other bots
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+weightconfig_t *PrivateWeightConfig(weightconfig_t *config)
+{
+	int i;
+	weightconfig_t *copy;
+
+	if (!config->shared) return config;
+	copy = (weightconfig_t *) GetMemory(config->size);
+	memcpy(copy, config, config->size);
+	//relocate the pointers into the copy
+	copy->nodes = (fuzzynode_t *) ((char *) copy + ((char *) config->nodes - (char *) config));
+	for (i = 0; i < copy->numweights; i++)
+	{
+		copy->weights[i].name = (char *) copy + (config->weights[i].name - (char *) config);
+	} //end for
+	copy->shared = qfalse;
+	return copy;
+} //end of the function PrivateWeightConfig
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+int NumFuzzySeperators_r(fuzzyseperator_t *fs)
+{
+	int n;
+
+	for (n = 0; fs; fs = fs->next)
+	{
+		n += 1 + NumFuzzySeperators_r(fs->child);
+	} //end for
+	return n;
+} //end of the function NumFuzzySeperators_r
+//===========================================================================
+// stores the fuzzy seperators depth first in the node array
+//
+// Parameter:			-
+// Returns:				index of the first node
+// Changes Globals:		-
+//===========================================================================
+int FlattenFuzzySeperators_r(fuzzyseperator_t *fs, fuzzynode_t *nodes, int *numnodes)
+{
+	int first, prev, n;
+
+	first = -1;
+	prev = -1;
+	for (; fs; fs = fs->next)
+	{
+		n = (*numnodes)++;
+		nodes[n].index = fs->index;
+		nodes[n].value = fs->value;
+		nodes[n].type = fs->type;
+		nodes[n].weight = fs->weight;
+		nodes[n].minweight = fs->minweight;
+		nodes[n].maxweight = fs->maxweight;
+		nodes[n].next = -1;
+		if (prev >= 0) nodes[prev].next = n;
+		else first = n;
+		prev = n;
+		//the child nodes directly follow the node
+		if (fs->child) nodes[n].child = FlattenFuzzySeperators_r(fs->child, nodes, numnodes);
+		else nodes[n].child = -1;
+	} //end for
+	return first;
+} //end of the function FlattenFuzzySeperators_r
+//===========================================================================
+// creates a weight config with all the nodes and names in one memory block
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+weightconfig_t *CreateWeightConfig(char *filename, char **names, fuzzyseperator_t **seperators, int numweights)
+{
+	int i, numnodes, size;
+	char *ptr;
+	weightconfig_t *config;
+
+	numnodes = 0;
+	size = sizeof(weightconfig_t);
+	for (i = 0; i < numweights; i++)
+	{
+		numnodes += NumFuzzySeperators_r(seperators[i]);
+		size += PAD(strlen(names[i]) + 1, sizeof(long));
+	} //end for
+	size += numnodes * sizeof(fuzzynode_t);
+	//
+	config = (weightconfig_t *) GetClearedMemory(size);
+	config->size = size;
+	config->shared = qfalse;
+	Q_strncpyz(config->filename, filename, sizeof(config->filename));
+	config->nodes = (fuzzynode_t *) (config + 1);
+	ptr = (char *) (config->nodes + numnodes);
+	for (i = 0; i < numweights; i++)
+	{
+		config->weights[i].name = ptr;
+		strcpy(ptr, names[i]);
+		ptr += PAD(strlen(names[i]) + 1, sizeof(long));
+		config->weights[i].firstnode = FlattenFuzzySeperators_r(seperators[i], config->nodes, &config->numnodes);
+	} //end for
+	config->numweights = numweights;
+	return config;
+} //end of the function CreateWeightConfig
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void FreeWeightDefinitions(char **names, fuzzyseperator_t **seperators, int numweights)
+{
+	int i;
+
+	for (i = 0; i < numweights; i++)
+	{
+		FreeFuzzySeperators_r(seperators[i]);
+		if (names[i]) FreeMemory(names[i]);
+	} //end for
+} //end of the function FreeWeightDefinitions
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -284,10 +404,12 @@ fuzzyseperator_t *ReadFuzzySeperators_r(source_t *source)
 //===========================================================================
 weightconfig_t *ReadWeightConfig(char *filename)
 {
-	int newindent, avail = 0, n;
+	int newindent, avail = 0, n, numweights;
 	token_t token;
 	source_t *source;
 	fuzzyseperator_t *fs;
+	char *names[MAX_WEIGHTS];
+	fuzzyseperator_t *seperators[MAX_WEIGHTS];
 	weightconfig_t *config = NULL;
 #ifdef DEBUG
 	int starttime;
@@ -331,31 +453,31 @@ weightconfig_t *ReadWeightConfig(char *filename)
 		return NULL;
 	} //end if
 	//
-	config = (weightconfig_t *) GetClearedMemory(sizeof(weightconfig_t));
-	config->numweights = 0;
-	Q_strncpyz( config->filename, filename, sizeof(config->filename) );
+	numweights = 0;
 	//parse the item config file
 	while(PC_ReadToken(source, &token))
 	{
 		if (!strcmp(token.string, "weight"))
 		{
-			if (config->numweights >= MAX_WEIGHTS)
+			if (numweights >= MAX_WEIGHTS)
 			{
 				SourceWarning(source, "too many fuzzy weights");
 				break;
 			} //end if
 			if (!PC_ExpectTokenType(source, TT_STRING, 0, &token))
 			{
-				FreeWeightConfig(config);
+				FreeWeightDefinitions(names, seperators, numweights);
 				FreeSource(source);
 				return NULL;
 			} //end if
 			StripDoubleQuotes(token.string);
-			config->weights[config->numweights].name = (char *) GetClearedMemory(strlen(token.string) + 1);
-			strcpy(config->weights[config->numweights].name, token.string);
+			names[numweights] = (char *) GetClearedMemory(strlen(token.string) + 1);
+			strcpy(names[numweights], token.string);
+			seperators[numweights] = NULL;
+			numweights++;
 			if (!PC_ExpectAnyToken(source, &token))
 			{
-				FreeWeightConfig(config);
+				FreeWeightDefinitions(names, seperators, numweights);
 				FreeSource(source);
 				return NULL;
 			} //end if
@@ -365,7 +487,7 @@ weightconfig_t *ReadWeightConfig(char *filename)
 				newindent = qtrue;
 				if (!PC_ExpectAnyToken(source, &token))
 				{
-					FreeWeightConfig(config);
+					FreeWeightDefinitions(names, seperators, numweights);
 					FreeSource(source);
 					return NULL;
 				} //end if
@@ -375,11 +497,11 @@ weightconfig_t *ReadWeightConfig(char *filename)
 				fs = ReadFuzzySeperators_r(source);
 				if (!fs)
 				{
-					FreeWeightConfig(config);
+					FreeWeightDefinitions(names, seperators, numweights);
 					FreeSource(source);
 					return NULL;
 				} //end if
-				config->weights[config->numweights].firstseperator = fs;
+				seperators[numweights - 1] = fs;
 			} //end if
 			else if (!strcmp(token.string, "return"))
 			{
@@ -391,16 +513,16 @@ weightconfig_t *ReadWeightConfig(char *filename)
 				if (!ReadFuzzyWeight(source, fs))
 				{
 					FreeMemory(fs);
-					FreeWeightConfig(config);
+					FreeWeightDefinitions(names, seperators, numweights);
 					FreeSource(source);
 					return NULL;
 				} //end if
-				config->weights[config->numweights].firstseperator = fs;
+				seperators[numweights - 1] = fs;
 			} //end else if
 			else
 			{
 				SourceError(source, "invalid name %s", token.string);
-				FreeWeightConfig(config);
+				FreeWeightDefinitions(names, seperators, numweights);
 				FreeSource(source);
 				return NULL;
 			} //end else
@@ -408,23 +530,25 @@ weightconfig_t *ReadWeightConfig(char *filename)
 			{
 				if (!PC_ExpectTokenString(source, "}"))
 				{
-					FreeWeightConfig(config);
+					FreeWeightDefinitions(names, seperators, numweights);
 					FreeSource(source);
 					return NULL;
 				} //end if
 			} //end if
-			config->numweights++;
 		} //end if
 		else
 		{
 			SourceError(source, "invalid name %s", token.string);
-			FreeWeightConfig(config);
+			FreeWeightDefinitions(names, seperators, numweights);
 			FreeSource(source);
 			return NULL;
 		} //end else
 	} //end while
 	//free the source at the end of a pass
 	FreeSource(source);
+	//store the weights in one flat memory block
+	config = CreateWeightConfig(filename, names, seperators, numweights);
+	FreeWeightDefinitions(names, seperators, numweights);
 	//if the file was located in a pak file
 	botimport.Print(PRT_MESSAGE, "loaded %s\n", filename);
 #ifdef DEBUG
@@ -436,6 +560,7 @@ weightconfig_t *ReadWeightConfig(char *filename)
 	//
 	if (!LibVarGetValue("bot_reloadcharacters"))
 	{
+		config->shared = qtrue;
 		weightFileList[avail] = config;
 	} //end if
 	//
@@ -579,36 +704,39 @@ int FindFuzzyWeight(weightconfig_t *wc, char *name)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-float FuzzyWeight_r(int *inventory, fuzzyseperator_t *fs)
+float FuzzyWeight_r(int *inventory, fuzzynode_t *nodes, int n)
 {
 	float scale, w1, w2;
+	fuzzynode_t *fs, *next;
 
-	if (inventory[fs->index] < fs->value)
-	{
-		if (fs->child) return FuzzyWeight_r(inventory, fs->child);
-		else return fs->weight;
-	} //end if
-	else if (fs->next)
+	while(1)
 	{
-		if (inventory[fs->index] < fs->next->value)
+		fs = &nodes[n];
+		if (inventory[fs->index] < fs->value)
+		{
+			if (fs->child < 0) return fs->weight;
+			n = fs->child;
+			continue;
+		} //end if
+		if (fs->next < 0) return fs->weight;
+		next = &nodes[fs->next];
+		if (inventory[fs->index] < next->value)
 		{
-			//first weight
-			if (fs->child) w1 = FuzzyWeight_r(inventory, fs->child);
-			else w1 = fs->weight;
 			//second weight
-			if (fs->next->child) w2 = FuzzyWeight_r(inventory, fs->next->child);
-			else w2 = fs->next->weight;
+			if (next->child >= 0) w2 = FuzzyWeight_r(inventory, nodes, next->child);
+			else w2 = next->weight;
 			//the scale factor
-			if(fs->next->value == MAX_INVENTORYVALUE) // is fs->next the default case?
-        		return w2;      // can't interpolate, return default weight
-			else
-				scale = (float) (inventory[fs->index] - fs->value) / (fs->next->value - fs->value);
+			if (next->value == MAX_INVENTORYVALUE) // is next the default case?
+				return w2;	// can't interpolate, return default weight
+			//first weight
+			if (fs->child >= 0) w1 = FuzzyWeight_r(inventory, nodes, fs->child);
+			else w1 = fs->weight;
+			scale = (float) (inventory[fs->index] - fs->value) / (next->value - fs->value);
 			//scale between the two weights
 			return (1 - scale) * w1 + scale * w2;
 		} //end if
-		return FuzzyWeight_r(inventory, fs->next);
-	} //end else if
-	return fs->weight;
+		n = fs->next;
+	} //end while
 } //end of the function FuzzyWeight_r
 //===========================================================================
 //
@@ -616,36 +744,39 @@ float FuzzyWeight_r(int *inventory, fuzzyseperator_t *fs)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-float FuzzyWeightUndecided_r(int *inventory, fuzzyseperator_t *fs)
+float FuzzyWeightUndecided_r(int *inventory, fuzzynode_t *nodes, int n)
 {
 	float scale, w1, w2;
+	fuzzynode_t *fs, *next;
 
-	if (inventory[fs->index] < fs->value)
-	{
-		if (fs->child) return FuzzyWeightUndecided_r(inventory, fs->child);
-		else return fs->minweight + random() * (fs->maxweight - fs->minweight);
-	} //end if
-	else if (fs->next)
+	while(1)
 	{
-		if (inventory[fs->index] < fs->next->value)
+		fs = &nodes[n];
+		if (inventory[fs->index] < fs->value)
 		{
-			//first weight
-			if (fs->child) w1 = FuzzyWeightUndecided_r(inventory, fs->child);
+			if (fs->child < 0) return fs->minweight + random() * (fs->maxweight - fs->minweight);
+			n = fs->child;
+			continue;
+		} //end if
+		if (fs->next < 0) return fs->weight;
+		next = &nodes[fs->next];
+		if (inventory[fs->index] < next->value)
+		{
+			//first weight, evaluated first to keep the order of the random numbers
+			if (fs->child >= 0) w1 = FuzzyWeightUndecided_r(inventory, nodes, fs->child);
 			else w1 = fs->minweight + random() * (fs->maxweight - fs->minweight);
 			//second weight
-			if (fs->next->child) w2 = FuzzyWeight_r(inventory, fs->next->child);
-			else w2 = fs->next->minweight + random() * (fs->next->maxweight - fs->next->minweight);
+			if (next->child >= 0) w2 = FuzzyWeight_r(inventory, nodes, next->child);
+			else w2 = next->minweight + random() * (next->maxweight - next->minweight);
 			//the scale factor
-			if(fs->next->value == MAX_INVENTORYVALUE) // is fs->next the default case?
-        		return w2;      // can't interpolate, return default weight
-			else
-				scale = (float) (inventory[fs->index] - fs->value) / (fs->next->value - fs->value);
+			if (next->value == MAX_INVENTORYVALUE) // is next the default case?
+				return w2;	// can't interpolate, return default weight
+			scale = (float) (inventory[fs->index] - fs->value) / (next->value - fs->value);
 			//scale between the two weights
 			return (1 - scale) * w1 + scale * w2;
 		} //end if
-		return FuzzyWeightUndecided_r(inventory, fs->next);
-	} //end else if
-	return fs->weight;
+		n = fs->next;
+	} //end while
 } //end of the function FuzzyWeightUndecided_r
 //===========================================================================
 //
@@ -656,22 +787,22 @@ float FuzzyWeightUndecided_r(int *inventory, fuzzyseperator_t *fs)
 float FuzzyWeight(int *inventory, weightconfig_t *wc, int weightnum)
 {
 #ifdef EVALUATERECURSIVELY
-	return FuzzyWeight_r(inventory, wc->weights[weightnum].firstseperator);
+	return FuzzyWeight_r(inventory, wc->nodes, wc->weights[weightnum].firstnode);
 #else
-	fuzzyseperator_t *s;
+	fuzzynode_t *s;
 
-	s = wc->weights[weightnum].firstseperator;
-	if (!s) return 0;
+	if (wc->weights[weightnum].firstnode < 0) return 0;
+	s = &wc->nodes[wc->weights[weightnum].firstnode];
 	while(1)
 	{
 		if (inventory[s->index] < s->value)
 		{
-			if (s->child) s = s->child;
+			if (s->child >= 0) s = &wc->nodes[s->child];
 			else return s->weight;
 		} //end if
 		else
 		{
-			if (s->next) s = s->next;
+			if (s->next >= 0) s = &wc->nodes[s->next];
 			else return s->weight;
 		} //end else
 	} //end if
@@ -687,22 +818,22 @@ float FuzzyWeight(int *inventory, weightconfig_t *wc, int weightnum)
 float FuzzyWeightUndecided(int *inventory, weightconfig_t *wc, int weightnum)
 {
 #ifdef EVALUATERECURSIVELY
-	return FuzzyWeightUndecided_r(inventory, wc->weights[weightnum].firstseperator);
+	return FuzzyWeightUndecided_r(inventory, wc->nodes, wc->weights[weightnum].firstnode);
 #else
-	fuzzyseperator_t *s;
+	fuzzynode_t *s;
 
-	s = wc->weights[weightnum].firstseperator;
-	if (!s) return 0;
+	if (wc->weights[weightnum].firstnode < 0) return 0;
+	s = &wc->nodes[wc->weights[weightnum].firstnode];
 	while(1)
 	{
 		if (inventory[s->index] < s->value)
 		{
-			if (s->child) s = s->child;
+			if (s->child >= 0) s = &wc->nodes[s->child];
 			else return s->minweight + random() * (s->maxweight - s->minweight);
 		} //end if
 		else
 		{
-			if (s->next) s = s->next;
+			if (s->next >= 0) s = &wc->nodes[s->next];
 			else return s->minweight + random() * (s->maxweight - s->minweight);
 		} //end else
 	} //end if
@@ -710,65 +841,64 @@ float FuzzyWeightUndecided(int *inventory, weightconfig_t *wc, int weightnum)
 #endif
 } //end of the function FuzzyWeightUndecided
 //===========================================================================
+// evaluates several weights of the same config for one inventory
 //
 // Parameter:				-
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-void EvolveFuzzySeperator_r(fuzzyseperator_t *fs)
+void FuzzyWeights(int *inventory, weightconfig_t *wc, int *weightnums, float *weights, int numweights)
 {
-	if (fs->child)
-	{
-		EvolveFuzzySeperator_r(fs->child);
-	} //end if
-	else if (fs->type == WT_BALANCE)
+	int i;
+	fuzzynode_t *nodes;
+	weight_t *w;
+
+	nodes = wc->nodes;
+	w = wc->weights;
+	for (i = 0; i < numweights; i++)
 	{
-		//every once in a while an evolution leap occurs, mutation
-		if (random() < 0.01) fs->weight += crandom() * (fs->maxweight - fs->minweight);
-		else fs->weight += crandom() * (fs->maxweight - fs->minweight) * 0.5;
-		//modify bounds if necesary because of mutation
-		if (fs->weight < fs->minweight) fs->minweight = fs->weight;
-		else if (fs->weight > fs->maxweight) fs->maxweight = fs->weight;
-	} //end else if
-	if (fs->next) EvolveFuzzySeperator_r(fs->next);
-} //end of the function EvolveFuzzySeperator_r
+		if (weightnums[i] < 0) weights[i] = 0;
+		else weights[i] = FuzzyWeight_r(inventory, nodes, w[weightnums[i]].firstnode);
+	} //end for
+} //end of the function FuzzyWeights
 //===========================================================================
+// returns the node range [first, last) of the weight
 //
 // Parameter:				-
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-void EvolveWeightConfig(weightconfig_t *config)
+void WeightNodeRange(weightconfig_t *config, int weightnum, int *first, int *last)
 {
-	int i;
-
-	for (i = 0; i < config->numweights; i++)
-	{
-		EvolveFuzzySeperator_r(config->weights[i].firstseperator);
-	} //end for
-} //end of the function EvolveWeightConfig
+	*first = config->weights[weightnum].firstnode;
+	if (weightnum + 1 < config->numweights) *last = config->weights[weightnum + 1].firstnode;
+	else *last = config->numnodes;
+} //end of the function WeightNodeRange
 //===========================================================================
+// the nodes are stored depth first so walking the node array visits the
+// leaves in the same order as walking the seperator trees
 //
 // Parameter:				-
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-void ScaleFuzzySeperator_r(fuzzyseperator_t *fs, float scale)
+void EvolveWeightConfig(weightconfig_t *config)
 {
-	if (fs->child)
-	{
-		ScaleFuzzySeperator_r(fs->child, scale);
-	} //end if
-	else if (fs->type == WT_BALANCE)
+	int i;
+	fuzzynode_t *fs;
+
+	for (i = 0; i < config->numnodes; i++)
 	{
-		//
-		fs->weight = (float) (fs->maxweight + fs->minweight) * scale;
-		//get the weight between bounds
-		if (fs->weight < fs->minweight) fs->weight = fs->minweight;
-		else if (fs->weight > fs->maxweight) fs->weight = fs->maxweight;
-	} //end else if
-	if (fs->next) ScaleFuzzySeperator_r(fs->next, scale);
-} //end of the function ScaleFuzzySeperator_r
+		fs = &config->nodes[i];
+		if (fs->child >= 0 || fs->type != WT_BALANCE) continue;
+		//every once in a while an evolution leap occurs, mutation
+		if (random() < 0.01) fs->weight += crandom() * (fs->maxweight - fs->minweight);
+		else fs->weight += crandom() * (fs->maxweight - fs->minweight) * 0.5;
+		//modify bounds if necesary because of mutation
+		if (fs->weight < fs->minweight) fs->minweight = fs->weight;
+		else if (fs->weight > fs->maxweight) fs->maxweight = fs->weight;
+	} //end for
+} //end of the function EvolveWeightConfig
 //===========================================================================
 //
 // Parameter:				-
@@ -777,7 +907,8 @@ void ScaleFuzzySeperator_r(fuzzyseperator_t *fs, float scale)
 //===========================================================================
 void ScaleWeight(weightconfig_t *config, char *name, float scale)
 {
-	int i;
+	int i, n, first, last;
+	fuzzynode_t *fs;
 
 	if (scale < 0) scale = 0;
 	else if (scale > 1) scale = 1;
@@ -785,7 +916,17 @@ void ScaleWeight(weightconfig_t *config, char *name, float scale)
 	{
 		if (!strcmp(name, config->weights[i].name))
 		{
-			ScaleFuzzySeperator_r(config->weights[i].firstseperator, scale);
+			WeightNodeRange(config, i, &first, &last);
+			for (n = first; n < last; n++)
+			{
+				fs = &config->nodes[n];
+				if (fs->child >= 0 || fs->type != WT_BALANCE) continue;
+				//
+				fs->weight = (float) (fs->maxweight + fs->minweight) * scale;
+				//get the weight between bounds
+				if (fs->weight < fs->minweight) fs->weight = fs->minweight;
+				else if (fs->weight > fs->maxweight) fs->weight = fs->maxweight;
+			} //end for
 			break;
 		} //end if
 	} //end for
@@ -796,15 +937,19 @@ void ScaleWeight(weightconfig_t *config, char *name, float scale)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-void ScaleFuzzySeperatorBalanceRange_r(fuzzyseperator_t *fs, float scale)
+void ScaleFuzzyBalanceRange(weightconfig_t *config, float scale)
 {
-	if (fs->child)
-	{
-		ScaleFuzzySeperatorBalanceRange_r(fs->child, scale);
-	} //end if
-	else if (fs->type == WT_BALANCE)
+	int i;
+	float mid;
+	fuzzynode_t *fs;
+
+	if (scale < 0) scale = 0;
+	else if (scale > 100) scale = 100;
+	for (i = 0; i < config->numnodes; i++)
 	{
-		float mid = (fs->minweight + fs->maxweight) * 0.5;
+		fs = &config->nodes[i];
+		if (fs->child >= 0 || fs->type != WT_BALANCE) continue;
+		mid = (fs->minweight + fs->maxweight) * 0.5;
 		//get the weight between bounds
 		fs->maxweight = mid + (fs->maxweight - mid) * scale;
 		fs->minweight = mid + (fs->minweight - mid) * scale;
@@ -812,24 +957,6 @@ void ScaleFuzzySeperatorBalanceRange_r(fuzzyseperator_t *fs, float scale)
 		{
 			fs->maxweight = fs->minweight;
 		} //end if
-	} //end else if
-	if (fs->next) ScaleFuzzySeperatorBalanceRange_r(fs->next, scale);
-} //end of the function ScaleFuzzySeperatorBalanceRange_r
-//===========================================================================
-//
-// Parameter:				-
-// Returns:					-
-// Changes Globals:		-
-//===========================================================================
-void ScaleFuzzyBalanceRange(weightconfig_t *config, float scale)
-{
-	int i;
-
-	if (scale < 0) scale = 0;
-	else if (scale > 100) scale = 100;
-	for (i = 0; i < config->numweights; i++)
-	{
-		ScaleFuzzySeperatorBalanceRange_r(config->weights[i].firstseperator, scale);
 	} //end for
 } //end of the function ScaleFuzzyBalanceRange
 //===========================================================================
@@ -838,40 +965,42 @@ void ScaleFuzzyBalanceRange(weightconfig_t *config, float scale)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-int InterbreedFuzzySeperator_r(fuzzyseperator_t *fs1, fuzzyseperator_t *fs2,
-								fuzzyseperator_t *fsout)
+int InterbreedFuzzySeperator_r(fuzzynode_t *nodes1, int fs1, fuzzynode_t *nodes2, int fs2,
+								fuzzynode_t *nodesout, int fsout)
 {
-	if (fs1->child)
+	if (nodes1[fs1].child >= 0)
 	{
-		if (!fs2->child || !fsout->child)
+		if (nodes2[fs2].child < 0 || nodesout[fsout].child < 0)
 		{
 			botimport.Print(PRT_ERROR, "cannot interbreed weight configs, unequal child\n");
 			return qfalse;
 		} //end if
-		if (!InterbreedFuzzySeperator_r(fs2->child, fs2->child, fsout->child))
+		if (!InterbreedFuzzySeperator_r(nodes2, nodes2[fs2].child, nodes2, nodes2[fs2].child,
+										nodesout, nodesout[fsout].child))
 		{
 			return qfalse;
 		} //end if
 	} //end if
-	else if (fs1->type == WT_BALANCE)
+	else if (nodes1[fs1].type == WT_BALANCE)
 	{
-		if (fs2->type != WT_BALANCE || fsout->type != WT_BALANCE)
+		if (nodes2[fs2].type != WT_BALANCE || nodesout[fsout].type != WT_BALANCE)
 		{
 			botimport.Print(PRT_ERROR, "cannot interbreed weight configs, unequal balance\n");
 			return qfalse;
 		} //end if
-		fsout->weight = (fs1->weight + fs2->weight) / 2;
-		if (fsout->weight > fsout->maxweight) fsout->maxweight = fsout->weight;
-		if (fsout->weight > fsout->minweight) fsout->minweight = fsout->weight;
+		nodesout[fsout].weight = (nodes1[fs1].weight + nodes2[fs2].weight) / 2;
+		if (nodesout[fsout].weight > nodesout[fsout].maxweight) nodesout[fsout].maxweight = nodesout[fsout].weight;
+		if (nodesout[fsout].weight > nodesout[fsout].minweight) nodesout[fsout].minweight = nodesout[fsout].weight;
 	} //end else if
-	if (fs1->next)
+	if (nodes1[fs1].next >= 0)
 	{
-		if (!fs2->next || !fsout->next)
+		if (nodes2[fs2].next < 0 || nodesout[fsout].next < 0)
 		{
 			botimport.Print(PRT_ERROR, "cannot interbreed weight configs, unequal next\n");
 			return qfalse;
 		} //end if
-		if (!InterbreedFuzzySeperator_r(fs1->next, fs2->next, fsout->next))
+		if (!InterbreedFuzzySeperator_r(nodes1, nodes1[fs1].next, nodes2, nodes2[fs2].next,
+										nodesout, nodesout[fsout].next))
 		{
 			return qfalse;
 		} //end if
@@ -898,9 +1027,9 @@ void InterbreedWeightConfigs(weightconfig_t *config1, weightconfig_t *config2,
 	} //end if
 	for (i = 0; i < config1->numweights; i++)
 	{
-		InterbreedFuzzySeperator_r(config1->weights[i].firstseperator,
-									config2->weights[i].firstseperator,
-									configout->weights[i].firstseperator);
+		InterbreedFuzzySeperator_r(config1->nodes, config1->weights[i].firstnode,
+									config2->nodes, config2->weights[i].firstnode,
+									configout->nodes, configout->weights[i].firstnode);
 	} //end for
 } //end of the function InterbreedWeightConfigs
 //===========================================================================
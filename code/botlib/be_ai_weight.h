@@ -45,11 +45,26 @@ typedef struct fuzzyseperator_s
 	struct fuzzyseperator_s *next;
 } fuzzyseperator_t;
 
+//flattened fuzzy seperator, child and next are indexes in the node array
+//of the weight configuration (-1 if none), the nodes of a weight are stored
+//depth first so every weight uses a contiguous range of nodes
+typedef struct fuzzynode_s
+{
+	int index;
+	int value;
+	int type;
+	int child;
+	int next;
+	float weight;
+	float minweight;
+	float maxweight;
+} fuzzynode_t;
+
 //fuzzy weight
 typedef struct weight_s
 {
 	char *name;
-	struct fuzzyseperator_s *firstseperator;
+	int firstnode;
 } weight_t;
 
 //weight configuration
@@ -57,6 +72,10 @@ typedef struct weightconfig_s
 {
 	int numweights;
 	weight_t weights[MAX_WEIGHTS];
+	int numnodes;
+	fuzzynode_t *nodes;
+	int size;							//size of the config including the nodes and names
+	qboolean shared;					//true if the config is shared by several bots
 	char		filename[MAX_QPATH];
 } weightconfig_t;
 
@@ -64,6 +83,8 @@ typedef struct weightconfig_s
 weightconfig_t *ReadWeightConfig(char *filename);
 //free a weight configuration
 void FreeWeightConfig(weightconfig_t *config);
+//returns a weight configuration that can be changed without affecting other bots
+weightconfig_t *PrivateWeightConfig(weightconfig_t *config);
 //writes a weight configuration, returns true if successfull
 qboolean WriteWeightConfig(char *filename, weightconfig_t *config);
 //find the fuzzy weight with the given name
@@ -71,6 +92,8 @@ int FindFuzzyWeight(weightconfig_t *wc, char *name);
 //returns the fuzzy weight for the given inventory and weight
 float FuzzyWeight(int *inventory, weightconfig_t *wc, int weightnum);
 float FuzzyWeightUndecided(int *inventory, weightconfig_t *wc, int weightnum);
+//stores the fuzzy weights for the given inventory and weights, negative weight numbers get weight zero
+void FuzzyWeights(int *inventory, weightconfig_t *wc, int *weightnums, float *weights, int numweights);
 //scales the weight with the given name
 void ScaleWeight(weightconfig_t *config, char *name, float scale);
 //scale the balance range
@@ -60,6 +60,7 @@ typedef enum {qfalse, qtrue}	qboolean;
 #include "l_script.h"
 #include "l_precomp.h"
 #include "l_log.h"
+#include "l_libvar.h"
 #endif //BOTLIB
 
 #ifdef MEQCC
@@ -119,6 +120,77 @@ token_t *freetokens;					//free tokens from the heap
 //list with global defines added to every source loaded
 define_t *globaldefines;
 
+#ifdef BOTLIB
+//precompiled sources store the tokens that come out of the pre compiler
+//together with checksums of all the files they were read from, the data
+//only uses offsets so it can be used directly after reading it from disk
+#define PCCACHE_ID				(('C'<<24)+('C'<<16)+('P'<<8)+'B')
+#define PCCACHE_VERSION			1
+#define PCCACHE_FOLDER			"botcache"
+#define MAX_PCCACHE_FILES		64
+
+typedef struct pc_cacheheader_s
+{
+	int ident;								//PCCACHE_ID
+	int version;							//PCCACHE_VERSION
+	int size;								//size of the data including this header
+	unsigned int definechecksum;			//checksum of the global defines
+	int numfiles;							//number of files the tokens were read from
+	int numtokens;							//number of tokens
+	int stringsize;							//size of the string data
+} pc_cacheheader_t;
+
+typedef struct pc_cachefile_s
+{
+	int name;								//offset of the file name in the string data
+	int length;								//length of the file
+	unsigned int checksum;					//checksum of the file contents
+} pc_cachefile_t;
+
+typedef struct pc_cachetoken_s
+{
+	int type;								//token type
+	int subtype;							//token sub type
+	unsigned int intvalue;					//integer value
+	float floatvalue;						//floating point value
+	int string;								//offset of the token string in the string data
+	int file;								//file the token was read from
+	int line;								//line the token was read from
+	int linescrossed;						//lines crossed in white space
+} pc_cachetoken_t;
+
+//precompiled source
+typedef struct pc_cache_s
+{
+	char path[MAX_PATH];					//base folder and file name
+	pc_cacheheader_t *header;				//precompiled data
+	pc_cachefile_t *files;
+	pc_cachetoken_t *tokens;
+	char *strings;
+	struct pc_cache_s *next;
+} pc_cache_t;
+
+//source being precompiled
+typedef struct pc_cachebuild_s
+{
+	int numerrors;							//errors and warnings while precompiling
+	int numfiles;
+	char filenames[MAX_PCCACHE_FILES][MAX_PATH];
+	pc_cachefile_t files[MAX_PCCACHE_FILES];
+	int numtokens, maxtokens;
+	pc_cachetoken_t *tokens;
+	int stringsize, maxstringsize;
+	char *strings;
+} pc_cachebuild_t;
+
+//list with precompiled sources
+pc_cache_t *pc_sourcecache;
+//source being precompiled
+pc_cachebuild_t *pc_cachebuild;
+//base folder the sources are loaded from
+char pc_basefolder[MAX_PATH];
+#endif //BOTLIB
+
 //============================================================================
 //
 // Parameter:				-
@@ -130,6 +202,14 @@ void QDECL SourceError(source_t *source, char *str, ...)
 	char text[1024];
 	va_list ap;
 
+#ifdef BOTLIB
+	//errors are reported when the source is loaded without precompiling
+	if (pc_cachebuild)
+	{
+		pc_cachebuild->numerrors++;
+		return;
+	} //end if
+#endif //BOTLIB
 	va_start(ap, str);
 	Q_vsnprintf(text, sizeof(text), str, ap);
 	va_end(ap);
@@ -154,6 +234,13 @@ void QDECL SourceWarning(source_t *source, char *str, ...)
 	char text[1024];
 	va_list ap;
 
+#ifdef BOTLIB
+	if (pc_cachebuild)
+	{
+		pc_cachebuild->numerrors++;
+		return;
+	} //end if
+#endif //BOTLIB
 	va_start(ap, str);
 	Q_vsnprintf(text, sizeof(text), str, ap);
 	va_end(ap);
@@ -216,6 +303,54 @@ void PC_PopIndent(source_t *source, int *type, int *skip)
 // Returns:					-
 // Changes Globals:		-
 //============================================================================
+#ifdef BOTLIB
+unsigned int PC_Checksum(unsigned int checksum, const char *data, int length)
+{
+	int i;
+
+	//FNV-1a
+	for (i = 0; i < length; i++)
+	{
+		checksum ^= (unsigned char) data[i];
+		checksum *= 16777619u;
+	} //end for
+	return checksum;
+} //end of the function PC_Checksum
+//============================================================================
+// returns the index of the script in the files of the source being
+// precompiled, the script is added when it isn't in the list yet
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+int PC_AddCacheFile(script_t *script)
+{
+	int i;
+
+	for (i = 0; i < pc_cachebuild->numfiles; i++)
+	{
+		if (!strcmp(pc_cachebuild->filenames[i], script->filename)) return i;
+	} //end for
+	if (pc_cachebuild->numfiles >= MAX_PCCACHE_FILES)
+	{
+		//can't precompile this source
+		pc_cachebuild->numerrors++;
+		return 0;
+	} //end if
+	Q_strncpyz(pc_cachebuild->filenames[i], script->filename, MAX_PATH);
+	pc_cachebuild->files[i].length = script->length;
+	pc_cachebuild->files[i].checksum = PC_Checksum(2166136261u, script->buffer, script->length);
+	pc_cachebuild->numfiles++;
+	return i;
+} //end of the function PC_AddCacheFile
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+#endif //BOTLIB
 void PC_PushScript(source_t *source, script_t *script)
 {
 	script_t *s;
@@ -231,6 +366,10 @@ void PC_PushScript(source_t *source, script_t *script)
 	//push the script on the script stack
 	script->next = source->scriptstack;
 	source->scriptstack = script;
+#ifdef BOTLIB
+	//the precompiled source depends on the included file
+	if (pc_cachebuild) PC_AddCacheFile(script);
+#endif //BOTLIB
 } //end of the function PC_PushScript
 //============================================================================
 //
@@ -2699,11 +2838,63 @@ int QuakeCMacro(source_t *source)
 // Parameter:				-
 // Returns:					-
 // Changes Globals:		-
+#ifdef BOTLIB
+//============================================================================
+// reads the next token of a precompiled source, the script on the script
+// stack only keeps the file name and line for error messages
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+int PC_ReadCachedToken(source_t *source, token_t *token)
+{
+	token_t *t;
+	pc_cache_t *cache;
+	pc_cachetoken_t *ct;
+
+	if (source->tokens)
+	{
+		//copy the already available token
+		memcpy(token, source->tokens, sizeof(token_t));
+		t = source->tokens;
+		source->tokens = source->tokens->next;
+		PC_FreeToken(t);
+	} //end if
+	else
+	{
+		cache = source->cache;
+		if (source->cachetoken >= cache->header->numtokens) return qfalse;
+		ct = &cache->tokens[source->cachetoken++];
+		Q_strncpyz(token->string, cache->strings + ct->string, sizeof(token->string));
+		token->type = ct->type;
+		token->subtype = ct->subtype;
+		token->intvalue = ct->intvalue;
+		token->floatvalue = ct->floatvalue;
+		token->whitespace_p = NULL;
+		token->endwhitespace_p = NULL;
+		token->line = ct->line;
+		token->linescrossed = ct->linescrossed;
+		token->next = NULL;
+		//keep the file and line for error messages
+		Q_strncpyz(source->scriptstack->filename,
+			cache->strings + cache->files[ct->file].name, sizeof(source->scriptstack->filename));
+		source->scriptstack->line = ct->line;
+	} //end else
+	//copy token for unreading
+	memcpy(&source->token, token, sizeof(token_t));
+	return qtrue;
+} //end of the function PC_ReadCachedToken
+#endif //BOTLIB
 //============================================================================
 int PC_ReadToken(source_t *source, token_t *token)
 {
 	define_t *define;
 
+#ifdef BOTLIB
+	//the tokens of a precompiled source are already pre compiled
+	if (source->cache) return PC_ReadCachedToken(source, token);
+#endif //BOTLIB
 	while(1)
 	{
 		if (!PC_ReadSourceToken(source, token)) return qfalse;
@@ -2980,7 +3171,7 @@ void PC_SetPunctuations(source_t *source, punctuation_t *p)
 // Returns:				-
 // Changes Globals:		-
 //============================================================================
-source_t *LoadSourceFile(const char *filename)
+source_t *PC_LoadSourceFile(const char *filename)
 {
 	source_t *source;
 	script_t *script;
@@ -3007,6 +3198,382 @@ source_t *LoadSourceFile(const char *filename)
 #endif //DEFINEHASHING
 	PC_AddGlobalDefinesToSource(source);
 	return source;
+} //end of the function PC_LoadSourceFile
+#ifdef BOTLIB
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+unsigned int PC_GlobalDefineChecksum(void)
+{
+	define_t *define;
+	token_t *t;
+	unsigned int checksum;
+
+	checksum = 2166136261u;
+	for (define = globaldefines; define; define = define->next)
+	{
+		checksum = PC_Checksum(checksum, define->name, strlen(define->name) + 1);
+		for (t = define->parms; t; t = t->next)
+		{
+			checksum = PC_Checksum(checksum, t->string, strlen(t->string) + 1);
+		} //end for
+		for (t = define->tokens; t; t = t->next)
+		{
+			checksum = PC_Checksum(checksum, t->string, strlen(t->string) + 1);
+		} //end for
+	} //end for
+	return checksum;
+} //end of the function PC_GlobalDefineChecksum
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+void PC_SetupSourceCache(pc_cache_t *cache)
+{
+	cache->files = (pc_cachefile_t *) (cache->header + 1);
+	cache->tokens = (pc_cachetoken_t *) (cache->files + cache->header->numfiles);
+	cache->strings = (char *) (cache->tokens + cache->header->numtokens);
+} //end of the function PC_SetupSourceCache
+//============================================================================
+// returns true if none of the files the precompiled source was read from
+// changed and the global defines are still the same
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+int PC_ValidSourceCache(pc_cache_t *cache)
+{
+	int i;
+	script_t *script;
+	pc_cachefile_t *file;
+
+	if (cache->header->definechecksum != PC_GlobalDefineChecksum()) return qfalse;
+	for (i = 0; i < cache->header->numfiles; i++)
+	{
+		file = &cache->files[i];
+		script = LoadScriptFile(cache->strings + file->name);
+		if (!script) return qfalse;
+		if (script->length != file->length ||
+			PC_Checksum(2166136261u, script->buffer, script->length) != file->checksum)
+		{
+			FreeScript(script);
+			return qfalse;
+		} //end if
+		FreeScript(script);
+	} //end for
+	return qtrue;
+} //end of the function PC_ValidSourceCache
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+int PC_AddCacheString(pc_cachebuild_t *build, const char *string)
+{
+	int len, ofs;
+	char *strings;
+
+	len = strlen(string) + 1;
+	if (build->stringsize + len > build->maxstringsize)
+	{
+		build->maxstringsize = (build->stringsize + len) * 2;
+		strings = (char *) GetMemory(build->maxstringsize);
+		if (build->strings)
+		{
+			memcpy(strings, build->strings, build->stringsize);
+			FreeMemory(build->strings);
+		} //end if
+		build->strings = strings;
+	} //end if
+	ofs = build->stringsize;
+	memcpy(build->strings + ofs, string, len);
+	build->stringsize += len;
+	return ofs;
+} //end of the function PC_AddCacheString
+//============================================================================
+// runs the pre compiler over the whole source and stores the tokens
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+pc_cache_t *PC_BuildSourceCache(const char *filename, const char *path)
+{
+	int i, size;
+	source_t *source;
+	token_t token;
+	pc_cachebuild_t *build;
+	pc_cachetoken_t *ct;
+	pc_cache_t *cache;
+	pc_cacheheader_t *header;
+
+	source = PC_LoadSourceFile(filename);
+	if (!source) return NULL;
+	//
+	build = (pc_cachebuild_t *) GetClearedMemory(sizeof(pc_cachebuild_t));
+	pc_cachebuild = build;
+	PC_AddCacheFile(source->scriptstack);
+	while(PC_ReadToken(source, &token))
+	{
+		if ((unsigned long) (unsigned int) token.intvalue != token.intvalue)
+		{
+			build->numerrors++;
+			break;
+		} //end if
+		if (build->numtokens >= build->maxtokens)
+		{
+			build->maxtokens = build->maxtokens ? build->maxtokens * 2 : 1024;
+			ct = (pc_cachetoken_t *) GetMemory(build->maxtokens * sizeof(pc_cachetoken_t));
+			if (build->tokens)
+			{
+				memcpy(ct, build->tokens, build->numtokens * sizeof(pc_cachetoken_t));
+				FreeMemory(build->tokens);
+			} //end if
+			build->tokens = ct;
+		} //end if
+		ct = &build->tokens[build->numtokens++];
+		ct->type = token.type;
+		ct->subtype = token.subtype;
+		ct->intvalue = token.intvalue;
+		ct->floatvalue = token.floatvalue;
+		ct->string = PC_AddCacheString(build, token.string);
+		ct->file = PC_AddCacheFile(source->scriptstack);
+		ct->line = source->scriptstack->line;
+		ct->linescrossed = token.linescrossed;
+	} //end while
+	pc_cachebuild = NULL;
+	FreeSource(source);
+	//
+	cache = NULL;
+	//sources with errors or warnings are never precompiled
+	if (!build->numerrors)
+	{
+		for (i = 0; i < build->numfiles; i++)
+		{
+			build->files[i].name = PC_AddCacheString(build, build->filenames[i]);
+		} //end for
+		size = sizeof(pc_cacheheader_t) + build->numfiles * sizeof(pc_cachefile_t) +
+				build->numtokens * sizeof(pc_cachetoken_t) + build->stringsize;
+		cache = (pc_cache_t *) GetClearedMemory(sizeof(pc_cache_t) + size);
+		Q_strncpyz(cache->path, path, sizeof(cache->path));
+		header = (pc_cacheheader_t *) (cache + 1);
+		header->ident = PCCACHE_ID;
+		header->version = PCCACHE_VERSION;
+		header->size = size;
+		header->definechecksum = PC_GlobalDefineChecksum();
+		header->numfiles = build->numfiles;
+		header->numtokens = build->numtokens;
+		header->stringsize = build->stringsize;
+		cache->header = header;
+		PC_SetupSourceCache(cache);
+		memcpy(cache->files, build->files, build->numfiles * sizeof(pc_cachefile_t));
+		if (build->numtokens) memcpy(cache->tokens, build->tokens, build->numtokens * sizeof(pc_cachetoken_t));
+		memcpy(cache->strings, build->strings, build->stringsize);
+	} //end if
+	if (build->tokens) FreeMemory(build->tokens);
+	if (build->strings) FreeMemory(build->strings);
+	FreeMemory(build);
+	return cache;
+} //end of the function PC_BuildSourceCache
+//============================================================================
+// reads a precompiled source from disk, the data is used as is
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+pc_cache_t *PC_ReadSourceCacheFile(const char *path)
+{
+	int i, length;
+	char filename[MAX_QPATH];
+	fileHandle_t fp;
+	pc_cache_t *cache;
+	pc_cacheheader_t *header;
+
+	Com_sprintf(filename, sizeof(filename), "%s/%s.pcc", PCCACHE_FOLDER, path);
+	length = botimport.FS_FOpenFile(filename, &fp, FS_READ);
+	if (!fp) return NULL;
+	if (length < (int) sizeof(pc_cacheheader_t))
+	{
+		botimport.FS_FCloseFile(fp);
+		return NULL;
+	} //end if
+	cache = (pc_cache_t *) GetClearedMemory(sizeof(pc_cache_t) + length);
+	Q_strncpyz(cache->path, path, sizeof(cache->path));
+	header = (pc_cacheheader_t *) (cache + 1);
+	botimport.FS_Read(header, length, fp);
+	botimport.FS_FCloseFile(fp);
+	cache->header = header;
+	//validate the header and all the offsets
+	if (header->ident != PCCACHE_ID || header->version != PCCACHE_VERSION ||
+		header->size != length || header->numfiles <= 0 || header->numfiles > MAX_PCCACHE_FILES ||
+		header->numtokens < 0 || header->stringsize <= 0 ||
+		header->numtokens > (length - (int) sizeof(pc_cacheheader_t)) / (int) sizeof(pc_cachetoken_t) ||
+		sizeof(pc_cacheheader_t) + header->numfiles * sizeof(pc_cachefile_t) +
+			header->numtokens * sizeof(pc_cachetoken_t) + header->stringsize != length)
+	{
+		FreeMemory(cache);
+		return NULL;
+	} //end if
+	PC_SetupSourceCache(cache);
+	if (cache->strings[header->stringsize - 1] != '\0')
+	{
+		FreeMemory(cache);
+		return NULL;
+	} //end if
+	for (i = 0; i < header->numfiles; i++)
+	{
+		if (cache->files[i].name < 0 || cache->files[i].name >= header->stringsize)
+		{
+			FreeMemory(cache);
+			return NULL;
+		} //end if
+	} //end for
+	for (i = 0; i < header->numtokens; i++)
+	{
+		if (cache->tokens[i].string < 0 || cache->tokens[i].string >= header->stringsize ||
+			cache->tokens[i].file < 0 || cache->tokens[i].file >= header->numfiles)
+		{
+			FreeMemory(cache);
+			return NULL;
+		} //end if
+	} //end for
+	return cache;
+} //end of the function PC_ReadSourceCacheFile
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+void PC_WriteSourceCacheFile(pc_cache_t *cache)
+{
+	char filename[MAX_QPATH];
+	fileHandle_t fp;
+
+	Com_sprintf(filename, sizeof(filename), "%s/%s.pcc", PCCACHE_FOLDER, cache->path);
+	botimport.FS_FOpenFile(filename, &fp, FS_WRITE);
+	if (!fp)
+	{
+		botimport.Print(PRT_WARNING, "can't write %s\n", filename);
+		return;
+	} //end if
+	botimport.FS_Write(cache->header, cache->header->size, fp);
+	botimport.FS_FCloseFile(fp);
+} //end of the function PC_WriteSourceCacheFile
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+source_t *PC_LoadPrecompiledSource(const char *filename, int persistent)
+{
+	char path[MAX_PATH];
+	source_t *source;
+	pc_cache_t *cache, *prev;
+
+	if (strlen(pc_basefolder))
+		Com_sprintf(path, sizeof(path), "%s/%s", pc_basefolder, filename);
+	else
+		Com_sprintf(path, sizeof(path), "%s", filename);
+	//find the precompiled source
+	prev = NULL;
+	for (cache = pc_sourcecache; cache; cache = cache->next)
+	{
+		if (!strcmp(cache->path, path)) break;
+		prev = cache;
+	} //end for
+	//remove it when one of the files changed
+	if (cache && !PC_ValidSourceCache(cache))
+	{
+		if (prev) prev->next = cache->next;
+		else pc_sourcecache = cache->next;
+		FreeMemory(cache);
+		cache = NULL;
+	} //end if
+	if (!cache && persistent)
+	{
+		cache = PC_ReadSourceCacheFile(path);
+		if (cache && !PC_ValidSourceCache(cache))
+		{
+			FreeMemory(cache);
+			cache = NULL;
+		} //end if
+		if (cache)
+		{
+			cache->next = pc_sourcecache;
+			pc_sourcecache = cache;
+		} //end if
+	} //end if
+	if (!cache)
+	{
+		cache = PC_BuildSourceCache(filename, path);
+		if (!cache) return NULL;
+		cache->next = pc_sourcecache;
+		pc_sourcecache = cache;
+		if (persistent) PC_WriteSourceCacheFile(cache);
+	} //end if
+	//
+	PC_InitTokenHeap();
+	source = (source_t *) GetClearedMemory(sizeof(source_t));
+	strncpy(source->filename, filename, MAX_PATH);
+	//the script is only used for the file name and line in error messages
+	source->scriptstack = LoadScriptMemory("", 0, source->filename);
+	source->cache = cache;
+	source->cachetoken = 0;
+#if DEFINEHASHING
+	source->definehash = GetClearedMemory(DEFINEHASHSIZE * sizeof(define_t *));
+#endif //DEFINEHASHING
+	return source;
+} //end of the function PC_LoadPrecompiledSource
+//============================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+void PC_FreeSourceCache(void)
+{
+	pc_cache_t *cache;
+
+	while(pc_sourcecache)
+	{
+		cache = pc_sourcecache;
+		pc_sourcecache = pc_sourcecache->next;
+		FreeMemory(cache);
+	} //end while
+} //end of the function PC_FreeSourceCache
+#endif //BOTLIB
+//============================================================================
+// bot_precompcache 0 = always run the pre compiler, 1 = keep precompiled
+// sources in memory, 2 = also store the precompiled sources on disk
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//============================================================================
+source_t *LoadSourceFile(const char *filename)
+{
+#ifdef BOTLIB
+	source_t *source;
+	int mode;
+
+	mode = (int) LibVarValue("bot_precompcache", "1");
+	if (mode > 0)
+	{
+		source = PC_LoadPrecompiledSource(filename, mode > 1);
+		if (source) return source;
+	} //end if
+#endif //BOTLIB
+	return PC_LoadSourceFile(filename);
 } //end of the function LoadSourceFile
 //============================================================================
 //
@@ -3126,8 +3693,8 @@ int PC_LoadSourceHandle(const char *filename)
 	} //end for
 	if (i >= MAX_SOURCEFILES)
 		return 0;
-	PS_SetBaseFolder("");
-	source = LoadSourceFile(filename);
+	PC_SetBaseFolder("");
+	source = PC_LoadSourceFile(filename);
 	if (!source)
 		return 0;
 	sourceFiles[i] = source;
@@ -3205,6 +3772,9 @@ int PC_SourceFileAndLine(int handle, char *filename, int *line)
 void PC_SetBaseFolder(char *path)
 {
 	PS_SetBaseFolder(path);
+#ifdef BOTLIB
+	Q_strncpyz(pc_basefolder, path, sizeof(pc_basefolder));
+#endif //BOTLIB
 } //end of the function PC_SetBaseFolder
 //============================================================================
 //
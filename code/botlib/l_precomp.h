@@ -104,6 +104,8 @@ typedef struct source_s
 	indent_t *indentstack;					//stack with indents
 	int skip;								// > 0 if skipping conditional code
 	token_t token;							//last read token
+	struct pc_cache_s *cache;				//precompiled tokens read instead of the scripts
+	int cachetoken;							//next precompiled token to read
 } source_t;
 
 
@@ -151,6 +153,8 @@ source_t *LoadSourceFile(const char *filename);
 source_t *LoadSourceMemory(char *ptr, int length, char *name);
 //free the given source
 void FreeSource(source_t *source);
+//free all the precompiled sources
+void PC_FreeSourceCache(void);
 //print a source error
 void QDECL SourceError(source_t *source, char *str, ...) __attribute__ ((format (printf, 2, 3)));
 //print a source warning
@@ -23,6 +23,12 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "client.h"
 #include "snd_local.h"
 
+#ifdef _WIN32
+	#include "../SDL2/include/SDL.h"
+#else
+	#include <SDL2/SDL.h>
+#endif
+
 #define INDEX_FILE_EXTENSION ".index.dat"
 
 #define MAX_RIFF_CHUNKS 16
@@ -39,6 +45,15 @@ typedef struct audioFormat_s
   int totalBytes;
 } audioFormat_t;
 
+#define MAX_AVI_QUEUE 16
+
+typedef struct aviChunk_s
+{
+  byte          *data;          // header, contents and padding, NULL to quit
+  int           size;
+  byte          index[ 16 ];
+} aviChunk_t;
+
 typedef struct aviFileData_s
 {
   qboolean      fileOpen;
@@ -66,6 +81,22 @@ typedef struct aviFileData_s
   int           chunkStackTop;
 
   byte          *cBuffer, *eBuffer;
+
+  // Chunks are handed to a writer thread so a slow disk doesn't stall
+  // the frame. The queue is bounded, producers wait for a free slot.
+  // The renderer delivers video frames from its own threads, so the
+  // file bookkeeping above is done under lock from open to close.
+  SDL_mutex     *lock;
+  SDL_Thread    *writeThread;
+  SDL_sem       *queueSlots, *queueChunks;
+  aviChunk_t    queue[ MAX_AVI_QUEUE ];
+  int           queueHead, queueTail;
+  volatile qboolean writeFailed;
+
+  int           numRequested;   // video frames asked of the renderer
+  int           maxFrameSize;   // chunk size of an uncompressed frame
+  int           numDroppedFrames; // too large, from the renderer's threads
+  qboolean      droppedWarned;
 } aviFileData_t;
 
 static aviFileData_t afd;
@@ -302,6 +333,129 @@ void CL_WriteAVIHeader( void )
   }
 }
 
+/*
+===============
+PUT_4BYTES
+
+WRITE_4BYTES into a buffer of the calling thread
+===============
+*/
+static ID_INLINE void PUT_4BYTES( byte *p, int x )
+{
+  p[ 0 ] = (byte)( ( x >>  0 ) & 0xFF );
+  p[ 1 ] = (byte)( ( x >>  8 ) & 0xFF );
+  p[ 2 ] = (byte)( ( x >> 16 ) & 0xFF );
+  p[ 3 ] = (byte)( ( x >> 24 ) & 0xFF );
+}
+
+/*
+===============
+CL_AVIWriteThread
+
+Writes the queued chunks in order until it finds the quit marker.
+Errors can't be raised from here, CL_CheckAVIWrite reports them
+===============
+*/
+static int CL_AVIWriteThread( void *data )
+{
+  aviChunk_t *c;
+
+  while( 1 )
+  {
+    SDL_SemWait( afd.queueChunks );
+
+    c = &afd.queue[ afd.queueTail ];
+    afd.queueTail = ( afd.queueTail + 1 ) % MAX_AVI_QUEUE;
+
+    if( !c->data )
+      break;
+
+    if( !afd.writeFailed )
+    {
+      if( FS_Write( c->data, c->size, afd.f ) < c->size ||
+          FS_Write( c->index, 16, afd.idxF ) < 16 )
+        afd.writeFailed = qtrue;
+    }
+
+    free( c->data );
+    SDL_SemPost( afd.queueSlots );
+  }
+
+  return 0;
+}
+
+/*
+===============
+CL_StartAVIWriter
+===============
+*/
+static qboolean CL_StartAVIWriter( void )
+{
+  afd.lock = SDL_CreateMutex( );
+  if( !afd.lock )
+    return qfalse;
+
+  if( !cl_aviWriteThread->integer )
+    return qtrue;
+
+  afd.queueSlots = SDL_CreateSemaphore( MAX_AVI_QUEUE );
+  afd.queueChunks = SDL_CreateSemaphore( 0 );
+
+  if( afd.queueSlots && afd.queueChunks )
+    afd.writeThread = SDL_CreateThread( CL_AVIWriteThread, "aviwrite", NULL );
+
+  if( !afd.writeThread )
+  {
+    // chunks get written as they come in instead
+    Com_Printf( S_COLOR_YELLOW "WARNING: Couldn't start the avi writer thread\n" );
+
+    if( afd.queueSlots )
+      SDL_DestroySemaphore( afd.queueSlots );
+    if( afd.queueChunks )
+      SDL_DestroySemaphore( afd.queueChunks );
+    afd.queueSlots = afd.queueChunks = NULL;
+  }
+
+  return qtrue;
+}
+
+/*
+===============
+CL_StopAVIWriter
+
+Waits for the frames still with the renderer and
+everything queued to be written
+===============
+*/
+static void CL_StopAVIWriter( void )
+{
+  if( re.FinishVideoFrames && cls.rendererStarted )
+    re.FinishVideoFrames( );
+
+  if( afd.writeThread )
+  {
+    SDL_SemWait( afd.queueSlots );
+    SDL_LockMutex( afd.lock );
+    afd.queue[ afd.queueHead ].data = NULL;
+    afd.queueHead = ( afd.queueHead + 1 ) % MAX_AVI_QUEUE;
+    SDL_UnlockMutex( afd.lock );
+    SDL_SemPost( afd.queueChunks );
+
+    SDL_WaitThread( afd.writeThread, NULL );
+    afd.writeThread = NULL;
+  }
+
+  if( afd.queueSlots )
+    SDL_DestroySemaphore( afd.queueSlots );
+  if( afd.queueChunks )
+    SDL_DestroySemaphore( afd.queueChunks );
+  afd.queueSlots = afd.queueChunks = NULL;
+
+  if( afd.lock )
+    SDL_DestroyMutex( afd.lock );
+  afd.lock = NULL;
+}
+
 /*
 ===============
 CL_OpenAVIForWriting
@@ -405,6 +559,17 @@ qboolean CL_OpenAVIForWriting( const char *fileName )
   SafeFS_Write( buffer, bufIndex, afd.idxF );
 
   afd.moviSize = 4; // For the "movi"
+  afd.maxFrameSize = 8 + PAD( afd.width * 3, AVI_LINE_PADDING ) * afd.height + 2;
+
+  if( !CL_StartAVIWriter( ) )
+  {
+    FS_FCloseFile( afd.idxF );
+    FS_FCloseFile( afd.f );
+    Z_Free( afd.cBuffer );
+    Z_Free( afd.eBuffer );
+    return qfalse;
+  }
+
   afd.fileOpen = qtrue;
 
   return qtrue;
@@ -412,19 +577,76 @@ qboolean CL_OpenAVIForWriting( const char *fileName )
 
 /*
 ===============
-CL_CheckFileSize
+CL_CheckAVIWrite
+
+Reports a write error of the writer thread
 ===============
 */
-static qboolean CL_CheckFileSize( int bytesToAdd )
+static void CL_CheckAVIWrite( void )
+{
+  if( !afd.writeFailed )
+    return;
+
+  CL_StopAVIWriter( );
+
+  afd.fileOpen = qfalse;
+  FS_FCloseFile( afd.idxF );
+  FS_FCloseFile( afd.f );
+  Z_Free( afd.cBuffer );
+  Z_Free( afd.eBuffer );
+
+  Com_Error( ERR_DROP, "Failed to write avi file" );
+}
+
+/*
+===============
+CL_ProjectedFileSize
+===============
+*/
+static unsigned int CL_ProjectedFileSize( int bytesToAdd )
 {
   unsigned int newFileSize;
+  int inFlight;
+
+  SDL_LockMutex( afd.lock );
+
+  inFlight = afd.numRequested - afd.numVideoFrames - afd.numDroppedFrames;
+  if( inFlight < 0 )
+    inFlight = 0;
 
   newFileSize =
     afd.fileSize +                // Current file size
     bytesToAdd +                  // What we want to add
-    ( afd.numIndices * 16 ) +     // The index
+    inFlight * afd.maxFrameSize + // Frames the renderer still has
+    ( ( afd.numIndices + inFlight ) * 16 ) + // The index
     4;                            // The index size
 
+  SDL_UnlockMutex( afd.lock );
+
+  return newFileSize;
+}
+
+/*
+===============
+CL_CheckFileSize
+
+Only called from the main thread, the file can't be
+switched while the renderer is delivering frames
+===============
+*/
+static qboolean CL_CheckFileSize( int bytesToAdd )
+{
+  unsigned int newFileSize = CL_ProjectedFileSize( bytesToAdd );
+
+  // Frames in flight are counted at their uncompressed size, get the
+  // real ones before deciding
+  if( newFileSize > INT_MAX && re.FinishVideoFrames && cls.rendererStarted )
+  {
+    re.FinishVideoFrames( );
+    afd.numRequested = afd.numVideoFrames;
+    newFileSize = CL_ProjectedFileSize( bytesToAdd );
+  }
+
   // I assume all the operating systems
   // we target can handle a 2Gb file
   if( newFileSize > INT_MAX )
@@ -443,47 +665,125 @@ static qboolean CL_CheckFileSize( int bytesToAdd )
 
 /*
 ===============
-CL_WriteAVIVideoFrame
+CL_WriteAVIChunk
+
+Adds a video or audio chunk and its index entry. Video frames
+come in from the renderer's threads, the chunk gets an offset in
+the order it is queued, so the locking covers both
 ===============
 */
-void CL_WriteAVIVideoFrame( const byte *imageBuffer, int size )
+static void CL_WriteAVIChunk( qboolean video, const byte *data, int size )
 {
-  int   chunkOffset = afd.fileSize - afd.moviOffset - 8;
-  int   chunkSize = 8 + size;
-  int   paddingSize = PADLEN(size, 2);
-  byte  padding[ 4 ] = { 0 };
+  const char  *tag = video ? "00dc" : "01wb";
+  int         paddingSize = PADLEN( size, 2 );
+  int         chunkSize = 8 + size + paddingSize;
+  int         chunkOffset;
+  byte        header[ 8 ];
+  byte        padding[ 4 ] = { 0 };
+  byte        *chunk = NULL;
+  aviChunk_t  *c;
+
+  memcpy( header, tag, 4 );
+  PUT_4BYTES( header + 4, size );
+
+  if( afd.writeThread )
+  {
+    // The zone isn't thread safe
+    chunk = malloc( chunkSize );
+    if( !chunk )
+    {
+      afd.writeFailed = qtrue;
+      return;
+    }
 
-  if( !afd.fileOpen )
-    return;
+    memcpy( chunk, header, 8 );
+    memcpy( chunk + 8, data, size );
+    memset( chunk + 8 + size, 0, paddingSize );
 
-  // Chunk header + contents + padding
-  if( CL_CheckFileSize( 8 + size + 2 ) )
+    // back-pressure, wait for the writer to catch up
+    SDL_SemWait( afd.queueSlots );
+  }
+
+  SDL_LockMutex( afd.lock );
+
+  chunkOffset = afd.fileSize - afd.moviOffset - 8;
+  afd.fileSize += chunkSize;
+  afd.moviSize += chunkSize;
+
+  if( video )
+  {
+    afd.numVideoFrames++;
+
+    if( size > afd.maxRecordSize )
+      afd.maxRecordSize = size;
+  }
+  else
+  {
+    afd.numAudioFrames++;
+    afd.a.totalBytes += size;
+  }
+
+  afd.numIndices++;
+
+  if( chunk )
+  {
+    c = &afd.queue[ afd.queueHead ];
+    afd.queueHead = ( afd.queueHead + 1 ) % MAX_AVI_QUEUE;
+
+    c->data = chunk;
+    c->size = chunkSize;
+    memcpy( c->index, tag, 4 );                                 //dwIdentifier
+    PUT_4BYTES( c->index + 4, video ? 0x00000010 : 0 );         //dwFlags (all frames are KeyFrames)
+    PUT_4BYTES( c->index + 8, chunkOffset );                    //dwOffset
+    PUT_4BYTES( c->index + 12, size );                          //dwLength
+
+    SDL_UnlockMutex( afd.lock );
+    SDL_SemPost( afd.queueChunks );
     return;
+  }
 
-  bufIndex = 0;
-  WRITE_STRING( "00dc" );
-  WRITE_4BYTES( size );
+  if( !afd.writeFailed )
+  {
+    byte index[ 16 ];
+
+    memcpy( index, tag, 4 );
+    PUT_4BYTES( index + 4, video ? 0x00000010 : 0 );
+    PUT_4BYTES( index + 8, chunkOffset );
+    PUT_4BYTES( index + 12, size );
+
+    if( FS_Write( header, 8, afd.f ) < 8 ||
+        FS_Write( data, size, afd.f ) < size ||
+        FS_Write( padding, paddingSize, afd.f ) < paddingSize ||
+        FS_Write( index, 16, afd.idxF ) < 16 )
+      afd.writeFailed = qtrue;
+  }
 
-  SafeFS_Write( buffer, 8, afd.f );
-  SafeFS_Write( imageBuffer, size, afd.f );
-  SafeFS_Write( padding, paddingSize, afd.f );
-  afd.fileSize += ( chunkSize + paddingSize );
+  SDL_UnlockMutex( afd.lock );
+}
 
-  afd.numVideoFrames++;
-  afd.moviSize += ( chunkSize + paddingSize );
+/*
+===============
+CL_WriteAVIVideoFrame
 
-  if( size > afd.maxRecordSize )
-    afd.maxRecordSize = size;
+Called by the renderer, possibly from one of its threads
+===============
+*/
+void CL_WriteAVIVideoFrame( const byte *imageBuffer, int size )
+{
+  if( !afd.fileOpen )
+    return;
 
-  // Index
-  bufIndex = 0;
-  WRITE_STRING( "00dc" );           //dwIdentifier
-  WRITE_4BYTES( 0x00000010 );       //dwFlags (all frames are KeyFrames)
-  WRITE_4BYTES( chunkOffset );      //dwOffset
-  WRITE_4BYTES( size );             //dwLength
-  SafeFS_Write( buffer, 16, afd.idxF );
+  // CL_CheckFileSize made room for this one before it was asked for,
+  // CL_TakeVideoFrame reports the ones that don't fit
+  if( size > afd.maxFrameSize - 10 )
+  {
+    SDL_LockMutex( afd.lock );
+    afd.numDroppedFrames++;
+    SDL_UnlockMutex( afd.lock );
+    return;
+  }
 
-  afd.numIndices++;
+  CL_WriteAVIChunk( qtrue, imageBuffer, size );
 }
 
 #define PCM_BUFFER_SIZE 44100
@@ -504,6 +804,8 @@ void CL_WriteAVIAudioFrame( const byte *pcmBuffer, int size )
   if( !afd.fileOpen )
     return;
 
+  CL_CheckAVIWrite( );
+
   // Chunk header + contents + padding
   if( CL_CheckFileSize( 8 + bytesInBuffer + size + 2 ) )
     return;
@@ -522,34 +824,7 @@ void CL_WriteAVIAudioFrame( const byte *pcmBuffer, int size )
   if( bytesInBuffer >= (int)ceil( (float)afd.a.rate / (float)afd.frameRate ) *
         afd.a.sampleSize )
   {
-    int   chunkOffset = afd.fileSize - afd.moviOffset - 8;
-    int   chunkSize = 8 + bytesInBuffer;
-    int   paddingSize = PADLEN(bytesInBuffer, 2);
-    byte  padding[ 4 ] = { 0 };
-
-    bufIndex = 0;
-    WRITE_STRING( "01wb" );
-    WRITE_4BYTES( bytesInBuffer );
-
-    SafeFS_Write( buffer, 8, afd.f );
-    SafeFS_Write( pcmCaptureBuffer, bytesInBuffer, afd.f );
-    SafeFS_Write( padding, paddingSize, afd.f );
-    afd.fileSize += ( chunkSize + paddingSize );
-
-    afd.numAudioFrames++;
-    afd.moviSize += ( chunkSize + paddingSize );
-    afd.a.totalBytes += bytesInBuffer;
-
-    // Index
-    bufIndex = 0;
-    WRITE_STRING( "01wb" );           //dwIdentifier
-    WRITE_4BYTES( 0 );                //dwFlags
-    WRITE_4BYTES( chunkOffset );      //dwOffset
-    WRITE_4BYTES( bytesInBuffer );    //dwLength
-    SafeFS_Write( buffer, 16, afd.idxF );
-
-    afd.numIndices++;
-
+    CL_WriteAVIChunk( qfalse, pcmCaptureBuffer, bytesInBuffer );
     bytesInBuffer = 0;
   }
 }
@@ -565,6 +840,23 @@ void CL_TakeVideoFrame( void )
   if( !afd.fileOpen )
     return;
 
+  CL_CheckAVIWrite( );
+
+  if( afd.numDroppedFrames && !afd.droppedWarned )
+  {
+    Com_Printf( S_COLOR_YELLOW "WARNING: Video frame larger than %d bytes "
+        "-- dropped\n", afd.maxFrameSize - 10 );
+    afd.droppedWarned = qtrue;
+  }
+
+  // Room for it uncompressed, it may not arrive until a few frames later
+  CL_CheckFileSize( afd.maxFrameSize );
+
+  // Opening the next file can fail
+  if( !afd.fileOpen )
+    return;
+
+  afd.numRequested++;
   re.TakeVideoFrame( afd.width, afd.height, afd.cBuffer, afd.eBuffer, afd.motionJpeg );
 }
 
@@ -578,15 +870,30 @@ Closes the AVI file and writes an index chunk
 qboolean CL_CloseAVI( void )
 {
   int indexRemainder;
-  int indexSize = afd.numIndices * 16;
-  const char *idxFileName = va( "%s" INDEX_FILE_EXTENSION, afd.fileName );
+  int indexSize;
+  const char *idxFileName;
 
   // AVI file isn't open
   if( !afd.fileOpen )
     return qfalse;
 
+  CL_StopAVIWriter( );
+
   afd.fileOpen = qfalse;
 
+  if( afd.writeFailed )
+  {
+    Com_Printf( S_COLOR_RED "ERROR: Failed to write avi file %s\n", afd.fileName );
+    FS_FCloseFile( afd.idxF );
+    FS_FCloseFile( afd.f );
+    Z_Free( afd.cBuffer );
+    Z_Free( afd.eBuffer );
+    return qfalse;
+  }
+
+  indexSize = afd.numIndices * 16;
+  idxFileName = va( "%s" INDEX_FILE_EXTENSION, afd.fileName );
+
   FS_Seek( afd.idxF, 4, FS_SEEK_SET );
   bufIndex = 0;
   WRITE_4BYTES( indexSize );
@@ -639,6 +946,9 @@ qboolean CL_CloseAVI( void )
 
   Com_Printf( "Wrote %d:%d frames to %s\n", afd.numVideoFrames, afd.numAudioFrames, afd.fileName );
 
+  if( afd.numDroppedFrames )
+    Com_Printf( S_COLOR_YELLOW "WARNING: Dropped %d video frames\n", afd.numDroppedFrames );
+
   return qtrue;
 }
 
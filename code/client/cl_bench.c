@@ -0,0 +1,454 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_bench.c -- timedemo benchmark runs with per frame timings
+
+#include "client.h"
+
+/*
+"benchmark <name> <demo> [<demo> ...]" plays the demos one after another
+as timedemos and times every frame in microseconds:
+
+	frame		the whole frame, from the end of the one before it
+	cgame		CG_DRAW_ACTIVE_FRAME, without the scenes it renders
+	frontend	RenderScene, culling and sorting the scenes
+	backend		EndFrame, without the swap
+	swap		waiting for the driver to finish and present the frame,
+				0 with renderers that don't report it
+
+With r_smp the back end runs a frame behind on its own thread, so backend
+and swap are only meaningful with r_smp 0.
+
+Each demo gets benchmarks/<name>/<demo>.csv with a line per frame and the
+resident size of the process, and the run gets benchmarks/<name>.json with
+the renderer, the resolution and per demo statistics. Once the last demo is
+done, or a demo fails to play, "nextdemo" is run, so a scripted run can
+end with "+set nextdemo quit". misc/benchmark has a script running it
+across renderers and settings, and one comparing the results to a baseline.
+*/
+
+#define	MAX_BENCH_DEMOS		64
+
+// frames without a demo playing before the run is given up
+#define	BENCH_IDLE_FRAMES	10
+
+typedef struct {
+	int		frameUsec;
+	int		cgameUsec;
+	int		frontEndUsec;
+	int		backEndUsec;
+	int		swapUsec;
+	int		residentKB;
+} benchFrame_t;
+
+typedef struct {
+	qboolean		active;
+	char			name[MAX_QPATH];
+	char			demos[MAX_BENCH_DEMOS][MAX_QPATH];
+	int				numDemos;
+	int				currentDemo;
+	qboolean		demoStarted;	// the current demo has been seen playing
+	int				idleFrames;
+	int				oldTimedemo;
+
+	benchFrame_t	*frames;
+	int				numFrames;
+	int				maxFrames;
+	int64_t			lastFrameTime;
+
+	fileHandle_t	summary;
+	qboolean		summaryOpened;
+	int				numResults;
+} benchmark_t;
+
+static benchmark_t	bench;
+
+
+/*
+====================
+CL_BenchmarkWriteString
+====================
+*/
+static void CL_BenchmarkWriteString( fileHandle_t f, const char *s ) {
+	char	buf[MAX_STRING_CHARS * 2];
+	int		c, len;
+
+	len = 0;
+	buf[len++] = '"';
+	for ( ; *s && len < sizeof( buf ) - 8 ; s++ ) {
+		c = *(const byte *)s;
+		if ( c == '"' || c == '\\' ) {
+			buf[len++] = '\\';
+			buf[len++] = c;
+		} else if ( c < 0x20 || c >= 0x7f ) {
+			Com_sprintf( buf + len, 7, "\\u%04x", c );
+			len += 6;
+		} else {
+			buf[len++] = c;
+		}
+	}
+	buf[len++] = '"';
+
+	FS_Write( buf, len, f );
+}
+
+/*
+====================
+CL_BenchmarkCompare
+====================
+*/
+static int CL_BenchmarkCompare( const void *a, const void *b ) {
+	return *(const int *)a - *(const int *)b;
+}
+
+/*
+====================
+CL_BenchmarkMs
+====================
+*/
+static float CL_BenchmarkMs( const int *sorted, int num, float fraction ) {
+	return sorted[ (int)( ( num - 1 ) * fraction + 0.5f ) ] / 1000.0f;
+}
+
+/*
+====================
+CL_BenchmarkOpenSummary
+====================
+*/
+static void CL_BenchmarkOpenSummary( void ) {
+	const char	*path;
+
+	path = va( "benchmarks/%s.json", bench.name );
+	bench.summary = FS_FOpenFileWrite( path );
+	if ( !bench.summary ) {
+		Com_Printf( "Couldn't open %s for writing\n", path );
+		return;
+	}
+
+	FS_Printf( bench.summary, "{\n\t\"name\": " );
+	CL_BenchmarkWriteString( bench.summary, bench.name );
+	FS_Printf( bench.summary, ",\n\t\"version\": " );
+	CL_BenchmarkWriteString( bench.summary, Q3_VERSION );
+	FS_Printf( bench.summary, ",\n\t\"renderer\": " );
+	CL_BenchmarkWriteString( bench.summary, Cvar_VariableString( "cl_renderer" ) );
+	FS_Printf( bench.summary, ",\n\t\"driver\": " );
+	CL_BenchmarkWriteString( bench.summary, cls.glconfig.renderer_string );
+	FS_Printf( bench.summary, ",\n\t\"vendor\": " );
+	CL_BenchmarkWriteString( bench.summary, cls.glconfig.vendor_string );
+	FS_Printf( bench.summary, ",\n\t\"width\": %i,\n\t\"height\": %i,\n\t\"demos\": [",
+		cls.glconfig.vidWidth, cls.glconfig.vidHeight );
+
+	bench.numResults = 0;
+}
+
+/*
+====================
+CL_BenchmarkCloseSummary
+====================
+*/
+static void CL_BenchmarkCloseSummary( qboolean completed ) {
+	if ( !bench.summary ) {
+		return;
+	}
+
+	FS_Printf( bench.summary, "\n\t],\n\t\"completed\": %s\n}\n", completed ? "true" : "false" );
+	FS_FCloseFile( bench.summary );
+	bench.summary = 0;
+
+	Com_Printf( "benchmarks/%s.json written\n", bench.name );
+}
+
+/*
+====================
+CL_BenchmarkWriteDemo
+
+The frame log of the demo just played and its line in the summary
+====================
+*/
+static void CL_BenchmarkWriteDemo( void ) {
+	benchFrame_t	*fr;
+	fileHandle_t	f;
+	const char		*path;
+	int				*sorted;
+	int64_t			total, cgame, frontEnd, backEnd, swap;
+	double			mean, variance;
+	int				i, peakKB;
+
+	if ( bench.numFrames <= 0 ) {
+		Com_Printf( "benchmark: no frames timed in %s\n", bench.demos[bench.currentDemo] );
+		return;
+	}
+
+	path = va( "benchmarks/%s/%s.csv", bench.name, bench.demos[bench.currentDemo] );
+	f = FS_FOpenFileWrite( path );
+	if ( f ) {
+		FS_Printf( f, "frame,frame_us,cgame_us,frontend_us,backend_us,swap_us,resident_kb\n" );
+		for ( i = 0, fr = bench.frames ; i < bench.numFrames ; i++, fr++ ) {
+			FS_Printf( f, "%i,%i,%i,%i,%i,%i,%i\n", i, fr->frameUsec, fr->cgameUsec,
+				fr->frontEndUsec, fr->backEndUsec, fr->swapUsec, fr->residentKB );
+		}
+		FS_FCloseFile( f );
+	} else {
+		Com_Printf( "Couldn't open %s for writing\n", path );
+	}
+
+	if ( !bench.summary ) {
+		return;
+	}
+
+	sorted = malloc( bench.numFrames * sizeof( *sorted ) );
+	if ( !sorted ) {
+		Com_Printf( "benchmark: out of memory for %i frames\n", bench.numFrames );
+		return;
+	}
+
+	total = cgame = frontEnd = backEnd = swap = 0;
+	peakKB = -1;
+	for ( i = 0, fr = bench.frames ; i < bench.numFrames ; i++, fr++ ) {
+		sorted[i] = fr->frameUsec;
+		total += fr->frameUsec;
+		cgame += fr->cgameUsec;
+		frontEnd += fr->frontEndUsec;
+		backEnd += fr->backEndUsec;
+		swap += fr->swapUsec;
+		if ( fr->residentKB > peakKB ) {
+			peakKB = fr->residentKB;
+		}
+	}
+
+	mean = (double)total / bench.numFrames;
+	variance = 0;
+	for ( i = 0 ; i < bench.numFrames ; i++ ) {
+		variance += ( sorted[i] - mean ) * ( sorted[i] - mean );
+	}
+	variance /= bench.numFrames;
+
+	qsort( sorted, bench.numFrames, sizeof( *sorted ), CL_BenchmarkCompare );
+
+	FS_Printf( bench.summary, "%s\n\t\t{\n\t\t\t\"demo\": ", bench.numResults ? "," : "" );
+	CL_BenchmarkWriteString( bench.summary, bench.demos[bench.currentDemo] );
+	FS_Printf( bench.summary, ",\n\t\t\t\"frames\": %i,\n\t\t\t\"seconds\": %.3f,\n\t\t\t\"fps\": %.2f,\n",
+		bench.numFrames, total / 1000000.0, bench.numFrames * 1000000.0 / total );
+	FS_Printf( bench.summary, "\t\t\t\"frame_ms\": { \"mean\": %.3f, \"sdev\": %.3f, \"min\": %.3f, "
+		"\"median\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f },\n",
+		mean / 1000.0, sqrt( variance ) / 1000.0,
+		CL_BenchmarkMs( sorted, bench.numFrames, 0.0f ),
+		CL_BenchmarkMs( sorted, bench.numFrames, 0.5f ),
+		CL_BenchmarkMs( sorted, bench.numFrames, 0.95f ),
+		CL_BenchmarkMs( sorted, bench.numFrames, 0.99f ),
+		CL_BenchmarkMs( sorted, bench.numFrames, 1.0f ) );
+	FS_Printf( bench.summary, "\t\t\t\"cgame_ms\": %.3f,\n\t\t\t\"frontend_ms\": %.3f,\n"
+		"\t\t\t\"backend_ms\": %.3f,\n\t\t\t\"swap_ms\": %.3f,\n",
+		cgame / 1000.0 / bench.numFrames, frontEnd / 1000.0 / bench.numFrames,
+		backEnd / 1000.0 / bench.numFrames, swap / 1000.0 / bench.numFrames );
+	FS_Printf( bench.summary, "\t\t\t\"resident_peak_kb\": %i,\n\t\t\t\"hunk_free_kb\": %i,\n"
+		"\t\t\t\"zone_free_kb\": %i\n\t\t}",
+		peakKB, Hunk_MemoryRemaining() / 1024, Z_AvailableMemory() / 1024 );
+
+	bench.numResults++;
+
+	Com_Printf( "benchmark %s: %i frames %.1f fps, %.2f ms median %.2f ms 99%%\n",
+		bench.demos[bench.currentDemo], bench.numFrames, bench.numFrames * 1000000.0 / total,
+		CL_BenchmarkMs( sorted, bench.numFrames, 0.5f ),
+		CL_BenchmarkMs( sorted, bench.numFrames, 0.99f ) );
+
+	free( sorted );
+}
+
+/*
+====================
+CL_BenchmarkStop
+====================
+*/
+static void CL_BenchmarkStop( qboolean completed ) {
+	CL_BenchmarkCloseSummary( completed );
+
+	free( bench.frames );
+
+	Cvar_Set( "timedemo", va( "%i", bench.oldTimedemo ) );
+
+	memset( &bench, 0, sizeof( bench ) );
+}
+
+/*
+====================
+CL_BenchmarkStartDemo
+====================
+*/
+static void CL_BenchmarkStartDemo( void ) {
+	bench.numFrames = 0;
+	bench.demoStarted = qfalse;
+	bench.idleFrames = 0;
+
+	Cbuf_AddText( va( "demo \"%s\"\n", bench.demos[bench.currentDemo] ) );
+}
+
+/*
+====================
+CL_BenchmarkFrame
+
+Called after every screen update
+====================
+*/
+void CL_BenchmarkFrame( void ) {
+	benchFrame_t	*fr;
+	int64_t			now;
+	int				swap;
+
+	if ( !bench.active ) {
+		// a plain timedemo times the frames too
+		clc.timeDemoCGameUsec = 0;
+		clc.timeDemoFrontEndUsec = 0;
+		clc.timeDemoEndFrameUsec = 0;
+		return;
+	}
+
+	if ( !clc.demoplaying ) {
+		// dropped, disconnected or the demo couldn't be opened
+		if ( bench.demoStarted || ++bench.idleFrames > BENCH_IDLE_FRAMES ) {
+			Com_Printf( "benchmark: %s didn't play to its end, stopping\n",
+				bench.demos[bench.currentDemo] );
+			CL_BenchmarkStop( qfalse );
+			CL_NextDemo();
+		}
+		return;
+	}
+
+	bench.demoStarted = qtrue;
+
+	// once the renderer is up
+	if ( !bench.summaryOpened ) {
+		bench.summaryOpened = qtrue;
+		CL_BenchmarkOpenSummary();
+	}
+
+	if ( clc.state != CA_ACTIVE || !clc.timeDemoFrames ) {
+		return;
+	}
+
+	now = Sys_Microseconds();
+
+	// the first frame waited for the gamestate load
+	if ( clc.timeDemoFrames > 1 ) {
+		if ( bench.numFrames == bench.maxFrames ) {
+			benchFrame_t	*frames;
+
+			// long runs would fragment the zone, keep them out of it
+			bench.maxFrames = bench.maxFrames ? bench.maxFrames * 2 : 4096;
+			frames = realloc( bench.frames, bench.maxFrames * sizeof( *frames ) );
+			if ( !frames ) {
+				Com_Printf( S_COLOR_YELLOW "WARNING: benchmark out of memory after %i frames\n", bench.numFrames );
+				CL_BenchmarkStop( qfalse );
+				return;
+			}
+			bench.frames = frames;
+		}
+
+		swap = re.SwapMicroseconds ? re.SwapMicroseconds() : 0;
+		if ( swap > clc.timeDemoEndFrameUsec ) {
+			swap = clc.timeDemoEndFrameUsec;
+		}
+
+		fr = &bench.frames[bench.numFrames++];
+		fr->frameUsec = now - bench.lastFrameTime;
+		fr->cgameUsec = clc.timeDemoCGameUsec - clc.timeDemoFrontEndUsec;
+		fr->frontEndUsec = clc.timeDemoFrontEndUsec;
+		fr->backEndUsec = clc.timeDemoEndFrameUsec - swap;
+		fr->swapUsec = swap;
+		fr->residentKB = Sys_ResidentMemory();
+	}
+
+	clc.timeDemoCGameUsec = 0;
+	clc.timeDemoFrontEndUsec = 0;
+	clc.timeDemoEndFrameUsec = 0;
+
+	// leave the bookkeeping above out of the next frame
+	bench.lastFrameTime = Sys_Microseconds();
+}
+
+/*
+====================
+CL_BenchmarkDemoCompleted
+
+Returns qtrue when the next demo of the run has been queued
+====================
+*/
+qboolean CL_BenchmarkDemoCompleted( void ) {
+	if ( !bench.active ) {
+		return qfalse;
+	}
+
+	CL_BenchmarkWriteDemo();
+
+	if ( ++bench.currentDemo < bench.numDemos ) {
+		CL_BenchmarkStartDemo();
+		return qtrue;
+	}
+
+	CL_BenchmarkStop( qtrue );
+	return qfalse;
+}
+
+/*
+====================
+CL_Benchmark_f
+
+benchmark <name> <demo> [<demo> ...]
+====================
+*/
+void CL_Benchmark_f( void ) {
+	int		i;
+
+	if ( Cmd_Argc() < 3 ) {
+		Com_Printf( "benchmark <name> <demo> [<demo> ...]\n" );
+		if ( bench.active ) {
+			Com_Printf( "%s is running, demo %i of %i\n", bench.name,
+				bench.currentDemo + 1, bench.numDemos );
+		}
+		return;
+	}
+
+	if ( bench.active ) {
+		CL_BenchmarkStop( qfalse );
+	}
+
+	if ( Cmd_Argc() - 2 > MAX_BENCH_DEMOS ) {
+		Com_Printf( "At most %i demos can be benchmarked at once.\n", MAX_BENCH_DEMOS );
+		return;
+	}
+
+	if ( strstr( Cmd_Argv( 1 ), ".." ) || strchr( Cmd_Argv( 1 ), ':' ) ) {
+		Com_Printf( "Invalid benchmark name.\n" );
+		return;
+	}
+
+	Q_strncpyz( bench.name, Cmd_Argv( 1 ), sizeof( bench.name ) );
+	for ( i = 2 ; i < Cmd_Argc() ; i++ ) {
+		Q_strncpyz( bench.demos[bench.numDemos++], Cmd_Argv( i ), sizeof( bench.demos[0] ) );
+	}
+
+	bench.oldTimedemo = cl_timedemo->integer;
+	Cvar_Set( "timedemo", "1" );
+
+	bench.active = qtrue;
+	bench.currentDemo = 0;
+	CL_BenchmarkStartDemo();
+}
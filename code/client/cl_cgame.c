@@ -547,6 +547,13 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 		re.AddAdditiveLightToScene( VMA(1), VMF(2), VMF(3), VMF(4), VMF(5) );
 		return 0;
 	case CG_R_RENDERSCENE:
+		if ( cl_timedemo->integer ) {
+			int64_t start = Sys_Microseconds();
+
+			re.RenderScene( VMA(1) );
+			clc.timeDemoFrontEndUsec += Sys_Microseconds() - start;
+			return 0;
+		}
 		re.RenderScene( VMA(1) );
 		return 0;
 	case CG_R_SETCOLOR:
@@ -771,8 +778,18 @@ qboolean CL_GameCommand( void )
 
 void CL_CGameRendering(void)
 {
+	int64_t start = 0;
+
+	if ( cl_timedemo->integer ) {
+		start = Sys_Microseconds();
+	}
+
 	VM_Call( cgvm, CG_DRAW_ACTIVE_FRAME, cl.serverTime, 0, clc.demoplaying );
 	VM_Debug( 0 );
+
+	if ( cl_timedemo->integer ) {
+		clc.timeDemoCGameUsec += Sys_Microseconds() - start;
+	}
 }
 
 
@@ -977,6 +994,11 @@ void CL_SetCGameTime( void )
 			tn = 30;
 		}
 
+		// a demoseek between keyframes plays on faster until it gets there
+		if ( clc.demoSeekTime ) {
+			CL_AdvanceDemoSeek();
+		}
+
 		cl.serverTime = cls.realtime + cl.serverTimeDelta - tn;
 
 		// guarantee that time will never flow backwards, even if
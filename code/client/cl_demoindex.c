@@ -0,0 +1,697 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// cl_demoindex.c -- keyframe index files for seeking in demos
+
+#include "client.h"
+
+/*
+Every snapshot in a demo is delta compressed from an earlier one, so a demo
+can only be parsed from its start. The index file next to a demo
+("demos/name.dm_68.idx") holds a keyframe every cl_demoIndex seconds of
+server time: a gamestate message and a non-delta snapshot built from the
+client state at that point, stored as demo records, and the offset of the
+demo message that follows them. A seek replays the last keyframe before the
+target and reads the demo on from that offset, so it never parses more than
+one interval of messages, however long the demo is.
+
+With cl_demoIndex set, keyframes are written while recording, and while
+playing a demo that has no index yet, so the first playback of an old demo
+builds its index. A keyframe is only kept once a later snapshot turns out to
+be delta compressed from it, the messages after it could not be parsed
+without older snapshots otherwise. That takes a round trip to the server,
+which deltas from the last snapshot the client acknowledged, so a keyframe
+waits for it as long as the snapshot is within PACKET_BACKUP.
+
+file layout, all little endian:
+	int		DEMO_INDEX_IDENT
+	int		DEMO_INDEX_VERSION
+	keyframes:
+		int		serverTime
+		int		demo file offset
+		int		length
+		byte	records[length]
+	trailer:
+		int		-1
+		int		demo file length
+		int		0
+
+An index without the trailer, or with the length of another demo, is
+rebuilt the next time the demo is played.
+*/
+
+#define	DEMO_INDEX_IDENT		(('X'<<24)+('D'<<16)+('I'<<8)+'D')
+#define	DEMO_INDEX_VERSION		1
+#define	DEMO_INDEX_EXT			".idx"
+
+#define	MAX_DEMO_KEYFRAMES		4096
+
+// a seek that lands between keyframes plays this much demo per frame to catch up
+#define	DEMO_SEEK_STEP			2000
+
+// forward seeks shorter than this catch up instead of restarting the demo
+#define	DEMO_SEEK_RESTART		10000
+
+#define	MAX_KEYFRAME_LENGTH		( 2 * ( 8 + MAX_MSGLEN ) )
+
+typedef struct {
+	int			serverTime;
+	int			demoOffset;		// demo message after the keyframe
+	int			indexOffset;	// keyframe records in the index file
+	int			length;
+} demoKeyframe_t;
+
+typedef struct {
+	char			demoName[MAX_OSPATH];
+	char			indexName[MAX_OSPATH];
+	int				demoLength;
+	int				startTime;		// serverTime of the first snapshot
+
+	demoKeyframe_t	keyframes[MAX_DEMO_KEYFRAMES];
+	int				numKeyframes;
+
+	// open while keyframes are added
+	fileHandle_t	file;
+	int				fileLength;
+	qboolean		building;		// playback is building a new index
+
+	int				lastSnapshot;	// messageNum of the last snapshot looked at
+
+	// keyframe waiting for the next snapshot to delta from it
+	qboolean		pending;
+	int				pendingMessage;
+	int				pendingTime;
+	int				pendingOffset;
+	int				pendingLength;
+	byte			pendingData[MAX_KEYFRAME_LENGTH];
+
+	// demoseek carried over the restart of the demo
+	int				seekTime;
+	int				seekKeyframe;
+
+	// keyframe being replayed by CL_ReadDemoMessage
+	int				replayPos;
+	int				replayLength;
+	byte			replayData[MAX_KEYFRAME_LENGTH];
+} demoIndex_t;
+
+static demoIndex_t	di;
+
+
+/*
+=======================================================================
+
+WRITING
+
+=======================================================================
+*/
+
+/*
+====================
+CL_AddKeyframeRecord
+====================
+*/
+static void CL_AddKeyframeRecord( int sequence, msg_t *buf ) {
+	int		swlen;
+
+	swlen = LittleLong( sequence );
+	memcpy( di.pendingData + di.pendingLength, &swlen, 4 );
+	swlen = LittleLong( buf->cursize );
+	memcpy( di.pendingData + di.pendingLength + 4, &swlen, 4 );
+	memcpy( di.pendingData + di.pendingLength + 8, buf->data, buf->cursize );
+
+	di.pendingLength += 8 + buf->cursize;
+}
+
+/*
+====================
+CL_WriteKeyframeSnapshot
+
+Writes cl.snap without delta compression, after the server commands the
+cgame has not executed yet
+====================
+*/
+static void CL_WriteKeyframeSnapshot( msg_t *buf ) {
+	entityState_t	*ent;
+	int				i;
+
+	MSG_WriteLong( buf, clc.reliableSequence );
+
+	i = clc.lastExecutedServerCommand + 1;
+	if ( i <= clc.serverCommandSequence - MAX_RELIABLE_COMMANDS ) {
+		i = clc.serverCommandSequence - MAX_RELIABLE_COMMANDS + 1;
+	}
+	for ( ; i <= clc.serverCommandSequence; i++ ) {
+		MSG_WriteByte( buf, svc_serverCommand );
+		MSG_WriteLong( buf, i );
+		MSG_WriteString( buf, clc.serverCommands[ i & ( MAX_RELIABLE_COMMANDS - 1 ) ] );
+	}
+
+	MSG_WriteByte( buf, svc_snapshot );
+	MSG_WriteLong( buf, cl.snap.serverTime );
+	MSG_WriteByte( buf, 0 );	// not delta compressed
+	MSG_WriteByte( buf, cl.snap.snapFlags );
+	MSG_WriteByte( buf, sizeof( cl.snap.areamask ) );
+	MSG_WriteData( buf, cl.snap.areamask, sizeof( cl.snap.areamask ) );
+
+	MSG_WriteDeltaPlayerstate( buf, NULL, &cl.snap.ps );
+
+	// new entities are delta compressed from their baselines
+	for ( i = 0; i < cl.snap.numEntities; i++ ) {
+		ent = &cl.parseEntities[ ( cl.snap.parseEntitiesNum + i ) & ( MAX_PARSE_ENTITIES - 1 ) ];
+		MSG_WriteDeltaEntity( buf, &cl.entityBaselines[ ent->number ], ent, qtrue );
+	}
+	MSG_WriteBits( buf, ( MAX_GENTITIES - 1 ), GENTITYNUM_BITS );
+
+	MSG_WriteByte( buf, svc_EOF );
+}
+
+/*
+====================
+CL_BuildKeyframe
+====================
+*/
+static void CL_BuildKeyframe( int offset ) {
+	byte	bufData[MAX_MSGLEN];
+	msg_t	buf;
+
+	di.pendingLength = 0;
+
+	// the gamestate the cgame has seen so far...
+	MSG_Init( &buf, bufData, sizeof( bufData ) );
+	MSG_Bitstream( &buf );
+	CL_WriteDemoGamestate( &buf, clc.lastExecutedServerCommand );
+	if ( buf.overflowed ) {
+		return;
+	}
+	CL_AddKeyframeRecord( cl.snap.messageNum - 1, &buf );
+
+	// ...and the rest of it with the snapshot
+	MSG_Init( &buf, bufData, sizeof( bufData ) );
+	MSG_Bitstream( &buf );
+	CL_WriteKeyframeSnapshot( &buf );
+	if ( buf.overflowed ) {
+		return;
+	}
+	CL_AddKeyframeRecord( cl.snap.messageNum, &buf );
+
+	di.pending = qtrue;
+	di.pendingMessage = cl.snap.messageNum;
+	di.pendingTime = cl.snap.serverTime;
+	di.pendingOffset = offset;
+}
+
+/*
+====================
+CL_CommitKeyframe
+====================
+*/
+static void CL_CommitKeyframe( void ) {
+	demoKeyframe_t	*kf;
+	int				entry[3];
+
+	kf = &di.keyframes[ di.numKeyframes++ ];
+	kf->serverTime = di.pendingTime;
+	kf->demoOffset = di.pendingOffset;
+	kf->indexOffset = di.fileLength + sizeof( entry );
+	kf->length = di.pendingLength;
+
+	entry[0] = LittleLong( kf->serverTime );
+	entry[1] = LittleLong( kf->demoOffset );
+	entry[2] = LittleLong( kf->length );
+	FS_Write( entry, sizeof( entry ), di.file );
+	FS_Write( di.pendingData, di.pendingLength, di.file );
+	FS_Flush( di.file );
+
+	di.fileLength += sizeof( entry ) + kf->length;
+}
+
+/*
+====================
+CL_DemoIndexMessage
+
+Called after each demo message is written or parsed, offset is where the
+next message starts in the demo file
+====================
+*/
+void CL_DemoIndexMessage( int offset ) {
+	int		interval;
+
+	if ( !cl.snap.valid || cl.snap.messageNum != clc.serverMessageSequence ) {
+		return;		// no snapshot in this message
+	}
+	if ( cl.snap.messageNum == di.lastSnapshot ) {
+		return;
+	}
+	di.lastSnapshot = cl.snap.messageNum;
+
+	if ( !di.startTime ) {
+		di.startTime = cl.snap.serverTime;
+	}
+
+	if ( !di.file ) {
+		return;
+	}
+
+	// the pending keyframe is good once a snapshot is parsed from it, and
+	// no use once the server can't delta from it any more
+	if ( di.pending ) {
+		if ( cl.snap.deltaNum == di.pendingMessage || cl.snap.deltaNum == -1 ) {
+			CL_CommitKeyframe();
+			di.pending = qfalse;
+		} else if ( cl.snap.messageNum - di.pendingMessage >= PACKET_BACKUP ) {
+			di.pending = qfalse;
+		} else {
+			return;
+		}
+	}
+
+	interval = cl_demoIndex->integer * 1000;
+	if ( interval <= 0 || di.numKeyframes == MAX_DEMO_KEYFRAMES ) {
+		return;
+	}
+	if ( di.numKeyframes && cl.snap.serverTime < di.keyframes[ di.numKeyframes - 1 ].serverTime + interval ) {
+		return;
+	}
+
+	CL_BuildKeyframe( offset );
+}
+
+/*
+====================
+CL_OpenDemoIndex
+====================
+*/
+static qboolean CL_OpenDemoIndex( void ) {
+	int		header[2];
+
+	di.file = FS_FOpenFileWrite( di.indexName );
+	if ( !di.file ) {
+		Com_Printf( "Couldn't open %s for writing\n", di.indexName );
+		return qfalse;
+	}
+
+	header[0] = LittleLong( DEMO_INDEX_IDENT );
+	header[1] = LittleLong( DEMO_INDEX_VERSION );
+	FS_Write( header, sizeof( header ), di.file );
+	di.fileLength = sizeof( header );
+
+	return qtrue;
+}
+
+/*
+====================
+CL_CloseDemoIndex
+
+A complete index gets the trailer with the length of its demo
+====================
+*/
+static void CL_CloseDemoIndex( int demoLength ) {
+	int		entry[3];
+
+	if ( !di.file ) {
+		return;
+	}
+
+	if ( demoLength > 0 ) {
+		entry[0] = LittleLong( -1 );
+		entry[1] = LittleLong( demoLength );
+		entry[2] = 0;
+		FS_Write( entry, sizeof( entry ), di.file );
+	}
+
+	FS_FCloseFile( di.file );
+	di.file = 0;
+	di.pending = qfalse;
+}
+
+/*
+====================
+CL_ResetDemoIndex
+====================
+*/
+static void CL_ResetDemoIndex( const char *demoName, int demoLength ) {
+	Q_strncpyz( di.demoName, demoName, sizeof( di.demoName ) );
+	Com_sprintf( di.indexName, sizeof( di.indexName ), "%s" DEMO_INDEX_EXT, demoName );
+	di.demoLength = demoLength;
+	di.startTime = 0;
+	di.numKeyframes = 0;
+	di.building = qfalse;
+	di.seekTime = 0;
+}
+
+/*
+====================
+CL_DemoIndexStartRecord
+====================
+*/
+void CL_DemoIndexStartRecord( const char *demoName ) {
+	CL_CloseDemoIndex( 0 );
+	CL_ResetDemoIndex( demoName, 0 );
+
+	di.lastSnapshot = -1;
+
+	if ( cl_demoIndex->integer > 0 ) {
+		CL_OpenDemoIndex();
+	}
+}
+
+/*
+====================
+CL_DemoIndexStopRecord
+====================
+*/
+void CL_DemoIndexStopRecord( int demoLength ) {
+	CL_CloseDemoIndex( demoLength );
+
+	// the next playback loads it from the file
+	di.demoName[0] = 0;
+}
+
+
+/*
+=======================================================================
+
+PLAYBACK
+
+=======================================================================
+*/
+
+/*
+====================
+CL_LoadDemoIndex
+
+Reads the keyframe table of a complete index
+====================
+*/
+static qboolean CL_LoadDemoIndex( void ) {
+	fileHandle_t	f;
+	demoKeyframe_t	*kf;
+	int				header[2], entry[3];
+	int				ofs;
+	qboolean		complete;
+
+	FS_FOpenFileRead( di.indexName, &f, qtrue );
+	if ( !f ) {
+		return qfalse;
+	}
+
+	complete = qfalse;
+
+	if ( FS_Read( header, sizeof( header ), f ) == sizeof( header ) &&
+		LittleLong( header[0] ) == DEMO_INDEX_IDENT &&
+		LittleLong( header[1] ) == DEMO_INDEX_VERSION ) {
+		ofs = sizeof( header );
+
+		while ( FS_Read( entry, sizeof( entry ), f ) == sizeof( entry ) ) {
+			ofs += sizeof( entry );
+
+			if ( LittleLong( entry[0] ) == -1 ) {
+				complete = ( LittleLong( entry[1] ) == di.demoLength );
+				break;
+			}
+
+			if ( di.numKeyframes == MAX_DEMO_KEYFRAMES ) {
+				break;
+			}
+
+			kf = &di.keyframes[ di.numKeyframes ];
+			kf->serverTime = LittleLong( entry[0] );
+			kf->demoOffset = LittleLong( entry[1] );
+			kf->length = LittleLong( entry[2] );
+			kf->indexOffset = ofs;
+
+			if ( kf->length <= 0 || kf->length > MAX_KEYFRAME_LENGTH ) {
+				break;
+			}
+			di.numKeyframes++;
+
+			ofs += kf->length;
+			FS_Seek( f, ofs, FS_SEEK_SET );
+		}
+	}
+
+	FS_FCloseFile( f );
+
+	if ( !complete ) {
+		Com_DPrintf( "%s is out of date\n", di.indexName );
+		di.numKeyframes = 0;
+		return qfalse;
+	}
+
+	if ( di.numKeyframes ) {
+		di.startTime = di.keyframes[0].serverTime;
+	}
+
+	return qtrue;
+}
+
+/*
+====================
+CL_ReadKeyframe
+====================
+*/
+static qboolean CL_ReadKeyframe( int num ) {
+	fileHandle_t	f;
+	demoKeyframe_t	*kf;
+	int				r;
+
+	kf = &di.keyframes[num];
+
+	FS_FOpenFileRead( di.indexName, &f, qtrue );
+	if ( !f ) {
+		return qfalse;
+	}
+
+	FS_Seek( f, kf->indexOffset, FS_SEEK_SET );
+	r = FS_Read( di.replayData, kf->length, f );
+	FS_FCloseFile( f );
+
+	if ( r != kf->length ) {
+		return qfalse;
+	}
+
+	di.replayPos = 0;
+	di.replayLength = kf->length;
+
+	return qtrue;
+}
+
+/*
+====================
+CL_ReadDemoKeyframe
+
+Feeds the records of the keyframe a seek started from to CL_ReadDemoMessage,
+returns qfalse once they are used up
+====================
+*/
+qboolean CL_ReadDemoKeyframe( msg_t *buf ) {
+	int		s, len;
+
+	if ( di.replayPos + 8 > di.replayLength ) {
+		return qfalse;
+	}
+
+	memcpy( &s, di.replayData + di.replayPos, 4 );
+	memcpy( &len, di.replayData + di.replayPos + 4, 4 );
+	len = LittleLong( len );
+
+	if ( len < 0 || len > buf->maxsize || di.replayPos + 8 + len > di.replayLength ) {
+		di.replayPos = di.replayLength;
+		return qfalse;
+	}
+
+	clc.serverMessageSequence = LittleLong( s );
+	buf->cursize = len;
+	memcpy( buf->data, di.replayData + di.replayPos + 8, len );
+
+	di.replayPos += 8 + len;
+
+	return qtrue;
+}
+
+/*
+====================
+CL_DemoIndexStartPlayback
+
+Called by CL_PlayDemo_f once the demo is open
+====================
+*/
+void CL_DemoIndexStartPlayback( const char *demoName ) {
+	int		demoLength, seekTime;
+
+	demoLength = FS_FOpenFileRead( demoName, NULL, qfalse );
+
+	if ( Q_stricmp( demoName, di.demoName ) || demoLength != di.demoLength ) {
+		CL_ResetDemoIndex( demoName, demoLength );
+
+		if ( !CL_LoadDemoIndex() && cl_demoIndex->integer > 0 ) {
+			di.building = CL_OpenDemoIndex();
+		}
+	} else if ( di.building ) {
+		// carry on with the index an earlier playback started
+		di.file = FS_FOpenFileAppend( di.indexName );
+		if ( !di.file ) {
+			di.building = qfalse;
+		}
+	}
+
+	di.lastSnapshot = -1;
+	di.pending = qfalse;
+	di.replayPos = di.replayLength = 0;
+
+	// restarted by demoseek
+	seekTime = di.seekTime;
+	di.seekTime = 0;
+
+	if ( !seekTime ) {
+		return;
+	}
+
+	if ( di.seekKeyframe >= 0 && CL_ReadKeyframe( di.seekKeyframe ) ) {
+		FS_Seek( clc.demofile, di.keyframes[ di.seekKeyframe ].demoOffset, FS_SEEK_SET );
+	}
+
+	clc.demoSeekTime = seekTime;
+}
+
+/*
+====================
+CL_DemoIndexStopPlayback
+
+Called before the demo is closed
+====================
+*/
+void CL_DemoIndexStopPlayback( void ) {
+	// an index built by a playback that got to the end of the demo is complete
+	if ( di.building && clc.demofile && FS_FTell( clc.demofile ) >= di.demoLength ) {
+		CL_CloseDemoIndex( di.demoLength );
+		di.building = qfalse;
+	} else {
+		CL_CloseDemoIndex( 0 );
+	}
+}
+
+/*
+====================
+CL_FindKeyframe
+
+Returns the last keyframe at or before serverTime, -1 if there is none
+====================
+*/
+static int CL_FindKeyframe( int serverTime ) {
+	int		lo, hi, mid, found;
+
+	found = -1;
+	lo = 0;
+	hi = di.numKeyframes - 1;
+
+	while ( lo <= hi ) {
+		mid = ( lo + hi ) / 2;
+		if ( di.keyframes[mid].serverTime <= serverTime ) {
+			found = mid;
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return found;
+}
+
+/*
+====================
+CL_AdvanceDemoSeek
+
+Called by CL_SetCGameTime while a seek catches up, moves the demo time
+on by up to DEMO_SEEK_STEP each frame so the cgame still gets to run the
+server commands in between
+====================
+*/
+void CL_AdvanceDemoSeek( void ) {
+	int		remaining;
+
+	remaining = clc.demoSeekTime - ( cls.realtime + cl.serverTimeDelta );
+	if ( remaining <= 0 ) {
+		clc.demoSeekTime = 0;
+		return;
+	}
+
+	if ( remaining > DEMO_SEEK_STEP ) {
+		remaining = DEMO_SEEK_STEP;
+	}
+	cl.serverTimeDelta += remaining;
+}
+
+/*
+====================
+CL_DemoSeek_f
+
+demoseek <[+|-]seconds | minutes:seconds>
+====================
+*/
+void CL_DemoSeek_f( void ) {
+	const char	*s, *colon;
+	int			target, num;
+
+	if ( Cmd_Argc() != 2 ) {
+		Com_Printf( "demoseek <[+|-]seconds | minutes:seconds>\n" );
+		return;
+	}
+
+	if ( !clc.demoplaying || clc.state != CA_ACTIVE ) {
+		Com_Printf( "Not playing a demo.\n" );
+		return;
+	}
+
+	if ( cl_timedemo->integer ) {
+		Com_Printf( "Can't seek in a timedemo.\n" );
+		return;
+	}
+
+	s = Cmd_Argv( 1 );
+	if ( s[0] == '+' || s[0] == '-' ) {
+		target = cl.serverTime + atof( s ) * 1000;
+	} else if ( ( colon = strchr( s, ':' ) ) != NULL ) {
+		target = di.startTime + ( atoi( s ) * 60 + atof( colon + 1 ) ) * 1000;
+	} else {
+		target = di.startTime + atof( s ) * 1000;
+	}
+
+	if ( target < di.startTime ) {
+		target = di.startTime;
+	}
+
+	num = CL_FindKeyframe( target );
+
+	// catch up from here when no keyframe gets closer
+	if ( target >= cl.serverTime && ( num < 0 || target - cl.serverTime < DEMO_SEEK_RESTART ||
+		di.keyframes[num].serverTime <= cl.snap.serverTime ) ) {
+		clc.demoSeekTime = target;
+		return;
+	}
+
+	// restart the demo from the keyframe, or from the start without one
+	di.seekTime = target;
+	di.seekKeyframe = num;
+
+	Cbuf_ExecuteText( EXEC_INSERT, va( "demo \"%s\"\n", clc.demoName ) );
+}
@@ -75,9 +75,11 @@ cvar_t	*cl_shownet;
 cvar_t	*cl_showSend;
 cvar_t	*cl_timedemo;
 cvar_t	*cl_timedemoLog;
+cvar_t	*cl_demoIndex;
 cvar_t	*cl_autoRecordDemo;
 cvar_t	*cl_aviFrameRate;
 cvar_t	*cl_aviMotionJpeg;
+cvar_t	*cl_aviWriteThread;
 cvar_t	*cl_forceavidemo;
 
 cvar_t	*cl_freelook;
@@ -620,6 +622,8 @@ void CL_WriteDemoMessage ( msg_t *msg, int headerBytes ) {
 	swlen = LittleLong(len);
 	FS_Write (&swlen, 4, clc.demofile);
 	FS_Write ( msg->data + headerBytes, len, clc.demofile );
+
+	CL_DemoIndexMessage( FS_FTell( clc.demofile ) );
 }
 
 
@@ -642,6 +646,7 @@ void CL_StopRecord_f( void ) {
 	len = -1;
 	FS_Write (&len, 4, clc.demofile);
 	FS_Write (&len, 4, clc.demofile);
+	CL_DemoIndexStopRecord( FS_FTell( clc.demofile ) );
 	FS_FCloseFile (clc.demofile);
 	clc.demofile = 0;
 	clc.demorecording = qfalse;
@@ -672,6 +677,60 @@ void CL_DemoFilename( int number, char *fileName, int fileNameSize ) {
 		, a, b, c, d );
 }
 
+/*
+====================
+CL_WriteDemoGamestate
+
+Writes a gamestate message for the current client state
+====================
+*/
+void CL_WriteDemoGamestate( msg_t *buf, int serverCommandSequence ) {
+	int			i;
+	entityState_t	*ent;
+	entityState_t	nullstate;
+	char		*s;
+
+	// NOTE, MRE: all server->client messages now acknowledge
+	MSG_WriteLong( buf, clc.reliableSequence );
+
+	MSG_WriteByte (buf, svc_gamestate);
+	MSG_WriteLong (buf, serverCommandSequence );
+
+	// configstrings
+	for ( i = 0 ; i < MAX_CONFIGSTRINGS ; i++ ) {
+		if ( !cl.gameState.stringOffsets[i] ) {
+			continue;
+		}
+		s = cl.gameState.stringData + cl.gameState.stringOffsets[i];
+		MSG_WriteByte (buf, svc_configstring);
+		MSG_WriteShort (buf, i);
+		MSG_WriteBigString (buf, s);
+	}
+
+	// baselines
+	memset (&nullstate, 0, sizeof(nullstate));
+	for ( i = 0; i < MAX_GENTITIES ; i++ ) {
+		ent = &cl.entityBaselines[i];
+		if ( !ent->number ) {
+			continue;
+		}
+		MSG_WriteByte (buf, svc_baseline);		
+		MSG_WriteDeltaEntity (buf, &nullstate, ent, qtrue );
+	}
+
+	MSG_WriteByte( buf, svc_EOF );
+	
+	// finished writing the gamestate stuff
+
+	// write the client num
+	MSG_WriteLong(buf, clc.clientNum);
+	// write the checksum feed
+	MSG_WriteLong(buf, clc.checksumFeed);
+
+	// finished writing the client packet
+	MSG_WriteByte( buf, svc_EOF );
+}
+
 /*
 ====================
 CL_Record_f
@@ -686,10 +745,7 @@ void CL_Record_f( void ) {
 	char		name[MAX_OSPATH];
 	byte		bufData[MAX_MSGLEN];
 	msg_t	buf;
-	int			i;
 	int			len;
-	entityState_t	*ent;
-	entityState_t	nullstate;
 	char		*s;
 
 	if ( Cmd_Argc() > 2 ) {
@@ -758,6 +814,8 @@ void CL_Record_f( void ) {
 
 	Q_strncpyz( clc.demoName, demoName, sizeof( clc.demoName ) );
 
+	CL_DemoIndexStartRecord( name );
+
 	// don't start saving messages until a non-delta compressed message is received
 	clc.demowaiting = qtrue;
 
@@ -765,45 +823,7 @@ void CL_Record_f( void ) {
 	MSG_Init (&buf, bufData, sizeof(bufData));
 	MSG_Bitstream(&buf);
 
-	// NOTE, MRE: all server->client messages now acknowledge
-	MSG_WriteLong( &buf, clc.reliableSequence );
-
-	MSG_WriteByte (&buf, svc_gamestate);
-	MSG_WriteLong (&buf, clc.serverCommandSequence );
-
-	// configstrings
-	for ( i = 0 ; i < MAX_CONFIGSTRINGS ; i++ ) {
-		if ( !cl.gameState.stringOffsets[i] ) {
-			continue;
-		}
-		s = cl.gameState.stringData + cl.gameState.stringOffsets[i];
-		MSG_WriteByte (&buf, svc_configstring);
-		MSG_WriteShort (&buf, i);
-		MSG_WriteBigString (&buf, s);
-	}
-
-	// baselines
-	memset (&nullstate, 0, sizeof(nullstate));
-	for ( i = 0; i < MAX_GENTITIES ; i++ ) {
-		ent = &cl.entityBaselines[i];
-		if ( !ent->number ) {
-			continue;
-		}
-		MSG_WriteByte (&buf, svc_baseline);		
-		MSG_WriteDeltaEntity (&buf, &nullstate, ent, qtrue );
-	}
-
-	MSG_WriteByte( &buf, svc_EOF );
-	
-	// finished writing the gamestate stuff
-
-	// write the client num
-	MSG_WriteLong(&buf, clc.clientNum);
-	// write the checksum feed
-	MSG_WriteLong(&buf, clc.checksumFeed);
-
-	// finished writing the client packet
-	MSG_WriteByte( &buf, svc_EOF );
+	CL_WriteDemoGamestate( &buf, clc.serverCommandSequence );
 
 	// write it to the demo file
 	len = LittleLong( clc.serverMessageSequence - 1 );
@@ -923,6 +943,12 @@ void CL_DemoCompleted( void )
 		}
 	}
 
+	// a benchmark goes on with its next demo instead
+	if ( CL_BenchmarkDemoCompleted() ) {
+		CL_Disconnect( qtrue );
+		return;
+	}
+
 	CL_Disconnect( qtrue );
 	CL_NextDemo();
 }
@@ -943,6 +969,16 @@ void CL_ReadDemoMessage( void ) {
 		return;
 	}
 
+	// init the message
+	MSG_Init( &buf, bufData, sizeof( bufData ) );
+
+	// a seek starts with the records of its keyframe
+	if ( CL_ReadDemoKeyframe( &buf ) ) {
+		clc.lastPacketTime = cls.realtime;
+		CL_ParseServerMessage( &buf );
+		return;
+	}
+
 	// get the sequence number
 	r = FS_Read( &s, 4, clc.demofile);
 	if ( r != 4 ) {
@@ -951,9 +987,6 @@ void CL_ReadDemoMessage( void ) {
 	}
 	clc.serverMessageSequence = LittleLong( s );
 
-	// init the message
-	MSG_Init( &buf, bufData, sizeof( bufData ) );
-
 	// get the length
 	r = FS_Read (&buf.cursize, 4, clc.demofile);
 	if ( r != 4 ) {
@@ -978,6 +1011,8 @@ void CL_ReadDemoMessage( void ) {
 	clc.lastPacketTime = cls.realtime;
 	buf.readcount = 0;
 	CL_ParseServerMessage( &buf );
+
+	CL_DemoIndexMessage( FS_FTell( clc.demofile ) );
 }
 
 /*
@@ -1145,6 +1180,8 @@ void CL_PlayDemo_f( void ) {
 		clc.compat = qfalse;
 #endif
 
+	CL_DemoIndexStartPlayback( name );
+
 	// read demo messages until connected
 	while ( clc.state >= CA_CONNECTED && clc.state < CA_PRIMED ) {
 		CL_ReadDemoMessage();
@@ -1399,6 +1436,7 @@ void CL_Disconnect( qboolean showMainMenu )
 
 	if (clc.voipCodecInitialized) {
 		int i;
+		S_FlushVoip();
 		opus_encoder_destroy(clc.opusEncoder);
 		for (i = 0; i < MAX_CLIENTS; i++) {
 			opus_decoder_destroy(clc.opusDecoder[i]);
@@ -1408,6 +1446,10 @@ void CL_Disconnect( qboolean showMainMenu )
 	Cmd_RemoveCommand ("voip");
 #endif
 
+	if ( clc.demoplaying ) {
+		CL_DemoIndexStopPlayback();
+	}
+
 	if ( clc.demofile ) {
 		FS_FCloseFile( clc.demofile );
 		clc.demofile = 0;
@@ -3035,6 +3077,8 @@ void CL_Frame ( int msec )
 	// update the screen
 	SCR_UpdateScreen();
 
+	CL_BenchmarkFrame();
+
 	// update audio
 	S_Update();
 
@@ -3231,6 +3275,7 @@ void CL_InitRef(void)
 	ri.Printf = CL_RefPrintf;
 	ri.Error = Com_Error;
 	ri.Milliseconds = CL_ScaledMilliseconds;
+	ri.Microseconds = Sys_Microseconds;
 	ri.Malloc = CL_RefMalloc;
 	ri.Free = Z_Free;
 #ifdef HUNK_DEBUG
@@ -3527,9 +3572,11 @@ void CL_Init( void )
 
 	cl_timedemo = Cvar_Get ("timedemo", "0", 0);
 	cl_timedemoLog = Cvar_Get ("cl_timedemoLog", "", CVAR_ARCHIVE);
+	cl_demoIndex = Cvar_Get ("cl_demoIndex", "0", CVAR_ARCHIVE);
 	cl_autoRecordDemo = Cvar_Get ("cl_autoRecordDemo", "0", CVAR_ARCHIVE);
 	cl_aviFrameRate = Cvar_Get ("cl_aviFrameRate", "25", CVAR_ARCHIVE);
 	cl_aviMotionJpeg = Cvar_Get ("cl_aviMotionJpeg", "1", CVAR_ARCHIVE);
+	cl_aviWriteThread = Cvar_Get ("cl_aviWriteThread", "1", CVAR_ARCHIVE);
 	cl_forceavidemo = Cvar_Get ("cl_forceavidemo", "0", 0);
 
 	rconAddress = Cvar_Get ("rconAddress", "", 0);
@@ -3658,6 +3705,8 @@ void CL_Init( void )
 	Cmd_AddCommand ("record", CL_Record_f);
 	Cmd_AddCommand ("demo", CL_PlayDemo_f);
 	Cmd_SetCommandCompletionFunc( "demo", CL_CompleteDemoName );
+	Cmd_AddCommand ("demoseek", CL_DemoSeek_f);
+	Cmd_AddCommand ("benchmark", CL_Benchmark_f);
 	Cmd_AddCommand ("cinematic", CL_PlayCinematic_f);
 	Cmd_AddCommand ("stoprecord", CL_StopRecord_f);
 	Cmd_AddCommand ("connect", CL_Connect_f);
@@ -3726,6 +3775,8 @@ void CL_Shutdown(char *finalmsg, qboolean disconnect, qboolean quit)
 	Cmd_RemoveCommand ("disconnect");
 	Cmd_RemoveCommand ("record");
 	Cmd_RemoveCommand ("demo");
+	Cmd_RemoveCommand ("demoseek");
+	Cmd_RemoveCommand ("benchmark");
 	Cmd_RemoveCommand ("cinematic");
 	Cmd_RemoveCommand ("stoprecord");
 	Cmd_RemoveCommand ("connect");
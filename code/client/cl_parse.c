@@ -53,35 +53,6 @@ MESSAGE PARSING
 =========================================================================
 */
 
-/*
-==================
-CL_DeltaEntity
-
-Parses deltas from the given base and adds the resulting entity
-to the current frame
-==================
-*/
-void CL_DeltaEntity (msg_t *msg, clSnapshot_t *frame, int newnum, entityState_t *old, 
-					 qboolean unchanged) {
-	entityState_t	*state;
-
-	// save the parsed entity state into the big circular buffer so
-	// it can be used as the source for a later delta
-	state = &cl.parseEntities[cl.parseEntitiesNum & (MAX_PARSE_ENTITIES-1)];
-
-	if ( unchanged ) {
-		*state = *old;
-	} else {
-		MSG_ReadDeltaEntity( msg, old, state, newnum );
-	}
-
-	if ( state->number == (MAX_GENTITIES-1) ) {
-		return;		// entity was delta removed
-	}
-	cl.parseEntitiesNum++;
-	frame->numEntities++;
-}
-
 /*
 ==================
 CL_ParsePacketEntities
@@ -89,105 +60,10 @@ CL_ParsePacketEntities
 ==================
 */
 void CL_ParsePacketEntities( msg_t *msg, clSnapshot_t *oldframe, clSnapshot_t *newframe) {
-	int			newnum;
-	entityState_t	*oldstate;
-	int			oldindex, oldnum;
-
 	newframe->parseEntitiesNum = cl.parseEntitiesNum;
-	newframe->numEntities = 0;
-
-	// delta from the entities present in oldframe
-	oldindex = 0;
-	oldstate = NULL;
-	if (!oldframe) {
-		oldnum = 99999;
-	} else {
-		if ( oldindex >= oldframe->numEntities ) {
-			oldnum = 99999;
-		} else {
-			oldstate = &cl.parseEntities[
-				(oldframe->parseEntitiesNum + oldindex) & (MAX_PARSE_ENTITIES-1)];
-			oldnum = oldstate->number;
-		}
-	}
-
-	while ( 1 ) {
-		// read the entity index number
-		newnum = MSG_ReadBits( msg, GENTITYNUM_BITS );
-
-		if ( newnum == (MAX_GENTITIES-1) ) {
-			break;
-		}
-
-		if ( msg->readcount > msg->cursize ) {
-			Com_Error (ERR_DROP,"CL_ParsePacketEntities: end of message");
-		}
-
-		while ( oldnum < newnum ) {
-			// one or more entities from the old packet are unchanged
-			if ( cl_shownet->integer == 3 ) {
-				Com_Printf ("%3i:  unchanged: %i\n", msg->readcount, oldnum);
-			}
-			CL_DeltaEntity( msg, newframe, oldnum, oldstate, qtrue );
-			
-			oldindex++;
-
-			if ( oldindex >= oldframe->numEntities ) {
-				oldnum = 99999;
-			} else {
-				oldstate = &cl.parseEntities[
-					(oldframe->parseEntitiesNum + oldindex) & (MAX_PARSE_ENTITIES-1)];
-				oldnum = oldstate->number;
-			}
-		}
-		if (oldnum == newnum) {
-			// delta from previous state
-			if ( cl_shownet->integer == 3 ) {
-				Com_Printf ("%3i:  delta: %i\n", msg->readcount, newnum);
-			}
-			CL_DeltaEntity( msg, newframe, newnum, oldstate, qfalse );
-
-			oldindex++;
-
-			if ( oldindex >= oldframe->numEntities ) {
-				oldnum = 99999;
-			} else {
-				oldstate = &cl.parseEntities[
-					(oldframe->parseEntitiesNum + oldindex) & (MAX_PARSE_ENTITIES-1)];
-				oldnum = oldstate->number;
-			}
-			continue;
-		}
-
-		if ( oldnum > newnum ) {
-			// delta from baseline
-			if ( cl_shownet->integer == 3 ) {
-				Com_Printf ("%3i:  baseline: %i\n", msg->readcount, newnum);
-			}
-			CL_DeltaEntity( msg, newframe, newnum, &cl.entityBaselines[newnum], qfalse );
-			continue;
-		}
-
-	}
-
-	// any remaining entities in the old frame are copied over
-	while ( oldnum != 99999 ) {
-		// one or more entities from the old packet are unchanged
-		if ( cl_shownet->integer == 3 ) {
-			Com_Printf ("%3i:  unchanged: %i\n", msg->readcount, oldnum);
-		}
-		CL_DeltaEntity( msg, newframe, oldnum, oldstate, qtrue );
-		
-		oldindex++;
-
-		if ( oldindex >= oldframe->numEntities ) {
-			oldnum = 99999;
-		} else {
-			oldstate = &cl.parseEntities[
-				(oldframe->parseEntitiesNum + oldindex) & (MAX_PARSE_ENTITIES-1)];
-			oldnum = oldstate->number;
-		}
-	}
+	newframe->numEntities = MSG_ReadPacketEntities( msg, cl.parseEntities, MAX_PARSE_ENTITIES - 1,
+		&cl.parseEntitiesNum, oldframe ? oldframe->parseEntitiesNum : 0,
+		oldframe ? oldframe->numEntities : 0, cl.entityBaselines );
 }
 
 
@@ -679,7 +555,7 @@ Play raw data
 =====================
 */
 
-static void CL_PlayVoip(int sender, int samplecnt, const byte *data, int flags)
+void CL_PlayVoip(int sender, int samplecnt, const byte *data, int flags)
 {
 	if(flags & VOIP_DIRECT)
 	{
@@ -703,19 +579,15 @@ A VoIP message has been received from the server
 */
 static
 void CL_ParseVoip ( msg_t *msg, qboolean ignoreData ) {
-	static short decoded[VOIP_MAX_PACKET_SAMPLES*4]; // !!! FIXME: don't hard code
-
 	const int sender = MSG_ReadShort(msg);
 	const int generation = MSG_ReadByte(msg);
 	const int sequence = MSG_ReadLong(msg);
 	const int frames = MSG_ReadByte(msg);
 	const int packetsize = MSG_ReadShort(msg);
 	const int flags = MSG_ReadBits(msg, VOIP_FLAGCNT);
-	unsigned char encoded[4000];
-	int	numSamples;
+	unsigned char encoded[VOIP_MAX_PACKET_BYTES];
+	qboolean reset = qfalse;
 	int seqdiff;
-	int written = 0;
-	int i;
 
 	Com_DPrintf("VoIP: %d-byte packet from client %d\n", packetsize, sender);
 
@@ -763,7 +635,7 @@ void CL_ParseVoip ( msg_t *msg, qboolean ignoreData ) {
 	// This is a new "generation" ... a new recording started, reset the bits.
 	if (generation != clc.voipIncomingGeneration[sender]) {
 		Com_DPrintf("VoIP: new generation %d!\n", generation);
-		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
+		reset = qtrue;
 		clc.voipIncomingGeneration[sender] = generation;
 		seqdiff = 0;
 	} else if (seqdiff < 0) {   // we're ahead of the sequence?!
@@ -771,54 +643,23 @@ void CL_ParseVoip ( msg_t *msg, qboolean ignoreData ) {
 		Com_DPrintf("VoIP: misordered sequence! %d < %d!\n",
 		            sequence, clc.voipIncomingSequence[sender]);
 		// reset the decoder just in case.
-		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
+		reset = qtrue;
 		seqdiff = 0;
-	} else if (seqdiff * VOIP_MAX_PACKET_SAMPLES*2 >= sizeof (decoded)) { // dropped more than we can handle?
+	} else if (seqdiff * VOIP_MAX_PACKET_SAMPLES >= VOIP_MAX_DECODED_SAMPLES) { // dropped more than we can handle?
 		// just start over.
 		Com_DPrintf("VoIP: Dropped way too many (%d) frames from client #%d\n",
 		            seqdiff, sender);
-		opus_decoder_ctl(clc.opusDecoder[sender], OPUS_RESET_STATE);
+		reset = qtrue;
 		seqdiff = 0;
 	}
 
 	if (seqdiff != 0) {
 		Com_DPrintf("VoIP: Dropped %d frames from client #%d\n",
 		            seqdiff, sender);
-		// tell opus that we're missing frames...
-		for (i = 0; i < seqdiff; i++) {
-			assert((written + VOIP_MAX_PACKET_SAMPLES) * 2 < sizeof (decoded));
-			numSamples = opus_decode(clc.opusDecoder[sender], NULL, 0, decoded + written, VOIP_MAX_PACKET_SAMPLES, 0);
-			if ( numSamples <= 0 ) {
-				Com_DPrintf("VoIP: Error decoding frame %d from client #%d\n", i, sender);
-				continue;
-			}
-			written += numSamples;
-		}
-	}
-
-	numSamples = opus_decode(clc.opusDecoder[sender], encoded, packetsize, decoded + written, ARRAY_LEN(decoded) - written, 0);
-
-	if ( numSamples <= 0 ) {
-		Com_DPrintf("VoIP: Error decoding voip data from client #%d\n", sender);
-		numSamples = 0;
 	}
 
-	#if 0
-	static FILE *encio = NULL;
-	if (encio == NULL) encio = fopen("voip-incoming-encoded.bin", "wb");
-	if (encio != NULL) { fwrite(encoded, len, 1, encio); fflush(encio); }
-	static FILE *decio = NULL;
-	if (decio == NULL) decio = fopen("voip-incoming-decoded.bin", "wb");
-	if (decio != NULL) { fwrite(decoded+written, clc.speexFrameSize*2, 1, decio); fflush(decio); }
-	#endif
-
-	written += numSamples;
-
-	Com_DPrintf("VoIP: playback %d bytes, %d samples, %d frames\n",
-	            written * 2, written, frames);
-
-	if(written > 0)
-		CL_PlayVoip(sender, written, (const byte *) decoded, flags);
+	// the sound system decodes it, concealing the missing frames, and plays it
+	S_DecodeVoip(sender, flags, reset, seqdiff, encoded, packetsize);
 
 	clc.voipIncomingSequence[sender] = sequence + frames;
 }
@@ -572,6 +572,12 @@ void SCR_UpdateScreen( void )
 		if ( com_speeds->integer ) {
 			re.EndFrame( &time_frontend, &time_backend );
 		}
+		else if ( cl_timedemo->integer ) {
+			int64_t start = Sys_Microseconds();
+
+			re.EndFrame( NULL, NULL );
+			clc.timeDemoEndFrameUsec += Sys_Microseconds() - start;
+		}
         else {
 			re.EndFrame( NULL, NULL );
 		}
@@ -217,6 +217,7 @@ typedef struct{
 	qboolean	demowaiting;	// don't record until a non-delta message is received
 	qboolean	firstDemoFrameSkipped;
 	fileHandle_t demofile;
+	int			demoSeekTime;	// serverTime a demoseek is catching up to
 
 	int			timeDemoFrames;		// counter of rendered frames
 	int			timeDemoStart;		// cls.realtime before first frame
@@ -225,6 +226,9 @@ typedef struct{
 	int			timeDemoMinDuration;	// minimum frame duration
 	int			timeDemoMaxDuration;	// maximum frame duration
 	unsigned char	timeDemoDurations[ MAX_TIMEDEMO_DURATIONS ];	// log of frame durations
+	int			timeDemoCGameUsec;		// this frame in the cgame, its scenes included
+	int			timeDemoFrontEndUsec;	// this frame in RenderScene
+	int			timeDemoEndFrameUsec;	// this frame in EndFrame, back end and swap
 
 	float	aviVideoFrameRemainder;
 	float	aviSoundFrameRemainder;
@@ -390,8 +394,10 @@ extern	cvar_t	*m_side;
 extern	cvar_t	*m_filter;
 
 extern	cvar_t	*cl_timedemo;
+extern	cvar_t	*cl_demoIndex;
 extern	cvar_t	*cl_aviFrameRate;
 extern	cvar_t	*cl_aviMotionJpeg;
+extern	cvar_t	*cl_aviWriteThread;
 
 extern	cvar_t	*cl_activeAction;
 
@@ -434,6 +440,10 @@ extern	cvar_t	*cl_voip;
 // 3 frame is 60ms of audio, the max opus will encode at once
 #define VOIP_MAX_PACKET_FRAMES		3
 #define VOIP_MAX_PACKET_SAMPLES		( VOIP_MAX_FRAME_SAMPLES * VOIP_MAX_PACKET_FRAMES )
+
+// one packet and the frames concealed before it
+#define VOIP_MAX_DECODED_SAMPLES	( VOIP_MAX_PACKET_SAMPLES * 4 )
+#define VOIP_MAX_PACKET_BYTES		4000
 #endif
 
 //=================================================
@@ -500,6 +510,7 @@ extern int cl_connectedToCheatServer;
 
 #ifdef USE_VOIP
 void CL_Voip_f(void);
+void CL_PlayVoip(int sender, int samplecnt, const byte *data, int flags);
 #endif
 
 void CL_SystemInfoChanged(void);
@@ -616,8 +627,28 @@ void CL_WriteAVIAudioFrame(const unsigned char *pcmBuffer, int size);
 qboolean CL_CloseAVI(void);
 qboolean CL_VideoRecording(void);
 
+//
+// cl_bench.c
+//
+void CL_BenchmarkFrame( void );
+qboolean CL_BenchmarkDemoCompleted( void );
+void CL_Benchmark_f( void );
+
+//
+// cl_demoindex.c
+//
+void CL_DemoIndexMessage( int offset );
+void CL_DemoIndexStartRecord( const char *demoName );
+void CL_DemoIndexStopRecord( int demoLength );
+void CL_DemoIndexStartPlayback( const char *demoName );
+void CL_DemoIndexStopPlayback( void );
+qboolean CL_ReadDemoKeyframe( msg_t *buf );
+void CL_AdvanceDemoSeek( void );
+void CL_DemoSeek_f( void );
+
 //
 // cl_main.c
 //
 void CL_WriteDemoMessage ( msg_t *msg, int headerBytes );
+void CL_WriteDemoGamestate( msg_t *buf, int serverCommandSequence );
 
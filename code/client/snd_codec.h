@@ -75,6 +75,12 @@ snd_stream_t *S_CodecOpenStream(const char *filename);
 void S_CodecCloseStream(snd_stream_t *stream);
 int S_CodecReadStream(snd_stream_t *stream, int bytes, void *buffer);
 
+// Streams decoded ahead on the decode thread, see snd_decode.c
+// S_DecodeReadStream returns 0 while the decoder is behind, -1 at the end
+void S_DecodeStartStream(snd_stream_t *stream);
+void S_DecodeStopStream(void);
+int S_DecodeReadStream(snd_stream_t *stream, int bytes, void *buffer);
+
 // Util functions (used by codecs)
 snd_stream_t *S_CodecUtilOpen(const char *filename, snd_codec_t *codec);
 void S_CodecUtilClose(snd_stream_t **stream);
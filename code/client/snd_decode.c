@@ -0,0 +1,427 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// snd_decode.c -- music and VoIP decoding ahead of the main thread
+
+#include "snd_local.h"
+#include "snd_codec.h"
+#include "client.h"
+
+/*
+With s_decodeThread the background music stream is read and decoded into
+a ring on a thread of its own, and incoming VoIP packets are queued there
+and come back as decoded frames. Each ring has a single producer and a
+single consumer. The decode thread only works while holding its lock, so
+the main thread takes the lock to hand streams over or to flush the rings.
+
+From S_DecodeStartStream to S_DecodeStopStream the music stream, and the
+file handle under it, belong to the decode thread alone. Streams are opened
+with a handle of their own, in a pk3 too, so the FS_Read and FS_Seek the
+codecs do there share nothing with the main thread's files. The only error
+those raise is for a file system that isn't up, which Com_Error can't take
+off the main thread, so the stream just ends then. The sound system stops
+the stream before the file system is restarted or shut down.
+
+Without the thread everything is decoded inline, as before.
+*/
+
+#define	DECODE_THREAD_MSEC		10
+
+// about 1.5 seconds of 44k stereo music
+#define	STREAM_RING_SIZE		0x40000		// must be a power of two
+#define	STREAM_READ_SIZE		0x4000
+
+static cvar_t		*s_decodeThread;
+static qboolean		s_decodeThreadRunning;
+
+static snd_stream_t	*s_decodeStream;
+static byte			s_streamRing[STREAM_RING_SIZE];
+static byte			s_streamRead[STREAM_READ_SIZE];
+static int			s_streamHead;		// written by the decode thread
+static int			s_streamTail;		// written by the main thread
+static int			s_streamEnded;
+
+#ifdef USE_VOIP
+#define	MAX_VOIP_PACKETS		32			// must be a power of two
+#define	MAX_VOIP_FRAMES			16			// must be a power of two
+
+typedef struct {
+	int			sender;
+	int			flags;
+	qboolean	reset;
+	int			lostFrames;
+	int			size;
+	byte		data[VOIP_MAX_PACKET_BYTES];
+} voipPacket_t;
+
+typedef struct {
+	int			sender;
+	int			flags;
+	int			numSamples;
+	short		samples[VOIP_MAX_DECODED_SAMPLES];
+} voipFrame_t;
+
+static voipPacket_t	s_voipPackets[MAX_VOIP_PACKETS];
+static int			s_voipPacketHead;	// written by the main thread
+static int			s_voipPacketTail;	// written by the decode thread
+
+static voipFrame_t	s_voipFrames[MAX_VOIP_FRAMES];
+static int			s_voipFrameHead;	// written by the decode thread
+static int			s_voipFrameTail;	// written by the main thread
+#endif
+
+
+/*
+===============================================================================
+
+music streams
+
+===============================================================================
+*/
+
+/*
+=================
+S_DecodeStreamAhead
+
+Fills the ring with as much of the stream as fits
+=================
+*/
+static void S_DecodeStreamAhead( void ) {
+	int		head, space, r, ofs, n;
+
+	if ( !s_decodeStream || s_streamEnded ) {
+		return;
+	}
+
+	if ( !FS_Initialized() ) {
+		S_StoreRelease( &s_streamEnded, 1 );
+		return;
+	}
+
+	head = s_streamHead;
+
+	while ( 1 ) {
+		space = STREAM_RING_SIZE - ( head - S_LoadAcquire( &s_streamTail ) );
+		if ( space < STREAM_READ_SIZE ) {
+			break;
+		}
+
+		r = S_CodecReadStream( s_decodeStream, STREAM_READ_SIZE, s_streamRead );
+		if ( r <= 0 ) {
+			S_StoreRelease( &s_streamEnded, 1 );
+			break;
+		}
+
+		ofs = head & ( STREAM_RING_SIZE - 1 );
+		n = STREAM_RING_SIZE - ofs;
+		if ( n > r ) {
+			n = r;
+		}
+		memcpy( s_streamRing + ofs, s_streamRead, n );
+		memcpy( s_streamRing, s_streamRead + n, r - n );
+
+		head += r;
+		S_StoreRelease( &s_streamHead, head );
+	}
+}
+
+/*
+=================
+S_DecodeStartStream
+
+Hands the stream over to the decode thread
+=================
+*/
+void S_DecodeStartStream( snd_stream_t *stream ) {
+	SNDDMA_LockThread( SND_THREAD_DECODE );
+	s_decodeStream = stream;
+	s_streamHead = s_streamTail = 0;
+	s_streamEnded = 0;
+	SNDDMA_UnlockThread( SND_THREAD_DECODE );
+}
+
+/*
+=================
+S_DecodeStopStream
+
+Takes the stream back, it can be closed after this
+=================
+*/
+void S_DecodeStopStream( void ) {
+	SNDDMA_LockThread( SND_THREAD_DECODE );
+	s_decodeStream = NULL;
+	s_streamHead = s_streamTail = 0;
+	s_streamEnded = 0;
+	SNDDMA_UnlockThread( SND_THREAD_DECODE );
+}
+
+/*
+=================
+S_DecodeReadStream
+
+Only whole sample frames are returned
+=================
+*/
+int S_DecodeReadStream( snd_stream_t *stream, int bytes, void *buffer ) {
+	int		frameBytes, ended, head, tail, ofs, n;
+
+	if ( !s_decodeThreadRunning || stream != s_decodeStream ) {
+		n = S_CodecReadStream( stream, bytes, buffer );
+		return n > 0 ? n : -1;
+	}
+
+	// the end is flagged after the last bytes went in
+	ended = S_LoadAcquire( &s_streamEnded );
+	head = S_LoadAcquire( &s_streamHead );
+	tail = s_streamTail;
+
+	frameBytes = stream->info.width * stream->info.channels;
+	if ( bytes > head - tail ) {
+		bytes = head - tail;
+		bytes -= bytes % frameBytes;
+	}
+
+	if ( bytes <= 0 ) {
+		return ended ? -1 : 0;
+	}
+
+	ofs = tail & ( STREAM_RING_SIZE - 1 );
+	n = STREAM_RING_SIZE - ofs;
+	if ( n > bytes ) {
+		n = bytes;
+	}
+	memcpy( buffer, s_streamRing + ofs, n );
+	memcpy( (byte *)buffer + n, s_streamRing, bytes - n );
+
+	S_StoreRelease( &s_streamTail, tail + bytes );
+
+	return bytes;
+}
+
+
+/*
+===============================================================================
+
+VoIP
+
+===============================================================================
+*/
+
+#ifdef USE_VOIP
+/*
+=================
+S_DecodeVoipPacket
+=================
+*/
+static int S_DecodeVoipPacket( const voipPacket_t *packet, short *decoded ) {
+	OpusDecoder	*decoder;
+	int			numSamples, written, i;
+
+	decoder = clc.opusDecoder[packet->sender];
+	written = 0;
+
+	if ( packet->reset ) {
+		opus_decoder_ctl( decoder, OPUS_RESET_STATE );
+	}
+
+	// tell opus that we're missing frames...
+	for ( i = 0; i < packet->lostFrames; i++ ) {
+		numSamples = opus_decode( decoder, NULL, 0, decoded + written, VOIP_MAX_PACKET_SAMPLES, 0 );
+		if ( numSamples > 0 ) {
+			written += numSamples;
+		}
+	}
+
+	numSamples = opus_decode( decoder, packet->data, packet->size, decoded + written, VOIP_MAX_DECODED_SAMPLES - written, 0 );
+	if ( numSamples > 0 ) {
+		written += numSamples;
+	}
+
+	return written;
+}
+
+/*
+=================
+S_DecodeVoipPackets
+
+Decodes queued packets while there is room for the frames
+=================
+*/
+static void S_DecodeVoipPackets( void ) {
+	voipPacket_t	*packet;
+	voipFrame_t		*frame;
+	int				packetTail, packetHead, frameHead;
+
+	packetTail = s_voipPacketTail;
+	packetHead = S_LoadAcquire( &s_voipPacketHead );
+	frameHead = s_voipFrameHead;
+
+	while ( packetTail != packetHead ) {
+		if ( frameHead - S_LoadAcquire( &s_voipFrameTail ) >= MAX_VOIP_FRAMES ) {
+			break;
+		}
+
+		packet = &s_voipPackets[ packetTail & ( MAX_VOIP_PACKETS - 1 ) ];
+		frame = &s_voipFrames[ frameHead & ( MAX_VOIP_FRAMES - 1 ) ];
+
+		frame->sender = packet->sender;
+		frame->flags = packet->flags;
+		frame->numSamples = S_DecodeVoipPacket( packet, frame->samples );
+
+		S_StoreRelease( &s_voipFrameHead, ++frameHead );
+		S_StoreRelease( &s_voipPacketTail, ++packetTail );
+	}
+}
+
+/*
+=================
+S_DecodeVoip
+=================
+*/
+void S_DecodeVoip( int sender, int flags, qboolean reset, int lostFrames, const byte *data, int size ) {
+	voipPacket_t	*packet;
+	int				head, numSamples;
+
+	head = s_voipPacketHead;
+
+	if ( head - S_LoadAcquire( &s_voipPacketTail ) >= MAX_VOIP_PACKETS ) {
+		Com_DPrintf( "VoIP: decode queue full, dropping packet from client #%d\n", sender );
+		return;
+	}
+
+	packet = &s_voipPackets[ head & ( MAX_VOIP_PACKETS - 1 ) ];
+	packet->sender = sender;
+	packet->flags = flags;
+	packet->reset = reset;
+	packet->lostFrames = lostFrames;
+	packet->size = size;
+	memcpy( packet->data, data, size );
+
+	if ( !s_decodeThreadRunning ) {
+		numSamples = S_DecodeVoipPacket( packet, s_voipFrames[0].samples );
+		if ( numSamples > 0 ) {
+			CL_PlayVoip( sender, numSamples, (const byte *)s_voipFrames[0].samples, flags );
+		}
+		return;
+	}
+
+	S_StoreRelease( &s_voipPacketHead, head + 1 );
+}
+
+/*
+=================
+S_FlushVoip
+=================
+*/
+void S_FlushVoip( void ) {
+	SNDDMA_LockThread( SND_THREAD_DECODE );
+	s_voipPacketHead = s_voipPacketTail = 0;
+	s_voipFrameHead = s_voipFrameTail = 0;
+	SNDDMA_UnlockThread( SND_THREAD_DECODE );
+}
+#endif
+
+
+/*
+===============================================================================
+
+decode thread
+
+===============================================================================
+*/
+
+/*
+=================
+S_DecodeThreadFrame
+
+Called by the decode thread every DECODE_THREAD_MSEC
+=================
+*/
+static void S_DecodeThreadFrame( void ) {
+	SNDDMA_LockThread( SND_THREAD_DECODE );
+
+	S_DecodeStreamAhead();
+#ifdef USE_VOIP
+	S_DecodeVoipPackets();
+#endif
+
+	SNDDMA_UnlockThread( SND_THREAD_DECODE );
+}
+
+/*
+=================
+S_UpdateDecode
+
+Plays the VoIP frames decoded since the last client frame
+=================
+*/
+void S_UpdateDecode( void ) {
+#ifdef USE_VOIP
+	voipFrame_t	*frame;
+	int			tail, head;
+
+	tail = s_voipFrameTail;
+	head = S_LoadAcquire( &s_voipFrameHead );
+
+	while ( tail != head ) {
+		frame = &s_voipFrames[ tail & ( MAX_VOIP_FRAMES - 1 ) ];
+		if ( frame->numSamples > 0 ) {
+			CL_PlayVoip( frame->sender, frame->numSamples, (const byte *)frame->samples, frame->flags );
+		}
+		tail++;
+	}
+
+	S_StoreRelease( &s_voipFrameTail, tail );
+#endif
+}
+
+/*
+=================
+S_InitDecode
+=================
+*/
+void S_InitDecode( void ) {
+	s_decodeThread = Cvar_Get( "s_decodeThread", "0", CVAR_ARCHIVE | CVAR_LATCH );
+
+	if ( s_decodeThread->integer ) {
+		s_decodeThreadRunning = SNDDMA_StartThread( SND_THREAD_DECODE, S_DecodeThreadFrame, DECODE_THREAD_MSEC );
+		if ( !s_decodeThreadRunning ) {
+			Com_Printf( S_COLOR_YELLOW "WARNING: no sound decode thread, decoding on the main thread\n" );
+		}
+	}
+}
+
+/*
+=================
+S_ShutdownDecode
+=================
+*/
+void S_ShutdownDecode( void ) {
+	if ( s_decodeThreadRunning ) {
+		SNDDMA_StopThread( SND_THREAD_DECODE );
+		s_decodeThreadRunning = qfalse;
+	}
+
+	S_DecodeStopStream();
+#ifdef USE_VOIP
+	S_FlushVoip();
+#endif
+}
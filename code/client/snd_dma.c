@@ -35,7 +35,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 void S_Update_( void );
 void S_Base_StopAllSounds(void);
-void S_Base_StopBackgroundTrack( void );
+static void S_StopBackgroundTrack_( void );
 
 snd_stream_t	*s_backgroundStream = NULL;
 static char		s_backgroundLoop[MAX_QPATH];
@@ -80,6 +80,8 @@ cvar_t		*s_testsound;
 cvar_t		*s_show;
 cvar_t		*s_mixahead;
 cvar_t		*s_mixPreStep;
+cvar_t		*s_mixSIMD;
+cvar_t		*s_mixThread;
 
 static loopSound_t		loopSounds[MAX_GENTITIES];
 static	channel_t		*freelist = NULL;
@@ -87,6 +89,110 @@ static	channel_t		*freelist = NULL;
 int						s_rawend[MAX_RAW_STREAMS];
 portable_samplepair_t s_rawsamples[MAX_RAW_STREAMS][MAX_RAW_SAMPLES];
 
+// milliseconds the mixer thread sleeps between mixes
+#define		MIX_THREAD_MSEC		5
+
+static qboolean			s_mixThreadRunning;
+static int				s_droppedSounds;
+static int				s_droppedSoundsReported;
+
+// CL_VideoRecording as of the last S_Base_Update, for the mixer thread
+qboolean				s_videoRecording;
+
+// the mixer thread wrapped the sample counters, the music is
+// stopped on the main thread since that closes the file
+static int				s_stopBackgroundTrack;
+
+
+// =======================================================================
+// Sound commands
+//
+// The game only posts starts, stops and position changes; they are run
+// by whoever paints next. With s_mixThread the main thread is the single
+// producer and the mixer thread the consumer, so posting never waits on a
+// mix in progress. Everything else that touches the channels or the sound
+// memory takes the mixer lock.
+// =======================================================================
+
+typedef enum {
+	SC_START_SOUND,
+	SC_STOP_LOOPING_SOUND,
+	SC_CLEAR_LOOPING_SOUNDS,
+	SC_ADD_LOOPING_SOUND,
+	SC_ADD_REAL_LOOPING_SOUND,
+	SC_UPDATE_ENTITY_POSITION,
+	SC_RESPATIALIZE
+} soundCommandType_t;
+
+typedef struct {
+	soundCommandType_t	type;
+	int			entityNum;
+	int			arg;			// entchannel or killall
+	int			time;			// Com_Milliseconds() when posted
+	int			framecount;		// cls.framecount when posted
+	sfx_t		*sfx;
+	qboolean	localSound;
+	qboolean	fixedOrigin;
+	vec3_t		origin;
+	vec3_t		velocity;
+	vec3_t		axis[3];
+} soundCommand_t;
+
+#define		MAX_SOUND_COMMANDS	2048	// must be a power of two
+
+static soundCommand_t	s_commands[MAX_SOUND_COMMANDS];
+static int				s_commandHead;		// only written by the main thread
+static int				s_commandTail;		// only written by the lock holder
+
+static void S_ExecuteCommand( soundCommand_t *cmd );
+
+/*
+=================
+S_ExecuteCommands
+
+Runs everything posted so far, the caller holds the mixer lock
+=================
+*/
+static void S_ExecuteCommands( void ) {
+	int		tail, head;
+
+	tail = s_commandTail;
+	head = S_LoadAcquire( &s_commandHead );
+
+	while ( tail != head ) {
+		S_ExecuteCommand( &s_commands[ tail & ( MAX_SOUND_COMMANDS - 1 ) ] );
+		tail++;
+	}
+
+	S_StoreRelease( &s_commandTail, tail );
+}
+
+/*
+=================
+S_PostCommand
+=================
+*/
+static void S_PostCommand( soundCommand_t *cmd ) {
+	int		head;
+
+	if ( !s_mixThreadRunning ) {
+		S_ExecuteCommand( cmd );
+		return;
+	}
+
+	head = s_commandHead;
+
+	if ( head - S_LoadAcquire( &s_commandTail ) >= MAX_SOUND_COMMANDS ) {
+		// the mixer fell behind, catch up here
+		SNDDMA_LockThread( SND_THREAD_MIX );
+		S_ExecuteCommands();
+		SNDDMA_UnlockThread( SND_THREAD_MIX );
+	}
+
+	s_commands[ head & ( MAX_SOUND_COMMANDS - 1 ) ] = *cmd;
+	S_StoreRelease( &s_commandHead, head + 1 );
+}
+
 
 // ====================================================================
 // User-setable variables
@@ -104,6 +210,8 @@ void S_Base_SoundInfo(void) {
 		Com_Printf("%5d submission_chunk\n", dma.submission_chunk);
 		Com_Printf("%5d speed\n", dma.speed);
 		Com_Printf("%p dma buffer\n", dma.buffer);
+		Com_Printf("%5s mixer\n", S_MixKernelsImplementation());
+		Com_Printf("%5s mixer thread\n", s_mixThreadRunning ? "on" : "off");
 		if ( s_backgroundStream ) {
 			Com_Printf("Background file: %s\n", s_backgroundLoop );
 		} else {
@@ -186,14 +294,14 @@ void S_ChannelFree(channel_t *v) {
 	freelist = (channel_t*)v;
 }
 
-channel_t*	S_ChannelMalloc( void ) {
+channel_t*	S_ChannelMalloc( int time ) {
 	channel_t *v;
 	if (freelist == NULL) {
 		return NULL;
 	}
 	v = freelist;
 	freelist = *(channel_t **)freelist;
-	v->allocTime = Com_Milliseconds();
+	v->allocTime = time;
 	return v;
 }
 
@@ -394,22 +502,31 @@ void S_Base_BeginRegistration( void ) {
 	s_soundMuted = qfalse;		// we can play again
 
 	if (s_numSfx == 0) {
+		SNDDMA_LockThread( SND_THREAD_MIX );
 		SND_setup();
 
 		memset(s_knownSfx, '\0', sizeof(s_knownSfx));
 		memset(sfxHash, '\0', sizeof(sfx_t *) * LOOP_HASH);
+		SNDDMA_UnlockThread( SND_THREAD_MIX );
 
 		S_Base_RegisterSound("sound/misc/silence.wav", qfalse);		// changed to a sound in baseoa
 	}
 }
 
 void S_memoryLoad(sfx_t	*sfx) {
-	// load the sound file
-	if ( !S_LoadSound ( sfx ) ) {
+	qboolean	loaded;
+
+	// load the sound file, S_LoadSound takes the mixer lock
+	// only once the file is read
+	loaded = S_LoadSound( sfx );
+
+	SNDDMA_LockThread( SND_THREAD_MIX );
+	if ( !loaded ) {
 //		Com_Printf( S_COLOR_YELLOW "WARNING: couldn't load sound: %s\n", sfx->soundName );
 		sfx->defaultSound = qtrue;
 	}
 	sfx->inMemory = qtrue;
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
 }
 
 //=============================================================================
@@ -517,45 +634,18 @@ static qboolean S_Base_HearingThroughEntity( int entityNum, vec3_t origin )
 
 /*
 ====================
-S_Base_StartSoundEx
+S_StartSoundOnChannel
 
-Validates the parms and ques the sound up
-if origin is NULL, the sound will be dynamically sourced from the entity
+Picks a channel for a sound posted by S_Base_StartSoundEx
 Entchannel 0 will never override a playing sound
 ====================
 */
-static void S_Base_StartSoundEx( vec3_t origin, int entityNum, int entchannel, sfxHandle_t sfxHandle, qboolean localSound ) {
+static void S_StartSoundOnChannel( vec3_t origin, int entityNum, int entchannel, sfx_t *sfx, qboolean localSound, int time ) {
 	channel_t	*ch;
-	sfx_t		*sfx;
-  int i, oldest, chosen, time;
+  int i, oldest, chosen;
   int	inplay, allowed;
 	qboolean	fullVolume;
 
-	if ( !s_soundStarted || s_soundMuted ) {
-		return;
-	}
-
-	if ( !origin && ( entityNum < 0 || entityNum >= MAX_GENTITIES ) ) {
-		Com_Error( ERR_DROP, "S_StartSound: bad entitynum %i", entityNum );
-	}
-
-	if ( sfxHandle < 0 || sfxHandle >= s_numSfx ) {
-		Com_Printf( S_COLOR_YELLOW "S_StartSound: handle %i out of range\n", sfxHandle );
-		return;
-	}
-
-	sfx = &s_knownSfx[ sfxHandle ];
-
-	if (sfx->inMemory == qfalse) {
-		S_memoryLoad(sfx);
-	}
-
-	if ( s_show->integer == 1 ) {
-		Com_Printf( "%i : %s\n", s_paintedtime, sfx->soundName );
-	}
-
-	time = Com_Milliseconds();
-
 //	Com_Printf("playing %s\n", sfx->soundName);
 	// pick a channel to play on
 
@@ -589,7 +679,7 @@ static void S_Base_StartSoundEx( vec3_t origin, int entityNum, int entchannel, s
 
 	sfx->lastTimeUsed = time;
 
-	ch = S_ChannelMalloc();	// entityNum, entchannel);
+	ch = S_ChannelMalloc( time );	// entityNum, entchannel);
 	if (!ch) {
 		ch = s_channels;
 
@@ -620,7 +710,7 @@ static void S_Base_StartSoundEx( vec3_t origin, int entityNum, int entchannel, s
 					}
 				}
 				if (chosen == -1) {
-					Com_Printf("dropping sound\n");
+					s_droppedSounds++;	// reported by S_Base_Update
 					return;
 				}
 			}
@@ -645,6 +735,56 @@ static void S_Base_StartSoundEx( vec3_t origin, int entityNum, int entchannel, s
 	ch->rightvol = ch->master_vol;		// unless the game isn't running
 	ch->doppler = qfalse;
 	ch->fullVolume = fullVolume;
+	ch->mixLeftVol = -1;		// no volume ramp into the first mix
+}
+
+/*
+====================
+S_Base_StartSoundEx
+
+Validates the parms and ques the sound up
+if origin is NULL, the sound will be dynamically sourced from the entity
+====================
+*/
+static void S_Base_StartSoundEx( vec3_t origin, int entityNum, int entchannel, sfxHandle_t sfxHandle, qboolean localSound ) {
+	soundCommand_t	cmd;
+	sfx_t		*sfx;
+
+	if ( !s_soundStarted || s_soundMuted ) {
+		return;
+	}
+
+	if ( !origin && ( entityNum < 0 || entityNum >= MAX_GENTITIES ) ) {
+		Com_Error( ERR_DROP, "S_StartSound: bad entitynum %i", entityNum );
+	}
+
+	if ( sfxHandle < 0 || sfxHandle >= s_numSfx ) {
+		Com_Printf( S_COLOR_YELLOW "S_StartSound: handle %i out of range\n", sfxHandle );
+		return;
+	}
+
+	sfx = &s_knownSfx[ sfxHandle ];
+
+	if (sfx->inMemory == qfalse) {
+		S_memoryLoad(sfx);
+	}
+
+	if ( s_show->integer == 1 ) {
+		Com_Printf( "%i : %s\n", s_paintedtime, sfx->soundName );
+	}
+
+	cmd.type = SC_START_SOUND;
+	cmd.entityNum = entityNum;
+	cmd.arg = entchannel;
+	cmd.time = Com_Milliseconds();
+	cmd.sfx = sfx;
+	cmd.localSound = localSound;
+	cmd.fixedOrigin = origin ? qtrue : qfalse;
+	if ( origin ) {
+		VectorCopy( origin, cmd.origin );
+	}
+
+	S_PostCommand( &cmd );
 }
 
 /*
@@ -679,17 +819,11 @@ void S_Base_StartLocalSound( sfxHandle_t sfxHandle, int channelNum ) {
 
 /*
 ==================
-S_ClearSoundBuffer
-
-If we are about to perform file access, clear the buffer
-so sound doesn't stutter.
+S_ClearSoundBuffer_
 ==================
 */
-void S_Base_ClearSoundBuffer( void ) {
+static void S_ClearSoundBuffer_( void ) {
 	int		clear;
-		
-	if (!s_soundStarted)
-		return;
 
 	// stop looping sounds
 	memset(loopSounds, 0, MAX_GENTITIES*sizeof(loopSound_t));
@@ -711,6 +845,24 @@ void S_Base_ClearSoundBuffer( void ) {
 	SNDDMA_Submit ();
 }
 
+/*
+==================
+S_ClearSoundBuffer
+
+If we are about to perform file access, clear the buffer
+so sound doesn't stutter.
+==================
+*/
+void S_Base_ClearSoundBuffer( void ) {
+	if (!s_soundStarted)
+		return;
+
+	SNDDMA_LockThread( SND_THREAD_MIX );
+	S_ExecuteCommands();
+	S_ClearSoundBuffer_();
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
+}
+
 /*
 ==================
 S_StopAllSounds
@@ -722,9 +874,12 @@ void S_Base_StopAllSounds(void) {
 	}
 
 	// stop the background music
-	S_Base_StopBackgroundTrack();
+	S_StopBackgroundTrack_();
 
-	S_Base_ClearSoundBuffer ();
+	SNDDMA_LockThread( SND_THREAD_MIX );
+	S_ExecuteCommands();
+	S_ClearSoundBuffer_();
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
 }
 
 /*
@@ -735,28 +890,100 @@ continuous looping sounds are added each frame
 ==============================================================
 */
 
-void S_Base_StopLoopingSound(int entityNum) {
+static void S_StopLoopingSound_( int entityNum ) {
 	loopSounds[entityNum].active = qfalse;
 //	loopSounds[entityNum].sfx = 0;
 	loopSounds[entityNum].kill = qfalse;
 }
 
+void S_Base_StopLoopingSound(int entityNum) {
+	soundCommand_t	cmd;
+
+	cmd.type = SC_STOP_LOOPING_SOUND;
+	cmd.entityNum = entityNum;
+	S_PostCommand( &cmd );
+}
+
 /*
 ==================
-S_ClearLoopingSounds
-
+S_ClearLoopingSounds_
 ==================
 */
-void S_Base_ClearLoopingSounds( qboolean killall ) {
+static void S_ClearLoopingSounds_( qboolean killall ) {
 	int i;
 	for ( i = 0 ; i < MAX_GENTITIES ; i++) {
 		if (killall || loopSounds[i].kill == qtrue || (loopSounds[i].sfx && loopSounds[i].sfx->soundLength == 0)) {
-			S_Base_StopLoopingSound(i);
+			S_StopLoopingSound_(i);
 		}
 	}
 	numLoopChannels = 0;
 }
 
+/*
+==================
+S_ClearLoopingSounds
+
+==================
+*/
+void S_Base_ClearLoopingSounds( qboolean killall ) {
+	soundCommand_t	cmd;
+
+	cmd.type = SC_CLEAR_LOOPING_SOUNDS;
+	cmd.arg = killall;
+	S_PostCommand( &cmd );
+}
+
+/*
+==================
+S_SetLoopingSound
+
+Runs a posted S_AddLoopingSound or S_AddRealLoopingSound
+==================
+*/
+static void S_SetLoopingSound( const soundCommand_t *cmd ) {
+	loopSound_t	*loop;
+
+	loop = &loopSounds[cmd->entityNum];
+
+	VectorCopy( cmd->origin, loop->origin );
+	VectorCopy( cmd->velocity, loop->velocity );
+	loop->sfx = cmd->sfx;
+	loop->active = qtrue;
+	loop->doppler = qfalse;
+
+	if ( cmd->type == SC_ADD_REAL_LOOPING_SOUND ) {
+		loop->kill = qfalse;
+		return;
+	}
+
+	loop->kill = qtrue;
+	loop->oldDopplerScale = 1.0;
+	loop->dopplerScale = 1.0;
+
+	if (s_doppler->integer && VectorLengthSquared(loop->velocity)>0.0) {
+		vec3_t	out;
+		float	lena, lenb;
+
+		loop->doppler = qtrue;
+		lena = DistanceSquared(loopSounds[listener_number].origin, loop->origin);
+		VectorAdd(loop->origin, loop->velocity, out);
+		lenb = DistanceSquared(loopSounds[listener_number].origin, out);
+		if ((loop->framenum+1) != cmd->framecount) {
+			loop->oldDopplerScale = 1.0;
+		} else {
+			loop->oldDopplerScale = loop->dopplerScale;
+		}
+		loop->dopplerScale = lenb/(lena*100);
+		if (loop->dopplerScale<=1.0) {
+			loop->doppler = qfalse;			// don't bother doing the math
+		} else if (loop->dopplerScale>MAX_DOPPLER_SCALE) {
+			loop->dopplerScale = MAX_DOPPLER_SCALE;
+		}
+	}
+
+	loop->framenum = cmd->framecount;
+}
+
 /*
 ==================
 S_AddLoopingSound
@@ -766,6 +993,7 @@ Include velocity in case I get around to doing doppler...
 ==================
 */
 void S_Base_AddLoopingSound( int entityNum, const vec3_t origin, const vec3_t velocity, sfxHandle_t sfxHandle ) {
+	soundCommand_t	cmd;
 	sfx_t *sfx;
 
 	if ( !s_soundStarted || s_soundMuted ) {
@@ -787,37 +1015,13 @@ void S_Base_AddLoopingSound( int entityNum, const vec3_t origin, const vec3_t ve
 		Com_Error( ERR_DROP, "%s has length 0", sfx->soundName );
 	}
 
-	VectorCopy( origin, loopSounds[entityNum].origin );
-	VectorCopy( velocity, loopSounds[entityNum].velocity );
-	loopSounds[entityNum].active = qtrue;
-	loopSounds[entityNum].kill = qtrue;
-	loopSounds[entityNum].doppler = qfalse;
-	loopSounds[entityNum].oldDopplerScale = 1.0;
-	loopSounds[entityNum].dopplerScale = 1.0;
-	loopSounds[entityNum].sfx = sfx;
-
-	if (s_doppler->integer && VectorLengthSquared(velocity)>0.0) {
-		vec3_t	out;
-		float	lena, lenb;
-
-		loopSounds[entityNum].doppler = qtrue;
-		lena = DistanceSquared(loopSounds[listener_number].origin, loopSounds[entityNum].origin);
-		VectorAdd(loopSounds[entityNum].origin, loopSounds[entityNum].velocity, out);
-		lenb = DistanceSquared(loopSounds[listener_number].origin, out);
-		if ((loopSounds[entityNum].framenum+1) != cls.framecount) {
-			loopSounds[entityNum].oldDopplerScale = 1.0;
-		} else {
-			loopSounds[entityNum].oldDopplerScale = loopSounds[entityNum].dopplerScale;
-		}
-		loopSounds[entityNum].dopplerScale = lenb/(lena*100);
-		if (loopSounds[entityNum].dopplerScale<=1.0) {
-			loopSounds[entityNum].doppler = qfalse;			// don't bother doing the math
-		} else if (loopSounds[entityNum].dopplerScale>MAX_DOPPLER_SCALE) {
-			loopSounds[entityNum].dopplerScale = MAX_DOPPLER_SCALE;
-		}
-	}
-
-	loopSounds[entityNum].framenum = cls.framecount;
+	cmd.type = SC_ADD_LOOPING_SOUND;
+	cmd.entityNum = entityNum;
+	cmd.framecount = cls.framecount;
+	cmd.sfx = sfx;
+	VectorCopy( origin, cmd.origin );
+	VectorCopy( velocity, cmd.velocity );
+	S_PostCommand( &cmd );
 }
 
 /*
@@ -829,6 +1033,7 @@ Include velocity in case I get around to doing doppler...
 ==================
 */
 void S_Base_AddRealLoopingSound( int entityNum, const vec3_t origin, const vec3_t velocity, sfxHandle_t sfxHandle ) {
+	soundCommand_t	cmd;
 	sfx_t *sfx;
 
 	if ( !s_soundStarted || s_soundMuted ) {
@@ -849,12 +1054,13 @@ void S_Base_AddRealLoopingSound( int entityNum, const vec3_t origin, const vec3_
 	if ( !sfx->soundLength ) {
 		Com_Error( ERR_DROP, "%s has length 0", sfx->soundName );
 	}
-	VectorCopy( origin, loopSounds[entityNum].origin );
-	VectorCopy( velocity, loopSounds[entityNum].velocity );
-	loopSounds[entityNum].sfx = sfx;
-	loopSounds[entityNum].active = qtrue;
-	loopSounds[entityNum].kill = qfalse;
-	loopSounds[entityNum].doppler = qfalse;
+
+	cmd.type = SC_ADD_REAL_LOOPING_SOUND;
+	cmd.entityNum = entityNum;
+	cmd.sfx = sfx;
+	VectorCopy( origin, cmd.origin );
+	VectorCopy( velocity, cmd.velocity );
+	S_PostCommand( &cmd );
 }
 
 
@@ -868,8 +1074,8 @@ All sounds are on the same cycle, so any duplicates can just
 sum up the channel multipliers.
 ==================
 */
-void S_AddLoopSounds (void) {
-	int			i, j, time;
+void S_AddLoopSounds (int time) {
+	int			i, j;
 	int			left_total, right_total, left, right;
 	channel_t	*ch;
 	loopSound_t	*loop, *loop2;
@@ -878,8 +1084,6 @@ void S_AddLoopSounds (void) {
 
 	numLoopChannels = 0;
 
-	time = Com_Milliseconds();
-
 	loopFrame++;
 	for ( i = 0 ; i < MAX_GENTITIES ; i++) {
 		loop = &loopSounds[i];
@@ -934,6 +1138,7 @@ void S_AddLoopSounds (void) {
 		ch->dopplerScale = loop->dopplerScale;
 		ch->oldDopplerScale = loop->oldDopplerScale;
 		ch->fullVolume = qfalse;
+		ch->mixLeftVol = -1;	// rebuilt every frame, so never ramped
 		numLoopChannels++;
 		if (numLoopChannels == MAX_CHANNELS) {
 			return;
@@ -971,12 +1176,10 @@ void S_ByteSwapRawSamples( int samples, int width, int s_channels, const byte *d
 
 /*
 ============
-S_Base_RawSamples
-
-Music streaming
+S_RawSamples_
 ============
 */
-void S_Base_RawSamples( int stream, int samples, int rate, int width, int s_channels, const byte *data, float volume, int entityNum)
+static void S_RawSamples_( int stream, int samples, int rate, int width, int s_channels, const byte *data, float volume, int entityNum)
 {
 	int		i;
 	int		src, dst;
@@ -1095,6 +1298,20 @@ void S_Base_RawSamples( int stream, int samples, int rate, int width, int s_chan
 	}
 }
 
+/*
+============
+S_Base_RawSamples
+
+Music streaming
+============
+*/
+void S_Base_RawSamples( int stream, int samples, int rate, int width, int s_channels, const byte *data, float volume, int entityNum)
+{
+	SNDDMA_LockThread( SND_THREAD_MIX );
+	S_RawSamples_( stream, samples, rate, width, s_channels, data, volume, entityNum );
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
+}
+
 //=============================================================================
 
 /*
@@ -1105,29 +1322,29 @@ let the sound system know where an entity currently is
 ======================
 */
 void S_Base_UpdateEntityPosition( int entityNum, const vec3_t origin ) {
+	soundCommand_t	cmd;
+
 	if ( entityNum < 0 || entityNum >= MAX_GENTITIES ) {
 		Com_Error( ERR_DROP, "S_UpdateEntityPosition: bad entitynum %i", entityNum );
 	}
-	VectorCopy( origin, loopSounds[entityNum].origin );
+
+	cmd.type = SC_UPDATE_ENTITY_POSITION;
+	cmd.entityNum = entityNum;
+	VectorCopy( origin, cmd.origin );
+	S_PostCommand( &cmd );
 }
 
 
 /*
 ============
-S_Respatialize
-
-Change the volumes of all the playing sounds for changes in their positions
+S_Respatialize_
 ============
 */
-void S_Base_Respatialize( int entityNum, const vec3_t head, vec3_t axis[3], int inwater ) {
+static void S_Respatialize_( int entityNum, const vec3_t head, vec3_t axis[3], int time ) {
 	int			i;
 	channel_t	*ch;
 	vec3_t		origin;
 
-	if ( !s_soundStarted || s_soundMuted ) {
-		return;
-	}
-
 	listener_number = entityNum;
 	VectorCopy(head, listener_origin);
 	VectorCopy(axis[0], listener_axis[0]);
@@ -1156,7 +1373,63 @@ void S_Base_Respatialize( int entityNum, const vec3_t head, vec3_t axis[3], int
 	}
 
 	// add loopsounds
-	S_AddLoopSounds ();
+	S_AddLoopSounds (time);
+}
+
+/*
+============
+S_Respatialize
+
+Change the volumes of all the playing sounds for changes in their positions
+============
+*/
+void S_Base_Respatialize( int entityNum, const vec3_t head, vec3_t axis[3], int inwater ) {
+	soundCommand_t	cmd;
+
+	if ( !s_soundStarted || s_soundMuted ) {
+		return;
+	}
+
+	cmd.type = SC_RESPATIALIZE;
+	cmd.entityNum = entityNum;
+	cmd.time = Com_Milliseconds();
+	VectorCopy( head, cmd.origin );
+	VectorCopy( axis[0], cmd.axis[0] );
+	VectorCopy( axis[1], cmd.axis[1] );
+	VectorCopy( axis[2], cmd.axis[2] );
+	S_PostCommand( &cmd );
+}
+
+/*
+============
+S_ExecuteCommand
+============
+*/
+static void S_ExecuteCommand( soundCommand_t *cmd ) {
+	switch ( cmd->type ) {
+	case SC_START_SOUND:
+		// local sounds follow the listener at the time they are run
+		S_StartSoundOnChannel( cmd->fixedOrigin ? cmd->origin : NULL,
+			cmd->localSound ? listener_number : cmd->entityNum,
+			cmd->arg, cmd->sfx, cmd->localSound, cmd->time );
+		break;
+	case SC_STOP_LOOPING_SOUND:
+		S_StopLoopingSound_( cmd->entityNum );
+		break;
+	case SC_CLEAR_LOOPING_SOUNDS:
+		S_ClearLoopingSounds_( cmd->arg );
+		break;
+	case SC_ADD_LOOPING_SOUND:
+	case SC_ADD_REAL_LOOPING_SOUND:
+		S_SetLoopingSound( cmd );
+		break;
+	case SC_UPDATE_ENTITY_POSITION:
+		VectorCopy( cmd->origin, loopSounds[cmd->entityNum].origin );
+		break;
+	case SC_RESPATIALIZE:
+		S_Respatialize_( cmd->entityNum, cmd->origin, cmd->axis, cmd->time );
+		break;
+	}
 }
 
 
@@ -1214,10 +1487,16 @@ void S_Base_Update( void ) {
 		return;
 	}
 
+	if ( s_droppedSounds != s_droppedSoundsReported ) {
+		s_droppedSoundsReported = s_droppedSounds;
+		Com_Printf("dropping sound\n");
+	}
+
 	//
 	// debugging output
 	//
 	if ( s_show->integer == 2 ) {
+		SNDDMA_LockThread( SND_THREAD_MIX );
 		total = 0;
 		ch = s_channels;
 		for (i=0 ; i<MAX_CHANNELS; i++, ch++) {
@@ -1228,13 +1507,56 @@ void S_Base_Update( void ) {
 		}
 		
 		Com_Printf ("----(%i)---- painted: %i\n", total, s_paintedtime);
+		SNDDMA_UnlockThread( SND_THREAD_MIX );
+	}
+
+	if ( CL_VideoRecording() != s_videoRecording ) {
+		SNDDMA_LockThread( SND_THREAD_MIX );
+		s_videoRecording = CL_VideoRecording();
+		SNDDMA_UnlockThread( SND_THREAD_MIX );
+	}
+
+	if ( S_LoadAcquire( &s_stopBackgroundTrack ) ) {
+		S_StoreRelease( &s_stopBackgroundTrack, 0 );
+		S_StopBackgroundTrack_();
 	}
 
-	// add raw data from streamed samples
+	// the music is read here without the mixer lock, it is only
+	// taken to add the samples to the raw buffer
 	S_UpdateBackgroundTrack();
 
+	// the mixer thread paints on its own, video capture
+	// mixes in step with the frames on this thread
+	if ( s_mixThreadRunning && !s_videoRecording ) {
+		return;
+	}
+
+	SNDDMA_LockThread( SND_THREAD_MIX );
+
+	S_ExecuteCommands();
+
 	// mix some sound
 	S_Update_();
+
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
+}
+
+/*
+============
+S_MixThreadFrame
+
+Called by the mixer thread every MIX_THREAD_MSEC
+============
+*/
+static void S_MixThreadFrame( void ) {
+	SNDDMA_LockThread( SND_THREAD_MIX );
+
+	if ( !s_videoRecording ) {
+		S_ExecuteCommands();
+		S_Update_();
+	}
+
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
 }
 
 void S_GetSoundtime(void)
@@ -1246,7 +1568,7 @@ void S_GetSoundtime(void)
 	
 	fullsamples = dma.samples / dma.channels;
 
-	if( CL_VideoRecording( ) )
+	if( s_videoRecording )
 	{
 		float fps = cl_aviFrameRate->value<1000.0f ? cl_aviFrameRate->value : 1000.0f;
 		float tmp = dma.speed / fps;
@@ -1270,7 +1592,12 @@ void S_GetSoundtime(void)
 		{	// time to chop things off to avoid 32 bit limits
 			buffers = 0;
 			s_paintedtime = fullsamples;
-			S_Base_StopAllSounds ();
+			S_ClearSoundBuffer_ ();
+
+			// this may be the mixer thread, the music file
+			// is closed on the main thread
+			s_rawend[0] = 0;
+			S_StoreRelease( &s_stopBackgroundTrack, 1 );
 		}
 	}
 	oldsamplepos = samplepos;
@@ -1306,7 +1633,8 @@ void S_Update_(void) {
 		return;
 	}
 
-	thisTime = Com_Milliseconds();
+	// not Com_Milliseconds, this may run on the mixer thread
+	thisTime = Sys_Milliseconds();
 
 	// Updates s_soundtime
 	S_GetSoundtime();
@@ -1367,15 +1695,28 @@ background music functions
 
 /*
 ======================
-S_StopBackgroundTrack
+S_StopBackgroundTrack_
 ======================
 */
-void S_Base_StopBackgroundTrack( void ) {
+static void S_StopBackgroundTrack_( void ) {
 	if(!s_backgroundStream)
 		return;
+	S_DecodeStopStream();
 	S_CodecCloseStream(s_backgroundStream);
 	s_backgroundStream = NULL;
+
+	SNDDMA_LockThread( SND_THREAD_MIX );
 	s_rawend[0] = 0;
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
+}
+
+/*
+======================
+S_StopBackgroundTrack
+======================
+*/
+void S_Base_StopBackgroundTrack( void ) {
+	S_StopBackgroundTrack_();
 }
 
 /*
@@ -1388,6 +1729,7 @@ static void S_OpenBackgroundStream( const char *filename ) {
 	// if restarting the same back ground track
 	if(s_backgroundStream)
 	{
+		S_DecodeStopStream();
 		S_CodecCloseStream(s_backgroundStream);
 		s_backgroundStream = NULL;
 	}
@@ -1402,6 +1744,9 @@ static void S_OpenBackgroundStream( const char *filename ) {
 	if(s_backgroundStream->info.channels != 2 || s_backgroundStream->info.rate != 22050) {
 		Com_Printf(S_COLOR_YELLOW "WARNING: music file %s is not 22k stereo\n", filename );
 	}
+
+	// decode ahead on the decode thread
+	S_DecodeStartStream(s_backgroundStream);
 }
 
 /*
@@ -1424,14 +1769,46 @@ void S_Base_StartBackgroundTrack( const char *intro, const char *loop ){
 		return;
 	}
 
+	// the stream belongs to the main thread, the mixer
+	// only sees the samples in the raw buffer
 	Q_strncpyz( s_backgroundLoop, loop, sizeof( s_backgroundLoop ) );
 
 	S_OpenBackgroundStream( intro );
 }
 
+/*
+======================
+S_BackgroundTrackSpace
+
+How many samples the raw buffer has room for, with the mixer
+thread it is refilled once it is half empty
+======================
+*/
+static int S_BackgroundTrackSpace( void ) {
+	int		space;
+
+	SNDDMA_LockThread( SND_THREAD_MIX );
+
+	if ( s_rawend[0] < s_soundtime ) {
+		s_rawend[0] = s_soundtime;
+	}
+	space = MAX_RAW_SAMPLES - ( s_rawend[0] - s_soundtime );
+
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
+
+	if ( s_mixThreadRunning && space < MAX_RAW_SAMPLES / 2 ) {
+		return 0;
+	}
+
+	return space;
+}
+
 /*
 ======================
 S_UpdateBackgroundTrack
+
+Runs on the main thread without the mixer lock, the stream is
+only read here
 ======================
 */
 void S_UpdateBackgroundTrack( void ) {
@@ -1451,12 +1828,7 @@ void S_UpdateBackgroundTrack( void ) {
 	}
 
 	// see how many samples should be copied into the raw buffer
-	if ( s_rawend[0] < s_soundtime ) {
-		s_rawend[0] = s_soundtime;
-	}
-
-	while ( s_rawend[0] < s_soundtime + MAX_RAW_SAMPLES ) {
-		bufferSamples = MAX_RAW_SAMPLES - (s_rawend[0] - s_soundtime);
+	while ( ( bufferSamples = S_BackgroundTrackSpace() ) > 0 ) {
 
 		// decide how much data needs to be read from the file
 		fileSamples = bufferSamples * s_backgroundStream->info.rate / dma.speed;
@@ -1472,7 +1844,10 @@ void S_UpdateBackgroundTrack( void ) {
 		}
 
 		// Read
-		r = S_CodecReadStream(s_backgroundStream, fileBytes, raw);
+		r = S_DecodeReadStream(s_backgroundStream, fileBytes, raw);
+		if(r == 0)
+			return;		// the decode thread is behind, try again next frame
+
 		if(r < fileBytes)
 		{
 			fileSamples = r / (s_backgroundStream->info.width * s_backgroundStream->info.channels);
@@ -1495,7 +1870,7 @@ void S_UpdateBackgroundTrack( void ) {
 			}
 			else
 			{
-				S_Base_StopBackgroundTrack();
+				S_StopBackgroundTrack_();
 				return;
 			}
 		}
@@ -1549,6 +1924,12 @@ void S_Base_Shutdown( void ) {
 		return;
 	}
 
+	if ( s_mixThreadRunning ) {
+		SNDDMA_StopThread( SND_THREAD_MIX );
+		s_mixThreadRunning = qfalse;
+	}
+	s_commandHead = s_commandTail = 0;
+
 	SNDDMA_Shutdown();
 	SND_shutdown();
 
@@ -1574,6 +1955,10 @@ qboolean S_Base_Init( soundInterface_t *si ) {
 	s_mixPreStep = Cvar_Get ("s_mixPreStep", "0.05", CVAR_ARCHIVE);
 	s_show = Cvar_Get ("s_show", "0", CVAR_CHEAT);
 	s_testsound = Cvar_Get ("s_testsound", "0", CVAR_CHEAT);
+	s_mixSIMD = Cvar_Get ("s_mixSIMD", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	s_mixThread = Cvar_Get ("s_mixThread", "0", CVAR_ARCHIVE | CVAR_LATCH);
+
+	S_InitMixKernels( s_mixSIMD->integer ? qtrue : qfalse );
 
 	r = SNDDMA_Init();
 
@@ -1588,6 +1973,13 @@ qboolean S_Base_Init( soundInterface_t *si ) {
 		s_paintedtime = 0;
 
 		S_Base_StopAllSounds( );
+
+		if ( s_mixThread->integer ) {
+			s_mixThreadRunning = SNDDMA_StartThread( SND_THREAD_MIX, S_MixThreadFrame, MIX_THREAD_MSEC );
+			if ( !s_mixThreadRunning ) {
+				Com_Printf( S_COLOR_YELLOW "WARNING: no mixer thread, mixing on the main thread\n" );
+			}
+		}
 	} else {
 		return qfalse;
 	}
@@ -107,6 +107,8 @@ typedef struct
 	sfx_t		*thesfx;		// sfx structure
 	qboolean	doppler;
 	qboolean	fullVolume;
+	int			mixLeftVol;		// scaled volumes at the end of the last mix, -1 if none
+	int			mixRightVol;
 } channel_t;
 
 
@@ -176,6 +178,45 @@ void	SNDDMA_BeginPainting (void);
 
 void	SNDDMA_Submit(void);
 
+typedef enum {
+	SND_THREAD_MIX,			// paints the dma buffer, see s_mixThread
+	SND_THREAD_DECODE,		// reads music and VoIP ahead, see snd_decode.c
+	SND_NUM_THREADS
+} sndThread_t;
+
+// indexes of the single producer, single consumer rings shared with them
+#if defined( _MSC_VER ) && defined( _M_ARM64 )
+#include <intrin.h>
+#define S_LoadAcquire( p )		( (int)__ldar32( (unsigned __int32 volatile *)(p) ) )
+#define S_StoreRelease( p, v )	__stlr32( (unsigned __int32 volatile *)(p), (unsigned __int32)(v) )
+#elif defined( _MSC_VER )
+#include <intrin.h>
+// x86 loads and stores are acquire and release already, the
+// barrier only keeps the compiler from moving others across
+static ID_INLINE int S_LoadAcquire( int *p ) {
+	int v = *(volatile int *)p;
+	_ReadWriteBarrier();
+	return v;
+}
+
+static ID_INLINE void S_StoreRelease( int *p, int v ) {
+	_ReadWriteBarrier();
+	*(volatile int *)p = v;
+}
+#else
+#define S_LoadAcquire( p )		__atomic_load_n( (p), __ATOMIC_ACQUIRE )
+#define S_StoreRelease( p, v )	__atomic_store_n( (p), (v), __ATOMIC_RELEASE )
+#endif
+
+// runs func every msec milliseconds on a thread of its own,
+// returns qfalse if the backend can't
+qboolean SNDDMA_StartThread( sndThread_t thread, void (*func)( void ), int msec );
+void	SNDDMA_StopThread( sndThread_t thread );
+
+// serializes the thread against the main thread
+void	SNDDMA_LockThread( sndThread_t thread );
+void	SNDDMA_UnlockThread( sndThread_t thread );
+
 #ifdef USE_VOIP
 void SNDDMA_StartCapture(void);
 int SNDDMA_AvailableCaptureSamples(void);
@@ -194,6 +235,7 @@ extern	channel_t   loop_channels[MAX_CHANNELS];
 extern	int		numLoopChannels;
 
 extern	int		s_paintedtime;
+extern	qboolean	s_videoRecording;	// CL_VideoRecording as of the last S_Base_Update
 extern	vec3_t	listener_forward;
 extern	vec3_t	listener_right;
 extern	vec3_t	listener_up;
@@ -220,6 +262,12 @@ void		SND_shutdown(void);
 
 void S_PaintChannels(int endtime);
 
+// snd_mix_kernels.c
+void S_InitMixKernels( qboolean allowSIMD );
+const char *S_MixKernelsImplementation( void );
+void S_MixSamples16( portable_samplepair_t *out, const short *samples, int count, int channels, int leftvol, int rightvol );
+void S_ClipSamples16( short *out, const int *in, int count );
+
 void S_memoryLoad(sfx_t *sfx);
 
 // spatializes a channel
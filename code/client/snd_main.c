@@ -250,6 +250,8 @@ void S_Update( void )
 		}
 	}
 	
+	S_UpdateDecode( );
+
 	if( si.Update ) {
 		si.Update( );
 	}
@@ -518,6 +520,8 @@ void S_Init( void )
 				Com_Error( ERR_FATAL, "Sound interface invalid" );
 			}
 
+			S_InitDecode( );
+
 			S_SoundInfo( );
 			Com_Printf( "--------Sound initialization successful.-------\n\n" );
 		} 
@@ -530,6 +534,8 @@ void S_Init( void )
 
 void S_Shutdown( void )
 {
+	S_ShutdownDecode( );
+
 	if( si.Shutdown )
     {
 		si.Shutdown( );
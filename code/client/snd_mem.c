@@ -234,6 +234,11 @@ qboolean S_LoadSound( sfx_t *sfx )
 
 	sfx->lastTimeUsed = Com_Milliseconds()+1;
 
+	// the sound memory is shared with the mixer thread and
+	// allocating may page out the oldest sound, the file
+	// was read without holding the mixer up
+	SNDDMA_LockThread( SND_THREAD_MIX );
+
 	// each of these compression schemes works just fine
 	// but the 16bit quality is much nicer and with a local
 	// install assured we can rely upon the sound memory
@@ -264,6 +269,8 @@ qboolean S_LoadSound( sfx_t *sfx )
 	}
 
 	sfx->soundChannels = info.channels;
+
+	SNDDMA_UnlockThread( SND_THREAD_MIX );
 	
 	Hunk_FreeTempMemory(samples);
 	Hunk_FreeTempMemory(data);
@@ -35,27 +35,7 @@ static short*   snd_out;
 
 void S_WriteLinearBlastStereo16 (void)
 {
-	int		i;
-	int		val;
-
-	for (i=0 ; i<snd_linear_count ; i+=2)
-	{
-		val = snd_p[i]>>8;
-		if (val > 0x7fff)
-			snd_out[i] = 0x7fff;
-		else if (val < -32768)
-			snd_out[i] = -32768;
-		else
-			snd_out[i] = val;
-
-		val = snd_p[i+1]>>8;
-		if (val > 0x7fff)
-			snd_out[i+1] = 0x7fff;
-		else if (val < -32768)
-			snd_out[i+1] = -32768;
-		else
-			snd_out[i+1] = val;
-	}
+	S_ClipSamples16( snd_out, snd_p, snd_linear_count );
 }
 #elif defined(__GNUC__)
 // uses snd_mixa.s
@@ -134,7 +114,8 @@ void S_TransferStereo16 (unsigned long *pbuf, int endtime)
 		snd_p += snd_linear_count;
 		ls_paintedtime += (snd_linear_count>>1);
 
-		if( CL_VideoRecording( ) )
+		// the mixer thread may be here, only the latched state is safe
+		if( s_videoRecording )
 			CL_WriteAVIAudioFrame( (byte *)snd_out, snd_linear_count << 1 );
 	}
 }
@@ -237,20 +218,56 @@ CHANNEL MIXING
 ===============================================================================
 */
 
+#define	MIX_RAMP_BLOCK		32		// frames mixed with one volume while ramping
+#define	MIX_DOPPLER_BLOCK	256		// frames resampled at a time for doppler
+
+/*
+=================
+S_PaintSpan16
+
+Mixes count frames of contiguous samples. While numBlocks is set the
+volume ramps from the one of the previous mix to the current one, one
+step per MIX_RAMP_BLOCK frames; *pos is the frame of the channel's mix
+the span starts at.
+=================
+*/
+static void S_PaintSpan16( const channel_t *ch, portable_samplepair_t *samp, const short *samples, int count,
+		int channels, int leftvol, int rightvol, int *pos, int numBlocks ) {
+	while ( count > 0 ) {
+		int n = count;
+		int l = leftvol, r = rightvol;
+		int block = *pos / MIX_RAMP_BLOCK;
+
+		if ( block < numBlocks - 1 ) {
+			n = MIX_RAMP_BLOCK - *pos % MIX_RAMP_BLOCK;
+			if ( n > count ) {
+				n = count;
+			}
+			l = ch->mixLeftVol + ( leftvol - ch->mixLeftVol ) * ( block + 1 ) / numBlocks;
+			r = ch->mixRightVol + ( rightvol - ch->mixRightVol ) * ( block + 1 ) / numBlocks;
+		}
+
+		S_MixSamples16( samp, samples, n, channels, l, r );
+		samp += n;
+		samples += n * channels;
+		count -= n;
+		*pos += n;
+	}
+}
+
 static void S_PaintChannelFrom16( channel_t *ch, const sfx_t *sc, int count, int sampleOffset, int bufferOffset ) {
-	int						data, aoff, boff;
 	int						leftvol, rightvol;
-	int						i, j;
+	int						i, n, channels;
+	int						pos, numBlocks;
 	portable_samplepair_t	*samp;
 	sndBuffer				*chunk;
-	short					*samples;
-	float					ooff, fdata[2], fdiv, fleftvol, frightvol;
 
 	if (sc->soundChannels <= 0) {
 		return;
 	}
 
 	samp = &paintbuffer[ bufferOffset ];
+	channels = sc->soundChannels;
 
 	if (ch->doppler) {
 		sampleOffset = sampleOffset*ch->oldDopplerScale;
@@ -273,63 +290,83 @@ static void S_PaintChannelFrom16( channel_t *ch, const sfx_t *sc, int count, int
 		}
 	}
 
-	if (!ch->doppler || ch->dopplerScale==1.0f) {
-		leftvol = ch->leftvol*snd_vol;
-		rightvol = ch->rightvol*snd_vol;
-		samples = chunk->sndChunk;
-		for ( i=0 ; i<count ; i++ ) {
-			data  = samples[sampleOffset++];
-			samp[i].left += (data * leftvol)>>8;
+	leftvol = ch->leftvol*snd_vol;
+	rightvol = ch->rightvol*snd_vol;
+
+	// spatialization only changes once per frame, so instead of
+	// stepping the volume every sample it is ramped per block
+	pos = numBlocks = 0;
+	if ( ch->mixLeftVol >= 0 && ( ch->mixLeftVol != leftvol || ch->mixRightVol != rightvol ) ) {
+		numBlocks = ( count + MIX_RAMP_BLOCK - 1 ) / MIX_RAMP_BLOCK;
+	}
 
-			if ( sc->soundChannels == 2 ) {
-				data = samples[sampleOffset++];
+	if (!ch->doppler || ch->dopplerScale==1.0f) {
+		// each chunk is a contiguous run of samples
+		for ( i = 0; i < count; i += n ) {
+			n = ( SND_CHUNK_SIZE - sampleOffset ) / channels;
+			if ( n > count - i ) {
+				n = count - i;
 			}
-			samp[i].right += (data * rightvol)>>8;
 
+			S_PaintSpan16( ch, samp + i, chunk->sndChunk + sampleOffset, n, channels, leftvol, rightvol, &pos, numBlocks );
+
+			sampleOffset += n * channels;
 			if (sampleOffset == SND_CHUNK_SIZE) {
 				chunk = chunk->next;
-				samples = chunk->sndChunk;
 				sampleOffset = 0;
 			}
 		}
 	} else {
-		fleftvol = ch->leftvol*snd_vol;
-		frightvol = ch->rightvol*snd_vol;
-
-		ooff = sampleOffset;
-		samples = chunk->sndChunk;
-		
+		// resample in 16.16 fixed point into a small block, averaging
+		// the source frames each output frame covers, then mix that
+		short		resampled[MIX_DOPPLER_BLOCK * 2];
+		unsigned	frac = 0;
+		unsigned	step = ch->dopplerScale * 65536.0f;
+
+		for ( i = 0; i < count; i += n ) {
+			int k;
+
+			n = count - i;
+			if ( n > MIX_DOPPLER_BLOCK ) {
+				n = MIX_DOPPLER_BLOCK;
+			}
 
+			for ( k = 0; k < n; k++ ) {
+				int frames, taken, sum[2] = { 0, 0 };
 
+				frac += step;
+				frames = frac >> 16;
+				frac &= 0xffff;
 
-		for ( i=0 ; i<count ; i++ ) {
+				if ( !frames ) {
+					// slowed down, repeat the current frame
+					resampled[k * 2] = chunk->sndChunk[sampleOffset];
+					resampled[k * 2 + 1] = chunk->sndChunk[sampleOffset + channels - 1];
+					continue;
+				}
 
-			aoff = ooff;
-			ooff = ooff + ch->dopplerScale * sc->soundChannels;
-			boff = ooff;
-			fdata[0] = fdata[1] = 0;
-			for (j=aoff; j<boff; j += sc->soundChannels) {
-				if (j == SND_CHUNK_SIZE) {
-					chunk = chunk->next;
-					if (!chunk) {
-						chunk = sc->soundData;
+				for ( taken = 0; taken < frames; taken++ ) {
+					sum[0] += chunk->sndChunk[sampleOffset];
+					sum[1] += chunk->sndChunk[sampleOffset + channels - 1];
+					sampleOffset += channels;
+					if (sampleOffset == SND_CHUNK_SIZE) {
+						chunk = chunk->next;
+						if (!chunk) {
+							chunk = sc->soundData;
+						}
+						sampleOffset = 0;
 					}
-					samples = chunk->sndChunk;
-					ooff -= SND_CHUNK_SIZE;
-				}
-				if ( sc->soundChannels == 2 ) {
-					fdata[0] += samples[j&(SND_CHUNK_SIZE-1)];
-					fdata[1] += samples[(j+1)&(SND_CHUNK_SIZE-1)];
-				} else {
-					fdata[0] += samples[j&(SND_CHUNK_SIZE-1)];
-					fdata[1] += samples[j&(SND_CHUNK_SIZE-1)];
 				}
+				resampled[k * 2] = sum[0] / frames;
+				resampled[k * 2 + 1] = sum[1] / frames;
 			}
-			fdiv = 256 * (boff-aoff) / sc->soundChannels;
-			samp[i].left += (fdata[0] * fleftvol)/fdiv;
-			samp[i].right += (fdata[1] * frightvol)/fdiv;
+
+			S_PaintSpan16( ch, samp + i, resampled, n, 2, leftvol, rightvol, &pos, numBlocks );
 		}
 	}
+
+	ch->mixLeftVol = leftvol;
+	ch->mixRightVol = rightvol;
 }
 
 
@@ -523,6 +560,7 @@ void S_PaintChannels( int endtime ) {
 		ch = s_channels;
 		for ( i = 0; i < MAX_CHANNELS ; i++, ch++ ) {		
 			if ( !ch->thesfx || (ch->leftvol<0.25 && ch->rightvol<0.25 )) {
+				ch->mixLeftVol = ch->mixRightVol = 0;	// ramp up from silence once audible
 				continue;
 			}
 
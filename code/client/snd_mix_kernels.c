@@ -0,0 +1,345 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// snd_mix_kernels.c -- inner loops of the software mixer, C, SSE2 and AVX2
+
+#include "snd_local.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	#define SND_MIX_X86
+	#define SND_MIX_TARGET(x) __attribute__((target(x)))
+	#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#define SND_MIX_X86
+	#define SND_MIX_TARGET(x)
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+typedef void (*mixFunc_t)( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol );
+typedef void (*clipFunc_t)( short *out, const int *in, int count );
+
+static mixFunc_t	s_mixMono;
+static mixFunc_t	s_mixStereo;
+static clipFunc_t	s_clip;
+static const char	*s_mixName;
+
+
+/*
+===============================================================================
+
+C
+
+===============================================================================
+*/
+
+static void MixMono_C( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol )
+{
+	int i;
+
+	for ( i = 0; i < count; i++ ) {
+		int data = samples[i];
+		out[i].left += (data * leftvol)>>8;
+		out[i].right += (data * rightvol)>>8;
+	}
+}
+
+static void MixStereo_C( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol )
+{
+	int i;
+
+	for ( i = 0; i < count; i++, samples += 2 ) {
+		out[i].left += (samples[0] * leftvol)>>8;
+		out[i].right += (samples[1] * rightvol)>>8;
+	}
+}
+
+static void Clip_C( short *out, const int *in, int count )
+{
+	int i, val;
+
+	for ( i = 0; i < count; i++ ) {
+		val = in[i]>>8;
+		if (val > 0x7fff)
+			out[i] = 0x7fff;
+		else if (val < -32768)
+			out[i] = -32768;
+		else
+			out[i] = val;
+	}
+}
+
+
+#ifdef SND_MIX_X86
+
+/*
+===============================================================================
+
+SSE2
+
+SSE2 has no 32 bit multiply, so a volume below 65536 is split into
+vh * 256 + vl and (data * vol) >> 8 is summed as data * vh + ((data * vl) >> 8),
+which is exact because both parts are products of 16 bit values.
+
+===============================================================================
+*/
+
+// eight 16 bit samples times the per lane volumes, as two sets of four 32 bit results
+SND_MIX_TARGET("sse2")
+static void MulVol_SSE2( __m128i d, __m128i vh, __m128i vl, __m128i *lo, __m128i *hi )
+{
+	__m128i hl = _mm_mullo_epi16( d, vh ), hh = _mm_mulhi_epi16( d, vh );
+	__m128i ll = _mm_mullo_epi16( d, vl ), lh = _mm_mulhi_epi16( d, vl );
+
+	*lo = _mm_add_epi32( _mm_unpacklo_epi16( hl, hh ), _mm_srai_epi32( _mm_unpacklo_epi16( ll, lh ), 8 ) );
+	*hi = _mm_add_epi32( _mm_unpackhi_epi16( hl, hh ), _mm_srai_epi32( _mm_unpackhi_epi16( ll, lh ), 8 ) );
+}
+
+// mixes four frames from d, which holds left right pairs
+SND_MIX_TARGET("sse2")
+static void MixFrames4_SSE2( portable_samplepair_t *out, __m128i d, __m128i vh, __m128i vl )
+{
+	__m128i lo, hi;
+
+	MulVol_SSE2( d, vh, vl, &lo, &hi );
+	_mm_storeu_si128( (__m128i *)out, _mm_add_epi32( _mm_loadu_si128( (__m128i *)out ), lo ) );
+	_mm_storeu_si128( (__m128i *)( out + 2 ), _mm_add_epi32( _mm_loadu_si128( (__m128i *)( out + 2 ) ), hi ) );
+}
+
+SND_MIX_TARGET("sse2")
+static void MixMono_SSE2( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol )
+{
+	__m128i vh, vl;
+	int i = 0;
+
+	if ( (unsigned)leftvol > 0xffff || (unsigned)rightvol > 0xffff ) {
+		MixMono_C( out, samples, count, leftvol, rightvol );
+		return;
+	}
+
+	vh = _mm_set1_epi32( ( ( rightvol >> 8 ) << 16 ) | ( leftvol >> 8 ) );
+	vl = _mm_set1_epi32( ( ( rightvol & 255 ) << 16 ) | ( leftvol & 255 ) );
+
+	for ( ; i + 8 <= count; i += 8 ) {
+		__m128i d = _mm_loadu_si128( (const __m128i *)( samples + i ) );
+
+		// duplicate every sample into a left right pair
+		MixFrames4_SSE2( out + i, _mm_unpacklo_epi16( d, d ), vh, vl );
+		MixFrames4_SSE2( out + i + 4, _mm_unpackhi_epi16( d, d ), vh, vl );
+	}
+
+	MixMono_C( out + i, samples + i, count - i, leftvol, rightvol );
+}
+
+SND_MIX_TARGET("sse2")
+static void MixStereo_SSE2( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol )
+{
+	__m128i vh, vl;
+	int i = 0;
+
+	if ( (unsigned)leftvol > 0xffff || (unsigned)rightvol > 0xffff ) {
+		MixStereo_C( out, samples, count, leftvol, rightvol );
+		return;
+	}
+
+	vh = _mm_set1_epi32( ( ( rightvol >> 8 ) << 16 ) | ( leftvol >> 8 ) );
+	vl = _mm_set1_epi32( ( ( rightvol & 255 ) << 16 ) | ( leftvol & 255 ) );
+
+	for ( ; i + 4 <= count; i += 4 ) {
+		MixFrames4_SSE2( out + i, _mm_loadu_si128( (const __m128i *)( samples + i * 2 ) ), vh, vl );
+	}
+
+	MixStereo_C( out + i, samples + i * 2, count - i, leftvol, rightvol );
+}
+
+// the saturating pack is the clamp
+SND_MIX_TARGET("sse2")
+static void Clip_SSE2( short *out, const int *in, int count )
+{
+	int i = 0;
+
+	for ( ; i + 8 <= count; i += 8 ) {
+		__m128i a = _mm_srai_epi32( _mm_loadu_si128( (const __m128i *)( in + i ) ), 8 );
+		__m128i b = _mm_srai_epi32( _mm_loadu_si128( (const __m128i *)( in + i + 4 ) ), 8 );
+		_mm_storeu_si128( (__m128i *)( out + i ), _mm_packs_epi32( a, b ) );
+	}
+
+	Clip_C( out + i, in + i, count - i );
+}
+
+
+/*
+===============================================================================
+
+AVX2
+
+===============================================================================
+*/
+
+SND_MIX_TARGET("avx2")
+static void MixMono_AVX2( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol )
+{
+	const __m256i vol = _mm256_setr_epi32( leftvol, rightvol, leftvol, rightvol, leftvol, rightvol, leftvol, rightvol );
+	int i = 0;
+
+	for ( ; i + 8 <= count; i += 8 ) {
+		__m128i d = _mm_loadu_si128( (const __m128i *)( samples + i ) );
+		__m256i a = _mm256_cvtepi16_epi32( _mm_unpacklo_epi16( d, d ) );
+		__m256i b = _mm256_cvtepi16_epi32( _mm_unpackhi_epi16( d, d ) );
+		__m256i *o = (__m256i *)( out + i );
+
+		a = _mm256_srai_epi32( _mm256_mullo_epi32( a, vol ), 8 );
+		b = _mm256_srai_epi32( _mm256_mullo_epi32( b, vol ), 8 );
+		_mm256_storeu_si256( o, _mm256_add_epi32( _mm256_loadu_si256( o ), a ) );
+		_mm256_storeu_si256( o + 1, _mm256_add_epi32( _mm256_loadu_si256( o + 1 ), b ) );
+	}
+
+	MixMono_C( out + i, samples + i, count - i, leftvol, rightvol );
+}
+
+SND_MIX_TARGET("avx2")
+static void MixStereo_AVX2( portable_samplepair_t *out, const short *samples, int count, int leftvol, int rightvol )
+{
+	const __m256i vol = _mm256_setr_epi32( leftvol, rightvol, leftvol, rightvol, leftvol, rightvol, leftvol, rightvol );
+	int i = 0;
+
+	for ( ; i + 4 <= count; i += 4 ) {
+		__m256i d = _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)( samples + i * 2 ) ) );
+		__m256i *o = (__m256i *)( out + i );
+
+		d = _mm256_srai_epi32( _mm256_mullo_epi32( d, vol ), 8 );
+		_mm256_storeu_si256( o, _mm256_add_epi32( _mm256_loadu_si256( o ), d ) );
+	}
+
+	MixStereo_C( out + i, samples + i * 2, count - i, leftvol, rightvol );
+}
+
+
+static qboolean S_CpuHasSSE2( void )
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return qtrue;
+#elif defined(_MSC_VER)
+	int regs[4];
+	__cpuid( regs, 1 );
+	return ( regs[3] & ( 1 << 26 ) ) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "sse2" ) ? qtrue : qfalse;
+#endif
+}
+
+static qboolean S_CpuHasAVX2( void )
+{
+#if defined(_MSC_VER)
+	int regs[4];
+
+	// the OS has to save the ymm registers too
+	__cpuid( regs, 1 );
+	if ( ( regs[2] & ( ( 1 << 27 ) | ( 1 << 28 ) ) ) != ( ( 1 << 27 ) | ( 1 << 28 ) ) )
+		return qfalse;
+	if ( ( _xgetbv( 0 ) & 6 ) != 6 )
+		return qfalse;
+
+	__cpuidex( regs, 7, 0 );
+	return ( regs[1] & ( 1 << 5 ) ) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "avx2" ) ? qtrue : qfalse;
+#endif
+}
+
+#endif // SND_MIX_X86
+
+
+/*
+================
+S_InitMixKernels
+
+Picks the widest implementation the CPU runs, allowSIMD false forces C
+================
+*/
+void S_InitMixKernels( qboolean allowSIMD )
+{
+	s_mixMono = MixMono_C;
+	s_mixStereo = MixStereo_C;
+	s_clip = Clip_C;
+	s_mixName = "C";
+
+#ifdef SND_MIX_X86
+	if ( allowSIMD && S_CpuHasSSE2() ) {
+		s_mixMono = MixMono_SSE2;
+		s_mixStereo = MixStereo_SSE2;
+		s_clip = Clip_SSE2;
+		s_mixName = "SSE2";
+
+		if ( S_CpuHasAVX2() ) {
+			s_mixMono = MixMono_AVX2;
+			s_mixStereo = MixStereo_AVX2;
+			s_mixName = "AVX2";
+		}
+	}
+#endif
+}
+
+const char *S_MixKernelsImplementation( void )
+{
+	if ( !s_mixName ) {
+		S_InitMixKernels( qtrue );
+	}
+	return s_mixName;
+}
+
+/*
+================
+S_MixSamples16
+
+out[i] += ( sample * vol ) >> 8 for count frames of mono or interleaved stereo samples
+================
+*/
+void S_MixSamples16( portable_samplepair_t *out, const short *samples, int count, int channels, int leftvol, int rightvol )
+{
+	if ( !s_mixName ) {
+		S_InitMixKernels( qtrue );
+	}
+
+	if ( channels == 2 ) {
+		s_mixStereo( out, samples, count, leftvol, rightvol );
+	} else {
+		s_mixMono( out, samples, count, leftvol, rightvol );
+	}
+}
+
+/*
+================
+S_ClipSamples16
+
+out[i] = in[i] >> 8 clamped to 16 bits
+================
+*/
+void S_ClipSamples16( short *out, const int *in, int count )
+{
+	if ( !s_mixName ) {
+		S_InitMixKernels( qtrue );
+	}
+
+	s_clip( out, in, count );
+}
@@ -71,6 +71,19 @@ void SNDDMA_Activate( void );
 
 void S_UpdateBackgroundTrack( void );
 
+// music and VoIP decoding ahead of the main thread, see s_decodeThread
+void S_InitDecode( void );
+void S_ShutdownDecode( void );
+void S_UpdateDecode( void );
+
+#ifdef USE_VOIP
+// queues an incoming packet, lostFrames are concealed before it
+void S_DecodeVoip( int sender, int flags, qboolean reset, int lostFrames, const byte *data, int size );
+
+// drops everything queued, before the decoders go away
+void S_FlushVoip( void );
+#endif
+
 
 #ifdef USE_VOIP
 void S_StartCapture( void );
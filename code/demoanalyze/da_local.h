@@ -0,0 +1,101 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// da_local.h -- headless demo analyzer
+
+#include "../qcommon/q_shared.h"
+#include "../qcommon/qcommon.h"
+#include "../game/bg_public.h"
+
+#include <stdio.h>
+#include <setjmp.h>
+
+#define	DA_MAX_PARSE_ENTITIES	( PACKET_BACKUP * MAX_SNAPSHOT_ENTITIES )
+
+// the same validity rules as clSnapshot_t in the client
+typedef struct {
+	qboolean		valid;
+	int				snapFlags;
+	int				serverTime;
+	int				messageNum;
+	int				deltaNum;
+	playerState_t	ps;
+	int				numEntities;
+	int				parseEntitiesNum;
+	int				serverCommandNum;
+} daSnapshot_t;
+
+typedef struct {
+	int				previousEvent;			// cgame style event edge detection
+	int				lastSeenTime;
+} daEntityEvents_t;
+
+typedef struct {
+	const char		*demoName;
+	FILE			*out;
+	int				snapshotInterval;		// write every n'th snapshot, 0 for events only
+
+	// parse state, wiped on every gamestate
+	gameState_t		gameState;
+	int				clientNum;
+	int				checksumFeed;
+	entityState_t	entityBaselines[MAX_GENTITIES];
+	entityState_t	*parseEntities;			// DA_MAX_PARSE_ENTITIES
+	int				parseEntitiesNum;
+	daSnapshot_t	snapshots[PACKET_BACKUP];
+	daSnapshot_t	snap;					// latest valid snapshot
+	daSnapshot_t	prevSnap;				// the one before it, for event detection
+
+	int				serverMessageSequence;
+	int				serverCommandSequence;
+
+	daEntityEvents_t	entityEvents[MAX_GENTITIES];
+
+	// totals for the summary line
+	int				numMessages;
+	int				numSnapshots;
+	int				numInvalid;
+	int				numKills;
+	int				numPickups;
+} daDemo_t;
+
+//
+// da_main.c
+//
+extern	qboolean	da_quiet;
+extern	qboolean	da_demoActive;		// Com_Error jumps to da_demoAbort while set
+extern	jmp_buf		da_demoAbort;
+
+//
+// da_parse.c
+//
+qboolean DA_AnalyzeDemo( const char *demoName, const char *outName, int snapshotInterval );
+
+//
+// da_output.c
+//
+void DA_WriteDemoStart( daDemo_t *d, int protocol );
+void DA_WriteGamestate( daDemo_t *d );
+void DA_WriteServerCommand( daDemo_t *d, int sequence, const char *s );
+void DA_WriteSnapshot( daDemo_t *d );
+void DA_WriteKill( daDemo_t *d, int target, int attacker, int meansOfDeath );
+void DA_WritePickup( daDemo_t *d, int clientNum, int item, qboolean global );
+void DA_WriteDemoEnd( daDemo_t *d, qboolean completed );
@@ -0,0 +1,385 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// da_main.c -- command line and worker processes of the demo analyzer
+
+#include "da_local.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+/*
+Each demo is analyzed by a worker process of its own, at most -j of them
+at a time. The huffman and delta code in msg.c keeps static state, so
+processes are used rather than threads, and a demo that crashes the
+parser can't take the others with it.
+*/
+
+#define	MAX_JOBS		64
+
+qboolean	da_quiet;
+qboolean	da_demoActive;
+jmp_buf		da_demoAbort;
+
+// msg.c prints with this when set, there is no console to set it
+cvar_t		*cl_shownet;
+
+static const char	*da_program;
+static const char	*da_outDir;
+static int			da_snapshotInterval = 1;
+static int			da_jobs;
+
+
+/*
+==================
+Com_Printf
+==================
+*/
+void QDECL Com_Printf( const char *fmt, ... ) {
+	va_list		argptr;
+
+	va_start( argptr, fmt );
+	vfprintf( stderr, fmt, argptr );
+	va_end( argptr );
+}
+
+/*
+==================
+Com_Error
+
+Drops the current demo, anything outside of a demo is fatal
+==================
+*/
+void QDECL Com_Error( int code, const char *fmt, ... ) {
+	va_list		argptr;
+	char		text[MAXPRINTMSG];
+
+	va_start( argptr, fmt );
+	Q_vsnprintf( text, sizeof( text ), fmt, argptr );
+	va_end( argptr );
+
+	fprintf( stderr, "ERROR: %s\n", text );
+
+	if ( da_demoActive ) {
+		longjmp( da_demoAbort, 1 );
+	}
+
+	exit( 1 );
+}
+
+
+/*
+==================
+DA_Usage
+==================
+*/
+static void DA_Usage( void ) {
+	fprintf( stderr,
+		"usage: %s [options] <demo> [<demo> ...]\n"
+		"  -j <jobs>      demos analyzed in parallel, defaults to the number of cores\n"
+		"  -o <dir>       directory for the .jsonl files, next to each demo by default,\n"
+		"                 - writes a single demo to stdout\n"
+		"  -s <n>         write every n'th snapshot, 0 writes events and commands only\n"
+		"  -q             no summary line per demo\n",
+		da_program );
+	exit( 1 );
+}
+
+/*
+==================
+DA_NumCores
+==================
+*/
+static int DA_NumCores( void ) {
+#ifdef _WIN32
+	SYSTEM_INFO	info;
+
+	GetSystemInfo( &info );
+	return info.dwNumberOfProcessors;
+#else
+	return sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+}
+
+/*
+==================
+DA_OutputName
+
+NULL for stdout
+==================
+*/
+static const char *DA_OutputName( const char *demoName, char *buf, int size ) {
+	const char	*base, *s;
+
+	if ( !da_outDir ) {
+		Com_sprintf( buf, size, "%s.jsonl", demoName );
+		return buf;
+	}
+
+	if ( !strcmp( da_outDir, "-" ) ) {
+		return NULL;
+	}
+
+	base = demoName;
+	for ( s = demoName ; *s ; s++ ) {
+		if ( *s == '/' || *s == '\\' ) {
+			base = s + 1;
+		}
+	}
+
+	Com_sprintf( buf, size, "%s/%s.jsonl", da_outDir, base );
+	return buf;
+}
+
+/*
+==================
+DA_RunDemo
+==================
+*/
+static qboolean DA_RunDemo( const char *demoName ) {
+	char	outName[MAX_OSPATH];
+
+	return DA_AnalyzeDemo( demoName, DA_OutputName( demoName, outName, sizeof( outName ) ),
+		da_snapshotInterval );
+}
+
+#ifdef _WIN32
+/*
+==================
+DA_QuoteArg
+
+_spawnv joins the arguments with spaces, so they have to be quoted
+==================
+*/
+static char *DA_QuoteArg( const char *arg ) {
+	char	*quoted, *o;
+	int		backslashes;
+
+	quoted = malloc( strlen( arg ) * 2 + 3 );
+	if ( !quoted ) {
+		Com_Error( ERR_FATAL, "DA_QuoteArg: out of memory" );
+	}
+
+	o = quoted;
+	*o++ = '"';
+	for ( backslashes = 0 ; *arg ; arg++ ) {
+		if ( *arg == '\\' ) {
+			backslashes++;
+		} else {
+			if ( *arg == '"' ) {
+				// backslashes before a quote are doubled, and the quote escaped
+				for ( ; backslashes ; backslashes-- ) {
+					*o++ = '\\';
+				}
+				*o++ = '\\';
+			}
+			backslashes = 0;
+		}
+		*o++ = *arg;
+	}
+	// the closing quote must not be escaped by a trailing backslash
+	for ( ; backslashes ; backslashes-- ) {
+		*o++ = '\\';
+	}
+	*o++ = '"';
+	*o = 0;
+
+	return quoted;
+}
+
+/*
+==================
+DA_RunWorkers
+
+Runs the program again with -j 1 for each demo, the oldest
+worker is waited on when all the job slots are taken
+==================
+*/
+static int DA_RunWorkers( char **demos, int numDemos ) {
+	intptr_t	workers[MAX_JOBS];
+	char		*args[10], interval[16];
+	char		*program, *outDir;
+	int			first, running, failed, status, i, n;
+
+	Com_sprintf( interval, sizeof( interval ), "%i", da_snapshotInterval );
+
+	// quoted once for all the workers
+	program = DA_QuoteArg( da_program );
+	outDir = da_outDir ? DA_QuoteArg( da_outDir ) : NULL;
+
+	n = 0;
+	args[n++] = program;
+	args[n++] = "-j";
+	args[n++] = "1";
+	args[n++] = "-s";
+	args[n++] = interval;
+	if ( da_quiet ) {
+		args[n++] = "-q";
+	}
+	if ( outDir ) {
+		args[n++] = "-o";
+		args[n++] = outDir;
+	}
+
+	first = running = failed = 0;
+	for ( i = 0 ; i < numDemos || running ; ) {
+		if ( i < numDemos && running < da_jobs ) {
+			args[n] = DA_QuoteArg( demos[i] );
+			args[n + 1] = NULL;
+			workers[ ( first + running ) % MAX_JOBS ] = _spawnv( _P_NOWAIT, da_program, (const char * const *)args );
+			free( args[n] );
+
+			if ( workers[ ( first + running ) % MAX_JOBS ] == -1 ) {
+				Com_Printf( "%s: couldn't start a worker, analyzing it here\n", demos[i] );
+				failed += !DA_RunDemo( demos[i] );
+			} else {
+				running++;
+			}
+			i++;
+			continue;
+		}
+
+		if ( _cwait( &status, workers[first], 0 ) == -1 || status ) {
+			failed++;
+		}
+		first = ( first + 1 ) % MAX_JOBS;
+		running--;
+	}
+
+	free( program );
+	free( outDir );
+
+	return failed;
+}
+#else
+/*
+==================
+DA_RunWorkers
+
+Forks a worker for each demo and collects
+them in whatever order they finish
+==================
+*/
+static int DA_RunWorkers( char **demos, int numDemos ) {
+	pid_t	pid;
+	int		running, failed, status, i;
+
+	running = failed = 0;
+	for ( i = 0 ; i < numDemos || running ; ) {
+		if ( i < numDemos && running < da_jobs ) {
+			// don't let the workers flush our buffers a second time
+			fflush( stdout );
+			fflush( stderr );
+
+			pid = fork();
+			if ( pid == 0 ) {
+				_exit( DA_RunDemo( demos[i] ) ? 0 : 1 );
+			}
+
+			if ( pid < 0 ) {
+				Com_Printf( "%s: couldn't start a worker, analyzing it here\n", demos[i] );
+				failed += !DA_RunDemo( demos[i] );
+			} else {
+				running++;
+			}
+			i++;
+			continue;
+		}
+
+		pid = wait( &status );
+		if ( pid < 0 ) {
+			Com_Error( ERR_FATAL, "lost track of the workers" );
+		}
+		if ( !WIFEXITED( status ) || WEXITSTATUS( status ) ) {
+			failed++;
+		}
+		running--;
+	}
+
+	return failed;
+}
+#endif
+
+/*
+==================
+main
+==================
+*/
+int main( int argc, char **argv ) {
+	int		i, failed, numDemos;
+
+	da_program = argv[0];
+
+	for ( i = 1 ; i < argc && argv[i][0] == '-' && argv[i][1] ; i++ ) {
+		if ( !strcmp( argv[i], "-q" ) ) {
+			da_quiet = qtrue;
+		} else if ( i + 1 < argc && !strcmp( argv[i], "-j" ) ) {
+			da_jobs = atoi( argv[++i] );
+		} else if ( i + 1 < argc && !strcmp( argv[i], "-o" ) ) {
+			da_outDir = argv[++i];
+		} else if ( i + 1 < argc && !strcmp( argv[i], "-s" ) ) {
+			da_snapshotInterval = atoi( argv[++i] );
+		} else {
+			DA_Usage();
+		}
+	}
+
+	numDemos = argc - i;
+	if ( numDemos <= 0 ) {
+		DA_Usage();
+	}
+
+	if ( da_outDir && !strcmp( da_outDir, "-" ) ) {
+		if ( numDemos > 1 ) {
+			Com_Error( ERR_FATAL, "only a single demo can be written to stdout" );
+		}
+	}
+
+	if ( da_jobs <= 0 ) {
+		da_jobs = DA_NumCores();
+	}
+	da_jobs = Com_Clamp( 1, MAX_JOBS, da_jobs );
+	if ( da_jobs > numDemos ) {
+		da_jobs = numDemos;
+	}
+
+	failed = 0;
+	if ( da_jobs == 1 ) {
+		// one at a time, no worker processes needed
+		for ( ; i < argc ; i++ ) {
+			failed += !DA_RunDemo( argv[i] );
+		}
+	} else {
+		failed = DA_RunWorkers( argv + i, numDemos );
+	}
+
+	if ( failed && !da_quiet ) {
+		Com_Printf( "%i of %i demos failed\n", failed, numDemos );
+	}
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,190 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// da_output.c -- JSON lines records for the demo analyzer
+
+#include "da_local.h"
+
+/*
+Every record is one JSON object on a line of its own, with a "type" key
+and the server time of the latest snapshot. Strings are written byte for
+byte with color codes kept, bytes outside of ASCII are escaped as latin-1.
+*/
+
+/*
+==================
+DA_WriteString
+==================
+*/
+static void DA_WriteString( FILE *out, const char *s ) {
+	int		c;
+
+	fputc( '"', out );
+	for ( ; *s ; s++ ) {
+		c = *(const byte *)s;
+		if ( c == '"' || c == '\\' ) {
+			fputc( '\\', out );
+			fputc( c, out );
+		} else if ( c == '\n' ) {
+			fputs( "\\n", out );
+		} else if ( c < 0x20 || c >= 0x7f ) {
+			fprintf( out, "\\u%04x", c );
+		} else {
+			fputc( c, out );
+		}
+	}
+	fputc( '"', out );
+}
+
+/*
+==================
+DA_WriteVector
+==================
+*/
+static void DA_WriteVector( FILE *out, const char *key, const vec3_t v ) {
+	fprintf( out, "\"%s\":[%.1f,%.1f,%.1f]", key, v[0], v[1], v[2] );
+}
+
+/*
+==================
+DA_WriteDemoStart
+==================
+*/
+void DA_WriteDemoStart( daDemo_t *d, int protocol ) {
+	fputs( "{\"type\":\"demo\",\"file\":", d->out );
+	DA_WriteString( d->out, d->demoName );
+	fprintf( d->out, ",\"protocol\":%i}\n", protocol );
+}
+
+/*
+==================
+DA_WriteGamestate
+==================
+*/
+void DA_WriteGamestate( daDemo_t *d ) {
+	int		i, first;
+
+	fprintf( d->out, "{\"type\":\"gamestate\",\"clientNum\":%i,\"checksumFeed\":%i,"
+		"\"serverCommandSequence\":%i,\"configstrings\":{",
+		d->clientNum, d->checksumFeed, d->serverCommandSequence );
+
+	first = 1;
+	for ( i = 0 ; i < MAX_CONFIGSTRINGS ; i++ ) {
+		if ( !d->gameState.stringOffsets[i] ) {
+			continue;
+		}
+		fprintf( d->out, "%s\"%i\":", first ? "" : ",", i );
+		DA_WriteString( d->out, d->gameState.stringData + d->gameState.stringOffsets[i] );
+		first = 0;
+	}
+
+	fputs( "}}\n", d->out );
+}
+
+/*
+==================
+DA_WriteServerCommand
+==================
+*/
+void DA_WriteServerCommand( daDemo_t *d, int sequence, const char *s ) {
+	fprintf( d->out, "{\"type\":\"command\",\"time\":%i,\"sequence\":%i,\"text\":",
+		d->snap.serverTime, sequence );
+	DA_WriteString( d->out, s );
+	fputs( "}\n", d->out );
+}
+
+/*
+==================
+DA_WriteSnapshot
+
+The recording client's playerstate and every player entity in view
+==================
+*/
+void DA_WriteSnapshot( daDemo_t *d ) {
+	playerState_t	*ps;
+	entityState_t	*es;
+	int				i, first;
+
+	ps = &d->snap.ps;
+
+	fprintf( d->out, "{\"type\":\"snapshot\",\"time\":%i,\"message\":%i,\"flags\":%i,",
+		d->snap.serverTime, d->snap.messageNum, d->snap.snapFlags );
+
+	fprintf( d->out, "\"ps\":{\"clientNum\":%i,\"pm_type\":%i,", ps->clientNum, ps->pm_type );
+	DA_WriteVector( d->out, "origin", ps->origin );
+	fputc( ',', d->out );
+	DA_WriteVector( d->out, "velocity", ps->velocity );
+	fputc( ',', d->out );
+	DA_WriteVector( d->out, "viewangles", ps->viewangles );
+	fprintf( d->out, ",\"health\":%i,\"armor\":%i,\"weapon\":%i},\"players\":[",
+		ps->stats[STAT_HEALTH], ps->stats[STAT_ARMOR], ps->weapon );
+
+	first = 1;
+	for ( i = 0 ; i < d->snap.numEntities ; i++ ) {
+		es = &d->parseEntities[ ( d->snap.parseEntitiesNum + i ) & ( DA_MAX_PARSE_ENTITIES - 1 ) ];
+		if ( es->eType != ET_PLAYER ) {
+			continue;
+		}
+		fprintf( d->out, "%s{\"clientNum\":%i,", first ? "" : ",", es->clientNum );
+		DA_WriteVector( d->out, "origin", es->pos.trBase );
+		fputc( ',', d->out );
+		DA_WriteVector( d->out, "angles", es->apos.trBase );
+		fprintf( d->out, ",\"weapon\":%i,\"eFlags\":%i}", es->weapon, es->eFlags );
+		first = 0;
+	}
+
+	fputs( "]}\n", d->out );
+}
+
+/*
+==================
+DA_WriteKill
+==================
+*/
+void DA_WriteKill( daDemo_t *d, int target, int attacker, int meansOfDeath ) {
+	fprintf( d->out, "{\"type\":\"kill\",\"time\":%i,\"target\":%i,\"attacker\":%i,\"mod\":%i}\n",
+		d->snap.serverTime, target, attacker, meansOfDeath );
+}
+
+/*
+==================
+DA_WritePickup
+
+item is an index into bg_itemlist, clientNum is -1
+for the global pickup announcements
+==================
+*/
+void DA_WritePickup( daDemo_t *d, int clientNum, int item, qboolean global ) {
+	fprintf( d->out, "{\"type\":\"pickup\",\"time\":%i,\"clientNum\":%i,\"item\":%i,\"global\":%s}\n",
+		d->snap.serverTime, clientNum, item, global ? "true" : "false" );
+}
+
+/*
+==================
+DA_WriteDemoEnd
+==================
+*/
+void DA_WriteDemoEnd( daDemo_t *d, qboolean completed ) {
+	fprintf( d->out, "{\"type\":\"end\",\"time\":%i,\"completed\":%s,\"messages\":%i,"
+		"\"snapshots\":%i,\"invalid\":%i,\"kills\":%i,\"pickups\":%i}\n",
+		d->snap.serverTime, completed ? "true" : "false", d->numMessages,
+		d->numSnapshots, d->numInvalid, d->numKills, d->numPickups );
+}
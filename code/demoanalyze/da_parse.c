@@ -0,0 +1,549 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// da_parse.c -- server message parsing for the demo analyzer
+
+#include "da_local.h"
+
+/*
+The messages are parsed the way CL_ParseServerMessage does it, but into a
+daDemo_t instead of the client globals, so several demos never share any
+state. Entities and playerstates go through the same msg.c delta code as
+the client.
+*/
+
+
+/*
+=========================================================================
+
+EVENTS
+
+=========================================================================
+*/
+
+/*
+==================
+DA_EntityEvent
+==================
+*/
+static void DA_EntityEvent( daDemo_t *d, int event, int clientNum, const entityState_t *es ) {
+	switch ( event ) {
+	case EV_OBITUARY:
+		if ( es ) {
+			DA_WriteKill( d, es->otherEntityNum, es->otherEntityNum2, es->eventParm );
+			d->numKills++;
+		}
+		break;
+	case EV_ITEM_PICKUP:
+		DA_WritePickup( d, clientNum, es ? es->eventParm : 0, qfalse );
+		d->numPickups++;
+		break;
+	case EV_GLOBAL_ITEM_PICKUP:
+		DA_WritePickup( d, -1, es ? es->eventParm : 0, qtrue );
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+==================
+DA_CheckEntityEvents
+
+Fires each event once, with the same rules as CG_CheckEvents
+==================
+*/
+static void DA_CheckEntityEvents( daDemo_t *d ) {
+	entityState_t		*es;
+	daEntityEvents_t	*ev;
+	int					i, event, clientNum;
+
+	for ( i = 0 ; i < d->snap.numEntities ; i++ ) {
+		es = &d->parseEntities[ ( d->snap.parseEntitiesNum + i ) & ( DA_MAX_PARSE_ENTITIES - 1 ) ];
+		ev = &d->entityEvents[ es->number ];
+
+		// an entity that comes back into view starts over, like CG_ResetEntity
+		if ( ev->lastSeenTime < d->snap.serverTime - EVENT_VALID_MSEC ) {
+			ev->previousEvent = 0;
+		}
+		ev->lastSeenTime = d->snap.serverTime;
+
+		if ( es->eType > ET_EVENTS ) {
+			// temporary event entities fire once while they exist
+			if ( ev->previousEvent ) {
+				continue;
+			}
+			ev->previousEvent = 1;
+			event = es->eType - ET_EVENTS;
+			clientNum = ( es->eFlags & EF_PLAYER_EVENT ) ? es->otherEntityNum : es->number;
+		} else {
+			// events riding with another entity
+			if ( es->event == ev->previousEvent ) {
+				continue;
+			}
+			ev->previousEvent = es->event;
+			if ( ( es->event & ~EV_EVENT_BITS ) == 0 ) {
+				continue;
+			}
+			event = es->event;
+			clientNum = es->number;
+		}
+
+		DA_EntityEvent( d, event & ~EV_EVENT_BITS, clientNum, es );
+	}
+}
+
+/*
+==================
+DA_CheckPlayerstateEvents
+
+The recording client's own entity is not sent, its events
+ride in the playerstate instead
+==================
+*/
+static void DA_CheckPlayerstateEvents( daDemo_t *d ) {
+	playerState_t	*ps, *ops;
+	entityState_t	es;
+	int				i;
+
+	ps = &d->snap.ps;
+	ops = &d->prevSnap.ps;
+
+	// no events on the first snapshot or when switching followed players
+	if ( !d->prevSnap.valid || ps->clientNum != ops->clientNum ) {
+		return;
+	}
+
+	memset( &es, 0, sizeof( es ) );
+	es.number = ps->clientNum;
+
+	if ( ps->externalEvent && ps->externalEvent != ops->externalEvent ) {
+		es.eventParm = ps->externalEventParm;
+		DA_EntityEvent( d, ps->externalEvent & ~EV_EVENT_BITS, ps->clientNum, &es );
+	}
+
+	for ( i = ps->eventSequence - MAX_PS_EVENTS ; i < ps->eventSequence ; i++ ) {
+		if ( i < ops->eventSequence ) {
+			continue;
+		}
+		es.eventParm = ps->eventParms[ i & ( MAX_PS_EVENTS - 1 ) ];
+		DA_EntityEvent( d, ps->events[ i & ( MAX_PS_EVENTS - 1 ) ] & ~EV_EVENT_BITS, ps->clientNum, &es );
+	}
+}
+
+
+/*
+=========================================================================
+
+MESSAGE PARSING
+
+=========================================================================
+*/
+
+/*
+==================
+DA_ParseSnapshot
+
+Mirrors CL_ParseSnapshot, an invalid snapshot is read and then dropped
+==================
+*/
+static void DA_ParseSnapshot( daDemo_t *d, msg_t *msg ) {
+	daSnapshot_t	*old;
+	daSnapshot_t	newSnap;
+	int				len, deltaNum, oldMessageNum;
+	byte			areamask[MAX_MAP_AREA_BYTES];
+
+	memset( &newSnap, 0, sizeof( newSnap ) );
+
+	newSnap.serverCommandNum = d->serverCommandSequence;
+	newSnap.serverTime = MSG_ReadLong( msg );
+	newSnap.messageNum = d->serverMessageSequence;
+
+	deltaNum = MSG_ReadByte( msg );
+	if ( !deltaNum ) {
+		newSnap.deltaNum = -1;
+	} else {
+		newSnap.deltaNum = newSnap.messageNum - deltaNum;
+	}
+	newSnap.snapFlags = MSG_ReadByte( msg );
+
+	if ( newSnap.deltaNum <= 0 ) {
+		newSnap.valid = qtrue;
+		old = NULL;
+	} else {
+		old = &d->snapshots[ newSnap.deltaNum & PACKET_MASK ];
+		if ( old->valid && old->messageNum == newSnap.deltaNum
+			&& d->parseEntitiesNum - old->parseEntitiesNum <= DA_MAX_PARSE_ENTITIES - MAX_SNAPSHOT_ENTITIES ) {
+			newSnap.valid = qtrue;
+		}
+	}
+
+	len = MSG_ReadByte( msg );
+	if ( len > sizeof( areamask ) ) {
+		Com_Error( ERR_DROP, "DA_ParseSnapshot: Invalid size %d for areamask", len );
+	}
+	MSG_ReadData( msg, areamask, len );
+
+	MSG_ReadDeltaPlayerstate( msg, old ? &old->ps : NULL, &newSnap.ps );
+
+	newSnap.parseEntitiesNum = d->parseEntitiesNum;
+	newSnap.numEntities = MSG_ReadPacketEntities( msg, d->parseEntities, DA_MAX_PARSE_ENTITIES - 1,
+		&d->parseEntitiesNum, old ? old->parseEntitiesNum : 0, old ? old->numEntities : 0,
+		d->entityBaselines );
+
+	if ( !newSnap.valid ) {
+		d->numInvalid++;
+		return;
+	}
+
+	// clear the frames that were skipped so they can't be delta'd from
+	oldMessageNum = d->snap.messageNum + 1;
+	if ( newSnap.messageNum - oldMessageNum >= PACKET_BACKUP ) {
+		oldMessageNum = newSnap.messageNum - ( PACKET_BACKUP - 1 );
+	}
+	for ( ; oldMessageNum < newSnap.messageNum ; oldMessageNum++ ) {
+		d->snapshots[ oldMessageNum & PACKET_MASK ].valid = qfalse;
+	}
+
+	d->prevSnap = d->snap;
+	d->snap = newSnap;
+	d->snapshots[ newSnap.messageNum & PACKET_MASK ] = newSnap;
+
+	if ( d->snapshotInterval > 0 && d->numSnapshots % d->snapshotInterval == 0 ) {
+		DA_WriteSnapshot( d );
+	}
+	d->numSnapshots++;
+
+	DA_CheckPlayerstateEvents( d );
+	DA_CheckEntityEvents( d );
+}
+
+/*
+==================
+DA_ParseGamestate
+
+Mirrors CL_ParseGamestate, everything but the output is started over
+==================
+*/
+static void DA_ParseGamestate( daDemo_t *d, msg_t *msg ) {
+	entityState_t	nullstate;
+	char			*s;
+	int				cmd, i, len, newnum;
+
+	memset( &d->gameState, 0, sizeof( d->gameState ) );
+	memset( d->entityBaselines, 0, sizeof( d->entityBaselines ) );
+	memset( d->snapshots, 0, sizeof( d->snapshots ) );
+	memset( &d->snap, 0, sizeof( d->snap ) );
+	memset( &d->prevSnap, 0, sizeof( d->prevSnap ) );
+	memset( d->entityEvents, 0, sizeof( d->entityEvents ) );
+	d->parseEntitiesNum = 0;
+
+	d->serverCommandSequence = MSG_ReadLong( msg );
+
+	d->gameState.dataCount = 1;
+	while ( 1 ) {
+		cmd = MSG_ReadByte( msg );
+
+		if ( cmd == svc_EOF ) {
+			break;
+		}
+
+		if ( cmd == svc_configstring ) {
+			i = MSG_ReadShort( msg );
+			if ( i < 0 || i >= MAX_CONFIGSTRINGS ) {
+				Com_Error( ERR_DROP, "configstring > MAX_CONFIGSTRINGS" );
+			}
+			s = MSG_ReadBigString( msg );
+			len = strlen( s );
+
+			if ( len + 1 + d->gameState.dataCount > MAX_GAMESTATE_CHARS ) {
+				Com_Error( ERR_DROP, "MAX_GAMESTATE_CHARS exceeded" );
+			}
+
+			d->gameState.stringOffsets[ i ] = d->gameState.dataCount;
+			memcpy( d->gameState.stringData + d->gameState.dataCount, s, len + 1 );
+			d->gameState.dataCount += len + 1;
+		} else if ( cmd == svc_baseline ) {
+			newnum = MSG_ReadBits( msg, GENTITYNUM_BITS );
+			if ( newnum < 0 || newnum >= MAX_GENTITIES ) {
+				Com_Error( ERR_DROP, "Baseline number out of range: %i", newnum );
+			}
+			memset( &nullstate, 0, sizeof( nullstate ) );
+			MSG_ReadDeltaEntity( msg, &nullstate, &d->entityBaselines[ newnum ], newnum );
+		} else {
+			Com_Error( ERR_DROP, "DA_ParseGamestate: bad command byte" );
+		}
+	}
+
+	d->clientNum = MSG_ReadLong( msg );
+	d->checksumFeed = MSG_ReadLong( msg );
+
+	DA_WriteGamestate( d );
+}
+
+/*
+==================
+DA_ParseCommandString
+==================
+*/
+static void DA_ParseCommandString( daDemo_t *d, msg_t *msg ) {
+	char	*s;
+	int		seq;
+
+	seq = MSG_ReadLong( msg );
+	s = MSG_ReadString( msg );
+
+	// see if we have already seen this command
+	if ( d->serverCommandSequence >= seq ) {
+		return;
+	}
+	d->serverCommandSequence = seq;
+
+	DA_WriteServerCommand( d, seq, s );
+}
+
+/*
+==================
+DA_SkipVoip
+
+The payload layout of CL_ParseVoip, nothing is decoded
+==================
+*/
+static void DA_SkipVoip( msg_t *msg ) {
+	byte	encoded[4000];
+	int		packetsize;
+
+	MSG_ReadShort( msg );		// sender
+	MSG_ReadByte( msg );		// generation
+	MSG_ReadLong( msg );		// sequence
+	MSG_ReadByte( msg );		// frames
+	packetsize = MSG_ReadShort( msg );
+	MSG_ReadBits( msg, VOIP_FLAGCNT );
+
+	while ( packetsize > 0 ) {
+		int bytes = packetsize > sizeof( encoded ) ? sizeof( encoded ) : packetsize;
+		MSG_ReadData( msg, encoded, bytes );
+		packetsize -= bytes;
+	}
+}
+
+/*
+==================
+DA_ParseServerMessage
+==================
+*/
+static void DA_ParseServerMessage( daDemo_t *d, msg_t *msg ) {
+	int		cmd;
+
+	MSG_Bitstream( msg );
+
+	// reliable acknowledge, only meaningful to a live client
+	MSG_ReadLong( msg );
+
+	while ( 1 ) {
+		if ( msg->readcount > msg->cursize ) {
+			Com_Error( ERR_DROP, "DA_ParseServerMessage: read past end of server message" );
+		}
+
+		cmd = MSG_ReadByte( msg );
+
+		if ( cmd == svc_EOF ) {
+			break;
+		}
+
+		switch ( cmd ) {
+		default:
+			Com_Error( ERR_DROP, "DA_ParseServerMessage: Illegible server message" );
+			break;
+		case svc_nop:
+			break;
+		case svc_serverCommand:
+			DA_ParseCommandString( d, msg );
+			break;
+		case svc_gamestate:
+			DA_ParseGamestate( d, msg );
+			break;
+		case svc_snapshot:
+			DA_ParseSnapshot( d, msg );
+			break;
+		case svc_download:
+			Com_Error( ERR_DROP, "DA_ParseServerMessage: download in a demo" );
+			break;
+		case svc_voipSpeex:
+		case svc_voipOpus:
+			DA_SkipVoip( msg );
+			break;
+		}
+	}
+}
+
+
+/*
+=========================================================================
+
+DEMO FILES
+
+=========================================================================
+*/
+
+/*
+==================
+DA_ReadDemoMessage
+
+Reads one record the way CL_ReadDemoMessage does,
+returns qfalse at the end of the demo
+==================
+*/
+static qboolean DA_ReadDemoMessage( FILE *f, msg_t *msg, int *sequence ) {
+	int		s, len;
+
+	if ( fread( &s, 4, 1, f ) != 1 ) {
+		return qfalse;
+	}
+	*sequence = LittleLong( s );
+
+	if ( fread( &len, 4, 1, f ) != 1 ) {
+		return qfalse;
+	}
+	len = LittleLong( len );
+	if ( len == -1 ) {
+		return qfalse;
+	}
+	if ( len < 0 || len > msg->maxsize ) {
+		Com_Error( ERR_DROP, "DA_ReadDemoMessage: demoMsglen > MAX_MSGLEN" );
+	}
+
+	msg->cursize = len;
+	msg->readcount = 0;
+	msg->bit = 0;
+	if ( fread( msg->data, len, 1, f ) != 1 && len ) {
+		Com_Printf( "Demo file was truncated.\n" );
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+==================
+DA_DemoProtocol
+
+The protocol from a .dm_<protocol> extension, 0 if there is none
+==================
+*/
+static int DA_DemoProtocol( const char *demoName ) {
+	const char	*ext;
+
+	ext = strrchr( demoName, '.' );
+	if ( !ext || Q_stricmpn( ext + 1, DEMOEXT, strlen( DEMOEXT ) ) ) {
+		return 0;
+	}
+
+	return atoi( ext + 1 + strlen( DEMOEXT ) );
+}
+
+/*
+==================
+DA_AnalyzeDemo
+
+Parses a whole demo and writes its records to outName,
+or to stdout when outName is NULL
+==================
+*/
+qboolean DA_AnalyzeDemo( const char *demoName, const char *outName, int snapshotInterval ) {
+	static byte	bufData[MAX_MSGLEN];
+	daDemo_t	*d;
+	FILE		*f, *out;
+	msg_t		buf;
+	int			sequence;
+	volatile qboolean	completed;
+
+	f = fopen( demoName, "rb" );
+	if ( !f ) {
+		Com_Printf( "%s: couldn't open\n", demoName );
+		return qfalse;
+	}
+
+	if ( outName ) {
+		out = fopen( outName, "w" );
+		if ( !out ) {
+			Com_Printf( "%s: couldn't write %s\n", demoName, outName );
+			fclose( f );
+			return qfalse;
+		}
+	} else {
+		out = stdout;
+	}
+
+	d = calloc( 1, sizeof( *d ) );
+	if ( d ) {
+		d->parseEntities = calloc( DA_MAX_PARSE_ENTITIES, sizeof( *d->parseEntities ) );
+	}
+	if ( !d || !d->parseEntities ) {
+		Com_Printf( "%s: out of memory\n", demoName );
+		free( d );
+		fclose( f );
+		if ( out != stdout ) {
+			fclose( out );
+		}
+		return qfalse;
+	}
+
+	d->demoName = demoName;
+	d->out = out;
+	d->snapshotInterval = snapshotInterval;
+
+	MSG_Init( &buf, bufData, sizeof( bufData ) );
+
+	DA_WriteDemoStart( d, DA_DemoProtocol( demoName ) );
+
+	// a bad message ends this demo but not the run
+	completed = qfalse;
+	da_demoActive = qtrue;
+	if ( !setjmp( da_demoAbort ) ) {
+		while ( DA_ReadDemoMessage( f, &buf, &sequence ) ) {
+			d->serverMessageSequence = sequence;
+			d->numMessages++;
+			DA_ParseServerMessage( d, &buf );
+		}
+		completed = qtrue;
+	}
+	da_demoActive = qfalse;
+
+	DA_WriteDemoEnd( d, completed );
+
+	if ( !da_quiet ) {
+		Com_Printf( "%s: %i messages, %i snapshots (%i invalid), %i kills, %i pickups%s\n",
+			demoName, d->numMessages, d->numSnapshots, d->numInvalid, d->numKills, d->numPickups,
+			completed ? "" : ", aborted" );
+	}
+
+	free( d->parseEntities );
+	free( d );
+	fclose( f );
+	if ( out != stdout ) {
+		fclose( out );
+	} else {
+		fflush( out );
+	}
+
+	return completed;
+}
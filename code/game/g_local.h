@@ -411,6 +411,8 @@ struct gclient_s {
 	int			historyHead;
 	// the history queue
 	clientHistory_t	history[NUM_CLIENT_HISTORY];
+	// absolute bounds swept by everything in the history queue
+	vec3_t		historyAbsmin, historyAbsmax;
 	// the client's saved position
 	clientHistory_t	saved;			// used to restore after time shift
 	// an approximation of the actual server time we received this
@@ -773,6 +775,7 @@ void G_StoreHistory( gentity_t *ent );
 void G_TimeShiftAllClients( int time, gentity_t *skip );
 void G_UnTimeShiftAllClients( gentity_t *skip );
 void G_DoTimeShiftFor( gentity_t *ent );
+void G_DoTimeShiftForTrace( gentity_t *ent, vec3_t start, vec3_t end, float spread );
 void G_UndoTimeShiftFor( gentity_t *ent );
 void G_UnTimeShiftClient( gentity_t *client );
 void G_PredictPlayerMove( gentity_t *ent, float frametime );
@@ -1165,6 +1168,7 @@ extern	vmCvar_t	g_truePing;
 // this is for convenience - using "sv_fps.integer" is nice :)
 extern	vmCvar_t	sv_fps;
 extern  vmCvar_t        g_lagLightning;
+extern	vmCvar_t	g_delagPrefilter;
 //unlagged - server options
 //KK-OAX Killing Sprees
 extern  vmCvar_t    g_sprees; //Used for specifiying the config file
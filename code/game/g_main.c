@@ -173,6 +173,7 @@ vmCvar_t	g_delagHitscan;
 vmCvar_t	g_truePing;
 vmCvar_t	sv_fps;
 vmCvar_t        g_lagLightning; //Adds a little lag to the lightninggun to make it less powerfull
+vmCvar_t	g_delagPrefilter; //Only shift clients whose history can touch the shot
 //unlagged - server options
 //KK-OAX
 vmCvar_t        g_sprees;
@@ -319,6 +320,7 @@ static cvarTable_t		gameCvarTable[] = {
 	// it's CVAR_SYSTEMINFO so the client's sv_fps will be automagically set to its value
 	{ &sv_fps, "sv_fps", "20", CVAR_SYSTEMINFO | CVAR_ARCHIVE, 0, qfalse },
 	{ &g_lagLightning, "g_lagLightning", "1", CVAR_ARCHIVE, 0, qtrue },
+	{ &g_delagPrefilter, "g_delagPrefilter", "1", CVAR_ARCHIVE, 0, qfalse },
 //unlagged - server options
 
 	{ &g_rankings, "g_rankings", "0", 0, 0, qfalse},
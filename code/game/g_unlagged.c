@@ -25,6 +25,43 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 //#include "g_local.h"
 
+/*
+============
+G_UpdateHistoryBounds
+
+Recalculate the absolute bounds swept by the client's history, so
+a shot can rule out the client without shifting it
+============
+*/
+static void G_UpdateHistoryBounds( gentity_t *ent )
+{
+	int		i, j;
+	clientHistory_t	*h;
+	gclient_t	*client;
+
+	client = ent->client;
+	h = &client->history[0];
+	VectorAdd( h->currentOrigin, h->mins, client->historyAbsmin );
+	VectorAdd( h->currentOrigin, h->maxs, client->historyAbsmax );
+	for ( i = 1, h++; i < NUM_CLIENT_HISTORY; i++, h++ ) {
+		for ( j = 0; j < 3; j++ ) {
+			if ( h->currentOrigin[j] + h->mins[j] < client->historyAbsmin[j] ) {
+				client->historyAbsmin[j] = h->currentOrigin[j] + h->mins[j];
+			}
+			if ( h->currentOrigin[j] + h->maxs[j] > client->historyAbsmax[j] ) {
+				client->historyAbsmax[j] = h->currentOrigin[j] + h->maxs[j];
+			}
+		}
+	}
+
+	// trap_LinkEntity expands absmin and absmax by one unit as well
+	for ( j = 0; j < 3; j++ ) {
+		client->historyAbsmin[j] -= 1;
+		client->historyAbsmax[j] += 1;
+	}
+}
+
+
 /*
 ============
 G_ResetHistory
@@ -44,6 +81,8 @@ void G_ResetHistory( gentity_t *ent )
 		VectorCopy( ent->r.currentOrigin, ent->client->history[i].currentOrigin );
 		ent->client->history[i].leveltime = time;
 	}
+
+	G_UpdateHistoryBounds( ent );
 }
 
 
@@ -71,6 +110,8 @@ void G_StoreHistory( gentity_t *ent )
 	VectorCopy( ent->s.pos.trBase, ent->client->history[head].currentOrigin );
 	SnapVector( ent->client->history[head].currentOrigin );
 	ent->client->history[head].leveltime = level.time;
+
+	G_UpdateHistoryBounds( ent );
 }
 
 
@@ -193,42 +234,177 @@ void G_TimeShiftAllClients( int time, gentity_t *skip )
 }
 
 
+/*
+=====================
+G_TraceTouchesBounds
+
+Conservative test of whether a shot from "start" towards "end" can
+touch the box "mins" "maxs". The shot may stray from the line by up
+to "spread" units per unit travelled (for spread patterns)
+=====================
+*/
+static qboolean G_TraceTouchesBounds( vec3_t start, vec3_t end, float spread, vec3_t mins, vec3_t maxs )
+{
+	vec3_t		dir, center, delta, point;
+	float		length, radius, along, reach, dist;
+
+	VectorSubtract( end, start, dir );
+	length = VectorNormalize( dir );
+
+	// test against the sphere around the box
+	VectorAdd( mins, maxs, center );
+	VectorScale( center, 0.5f, center );
+	VectorSubtract( maxs, center, delta );
+	radius = VectorLength( delta );
+
+	VectorSubtract( center, start, delta );
+	along = DotProduct( delta, dir );
+
+	// the shot can't get farther along the line than this and still touch the sphere
+	if ( spread < 1.0f ) {
+		reach = ( along + radius ) / ( 1.0f - spread );
+		if ( reach < 0 ) {
+			return qfalse;
+		}
+		if ( reach > length ) {
+			reach = length;
+		}
+	}
+	else {
+		reach = length;
+	}
+
+	if ( along < 0 ) {
+		along = 0;
+	}
+	else if ( along > length ) {
+		along = length;
+	}
+	VectorMA( start, along, dir, point );
+	VectorSubtract( center, point, delta );
+	dist = radius + spread * reach;
+
+	return ( DotProduct( delta, delta ) <= dist * dist );
+}
+
+
+/*
+=====================
+G_TimeShiftClientsAlongTrace
+
+Like G_TimeShiftAllClients, but leaves alone any client that the
+shot can't reach either where it is now or anywhere in its history
+=====================
+*/
+static void G_TimeShiftClientsAlongTrace( int time, gentity_t *skip, vec3_t start, vec3_t end, float spread )
+{
+	int			i;
+	gentity_t	*ent;
+	qboolean debug = ( (skip != NULL) && skip->client && (skip->s.weapon == WP_RAILGUN) );
+
+	ent = &g_entities[0];
+	for ( i = 0; i < MAX_CLIENTS; i++, ent++ )
+	{
+		if ( (ent == skip) || !ent->client || !ent->inuse ||
+				(ent->client->sess.sessionTeam >= TEAM_SPECTATOR) )
+		{
+			continue;
+		}
+
+		if ( !G_TraceTouchesBounds( start, end, spread, ent->client->historyAbsmin, ent->client->historyAbsmax ) &&
+				!G_TraceTouchesBounds( start, end, spread, ent->r.absmin, ent->r.absmax ) )
+		{
+			continue;
+		}
+
+		G_TimeShiftClient( ent, time, debug, skip );
+	}
+}
+
+
 /*
 ================
-G_DoTimeShiftFor
+G_TimeShiftTimeFor
 
-Decide what time to shift everyone back to, and do it
+Decide what time to shift everyone back to for this client's shot,
+returns qfalse if nobody should be shifted at all
 ================
 */
-void G_DoTimeShiftFor( gentity_t *ent )
+static qboolean G_TimeShiftTimeFor( gentity_t *ent, int *time )
 {
 	int wpflags[WP_NUM_WEAPONS] = { 0, 0, 2, 4, 0, 0, 8, 16, 0, 0, 0, 32, 0, 64 };
 
-	int wpflag = wpflags[ent->client->ps.weapon];
-	int time;
+	int wpflag;
 
 	// don't time shift for mistakes or bots
 	if ( !ent->inuse || !ent->client || (ent->r.svFlags & SVF_BOT) ) {
-		return;
+		return qfalse;
 	}
 
+	wpflag = wpflags[ent->client->ps.weapon];
+
 	// if it's enabled server-side and the client wants it or wants it for this weapon
 	if ( g_delagHitscan.integer && ( ent->client->pers.delag & 1 || ent->client->pers.delag & wpflag ) ) {
 		// do the full lag compensation, except what the client nudges
-		time = ent->client->attackTime + ent->client->pers.cmdTimeNudge;
+		*time = ent->client->attackTime + ent->client->pers.cmdTimeNudge;
 		//Give the lightning gun some handicap (lag was part of weapon balance in VQ3)
 		if(ent->client->ps.weapon == WP_LIGHTNING && g_lagLightning.integer)
-			time+=50;
+			*time+=50;
 	}
 	else {
 		// do just 50ms
-		time = level.previousTime + ent->client->frameOffset;
+		*time = level.previousTime + ent->client->frameOffset;
+	}
+
+	return qtrue;
+}
+
+
+/*
+================
+G_DoTimeShiftFor
+
+Decide what time to shift everyone back to, and do it
+================
+*/
+void G_DoTimeShiftFor( gentity_t *ent )
+{
+	int time;
+
+	if ( !G_TimeShiftTimeFor( ent, &time ) ) {
+		return;
 	}
 
 	G_TimeShiftAllClients( time, ent );
 }
 
 
+/*
+=====================
+G_DoTimeShiftForTrace
+
+Same as G_DoTimeShiftFor, but only for the clients the shot from
+"start" to "end" could possibly hit. "spread" is how far the shot
+may stray from that line per unit travelled
+=====================
+*/
+void G_DoTimeShiftForTrace( gentity_t *ent, vec3_t start, vec3_t end, float spread )
+{
+	int time;
+
+	if ( !g_delagPrefilter.integer ) {
+		G_DoTimeShiftFor( ent );
+		return;
+	}
+
+	if ( !G_TimeShiftTimeFor( ent, &time ) ) {
+		return;
+	}
+
+	G_TimeShiftClientsAlongTrace( time, ent, start, end, spread );
+}
+
+
 /*
 ===================
 G_UnTimeShiftClient
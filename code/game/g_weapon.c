@@ -234,7 +234,7 @@ void Bullet_Fire (gentity_t *ent, float spread, int damage )
 
 //unlagged - backward reconciliation #2
 		// backward-reconcile the other clients
-		G_DoTimeShiftFor( ent );
+		G_DoTimeShiftForTrace( ent, muzzle, end, 0 );
 //unlagged - backward reconciliation #2
 
 		trap_Trace (&tr, muzzle, NULL, NULL, end, passent, MASK_SHOT);
@@ -367,6 +367,8 @@ qboolean ShotgunPellet( vec3_t start, vec3_t end, gentity_t *ent )
 				if (G_InvulnerabilityEffect( traceEnt, forward, tr.endpos, impactpoint, bouncedir )) {
 					G_BounceProjectile( tr_start, impactpoint, bouncedir, tr_end );
 					VectorCopy( impactpoint, tr_start );
+					// the bounced pellet can go anywhere, so shift everyone
+					G_DoTimeShiftFor( ent );
 					// the player can hit him/herself with the bounced rail
 					passent = ENTITYNUM_NONE;
 				}
@@ -411,8 +413,10 @@ void ShotgunPattern( vec3_t origin, vec3_t origin2, int seed, gentity_t *ent )
 
 
 //unlagged - backward reconciliation #2
-	// backward-reconcile the other clients
-	G_DoTimeShiftFor( ent );
+	// backward-reconcile the other clients, any pellet strays from
+	// the center line by less than 1.5 * spread * 16 every 8192 * 16 units
+	VectorMA( origin, 8192 * 16, forward, end );
+	G_DoTimeShiftForTrace( ent, origin, end, DEFAULT_SHOTGUN_SPREAD * 1.5f / 8192 );
 //unlagged - backward reconciliation #2
 
 	// generate the "random" spread pattern
@@ -556,7 +560,7 @@ void weapon_railgun_fire (gentity_t *ent)
 
 //unlagged - backward reconciliation #2
 	// backward-reconcile the other clients
-	G_DoTimeShiftFor( ent );
+	G_DoTimeShiftForTrace( ent, muzzle, end, 0 );
 //unlagged - backward reconciliation #2
 
 	// trace only against the solids, so the railgun will go through people
@@ -588,6 +592,8 @@ void weapon_railgun_fire (gentity_t *ent)
 					VectorCopy( impactpoint, muzzle );
 					// the player can hit him/herself with the bounced rail
 					passent = ENTITYNUM_NONE;
+					// the bounced rail can go anywhere, so shift everyone
+					G_DoTimeShiftFor( ent );
 				}
 			}
 			else {
@@ -733,7 +739,7 @@ void Weapon_LightningFire( gentity_t *ent )
 //Sago: I'm not sure this should recieve backward reconciliation. It is not a real instant hit weapon, it can normally be dogded
 //unlagged - backward reconciliation #2
 		// backward-reconcile the other clients
-		G_DoTimeShiftFor( ent );
+		G_DoTimeShiftForTrace( ent, muzzle, end, 0 );
 //unlagged - backward reconciliation #2
 
 		trap_Trace( &tr, muzzle, NULL, NULL, end, passent, MASK_SHOT );
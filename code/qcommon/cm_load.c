@@ -45,6 +45,7 @@ byte		*cmod_base;
 cvar_t		*cm_noAreas;
 cvar_t		*cm_noCurves;
 cvar_t		*cm_playerCurveClip;
+cvar_t		*cm_traceRegion;
 #endif
 
 cmodel_t	box_model;
@@ -563,6 +564,7 @@ void CM_LoadMap( const char *name, qboolean clientload, int *checksum ) {
 	cm_noAreas = Cvar_Get ("cm_noAreas", "0", CVAR_CHEAT);
 	cm_noCurves = Cvar_Get ("cm_noCurves", "0", CVAR_CHEAT);
 	cm_playerCurveClip = Cvar_Get ("cm_playerCurveClip", "1", CVAR_ARCHIVE|CVAR_CHEAT );
+	cm_traceRegion = Cvar_Get ("cm_traceRegion", "1", CVAR_ARCHIVE );
 #endif
 	Com_DPrintf( "CM_LoadMap( %s, %i )\n", name, clientload );
 
@@ -653,6 +655,7 @@ void CM_ClearMap( void )
 {
 	memset( &cm, 0, sizeof( cm ) );
 	CM_ClearLevelPatches();
+	CM_ClearTraceRegion();
 }
 
 /*
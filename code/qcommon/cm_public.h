@@ -46,6 +46,11 @@ void		CM_TransformedBoxTrace( trace_t *results, const vec3_t start, const vec3_t
 						  clipHandle_t model, int brushmask,
 						  const vec3_t origin, const vec3_t angles, int capsule );
 
+// world traces that start and end inside the region and are no larger
+// than extents skip the top of the tree, results are unchanged
+void		CM_SetTraceRegion( const vec3_t mins, const vec3_t maxs, const vec3_t extents );
+void		CM_ClearTraceRegion( void );
+
 byte		*CM_ClusterPVS (int cluster);
 
 int			CM_PointLeafnum( const vec3_t p );
@@ -1138,6 +1138,207 @@ void CM_TraceThroughTree( traceWork_t *tw, int num, float p1f, float p2f, vec3_t
 }
 
 
+/*
+===============================================================================
+
+TRACE REGION
+
+While a client moves, nearly all of its world traces start and end
+close to where it stands. The region remembers the first node of the
+tree that splits the area around the client, so those traces can skip
+the walk down to it, and whether there is anything solid near the
+client at all.
+
+===============================================================================
+*/
+
+typedef struct {
+	qboolean	active;
+	vec3_t		bounds[2];		// trace start and end points must stay inside
+	vec3_t		extents;		// largest trace box half size
+	int			headNode;		// first node that splits the region
+	int			contents;		// contents of all brushes and patches near the region
+} traceRegion_t;
+
+static traceRegion_t	cm_region;
+
+/*
+================
+CM_StoreRegionContents
+================
+*/
+static void CM_StoreRegionContents( leafList_t *ll, int nodenum ) {
+	int			k;
+	cLeaf_t		*leaf;
+	cbrush_t	*b;
+	cPatch_t	*patch;
+
+	leaf = &cm.leafs[-1 - nodenum];
+
+	for ( k = 0 ; k < leaf->numLeafBrushes ; k++ ) {
+		b = &cm.brushes[cm.leafbrushes[leaf->firstLeafBrush + k]];
+		if ( b->checkcount == cm.checkcount ) {
+			continue;
+		}
+		b->checkcount = cm.checkcount;
+
+		if ( CM_BoundsIntersect( ll->bounds[0], ll->bounds[1], b->bounds[0], b->bounds[1] ) ) {
+			*ll->list |= b->contents;
+		}
+	}
+
+	for ( k = 0 ; k < leaf->numLeafSurfaces ; k++ ) {
+		patch = cm.surfaces[cm.leafsurfaces[leaf->firstLeafSurface + k]];
+		if ( !patch ) {
+			continue;
+		}
+		if ( patch->checkcount == cm.checkcount ) {
+			continue;
+		}
+		patch->checkcount = cm.checkcount;
+
+		// patches in the leafs are few, so don't bother with their bounds
+		*ll->list |= patch->contents;
+	}
+}
+
+/*
+================
+CM_RegionHeadNode
+
+Walk down the tree as long as every trace inside the region would
+go to the same child in CM_TraceThroughTree, which passes the trace
+on unchanged in that case
+================
+*/
+static int CM_RegionHeadNode( void ) {
+	int			num, i;
+	cNode_t		*node;
+	cplane_t	*plane;
+	float		dmin, dmax, offset;
+
+	num = 0;
+	while ( num >= 0 ) {
+		node = cm.nodes + num;
+		plane = node->plane;
+
+		if ( plane->type < 3 ) {
+			dmin = cm_region.bounds[0][plane->type];
+			dmax = cm_region.bounds[1][plane->type];
+			offset = cm_region.extents[plane->type];
+		} else {
+			dmin = dmax = 0;
+			for ( i = 0 ; i < 3 ; i++ ) {
+				if ( plane->normal[i] < 0 ) {
+					dmin += plane->normal[i] * cm_region.bounds[1][i];
+					dmax += plane->normal[i] * cm_region.bounds[0][i];
+				} else {
+					dmin += plane->normal[i] * cm_region.bounds[0][i];
+					dmax += plane->normal[i] * cm_region.bounds[1][i];
+				}
+			}
+			// box traces use this, point traces use 0 which is covered by it
+			offset = 2048;
+		}
+		dmin -= plane->dist;
+		dmax -= plane->dist;
+
+		// one extra unit for rounding differences with the actual trace
+		if ( dmin >= offset + 2 ) {
+			num = node->children[0];
+		} else if ( dmax < -offset - 2 ) {
+			num = node->children[1];
+		} else {
+			break;
+		}
+	}
+
+	return num;
+}
+
+/*
+================
+CM_SetTraceRegion
+================
+*/
+void CM_SetTraceRegion( const vec3_t mins, const vec3_t maxs, const vec3_t extents ) {
+	leafList_t	ll;
+	int			i;
+
+	cm_region.active = qfalse;
+
+	if ( !cm.numNodes ) {
+		return;
+	}
+#ifndef BSPC
+	if ( !cm_traceRegion->integer ) {
+		return;
+	}
+#endif
+
+	VectorCopy( mins, cm_region.bounds[0] );
+	VectorCopy( maxs, cm_region.bounds[1] );
+	VectorCopy( extents, cm_region.extents );
+
+	cm_region.headNode = CM_RegionHeadNode();
+
+	// everything a trace inside the region could touch, position tests
+	// look one unit further out
+	for ( i = 0 ; i < 3 ; i++ ) {
+		ll.bounds[0][i] = mins[i] - extents[i] - 2;
+		ll.bounds[1][i] = maxs[i] + extents[i] + 2;
+	}
+
+	cm_region.contents = 0;
+	ll.count = 0;
+	ll.maxcount = 0;
+	ll.list = &cm_region.contents;
+	ll.storeLeafs = CM_StoreRegionContents;
+	ll.lastLeaf = 0;
+	ll.overflowed = qfalse;
+
+	cm.checkcount++;
+	CM_BoxLeafnums_r( &ll, 0 );
+
+	cm_region.active = qtrue;
+}
+
+/*
+================
+CM_ClearTraceRegion
+================
+*/
+void CM_ClearTraceRegion( void ) {
+	cm_region.active = qfalse;
+}
+
+/*
+================
+CM_TraceInRegion
+================
+*/
+static qboolean CM_TraceInRegion( const traceWork_t *tw ) {
+	int		i;
+
+	if ( !cm_region.active ) {
+		return qfalse;
+	}
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		if ( tw->size[1][i] > cm_region.extents[i] ) {
+			return qfalse;
+		}
+		if ( tw->start[i] < cm_region.bounds[0][i] || tw->start[i] > cm_region.bounds[1][i] ) {
+			return qfalse;
+		}
+		if ( tw->end[i] < cm_region.bounds[0][i] || tw->end[i] > cm_region.bounds[1][i] ) {
+			return qfalse;
+		}
+	}
+
+	return qtrue;
+}
+
 //======================================================================
 
 
@@ -1292,7 +1493,7 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 			else {
 				CM_TestInLeaf( &tw, &cmod->leaf );
 			}
-		} else {
+		} else if ( !CM_TraceInRegion( &tw ) || ( cm_region.contents & tw.contents ) ) {
 			CM_PositionTest( &tw );
 		}
 	} else {
@@ -1336,6 +1537,11 @@ void CM_Trace( trace_t *results, const vec3_t start, const vec3_t end, vec3_t mi
 			else {
 				CM_TraceThroughLeaf( &tw, &cmod->leaf );
 			}
+		} else if ( CM_TraceInRegion( &tw ) ) {
+			// nothing near the region means nothing to hit
+			if ( cm_region.contents & tw.contents ) {
+				CM_TraceThroughTree( &tw, cm_region.headNode, 0, 1, tw.start, tw.end );
+			}
 		} else {
 			CM_TraceThroughTree( &tw, 0, 0, 1, tw.start, tw.end );
 		}
@@ -263,7 +263,6 @@ static	cvar_t		*fs_basepath;
 static	cvar_t		*fs_basegame;
 static	cvar_t		*fs_gamedirvar;
 static	searchpath_t	*fs_searchpaths;
-static	int			fs_readCount;			// total bytes read
 static	int			fs_loadCount;			// total files read
 static	int			fs_loadStack;			// total files in memory
 static	int			fs_packFiles = 0;		// total number of files in packs
@@ -1523,7 +1522,6 @@ int FS_Read( void *buffer, int len, fileHandle_t f )
 	}
 
 	buf = (unsigned char *)buffer;
-	fs_readCount += len;
 
 	if (fsh[f].zipFile == qfalse) {
 		remaining = len;
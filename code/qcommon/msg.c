@@ -1086,6 +1086,144 @@ void MSG_ReadDeltaEntity( msg_t *msg, entityState_t *from, entityState_t *to,
 	}
 }
 
+/*
+==================
+MSG_DeltaPacketEntity
+
+Parses deltas from the given base and adds the resulting entity
+to the circular buffer
+==================
+*/
+static void MSG_DeltaPacketEntity( msg_t *msg, entityState_t *parseEntities, int parseMask,
+		int *parseEntitiesNum, int *numEntities, int newnum, entityState_t *old, qboolean unchanged ) {
+	entityState_t	*state;
+
+	// save the parsed entity state into the big circular buffer so
+	// it can be used as the source for a later delta
+	state = &parseEntities[*parseEntitiesNum & parseMask];
+
+	if ( unchanged ) {
+		*state = *old;
+	} else {
+		MSG_ReadDeltaEntity( msg, old, state, newnum );
+	}
+
+	if ( state->number == (MAX_GENTITIES-1) ) {
+		return;		// entity was delta removed
+	}
+	(*parseEntitiesNum)++;
+	(*numEntities)++;
+}
+
+/*
+==================
+MSG_ReadPacketEntities
+
+Parses the entity list of a snapshot into parseEntities, a circular buffer
+of parseMask + 1 states. Entities are delta compressed from the numOld
+states of the old frame starting at oldFirst, or from their baselines.
+Returns the number of entities, *parseEntitiesNum is moved past them.
+==================
+*/
+int MSG_ReadPacketEntities( msg_t *msg, entityState_t *parseEntities, int parseMask, int *parseEntitiesNum,
+		int oldFirst, int numOld, entityState_t *baselines ) {
+	int			newnum;
+	entityState_t	*oldstate;
+	int			oldindex, oldnum;
+	int			numEntities;
+	qboolean	print;
+
+	print = ( cl_shownet && cl_shownet->integer == 3 );
+	numEntities = 0;
+
+	// delta from the entities present in the old frame
+	oldindex = 0;
+	oldstate = NULL;
+	if ( oldindex >= numOld ) {
+		oldnum = 99999;
+	} else {
+		oldstate = &parseEntities[(oldFirst + oldindex) & parseMask];
+		oldnum = oldstate->number;
+	}
+
+	while ( 1 ) {
+		// read the entity index number
+		newnum = MSG_ReadBits( msg, GENTITYNUM_BITS );
+
+		if ( newnum == (MAX_GENTITIES-1) ) {
+			break;
+		}
+
+		if ( msg->readcount > msg->cursize ) {
+			Com_Error (ERR_DROP,"MSG_ReadPacketEntities: end of message");
+		}
+
+		while ( oldnum < newnum ) {
+			// one or more entities from the old packet are unchanged
+			if ( print ) {
+				Com_Printf ("%3i:  unchanged: %i\n", msg->readcount, oldnum);
+			}
+			MSG_DeltaPacketEntity( msg, parseEntities, parseMask, parseEntitiesNum, &numEntities, oldnum, oldstate, qtrue );
+
+			oldindex++;
+
+			if ( oldindex >= numOld ) {
+				oldnum = 99999;
+			} else {
+				oldstate = &parseEntities[(oldFirst + oldindex) & parseMask];
+				oldnum = oldstate->number;
+			}
+		}
+		if (oldnum == newnum) {
+			// delta from previous state
+			if ( print ) {
+				Com_Printf ("%3i:  delta: %i\n", msg->readcount, newnum);
+			}
+			MSG_DeltaPacketEntity( msg, parseEntities, parseMask, parseEntitiesNum, &numEntities, newnum, oldstate, qfalse );
+
+			oldindex++;
+
+			if ( oldindex >= numOld ) {
+				oldnum = 99999;
+			} else {
+				oldstate = &parseEntities[(oldFirst + oldindex) & parseMask];
+				oldnum = oldstate->number;
+			}
+			continue;
+		}
+
+		if ( oldnum > newnum ) {
+			// delta from baseline
+			if ( print ) {
+				Com_Printf ("%3i:  baseline: %i\n", msg->readcount, newnum);
+			}
+			MSG_DeltaPacketEntity( msg, parseEntities, parseMask, parseEntitiesNum, &numEntities, newnum, &baselines[newnum], qfalse );
+			continue;
+		}
+
+	}
+
+	// any remaining entities in the old frame are copied over
+	while ( oldnum != 99999 ) {
+		// one or more entities from the old packet are unchanged
+		if ( print ) {
+			Com_Printf ("%3i:  unchanged: %i\n", msg->readcount, oldnum);
+		}
+		MSG_DeltaPacketEntity( msg, parseEntities, parseMask, parseEntitiesNum, &numEntities, oldnum, oldstate, qtrue );
+
+		oldindex++;
+
+		if ( oldindex >= numOld ) {
+			oldnum = 99999;
+		} else {
+			oldstate = &parseEntities[(oldFirst + oldindex) & parseMask];
+			oldnum = oldstate->number;
+		}
+	}
+
+	return numEntities;
+}
+
 
 /*
 ============================================================================
@@ -99,6 +99,8 @@ void MSG_ReadDeltaUsercmdKey( msg_t *msg, int key, usercmd_t *from, usercmd_t *t
 
 void MSG_WriteDeltaEntity( msg_t *msg, struct entityState_s *from, struct entityState_s *to, qboolean force );
 void MSG_ReadDeltaEntity( msg_t *msg, entityState_t *from, entityState_t *to, int number );
+int MSG_ReadPacketEntities( msg_t *msg, entityState_t *parseEntities, int parseMask, int *parseEntitiesNum,
+		int oldFirst, int numOld, entityState_t *baselines );
 
 void MSG_WriteDeltaPlayerstate( msg_t *msg, struct playerState_s *from, struct playerState_s *to );
 void MSG_ReadDeltaPlayerstate( msg_t *msg, struct playerState_s *from, struct playerState_s *to );
@@ -1063,6 +1065,10 @@ void    Sys_AnsiColorPrint( const char *msg );
 // Sys_Milliseconds should only be used for profiling purposes,
 // any game related timing information should come from event timestamps
 int		Sys_Milliseconds (void);
+int64_t	Sys_Microseconds( void );
+
+// resident size of the process in KB, -1 where it can't be told
+int		Sys_ResidentMemory( void );
 
 qboolean Sys_RandomBytes( byte *string, int len );
 
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_init.c -- functions that are not called every frame
 
 #include "tr_local.h"
+#include "../renderercommon/tr_mesh_lerp.h"
 
 
 glconfig_t	glConfig;
@@ -50,6 +51,7 @@ cvar_t	*r_dynamiclight;
 
 cvar_t	*r_lodbias;
 cvar_t	*r_lodscale;
+cvar_t	*r_lerpCache;
 
 cvar_t	*r_norefresh;
 cvar_t	*r_drawentities;
@@ -822,6 +824,7 @@ void GfxInfo_f( void )
     ri.Printf( PRINT_ALL, "compiled vertex arrays: %s\n", enablestrings[qglLockArraysEXT != 0 ] );
     ri.Printf( PRINT_ALL, "texenv add: %s\n", enablestrings[glConfig.textureEnvAddAvailable != 0] );
     ri.Printf( PRINT_ALL, "compressed textures: %s\n", enablestrings[glConfig.textureCompression!=TC_NONE] );
+    ri.Printf( PRINT_ALL, "md3 vertex lerp: %s\n", R_MD3LerpImplementation() );
 
     if (glConfig.smpActive) {
         ri.Printf( PRINT_ALL, "Using dual processor acceleration\n" );
@@ -927,6 +930,7 @@ void R_Register( void )
 	r_skipBackEnd = ri.Cvar_Get ("r_skipBackEnd", "0", CVAR_CHEAT);
 
 	r_lodscale = ri.Cvar_Get( "r_lodscale", "5", CVAR_CHEAT );
+	r_lerpCache = ri.Cvar_Get( "r_lerpCache", "0", CVAR_ARCHIVE );
 	r_norefresh = ri.Cvar_Get ("r_norefresh", "0", CVAR_CHEAT);
 	r_drawentities = ri.Cvar_Get ("r_drawentities", "1", CVAR_CHEAT );
 	r_nocull = ri.Cvar_Get ("r_nocull", "0", CVAR_CHEAT);
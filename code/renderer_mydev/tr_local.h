@@ -1060,6 +1060,7 @@ extern cvar_t	*r_texturebits;			// number of desired texture bits
 
 extern cvar_t	*r_lodbias;				// push/pull LOD transitions
 extern cvar_t	*r_lodscale;
+extern cvar_t	*r_lerpCache;			// reuse decoded md3 vertexes within a frame
 
 extern cvar_t	*r_inGameVideo;				// controls whether in game video should be draw
 extern cvar_t	*r_fastsky;				// controls whether sky should be cleared or drawn
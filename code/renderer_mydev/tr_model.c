@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_models.c -- model loading and caching
 
 #include "tr_local.h"
+#include "../renderercommon/tr_mesh_lerp.h"
 #include "../renderercommon/matrix_multiplication.h"
 
 #define	LL(x) x=LittleLong(x)
@@ -536,6 +537,8 @@ void R_ModelInit( void ) {
 
 	mod = R_AllocModel();
 	mod->type = MOD_BAD;
+
+	R_ClearMD3LerpCache();
 }
 
 
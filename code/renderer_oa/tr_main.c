@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "tr_local.h"
 #include "../renderercommon/matrix_multiplication.h"
+#include "../renderercommon/tr_radix.h"
 ///////// externs ///////////
 extern int max_polys;
 extern int max_polyverts;
@@ -710,47 +711,16 @@ DRAWSURF SORTING
 ==========================================================================================
 */
 
-static ID_INLINE void R_Radix( int byte, int size, drawSurf_t *source, drawSurf_t *dest )
-{
-  int count[ 256 ] = { 0 };
-  int index[ 256 ] = { 0 };
-  int i;
-
-  unsigned char* sortKey = ( (unsigned char *)&source[ 0 ].sort ) + byte;
-  unsigned char* end = sortKey + ( size * sizeof( drawSurf_t ) );
-
-  for( ; sortKey < end; sortKey += sizeof( drawSurf_t ) )
-    ++count[ *sortKey ];
-
-  for( i = 1; i < 256; ++i )
-    index[ i ] = index[ i - 1 ] + count[ i - 1 ];
-
-  sortKey = ( (unsigned char *)&source[ 0 ].sort ) + byte;
-  for( i = 0; i < size; ++i, sortKey += sizeof( drawSurf_t ) )
-    dest[ index[ *sortKey ]++ ] = source[ i ];
-}
-
 /*
 ===============
 R_RadixSort
-
-Radix sort with 4 byte size buckets
 ===============
 */
 static void R_RadixSort( drawSurf_t *source, int size )
 {
-  static drawSurf_t scratch[ MAX_DRAWSURFS ];
-#ifdef Q3_LITTLE_ENDIAN
-  R_Radix( 0, size, source, scratch );
-  R_Radix( 1, size, scratch, source );
-  R_Radix( 2, size, source, scratch );
-  R_Radix( 3, size, scratch, source );
-#else
-  R_Radix( 3, size, source, scratch );
-  R_Radix( 2, size, scratch, source );
-  R_Radix( 1, size, source, scratch );
-  R_Radix( 0, size, scratch, source );
-#endif //Q3_LITTLE_ENDIAN
+	static drawSurf_t scratch[ MAX_DRAWSURFS ];
+
+	R_RadixSortDrawSurfs( source, scratch, size, sizeof( drawSurf_t ) );
 }
 
 /*
@@ -5,9 +5,12 @@
 #include "../renderercommon/ref_import.h"
 
 #include "R_ImageProcess.h"
+#include "../renderercommon/tr_image_kernels.h"
 
 static unsigned char s_intensitytable[256];
 static unsigned char s_gammatable[256];
+// s_gammatable[s_intensitytable[i]]
+static unsigned char s_lightscaletable[256];
 
 /*
 void R_GammaCorrect(unsigned char* buffer, const unsigned int Size)
@@ -69,6 +72,10 @@ void R_SetColorMappings( void )
 		s_intensitytable[i] = j;
 	}
 
+	for (i=0 ; i<256 ; i++)
+    {
+		s_lightscaletable[i] = s_gammatable[s_intensitytable[i]];
+	}
 }
 
 
@@ -80,36 +87,7 @@ Scale up the pixel values in a texture to increase the lighting range
 */
 void R_LightScaleTexture (unsigned char* dst, unsigned char* in, unsigned int nBytes)
 {
-    unsigned int i;
-
-    if ( 0 )
-    {
-        for (i=0; i<nBytes; i+=4)
-        {
-            unsigned int n1 = i + 1;
-            unsigned int n2 = i + 2;
-            unsigned int n3 = i + 3;
-
-            dst[i] = s_gammatable[in[i]];
-            dst[n1] = s_gammatable[in[n1]];
-            dst[n2] = s_gammatable[in[n2]];
-            dst[n3] = in[n3];
-        }
-    }
-    else
-    {
-        for (i=0; i<nBytes; i+=4)
-        {
-            unsigned int n1 = i + 1;
-            unsigned int n2 = i + 2;
-            unsigned int n3 = i + 3;
-
-            dst[i] = s_gammatable[s_intensitytable[in[i]]];
-            dst[n1] = s_gammatable[s_intensitytable[in[n1]]];
-            dst[n2] = s_gammatable[s_intensitytable[in[n2]]];
-            dst[n3] = in[n3];
-        }
-    }
+    R_LightScaleImage(dst, in, nBytes / 4, s_lightscaletable);
 }
 
 
@@ -172,48 +150,12 @@ void R_BlendOverTexture(unsigned char* data, const uint32_t pixelCount, uint32_t
 ================
 R_MipMap
 
-Operates in place, quartering the size of the texture, no error checking
+Quartering the size of the texture into out, no error checking
 ================
 */
 void R_MipMap(const unsigned char* in, uint32_t width, uint32_t height, unsigned char* out)
 {
-
-	if ( (width == 1) && (height == 1) )
-    {
-        out[0] = in[0];
-		return;
-    }
-    uint32_t i;
-
-    const unsigned int row = width * 4;
-	width >>= 1;
-	height >>= 1;
-
-	if ( (width == 0) || (height == 0) )
-    {
-		width += height;	// get largest
-		for (i=0; i<width; i++, out+=4, in+=8 )
-        {
-			out[0] = ( in[0] + in[4] )>>1;
-			out[1] = ( in[1] + in[5] )>>1;
-			out[2] = ( in[2] + in[6] )>>1;
-			out[3] = ( in[3] + in[7] )>>1;
-		}
-	}
-    else
-    {   
-        for (i=0; i<height; i++, in+=row)
-        {
-            uint32_t j;
-            for (j=0; j<width; j++, out+=4, in+=8)
-            {
-                out[0] = (in[0] + in[4] + in[row+0] + in[row+4])>>2;
-                out[1] = (in[1] + in[5] + in[row+1] + in[row+5])>>2;
-                out[2] = (in[2] + in[6] + in[row+2] + in[row+6])>>2;
-                out[3] = (in[3] + in[7] + in[row+3] + in[row+7])>>2;
-            }
-        }
-    }
+    R_MipMapBox(in, width, height, out);
 }
 
 
@@ -221,79 +163,13 @@ void R_MipMap(const unsigned char* in, uint32_t width, uint32_t height, unsigned
 ================
 R_MipMap2
 
-Operates in place, quartering the size of the texture
+Quartering the size of the texture into out
 Proper linear filter, no error checking
 ================
 */
 void R_MipMap2(const unsigned char* in, uint32_t inWidth, uint32_t inHeight, unsigned char* out)
 {
-
-	int	i, j;
-
-	if ( (inWidth == 1) && (inHeight == 1) )
-    {
-        out[0] = in[0];
-		return;
-    }
-	//ri.Printf (PRINT_ALL, "\n---R_MipMap2---\n");
-    // Not run time funs, can be used for best view effects
-
-	unsigned int outWidth = inWidth >> 1;
-	unsigned int outHeight = inHeight >> 1;
-    unsigned int nBytes = outWidth * outHeight * 4;
-
-    unsigned char * temp = malloc( nBytes );
-
-	const unsigned int inWidthMask = inWidth - 1;
-	const unsigned int inHeightMask = inHeight - 1;
-
-	for ( i = 0 ; i < outHeight ; i++ )
-    {
-		for ( j = 0 ; j < outWidth ; j++ )
-        {
-            unsigned int outIndex = i * outWidth + j;
-            unsigned int k;
-			for ( k = 0 ; k < 4 ; k++ )
-            {
-                unsigned int r0 = ((i*2-1) & inHeightMask) * inWidth;
-                unsigned int r1 = ((i*2 ) & inHeightMask) * inWidth;
-                unsigned int r2 = ((i*2+1) & inHeightMask) * inWidth;
-                unsigned int r3 = ((i*2+2) & inHeightMask) * inWidth;
-
-                unsigned int c0 = ((j*2-1) & inWidthMask);
-                unsigned int c1 = ((j*2 ) & inWidthMask);
-                unsigned int c2 = ((j*2+1) & inWidthMask);
-                unsigned int c3 = ((j*2+2) & inWidthMask);
-
-
-				unsigned int total = 
-					1 * in[(r0 + c0) * 4 + k] +
-					2 * in[(r0 + c1) * 4 + k] +
-					2 * in[(r0 + c2) * 4 + k] +
-					1 * in[(r0 + c3) * 4 + k] +
-
-					2 * in[(r1 + c0) * 4 + k] +
-					4 * in[(r1 + c1) * 4 + k] +
-					4 * in[(r1 + c2) * 4 + k] +
-					2 * in[(r1 + c3) * 4 + k] +
-
-					2 * in[(r2 + c0) * 4 + k] +
-					4 * in[(r2 + c1) * 4 + k] +
-					4 * in[(r2 + c2) * 4 + k] +
-					2 * in[(r2 + c3) * 4 + k] +
-
-					1 * in[(r3 + c0) * 4 + k] +
-					2 * in[(r3 + c1) * 4 + k] +
-					2 * in[(r3 + c2) * 4 + k] +
-					1 * in[(r3 + c3) * 4 + k] ;
-				
-                temp[4*outIndex + k] = total / 36;
-			}
-		}
-	}
-
-	memcpy( out, temp, nBytes );
-	free( temp );
+    R_MipMapFilter(in, inWidth, inHeight, out);
 }
 
 
@@ -333,58 +209,7 @@ static void DEBUG_resample(const char *name, unsigned char* data, unsigned char*
 void ResampleTexture(unsigned char * pOut, const unsigned int inwidth, const unsigned int inheight,
                                const unsigned char *pIn, const unsigned int outwidth, const unsigned int outheight)
 {
-	unsigned int i, j;
-	unsigned int p1[2048], p2[2048];
-
-    // printf("inwidth: %d \t outwidth: %d \n", inwidth, outwidth);
-
-
-    unsigned int fracstep = (inwidth << 16)/outwidth;
-
-    unsigned int frac1 = fracstep>>2;
-    unsigned int frac2 = 3*(fracstep>>2);
-
-    for(i=0; i<outwidth; i++)
-    {
-        p1[i] = 4*(frac1>>16);
-        frac1 += fracstep;
-
-        p2[i] = 4*(frac2>>16);
-        frac2 += fracstep;
-    }
- 
-   
-	for (i=0; i<outheight; i++)
-	{
-		const unsigned char* inrow1 = pIn + 4 * inwidth * (unsigned int)((i+0.25)*inheight/outheight);
-		const unsigned char* inrow2 = pIn + 4 * inwidth * (unsigned int)((i+0.75)*inheight/outheight);
-        //const unsigned char* inrow1 = pIn + inwidth * (unsigned int)((4*i+1)*inheight/outheight);
-		//const unsigned char* inrow2 = pIn + inwidth * (unsigned int)((4*i+3)*inheight/outheight);
-
-
-        // printf("inrow1: %d \t inrow2: %d \n", 
-        //        4 * (unsigned int)((i+0.25)*inheight/outheight),
-        //        4 * (unsigned int)((i+0.75)*inheight/outheight)
-        //        );
-
-
-        for (j=0; j<outwidth; j++)
-        {
-			const unsigned char* pix1 = inrow1 + p1[j];
-			const unsigned char* pix2 = inrow1 + p2[j];
-			const unsigned char* pix3 = inrow2 + p1[j];
-			const unsigned char* pix4 = inrow2 + p2[j];
-            
-            unsigned char* pCurPix = pOut + j*4;
-
-			pCurPix[0] = (pix1[0] + pix2[0] + pix3[0] + pix4[0])>>2;
-			pCurPix[1] = (pix1[1] + pix2[1] + pix3[1] + pix4[1])>>2;
-			pCurPix[2] = (pix1[2] + pix2[2] + pix3[2] + pix4[2])>>2;
-			pCurPix[3] = (pix1[3] + pix2[3] + pix3[3] + pix4[3])>>2;
-		}
-
-        pOut += outwidth*4;
-	}
+    R_ResampleImage(pIn, inwidth, inheight, pOut, outwidth, outheight);
 }
 
 
@@ -25,6 +25,8 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tr_globals.h"
 #include "vk_image.h"
 #include "tr_cvar.h"
+#include "vk_world_geometry.h"
+#include "vk_pipelines.h"
 #include "../renderercommon/ref_import.h"
 
 /*
@@ -1881,6 +1883,9 @@ void RE_LoadWorldMap( const char *name )
 		((int *)header)[i] = LittleLong ( ((int *)header)[i]);
 	}
 
+	// build the pipelines this map needed last time before its shaders ask for them
+	vk_prewarmPipelines( s_worldData.baseName );
+
 	// load into heap
 	R_LoadShaders( &header->lumps[LUMP_SHADERS] );
 	R_LoadLightmaps( &header->lumps[LUMP_LIGHTMAPS] );
@@ -1899,5 +1904,8 @@ void RE_LoadWorldMap( const char *name )
 	// only set tr.world now that we know the entire level has loaded properly
 	tr.world = &s_worldData;
 	tr.worldMapLoaded = qtrue;
+
+	vk_createWorldGeometry();
+
     ri.FS_FreeFile( buffer );
 }
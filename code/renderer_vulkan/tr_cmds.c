@@ -31,9 +31,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 //#include "vk_clear_attachments.h"
 #include "vk_frame.h"
 #include "vk_shade_geometry.h"
+#include "vk_world_geometry.h"
 #include "R_DEBUG.h"
 
 #include "vk_screenshot.h"
+#include "../renderercommon/tr_capture.h"
 
 
 
@@ -184,7 +186,8 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec )
 
 
 	R_IssueRenderCommands( qtrue );
-    
+
+	R_ReportCaptureDrops();
 
 	if ( frontEndMsec ) {
 		*frontEndMsec = tr.frontEndMsec;
@@ -197,6 +200,12 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec )
 }
 
 
+int RE_SwapMicroseconds( void )
+{
+	return backEnd.swapUsec;
+}
+
+
 void R_TakeScreenshot( int x, int y, int width, int height, char *name, qboolean jpeg )
 {
     ri.Printf( PRINT_WARNING, "R_TakeScreenshot\n");
@@ -254,7 +263,11 @@ static void R_PerformanceCounters( void )
 				tr.pc.c_dlightSurfaces, tr.pc.c_dlightSurfacesCulled,
 				backEnd.pc.c_dlightVertexes, backEnd.pc.c_dlightIndexes / 3 );
 		}
-	} 
+	} else if (r_speeds->integer == 5) {
+		// time the last frame spent blocked on the GPU before it could record
+		ri.Printf (PRINT_ALL, "front end %i msec, %i msec fence wait, %i frames in flight\n",
+			tr.frontEndMsec, vk_getFenceWaitMsec(), vk.num_frames_in_flight );
+	}
 
 
 	memset( &tr.pc, 0, sizeof( tr.pc ) );
@@ -273,6 +286,7 @@ static void RB_RenderDrawSurfList( drawSurf_t* drawSurfs, int numDrawSurfs )
 	drawSurf_t		*drawSurf;
 	int				oldSort;
 	float			originalTime;
+	qboolean		staticWorld;
 
 	// save original time for entity shader offsets
 	originalTime = backEnd.refdef.floatTime;
@@ -329,6 +343,7 @@ static void RB_RenderDrawSurfList( drawSurf_t* drawSurfs, int numDrawSurfs )
 	oldFogNum = -1;
 	oldDlighted = qfalse;
 	oldSort = -1;
+	staticWorld = qfalse;
 
 	backEnd.pc.c_surfaces += numDrawSurfs;
 
@@ -336,7 +351,9 @@ static void RB_RenderDrawSurfList( drawSurf_t* drawSurfs, int numDrawSurfs )
     {
 		if ( (int)drawSurf->sort == oldSort ) {
 			// fast path, same as previous sort
-			rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
+			if ( !staticWorld || !vk_queueWorldSurface( drawSurf->surface ) ) {
+				rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
+			}
 			continue;
 		}
 		oldSort = drawSurf->sort;
@@ -357,6 +374,11 @@ static void RB_RenderDrawSurfList( drawSurf_t* drawSurfs, int numDrawSurfs )
 			oldDlighted = dlighted;
 		}
 
+		// static world surfaces are drawn from the world buffers
+		// instead of being copied into tess
+		staticWorld = ( entityNum == ENTITYNUM_WORLD && !fogNum && !dlighted
+			&& vk_isStaticWorldShader( shader ) );
+
 		//
 		// change the modelview matrix if needed
 		//
@@ -401,7 +423,9 @@ static void RB_RenderDrawSurfList( drawSurf_t* drawSurfs, int numDrawSurfs )
         }
 
 		// add the triangles for this surface
-		rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
+		if ( !staticWorld || !vk_queueWorldSurface( drawSurf->surface ) ) {
+			rb_surfaceTable[ *drawSurf->surface ]( drawSurf->surface );
+		}
 	}
 
 	backEnd.refdef.floatTime = originalTime;
@@ -636,7 +660,9 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters )
 #endif
 
                 // VULKAN
+                const int64_t swapStart = ri.Microseconds();
                 vk_end_frame();
+                backEnd.swapUsec = ri.Microseconds() - swapStart;
 
                 data += sizeof(swapBuffersCommand_t);
             } break;
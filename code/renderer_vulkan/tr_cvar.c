@@ -74,6 +74,13 @@ cvar_t	*r_maxpolys;
 cvar_t	*r_maxpolyverts;
 
 cvar_t* r_allowResize; // make window resizable
+cvar_t* r_framesInFlight;
+cvar_t* r_worldBuffers;
+cvar_t* r_pipelineCache;
+cvar_t* r_lerpCache;
+cvar_t* r_worldThreads;
+cvar_t* r_aviCaptureThreads;
+cvar_t* r_clusterCull;
 
 void R_Register( void ) 
 {
@@ -161,5 +168,12 @@ void R_Register( void )
     ri.Cvar_CheckRange( r_displayRefresh, 0, 200, qtrue );
 
     r_allowResize = ri.Cvar_Get( "r_allowResize", "0", CVAR_ARCHIVE | CVAR_LATCH );
+    r_framesInFlight = ri.Cvar_Get( "r_framesInFlight", "2", CVAR_ARCHIVE | CVAR_LATCH );
+    r_worldBuffers = ri.Cvar_Get( "r_worldBuffers", "1", CVAR_ARCHIVE | CVAR_LATCH );
+    r_pipelineCache = ri.Cvar_Get( "r_pipelineCache", "1", CVAR_ARCHIVE | CVAR_LATCH );
+    r_lerpCache = ri.Cvar_Get( "r_lerpCache", "0", CVAR_ARCHIVE );
+    r_worldThreads = ri.Cvar_Get( "r_worldThreads", "0", CVAR_ARCHIVE | CVAR_LATCH );
+    r_aviCaptureThreads = ri.Cvar_Get( "r_aviCaptureThreads", "3", CVAR_ARCHIVE | CVAR_LATCH );
+    r_clusterCull = ri.Cvar_Get( "r_clusterCull", "0", CVAR_ARCHIVE );
 }
 
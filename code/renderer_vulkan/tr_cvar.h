@@ -86,6 +86,13 @@ extern cvar_t* r_fullscreen;
 extern cvar_t* r_displayRefresh;
 
 extern cvar_t* r_allowResize; // make window resizable
+extern cvar_t* r_framesInFlight; // frames the CPU may record before waiting on the GPU
+extern cvar_t* r_worldBuffers; // keep static world surfaces in device local buffers
+extern cvar_t* r_pipelineCache; // save compiled pipelines and prebuild the ones a map used
+extern cvar_t* r_lerpCache; // reuse decoded md3 vertexes within a frame
+extern cvar_t* r_worldThreads; // front end threads walking the BSP, 0 = none
+extern cvar_t* r_aviCaptureThreads; // threads compressing video frames, 0 = none
+extern cvar_t* r_clusterCull; // cull a per cluster surface list instead of walking the BSP
 
 void R_Register( void );
 
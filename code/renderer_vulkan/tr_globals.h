@@ -115,6 +115,7 @@ typedef struct {
 	viewParms_t	viewParms;
 	orientationr_t	or;
 	backEndCounters_t	pc;
+	int			swapUsec;		// submit and present of the last frame
 	qboolean	isHyperspace;
 	trRefEntity_t	*currentEntity;
 
@@ -31,9 +31,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "vk_shade_geometry.h"
 #include "vk_pipelines.h"
 #include "vk_image.h"
+#include "vk_world_geometry.h"
 #include "R_LerpTag.h"
 #include "R_ModelBounds.h"
 #include "R_StretchRaw.h"
+#include "../renderercommon/tr_shade_kernels.h"
+#include "../renderercommon/tr_image_kernels.h"
+#include "../renderercommon/tr_capture.h"
 
 refimport_t	ri;
 
@@ -118,6 +122,7 @@ void R_Init( void )
 		vk_initialize();
 	}
 
+	R_InitImageKernels( qtrue );
 
 	R_InitImages();
 
@@ -129,6 +134,12 @@ void R_Init( void )
 
 	R_InitFreeType();
 
+	R_InitWorldJobs();
+
+	R_InitCapture( r_aviCaptureThreads->integer );
+
+	R_InitShadeKernels( qtrue );
+
     ri.Printf( PRINT_ALL, "----- R_Init finished -----\n" );
 }
 
@@ -156,6 +167,12 @@ void RE_Shutdown( qboolean destroyWindow )
     ri.Cmd_RemoveCommand( "gpuMem");
 
 
+	vk_destroyVideoStaging();
+	R_ShutdownCapture();
+
+	R_ShutdownWorldJobs();
+	R_ClearClusterSurfaces();
+
 	R_DoneFreeType();
 
     // VULKAN
@@ -177,6 +194,7 @@ void RE_Shutdown( qboolean destroyWindow )
         tr.registered = qfalse;
         R_DestroyScene();
 
+        vk_destroyWorldGeometry();
         vk_destroyImageRes();
 	}
 
@@ -266,6 +284,8 @@ refexport_t* GetRefAPI(int apiVersion, refimport_t *rimp)
 	re.inPVS = R_inPVS;
 
 	re.TakeVideoFrame = RE_TakeVideoFrame;
+	re.FinishVideoFrames = RE_FinishVideoFrames;
+	re.SwapMicroseconds = RE_SwapMicroseconds;
 
 	return &re;
 }
@@ -563,6 +563,9 @@ typedef struct {
 	// dynamic lighting information
 	int			dlightBits;
 
+	// first index in the static world index buffer, -1 if streamed
+	int			worldFirstIndex;
+
 	// triangle definitions (no normals at points)
 	int			numPoints;
 	int			numIndices;
@@ -579,6 +582,9 @@ typedef struct {
 	// dynamic lighting information
 	int				dlightBits;
 
+	// first index in the static world index buffer, -1 if streamed
+	int				worldFirstIndex;
+
 	// culling information (FIXME: use this!)
 	vec3_t			bounds[2];
 	vec3_t			localOrigin;
@@ -898,6 +904,9 @@ WORLD MAP
 
 void R_AddBrushModelSurfaces( trRefEntity_t *e );
 void R_AddWorldSurfaces( void );
+void R_InitWorldJobs( void );
+void R_ShutdownWorldJobs( void );
+void R_ClearClusterSurfaces( void );
 qboolean R_inPVS( const vec3_t p1, const vec3_t p2 );
 
 /*
@@ -1054,6 +1063,7 @@ void RE_SetColor( const float *rgba );
 void RE_StretchPic ( float x, float y, float w, float h, 
 					  float s1, float t1, float s2, float t2, qhandle_t hShader );
 void RE_EndFrame( int *frontEndMsec, int *backEndMsec );
+int RE_SwapMicroseconds( void );
 void RE_RegisterFont(const char *fontName, int pointSize, fontInfo_t *font);
 void RE_EndRegistration( void );
 // font stuff
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_models.c -- model loading and caching
 
 #include "tr_local.h"
+#include "../renderercommon/tr_mesh_lerp.h"
 #include "tr_globals.h"
 
 #include "tr_model.h"
@@ -54,6 +55,8 @@ void R_ModelInit( void )
 
 	tr.models[tr.numModels] = mod;
 	tr.numModels++;
+
+	R_ClearMD3LerpCache();
 }
 
 
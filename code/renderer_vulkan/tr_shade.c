@@ -23,6 +23,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 
 #include "tr_globals.h"
 #include "vk_shade_geometry.h"
+#include "vk_world_geometry.h"
 
 #include "../renderercommon/ref_import.h"
 
@@ -64,6 +65,7 @@ void RB_BeginSurface( shader_t *shader, int fogNum )
 
 	tess.numIndexes = 0;
 	tess.numVertexes = 0;
+	vk_clearWorldSurfaceQueue();
 	tess.shader = state;
 	tess.fogNum = fogNum;
 	tess.dlightBits = 0;		// will be OR'd in by surface functions
@@ -81,7 +83,7 @@ void RB_BeginSurface( shader_t *shader, int fogNum )
 void RB_EndSurface( void )
 {
 
-	if (tess.numIndexes == 0) {
+	if (tess.numIndexes == 0 && vk_numQueuedWorldSurfaces() == 0) {
 		return;
 	}
     
@@ -26,6 +26,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include "tr_globals.h"
 
 #include "../renderercommon/ref_import.h"
+#include "../renderercommon/tr_shade_kernels.h"
 
 #define	WAVEVALUE( table, base, amplitude, phase, freq )  ((base) + table[ (int)( ( ( (phase) + tess.shaderTime * (freq) ) * FUNCTABLE_SIZE ) ) & FUNCTABLE_MASK ] * (amplitude))
 
@@ -120,45 +121,16 @@ RB_CalcDeformVertexes
 */
 void RB_CalcDeformVertexes( deformStage_t *ds )
 {
-	int i;
-	vec3_t	offset;
-	float	scale;
-	float	*xyz = ( float * ) tess.xyz;
-	float	*normal = ( float * ) tess.normal;
-	float	*table;
-
 	if ( ds->deformationWave.frequency == 0 )
 	{
-		scale = EvalWaveForm( &ds->deformationWave );
-
-		for ( i = 0; i < tess.numVertexes; i++, xyz += 4, normal += 4 )
-		{
-			VectorScale( normal, scale, offset );
-			
-			xyz[0] += offset[0];
-			xyz[1] += offset[1];
-			xyz[2] += offset[2];
-		}
+		R_DeformVertexesScaled( tess.xyz[0], tess.normal[0], tess.numVertexes, EvalWaveForm( &ds->deformationWave ) );
 	}
 	else
 	{
-		table = TableForFunc( ds->deformationWave.func );
-
-		for ( i = 0; i < tess.numVertexes; i++, xyz += 4, normal += 4 )
-		{
-			float off = ( xyz[0] + xyz[1] + xyz[2] ) * ds->deformationSpread;
-
-			scale = WAVEVALUE( table, ds->deformationWave.base, 
-				ds->deformationWave.amplitude,
-				ds->deformationWave.phase + off,
-				ds->deformationWave.frequency );
-
-			VectorScale( normal, scale, offset );
-			
-			xyz[0] += offset[0];
-			xyz[1] += offset[1];
-			xyz[2] += offset[2];
-		}
+		R_DeformVertexesWave( tess.xyz[0], tess.normal[0], tess.numVertexes,
+			TableForFunc( ds->deformationWave.func ),
+			ds->deformationWave.base, ds->deformationWave.amplitude, ds->deformationWave.phase,
+			tess.shaderTime * ds->deformationWave.frequency, ds->deformationSpread );
 	}
 }
 
@@ -596,20 +568,7 @@ void RB_CalcColorFromEntity( unsigned char (*dstColors)[4] )
 {
 	if ( backEnd.currentEntity )
 	{
-		uint32_t i;
-		uint32_t nVerts = tess.numVertexes; 
-		
-        unsigned char srColor[4];
-
-        memcpy(srColor, backEnd.currentEntity->e.shaderRGBA, 4);
-        for ( i = 0; i < nVerts; i++)
-		{
-			// dstColors[i][0]=backEnd.currentEntity->e.shaderRGBA[0];
-			// dstColors[i][1]=backEnd.currentEntity->e.shaderRGBA[1];
-			// dstColors[i][2]=backEnd.currentEntity->e.shaderRGBA[2];
-			// dstColors[i][3]=backEnd.currentEntity->e.shaderRGBA[3];
-            memcpy(dstColors[i], srColor, 4);
-		}
+		R_FillColors( dstColors[0], tess.numVertexes, backEnd.currentEntity->e.shaderRGBA );
 	}	
 }
 
@@ -628,13 +587,8 @@ void RB_CalcColorFromOneMinusEntity( unsigned char (*dstColors)[4] )
         invModulate[2] = 255 - backEnd.currentEntity->e.shaderRGBA[2];
         invModulate[3] = 255 - backEnd.currentEntity->e.shaderRGBA[3];
         // this trashes alpha, but the AGEN block fixes it
-        
-        uint32_t nVerts = tess.numVertexes; 
-        uint32_t i;       
-        for ( i = 0; i < nVerts; i++ )
-        {
-            memcpy(dstColors[i], invModulate, 4);
-        }
+
+        R_FillColors( dstColors[0], tess.numVertexes, invModulate );
     }
 }
 
@@ -643,17 +597,10 @@ void RB_CalcColorFromOneMinusEntity( unsigned char (*dstColors)[4] )
 */
 void RB_CalcAlphaFromEntity( unsigned char *dstColors )
 {
-	int	i;
-
 	if ( !backEnd.currentEntity )
 		return;
 
-	dstColors += 3;
-
-	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
-	{
-		*dstColors = backEnd.currentEntity->e.shaderRGBA[3];
-	}
+	R_FillAlphas( dstColors, tess.numVertexes, backEnd.currentEntity->e.shaderRGBA[3] );
 }
 
 /*
@@ -661,17 +608,10 @@ void RB_CalcAlphaFromEntity( unsigned char *dstColors )
 */
 void RB_CalcAlphaFromOneMinusEntity( unsigned char *dstColors )
 {
-	int	i;
-
 	if ( !backEnd.currentEntity )
 		return;
 
-	dstColors += 3;
-
-	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
-	{
-		*dstColors = 0xff - backEnd.currentEntity->e.shaderRGBA[3];
-	}
+	R_FillAlphas( dstColors, tess.numVertexes, 0xff - backEnd.currentEntity->e.shaderRGBA[3] );
 }
 
 /*
@@ -725,16 +665,12 @@ void RB_CalcWaveColor( const waveForm_t* wf, unsigned char (*dstColors)[4] )
 		glow = 1;
 
 
-    uint8_t color = glow * 255;
+	uint8_t color[4];
 
-    uint32_t i;  
-	for(i = 0; i < tess.numVertexes; i++)
-    {
-		dstColors[i][0] = color;
-    	dstColors[i][1] = color;
-        dstColors[i][2] = color;
-		dstColors[i][3] = 255;
-    }
+	color[0] = color[1] = color[2] = glow * 255;
+	color[3] = 255;
+
+	R_FillColors( dstColors[0], tess.numVertexes, color );
 }
 
 
@@ -743,7 +679,6 @@ void RB_CalcWaveColor( const waveForm_t* wf, unsigned char (*dstColors)[4] )
 */
 void RB_CalcWaveAlpha( const waveForm_t *wf, unsigned char *dstColors )
 {
-	int i;
 	int v;
 	float glow;
 
@@ -751,17 +686,13 @@ void RB_CalcWaveAlpha( const waveForm_t *wf, unsigned char *dstColors )
 
 	v = 255 * glow;
 
-	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
-	{
-		dstColors[3] = v;
-	}
+	R_FillAlphas( dstColors, tess.numVertexes, v );
 }
 
 /*
 ** RB_CalcModulateColorsByFog
 */
 void RB_CalcModulateColorsByFog( unsigned char *colors ) {
-	int		i;
 	float	texCoords[SHADER_MAX_VERTEXES][2];
 
 	// calculate texcoords so we can derive density
@@ -769,19 +700,13 @@ void RB_CalcModulateColorsByFog( unsigned char *colors ) {
 	// been previously called if the surface was opaque
 	RB_CalcFogTexCoords( texCoords[0] );
 
-	for ( i = 0; i < tess.numVertexes; i++, colors += 4 ) {
-		float f = 1.0 - R_FogFactor( texCoords[i][0], texCoords[i][1] );
-		colors[0] *= f;
-		colors[1] *= f;
-		colors[2] *= f;
-	}
+	R_ModulateByFog( colors, texCoords[0], tess.numVertexes, tr.fogTable, qtrue, qfalse );
 }
 
 /*
 ** RB_CalcModulateAlphasByFog
 */
 void RB_CalcModulateAlphasByFog( unsigned char *colors ) {
-	int		i;
 	float	texCoords[SHADER_MAX_VERTEXES][2];
 
 	// calculate texcoords so we can derive density
@@ -789,17 +714,13 @@ void RB_CalcModulateAlphasByFog( unsigned char *colors ) {
 	// been previously called if the surface was opaque
 	RB_CalcFogTexCoords( texCoords[0] );
 
-	for ( i = 0; i < tess.numVertexes; i++, colors += 4 ) {
-		float f = 1.0 - R_FogFactor( texCoords[i][0], texCoords[i][1] );
-		colors[3] *= f;
-	}
+	R_ModulateByFog( colors, texCoords[0], tess.numVertexes, tr.fogTable, qfalse, qtrue );
 }
 
 /*
 ** RB_CalcModulateRGBAsByFog
 */
 void RB_CalcModulateRGBAsByFog( unsigned char *colors ) {
-	int		i;
 	float	texCoords[SHADER_MAX_VERTEXES][2];
 
 	// calculate texcoords so we can derive density
@@ -807,13 +728,7 @@ void RB_CalcModulateRGBAsByFog( unsigned char *colors ) {
 	// been previously called if the surface was opaque
 	RB_CalcFogTexCoords( texCoords[0] );
 
-	for ( i = 0; i < tess.numVertexes; i++, colors += 4 ) {
-		float f = 1.0 - R_FogFactor( texCoords[i][0], texCoords[i][1] );
-		colors[0] *= f;
-		colors[1] *= f;
-		colors[2] *= f;
-		colors[3] *= f;
-	}
+	R_ModulateByFog( colors, texCoords[0], tess.numVertexes, tr.fogTable, qtrue, qtrue );
 }
 
 
@@ -835,11 +750,7 @@ doesn't fit our shader data.
 ========================
 */
 void RB_CalcFogTexCoords( float *st ) {
-	int			i;
-	float		*v;
-	float		s, t;
 	float		eyeT;
-	qboolean	eyeOutside;
 	fog_t		*fog;
 	vec3_t		local;
 	vec4_t		fogDistanceVector, fogDepthVector = {0};
@@ -874,42 +785,11 @@ void RB_CalcFogTexCoords( float *st ) {
 		eyeT = 1;	// non-surface fog always has eye inside
 	}
 
-	// see if the viewpoint is outside
-	// this is needed for clipping distance even for constant fog
-
-	if ( eyeT < 0 ) {
-		eyeOutside = qtrue;
-	} else {
-		eyeOutside = qfalse;
-	}
-
 	fogDistanceVector[3] += 1.0/512;
 
-	// calculate density for each point
-	for (i = 0, v = tess.xyz[0] ; i < tess.numVertexes ; i++, v += 4) {
-		// calculate the length in fog
-		s = DotProduct( v, fogDistanceVector ) + fogDistanceVector[3];
-		t = DotProduct( v, fogDepthVector ) + fogDepthVector[3];
-
-		// partially clipped fogs use the T axis		
-		if ( eyeOutside ) {
-			if ( t < 1.0 ) {
-				t = 1.0/32;	// point is outside, so no fogging
-			} else {
-				t = 1.0/32 + 30.0/32 * t / ( t - eyeT );	// cut the distance at the fog plane
-			}
-		} else {
-			if ( t < 0 ) {
-				t = 1.0/32;	// point is outside, so no fogging
-			} else {
-				t = 31.0/32;
-			}
-		}
-
-		st[0] = s;
-		st[1] = t;
-		st += 2;
-	}
+	// calculate density for each point, the viewpoint is outside when eyeT < 0
+	// this is needed for clipping distance even for constant fog
+	R_FogTexCoords( st, tess.xyz[0], tess.numVertexes, fogDistanceVector, fogDepthVector, eyeT );
 }
 
 
@@ -919,28 +799,7 @@ void RB_CalcFogTexCoords( float *st ) {
 */
 void RB_CalcEnvironmentTexCoords( float *st ) 
 {
-	int			i;
-	float		*v, *normal;
-	vec3_t		viewer, reflected;
-	float		d;
-
-	v = tess.xyz[0];
-	normal = tess.normal[0];
-
-	for (i = 0 ; i < tess.numVertexes ; i++, v += 4, normal += 4, st += 2 ) 
-	{
-		VectorSubtract (backEnd.or.viewOrigin, v, viewer);
-		VectorNorm(viewer);
-
-		d = DotProduct (normal, viewer);
-
-		reflected[0] = normal[0]*2*d - viewer[0];
-		reflected[1] = normal[1]*2*d - viewer[1];
-		reflected[2] = normal[2]*2*d - viewer[2];
-
-		st[0] = 0.5 + reflected[1] * 0.5;
-		st[1] = 0.5 - reflected[2] * 0.5;
-	}
+	R_EnvironmentTexCoords( st, tess.xyz[0], tess.normal[0], tess.numVertexes, backEnd.or.viewOrigin );
 }
 
 /*
@@ -948,19 +807,11 @@ void RB_CalcEnvironmentTexCoords( float *st )
 */
 void RB_CalcTurbulentTexCoords( const waveForm_t *wf, float *st )
 {
-	int i;
 	float now;
 
 	now = ( wf->phase + tess.shaderTime * wf->frequency );
 
-	for ( i = 0; i < tess.numVertexes; i++, st += 2 )
-	{
-		float s = st[0];
-		float t = st[1];
-
-		st[0] = s + tr.sinTable[ ( ( int ) ( ( ( tess.xyz[i][0] + tess.xyz[i][2] )* 1.0/128 * 0.125 + now ) * FUNCTABLE_SIZE ) ) & ( FUNCTABLE_MASK ) ] * wf->amplitude;
-		st[1] = t + tr.sinTable[ ( ( int ) ( ( tess.xyz[i][1] * 1.0/128 * 0.125 + now ) * FUNCTABLE_SIZE ) ) & ( FUNCTABLE_MASK ) ] * wf->amplitude;
-	}
+	R_TurbulentTexCoords( st, tess.xyz[0], tess.numVertexes, tr.sinTable, now, wf->amplitude );
 }
 
 /*
@@ -1112,120 +963,9 @@ void RB_CalcSpecularAlpha( unsigned char *alphas ) {
 */
 void RB_CalcDiffuseColor( unsigned char (*colors)[4] )
 {
-	int				i;
-	float			*v, *normal;
-	float			incoming;
-	trRefEntity_t	*ent;
-//	unsigned char	ambientLightRGBA[4];
-	vec3_t			ambientLight;
-	vec3_t			lightDir;
-	vec3_t			directedLight;
-	int				numVertexes;
-#if idppc_altivec
-	vector unsigned char vSel = (vector unsigned char)(0x00, 0x00, 0x00, 0xff,
-							   0x00, 0x00, 0x00, 0xff,
-							   0x00, 0x00, 0x00, 0xff,
-							   0x00, 0x00, 0x00, 0xff);
-	vector float ambientLightVec;
-	vector float directedLightVec;
-	vector float lightDirVec;
-	vector float normalVec0, normalVec1;
-	vector float incomingVec0, incomingVec1, incomingVec2;
-	vector float zero, jVec;
-	vector signed int jVecInt;
-	vector signed short jVecShort;
-	vector unsigned char jVecChar, normalPerm;
-#endif
-	ent = backEnd.currentEntity;
-//	ambientLightRGBA[0] = ent->ambientLightRGBA[0];
-//  ambientLightRGBA[1] = ent->ambientLightRGBA[1];
-//	ambientLightRGBA[2] = ent->ambientLightRGBA[2];
-//	ambientLightRGBA[3] = ent->ambientLightRGBA[3];
-
-#if idppc_altivec
-	// A lot of this could be simplified if we made sure
-	// entities light info was 16-byte aligned.
-	jVecChar = vec_lvsl(0, ent->ambientLight);
-	ambientLightVec = vec_ld(0, (vector float *)ent->ambientLight);
-	jVec = vec_ld(11, (vector float *)ent->ambientLight);
-	ambientLightVec = vec_perm(ambientLightVec,jVec,jVecChar);
-
-	jVecChar = vec_lvsl(0, ent->directedLight);
-	directedLightVec = vec_ld(0,(vector float *)ent->directedLight);
-	jVec = vec_ld(11,(vector float *)ent->directedLight);
-	directedLightVec = vec_perm(directedLightVec,jVec,jVecChar);	 
-
-	jVecChar = vec_lvsl(0, ent->lightDir);
-	lightDirVec = vec_ld(0,(vector float *)ent->lightDir);
-	jVec = vec_ld(11,(vector float *)ent->lightDir);
-	lightDirVec = vec_perm(lightDirVec,jVec,jVecChar);	 
-
-	zero = (vector float)vec_splat_s8(0);
-	VectorCopy( ent->lightDir, lightDir );
-#else
-	VectorCopy( ent->ambientLight, ambientLight );
-	VectorCopy( ent->directedLight, directedLight );
-	VectorCopy( ent->lightDir, lightDir );
-#endif
-
-	v = tess.xyz[0];
-	normal = tess.normal[0];
+	trRefEntity_t	*ent = backEnd.currentEntity;
 
-#if idppc_altivec
-	normalPerm = vec_lvsl(0,normal);
-#endif
-	numVertexes = tess.numVertexes;
-	for (i = 0 ; i < numVertexes ; i++, v += 4, normal += 4) {
-#if idppc_altivec
-		normalVec0 = vec_ld(0,(vector float *)normal);
-		normalVec1 = vec_ld(11,(vector float *)normal);
-		normalVec0 = vec_perm(normalVec0,normalVec1,normalPerm);
-		incomingVec0 = vec_madd(normalVec0, lightDirVec, zero);
-		incomingVec1 = vec_sld(incomingVec0,incomingVec0,4);
-		incomingVec2 = vec_add(incomingVec0,incomingVec1);
-		incomingVec1 = vec_sld(incomingVec1,incomingVec1,4);
-		incomingVec2 = vec_add(incomingVec2,incomingVec1);
-		incomingVec0 = vec_splat(incomingVec2,0);
-		incomingVec0 = vec_max(incomingVec0,zero);
-		normalPerm = vec_lvsl(12,normal);
-		jVec = vec_madd(incomingVec0, directedLightVec, ambientLightVec);
-		jVecInt = vec_cts(jVec,0);	// RGBx
-		jVecShort = vec_pack(jVecInt,jVecInt);		// RGBxRGBx
-		jVecChar = vec_packsu(jVecShort,jVecShort);	// RGBxRGBxRGBxRGBx
-		jVecChar = vec_sel(jVecChar,vSel,vSel);		// RGBARGBARGBARGBA replace alpha with 255
-		vec_ste((vector unsigned int)jVecChar,0,(unsigned int *)&colors[i*4]);	// store color
-#else
-		incoming = DotProduct (normal, lightDir);
-		if ( incoming <= 0 )
-        {
-			colors[i][0] = ent->ambientLightRGBA[0];
-            colors[i][1] = ent->ambientLightRGBA[1];
-			colors[i][2] = ent->ambientLightRGBA[2];
-			colors[i][3] = ent->ambientLightRGBA[3];
-
-			continue;
-		}
-
-		int R = (int)( ambientLight[0] + incoming * directedLight[0] );
-		if ( R > 255 ) {
-			R = 255;
-		}
-		colors[i][0] = R;
-
-		int G = (int)( ambientLight[1] + incoming * directedLight[1] );
-		if ( G > 255 ) {
-			G = 255;
-		}
-		colors[i][1] = G;
-
-		int B = (int)( ambientLight[2] + incoming * directedLight[2] );
-		if ( B > 255 ) {
-			B = 255;
-		}
-		colors[i][2] = B;
-
-		colors[i][3] = 255;
-#endif
-	}
+	R_DiffuseColors( colors[0], tess.normal[0], tess.numVertexes,
+		ent->ambientLight, ent->directedLight, ent->lightDir, ent->ambientLightRGBA );
 }
 
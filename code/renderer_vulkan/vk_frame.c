@@ -54,9 +54,17 @@
 
 
 
-VkSemaphore sema_imageAvailable;
-VkSemaphore sema_renderFinished;
-VkFence fence_renderFinished;
+// one per frame in flight, indexed with vk.idx_frame
+static VkSemaphore sema_imageAvailable[MAX_FRAMES_IN_FLIGHT];
+static VkFence fence_renderFinished[MAX_FRAMES_IN_FLIGHT];
+
+// one per swapchain image, indexed with vk.idx_swapchain_image: the
+// present waits on it, and only acquiring the image again tells that
+// the wait is over, the fence of a frame slot doesn't
+static VkSemaphore sema_renderFinished[MAX_SWAPCHAIN_IMAGES];
+
+// msec the CPU spent blocked on the fence of the frame being reused
+static int s_fenceWaitMsec;
 
 /*
    Use of a presentable image must occur only after the image is
@@ -97,8 +105,12 @@ void vk_create_sync_primitives(void)
     // &desc is a pointer to an instance of the VkSemaphoreCreateInfo structure
     // which contains information about how the semaphore is to be created.
     // When created, the semaphore is in the unsignaled state.
-    VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_imageAvailable));
-    VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_renderFinished));
+    uint32_t i;
+    for (i = 0; i < vk.num_frames_in_flight; i++)
+        VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_imageAvailable[i]));
+
+    for (i = 0; i < vk.swapchain_image_count; i++)
+        VK_CHECK(qvkCreateSemaphore(vk.device, &desc, NULL, &sema_renderFinished[i]));
 
 
     VkFenceCreateInfo fence_desc;
@@ -118,7 +130,8 @@ void vk_create_sync_primitives(void)
     // "fence_renderFinished" is a handle in which the resulting
     // fence object is returned.
 
-    VK_CHECK(qvkCreateFence(vk.device, &fence_desc, NULL, &fence_renderFinished));
+    for (i = 0; i < vk.num_frames_in_flight; i++)
+        VK_CHECK(qvkCreateFence(vk.device, &fence_desc, NULL, &fence_renderFinished[i]));
 }
 
 
@@ -127,11 +140,17 @@ void vk_destroy_sync_primitives(void)
 {
     ri.Printf(PRINT_ALL, " Destroy sema_imageAvailable sema_renderFinished fence_renderFinished\n");
 
-    qvkDestroySemaphore(vk.device, sema_imageAvailable, NULL);
-	qvkDestroySemaphore(vk.device, sema_renderFinished, NULL);
+    uint32_t i;
+    for (i = 0; i < vk.num_frames_in_flight; i++)
+    {
+        qvkDestroySemaphore(vk.device, sema_imageAvailable[i], NULL);
+
+        // To destroy a fence, 
+        qvkDestroyFence(vk.device, fence_renderFinished[i], NULL);
+    }
 
-    // To destroy a fence, 
-	qvkDestroyFence(vk.device, fence_renderFinished, NULL);
+    for (i = 0; i < vk.swapchain_image_count; i++)
+        qvkDestroySemaphore(vk.device, sema_renderFinished[i], NULL);
 }
 
 
@@ -246,8 +265,25 @@ static void vk_createRenderPass(VkDevice device)
     // subpasses. Operations right before and right after this subpass also
     // count as inplicit "subpasses".
 
-	desc.dependencyCount = 0;
-	desc.pDependencies = NULL;
+    // With more than one frame in flight consecutive frames share
+    // vk.depth_image, the clear and depth writes of a frame must wait
+    // for the depth writes of the one before. The color output waits
+    // for the swapchain image the way the submit does, the layout
+    // transition from UNDEFINED happens after the acquire then.
+	VkSubpassDependency dependency;
+	dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+	dependency.dstSubpass = 0;
+	dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+		VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+		VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	dependency.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+	dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+		VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+	dependency.dependencyFlags = 0;
+
+	desc.dependencyCount = 1;
+	desc.pDependencies = &dependency;
 
 	VK_CHECK(qvkCreateRenderPass(device, &desc, NULL, &vk.render_pass));
 }
@@ -427,24 +463,6 @@ void vk_destroyFrameBuffers(void)
 
 void vk_begin_frame(void)
 {
-  
-    // An application can acquire use of a presentable image with vkAcquireNextImageKHR. 
-    // After acquiring a presentable image and before modifying it, the application must
-    // use a synchronization primitive to ensure that the presentation engine has 
-    // finished reading from the image. The application can then transition the image's
-    // layout, queue rendering commands to it, etc. Finally, the application presents 
-    // the image with vkQueuePresentKHR, which releases the acquisition of the image.
-
-    // To acquire an available presentable image to use, and retrieve the index of 
-    // that image If timeout is UINT64_MAX, the timeout period is treated as infinite,
-    // and vkAcquireNextImageKHR will block until an image is acquired or an error occurs.
-    
-    // An application must wait until either the semaphore or fence is signaled
-    // before accessing the image's data.
-	VK_CHECK(qvkAcquireNextImageKHR(vk.device, vk.swapchain, UINT64_MAX,
-        sema_imageAvailable, VK_NULL_HANDLE, &vk.idx_swapchain_image));
-
-
     //  User could call method vkWaitForFences to wait for completion. A fence is a 
     //  very heavyweight synchronization primitive as it requires the GPU to flush
     //  all caches at least, and potentially some additional synchronization. Due to
@@ -457,12 +475,35 @@ void vk_begin_frame(void)
     //  the time vkWaitForFences is called, then vkWaitForFences will block and 
     //  wait up to timeout nanoseconds for the condition to become satisfied.
 
-	VK_CHECK(qvkWaitForFences(vk.device, 1, &fence_renderFinished, VK_FALSE, 1e9));
+    //  Only the frame that last used this slot has to be finished, the
+    //  GPU can still be working on the other frames in flight. Its command
+    //  buffer, semaphores and geometry region can be reused after this.
+    int t1 = ri.Milliseconds();
+	VK_CHECK(qvkWaitForFences(vk.device, 1, &fence_renderFinished[vk.idx_frame], VK_FALSE, 1e9));
+    s_fenceWaitMsec = ri.Milliseconds() - t1;
  
     //  To set the state of fences to unsignaled from the host
     //  "1" is the number of fences to reset. 
     //  "fence_renderFinished" is the fence handle to reset.
-	VK_CHECK(qvkResetFences(vk.device, 1, &fence_renderFinished));
+	VK_CHECK(qvkResetFences(vk.device, 1, &fence_renderFinished[vk.idx_frame]));
+
+    vk.command_buffer = vk.frame_cmd_buffers[vk.idx_frame];
+
+    // An application can acquire use of a presentable image with vkAcquireNextImageKHR. 
+    // After acquiring a presentable image and before modifying it, the application must
+    // use a synchronization primitive to ensure that the presentation engine has 
+    // finished reading from the image. The application can then transition the image's
+    // layout, queue rendering commands to it, etc. Finally, the application presents 
+    // the image with vkQueuePresentKHR, which releases the acquisition of the image.
+
+    // To acquire an available presentable image to use, and retrieve the index of 
+    // that image If timeout is UINT64_MAX, the timeout period is treated as infinite,
+    // and vkAcquireNextImageKHR will block until an image is acquired or an error occurs.
+    
+    // An application must wait until either the semaphore or fence is signaled
+    // before accessing the image's data.
+	VK_CHECK(qvkAcquireNextImageKHR(vk.device, vk.swapchain, UINT64_MAX,
+        sema_imageAvailable[vk.idx_frame], VK_NULL_HANDLE, &vk.idx_swapchain_image));
 
     //  commandBuffer must not be in the recording or pending state.
     
@@ -564,14 +605,14 @@ void vk_end_frame(void)
 	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 	submit_info.pNext = NULL;
 	submit_info.waitSemaphoreCount = 1;
-	submit_info.pWaitSemaphores = &sema_imageAvailable;
+	submit_info.pWaitSemaphores = &sema_imageAvailable[vk.idx_frame];
 	submit_info.pWaitDstStageMask = &wait_dst_stage_mask;
 	submit_info.commandBufferCount = 1;
 	submit_info.pCommandBuffers = &vk.command_buffer;
 	submit_info.signalSemaphoreCount = 1;
     // specify which semaphones to signal once the command buffers
     // have finished execution
-	submit_info.pSignalSemaphores = &sema_renderFinished;
+	submit_info.pSignalSemaphores = &sema_renderFinished[vk.idx_swapchain_image];
 
 
     //  queue is the queue that the command buffers will be submitted to.
@@ -612,13 +653,13 @@ void vk_end_frame(void)
        
     //  To submit command buffers to a queue 
     
-    VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, fence_renderFinished));
+    VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, fence_renderFinished[vk.idx_frame]));
 
     VkPresentInfoKHR present_info;
 	present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 	present_info.pNext = NULL;
 	present_info.waitSemaphoreCount = 1;
-	present_info.pWaitSemaphores = &sema_renderFinished;
+	present_info.pWaitSemaphores = &sema_renderFinished[vk.idx_swapchain_image];
 
     // specify the swap chains to present images to
 	present_info.swapchainCount = 1;
@@ -638,6 +679,11 @@ void vk_end_frame(void)
     // queue is a queue that is capable of presentation to the target 
     // surface's platform on the same device as the image's swapchain.
     VkResult result = qvkQueuePresentKHR(vk.queue, &present_info);
+
+    // record the next frame into the next slot while the GPU works on this one,
+    // vk_resetGeometryBuffer picks its geometry region from vk.idx_frame
+    vk.idx_frame = (vk.idx_frame + 1) % vk.num_frames_in_flight;
+
     if(result == VK_SUCCESS)
     {
         return;
@@ -881,3 +927,9 @@ void vk_createSwapChain(VkDevice device, VkSurfaceKHR surface, VkSurfaceFormatKH
         }
     }
 }
+
+
+int vk_getFenceWaitMsec(void)
+{
+    return s_fenceWaitMsec;
+}
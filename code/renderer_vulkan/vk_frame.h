@@ -13,4 +13,6 @@ void vk_createSwapChain(VkDevice device, VkSurfaceKHR surface, VkSurfaceFormatKH
 void vk_create_sync_primitives(void);
 void vk_destroy_sync_primitives(void);
 
+int vk_getFenceWaitMsec(void);
+
 #endif
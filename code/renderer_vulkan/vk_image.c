@@ -754,6 +754,13 @@ void RE_UploadCinematic (int w, int h, int cols, int rows, const unsigned char *
 {
 
     image_t* prtImage = tr.scratchImage[client];
+
+    // earlier frames still in flight may be sampling the image
+    // that is about to be replaced or overwritten
+    if ( dirty || (cols != prtImage->uploadWidth) || (rows != prtImage->uploadHeight) )
+    {
+        VK_CHECK(qvkQueueWaitIdle(vk.queue));
+    }
     
     // if the scratchImage isn't in the format we want, specify it as a new texture
     if ( (cols != prtImage->uploadWidth) || (rows != prtImage->uploadHeight) )
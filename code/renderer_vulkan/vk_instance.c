@@ -4,6 +4,7 @@
 #include "VKimpl.h"
 #include "vk_instance.h"
 #include "tr_globals.h"
+#include "tr_cvar.h"
 #include "vk_image.h"
 #include "vk_instance.h"
 #include "vk_shade_geometry.h"
@@ -11,6 +12,8 @@
 #include "vk_frame.h"
 #include "vk_shaders.h"
 #include "vk_depth_attachment.h"
+#include "../renderercommon/tr_shade_kernels.h"
+#include "../renderercommon/tr_image_kernels.h"
 
 struct Vk_Instance vk;
 
@@ -58,6 +61,7 @@ PFN_vkCmdBindPipeline							qvkCmdBindPipeline;
 PFN_vkCmdBindVertexBuffers						qvkCmdBindVertexBuffers;
 PFN_vkCmdBlitImage								qvkCmdBlitImage;
 PFN_vkCmdClearAttachments						qvkCmdClearAttachments;
+PFN_vkCmdCopyBuffer								qvkCmdCopyBuffer;
 PFN_vkCmdCopyBufferToImage						qvkCmdCopyBufferToImage;
 PFN_vkCmdCopyImage								qvkCmdCopyImage;
 PFN_vkCmdCopyImageToBuffer                      qvkCmdCopyImageToBuffer;
@@ -78,6 +82,7 @@ PFN_vkCreateFramebuffer							qvkCreateFramebuffer;
 PFN_vkCreateGraphicsPipelines					qvkCreateGraphicsPipelines;
 PFN_vkCreateImage								qvkCreateImage;
 PFN_vkCreateImageView							qvkCreateImageView;
+PFN_vkCreatePipelineCache						qvkCreatePipelineCache;
 PFN_vkCreatePipelineLayout						qvkCreatePipelineLayout;
 PFN_vkCreateRenderPass							qvkCreateRenderPass;
 PFN_vkCreateSampler								qvkCreateSampler;
@@ -93,6 +98,7 @@ PFN_vkDestroyFramebuffer						qvkDestroyFramebuffer;
 PFN_vkDestroyImage								qvkDestroyImage;
 PFN_vkDestroyImageView							qvkDestroyImageView;
 PFN_vkDestroyPipeline							qvkDestroyPipeline;
+PFN_vkDestroyPipelineCache						qvkDestroyPipelineCache;
 PFN_vkDestroyPipelineLayout						qvkDestroyPipelineLayout;
 PFN_vkDestroyRenderPass							qvkDestroyRenderPass;
 PFN_vkDestroySampler							qvkDestroySampler;
@@ -107,6 +113,7 @@ PFN_vkGetBufferMemoryRequirements				qvkGetBufferMemoryRequirements;
 PFN_vkGetDeviceQueue							qvkGetDeviceQueue;
 PFN_vkGetImageMemoryRequirements				qvkGetImageMemoryRequirements;
 PFN_vkGetImageSubresourceLayout					qvkGetImageSubresourceLayout;
+PFN_vkGetPipelineCacheData						qvkGetPipelineCacheData;
 PFN_vkMapMemory									qvkMapMemory;
 PFN_vkUnmapMemory                               qvkUnmapMemory;
 PFN_vkQueueSubmit								qvkQueueSubmit;
@@ -649,6 +656,7 @@ static void vk_loadDeviceFunctions(void)
 	INIT_DEVICE_FUNCTION(vkCmdBindVertexBuffers)
 	INIT_DEVICE_FUNCTION(vkCmdBlitImage)
 	INIT_DEVICE_FUNCTION(vkCmdClearAttachments)
+	INIT_DEVICE_FUNCTION(vkCmdCopyBuffer)
 	INIT_DEVICE_FUNCTION(vkCmdCopyBufferToImage)
 	INIT_DEVICE_FUNCTION(vkCmdCopyImage)
     INIT_DEVICE_FUNCTION(vkCmdCopyImageToBuffer)
@@ -669,6 +677,7 @@ static void vk_loadDeviceFunctions(void)
 	INIT_DEVICE_FUNCTION(vkCreateGraphicsPipelines)
 	INIT_DEVICE_FUNCTION(vkCreateImage)
 	INIT_DEVICE_FUNCTION(vkCreateImageView)
+	INIT_DEVICE_FUNCTION(vkCreatePipelineCache)
 	INIT_DEVICE_FUNCTION(vkCreatePipelineLayout)
 	INIT_DEVICE_FUNCTION(vkCreateRenderPass)
 	INIT_DEVICE_FUNCTION(vkCreateSampler)
@@ -684,6 +693,7 @@ static void vk_loadDeviceFunctions(void)
 	INIT_DEVICE_FUNCTION(vkDestroyImage)
 	INIT_DEVICE_FUNCTION(vkDestroyImageView)
 	INIT_DEVICE_FUNCTION(vkDestroyPipeline)
+	INIT_DEVICE_FUNCTION(vkDestroyPipelineCache)
 	INIT_DEVICE_FUNCTION(vkDestroyPipelineLayout)
 	INIT_DEVICE_FUNCTION(vkDestroyRenderPass)
 	INIT_DEVICE_FUNCTION(vkDestroySampler)
@@ -698,6 +708,7 @@ static void vk_loadDeviceFunctions(void)
 	INIT_DEVICE_FUNCTION(vkGetDeviceQueue)
 	INIT_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
 	INIT_DEVICE_FUNCTION(vkGetImageSubresourceLayout)
+	INIT_DEVICE_FUNCTION(vkGetPipelineCacheData)
 	INIT_DEVICE_FUNCTION(vkMapMemory)
 	INIT_DEVICE_FUNCTION(vkUnmapMemory)
 	INIT_DEVICE_FUNCTION(vkQueueSubmit)
@@ -789,6 +800,7 @@ void vk_clearProcAddress(void)
 	qvkCmdBindVertexBuffers						= NULL;
 	qvkCmdBlitImage								= NULL;
 	qvkCmdClearAttachments						= NULL;
+	qvkCmdCopyBuffer							= NULL;
 	qvkCmdCopyBufferToImage						= NULL;
 	qvkCmdCopyImage								= NULL;
     qvkCmdCopyImageToBuffer                     = NULL;
@@ -809,6 +821,7 @@ void vk_clearProcAddress(void)
 	qvkCreateGraphicsPipelines					= NULL;
 	qvkCreateImage								= NULL;
 	qvkCreateImageView							= NULL;
+	qvkCreatePipelineCache						= NULL;
 	qvkCreatePipelineLayout						= NULL;
 	qvkCreateRenderPass							= NULL;
 	qvkCreateSampler							= NULL;
@@ -824,6 +837,7 @@ void vk_clearProcAddress(void)
 	qvkDestroyImage								= NULL;
 	qvkDestroyImageView							= NULL;
 	qvkDestroyPipeline							= NULL;
+	qvkDestroyPipelineCache						= NULL;
 	qvkDestroyPipelineLayout					= NULL;
 	qvkDestroyRenderPass						= NULL;
 	qvkDestroySampler							= NULL;
@@ -838,6 +852,7 @@ void vk_clearProcAddress(void)
 	qvkGetDeviceQueue							= NULL;
 	qvkGetImageMemoryRequirements				= NULL;
 	qvkGetImageSubresourceLayout				= NULL;
+	qvkGetPipelineCacheData						= NULL;
 	qvkMapMemory								= NULL;
     qvkUnmapMemory                              = NULL;
 	qvkQueueSubmit								= NULL;
@@ -950,6 +965,13 @@ void vk_initialize(void)
 	// Swapchain. vk.physical_device required to be init. 
 	vk_createSwapChain(vk.device, vk.surface, vk.surface_format);
 
+    vk.num_frames_in_flight = r_framesInFlight->integer;
+    if ( vk.num_frames_in_flight < 1 )
+        vk.num_frames_in_flight = 1;
+    else if ( vk.num_frames_in_flight > MAX_FRAMES_IN_FLIGHT )
+        vk.num_frames_in_flight = MAX_FRAMES_IN_FLIGHT;
+    vk.idx_frame = 0;
+
 	//
 	// Sync primitives.
 	//
@@ -961,8 +983,14 @@ void vk_initialize(void)
     ri.Printf(PRINT_ALL, " Create command pool: vk.command_pool \n");
     vk_create_command_pool(&vk.command_pool);
     
-    ri.Printf(PRINT_ALL, " Create command buffer: vk.command_buffer \n");
-    vk_create_command_buffer(vk.command_pool, &vk.command_buffer);
+    ri.Printf(PRINT_ALL, " Create command buffers: vk.frame_cmd_buffers, %d frames in flight \n",
+            vk.num_frames_in_flight);
+    {
+        uint32_t i;
+        for (i = 0; i < vk.num_frames_in_flight; i++)
+            vk_create_command_buffer(vk.command_pool, &vk.frame_cmd_buffers[i]);
+    }
+    vk.command_buffer = vk.frame_cmd_buffers[0];
 
     // Depth attachment image.
     vk_createDepthAttachment();
@@ -980,6 +1008,9 @@ void vk_initialize(void)
     
     vk_createPipelineLayout();
 
+    // Pipeline cache, loaded from the previous run if there was one.
+    vk_createPipelineCache();
+
 	//
 	vk_createVertexBuffer();
     vk_createIndexBuffer();;
@@ -1014,12 +1045,14 @@ void vk_shutdown(void)
 
 //
     vk_destroyGlobalStagePipeline();
+
+    vk_destroyPipelineCache();
 //
     // Command buffers will be automatically freed when their
     // command pool is destroyed, so it don't need an explicit 
     // cleanup.
-    ri.Printf( PRINT_ALL, " Free command buffers: vk.command_buffer. \n" );     
-    qvkFreeCommandBuffers(vk.device, vk.command_pool, 1, &vk.command_buffer); 
+    ri.Printf( PRINT_ALL, " Free command buffers: vk.frame_cmd_buffers. \n" );     
+    qvkFreeCommandBuffers(vk.device, vk.command_pool, vk.num_frames_in_flight, vk.frame_cmd_buffers); 
     ri.Printf( PRINT_ALL, " Destroy command pool: vk.command_pool. \n" );
     qvkDestroyCommandPool(vk.device, vk.command_pool, NULL);
 
@@ -1088,6 +1121,8 @@ void vulkanInfo_f( void )
     ri.Printf(PRINT_ALL, "Vk device id: 0x%X\n", props.deviceID);
     ri.Printf(PRINT_ALL, "Vk device type: %s\n", device_type);
     ri.Printf(PRINT_ALL, "Vk device name: %s\n", props.deviceName);
+    ri.Printf(PRINT_ALL, "shade kernels: %s\n", R_ShadeKernelsImplementation());
+    ri.Printf(PRINT_ALL, "image kernels: %s\n", R_ImageKernelsImplementation());
 
 //    ri.Printf(PRINT_ALL, "\n The maximum number of sampler objects,  
 //    as created by vkCreateSampler, which can simultaneously exist on a device is: %d\n", 
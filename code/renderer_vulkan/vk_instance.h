@@ -48,6 +48,7 @@ extern PFN_vkCmdBindPipeline							qvkCmdBindPipeline;
 extern PFN_vkCmdBindVertexBuffers						qvkCmdBindVertexBuffers;
 extern PFN_vkCmdBlitImage								qvkCmdBlitImage;
 extern PFN_vkCmdClearAttachments						qvkCmdClearAttachments;
+extern PFN_vkCmdCopyBuffer								qvkCmdCopyBuffer;
 extern PFN_vkCmdCopyBufferToImage						qvkCmdCopyBufferToImage;
 extern PFN_vkCmdCopyImage								qvkCmdCopyImage;
 extern PFN_vkCmdCopyImageToBuffer                       qvkCmdCopyImageToBuffer;
@@ -68,6 +69,7 @@ extern PFN_vkCreateFramebuffer							qvkCreateFramebuffer;
 extern PFN_vkCreateGraphicsPipelines					qvkCreateGraphicsPipelines;
 extern PFN_vkCreateImage								qvkCreateImage;
 extern PFN_vkCreateImageView							qvkCreateImageView;
+extern PFN_vkCreatePipelineCache						qvkCreatePipelineCache;
 extern PFN_vkCreatePipelineLayout						qvkCreatePipelineLayout;
 extern PFN_vkCreateRenderPass							qvkCreateRenderPass;
 extern PFN_vkCreateSampler								qvkCreateSampler;
@@ -83,6 +85,7 @@ extern PFN_vkDestroyFramebuffer					    	qvkDestroyFramebuffer;
 extern PFN_vkDestroyImage								qvkDestroyImage;
 extern PFN_vkDestroyImageView							qvkDestroyImageView;
 extern PFN_vkDestroyPipeline							qvkDestroyPipeline;
+extern PFN_vkDestroyPipelineCache						qvkDestroyPipelineCache;
 extern PFN_vkDestroyPipelineLayout						qvkDestroyPipelineLayout;
 extern PFN_vkDestroyRenderPass							qvkDestroyRenderPass;
 extern PFN_vkDestroySampler						    	qvkDestroySampler;
@@ -97,6 +100,7 @@ extern PFN_vkGetBufferMemoryRequirements				qvkGetBufferMemoryRequirements;
 extern PFN_vkGetDeviceQueue						    	qvkGetDeviceQueue;
 extern PFN_vkGetImageMemoryRequirements			    	qvkGetImageMemoryRequirements;
 extern PFN_vkGetImageSubresourceLayout					qvkGetImageSubresourceLayout;
+extern PFN_vkGetPipelineCacheData						qvkGetPipelineCacheData;
 extern PFN_vkMapMemory									qvkMapMemory;
 extern PFN_vkUnmapMemory                                qvkUnmapMemory;
 extern PFN_vkQueueSubmit								qvkQueueSubmit;
@@ -143,6 +147,8 @@ const char * cvtResToStr(VkResult result);
 
 
 #define MAX_SWAPCHAIN_IMAGES    8
+// the CPU records up to this many frames ahead of the GPU
+#define MAX_FRAMES_IN_FLIGHT    3
 
 // Vk_Instance contains engine-specific vulkan resources that persist entire renderer lifetime.
 // This structure is initialized/deinitialized by vk_initialize/vk_shutdown functions correspondingly.
@@ -182,7 +188,11 @@ struct Vk_Instance {
 
 
 	VkCommandPool command_pool;
+	// command buffer of the frame being recorded, one of frame_cmd_buffers
 	VkCommandBuffer command_buffer;
+	VkCommandBuffer frame_cmd_buffers[MAX_FRAMES_IN_FLIGHT];
+	uint32_t num_frames_in_flight;
+	uint32_t idx_frame;
 
 	VkImage depth_image;
 	VkDeviceMemory depth_image_memory;
@@ -197,6 +207,9 @@ struct Vk_Instance {
     // Pipeline layout: the uniform and push values referenced by 
     // the shader that can be updated at draw time
 	VkPipelineLayout pipeline_layout;
+
+    // shared by all pipeline creation, persisted across runs
+	VkPipelineCache pipeline_cache;
     
 #ifndef NDEBUG
     VkDebugReportCallbackEXT h_debugCB;
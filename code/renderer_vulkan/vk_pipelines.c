@@ -2,6 +2,7 @@
 #include "vk_instance.h"
 #include "vk_shaders.h"
 #include "vk_pipelines.h"
+#include "tr_cvar.h"
 
 // The graphics pipeline is the sequence of operations that take the vertices
 // and textures of your meshes all the way to the pixels in the render targets
@@ -194,7 +195,9 @@ void vk_createPipelineLayout(void)
 }
 
 
-static void vk_create_pipeline(const struct Vk_Pipeline_Def* def, VkPipeline* pPipeLine)
+// may run on the job threads for vk_prewarmPipelines, which checks
+// the state bits first, so only the main thread gets to the ri.Errors
+static VkResult vk_build_pipeline(const struct Vk_Pipeline_Def* def, VkPipeline* pPipeLine)
 {
 
 	struct Specialization_Data {
@@ -632,16 +635,22 @@ static void vk_create_pipeline(const struct Vk_Pipeline_Def* def, VkPipeline* pP
     // Graphics pipelines consist of multiple shader stages, 
     // multiple fixed-function pipeline stages, and a pipeline layout.
     // To create graphics pipelines
-    // VK_NULL_HANDLE indicating that pipeline caching is disabled; 
-    // TODO: provide the handle of a valid pipeline cache object, 
+    // vk.pipeline_cache lets the driver skip compiling pipelines it has
+    // already seen in this or a previous run, VK_NULL_HANDLE disables it.
     // 1 is the length of the pCreateInfos and pPipelines arrays.
     //
-	VK_CHECK(qvkCreateGraphicsPipelines(vk.device, VK_NULL_HANDLE, 1, &create_info, NULL, pPipeLine));
+	return qvkCreateGraphicsPipelines(vk.device, vk.pipeline_cache, 1, &create_info, NULL, pPipeLine);
+}
+
+
+static void vk_create_pipeline(const struct Vk_Pipeline_Def* def, VkPipeline* pPipeLine)
+{
+	VK_CHECK(vk_build_pipeline(def, pPipeLine));
 }
 
 
 
-static VkPipeline vk_find_pipeline(struct Vk_Pipeline_Def* def)
+static struct Vk_Pipeline_Def* vk_lookup_pipeline(const struct Vk_Pipeline_Def* def)
 {
     uint32_t i = 0;
 	for (i = 0; i < s_numPipelines; i++)
@@ -656,11 +665,21 @@ static VkPipeline vk_find_pipeline(struct Vk_Pipeline_Def* def)
 			// && s_pipeline_defs[i].shadow_phase == def->shadow_phase
             )
 		{
-			return s_pipeline_defs[i].pipeline;
+			return &s_pipeline_defs[i];
 		}
 	}
+	return NULL;
+}
 
 
+static VkPipeline vk_find_pipeline(struct Vk_Pipeline_Def* def)
+{
+	const struct Vk_Pipeline_Def* found = vk_lookup_pipeline(def);
+	if (found)
+	{
+		return found->pipeline;
+	}
+
 	//VkPipeline pipeline;
     vk_create_pipeline(def, &def->pipeline);
     
@@ -888,8 +907,328 @@ void create_standard_pipelines(void)
 }
 
 
+/*
+====================================================================
+
+PIPELINE CACHE
+
+The driver side VkPipelineCache is saved to vkpipelines.cache when
+the renderer shuts down and fed back on the next start, so pipelines
+compiled in an earlier run only cost a cache lookup. Its header holds
+the device UUID and driver version, a driver update or a different
+GPU simply starts with an empty cache.
+
+Independently, the pipeline defs used on a map are written to
+vkpipelines/<map>.defs and created by worker threads when the map
+loads again, before any shader asks for them. Without this the first
+sight of a new stage state would compile a pipeline mid game.
+
+====================================================================
+*/
+
+#include "../renderercommon/tr_jobs.h"
+
+#define PIPELINE_CACHE_FILE     "vkpipelines.cache"
+#define PIPELINE_CACHE_IDENT    (('C'<<24)+('P'<<16)+('K'<<8)+'V')
+#define PIPELINE_DEFS_IDENT     (('D'<<24)+('P'<<16)+('K'<<8)+'V')
+#define PIPELINE_CACHE_VERSION  1
+
+typedef struct {
+	int ident;
+	int version;
+	uint32_t vendorID;
+	uint32_t deviceID;
+	uint32_t driverVersion;
+	uint8_t uuid[VK_UUID_SIZE];
+	uint32_t dataSize;
+} pipelineCacheHeader_t;
+
+// the part of Vk_Pipeline_Def vk_lookup_pipeline compares
+typedef struct {
+	uint32_t state_bits;
+	uint32_t face_culling;
+	uint32_t polygon_offset;
+	uint32_t clipping_plane;
+	uint32_t mirror;
+	uint32_t shader_type;
+} pipelineDefRecord_t;
+
+typedef struct {
+	struct Vk_Pipeline_Def* defs;
+	VkResult* results;
+} pipelineWork_t;
+
+static char s_mapName[MAX_QPATH];
+
+
+static void vk_fillCacheHeader(pipelineCacheHeader_t* header)
+{
+	VkPhysicalDeviceProperties props;
+	qvkGetPhysicalDeviceProperties(vk.physical_device, &props);
+
+	memset(header, 0, sizeof(*header));
+	header->ident = PIPELINE_CACHE_IDENT;
+	header->version = PIPELINE_CACHE_VERSION;
+	header->vendorID = props.vendorID;
+	header->deviceID = props.deviceID;
+	header->driverVersion = props.driverVersion;
+	memcpy(header->uuid, props.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+
+void vk_createPipelineCache(void)
+{
+	VkPipelineCacheCreateInfo desc;
+	pipelineCacheHeader_t expected;
+	unsigned char* buffer = NULL;
+	long len = 0;
+
+	desc.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	desc.pNext = NULL;
+	desc.flags = 0;
+	desc.initialDataSize = 0;
+	desc.pInitialData = NULL;
+
+	if (r_pipelineCache->integer)
+	{
+		len = ri.FS_ReadFile(PIPELINE_CACHE_FILE, (void**)&buffer);
+	}
+
+	if (buffer)
+	{
+		const pipelineCacheHeader_t* header = (const pipelineCacheHeader_t*)buffer;
+
+		vk_fillCacheHeader(&expected);
+
+		if (len < (long)sizeof(*header) || header->dataSize != len - sizeof(*header))
+		{
+			ri.Printf(PRINT_WARNING, "%s is truncated, ignored\n", PIPELINE_CACHE_FILE);
+		}
+		else if (memcmp(header, &expected, offsetof(pipelineCacheHeader_t, dataSize)))
+		{
+			ri.Printf(PRINT_ALL, " %s was written by another device or driver, ignored\n", PIPELINE_CACHE_FILE);
+		}
+		else
+		{
+			desc.initialDataSize = header->dataSize;
+			desc.pInitialData = buffer + sizeof(*header);
+		}
+	}
+
+	ri.Printf(PRINT_ALL, " Create pipeline cache: vk.pipeline_cache, %d bytes loaded \n", (int)desc.initialDataSize);
+
+	// an implementation rejecting the data still returns an empty cache
+	VK_CHECK(qvkCreatePipelineCache(vk.device, &desc, NULL, &vk.pipeline_cache));
+
+	if (buffer)
+	{
+		ri.FS_FreeFile(buffer);
+	}
+}
+
+
+static void vk_savePipelineCache(void)
+{
+	pipelineCacheHeader_t* header;
+	size_t dataSize = 0;
+
+	if (!r_pipelineCache->integer || vk.pipeline_cache == VK_NULL_HANDLE)
+		return;
+
+	VK_CHECK(qvkGetPipelineCacheData(vk.device, vk.pipeline_cache, &dataSize, NULL));
+	if (dataSize == 0)
+		return;
+
+	header = (pipelineCacheHeader_t*)ri.Hunk_AllocateTempMemory(sizeof(*header) + dataSize);
+	vk_fillCacheHeader(header);
+
+	VK_CHECK(qvkGetPipelineCacheData(vk.device, vk.pipeline_cache, &dataSize, header + 1));
+	header->dataSize = dataSize;
+
+	ri.FS_WriteFile(PIPELINE_CACHE_FILE, header, sizeof(*header) + dataSize);
+
+	ri.Hunk_FreeTempMemory(header);
+}
+
+
+void vk_destroyPipelineCache(void)
+{
+	vk_savePipelineCache();
+
+	ri.Printf(PRINT_ALL, " Destroy pipeline cache: vk.pipeline_cache \n");
+	qvkDestroyPipelineCache(vk.device, vk.pipeline_cache, NULL);
+	vk.pipeline_cache = VK_NULL_HANDLE;
+}
+
+
+static void vk_savePipelineDefs(void)
+{
+	pipelineDefRecord_t* records;
+	int* buffer;
+	uint32_t i;
+
+	if (!r_pipelineCache->integer || !s_mapName[0] || s_numPipelines == 0)
+		return;
+
+	buffer = ri.Hunk_AllocateTempMemory(2 * sizeof(int) + s_numPipelines * sizeof(pipelineDefRecord_t));
+	buffer[0] = PIPELINE_DEFS_IDENT;
+	buffer[1] = s_numPipelines;
+	records = (pipelineDefRecord_t*)(buffer + 2);
+
+	for (i = 0; i < s_numPipelines; i++)
+	{
+		records[i].state_bits = s_pipeline_defs[i].state_bits;
+		records[i].face_culling = s_pipeline_defs[i].face_culling;
+		records[i].polygon_offset = s_pipeline_defs[i].polygon_offset;
+		records[i].clipping_plane = s_pipeline_defs[i].clipping_plane;
+		records[i].mirror = s_pipeline_defs[i].mirror;
+		records[i].shader_type = s_pipeline_defs[i].shader_type;
+	}
+
+	ri.FS_WriteFile(va("vkpipelines/%s.defs", s_mapName), buffer,
+		2 * sizeof(int) + s_numPipelines * sizeof(pipelineDefRecord_t));
+
+	ri.Hunk_FreeTempMemory(buffer);
+}
+
+
+static void vk_pipelineJob(void* data, int item, int thread)
+{
+	pipelineWork_t* work = (pipelineWork_t*)data;
+
+	// vkCreateGraphicsPipelines is free threaded and
+	// vk.pipeline_cache synchronizes internally
+	work->results[item] = vk_build_pipeline(&work->defs[item], &work->defs[item].pipeline);
+}
+
+
+// state bits vk_build_pipeline has no ri.Error for
+static qboolean vk_validStateBits(uint32_t stateBits)
+{
+	uint32_t atest = stateBits & GLS_ATEST_BITS;
+	uint32_t srcBlend = stateBits & GLS_SRCBLEND_BITS;
+	uint32_t dstBlend = stateBits & GLS_DSTBLEND_BITS;
+
+	if (atest && atest != GLS_ATEST_GT_0 && atest != GLS_ATEST_LT_80 && atest != GLS_ATEST_GE_80)
+		return qfalse;
+
+	if (srcBlend | dstBlend)
+	{
+		if (srcBlend < GLS_SRCBLEND_ZERO || srcBlend > GLS_SRCBLEND_ALPHA_SATURATE)
+			return qfalse;
+		if (dstBlend < GLS_DSTBLEND_ZERO || dstBlend > GLS_DSTBLEND_ONE_MINUS_DST_ALPHA)
+			return qfalse;
+	}
+
+	return qtrue;
+}
+
+
+/*
+=================
+vk_prewarmPipelines
+
+Called by RE_LoadWorldMap before any map shader is registered
+=================
+*/
+void vk_prewarmPipelines(const char* mapName)
+{
+	const pipelineDefRecord_t* records;
+	struct Vk_Pipeline_Def* defs;
+	VkResult* results;
+	pipelineWork_t work;
+	int* buffer;
+	long len;
+	uint32_t i, numRecords, numDefs, numCreated;
+	int start;
+
+	Q_strncpyz(s_mapName, mapName, sizeof(s_mapName));
+
+	if (!r_pipelineCache->integer)
+		return;
+
+	len = ri.FS_ReadFile(va("vkpipelines/%s.defs", s_mapName), (void**)&buffer);
+	if (!buffer)
+		return;
+
+	numRecords = 0;
+	if (len >= 2 * (long)sizeof(int) && buffer[0] == PIPELINE_DEFS_IDENT)
+		numRecords = buffer[1];
+
+	if (len != 2 * sizeof(int) + numRecords * sizeof(pipelineDefRecord_t))
+	{
+		ri.Printf(PRINT_WARNING, "vk_prewarmPipelines: vkpipelines/%s.defs is invalid\n", s_mapName);
+		ri.FS_FreeFile(buffer);
+		return;
+	}
+
+	start = ri.Milliseconds();
+
+	records = (const pipelineDefRecord_t*)(buffer + 2);
+	defs = ri.Hunk_AllocateTempMemory(numRecords * sizeof(*defs));
+	results = ri.Hunk_AllocateTempMemory(numRecords * sizeof(*results));
+	numDefs = 0;
+
+	for (i = 0; i < numRecords; i++)
+	{
+		struct Vk_Pipeline_Def* def = &defs[numDefs];
+
+		memset(def, 0, sizeof(*def));
+		def->state_bits = records[i].state_bits;
+		def->face_culling = records[i].face_culling;
+		def->polygon_offset = records[i].polygon_offset;
+		def->clipping_plane = records[i].clipping_plane;
+		def->mirror = records[i].mirror;
+		def->shader_type = records[i].shader_type;
+
+		// the job threads must never reach an ri.Error
+		if (def->shader_type > ST_MULTI_TEXURE_ADD || def->face_culling > CT_TWO_SIDED ||
+			!vk_validStateBits(def->state_bits))
+			continue;
+
+		if (vk_lookup_pipeline(def))
+			continue;
+
+		if (s_numPipelines + numDefs >= MAX_VK_PIPELINES / 2)
+			break;
+
+		numDefs++;
+	}
+
+	work.defs = defs;
+	work.results = results;
+	R_RunJobs(vk_pipelineJob, &work, numDefs);
+
+	// failures are reported here, the shaders that need those
+	// pipelines create them again when they are registered
+	numCreated = 0;
+	for (i = 0; i < numDefs; i++)
+	{
+		if (results[i] != VK_SUCCESS)
+		{
+			ri.Printf(PRINT_WARNING, "vk_prewarmPipelines: error %s creating a pipeline\n", cvtResToStr(results[i]));
+			continue;
+		}
+
+		s_pipeline_defs[s_numPipelines++] = defs[i];
+		numCreated++;
+	}
+
+	// temp memory is freed in the reverse order it was taken
+	ri.Hunk_FreeTempMemory(results);
+	ri.Hunk_FreeTempMemory(defs);
+	ri.FS_FreeFile(buffer);
+
+	ri.Printf(PRINT_ALL, " Prewarmed %d pipelines for %s in %d msec\n", numCreated, s_mapName, ri.Milliseconds() - start);
+}
+
+
 void vk_destroyShaderStagePipeline(void)
 {
+    // remember what this map needed for the next time it loads
+    vk_savePipelineDefs();
+    s_mapName[0] = 0;
+
     // shader stage
     qvkDeviceWaitIdle(vk.device);
     uint32_t i;
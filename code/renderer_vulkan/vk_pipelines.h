@@ -6,6 +6,10 @@ void create_standard_pipelines(void);
 void create_pipelines_for_each_stage(shaderStage_t *pStage, shader_t* pShader);
 void vk_createPipelineLayout(void);
 
+void vk_createPipelineCache(void);
+void vk_destroyPipelineCache(void);
+void vk_prewarmPipelines(const char* mapName);
+
 void vk_destroyShaderStagePipeline(void);
 void vk_destroyGlobalStagePipeline(void);
 
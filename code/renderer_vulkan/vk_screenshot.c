@@ -8,6 +8,7 @@
 #include "../renderercommon/ref_import.h"
 
 #include "R_ImageJPG.h"
+#include "../renderercommon/tr_capture.h"
 
 /* 
 ============================================================================== 
@@ -537,74 +538,220 @@ void R_ScreenShotJPEG_f(void)
 
 
 
-void RB_TakeVideoFrameCmd( const videoFrameCommand_t * const cmd )
+/*
+Video frames are copied into a ring of host visible buffers that stay
+mapped. The copy is submitted without waiting for it, a frame is only
+looked at when the ring comes around to it again, so the GPU isn't
+drained every frame like vk_read_pixels does. The frames are converted
+and compressed on the capture threads, see tr_capture.c.
+*/
+#define NUM_VIDEO_STAGING	3
+
+typedef struct {
+    VkBuffer buffer;
+    VkDeviceMemory memory;
+    const unsigned char* pixels;
+    VkCommandBuffer cmdBuf;
+    VkFence fence;
+    qboolean motionJpeg;
+} videoStaging_t;
+
+static videoStaging_t videoStaging[NUM_VIDEO_STAGING];
+static captureFormat_t videoStagingFormat;
+static int videoStagingFirst; // oldest frame not captured yet
+static int videoStagingCount;
+
+
+static void vk_createVideoStaging(const captureFormat_t* format)
 {
+    uint32_t i;
 
-	size_t				memcount, linelen;
-	int				padwidth, avipadwidth, padlen;
-	
+    videoStagingFormat = *format;
 
-	linelen = cmd->width * 3;
+    for (i = 0; i < NUM_VIDEO_STAGING; i++)
+    {
+        videoStaging_t* v = &videoStaging[i];
 
-	// Alignment stuff for glReadPixels
-	padwidth = PAD(linelen, 4);
-	padlen = padwidth - linelen;
-	// AVI line padding
-	avipadwidth = PAD(linelen, 4);
+        VkBufferCreateInfo buffer_create_info;
+        memset(&buffer_create_info, 0, sizeof(buffer_create_info));
+        buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_create_info.size = format->stride * format->height;
+        buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        VK_CHECK( qvkCreateBuffer(vk.device, &buffer_create_info, NULL, &v->buffer) );
 
-		
-    unsigned char* const pImg = (unsigned char*) malloc ( cmd->width * cmd->height * 4);
-    
-    vk_read_pixels(pImg);
+        VkMemoryRequirements memory_requirements;
+        qvkGetBufferMemoryRequirements(vk.device, v->buffer, &memory_requirements);
 
-    imgFlipY(pImg, cmd->width, cmd->height);
+        VkMemoryAllocateInfo memory_allocate_info;
+        memset(&memory_allocate_info, 0, sizeof(memory_allocate_info));
+        memory_allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memory_allocate_info.allocationSize = memory_requirements.size;
+        memory_allocate_info.memoryTypeIndex = find_memory_type(memory_requirements.memoryTypeBits,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-	memcount = padwidth * cmd->height;
+        VK_CHECK( qvkAllocateMemory(vk.device, &memory_allocate_info, NULL, &v->memory) );
+        VK_CHECK( qvkBindBufferMemory(vk.device, v->buffer, v->memory, 0) );
+
+        void* data;
+        VK_CHECK( qvkMapMemory(vk.device, v->memory, 0, VK_WHOLE_SIZE, 0, &data) );
+        v->pixels = data;
+
+        VkCommandBufferAllocateInfo alloc_info;
+        alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.pNext = NULL;
+        alloc_info.commandPool = vk.command_pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        VK_CHECK( qvkAllocateCommandBuffers(vk.device, &alloc_info, &v->cmdBuf) );
+
+        VkFenceCreateInfo fence_desc;
+        fence_desc.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fence_desc.pNext = NULL;
+        fence_desc.flags = 0;
+        VK_CHECK( qvkCreateFence(vk.device, &fence_desc, NULL, &v->fence) );
+    }
 
+    videoStagingFirst = 0;
+    videoStagingCount = 0;
+}
 
-	if(cmd->motionJpeg)
-	{
 
-        const uint32_t cnPixels = cmd->width * cmd->height;
-        unsigned char* pSrc = pImg;
-        const unsigned char* pDst = pImg;
+// hands the oldest frame in the ring to the capture threads
+static void vk_captureVideoStaging(void)
+{
+    videoStaging_t* v = &videoStaging[videoStagingFirst];
 
-        uint32_t i;
-        for (i = 0; i < cnPixels; i++)
-        {
-            pSrc[0] = pDst[2];
-            pSrc[1] = pDst[1];
-            pSrc[2] = pDst[0];
-            pSrc += 3;
-            pDst += 4;
-        }
+    VK_CHECK( qvkWaitForFences(vk.device, 1, &v->fence, VK_TRUE, UINT64_MAX) );
+    VK_CHECK( qvkResetFences(vk.device, 1, &v->fence) );
 
-        
-		memcount = RE_SaveJPGToBuffer(cmd->encodeBuffer, linelen * cmd->height,
-			90,	cmd->width, cmd->height, pImg, padlen);
-        
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, memcount);
-	}
-	else
-	{
+    R_CaptureFrame(v->pixels, &videoStagingFormat, NULL, v->motionJpeg, 90);
 
-        unsigned char* buffer_ptr = cmd->encodeBuffer;
-        const unsigned char* buffer2_ptr = pImg;
+    videoStagingFirst = (videoStagingFirst + 1) % NUM_VIDEO_STAGING;
+    videoStagingCount--;
+}
 
-        uint32_t i;
-        for (i = 0; i < cmd->width * cmd->height; i++)
-        {
-            buffer_ptr[0] = buffer2_ptr[0];
-            buffer_ptr[1] = buffer2_ptr[1];
-            buffer_ptr[2] = buffer2_ptr[2];
-            buffer_ptr += 3;
-            buffer2_ptr += 4;
-        }
 
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, avipadwidth * cmd->height);
-	}
+void RE_FinishVideoFrames(void)
+{
+    while (videoStagingCount)
+        vk_captureVideoStaging();
+
+    R_FinishCapture();
+}
+
+
+void vk_destroyVideoStaging(void)
+{
+    uint32_t i;
+
+    RE_FinishVideoFrames();
+
+    if (videoStaging[0].buffer == VK_NULL_HANDLE)
+        return;
+
+    for (i = 0; i < NUM_VIDEO_STAGING; i++)
+    {
+        videoStaging_t* v = &videoStaging[i];
+
+        qvkDestroyFence(vk.device, v->fence, NULL);
+        qvkFreeCommandBuffers(vk.device, vk.command_pool, 1, &v->cmdBuf);
+        qvkUnmapMemory(vk.device, v->memory);
+        qvkFreeMemory(vk.device, v->memory, NULL);
+        qvkDestroyBuffer(vk.device, v->buffer, NULL);
+    }
+
+    memset(videoStaging, 0, sizeof(videoStaging));
+}
+
+
+void RB_TakeVideoFrameCmd( const videoFrameCommand_t * const cmd )
+{
+    captureFormat_t format;
 
+    // the swapchain image is BGRA and top down
+    format.width = cmd->width;
+    format.height = cmd->height;
+    format.stride = cmd->width * 4;
+    format.bytesPerPixel = 4;
+    format.bgr = qtrue;
+    format.topDown = qtrue;
 
-    free(pImg);
+    if ( (videoStaging[0].buffer != VK_NULL_HANDLE) && memcmp(&format, &videoStagingFormat, sizeof(format)) )
+        vk_destroyVideoStaging();
+
+    if (videoStaging[0].buffer == VK_NULL_HANDLE)
+        vk_createVideoStaging(&format);
+
+    // make room for this one
+    if (videoStagingCount == NUM_VIDEO_STAGING)
+        vk_captureVideoStaging();
+
+    videoStaging_t* v = &videoStaging[(videoStagingFirst + videoStagingCount) % NUM_VIDEO_STAGING];
+
+    VkBufferImageCopy image_copy;
+    memset(&image_copy, 0, sizeof(image_copy));
+    image_copy.bufferRowLength = cmd->width;
+    image_copy.bufferImageHeight = cmd->height;
+    image_copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    image_copy.imageSubresource.layerCount = 1;
+    image_copy.imageExtent.width = cmd->width;
+    image_copy.imageExtent.height = cmd->height;
+    image_copy.imageExtent.depth = 1;
+
+    // same transition as vk_read_pixels, and back again for the next present
+    VkImageMemoryBarrier image_barrier;
+    image_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    image_barrier.pNext = NULL;
+    image_barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT;
+    image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.image = vk.swapchain_images_array[vk.idx_swapchain_image];
+    image_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    image_barrier.subresourceRange.baseMipLevel = 0;
+    image_barrier.subresourceRange.levelCount = 1;
+    image_barrier.subresourceRange.baseArrayLayer = 0;
+    image_barrier.subresourceRange.layerCount = 1;
+
+    VkBufferMemoryBarrier buffer_barrier;
+    buffer_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    buffer_barrier.pNext = NULL;
+    buffer_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    buffer_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    buffer_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    buffer_barrier.buffer = v->buffer;
+    buffer_barrier.offset = 0;
+    buffer_barrier.size = VK_WHOLE_SIZE;
+
+    VkCommandBufferBeginInfo begin_info;
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.pNext = NULL;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    begin_info.pInheritanceInfo = NULL;
+    VK_CHECK(qvkBeginCommandBuffer(v->cmdBuf, &begin_info));
+
+    qvkCmdPipelineBarrier(v->cmdBuf, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, NULL, 0, NULL, 1, &image_barrier);
+    qvkCmdCopyImageToBuffer(v->cmdBuf, image_barrier.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, v->buffer, 1, &image_copy);
+
+    image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    image_barrier.dstAccessMask = 0;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    qvkCmdPipelineBarrier(v->cmdBuf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+            0, 0, NULL, 1, &buffer_barrier, 1, &image_barrier);
+
+    VK_CHECK(qvkEndCommandBuffer(v->cmdBuf));
+
+    VkSubmitInfo submit_info;
+    memset(&submit_info, 0, sizeof(submit_info));
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &v->cmdBuf;
+    VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, v->fence));
 
+    v->motionJpeg = cmd->motionJpeg;
+    videoStagingCount++;
 }
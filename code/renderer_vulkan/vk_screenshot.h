@@ -10,6 +10,8 @@ void R_ScreenShot_f( void );
 void RB_TakeScreenshot(const char *fileName, int width, int height, VkBool32 isJpeg);
 
 void RB_TakeVideoFrameCmd( const videoFrameCommand_t * const cmd );
+void RE_FinishVideoFrames( void );
+void vk_destroyVideoStaging( void );
 
 void RE_TakeVideoFrame( int width, int height, unsigned char *captureBuffer, unsigned char *encodeBuffer, qboolean motionJpeg );
 #endif
@@ -4,6 +4,7 @@
 #include "tr_cvar.h"
 #include "vk_image.h"
 #include "vk_pipelines.h"
+#include "vk_world_geometry.h"
 #include "../renderercommon/matrix_multiplication.h"
 
 
@@ -20,6 +21,10 @@
 #define ST0_OFFSET          (COLOR_OFFSET + COLOR_SIZE)
 #define ST1_OFFSET          (ST0_OFFSET + ST0_SIZE)
 
+// each frame in flight writes its geometry into its own region
+// of the vertex and index buffers
+#define VERTEX_REGION_SIZE  (XYZ_SIZE + COLOR_SIZE + ST0_SIZE + ST1_SIZE)
+
 struct ShadingData_t
 {
     // Buffers represent linear arrays of data which are used for various purposes
@@ -35,6 +40,10 @@ struct ShadingData_t
 	unsigned char* index_buffer_ptr; // pointer to mapped index buffer
 	uint32_t index_buffer_offset;
 
+	// start of the current frame's region in vertex_buffer and index_buffer
+	VkDeviceSize vertex_region;
+	VkDeviceSize index_region;
+
 	// host visible memory that holds both vertex and index data
 	VkDeviceMemory vertex_buffer_memory;
 	VkDeviceMemory index_buffer_memory;
@@ -272,7 +281,7 @@ void vk_createVertexBuffer(void)
     desc.queueFamilyIndexCount = 0;
     desc.pQueueFamilyIndices = NULL;
     //VERTEX_BUFFER_SIZE
-    desc.size = XYZ_SIZE + COLOR_SIZE + ST0_SIZE + ST1_SIZE;
+    desc.size = VERTEX_REGION_SIZE * vk.num_frames_in_flight;
     desc.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
     
     VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, &shadingDat.vertex_buffer));
@@ -323,7 +332,7 @@ void vk_createIndexBuffer(void)
     desc.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     desc.queueFamilyIndexCount = 0;
     desc.pQueueFamilyIndices = NULL;
-    desc.size = INDEX_BUFFER_SIZE;
+    desc.size = INDEX_BUFFER_SIZE * vk.num_frames_in_flight;
     desc.usage = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
 
     VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, &shadingDat.index_buffer));
@@ -397,9 +406,9 @@ void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth
 	// configure vertex data stream
 	VkBuffer bufs[3] = { shadingDat.vertex_buffer, shadingDat.vertex_buffer, shadingDat.vertex_buffer };
 	VkDeviceSize offs[3] = {
-		COLOR_OFFSET + shadingDat.color_st_elements * sizeof(color4ub_t),
-		ST0_OFFSET   + shadingDat.color_st_elements * sizeof(vec2_t),
-		ST1_OFFSET   + shadingDat.color_st_elements * sizeof(vec2_t)
+		shadingDat.vertex_region + COLOR_OFFSET + shadingDat.color_st_elements * sizeof(color4ub_t),
+		shadingDat.vertex_region + ST0_OFFSET   + shadingDat.color_st_elements * sizeof(vec2_t),
+		shadingDat.vertex_region + ST1_OFFSET   + shadingDat.color_st_elements * sizeof(vec2_t)
 	};
 
 
@@ -425,6 +434,18 @@ void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth
 	qvkCmdBindVertexBuffers(vk.command_buffer, 1, multitexture ? 3 : 2, bufs, offs);
 	shadingDat.color_st_elements += tess.numVertexes;
 
+	vk_set_shade_state(pipeline, multitexture, depth_range);
+
+	// issue draw call
+	if (indexed)
+		qvkCmdDrawIndexed(vk.command_buffer, tess.numIndexes, 1, 0, 0, 0);
+	else
+		qvkCmdDraw(vk.command_buffer, tess.numVertexes, 1, 0, 0);
+}
+
+
+void vk_set_shade_state(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depth_range)
+{
 	// bind descriptor sets
 
 //    vkCmdBindDescriptorSets causes the sets numbered [firstSet.. firstSet+descriptorSetCount-1] to use
@@ -449,13 +470,6 @@ void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth
 		qvkCmdSetDepthBias(vk.command_buffer, r_offsetUnits->value, 0.0f, r_offsetFactor->value);
 	}
 
-	// issue draw call
-	if (indexed)
-		qvkCmdDrawIndexed(vk.command_buffer, tess.numIndexes, 1, 0, 0, 0);
-	else
-		qvkCmdDraw(vk.command_buffer, tess.numVertexes, 1, 0, 0);
-
-	
     shadingDat.s_depth_attachment_dirty = VK_TRUE;
 }
 
@@ -465,7 +479,7 @@ void vk_bind_geometry2(float modelviewMat4x4[16])
 
 	// xyz stream
 	{
-        const VkDeviceSize xyz_offset = XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
+        const VkDeviceSize xyz_offset = shadingDat.vertex_region + XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
 		unsigned char* dst = shadingDat.vertex_buffer_ptr + xyz_offset;
 		memcpy(dst, tess.xyz, tess.numVertexes * sizeof(vec4_t));
 
@@ -480,10 +494,11 @@ void vk_bind_geometry2(float modelviewMat4x4[16])
 	{
 		const uint32_t indexes_size = tess.numIndexes * sizeof(uint32_t);        
 
-		unsigned char* dst = shadingDat.index_buffer_ptr + shadingDat.index_buffer_offset;
+		const VkDeviceSize index_offset = shadingDat.index_region + shadingDat.index_buffer_offset;
+		unsigned char* dst = shadingDat.index_buffer_ptr + index_offset;
 		memcpy(dst, tess.indexes, indexes_size);
 
-		qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.index_buffer, shadingDat.index_buffer_offset, VK_INDEX_TYPE_UINT32);
+		qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.index_buffer, index_offset, VK_INDEX_TYPE_UINT32);
 		shadingDat.index_buffer_offset += indexes_size;
 
         assert (shadingDat.index_buffer_offset < INDEX_BUFFER_SIZE);
@@ -529,7 +544,7 @@ void vk_bind_geometry(void)
 
 	// xyz stream
 	{
-        const VkDeviceSize xyz_offset = XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
+        const VkDeviceSize xyz_offset = shadingDat.vertex_region + XYZ_OFFSET + shadingDat.xyz_elements * sizeof(vec4_t);
 		unsigned char* dst = shadingDat.vertex_buffer_ptr + xyz_offset;
 		memcpy(dst, tess.xyz, tess.numVertexes * sizeof(vec4_t));
 
@@ -544,17 +559,22 @@ void vk_bind_geometry(void)
 	{
 		const uint32_t indexes_size = tess.numIndexes * sizeof(uint32_t);        
 
-		unsigned char* dst = shadingDat.index_buffer_ptr + shadingDat.index_buffer_offset;
+		const VkDeviceSize index_offset = shadingDat.index_region + shadingDat.index_buffer_offset;
+		unsigned char* dst = shadingDat.index_buffer_ptr + index_offset;
 		memcpy(dst, tess.indexes, indexes_size);
 
-		qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.index_buffer, shadingDat.index_buffer_offset, VK_INDEX_TYPE_UINT32);
+		qvkCmdBindIndexBuffer(vk.command_buffer, shadingDat.index_buffer, index_offset, VK_INDEX_TYPE_UINT32);
 		shadingDat.index_buffer_offset += indexes_size;
 
         assert (shadingDat.index_buffer_offset < INDEX_BUFFER_SIZE);
 	}
 
+    vk_push_transform();
+}
 
 
+void vk_push_transform(void)
+{
 	if (backEnd.viewParms.isPortal)
     {
 
@@ -663,6 +683,11 @@ void vk_resetGeometryBuffer(void)
 	shadingDat.index_buffer_offset = 0;
     shadingDat.s_depth_attachment_dirty = VK_FALSE;
 
+    // the previous user of this region has finished once
+    // vk_begin_frame has waited on its fence
+    shadingDat.vertex_region = (VkDeviceSize)vk.idx_frame * VERTEX_REGION_SIZE;
+    shadingDat.index_region = (VkDeviceSize)vk.idx_frame * INDEX_BUFFER_SIZE;
+
     Mat4Identity(s_modelview_matrix);
 }
 
@@ -1229,18 +1254,23 @@ static void RB_FogPass( void ) {
 }
 
 
-void RB_StageIteratorGeneric( void )
+void vk_compute_stage_vertexes( shaderStage_t *pStage )
 {
-//	shaderCommands_t *input = &tess;
+	ComputeColors( pStage );
+	ComputeTexCoords( pStage );
+}
 
-	RB_DeformTessGeometry();
 
-	// call shader function
-	//
-	// VULKAN
+/*
+================
+RB_IterateStages
 
-	vk_bind_geometry();
-    
+Draws every stage of tess.shader, either from the streamed tess
+geometry or from the static world buffers
+================
+*/
+static void RB_IterateStages( VkBool32 staticWorld )
+{
     uint32_t stage = 0;
 
 	for ( stage = 0; stage < MAX_SHADER_STAGES; ++stage )
@@ -1250,8 +1280,11 @@ void RB_StageIteratorGeneric( void )
 			break;
 		}
 
-		ComputeColors( tess.xstages[stage] );
-		ComputeTexCoords( tess.xstages[stage] );
+		if ( !staticWorld )
+		{
+			ComputeColors( tess.xstages[stage] );
+			ComputeTexCoords( tess.xstages[stage] );
+		}
 
         // base
         // set state
@@ -1351,17 +1384,23 @@ END_ANIMA2:
         }
  
         
+        VkPipeline pipeline = tess.xstages[stage]->vk_pipeline;
         if (backEnd.viewParms.isMirror)
         {
-            vk_shade_geometry(tess.xstages[stage]->vk_mirror_pipeline, multitexture, depth_range, VK_TRUE);
+            pipeline = tess.xstages[stage]->vk_mirror_pipeline;
         }
         else if (backEnd.viewParms.isPortal)
         {
-            vk_shade_geometry(tess.xstages[stage]->vk_portal_pipeline, multitexture, depth_range, VK_TRUE);
+            pipeline = tess.xstages[stage]->vk_portal_pipeline;
+        }
+
+        if (staticWorld)
+        {
+            vk_shadeWorldGeometry(stage, pipeline, multitexture, depth_range);
         }
         else
         {
-            vk_shade_geometry(tess.xstages[stage]->vk_pipeline, multitexture, depth_range, VK_TRUE);
+            vk_shade_geometry(pipeline, multitexture, depth_range, VK_TRUE);
         }
 
                 
@@ -1371,6 +1410,34 @@ END_ANIMA2:
 			break;
 		}
 	}
+}
+
+
+void RB_StageIteratorGeneric( void )
+{
+	// surfaces already in the world buffers,
+	// they never need dlights, fog or deforms
+	if ( vk_numQueuedWorldSurfaces() )
+	{
+		vk_bindWorldGeometry();
+		RB_IterateStages( VK_TRUE );
+		vk_clearWorldSurfaceQueue();
+	}
+
+	if ( tess.numIndexes == 0 )
+	{
+		return;
+	}
+
+	RB_DeformTessGeometry();
+
+	// call shader function
+	//
+	// VULKAN
+
+	vk_bind_geometry();
+
+	RB_IterateStages( VK_FALSE );
 
 	// 
 	// now do any dynamic lighting needed
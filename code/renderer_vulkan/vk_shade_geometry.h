@@ -18,7 +18,9 @@ void R_SetupProjection( float pMatProj[16] );
 
 
 void vk_shade_geometry(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depth_range, VkBool32 indexed);
+void vk_set_shade_state(VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depth_range);
 void vk_bind_geometry(void);
+void vk_push_transform(void);
 void vk_bind_geometry2(float modelviewMat4x4[16]);
 
 void vk_resetGeometryBuffer(void);
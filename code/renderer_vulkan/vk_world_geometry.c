@@ -0,0 +1,576 @@
+#include "vk_world_geometry.h"
+#include "vk_instance.h"
+#include "vk_image.h"
+#include "tr_globals.h"
+#include "tr_cvar.h"
+#include "../renderercommon/ref_import.h"
+
+// Static world geometry
+//
+// BSP faces and triangle soups whose shader output depends only on
+// the vertex data are tessellated once when the map is loaded. Their
+// positions, the colors and texture coordinates of every shader stage
+// and the indexes go into device local buffers, so drawing them is
+// just binding offsets and issuing indexed draws. Everything else
+// (grids, entities, deforms, waves, tcMods, fogged and dlighted
+// surfaces) keeps going through tess and the streamed buffers.
+//
+// The vertexes of all surfaces that share a shader are contiguous,
+// the indexes are relative to the start of that block.
+
+#define MAX_QUEUED_WORLD_SURFACES   4096
+
+typedef struct {
+	// byte offsets in the world vertex buffer
+	VkDeviceSize xyz;
+	VkDeviceSize color[MAX_SHADER_STAGES];
+	VkDeviceSize st0[MAX_SHADER_STAGES];
+	VkDeviceSize st1[MAX_SHADER_STAGES];
+
+	uint32_t numVerts;
+	uint32_t numIndexes;
+	uint32_t firstIndex;
+
+	// fill cursors while building
+	uint32_t curVert;
+	uint32_t curIndex;
+} vkWorldShader_t;
+
+typedef struct {
+	uint32_t firstIndex;
+	uint32_t numIndexes;
+} vkWorldDraw_t;
+
+static struct {
+	VkBuffer vertex_buffer;
+	VkDeviceMemory vertex_buffer_memory;
+	VkBuffer index_buffer;
+	VkDeviceMemory index_buffer_memory;
+
+	// indexed by shader_t->index, NULL for streamed shaders
+	vkWorldShader_t** shaders;
+	int numShaders;
+
+	vkWorldDraw_t queue[MAX_QUEUED_WORLD_SURFACES];
+	uint32_t numQueued;
+} s_world;
+
+
+static qboolean IsStaticStage(const shaderStage_t* pStage)
+{
+	uint32_t b;
+
+	switch (pStage->rgbGen)
+	{
+		case CGEN_IDENTITY:
+		case CGEN_IDENTITY_LIGHTING:
+		case CGEN_EXACT_VERTEX:
+		case CGEN_CONST:
+		case CGEN_VERTEX:
+		case CGEN_ONE_MINUS_VERTEX:
+			break;
+		default:
+			return qfalse;
+	}
+
+	switch (pStage->alphaGen)
+	{
+		case AGEN_SKIP:
+		case AGEN_IDENTITY:
+		case AGEN_CONST:
+		case AGEN_VERTEX:
+		case AGEN_ONE_MINUS_VERTEX:
+			break;
+		default:
+			return qfalse;
+	}
+
+	for (b = 0; b < NUM_TEXTURE_BUNDLES; b++)
+	{
+		switch (pStage->bundle[b].tcGen)
+		{
+			case TCGEN_BAD:
+			case TCGEN_IDENTITY:
+			case TCGEN_TEXTURE:
+			case TCGEN_LIGHTMAP:
+			case TCGEN_VECTOR:
+				break;
+			default:
+				return qfalse;
+		}
+
+		if (pStage->bundle[b].numTexMods > 0)
+			return qfalse;
+	}
+
+	return qtrue;
+}
+
+
+static qboolean IsStaticShader(const shader_t* sh)
+{
+	uint32_t stage;
+
+	if (sh->isSky || sh->numDeforms || sh->sort == SS_PORTAL || sh->remappedShader)
+		return qfalse;
+
+	if (sh->stages[0] == NULL)
+		return qfalse;
+
+	for (stage = 0; stage < MAX_SHADER_STAGES && sh->stages[stage]; stage++)
+	{
+		if (!IsStaticStage(sh->stages[stage]))
+			return qfalse;
+	}
+
+	return qtrue;
+}
+
+
+static qboolean SurfaceSize(const msurface_t* surf, uint32_t* numVerts, uint32_t* numIndexes)
+{
+	switch (*surf->data)
+	{
+		case SF_FACE:
+		{
+			const srfSurfaceFace_t* face = (const srfSurfaceFace_t*)surf->data;
+			*numVerts = face->numPoints;
+			*numIndexes = face->numIndices;
+		} break;
+
+		case SF_TRIANGLES:
+		{
+			const srfTriangles_t* tri = (const srfTriangles_t*)surf->data;
+			*numVerts = tri->numVerts;
+			*numIndexes = tri->numIndexes;
+		} break;
+
+		default:
+			return qfalse;
+	}
+
+	// has to fit into tess without an overflow flush
+	return (*numVerts > 0 && *numVerts < SHADER_MAX_VERTEXES && *numIndexes < SHADER_MAX_INDEXES);
+}
+
+
+static void SetWorldFirstIndex(msurface_t* surf, int firstIndex)
+{
+	if (*surf->data == SF_FACE)
+		((srfSurfaceFace_t*)surf->data)->worldFirstIndex = firstIndex;
+	else if (*surf->data == SF_TRIANGLES)
+		((srfTriangles_t*)surf->data)->worldFirstIndex = firstIndex;
+}
+
+
+static void vk_createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
+		VkBuffer* pBuf, VkDeviceMemory* pMem)
+{
+	VkBufferCreateInfo desc;
+	desc.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	desc.pNext = NULL;
+	desc.flags = 0;
+	desc.size = size;
+	desc.usage = usage;
+	desc.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+	desc.queueFamilyIndexCount = 0;
+	desc.pQueueFamilyIndices = NULL;
+
+	VK_CHECK(qvkCreateBuffer(vk.device, &desc, NULL, pBuf));
+
+	VkMemoryRequirements memory_requirements;
+	qvkGetBufferMemoryRequirements(vk.device, *pBuf, &memory_requirements);
+
+	VkMemoryAllocateInfo alloc_info;
+	alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	alloc_info.pNext = NULL;
+	alloc_info.allocationSize = memory_requirements.size;
+	alloc_info.memoryTypeIndex = find_memory_type(memory_requirements.memoryTypeBits, properties);
+
+	VK_CHECK(qvkAllocateMemory(vk.device, &alloc_info, NULL, pMem));
+	VK_CHECK(qvkBindBufferMemory(vk.device, *pBuf, *pMem, 0));
+}
+
+
+static void vk_copyStagingToWorldBuffers(VkBuffer staging, VkDeviceSize vertexSize, VkDeviceSize indexSize)
+{
+	VkCommandBuffer cmd_buf;
+
+	VkCommandBufferAllocateInfo alloc_info;
+	alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+	alloc_info.pNext = NULL;
+	alloc_info.commandPool = vk.command_pool;
+	alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+	alloc_info.commandBufferCount = 1;
+	VK_CHECK(qvkAllocateCommandBuffers(vk.device, &alloc_info, &cmd_buf));
+
+	VkCommandBufferBeginInfo begin_info;
+	begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	begin_info.pNext = NULL;
+	begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	begin_info.pInheritanceInfo = NULL;
+	VK_CHECK(qvkBeginCommandBuffer(cmd_buf, &begin_info));
+
+	VkBufferCopy region;
+	region.srcOffset = 0;
+	region.dstOffset = 0;
+	region.size = vertexSize;
+	qvkCmdCopyBuffer(cmd_buf, staging, s_world.vertex_buffer, 1, &region);
+
+	region.srcOffset = vertexSize;
+	region.size = indexSize;
+	qvkCmdCopyBuffer(cmd_buf, staging, s_world.index_buffer, 1, &region);
+
+	VK_CHECK(qvkEndCommandBuffer(cmd_buf));
+
+	VkSubmitInfo submit_info;
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = NULL;
+	submit_info.waitSemaphoreCount = 0;
+	submit_info.pWaitSemaphores = NULL;
+	submit_info.pWaitDstStageMask = NULL;
+	submit_info.commandBufferCount = 1;
+	submit_info.pCommandBuffers = &cmd_buf;
+	submit_info.signalSemaphoreCount = 0;
+	submit_info.pSignalSemaphores = NULL;
+
+	// the copy finishes before any frame can use the buffers
+	VK_CHECK(qvkQueueSubmit(vk.queue, 1, &submit_info, VK_NULL_HANDLE));
+	VK_CHECK(qvkQueueWaitIdle(vk.queue));
+
+	qvkFreeCommandBuffers(vk.device, vk.command_pool, 1, &cmd_buf);
+}
+
+
+static void FillWorldSurface(msurface_t* surf, vkWorldShader_t* ws, unsigned char* vertexes, uint32_t* indexes)
+{
+	const shader_t* sh = surf->shader;
+	uint32_t stage;
+	int i;
+
+	// let the regular surface code tessellate it
+	RB_BeginSurface(surf->shader, 0);
+	rb_surfaceTable[*surf->data](surf->data);
+
+	for (i = 0; i < tess.numVertexes; i++)
+	{
+		memcpy(vertexes + ws->xyz + (ws->curVert + i) * sizeof(vec4_t), tess.xyz[i], sizeof(vec4_t));
+	}
+
+	for (stage = 0; stage < MAX_SHADER_STAGES && sh->stages[stage]; stage++)
+	{
+		vk_compute_stage_vertexes(sh->stages[stage]);
+
+		memcpy(vertexes + ws->color[stage] + ws->curVert * sizeof(color4ub_t),
+			tess.svars.colors, tess.numVertexes * sizeof(color4ub_t));
+		memcpy(vertexes + ws->st0[stage] + ws->curVert * sizeof(vec2_t),
+			tess.svars.texcoords[0], tess.numVertexes * sizeof(vec2_t));
+
+		if (sh->stages[stage]->bundle[1].image[0] != NULL)
+		{
+			memcpy(vertexes + ws->st1[stage] + ws->curVert * sizeof(vec2_t),
+				tess.svars.texcoords[1], tess.numVertexes * sizeof(vec2_t));
+		}
+	}
+
+	for (i = 0; i < tess.numIndexes; i++)
+	{
+		indexes[ws->firstIndex + ws->curIndex + i] = ws->curVert + tess.indexes[i];
+	}
+
+	SetWorldFirstIndex(surf, ws->firstIndex + ws->curIndex);
+
+	ws->curVert += tess.numVertexes;
+	ws->curIndex += tess.numIndexes;
+
+	tess.numVertexes = 0;
+	tess.numIndexes = 0;
+}
+
+
+/*
+=================
+vk_createWorldGeometry
+
+Called at the end of RE_LoadWorldMap
+=================
+*/
+void vk_createWorldGeometry(void)
+{
+	msurface_t* surf;
+	int i;
+
+	vk_destroyWorldGeometry();
+
+	if (tr.world == NULL)
+		return;
+
+	// everything is streamed until proven otherwise,
+	// including brush model surfaces that never come here
+	for (i = 0, surf = tr.world->surfaces; i < tr.world->numsurfaces; i++, surf++)
+	{
+		SetWorldFirstIndex(surf, -1);
+	}
+
+	if (!r_worldBuffers->integer)
+		return;
+
+	s_world.numShaders = tr.numShaders;
+	s_world.shaders = ri.Hunk_Alloc(s_world.numShaders * sizeof(vkWorldShader_t*), h_low);
+
+	//
+	// count the vertexes and indexes of each static shader
+	//
+	const bmodel_t* world = &tr.world->bmodels[0];
+	uint32_t numSurfaces = 0;
+
+	for (i = 0, surf = world->firstSurface; i < world->numSurfaces; i++, surf++)
+	{
+		uint32_t numVerts, numIndexes;
+		const shader_t* sh = surf->shader;
+
+		if (surf->fogIndex || !SurfaceSize(surf, &numVerts, &numIndexes) || !IsStaticShader(sh))
+			continue;
+
+		if (s_world.shaders[sh->index] == NULL)
+		{
+			s_world.shaders[sh->index] = ri.Hunk_Alloc(sizeof(vkWorldShader_t), h_low);
+		}
+
+		s_world.shaders[sh->index]->numVerts += numVerts;
+		s_world.shaders[sh->index]->numIndexes += numIndexes;
+		numSurfaces++;
+	}
+
+	if (numSurfaces == 0)
+	{
+		s_world.shaders = NULL;
+		s_world.numShaders = 0;
+		return;
+	}
+
+	//
+	// lay out the per shader blocks
+	//
+	VkDeviceSize vertexSize = 0;
+	uint32_t numIndexes = 0;
+
+	for (i = 0; i < s_world.numShaders; i++)
+	{
+		vkWorldShader_t* ws = s_world.shaders[i];
+		const shader_t* sh = tr.shaders[i];
+		uint32_t stage;
+
+		if (ws == NULL)
+			continue;
+
+		ws->xyz = vertexSize;
+		vertexSize += ws->numVerts * sizeof(vec4_t);
+
+		for (stage = 0; stage < MAX_SHADER_STAGES && sh->stages[stage]; stage++)
+		{
+			ws->color[stage] = vertexSize;
+			vertexSize += ws->numVerts * sizeof(color4ub_t);
+
+			ws->st0[stage] = vertexSize;
+			vertexSize += ws->numVerts * sizeof(vec2_t);
+
+			if (sh->stages[stage]->bundle[1].image[0] != NULL)
+			{
+				ws->st1[stage] = vertexSize;
+				vertexSize += ws->numVerts * sizeof(vec2_t);
+			}
+		}
+
+		ws->firstIndex = numIndexes;
+		numIndexes += ws->numIndexes;
+	}
+
+	const VkDeviceSize indexSize = numIndexes * sizeof(uint32_t);
+
+	//
+	// tessellate into a host visible staging buffer
+	//
+	VkBuffer staging;
+	VkDeviceMemory staging_memory;
+	void* data;
+
+	vk_createBuffer(vertexSize + indexSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		&staging, &staging_memory);
+
+	VK_CHECK(qvkMapMemory(vk.device, staging_memory, 0, VK_WHOLE_SIZE, 0, &data));
+
+	for (i = 0, surf = world->firstSurface; i < world->numSurfaces; i++, surf++)
+	{
+		uint32_t numVerts, numIdx;
+		const shader_t* sh = surf->shader;
+
+		if (surf->fogIndex || !SurfaceSize(surf, &numVerts, &numIdx) || s_world.shaders[sh->index] == NULL)
+			continue;
+
+		FillWorldSurface(surf, s_world.shaders[sh->index], (unsigned char*)data,
+			(uint32_t*)((unsigned char*)data + vertexSize));
+	}
+
+	qvkUnmapMemory(vk.device, staging_memory);
+
+	//
+	// and move it to device local memory
+	//
+	vk_createBuffer(vertexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &s_world.vertex_buffer, &s_world.vertex_buffer_memory);
+	vk_createBuffer(indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &s_world.index_buffer, &s_world.index_buffer_memory);
+
+	vk_copyStagingToWorldBuffers(staging, vertexSize, indexSize);
+
+	qvkDestroyBuffer(vk.device, staging, NULL);
+	qvkFreeMemory(vk.device, staging_memory, NULL);
+
+	ri.Printf(PRINT_ALL, " Create world buffers: %d static surfaces, %d KB vertexes, %d KB indexes. \n",
+		numSurfaces, (int)(vertexSize / 1024), (int)(indexSize / 1024));
+}
+
+
+void vk_destroyWorldGeometry(void)
+{
+	if (s_world.vertex_buffer != VK_NULL_HANDLE)
+	{
+		ri.Printf(PRINT_ALL, " Destroy world buffers. \n");
+
+		qvkDestroyBuffer(vk.device, s_world.vertex_buffer, NULL);
+		qvkFreeMemory(vk.device, s_world.vertex_buffer_memory, NULL);
+		qvkDestroyBuffer(vk.device, s_world.index_buffer, NULL);
+		qvkFreeMemory(vk.device, s_world.index_buffer_memory, NULL);
+	}
+
+	// the shader table lives on the hunk with the map
+	memset(&s_world, 0, sizeof(s_world));
+}
+
+
+qboolean vk_isStaticWorldShader(const shader_t* shader)
+{
+	if (s_world.shaders == NULL || shader->index >= s_world.numShaders || shader->remappedShader)
+		return qfalse;
+
+	// the debug views need the geometry in tess
+	if (r_showtris->integer || r_shownormals->integer)
+		return qfalse;
+
+	return s_world.shaders[shader->index] != NULL;
+}
+
+
+qboolean vk_queueWorldSurface(const surfaceType_t* surface)
+{
+	int firstIndex;
+	uint32_t numIndexes;
+
+	switch (*surface)
+	{
+		case SF_FACE:
+			firstIndex = ((const srfSurfaceFace_t*)surface)->worldFirstIndex;
+			numIndexes = ((const srfSurfaceFace_t*)surface)->numIndices;
+			break;
+		case SF_TRIANGLES:
+			firstIndex = ((const srfTriangles_t*)surface)->worldFirstIndex;
+			numIndexes = ((const srfTriangles_t*)surface)->numIndexes;
+			break;
+		default:
+			return qfalse;
+	}
+
+	if (firstIndex < 0 || s_world.numQueued == MAX_QUEUED_WORLD_SURFACES)
+		return qfalse;
+
+	s_world.queue[s_world.numQueued].firstIndex = firstIndex;
+	s_world.queue[s_world.numQueued].numIndexes = numIndexes;
+	s_world.numQueued++;
+
+	return qtrue;
+}
+
+
+uint32_t vk_numQueuedWorldSurfaces(void)
+{
+	return s_world.numQueued;
+}
+
+
+void vk_clearWorldSurfaceQueue(void)
+{
+	s_world.numQueued = 0;
+}
+
+
+static int CompareWorldDraws(const void* a, const void* b)
+{
+	const vkWorldDraw_t* da = (const vkWorldDraw_t*)a;
+	const vkWorldDraw_t* db = (const vkWorldDraw_t*)b;
+
+	if (da->firstIndex < db->firstIndex)
+		return -1;
+	return da->firstIndex > db->firstIndex;
+}
+
+
+/*
+=================
+vk_bindWorldGeometry
+
+Merges the queued surfaces of tess.shader into as few index ranges as
+possible and binds the positions and indexes for the stages
+=================
+*/
+void vk_bindWorldGeometry(void)
+{
+	const vkWorldShader_t* ws = s_world.shaders[tess.shader->index];
+	uint32_t i, n;
+
+	// neighbouring surfaces in the index buffer become one draw
+	qsort(s_world.queue, s_world.numQueued, sizeof(s_world.queue[0]), CompareWorldDraws);
+
+	for (i = 1, n = 0; i < s_world.numQueued; i++)
+	{
+		vkWorldDraw_t* last = &s_world.queue[n];
+
+		if (last->firstIndex + last->numIndexes == s_world.queue[i].firstIndex)
+			last->numIndexes += s_world.queue[i].numIndexes;
+		else
+			s_world.queue[++n] = s_world.queue[i];
+	}
+
+	for (i = 0; i <= n; i++)
+	{
+		backEnd.pc.c_indexes += s_world.queue[i].numIndexes;
+		backEnd.pc.c_totalIndexes += s_world.queue[i].numIndexes * tess.numPasses;
+	}
+
+	s_world.numQueued = n + 1;
+
+	qvkCmdBindVertexBuffers(vk.command_buffer, 0, 1, &s_world.vertex_buffer, &ws->xyz);
+	qvkCmdBindIndexBuffer(vk.command_buffer, s_world.index_buffer, 0, VK_INDEX_TYPE_UINT32);
+
+	vk_push_transform();
+}
+
+
+void vk_shadeWorldGeometry(uint32_t stage, VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depth_range)
+{
+	const vkWorldShader_t* ws = s_world.shaders[tess.shader->index];
+	uint32_t i;
+
+	VkBuffer bufs[3] = { s_world.vertex_buffer, s_world.vertex_buffer, s_world.vertex_buffer };
+	VkDeviceSize offs[3] = { ws->color[stage], ws->st0[stage], ws->st1[stage] };
+
+	qvkCmdBindVertexBuffers(vk.command_buffer, 1, multitexture ? 3 : 2, bufs, offs);
+
+	vk_set_shade_state(pipeline, multitexture, depth_range);
+
+	for (i = 0; i < s_world.numQueued; i++)
+	{
+		qvkCmdDrawIndexed(vk.command_buffer, s_world.queue[i].numIndexes, 1, s_world.queue[i].firstIndex, 0, 0);
+	}
+}
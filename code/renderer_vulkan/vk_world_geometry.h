@@ -0,0 +1,23 @@
+#ifndef VK_WORLD_GEOMETRY_H_
+#define VK_WORLD_GEOMETRY_H_
+
+#include "tr_local.h"
+#include "vk_shade_geometry.h"
+
+// static BSP surfaces uploaded once into device local buffers
+
+void vk_createWorldGeometry(void);
+void vk_destroyWorldGeometry(void);
+
+qboolean vk_isStaticWorldShader(const shader_t* shader);
+qboolean vk_queueWorldSurface(const surfaceType_t* surface);
+uint32_t vk_numQueuedWorldSurfaces(void);
+void vk_clearWorldSurfaceQueue(void);
+
+// fills tess.svars for one stage, implemented in vk_shade_geometry.c
+void vk_compute_stage_vertexes(shaderStage_t* pStage);
+
+void vk_bindWorldGeometry(void);
+void vk_shadeWorldGeometry(uint32_t stage, VkPipeline pipeline, VkBool32 multitexture, enum Vk_Depth_Range depth_range);
+
+#endif
@@ -299,6 +299,20 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 	GLE(GLvoid, NamedFramebufferTexture2DEXT, GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level) \
 	GLE(GLvoid, NamedFramebufferRenderbufferEXT, GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) \
 
+// GL_ARB_get_program_binary, built-in to OpenGL 4.1
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT          0x8257
+#define GL_PROGRAM_BINARY_LENGTH                    0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS               0x87FE
+#define GL_PROGRAM_BINARY_FORMATS                   0x87FF
+#endif
+
+#define QGL_ARB_get_program_binary_PROCS \
+	GLE(GLvoid, GetProgramBinary, GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary) \
+	GLE(GLvoid, ProgramBinary, GLuint program, GLenum binaryFormat, const GLvoid *binary, GLsizei length) \
+	GLE(GLvoid, ProgramParameteri, GLuint program, GLenum pname, GLint value) \
+
 #define GLE(ret, name, ...) typedef ret APIENTRY name##proc(__VA_ARGS__);
 QGL_1_1_PROCS;
 QGL_DESKTOP_1_1_PROCS;
@@ -310,6 +324,7 @@ QGL_3_0_PROCS;
 QGL_ARB_framebuffer_object_PROCS;
 QGL_ARB_vertex_array_object_PROCS;
 QGL_EXT_direct_state_access_PROCS;
+QGL_ARB_get_program_binary_PROCS;
 #undef GLE
 
 
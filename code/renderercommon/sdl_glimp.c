@@ -676,14 +676,162 @@ void GLimp_SetGamma( unsigned char red[256], unsigned char green[256], unsigned
 
 //////////////////////////////////////////////////////
 
-void GLimp_RenderThreadWrapper( void *stub ) {}
+/*
+===========================================================
+
+SMP acceleration
+
+The render thread owns the GL context while it executes a command
+list, the front end gets it back in GLimp_FrontEndSleep
+
+===========================================================
+*/
+
+static SDL_mutex	*smpMutex = NULL;
+static SDL_cond		*renderCommandsEvent = NULL;
+static SDL_cond		*renderCompletedEvent = NULL;
+static SDL_Thread	*renderThread = NULL;
+
+static void (*glimpRenderThread)( void );
+
+static volatile void		*smpData = NULL;
+static volatile qboolean	smpDataReady;
+static int					smpStarting;	// smpData until the thread first sleeps
+
+static int GLimp_RenderThreadWrapper( void *arg )
+{
+	ri.Printf( PRINT_ALL, "Render thread starting\n" );
+
+	glimpRenderThread();
+
+	SDL_GL_MakeCurrent( SDL_window, NULL );
+
+	ri.Printf( PRINT_ALL, "Render thread terminating\n" );
+
+	return 0;
+}
+
+static void GLimp_ShutdownRenderThread( void )
+{
+	if ( smpMutex != NULL ) {
+		SDL_DestroyMutex( smpMutex );
+		smpMutex = NULL;
+	}
+	if ( renderCommandsEvent != NULL ) {
+		SDL_DestroyCond( renderCommandsEvent );
+		renderCommandsEvent = NULL;
+	}
+	if ( renderCompletedEvent != NULL ) {
+		SDL_DestroyCond( renderCompletedEvent );
+		renderCompletedEvent = NULL;
+	}
+
+	smpData = NULL;
+	smpDataReady = qfalse;
+	glimpRenderThread = NULL;
+}
+
 qboolean GLimp_SpawnRenderThread( void (*function)( void ) )
 {
-	ri.Printf(PRINT_ALL, "ERROR: SMP support was disabled at compile time\n");
-  return qfalse;
+	if ( renderThread != NULL ) {
+		ri.Printf( PRINT_ALL, "GLimp_SpawnRenderThread: render thread already running\n" );
+		return qfalse;
+	}
+
+	smpMutex = SDL_CreateMutex( );
+	renderCommandsEvent = SDL_CreateCond( );
+	renderCompletedEvent = SDL_CreateCond( );
+
+	if ( smpMutex == NULL || renderCommandsEvent == NULL || renderCompletedEvent == NULL ) {
+		ri.Printf( PRINT_ALL, "GLimp_SpawnRenderThread: %s\n", SDL_GetError( ) );
+		GLimp_ShutdownRenderThread( );
+		return qfalse;
+	}
+
+	// the front end waits in GLimp_FrontEndSleep until the thread is ready
+	smpData = &smpStarting;
+	smpDataReady = qfalse;
+	glimpRenderThread = function;
+
+	renderThread = SDL_CreateThread( GLimp_RenderThreadWrapper, "render", NULL );
+	if ( renderThread == NULL ) {
+		ri.Printf( PRINT_ALL, "SDL_CreateThread() failed: %s\n", SDL_GetError( ) );
+		GLimp_ShutdownRenderThread( );
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+void *GLimp_RendererSleep( void )
+{
+	void	*data;
+
+	SDL_GL_MakeCurrent( SDL_window, NULL );
+
+	SDL_LockMutex( smpMutex );
+	{
+		smpData = NULL;
+		smpDataReady = qfalse;
+
+		// after this, the front end can exit GLimp_FrontEndSleep
+		SDL_CondSignal( renderCompletedEvent );
+
+		while ( !smpDataReady ) {
+			SDL_CondWait( renderCommandsEvent, smpMutex );
+		}
+
+		data = (void *)smpData;
+	}
+	SDL_UnlockMutex( smpMutex );
+
+	if ( data ) {
+		SDL_GL_MakeCurrent( SDL_window, SDL_glContext );
+	}
+
+	return data;
+}
+
+void GLimp_FrontEndSleep( void )
+{
+	SDL_LockMutex( smpMutex );
+	{
+		while ( smpData ) {
+			SDL_CondWait( renderCompletedEvent, smpMutex );
+		}
+	}
+	SDL_UnlockMutex( smpMutex );
+
+	SDL_GL_MakeCurrent( SDL_window, SDL_glContext );
 }
-void *GLimp_RendererSleep( void ) {
-  return NULL;
+
+void GLimp_WakeRenderer( void *data )
+{
+	SDL_GL_MakeCurrent( SDL_window, NULL );
+
+	SDL_LockMutex( smpMutex );
+	{
+		// a shutdown doesn't have to come after GLimp_FrontEndSleep
+		while ( !data && smpData ) {
+			SDL_CondWait( renderCompletedEvent, smpMutex );
+		}
+
+		assert( smpData == NULL );
+		smpData = data;
+		smpDataReady = qtrue;
+
+		// after this, the renderer can continue through GLimp_RendererSleep
+		SDL_CondSignal( renderCommandsEvent );
+	}
+	SDL_UnlockMutex( smpMutex );
+
+	// NULL tells the render thread to exit, take the context back for good
+	if ( !data ) {
+		SDL_WaitThread( renderThread, NULL );
+		renderThread = NULL;
+
+		GLimp_ShutdownRenderThread( );
+
+		SDL_GL_MakeCurrent( SDL_window, SDL_glContext );
+	}
 }
-void GLimp_FrontEndSleep( void ) {}
-void GLimp_WakeRenderer( void *data ) {}
@@ -0,0 +1,153 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include "../tr_image_kernels.h"
+
+#define MAX_SIZE	1024
+#define RUN_COUNT	20
+
+
+static byte imageIn[MAX_SIZE * MAX_SIZE * 4];
+static byte imageOut[2][MAX_SIZE * MAX_SIZE * 4];
+static byte lightTable[256];
+
+static int failures;
+
+
+static void InitData( void )
+{
+	int i;
+
+	srand( 1234 );
+
+	for ( i = 0; i < MAX_SIZE * MAX_SIZE * 4; i++ )
+		imageIn[i] = rand() & 255;
+
+	for ( i = 0; i < 256; i++ )
+		lightTable[i] = i * 2 > 255 ? 255 : i * 2;
+}
+
+
+static void CompareImages( const char *name, int width, int height, int outWidth, int outHeight )
+{
+	int i, count = outWidth * outHeight * 4;
+
+	for ( i = 0; i < count; i++ )
+	{
+		if ( imageOut[0][i] != imageOut[1][i] )
+		{
+			printf( "%-16s %4dx%-4d -> %4dx%-4d FAILED, pixel %d component %d: %d != %d\n", name,
+					width, height, outWidth, outHeight, i / 4, i & 3, imageOut[0][i], imageOut[1][i] );
+			failures++;
+			return;
+		}
+	}
+}
+
+
+// kernel k on a width x height image with the implementation selected
+// last, into the buffer of impl, returns the output size
+static void RunKernel( int k, int impl, int width, int height, int *outWidth, int *outHeight )
+{
+	*outWidth = width > 1 ? width >> 1 : 1;
+	*outHeight = height > 1 ? height >> 1 : 1;
+
+	switch ( k )
+	{
+		case 0:
+			// a non power of two source like the ones of resampled textures
+			R_ResampleImage( imageIn, width - width / 3, height - height / 5, imageOut[impl], width, height );
+			*outWidth = width;
+			*outHeight = height;
+			break;
+		case 1:
+			memcpy( imageOut[impl], imageIn, width * height * 4 );
+			R_LightScaleImage( imageOut[impl], imageOut[impl], width * height, lightTable );
+			*outWidth = width;
+			*outHeight = height;
+			break;
+		case 2:
+			R_MipMapBox( imageIn, width, height, imageOut[impl] );
+			break;
+		case 3:
+			R_MipMapFilter( imageIn, width, height, imageOut[impl] );
+			// single rows and columns keep their first half
+			if ( width == 1 || height == 1 )
+			{
+				*outWidth = width * height > 1 ? width * height / 2 : 1;
+				*outHeight = 1;
+			}
+			break;
+	}
+}
+
+#define NUM_KERNELS	4
+
+static const char *kernelNames[NUM_KERNELS] = {
+	"resample", "light scale", "mipmap box", "mipmap filter"
+};
+
+
+// every power of two size up to MAX_SIZE, square or not
+static void ValidateKernel( int k )
+{
+	int width, height, outWidth, outHeight;
+
+	for ( width = 1; width <= MAX_SIZE; width <<= 1 )
+	{
+		for ( height = 1; height <= MAX_SIZE; height <<= 1 )
+		{
+			if ( k == 0 && ( width < 2 || height < 2 ) )
+				continue;
+
+			memset( imageOut, 0xcd, sizeof( imageOut ) );
+
+			R_InitImageKernels( qfalse );
+			RunKernel( k, 0, width, height, &outWidth, &outHeight );
+			R_InitImageKernels( qtrue );
+			RunKernel( k, 1, width, height, &outWidth, &outHeight );
+
+			CompareImages( kernelNames[k], width, height, outWidth, outHeight );
+		}
+	}
+
+	printf( "%-24s done\n", kernelNames[k] );
+}
+
+
+int main( int argc, char *argv[] )
+{
+	struct timeval tv_begin, tv_end;
+	int netTimeMS;
+	int impl, n, k, outWidth, outHeight;
+
+	InitData();
+
+	R_InitImageKernels( qtrue );
+	printf( "implementation: %s\n", R_ImageKernelsImplementation() );
+
+	for ( k = 0; k < NUM_KERNELS; k++ )
+		ValidateKernel( k );
+
+	for ( impl = 0; impl < 2; impl++ )
+	{
+		R_InitImageKernels( impl ? qtrue : qfalse );
+
+		for ( k = 0; k < NUM_KERNELS; k++ )
+		{
+			gettimeofday( &tv_begin, NULL );
+			for ( n = 0; n < RUN_COUNT; n++ )
+				RunKernel( k, impl, MAX_SIZE, MAX_SIZE, &outWidth, &outHeight );
+			gettimeofday( &tv_end, NULL );
+
+			netTimeMS = 1000 * ( tv_end.tv_sec - tv_begin.tv_sec ) + ( tv_end.tv_usec - tv_begin.tv_usec ) / 1000;
+			printf( "%s %-16s %d passes over %dx%d: %d ms\n", R_ImageKernelsImplementation(),
+					kernelNames[k], RUN_COUNT, MAX_SIZE, MAX_SIZE, netTimeMS );
+		}
+	}
+
+	printf( "%d failures\n", failures );
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,221 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+#include "../tr_shade_kernels.h"
+
+#define NUM_VERTS	1001	// not a multiple of 4, so the scalar tails run too
+#define RUN_COUNT	20000
+
+
+static float xyzIn[NUM_VERTS][4];
+static float normalIn[NUM_VERTS][4];
+static float stIn[NUM_VERTS][2];
+static byte colorIn[NUM_VERTS][4];
+
+static float xyzOut[2][NUM_VERTS][4];
+static float stOut[2][NUM_VERTS][2];
+static byte colorOut[2][NUM_VERTS][4];
+
+static float sinTable[SHADE_FUNCTABLE_SIZE];
+static float fogTable[SHADE_FOG_TABLE_SIZE];
+
+static int failures;
+
+
+static float RandomFloat( float min, float max )
+{
+	return min + ( max - min ) * ( rand() / (float)RAND_MAX );
+}
+
+
+static void InitData( void )
+{
+	int i;
+
+	srand( 1234 );
+
+	for ( i = 0; i < SHADE_FUNCTABLE_SIZE; i++ )
+		sinTable[i] = sin( i * 2 * M_PI / SHADE_FUNCTABLE_SIZE );
+
+	for ( i = 0; i < SHADE_FOG_TABLE_SIZE; i++ )
+		fogTable[i] = 1 - exp( -8.0 * i / SHADE_FOG_TABLE_SIZE );
+
+	for ( i = 0; i < NUM_VERTS; i++ )
+	{
+		float len;
+
+		xyzIn[i][0] = RandomFloat( -2048, 2048 );
+		xyzIn[i][1] = RandomFloat( -2048, 2048 );
+		xyzIn[i][2] = RandomFloat( -2048, 2048 );
+		xyzIn[i][3] = 0;
+
+		normalIn[i][0] = RandomFloat( -1, 1 );
+		normalIn[i][1] = RandomFloat( -1, 1 );
+		normalIn[i][2] = RandomFloat( -1, 1 );
+		len = sqrtf( DotProduct( normalIn[i], normalIn[i] ) );
+		VectorScale( normalIn[i], 1.0f / len, normalIn[i] );
+		normalIn[i][3] = 0;
+
+		// fog coordinates around the interesting ranges of R_FogFactor
+		stIn[i][0] = RandomFloat( -0.1f, 0.3f );
+		stIn[i][1] = RandomFloat( 0.0f, 1.0f );
+
+		colorIn[i][0] = rand() & 255;
+		colorIn[i][1] = rand() & 255;
+		colorIn[i][2] = rand() & 255;
+		colorIn[i][3] = rand() & 255;
+	}
+}
+
+
+static void CompareFloats( const char *name, const float *a, const float *b, int count, int stride, float tolerance )
+{
+	int i, j, bad = 0;
+
+	for ( i = 0; i < count; i++ )
+	{
+		for ( j = 0; j < stride; j++ )
+		{
+			float x = a[i * stride + j], y = b[i * stride + j];
+
+			if ( fabsf( x - y ) > tolerance * ( 1.0f + fabsf( x ) ) )
+			{
+				if ( !bad )
+					printf( "  %s: vertex %d component %d: %f != %f\n", name, i, j, x, y );
+				bad++;
+			}
+		}
+	}
+
+	printf( "%-24s %s\n", name, bad ? "FAILED" : "ok" );
+	failures += bad ? 1 : 0;
+}
+
+
+// -ffast-math is free to reorder the C version, so allow off by one
+static void CompareBytes( const char *name, const byte *a, const byte *b, int count )
+{
+	int i, bad = 0;
+
+	for ( i = 0; i < count * 4; i++ )
+	{
+		if ( abs( a[i] - b[i] ) > 1 )
+		{
+			if ( !bad )
+				printf( "  %s: vertex %d component %d: %d != %d\n", name, i / 4, i & 3, a[i], b[i] );
+			bad++;
+		}
+	}
+
+	printf( "%-24s %s\n", name, bad ? "FAILED" : "ok" );
+	failures += bad ? 1 : 0;
+}
+
+
+static const vec3_t viewOrigin = { 100, -200, 50 };
+static const vec3_t ambient = { 40, 60, 80 };
+static const vec3_t directed = { 180, 170, 300 };
+static const vec3_t lightDir = { 0.30304576f, 0.50507627f, 0.80812204f };
+static const vec4_t distanceVector = { 0.001f, -0.002f, 0.0005f, 0.25f };
+static const vec4_t depthVector = { 0.0f, 0.0f, 0.004f, -1.0f };
+static const byte ambientRGBA[4] = { 40, 60, 80, 255 };
+static const byte rgba[4] = { 1, 2, 3, 4 };
+
+
+// kernel k of the implementation selected last, into the buffers of impl
+static void RunKernel( int k, int impl )
+{
+	switch ( k )
+	{
+		case 0:
+			memcpy( xyzOut[impl], xyzIn, sizeof( xyzIn ) );
+			R_DeformVertexesScaled( xyzOut[impl][0], normalIn[0], NUM_VERTS, 3.5f );
+			R_DeformVertexesWave( xyzOut[impl][0], normalIn[0], NUM_VERTS, sinTable, 1.0f, 4.0f, 0.25f, 1234.567 * 0.5, 0.01f );
+			break;
+		case 1:
+			memcpy( stOut[impl], stIn, sizeof( stIn ) );
+			R_TurbulentTexCoords( stOut[impl][0], xyzIn[0], NUM_VERTS, sinTable, 1234.567, 0.125f );
+			break;
+		case 2:
+			R_EnvironmentTexCoords( stOut[impl][0], xyzIn[0], normalIn[0], NUM_VERTS, viewOrigin );
+			break;
+		case 3:
+			R_FogTexCoords( stOut[impl][0], xyzIn[0], NUM_VERTS, distanceVector, depthVector, -3.0f );
+			break;
+		case 4:
+			R_DiffuseColors( colorOut[impl][0], normalIn[0], NUM_VERTS, ambient, directed, lightDir, ambientRGBA );
+			break;
+		case 5:
+			R_FillColors( colorOut[impl][0], NUM_VERTS, rgba );
+			break;
+		case 6:
+			memcpy( colorOut[impl], colorIn, sizeof( colorIn ) );
+			R_ModulateByFog( colorOut[impl][0], stIn[0], NUM_VERTS, fogTable, qtrue, qtrue );
+			break;
+		case 7:
+			memcpy( colorOut[impl], colorIn, sizeof( colorIn ) );
+			R_ModulateByFog( colorOut[impl][0], stIn[0], NUM_VERTS, fogTable, qfalse, qtrue );
+			break;
+	}
+}
+
+#define NUM_KERNELS	8
+
+static const char *kernelNames[NUM_KERNELS] = {
+	"deform", "turbulent", "environment", "fog texcoords",
+	"diffuse", "fill", "modulate rgba by fog", "modulate alpha by fog"
+};
+
+
+static void ValidateKernel( int k )
+{
+	R_InitShadeKernels( qfalse );
+	RunKernel( k, 0 );
+	R_InitShadeKernels( qtrue );
+	RunKernel( k, 1 );
+
+	if ( k == 0 )
+		CompareFloats( kernelNames[k], xyzOut[0][0], xyzOut[1][0], NUM_VERTS, 4, 1e-5f );
+	else if ( k < 4 )
+		CompareFloats( kernelNames[k], stOut[0][0], stOut[1][0], NUM_VERTS, 2, 1e-5f );
+	else
+		CompareBytes( kernelNames[k], colorOut[0][0], colorOut[1][0], NUM_VERTS );
+}
+
+
+int main( int argc, char *argv[] )
+{
+	struct timeval tv_begin, tv_end;
+	int netTimeMS;
+	int impl, n, k;
+
+	InitData();
+
+	R_InitShadeKernels( qtrue );
+	printf( "implementation: %s\n", R_ShadeKernelsImplementation() );
+
+	for ( k = 0; k < NUM_KERNELS; k++ )
+		ValidateKernel( k );
+
+	for ( impl = 0; impl < 2; impl++ )
+	{
+		R_InitShadeKernels( impl ? qtrue : qfalse );
+
+		gettimeofday( &tv_begin, NULL );
+		for ( n = 0; n < RUN_COUNT; n++ )
+		{
+			for ( k = 0; k < NUM_KERNELS; k++ )
+				RunKernel( k, impl );
+		}
+		gettimeofday( &tv_end, NULL );
+
+		netTimeMS = 1000 * ( tv_end.tv_sec - tv_begin.tv_sec ) + ( tv_end.tv_usec - tv_begin.tv_usec ) / 1000;
+		printf( "%s: %d passes over %d vertexes: %d ms\n", R_ShadeKernelsImplementation(), RUN_COUNT, NUM_VERTS, netTimeMS );
+	}
+
+	printf( "%d failures\n", failures );
+
+	return failures ? 1 : 0;
+}
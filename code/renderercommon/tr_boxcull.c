@@ -0,0 +1,158 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_boxcull.c
+ *    Description:  frustum culling of box lists
+ * ==================================================================================
+ */
+
+#include <string.h>
+
+#include "tr_boxcull.h"
+#include "tr_public.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+	#define BOXCULL_SSE
+	#include <emmintrin.h>
+#endif
+
+extern refimport_t	ri;
+
+
+void R_AllocSoABoxes( soaBoxes_t *boxes, int maxBoxes )
+{
+	float	*data;
+	int		i;
+
+	// one block, the arrays follow each other
+	data = ri.Malloc( maxBoxes * 6 * sizeof( float ) );
+
+	for ( i = 0; i < 3; i++ )
+	{
+		boxes->center[i] = data + i * maxBoxes;
+		boxes->extent[i] = data + ( 3 + i ) * maxBoxes;
+	}
+
+	boxes->maxBoxes = maxBoxes;
+}
+
+
+void R_FreeSoABoxes( soaBoxes_t *boxes )
+{
+	if ( boxes->center[0] )
+		ri.Free( boxes->center[0] );
+
+	memset( boxes, 0, sizeof( *boxes ) );
+}
+
+
+void R_SetSoABox( soaBoxes_t *boxes, int index, const vec3_t mins, const vec3_t maxs )
+{
+	int i;
+
+	for ( i = 0; i < 3; i++ )
+	{
+		boxes->center[i][index] = 0.5f * ( mins[i] + maxs[i] );
+		boxes->extent[i][index] = 0.5f * ( maxs[i] - mins[i] );
+	}
+}
+
+
+void R_GetSoABox( const soaBoxes_t *boxes, int index, vec3_t mins, vec3_t maxs )
+{
+	int i;
+
+	for ( i = 0; i < 3; i++ )
+	{
+		mins[i] = boxes->center[i][index] - boxes->extent[i][index];
+		maxs[i] = boxes->center[i][index] + boxes->extent[i][index];
+	}
+}
+
+
+/*
+ * A box is behind a plane when even its corner furthest along the
+ * normal is: center.n + extent.|n| < dist, the same test as
+ * BoxOnPlaneSide returning 2.
+ */
+static qboolean R_BoxVisible( const soaBoxes_t *boxes, int index, const cplane_t *planes, int numPlanes )
+{
+	int p;
+
+	for ( p = 0; p < numPlanes; p++ )
+	{
+		const float *n = planes[p].normal;
+		float d;
+
+		d = boxes->center[0][index] * n[0] + boxes->center[1][index] * n[1] + boxes->center[2][index] * n[2]
+			+ boxes->extent[0][index] * fabs( n[0] ) + boxes->extent[1][index] * fabs( n[1] ) + boxes->extent[2][index] * fabs( n[2] );
+
+		if ( d < planes[p].dist )
+			return qfalse;
+	}
+
+	return qtrue;
+}
+
+
+int R_CullSoABoxes( const soaBoxes_t *boxes, int numBoxes,
+		const cplane_t *planes, int numPlanes, int *visible )
+{
+	int numVisible = 0;
+	int i = 0;
+
+#ifdef BOXCULL_SSE
+	__m128	nx[8], ny[8], nz[8], ax[8], ay[8], az[8], dist[8];
+	const __m128 signMask = _mm_set1_ps( -0.0f );
+	int		p;
+
+	if ( numPlanes <= 8 )
+	{
+		for ( p = 0; p < numPlanes; p++ )
+		{
+			nx[p] = _mm_set1_ps( planes[p].normal[0] );
+			ny[p] = _mm_set1_ps( planes[p].normal[1] );
+			nz[p] = _mm_set1_ps( planes[p].normal[2] );
+			ax[p] = _mm_andnot_ps( signMask, nx[p] );
+			ay[p] = _mm_andnot_ps( signMask, ny[p] );
+			az[p] = _mm_andnot_ps( signMask, nz[p] );
+			dist[p] = _mm_set1_ps( planes[p].dist );
+		}
+
+		for ( ; i + 4 <= numBoxes; i += 4 )
+		{
+			__m128 cx = _mm_loadu_ps( boxes->center[0] + i );
+			__m128 cy = _mm_loadu_ps( boxes->center[1] + i );
+			__m128 cz = _mm_loadu_ps( boxes->center[2] + i );
+			__m128 ex = _mm_loadu_ps( boxes->extent[0] + i );
+			__m128 ey = _mm_loadu_ps( boxes->extent[1] + i );
+			__m128 ez = _mm_loadu_ps( boxes->extent[2] + i );
+			__m128 inside = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+			int mask;
+
+			for ( p = 0; p < numPlanes; p++ )
+			{
+				__m128 d = _mm_add_ps(
+					_mm_add_ps( _mm_mul_ps( cx, nx[p] ), _mm_add_ps( _mm_mul_ps( cy, ny[p] ), _mm_mul_ps( cz, nz[p] ) ) ),
+					_mm_add_ps( _mm_mul_ps( ex, ax[p] ), _mm_add_ps( _mm_mul_ps( ey, ay[p] ), _mm_mul_ps( ez, az[p] ) ) ) );
+
+				inside = _mm_and_ps( inside, _mm_cmpge_ps( d, dist[p] ) );
+			}
+
+			mask = _mm_movemask_ps( inside );
+
+			if ( mask & 1 ) visible[numVisible++] = i;
+			if ( mask & 2 ) visible[numVisible++] = i + 1;
+			if ( mask & 4 ) visible[numVisible++] = i + 2;
+			if ( mask & 8 ) visible[numVisible++] = i + 3;
+		}
+	}
+#endif
+
+	for ( ; i < numBoxes; i++ )
+	{
+		if ( R_BoxVisible( boxes, i, planes, numPlanes ) )
+			visible[numVisible++] = i;
+	}
+
+	return numVisible;
+}
@@ -0,0 +1,28 @@
+#ifndef TR_BOXCULL_H_
+#define TR_BOXCULL_H_
+
+#include "../qcommon/q_shared.h"
+
+/*
+ * Axial boxes kept as centers and half extents in separate arrays
+ * (structure of arrays), so the frustum test runs on four boxes per
+ * SSE instruction instead of one BoxOnPlaneSide call per box.
+ */
+typedef struct {
+	float	*center[3];
+	float	*extent[3];
+	int		maxBoxes;
+} soaBoxes_t;
+
+void R_AllocSoABoxes( soaBoxes_t *boxes, int maxBoxes );
+void R_FreeSoABoxes( soaBoxes_t *boxes );
+
+void R_SetSoABox( soaBoxes_t *boxes, int index, const vec3_t mins, const vec3_t maxs );
+void R_GetSoABox( const soaBoxes_t *boxes, int index, vec3_t mins, vec3_t maxs );
+
+// writes the indexes of the first numBoxes boxes that are not completely
+// behind one of the planes to visible, in order, and returns their count
+int R_CullSoABoxes( const soaBoxes_t *boxes, int numBoxes,
+		const cplane_t *planes, int numPlanes, int *visible );
+
+#endif
@@ -0,0 +1,446 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_capture.c
+ *    Description:  video capture encoder threads
+ * ==================================================================================
+ */
+
+#include <stdlib.h>
+
+#include "tr_capture.h"
+
+#ifdef _WIN32
+	#include "../SDL2/include/SDL.h"
+#else
+	#include <SDL2/SDL.h>
+#endif
+
+#include "tr_public.h"
+
+extern refimport_t	ri;
+
+// each renderer links its own jpeg writer
+size_t RE_SaveJPGToBuffer( byte *buffer, size_t bufSize, int quality,
+		int image_width, int image_height, byte *image_buffer, int padding );
+
+
+// a couple more than the workers, so the back end can go
+// on while all of them are busy
+#define MAX_CAPTURE_SLOTS	( MAX_CAPTURE_THREADS + 2 )
+
+typedef enum {
+	SLOT_FREE,
+	SLOT_FILLING,		// being copied into by R_CaptureFrame
+	SLOT_QUEUED,
+	SLOT_ENCODING,
+	SLOT_DONE			// waiting for the frames before it
+} slotState_t;
+
+typedef struct {
+	slotState_t		state;
+	int				frameNum;
+
+	captureFormat_t	format;
+	byte			gamma[256];
+	qboolean		motionJpeg;
+	int				quality;
+
+	const byte		*src;			// pixels, or the caller's without workers
+	byte			*pixels;
+	int				pixelsSize;
+	byte			*rgb;			// bottom up RGB for the jpeg writer
+	int				rgbSize;
+	byte			*encoded;
+	int				encodedSize;
+
+	const byte		*out;
+	int				outSize;
+	qboolean		failed;			// out of memory, skipped when handed over
+} captureSlot_t;
+
+static SDL_Thread	*captureThreads[MAX_CAPTURE_THREADS];
+static int			numCaptureWorkers;
+
+static SDL_mutex	*captureLock;
+static SDL_cond		*captureWake;		// a frame got queued
+static SDL_cond		*captureDone;		// a frame got handed over
+
+static captureSlot_t	captureSlots[MAX_CAPTURE_SLOTS];
+static int			numCaptureSlots;
+static int			captureNextFrame;
+static int			captureNextDeliver;
+static qboolean		captureDelivering;
+static qboolean		captureQuit;
+
+// frames lost to failed allocations, reported on the main thread
+static SDL_atomic_t	captureDropped;
+
+
+/*
+ * Runs on the back end and the workers, where ri.Error can't be
+ * raised, a frame that doesn't get its buffers is dropped instead
+ */
+static qboolean R_CaptureAlloc( byte **buf, int *size, int needed )
+{
+	if ( *size >= needed )
+		return qtrue;
+
+	free( *buf );
+	*buf = malloc( needed );
+	*size = *buf ? needed : 0;
+
+	return *buf != NULL;
+}
+
+
+/*
+ * Both the AVI and the jpeg writer want the bottom row first, raw
+ * frames in BGR with rows padded to 4 bytes, the jpeg writer in RGB
+ */
+static void R_ConvertFrame( const captureSlot_t *s, byte *out, qboolean toBGR, int outStride )
+{
+	const captureFormat_t *f = &s->format;
+	const byte *src;
+	byte *dst;
+	int x, y, first, last, pad;
+
+	// swap red and blue when the orders differ
+	first = ( f->bgr != toBGR ) ? 2 : 0;
+	last = 2 - first;
+	pad = outStride - f->width * 3;
+
+	for ( y = 0; y < f->height; y++ )
+	{
+		src = s->src + ( f->topDown ? f->height - 1 - y : y ) * f->stride;
+		dst = out + y * outStride;
+
+		for ( x = 0; x < f->width; x++, src += f->bytesPerPixel, dst += 3 )
+		{
+			dst[0] = s->gamma[src[first]];
+			dst[1] = s->gamma[src[1]];
+			dst[2] = s->gamma[src[last]];
+		}
+
+		memset( dst, 0, pad );
+	}
+}
+
+
+static void R_EncodeFrame( captureSlot_t *s )
+{
+	const captureFormat_t *f = &s->format;
+	int linelen = f->width * 3;
+	int avilinelen = PAD( linelen, 4 );
+
+	if ( s->motionJpeg )
+	{
+		R_ConvertFrame( s, s->rgb, qfalse, linelen );
+		s->outSize = RE_SaveJPGToBuffer( s->encoded, linelen * f->height, s->quality,
+			f->width, f->height, s->rgb, 0 );
+	}
+	else
+	{
+		R_ConvertFrame( s, s->encoded, qtrue, avilinelen );
+		s->outSize = avilinelen * f->height;
+	}
+
+	s->out = s->encoded;
+}
+
+
+static qboolean R_SetupSlot( captureSlot_t *s, const captureFormat_t *format,
+		const byte *gammaTable, qboolean motionJpeg, int quality )
+{
+	int i;
+
+	s->format = *format;
+	s->motionJpeg = motionJpeg;
+	s->quality = quality;
+
+	// copied, gamma may change while the frame waits
+	for ( i = 0; i < 256; i++ )
+		s->gamma[i] = gammaTable ? gammaTable[i] : i;
+
+	if ( motionJpeg && !R_CaptureAlloc( &s->rgb, &s->rgbSize, format->width * 3 * format->height ) )
+		return qfalse;
+
+	return R_CaptureAlloc( &s->encoded, &s->encodedSize, PAD( format->width * 3, 4 ) * format->height );
+}
+
+
+static captureSlot_t *R_SlotForFrame( int frameNum, slotState_t state )
+{
+	int i;
+
+	for ( i = 0; i < numCaptureSlots; i++ )
+	{
+		if ( captureSlots[i].state == state && captureSlots[i].frameNum == frameNum )
+			return &captureSlots[i];
+	}
+
+	return NULL;
+}
+
+
+static captureSlot_t *R_OldestSlot( slotState_t state )
+{
+	captureSlot_t *best = NULL;
+	int i;
+
+	for ( i = 0; i < numCaptureSlots; i++ )
+	{
+		if ( captureSlots[i].state != state )
+			continue;
+		if ( best == NULL || captureSlots[i].frameNum < best->frameNum )
+			best = &captureSlots[i];
+	}
+
+	return best;
+}
+
+
+/*
+ * Called with captureLock held. Only one thread hands frames over at a
+ * time, the others leave theirs to it, it looks again after every frame
+ */
+static void R_DeliverFrames( void )
+{
+	captureSlot_t *s;
+
+	if ( captureDelivering )
+		return;
+
+	captureDelivering = qtrue;
+
+	while ( ( s = R_SlotForFrame( captureNextDeliver, SLOT_DONE ) ) != NULL )
+	{
+		if ( s->failed )
+			SDL_AtomicIncRef( &captureDropped );
+		else
+		{
+			SDL_UnlockMutex( captureLock );
+			ri.CL_WriteAVIVideoFrame( s->out, s->outSize );
+			SDL_LockMutex( captureLock );
+		}
+
+		s->state = SLOT_FREE;
+		captureNextDeliver++;
+		SDL_CondBroadcast( captureDone );
+	}
+
+	captureDelivering = qfalse;
+}
+
+
+static int R_CaptureThread( void *arg )
+{
+	captureSlot_t *s;
+
+	SDL_LockMutex( captureLock );
+
+	while ( 1 )
+	{
+		s = R_OldestSlot( SLOT_QUEUED );
+		if ( s == NULL )
+		{
+			if ( captureQuit )
+				break;
+
+			SDL_CondWait( captureWake, captureLock );
+			continue;
+		}
+
+		s->state = SLOT_ENCODING;
+		SDL_UnlockMutex( captureLock );
+
+		R_EncodeFrame( s );
+
+		SDL_LockMutex( captureLock );
+		s->state = SLOT_DONE;
+
+		R_DeliverFrames();
+	}
+
+	SDL_UnlockMutex( captureLock );
+
+	return 0;
+}
+
+
+void R_InitCapture( int numWorkers )
+{
+	int i;
+
+	R_ShutdownCapture();
+
+	if ( numWorkers > MAX_CAPTURE_THREADS )
+		numWorkers = MAX_CAPTURE_THREADS;
+
+	// a single slot for encoding right away
+	numCaptureSlots = 1;
+
+	if ( numWorkers <= 0 )
+		return;
+
+	captureLock = SDL_CreateMutex();
+	captureWake = SDL_CreateCond();
+	captureDone = SDL_CreateCond();
+
+	if ( captureLock == NULL || captureWake == NULL || captureDone == NULL )
+	{
+		ri.Printf( PRINT_WARNING, "R_InitCapture: %s\n", SDL_GetError() );
+		R_ShutdownCapture();
+		numCaptureSlots = 1;
+		return;
+	}
+
+	captureQuit = qfalse;
+	captureNextFrame = captureNextDeliver = 0;
+	numCaptureSlots = numWorkers + 2;
+
+	for ( i = 0; i < numWorkers; i++ )
+	{
+		captureThreads[i] = SDL_CreateThread( R_CaptureThread, "rcapture", NULL );
+		if ( captureThreads[i] == NULL )
+		{
+			ri.Printf( PRINT_WARNING, "R_InitCapture: SDL_CreateThread() failed: %s\n", SDL_GetError() );
+			break;
+		}
+		numCaptureWorkers++;
+	}
+
+	if ( !numCaptureWorkers )
+		numCaptureSlots = 1;
+
+	ri.Printf( PRINT_ALL, "Started %d video capture threads\n", numCaptureWorkers );
+}
+
+
+void R_ShutdownCapture( void )
+{
+	int i;
+
+	if ( numCaptureWorkers )
+	{
+		R_FinishCapture();
+
+		SDL_LockMutex( captureLock );
+		captureQuit = qtrue;
+		SDL_CondBroadcast( captureWake );
+		SDL_UnlockMutex( captureLock );
+
+		for ( i = 0; i < numCaptureWorkers; i++ )
+		{
+			SDL_WaitThread( captureThreads[i], NULL );
+			captureThreads[i] = NULL;
+		}
+
+		numCaptureWorkers = 0;
+	}
+
+	if ( captureLock != NULL )
+	{
+		SDL_DestroyMutex( captureLock );
+		captureLock = NULL;
+	}
+	if ( captureWake != NULL )
+	{
+		SDL_DestroyCond( captureWake );
+		captureWake = NULL;
+	}
+	if ( captureDone != NULL )
+	{
+		SDL_DestroyCond( captureDone );
+		captureDone = NULL;
+	}
+
+	for ( i = 0; i < MAX_CAPTURE_SLOTS; i++ )
+	{
+		free( captureSlots[i].pixels );
+		free( captureSlots[i].rgb );
+		free( captureSlots[i].encoded );
+	}
+	memset( captureSlots, 0, sizeof( captureSlots ) );
+	numCaptureSlots = 0;
+}
+
+
+void R_CaptureFrame( const byte *pixels, const captureFormat_t *format,
+		const byte *gammaTable, qboolean motionJpeg, int quality )
+{
+	captureSlot_t *s;
+
+	if ( !numCaptureWorkers )
+	{
+		s = &captureSlots[0];
+		if ( !R_SetupSlot( s, format, gammaTable, motionJpeg, quality ) )
+		{
+			SDL_AtomicIncRef( &captureDropped );
+			return;
+		}
+		s->src = pixels;
+		R_EncodeFrame( s );
+		ri.CL_WriteAVIVideoFrame( s->out, s->outSize );
+		return;
+	}
+
+	SDL_LockMutex( captureLock );
+
+	// back-pressure, wait for a frame to be handed over
+	while ( ( s = R_OldestSlot( SLOT_FREE ) ) == NULL )
+		SDL_CondWait( captureDone, captureLock );
+
+	s->state = SLOT_FILLING;
+	s->frameNum = captureNextFrame++;
+
+	SDL_UnlockMutex( captureLock );
+
+	s->failed = !R_SetupSlot( s, format, gammaTable, motionJpeg, quality ) ||
+		!R_CaptureAlloc( &s->pixels, &s->pixelsSize, format->stride * format->height );
+
+	SDL_LockMutex( captureLock );
+
+	if ( s->failed )
+	{
+		// keeps its place in line so the frames after it aren't held up
+		s->state = SLOT_DONE;
+		R_DeliverFrames();
+		SDL_UnlockMutex( captureLock );
+		return;
+	}
+
+	SDL_UnlockMutex( captureLock );
+
+	memcpy( s->pixels, pixels, format->stride * format->height );
+	s->src = s->pixels;
+
+	SDL_LockMutex( captureLock );
+	s->state = SLOT_QUEUED;
+	SDL_CondSignal( captureWake );
+	SDL_UnlockMutex( captureLock );
+}
+
+
+void R_ReportCaptureDrops( void )
+{
+	int dropped = SDL_AtomicSet( &captureDropped, 0 );
+
+	if ( dropped )
+		ri.Printf( PRINT_WARNING, "R_CaptureFrame: out of memory, dropped %d video frames\n", dropped );
+}
+
+
+void R_FinishCapture( void )
+{
+	if ( numCaptureWorkers )
+	{
+		SDL_LockMutex( captureLock );
+
+		while ( captureNextDeliver != captureNextFrame )
+			SDL_CondWait( captureDone, captureLock );
+
+		SDL_UnlockMutex( captureLock );
+	}
+
+	R_ReportCaptureDrops();
+}
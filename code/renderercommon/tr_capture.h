@@ -0,0 +1,42 @@
+#ifndef TR_CAPTURE_H_
+#define TR_CAPTURE_H_
+
+#include "../qcommon/q_shared.h"
+
+/*
+ * Video capture encoder threads.
+ *
+ * R_CaptureFrame copies a frame the back end has read back and returns,
+ * the workers convert it to what the AVI wants, compress it when asked,
+ * and hand it to ri.CL_WriteAVIVideoFrame. Frames are handed over in the
+ * order they were captured. When every slot is busy R_CaptureFrame waits,
+ * so a client that can't keep up slows the game down instead of piling
+ * up frames. Without workers the frame is encoded right away.
+ */
+#define MAX_CAPTURE_THREADS		8
+
+// how the pixels of a captured frame are laid out
+typedef struct {
+	int			width, height;
+	int			stride;				// bytes from one row to the next
+	int			bytesPerPixel;		// 3 or 4, the 4th byte is skipped
+	qboolean	bgr;				// blue first instead of red
+	qboolean	topDown;			// first row is the top of the screen
+} captureFormat_t;
+
+void R_InitCapture( int numWorkers );
+void R_ShutdownCapture( void );
+
+// gammaTable is applied to every channel when not NULL,
+// quality is for motion jpeg
+void R_CaptureFrame( const byte *pixels, const captureFormat_t *format,
+		const byte *gammaTable, qboolean motionJpeg, int quality );
+
+// returns when every captured frame has been handed to the client
+void R_FinishCapture( void );
+
+// warns about frames dropped for lack of memory, from the main thread,
+// R_FinishCapture does it as well
+void R_ReportCaptureDrops( void );
+
+#endif
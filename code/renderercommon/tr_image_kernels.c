@@ -0,0 +1,473 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_image_kernels.c
+ *    Description:  per pixel loops of image upload, C and SSE2
+ * ==================================================================================
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "tr_image_kernels.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	#define IMAGE_X86
+	#define IMAGE_TARGET(x) __attribute__((target(x)))
+	#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#define IMAGE_X86
+	#define IMAGE_TARGET(x)
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+
+typedef struct {
+	void (*resample)( const byte *in, int inWidth, int inHeight,
+			byte *out, int outWidth, int outHeight );
+	void (*mipMapBox)( const byte *in, int width, int height, byte *out );
+	void (*mipMapFilter)( const byte *in, int width, int height, byte *out );
+	const char *name;
+} imageKernels_t;
+
+
+/*
+====================================================================
+
+C reference, the loops of the renderers' tr_image.c
+
+====================================================================
+*/
+
+// the source rows and columns of output pixels, 1/4 and 3/4 into them
+static void ResampleTaps( int inSize, int outSize, int *p1, int *p2 )
+{
+	unsigned frac, fracstep;
+	int i;
+
+	fracstep = inSize * 0x10000 / outSize;
+
+	frac = fracstep >> 2;
+	for ( i = 0; i < outSize; i++ )
+	{
+		p1[i] = frac >> 16;
+		frac += fracstep;
+	}
+
+	frac = 3 * ( fracstep >> 2 );
+	for ( i = 0; i < outSize; i++ )
+	{
+		p2[i] = frac >> 16;
+		frac += fracstep;
+	}
+}
+
+
+static void Resample_C( const byte *in, int inWidth, int inHeight,
+		byte *out, int outWidth, int outHeight )
+{
+	int p1[IMAGE_RESAMPLE_MAX_WIDTH], p2[IMAGE_RESAMPLE_MAX_WIDTH];
+	int i, j, k;
+
+	ResampleTaps( inWidth, outWidth, p1, p2 );
+
+	for ( i = 0; i < outHeight; i++, out += outWidth * 4 )
+	{
+		const byte *inrow = in + 4 * inWidth * (int)( ( i + 0.25 ) * inHeight / outHeight );
+		const byte *inrow2 = in + 4 * inWidth * (int)( ( i + 0.75 ) * inHeight / outHeight );
+
+		for ( j = 0; j < outWidth; j++ )
+		{
+			const byte *pix1 = inrow + p1[j] * 4;
+			const byte *pix2 = inrow + p2[j] * 4;
+			const byte *pix3 = inrow2 + p1[j] * 4;
+			const byte *pix4 = inrow2 + p2[j] * 4;
+
+			for ( k = 0; k < 4; k++ )
+				out[j * 4 + k] = ( pix1[k] + pix2[k] + pix3[k] + pix4[k] ) >> 2;
+		}
+	}
+}
+
+
+static void MipMapBox_C( const byte *in, int width, int height, byte *out )
+{
+	int i, j, row;
+
+	if ( width == 1 && height == 1 )
+	{
+		memcpy( out, in, 4 );
+		return;
+	}
+
+	row = width * 4;
+	width >>= 1;
+	height >>= 1;
+
+	if ( width == 0 || height == 0 )
+	{
+		width += height;	// get largest
+		for ( i = 0; i < width; i++, out += 4, in += 8 )
+		{
+			out[0] = ( in[0] + in[4] ) >> 1;
+			out[1] = ( in[1] + in[5] ) >> 1;
+			out[2] = ( in[2] + in[6] ) >> 1;
+			out[3] = ( in[3] + in[7] ) >> 1;
+		}
+		return;
+	}
+
+	for ( i = 0; i < height; i++, in += row )
+	{
+		for ( j = 0; j < width; j++, out += 4, in += 8 )
+		{
+			out[0] = ( in[0] + in[4] + in[row + 0] + in[row + 4] ) >> 2;
+			out[1] = ( in[1] + in[5] + in[row + 1] + in[row + 5] ) >> 2;
+			out[2] = ( in[2] + in[6] + in[row + 2] + in[row + 6] ) >> 2;
+			out[3] = ( in[3] + in[7] + in[row + 3] + in[row + 7] ) >> 2;
+		}
+	}
+}
+
+
+// single rows and columns keep their first half, as the in place
+// version of the renderers left them
+static qboolean MipMapFilterThin( const byte *in, int width, int height, byte *out )
+{
+	int outWidth = width >> 1;
+	int outHeight = height >> 1;
+
+	if ( outWidth && outHeight )
+		return qfalse;
+
+	memcpy( out, in, ( outWidth + outHeight ? outWidth + outHeight : 1 ) * 4 );
+	return qtrue;
+}
+
+
+static void MipMapFilter_C( const byte *in, int width, int height, byte *out )
+{
+	static const int weights[4] = { 1, 2, 2, 1 };
+	int widthMask = width - 1, heightMask = height - 1;
+	int outWidth = width >> 1, outHeight = height >> 1;
+	int i, j, k, x, y;
+
+	if ( MipMapFilterThin( in, width, height, out ) )
+		return;
+
+	for ( i = 0; i < outHeight; i++ )
+	{
+		for ( j = 0; j < outWidth; j++, out += 4 )
+		{
+			for ( k = 0; k < 4; k++ )
+			{
+				int total = 0;
+
+				for ( y = 0; y < 4; y++ )
+				{
+					const byte *inrow = in + ( ( i * 2 - 1 + y ) & heightMask ) * width * 4;
+
+					for ( x = 0; x < 4; x++ )
+						total += weights[y] * weights[x] * inrow[( ( j * 2 - 1 + x ) & widthMask ) * 4 + k];
+				}
+
+				out[k] = total / 36;
+			}
+		}
+	}
+}
+
+
+static const imageKernels_t s_kernelsC = {
+	Resample_C, MipMapBox_C, MipMapFilter_C, "C"
+};
+
+
+/*
+====================================================================
+
+SSE2, pixels are widened to 16 bits per channel, four per register
+
+====================================================================
+*/
+
+#ifdef IMAGE_X86
+
+static ID_INLINE int LoadPixel( const byte *p )
+{
+	int v;
+	memcpy( &v, p, 4 );
+	return v;
+}
+
+
+IMAGE_TARGET("sse2")
+static void Resample_SSE2( const byte *in, int inWidth, int inHeight,
+		byte *out, int outWidth, int outHeight )
+{
+	int p1[IMAGE_RESAMPLE_MAX_WIDTH], p2[IMAGE_RESAMPLE_MAX_WIDTH];
+	const __m128i zero = _mm_setzero_si128();
+	int i, j, k;
+
+	ResampleTaps( inWidth, outWidth, p1, p2 );
+
+	for ( i = 0; i < outHeight; i++, out += outWidth * 4 )
+	{
+		const byte *inrow = in + 4 * inWidth * (int)( ( i + 0.25 ) * inHeight / outHeight );
+		const byte *inrow2 = in + 4 * inWidth * (int)( ( i + 0.75 ) * inHeight / outHeight );
+
+		for ( j = 0; j + 4 <= outWidth; j += 4 )
+		{
+			__m128i a, b, c, d, lo, hi;
+
+			a = _mm_set_epi32( LoadPixel( inrow + p1[j + 3] * 4 ), LoadPixel( inrow + p1[j + 2] * 4 ),
+					LoadPixel( inrow + p1[j + 1] * 4 ), LoadPixel( inrow + p1[j] * 4 ) );
+			b = _mm_set_epi32( LoadPixel( inrow + p2[j + 3] * 4 ), LoadPixel( inrow + p2[j + 2] * 4 ),
+					LoadPixel( inrow + p2[j + 1] * 4 ), LoadPixel( inrow + p2[j] * 4 ) );
+			c = _mm_set_epi32( LoadPixel( inrow2 + p1[j + 3] * 4 ), LoadPixel( inrow2 + p1[j + 2] * 4 ),
+					LoadPixel( inrow2 + p1[j + 1] * 4 ), LoadPixel( inrow2 + p1[j] * 4 ) );
+			d = _mm_set_epi32( LoadPixel( inrow2 + p2[j + 3] * 4 ), LoadPixel( inrow2 + p2[j + 2] * 4 ),
+					LoadPixel( inrow2 + p2[j + 1] * 4 ), LoadPixel( inrow2 + p2[j] * 4 ) );
+
+			lo = _mm_add_epi16( _mm_add_epi16( _mm_unpacklo_epi8( a, zero ), _mm_unpacklo_epi8( b, zero ) ),
+					_mm_add_epi16( _mm_unpacklo_epi8( c, zero ), _mm_unpacklo_epi8( d, zero ) ) );
+			hi = _mm_add_epi16( _mm_add_epi16( _mm_unpackhi_epi8( a, zero ), _mm_unpackhi_epi8( b, zero ) ),
+					_mm_add_epi16( _mm_unpackhi_epi8( c, zero ), _mm_unpackhi_epi8( d, zero ) ) );
+
+			_mm_storeu_si128( (__m128i *)( out + j * 4 ),
+					_mm_packus_epi16( _mm_srli_epi16( lo, 2 ), _mm_srli_epi16( hi, 2 ) ) );
+		}
+
+		for ( ; j < outWidth; j++ )
+		{
+			const byte *pix1 = inrow + p1[j] * 4;
+			const byte *pix2 = inrow + p2[j] * 4;
+			const byte *pix3 = inrow2 + p1[j] * 4;
+			const byte *pix4 = inrow2 + p2[j] * 4;
+
+			for ( k = 0; k < 4; k++ )
+				out[j * 4 + k] = ( pix1[k] + pix2[k] + pix3[k] + pix4[k] ) >> 2;
+		}
+	}
+}
+
+
+// sums of horizontal pixel pairs of two rows of 4 pixels, one pair per half
+IMAGE_TARGET("sse2")
+static ID_INLINE __m128i BoxSums( __m128i a, __m128i b )
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i lo = _mm_add_epi16( _mm_unpacklo_epi8( a, zero ), _mm_unpacklo_epi8( b, zero ) );
+	__m128i hi = _mm_add_epi16( _mm_unpackhi_epi8( a, zero ), _mm_unpackhi_epi8( b, zero ) );
+
+	return _mm_add_epi16( _mm_unpacklo_epi64( lo, hi ), _mm_unpackhi_epi64( lo, hi ) );
+}
+
+
+IMAGE_TARGET("sse2")
+static void MipMapBox_SSE2( const byte *in, int width, int height, byte *out )
+{
+	int outWidth = width >> 1, outHeight = height >> 1;
+	int row = width * 4;
+	int i, j;
+
+	if ( outWidth < 4 || outHeight == 0 )
+	{
+		MipMapBox_C( in, width, height, out );
+		return;
+	}
+
+	for ( i = 0; i < outHeight; i++, in += 2 * row )
+	{
+		const byte *in2 = in + row;
+
+		for ( j = 0; j + 4 <= outWidth; j += 4, out += 16 )
+		{
+			__m128i s0 = BoxSums( _mm_loadu_si128( (const __m128i *)( in + j * 8 ) ),
+					_mm_loadu_si128( (const __m128i *)( in2 + j * 8 ) ) );
+			__m128i s1 = BoxSums( _mm_loadu_si128( (const __m128i *)( in + j * 8 + 16 ) ),
+					_mm_loadu_si128( (const __m128i *)( in2 + j * 8 + 16 ) ) );
+
+			_mm_storeu_si128( (__m128i *)out,
+					_mm_packus_epi16( _mm_srli_epi16( s0, 2 ), _mm_srli_epi16( s1, 2 ) ) );
+		}
+
+		for ( ; j < outWidth; j++, out += 4 )
+		{
+			const byte *p = in + j * 8, *p2 = in2 + j * 8;
+
+			out[0] = ( p[0] + p[4] + p2[0] + p2[4] ) >> 2;
+			out[1] = ( p[1] + p[5] + p2[1] + p2[5] ) >> 2;
+			out[2] = ( p[2] + p[6] + p2[2] + p2[6] ) >> 2;
+			out[3] = ( p[3] + p[7] + p2[3] + p2[7] ) >> 2;
+		}
+	}
+}
+
+
+/*
+The tent filter is separable: the rows are summed 1 2 2 1 into 16 bit
+columns first, then the columns 1 2 2 1 into the output. The column sums
+get one column of padding on each side that wraps around, so the second
+pass needs no masking. The largest total, 36 * 255, fits 16 bits and
+x / 36 is ( x * 7282 ) >> 18 for all of them.
+*/
+IMAGE_TARGET("sse2")
+static void MipMapFilter_SSE2( const byte *in, int width, int height, byte *out )
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i w12 = _mm_set_epi16( 2, 2, 2, 2, 1, 1, 1, 1 );
+	const __m128i w21 = _mm_set_epi16( 1, 1, 1, 1, 2, 2, 2, 2 );
+	const __m128i div36 = _mm_set1_epi16( 7282 );
+	int heightMask = height - 1;
+	int outWidth = width >> 1, outHeight = height >> 1;
+	unsigned short *columns;
+	int i, j, k;
+
+	if ( MipMapFilterThin( in, width, height, out ) )
+		return;
+
+	columns = malloc( ( width + 2 ) * 4 * sizeof( *columns ) );
+	if ( !columns )
+	{
+		MipMapFilter_C( in, width, height, out );
+		return;
+	}
+
+	for ( i = 0; i < outHeight; i++, out += outWidth * 4 )
+	{
+		const byte *r0 = in + ( ( i * 2 - 1 ) & heightMask ) * width * 4;
+		const byte *r1 = in + ( ( i * 2 ) & heightMask ) * width * 4;
+		const byte *r2 = in + ( ( i * 2 + 1 ) & heightMask ) * width * 4;
+		const byte *r3 = in + ( ( i * 2 + 2 ) & heightMask ) * width * 4;
+		unsigned short *c = columns + 4;
+
+		for ( j = 0; j + 4 <= width; j += 4 )
+		{
+			__m128i x0 = _mm_loadu_si128( (const __m128i *)( r0 + j * 4 ) );
+			__m128i x1 = _mm_loadu_si128( (const __m128i *)( r1 + j * 4 ) );
+			__m128i x2 = _mm_loadu_si128( (const __m128i *)( r2 + j * 4 ) );
+			__m128i x3 = _mm_loadu_si128( (const __m128i *)( r3 + j * 4 ) );
+			__m128i lo, hi;
+
+			lo = _mm_add_epi16( _mm_add_epi16( _mm_unpacklo_epi8( x0, zero ), _mm_unpacklo_epi8( x3, zero ) ),
+					_mm_slli_epi16( _mm_add_epi16( _mm_unpacklo_epi8( x1, zero ), _mm_unpacklo_epi8( x2, zero ) ), 1 ) );
+			hi = _mm_add_epi16( _mm_add_epi16( _mm_unpackhi_epi8( x0, zero ), _mm_unpackhi_epi8( x3, zero ) ),
+					_mm_slli_epi16( _mm_add_epi16( _mm_unpackhi_epi8( x1, zero ), _mm_unpackhi_epi8( x2, zero ) ), 1 ) );
+
+			_mm_storeu_si128( (__m128i *)( c + j * 4 ), lo );
+			_mm_storeu_si128( (__m128i *)( c + j * 4 + 8 ), hi );
+		}
+
+		for ( j *= 4; j < width * 4; j++ )
+			c[j] = r0[j] + 2 * ( r1[j] + r2[j] ) + r3[j];
+
+		// wrap around
+		memcpy( columns, c + ( width - 1 ) * 4, 4 * sizeof( *columns ) );
+		memcpy( c + width * 4, c, 4 * sizeof( *columns ) );
+
+		// output pixel j is columns 2j - 1 .. 2j + 2, which start at columns[2j * 4]
+		for ( j = 0; j + 2 <= outWidth; j += 2 )
+		{
+			__m128i p = _mm_loadu_si128( (const __m128i *)( columns + j * 8 ) );
+			__m128i q = _mm_loadu_si128( (const __m128i *)( columns + j * 8 + 8 ) );
+			__m128i r = _mm_loadu_si128( (const __m128i *)( columns + j * 8 + 16 ) );
+			__m128i s0 = _mm_add_epi16( _mm_mullo_epi16( p, w12 ), _mm_mullo_epi16( q, w21 ) );
+			__m128i s1 = _mm_add_epi16( _mm_mullo_epi16( q, w12 ), _mm_mullo_epi16( r, w21 ) );
+			__m128i t = _mm_add_epi16( _mm_unpacklo_epi64( s0, s1 ), _mm_unpackhi_epi64( s0, s1 ) );
+
+			t = _mm_srli_epi16( _mm_mulhi_epu16( t, div36 ), 2 );
+			_mm_storel_epi64( (__m128i *)( out + j * 4 ), _mm_packus_epi16( t, t ) );
+		}
+
+		for ( ; j < outWidth; j++ )
+		{
+			const unsigned short *s = columns + j * 8;
+
+			for ( k = 0; k < 4; k++ )
+				out[j * 4 + k] = ( s[k] + 2 * ( s[k + 4] + s[k + 8] ) + s[k + 12] ) / 36;
+		}
+	}
+
+	free( columns );
+}
+
+
+static const imageKernels_t s_kernelsSSE2 = {
+	Resample_SSE2, MipMapBox_SSE2, MipMapFilter_SSE2, "SSE2"
+};
+
+
+static qboolean R_CpuHasSSE2( void )
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return qtrue;
+#elif defined(_MSC_VER)
+	int regs[4];
+	__cpuid( regs, 1 );
+	return ( regs[3] & ( 1 << 26 ) ) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "sse2" ) ? qtrue : qfalse;
+#endif
+}
+
+#endif // IMAGE_X86
+
+
+static const imageKernels_t *s_kernels = &s_kernelsC;
+
+
+void R_InitImageKernels( qboolean allowSIMD )
+{
+	s_kernels = &s_kernelsC;
+
+#ifdef IMAGE_X86
+	if ( allowSIMD && R_CpuHasSSE2() )
+		s_kernels = &s_kernelsSSE2;
+#endif
+}
+
+
+const char *R_ImageKernelsImplementation( void )
+{
+	return s_kernels->name;
+}
+
+
+void R_ResampleImage( const byte *in, int inWidth, int inHeight,
+		byte *out, int outWidth, int outHeight )
+{
+	s_kernels->resample( in, inWidth, inHeight, out, outWidth, outHeight );
+}
+
+
+/*
+A table lookup per channel, which SSE2 can't gather, so there is only
+this version. The renderers fold the gamma and intensity tables into
+one and skip identity tables, which saves more than vectors would.
+*/
+void R_LightScaleImage( byte *out, const byte *in, int numPixels, const byte table[256] )
+{
+	int i;
+
+	for ( i = 0; i < numPixels; i++, in += 4, out += 4 )
+	{
+		out[0] = table[in[0]];
+		out[1] = table[in[1]];
+		out[2] = table[in[2]];
+		out[3] = in[3];
+	}
+}
+
+
+void R_MipMapBox( const byte *in, int width, int height, byte *out )
+{
+	s_kernels->mipMapBox( in, width, height, out );
+}
+
+
+void R_MipMapFilter( const byte *in, int width, int height, byte *out )
+{
+	s_kernels->mipMapFilter( in, width, height, out );
+}
@@ -0,0 +1,39 @@
+#ifndef TR_IMAGE_KERNELS_H_
+#define TR_IMAGE_KERNELS_H_
+
+#include "../qcommon/q_shared.h"
+
+/*
+ * Per pixel loops of image upload shared by the renderers.
+ *
+ * Images are 4 bytes per pixel RGBA, mipmapped ones have power of two
+ * sizes. The plain C versions are the reference, SSE2 versions are used
+ * on x86 after R_InitImageKernels( qtrue ). Everything is integer math,
+ * so both give the same bytes.
+ */
+
+// widest output of R_ResampleImage
+#define IMAGE_RESAMPLE_MAX_WIDTH	2048
+
+void R_InitImageKernels( qboolean allowSIMD );
+
+// name of the implementation in use, for gfxinfo
+const char *R_ImageKernelsImplementation( void );
+
+// resamples in to outWidth x outHeight averaging 4 taps, filtered
+// properly only when shrinking to no less than half the size
+void R_ResampleImage( const byte *in, int inWidth, int inHeight,
+		byte *out, int outWidth, int outHeight );
+
+// rgb = table[rgb], alpha is kept, out may be in
+void R_LightScaleImage( byte *out, const byte *in, int numPixels, const byte table[256] );
+
+// quarters the size averaging 2x2 blocks, a 1 pixel wide or high
+// image is halved along its length, out must not be in
+void R_MipMapBox( const byte *in, int width, int height, byte *out );
+
+// quarters the size with a 4x4 tent filter wrapping around the edges,
+// a 1 pixel wide or high image is copied as it is, out must not be in
+void R_MipMapFilter( const byte *in, int width, int height, byte *out );
+
+#endif
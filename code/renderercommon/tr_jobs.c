@@ -0,0 +1,168 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_jobs.c
+ *    Description:  front end worker threads
+ * ==================================================================================
+ */
+
+#include "tr_jobs.h"
+
+#ifdef _WIN32
+	#include "../SDL2/include/SDL.h"
+#else
+	#include <SDL2/SDL.h>
+#endif
+
+#include "tr_public.h"
+
+extern refimport_t	ri;
+
+
+static SDL_Thread	*jobThreads[MAX_JOB_THREADS];
+static int			numJobWorkers;
+
+static SDL_sem		*jobsStart;
+static SDL_sem		*jobsDone;
+
+static jobFunc_t	jobFunc;
+static void			*jobData;
+static int			jobNumItems;
+static SDL_atomic_t	jobNextItem;
+static qboolean		jobsQuit;
+
+
+static void R_DoJobs( int thread )
+{
+	int item;
+
+	while ( ( item = SDL_AtomicAdd( &jobNextItem, 1 ) ) < jobNumItems )
+		jobFunc( jobData, item, thread );
+}
+
+
+static int R_JobThread( void *arg )
+{
+	int thread = (int)(intptr_t)arg;
+
+	while ( 1 )
+	{
+		SDL_SemWait( jobsStart );
+
+		if ( jobsQuit )
+			break;
+
+		R_DoJobs( thread );
+
+		SDL_SemPost( jobsDone );
+	}
+
+	return 0;
+}
+
+
+void R_InitJobs( int numWorkers )
+{
+	int i;
+
+	R_ShutdownJobs();
+
+	if ( numWorkers > MAX_JOB_THREADS - 1 )
+		numWorkers = MAX_JOB_THREADS - 1;
+
+	if ( numWorkers <= 0 )
+		return;
+
+	jobsStart = SDL_CreateSemaphore( 0 );
+	jobsDone = SDL_CreateSemaphore( 0 );
+
+	if ( jobsStart == NULL || jobsDone == NULL )
+	{
+		ri.Printf( PRINT_WARNING, "R_InitJobs: %s\n", SDL_GetError() );
+		R_ShutdownJobs();
+		return;
+	}
+
+	jobsQuit = qfalse;
+
+	for ( i = 0; i < numWorkers; i++ )
+	{
+		jobThreads[i] = SDL_CreateThread( R_JobThread, "rjob", (void *)(intptr_t)( i + 1 ) );
+		if ( jobThreads[i] == NULL )
+		{
+			ri.Printf( PRINT_WARNING, "R_InitJobs: SDL_CreateThread() failed: %s\n", SDL_GetError() );
+			break;
+		}
+		numJobWorkers++;
+	}
+
+	ri.Printf( PRINT_ALL, "Started %d front end worker threads\n", numJobWorkers );
+}
+
+
+void R_ShutdownJobs( void )
+{
+	int i;
+
+	if ( numJobWorkers )
+	{
+		jobsQuit = qtrue;
+
+		for ( i = 0; i < numJobWorkers; i++ )
+			SDL_SemPost( jobsStart );
+
+		for ( i = 0; i < numJobWorkers; i++ )
+		{
+			SDL_WaitThread( jobThreads[i], NULL );
+			jobThreads[i] = NULL;
+		}
+
+		numJobWorkers = 0;
+	}
+
+	if ( jobsStart != NULL )
+	{
+		SDL_DestroySemaphore( jobsStart );
+		jobsStart = NULL;
+	}
+	if ( jobsDone != NULL )
+	{
+		SDL_DestroySemaphore( jobsDone );
+		jobsDone = NULL;
+	}
+}
+
+
+int R_NumJobThreads( void )
+{
+	return numJobWorkers + 1;
+}
+
+
+void R_RunJobs( jobFunc_t func, void *data, int numItems )
+{
+	int i, numWake;
+
+	jobFunc = func;
+	jobData = data;
+	jobNumItems = numItems;
+	SDL_AtomicSet( &jobNextItem, 0 );
+
+	// don't wake workers that would find nothing to do
+	numWake = numJobWorkers;
+	if ( numWake > numItems - 1 )
+		numWake = numItems - 1;
+
+	for ( i = 0; i < numWake; i++ )
+		SDL_SemPost( jobsStart );
+
+	R_DoJobs( 0 );
+
+	for ( i = 0; i < numWake; i++ )
+		SDL_SemWait( jobsDone );
+}
+
+
+int R_AtomicExchange( volatile int *p, int value )
+{
+	return SDL_AtomicSet( (SDL_atomic_t *)p, value );
+}
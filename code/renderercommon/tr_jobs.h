@@ -0,0 +1,31 @@
+#ifndef TR_JOBS_H_
+#define TR_JOBS_H_
+
+#include "../qcommon/q_shared.h"
+
+/*
+ * Small pool of front end worker threads.
+ *
+ * R_RunJobs calls func once for every item in [0, numItems), spread
+ * over the workers and the calling thread, and returns when all of
+ * them are done. thread is 0 for the caller and 1..R_NumJobThreads()-1
+ * for the workers, so per thread scratch can be indexed with it.
+ * Items must not depend on each other.
+ */
+#define MAX_JOB_THREADS		8
+
+typedef void (*jobFunc_t)( void *data, int item, int thread );
+
+void R_InitJobs( int numWorkers );
+void R_ShutdownJobs( void );
+
+// 1 when no workers are running
+int R_NumJobThreads( void );
+
+void R_RunJobs( jobFunc_t func, void *data, int numItems );
+
+// stores value and returns what was there before, for claiming
+// something shared between items (surface viewCount marks)
+int R_AtomicExchange( volatile int *p, int value );
+
+#endif
@@ -0,0 +1,448 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_mesh_lerp.c
+ *    Description:  MD3 vertex interpolation and normal decoding
+ * ==================================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "tr_mesh_lerp.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	#define MESH_LERP_X86
+	#define MESH_LERP_TARGET(x) __attribute__((target(x)))
+	#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#define MESH_LERP_X86
+	#define MESH_LERP_TARGET(x)
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+
+#define SINTABLE_SIZE       1024
+#define SINTABLE_MASK       (SINTABLE_SIZE - 1)
+
+// lat/long normal decoding split into two products:
+// latTable[lat] * lngTable[lng] = ( cos(lat)*sin(lng), sin(lat)*sin(lng), cos(lng), 0 )
+// the entries are the same tr.sinTable values the scalar decode used
+static float s_latTable[256][4] QALIGN(16);
+static float s_lngTable[256][4] QALIGN(16);
+static const float *s_sinTable;
+
+
+typedef void (*lerpFunc_t)( const short *newXyz, const short *oldXyz, int numVerts,
+		float newXyzScale, float oldXyzScale, float newNormalScale, float oldNormalScale,
+		float *outXyz, float *outNormal );
+
+static lerpFunc_t s_lerpFunc;
+static const char *s_lerpName;
+
+
+static void R_InitNormalTables( const float *sinTable )
+{
+	int i;
+
+	for ( i = 0; i < 256; i++ )
+	{
+		int a = i * ( SINTABLE_SIZE / 256 );
+
+		s_latTable[i][0] = sinTable[( a + SINTABLE_SIZE / 4 ) & SINTABLE_MASK];
+		s_latTable[i][1] = sinTable[a];
+		s_latTable[i][2] = 1.0f;
+		s_latTable[i][3] = 0.0f;
+
+		s_lngTable[i][0] = sinTable[a];
+		s_lngTable[i][1] = sinTable[a];
+		s_lngTable[i][2] = sinTable[( a + SINTABLE_SIZE / 4 ) & SINTABLE_MASK];
+		s_lngTable[i][3] = 0.0f;
+	}
+
+	s_sinTable = sinTable;
+}
+
+
+static void LerpMD3_C( const short *newXyz, const short *oldXyz, int numVerts,
+		float newXyzScale, float oldXyzScale, float newNormalScale, float oldNormalScale,
+		float *outXyz, float *outNormal )
+{
+	int i;
+
+	if ( !oldXyz )
+	{
+		for ( i = 0; i < numVerts; i++, newXyz += 4, outXyz += 4, outNormal += 4 )
+		{
+			const float *lat = s_latTable[( newXyz[3] >> 8 ) & 0xff];
+			const float *lng = s_lngTable[newXyz[3] & 0xff];
+
+			outXyz[0] = newXyz[0] * newXyzScale;
+			outXyz[1] = newXyz[1] * newXyzScale;
+			outXyz[2] = newXyz[2] * newXyzScale;
+			outXyz[3] = 0.0f;
+
+			outNormal[0] = lat[0] * lng[0];
+			outNormal[1] = lat[1] * lng[1];
+			outNormal[2] = lat[2] * lng[2];
+			outNormal[3] = 0.0f;
+		}
+		return;
+	}
+
+	for ( i = 0; i < numVerts; i++, newXyz += 4, oldXyz += 4, outXyz += 4, outNormal += 4 )
+	{
+		const float *newLat = s_latTable[( newXyz[3] >> 8 ) & 0xff];
+		const float *newLng = s_lngTable[newXyz[3] & 0xff];
+		const float *oldLat = s_latTable[( oldXyz[3] >> 8 ) & 0xff];
+		const float *oldLng = s_lngTable[oldXyz[3] & 0xff];
+		float x, y, z, ilength;
+
+		outXyz[0] = oldXyz[0] * oldXyzScale + newXyz[0] * newXyzScale;
+		outXyz[1] = oldXyz[1] * oldXyzScale + newXyz[1] * newXyzScale;
+		outXyz[2] = oldXyz[2] * oldXyzScale + newXyz[2] * newXyzScale;
+		outXyz[3] = 0.0f;
+
+		x = oldLat[0] * oldLng[0] * oldNormalScale + newLat[0] * newLng[0] * newNormalScale;
+		y = oldLat[1] * oldLng[1] * oldNormalScale + newLat[1] * newLng[1] * newNormalScale;
+		z = oldLat[2] * oldLng[2] * oldNormalScale + newLat[2] * newLng[2] * newNormalScale;
+
+		// the blend of two unit vectors is never close to zero length here
+		ilength = 1.0f / sqrtf( x * x + y * y + z * z );
+
+		outNormal[0] = x * ilength;
+		outNormal[1] = y * ilength;
+		outNormal[2] = z * ilength;
+		outNormal[3] = 0.0f;
+	}
+}
+
+
+#ifdef MESH_LERP_X86
+
+MESH_LERP_TARGET("sse2")
+static void LerpMD3_SSE2( const short *newXyz, const short *oldXyz, int numVerts,
+		float newXyzScale, float oldXyzScale, float newNormalScale, float oldNormalScale,
+		float *outXyz, float *outNormal )
+{
+	const __m128 newScale = _mm_setr_ps( newXyzScale, newXyzScale, newXyzScale, 0.0f );
+	int i;
+
+	if ( !oldXyz )
+	{
+		for ( i = 0; i < numVerts; i++, newXyz += 4, outXyz += 4, outNormal += 4 )
+		{
+			// x y z and the packed normal, sign extended to 32 bits
+			__m128i raw = _mm_loadl_epi64( (const __m128i *)newXyz );
+			__m128 xyz = _mm_cvtepi32_ps( _mm_srai_epi32( _mm_unpacklo_epi16( raw, raw ), 16 ) );
+			unsigned n = (unsigned short)newXyz[3];
+
+			_mm_storeu_ps( outXyz, _mm_mul_ps( xyz, newScale ) );
+			_mm_storeu_ps( outNormal, _mm_mul_ps( _mm_loadu_ps( s_latTable[n >> 8] ), _mm_loadu_ps( s_lngTable[n & 0xff] ) ) );
+		}
+	}
+	else
+	{
+		const __m128 oldScale = _mm_setr_ps( oldXyzScale, oldXyzScale, oldXyzScale, 0.0f );
+		const __m128 newNScale = _mm_set1_ps( newNormalScale );
+		const __m128 oldNScale = _mm_set1_ps( oldNormalScale );
+		const __m128 half = _mm_set1_ps( 0.5f );
+		const __m128 three = _mm_set1_ps( 3.0f );
+
+		for ( i = 0; i < numVerts; i++, newXyz += 4, oldXyz += 4, outXyz += 4, outNormal += 4 )
+		{
+			__m128i newRaw = _mm_loadl_epi64( (const __m128i *)newXyz );
+			__m128i oldRaw = _mm_loadl_epi64( (const __m128i *)oldXyz );
+			__m128 newPos = _mm_cvtepi32_ps( _mm_srai_epi32( _mm_unpacklo_epi16( newRaw, newRaw ), 16 ) );
+			__m128 oldPos = _mm_cvtepi32_ps( _mm_srai_epi32( _mm_unpacklo_epi16( oldRaw, oldRaw ), 16 ) );
+			unsigned nn = (unsigned short)newXyz[3];
+			unsigned on = (unsigned short)oldXyz[3];
+			__m128 newN, oldN, normal, len2, r;
+
+			_mm_storeu_ps( outXyz, _mm_add_ps( _mm_mul_ps( oldPos, oldScale ), _mm_mul_ps( newPos, newScale ) ) );
+
+			newN = _mm_mul_ps( _mm_loadu_ps( s_latTable[nn >> 8] ), _mm_loadu_ps( s_lngTable[nn & 0xff] ) );
+			oldN = _mm_mul_ps( _mm_loadu_ps( s_latTable[on >> 8] ), _mm_loadu_ps( s_lngTable[on & 0xff] ) );
+			normal = _mm_add_ps( _mm_mul_ps( oldN, oldNScale ), _mm_mul_ps( newN, newNScale ) );
+
+			// w is zero, so a 4 wide dot product is the squared length
+			len2 = _mm_mul_ps( normal, normal );
+			len2 = _mm_add_ps( len2, _mm_shuffle_ps( len2, len2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+			len2 = _mm_add_ps( len2, _mm_shuffle_ps( len2, len2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+			// rsqrt estimate and one Newton-Raphson step
+			r = _mm_rsqrt_ps( len2 );
+			r = _mm_mul_ps( _mm_mul_ps( half, r ), _mm_sub_ps( three, _mm_mul_ps( _mm_mul_ps( len2, r ), r ) ) );
+
+			_mm_storeu_ps( outNormal, _mm_mul_ps( normal, r ) );
+		}
+	}
+}
+
+
+MESH_LERP_TARGET("avx2")
+static __m256 LoadNormalPair( unsigned n0, unsigned n1 )
+{
+	__m256 lat = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( s_latTable[n0 >> 8] ) ),
+			_mm_loadu_ps( s_latTable[n1 >> 8] ), 1 );
+	__m256 lng = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( s_lngTable[n0 & 0xff] ) ),
+			_mm_loadu_ps( s_lngTable[n1 & 0xff] ), 1 );
+
+	return _mm256_mul_ps( lat, lng );
+}
+
+
+MESH_LERP_TARGET("avx2")
+static void LerpMD3_AVX2( const short *newXyz, const short *oldXyz, int numVerts,
+		float newXyzScale, float oldXyzScale, float newNormalScale, float oldNormalScale,
+		float *outXyz, float *outNormal )
+{
+	const __m256 newScale = _mm256_setr_ps( newXyzScale, newXyzScale, newXyzScale, 0.0f,
+			newXyzScale, newXyzScale, newXyzScale, 0.0f );
+	int i;
+
+	// two vertexes per iteration
+	if ( !oldXyz )
+	{
+		for ( i = 0; i + 1 < numVerts; i += 2, newXyz += 8, outXyz += 8, outNormal += 8 )
+		{
+			__m128i raw = _mm_loadu_si128( (const __m128i *)newXyz );
+			__m256 xyz = _mm256_cvtepi32_ps( _mm256_cvtepi16_epi32( raw ) );
+
+			_mm256_storeu_ps( outXyz, _mm256_mul_ps( xyz, newScale ) );
+			_mm256_storeu_ps( outNormal, LoadNormalPair( (unsigned short)newXyz[3], (unsigned short)newXyz[7] ) );
+		}
+	}
+	else
+	{
+		const __m256 oldScale = _mm256_setr_ps( oldXyzScale, oldXyzScale, oldXyzScale, 0.0f,
+				oldXyzScale, oldXyzScale, oldXyzScale, 0.0f );
+		const __m256 newNScale = _mm256_set1_ps( newNormalScale );
+		const __m256 oldNScale = _mm256_set1_ps( oldNormalScale );
+		const __m256 half = _mm256_set1_ps( 0.5f );
+		const __m256 three = _mm256_set1_ps( 3.0f );
+
+		for ( i = 0; i + 1 < numVerts; i += 2, newXyz += 8, oldXyz += 8, outXyz += 8, outNormal += 8 )
+		{
+			__m256 newPos = _mm256_cvtepi32_ps( _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)newXyz ) ) );
+			__m256 oldPos = _mm256_cvtepi32_ps( _mm256_cvtepi16_epi32( _mm_loadu_si128( (const __m128i *)oldXyz ) ) );
+			__m256 newN, oldN, normal, len2, r;
+
+			_mm256_storeu_ps( outXyz, _mm256_add_ps( _mm256_mul_ps( oldPos, oldScale ), _mm256_mul_ps( newPos, newScale ) ) );
+
+			newN = LoadNormalPair( (unsigned short)newXyz[3], (unsigned short)newXyz[7] );
+			oldN = LoadNormalPair( (unsigned short)oldXyz[3], (unsigned short)oldXyz[7] );
+			normal = _mm256_add_ps( _mm256_mul_ps( oldN, oldNScale ), _mm256_mul_ps( newN, newNScale ) );
+
+			// the permutes stay inside each 128 bit lane, one vertex per lane
+			len2 = _mm256_mul_ps( normal, normal );
+			len2 = _mm256_add_ps( len2, _mm256_permute_ps( len2, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+			len2 = _mm256_add_ps( len2, _mm256_permute_ps( len2, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+
+			r = _mm256_rsqrt_ps( len2 );
+			r = _mm256_mul_ps( _mm256_mul_ps( half, r ), _mm256_sub_ps( three, _mm256_mul_ps( _mm256_mul_ps( len2, r ), r ) ) );
+
+			_mm256_storeu_ps( outNormal, _mm256_mul_ps( normal, r ) );
+		}
+	}
+
+	// odd vertex count
+	if ( i < numVerts )
+	{
+		LerpMD3_SSE2( newXyz, oldXyz, 1, newXyzScale, oldXyzScale, newNormalScale, oldNormalScale,
+				outXyz, outNormal );
+	}
+}
+
+
+static qboolean R_CpuHasSSE2( void )
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return qtrue;
+#elif defined(_MSC_VER)
+	int regs[4];
+	__cpuid( regs, 1 );
+	return ( regs[3] & ( 1 << 26 ) ) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "sse2" ) ? qtrue : qfalse;
+#endif
+}
+
+
+static qboolean R_CpuHasAVX2( void )
+{
+#if defined(_MSC_VER)
+	int regs[4];
+
+	// the OS has to save the ymm registers too
+	__cpuid( regs, 1 );
+	if ( ( regs[2] & ( ( 1 << 27 ) | ( 1 << 28 ) ) ) != ( ( 1 << 27 ) | ( 1 << 28 ) ) )
+		return qfalse;
+	if ( ( _xgetbv( 0 ) & 6 ) != 6 )
+		return qfalse;
+
+	__cpuidex( regs, 7, 0 );
+	return ( regs[1] & ( 1 << 5 ) ) != 0;
+#else
+	// libgcc checks the OS support through xgetbv as well
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "avx2" ) ? qtrue : qfalse;
+#endif
+}
+
+#endif // MESH_LERP_X86
+
+
+static void R_SelectLerpFunc( void )
+{
+	s_lerpFunc = LerpMD3_C;
+	s_lerpName = "C";
+
+#ifdef MESH_LERP_X86
+	if ( R_CpuHasAVX2() )
+	{
+		s_lerpFunc = LerpMD3_AVX2;
+		s_lerpName = "AVX2";
+	}
+	else if ( R_CpuHasSSE2() )
+	{
+		s_lerpFunc = LerpMD3_SSE2;
+		s_lerpName = "SSE2";
+	}
+#endif
+}
+
+
+const char *R_MD3LerpImplementation( void )
+{
+	if ( !s_lerpFunc )
+		R_SelectLerpFunc();
+
+	return s_lerpName;
+}
+
+
+/*
+====================================================================
+
+Results cache
+
+A ring buffer of decoded vertexes plus a direct mapped table of
+entries pointing into it. An entry is valid as long as less than a
+full ring has been written since it was stored.
+
+====================================================================
+*/
+
+#define LERP_CACHE_ENTRIES      512
+#define LERP_CACHE_VERTEXES     ( 32 * 1024 )
+
+typedef struct {
+	const md3Surface_t *surf;
+	int frame;
+	int oldframe;
+	float backlerp;
+	int numVerts;
+	unsigned int pos;       // ring position of the first vertex, never wrapped
+} lerpCacheEntry_t;
+
+static lerpCacheEntry_t s_lerpCache[LERP_CACHE_ENTRIES];
+static float s_lerpRing[LERP_CACHE_VERTEXES][2][4];
+static unsigned int s_lerpRingPos;
+
+
+void R_ClearMD3LerpCache( void )
+{
+	memset( s_lerpCache, 0, sizeof( s_lerpCache ) );
+	s_lerpRingPos = 0;
+}
+
+
+static lerpCacheEntry_t *R_LerpCacheEntry( const md3Surface_t *surf, int frame, int oldframe, float backlerp )
+{
+	union { float f; unsigned int i; } bits;
+	unsigned int hash;
+
+	bits.f = backlerp;
+	hash = (unsigned int)( (size_t)surf >> 4 );
+	hash ^= frame * 2654435761u;
+	hash ^= oldframe * 40503u;
+	hash ^= bits.i;
+	hash ^= hash >> 16;
+
+	return &s_lerpCache[hash & ( LERP_CACHE_ENTRIES - 1 )];
+}
+
+
+/*
+=================
+R_LerpMD3Vertexes
+=================
+*/
+void R_LerpMD3Vertexes( const md3Surface_t *surf, int frame, int oldframe, float backlerp,
+		const float *sinTable, qboolean useCache, float *outXyz, float *outNormal )
+{
+	const short *newXyz, *oldXyz;
+	lerpCacheEntry_t *entry = NULL;
+	int numVerts = surf->numVerts;
+	int i;
+
+	if ( sinTable != s_sinTable )
+		R_InitNormalTables( sinTable );
+
+	if ( !s_lerpFunc )
+		R_SelectLerpFunc();
+
+	if ( useCache && numVerts <= LERP_CACHE_VERTEXES )
+	{
+		entry = R_LerpCacheEntry( surf, frame, oldframe, backlerp );
+
+		if ( entry->surf == surf && entry->frame == frame && entry->oldframe == oldframe
+			&& entry->backlerp == backlerp && s_lerpRingPos - entry->pos <= LERP_CACHE_VERTEXES )
+		{
+			const float (*src)[2][4] = &s_lerpRing[entry->pos % LERP_CACHE_VERTEXES];
+
+			for ( i = 0; i < numVerts; i++, outXyz += 4, outNormal += 4 )
+			{
+				memcpy( outXyz, src[i][0], sizeof( src[i][0] ) );
+				memcpy( outNormal, src[i][1], sizeof( src[i][1] ) );
+			}
+			return;
+		}
+	}
+
+	newXyz = (const short *)( (const byte *)surf + surf->ofsXyzNormals ) + frame * numVerts * 4;
+	oldXyz = NULL;
+	if ( backlerp != 0 )
+		oldXyz = (const short *)( (const byte *)surf + surf->ofsXyzNormals ) + oldframe * numVerts * 4;
+
+	s_lerpFunc( newXyz, oldXyz, numVerts,
+		MD3_XYZ_SCALE * ( 1.0 - backlerp ), MD3_XYZ_SCALE * backlerp, 1.0 - backlerp, backlerp,
+		outXyz, outNormal );
+
+	if ( entry )
+	{
+		float (*dst)[2][4];
+
+		// keep every entry contiguous in the ring
+		if ( s_lerpRingPos % LERP_CACHE_VERTEXES + numVerts > LERP_CACHE_VERTEXES )
+			s_lerpRingPos += LERP_CACHE_VERTEXES - s_lerpRingPos % LERP_CACHE_VERTEXES;
+
+		entry->surf = surf;
+		entry->frame = frame;
+		entry->oldframe = oldframe;
+		entry->backlerp = backlerp;
+		entry->numVerts = numVerts;
+		entry->pos = s_lerpRingPos;
+
+		dst = &s_lerpRing[s_lerpRingPos % LERP_CACHE_VERTEXES];
+		for ( i = 0; i < numVerts; i++, outXyz += 4, outNormal += 4 )
+		{
+			memcpy( dst[i][0], outXyz, sizeof( dst[i][0] ) );
+			memcpy( dst[i][1], outNormal, sizeof( dst[i][1] ) );
+		}
+
+		s_lerpRingPos += numVerts;
+	}
+}
@@ -0,0 +1,29 @@
+#ifndef TR_MESH_LERP_H_
+#define TR_MESH_LERP_H_
+
+#include "../qcommon/q_shared.h"
+#include "../qcommon/qfiles.h"
+
+/*
+ * MD3 vertex decompression shared by the renderers that draw md3Surface_t.
+ *
+ * Interpolates the compressed xyz between two frames and decodes the
+ * lat/long normals, writing vec4 strided arrays (w is zero). SSE2 and
+ * AVX2 versions are picked at runtime on x86, other CPUs use plain C.
+ *
+ * sinTable is the renderer's tr.sinTable, 1024 entries.
+ *
+ * With useCache the results are also kept in a small ring buffer keyed
+ * by surface, frame, oldframe and backlerp, so an entity drawn again in
+ * a mirror, portal or shadow pass is copied instead of decoded.
+ */
+void R_LerpMD3Vertexes( const md3Surface_t *surf, int frame, int oldframe, float backlerp,
+		const float *sinTable, qboolean useCache, float *outXyz, float *outNormal );
+
+// must be called whenever models may be freed, the cache is keyed by address
+void R_ClearMD3LerpCache( void );
+
+// name of the implementation in use, for gfxinfo
+const char *R_MD3LerpImplementation( void );
+
+#endif
@@ -89,6 +89,14 @@ typedef struct
 	qboolean (*inPVS)( const vec3_t p1, const vec3_t p2 );
 
 	void (*TakeVideoFrame)( int h, int w, byte* captureBuffer, byte *encodeBuffer, qboolean motionJpeg );
+
+	// hands every frame still being read back or encoded to
+	// CL_WriteAVIVideoFrame, NULL when TakeVideoFrame is synchronous
+	void (*FinishVideoFrames)( void );
+
+	// microseconds the last frame spent waiting for the driver to finish
+	// and present it, NULL when the renderer doesn't measure it
+	int (*SwapMicroseconds)( void );
 } refexport_t;
 
 //
@@ -103,6 +111,7 @@ typedef struct {
 
 	// milliseconds should only be used for profiling, never for anything game related. Get time from the refdef
 	int (*Milliseconds)( void );
+	int64_t (*Microseconds)( void );
 
 	// stack based memory allocation for per-level things that won't be freed
 #ifdef HUNK_DEBUG
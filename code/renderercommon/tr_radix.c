@@ -0,0 +1,101 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_radix.c
+ *    Description:  draw surface sorting shared by the renderers
+ * ==================================================================================
+ */
+
+#include <string.h>
+
+#include "../qcommon/q_shared.h"
+#include "tr_radix.h"
+
+
+#define SORT_KEY( p )	( *(const unsigned int *)(p) )
+
+
+/*
+ * one scatter pass, the element copy is specialised for the usual
+ * drawSurf_t sizes so the compiler doesn't call memcpy per surface
+ */
+#define RADIX_SCATTER( copy ) \
+	for ( i = 0; i < numSurfs; i++, in += surfSize ) { \
+		byte *out = dest + offset[( SORT_KEY( in ) >> shift ) & 255]++ * surfSize; \
+		copy; \
+	}
+
+static void R_RadixScatter( const byte *in, byte *dest, int numSurfs, int surfSize,
+		int shift, int *offset )
+{
+	int i;
+
+	switch ( surfSize )
+	{
+		case 8:
+			RADIX_SCATTER( memcpy( out, in, 8 ) );
+			break;
+		case 12:
+			RADIX_SCATTER( memcpy( out, in, 12 ) );
+			break;
+		case 16:
+			RADIX_SCATTER( memcpy( out, in, 16 ) );
+			break;
+		default:
+			RADIX_SCATTER( memcpy( out, in, surfSize ) );
+			break;
+	}
+}
+
+
+void R_RadixSortDrawSurfs( void *surfs, void *scratch, int numSurfs, int surfSize )
+{
+	int			count[4][256];
+	byte		*source, *dest, *swap;
+	const byte	*in;
+	int			pass, i;
+
+	if ( numSurfs < 2 )
+		return;
+
+	memset( count, 0, sizeof( count ) );
+
+	in = (const byte *)surfs;
+	for ( i = 0; i < numSurfs; i++, in += surfSize )
+	{
+		unsigned int key = SORT_KEY( in );
+
+		count[0][key & 255]++;
+		count[1][( key >> 8 ) & 255]++;
+		count[2][( key >> 16 ) & 255]++;
+		count[3][key >> 24]++;
+	}
+
+	source = (byte *)surfs;
+	dest = (byte *)scratch;
+
+	// least significant byte first, each pass keeps the order of the previous one
+	for ( pass = 0; pass < 4; pass++ )
+	{
+		int offset[256];
+		int sum;
+
+		// every key has the same value in this byte
+		if ( count[pass][( SORT_KEY( source ) >> ( pass * 8 ) ) & 255] == numSurfs )
+			continue;
+
+		for ( i = 0, sum = 0; i < 256; i++ )
+		{
+			offset[i] = sum;
+			sum += count[pass][i];
+		}
+
+		R_RadixScatter( source, dest, numSurfs, surfSize, pass * 8, offset );
+
+		swap = source;
+		source = dest;
+		dest = swap;
+	}
+
+	if ( source != (byte *)surfs )
+		memcpy( surfs, source, (size_t)numSurfs * surfSize );
+}
@@ -0,0 +1,17 @@
+#ifndef TR_RADIX_H_
+#define TR_RADIX_H_
+
+/*
+ * Stable radix sort of draw surfaces on their 32 bit sort key.
+ *
+ * Every renderer's drawSurf_t starts with the unsigned sort key, the
+ * rest of the element is moved along with it. scratch must hold
+ * numSurfs elements, the sorted result always ends up in surfs.
+ *
+ * All four byte histograms are built in one pass over the keys and a
+ * byte that is the same for every surface (entity and fog bits of a
+ * world only view, for example) costs no scatter pass.
+ */
+void R_RadixSortDrawSurfs( void *surfs, void *scratch, int numSurfs, int surfSize );
+
+#endif
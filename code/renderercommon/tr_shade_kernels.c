@@ -0,0 +1,660 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_shade_kernels.c
+ *    Description:  per vertex loops of shader stage evaluation, C and SSE2
+ * ==================================================================================
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "tr_shade_kernels.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	#define SHADE_X86
+	#define SHADE_TARGET(x) __attribute__((target(x)))
+	#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#define SHADE_X86
+	#define SHADE_TARGET(x)
+	#include <intrin.h>
+	#include <immintrin.h>
+#endif
+
+
+typedef struct {
+	void (*deformScaled)( float *xyz, const float *normal, int numVerts, float scale );
+	void (*deformWave)( float *xyz, const float *normal, int numVerts, const float *table,
+			float base, float amplitude, float phase, double timeFreq, float spread );
+	void (*fillColors)( byte *colors, int numVerts, const byte rgba[4] );
+	void (*turbulent)( float *st, const float *xyz, int numVerts,
+			const float *sinTable, double now, float amplitude );
+	void (*environment)( float *st, const float *xyz, const float *normal, int numVerts,
+			const vec3_t viewOrigin );
+	void (*diffuse)( byte *colors, const float *normal, int numVerts,
+			const vec3_t ambientLight, const vec3_t directedLight, const vec3_t lightDir,
+			const byte ambientRGBA[4] );
+	void (*fogTexCoords)( float *st, const float *xyz, int numVerts,
+			const vec4_t distanceVector, const vec4_t depthVector, float eyeT );
+	void (*modulateByFog)( byte *colors, const float *st, int numVerts, const float *fogTable,
+			qboolean rgb, qboolean alpha );
+	const char *name;
+} shadeKernels_t;
+
+
+/*
+====================================================================
+
+C reference, the loops of tr_shade_calc.c
+
+====================================================================
+*/
+
+static void DeformScaled_C( float *xyz, const float *normal, int numVerts, float scale )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, xyz += 4, normal += 4 )
+	{
+		xyz[0] += normal[0] * scale;
+		xyz[1] += normal[1] * scale;
+		xyz[2] += normal[2] * scale;
+	}
+}
+
+
+static void DeformWave_C( float *xyz, const float *normal, int numVerts, const float *table,
+		float base, float amplitude, float phase, double timeFreq, float spread )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, xyz += 4, normal += 4 )
+	{
+		float off = ( xyz[0] + xyz[1] + xyz[2] ) * spread;
+		float scale = base + table[( (int64_t)( ( ( phase + off ) + timeFreq ) * SHADE_FUNCTABLE_SIZE ) ) & SHADE_FUNCTABLE_MASK] * amplitude;
+
+		xyz[0] += normal[0] * scale;
+		xyz[1] += normal[1] * scale;
+		xyz[2] += normal[2] * scale;
+	}
+}
+
+
+static void FillColors_C( byte *colors, int numVerts, const byte rgba[4] )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, colors += 4 )
+	{
+		colors[0] = rgba[0];
+		colors[1] = rgba[1];
+		colors[2] = rgba[2];
+		colors[3] = rgba[3];
+	}
+}
+
+
+static void Turbulent_C( float *st, const float *xyz, int numVerts,
+		const float *sinTable, double now, float amplitude )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, st += 2, xyz += 4 )
+	{
+		st[0] += sinTable[( (int64_t)( ( ( xyz[0] + xyz[2] ) * 1.0 / 1024 + now ) * SHADE_FUNCTABLE_SIZE ) ) & SHADE_FUNCTABLE_MASK] * amplitude;
+		st[1] += sinTable[( (int64_t)( ( xyz[1] * 1.0 / 1024 + now ) * SHADE_FUNCTABLE_SIZE ) ) & SHADE_FUNCTABLE_MASK] * amplitude;
+	}
+}
+
+
+static void Environment_C( float *st, const float *xyz, const float *normal, int numVerts,
+		const vec3_t viewOrigin )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, xyz += 4, normal += 4, st += 2 )
+	{
+		vec3_t viewer;
+		float invLen, d;
+
+		VectorSubtract( viewOrigin, xyz, viewer );
+
+		invLen = 1.0f / sqrtf( viewer[0] * viewer[0] + viewer[1] * viewer[1] + viewer[2] * viewer[2] );
+		viewer[0] *= invLen;
+		viewer[1] *= invLen;
+		viewer[2] *= invLen;
+
+		d = DotProduct( normal, viewer );
+
+		st[0] = 0.5f + ( normal[1] * 2 * d - viewer[1] ) * 0.5f;
+		st[1] = 0.5f - ( normal[2] * 2 * d - viewer[2] ) * 0.5f;
+	}
+}
+
+
+static void Diffuse_C( byte *colors, const float *normal, int numVerts,
+		const vec3_t ambientLight, const vec3_t directedLight, const vec3_t lightDir,
+		const byte ambientRGBA[4] )
+{
+	int i, j;
+
+	for ( i = 0; i < numVerts; i++, normal += 4, colors += 4 )
+	{
+		float incoming = DotProduct( normal, lightDir );
+
+		if ( incoming <= 0 )
+		{
+			colors[0] = ambientRGBA[0];
+			colors[1] = ambientRGBA[1];
+			colors[2] = ambientRGBA[2];
+			colors[3] = ambientRGBA[3];
+			continue;
+		}
+
+		for ( j = 0; j < 3; j++ )
+		{
+			float c = ambientLight[j] + incoming * directedLight[j];
+
+			colors[j] = c < 255.0f ? (byte)c : 255;
+		}
+		colors[3] = 255;
+	}
+}
+
+
+static void FogTexCoords_C( float *st, const float *xyz, int numVerts,
+		const vec4_t distanceVector, const vec4_t depthVector, float eyeT )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, xyz += 4, st += 2 )
+	{
+		float s = DotProduct( xyz, distanceVector ) + distanceVector[3];
+		float t = DotProduct( xyz, depthVector ) + depthVector[3];
+
+		// partially clipped fogs use the T axis
+		if ( eyeT < 0 )
+		{
+			if ( t < 1.0f )
+				t = 1.0f / 32;	// point is outside, so no fogging
+			else
+				t = 1.0f / 32 + 30.0f / 32 * t / ( t - eyeT );	// cut the distance at the fog plane
+		}
+		else
+		{
+			t = ( t < 0 ) ? 1.0f / 32 : 31.0f / 32;
+		}
+
+		st[0] = s;
+		st[1] = t;
+	}
+}
+
+
+// R_FogFactor of the renderers
+static float FogFactor( const float *fogTable, float s, float t )
+{
+	s -= 1.0f / 512;
+	if ( s < 0 || t < 1.0f / 32 )
+		return 0;
+
+	if ( t < 31.0f / 32 )
+		s *= ( t - 1.0f / 32 ) / ( 30.0f / 32 );
+
+	// we need to leave a lot of clamp range
+	s *= 8;
+	if ( s > 1.0f )
+		s = 1.0f;
+
+	return fogTable[(int)( s * ( SHADE_FOG_TABLE_SIZE - 1 ) )];
+}
+
+
+static void ModulateByFog_C( byte *colors, const float *st, int numVerts, const float *fogTable,
+		qboolean rgb, qboolean alpha )
+{
+	int i;
+
+	for ( i = 0; i < numVerts; i++, colors += 4, st += 2 )
+	{
+		float f = 1.0f - FogFactor( fogTable, st[0], st[1] );
+
+		if ( rgb )
+		{
+			colors[0] *= f;
+			colors[1] *= f;
+			colors[2] *= f;
+		}
+		if ( alpha )
+			colors[3] *= f;
+	}
+}
+
+
+static const shadeKernels_t s_kernelsC = {
+	DeformScaled_C, DeformWave_C, FillColors_C, Turbulent_C, Environment_C,
+	Diffuse_C, FogTexCoords_C, ModulateByFog_C, "C"
+};
+
+
+/*
+====================================================================
+
+SSE2
+
+Four vertexes at a time where the math is per vertex, the vec4
+strided positions and normals are transposed so every lane does
+the same operations in the same order as the C reference.
+
+====================================================================
+*/
+
+#ifdef SHADE_X86
+
+// loads x y z w of four vertexes and transposes them to xxxx yyyy zzzz
+#define LOAD_XYZ4( p, x, y, z ) do { \
+	__m128 r0 = _mm_loadu_ps( (p) ), r1 = _mm_loadu_ps( (p) + 4 ); \
+	__m128 r2 = _mm_loadu_ps( (p) + 8 ), r3 = _mm_loadu_ps( (p) + 12 ); \
+	_MM_TRANSPOSE4_PS( r0, r1, r2, r3 ); \
+	(x) = r0; (y) = r1; (z) = r2; \
+} while ( 0 )
+
+// interleaves four s and four t into st pairs
+#define STORE_ST4( p, s, t ) do { \
+	_mm_storeu_ps( (p), _mm_unpacklo_ps( (s), (t) ) ); \
+	_mm_storeu_ps( (p) + 4, _mm_unpackhi_ps( (s), (t) ) ); \
+} while ( 0 )
+
+
+SHADE_TARGET("sse2")
+static void DeformScaled_SSE2( float *xyz, const float *normal, int numVerts, float scale )
+{
+	const __m128 s = _mm_setr_ps( scale, scale, scale, 0.0f );
+	int i;
+
+	for ( i = 0; i < numVerts; i++, xyz += 4, normal += 4 )
+		_mm_storeu_ps( xyz, _mm_add_ps( _mm_loadu_ps( xyz ), _mm_mul_ps( _mm_loadu_ps( normal ), s ) ) );
+}
+
+
+SHADE_TARGET("sse2")
+static void DeformWave_SSE2( float *xyz, const float *normal, int numVerts, const float *table,
+		float base, float amplitude, float phase, double timeFreq, float spread )
+{
+	const __m128 mask = _mm_castsi128_ps( _mm_setr_epi32( -1, -1, -1, 0 ) );
+	const __m128 vBase = _mm_set1_ps( base );
+	const __m128 vAmplitude = _mm_set1_ps( amplitude );
+	int i;
+
+	for ( i = 0; i < numVerts; i++, xyz += 4, normal += 4 )
+	{
+		// the table index has to stay in double like WAVEVALUE
+		__m128 p = _mm_loadu_ps( xyz );
+		float off = ( xyz[0] + xyz[1] + xyz[2] ) * spread;
+		__m128 w = _mm_load_ss( &table[( (int64_t)( ( ( phase + off ) + timeFreq ) * SHADE_FUNCTABLE_SIZE ) ) & SHADE_FUNCTABLE_MASK] );
+		__m128 scale = _mm_add_ps( vBase, _mm_mul_ps( _mm_shuffle_ps( w, w, 0 ), vAmplitude ) );
+
+		_mm_storeu_ps( xyz, _mm_add_ps( p, _mm_and_ps( _mm_mul_ps( _mm_loadu_ps( normal ), scale ), mask ) ) );
+	}
+}
+
+
+SHADE_TARGET("sse2")
+static void FillColors_SSE2( byte *colors, int numVerts, const byte rgba[4] )
+{
+	int c, i = 0;
+	__m128i v;
+
+	memcpy( &c, rgba, 4 );
+	v = _mm_set1_epi32( c );
+
+	for ( ; i + 4 <= numVerts; i += 4 )
+		_mm_storeu_si128( (__m128i *)( colors + i * 4 ), v );
+	for ( ; i < numVerts; i++ )
+		memcpy( colors + i * 4, &c, 4 );
+}
+
+
+SHADE_TARGET("sse2")
+static void Turbulent_SSE2( float *st, const float *xyz, int numVerts,
+		const float *sinTable, double now, float amplitude )
+{
+	const __m128d vNow = _mm_set1_pd( now );
+	const __m128d scale = _mm_set1_pd( 1.0 / 1024 );
+	const __m128d size = _mm_set1_pd( SHADE_FUNCTABLE_SIZE );
+	const __m128d limit = _mm_set1_pd( 2147483647.0 );
+	int i;
+
+	for ( i = 0; i < numVerts; i++, st += 2, xyz += 4 )
+	{
+		// s from x + z and t from y, both lanes in double
+		__m128d pos = _mm_cvtps_pd( _mm_setr_ps( xyz[0] + xyz[2], xyz[1], 0, 0 ) );
+		__m128d f = _mm_mul_pd( _mm_add_pd( _mm_mul_pd( pos, scale ), vNow ), size );
+		int i0, i1;
+
+		if ( _mm_movemask_pd( _mm_cmpnlt_pd( _mm_andnot_pd( _mm_set1_pd( -0.0 ), f ), limit ) ) == 0 )
+		{
+			__m128i idx = _mm_cvttpd_epi32( f );
+			i0 = _mm_cvtsi128_si32( idx );
+			i1 = _mm_cvtsi128_si32( _mm_srli_si128( idx, 4 ) );
+		}
+		else
+		{
+			// shader time far out of int range, truncate through int64 like the C version
+			double d[2];
+
+			_mm_storeu_pd( d, f );
+			i0 = (int)( (int64_t)d[0] & SHADE_FUNCTABLE_MASK );
+			i1 = (int)( (int64_t)d[1] & SHADE_FUNCTABLE_MASK );
+		}
+
+		st[0] += sinTable[i0 & SHADE_FUNCTABLE_MASK] * amplitude;
+		st[1] += sinTable[i1 & SHADE_FUNCTABLE_MASK] * amplitude;
+	}
+}
+
+
+SHADE_TARGET("sse2")
+static void Environment_SSE2( float *st, const float *xyz, const float *normal, int numVerts,
+		const vec3_t viewOrigin )
+{
+	const __m128 ox = _mm_set1_ps( viewOrigin[0] );
+	const __m128 oy = _mm_set1_ps( viewOrigin[1] );
+	const __m128 oz = _mm_set1_ps( viewOrigin[2] );
+	const __m128 one = _mm_set1_ps( 1.0f );
+	const __m128 two = _mm_set1_ps( 2.0f );
+	const __m128 half = _mm_set1_ps( 0.5f );
+	int i;
+
+	for ( i = 0; i + 4 <= numVerts; i += 4, xyz += 16, normal += 16, st += 8 )
+	{
+		__m128 px, py, pz, nx, ny, nz, vx, vy, vz, invLen, d;
+
+		LOAD_XYZ4( xyz, px, py, pz );
+		LOAD_XYZ4( normal, nx, ny, nz );
+
+		vx = _mm_sub_ps( ox, px );
+		vy = _mm_sub_ps( oy, py );
+		vz = _mm_sub_ps( oz, pz );
+
+		invLen = _mm_add_ps( _mm_add_ps( _mm_mul_ps( vx, vx ), _mm_mul_ps( vy, vy ) ), _mm_mul_ps( vz, vz ) );
+		invLen = _mm_div_ps( one, _mm_sqrt_ps( invLen ) );
+		vx = _mm_mul_ps( vx, invLen );
+		vy = _mm_mul_ps( vy, invLen );
+		vz = _mm_mul_ps( vz, invLen );
+
+		d = _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, vx ), _mm_mul_ps( ny, vy ) ), _mm_mul_ps( nz, vz ) );
+
+		// reflected y and z
+		vy = _mm_sub_ps( _mm_mul_ps( _mm_mul_ps( ny, two ), d ), vy );
+		vz = _mm_sub_ps( _mm_mul_ps( _mm_mul_ps( nz, two ), d ), vz );
+
+		STORE_ST4( st, _mm_add_ps( half, _mm_mul_ps( vy, half ) ), _mm_sub_ps( half, _mm_mul_ps( vz, half ) ) );
+	}
+
+	Environment_C( st, xyz, normal, numVerts - i, viewOrigin );
+}
+
+
+SHADE_TARGET("sse2")
+static void Diffuse_SSE2( byte *colors, const float *normal, int numVerts,
+		const vec3_t ambientLight, const vec3_t directedLight, const vec3_t lightDir,
+		const byte ambientRGBA[4] )
+{
+	const __m128 lx = _mm_set1_ps( lightDir[0] );
+	const __m128 ly = _mm_set1_ps( lightDir[1] );
+	const __m128 lz = _mm_set1_ps( lightDir[2] );
+	const __m128 ambient = _mm_setr_ps( ambientLight[0], ambientLight[1], ambientLight[2], 255.0f );
+	const __m128 directed = _mm_setr_ps( directedLight[0], directedLight[1], directedLight[2], 0.0f );
+	const __m128 max = _mm_set1_ps( 255.0f );
+	int i, amb;
+
+	memcpy( &amb, ambientRGBA, 4 );
+
+	for ( i = 0; i + 4 <= numVerts; i += 4, normal += 16, colors += 16 )
+	{
+		__m128 nx, ny, nz, incoming, c[4];
+		__m128i rgba, lit, unlit;
+		float in[4];
+		int j;
+
+		LOAD_XYZ4( normal, nx, ny, nz );
+		incoming = _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, lx ), _mm_mul_ps( ny, ly ) ), _mm_mul_ps( nz, lz ) );
+		_mm_storeu_ps( in, incoming );
+
+		// ambient + incoming * directed per vertex, alpha stays 255
+		for ( j = 0; j < 4; j++ )
+		{
+			c[j] = _mm_add_ps( ambient, _mm_mul_ps( _mm_set1_ps( in[j] ), directed ) );
+			c[j] = _mm_min_ps( c[j], max );
+		}
+
+		// values are in 0..255 once the unlit ones are replaced, so the packs don't saturate
+		rgba = _mm_packs_epi32( _mm_cvttps_epi32( c[0] ), _mm_cvttps_epi32( c[1] ) );
+		lit = _mm_packus_epi16( rgba, _mm_packs_epi32( _mm_cvttps_epi32( c[2] ), _mm_cvttps_epi32( c[3] ) ) );
+
+		unlit = _mm_castps_si128( _mm_cmple_ps( incoming, _mm_setzero_ps() ) );
+		lit = _mm_or_si128( _mm_andnot_si128( unlit, lit ), _mm_and_si128( unlit, _mm_set1_epi32( amb ) ) );
+
+		_mm_storeu_si128( (__m128i *)colors, lit );
+	}
+
+	Diffuse_C( colors, normal, numVerts - i, ambientLight, directedLight, lightDir, ambientRGBA );
+}
+
+
+SHADE_TARGET("sse2")
+static void FogTexCoords_SSE2( float *st, const float *xyz, int numVerts,
+		const vec4_t distanceVector, const vec4_t depthVector, float eyeT )
+{
+	const __m128 sx = _mm_set1_ps( distanceVector[0] ), sy = _mm_set1_ps( distanceVector[1] );
+	const __m128 sz = _mm_set1_ps( distanceVector[2] ), sw = _mm_set1_ps( distanceVector[3] );
+	const __m128 tx = _mm_set1_ps( depthVector[0] ), ty = _mm_set1_ps( depthVector[1] );
+	const __m128 tz = _mm_set1_ps( depthVector[2] ), tw = _mm_set1_ps( depthVector[3] );
+	const __m128 vEyeT = _mm_set1_ps( eyeT );
+	const __m128 outside = _mm_set1_ps( 1.0f / 32 );
+	const __m128 inside = _mm_set1_ps( 31.0f / 32 );
+	const __m128 clip = _mm_set1_ps( 30.0f / 32 );
+	const __m128 one = _mm_set1_ps( 1.0f );
+	int i;
+
+	for ( i = 0; i + 4 <= numVerts; i += 4, xyz += 16, st += 8 )
+	{
+		__m128 px, py, pz, s, t, cut;
+
+		LOAD_XYZ4( xyz, px, py, pz );
+
+		s = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( px, sx ), _mm_mul_ps( py, sy ) ), _mm_mul_ps( pz, sz ) ), sw );
+		t = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( px, tx ), _mm_mul_ps( py, ty ) ), _mm_mul_ps( pz, tz ) ), tw );
+
+		if ( eyeT < 0 )
+		{
+			// t >= 1 is always past the eye, so the divide can't hit zero on those lanes
+			cut = _mm_cmplt_ps( t, one );
+			t = _mm_add_ps( outside, _mm_div_ps( _mm_mul_ps( clip, t ), _mm_sub_ps( t, vEyeT ) ) );
+			t = _mm_or_ps( _mm_and_ps( cut, outside ), _mm_andnot_ps( cut, t ) );
+		}
+		else
+		{
+			cut = _mm_cmplt_ps( t, _mm_setzero_ps() );
+			t = _mm_or_ps( _mm_and_ps( cut, outside ), _mm_andnot_ps( cut, inside ) );
+		}
+
+		STORE_ST4( st, s, t );
+	}
+
+	FogTexCoords_C( st, xyz, numVerts - i, distanceVector, depthVector, eyeT );
+}
+
+
+SHADE_TARGET("sse2")
+static void ModulateByFog_SSE2( byte *colors, const float *st, int numVerts, const float *fogTable,
+		qboolean rgb, qboolean alpha )
+{
+	const __m128 bias = _mm_set1_ps( 1.0f / 512 );
+	const __m128 tMin = _mm_set1_ps( 1.0f / 32 );
+	const __m128 tMax = _mm_set1_ps( 31.0f / 32 );
+	const __m128 tRange = _mm_set1_ps( 30.0f / 32 );
+	const __m128 one = _mm_set1_ps( 1.0f );
+	const __m128 eight = _mm_set1_ps( 8.0f );
+	const __m128 tableMax = _mm_set1_ps( SHADE_FOG_TABLE_SIZE - 1 );
+	const __m128 channels = _mm_castsi128_ps( _mm_setr_epi32( rgb ? -1 : 0, rgb ? -1 : 0, rgb ? -1 : 0, alpha ? -1 : 0 ) );
+	const __m128i zero = _mm_setzero_si128();
+	int i;
+
+	for ( i = 0; i + 4 <= numVerts; i += 4, st += 8, colors += 16 )
+	{
+		__m128 st0 = _mm_loadu_ps( st ), st1 = _mm_loadu_ps( st + 4 );
+		__m128 s = _mm_shuffle_ps( st0, st1, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+		__m128 t = _mm_shuffle_ps( st0, st1, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+		__m128 fog, scaled, c[4];
+		__m128i raw, lo, hi, out0, out1;
+		float density[4], f[4];
+		int idx[4], j;
+
+		// R_FogFactor with its early outs as a mask
+		s = _mm_sub_ps( s, bias );
+		fog = _mm_or_ps( _mm_cmplt_ps( s, _mm_setzero_ps() ), _mm_cmplt_ps( t, tMin ) );
+
+		scaled = _mm_mul_ps( s, _mm_div_ps( _mm_sub_ps( t, tMin ), tRange ) );
+		scaled = _mm_or_ps( _mm_and_ps( _mm_cmplt_ps( t, tMax ), scaled ), _mm_andnot_ps( _mm_cmplt_ps( t, tMax ), s ) );
+		scaled = _mm_min_ps( _mm_mul_ps( scaled, eight ), one );
+		scaled = _mm_andnot_ps( fog, scaled );
+		_mm_storeu_si128( (__m128i *)idx, _mm_cvttps_epi32( _mm_mul_ps( scaled, tableMax ) ) );
+
+		for ( j = 0; j < 4; j++ )
+			density[j] = fogTable[idx[j]];
+		_mm_storeu_ps( f, _mm_sub_ps( one, _mm_andnot_ps( fog, _mm_loadu_ps( density ) ) ) );
+
+		raw = _mm_loadu_si128( (const __m128i *)colors );
+		lo = _mm_unpacklo_epi8( raw, zero );
+		hi = _mm_unpackhi_epi8( raw, zero );
+
+		// one vertex per register, the multiplier is f on the selected channels and 1 elsewhere
+		c[0] = _mm_cvtepi32_ps( _mm_unpacklo_epi16( lo, zero ) );
+		c[1] = _mm_cvtepi32_ps( _mm_unpackhi_epi16( lo, zero ) );
+		c[2] = _mm_cvtepi32_ps( _mm_unpacklo_epi16( hi, zero ) );
+		c[3] = _mm_cvtepi32_ps( _mm_unpackhi_epi16( hi, zero ) );
+
+		for ( j = 0; j < 4; j++ )
+		{
+			__m128 fj = _mm_set1_ps( f[j] );
+
+			c[j] = _mm_mul_ps( c[j], _mm_or_ps( _mm_and_ps( channels, fj ), _mm_andnot_ps( channels, one ) ) );
+		}
+
+		out0 = _mm_packs_epi32( _mm_cvttps_epi32( c[0] ), _mm_cvttps_epi32( c[1] ) );
+		out1 = _mm_packs_epi32( _mm_cvttps_epi32( c[2] ), _mm_cvttps_epi32( c[3] ) );
+		_mm_storeu_si128( (__m128i *)colors, _mm_packus_epi16( out0, out1 ) );
+	}
+
+	ModulateByFog_C( colors, st, numVerts - i, fogTable, rgb, alpha );
+}
+
+
+static const shadeKernels_t s_kernelsSSE2 = {
+	DeformScaled_SSE2, DeformWave_SSE2, FillColors_SSE2, Turbulent_SSE2, Environment_SSE2,
+	Diffuse_SSE2, FogTexCoords_SSE2, ModulateByFog_SSE2, "SSE2"
+};
+
+
+static qboolean R_CpuHasSSE2( void )
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return qtrue;
+#elif defined(_MSC_VER)
+	int regs[4];
+	__cpuid( regs, 1 );
+	return ( regs[3] & ( 1 << 26 ) ) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports( "sse2" ) ? qtrue : qfalse;
+#endif
+}
+
+#endif // SHADE_X86
+
+
+static const shadeKernels_t *s_kernels = &s_kernelsC;
+
+
+void R_InitShadeKernels( qboolean allowSIMD )
+{
+	s_kernels = &s_kernelsC;
+
+#ifdef SHADE_X86
+	if ( allowSIMD && R_CpuHasSSE2() )
+		s_kernels = &s_kernelsSSE2;
+#endif
+}
+
+
+const char *R_ShadeKernelsImplementation( void )
+{
+	return s_kernels->name;
+}
+
+
+void R_DeformVertexesScaled( float *xyz, const float *normal, int numVerts, float scale )
+{
+	s_kernels->deformScaled( xyz, normal, numVerts, scale );
+}
+
+
+void R_DeformVertexesWave( float *xyz, const float *normal, int numVerts, const float *table,
+		float base, float amplitude, float phase, double timeFreq, float spread )
+{
+	s_kernels->deformWave( xyz, normal, numVerts, table, base, amplitude, phase, timeFreq, spread );
+}
+
+
+void R_FillColors( byte *colors, int numVerts, const byte rgba[4] )
+{
+	s_kernels->fillColors( colors, numVerts, rgba );
+}
+
+
+void R_FillAlphas( byte *colors, int numVerts, byte alpha )
+{
+	int i;
+
+	// a byte store every 4 bytes, the compiler does as well as intrinsics here
+	for ( i = 0; i < numVerts; i++ )
+		colors[i * 4 + 3] = alpha;
+}
+
+
+void R_TurbulentTexCoords( float *st, const float *xyz, int numVerts,
+		const float *sinTable, double now, float amplitude )
+{
+	s_kernels->turbulent( st, xyz, numVerts, sinTable, now, amplitude );
+}
+
+
+void R_EnvironmentTexCoords( float *st, const float *xyz, const float *normal, int numVerts,
+		const vec3_t viewOrigin )
+{
+	s_kernels->environment( st, xyz, normal, numVerts, viewOrigin );
+}
+
+
+void R_DiffuseColors( byte *colors, const float *normal, int numVerts,
+		const vec3_t ambientLight, const vec3_t directedLight, const vec3_t lightDir,
+		const byte ambientRGBA[4] )
+{
+	s_kernels->diffuse( colors, normal, numVerts, ambientLight, directedLight, lightDir, ambientRGBA );
+}
+
+
+void R_FogTexCoords( float *st, const float *xyz, int numVerts,
+		const vec4_t distanceVector, const vec4_t depthVector, float eyeT )
+{
+	s_kernels->fogTexCoords( st, xyz, numVerts, distanceVector, depthVector, eyeT );
+}
+
+
+void R_ModulateByFog( byte *colors, const float *st, int numVerts, const float *fogTable,
+		qboolean rgb, qboolean alpha )
+{
+	s_kernels->modulateByFog( colors, st, numVerts, fogTable, rgb, alpha );
+}
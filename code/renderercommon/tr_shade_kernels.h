@@ -0,0 +1,58 @@
+#ifndef TR_SHADE_KERNELS_H_
+#define TR_SHADE_KERNELS_H_
+
+#include "../qcommon/q_shared.h"
+
+/*
+ * Per vertex loops of shader stage evaluation shared by the renderers.
+ *
+ * Positions and normals are vec4 strided like tess.xyz and tess.normal,
+ * colors are 4 bytes per vertex and texture coordinates 2 floats.
+ * The plain C versions are the reference, SSE2 versions are used on
+ * x86 after R_InitShadeKernels( qtrue ). They keep the operation
+ * order of the reference, so results only differ where the compiler
+ * reorders the C math (-ffast-math).
+ */
+
+// must match FUNCTABLE_SIZE and FOG_TABLE_SIZE of the renderers
+#define SHADE_FUNCTABLE_SIZE	1024
+#define SHADE_FUNCTABLE_MASK	( SHADE_FUNCTABLE_SIZE - 1 )
+#define SHADE_FOG_TABLE_SIZE	256
+
+void R_InitShadeKernels( qboolean allowSIMD );
+
+// name of the implementation in use, for gfxinfo
+const char *R_ShadeKernelsImplementation( void );
+
+// xyz += normal * scale
+void R_DeformVertexesScaled( float *xyz, const float *normal, int numVerts, float scale );
+
+// xyz += normal * ( base + table[ phase + ( x + y + z ) * spread + timeFreq ] * amplitude )
+// timeFreq is shaderTime * frequency, the table index is taken like WAVEVALUE does
+void R_DeformVertexesWave( float *xyz, const float *normal, int numVerts, const float *table,
+		float base, float amplitude, float phase, double timeFreq, float spread );
+
+void R_FillColors( byte *colors, int numVerts, const byte rgba[4] );
+void R_FillAlphas( byte *colors, int numVerts, byte alpha );
+
+// st += sinTable[ position / 1024 + now ] * amplitude, s from x + z and t from y
+void R_TurbulentTexCoords( float *st, const float *xyz, int numVerts,
+		const float *sinTable, double now, float amplitude );
+
+void R_EnvironmentTexCoords( float *st, const float *xyz, const float *normal, int numVerts,
+		const vec3_t viewOrigin );
+
+// ambient + directed * ( normal . lightDir ), ambientRGBA where the normal faces away
+void R_DiffuseColors( byte *colors, const float *normal, int numVerts,
+		const vec3_t ambientLight, const vec3_t directedLight, const vec3_t lightDir,
+		const byte ambientRGBA[4] );
+
+// the eye is outside of the fog volume when eyeT < 0
+void R_FogTexCoords( float *st, const float *xyz, int numVerts,
+		const vec4_t distanceVector, const vec4_t depthVector, float eyeT );
+
+// scales rgb and/or alpha by 1 - fog density of the fog texture coordinates
+void R_ModulateByFog( byte *colors, const float *st, int numVerts, const float *fogTable,
+		qboolean rgb, qboolean alpha );
+
+#endif
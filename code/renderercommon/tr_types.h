@@ -207,7 +207,7 @@ typedef struct {
     // synonymous with "does rendering consume the entire screen?"
     qboolean				isFullscreen;
 	qboolean				stereoDisabled;
-	qboolean				smpActive;		// UNUSED, present for compatibility
+	qboolean				smpActive;		// dual processor, render thread running
 
 } glconfig_t;
 
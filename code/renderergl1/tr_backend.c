@@ -540,6 +540,8 @@ static const void *RB_ClearDepth(const void *data)
 
 static const void* RB_SwapBuffers( const void *data )
 {
+	int64_t t1;
+
 	// finish any 2D drawing if needed
 	if ( tess.numIndexes )
     {
@@ -575,12 +577,16 @@ static const void* RB_SwapBuffers( const void *data )
 	}
 
 
+	t1 = ri.Microseconds();
+
 	if ( !glState.finishCalled ) {
 		qglFinish();
 	}
 
 	GLimp_EndFrame();
 
+	backEnd.swapUsec = ri.Microseconds() - t1;
+
 	backEnd.projection2D = qfalse;
 
 
@@ -1094,6 +1100,13 @@ void RB_ShowImages(void)
 void RB_ExecuteRenderCommands(const void *data)
 {
 	int	t1 = ri.Milliseconds();
+
+	if ( !glConfig.smpActive || data == backEndData[0]->commands.cmds ) {
+		backEnd.smpFrame = 0;
+	} else {
+		backEnd.smpFrame = 1;
+	}
+
 	while( 1 )
     {
 		data = PADP(data, sizeof(void *));
@@ -1125,3 +1138,29 @@ void RB_ExecuteRenderCommands(const void *data)
 		}
 	}
 }
+
+
+/*
+================
+RB_RenderThread
+================
+*/
+void RB_RenderThread( void ) {
+	const void	*data;
+
+	// wait for either a rendering command or a quit command
+	while ( 1 ) {
+		// sleep until we have work to do
+		data = GLimp_RendererSleep();
+
+		if ( !data ) {
+			return;	// all done, renderer is shutting down
+		}
+
+		renderThreadActive = qtrue;
+
+		RB_ExecuteRenderCommands( data );
+
+		renderThreadActive = qfalse;
+	}
+}
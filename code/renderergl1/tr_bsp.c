@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_map.c
 
 #include "tr_local.h"
+#include "../renderercommon/tr_jobs.h"
 
 
 
@@ -1440,6 +1441,37 @@ static void R_LoadShaders( lump_t *l )
 	}
 }
 
+/*
+=================
+R_PrefetchWorldImages
+
+Decodes the images of the world shaders on the job threads before
+R_LoadSurfaces loads them one at a time through R_FindShader.
+=================
+*/
+static void R_PrefetchWorldImages( void )
+{
+	imageRequest_t	*requests;
+	int			i, numRequests;
+
+	if ( R_NumJobThreads() < 2 )
+		return;
+
+	requests = ri.Hunk_AllocateTempMemory( MAX_DRAWIMAGES * sizeof( *requests ) );
+
+	numRequests = 0;
+	for ( i = 0 ; i < s_worldData.numShaders ; i++ )
+	{
+		numRequests += R_ShaderImages( s_worldData.shaders[i].shader, qtrue,
+			requests + numRequests, MAX_DRAWIMAGES - numRequests );
+	}
+
+	R_PrefetchImages( requests, numRequests );
+
+	ri.Hunk_FreeTempMemory( requests );
+}
+
+
 
 /*
 =================
@@ -1816,6 +1848,7 @@ void RE_LoadWorldMap( const char *name ) {
 
     // load into heap
 	R_LoadShaders( &header->lumps[LUMP_SHADERS] );
+	R_PrefetchWorldImages();
 	R_LoadLightmaps( &header->lumps[LUMP_LIGHTMAPS] );
 	R_LoadPlanes (&header->lumps[LUMP_PLANES]);
 	R_LoadFogs( &header->lumps[LUMP_FOGS], &header->lumps[LUMP_BRUSHES], &header->lumps[LUMP_BRUSHSIDES] );
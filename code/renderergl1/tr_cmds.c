@@ -20,8 +20,17 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 #include "tr_local.h"
+#include "../renderercommon/tr_capture.h"
 
-backEndData_t* backEndData;
+backEndData_t	*backEndData[SMP_FRAMES];
+
+volatile qboolean	renderThreadActive;
+
+// qtrue while the render thread is idle and the front end owns the context
+static qboolean	r_frontEndOwnsContext = qtrue;
+
+// the next command list has to finish before the front end continues
+static qboolean	r_syncNextIssue;
 
 /*
 =====================
@@ -72,15 +81,55 @@ void R_PerformanceCounters( void ) {
 }
 
 
+/*
+====================
+R_InitCommandBuffers
+====================
+*/
+void R_InitCommandBuffers( void ) {
+	glConfig.smpActive = qfalse;
+	r_frontEndOwnsContext = qtrue;
+	r_syncNextIssue = qfalse;
+
+	if ( r_smp->integer && backEndData[1] ) {
+		ri.Printf( PRINT_ALL, "Trying SMP acceleration...\n" );
+		if ( GLimp_SpawnRenderThread( RB_RenderThread ) ) {
+			ri.Printf( PRINT_ALL, "...succeeded.\n" );
+			glConfig.smpActive = qtrue;
+		} else {
+			ri.Printf( PRINT_ALL, "...failed.\n" );
+		}
+	}
+}
+
+/*
+====================
+R_ShutdownCommandBuffers
+====================
+*/
+void R_ShutdownCommandBuffers( void ) {
+	// kill the rendering thread
+	if ( glConfig.smpActive ) {
+		GLimp_WakeRenderer( NULL );
+		glConfig.smpActive = qfalse;
+	}
+	r_frontEndOwnsContext = qtrue;
+	tr.smpFrame = 0;
+}
+
+
 /*
 ====================
 R_IssueRenderCommands
 ====================
 */
+int	c_blockedOnRender;
+int	c_blockedOnMain;
+
 void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 	renderCommandList_t	*cmdList;
 
-	cmdList = &backEndData->commands;
+	cmdList = &backEndData[tr.smpFrame]->commands;
 	assert(cmdList);
 	// add an end-of-list command
 	*(int *)(cmdList->cmds + cmdList->used) = RC_END_OF_LIST;
@@ -88,6 +137,21 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 	// clear it out, in case this is a sync and not a buffer flip
 	cmdList->used = 0;
 
+	if ( glConfig.smpActive ) {
+		// if the render thread is not idle, wait for it
+		if ( renderThreadActive ) {
+			c_blockedOnRender++;
+		} else {
+			c_blockedOnMain++;
+		}
+
+		// sleep until the renderer has completed
+		GLimp_FrontEndSleep();
+		r_frontEndOwnsContext = qtrue;
+	}
+
+	// at this point, the back end thread is idle, so it is ok
+	// to look at its performance counters
 	if ( runPerformanceCounters ) {
 		R_PerformanceCounters();
 	}
@@ -95,8 +159,22 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 	// actually start the commands going
 	if ( !r_skipBackEnd->integer ) {
 		// let it start on the new batch
-		RB_ExecuteRenderCommands( cmdList->cmds );
+		if ( !glConfig.smpActive ) {
+			RB_ExecuteRenderCommands( cmdList->cmds );
+		} else {
+			GLimp_WakeRenderer( cmdList );
+			r_frontEndOwnsContext = qfalse;
+
+			// screenshots use temp hunk memory and the filesystem,
+			// so don't run the front end next to them
+			if ( r_syncNextIssue || r_measureOverdraw->integer ) {
+				GLimp_FrontEndSleep();
+				r_frontEndOwnsContext = qtrue;
+			}
+		}
 	}
+
+	r_syncNextIssue = qfalse;
 }
 
 
@@ -105,13 +183,57 @@ void R_IssueRenderCommands( qboolean runPerformanceCounters ) {
 R_IssuePendingRenderCommands
 
 Issue any pending commands and wait for them to complete.
+After exiting, the render thread will have completed its work
+and will remain idle and the main thread is free to issue
+OpenGL calls until R_IssueRenderCommands is called.
 ====================
 */
 void R_IssuePendingRenderCommands( void ) {
 	if ( !tr.registered ) {
 		return;
 	}
+
+	// nothing queued since the last flip, just wait for the render thread
+	if ( glConfig.smpActive && !backEndData[tr.smpFrame]->commands.used ) {
+		R_SyncRenderThread();
+		return;
+	}
+
 	R_IssueRenderCommands( qfalse );
+
+	R_SyncRenderThread();
+}
+
+
+/*
+====================
+R_SyncRenderThread
+
+Wait for the render thread to finish the previous frame without
+flushing the commands the front end is still building, so tr.images
+and tr.sortedShaders can be changed
+====================
+*/
+void R_SyncRenderThread( void ) {
+	if ( !glConfig.smpActive || r_frontEndOwnsContext ) {
+		return;
+	}
+
+	GLimp_FrontEndSleep();
+	r_frontEndOwnsContext = qtrue;
+}
+
+
+/*
+====================
+R_SyncNextIssue
+
+The command list being built has to be completed before
+the front end goes on with the next frame
+====================
+*/
+void R_SyncNextIssue( void ) {
+	r_syncNextIssue = qtrue;
 }
 
 /*
@@ -122,7 +244,7 @@ make sure there is enough command space
 ============
 */
 void *R_GetCommandBufferReserved( int bytes, int reservedBytes ) {
-	renderCommandList_t	*cmdList = &backEndData->commands;
+	renderCommandList_t	*cmdList = &backEndData[tr.smpFrame]->commands;
 	bytes = PAD(bytes, sizeof(void *));
 
 	// always leave room for the end of list command
@@ -223,6 +345,7 @@ void RE_StretchPic ( float x, float y, float w, float h,
 	}
 	cmd->commandId = RC_STRETCH_PIC;
 	cmd->shader = R_GetShaderByHandle( hShader );
+	R_NoteShaderImages( cmd->shader );
 	cmd->x = x;
 	cmd->y = y;
 	cmd->w = w;
@@ -249,6 +372,8 @@ void RE_BeginFrame(void) {
 	}
 	glState.finishCalled = qfalse;
 
+	R_UpdateResidency();
+
 	tr.frameCount++;
 	tr.frameSceneNum = 0;
 
@@ -345,6 +470,8 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec ) {
 
 	R_InitNextFrame();
 
+	R_ReportCaptureDrops();
+
 	if ( frontEndMsec ) {
 		*frontEndMsec = tr.frontEndMsec;
 	}
@@ -355,6 +482,15 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec ) {
 	backEnd.pc.msec = 0;
 }
 
+/*
+=============
+RE_SwapMicroseconds
+=============
+*/
+int RE_SwapMicroseconds( void ) {
+	return backEnd.swapUsec;
+}
+
 /*
 =============
 RE_TakeVideoFrame
@@ -382,3 +518,21 @@ void RE_TakeVideoFrame( int width, int height,
 	cmd->encodeBuffer = encodeBuffer;
 	cmd->motionJpeg = motionJpeg;
 }
+
+/*
+=============
+RE_FinishVideoFrames
+
+Frames are read back a few frames late and encoded on the capture
+threads, the client calls this before it closes the video
+=============
+*/
+void RE_FinishVideoFrames( void )
+{
+	if( !tr.registered ) {
+		return;
+	}
+
+	R_IssuePendingRenderCommands();
+	RB_FinishVideoFrames();
+}
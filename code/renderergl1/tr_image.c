@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_image.c
 #include "tr_local.h"
 #include "../renderercommon/image_loader.h"
+#include "../renderercommon/tr_image_kernels.h"
 extern void (APIENTRYP qglActiveTextureARB) (GLenum texture);
 
 
@@ -46,6 +47,15 @@ void R_GammaCorrect( byte *buffer, int bufSize ) {
 	}
 }
 
+/*
+** R_GammaTable
+**
+** For correcting video frames on the capture threads
+*/
+const byte *R_GammaTable( void ) {
+	return s_gammatable;
+}
+
 typedef struct {
 	char *name;
 	int	minimize, maximize;
@@ -154,42 +164,10 @@ before or after.
 */
 static void ResampleTexture( unsigned *in, int inwidth, int inheight, unsigned *out,  
 							int outwidth, int outheight ) {
-	int		i, j;
-	unsigned	*inrow, *inrow2;
-	unsigned	frac, fracstep;
-	unsigned	p1[2048], p2[2048];
-	byte		*pix1, *pix2, *pix3, *pix4;
-
-	if (outwidth>2048)
+	if (outwidth>IMAGE_RESAMPLE_MAX_WIDTH)
 		ri.Error(ERR_DROP, "ResampleTexture: max width");
-								
-	fracstep = inwidth*0x10000/outwidth;
-
-	frac = fracstep>>2;
-	for ( i=0 ; i<outwidth ; i++ ) {
-		p1[i] = 4*(frac>>16);
-		frac += fracstep;
-	}
-	frac = 3*(fracstep>>2);
-	for ( i=0 ; i<outwidth ; i++ ) {
-		p2[i] = 4*(frac>>16);
-		frac += fracstep;
-	}
-
-	for (i=0 ; i<outheight ; i++, out += outwidth) {
-		inrow = in + inwidth*(int)((i+0.25)*inheight/outheight);
-		inrow2 = in + inwidth*(int)((i+0.75)*inheight/outheight);
-		for (j=0 ; j<outwidth ; j++) {
-			pix1 = (byte *)inrow + p1[j];
-			pix2 = (byte *)inrow + p2[j];
-			pix3 = (byte *)inrow2 + p1[j];
-			pix4 = (byte *)inrow2 + p2[j];
-			((byte *)(out+j))[0] = (pix1[0] + pix2[0] + pix3[0] + pix4[0])>>2;
-			((byte *)(out+j))[1] = (pix1[1] + pix2[1] + pix3[1] + pix4[1])>>2;
-			((byte *)(out+j))[2] = (pix1[2] + pix2[2] + pix3[2] + pix4[2])>>2;
-			((byte *)(out+j))[3] = (pix1[3] + pix2[3] + pix3[3] + pix4[3])>>2;
-		}
-	}
+
+	R_ResampleImage( (const byte *)in, inwidth, inheight, (byte *)out, outwidth, outheight );
 }
 
 /*
@@ -202,159 +180,42 @@ lighting range
 */
 void R_LightScaleTexture (unsigned *in, int inwidth, int inheight, qboolean only_gamma )
 {
-	if ( only_gamma )
-	{
-		if ( !glConfig.deviceSupportsGamma )
-		{
-			int		i, c;
-			byte	*p;
-
-			p = (byte *)in;
+	byte	table[256];
+	int		i, identity;
 
-			c = inwidth*inheight;
-			for (i=0 ; i<c ; i++, p+=4)
-			{
-				p[0] = s_gammatable[p[0]];
-				p[1] = s_gammatable[p[1]];
-				p[2] = s_gammatable[p[2]];
-			}
-		}
-	}
-	else
+	// fold the gamma and intensity tables into one lookup
+	identity = 0;
+	for ( i = 0 ; i < 256 ; i++ )
 	{
-		int		i, c;
-		byte	*p;
+		int c = i;
 
-		p = (byte *)in;
-
-		c = inwidth*inheight;
+		if ( !only_gamma )
+			c = s_intensitytable[c];
+		if ( !glConfig.deviceSupportsGamma )
+			c = s_gammatable[c];
 
-		if ( glConfig.deviceSupportsGamma )
-		{
-			for (i=0 ; i<c ; i++, p+=4)
-			{
-				p[0] = s_intensitytable[p[0]];
-				p[1] = s_intensitytable[p[1]];
-				p[2] = s_intensitytable[p[2]];
-			}
-		}
-		else
-		{
-			for (i=0 ; i<c ; i++, p+=4)
-			{
-				p[0] = s_gammatable[s_intensitytable[p[0]]];
-				p[1] = s_gammatable[s_intensitytable[p[1]]];
-				p[2] = s_gammatable[s_intensitytable[p[2]]];
-			}
-		}
+		table[i] = c;
+		identity += ( c == i );
 	}
-}
-
-
-
-/*
-================
-R_MipMap2
-
-Operates in place, quartering the size of the texture Proper linear filter
-================
-*/
-static void R_MipMap2( unsigned *in, int inWidth, int inHeight )
-{
-	int			i, j, k;
-	int			inWidthMask, inHeightMask;
-	int			outWidth, outHeight;
-	unsigned	*temp;
 
-	outWidth = inWidth >> 1;
-	outHeight = inHeight >> 1;
-	temp = ri.Hunk_AllocateTempMemory( outWidth * outHeight * 4 );
-
-	inWidthMask = inWidth - 1;
-	inHeightMask = inHeight - 1;
-
-	for ( i = 0 ; i < outHeight ; i++ ) {
-		for ( j = 0 ; j < outWidth ; j++ )
-        {
-			unsigned char* outpix = (unsigned char*) ( temp + i * outWidth + j );
-			for ( k = 0 ; k < 4 ; k++ )
-            {
-				int total = 
-					1 * ((byte *)&in[ ((i*2-1)&inHeightMask)*inWidth + ((j*2-1)&inWidthMask) ])[k] +
-					2 * ((byte *)&in[ ((i*2-1)&inHeightMask)*inWidth + ((j*2)&inWidthMask) ])[k] +
-					2 * ((byte *)&in[ ((i*2-1)&inHeightMask)*inWidth + ((j*2+1)&inWidthMask) ])[k] +
-					1 * ((byte *)&in[ ((i*2-1)&inHeightMask)*inWidth + ((j*2+2)&inWidthMask) ])[k] +
-
-					2 * ((byte *)&in[ ((i*2)&inHeightMask)*inWidth + ((j*2-1)&inWidthMask) ])[k] +
-					4 * ((byte *)&in[ ((i*2)&inHeightMask)*inWidth + ((j*2)&inWidthMask) ])[k] +
-					4 * ((byte *)&in[ ((i*2)&inHeightMask)*inWidth + ((j*2+1)&inWidthMask) ])[k] +
-					2 * ((byte *)&in[ ((i*2)&inHeightMask)*inWidth + ((j*2+2)&inWidthMask) ])[k] +
-
-					2 * ((byte *)&in[ ((i*2+1)&inHeightMask)*inWidth + ((j*2-1)&inWidthMask) ])[k] +
-					4 * ((byte *)&in[ ((i*2+1)&inHeightMask)*inWidth + ((j*2)&inWidthMask) ])[k] +
-					4 * ((byte *)&in[ ((i*2+1)&inHeightMask)*inWidth + ((j*2+1)&inWidthMask) ])[k] +
-					2 * ((byte *)&in[ ((i*2+1)&inHeightMask)*inWidth + ((j*2+2)&inWidthMask) ])[k] +
-
-					1 * ((byte *)&in[ ((i*2+2)&inHeightMask)*inWidth + ((j*2-1)&inWidthMask) ])[k] +
-					2 * ((byte *)&in[ ((i*2+2)&inHeightMask)*inWidth + ((j*2)&inWidthMask) ])[k] +
-					2 * ((byte *)&in[ ((i*2+2)&inHeightMask)*inWidth + ((j*2+1)&inWidthMask) ])[k] +
-					1 * ((byte *)&in[ ((i*2+2)&inHeightMask)*inWidth + ((j*2+2)&inWidthMask) ])[k];
-				outpix[k] = total / 36;
-			}
-		}
-	}
+	if ( identity == 256 )
+		return;
 
-	memcpy( in, temp, outWidth * outHeight * 4 );
-	ri.Hunk_FreeTempMemory( temp );
+	R_LightScaleImage( (byte *)in, (const byte *)in, inwidth*inheight, table );
 }
 
+
 /*
 ================
-R_MipMap: Operates in place, quartering the size of the texture
+R_MipMap: Quarters the size of the texture into out, which must not be in
 ================
 */
-static void R_MipMap(unsigned char *in, int width, int height)
+static void R_MipMap(const unsigned char *in, int width, int height, unsigned char *out)
 {
-	int	i, j;
-	unsigned char *out;
-	int	row;
-
-	if ( !r_simpleMipMaps->integer ) {
-		R_MipMap2( (unsigned *)in, width, height );
-		return;
-	}
-
-	if ( width == 1 && height == 1 )
-		return;
-
-	row = width * 4;
-	out = in;
-	width >>= 1;
-	height >>= 1;
-
-	if ( width == 0 || height == 0 )
-    {
-		width += height;	// get largest
-		for (i=0 ; i<width ; i++, out+=4, in+=8 )
-        {
-			out[0] = ( in[0] + in[4] )>>1;
-			out[1] = ( in[1] + in[5] )>>1;
-			out[2] = ( in[2] + in[6] )>>1;
-			out[3] = ( in[3] + in[7] )>>1;
-		}
-		return;
-	}
-
-	for (i=0 ; i<height ; i++, in+=row)
-    {
-		for (j=0 ; j<width ; j++, out+=4, in+=8)
-        {
-			out[0] = (in[0] + in[4] + in[row+0] + in[row+4])>>2;
-			out[1] = (in[1] + in[5] + in[row+1] + in[row+5])>>2;
-			out[2] = (in[2] + in[6] + in[row+2] + in[row+6])>>2;
-			out[3] = (in[3] + in[7] + in[row+3] + in[row+7])>>2;
-		}
-	}
+	if ( !r_simpleMipMaps->integer )
+		R_MipMapFilter( in, width, height, out );
+	else
+		R_MipMapBox( in, width, height, out );
 }
 
 
@@ -377,31 +238,54 @@ static void R_BlendOverTexture(unsigned char *data, int pixelCount, const unsign
 }
 
 
-
 /*
 ===============
-Upload32
+R_PrepareUpload
 
+Everything Upload32 does short of the GL calls: rounds to a power of two
+size, applies picmip and the GL size limit, picks the internal format,
+light scales and builds the mip chain. data is used as scratch. Only
+reads the settings and allocates with malloc, so it can run on the job
+threads. Returns qfalse when the image can't be resampled.
 ===============
 */
-static void Upload32( unsigned *data, 
-						  int width, int height, 
-						  qboolean mipmap, 
-						  qboolean picmip, 
-							qboolean lightMap,
-						  qboolean allowCompression,
-						  int *format, 
-						  int *pUploadWidth, int *pUploadHeight )
+qboolean R_PrepareUpload( unsigned *data, int width, int height, qboolean mipmap, qboolean picmip,
+		qboolean lightMap, qboolean allowCompression, imageUpload_t *up )
 {
+	static const unsigned char mipBlendColors[16][4] =
+	{
+		{0,0,0,0},
+		{255,0,0,128},
+		{0,255,0,128},
+		{0,0,255,128},
+		{255,0,0,128},
+		{0,255,0,128},
+		{0,0,255,128},
+		{255,0,0,128},
+		{0,255,0,128},
+		{0,0,255,128},
+		{255,0,0,128},
+		{0,255,0,128},
+		{0,0,255,128},
+		{255,0,0,128},
+		{0,255,0,128},
+		{0,0,255,128},
+	};
+
 	int			samples;
-	unsigned	*scaledBuffer = NULL;
 	unsigned	*resampledBuffer = NULL;
+	unsigned	*mipBuffer = NULL;
+	unsigned	*src, *dst, *swap;
 	int			scaled_width, scaled_height;
-	int			i, c;
+	int			i, c, w, h, size;
 	byte		*scan;
 	GLenum		internalFormat = GL_RGB;
 	float		rMax = 0, gMax = 0, bMax = 0;
 
+	memset( up, 0, sizeof( *up ) );
+	up->width = width;
+	up->height = height;
+
 	//
 	// convert to exact power of 2 sizes
 	//
@@ -415,7 +299,14 @@ static void Upload32( unsigned *data,
 		scaled_height >>= 1;
 
 	if ( scaled_width != width || scaled_height != height ) {
-		resampledBuffer = ri.Hunk_AllocateTempMemory( scaled_width * scaled_height * 4 );
+		// ResampleTexture's row tables
+		if ( scaled_width > 2048 )
+			return qfalse;
+
+		resampledBuffer = malloc( scaled_width * scaled_height * 4 );
+		if ( resampledBuffer == NULL )
+			return qfalse;
+
 		ResampleTexture (data, width, height, resampledBuffer, scaled_width, scaled_height);
 		data = resampledBuffer;
 		width = scaled_width;
@@ -446,13 +337,13 @@ static void Upload32( unsigned *data,
 	// deal with a half mip resampling
 	//
 	while ( scaled_width > glConfig.maxTextureSize
-		|| scaled_height > glConfig.maxTextureSize ) {
+		|| scaled_height > glConfig.maxTextureSize
+		|| scaled_width > ( 1 << ( MAX_UPLOAD_LEVELS - 1 ) )
+		|| scaled_height > ( 1 << ( MAX_UPLOAD_LEVELS - 1 ) ) ) {
 		scaled_width >>= 1;
 		scaled_height >>= 1;
 	}
 
-	scaledBuffer = ri.Hunk_AllocateTempMemory( sizeof( unsigned ) * scaled_width * scaled_height );
-
 	//
 	// scan the texture for each channel's max values
 	// and verify if the alpha channel is being used or not
@@ -560,7 +451,11 @@ static void Upload32( unsigned *data,
 			}
 			else
 			{
-				if ( r_texturebits->integer == 16 )
+				if ( allowCompression && glConfig.textureCompression == TC_S3TC_ARB )
+				{
+					internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+				}
+				else if ( r_texturebits->integer == 16 )
 				{
 					internalFormat = GL_RGBA4;
 				}
@@ -576,28 +471,71 @@ static void Upload32( unsigned *data,
 		}
 	}
 
+	//
+	// lay out the mip chain in a single buffer
+	//
+	up->internalFormat = internalFormat;
+	up->uploadWidth = scaled_width;
+	up->uploadHeight = scaled_height;
+	up->mipmap = mipmap;
+	up->numLevels = 1;
+
+	if ( mipmap ) {
+		for ( w = scaled_width, h = scaled_height ; w > 1 || h > 1 ; up->numLevels++ ) {
+			w = w > 1 ? w >> 1 : 1;
+			h = h > 1 ? h >> 1 : 1;
+		}
+	}
+
+	size = 0;
+	for ( i = 0 ; i < up->numLevels ; i++ ) {
+		w = scaled_width >> i;
+		h = scaled_height >> i;
+		up->levelSize[i] = ( w ? w : 1 ) * ( h ? h : 1 ) * 4;
+		size += up->levelSize[i];
+	}
+
+	up->buffer = malloc( size );
+	if ( up->buffer == NULL ) {
+		free( resampledBuffer );
+		return qfalse;
+	}
+
+	for ( i = 0, size = 0 ; i < up->numLevels ; i++ ) {
+		up->levels[i] = up->buffer + size;
+		size += up->levelSize[i];
+	}
 
 	// copy or resample data as appropriate for first MIP level
 	if ( ( scaled_width == width ) && ( scaled_height == height ) ) 
     {
-		if (!mipmap)
-		{
-			qglTexImage2D (GL_TEXTURE_2D, 0, internalFormat, scaled_width, scaled_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-			*pUploadWidth = scaled_width;
-			*pUploadHeight = scaled_height;
-			*format = internalFormat;
+		memcpy( up->levels[0], data, width*height*4 );
 
-			goto done;
+		// goes up as it is
+		if ( !mipmap ) {
+			free( resampledBuffer );
+			return qtrue;
 		}
-
-		memcpy(scaledBuffer, data, width*height*4);
 	}
 	else
 	{
-		// use the normal mip-mapping function to go down from here
+		// use the normal mip-mapping function to go down from here,
+		// back and forth between data and a buffer for the first step
+		mipBuffer = malloc( ( width > 1 ? width >> 1 : 1 ) * ( height > 1 ? height >> 1 : 1 ) * 4 );
+		if ( mipBuffer == NULL ) {
+			R_FreeUpload( up );
+			free( resampledBuffer );
+			return qfalse;
+		}
+
+		src = data;
+		dst = mipBuffer;
 		while ( width > scaled_width || height > scaled_height )
         {
-			R_MipMap( (byte *)data, width, height );
+			R_MipMap( (byte *)src, width, height, (byte *)dst );
+			swap = src;
+			src = dst;
+			dst = swap;
 			width >>= 1;
 			height >>= 1;
 			if ( width < 1 ) {
@@ -607,63 +545,75 @@ static void Upload32( unsigned *data,
 				height = 1;
 			}
 		}
-		memcpy(scaledBuffer, data, width * height * 4 );
+		memcpy( up->levels[0], src, width * height * 4 );
 	}
 
-	R_LightScaleTexture (scaledBuffer, scaled_width, scaled_height, !mipmap );
+	R_LightScaleTexture ( (unsigned *)up->levels[0], scaled_width, scaled_height, !mipmap );
 
-	*pUploadWidth = scaled_width;
-	*pUploadHeight = scaled_height;
-	*format = internalFormat;
+	for ( i = 1 ; i < up->numLevels ; i++ )
+	{
+		R_MipMap( up->levels[i - 1], scaled_width, scaled_height, up->levels[i] );
+		scaled_width >>= 1;
+		scaled_height >>= 1;
+		if (scaled_width < 1)
+			scaled_width = 1;
+		if (scaled_height < 1)
+			scaled_height = 1;
 
-	qglTexImage2D(GL_TEXTURE_2D, 0, internalFormat, scaled_width, scaled_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, scaledBuffer );
+		if ( r_colorMipLevels->integer )
+        {
+			R_BlendOverTexture( up->levels[i], scaled_width * scaled_height, mipBlendColors[i] );
+		}
+	}
 
+	free( mipBuffer );
+	free( resampledBuffer );
 
-	if (mipmap)
-	{
-        static const unsigned char mipBlendColors[16][4] =
-        {
-            {0,0,0,0},
-            {255,0,0,128},
-            {0,255,0,128},
-            {0,0,255,128},
-            {255,0,0,128},
-            {0,255,0,128},
-            {0,0,255,128},
-            {255,0,0,128},
-            {0,255,0,128},
-            {0,0,255,128},
-            {255,0,0,128},
-            {0,255,0,128},
-            {0,0,255,128},
-            {255,0,0,128},
-            {0,255,0,128},
-            {0,0,255,128},
-        };
-
-		int	miplevel = 0;
-		while (scaled_width > 1 || scaled_height > 1)
-		{
-			R_MipMap( (unsigned char *)scaledBuffer, scaled_width, scaled_height );
-			scaled_width >>= 1;
-			scaled_height >>= 1;
-			if (scaled_width < 1)
-				scaled_width = 1;
-			if (scaled_height < 1)
-				scaled_height = 1;
-			miplevel++;
-
-			if ( r_colorMipLevels->integer )
-            {
-				R_BlendOverTexture( (unsigned char *)scaledBuffer, scaled_width * scaled_height, mipBlendColors[miplevel] );
-			}
+	return qtrue;
+}
 
-			qglTexImage2D (GL_TEXTURE_2D, miplevel, internalFormat, scaled_width, scaled_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, scaledBuffer );
-		}
+
+/*
+===============
+R_FreeUpload
+===============
+*/
+void R_FreeUpload( imageUpload_t *up )
+{
+	free( up->buffer );
+	up->buffer = NULL;
+	up->numLevels = 0;
+}
+
+
+/*
+===============
+R_UploadLevels
+
+Sends a prepared mip chain to the bound texture, leaving out the
+firstLevel largest levels
+===============
+*/
+static void R_UploadLevels( const imageUpload_t *up, int firstLevel )
+{
+	int		i, w, h;
+
+	for ( i = firstLevel ; i < up->numLevels ; i++ )
+	{
+		w = up->uploadWidth >> i;
+		h = up->uploadHeight >> i;
+		if ( w < 1 )
+			w = 1;
+		if ( h < 1 )
+			h = 1;
+
+		if ( up->compressed )
+			qglCompressedTexImage2D( GL_TEXTURE_2D, i - firstLevel, up->internalFormat, w, h, 0, up->levelSize[i], up->levels[i] );
+		else
+			qglTexImage2D( GL_TEXTURE_2D, i - firstLevel, up->internalFormat, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, up->levels[i] );
 	}
-done:
 
-	if (mipmap)
+	if (up->mipmap)
 	{
 		qglTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, gl_filter_min);
 		qglTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, gl_filter_max);
@@ -675,43 +625,109 @@ done:
 	}
 
 	GL_CheckErrors();
+}
+
+
+/*
+===============
+Upload32
 
-	if ( scaledBuffer != 0 )
-		ri.Hunk_FreeTempMemory( scaledBuffer );
-	if ( resampledBuffer != 0 )
-		ri.Hunk_FreeTempMemory( resampledBuffer );
+===============
+*/
+static void Upload32( unsigned *data, 
+						  int width, int height, 
+						  qboolean mipmap, 
+						  qboolean picmip, 
+							qboolean lightMap,
+						  qboolean allowCompression,
+						  int *format, 
+						  int *pUploadWidth, int *pUploadHeight )
+{
+	imageUpload_t	up;
+
+	if ( !R_PrepareUpload( data, width, height, mipmap, picmip, lightMap, allowCompression, &up ) )
+		ri.Error( ERR_DROP, "Upload32: couldn't prepare a %ix%i image", width, height );
+
+	R_UploadLevels( &up, 0 );
+
+	*format = up.internalFormat;
+	*pUploadWidth = up.uploadWidth;
+	*pUploadHeight = up.uploadHeight;
+
+	R_FreeUpload( &up );
 }
 
 
+/*
+===============
+R_HashBytes
+
+FNV-1a, start from IMAGE_HASH_SEED
+===============
+*/
+unsigned R_HashBytes( unsigned hash, const void *data, int size )
+{
+	const byte	*p = data;
+	int			i;
+
+	for ( i = 0 ; i < size ; i++ ) {
+		hash = ( hash ^ p[i] ) * 16777619u;
+	}
+
+	return hash;
+}
+
+
+/*
+===============
+R_HashUploadSettings
+
+Mixes everything R_PrepareUpload depends on besides the image into hash,
+for keying the image cache
+===============
+*/
+unsigned R_HashUploadSettings( unsigned hash )
+{
+	int		settings[8];
+
+	settings[0] = r_picmip->integer;
+	settings[1] = r_roundImagesDown->integer;
+	settings[2] = r_simpleMipMaps->integer;
+	settings[3] = (int)( r_greyscale->value * 255 );
+	settings[4] = r_texturebits->integer;
+	settings[5] = glConfig.maxTextureSize;
+	settings[6] = glConfig.textureCompression;
+	settings[7] = glConfig.deviceSupportsGamma;
 
+	hash = R_HashBytes( hash, settings, sizeof( settings ) );
+	hash = R_HashBytes( hash, s_gammatable, sizeof( s_gammatable ) );
+	hash = R_HashBytes( hash, s_intensitytable, sizeof( s_intensitytable ) );
+
+	return hash;
+}
 
 
 //===================================================================
+
+// Note that the ordering indicates the order of preference used
+// when there are multiple images of different formats available
+const imageExtToLoaderMap_t imageLoaders[ ] =
+{
+    { "tga",  R_LoadTGA },
+    { "jpg",  R_LoadJPG },
+    { "jpeg", R_LoadJPG },
+    { "png",  R_LoadPNG },
+    { "pcx",  R_LoadPCX },
+    { "bmp",  R_LoadBMP }
+};
+
+const int numImageLoaders = ARRAY_LEN( imageLoaders );
+
 /*
  * Loads any of the supported image types into a cannonical 32 bit format.
 */
 static void R_LoadImage(const char *name, unsigned char **pic, int *width, int *height )
 {
-    typedef struct
-    {
-        char *ext;
-        void (*ImageLoader)( const char *, unsigned char **, int *, int * );
-    } imageExtToLoaderMap_t;
-
-    // Note that the ordering indicates the order of preference used
-    // when there are multiple images of different formats available
-    static const imageExtToLoaderMap_t imageLoaders[ ] =
-    {
-        { "tga",  R_LoadTGA },
-        { "jpg",  R_LoadJPG },
-        { "jpeg", R_LoadJPG },
-        { "png",  R_LoadPNG },
-        { "pcx",  R_LoadPCX },
-        { "bmp",  R_LoadBMP }
-    };
-
-    static const int numImageLoaders = ARRAY_LEN( imageLoaders );
-    
 	qboolean orgNameFailed = qfalse;
 	int orgLoader = -1;
 	int i;
@@ -796,6 +812,7 @@ image_t* R_FindImageFile( const char *name, imgType_t type, imgFlags_t flags )
     image_t* image;
     int	width, height;
     unsigned char* pic;
+    qboolean found;
 
     if (!name) {
         return NULL;
@@ -821,6 +838,27 @@ image_t* R_FindImageFile( const char *name, imgType_t type, imgFlags_t flags )
         }
     }
 
+    //
+    // an earlier map may have left it in texture memory
+    //
+    image = R_FindRetainedImage( name, type, flags );
+    if ( image ) {
+        return image;
+    }
+
+    //
+    // load it through the image cache, the way below
+    // only when that didn't work out for a file that is there
+    //
+    image = R_LoadImageFile( name, type, flags, &found );
+    if ( image ) {
+        R_SetImageRetainable( image );
+        return image;
+    }
+    if ( !found ) {
+        return NULL;
+    }
+
     //
     // load the pic from disk
     //
@@ -831,6 +869,7 @@ image_t* R_FindImageFile( const char *name, imgType_t type, imgFlags_t flags )
 
     image = R_CreateImage( ( char * ) name, pic, width, height, type, flags, 0 );
     ri.Free( pic );
+    R_SetImageRetainable( image );
     return image;
 }
 
@@ -1113,17 +1152,17 @@ void R_SetColorMappings( void ) {
 
 /*
 ================
-R_CreateImage
+R_AllocImage
 
-This is the only way any image_t are created
+Starts an image_t for R_CreateImage and R_CreateImageFromUpload,
+leaving its texture bound for the upload. A texnum of 0 gets a new
+texture object.
 ================
 */
-image_t *R_CreateImage(const char *name, byte *pic, int width, int height, imgType_t type, imgFlags_t flags, int internalFormat )
+static image_t *R_AllocImage( const char *name, int width, int height, imgType_t type, imgFlags_t flags, GLuint texnum )
 {
 	image_t		*image;
 	qboolean	isLightmap = qfalse;
-	long		hash;
-	int         glWrapClampMode;
 
 	if (strlen(name) >= MAX_QPATH ) {
 		ri.Error (ERR_DROP, "R_CreateImage: \"%s\" is too long", name);
@@ -1136,8 +1175,16 @@ image_t *R_CreateImage(const char *name, byte *pic, int width, int height, imgTy
 		ri.Error( ERR_DROP, "R_CreateImage: MAX_DRAWIMAGES hit");
 	}
 
+	// the context has to be current on this thread for the upload
+	R_SyncRenderThread();
+
 	image = tr.images[tr.numImages] = ri.Hunk_Alloc( sizeof( image_t ), h_low );
-	qglGenTextures(1, &image->texnum);
+	if ( texnum ) {
+		image->texnum = texnum;
+	} else {
+		qglGenTextures(1, &image->texnum);
+	}
+	image->index = tr.numImages;
 	tr.numImages++;
 
 	image->type = type;
@@ -1147,10 +1194,6 @@ image_t *R_CreateImage(const char *name, byte *pic, int width, int height, imgTy
 
 	image->width = width;
 	image->height = height;
-	if (flags & IMGFLAG_CLAMPTOEDGE)
-		glWrapClampMode = GL_CLAMP_TO_EDGE;
-	else
-		glWrapClampMode = GL_REPEAT;
 
 	// lightmaps are always allocated on TMU 1
 	if ( qglActiveTextureARB && isLightmap ) {
@@ -1165,9 +1208,25 @@ image_t *R_CreateImage(const char *name, byte *pic, int width, int height, imgTy
 
 	GL_Bind(image);
 
-	Upload32( (unsigned *)pic, image->width, image->height, image->flags & IMGFLAG_MIPMAP, 
-	image->flags & IMGFLAG_PICMIP, isLightmap, !(image->flags & IMGFLAG_NO_COMPRESSION), 
-	&image->internalFormat, &image->uploadWidth, &image->uploadHeight );
+	return image;
+}
+
+/*
+================
+R_FinishImage
+
+dropLevels is how many of the largest mip levels were left out
+================
+*/
+static void R_FinishImage( image_t *image, int dropLevels, qboolean streamable )
+{
+	long		hash;
+	int         glWrapClampMode;
+
+	if (image->flags & IMGFLAG_CLAMPTOEDGE)
+		glWrapClampMode = GL_CLAMP_TO_EDGE;
+	else
+		glWrapClampMode = GL_REPEAT;
 
 	qglTexParameterf( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, glWrapClampMode );
 	qglTexParameterf( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, glWrapClampMode );
@@ -1179,13 +1238,147 @@ image_t *R_CreateImage(const char *name, byte *pic, int width, int height, imgTy
 		GL_SelectTexture( 0 );
 	}
 
-	hash = generateHashValue(name);
+	hash = generateHashValue(image->imgName);
 	image->next = hashTable[hash];
 	hashTable[hash] = image;
 
+	R_TrackImage( image, dropLevels, streamable );
+}
+
+/*
+================
+R_CreateImage
+
+This is the only way any image_t are created from pixels
+================
+*/
+image_t *R_CreateImage(const char *name, byte *pic, int width, int height, imgType_t type, imgFlags_t flags, int internalFormat )
+{
+	image_t		*image;
+
+	image = R_AllocImage( name, width, height, type, flags, 0 );
+
+	Upload32( (unsigned *)pic, image->width, image->height, image->flags & IMGFLAG_MIPMAP, 
+	image->flags & IMGFLAG_PICMIP, !strncmp( name, "*lightmap", 9 ), !(image->flags & IMGFLAG_NO_COMPRESSION), 
+	&image->internalFormat, &image->uploadWidth, &image->uploadHeight );
+
+	R_FinishImage( image, 0, qfalse );
+
+	return image;
+}
+
+/*
+================
+R_CreateImageFromUpload
+
+Creates an image from a mip chain R_PrepareUpload made or the image
+cache had, the upload stays the caller's
+================
+*/
+image_t *R_CreateImageFromUpload( const char *name, const imageUpload_t *up, imgType_t type, imgFlags_t flags )
+{
+	image_t		*image;
+	int			dropLevels;
+
+	// streamed images start small
+	dropLevels = R_StreamStartLevel( up );
+
+	image = R_AllocImage( name, up->width, up->height, type, flags, 0 );
+
+	R_UploadLevels( up, dropLevels );
+
+	image->internalFormat = up->internalFormat;
+	image->uploadWidth = MAX( up->uploadWidth >> dropLevels, 1 );
+	image->uploadHeight = MAX( up->uploadHeight >> dropLevels, 1 );
+
+	R_FinishImage( image, dropLevels, up->mipmap && up->numLevels > 1 );
+
+	return image;
+}
+
+/*
+================
+R_CreateImageFromTexture
+
+Makes an image of a texture object that is already filled in, one an
+earlier map left behind
+================
+*/
+image_t *R_CreateImageFromTexture( const char *name, GLuint texnum, int width, int height,
+		int uploadWidth, int uploadHeight, int internalFormat, imgType_t type, imgFlags_t flags,
+		int dropLevels, qboolean streamable )
+{
+	image_t		*image;
+
+	image = R_AllocImage( name, width, height, type, flags, texnum );
+
+	image->internalFormat = internalFormat;
+	image->uploadWidth = uploadWidth;
+	image->uploadHeight = uploadHeight;
+
+	// r_textureMode may have changed since
+	if ( flags & IMGFLAG_MIPMAP )
+	{
+		qglTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, gl_filter_min);
+		qglTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, gl_filter_max);
+	}
+
+	R_FinishImage( image, dropLevels, streamable );
+
 	return image;
 }
 
+/*
+================
+R_ReplaceImageLevels
+
+Uploads the mip chain of an image again, for streaming it to another
+level of detail
+================
+*/
+void R_ReplaceImageLevels( image_t *image, const imageUpload_t *up, int dropLevels )
+{
+	R_SyncRenderThread();
+
+	if ( qglActiveTextureARB ) {
+		GL_SelectTexture( image->TMU );
+	}
+
+	GL_Bind( image );
+
+	R_UploadLevels( up, dropLevels );
+
+	image->internalFormat = up->internalFormat;
+	image->uploadWidth = MAX( up->uploadWidth >> dropLevels, 1 );
+	image->uploadHeight = MAX( up->uploadHeight >> dropLevels, 1 );
+
+	if ( image->TMU == 1 ) {
+		GL_SelectTexture( 0 );
+	}
+
+	R_SetImageDropLevels( image, dropLevels );
+}
+
+/*
+================
+R_FindLoadedImage
+
+Returns the image by that name if it was loaded already
+================
+*/
+image_t *R_FindLoadedImage( const char *name )
+{
+	image_t		*image;
+
+	for ( image = hashTable[generateHashValue( name )]; image; image = image->next ) {
+		if ( !strcmp( name, image->imgName ) ) {
+			return image;
+		}
+	}
+
+	return NULL;
+}
+
 
 /*
 ===============
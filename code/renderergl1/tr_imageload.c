@@ -0,0 +1,1131 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_imageload.c
+ *    Description:  image decoding on the front end workers and the image cache
+ * ==================================================================================
+ */
+
+/*
+ * Images are loaded in batches: this thread finds and reads the files,
+ * the file system isn't thread safe, the job threads decode them and
+ * build the mip chains with R_PrepareUpload, and this thread uploads
+ * them. R_FindImageFile loads single images that way, RE_LoadWorldMap
+ * hands all the images of the world's shaders to R_PrefetchImages so
+ * they are decoded in parallel with r_worldThreads.
+ *
+ * The loaders in renderercommon read through ri and give up with
+ * ri.Error, so while a batch is decoded those imports are swapped for
+ * ones that serve the files read for it, allocate with malloc and turn
+ * errors into a failed image on the thread that hit them. Failed images
+ * are left to R_LoadImage, which gives the errors as before. Threads that
+ * aren't decoding go through to the real imports.
+ *
+ * Streamed images are decoded on a thread of their own, the job pool
+ * is busy with the world every frame. R_StreamImages reads the files of
+ * a batch and hands it over, R_ImageStreamBusy uploads it on a later
+ * frame once it is decoded. The imports stay swapped while streaming,
+ * and the stream thread keeps what the loaders print for the upload.
+ *
+ * With r_imageCache the prepared mip chains are kept in imagecache/,
+ * keyed by a hash of the source file and of everything R_PrepareUpload
+ * depends on: picmip, the gamma and intensity tables, greyscale, texture
+ * bits and so on. With r_ext_compressed_textures it keeps the blocks the
+ * driver compressed them to, read back after the first upload. The files
+ * are in the byte order of the machine that wrote them. A pure server
+ * can't vouch for them, so the cache isn't used with sv_pure and the
+ * file system refuses the .icache extension from outside the paks then.
+ */
+
+#include <setjmp.h>
+#include <stdlib.h>
+
+#include "tr_local.h"
+#include "../renderercommon/tr_jobs.h"
+
+#ifdef _WIN32
+	#include "../SDL2/include/SDL.h"
+#else
+	#include <SDL2/SDL.h>
+#endif
+
+
+#define IMAGE_BATCH_SIZE		64
+#define IMAGE_BATCH_BYTES		( 32 << 20 )	// files read ahead of the decoding
+#define MAX_DECODE_ALLOCS		32
+#define IMAGE_STREAM_SIZE		( MAX_JOB_THREADS * 2 )	// what R_UpdateResidency picks at most
+#define IMAGE_STREAM_BYTES		( 4 << 20 )	// files read for a stream batch
+#define STREAM_DECODE_THREAD	MAX_JOB_THREADS	// decodeThreads slot of the stream thread
+
+#define IMAGECACHE_IDENT		(('I'<<24)+('C'<<16)+('M'<<8)+'I')
+#define IMAGECACHE_VERSION		1
+
+typedef struct {
+	int			ident;
+	int			version;
+	unsigned	key;
+	int			sourceSize;
+	int			width, height;
+	int			uploadWidth, uploadHeight;
+	int			internalFormat;
+	int			mipmap;
+	int			compressed;
+	int			numLevels;
+	int			levelSize[MAX_UPLOAD_LEVELS];
+} imageCacheHeader_t;
+
+typedef struct {
+	const char		*name;				// as asked for
+	imgType_t		type;
+	imgFlags_t		flags;
+	qboolean		cacheable;
+
+	char			fileName[MAX_QPATH];	// what was found for it
+	int				loader;
+	byte			*file;
+	int				fileSize;
+	byte			*cache;
+	int				cacheSize;
+
+	unsigned		key;
+	qboolean		prepared;
+	qboolean		fromCache;
+	imageUpload_t	upload;
+
+	char			messages[256];		// printed by a streamed load
+} imageLoad_t;
+
+typedef struct {
+	SDL_threadID	id;
+	imageLoad_t		*load;				// while its loader runs
+	jmp_buf			abort;
+	void			*allocs[MAX_DECODE_ALLOCS];
+	int				numAllocs;
+} decodeThread_t;
+
+static decodeThread_t	decodeThreads[MAX_JOB_THREADS + 1];	// the job threads and the stream thread
+static refimport_t		realImports;
+static qboolean			decodeImportsSet;
+static SDL_SpinLock		decodePrintLock;
+
+static imageLoad_t		imageBatch[IMAGE_BATCH_SIZE];
+
+static imageLoad_t		streamLoads[IMAGE_STREAM_SIZE];
+static image_t			*streamImages[IMAGE_STREAM_SIZE];	// the image of each load
+static int				streamDropLevels[IMAGE_STREAM_SIZE];
+static int				numStreamLoads;			// being decoded or waiting for the upload
+static int				streamStartTime;
+
+static SDL_Thread		*streamThread;
+static SDL_sem			*streamStart;
+static SDL_sem			*streamDone;
+static qboolean			streamThreadTried;
+static qboolean			streamQuit;
+
+extern void (APIENTRYP qglGetCompressedTexImageARB) (GLenum target, GLint level, void *img);
+extern void (APIENTRYP qglGetTexLevelParameteriv) (GLenum target, GLint level, GLenum pname, GLint *params);
+
+
+/*
+ * The thread's slot while it runs a loader, NULL for any other thread
+ */
+static decodeThread_t *R_DecodeThread( void )
+{
+	SDL_threadID id = SDL_ThreadID();
+	int i;
+
+	for ( i = 0; i < ARRAY_LEN( decodeThreads ); i++ )
+	{
+		if ( decodeThreads[i].load != NULL && decodeThreads[i].id == id )
+			return &decodeThreads[i];
+	}
+
+	return NULL;
+}
+
+
+static void QDECL __attribute__ ((format (printf, 2, 3))) R_DecodePrintf( int printLevel, const char *fmt, ... )
+{
+	decodeThread_t *t = R_DecodeThread();
+	char msg[4096];		// as much as Com_Printf takes, others print through here too
+	va_list argptr;
+	int len;
+
+	va_start( argptr, fmt );
+	Q_vsnprintf( msg, sizeof( msg ), fmt, argptr );
+	va_end( argptr );
+
+	// the main thread goes on meanwhile, the console is its own
+	if ( t == &decodeThreads[STREAM_DECODE_THREAD] )
+	{
+		len = strlen( t->load->messages );
+		if ( len < sizeof( t->load->messages ) - 1 )
+			Q_strncpyz( t->load->messages + len, msg, sizeof( t->load->messages ) - len );
+		return;
+	}
+
+	SDL_AtomicLock( &decodePrintLock );
+	realImports.Printf( printLevel, "%s", msg );
+	SDL_AtomicUnlock( &decodePrintLock );
+}
+
+
+static void QDECL __attribute__ ((noreturn, format (printf, 2, 3))) R_DecodeError( int errorLevel, const char *fmt, ... )
+{
+	decodeThread_t *t = R_DecodeThread();
+	char msg[4096];
+	va_list argptr;
+
+	va_start( argptr, fmt );
+	Q_vsnprintf( msg, sizeof( msg ), fmt, argptr );
+	va_end( argptr );
+
+	if ( t == NULL )
+		realImports.Error( errorLevel, "%s", msg );
+
+	// R_LoadImage gives it again when the image is asked for
+	R_DecodePrintf( PRINT_DEVELOPER, "%s: %s\n", t->load->fileName, msg );
+	longjmp( t->abort, 1 );
+}
+
+
+static void *R_DecodeMalloc( int bytes )
+{
+	decodeThread_t *t = R_DecodeThread();
+	void *buf;
+
+	if ( t == NULL )
+		return realImports.Malloc( bytes );
+
+	if ( t->numAllocs == MAX_DECODE_ALLOCS )
+		R_DecodeError( ERR_DROP, "R_DecodeMalloc: too many allocations" );
+
+	// zeroed like Z_Malloc
+	buf = calloc( 1, bytes );
+	if ( buf == NULL )
+		R_DecodeError( ERR_DROP, "R_DecodeMalloc: couldn't allocate %d bytes", bytes );
+
+	t->allocs[t->numAllocs++] = buf;
+
+	return buf;
+}
+
+
+static void R_DecodeFree( void *buf )
+{
+	decodeThread_t *t = R_DecodeThread();
+	int i;
+
+	if ( t == NULL )
+	{
+		realImports.Free( buf );
+		return;
+	}
+
+	for ( i = 0; i < t->numAllocs; i++ )
+	{
+		if ( t->allocs[i] == buf )
+		{
+			t->allocs[i] = t->allocs[--t->numAllocs];
+			break;
+		}
+	}
+
+	free( buf );
+}
+
+
+static long R_DecodeReadFile( const char *name, char **buf )
+{
+	decodeThread_t *t = R_DecodeThread();
+
+	if ( t == NULL )
+		return realImports.R_ReadFile( name, buf );
+
+	// only the file that was read for it
+	if ( Q_stricmp( name, t->load->fileName ) )
+	{
+		*buf = NULL;
+		return -1;
+	}
+
+	*buf = (char *)t->load->file;
+
+	return t->load->fileSize;
+}
+
+
+static void R_DecodeFreeFile( void *buf )
+{
+	// the files of a batch are freed with it
+	if ( R_DecodeThread() == NULL )
+		realImports.FS_FreeFile( buf );
+}
+
+
+/*
+ * Runs the loader for an image, returns the pixels or NULL when it failed
+ */
+static byte *R_DecodeImage( decodeThread_t *t, imageLoad_t *load, int *width, int *height )
+{
+	byte *pic = NULL;
+	int i;
+
+	t->id = SDL_ThreadID();
+	t->numAllocs = 0;
+	t->load = load;
+
+	if ( setjmp( t->abort ) )
+	{
+		for ( i = 0; i < t->numAllocs; i++ )
+			free( t->allocs[i] );
+
+		t->load = NULL;
+		return NULL;
+	}
+
+	imageLoaders[load->loader].ImageLoader( load->fileName, &pic, width, height );
+
+	// the pixels are ours now, drop anything else the loader left
+	for ( i = 0; i < t->numAllocs; i++ )
+	{
+		if ( t->allocs[i] != pic )
+			free( t->allocs[i] );
+	}
+
+	t->load = NULL;
+
+	return pic;
+}
+
+
+static unsigned R_ImageCacheKey( const imageLoad_t *load )
+{
+	unsigned hash = IMAGE_HASH_SEED;
+	int flags = load->flags;
+
+	hash = R_HashBytes( hash, load->file, load->fileSize );
+	hash = R_HashBytes( hash, &flags, sizeof( flags ) );
+
+	return R_HashUploadSettings( hash );
+}
+
+
+/*
+ * The size a level of a cache file must have for its dimensions, -1 for
+ * blocks of a format R_ReadCompressedLevels can't have written
+ */
+static int R_CachedLevelSize( const imageCacheHeader_t *header, int level )
+{
+	int w = MAX( header->uploadWidth >> level, 1 );
+	int h = MAX( header->uploadHeight >> level, 1 );
+
+	if ( !header->compressed )
+		return w * h * 4;
+
+	switch ( header->internalFormat )
+	{
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_RGB4_S3TC:
+			return ( ( w + 3 ) / 4 ) * ( ( h + 3 ) / 4 ) * 8;
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+			return ( ( w + 3 ) / 4 ) * ( ( h + 3 ) / 4 ) * 16;
+	}
+
+	return -1;
+}
+
+
+/*
+ * Takes the mip chain from the cache file if it was made from the same
+ * file with the same settings. The levels must be as big as the
+ * dimensions say, R_UploadLevels reads that much.
+ */
+static qboolean R_UseCachedImage( imageLoad_t *load )
+{
+	const imageCacheHeader_t *header = (const imageCacheHeader_t *)load->cache;
+	imageUpload_t *up = &load->upload;
+	int i, size;
+
+	if ( load->cacheSize < (int)sizeof( *header ) )
+		return qfalse;
+
+	if ( header->ident != IMAGECACHE_IDENT || header->version != IMAGECACHE_VERSION ||
+		header->key != load->key || header->sourceSize != load->fileSize )
+		return qfalse;
+
+	if ( header->numLevels < 1 || header->numLevels > MAX_UPLOAD_LEVELS )
+		return qfalse;
+
+	if ( header->uploadWidth < 1 || header->uploadWidth > glConfig.maxTextureSize ||
+		header->uploadHeight < 1 || header->uploadHeight > glConfig.maxTextureSize )
+		return qfalse;
+
+	memset( up, 0, sizeof( *up ) );
+
+	size = sizeof( *header );
+	for ( i = 0; i < header->numLevels; i++ )
+	{
+		if ( header->levelSize[i] <= 0 || header->levelSize[i] > load->cacheSize - size ||
+			header->levelSize[i] != R_CachedLevelSize( header, i ) )
+			return qfalse;
+
+		up->levels[i] = load->cache + size;
+		up->levelSize[i] = header->levelSize[i];
+		size += header->levelSize[i];
+	}
+
+	up->width = header->width;
+	up->height = header->height;
+	up->uploadWidth = header->uploadWidth;
+	up->uploadHeight = header->uploadHeight;
+	up->internalFormat = header->internalFormat;
+	up->mipmap = header->mipmap;
+	up->compressed = header->compressed;
+	up->numLevels = header->numLevels;
+
+	// the levels are in the file, the upload owns it now
+	up->buffer = load->cache;
+	load->cache = NULL;
+	load->fromCache = qtrue;
+
+	return qtrue;
+}
+
+
+static void R_DecodeLoad( decodeThread_t *t, imageLoad_t *load )
+{
+	byte *pic;
+	int width, height;
+
+	if ( load->file == NULL )
+		return;
+
+	if ( load->cacheable )
+	{
+		load->key = R_ImageCacheKey( load );
+
+		if ( load->cache != NULL && R_UseCachedImage( load ) )
+		{
+			load->prepared = qtrue;
+			return;
+		}
+	}
+
+	pic = R_DecodeImage( t, load, &width, &height );
+	if ( pic == NULL )
+		return;
+
+	load->prepared = R_PrepareUpload( (unsigned *)pic, width, height,
+		load->flags & IMGFLAG_MIPMAP, load->flags & IMGFLAG_PICMIP, qfalse,
+		!( load->flags & IMGFLAG_NO_COMPRESSION ), &load->upload );
+
+	free( pic );
+}
+
+
+static void R_DecodeJob( void *data, int item, int thread )
+{
+	R_DecodeLoad( &decodeThreads[thread], (imageLoad_t *)data + item );
+}
+
+
+static void R_ImageCachePath( const imageLoad_t *load, char *path, int size )
+{
+	Com_sprintf( path, size, "imagecache/%s_%x.icache", load->fileName, load->flags );
+}
+
+
+/*
+ * Reads a file into memory of our own, so the batch can hold many
+ * without stacking up hunk temp memory
+ */
+static byte *R_ReadWholeFile( const char *name, int *size )
+{
+	char *buf;
+	byte *copy;
+	long len;
+
+	len = ri.R_ReadFile( name, &buf );
+	if ( buf == NULL || len < 0 )
+		return NULL;
+
+	// with the trailing 0 FS_ReadFile gives
+	copy = malloc( len + 1 );
+	if ( copy != NULL )
+	{
+		memcpy( copy, buf, len + 1 );
+		*size = len;
+	}
+
+	ri.FS_FreeFile( buf );
+
+	return copy;
+}
+
+
+static qboolean R_ReadImageFile( imageLoad_t *load, const char *fileName, int loader )
+{
+	char path[MAX_OSPATH];
+
+	load->file = R_ReadWholeFile( fileName, &load->fileSize );
+	if ( load->file == NULL )
+		return qfalse;
+
+	Q_strncpyz( load->fileName, fileName, sizeof( load->fileName ) );
+	load->loader = loader;
+
+	if ( load->cacheable )
+	{
+		R_ImageCachePath( load, path, sizeof( path ) );
+		load->cache = R_ReadWholeFile( path, &load->cacheSize );
+	}
+
+	return qtrue;
+}
+
+
+/*
+ * Finds the file for an image the way R_LoadImage does and reads it
+ * and its cache file, returns qfalse when there is none
+ */
+static qboolean R_ReadImageFiles( imageLoad_t *load )
+{
+	char localName[MAX_QPATH];
+	const char *ext;
+	int i, orgLoader = -1;
+
+	Q_strncpyz( localName, load->name, sizeof( localName ) );
+	ext = COM_GetExtension( localName );
+
+	if ( *ext )
+	{
+		for ( i = 0; i < numImageLoaders; i++ )
+		{
+			if ( !Q_stricmp( ext, imageLoaders[i].ext ) )
+				break;
+		}
+
+		if ( i < numImageLoaders )
+		{
+			if ( R_ReadImageFile( load, localName, i ) )
+				return qtrue;
+
+			// try again without the extension
+			orgLoader = i;
+			stripExtension( load->name, localName, sizeof( localName ) );
+		}
+	}
+
+	for ( i = 0; i < numImageLoaders; i++ )
+	{
+		if ( i == orgLoader )
+			continue;
+
+		if ( R_ReadImageFile( load, va( "%s.%s", localName, imageLoaders[i].ext ), i ) )
+		{
+			if ( orgLoader >= 0 )
+				ri.Printf( PRINT_WARNING, "WARNING: %s not present, using %s instead\n", load->name, load->fileName );
+
+			return qtrue;
+		}
+	}
+
+	return qfalse;
+}
+
+
+static void R_StartImageLoad( imageLoad_t *load, const char *name, imgType_t type, imgFlags_t flags )
+{
+	memset( load, 0, sizeof( *load ) );
+
+	load->name = name;
+	load->type = type;
+	load->flags = flags;
+
+	// the colored levels are for looking at, not keeping
+	load->cacheable = r_imageCache->integer && !r_colorMipLevels->integer &&
+		!ri.Cvar_VariableIntegerValue( "sv_pure" );
+}
+
+
+static void R_SetDecodeImports( qboolean set )
+{
+	if ( set == decodeImportsSet )
+		return;
+
+	// the render thread calls through ri too
+	R_SyncRenderThread();
+
+	if ( set )
+	{
+		realImports = ri;
+
+		ri.Printf = R_DecodePrintf;
+		ri.Error = R_DecodeError;
+		ri.Malloc = R_DecodeMalloc;
+		ri.Free = R_DecodeFree;
+		ri.R_ReadFile = R_DecodeReadFile;
+		ri.FS_FreeFile = R_DecodeFreeFile;
+	}
+	else
+	{
+		ri = realImports;
+	}
+
+	decodeImportsSet = set;
+}
+
+
+static void R_DecodeImages( imageLoad_t *loads, int numLoads )
+{
+	// streaming leaves them set
+	qboolean restore = !decodeImportsSet;
+
+	R_SetDecodeImports( qtrue );
+
+	R_RunJobs( R_DecodeJob, loads, numLoads );
+
+	if ( restore )
+		R_SetDecodeImports( qfalse );
+}
+
+
+static qboolean R_IsCompressedFormat( int internalFormat )
+{
+	switch ( internalFormat )
+	{
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		case GL_RGB4_S3TC:
+			return qtrue;
+	}
+
+	return qfalse;
+}
+
+
+/*
+ * Reads back what the driver compressed an image to
+ */
+static qboolean R_ReadCompressedLevels( image_t *image, const imageUpload_t *up, imageUpload_t *out )
+{
+	GLint compressed, size;
+	int i, total;
+
+	if ( qglGetCompressedTexImageARB == NULL || qglGetTexLevelParameteriv == NULL )
+		return qfalse;
+
+	GL_Bind( image );
+
+	*out = *up;
+	out->compressed = qtrue;
+	out->buffer = NULL;
+
+	total = 0;
+	for ( i = 0; i < up->numLevels; i++ )
+	{
+		compressed = size = 0;
+		qglGetTexLevelParameteriv( GL_TEXTURE_2D, i, GL_TEXTURE_COMPRESSED_ARB, &compressed );
+		qglGetTexLevelParameteriv( GL_TEXTURE_2D, i, GL_TEXTURE_COMPRESSED_IMAGE_SIZE_ARB, &size );
+
+		if ( !compressed || size <= 0 )
+			return qfalse;
+
+		out->levelSize[i] = size;
+		total += size;
+	}
+
+	out->buffer = malloc( total );
+	if ( out->buffer == NULL )
+		return qfalse;
+
+	for ( i = 0, total = 0; i < up->numLevels; i++ )
+	{
+		out->levels[i] = out->buffer + total;
+		qglGetCompressedTexImageARB( GL_TEXTURE_2D, i, out->levels[i] );
+		total += out->levelSize[i];
+	}
+
+	return qtrue;
+}
+
+
+static void R_WriteImageCache( const imageLoad_t *load, image_t *image )
+{
+	imageCacheHeader_t *header;
+	imageUpload_t compressed;
+	const imageUpload_t *up = &load->upload;
+	char path[MAX_OSPATH];
+	byte *buf;
+	int i, size;
+
+	memset( &compressed, 0, sizeof( compressed ) );
+
+	if ( R_IsCompressedFormat( up->internalFormat ) )
+	{
+		// the texture lacks the levels a streamed image left out
+		if ( R_ImageDropLevels( image ) > 0 || !R_ReadCompressedLevels( image, up, &compressed ) )
+		{
+			R_FreeUpload( &compressed );
+			return;
+		}
+		up = &compressed;
+	}
+
+	size = sizeof( *header );
+	for ( i = 0; i < up->numLevels; i++ )
+		size += up->levelSize[i];
+
+	buf = malloc( size );
+	if ( buf != NULL )
+	{
+		header = (imageCacheHeader_t *)buf;
+		memset( header, 0, sizeof( *header ) );
+
+		header->ident = IMAGECACHE_IDENT;
+		header->version = IMAGECACHE_VERSION;
+		header->key = load->key;
+		header->sourceSize = load->fileSize;
+		header->width = up->width;
+		header->height = up->height;
+		header->uploadWidth = up->uploadWidth;
+		header->uploadHeight = up->uploadHeight;
+		header->internalFormat = up->internalFormat;
+		header->mipmap = up->mipmap;
+		header->compressed = up->compressed;
+		header->numLevels = up->numLevels;
+
+		size = sizeof( *header );
+		for ( i = 0; i < up->numLevels; i++ )
+		{
+			header->levelSize[i] = up->levelSize[i];
+			memcpy( buf + size, up->levels[i], up->levelSize[i] );
+			size += up->levelSize[i];
+
+			// a driver block size R_UseCachedImage wouldn't take
+			if ( up->levelSize[i] != R_CachedLevelSize( header, i ) )
+				break;
+		}
+
+		if ( i == up->numLevels )
+		{
+			R_ImageCachePath( load, path, sizeof( path ) );
+			ri.FS_WriteFile( path, buf, size );
+		}
+
+		free( buf );
+	}
+
+	R_FreeUpload( &compressed );
+}
+
+
+static void R_FreeImageLoad( imageLoad_t *load )
+{
+	R_FreeUpload( &load->upload );
+	free( load->file );
+	free( load->cache );
+	load->file = load->cache = NULL;
+}
+
+
+/*
+ * Uploads a decoded image and frees what the load holds, NULL when
+ * it couldn't be decoded
+ */
+static image_t *R_FinishImageLoad( imageLoad_t *load )
+{
+	image_t *image = NULL;
+
+	if ( load->prepared )
+	{
+		image = R_CreateImageFromUpload( load->name, &load->upload, load->type, load->flags );
+
+		if ( load->cacheable && !load->fromCache )
+			R_WriteImageCache( load, image );
+	}
+
+	R_FreeImageLoad( load );
+
+	return image;
+}
+
+
+static qboolean R_ImageSourceExists( const char *fileName, char *out, int size, int *pak )
+{
+	// a NULL buffer only finds the length, the pure rules apply
+	if ( ri.FS_ReadFile( fileName, NULL ) < 0 )
+		return qfalse;
+
+	Q_strncpyz( out, fileName, size );
+
+	if ( ri.FS_FileIsInPAK( fileName, pak ) != 1 )
+		*pak = 0;
+
+	return qtrue;
+}
+
+
+/*
+===============
+R_FindImageSource
+
+Finds the file that would be loaded for an image the way R_ReadImageFiles
+does, without reading it. pak is the pure checksum of the pak it is in,
+0 for a file outside the paks. qfalse when there is none.
+===============
+*/
+qboolean R_FindImageSource( const char *name, char *fileName, int size, int *pak )
+{
+	char localName[MAX_QPATH];
+	const char *ext;
+	int i, orgLoader = -1;
+
+	Q_strncpyz( localName, name, sizeof( localName ) );
+	ext = COM_GetExtension( localName );
+
+	if ( *ext )
+	{
+		for ( i = 0; i < numImageLoaders; i++ )
+		{
+			if ( !Q_stricmp( ext, imageLoaders[i].ext ) )
+				break;
+		}
+
+		if ( i < numImageLoaders )
+		{
+			if ( R_ImageSourceExists( localName, fileName, size, pak ) )
+				return qtrue;
+
+			orgLoader = i;
+			stripExtension( name, localName, sizeof( localName ) );
+		}
+	}
+
+	for ( i = 0; i < numImageLoaders; i++ )
+	{
+		if ( i == orgLoader )
+			continue;
+
+		if ( R_ImageSourceExists( va( "%s.%s", localName, imageLoaders[i].ext ), fileName, size, pak ) )
+			return qtrue;
+	}
+
+	return qfalse;
+}
+
+
+/*
+===============
+R_LoadImageFile
+
+Loads an image for R_FindImageFile. found is qfalse when there is no
+file for it, NULL with found means it should be loaded the old way
+===============
+*/
+image_t *R_LoadImageFile( const char *name, imgType_t type, imgFlags_t flags, qboolean *found )
+{
+	imageLoad_t *load = &imageBatch[0];
+
+	R_StartImageLoad( load, name, type, flags );
+
+	*found = R_ReadImageFiles( load );
+	if ( !*found )
+		return NULL;
+
+	R_DecodeImages( load, 1 );
+
+	return R_FinishImageLoad( load );
+}
+
+
+static int R_CompareImageRequests( const void *a, const void *b )
+{
+	return strcmp( ( (const imageRequest_t *)a )->name, ( (const imageRequest_t *)b )->name );
+}
+
+
+static void R_LoadImageBatch( int numLoads, int *numLoaded, int *numCached )
+{
+	imageLoad_t *load;
+	image_t *image;
+
+	R_DecodeImages( imageBatch, numLoads );
+
+	for ( load = imageBatch; load < imageBatch + numLoads; load++ )
+	{
+		*numCached += load->fromCache;
+
+		image = R_FinishImageLoad( load );
+		if ( image )
+		{
+			R_SetImageRetainable( image );
+			( *numLoaded )++;
+		}
+	}
+}
+
+
+/*
+===============
+R_PrefetchImages
+
+Loads images ahead of the shaders that use them, decoding them on the
+front end workers. Names asked for with differing flags are skipped, the
+first shader to use them decides, as are missing or broken files, those
+are left to the shaders. Sorts the requests.
+===============
+*/
+void R_PrefetchImages( imageRequest_t *requests, int numRequests )
+{
+	imageLoad_t *load;
+	int i, j, numLoads, bytes, numLoaded, numCached;
+	int start = ri.Milliseconds();
+
+	qsort( requests, numRequests, sizeof( *requests ), R_CompareImageRequests );
+
+	numLoads = bytes = numLoaded = numCached = 0;
+
+	for ( i = 0; i < numRequests; i = j )
+	{
+		qboolean mixed = qfalse;
+
+		for ( j = i + 1; j < numRequests && !strcmp( requests[j].name, requests[i].name ); j++ )
+		{
+			if ( requests[j].flags != requests[i].flags )
+				mixed = qtrue;
+		}
+
+		if ( mixed || R_FindLoadedImage( requests[i].name ) || R_IsImageRetained( requests[i].name, requests[i].flags ) )
+			continue;
+
+		load = &imageBatch[numLoads];
+		R_StartImageLoad( load, requests[i].name, IMGTYPE_COLORALPHA, requests[i].flags );
+
+		if ( !R_ReadImageFiles( load ) )
+			continue;
+
+		bytes += load->fileSize + load->cacheSize;
+
+		if ( ++numLoads == IMAGE_BATCH_SIZE || bytes >= IMAGE_BATCH_BYTES )
+		{
+			R_LoadImageBatch( numLoads, &numLoaded, &numCached );
+			numLoads = bytes = 0;
+		}
+	}
+
+	if ( numLoads )
+		R_LoadImageBatch( numLoads, &numLoaded, &numCached );
+
+	ri.Printf( PRINT_DEVELOPER, "Prefetched %d images, %d from the cache, in %d msec on %d threads\n",
+		numLoaded, numCached, ri.Milliseconds() - start, R_NumJobThreads() );
+}
+
+
+static int R_StreamThread( void *arg )
+{
+	int i;
+
+	while ( 1 )
+	{
+		SDL_SemWait( streamStart );
+
+		if ( streamQuit )
+			break;
+
+		for ( i = 0; i < numStreamLoads; i++ )
+			R_DecodeLoad( &decodeThreads[STREAM_DECODE_THREAD], &streamLoads[i] );
+
+		SDL_SemPost( streamDone );
+	}
+
+	return 0;
+}
+
+
+/*
+ * Starts the stream thread the first time it is needed, qfalse when
+ * there is none and the batches are decoded right away
+ */
+static qboolean R_StartStreamThread( void )
+{
+	if ( streamThreadTried )
+		return streamThread != NULL;
+
+	streamThreadTried = qtrue;
+
+	streamStart = SDL_CreateSemaphore( 0 );
+	streamDone = SDL_CreateSemaphore( 0 );
+
+	if ( streamStart != NULL && streamDone != NULL )
+		streamThread = SDL_CreateThread( R_StreamThread, "rstream", NULL );
+
+	if ( streamThread == NULL )
+	{
+		ri.Printf( PRINT_WARNING, "R_StartStreamThread: %s\n", SDL_GetError() );
+
+		if ( streamStart != NULL )
+			SDL_DestroySemaphore( streamStart );
+		if ( streamDone != NULL )
+			SDL_DestroySemaphore( streamDone );
+		streamStart = streamDone = NULL;
+
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+
+/*
+===============
+R_StreamImages
+
+Reads the files of images to upload again with dropLevels of their
+largest levels left out and starts decoding them, R_ImageStreamBusy
+uploads them when they are done. Images that can't be read are marked
+as failed. Call only when R_ImageStreamBusy is qfalse.
+===============
+*/
+void R_StreamImages( image_t **images, const int *dropLevels, int numImages )
+{
+	imageLoad_t *load;
+	int i, bytes;
+
+	streamStartTime = ri.Milliseconds();
+	bytes = 0;
+
+	// the file system is the main thread's, read no more than a bit a frame
+	for ( i = 0; i < numImages && numStreamLoads < IMAGE_STREAM_SIZE && bytes < IMAGE_STREAM_BYTES; i++ )
+	{
+		load = &streamLoads[numStreamLoads];
+		R_StartImageLoad( load, images[i]->imgName, images[i]->type, images[i]->flags );
+
+		if ( !R_ReadImageFiles( load ) )
+		{
+			R_SetImageStreamFailed( images[i] );
+			continue;
+		}
+
+		bytes += load->fileSize + load->cacheSize;
+
+		streamImages[numStreamLoads] = images[i];
+		streamDropLevels[numStreamLoads] = dropLevels[i];
+		numStreamLoads++;
+	}
+
+	if ( !numStreamLoads )
+		return;
+
+	R_SetDecodeImports( qtrue );
+
+	if ( R_StartStreamThread() )
+		SDL_SemPost( streamStart );
+	else
+		R_DecodeImages( streamLoads, numStreamLoads );
+}
+
+
+/*
+ * Uploads a decoded stream batch, images that couldn't be decoded
+ * are marked as failed
+ */
+static void R_UploadStreamedImages( void )
+{
+	imageLoad_t *load;
+	image_t *image;
+	int i, drop, numLoaded = 0;
+
+	for ( i = 0; i < numStreamLoads; i++ )
+	{
+		load = &streamLoads[i];
+		image = streamImages[i];
+
+		// it was loaded before, what it says now was said then
+		if ( load->messages[0] )
+			ri.Printf( PRINT_DEVELOPER, "%s", load->messages );
+
+		if ( load->prepared )
+		{
+			drop = streamDropLevels[i];
+			if ( drop > load->upload.numLevels - 1 )
+				drop = load->upload.numLevels - 1;
+
+			R_ReplaceImageLevels( image, &load->upload, drop );
+			numLoaded++;
+
+			if ( load->cacheable && !load->fromCache )
+				R_WriteImageCache( load, image );
+		}
+		else
+		{
+			R_SetImageStreamFailed( image );
+		}
+
+		R_FreeImageLoad( load );
+	}
+
+	numStreamLoads = 0;
+
+	ri.Printf( PRINT_DEVELOPER, "Streamed %d images in %d msec\n", numLoaded, ri.Milliseconds() - streamStartTime );
+}
+
+
+/*
+===============
+R_ImageStreamBusy
+
+Uploads the stream batch once it is decoded, qtrue while it is not
+===============
+*/
+qboolean R_ImageStreamBusy( void )
+{
+	if ( !numStreamLoads )
+		return qfalse;
+
+	if ( streamThread != NULL && SDL_SemTryWait( streamDone ) != 0 )
+		return qtrue;
+
+	R_UploadStreamedImages();
+
+	return qfalse;
+}
+
+
+/*
+===============
+R_ShutdownImageStream
+
+Drops the stream batch and stops the stream thread, before the images
+are deleted
+===============
+*/
+void R_ShutdownImageStream( void )
+{
+	int i;
+
+	if ( streamThread != NULL )
+	{
+		if ( numStreamLoads )
+			SDL_SemWait( streamDone );
+
+		streamQuit = qtrue;
+		SDL_SemPost( streamStart );
+		SDL_WaitThread( streamThread, NULL );
+		streamThread = NULL;
+		streamQuit = qfalse;
+	}
+
+	if ( streamStart != NULL )
+		SDL_DestroySemaphore( streamStart );
+	if ( streamDone != NULL )
+		SDL_DestroySemaphore( streamDone );
+	streamStart = streamDone = NULL;
+	streamThreadTried = qfalse;
+
+	for ( i = 0; i < numStreamLoads; i++ )
+		R_FreeImageLoad( &streamLoads[i] );
+	numStreamLoads = 0;
+
+	R_SetDecodeImports( qfalse );
+}
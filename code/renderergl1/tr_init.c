@@ -22,6 +22,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_init.c -- functions that are not called every frame
 
 #include "tr_local.h"
+#include "../renderercommon/tr_mesh_lerp.h"
+#include "../renderercommon/tr_shade_kernels.h"
+#include "../renderercommon/tr_image_kernels.h"
+#include "../renderercommon/tr_capture.h"
 
 glconfig_t  glConfig;
 
@@ -48,6 +52,10 @@ cvar_t	*r_zproj;
 
 cvar_t	*r_skipBackEnd;
 
+cvar_t	*r_smp;
+cvar_t	*r_worldThreads;
+cvar_t	*r_clusterCull;
+
 cvar_t	*r_greyscale;
 
 cvar_t	*r_measureOverdraw;
@@ -60,6 +68,7 @@ cvar_t	*r_dlightBacks;
 
 cvar_t	*r_lodbias;
 cvar_t	*r_lodscale;
+cvar_t	*r_lerpCache;
 
 cvar_t	*r_drawentities;
 cvar_t	*r_speeds;
@@ -110,6 +119,9 @@ cvar_t	*r_mapOverBrightBits;
 
 cvar_t	*r_debugSurface;
 cvar_t	*r_simpleMipMaps;
+cvar_t	*r_imageCache;
+cvar_t	*r_textureStreaming;
+cvar_t	*r_textureBudget;
 
 cvar_t	*r_showImages;
 
@@ -122,6 +134,7 @@ cvar_t	*r_printShaders;
 cvar_t	*r_marksOnTriangleMeshes;
 
 cvar_t	*r_aviMotionJpegQuality;
+cvar_t	*r_aviCaptureThreads;
 cvar_t	*r_screenshotJpegQuality;
 
 cvar_t	*r_maxpolys;
@@ -132,6 +145,7 @@ int		max_polyverts;
 
 static cvar_t* r_ext_texture_filter_anisotropic;
 static cvar_t* r_ext_max_anisotropy;
+static cvar_t* r_ext_compressed_textures;
 
 
 void (APIENTRYP qglActiveTextureARB) (GLenum texture);
@@ -139,6 +153,14 @@ void (APIENTRYP qglClientActiveTextureARB) (GLenum texture);
 void (APIENTRYP qglMultiTexCoord2fARB) (GLenum target, GLfloat s, GLfloat t);
 void (APIENTRYP qglLockArraysEXT) (GLint first, GLsizei count);
 void (APIENTRYP qglUnlockArraysEXT) (void);
+void (APIENTRYP qglBindBufferARB) (GLenum target, GLuint buffer);
+void (APIENTRYP qglDeleteBuffersARB) (GLsizei n, const GLuint *buffers);
+void (APIENTRYP qglGenBuffersARB) (GLsizei n, GLuint *buffers);
+void (APIENTRYP qglBufferDataARB) (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage);
+void *(APIENTRYP qglMapBufferARB) (GLenum target, GLenum access);
+GLboolean (APIENTRYP qglUnmapBufferARB) (GLenum target);
+void (APIENTRYP qglGetCompressedTexImageARB) (GLenum target, GLint level, void *img);
+void (APIENTRYP qglGetTexLevelParameteriv) (GLenum target, GLint level, GLenum pname, GLint *params);
 
 #define GLE(ret, name, ...) name##proc * qgl##name;
 QGL_1_1_PROCS;
@@ -220,6 +242,16 @@ void GLimp_ClearProcAddresses( void )
 
 	qglLockArraysEXT = NULL;
 	qglUnlockArraysEXT = NULL;
+
+	qglBindBufferARB = NULL;
+	qglDeleteBuffersARB = NULL;
+	qglGenBuffersARB = NULL;
+	qglBufferDataARB = NULL;
+	qglMapBufferARB = NULL;
+	qglUnmapBufferARB = NULL;
+
+	qglGetCompressedTexImageARB = NULL;
+	qglGetTexLevelParameteriv = NULL;
 #undef GLE
 }
 
@@ -239,9 +271,35 @@ void GLimp_InitExtensions( void )
 {
 	r_ext_max_anisotropy = ri.Cvar_Get( "r_ext_max_anisotropy", "2", CVAR_ARCHIVE | CVAR_LATCH );
     r_ext_texture_filter_anisotropic = ri.Cvar_Get( "r_ext_texture_filter_anisotropic", "0", CVAR_ARCHIVE | CVAR_LATCH );
+	r_ext_compressed_textures = ri.Cvar_Get( "r_ext_compressed_textures", "0", CVAR_ARCHIVE | CVAR_LATCH );
 
 	ri.Printf( PRINT_ALL,  "\n...Initializing OpenGL extensions\n" );
 
+	// GL_EXT_texture_compression_s3tc, r_imageCache reads back what the
+	// driver compressed textures to
+	glConfig.textureCompression = TC_NONE;
+	qglGetCompressedTexImageARB = NULL;
+	qglGetTexLevelParameteriv = NULL;
+	if ( GLimp_HaveExtension( "GL_ARB_texture_compression" ) &&
+	     GLimp_HaveExtension( "GL_EXT_texture_compression_s3tc" ) )
+	{
+		if ( r_ext_compressed_textures->integer )
+		{
+			glConfig.textureCompression = TC_S3TC_ARB;
+			qglGetCompressedTexImageARB = GLimp_GetProcAddress( "glGetCompressedTexImageARB" );
+			qglGetTexLevelParameteriv = GLimp_GetProcAddress( "glGetTexLevelParameteriv" );
+			ri.Printf( PRINT_ALL, "...using GL_EXT_texture_compression_s3tc\n" );
+		}
+		else
+		{
+			ri.Printf( PRINT_ALL, "...ignoring GL_EXT_texture_compression_s3tc\n" );
+		}
+	}
+	else
+	{
+		ri.Printf( PRINT_ALL, "...GL_EXT_texture_compression_s3tc not found\n" );
+	}
+
 
 	// GL_EXT_texture_env_add
 	glConfig.textureEnvAddAvailable = qfalse;
@@ -312,6 +370,38 @@ void GLimp_InitExtensions( void )
 		ri.Printf( PRINT_ALL, "...GL_EXT_compiled_vertex_array not found\n" );
 	}
 
+	// GL_ARB_pixel_buffer_object, video frames are read back through it
+	qglBindBufferARB = NULL;
+	qglDeleteBuffersARB = NULL;
+	qglGenBuffersARB = NULL;
+	qglBufferDataARB = NULL;
+	qglMapBufferARB = NULL;
+	qglUnmapBufferARB = NULL;
+	if ( GLimp_HaveExtension( "GL_ARB_pixel_buffer_object" ) && GLimp_HaveExtension( "GL_ARB_vertex_buffer_object" ) )
+	{
+		qglBindBufferARB = GLimp_GetProcAddress( "glBindBufferARB" );
+		qglDeleteBuffersARB = GLimp_GetProcAddress( "glDeleteBuffersARB" );
+		qglGenBuffersARB = GLimp_GetProcAddress( "glGenBuffersARB" );
+		qglBufferDataARB = GLimp_GetProcAddress( "glBufferDataARB" );
+		qglMapBufferARB = GLimp_GetProcAddress( "glMapBufferARB" );
+		qglUnmapBufferARB = GLimp_GetProcAddress( "glUnmapBufferARB" );
+
+		if ( qglBindBufferARB && qglDeleteBuffersARB && qglGenBuffersARB &&
+			qglBufferDataARB && qglMapBufferARB && qglUnmapBufferARB )
+		{
+			ri.Printf( PRINT_ALL, "...using GL_ARB_pixel_buffer_object\n" );
+		}
+		else
+		{
+			qglMapBufferARB = NULL;
+			ri.Printf( PRINT_ALL, "...GL_ARB_pixel_buffer_object is incomplete\n" );
+		}
+	}
+	else
+	{
+		ri.Printf( PRINT_ALL, "...GL_ARB_pixel_buffer_object not found\n" );
+	}
+
 	if ( GLimp_HaveExtension( "GL_EXT_texture_filter_anisotropic" ) )
 	{
 		if ( r_ext_texture_filter_anisotropic->integer )
@@ -631,6 +721,7 @@ void R_TakeScreenshot( int x, int y, int width, int height, char *name, qboolean
 		return;
 	}
 	cmd->commandId = RC_SCREENSHOT;
+	R_SyncNextIssue();
 
 	cmd->x = x;
 	cmd->y = y;
@@ -710,6 +801,8 @@ void R_LevelShot( void ) {
 	float		xScale, yScale;
 	int			xx, yy;
 
+	R_SyncRenderThread();
+
 	snprintf(checkname, sizeof(checkname), "levelshots/%s.tga", tr.world->baseName);
 
 	allsource = RB_ReadPixels(0, 0, glConfig.vidWidth, glConfig.vidHeight, &offset, &padlen);
@@ -877,6 +970,80 @@ void R_ScreenShotJPEG_f (void) {
 
 //============================================================================
 
+/*
+Video frames are read into a ring of pixel buffer objects and only mapped
+when the ring comes around to them again, by then the transfer is long
+done and glReadPixels doesn't stall on the frame being drawn. The frames
+are converted and compressed on the capture threads, see tr_capture.c.
+*/
+#define NUM_VIDEO_PBOS	3
+
+static GLuint			videoPBOs[NUM_VIDEO_PBOS];
+static qboolean			videoPBOMotionJpeg[NUM_VIDEO_PBOS];
+static captureFormat_t	videoPBOFormat;
+static int				videoPBOFirst;		// oldest frame not captured yet
+static int				videoPBOCount;
+
+/*
+==================
+RB_CaptureVideoPBO
+
+Hands the oldest frame in the ring to the capture threads
+==================
+*/
+static void RB_CaptureVideoPBO( void )
+{
+	const byte *pixels;
+	int i = videoPBOFirst;
+
+	qglBindBufferARB( GL_PIXEL_PACK_BUFFER_ARB, videoPBOs[i] );
+
+	pixels = qglMapBufferARB( GL_PIXEL_PACK_BUFFER_ARB, GL_READ_ONLY_ARB );
+	if ( pixels ) {
+		R_CaptureFrame( pixels, &videoPBOFormat, glConfig.deviceSupportsGamma ? R_GammaTable() : NULL,
+			videoPBOMotionJpeg[i], r_aviMotionJpegQuality->integer );
+		qglUnmapBufferARB( GL_PIXEL_PACK_BUFFER_ARB );
+	}
+
+	qglBindBufferARB( GL_PIXEL_PACK_BUFFER_ARB, 0 );
+
+	videoPBOFirst = ( videoPBOFirst + 1 ) % NUM_VIDEO_PBOS;
+	videoPBOCount--;
+}
+
+/*
+==================
+RB_FinishVideoFrames
+
+Captures what is left in the ring and waits for the capture threads
+==================
+*/
+void RB_FinishVideoFrames( void )
+{
+	while ( videoPBOCount ) {
+		RB_CaptureVideoPBO();
+	}
+
+	R_FinishCapture();
+}
+
+/*
+==================
+RB_DeleteVideoPBOs
+==================
+*/
+static void RB_DeleteVideoPBOs( void )
+{
+	RB_FinishVideoFrames();
+
+	if ( videoPBOs[0] ) {
+		qglDeleteBuffersARB( NUM_VIDEO_PBOS, videoPBOs );
+		memset( videoPBOs, 0, sizeof( videoPBOs ) );
+	}
+
+	videoPBOFirst = 0;
+}
+
 /*
 ==================
 RB_TakeVideoFrameCmd
@@ -885,73 +1052,64 @@ RB_TakeVideoFrameCmd
 const void *RB_TakeVideoFrameCmd( const void *data )
 {
 	const videoFrameCommand_t	*cmd;
-	byte				*cBuf;
-	size_t				memcount, linelen;
-	int				padwidth, avipadwidth, padlen, avipadlen;
-	GLint packAlign;
-	
+	captureFormat_t		format;
+	GLint				packAlign;
+	int					i;
+
 	cmd = (const videoFrameCommand_t *)data;
-	
+
 	qglGetIntegerv(GL_PACK_ALIGNMENT, &packAlign);
 
-	linelen = cmd->width * 3;
+	// glReadPixels pads the lines to the pack alignment
+	format.width = cmd->width;
+	format.height = cmd->height;
+	format.stride = PAD(cmd->width * 3, packAlign);
+	format.bytesPerPixel = 3;
+	format.bgr = qfalse;
+	format.topDown = qfalse;
 
-	// Alignment stuff for glReadPixels
-	padwidth = PAD(linelen, packAlign);
-	padlen = padwidth - linelen;
-	// AVI line padding
-	avipadwidth = PAD(linelen, 4);
-	avipadlen = avipadwidth - linelen;
+	if ( !qglMapBufferARB ) {
+		byte *cBuf = PADP(cmd->captureBuffer, packAlign);
 
-	cBuf = PADP(cmd->captureBuffer, packAlign);
-		
-	qglReadPixels(0, 0, cmd->width, cmd->height, GL_RGB,
-		GL_UNSIGNED_BYTE, cBuf);
+		qglReadPixels(0, 0, cmd->width, cmd->height, GL_RGB,
+			GL_UNSIGNED_BYTE, cBuf);
 
-	memcount = padwidth * cmd->height;
+		R_CaptureFrame( cBuf, &format, glConfig.deviceSupportsGamma ? R_GammaTable() : NULL,
+			cmd->motionJpeg, r_aviMotionJpegQuality->integer );
 
-	// gamma correct
-	if(glConfig.deviceSupportsGamma)
-		R_GammaCorrect(cBuf, memcount);
+		return (const void *)(cmd + 1);
+	}
 
-	if(cmd->motionJpeg)
-	{
-		memcount = RE_SaveJPGToBuffer(cmd->encodeBuffer, linelen * cmd->height,
-			r_aviMotionJpegQuality->integer,
-			cmd->width, cmd->height, cBuf, padlen);
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, memcount);
+	if ( videoPBOs[0] && memcmp( &format, &videoPBOFormat, sizeof( format ) ) ) {
+		RB_DeleteVideoPBOs();
 	}
-	else
-	{
-		byte *lineend, *memend;
-		byte *srcptr, *destptr;
-	
-		srcptr = cBuf;
-		destptr = cmd->encodeBuffer;
-		memend = srcptr + memcount;
-		
-		// swap R and B and remove line paddings
-		while(srcptr < memend)
-		{
-			lineend = srcptr + linelen;
-			while(srcptr < lineend)
-			{
-				*destptr++ = srcptr[2];
-				*destptr++ = srcptr[1];
-				*destptr++ = srcptr[0];
-				srcptr += 3;
-			}
-			
-			memset(destptr, '\0', avipadlen);
-			destptr += avipadlen;
-			
-			srcptr += padlen;
+
+	if ( !videoPBOs[0] ) {
+		videoPBOFormat = format;
+
+		qglGenBuffersARB( NUM_VIDEO_PBOS, videoPBOs );
+		for ( i = 0; i < NUM_VIDEO_PBOS; i++ ) {
+			qglBindBufferARB( GL_PIXEL_PACK_BUFFER_ARB, videoPBOs[i] );
+			qglBufferDataARB( GL_PIXEL_PACK_BUFFER_ARB, format.stride * format.height, NULL, GL_STREAM_READ_ARB );
 		}
-		
-		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, avipadwidth * cmd->height);
+		qglBindBufferARB( GL_PIXEL_PACK_BUFFER_ARB, 0 );
 	}
 
-	return (const void *)(cmd + 1);	
+	// make room for this one
+	if ( videoPBOCount == NUM_VIDEO_PBOS ) {
+		RB_CaptureVideoPBO();
+	}
+
+	i = ( videoPBOFirst + videoPBOCount ) % NUM_VIDEO_PBOS;
+
+	qglBindBufferARB( GL_PIXEL_PACK_BUFFER_ARB, videoPBOs[i] );
+	qglReadPixels( 0, 0, cmd->width, cmd->height, GL_RGB, GL_UNSIGNED_BYTE, 0 );
+	qglBindBufferARB( GL_PIXEL_PACK_BUFFER_ARB, 0 );
+
+	videoPBOMotionJpeg[i] = cmd->motionJpeg;
+	videoPBOCount++;
+
+	return (const void *)(cmd + 1);
 }
 
 //============================================================================
@@ -1097,6 +1255,9 @@ void GfxInfo_f( void )
 	ri.Printf( PRINT_ALL, "compiled vertex arrays: %s\n", enablestrings[qglLockArraysEXT != 0 ] );
 	ri.Printf( PRINT_ALL, "texenv add: %s\n", enablestrings[glConfig.textureEnvAddAvailable != 0] );
 	ri.Printf( PRINT_ALL, "compressed textures: %s\n", enablestrings[glConfig.textureCompression!=TC_NONE] );
+	ri.Printf( PRINT_ALL, "md3 vertex lerp: %s\n", R_MD3LerpImplementation() );
+	ri.Printf( PRINT_ALL, "shade kernels: %s\n", R_ShadeKernelsImplementation() );
+	ri.Printf( PRINT_ALL, "image kernels: %s\n", R_ImageKernelsImplementation() );
 
 	if ( r_finish->integer ) {
 		ri.Printf( PRINT_ALL, "Forcing glFinish\n" );
@@ -1124,7 +1285,13 @@ void R_Register( void )
 	r_overBrightBits = ri.Cvar_Get ("r_overBrightBits", "1", CVAR_ARCHIVE | CVAR_LATCH );
 	
 	r_simpleMipMaps = ri.Cvar_Get( "r_simpleMipMaps", "1", CVAR_ARCHIVE | CVAR_LATCH );
+	r_imageCache = ri.Cvar_Get( "r_imageCache", "0", CVAR_ARCHIVE );
+	r_textureStreaming = ri.Cvar_Get( "r_textureStreaming", "0", CVAR_ARCHIVE | CVAR_LATCH );
+	r_textureBudget = ri.Cvar_Get( "r_textureBudget", "0", CVAR_ARCHIVE );
 	r_vertexLight = ri.Cvar_Get( "r_vertexLight", "0", CVAR_ARCHIVE | CVAR_LATCH );
+	r_smp = ri.Cvar_Get( "r_smp", "0", CVAR_ARCHIVE | CVAR_LATCH );
+	r_worldThreads = ri.Cvar_Get( "r_worldThreads", "0", CVAR_ARCHIVE | CVAR_LATCH );
+	r_clusterCull = ri.Cvar_Get( "r_clusterCull", "0", CVAR_ARCHIVE );
 	r_uiFullScreen = ri.Cvar_Get( "r_uifullscreen", "0", 0);
 	r_subdivisions = ri.Cvar_Get ("r_subdivisions", "4", CVAR_ARCHIVE | CVAR_LATCH);
 	r_greyscale = ri.Cvar_Get("r_greyscale", "0", CVAR_ARCHIVE | CVAR_LATCH);
@@ -1188,6 +1355,7 @@ void R_Register( void )
 
 	r_measureOverdraw = ri.Cvar_Get( "r_measureOverdraw", "0", CVAR_CHEAT );
 	r_lodscale = ri.Cvar_Get( "r_lodscale", "5", CVAR_CHEAT );
+	r_lerpCache = ri.Cvar_Get( "r_lerpCache", "0", CVAR_ARCHIVE );
 	r_drawentities = ri.Cvar_Get ("r_drawentities", "1", CVAR_CHEAT );
 	r_ignore = ri.Cvar_Get( "r_ignore", "1", CVAR_CHEAT );
 	r_nocull = ri.Cvar_Get ("r_nocull", "0", CVAR_CHEAT);
@@ -1210,6 +1378,7 @@ void R_Register( void )
 	r_marksOnTriangleMeshes = ri.Cvar_Get("r_marksOnTriangleMeshes", "0", CVAR_ARCHIVE);
 
 	r_aviMotionJpegQuality = ri.Cvar_Get("r_aviMotionJpegQuality", "90", CVAR_ARCHIVE);
+	r_aviCaptureThreads = ri.Cvar_Get( "r_aviCaptureThreads", "3", CVAR_ARCHIVE | CVAR_LATCH );
 	r_screenshotJpegQuality = ri.Cvar_Get("r_screenshotJpegQuality", "90", CVAR_ARCHIVE);
 
 	r_maxpolys = ri.Cvar_Get( "r_maxpolys", va("%d", MAX_POLYS), 0);
@@ -1294,14 +1463,24 @@ void R_Init( void ) {
 	if (max_polyverts < MAX_POLYVERTS)
 		max_polyverts = MAX_POLYVERTS;
 
-	ptr = ri.Hunk_Alloc( sizeof( *backEndData ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
-	backEndData = (backEndData_t *) ptr;
-	backEndData->polys = (srfPoly_t *) ((char *) ptr + sizeof( *backEndData ));
-	backEndData->polyVerts = (polyVert_t *) ((char *) ptr + sizeof( *backEndData ) + sizeof(srfPoly_t) * max_polys);
+	for ( i = 0; i < SMP_FRAMES; i++ ) {
+		// the second frame is only used by the render thread
+		if ( i > 0 && !r_smp->integer ) {
+			backEndData[i] = NULL;
+			continue;
+		}
+
+		ptr = ri.Hunk_Alloc( sizeof( *backEndData[i] ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
+		backEndData[i] = (backEndData_t *) ptr;
+		backEndData[i]->polys = (srfPoly_t *) ((char *) ptr + sizeof( *backEndData[i] ));
+		backEndData[i]->polyVerts = (polyVert_t *) ((char *) ptr + sizeof( *backEndData[i] ) + sizeof(srfPoly_t) * max_polys);
+	}
 	R_InitNextFrame();
 
 	InitOpenGL();
 
+	R_InitImageKernels( qtrue );
+
 	R_InitImages();
 
 	R_InitShaders();
@@ -1312,11 +1491,18 @@ void R_Init( void ) {
 
 	R_InitFreeType();
 
+	R_InitWorldJobs();
+
+	R_InitCapture( r_aviCaptureThreads->integer );
+
+	R_InitShadeKernels( qtrue );
 
 	err = qglGetError();
 	if ( err != GL_NO_ERROR )
 		ri.Printf (PRINT_ALL, "glGetError() = 0x%x\n", err);
 
+	R_InitCommandBuffers();
+
 	// print info
 	GfxInfo_f();
 	ri.Printf( PRINT_ALL, "----- finished R_Init -----\n" );
@@ -1340,14 +1526,30 @@ void RE_Shutdown( qboolean destroyWindow ) {
 
 	if ( tr.registered ) {
 		R_IssuePendingRenderCommands();
+		RB_DeleteVideoPBOs();
+		R_ShutdownImageStream();
+
+		// keep what the next map is likely to use
+		if ( !destroyWindow ) {
+			R_RetainImages();
+		}
+
 		R_DeleteTextures();
 	}
 
+	R_ShutdownCommandBuffers();
+
+	R_ShutdownCapture();
+	R_ShutdownWorldJobs();
+	R_ClearClusterSurfaces();
+
 	R_DoneFreeType();
 
 	// shut down platform specific OpenGL stuff
 	if ( destroyWindow ) {
 
+		R_ReleaseRetainedImages();
+
 		GLimp_Shutdown();
 
 		memset( &glConfig, 0, sizeof( glConfig ) );
@@ -1436,6 +1638,8 @@ refexport_t *GetRefAPI ( int apiVersion, refimport_t *rimp ) {
 	re.inPVS = R_inPVS;
 
 	re.TakeVideoFrame = RE_TakeVideoFrame;
+	re.FinishVideoFrames = RE_FinishVideoFrames;
+	re.SwapMicroseconds = RE_SwapMicroseconds;
 
 	return &re;
 }
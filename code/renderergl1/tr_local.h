@@ -37,6 +37,11 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #define GL_INDEX_TYPE		GL_UNSIGNED_INT
 typedef unsigned int glIndex_t;
 
+// everything that is needed by the backend needs
+// to be double buffered to allow it to run in
+// parallel with the front end on a render thread
+#define	SMP_FRAMES		2
+
 // 14 bits
 // can't be increased without changing bit packing for drawsurfs
 // see QSORT_SHADERNUM_SHIFT
@@ -518,7 +523,7 @@ typedef struct srfGridMesh_s {
 	surfaceType_t	surfaceType;
 
 	// dynamic lighting information
-	int				dlightBits;
+	int				dlightBits[SMP_FRAMES];
 
 	// culling information
 	vec3_t			meshBounds[2];
@@ -548,7 +553,7 @@ typedef struct {
 	cplane_t	plane;
 
 	// dynamic lighting information
-	int			dlightBits;
+	int			dlightBits[SMP_FRAMES];
 
 	// triangle definitions (no normals at points)
 	int			numPoints;
@@ -564,7 +569,7 @@ typedef struct {
 	surfaceType_t	surfaceType;
 
 	// dynamic lighting information
-	int				dlightBits;
+	int				dlightBits[SMP_FRAMES];
 
 	// culling information (FIXME: use this!)
 	vec3_t			bounds[2];
@@ -841,10 +846,12 @@ typedef struct {
 // all state modified by the back end is separated
 // from the front end state
 typedef struct {
+	int			smpFrame;
 	trRefdef_t	refdef;
 	viewParms_t	viewParms;
 	orientationr_t	or;
 	backEndCounters_t	pc;
+	int			swapUsec;		// glFinish and swap of the last frame
 	qboolean	isHyperspace;
 	trRefEntity_t	*currentEntity;
 	qboolean	skyRenderedThisView;	// flag for drawing sun
@@ -874,6 +881,8 @@ typedef struct {
 
 	int						frameSceneNum;	// zeroed at RE_BeginFrame
 
+	int						smpFrame;		// backEndData being filled by the front end
+
 	qboolean				worldMapLoaded;
 	world_t					*world;
 
@@ -978,6 +987,7 @@ extern cvar_t	*r_measureOverdraw;		// enables stencil buffer overdraw measuremen
 
 extern cvar_t	*r_lodbias;				// push/pull LOD transitions
 extern cvar_t	*r_lodscale;
+extern cvar_t	*r_lerpCache;			// reuse decoded md3 vertexes within a frame
 
 extern cvar_t	*r_primitives;			// "0" = based on compiled vertex array existence
 										// "1" = glDrawElemet tristrips
@@ -1031,6 +1041,10 @@ extern	cvar_t	*r_subdivisions;
 extern	cvar_t	*r_lodCurveError;
 extern	cvar_t	*r_skipBackEnd;
 
+extern	cvar_t	*r_smp;
+extern	cvar_t	*r_worldThreads;		// front end threads walking the BSP, 0 = none
+extern	cvar_t	*r_clusterCull;			// cull a per cluster surface list instead of walking the BSP
+
 extern	cvar_t	*r_greyscale;
 
 extern	cvar_t	*r_ignoreGLErrors;
@@ -1040,6 +1054,9 @@ extern	cvar_t	*r_mapOverBrightBits;
 
 extern	cvar_t	*r_debugSurface;
 extern	cvar_t	*r_simpleMipMaps;
+extern	cvar_t	*r_imageCache;			// keep prepared mip chains in imagecache/
+extern	cvar_t	*r_textureStreaming;	// start with small mips, load the detail in view
+extern	cvar_t	*r_textureBudget;		// MB of textures, kept ones from earlier maps included
 
 extern	cvar_t	*r_showImages;
 extern	cvar_t	*r_debugSort;
@@ -1151,6 +1168,7 @@ void    	R_Init( void );
 
 void		R_SetColorMappings( void );
 void		R_GammaCorrect( byte *buffer, int bufSize );
+const byte	*R_GammaTable( void );
 
 void	R_ImageList_f( void );
 void	R_SkinList_f( void );
@@ -1167,10 +1185,18 @@ void	R_InitSkins( void );
 skin_t	*R_GetSkinByHandle( qhandle_t hSkin );
 
 const void *RB_TakeVideoFrameCmd( const void *data );
+void	RB_FinishVideoFrames( void );
 
 //
 // tr_shader.c
 //
+
+// an image a shader loads, see R_ShaderImages
+typedef struct imageRequest_s {
+	char		name[MAX_QPATH];
+	imgFlags_t	flags;
+} imageRequest_t;
+
 shader_t	*R_FindShader( const char *name, int lightmapIndex, qboolean mipRawImage );
 shader_t	*R_GetShaderByHandle( qhandle_t hShader );
 shader_t	*R_GetShaderByState( int index, long *cycleTime );
@@ -1178,6 +1204,7 @@ shader_t *R_FindShaderByName( const char *name );
 void		R_InitShaders( void );
 void		R_ShaderList_f( void );
 void    R_RemapShader(const char *oldShader, const char *newShader, const char *timeOffset);
+int		R_ShaderImages( const char *name, qboolean mipRawImage, imageRequest_t *images, int maxImages );
 image_t *R_FindImageFile( const char *name, imgType_t type, imgFlags_t flags );
 /*
 ====================================================================
@@ -1251,6 +1278,9 @@ WORLD MAP
 
 void R_AddBrushModelSurfaces( trRefEntity_t *e );
 void R_AddWorldSurfaces( void );
+void R_InitWorldJobs( void );
+void R_ShutdownWorldJobs( void );
+void R_ClearClusterSurfaces( void );
 qboolean R_inPVS( const vec3_t p1, const vec3_t p2 );
 
 
@@ -1528,25 +1558,103 @@ typedef struct {
 extern	int		max_polys;
 extern	int		max_polyverts;
 
-extern	backEndData_t	*backEndData;	// the second one may not be allocated
+extern	backEndData_t	*backEndData[SMP_FRAMES];	// the second one may not be allocated
+
+extern	volatile qboolean	renderThreadActive;
 
 
 void *R_GetCommandBuffer( int bytes );
 void RB_ExecuteRenderCommands( const void *data );
 
+void R_InitCommandBuffers( void );
+void R_ShutdownCommandBuffers( void );
+void RB_RenderThread( void );
+
 void R_IssuePendingRenderCommands( void );
+void R_SyncRenderThread( void );
+void R_SyncNextIssue( void );
 image_t *R_CreateImage( const char *name, unsigned char *pic, int width, int height, imgType_t type, imgFlags_t flags, int internalFormat );
 
+/*
+** The CPU half of an image upload, the mip chain the way it goes to GL.
+** R_PrepareUpload makes one from pixels on any thread, the image cache
+** from a file, see tr_imageload.c
+*/
+#define MAX_UPLOAD_LEVELS	16
+
+typedef struct {
+	int			width, height;				// of the source image
+	int			uploadWidth, uploadHeight;	// of the first level
+	int			internalFormat;
+	qboolean	mipmap;
+	qboolean	compressed;					// levels are blocks of internalFormat
+	int			numLevels;
+	int			levelSize[MAX_UPLOAD_LEVELS];
+	byte		*levels[MAX_UPLOAD_LEVELS];
+	byte		*buffer;					// malloc'd, holds all the levels
+} imageUpload_t;
+
+typedef struct {
+	char	*ext;
+	void	(*ImageLoader)( const char *, unsigned char **, int *, int * );
+} imageExtToLoaderMap_t;
+
+extern const imageExtToLoaderMap_t	imageLoaders[];
+extern const int					numImageLoaders;
+
+#define IMAGE_HASH_SEED		2166136261u
+
+qboolean R_PrepareUpload( unsigned *data, int width, int height, qboolean mipmap, qboolean picmip,
+		qboolean lightMap, qboolean allowCompression, imageUpload_t *up );
+void R_FreeUpload( imageUpload_t *up );
+image_t *R_CreateImageFromUpload( const char *name, const imageUpload_t *up, imgType_t type, imgFlags_t flags );
+image_t *R_CreateImageFromTexture( const char *name, GLuint texnum, int width, int height,
+		int uploadWidth, int uploadHeight, int internalFormat, imgType_t type, imgFlags_t flags,
+		int dropLevels, qboolean streamable );
+void R_ReplaceImageLevels( image_t *image, const imageUpload_t *up, int dropLevels );
+image_t *R_FindLoadedImage( const char *name );
+unsigned R_HashBytes( unsigned hash, const void *data, int size );
+unsigned R_HashUploadSettings( unsigned hash );
+
+//
+// tr_imageload.c
+//
+image_t *R_LoadImageFile( const char *name, imgType_t type, imgFlags_t flags, qboolean *found );
+void R_PrefetchImages( imageRequest_t *requests, int numRequests );
+qboolean R_FindImageSource( const char *name, char *fileName, int size, int *pak );
+void R_StreamImages( image_t **images, const int *dropLevels, int numImages );
+qboolean R_ImageStreamBusy( void );
+void R_ShutdownImageStream( void );
+
+//
+// tr_residency.c
+//
+int R_StreamStartLevel( const imageUpload_t *up );
+void R_TrackImage( image_t *image, int dropLevels, qboolean streamable );
+void R_SetImageDropLevels( image_t *image, int dropLevels );
+void R_SetImageStreamFailed( image_t *image );
+void R_SetImageRetainable( image_t *image );
+int R_ImageDropLevels( const image_t *image );
+void R_NoteShaderImages( shader_t *shader );
+void R_NoteDrawSurfImages( drawSurf_t *drawSurfs, int numDrawSurfs );
+void R_RetainImages( void );
+void R_ReleaseRetainedImages( void );
+qboolean R_IsImageRetained( const char *name, imgFlags_t flags );
+image_t *R_FindRetainedImage( const char *name, imgType_t type, imgFlags_t flags );
+void R_UpdateResidency( void );
+
 void RE_SetColor( const float *rgba );
 void RE_StretchPic ( float x, float y, float w, float h, 
 					  float s1, float t1, float s2, float t2, qhandle_t hShader );
 void RE_EndFrame( int *frontEndMsec, int *backEndMsec );
+int RE_SwapMicroseconds( void );
 void RE_SaveJPG(char * filename, int quality, int image_width, int image_height,
                 unsigned char *image_buffer, int padding);
 size_t RE_SaveJPGToBuffer(byte *buffer, size_t bufSize, int quality,
 		          int image_width, int image_height, byte *image_buffer, int padding);
 void RE_TakeVideoFrame( int width, int height,
 		byte *captureBuffer, byte *encodeBuffer, qboolean motionJpeg );
+void RE_FinishVideoFrames( void );
 
 
 #define GLE(ret, name, ...) extern name##proc * qgl##name;
@@ -1566,4 +1674,10 @@ void* GLimp_GetProcAddress(const char* fun);
 void GLimp_DeleteGLContext(void);
 void GLimp_DestroyWindow(void);
 
+// SMP
+void* GLimp_RendererSleep( void );
+qboolean GLimp_SpawnRenderThread( void (*function)( void ) );
+void GLimp_WakeRenderer( void *data );
+void GLimp_FrontEndSleep( void );
+
 #endif //TR_LOCAL_H
@@ -0,0 +1,825 @@
+/*
+ * ==================================================================================
+ *       Filename:  tr_residency.c
+ *    Description:  texture streaming and images kept across map changes
+ * ==================================================================================
+ */
+
+/*
+ * With r_textureStreaming the mipmapped images loaded through
+ * tr_imageload.c start with their largest levels left out, no bigger
+ * than STREAM_START_SIZE. R_SortDrawSurfs notes how close the surfaces
+ * of each shader are, RE_StretchPic notes 2D pics as close as can be,
+ * and R_UpdateResidency decodes the images in view again at the detail
+ * the view asks for, a batch at a time on the stream thread, which is
+ * uploaded on a later frame. There is no reading textures back in GL 1,
+ * so images are shrunk the same way. Images that can't be read or
+ * decoded again are left the way they are.
+ *
+ * With r_textureBudget the textures of images loaded from files are
+ * kept when the map changes, the least recently used beyond the budget
+ * are deleted, and R_FindImageFile takes them over for the next map
+ * instead of loading them again. Models, weapons and the HUD are
+ * mostly the same on every map. They are only taken over when the file
+ * they were loaded from would still be the one loaded, from the same
+ * pak, pure servers and paks overriding them change that. The budget
+ * bounds the retained textures together with the ones in use, streamed
+ * images idle for STREAM_IDLE_FRAMES go back to their start size when
+ * it is exceeded.
+ *
+ * The sizes are estimates from the internal formats, drivers may pad.
+ * Single textures fit an int, the totals and the budget are 64 bit.
+ */
+
+#include "tr_local.h"
+#include "../renderercommon/tr_jobs.h"
+
+
+#define STREAM_START_SIZE		128		// largest level streamed images start with
+#define STREAM_TEXEL_SIZE		0.5f	// world units of a texel at the default shader scale
+#define STREAM_IDLE_FRAMES		600		// unused for that long, may be shrunk again
+#define MAX_RETAINED_IMAGES		MAX_DRAWIMAGES
+
+typedef struct {
+	int			bytes;					// estimated size of the texture
+	int			dropLevels;				// largest levels left out
+	int			startLevels;			// what it was loaded with
+	int			wantedLevels;			// what the last frame needs
+	unsigned	lastUsed;
+	qboolean	streamable;
+	qboolean	streamFailed;			// couldn't be loaded again, not tried any more
+	qboolean	retainable;				// loaded from a file
+	char		sourceName[MAX_QPATH];	// the file, when retainable
+	int			sourcePak;				// pure checksum of its pak, 0 outside the paks
+} imageResidency_t;
+
+typedef struct {
+	char		name[MAX_QPATH];
+	imgType_t	type;
+	imgFlags_t	flags;
+	unsigned	settings;				// R_HashUploadSettings when it was loaded
+	GLuint		texnum;
+	int			width, height;
+	int			uploadWidth, uploadHeight;
+	int			internalFormat;
+	int			dropLevels;
+	int			startLevels;
+	qboolean	streamable;
+	char		sourceName[MAX_QPATH];
+	int			sourcePak;
+	int			bytes;
+	unsigned	lastUsed;
+} retainedImage_t;
+
+static imageResidency_t	residency[MAX_DRAWIMAGES];	// by image_t index
+
+static retainedImage_t	retained[MAX_RETAINED_IMAGES];
+static int				numRetained;
+
+// counts frames, unlike tr.frameCount it goes on over map changes
+static unsigned			residencyClock;
+
+// nearest surface of each shader in a view
+static float			shaderDistance[MAX_SHADERS];
+static unsigned			shaderNoted[MAX_SHADERS];
+static int				notedShaders[MAX_SHADERS];
+static unsigned			noteCount;
+
+static int				streamStart;				// round robin over the images
+
+
+/*
+ * Estimates the memory a texture takes
+ */
+static int R_TextureBytes( int internalFormat, int width, int height, qboolean mipmap )
+{
+	int quarters;	// quarter bytes per texel
+	int bytes;
+
+	switch ( internalFormat )
+	{
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_RGB4_S3TC:
+			quarters = 2;
+			break;
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		case GL_LUMINANCE:
+		case GL_LUMINANCE8:
+			quarters = 4;
+			break;
+		case GL_RGB5:
+		case GL_RGBA4:
+		case GL_LUMINANCE16:
+		case GL_LUMINANCE_ALPHA:
+		case GL_LUMINANCE8_ALPHA8:
+			quarters = 8;
+			break;
+		default:
+			quarters = 16;
+			break;
+	}
+
+	bytes = width * height / 4 * quarters;
+	if ( bytes < quarters )
+		bytes = quarters;
+
+	// the mip chain adds a third
+	if ( mipmap )
+		bytes += bytes / 3;
+
+	return bytes;
+}
+
+
+static int R_ImageBytes( const image_t *image )
+{
+	return R_TextureBytes( image->internalFormat, image->uploadWidth, image->uploadHeight,
+		image->flags & IMGFLAG_MIPMAP );
+}
+
+
+static int64_t R_BudgetBytes( void )
+{
+	if ( r_textureBudget->integer <= 0 )
+		return 0;
+
+	return (int64_t)r_textureBudget->integer << 20;
+}
+
+
+/*
+================
+R_StreamStartLevel
+
+How many of the largest levels of a prepared image to leave out when it
+is first uploaded
+================
+*/
+int R_StreamStartLevel( const imageUpload_t *up )
+{
+	int levels = 0;
+
+	if ( !r_textureStreaming->integer || !up->mipmap )
+		return 0;
+
+	while ( levels < up->numLevels - 1 &&
+		( ( up->uploadWidth >> levels ) > STREAM_START_SIZE || ( up->uploadHeight >> levels ) > STREAM_START_SIZE ) )
+		levels++;
+
+	return levels;
+}
+
+
+/*
+================
+R_TrackImage
+
+Starts keeping track of a new image, dropLevels of its largest levels
+left out
+================
+*/
+void R_TrackImage( image_t *image, int dropLevels, qboolean streamable )
+{
+	imageResidency_t *res = &residency[image->index];
+
+	res->bytes = R_ImageBytes( image );
+	res->dropLevels = dropLevels;
+	res->startLevels = dropLevels;
+	res->wantedLevels = dropLevels;
+	res->lastUsed = residencyClock;
+	res->streamable = streamable && dropLevels > 0;
+	res->streamFailed = qfalse;
+	res->retainable = qfalse;
+}
+
+
+/*
+================
+R_SetImageDropLevels
+
+After the levels of a streamed image were uploaded again
+================
+*/
+void R_SetImageDropLevels( image_t *image, int dropLevels )
+{
+	imageResidency_t *res = &residency[image->index];
+
+	res->bytes = R_ImageBytes( image );
+	res->dropLevels = dropLevels;
+}
+
+
+/*
+================
+R_SetImageStreamFailed
+
+The file of a streamed image couldn't be read or decoded again
+================
+*/
+void R_SetImageStreamFailed( image_t *image )
+{
+	residency[image->index].streamFailed = qtrue;
+}
+
+
+/*
+================
+R_SetImageRetainable
+
+Images loaded from files may be kept for the next map, noting the file
+they are loaded from now
+================
+*/
+void R_SetImageRetainable( image_t *image )
+{
+	imageResidency_t *res = &residency[image->index];
+
+	res->retainable = R_FindImageSource( image->imgName, res->sourceName, sizeof( res->sourceName ), &res->sourcePak );
+}
+
+
+int R_ImageDropLevels( const image_t *image )
+{
+	return residency[image->index].dropLevels;
+}
+
+
+/*
+ * Only streaming and the budget look at what the frames use
+ */
+static qboolean R_TrackingUse( void )
+{
+	return r_textureStreaming->integer || r_textureBudget->integer > 0;
+}
+
+
+static void R_NoteImage( image_t *image, int wantedLevels )
+{
+	imageResidency_t *res = &residency[image->index];
+
+	if ( res->lastUsed != residencyClock )
+	{
+		res->lastUsed = residencyClock;
+		res->wantedLevels = res->startLevels;
+	}
+
+	if ( wantedLevels < res->wantedLevels )
+		res->wantedLevels = wantedLevels;
+}
+
+
+/*
+ * Marks the images of a shader used this frame, wantedLevels is how many
+ * of their largest levels they can do without
+ */
+static void R_NoteShaderImagesLevels( shader_t *shader, int wantedLevels )
+{
+	int i, b, a, numImages;
+
+	if ( shader->remappedShader )
+		shader = shader->remappedShader;
+
+	for ( i = 0; i < MAX_SHADER_STAGES; i++ )
+	{
+		shaderStage_t *stage = shader->stages[i];
+
+		if ( !stage || !stage->active )
+			break;
+
+		for ( b = 0; b < NUM_TEXTURE_BUNDLES; b++ )
+		{
+			// only animMap counts its images, map and clampMap leave it 0
+			numImages = MIN( MAX( stage->bundle[b].numImageAnimations, 1 ), MAX_IMAGE_ANIMATIONS );
+
+			for ( a = 0; a < numImages; a++ )
+			{
+				if ( stage->bundle[b].image[a] )
+					R_NoteImage( stage->bundle[b].image[a], wantedLevels );
+			}
+		}
+	}
+
+	for ( i = 0; i < 6; i++ )
+	{
+		if ( shader->sky.outerbox[i] )
+			R_NoteImage( shader->sky.outerbox[i], wantedLevels );
+		if ( shader->sky.innerbox[i] )
+			R_NoteImage( shader->sky.innerbox[i], wantedLevels );
+	}
+}
+
+
+/*
+================
+R_NoteShaderImages
+
+For shaders drawn in 2D, which want all the detail there is
+================
+*/
+void R_NoteShaderImages( shader_t *shader )
+{
+	if ( !R_TrackingUse() )
+		return;
+
+	R_NoteShaderImagesLevels( shader, 0 );
+}
+
+
+/*
+ * How far a surface is at least from the view, 0 when it can't tell
+ */
+static float R_SurfaceDistance( const drawSurf_t *drawSurf, int entityNum )
+{
+	const float *viewOrg = tr.viewParms.or.origin;
+	const trRefEntity_t *ent;
+	vec3_t delta;
+	float dist;
+
+	if ( entityNum != REFENTITYNUM_WORLD )
+	{
+		ent = &tr.refdef.entities[entityNum];
+
+		if ( ent->e.renderfx & ( RF_FIRST_PERSON | RF_DEPTHHACK ) )
+			return 0;
+
+		// brush models keep their surfaces in world space
+		switch ( *drawSurf->surface )
+		{
+			case SF_MD3:
+			case SF_MDR:
+			case SF_IQM:
+				VectorSubtract( ent->e.origin, viewOrg, delta );
+				return VectorLength( delta );
+			default:
+				return 0;
+		}
+	}
+
+	switch ( *drawSurf->surface )
+	{
+		case SF_FACE:
+		{
+			const srfSurfaceFace_t *face = (const srfSurfaceFace_t *)drawSurf->surface;
+
+			dist = DotProduct( viewOrg, face->plane.normal ) - face->plane.dist;
+			return fabs( dist );
+		}
+		case SF_GRID:
+		{
+			const srfGridMesh_t *grid = (const srfGridMesh_t *)drawSurf->surface;
+
+			VectorSubtract( grid->localOrigin, viewOrg, delta );
+			dist = VectorLength( delta ) - grid->meshRadius;
+			break;
+		}
+		case SF_TRIANGLES:
+		{
+			const srfTriangles_t *tris = (const srfTriangles_t *)drawSurf->surface;
+
+			VectorSubtract( tris->localOrigin, viewOrg, delta );
+			dist = VectorLength( delta ) - tris->radius;
+			break;
+		}
+		default:
+			return 0;
+	}
+
+	return dist > 0 ? dist : 0;
+}
+
+
+/*
+================
+R_NoteDrawSurfImages
+
+Marks the images of the surfaces of a view used this frame, with the
+detail they need from how close the nearest surface of their shader is
+================
+*/
+void R_NoteDrawSurfImages( drawSurf_t *drawSurfs, int numDrawSurfs )
+{
+	shader_t *shader;
+	int i, entityNum, fogNum, dlighted, numNoted;
+	float dist, fullDistance, tanHalfFov;
+
+	if ( !R_TrackingUse() )
+		return;
+
+	numNoted = 0;
+	noteCount++;
+
+	for ( i = 0; i < numDrawSurfs; i++ )
+	{
+		R_DecomposeSort( drawSurfs[i].sort, &entityNum, &shader, &fogNum, &dlighted );
+
+		// without streaming only the use counts
+		dist = r_textureStreaming->integer ? R_SurfaceDistance( &drawSurfs[i], entityNum ) : 0;
+
+		if ( shaderNoted[shader->index] != noteCount )
+		{
+			shaderNoted[shader->index] = noteCount;
+			shaderDistance[shader->index] = dist;
+			notedShaders[numNoted++] = shader->index;
+		}
+		else if ( dist < shaderDistance[shader->index] )
+		{
+			shaderDistance[shader->index] = dist;
+		}
+	}
+
+	// a texel is as big as a pixel this far away, every doubling
+	// of the distance can do with a level less
+	tanHalfFov = tan( tr.viewParms.fovX * ( M_PI / 360.0f ) );
+	if ( tanHalfFov < 0.01f )
+		tanHalfFov = 0.01f;
+	fullDistance = STREAM_TEXEL_SIZE * tr.viewParms.viewportWidth / ( 2.0f * tanHalfFov );
+	if ( fullDistance < 1.0f )
+		fullDistance = 1.0f;
+
+	for ( i = 0; i < numNoted; i++ )
+	{
+		int levels = 0;
+
+		dist = shaderDistance[notedShaders[i]];
+		while ( dist > fullDistance * 2.0f && levels < MAX_UPLOAD_LEVELS )
+		{
+			dist *= 0.5f;
+			levels++;
+		}
+
+		R_NoteShaderImagesLevels( tr.shaders[notedShaders[i]], levels );
+	}
+}
+
+
+static void R_DeleteRetainedImage( int i )
+{
+	qglDeleteTextures( 1, &retained[i].texnum );
+	retained[i] = retained[--numRetained];
+}
+
+
+static int64_t R_RetainedBytes( void )
+{
+	int64_t bytes = 0;
+	int i;
+
+	for ( i = 0; i < numRetained; i++ )
+		bytes += retained[i].bytes;
+
+	return bytes;
+}
+
+
+static int R_LeastRecentlyRetained( void )
+{
+	int i, oldest = 0;
+
+	for ( i = 1; i < numRetained; i++ )
+	{
+		if ( retained[i].lastUsed < retained[oldest].lastUsed )
+			oldest = i;
+	}
+
+	return oldest;
+}
+
+
+/*
+ * Deletes the least recently used retained textures until
+ * bytes of them are left at most
+ */
+static void R_EvictRetainedImages( int64_t bytes )
+{
+	int64_t total = R_RetainedBytes();
+	int i;
+
+	while ( numRetained && total > bytes )
+	{
+		i = R_LeastRecentlyRetained();
+		total -= retained[i].bytes;
+		R_DeleteRetainedImage( i );
+	}
+}
+
+
+/*
+================
+R_RetainImages
+
+Called before the textures are deleted for a map change, takes over
+the ones to keep
+================
+*/
+void R_RetainImages( void )
+{
+	unsigned settings = R_HashUploadSettings( IMAGE_HASH_SEED );
+	retainedImage_t *ret;
+	imageResidency_t *res;
+	image_t *image;
+	int64_t budget = R_BudgetBytes();
+	int i;
+
+	if ( !budget )
+	{
+		R_ReleaseRetainedImages();
+		return;
+	}
+
+	for ( i = 0; i < tr.numImages; i++ )
+	{
+		image = tr.images[i];
+		res = &residency[i];
+
+		if ( !res->retainable || !image->texnum )
+			continue;
+
+		if ( numRetained == MAX_RETAINED_IMAGES )
+			R_DeleteRetainedImage( R_LeastRecentlyRetained() );
+
+		ret = &retained[numRetained++];
+
+		Q_strncpyz( ret->name, image->imgName, sizeof( ret->name ) );
+		ret->type = image->type;
+		ret->flags = image->flags;
+		ret->settings = settings;
+		ret->texnum = image->texnum;
+		ret->width = image->width;
+		ret->height = image->height;
+		ret->uploadWidth = image->uploadWidth;
+		ret->uploadHeight = image->uploadHeight;
+		ret->internalFormat = image->internalFormat;
+		ret->dropLevels = res->dropLevels;
+		ret->startLevels = res->startLevels;
+		ret->streamable = res->streamable;
+		Q_strncpyz( ret->sourceName, res->sourceName, sizeof( ret->sourceName ) );
+		ret->sourcePak = res->sourcePak;
+		ret->bytes = res->bytes;
+		ret->lastUsed = res->lastUsed;
+
+		// R_DeleteTextures leaves it alone now
+		image->texnum = 0;
+	}
+
+	R_EvictRetainedImages( budget );
+
+	ri.Printf( PRINT_DEVELOPER, "Retained %d images, %d KB\n", numRetained, (int)( R_RetainedBytes() >> 10 ) );
+}
+
+
+/*
+================
+R_ReleaseRetainedImages
+
+Deletes all the retained textures, before the context goes away
+================
+*/
+void R_ReleaseRetainedImages( void )
+{
+	while ( numRetained )
+		R_DeleteRetainedImage( numRetained - 1 );
+}
+
+
+static int R_FindRetained( const char *name, imgFlags_t flags )
+{
+	int i;
+
+	for ( i = 0; i < numRetained; i++ )
+	{
+		if ( retained[i].flags == flags && !strcmp( retained[i].name, name ) )
+			return i;
+	}
+
+	return -1;
+}
+
+
+/*
+================
+R_IsImageRetained
+================
+*/
+qboolean R_IsImageRetained( const char *name, imgFlags_t flags )
+{
+	return R_FindRetained( name, flags ) >= 0;
+}
+
+
+/*
+================
+R_FindRetainedImage
+
+Takes over the texture an earlier map left for an image, NULL when there
+is none that was loaded the same way
+================
+*/
+image_t *R_FindRetainedImage( const char *name, imgType_t type, imgFlags_t flags )
+{
+	retainedImage_t ret;
+	imageResidency_t *res;
+	image_t *image;
+	char sourceName[MAX_QPATH];
+	int i, sourcePak;
+
+	i = R_FindRetained( name, flags );
+	if ( i < 0 )
+		return NULL;
+
+	ret = retained[i];
+	retained[i] = retained[--numRetained];
+
+	// picmip, gamma or the like changed since, or another file or pak
+	// would be loaded for it now, the search paths or sv_pure changed
+	if ( ret.type != type || ret.settings != R_HashUploadSettings( IMAGE_HASH_SEED ) ||
+		!R_FindImageSource( name, sourceName, sizeof( sourceName ), &sourcePak ) ||
+		Q_stricmp( sourceName, ret.sourceName ) || sourcePak != ret.sourcePak )
+	{
+		qglDeleteTextures( 1, &ret.texnum );
+		return NULL;
+	}
+
+	image = R_CreateImageFromTexture( name, ret.texnum, ret.width, ret.height, ret.uploadWidth,
+		ret.uploadHeight, ret.internalFormat, type, flags, ret.dropLevels, ret.streamable );
+
+	res = &residency[image->index];
+	res->startLevels = ret.startLevels;
+	res->streamable = ret.streamable;
+	res->retainable = qtrue;
+	Q_strncpyz( res->sourceName, ret.sourceName, sizeof( res->sourceName ) );
+	res->sourcePak = ret.sourcePak;
+
+	return image;
+}
+
+
+static int64_t R_ResidentBytes( void )
+{
+	int64_t bytes = 0;
+	int i;
+
+	for ( i = 0; i < tr.numImages; i++ )
+		bytes += residency[i].bytes;
+
+	return bytes + R_RetainedBytes();
+}
+
+
+static qboolean R_IsPicked( const image_t *image, image_t **images, int numImages )
+{
+	int i;
+
+	for ( i = 0; i < numImages; i++ )
+	{
+		if ( images[i] == image )
+			return qtrue;
+	}
+
+	return qfalse;
+}
+
+
+/*
+ * Picks streamed images to shrink back to their start size, ones
+ * unused for the longest first, until bytes are freed or there are
+ * no more of them, returns what they free
+ */
+static int64_t R_PickIdleImages( image_t **images, int *dropLevels, int *numImages, int maxImages, int64_t bytes )
+{
+	imageResidency_t *res;
+	image_t *image;
+	int64_t freed = 0;
+	int i, oldest, levels;
+
+	while ( freed < bytes && *numImages < maxImages )
+	{
+		oldest = -1;
+
+		for ( i = 0; i < tr.numImages; i++ )
+		{
+			res = &residency[i];
+
+			if ( !res->streamable || res->streamFailed || res->dropLevels >= res->startLevels )
+				continue;
+			if ( residencyClock - res->lastUsed < STREAM_IDLE_FRAMES )
+				continue;
+			if ( oldest >= 0 && res->lastUsed >= residency[oldest].lastUsed )
+				continue;
+			if ( R_IsPicked( tr.images[i], images, *numImages ) )
+				continue;
+
+			oldest = i;
+		}
+
+		if ( oldest < 0 )
+			break;
+
+		image = tr.images[oldest];
+		res = &residency[oldest];
+		levels = res->startLevels - res->dropLevels;
+
+		images[*numImages] = image;
+		dropLevels[*numImages] = res->startLevels;
+		( *numImages )++;
+
+		freed += res->bytes - R_TextureBytes( image->internalFormat,
+			MAX( image->uploadWidth >> levels, 1 ), MAX( image->uploadHeight >> levels, 1 ), qtrue );
+	}
+
+	return freed;
+}
+
+
+/*
+================
+R_UpdateResidency
+
+Called at the start of every frame, streams the images the last frame
+needed in or out and keeps the budget
+================
+*/
+void R_UpdateResidency( void )
+{
+	image_t *images[MAX_JOB_THREADS * 2];
+	int dropLevels[MAX_JOB_THREADS * 2];
+	image_t *idle[MAX_JOB_THREADS];
+	int idleLevels[MAX_JOB_THREADS];
+	imageResidency_t *res;
+	image_t *image;
+	int64_t budget, resident, growth;
+	int i, n, numImages, numIdle, maxLoads, levels;
+
+	budget = R_BudgetBytes();
+
+	// the images of the last frame
+	residencyClock++;
+
+	if ( budget && numRetained && ( resident = R_ResidentBytes() ) > budget )
+	{
+		R_SyncRenderThread();
+		R_EvictRetainedImages( MAX( budget - ( resident - R_RetainedBytes() ), 0 ) );
+	}
+
+	// the images of the last batch are uploaded once they are decoded
+	if ( R_ImageStreamBusy() )
+		return;
+
+	if ( !r_textureStreaming->integer || !tr.numImages )
+		return;
+
+	maxLoads = MIN( MAX( R_NumJobThreads(), 1 ), MAX_JOB_THREADS );
+	resident = budget ? R_ResidentBytes() : 0;
+	numImages = numIdle = 0;
+
+	for ( n = 0; n < tr.numImages && numImages < maxLoads; n++ )
+	{
+		i = ( streamStart + n ) % tr.numImages;
+		res = &residency[i];
+		image = tr.images[i];
+
+		if ( !res->streamable || res->streamFailed || res->lastUsed != residencyClock - 1 )
+			continue;
+		if ( res->wantedLevels >= res->dropLevels )
+			continue;
+
+		if ( budget )
+		{
+			levels = res->dropLevels - res->wantedLevels;
+			growth = R_TextureBytes( image->internalFormat, image->uploadWidth << levels,
+				image->uploadHeight << levels, qtrue ) - res->bytes;
+
+			// make room with what the last maps left first
+			if ( resident + growth > budget && numRetained )
+			{
+				R_SyncRenderThread();
+				resident -= R_RetainedBytes();
+				R_EvictRetainedImages( MAX( budget - growth - resident, 0 ) );
+				resident += R_RetainedBytes();
+			}
+
+			if ( resident + growth > budget )
+				resident -= R_PickIdleImages( idle, idleLevels, &numIdle, maxLoads, resident + growth - budget );
+
+			if ( resident + growth > budget )
+				break;
+
+			resident += growth;
+		}
+
+		images[numImages] = image;
+		dropLevels[numImages] = res->wantedLevels;
+		numImages++;
+	}
+
+	streamStart = ( streamStart + n ) % tr.numImages;
+
+	for ( i = 0; i < numIdle; i++ )
+	{
+		images[numImages] = idle[i];
+		dropLevels[numImages] = idleLevels[i];
+		numImages++;
+	}
+
+	if ( numImages )
+		R_StreamImages( images, dropLevels, numImages );
+}
@@ -22,6 +22,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 // tr_shade_calc.c
 
 #include "tr_local.h"
+#include "../renderercommon/tr_shade_kernels.h"
 
 #define	WAVEVALUE( table, base, amplitude, phase, freq )  ((base) + table[ ( (int64_t) ( ( (phase) + tess.shaderTime * (freq) ) * FUNCTABLE_SIZE ) ) & FUNCTABLE_MASK ] * (amplitude))
 
@@ -116,45 +117,16 @@ RB_CalcDeformVertexes
 */
 void RB_CalcDeformVertexes( deformStage_t *ds )
 {
-	int i;
-	vec3_t	offset;
-	float	scale;
-	float	*xyz = ( float * ) tess.xyz;
-	float	*normal = ( float * ) tess.normal;
-	float	*table;
-
 	if ( ds->deformationWave.frequency == 0 )
 	{
-		scale = EvalWaveForm( &ds->deformationWave );
-
-		for ( i = 0; i < tess.numVertexes; i++, xyz += 4, normal += 4 )
-		{
-			VectorScale( normal, scale, offset );
-			
-			xyz[0] += offset[0];
-			xyz[1] += offset[1];
-			xyz[2] += offset[2];
-		}
+		R_DeformVertexesScaled( tess.xyz[0], tess.normal[0], tess.numVertexes, EvalWaveForm( &ds->deformationWave ) );
 	}
 	else
 	{
-		table = TableForFunc( ds->deformationWave.func );
-
-		for ( i = 0; i < tess.numVertexes; i++, xyz += 4, normal += 4 )
-		{
-			float off = ( xyz[0] + xyz[1] + xyz[2] ) * ds->deformationSpread;
-
-			scale = WAVEVALUE( table, ds->deformationWave.base, 
-				ds->deformationWave.amplitude,
-				ds->deformationWave.phase + off,
-				ds->deformationWave.frequency );
-
-			VectorScale( normal, scale, offset );
-			
-			xyz[0] += offset[0];
-			xyz[1] += offset[1];
-			xyz[2] += offset[2];
-		}
+		R_DeformVertexesWave( tess.xyz[0], tess.normal[0], tess.numVertexes,
+			TableForFunc( ds->deformationWave.func ),
+			ds->deformationWave.base, ds->deformationWave.amplitude, ds->deformationWave.phase,
+			tess.shaderTime * ds->deformationWave.frequency, ds->deformationSpread );
 	}
 }
 
@@ -593,15 +565,7 @@ void RB_CalcColorFromEntity( unsigned char (*dstColors)[4] )
 {
 	if ( backEnd.currentEntity )
 	{
-		uint32_t i;
-		uint32_t nVerts = tess.numVertexes; 
-		for ( i = 0; i < nVerts; i++)
-		{
-			dstColors[i][0]=backEnd.currentEntity->e.shaderRGBA[0];
-			dstColors[i][1]=backEnd.currentEntity->e.shaderRGBA[1];
-			dstColors[i][2]=backEnd.currentEntity->e.shaderRGBA[2];
-			dstColors[i][3]=backEnd.currentEntity->e.shaderRGBA[3];
-		}
+		R_FillColors( dstColors[0], tess.numVertexes, backEnd.currentEntity->e.shaderRGBA );
 	}	
 }
 
@@ -617,14 +581,7 @@ void RB_CalcColorFromOneMinusEntity( unsigned char (*dstColors)[4] )
 		invModulate[2] = 255 - backEnd.currentEntity->e.shaderRGBA[2];
 		invModulate[3] = 255 - backEnd.currentEntity->e.shaderRGBA[3];	// this trashes alpha, but the AGEN block fixes it
 
-		uint32_t i;
-		for ( i = 0; i < tess.numVertexes; i++ )
-		{
-			dstColors[i][0] = invModulate[0];
-			dstColors[i][1] = invModulate[1];
-			dstColors[i][2] = invModulate[2];
-			dstColors[i][3] = invModulate[3];
-		}
+		R_FillColors( dstColors[0], tess.numVertexes, invModulate );
 	}
 }
 
@@ -633,17 +590,10 @@ void RB_CalcColorFromOneMinusEntity( unsigned char (*dstColors)[4] )
 */
 void RB_CalcAlphaFromEntity( unsigned char *dstColors )
 {
-	int	i;
-
 	if ( !backEnd.currentEntity )
 		return;
 
-	dstColors += 3;
-
-	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
-	{
-		*dstColors = backEnd.currentEntity->e.shaderRGBA[3];
-	}
+	R_FillAlphas( dstColors, tess.numVertexes, backEnd.currentEntity->e.shaderRGBA[3] );
 }
 
 /*
@@ -651,17 +601,10 @@ void RB_CalcAlphaFromEntity( unsigned char *dstColors )
 */
 void RB_CalcAlphaFromOneMinusEntity( unsigned char *dstColors )
 {
-	int	i;
-
 	if ( !backEnd.currentEntity )
 		return;
 
-	dstColors += 3;
-
-	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
-	{
-		*dstColors = 0xff - backEnd.currentEntity->e.shaderRGBA[3];
-	}
+	R_FillAlphas( dstColors, tess.numVertexes, 0xff - backEnd.currentEntity->e.shaderRGBA[3] );
 }
 
 
@@ -680,16 +623,12 @@ void RB_CalcWaveColor( const waveForm_t* wf, unsigned char (*dstColors)[4] )
 		glow = 1;
 
 
-    unsigned char color = glow * 255;
+	unsigned char color[4];
 
-    uint32_t i;  
-	for(i = 0; i < tess.numVertexes; i++)
-    {
-		dstColors[i][0] = color;
-    	dstColors[i][1] = color;
-        dstColors[i][2] = color;
-		dstColors[i][3] = 255;
-    }
+	color[0] = color[1] = color[2] = glow * 255;
+	color[3] = 255;
+
+	R_FillColors( dstColors[0], tess.numVertexes, color );
 }
 
 /*
@@ -697,7 +636,6 @@ void RB_CalcWaveColor( const waveForm_t* wf, unsigned char (*dstColors)[4] )
 */
 void RB_CalcWaveAlpha( const waveForm_t *wf, unsigned char *dstColors )
 {
-	int i;
 	int v;
 	float glow;
 
@@ -705,17 +643,13 @@ void RB_CalcWaveAlpha( const waveForm_t *wf, unsigned char *dstColors )
 
 	v = 255 * glow;
 
-	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
-	{
-		dstColors[3] = v;
-	}
+	R_FillAlphas( dstColors, tess.numVertexes, v );
 }
 
 /*
 ** RB_CalcModulateColorsByFog
 */
 void RB_CalcModulateColorsByFog( unsigned char *colors ) {
-	int		i;
 	float	texCoords[SHADER_MAX_VERTEXES][2];
 
 	// calculate texcoords so we can derive density
@@ -723,19 +657,13 @@ void RB_CalcModulateColorsByFog( unsigned char *colors ) {
 	// been previously called if the surface was opaque
 	RB_CalcFogTexCoords( texCoords[0] );
 
-	for ( i = 0; i < tess.numVertexes; i++, colors += 4 ) {
-		float f = 1.0 - R_FogFactor( texCoords[i][0], texCoords[i][1] );
-		colors[0] *= f;
-		colors[1] *= f;
-		colors[2] *= f;
-	}
+	R_ModulateByFog( colors, texCoords[0], tess.numVertexes, tr.fogTable, qtrue, qfalse );
 }
 
 /*
 ** RB_CalcModulateAlphasByFog
 */
 void RB_CalcModulateAlphasByFog( unsigned char *colors ) {
-	int		i;
 	float	texCoords[SHADER_MAX_VERTEXES][2];
 
 	// calculate texcoords so we can derive density
@@ -743,17 +671,13 @@ void RB_CalcModulateAlphasByFog( unsigned char *colors ) {
 	// been previously called if the surface was opaque
 	RB_CalcFogTexCoords( texCoords[0] );
 
-	for ( i = 0; i < tess.numVertexes; i++, colors += 4 ) {
-		float f = 1.0 - R_FogFactor( texCoords[i][0], texCoords[i][1] );
-		colors[3] *= f;
-	}
+	R_ModulateByFog( colors, texCoords[0], tess.numVertexes, tr.fogTable, qfalse, qtrue );
 }
 
 /*
 ** RB_CalcModulateRGBAsByFog
 */
 void RB_CalcModulateRGBAsByFog( unsigned char *colors ) {
-	int		i;
 	float	texCoords[SHADER_MAX_VERTEXES][2] = {{0.0f}};
 
 	// calculate texcoords so we can derive density
@@ -761,13 +685,7 @@ void RB_CalcModulateRGBAsByFog( unsigned char *colors ) {
 	// been previously called if the surface was opaque
 	RB_CalcFogTexCoords( texCoords[0] );
 
-	for ( i = 0; i < tess.numVertexes; i++, colors += 4 ) {
-		float f = 1.0 - R_FogFactor( texCoords[i][0], texCoords[i][1] );
-		colors[0] *= f;
-		colors[1] *= f;
-		colors[2] *= f;
-		colors[3] *= f;
-	}
+	R_ModulateByFog( colors, texCoords[0], tess.numVertexes, tr.fogTable, qtrue, qtrue );
 }
 
 
@@ -789,11 +707,7 @@ doesn't fit our shader data.
 ========================
 */
 void RB_CalcFogTexCoords( float *st ) {
-	int			i;
-	float		*v;
-	float		s, t;
 	float		eyeT;
-	qboolean	eyeOutside;
 	fog_t		*fog;
 	vec3_t		local;
 	vec4_t		fogDistanceVector, fogDepthVector = {0, 0, 0, 0};
@@ -828,42 +742,11 @@ void RB_CalcFogTexCoords( float *st ) {
 		eyeT = 1;	// non-surface fog always has eye inside
 	}
 
-	// see if the viewpoint is outside
-	// this is needed for clipping distance even for constant fog
-
-	if ( eyeT < 0 ) {
-		eyeOutside = qtrue;
-	} else {
-		eyeOutside = qfalse;
-	}
-
 	fogDistanceVector[3] += 1.0/512;
 
-	// calculate density for each point
-	for (i = 0, v = tess.xyz[0] ; i < tess.numVertexes ; i++, v += 4) {
-		// calculate the length in fog
-		s = DotProduct( v, fogDistanceVector ) + fogDistanceVector[3];
-		t = DotProduct( v, fogDepthVector ) + fogDepthVector[3];
-
-		// partially clipped fogs use the T axis		
-		if ( eyeOutside ) {
-			if ( t < 1.0 ) {
-				t = 1.0/32;	// point is outside, so no fogging
-			} else {
-				t = 1.0/32 + 30.0/32 * t / ( t - eyeT );	// cut the distance at the fog plane
-			}
-		} else {
-			if ( t < 0 ) {
-				t = 1.0/32;	// point is outside, so no fogging
-			} else {
-				t = 31.0/32;
-			}
-		}
-
-		st[0] = s;
-		st[1] = t;
-		st += 2;
-	}
+	// calculate density for each point, the viewpoint is outside when eyeT < 0
+	// this is needed for clipping distance even for constant fog
+	R_FogTexCoords( st, tess.xyz[0], tess.numVertexes, fogDistanceVector, fogDepthVector, eyeT );
 }
 
 
@@ -873,27 +756,7 @@ void RB_CalcFogTexCoords( float *st ) {
 */
 void RB_CalcEnvironmentTexCoords( float *st ) 
 {
-	int			i;
-	float		*v, *normal;
-	vec3_t		viewer, reflected;
-
-	v = tess.xyz[0];
-	normal = tess.normal[0];
-
-	for (i = 0 ; i < tess.numVertexes ; i++, v += 4, normal += 4, st += 2 ) 
-	{
-		VectorSubtract (backEnd.or.viewOrigin, v, viewer);
-		FastNormalize1f(viewer);
-
-		float d = DotProduct (normal, viewer);
-
-		reflected[0] = normal[0]*2*d - viewer[0];
-		reflected[1] = normal[1]*2*d - viewer[1];
-		reflected[2] = normal[2]*2*d - viewer[2];
-
-		st[0] = 0.5 + reflected[1] * 0.5;
-		st[1] = 0.5 - reflected[2] * 0.5;
-	}
+	R_EnvironmentTexCoords( st, tess.xyz[0], tess.normal[0], tess.numVertexes, backEnd.or.viewOrigin );
 }
 
 /*
@@ -901,19 +764,11 @@ void RB_CalcEnvironmentTexCoords( float *st )
 */
 void RB_CalcTurbulentTexCoords( const waveForm_t *wf, float *st )
 {
-	int i;
 	double now;
 
 	now = ( wf->phase + tess.shaderTime * wf->frequency );
 
-	for ( i = 0; i < tess.numVertexes; i++, st += 2 )
-	{
-		float s = st[0];
-		float t = st[1];
-
-		st[0] = s + tr.sinTable[ ( ( int64_t ) ( ( ( tess.xyz[i][0] + tess.xyz[i][2] )* 1.0/128 * 0.125 + now ) * FUNCTABLE_SIZE ) ) & ( FUNCTABLE_MASK ) ] * wf->amplitude;
-		st[1] = t + tr.sinTable[ ( ( int64_t ) ( ( tess.xyz[i][1] * 1.0/128 * 0.125 + now ) * FUNCTABLE_SIZE ) ) & ( FUNCTABLE_MASK ) ] * wf->amplitude;
-	}
+	R_TurbulentTexCoords( st, tess.xyz[0], tess.numVertexes, tr.sinTable, now, wf->amplitude );
 }
 
 /*
@@ -1056,53 +911,9 @@ void RB_CalcSpecularAlpha( unsigned char *alphas ) {
 
 void RB_CalcDiffuseColor( unsigned char (*colors)[4] )
 {
-
 	trRefEntity_t* ent = backEnd.currentEntity;
 
-    vec3_t abtLit;
-    abtLit[0] = ent->ambientLight[0];
-    abtLit[1] = ent->ambientLight[1];
-    abtLit[2] = ent->ambientLight[2];
-
-    vec3_t drtLit;
-    drtLit[0] = ent->directedLight[0];
-    drtLit[1] = ent->directedLight[1];
-    drtLit[2] = ent->directedLight[2];
-
-    vec3_t litDir;
-    litDir[0] = ent->lightDir[0];
-    litDir[1] = ent->lightDir[1];
-    litDir[2] = ent->lightDir[2];
-    
-    unsigned char ambLitRGBA[4];  
-    ambLitRGBA[0] = ent->ambientLightRGBA[0];
-    ambLitRGBA[1] = ent->ambientLightRGBA[1];
-    ambLitRGBA[2] = ent->ambientLightRGBA[2];
-    ambLitRGBA[3] = ent->ambientLightRGBA[3];
-
-    int numVertexes = tess.numVertexes;
-	int	i;
-	for (i = 0 ; i < numVertexes ; i++)
-    {
-		float incoming = DotProduct(tess.normal[i], litDir);
-		
-        if( incoming <= 0 )
-        {
-			colors[i][0] = ambLitRGBA[0];
-            colors[i][1] = ambLitRGBA[1];
-			colors[i][2] = ambLitRGBA[2];
-			colors[i][3] = ambLitRGBA[3];
-		}
-        else
-        {
-            unsigned int r = abtLit[0] + incoming * drtLit[0];
-            colors[i][0] = (r <= 255 ? r : 255);
-            unsigned int g = abtLit[1] + incoming * drtLit[1];
-            colors[i][1] = (g <= 255 ? g : 255);
-            unsigned int b = abtLit[2] + incoming * drtLit[2];
-            colors[i][2] = (b <= 255 ? b : 255);
-            colors[i][3] = 255;
-        }
-	}
+	R_DiffuseColors( colors[0], tess.normal[0], tess.numVertexes,
+		ent->ambientLight, ent->directedLight, ent->lightDir, ent->ambientLightRGBA );
 }
 
@@ -1875,7 +1875,7 @@ sortedIndex.
 ==============
 */
 static void FixRenderCommandList( int newShader ) {
-	renderCommandList_t	*cmdList = &backEndData->commands;
+	renderCommandList_t	*cmdList = &backEndData[tr.smpFrame]->commands;
 
 	if( cmdList ) {
 		const void *curCmd = cmdList->cmds;
@@ -1954,6 +1954,9 @@ static void SortNewShader( void ) {
 	float	sort;
 	shader_t	*newShader;
 
+	// the render thread may still be reading tr.sortedShaders
+	R_SyncRenderThread();
+
 	newShader = tr.shaders[ tr.numShaders - 1 ];
 	sort = newShader->sort;
 
@@ -2371,6 +2374,121 @@ static char *FindShaderInShaderText( const char *shadername ) {
 }
 
 
+/*
+====================
+R_AddShaderImage
+====================
+*/
+static int R_AddShaderImage( imageRequest_t *images, int numImages, int maxImages, const char *name, imgFlags_t flags ) {
+	// built in images and $lightmap
+	if ( numImages >= maxImages || name[0] == '*' || name[0] == '$' ) {
+		return numImages;
+	}
+
+	Q_strncpyz( images[numImages].name, name, sizeof( images[numImages].name ) );
+	images[numImages].flags = flags;
+
+	return numImages + 1;
+}
+
+
+/*
+====================
+R_ShaderImages
+
+Lists the images R_FindShader would load for a shader with the flags it
+would load them with, so they can be decoded ahead of time. Follows map,
+clampMap, animMap, skyParms, nomipmaps and nopicmip, anything it gets
+wrong is still loaded right when the shader is parsed.
+====================
+*/
+int R_ShaderImages( const char *name, qboolean mipRawImage, imageRequest_t *images, int maxImages ) {
+	char		strippedName[MAX_QPATH];
+	char		pathname[MAX_QPATH];
+	static char	*suf[6] = {"rt", "bk", "lf", "ft", "up", "dn"};
+	char		*text, *token;
+	qboolean	noMipMaps = qfalse, noPicMip = qfalse;
+	imgFlags_t	flags;
+	int			depth, numImages, i;
+
+	stripExtension( name, strippedName, sizeof( strippedName ) );
+
+	text = FindShaderInShaderText( strippedName );
+	if ( !text ) {
+		// a single image file, see R_FindShader
+		return R_AddShaderImage( images, 0, maxImages, name,
+			mipRawImage ? IMGFLAG_MIPMAP | IMGFLAG_PICMIP : IMGFLAG_CLAMPTOEDGE );
+	}
+
+	numImages = 0;
+	depth = 0;
+
+	while ( 1 ) {
+		token = R_ParseExt( &text, qtrue );
+		if ( !token[0] ) {
+			break;
+		}
+
+		if ( token[0] == '{' ) {
+			depth++;
+			continue;
+		}
+		if ( token[0] == '}' ) {
+			if ( --depth <= 0 ) {
+				break;
+			}
+			continue;
+		}
+
+		flags = IMGFLAG_NONE;
+		if ( !noMipMaps ) {
+			flags |= IMGFLAG_MIPMAP;
+		}
+		if ( !noPicMip ) {
+			flags |= IMGFLAG_PICMIP;
+		}
+
+		if ( !Q_stricmp( token, "nomipmaps" ) ) {
+			noMipMaps = qtrue;
+			noPicMip = qtrue;
+		} else if ( !Q_stricmp( token, "nopicmip" ) ) {
+			noPicMip = qtrue;
+		} else if ( !Q_stricmp( token, "surfaceParm" ) ) {
+			R_ParseExt( &text, qfalse );
+		} else if ( !Q_stricmp( token, "map" ) ) {
+			token = R_ParseExt( &text, qfalse );
+			numImages = R_AddShaderImage( images, numImages, maxImages, token, flags );
+		} else if ( !Q_stricmp( token, "clampmap" ) ) {
+			token = R_ParseExt( &text, qfalse );
+			numImages = R_AddShaderImage( images, numImages, maxImages, token, flags | IMGFLAG_CLAMPTOEDGE );
+		} else if ( !Q_stricmp( token, "animMap" ) ) {
+			R_ParseExt( &text, qfalse );
+
+			for ( i = 0 ; ; i++ ) {
+				token = R_ParseExt( &text, qfalse );
+				if ( !token[0] ) {
+					break;
+				}
+				if ( i < MAX_IMAGE_ANIMATIONS ) {
+					numImages = R_AddShaderImage( images, numImages, maxImages, token, flags );
+				}
+			}
+		} else if ( !Q_stricmp( token, "skyParms" ) ) {
+			token = R_ParseExt( &text, qfalse );
+			if ( token[0] && strcmp( token, "-" ) ) {
+				for ( i = 0 ; i < 6 ; i++ ) {
+					Com_sprintf( pathname, sizeof( pathname ), "%s_%s.tga", token, suf[i] );
+					numImages = R_AddShaderImage( images, numImages, maxImages, pathname,
+						IMGFLAG_MIPMAP | IMGFLAG_PICMIP | IMGFLAG_CLAMPTOEDGE );
+				}
+			}
+		}
+	}
+
+	return numImages;
+}
+
+
 /*
 ==================
 R_FindShaderByName
@@ -20,7 +20,44 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 ===========================================================================
 */
 #include "tr_local.h"
+#include "../renderercommon/tr_jobs.h"
+#include "../renderercommon/tr_boxcull.h"
 
+/*
+=============================================================
+
+	PARALLEL WORLD TRAVERSAL
+
+With r_worldThreads the BSP is split into subtrees that are walked
+by the front end worker threads. Each thread appends to its own
+bucket and the buckets are merged in subtree order before the sort,
+so the result doesn't depend on which thread took which subtree.
+
+=============================================================
+*/
+
+#define	MAX_WORLD_JOBS		64
+
+typedef struct {
+	drawSurf_t			*drawSurfs;		// MAX_DRAWSURFS
+	int					numDrawSurfs;
+	frontEndCounters_t	pc;
+	vec3_t				visBounds[2];
+} worldBucket_t;
+
+typedef struct {
+	mnode_t			*node;
+	unsigned int	planeBits;
+	unsigned int	dlightBits;
+
+	int				thread;			// bucket the surfaces went to
+	int				firstDrawSurf;
+	int				numDrawSurfs;
+} worldJob_t;
+
+static worldBucket_t	worldBuckets[MAX_JOB_THREADS];
+static worldJob_t		worldJobs[MAX_WORLD_JOBS];
+static int				numWorldJobs;
 
 
 /*
@@ -50,7 +87,7 @@ Returns true if the grid is completely culled away.
 Also sets the clipped hint bit in tess
 =================
 */
-static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
+static qboolean	R_CullGrid( srfGridMesh_t *cv, frontEndCounters_t *pc ) {
 	int 	boxCull;
 	int 	sphereCull;
 
@@ -67,33 +104,33 @@ static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
 	// check for trivial reject
 	if ( sphereCull == CULL_OUT )
 	{
-		tr.pc.c_sphere_cull_patch_out++;
+		pc->c_sphere_cull_patch_out++;
 		return qtrue;
 	}
 	// check bounding box if necessary
 	else if ( sphereCull == CULL_CLIP )
 	{
-		tr.pc.c_sphere_cull_patch_clip++;
+		pc->c_sphere_cull_patch_clip++;
 
 		boxCull = R_CullLocalBox( cv->meshBounds );
 
 		if ( boxCull == CULL_OUT ) 
 		{
-			tr.pc.c_box_cull_patch_out++;
+			pc->c_box_cull_patch_out++;
 			return qtrue;
 		}
 		else if ( boxCull == CULL_IN )
 		{
-			tr.pc.c_box_cull_patch_in++;
+			pc->c_box_cull_patch_in++;
 		}
 		else
 		{
-			tr.pc.c_box_cull_patch_clip++;
+			pc->c_box_cull_patch_clip++;
 		}
 	}
 	else
 	{
-		tr.pc.c_sphere_cull_patch_in++;
+		pc->c_sphere_cull_patch_in++;
 	}
 
 	return qfalse;
@@ -110,7 +147,7 @@ added to the sorting list.
 This will also allow mirrors on both sides of a model without recursion.
 ================
 */
-static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
+static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader, frontEndCounters_t *pc ) {
 	srfSurfaceFace_t *sface;
 	float			d;
 
@@ -119,7 +156,7 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 	}
 
 	if ( *surface == SF_GRID ) {
-		return R_CullGrid( (srfGridMesh_t *)surface );
+		return R_CullGrid( (srfGridMesh_t *)surface, pc );
 	}
 
 	if ( *surface == SF_TRIANGLES ) {
@@ -159,7 +196,7 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 }
 
 
-static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits ) {
+static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits, frontEndCounters_t *pc ) {
 	float		d;
 	int			i;
 	dlight_t	*dl;
@@ -177,14 +214,14 @@ static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		pc->c_dlightSurfacesCulled++;
 	}
 
-	face->dlightBits = dlightBits;
+	face->dlightBits[ tr.smpFrame ] = dlightBits;
 	return dlightBits;
 }
 
-static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits ) {
+static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits, frontEndCounters_t *pc ) {
 	int			i;
 	dlight_t	*dl;
 
@@ -205,17 +242,17 @@ static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		pc->c_dlightSurfacesCulled++;
 	}
 
-	grid->dlightBits = dlightBits;
+	grid->dlightBits[ tr.smpFrame ] = dlightBits;
 	return dlightBits;
 }
 
 
 static int R_DlightTrisurf( srfTriangles_t *surf, int dlightBits ) {
 	// FIXME: more dlight culling to trisurfs...
-	surf->dlightBits = dlightBits;
+	surf->dlightBits[ tr.smpFrame ] = dlightBits;
 	return dlightBits;
 #if 0
 	int			i;
@@ -238,10 +275,10 @@ static int R_DlightTrisurf( srfTriangles_t *surf, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		pc->c_dlightSurfacesCulled++;
 	}
 
-	grid->dlightBits = dlightBits;
+	grid->dlightBits[ tr.smpFrame ] = dlightBits;
 	return dlightBits;
 #endif
 }
@@ -255,11 +292,11 @@ that is touched by one or more dlights, so try to throw out
 more dlights if possible.
 ====================
 */
-static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
+static int R_DlightSurface( msurface_t *surf, int dlightBits, frontEndCounters_t *pc ) {
 	if ( *surf->data == SF_FACE ) {
-		dlightBits = R_DlightFace( (srfSurfaceFace_t *)surf->data, dlightBits );
+		dlightBits = R_DlightFace( (srfSurfaceFace_t *)surf->data, dlightBits, pc );
 	} else if ( *surf->data == SF_GRID ) {
-		dlightBits = R_DlightGrid( (srfGridMesh_t *)surf->data, dlightBits );
+		dlightBits = R_DlightGrid( (srfGridMesh_t *)surf->data, dlightBits, pc );
 	} else if ( *surf->data == SF_TRIANGLES ) {
 		dlightBits = R_DlightTrisurf( (srfTriangles_t *)surf->data, dlightBits );
 	} else {
@@ -267,7 +304,7 @@ static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
 	}
 
 	if ( dlightBits ) {
-		tr.pc.c_dlightSurfaces++;
+		pc->c_dlightSurfaces++;
 	}
 
 	return dlightBits;
@@ -280,26 +317,49 @@ static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
 R_AddWorldSurface
 ======================
 */
-static void R_AddWorldSurface( msurface_t *surf, int dlightBits ) {
-	if ( surf->viewCount == tr.viewCount ) {
-		return;		// already in this view
-	}
+static void R_AddWorldSurface( msurface_t *surf, int dlightBits, worldBucket_t *bucket ) {
+	frontEndCounters_t	*pc = bucket ? &bucket->pc : &tr.pc;
+	drawSurf_t			*drawSurf;
+
+	if ( bucket ) {
+		// another thread may reach the surface through a different leaf
+		if ( R_AtomicExchange( &surf->viewCount, tr.viewCount ) == tr.viewCount ) {
+			return;
+		}
+	} else {
+		if ( surf->viewCount == tr.viewCount ) {
+			return;		// already in this view
+		}
 
-	surf->viewCount = tr.viewCount;
+		surf->viewCount = tr.viewCount;
+	}
 	// FIXME: bmodel fog?
 
 	// try to cull before dlighting or adding
-	if ( R_CullSurface( surf->data, surf->shader ) ) {
+	if ( R_CullSurface( surf->data, surf->shader, pc ) ) {
 		return;
 	}
 
 	// check for dlighting
 	if ( dlightBits ) {
-		dlightBits = R_DlightSurface( surf, dlightBits );
+		dlightBits = R_DlightSurface( surf, dlightBits, pc );
 		dlightBits = ( dlightBits != 0 );
 	}
 
-	R_AddDrawSurf( surf->data, surf->shader, surf->fogIndex, dlightBits );
+	if ( !bucket ) {
+		R_AddDrawSurf( surf->data, surf->shader, surf->fogIndex, dlightBits );
+		return;
+	}
+
+	if ( bucket->numDrawSurfs >= MAX_DRAWSURFS ) {
+		return;
+	}
+
+	// same packing as R_AddDrawSurf
+	drawSurf = &bucket->drawSurfs[ bucket->numDrawSurfs++ ];
+	drawSurf->sort = (surf->shader->sortedIndex << QSORT_SHADERNUM_SHIFT)
+		| tr.shiftedEntityNum | ( surf->fogIndex << QSORT_FOGNUM_SHIFT ) | dlightBits;
+	drawSurf->surface = surf->data;
 }
 
 /*
@@ -334,7 +394,7 @@ void R_AddBrushModelSurfaces ( trRefEntity_t *ent ) {
 	R_DlightBmodel( bmodel );
 
 	for ( i = 0 ; i < bmodel->numSurfaces ; i++ ) {
-		R_AddWorldSurface( bmodel->firstSurface + i, tr.currentEntity->needDlights );
+		R_AddWorldSurface( bmodel->firstSurface + i, tr.currentEntity->needDlights, NULL );
 	}
 }
 
@@ -353,7 +413,7 @@ void R_AddBrushModelSurfaces ( trRefEntity_t *ent ) {
 R_RecursiveWorldNode
 ================
 */
-static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigned int dlightBits ) {
+static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigned int dlightBits, worldBucket_t *bucket ) {
 
 	do {
 		unsigned int newDlights[2];
@@ -443,7 +503,7 @@ static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigne
 		}
 
 		// recurse down the children, front side first
-		R_RecursiveWorldNode(node->children[0], planeBits, newDlights[0] );
+		R_RecursiveWorldNode(node->children[0], planeBits, newDlights[0], bucket );
 
 		// tail recurse
 		node = node->children[1];
@@ -454,28 +514,33 @@ static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigne
 		// leaf node, so add mark surfaces
 		int			c;
 		msurface_t	*surf, **mark;
+		vec3_t		*visBounds = bucket ? bucket->visBounds : tr.viewParms.visBounds;
 
-		tr.pc.c_leafs++;
+		if ( bucket ) {
+			bucket->pc.c_leafs++;
+		} else {
+			tr.pc.c_leafs++;
+		}
 
 		// add to z buffer bounds
-		if ( node->mins[0] < tr.viewParms.visBounds[0][0] ) {
-			tr.viewParms.visBounds[0][0] = node->mins[0];
+		if ( node->mins[0] < visBounds[0][0] ) {
+			visBounds[0][0] = node->mins[0];
 		}
-		if ( node->mins[1] < tr.viewParms.visBounds[0][1] ) {
-			tr.viewParms.visBounds[0][1] = node->mins[1];
+		if ( node->mins[1] < visBounds[0][1] ) {
+			visBounds[0][1] = node->mins[1];
 		}
-		if ( node->mins[2] < tr.viewParms.visBounds[0][2] ) {
-			tr.viewParms.visBounds[0][2] = node->mins[2];
+		if ( node->mins[2] < visBounds[0][2] ) {
+			visBounds[0][2] = node->mins[2];
 		}
 
-		if ( node->maxs[0] > tr.viewParms.visBounds[1][0] ) {
-			tr.viewParms.visBounds[1][0] = node->maxs[0];
+		if ( node->maxs[0] > visBounds[1][0] ) {
+			visBounds[1][0] = node->maxs[0];
 		}
-		if ( node->maxs[1] > tr.viewParms.visBounds[1][1] ) {
-			tr.viewParms.visBounds[1][1] = node->maxs[1];
+		if ( node->maxs[1] > visBounds[1][1] ) {
+			visBounds[1][1] = node->maxs[1];
 		}
-		if ( node->maxs[2] > tr.viewParms.visBounds[1][2] ) {
-			tr.viewParms.visBounds[1][2] = node->maxs[2];
+		if ( node->maxs[2] > visBounds[1][2] ) {
+			visBounds[1][2] = node->maxs[2];
 		}
 
 		// add the individual surfaces
@@ -485,7 +550,7 @@ static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigne
 			// the surface may have already been added if it
 			// spans multiple leafs
 			surf = *mark;
-			R_AddWorldSurface( surf, dlightBits );
+			R_AddWorldSurface( surf, dlightBits, bucket );
 			mark++;
 		}
 	}
@@ -493,6 +558,358 @@ static void R_RecursiveWorldNode( mnode_t *node, unsigned int planeBits, unsigne
 }
 
 
+/*
+================
+R_SplitWorldNode
+
+Collects the visible subtrees depth levels below node as jobs,
+doing the same culling and dlight splitting R_RecursiveWorldNode
+would do on the way down
+================
+*/
+static void R_SplitWorldNode( mnode_t *node, unsigned int planeBits, unsigned int dlightBits, int depth ) {
+	worldJob_t		*job;
+	unsigned int	newDlights[2];
+	int				i;
+
+	if ( node->visframe != tr.visCount ) {
+		return;
+	}
+
+	if ( !r_nocull->integer ) {
+		for ( i = 0 ; i < 4 ; i++ ) {
+			int		r;
+
+			if ( planeBits & ( 1 << i ) ) {
+				r = BoxOnPlaneSide( node->mins, node->maxs, &tr.viewParms.frustum[i] );
+				if ( r == 2 ) {
+					return;						// culled
+				}
+				if ( r == 1 ) {
+					planeBits &= ~( 1 << i );	// all descendants will also be in front
+				}
+			}
+		}
+	}
+
+	if ( node->contents != -1 || depth == 0 ) {
+		job = &worldJobs[ numWorldJobs++ ];
+		job->node = node;
+		job->planeBits = planeBits;
+		job->dlightBits = dlightBits;
+		return;
+	}
+
+	newDlights[0] = 0;
+	newDlights[1] = 0;
+	for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
+		dlight_t	*dl;
+		float		dist;
+
+		if ( dlightBits & ( 1 << i ) ) {
+			dl = &tr.refdef.dlights[i];
+			dist = DotProduct( dl->origin, node->plane->normal ) - node->plane->dist;
+
+			if ( dist > -dl->radius ) {
+				newDlights[0] |= ( 1 << i );
+			}
+			if ( dist < dl->radius ) {
+				newDlights[1] |= ( 1 << i );
+			}
+		}
+	}
+
+	R_SplitWorldNode( node->children[0], planeBits, newDlights[0], depth - 1 );
+	R_SplitWorldNode( node->children[1], planeBits, newDlights[1], depth - 1 );
+}
+
+/*
+================
+R_WorldJob
+================
+*/
+static void R_WorldJob( void *data, int item, int thread ) {
+	worldJob_t		*job = &worldJobs[ item ];
+	worldBucket_t	*bucket = &worldBuckets[ thread ];
+
+	job->thread = thread;
+	job->firstDrawSurf = bucket->numDrawSurfs;
+
+	R_RecursiveWorldNode( job->node, job->planeBits, job->dlightBits, bucket );
+
+	job->numDrawSurfs = bucket->numDrawSurfs - job->firstDrawSurf;
+}
+
+/*
+================
+R_ParallelWorldNodes
+================
+*/
+static void R_ParallelWorldNodes( unsigned int dlightBits ) {
+	int				numThreads = R_NumJobThreads();
+	int				depth, i, j;
+
+	// a few subtrees per thread so an expensive one doesn't hold up the others,
+	// MAX_WORLD_JOBS is 2^6
+	for ( depth = 2 ; depth < 6 && ( 1 << depth ) < numThreads * 4 ; depth++ ) {
+	}
+
+	numWorldJobs = 0;
+	R_SplitWorldNode( tr.world->nodes, 15, dlightBits, depth );
+
+	for ( i = 0 ; i < numThreads ; i++ ) {
+		worldBucket_t *bucket = &worldBuckets[i];
+
+		if ( !bucket->drawSurfs ) {
+			bucket->drawSurfs = ri.Malloc( MAX_DRAWSURFS * sizeof( drawSurf_t ) );
+		}
+		bucket->numDrawSurfs = 0;
+		memset( &bucket->pc, 0, sizeof( bucket->pc ) );
+		ClearBounds( bucket->visBounds[0], bucket->visBounds[1] );
+	}
+
+	R_RunJobs( R_WorldJob, NULL, numWorldJobs );
+
+	// append in subtree order
+	for ( i = 0 ; i < numWorldJobs ; i++ ) {
+		worldJob_t		*job = &worldJobs[i];
+		drawSurf_t		*drawSurf = &worldBuckets[ job->thread ].drawSurfs[ job->firstDrawSurf ];
+
+		for ( j = 0 ; j < job->numDrawSurfs ; j++, drawSurf++ ) {
+			tr.refdef.drawSurfs[ tr.refdef.numDrawSurfs & DRAWSURF_MASK ] = *drawSurf;
+			tr.refdef.numDrawSurfs++;
+		}
+	}
+
+	for ( i = 0 ; i < numThreads ; i++ ) {
+		worldBucket_t *bucket = &worldBuckets[i];
+
+		tr.pc.c_sphere_cull_patch_in += bucket->pc.c_sphere_cull_patch_in;
+		tr.pc.c_sphere_cull_patch_clip += bucket->pc.c_sphere_cull_patch_clip;
+		tr.pc.c_sphere_cull_patch_out += bucket->pc.c_sphere_cull_patch_out;
+		tr.pc.c_box_cull_patch_in += bucket->pc.c_box_cull_patch_in;
+		tr.pc.c_box_cull_patch_clip += bucket->pc.c_box_cull_patch_clip;
+		tr.pc.c_box_cull_patch_out += bucket->pc.c_box_cull_patch_out;
+		tr.pc.c_leafs += bucket->pc.c_leafs;
+		tr.pc.c_dlightSurfaces += bucket->pc.c_dlightSurfaces;
+		tr.pc.c_dlightSurfacesCulled += bucket->pc.c_dlightSurfacesCulled;
+
+		if ( bucket->pc.c_leafs ) {
+			AddPointToBounds( bucket->visBounds[0], tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
+			AddPointToBounds( bucket->visBounds[1], tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
+		}
+	}
+}
+
+/*
+================
+R_InitWorldJobs
+================
+*/
+void R_InitWorldJobs( void ) {
+	R_InitJobs( r_worldThreads->integer );
+}
+
+/*
+================
+R_ShutdownWorldJobs
+================
+*/
+void R_ShutdownWorldJobs( void ) {
+	int		i;
+
+	R_ShutdownJobs();
+
+	for ( i = 0 ; i < MAX_JOB_THREADS ; i++ ) {
+		if ( worldBuckets[i].drawSurfs ) {
+			ri.Free( worldBuckets[i].drawSurfs );
+			worldBuckets[i].drawSurfs = NULL;
+		}
+	}
+}
+
+
+/*
+=============================================================
+
+	CLUSTER SURFACE LISTS
+
+With r_clusterCull the surfaces of all leafs R_MarkLeaves marked are
+flattened into one list with their bounds, which is rebuilt only when
+the marking changes (new view cluster or areamask). Each view then
+frustum culls the whole list with R_CullSoABoxes instead of walking
+the BSP.
+
+=============================================================
+*/
+
+static struct {
+	world_t		*world;
+	int			visCount;		// tr.visCount the list was built for
+	int			build;
+
+	int			numSurfaces;
+	msurface_t	**surfaces;
+	soaBoxes_t	boxes;
+
+	int			*listed;		// per world surface, build that took it
+	int			*visible;
+} clusterSurfs;
+
+/*
+================
+R_ClearClusterSurfaces
+================
+*/
+void R_ClearClusterSurfaces( void ) {
+	if ( clusterSurfs.surfaces ) {
+		ri.Free( clusterSurfs.surfaces );
+		ri.Free( clusterSurfs.listed );
+		ri.Free( clusterSurfs.visible );
+		R_FreeSoABoxes( &clusterSurfs.boxes );
+	}
+
+	memset( &clusterSurfs, 0, sizeof( clusterSurfs ) );
+}
+
+/*
+================
+R_WorldSurfaceBounds
+================
+*/
+static void R_WorldSurfaceBounds( const msurface_t *surf, const mnode_t *leaf, vec3_t mins, vec3_t maxs ) {
+	int		i;
+
+	switch ( *surf->data ) {
+	case SF_FACE:
+		{
+			srfSurfaceFace_t *face = (srfSurfaceFace_t *)surf->data;
+
+			ClearBounds( mins, maxs );
+			for ( i = 0 ; i < face->numPoints ; i++ ) {
+				AddPointToBounds( face->points[i], mins, maxs );
+			}
+		}
+		break;
+	case SF_GRID:
+		VectorCopy( ((srfGridMesh_t *)surf->data)->meshBounds[0], mins );
+		VectorCopy( ((srfGridMesh_t *)surf->data)->meshBounds[1], maxs );
+		break;
+	case SF_TRIANGLES:
+		VectorCopy( ((srfTriangles_t *)surf->data)->bounds[0], mins );
+		VectorCopy( ((srfTriangles_t *)surf->data)->bounds[1], maxs );
+		break;
+	default:
+		// flares and anything else are kept as long as the leaf is in view
+		VectorCopy( leaf->mins, mins );
+		VectorCopy( leaf->maxs, maxs );
+		break;
+	}
+}
+
+/*
+================
+R_BuildClusterSurfaces
+================
+*/
+static void R_BuildClusterSurfaces( void ) {
+	mnode_t		*leaf;
+	int			i, j;
+
+	if ( clusterSurfs.world != tr.world ) {
+		R_ClearClusterSurfaces();
+
+		clusterSurfs.world = tr.world;
+		clusterSurfs.surfaces = ri.Malloc( tr.world->numsurfaces * sizeof( *clusterSurfs.surfaces ) );
+		clusterSurfs.listed = ri.Malloc( tr.world->numsurfaces * sizeof( *clusterSurfs.listed ) );
+		clusterSurfs.visible = ri.Malloc( tr.world->numsurfaces * sizeof( *clusterSurfs.visible ) );
+		memset( clusterSurfs.listed, 0, tr.world->numsurfaces * sizeof( *clusterSurfs.listed ) );
+		R_AllocSoABoxes( &clusterSurfs.boxes, tr.world->numsurfaces );
+	}
+
+	clusterSurfs.build++;
+	clusterSurfs.numSurfaces = 0;
+
+	for ( i = 0, leaf = tr.world->nodes ; i < tr.world->numnodes ; i++, leaf++ ) {
+		if ( leaf->contents == CONTENTS_NODE || leaf->visframe != tr.visCount ) {
+			continue;
+		}
+
+		for ( j = 0 ; j < leaf->nummarksurfaces ; j++ ) {
+			msurface_t	*surf = leaf->firstmarksurface[j];
+			int			index = surf - tr.world->surfaces;
+			vec3_t		mins, maxs;
+
+			// the surface may be in several leafs
+			if ( clusterSurfs.listed[index] == clusterSurfs.build ) {
+				continue;
+			}
+			clusterSurfs.listed[index] = clusterSurfs.build;
+
+			R_WorldSurfaceBounds( surf, leaf, mins, maxs );
+			R_SetSoABox( &clusterSurfs.boxes, clusterSurfs.numSurfaces, mins, maxs );
+			clusterSurfs.surfaces[ clusterSurfs.numSurfaces++ ] = surf;
+		}
+	}
+
+	clusterSurfs.visCount = tr.visCount;
+}
+
+/*
+================
+R_AddClusterSurfaces
+================
+*/
+static void R_AddClusterSurfaces( unsigned int dlightBits ) {
+	int		numVisible;
+	int		i, j;
+
+	if ( clusterSurfs.world != tr.world || clusterSurfs.visCount != tr.visCount ) {
+		R_BuildClusterSurfaces();
+	}
+
+	if ( r_nocull->integer ) {
+		for ( i = 0 ; i < clusterSurfs.numSurfaces ; i++ ) {
+			clusterSurfs.visible[i] = i;
+		}
+		numVisible = clusterSurfs.numSurfaces;
+	} else {
+		numVisible = R_CullSoABoxes( &clusterSurfs.boxes, clusterSurfs.numSurfaces,
+			tr.viewParms.frustum, 4, clusterSurfs.visible );
+	}
+
+	for ( i = 0 ; i < numVisible ; i++ ) {
+		int				index = clusterSurfs.visible[i];
+		unsigned int	surfDlights = 0;
+		vec3_t			mins, maxs;
+
+		R_GetSoABox( &clusterSurfs.boxes, index, mins, maxs );
+
+		AddPointToBounds( mins, tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
+		AddPointToBounds( maxs, tr.viewParms.visBounds[0], tr.viewParms.visBounds[1] );
+
+		// the node walk narrows the dlights by plane side, use the box here
+		if ( dlightBits ) {
+			for ( j = 0 ; j < tr.refdef.num_dlights ; j++ ) {
+				dlight_t	*dl = &tr.refdef.dlights[j];
+
+				if ( !( dlightBits & ( 1 << j ) ) ) {
+					continue;
+				}
+				if ( dl->origin[0] - dl->radius > maxs[0] || dl->origin[0] + dl->radius < mins[0]
+					|| dl->origin[1] - dl->radius > maxs[1] || dl->origin[1] + dl->radius < mins[1]
+					|| dl->origin[2] - dl->radius > maxs[2] || dl->origin[2] + dl->radius < mins[2] ) {
+					continue;
+				}
+				surfDlights |= ( 1 << j );
+			}
+		}
+
+		R_AddWorldSurface( clusterSurfs.surfaces[index], surfDlights, NULL );
+	}
+}
+
+
 /*
 ===============
 R_PointInLeaf
@@ -661,5 +1078,11 @@ void R_AddWorldSurfaces (void) {
 	if ( tr.refdef.num_dlights > MAX_DLIGHTS ) {
 		tr.refdef.num_dlights = MAX_DLIGHTS ;
 	}
-	R_RecursiveWorldNode( tr.world->nodes, 15, ( 1ULL << tr.refdef.num_dlights ) - 1 );
+	if ( r_clusterCull->integer ) {
+		R_AddClusterSurfaces( ( 1ULL << tr.refdef.num_dlights ) - 1 );
+	} else if ( R_NumJobThreads() > 1 ) {
+		R_ParallelWorldNodes( ( 1ULL << tr.refdef.num_dlights ) - 1 );
+	} else {
+		R_RecursiveWorldNode( tr.world->nodes, 15, ( 1ULL << tr.refdef.num_dlights ) - 1, NULL );
+	}
 }
@@ -2,10 +2,13 @@ attribute vec3  attr_Position;
 attribute vec3  attr_Normal;
 attribute vec4  attr_TexCoord0;
 
-//#if defined(USE_VERTEX_ANIMATION)
+#if defined(USE_BONE_ANIMATION)
+attribute vec4  attr_BoneIndexes;
+attribute vec4  attr_BoneWeights;
+#else
 attribute vec3  attr_Position2;
 attribute vec3  attr_Normal2;
-//#endif
+#endif
 
 //#if defined(USE_DEFORM_VERTEXES)
 uniform int     u_DeformGen;
@@ -17,9 +20,11 @@ uniform mat4    u_ModelViewProjectionMatrix;
 
 uniform mat4   u_ModelMatrix;
 
-//#if defined(USE_VERTEX_ANIMATION)
+#if defined(USE_BONE_ANIMATION)
+uniform mat4    u_BoneMatrix[MAX_GLSL_BONES];
+#else
 uniform float   u_VertexLerp;
-//#endif
+#endif
 
 varying vec3    var_Position;
 
@@ -78,8 +83,19 @@ vec3 DeformPosition(const vec3 pos, const vec3 normal, const vec2 st)
 
 void main()
 {
+#if defined(USE_BONE_ANIMATION)
+	mat4 vtxMat  = u_BoneMatrix[int(attr_BoneIndexes.x)] * attr_BoneWeights.x;
+	vtxMat      += u_BoneMatrix[int(attr_BoneIndexes.y)] * attr_BoneWeights.y;
+	vtxMat      += u_BoneMatrix[int(attr_BoneIndexes.z)] * attr_BoneWeights.z;
+	vtxMat      += u_BoneMatrix[int(attr_BoneIndexes.w)] * attr_BoneWeights.w;
+	mat3 nrmMat  = mat3(cross(vtxMat[1].xyz, vtxMat[2].xyz), cross(vtxMat[2].xyz, vtxMat[0].xyz), cross(vtxMat[0].xyz, vtxMat[1].xyz));
+
+	vec3 position  = vec3(vtxMat * vec4(attr_Position, 1.0));
+	vec3 normal    = normalize(nrmMat * attr_Normal);
+#else
 	vec3 position  = mix(attr_Position, attr_Position2, u_VertexLerp);
 	vec3 normal    = mix(attr_Normal,   attr_Normal2,   u_VertexLerp);
+#endif
 
 	position = DeformPosition(position, normal, attr_TexCoord0.st);
 
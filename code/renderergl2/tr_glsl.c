@@ -127,6 +127,7 @@ static uniformInfo_t uniformsInfo[] =
 
 	{ "u_Time",          GLSL_FLOAT },
 	{ "u_VertexLerp" ,   GLSL_FLOAT },
+	{ "u_BoneMatrix",    GLSL_MAT16_BONEMATRIX },
 	{ "u_NormalScale",   GLSL_VEC4 },
 	{ "u_SpecularScale", GLSL_VEC4 },
 
@@ -463,8 +464,288 @@ static void GLSL_ShowProgramUniforms(GLuint program)
 	}
 }
 
+/*
+====================================================================
+
+PROGRAM BINARY CACHE
+
+Linked programs are saved with glGetProgramBinary into glslcache.bin
+and restored with glProgramBinary on the next GLSL_InitGPUShaders.
+An entry is found by a hash of the complete vertex and fragment
+source, which already contains the permutation defines and the
+header, plus the attribute bindings. The whole file is tied to the
+GL vendor, renderer and version strings; a driver that refuses a
+binary just makes that program compile from source again.
+
+====================================================================
+*/
+
+#define GLSL_CACHE_FILE         "glslcache.bin"
+#define GLSL_CACHE_IDENT        (('C'<<24)+('L'<<16)+('G'<<8)+'Q')
+#define GLSL_CACHE_VERSION      1
+#define MAX_GLSL_CACHE_ENTRIES  256
+
+typedef struct {
+	int ident;
+	int version;
+	unsigned int driverHash;
+	int numEntries;
+} glslCacheHeader_t;
+
+typedef struct {
+	unsigned int vpHash;
+	unsigned int fpHash;
+	int attribs;
+	GLenum binaryFormat;
+	int length;
+} glslCacheEntryHeader_t;
+
+typedef struct {
+	glslCacheEntryHeader_t header;
+	const void *binary;
+	qboolean allocated;
+} glslCacheEntry_t;
+
+static struct {
+	void *fileBuffer;
+	glslCacheEntry_t entries[MAX_GLSL_CACHE_ENTRIES];
+	int numEntries;
+	qboolean dirty;
+	qboolean bypass;		// glslBenchmark compiling from source
+
+	int numHits;
+	int numMisses;
+} glslCache;
+
+
+static unsigned int GLSL_HashString(unsigned int hash, const char *s)
+{
+	// FNV-1a
+	while (*s)
+	{
+		hash ^= (unsigned char)*s++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+static unsigned int GLSL_DriverHash(void)
+{
+	unsigned int hash = 2166136261u;
+
+	hash = GLSL_HashString(hash, glConfig.vendor_string);
+	hash = GLSL_HashString(hash, glConfig.renderer_string);
+	hash = GLSL_HashString(hash, glConfig.version_string);
+
+	return hash;
+}
+
+static void GLSL_LoadProgramCache(void)
+{
+	const glslCacheHeader_t *header;
+	const byte *p, *end;
+	long len;
+	int i;
+
+	qboolean bypass = glslCache.bypass;
+
+	memset(&glslCache, 0, sizeof(glslCache));
+	glslCache.bypass = bypass;
+
+	if (!glRefConfig.getProgramBinary || glslCache.bypass)
+		return;
+
+	len = ri.FS_ReadFile(GLSL_CACHE_FILE, &glslCache.fileBuffer);
+	if (!glslCache.fileBuffer)
+		return;
+
+	header = glslCache.fileBuffer;
+	if (len < sizeof(*header) || header->ident != GLSL_CACHE_IDENT || header->version != GLSL_CACHE_VERSION
+		|| header->numEntries < 0 || header->numEntries > MAX_GLSL_CACHE_ENTRIES)
+	{
+		ri.Printf(PRINT_WARNING, "%s is invalid, ignored\n", GLSL_CACHE_FILE);
+		return;
+	}
+
+	if (header->driverHash != GLSL_DriverHash())
+	{
+		ri.Printf(PRINT_ALL, "...%s was written by another GL driver, ignored\n", GLSL_CACHE_FILE);
+		return;
+	}
+
+	p = (const byte *)(header + 1);
+	end = (const byte *)glslCache.fileBuffer + len;
+
+	for (i = 0; i < header->numEntries; i++)
+	{
+		glslCacheEntry_t *entry = &glslCache.entries[i];
+
+		if (end - p < sizeof(entry->header))
+			break;
+
+		memcpy(&entry->header, p, sizeof(entry->header));
+		p += sizeof(entry->header);
+
+		if (entry->header.length <= 0 || end - p < entry->header.length)
+			break;
+
+		entry->binary = p;
+		p += entry->header.length;
+	}
+
+	if (i != header->numEntries)
+	{
+		ri.Printf(PRINT_WARNING, "%s is truncated, ignored\n", GLSL_CACHE_FILE);
+		return;
+	}
+
+	glslCache.numEntries = header->numEntries;
+}
+
+static void GLSL_SaveProgramCache(void)
+{
+	glslCacheHeader_t *header;
+	byte *buffer, *p;
+	int i, size;
+
+	if (!glslCache.dirty)
+		return;
+
+	size = sizeof(*header);
+	for (i = 0; i < glslCache.numEntries; i++)
+		size += sizeof(glslCache.entries[i].header) + glslCache.entries[i].header.length;
+
+	buffer = ri.Hunk_AllocateTempMemory(size);
+
+	header = (glslCacheHeader_t *)buffer;
+	header->ident = GLSL_CACHE_IDENT;
+	header->version = GLSL_CACHE_VERSION;
+	header->driverHash = GLSL_DriverHash();
+	header->numEntries = glslCache.numEntries;
+
+	p = (byte *)(header + 1);
+	for (i = 0; i < glslCache.numEntries; i++)
+	{
+		memcpy(p, &glslCache.entries[i].header, sizeof(glslCache.entries[i].header));
+		p += sizeof(glslCache.entries[i].header);
+		memcpy(p, glslCache.entries[i].binary, glslCache.entries[i].header.length);
+		p += glslCache.entries[i].header.length;
+	}
+
+	ri.FS_WriteFile(GLSL_CACHE_FILE, buffer, size);
+
+	ri.Hunk_FreeTempMemory(buffer);
+}
+
+static void GLSL_FreeProgramCache(void)
+{
+	int i;
+
+	for (i = 0; i < glslCache.numEntries; i++)
+	{
+		if (glslCache.entries[i].allocated)
+			ri.Free((void *)glslCache.entries[i].binary);
+	}
+
+	if (glslCache.fileBuffer)
+		ri.FS_FreeFile(glslCache.fileBuffer);
+
+	glslCache.fileBuffer = NULL;
+	glslCache.numEntries = 0;
+}
+
+static glslCacheEntry_t *GLSL_FindCachedProgram(unsigned int vpHash, unsigned int fpHash, int attribs)
+{
+	int i;
+
+	for (i = 0; i < glslCache.numEntries; i++)
+	{
+		glslCacheEntry_t *entry = &glslCache.entries[i];
+
+		if (entry->header.vpHash == vpHash && entry->header.fpHash == fpHash && entry->header.attribs == attribs)
+			return entry;
+	}
+
+	return NULL;
+}
+
+static qboolean GLSL_LoadCachedProgram(shaderProgram_t *program, unsigned int vpHash, unsigned int fpHash, int attribs)
+{
+	glslCacheEntry_t *entry;
+	GLint linked;
+
+	if (!glRefConfig.getProgramBinary || glslCache.bypass)
+		return qfalse;
+
+	entry = GLSL_FindCachedProgram(vpHash, fpHash, attribs);
+	if (!entry)
+		return qfalse;
+
+	qglProgramBinary(program->program, entry->header.binaryFormat, entry->binary, entry->header.length);
+
+	// a binary from an older driver build fails here instead of producing garbage
+	qglGetProgramiv(program->program, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		ri.Printf(PRINT_DEVELOPER, "GLSL_LoadCachedProgram: binary for \"%s\" rejected\n", program->name);
+
+		// clear the error glProgramBinary may have raised
+		while (qglGetError() != GL_NO_ERROR)
+			;
+		return qfalse;
+	}
+
+	glslCache.numHits++;
+	return qtrue;
+}
+
+static void GLSL_StoreCachedProgram(shaderProgram_t *program, unsigned int vpHash, unsigned int fpHash, int attribs)
+{
+	glslCacheEntry_t *entry;
+	GLint length = 0;
+	void *binary;
+
+	if (!glRefConfig.getProgramBinary || glslCache.bypass)
+		return;
+
+	glslCache.numMisses++;
+
+	qglGetProgramiv(program->program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+
+	// a rejected binary is replaced in place
+	entry = GLSL_FindCachedProgram(vpHash, fpHash, attribs);
+	if (!entry)
+	{
+		if (glslCache.numEntries == MAX_GLSL_CACHE_ENTRIES)
+			return;
+		entry = &glslCache.entries[glslCache.numEntries++];
+	}
+	else if (entry->allocated)
+	{
+		ri.Free((void *)entry->binary);
+	}
+
+	binary = ri.Malloc(length);
+	qglGetProgramBinary(program->program, length, &length, &entry->header.binaryFormat, binary);
+
+	entry->header.vpHash = vpHash;
+	entry->header.fpHash = fpHash;
+	entry->header.attribs = attribs;
+	entry->header.length = length;
+	entry->binary = binary;
+	entry->allocated = qtrue;
+
+	glslCache.dirty = qtrue;
+}
+
+
 static int GLSL_InitGPUShader2(shaderProgram_t* program, const char *name, int attribs, const char *vpCode, const char *fpCode)
 {
+	unsigned int vpHash, fpHash;
+
 	ri.Printf(PRINT_DEVELOPER, "------- GPU shader -------\n");
 
 	if(strlen(name) >= MAX_QPATH)
@@ -474,9 +755,26 @@ static int GLSL_InitGPUShader2(shaderProgram_t* program, const char *name, int a
 
 	Q_strncpyz(program->name, name, sizeof(program->name));
 
+	vpHash = GLSL_HashString(2166136261u, vpCode);
+	fpHash = GLSL_HashString(2166136261u, fpCode ? fpCode : "");
+
 	program->program = qglCreateProgram();
 	program->attribs = attribs;
 
+	if (GLSL_LoadCachedProgram(program, vpHash, fpHash, attribs))
+	{
+		return 1;
+	}
+
+	if (glRefConfig.getProgramBinary && !glslCache.bypass)
+	{
+		// start over with a clean program object after a rejected binary
+		qglDeleteProgram(program->program);
+		program->program = qglCreateProgram();
+
+		qglProgramParameteri(program->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
 	if (!(GLSL_CompileGPUShader(program->program, &program->vertexShader, vpCode, strlen(vpCode), GL_VERTEX_SHADER)))
 	{
 		ri.Printf(PRINT_ALL, "GLSL_InitGPUShader2: Unable to load \"%s\" as GL_VERTEX_SHADER\n", name);
@@ -533,8 +831,16 @@ static int GLSL_InitGPUShader2(shaderProgram_t* program, const char *name, int a
 	if(attribs & ATTR_TANGENT2)
 		qglBindAttribLocation(program->program, ATTR_INDEX_TANGENT2, "attr_Tangent2");
 
+	if(attribs & ATTR_BONE_INDEXES)
+		qglBindAttribLocation(program->program, ATTR_INDEX_BONE_INDEXES, "attr_BoneIndexes");
+
+	if(attribs & ATTR_BONE_WEIGHTS)
+		qglBindAttribLocation(program->program, ATTR_INDEX_BONE_WEIGHTS, "attr_BoneWeights");
+
 	GLSL_LinkProgram(program->program);
 
+	GLSL_StoreCachedProgram(program, vpHash, fpHash, attribs);
+
 	return 1;
 }
 
@@ -630,6 +936,9 @@ void GLSL_InitUniforms(shaderProgram_t *program)
 			case GLSL_MAT16:
 				size += sizeof(vec_t) * 16;
 				break;
+			case GLSL_MAT16_BONEMATRIX:
+				size += sizeof(vec_t) * 16 * glRefConfig.glslMaxAnimatedBones;
+				break;
 			default:
 				break;
 		}
@@ -817,6 +1126,37 @@ void GLSL_SetUniformMat4(shaderProgram_t *program, int uniformNum, const float m
 	}
 }
 
+void GLSL_SetUniformMat4BoneMatrix(shaderProgram_t *program, int uniformNum, float (*matrix)[16], int numMatricies)
+{
+	GLint *uniforms = program->uniforms;
+	vec_t *compare = (float *)(program->uniformBuffer + program->uniformBufferOffsets[uniformNum]);
+
+	if (uniforms[uniformNum] == -1)
+		return;
+
+	if (uniformsInfo[uniformNum].type != GLSL_MAT16_BONEMATRIX)
+	{
+		ri.Printf( PRINT_WARNING, "GLSL_SetUniformMat4BoneMatrix: wrong type for uniform %i in program %s\n", uniformNum, program->name);
+		return;
+	}
+
+	if (numMatricies > glRefConfig.glslMaxAnimatedBones)
+	{
+		ri.Printf( PRINT_WARNING, "GLSL_SetUniformMat4BoneMatrix: too many matricies (%d/%d) for uniform %i in program %s\n",
+			numMatricies, glRefConfig.glslMaxAnimatedBones, uniformNum, program->name);
+		return;
+	}
+
+	if (!memcmp(matrix, compare, numMatricies * sizeof(float) * 16))
+	{
+		return;
+	}
+
+	memcpy(compare, matrix, numMatricies * sizeof(float) * 16);
+
+	qglProgramUniformMatrix4fvEXT(program->program, uniforms[uniformNum], numMatricies, GL_FALSE, &matrix[0][0]);
+}
+
 
 void GLSL_DeleteGPUShader(shaderProgram_t *program)
 {
@@ -859,8 +1199,16 @@ void GLSL_InitGPUShaders(void)
 
 	startTime = ri.Milliseconds();
 
+	GLSL_LoadProgramCache();
+
 	for (i = 0; i < GENERICDEF_COUNT; i++)
 	{	
+		if ((i & GENERICDEF_USE_VERTEX_ANIMATION) && (i & GENERICDEF_USE_BONE_ANIMATION))
+			continue;
+
+		if ((i & GENERICDEF_USE_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
+			continue;
+
 		attribs = ATTR_POSITION | ATTR_TEXCOORD | ATTR_LIGHTCOORD | ATTR_NORMAL | ATTR_COLOR;
 		extradefines[0] = '\0';
 
@@ -878,6 +1226,11 @@ void GLSL_InitGPUShaders(void)
 			strcat(extradefines, "#define USE_VERTEX_ANIMATION\n");
 			attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
 		}
+		else if (i & GENERICDEF_USE_BONE_ANIMATION)
+		{
+			strcat(extradefines, va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
+			attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+		}
 
 		if (i & GENERICDEF_USE_FOG)
 			strcat(extradefines, "#define USE_FOG\n");
@@ -920,6 +1273,12 @@ void GLSL_InitGPUShaders(void)
 
 	for (i = 0; i < FOGDEF_COUNT; i++)
 	{
+		if ((i & FOGDEF_USE_VERTEX_ANIMATION) && (i & FOGDEF_USE_BONE_ANIMATION))
+			continue;
+
+		if ((i & FOGDEF_USE_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
+			continue;
+
 		attribs = ATTR_POSITION | ATTR_POSITION2 | ATTR_NORMAL | ATTR_NORMAL2 | ATTR_TEXCOORD;
 		extradefines[0] = '\0';
 
@@ -928,6 +1287,11 @@ void GLSL_InitGPUShaders(void)
 
 		if (i & FOGDEF_USE_VERTEX_ANIMATION)
 			strcat(extradefines, "#define USE_VERTEX_ANIMATION\n");
+		else if (i & FOGDEF_USE_BONE_ANIMATION)
+		{
+			strcat(extradefines, va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
+			attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+		}
 
 		if (!GLSL_InitGPUShader(&tr.fogShader[i], "fogpass", attribs, qtrue, extradefines, qtrue, fallbackShader_fogpass_vp, fallbackShader_fogpass_fp))
 		{
@@ -978,6 +1342,9 @@ void GLSL_InitGPUShaders(void)
 		if ((i & LIGHTDEF_USE_SHADOWMAP) && (!lightType || !r_sunlightMode->integer))
 			continue;
 
+		if ((i & LIGHTDEF_ENTITY_BONE_ANIMATION) && ((i & LIGHTDEF_ENTITY) || !glRefConfig.glslMaxAnimatedBones))
+			continue;
+
 		attribs = ATTR_POSITION | ATTR_TEXCOORD | ATTR_COLOR | ATTR_NORMAL;
 
 		extradefines[0] = '\0';
@@ -1020,7 +1387,7 @@ void GLSL_InitGPUShaders(void)
 
 				attribs |= ATTR_TANGENT;
 
-				if ((i & LIGHTDEF_USE_PARALLAXMAP) && !(i & LIGHTDEF_ENTITY) && r_parallaxMapping->integer)
+				if ((i & LIGHTDEF_USE_PARALLAXMAP) && !(i & (LIGHTDEF_ENTITY | LIGHTDEF_ENTITY_BONE_ANIMATION)) && r_parallaxMapping->integer)
 				{
 					strcat(extradefines, "#define USE_PARALLAXMAP\n");
 					if (r_parallaxMapping->integer > 1)
@@ -1080,6 +1447,12 @@ void GLSL_InitGPUShaders(void)
 				attribs |= ATTR_TANGENT2;
 			}
 		}
+		else if (i & LIGHTDEF_ENTITY_BONE_ANIMATION)
+		{
+			strcat(extradefines, "#define USE_MODELMATRIX\n");
+			strcat(extradefines, va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
+			attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+		}
 
 		if (!GLSL_InitGPUShader(&tr.lightallShader[i], "lightall", attribs, qtrue, extradefines, qtrue, fallbackShader_lightall_vp, fallbackShader_lightall_fp))
 		{
@@ -1101,19 +1474,34 @@ void GLSL_InitGPUShaders(void)
 		numLightShaders++;
 	}
 
-	attribs = ATTR_POSITION | ATTR_POSITION2 | ATTR_NORMAL | ATTR_NORMAL2 | ATTR_TEXCOORD;
+	for (i = 0; i < SHADOWMAPDEF_COUNT; i++)
+	{
+		if ((i & SHADOWMAPDEF_USE_BONE_ANIMATION) && !glRefConfig.glslMaxAnimatedBones)
+			continue;
 
-	extradefines[0] = '\0';
+		attribs = ATTR_POSITION | ATTR_NORMAL | ATTR_TEXCOORD;
+		extradefines[0] = '\0';
 
-	if (!GLSL_InitGPUShader(&tr.shadowmapShader, "shadowfill", attribs, qtrue, extradefines, qtrue, fallbackShader_shadowfill_vp, fallbackShader_shadowfill_fp))
-	{
-		ri.Error(ERR_FATAL, "Could not load shadowfill shader!");
-	}
+		if (i & SHADOWMAPDEF_USE_BONE_ANIMATION)
+		{
+			strcat(extradefines, va("#define USE_BONE_ANIMATION\n#define MAX_GLSL_BONES %d\n", glRefConfig.glslMaxAnimatedBones));
+			attribs |= ATTR_BONE_INDEXES | ATTR_BONE_WEIGHTS;
+		}
+		else
+		{
+			attribs |= ATTR_POSITION2 | ATTR_NORMAL2;
+		}
 
-	GLSL_InitUniforms(&tr.shadowmapShader);
-	GLSL_FinishGPUShader(&tr.shadowmapShader);
+		if (!GLSL_InitGPUShader(&tr.shadowmapShader[i], "shadowfill", attribs, qtrue, extradefines, qtrue, fallbackShader_shadowfill_vp, fallbackShader_shadowfill_fp))
+		{
+			ri.Error(ERR_FATAL, "Could not load shadowfill shader!");
+		}
 
-	numEtcShaders++;
+		GLSL_InitUniforms(&tr.shadowmapShader[i]);
+		GLSL_FinishGPUShader(&tr.shadowmapShader[i]);
+
+		numEtcShaders++;
+	}
 
 	attribs = ATTR_POSITION | ATTR_NORMAL;
 	extradefines[0] = '\0';
@@ -1308,11 +1696,69 @@ void GLSL_InitGPUShaders(void)
 #endif
 
 
+	GLSL_SaveProgramCache();
+	GLSL_FreeProgramCache();
+
 	endTime = ri.Milliseconds();
 
 	ri.Printf(PRINT_ALL, "loaded %i GLSL shaders (%i gen %i light %i etc) in %5.2f seconds\n", 
 		numGenShaders + numLightShaders + numEtcShaders, numGenShaders, numLightShaders, 
 		numEtcShaders, (endTime - startTime) / 1000.0);
+
+	if (glRefConfig.getProgramBinary && !glslCache.bypass)
+	{
+		ri.Printf(PRINT_ALL, "%i programs from %s, %i compiled\n", glslCache.numHits, GLSL_CACHE_FILE, glslCache.numMisses);
+	}
+}
+
+
+/*
+================
+GLSL_Benchmark_f
+
+Times GLSL_InitGPUShaders compiling everything from source and then
+restoring it from the program binary cache. Software drivers such as
+llvmpipe (LIBGL_ALWAYS_SOFTWARE=1) work too, the numbers are only
+meaningful relative to each other.
+================
+*/
+void GLSL_Benchmark_f(void)
+{
+	int sourceMsec, binaryMsec, start, pass;
+
+	if (!glRefConfig.getProgramBinary)
+	{
+		ri.Printf(PRINT_ALL, "glslBenchmark: GL_ARB_get_program_binary is not in use\n");
+		return;
+	}
+
+	R_IssuePendingRenderCommands();
+
+	GLSL_ShutdownGPUShaders();
+	glslCache.bypass = qtrue;
+
+	start = ri.Milliseconds();
+	GLSL_InitGPUShaders();
+	sourceMsec = ri.Milliseconds() - start;
+
+	glslCache.bypass = qfalse;
+
+	// the first pass may have to fill a cold cache
+	for (pass = 0; pass < 2; pass++)
+	{
+		GLSL_ShutdownGPUShaders();
+
+		start = ri.Milliseconds();
+		GLSL_InitGPUShaders();
+		binaryMsec = ri.Milliseconds() - start;
+
+		if (!glslCache.numMisses)
+			break;
+	}
+
+	ri.Printf(PRINT_ALL, "GL_RENDERER: %s\n", glConfig.renderer_string);
+	ri.Printf(PRINT_ALL, "from source: %i msec, from binary cache: %i msec (%i hits, %i misses)\n",
+		sourceMsec, binaryMsec, glslCache.numHits, glslCache.numMisses);
 }
 
 void GLSL_ShutdownGPUShaders(void)
@@ -1340,7 +1786,9 @@ void GLSL_ShutdownGPUShaders(void)
 	for ( i = 0; i < LIGHTDEF_COUNT; i++)
 		GLSL_DeleteGPUShader(&tr.lightallShader[i]);
 
-	GLSL_DeleteGPUShader(&tr.shadowmapShader);
+	for ( i = 0; i < SHADOWMAPDEF_COUNT; i++)
+		GLSL_DeleteGPUShader(&tr.shadowmapShader[i]);
+
 	GLSL_DeleteGPUShader(&tr.pshadowShader);
 	GLSL_DeleteGPUShader(&tr.down4xShader);
 	GLSL_DeleteGPUShader(&tr.bokehShader);
@@ -1409,6 +1857,11 @@ shaderProgram_t *GLSL_GetGenericShaderProgram(int stage)
 		shaderAttribs |= GENERICDEF_USE_VERTEX_ANIMATION;
 	}
 
+	if (glState.boneAnimation)
+	{
+		shaderAttribs |= GENERICDEF_USE_BONE_ANIMATION;
+	}
+
 	if (pStage->bundle[0].numTexMods)
 	{
 		shaderAttribs |= GENERICDEF_USE_TCGEN_AND_TCMOD;
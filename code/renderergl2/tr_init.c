@@ -81,6 +81,7 @@ cvar_t  *r_ext_texture_float;
 cvar_t  *r_ext_framebuffer_multisample;
 cvar_t  *r_arb_seamless_cube_map;
 cvar_t  *r_arb_vertex_array_object;
+cvar_t  *r_arb_get_program_binary;
 cvar_t  *r_ext_direct_state_access;
 
 cvar_t  *r_cameraExposure;
@@ -120,6 +121,7 @@ cvar_t  *r_glossType;
 cvar_t  *r_mergeLightmaps;
 cvar_t  *r_dlightMode;
 cvar_t  *r_pshadowDist;
+cvar_t  *r_gpuSkinning;
 cvar_t  *r_imageUpsample;
 cvar_t  *r_imageUpsampleMaxSize;
 cvar_t  *r_imageUpsampleType;
@@ -208,6 +210,7 @@ QGL_3_0_PROCS;
 QGL_ARB_framebuffer_object_PROCS;
 QGL_ARB_vertex_array_object_PROCS;
 QGL_EXT_direct_state_access_PROCS;
+QGL_ARB_get_program_binary_PROCS;
 #undef GLE
 
 
@@ -303,6 +306,7 @@ void GLimp_ClearProcAddresses( void )
     QGL_ARB_framebuffer_object_PROCS;
     QGL_ARB_vertex_array_object_PROCS;
     QGL_EXT_direct_state_access_PROCS;
+    QGL_ARB_get_program_binary_PROCS;
     QGL_3_0_PROCS;
 
     qglMultiTexCoord2fARB = NULL;
@@ -606,6 +610,24 @@ static void GLimp_InitExtensions(void)
 		ri.Printf(PRINT_ALL, "...using GLSL version %s\n", version);
 	}
 
+	// GPU skinning keeps the bone matrices in vertex shader uniforms,
+	// leave room for everything else lightall_vp uses
+	glRefConfig.glslMaxAnimatedBones = 0;
+	if (r_gpuSkinning->integer)
+	{
+		GLint maxComponents = 0;
+
+		qglGetIntegerv(GL_MAX_VERTEX_UNIFORM_COMPONENTS, &maxComponents);
+
+		glRefConfig.glslMaxAnimatedBones = Com_Clamp(0, IQM_MAX_JOINTS + 1, (maxComponents - 256) / 16);
+
+		// not worth the extra shader permutations for tiny skeletons
+		if (glRefConfig.glslMaxAnimatedBones < 12)
+			glRefConfig.glslMaxAnimatedBones = 0;
+
+		ri.Printf(PRINT_ALL, "...using up to %d bones for GPU skinning\n", glRefConfig.glslMaxAnimatedBones);
+	}
+
 	glRefConfig.memInfo = MI_NONE;
 
 	// GL_NVX_gpu_memory_info
@@ -697,6 +719,26 @@ static void GLimp_InitExtensions(void)
 		ri.Printf(PRINT_ALL, result[2], extension);
 	}
 
+	// OpenGL 4.1 - GL_ARB_get_program_binary
+	extension = "GL_ARB_get_program_binary";
+	glRefConfig.getProgramBinary = qfalse;
+	if (GLimp_HaveExtension(extension))
+	{
+		GLint numFormats = 0;
+
+		QGL_ARB_get_program_binary_PROCS;
+
+		// some drivers expose the extension without any binary format
+		qglGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+		glRefConfig.getProgramBinary = r_arb_get_program_binary->integer && numFormats > 0;
+
+		ri.Printf(PRINT_ALL, result[glRefConfig.getProgramBinary], extension);
+	}
+	else
+	{
+		ri.Printf(PRINT_ALL, result[2], extension);
+	}
+
 #undef GLE
 }
 
@@ -1612,6 +1654,7 @@ void R_Register( void )
 	r_ext_framebuffer_multisample = ri.Cvar_Get( "r_ext_framebuffer_multisample", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_arb_seamless_cube_map = ri.Cvar_Get( "r_arb_seamless_cube_map", "0", CVAR_ARCHIVE | CVAR_LATCH);
 	r_arb_vertex_array_object = ri.Cvar_Get( "r_arb_vertex_array_object", "1", CVAR_ARCHIVE | CVAR_LATCH);
+	r_arb_get_program_binary = ri.Cvar_Get( "r_arb_get_program_binary", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_ext_direct_state_access = ri.Cvar_Get("r_ext_direct_state_access", "1", CVAR_ARCHIVE | CVAR_LATCH);
 
 	r_picmip = ri.Cvar_Get ("r_picmip", "1", CVAR_ARCHIVE | CVAR_LATCH );
@@ -1662,6 +1705,7 @@ void R_Register( void )
 	r_glossType = ri.Cvar_Get("r_glossType", "1", CVAR_ARCHIVE | CVAR_LATCH);
 	r_dlightMode = ri.Cvar_Get( "r_dlightMode", "0", CVAR_ARCHIVE | CVAR_LATCH );
 	r_pshadowDist = ri.Cvar_Get( "r_pshadowDist", "128", CVAR_ARCHIVE );
+	r_gpuSkinning = ri.Cvar_Get( "r_gpuSkinning", "1", CVAR_ARCHIVE | CVAR_LATCH );
 	r_mergeLightmaps = ri.Cvar_Get( "r_mergeLightmaps", "1", CVAR_ARCHIVE | CVAR_LATCH );
 	r_imageUpsample = ri.Cvar_Get( "r_imageUpsample", "0", CVAR_ARCHIVE | CVAR_LATCH );
 	r_imageUpsampleMaxSize = ri.Cvar_Get( "r_imageUpsampleMaxSize", "1024", CVAR_ARCHIVE | CVAR_LATCH );
@@ -1777,6 +1821,7 @@ void R_Register( void )
 	ri.Cmd_AddCommand( "minimize", GLimp_Minimize );
 	ri.Cmd_AddCommand( "gfxmeminfo", GfxMemInfo_f );
 	ri.Cmd_AddCommand( "exportCubemaps", R_ExportCubemaps_f );
+	ri.Cmd_AddCommand( "glslBenchmark", GLSL_Benchmark_f );
 }
 
 void R_InitQueries(void)
@@ -1918,6 +1963,7 @@ void RE_Shutdown( qboolean destroyWindow )
 	ri.Cmd_RemoveCommand( "minimize" );
 	ri.Cmd_RemoveCommand( "gfxmeminfo" );
 	ri.Cmd_RemoveCommand( "exportCubemaps" );
+	ri.Cmd_RemoveCommand( "glslBenchmark" );
 
 
 	if ( tr.registered ) {
@@ -47,6 +47,7 @@ QGL_3_0_PROCS;
 QGL_ARB_framebuffer_object_PROCS;
 QGL_ARB_vertex_array_object_PROCS;
 QGL_EXT_direct_state_access_PROCS;
+QGL_ARB_get_program_binary_PROCS;
 #undef GLE
 
 void GLimp_Init(glconfig_t *glConfig, qboolean coreContext);
@@ -567,16 +568,18 @@ enum
 	GENERICDEF_USE_VERTEX_ANIMATION = 0x0004,
 	GENERICDEF_USE_FOG              = 0x0008,
 	GENERICDEF_USE_RGBAGEN          = 0x0010,
-	GENERICDEF_ALL                  = 0x001F,
-	GENERICDEF_COUNT                = 0x0020,
+	GENERICDEF_USE_BONE_ANIMATION   = 0x0020,
+	GENERICDEF_ALL                  = 0x003F,
+	GENERICDEF_COUNT                = 0x0040,
 };
 
 enum
 {
 	FOGDEF_USE_DEFORM_VERTEXES  = 0x0001,
 	FOGDEF_USE_VERTEX_ANIMATION = 0x0002,
-	FOGDEF_ALL                  = 0x0003,
-	FOGDEF_COUNT                = 0x0004,
+	FOGDEF_USE_BONE_ANIMATION   = 0x0004,
+	FOGDEF_ALL                  = 0x0007,
+	FOGDEF_COUNT                = 0x0008,
 };
 
 enum
@@ -596,8 +599,16 @@ enum
 	LIGHTDEF_USE_TCGEN_AND_TCMOD = 0x0008,
 	LIGHTDEF_USE_PARALLAXMAP     = 0x0010,
 	LIGHTDEF_USE_SHADOWMAP       = 0x0020,
-	LIGHTDEF_ALL                 = 0x003F,
-	LIGHTDEF_COUNT               = 0x0040
+	LIGHTDEF_ENTITY_BONE_ANIMATION = 0x0040,
+	LIGHTDEF_ALL                 = 0x007F,
+	LIGHTDEF_COUNT               = 0x0080
+};
+
+enum
+{
+	SHADOWMAPDEF_USE_BONE_ANIMATION = 0x0001,
+	SHADOWMAPDEF_ALL                = 0x0001,
+	SHADOWMAPDEF_COUNT              = 0x0002
 };
 
 enum
@@ -608,7 +619,8 @@ enum
 	GLSL_VEC2,
 	GLSL_VEC3,
 	GLSL_VEC4,
-	GLSL_MAT16
+	GLSL_MAT16,
+	GLSL_MAT16_BONEMATRIX
 };
 
 typedef enum
@@ -676,6 +688,7 @@ typedef enum
 
 	UNIFORM_TIME,
 	UNIFORM_VERTEXLERP,
+	UNIFORM_BONEMATRIX,
 	UNIFORM_NORMALSCALE,
 	UNIFORM_SPECULARSCALE,
 
@@ -859,6 +872,7 @@ typedef enum {
 	SF_FLARE,
 	SF_ENTITY,				// beams, rails, lightning, etc that can be determined by entity
 	SF_VAO_MDVMESH,
+	SF_VAO_IQM,
 
 	SF_NUM_SURFACE_TYPES,
 	SF_MAX = 0x7fffffff			// ensures that sizeof( surfaceType_t ) == sizeof( int )
@@ -958,6 +972,7 @@ typedef struct {
 	int		num_joints;
 	int		num_poses;
 	struct srfIQModel_s	*surfaces;
+	struct srfVaoIQModel_s	*vaoSurfaces;	// NULL if the model can't be skinned on the GPU
 
 	float		*positions;
 	float		*texcoords;
@@ -993,6 +1008,22 @@ typedef struct srfIQModel_s {
 	int		first_triangle, num_triangles;
 } srfIQModel_t;
 
+// inter-quake-model surface with the bind pose in a static VAO, skinned in the vertex shader
+typedef struct srfVaoIQModel_s
+{
+	surfaceType_t	surfaceType;
+
+	iqmData_t	*iqmData;
+	struct srfIQModel_s	*iqmSurface;
+
+	// backEnd stats
+	int		numIndexes;
+	int		numVerts;
+
+	// static render data
+	vao_t		*vao;
+} srfVaoIQModel_t;
+
 typedef struct srfVaoMdvMesh_s
 {
 	surfaceType_t   surfaceType;
@@ -1340,6 +1371,8 @@ typedef struct {
 	uint32_t    storedGlState;
 	float           vertexAttribsInterpolation;
 	qboolean        vertexAnimation;
+	int             boneAnimation; // number of bones
+	float           boneMatrix[IQM_MAX_JOINTS + 1][16] QALIGN(16);
 	uint32_t        vertexAttribsEnabled;  // global if no VAOs, tess only otherwise
 	FBO_t          *currentFBO;
 	vao_t          *currentVao;
@@ -1366,6 +1399,7 @@ typedef struct {
 
 	int glslMajorVersion;
 	int glslMinorVersion;
+	int glslMaxAnimatedBones;
 
 	memInfo_t   memInfo;
 
@@ -1385,6 +1419,7 @@ typedef struct {
 
 	qboolean vertexArrayObject;
 	qboolean directStateAccess;
+	qboolean getProgramBinary;
 } glRefConfig_t;
 
 
@@ -1546,7 +1581,7 @@ typedef struct {
 	shaderProgram_t fogShader[FOGDEF_COUNT];
 	shaderProgram_t dlightShader[DLIGHTDEF_COUNT];
 	shaderProgram_t lightallShader[LIGHTDEF_COUNT];
-	shaderProgram_t shadowmapShader;
+	shaderProgram_t shadowmapShader[SHADOWMAPDEF_COUNT];
 	shaderProgram_t pshadowShader;
 	shaderProgram_t down4xShader;
 	shaderProgram_t bokehShader;
@@ -1670,6 +1705,7 @@ extern  cvar_t  *r_ext_texture_float;
 extern  cvar_t  *r_ext_framebuffer_multisample;
 extern  cvar_t  *r_arb_seamless_cube_map;
 extern  cvar_t  *r_arb_vertex_array_object;
+extern  cvar_t  *r_arb_get_program_binary;
 extern  cvar_t  *r_ext_direct_state_access;
 
 extern	cvar_t	*r_nobind;						// turns off binding to appropriate textures
@@ -1742,6 +1778,7 @@ extern  cvar_t  *r_baseGloss;
 extern  cvar_t  *r_glossType;
 extern  cvar_t  *r_dlightMode;
 extern  cvar_t  *r_pshadowDist;
+extern  cvar_t  *r_gpuSkinning;                 // skin IQM models in the vertex shader
 extern  cvar_t  *r_mergeLightmaps;
 extern  cvar_t  *r_imageUpsample;
 extern  cvar_t  *r_imageUpsampleMaxSize;
@@ -2163,6 +2200,7 @@ GLSL
 */
 
 void GLSL_InitGPUShaders(void);
+void GLSL_Benchmark_f(void);
 void GLSL_ShutdownGPUShaders(void);
 void GLSL_VertexAttribPointers(uint32_t attribBits);
 void GLSL_BindProgram(shaderProgram_t * program);
@@ -2174,6 +2212,7 @@ void GLSL_SetUniformVec2(shaderProgram_t *program, int uniformNum, const vec2_t
 void GLSL_SetUniformVec3(shaderProgram_t *program, int uniformNum, const vec3_t v);
 void GLSL_SetUniformVec4(shaderProgram_t *program, int uniformNum, const vec4_t v);
 void GLSL_SetUniformMat4(shaderProgram_t *program, int uniformNum, const float matrix[16]);
+void GLSL_SetUniformMat4BoneMatrix(shaderProgram_t *program, int uniformNum, float (*matrix)[16], int numMatricies);
 
 shaderProgram_t *GLSL_GetGenericShaderProgram(int stage);
 
@@ -2228,6 +2267,7 @@ void RB_MDRSurfaceAnim( mdrSurface_t *surface );
 qboolean R_LoadIQM (model_t *mod, void *buffer, int filesize, const char *name );
 void R_AddIQMSurfaces( trRefEntity_t *ent );
 void RB_IQMSurfaceAnim( surfaceType_t *surface );
+void RB_SurfaceVaoIQM( srfVaoIQModel_t *surface );
 int R_IQMLerpTag( orientation_t *tag, iqmData_t *data,
                   int startFrame, int endFrame,
                   float frac, const char *tagName );
@@ -126,6 +126,176 @@ static void Matrix34Invert( float *inMat, float *outMat )
 	outMat[11] = -DotProduct(outMat + 8, trans);
 }
 
+/*
+=================
+R_CreateIQMVaos
+
+Upload the bind pose of every surface with the blend indexes and
+weights, the vertex shader does the skinning
+=================
+*/
+static void R_CreateIQMVaos( iqmData_t *data ) {
+	srfIQModel_t	*surf;
+	srfVaoIQModel_t	*vaoSurf;
+	int		i, j, k;
+
+	// one extra bone slot holds the identity for unweighted vertexes
+	if ( !glRefConfig.glslMaxAnimatedBones || data->num_joints + 1 > glRefConfig.glslMaxAnimatedBones )
+		return;
+
+	// ComputePoseMats fills one matrix per pose
+	if ( data->num_poses && data->num_poses != data->num_joints )
+		return;
+
+	data->vaoSurfaces = ri.Hunk_Alloc( sizeof( *data->vaoSurfaces ) * data->num_surfaces, h_low );
+
+	surf = data->surfaces;
+	vaoSurf = data->vaoSurfaces;
+	for ( i = 0; i < data->num_surfaces; i++, surf++, vaoSurf++ ) {
+		uint32_t offset_xyz, offset_st, offset_normal, offset_tangent;
+		uint32_t offset_color, offset_boneIndexes, offset_boneWeights, stride;
+		uint32_t dataSize, dataOfs;
+		uint8_t *vertexes;
+		glIndex_t *indexes;
+		int *tri;
+
+		offset_xyz         = 0;
+		offset_st          = offset_xyz + sizeof( vec3_t );
+		offset_normal      = offset_st + sizeof( vec2_t );
+		offset_tangent     = offset_normal + sizeof( int16_t ) * 4;
+		offset_color       = offset_tangent + sizeof( int16_t ) * 4;
+		offset_boneIndexes = offset_color + sizeof( uint16_t ) * 4;
+		offset_boneWeights = offset_boneIndexes + sizeof( byte ) * 4;
+		stride             = offset_boneWeights + sizeof( float ) * 4;
+
+		dataSize = surf->num_vertexes * stride;
+		vertexes = ri.Malloc( dataSize );
+		indexes = ri.Malloc( surf->num_triangles * 3 * sizeof( *indexes ) );
+		dataOfs = 0;
+
+		for ( j = 0; j < surf->num_vertexes; j++ ) {
+			int	vtx = j + surf->first_vertex;
+			int16_t	normal[4], tangent[4];
+			uint16_t	color[4];
+			byte	boneIndexes[4];
+			float	boneWeights[4];
+			vec3_t	n;
+			vec4_t	t;
+
+			VectorCopy( &data->normals[3*vtx], n );
+			R_VaoPackNormal( normal, n );
+			VectorCopy4( &data->tangents[4*vtx], t );
+			R_VaoPackTangent( tangent, t );
+
+			for ( k = 0; k < 4; k++ )
+				color[k] = data->colors[4*vtx + k] * 257;
+
+			// same weights RB_IQMSurfaceAnim uses, it stops at the first empty one
+			memset( boneIndexes, 0, sizeof( boneIndexes ) );
+			memset( boneWeights, 0, sizeof( boneWeights ) );
+			for ( k = 0; k < 4; k++ ) {
+				float weight;
+
+				if ( data->blendWeightsType == IQM_FLOAT )
+					weight = data->blendWeights.f[4*vtx + k];
+				else
+					weight = (float)data->blendWeights.b[4*vtx + k] / 255.0f;
+
+				if ( weight <= 0 )
+					break;
+
+				boneIndexes[k] = data->blendIndexes[4*vtx + k];
+				boneWeights[k] = weight;
+			}
+
+			if ( data->num_poses == 0 || k == 0 ) {
+				boneIndexes[0] = data->num_joints;
+				boneWeights[0] = 1.0f;
+				for ( k = 1; k < 4; k++ ) {
+					boneIndexes[k] = 0;
+					boneWeights[k] = 0.0f;
+				}
+			}
+
+			memcpy( vertexes + dataOfs, &data->positions[3*vtx], sizeof( vec3_t ) );
+			dataOfs += sizeof( vec3_t );
+			memcpy( vertexes + dataOfs, &data->texcoords[2*vtx], sizeof( vec2_t ) );
+			dataOfs += sizeof( vec2_t );
+			memcpy( vertexes + dataOfs, normal, sizeof( normal ) );
+			dataOfs += sizeof( normal );
+			memcpy( vertexes + dataOfs, tangent, sizeof( tangent ) );
+			dataOfs += sizeof( tangent );
+			memcpy( vertexes + dataOfs, color, sizeof( color ) );
+			dataOfs += sizeof( color );
+			memcpy( vertexes + dataOfs, boneIndexes, sizeof( boneIndexes ) );
+			dataOfs += sizeof( boneIndexes );
+			memcpy( vertexes + dataOfs, boneWeights, sizeof( boneWeights ) );
+			dataOfs += sizeof( boneWeights );
+		}
+
+		tri = data->triangles + 3 * surf->first_triangle;
+		for ( j = 0; j < surf->num_triangles * 3; j++ )
+			indexes[j] = tri[j] - surf->first_vertex;
+
+		vaoSurf->surfaceType = SF_VAO_IQM;
+		vaoSurf->iqmData = data;
+		vaoSurf->iqmSurface = surf;
+		vaoSurf->numIndexes = surf->num_triangles * 3;
+		vaoSurf->numVerts = surf->num_vertexes;
+
+		vaoSurf->vao = R_CreateVao( va( "staticIQMMesh_VAO '%s'", surf->name ), vertexes, dataSize,
+			(byte *)indexes, vaoSurf->numIndexes * sizeof( *indexes ), VAO_USAGE_STATIC );
+
+		vaoSurf->vao->attribs[ATTR_INDEX_POSITION    ].enabled = 1;
+		vaoSurf->vao->attribs[ATTR_INDEX_TEXCOORD    ].enabled = 1;
+		vaoSurf->vao->attribs[ATTR_INDEX_NORMAL      ].enabled = 1;
+		vaoSurf->vao->attribs[ATTR_INDEX_TANGENT     ].enabled = 1;
+		vaoSurf->vao->attribs[ATTR_INDEX_COLOR       ].enabled = 1;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_INDEXES].enabled = 1;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_WEIGHTS].enabled = 1;
+
+		vaoSurf->vao->attribs[ATTR_INDEX_POSITION    ].count = 3;
+		vaoSurf->vao->attribs[ATTR_INDEX_TEXCOORD    ].count = 2;
+		vaoSurf->vao->attribs[ATTR_INDEX_NORMAL      ].count = 4;
+		vaoSurf->vao->attribs[ATTR_INDEX_TANGENT     ].count = 4;
+		vaoSurf->vao->attribs[ATTR_INDEX_COLOR       ].count = 4;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_INDEXES].count = 4;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_WEIGHTS].count = 4;
+
+		vaoSurf->vao->attribs[ATTR_INDEX_POSITION    ].type = GL_FLOAT;
+		vaoSurf->vao->attribs[ATTR_INDEX_TEXCOORD    ].type = GL_FLOAT;
+		vaoSurf->vao->attribs[ATTR_INDEX_NORMAL      ].type = GL_SHORT;
+		vaoSurf->vao->attribs[ATTR_INDEX_TANGENT     ].type = GL_SHORT;
+		vaoSurf->vao->attribs[ATTR_INDEX_COLOR       ].type = GL_UNSIGNED_SHORT;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_INDEXES].type = GL_UNSIGNED_BYTE;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_WEIGHTS].type = GL_FLOAT;
+
+		vaoSurf->vao->attribs[ATTR_INDEX_POSITION    ].normalized = GL_FALSE;
+		vaoSurf->vao->attribs[ATTR_INDEX_TEXCOORD    ].normalized = GL_FALSE;
+		vaoSurf->vao->attribs[ATTR_INDEX_NORMAL      ].normalized = GL_TRUE;
+		vaoSurf->vao->attribs[ATTR_INDEX_TANGENT     ].normalized = GL_TRUE;
+		vaoSurf->vao->attribs[ATTR_INDEX_COLOR       ].normalized = GL_TRUE;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_INDEXES].normalized = GL_FALSE;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_WEIGHTS].normalized = GL_FALSE;
+
+		vaoSurf->vao->attribs[ATTR_INDEX_POSITION    ].offset = offset_xyz;
+		vaoSurf->vao->attribs[ATTR_INDEX_TEXCOORD    ].offset = offset_st;
+		vaoSurf->vao->attribs[ATTR_INDEX_NORMAL      ].offset = offset_normal;
+		vaoSurf->vao->attribs[ATTR_INDEX_TANGENT     ].offset = offset_tangent;
+		vaoSurf->vao->attribs[ATTR_INDEX_COLOR       ].offset = offset_color;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_INDEXES].offset = offset_boneIndexes;
+		vaoSurf->vao->attribs[ATTR_INDEX_BONE_WEIGHTS].offset = offset_boneWeights;
+
+		for ( k = 0; k < ATTR_INDEX_COUNT; k++ )
+			vaoSurf->vao->attribs[k].stride = stride;
+
+		Vao_SetVertexPointers( vaoSurf->vao );
+
+		ri.Free( indexes );
+		ri.Free( vertexes );
+	}
+}
+
 /*
 =================
 R_LoadIQM
@@ -736,6 +906,8 @@ qboolean R_LoadIQM( model_t *mod, void *buffer, int filesize, const char *mod_na
 		}
 	}
 
+	R_CreateIQMVaos( iqmData );
+
 	return qtrue;
 }
 
@@ -937,7 +1109,10 @@ void R_AddIQMSurfaces( trRefEntity_t *ent ) {
 		}
 
 		if( !personalModel ) {
-			R_AddDrawSurf( (void *)surface, shader, fogNum, 0, 0, cubemapIndex );
+			if ( data->vaoSurfaces )
+				R_AddDrawSurf( (void *)&data->vaoSurfaces[i], shader, fogNum, 0, 0, cubemapIndex );
+			else
+				R_AddDrawSurf( (void *)surface, shader, fogNum, 0, 0, cubemapIndex );
 		}
 
 		surface++;
@@ -1156,6 +1331,68 @@ void RB_IQMSurfaceAnim( surfaceType_t *surface ) {
 	tess.numVertexes += surf->num_vertexes;
 }
 
+/*
+=================
+RB_SurfaceVaoIQM
+
+Draw the static VAO, only the bone matrices change per entity
+=================
+*/
+void RB_SurfaceVaoIQM( srfVaoIQModel_t *surface ) {
+	iqmData_t	*data = surface->iqmData;
+	float		jointMats[( IQM_MAX_JOINTS + 1 ) * 12];	// and the identity slot
+	int		i;
+
+	int	frame = data->num_frames ? backEnd.currentEntity->e.frame % data->num_frames : 0;
+	int	oldframe = data->num_frames ? backEnd.currentEntity->e.oldframe % data->num_frames : 0;
+	float	backlerp = backEnd.currentEntity->e.backlerp;
+
+	if ( ShaderRequiresCPUDeforms( tess.shader ) ) {
+		RB_IQMSurfaceAnim( &surface->iqmSurface->surfaceType );
+		return;
+	}
+
+	if ( !surface->vao )
+		return;
+
+	RB_EndSurface();
+	RB_BeginSurface( tess.shader, tess.fogNum, tess.cubemapIndex );
+
+	R_BindVao( surface->vao );
+
+	tess.useInternalVao = qfalse;
+
+	tess.numIndexes = surface->numIndexes;
+	tess.numVertexes = surface->numVerts;
+
+	if ( data->num_poses > 0 ) {
+		ComputePoseMats( data, frame, oldframe, backlerp, jointMats );
+	} else {
+		for ( i = 0; i < data->num_joints; i++ )
+			memcpy( jointMats + 12 * i, identityMatrix, sizeof( identityMatrix ) );
+	}
+
+	// 3x4 row major to 4x4 column major, the last slot is the identity
+	// for vertexes without blend weights
+	memcpy( jointMats + 12 * data->num_joints, identityMatrix, sizeof( identityMatrix ) );
+
+	for ( i = 0; i <= data->num_joints; i++ ) {
+		float *in = jointMats + 12 * i;
+		float *out = glState.boneMatrix[i];
+
+		out[ 0] = in[0]; out[ 4] = in[1]; out[ 8] = in[ 2]; out[12] = in[ 3];
+		out[ 1] = in[4]; out[ 5] = in[5]; out[ 9] = in[ 6]; out[13] = in[ 7];
+		out[ 2] = in[8]; out[ 6] = in[9]; out[10] = in[10]; out[14] = in[11];
+		out[ 3] = 0.0f;  out[ 7] = 0.0f;  out[11] = 0.0f;   out[15] = 1.0f;
+	}
+
+	glState.boneAnimation = data->num_joints + 1;
+
+	RB_EndSurface();
+
+	glState.boneAnimation = 0;
+}
+
 int R_IQMLerpTag( orientation_t *tag, iqmData_t *data,
 		  int startFrame, int endFrame, 
 		  float frac, const char *tagName ) {
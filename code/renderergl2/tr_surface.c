@@ -1442,4 +1442,5 @@ void (*rb_surfaceTable[SF_NUM_SURFACE_TYPES])( void *) =
 	(void(*)(void*))RB_SurfaceFlare,		// SF_FLARE,
 	(void(*)(void*))RB_SurfaceEntity,		// SF_ENTITY
 	(void(*)(void*))RB_SurfaceVaoMdvMesh,   // SF_VAO_MDVMESH
+	(void(*)(void*))RB_SurfaceVaoIQM,       // SF_VAO_IQM
 };
@@ -348,6 +348,7 @@ void R_BindVao(vao_t * vao)
 
 		glState.vertexAttribsInterpolation = 0;
 		glState.vertexAnimation = qfalse;
+		glState.boneAnimation = 0;
 		backEnd.pc.c_vaoBinds++;
 
 		if (glRefConfig.vertexArrayObject)
@@ -397,6 +397,116 @@ void SNDDMA_BeginPainting (void)
 	SDL_LockAudioDevice(sdlPlaybackDevice);
 }
 
+typedef struct {
+	SDL_Thread *thread;
+	SDL_mutex *mutex;
+	SDL_atomic_t quit;
+	void (*func)( void );
+	int msec;
+} sndThreadState_t;
+
+static sndThreadState_t sndThreads[SND_NUM_THREADS];
+static const char *sndThreadNames[SND_NUM_THREADS] = { "mixer", "sound decode" };
+
+/*
+===============
+SNDDMA_ThreadMain
+===============
+*/
+static int SNDDMA_ThreadMain(void *arg)
+{
+	sndThreadState_t *t = arg;
+
+	if (t == &sndThreads[SND_THREAD_MIX])
+		SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+	while (!SDL_AtomicGet(&t->quit))
+	{
+		t->func();
+		SDL_Delay(t->msec);
+	}
+
+	return 0;
+}
+
+/*
+===============
+SNDDMA_StartThread
+===============
+*/
+qboolean SNDDMA_StartThread(sndThread_t thread, void (*func)(void), int msec)
+{
+	sndThreadState_t *t = &sndThreads[thread];
+
+	SNDDMA_StopThread(thread);
+
+	t->mutex = SDL_CreateMutex();
+	if (t->mutex == NULL)
+	{
+		Com_Printf("SDL_CreateMutex() failed: %s\n", SDL_GetError());
+		return qfalse;
+	}
+
+	t->func = func;
+	t->msec = msec;
+	SDL_AtomicSet(&t->quit, 0);
+
+	t->thread = SDL_CreateThread(SNDDMA_ThreadMain, sndThreadNames[thread], t);
+	if (t->thread == NULL)
+	{
+		Com_Printf("SDL_CreateThread() failed: %s\n", SDL_GetError());
+		SNDDMA_StopThread(thread);
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+/*
+===============
+SNDDMA_StopThread
+===============
+*/
+void SNDDMA_StopThread(sndThread_t thread)
+{
+	sndThreadState_t *t = &sndThreads[thread];
+
+	if (t->thread != NULL)
+	{
+		SDL_AtomicSet(&t->quit, 1);
+		SDL_WaitThread(t->thread, NULL);
+		t->thread = NULL;
+	}
+
+	if (t->mutex != NULL)
+	{
+		SDL_DestroyMutex(t->mutex);
+		t->mutex = NULL;
+	}
+}
+
+/*
+===============
+SNDDMA_LockThread
+===============
+*/
+void SNDDMA_LockThread(sndThread_t thread)
+{
+	if (sndThreads[thread].mutex != NULL)
+		SDL_LockMutex(sndThreads[thread].mutex);
+}
+
+/*
+===============
+SNDDMA_UnlockThread
+===============
+*/
+void SNDDMA_UnlockThread(sndThread_t thread)
+{
+	if (sndThreads[thread].mutex != NULL)
+		SDL_UnlockMutex(sndThreads[thread].mutex);
+}
+
 
 #ifdef USE_VOIP
 void SNDDMA_StartCapture(void)
@@ -244,6 +244,30 @@ void SNDDMA_Submit( void )
 }
 
 
+qboolean SNDDMA_StartThread( sndThread_t thread, void (*func)( void ), int msec )
+{
+	return qfalse;
+}
+
+
+void SNDDMA_StopThread( sndThread_t thread )
+{
+
+}
+
+
+void SNDDMA_LockThread( sndThread_t thread )
+{
+
+}
+
+
+void SNDDMA_UnlockThread( sndThread_t thread )
+{
+
+}
+
+
 static void UnloadLibs( void )
 {
 #ifndef USE_ALSA_STATIC
@@ -1646,6 +1646,53 @@ static qboolean SV_ClientCommand( client_t *cl, msg_t *msg ) {
 //==================================================================================
 
 
+/*
+==================
+SV_SetClientTraceRegion
+
+Set up the collision trace region around everywhere the client
+can get to while running this usercmd
+==================
+*/
+#define	TRACE_REGION_MARGIN		64
+#define	TRACE_REGION_MAX_REACH	512
+
+static void SV_SetClientTraceRegion( client_t *cl, usercmd_t *cmd ) {
+	playerState_t	*ps;
+	sharedEntity_t	*ent;
+	vec3_t			mins, maxs, extents;
+	float			reach, center;
+	int				i, msec;
+
+	ps = SV_GameClientNum( cl - svs.clients );
+	ent = SV_GentityNum( cl - svs.clients );
+
+	msec = cmd->serverTime - ps->commandTime;
+	if ( msec < 0 ) {
+		msec = 0;
+	} else if ( msec > 1000 ) {
+		msec = 1000;
+	}
+
+	// gravity and a jump can add a few hundred units per second
+	reach = TRACE_REGION_MARGIN + ( VectorLength( ps->velocity ) + 1000 ) * msec * 0.001f;
+	if ( reach > TRACE_REGION_MAX_REACH ) {
+		CM_ClearTraceRegion();
+		return;
+	}
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		center = ps->origin[i] + ( ent->r.mins[i] + ent->r.maxs[i] ) * 0.5f;
+		mins[i] = center - reach;
+		maxs[i] = center + reach;
+		extents[i] = ( ent->r.maxs[i] - ent->r.mins[i] ) * 0.5f;
+	}
+	// standing up from a crouch traces a taller box
+	extents[2] += 8;
+
+	CM_SetTraceRegion( mins, maxs, extents );
+}
+
 /*
 ==================
 SV_ClientThink
@@ -1660,7 +1707,9 @@ void SV_ClientThink (client_t *cl, usercmd_t *cmd) {
 		return;		// may have been kicked during the last usercmd
 	}
 
+	SV_SetClientTraceRegion( cl, cmd );
 	VM_Call( gvm, GAME_CLIENT_THINK, cl - svs.clients );
+	CM_ClearTraceRegion();
 }
 
 /*
@@ -33,6 +33,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/time.h>
+#include <time.h>
 #include <pwd.h>
 #include <libgen.h>
 #include <fcntl.h>
@@ -261,6 +262,60 @@ int Sys_Milliseconds (void)
 	return curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+int64_t Sys_Microseconds( void )
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	if ( clock_gettime( CLOCK_MONOTONIC, &ts ) == 0 )
+		return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+	{
+		struct timeval tp;
+
+		gettimeofday( &tp, NULL );
+		return (int64_t)tp.tv_sec * 1000000 + tp.tv_usec;
+	}
+}
+
+/*
+================
+Sys_ResidentMemory
+================
+*/
+int Sys_ResidentMemory( void )
+{
+#ifdef __linux__
+	static int fd = -2;
+	char buf[64];
+	long pages, resident;
+	int n;
+
+	// kept open, it is read every frame of a benchmark
+	if ( fd == -2 )
+		fd = open( "/proc/self/statm", O_RDONLY );
+	if ( fd < 0 )
+		return -1;
+
+	n = pread( fd, buf, sizeof( buf ) - 1, 0 );
+	if ( n <= 0 )
+		return -1;
+	buf[n] = '\0';
+
+	if ( sscanf( buf, "%ld %ld", &pages, &resident ) != 2 )
+		return -1;
+
+	return resident * ( sysconf( _SC_PAGESIZE ) / 1024 );
+#else
+	return -1;
+#endif
+}
+
 /*
 ==================
 Sys_RandomBytes
@@ -200,6 +200,40 @@ int Sys_Milliseconds (void)
 	return sys_curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+int64_t Sys_Microseconds( void )
+{
+	static LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+
+	if ( !frequency.QuadPart )
+		QueryPerformanceFrequency( &frequency );
+
+	QueryPerformanceCounter( &counter );
+
+	return counter.QuadPart / frequency.QuadPart * 1000000 +
+		counter.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart;
+}
+
+/*
+================
+Sys_ResidentMemory
+================
+*/
+int Sys_ResidentMemory( void )
+{
+	PROCESS_MEMORY_COUNTERS counters;
+
+	if ( !GetProcessMemoryInfo( GetCurrentProcess(), &counters, sizeof( counters ) ) )
+		return -1;
+
+	return counters.WorkingSetSize / 1024;
+}
+
 /*
 ================
 Sys_RandomBytes
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Compares benchmark results to a baseline and flags regressions.
+
+usage: compare.py [options] <baseline> <results>
+
+Both are either a single .json written by the benchmark command or a
+directory of them as run_benchmark.sh leaves it, configurations and demos
+are matched by name. A metric regresses when it got worse by more than
+the threshold in percent and by more than a noise floor, 0.05 ms for the
+times and 4 MB for the resident size, which keeps the sub-millisecond
+parts from flagging on timer jitter. The exit status is 1 when anything
+regressed or went missing from the results.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+# metric, how to get it from a demo's result, whether higher is better
+METRICS = [
+    ("fps", lambda d: d["fps"], True),
+    ("frame mean", lambda d: d["frame_ms"]["mean"], False),
+    ("frame median", lambda d: d["frame_ms"]["median"], False),
+    ("frame p95", lambda d: d["frame_ms"]["p95"], False),
+    ("frame p99", lambda d: d["frame_ms"]["p99"], False),
+    ("cgame", lambda d: d["cgame_ms"], False),
+    ("front end", lambda d: d["frontend_ms"], False),
+    ("back end", lambda d: d["backend_ms"], False),
+    ("swap", lambda d: d["swap_ms"], False),
+    ("resident MB", lambda d: d["resident_peak_kb"] / 1024.0, False),
+]
+
+
+def load(path):
+    """Returns {configuration name: summary}."""
+    if os.path.isdir(path):
+        files = sorted(os.path.join(path, f) for f in os.listdir(path)
+                       if f.endswith(".json"))
+    else:
+        files = [path]
+
+    runs = {}
+    for f in files:
+        with open(f) as fp:
+            run = json.load(fp)
+        runs[run["name"]] = run
+    return runs
+
+
+def compare_demo(base, new, threshold, noise, memory):
+    """Yields (metric, baseline, result, change in percent, regressed)."""
+    for name, get, higher_better in METRICS:
+        try:
+            b, n = get(base), get(new)
+        except (KeyError, TypeError):
+            continue
+        if b < 0 or n < 0:
+            continue
+
+        change = (n - b) / b * 100.0 if b else 0.0
+        pct = -change if higher_better else change
+
+        if name == "fps":
+            # the noise floor is in ms, fps go by their frame times
+            worse = 1000.0 / n - 1000.0 / b if n and b else 0.0
+            floor = noise
+        elif name == "resident MB":
+            worse = n - b
+            floor = memory
+        else:
+            worse = n - b
+            floor = noise
+
+        yield name, b, n, change, pct > threshold and worse > floor
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n")[0])
+    parser.add_argument("baseline")
+    parser.add_argument("results")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="percent a metric may get worse, 5 by default")
+    parser.add_argument("-n", "--noise", type=float, default=0.05,
+                        help="ms a time may get worse regardless, "
+                        "0.05 by default")
+    parser.add_argument("-m", "--memory", type=float, default=4.0,
+                        help="MB the resident size may grow regardless, "
+                        "4 by default")
+    parser.add_argument("-q", "--quiet", action="store_true",
+                        help="only print the regressions")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    results = load(args.results)
+    regressions = 0
+
+    for config in sorted(baseline):
+        if config not in results:
+            print("%s: missing from the results" % config)
+            regressions += 1
+            continue
+
+        base_run, new_run = baseline[config], results[config]
+        if not new_run.get("completed", False):
+            print("%s: didn't finish" % config)
+            regressions += 1
+
+        for key in ("renderer", "driver", "width", "height"):
+            if base_run.get(key) != new_run.get(key):
+                print("%s: %s changed from %r to %r, the numbers may not compare"
+                      % (config, key, base_run.get(key), new_run.get(key)))
+
+        new_demos = dict((d["demo"], d) for d in new_run["demos"])
+        for base_demo in base_run["demos"]:
+            demo = base_demo["demo"]
+            if demo not in new_demos:
+                print("%s %s: missing from the results" % (config, demo))
+                regressions += 1
+                continue
+
+            if not args.quiet:
+                print("%s %s:" % (config, demo))
+
+            for name, b, n, change, regressed in compare_demo(
+                    base_demo, new_demos[demo], args.threshold, args.noise,
+                    args.memory):
+                if regressed:
+                    regressions += 1
+                    if args.quiet:
+                        print("%s %s: %s %.3f -> %.3f (%+.1f%%) REGRESSION"
+                              % (config, demo, name, b, n, change))
+                        continue
+                if not args.quiet:
+                    print("  %-14s %10.3f %10.3f %+7.1f%%%s"
+                          % (name, b, n, change,
+                             "  REGRESSION" if regressed else ""))
+
+    for config in sorted(set(results) - set(baseline)):
+        print("%s: not in the baseline" % config)
+
+    if regressions:
+        print("%d regressions" % regressions)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
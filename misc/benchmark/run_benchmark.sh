@@ -0,0 +1,143 @@
+#!/bin/sh
+# Plays a set of demos with the benchmark command, once for every
+# configuration in a configurations file, and collects the results.
+#
+# usage: run_benchmark.sh [options] <demo> [<demo> ...]
+#   -e <client>     the client to run, ./openarena.x86_64 by default
+#   -b <basepath>   fs_basepath, where baseoa and the demos are
+#   -c <file>       the configurations, configs.txt next to this script by default
+#   -o <dir>        where the results go, benchmark-results by default
+#   -r <w>x<h>      the resolution, 1280x720 by default
+#   -t <seconds>    time limit of a configuration, 1800 by default
+#   -g              use the GPU and the display instead of Mesa's llvmpipe
+#                   and lavapipe
+#
+# Demos are named as for the demo command, relative to demos/. Every
+# configuration gets a fresh fs_homepath, so a q3config.cfg can't change
+# the results. The GL renderers are run on llvmpipe and the vulkan one on
+# lavapipe unless -g is given, through xvfb-run when there is no DISPLAY,
+# so the numbers can be taken on machines without a GPU. LP_NUM_THREADS is
+# passed on, pin it for results that compare across machines.
+#
+# The results are <dir>/<configuration>.json and the per frame logs
+# <dir>/<configuration>/<demo>.csv, compare.py checks them against a
+# baseline. The exit status is 1 when a configuration didn't finish.
+
+ENGINE=./openarena.x86_64
+BASEPATH=
+CONFIGS=$(dirname "$0")/configs.txt
+OUT=benchmark-results
+RESOLUTION=1280x720
+TIMEOUT=1800
+SOFTWARE=1
+
+usage()
+{
+	sed -n '5,13p' "$0" | sed 's/^# \{0,1\}//' >&2
+	exit 2
+}
+
+while getopts "e:b:c:o:r:t:g" opt; do
+	case $opt in
+	e) ENGINE=$OPTARG ;;
+	b) BASEPATH=$OPTARG ;;
+	c) CONFIGS=$OPTARG ;;
+	o) OUT=$OPTARG ;;
+	r) RESOLUTION=$OPTARG ;;
+	t) TIMEOUT=$OPTARG ;;
+	g) SOFTWARE=0 ;;
+	*) usage ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+[ $# -gt 0 ] || usage
+
+if [ ! -x "$ENGINE" ]; then
+	echo "$ENGINE is not an executable, give the client with -e" >&2
+	exit 2
+fi
+if [ ! -r "$CONFIGS" ]; then
+	echo "can't read $CONFIGS" >&2
+	exit 2
+fi
+
+WIDTH=${RESOLUTION%x*}
+HEIGHT=${RESOLUTION#*x}
+
+mkdir -p "$OUT" || exit 2
+OUT=$(cd "$OUT" && pwd)
+
+if [ "$SOFTWARE" = 1 ]; then
+	LIBGL_ALWAYS_SOFTWARE=1
+	GALLIUM_DRIVER=llvmpipe
+	export LIBGL_ALWAYS_SOFTWARE GALLIUM_DRIVER
+
+	for icd in /usr/share/vulkan/icd.d/lvp_icd.*.json /etc/vulkan/icd.d/lvp_icd.*.json; do
+		if [ -r "$icd" ]; then
+			VK_ICD_FILENAMES=$icd
+			VK_DRIVER_FILES=$icd
+			export VK_ICD_FILENAMES VK_DRIVER_FILES
+			break
+		fi
+	done
+fi
+
+XVFB=
+if [ -z "$DISPLAY" ]; then
+	if ! command -v xvfb-run >/dev/null; then
+		echo "no DISPLAY and no xvfb-run to make one" >&2
+		exit 2
+	fi
+	XVFB="xvfb-run -a -s \"-screen 0 ${WIDTH}x${HEIGHT}x24\""
+fi
+
+TIMER=
+if command -v timeout >/dev/null; then
+	TIMER="timeout $TIMEOUT"
+fi
+
+failed=0
+
+# name renderer [engine arguments ...]
+while read -r name renderer args; do
+	case $name in
+	""|\#*) continue ;;
+	esac
+
+	echo "== $name ($renderer)"
+
+	home=$OUT/.home-$name
+	rm -rf "$home"
+	mkdir -p "$home"
+
+	eval "$XVFB $TIMER \"\$ENGINE\" \
+		${BASEPATH:++set fs_basepath \"\$BASEPATH\"} \
+		+set fs_homepath \"\$home\" \
+		+set cl_renderer \"\$renderer\" \
+		+set r_fullscreen 0 +set r_mode -1 \
+		+set r_customwidth $WIDTH +set r_customheight $HEIGHT \
+		+set r_swapInterval 0 +set com_maxfps 0 \
+		+set s_initsound 0 +set in_nograb 1 +set com_introplayed 1 \
+		+set nextdemo quit \
+		$args \
+		+benchmark \"\$name\" \"\$@\"" </dev/null > "$OUT/$name.log" 2>&1
+
+	json=$(find "$home" -path "*/benchmarks/$name.json" | head -n 1)
+	if [ -z "$json" ]; then
+		echo "   no results, see $OUT/$name.log"
+		failed=1
+		continue
+	fi
+
+	cp "$json" "$OUT/$name.json"
+	rm -rf "${OUT:?}/$name"
+	cp -r "$(dirname "$json")/$name" "$OUT/$name" 2>/dev/null
+
+	if ! grep -q '"completed": true' "$OUT/$name.json"; then
+		echo "   didn't finish, see $OUT/$name.log"
+		failed=1
+	fi
+done < "$CONFIGS"
+
+exit $failed